@@ -152,6 +152,8 @@ int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name) {
 	Abc_Obj_t * obj;
 	int i, j;
 	Ace_Obj_Info_t * info;
+	int num_bdd_nodes = 0;
+	int num_sim_nodes = 0;
 
 	//Build BDD
 	Abc_NtkSopToBdd(ntk);
@@ -283,21 +285,36 @@ int ace_calc_activity(Abc_Ntk_t * ntk, int num_vectors, char * clk_name) {
 			info2->switch_act = 0.0;
 			continue;
 		} else {
-			Vec_Ptr_t * literals = Vec_PtrAlloc(0);
-			Abc_Obj_t * fanin;
+			int n0 = 0;
+			int n1 = 0;
 
 			VTR_ASSERT(obj->Type == ABC_OBJ_NODE);
 
-			Abc_ObjForEachFanin(obj, fanin, j)
-			{
-				Vec_PtrPush(literals, fanin);
+			if (!ace_bdd_count_paths_limited((DdManager*)ntk->pManFunc,
+					(DdNode*) obj->pData, &n1, &n0, ACE_MAX_BDD_PATHS)) {
+				/* Too many paths to walk (e.g. wide XOR logic), fall back to
+				 * the (zero delay) activity found by the simulation */
+				info2->switch_act = info2->switch_prob;
+				num_sim_nodes++;
+			} else {
+				Vec_Ptr_t * literals = Vec_PtrAlloc(0);
+				Abc_Obj_t * fanin;
+
+				Abc_ObjForEachFanin(obj, fanin, j)
+				{
+					Vec_PtrPush(literals, fanin);
+				}
+				info2->switch_act = ace_bdd_calc_switch_act((DdManager*)ntk->pManFunc, obj,
+						literals);
+				Vec_PtrFree(literals);
+				num_bdd_nodes++;
 			}
-			info2->switch_act = ace_bdd_calc_switch_act((DdManager*)ntk->pManFunc, obj,
-					literals);
-			Vec_PtrFree(literals);
 		}
 		VTR_ASSERT(info2->switch_act >= 0);
 	}
+	printf("%d nodes computed from BDDs, %d nodes from simulation (over %d BDD paths)\n",
+			num_bdd_nodes, num_sim_nodes, ACE_MAX_BDD_PATHS);
+	fflush(0);
     Vec_PtrFree(nodes_logic);
     Vec_PtrFree(nodes_all);
     Vec_PtrFree(latches_in_cycles_vec);
@@ -31,6 +31,7 @@
 
 #define ACE_CHAR_BUFFER_SIZE 	4096
 #define ACE_NUM_VECTORS			5000
+#define ACE_MAX_BDD_PATHS		100000	/* Nodes with more BDD paths use their simulated activity */
 
 typedef enum {
 	ACE_VEC, ACE_ACT, ACE_PD, ACE_CODED
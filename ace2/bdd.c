@@ -75,6 +75,34 @@ void ace_bdd_count_paths(DdManager * mgr, DdNode * bdd, int * num_one_paths,
 
 }
 
+/* Same as ace_bdd_count_paths, but gives up (returning FALSE) once there are more
+ * than max_paths paths, as the switching activity calculation walks every path */
+bool ace_bdd_count_paths_limited(DdManager * mgr, DdNode * bdd,
+		int * num_one_paths, int * num_zero_paths, int max_paths) {
+	if (*num_one_paths + *num_zero_paths > max_paths) {
+		return FALSE;
+	}
+
+	if (bdd == Cudd_ReadLogicZero(mgr)) {
+		*num_zero_paths = *num_zero_paths + 1;
+		return TRUE;
+	} else if (bdd == Cudd_ReadOne(mgr)) {
+		*num_one_paths = *num_one_paths + 1;
+		return TRUE;
+	}
+
+	if (!ace_bdd_count_paths_limited(mgr, Cudd_T(bdd), num_one_paths,
+			num_zero_paths, max_paths)) {
+		return FALSE;
+	}
+	if (!ace_bdd_count_paths_limited(mgr, Cudd_E(bdd), num_one_paths,
+			num_zero_paths, max_paths)) {
+		return FALSE;
+	}
+
+	return *num_one_paths + *num_zero_paths <= max_paths;
+}
+
 #if 0
 int ace_bdd_build_network_bdds(
 		Abc_Ntk_t * ntk,
@@ -17,6 +17,9 @@ void ace_bdd_get_literals(Abc_Ntk_t * ntk, st__table ** lit_st_table,
 int ace_bdd_build_network_bdds(Abc_Ntk_t * ntk, st__table * leaves,
 		Vec_Ptr_t * inputs, int max_size, double min_Prob);
 
+bool ace_bdd_count_paths_limited(DdManager * mgr, DdNode * bdd,
+		int * num_one_paths, int * num_zero_paths, int max_paths);
+
 double ace_bdd_calc_switch_act(DdManager * mgr, Abc_Obj_t * obj,
 		Vec_Ptr_t * fanins);
 
@@ -1,3 +1,5 @@
+#include <stdint.h>
+
 #include "vtr_assert.h"
 
 #include "ace.h"
@@ -6,130 +8,259 @@
 #include "bdd/cudd/cudd.h"
 #include "bdd/cudd/cuddInt.h"
 
-void get_pi_values(Abc_Ntk_t * ntk, Vec_Ptr_t * nodes, int cycle);
-int * getFaninValues(Abc_Obj_t * obj_ptr);
-ace_status_t getFaninStatus(Abc_Obj_t * obj_ptr);
-void evaluate_circuit(Abc_Ntk_t * ntk, Vec_Ptr_t * node_vec, int cycle);
-void update_FFs(Abc_Ntk_t * ntk);
+/* Nodes with at most this many fanins are evaluated from a 64-bit truth table */
+#define ACE_SIM_MAX_TABLE_FANINS 6
 
-void get_pi_values(Abc_Ntk_t * ntk, Vec_Ptr_t * /*nodes*/, int cycle) {
+/* An object of the network to simulate, with its activity info and fanins looked up once */
+typedef struct {
 	Abc_Obj_t * obj;
 	Ace_Obj_Info_t * info;
-	int i;
-	double prob0to1, prob1to0, rand_num;
+	Ace_Obj_Info_t ** fanin_infos;
+	int num_fanins;
 
-	//Vec_PtrForEachEntry(Abc_Obj_t *, nodes, obj, i)
+	bool has_truth_table;
+	uint64_t truth_table; /* bit i is the node's value when fanin j has value (i >> j) & 1 */
+} Ace_Sim_Obj_t;
+
+/* A latch, with the activity info of its input, output and the node driving its input */
+typedef struct {
+	Ace_Obj_Info_t * bi_fanin_info;
+	Ace_Obj_Info_t * bi_info;
+	Ace_Obj_Info_t * latch_info;
+	Ace_Obj_Info_t * bo_info;
+} Ace_Sim_Latch_t;
+
+typedef struct {
+	Ace_Obj_Info_t ** pi_infos;
+	int num_pis;
+
+	Ace_Sim_Obj_t * objs;
+	int num_objs;
+
+	Ace_Sim_Latch_t * latches;
+	int num_latches;
+
+	int * fanin_values;
+} Ace_Sim_t;
+
+Ace_Sim_t * ace_sim_init(Abc_Ntk_t * ntk, Vec_Ptr_t * logic_nodes);
+void ace_sim_free(Ace_Sim_t * sim);
+bool ace_sim_truth_table(Abc_Ntk_t * ntk, Abc_Obj_t * obj, int * fanin_values, uint64_t * truth_table);
+void get_pi_values(Ace_Sim_t * sim, int cycle);
+int * getFaninValues(Ace_Sim_t * sim, Ace_Sim_Obj_t * sim_obj);
+ace_status_t getFaninStatus(Ace_Sim_Obj_t * sim_obj);
+void evaluate_circuit(Abc_Ntk_t * ntk, Ace_Sim_t * sim, int cycle);
+void update_FFs(Ace_Sim_t * sim);
+
+Ace_Sim_t * ace_sim_init(Abc_Ntk_t * ntk, Vec_Ptr_t * logic_nodes) {
+	Abc_Obj_t * obj;
+	Abc_Obj_t * fanin;
+	int i, j;
+	int max_fanins = 1;
+	Ace_Sim_t * sim = (Ace_Sim_t*) calloc(1, sizeof(Ace_Sim_t));
+
+	sim->pi_infos = (Ace_Obj_Info_t**) malloc(Abc_NtkObjNum(ntk) * sizeof(Ace_Obj_Info_t*));
 	Abc_NtkForEachObj(ntk, obj, i)
 	{
-		info = Ace_ObjInfo(obj);
 		if (Abc_ObjType(obj) == ABC_OBJ_PI) {
-			if (info->values) {
-				if (info->status == ACE_UNDEF) {
-					info->status = ACE_NEW;
+			sim->pi_infos[sim->num_pis++] = Ace_ObjInfo(obj);
+		}
+	}
+
+	Vec_PtrForEachEntry(Abc_Obj_t*, logic_nodes, obj, i)
+	{
+		max_fanins = MAX(max_fanins, Abc_ObjFaninNum(obj));
+	}
+	sim->fanin_values = (int*) calloc(max_fanins, sizeof(int));
+
+	sim->num_objs = Vec_PtrSize(logic_nodes);
+	sim->objs = (Ace_Sim_Obj_t*) calloc(sim->num_objs, sizeof(Ace_Sim_Obj_t));
+	Vec_PtrForEachEntry(Abc_Obj_t*, logic_nodes, obj, i)
+	{
+		Ace_Sim_Obj_t * sim_obj = &sim->objs[i];
+
+		sim_obj->obj = obj;
+		sim_obj->info = Ace_ObjInfo(obj);
+		sim_obj->num_fanins = Abc_ObjFaninNum(obj);
+		sim_obj->fanin_infos = (Ace_Obj_Info_t**) malloc(MAX(sim_obj->num_fanins, 1) * sizeof(Ace_Obj_Info_t*));
+		Abc_ObjForEachFanin(obj, fanin, j)
+		{
+			sim_obj->fanin_infos[j] = Ace_ObjInfo(fanin);
+		}
+
+		if (Abc_ObjIsNode(obj)) {
+			sim_obj->has_truth_table = ace_sim_truth_table(ntk, obj, sim->fanin_values, &sim_obj->truth_table);
+		}
+	}
+
+	sim->latches = (Ace_Sim_Latch_t*) malloc(MAX(Abc_NtkLatchNum(ntk), 1) * sizeof(Ace_Sim_Latch_t));
+	Abc_NtkForEachLatch(ntk, obj, i)
+	{
+		Ace_Sim_Latch_t * latch = &sim->latches[sim->num_latches++];
+
+		latch->bi_fanin_info = Ace_ObjInfo(Abc_ObjFanin0(Abc_ObjFanin0(obj)));
+		latch->bi_info = Ace_ObjInfo(Abc_ObjFanin0(obj));
+		latch->bo_info = Ace_ObjInfo(Abc_ObjFanout0(obj));
+		latch->latch_info = Ace_ObjInfo(obj);
+	}
+
+	return sim;
+}
+
+void ace_sim_free(Ace_Sim_t * sim) {
+	int i;
+
+	for (i = 0; i < sim->num_objs; i++) {
+		free(sim->objs[i].fanin_infos);
+	}
+	free(sim->objs);
+	free(sim->pi_infos);
+	free(sim->latches);
+	free(sim->fanin_values);
+	free(sim);
+}
+
+/* Evaluates the function of a node with few fanins for every fanin combination, to
+ * avoid walking its BDD for every simulated cycle */
+bool ace_sim_truth_table(Abc_Ntk_t * ntk, Abc_Obj_t * obj, int * fanin_values, uint64_t * truth_table) {
+	int num_fanins = Abc_ObjFaninNum(obj);
+	int i, j;
+	DdNode * dd_node;
+
+	if (num_fanins > ACE_SIM_MAX_TABLE_FANINS) {
+		return FALSE;
+	}
+
+	*truth_table = 0;
+	for (i = 0; i < (1 << num_fanins); i++) {
+		for (j = 0; j < num_fanins; j++) {
+			fanin_values[j] = (i >> j) & 1;
+		}
+
+		dd_node = Cudd_Eval((DdManager*) ntk->pManFunc, (DdNode*) obj->pData, fanin_values);
+		VTR_ASSERT(Cudd_IsConstant(dd_node));
+		if (dd_node == Cudd_ReadOne((DdManager*) ntk->pManFunc)) {
+			*truth_table |= ((uint64_t) 1) << i;
+		} else {
+			VTR_ASSERT(dd_node == Cudd_ReadLogicZero((DdManager*) ntk->pManFunc));
+		}
+	}
+
+	return TRUE;
+}
+
+void get_pi_values(Ace_Sim_t * sim, int cycle) {
+	Ace_Obj_Info_t * info;
+	int i;
+	double prob0to1, prob1to0, rand_num;
+
+	for (i = 0; i < sim->num_pis; i++)
+	{
+		info = sim->pi_infos[i];
+		if (info->values) {
+			if (info->status == ACE_UNDEF) {
+				info->status = ACE_NEW;
+				if (info->values[cycle] == 1) {
+					info->value = 1;
+					info->num_toggles = 1;
+					info->num_ones = 1;
+				} else {
+					info->value = 0;
+					info->num_toggles = 0;
+					info->num_ones = 0;
+				}
+			} else {
+				switch (info->value) {
+				case 0:
 					if (info->values[cycle] == 1) {
 						info->value = 1;
-						info->num_toggles = 1;
-						info->num_ones = 1;
+						info->status = ACE_NEW;
+						info->num_toggles++;
+						info->num_ones++;
 					} else {
-						info->value = 0;
-						info->num_toggles = 0;
-						info->num_ones = 0;
+						info->status = ACE_OLD;
 					}
-				} else {
-					switch (info->value) {
-					case 0:
-						if (info->values[cycle] == 1) {
-							info->value = 1;
-							info->status = ACE_NEW;
-							info->num_toggles++;
-							info->num_ones++;
-						} else {
-							info->status = ACE_OLD;
-						}
-						break;
-
-					case 1:
-						if (info->values[cycle] == 0) {
-							info->value = 0;
-							info->status = ACE_NEW;
-							info->num_toggles++;
-						} else {
-							info->num_ones++;
-							info->status = ACE_OLD;
-						}
-						break;
+					break;
 
-					default:
-						printf("Bad Value\n");
-						VTR_ASSERT(0);
-						break;
+				case 1:
+					if (info->values[cycle] == 0) {
+						info->value = 0;
+						info->status = ACE_NEW;
+						info->num_toggles++;
+					} else {
+						info->num_ones++;
+						info->status = ACE_OLD;
 					}
+					break;
+
+				default:
+					printf("Bad Value\n");
+					VTR_ASSERT(0);
+					break;
+				}
+			}
+		} else {
+			prob0to1 = ACE_P0TO1(info->static_prob, info->switch_prob);
+			prob1to0 = ACE_P1TO0(info->static_prob, info->switch_prob);
+
+            //We don't need a cryptographically secure random number
+            //generator so suppress warning in coverity
+            //
+            //coverity[dont_call]
+			rand_num = (double) rand() / (double) RAND_MAX;
+
+			if (info->status == ACE_UNDEF) {
+				info->status = ACE_NEW;
+				if (rand_num < prob0to1) {
+					info->value = 1;
+					info->num_toggles = 1;
+					info->num_ones = 1;
+				} else {
+					info->value = 0;
+					info->num_toggles = 0;
+					info->num_ones = 0;
 				}
 			} else {
-				prob0to1 = ACE_P0TO1(info->static_prob, info->switch_prob);
-				prob1to0 = ACE_P1TO0(info->static_prob, info->switch_prob);
-
-                //We don't need a cryptographically secure random number
-                //generator so suppress warning in coverity
-                //
-                //coverity[dont_call]
-				rand_num = (double) rand() / (double) RAND_MAX;
-
-				if (info->status == ACE_UNDEF) {
-					info->status = ACE_NEW;
+				switch (info->value) {
+				case 0:
 					if (rand_num < prob0to1) {
 						info->value = 1;
-						info->num_toggles = 1;
-						info->num_ones = 1;
+						info->status = ACE_NEW;
+						info->num_toggles++;
+						info->num_ones++;
 					} else {
-						info->value = 0;
-						info->num_toggles = 0;
-						info->num_ones = 0;
+						info->status = ACE_OLD;
 					}
-				} else {
-					switch (info->value) {
-					case 0:
-						if (rand_num < prob0to1) {
-							info->value = 1;
-							info->status = ACE_NEW;
-							info->num_toggles++;
-							info->num_ones++;
-						} else {
-							info->status = ACE_OLD;
-						}
-						break;
+					break;
 
-					case 1:
-						if (rand_num < prob1to0) {
-							info->value = 0;
-							info->status = ACE_NEW;
-							info->num_toggles++;
-						} else {
-							info->num_ones++;
-							info->status = ACE_OLD;
-						}
-						break;
-
-					default:
-						printf("Bad value\n");
-						VTR_ASSERT(FALSE);
-						break;
+				case 1:
+					if (rand_num < prob1to0) {
+						info->value = 0;
+						info->status = ACE_NEW;
+						info->num_toggles++;
+					} else {
+						info->num_ones++;
+						info->status = ACE_OLD;
 					}
+					break;
+
+				default:
+					printf("Bad value\n");
+					VTR_ASSERT(FALSE);
+					break;
 				}
 			}
 		}
 	}
 }
 
-int * getFaninValues(Abc_Obj_t * obj_ptr) {
-	Abc_Obj_t * fanin;
-	int i;
+int * getFaninValues(Ace_Sim_t * sim, Ace_Sim_Obj_t * sim_obj) {
 	Ace_Obj_Info_t * info;
-	int * faninValues;
+	int i;
 
-	Abc_ObjForEachFanin(obj_ptr, fanin, i)
+	for (i = 0; i < sim_obj->num_fanins; i++)
 	{
-		info = Ace_ObjInfo(fanin);
+		info = sim_obj->fanin_infos[i];
 		if (info->status == ACE_UNDEF) {
 			printf("Fan-in is undefined\n");
 			VTR_ASSERT(FALSE);
@@ -138,37 +269,34 @@ int * getFaninValues(Abc_Obj_t * obj_ptr) {
 		}
 	}
 
-	if (i >= Abc_ObjFaninNum(obj_ptr)) {
+	if (i >= sim_obj->num_fanins) {
 		// inputs haven't changed
 		return NULL;
 	}
 
-	faninValues = (int*) malloc(Abc_ObjFaninNum(obj_ptr) * sizeof(int));
-	Abc_ObjForEachFanin(obj_ptr, fanin, i)
+	for (i = 0; i < sim_obj->num_fanins; i++)
 	{
-		info = Ace_ObjInfo(fanin);
-		faninValues[i] = info->value;
+		sim->fanin_values[i] = sim_obj->fanin_infos[i]->value;
 	}
 
-	return faninValues;
+	return sim->fanin_values;
 }
 
-ace_status_t getFaninStatus(Abc_Obj_t * obj_ptr) {
-	Abc_Obj_t * fanin;
-	int i;
+ace_status_t getFaninStatus(Ace_Sim_Obj_t * sim_obj) {
 	Ace_Obj_Info_t * info;
+	int i;
 
-	Abc_ObjForEachFanin(obj_ptr, fanin, i)
+	for (i = 0; i < sim_obj->num_fanins; i++)
 	{
-		info = Ace_ObjInfo(fanin);
+		info = sim_obj->fanin_infos[i];
 		if (info->status == ACE_UNDEF) {
 			return ACE_UNDEF;
 		}
 	}
 
-	Abc_ObjForEachFanin(obj_ptr, fanin, i)
+	for (i = 0; i < sim_obj->num_fanins; i++)
 	{
-		info = Ace_ObjInfo(fanin);
+		info = sim_obj->fanin_infos[i];
 		if (info->status == ACE_NEW || info->status == ACE_SIM) {
 			return ACE_NEW;
 		}
@@ -177,18 +305,21 @@ ace_status_t getFaninStatus(Abc_Obj_t * obj_ptr) {
 	return ACE_OLD;
 }
 
-void evaluate_circuit(Abc_Ntk_t * ntk, Vec_Ptr_t * node_vec, int /*cycle*/) {
+void evaluate_circuit(Abc_Ntk_t * ntk, Ace_Sim_t * sim, int /*cycle*/) {
 	Abc_Obj_t * obj;
 	Ace_Obj_Info_t * info;
-	int i;
+	int i, j;
 	int value = -1;
 	int * faninValues;
 	ace_status_t status;
 	DdNode * dd_node;
 
-	Vec_PtrForEachEntry(Abc_Obj_t*, node_vec, obj, i)
+	for (i = 0; i < sim->num_objs; i++)
 	{
-		info = Ace_ObjInfo(obj);
+		Ace_Sim_Obj_t * sim_obj = &sim->objs[i];
+
+		obj = sim_obj->obj;
+		info = sim_obj->info;
 
 		switch (Abc_ObjType(obj)) {
 		case ABC_OBJ_PI:
@@ -199,7 +330,7 @@ void evaluate_circuit(Abc_Ntk_t * ntk, Vec_Ptr_t * node_vec, int /*cycle*/) {
 		case ABC_OBJ_BI:
 		case ABC_OBJ_LATCH:
 		case ABC_OBJ_NODE:
-			status = getFaninStatus(obj);
+			status = getFaninStatus(sim_obj);
 			switch (status) {
 			case ACE_UNDEF:
 				info->status = ACE_UNDEF;
@@ -210,22 +341,27 @@ void evaluate_circuit(Abc_Ntk_t * ntk, Vec_Ptr_t * node_vec, int /*cycle*/) {
 				break;
 			case ACE_NEW:
 				if (Abc_ObjIsNode(obj)) {
-					faninValues = getFaninValues(obj);
+					faninValues = getFaninValues(sim, sim_obj);
 					VTR_ASSERT(faninValues);
-					dd_node = Cudd_Eval((DdManager*) ntk->pManFunc, (DdNode*) obj->pData, faninValues);
-					VTR_ASSERT(Cudd_IsConstant(dd_node));
-					if (dd_node == Cudd_ReadOne((DdManager*) ntk->pManFunc)) {
-						value = 1;
-					} else if (dd_node == Cudd_ReadLogicZero((DdManager*) ntk->pManFunc)) {
-						value = 0;
+					if (sim_obj->has_truth_table) {
+						int minterm = 0;
+						for (j = 0; j < sim_obj->num_fanins; j++) {
+							minterm |= (faninValues[j] & 1) << j;
+						}
+						value = (sim_obj->truth_table >> minterm) & 1;
 					} else {
-						VTR_ASSERT(0);
+						dd_node = Cudd_Eval((DdManager*) ntk->pManFunc, (DdNode*) obj->pData, faninValues);
+						VTR_ASSERT(Cudd_IsConstant(dd_node));
+						if (dd_node == Cudd_ReadOne((DdManager*) ntk->pManFunc)) {
+							value = 1;
+						} else if (dd_node == Cudd_ReadLogicZero((DdManager*) ntk->pManFunc)) {
+							value = 0;
+						} else {
+							VTR_ASSERT(0);
+						}
 					}
-					free(faninValues);
 				} else {
-					Ace_Obj_Info_t * fanin_info = Ace_ObjInfo(
-							Abc_ObjFanin0(obj));
-					value = fanin_info->value;
+					value = sim_obj->fanin_infos[0]->value;
 				}
 
 				if (info->value != value || info->status == ACE_UNDEF) {
@@ -252,20 +388,15 @@ void evaluate_circuit(Abc_Ntk_t * ntk, Vec_Ptr_t * node_vec, int /*cycle*/) {
 	}
 }
 
-void update_FFs(Abc_Ntk_t * ntk) {
-	Abc_Obj_t * obj;
+void update_FFs(Ace_Sim_t * sim) {
 	int i;
-	Ace_Obj_Info_t * bi_fanin_info;
-	Ace_Obj_Info_t * bi_info;
-	Ace_Obj_Info_t * latch_info;
-	Ace_Obj_Info_t * bo_info;
 
-	Abc_NtkForEachLatch(ntk, obj, i)
+	for (i = 0; i < sim->num_latches; i++)
 	{
-		bi_fanin_info = Ace_ObjInfo(Abc_ObjFanin0(Abc_ObjFanin0(obj)));
-		bi_info = Ace_ObjInfo(Abc_ObjFanin0(obj));
-		bo_info = Ace_ObjInfo(Abc_ObjFanout0(obj));
-		latch_info = Ace_ObjInfo(obj);
+		Ace_Obj_Info_t * bi_fanin_info = sim->latches[i].bi_fanin_info;
+		Ace_Obj_Info_t * bi_info = sim->latches[i].bi_info;
+		Ace_Obj_Info_t * latch_info = sim->latches[i].latch_info;
+		Ace_Obj_Info_t * bo_info = sim->latches[i].bo_info;
 
 		// Value
 		bi_info->value = bi_fanin_info->value;
@@ -289,7 +420,7 @@ void update_FFs(Abc_Ntk_t * ntk) {
 	}
 }
 
-void ace_sim_activities(Abc_Ntk_t * ntk, Vec_Ptr_t * nodes, int max_cycles,
+void ace_sim_activities(Abc_Ntk_t * ntk, Vec_Ptr_t * /*nodes*/, int max_cycles,
 		double threshold) {
 	Abc_Obj_t * obj;
 	Ace_Obj_Info_t * info;
@@ -316,11 +447,13 @@ void ace_sim_activities(Abc_Ntk_t * ntk, Vec_Ptr_t * nodes, int max_cycles,
 	}
 
 	Vec_Ptr_t * logic_nodes = Abc_NtkDfs(ntk, TRUE);
+	Ace_Sim_t * sim = ace_sim_init(ntk, logic_nodes);
 	for (i = 0; i < max_cycles; i++) {
-		get_pi_values(ntk, nodes, i);
-		evaluate_circuit(ntk, logic_nodes, i);
-		update_FFs(ntk);
+		get_pi_values(sim, i);
+		evaluate_circuit(ntk, sim, i);
+		update_FFs(sim);
 	}
+	ace_sim_free(sim);
 
 	//Vec_PtrForEachEntry(Abc_Obj_t *, nodes, obj, i)
 	Abc_NtkForEachObj(ntk, obj, i)
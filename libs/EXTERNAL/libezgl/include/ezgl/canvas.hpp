@@ -115,6 +115,16 @@ public:
   bool print_pdf(const char *file_name, int width = 0, int height = 0);
   bool print_svg(const char *file_name, int width = 0, int height = 0);
   bool print_png(const char *file_name, int width = 0, int height = 0);
+
+  /**
+   * Draw all the graphical content of the current canvas to a new image surface, like print_png
+   * but without encoding and writing the image. This lets the caller write the image elsewhere
+   * (e.g. on another thread).
+   *
+   * @return            the image surface, which the caller must free with cairo_surface_destroy(),
+   *                    or nullptr on failure (e.g. out of memory).
+   */
+  cairo_surface_t *render_image_surface(int width = 0, int height = 0);
   
   
 protected:
@@ -143,13 +143,29 @@ bool canvas::print_svg(const char *file_name, int output_width, int output_heigh
 }
 
 bool canvas::print_png(const char *file_name, int output_width, int output_height)
+{
+  cairo_surface_t *png_surface = render_image_surface(output_width, output_height);
+
+  if(png_surface == NULL)
+    return false; // failed to create due to errors such as out of memory
+
+  // create png output file
+  cairo_surface_write_to_png(png_surface, file_name);
+
+  // free surface
+  cairo_surface_destroy(png_surface);
+
+  return true;
+}
+
+cairo_surface_t *canvas::render_image_surface(int output_width, int output_height)
 {
   cairo_surface_t *png_surface;
   cairo_t *context;
   int surface_width = 0;
   int surface_height = 0;
   
-  // create pdf surface based on canvas size
+  // create image surface based on canvas size
   if(output_width == 0 && output_height == 0){
     surface_width = gtk_widget_get_allocated_width(m_drawing_area);
     surface_height = gtk_widget_get_allocated_height(m_drawing_area);
@@ -160,7 +176,7 @@ bool canvas::print_png(const char *file_name, int output_width, int output_heigh
   png_surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, surface_width, surface_height);
 
   if(png_surface == NULL)
-    return false; // failed to create due to errors such as out of memory
+    return NULL; // failed to create due to errors such as out of memory
   context = create_context(png_surface);
 
   // draw on the newly created png surface & context
@@ -174,14 +190,10 @@ bool canvas::print_png(const char *file_name, int output_width, int output_heigh
   renderer g(context, std::bind(&camera::world_to_screen, png_cam, _1), &png_cam, png_surface);
   m_draw_callback(&g);
 
-  // create png output file
-  cairo_surface_write_to_png(png_surface, file_name);
-
-  // free surface & context
-  cairo_surface_destroy(png_surface);
+  // free context
   cairo_destroy(context);
 
-  return true;
+  return png_surface;
 }
 
 gboolean canvas::configure_event(GtkWidget *widget, GdkEventConfigure *, gpointer data)
@@ -74,11 +74,11 @@ bool TimingConstraints::node_is_constant_generator(const NodeId id) const {
 }
 
 DomainId TimingConstraints::find_node_source_clock_domain(const NodeId node_id) const {
-    //We don't expect many clocks, so the linear search should be fine
-    for(auto domain_id : clock_domains()) {
-        if(clock_domain_source_node(domain_id) == node_id) {
-            return domain_id;
-        }
+    //Called for every edge during the arrival traversal, so use the lookup rather than
+    //searching the clock domains
+    auto iter = source_node_domains_.find(node_id);
+    if(iter != source_node_domains_.end()) {
+        return iter->second;
     }
 
     return DomainId::INVALID();
@@ -101,6 +101,16 @@ bool TimingConstraints::should_analyze(const DomainId src_domain, const DomainId
     TATUM_ASSERT(src_domain);
     TATUM_ASSERT(sink_domain);
 
+    //Most pairs are either unconstrained or have a default constraint
+    PairConstraint pair_constraint = PairConstraint::NONE;
+    auto row = domain_pair_constraints_.find(src_domain);
+    if(row != domain_pair_constraints_.end() && size_t(sink_domain) < row->size()) {
+        pair_constraint = (*row)[size_t(sink_domain)];
+    }
+    if(pair_constraint != PairConstraint::CAPTURE_NODES) {
+        return pair_constraint == PairConstraint::ALL;
+    }
+
     //If there is a domain pair + capture node or domain pair constraint then it should be analyzed
     return setup_constraints_.count(NodeDomainPair(src_domain, sink_domain, capture_node)) 
            || setup_constraints_.count(NodeDomainPair(src_domain, sink_domain, NodeId::INVALID())) 
@@ -108,6 +118,14 @@ bool TimingConstraints::should_analyze(const DomainId src_domain, const DomainId
            || hold_constraints_.count(NodeDomainPair(src_domain, sink_domain, NodeId::INVALID()));
 }
 
+bool TimingConstraints::should_analyze_launch_domain(const DomainId src_domain) const {
+    TATUM_ASSERT(src_domain);
+
+    //Rows are only extended when a constraint is recorded, so any non-empty row has a constrained pair
+    auto row = domain_pair_constraints_.find(src_domain);
+    return row != domain_pair_constraints_.end() && !row->empty();
+}
+
 Time TimingConstraints::hold_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node) const {
     //Try to find the capture node-specific constraint
     auto iter = hold_constraints_.find(NodeDomainPair(src_domain, sink_domain, capture_node));
@@ -309,6 +327,7 @@ void TimingConstraints::set_setup_constraint(const DomainId src_domain, const Do
 void TimingConstraints::set_setup_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node, const Time constraint) {
     auto key = NodeDomainPair(src_domain, sink_domain, capture_node);
     setup_constraints_[key] = constraint;
+    record_domain_pair_constraint(src_domain, sink_domain, capture_node);
 }
 
 void TimingConstraints::set_hold_constraint(const DomainId src_domain, const DomainId sink_domain, const Time constraint) {
@@ -318,6 +337,27 @@ void TimingConstraints::set_hold_constraint(const DomainId src_domain, const Dom
 void TimingConstraints::set_hold_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node, const Time constraint) {
     auto key = NodeDomainPair(src_domain, sink_domain, capture_node);
     hold_constraints_[key] = constraint;
+    record_domain_pair_constraint(src_domain, sink_domain, capture_node);
+}
+
+void TimingConstraints::record_domain_pair_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node) {
+    TATUM_ASSERT(src_domain);
+    TATUM_ASSERT(sink_domain);
+
+    if(size_t(src_domain) >= domain_pair_constraints_.size()) {
+        domain_pair_constraints_.resize(size_t(src_domain) + 1);
+    }
+    auto& row = domain_pair_constraints_[src_domain];
+    if(size_t(sink_domain) >= row.size()) {
+        row.resize(size_t(sink_domain) + 1, PairConstraint::NONE);
+    }
+
+    PairConstraint& pair_constraint = row[size_t(sink_domain)];
+    if(!capture_node) {
+        pair_constraint = PairConstraint::ALL;
+    } else if(pair_constraint == PairConstraint::NONE) {
+        pair_constraint = PairConstraint::CAPTURE_NODES;
+    }
 }
 
 void TimingConstraints::set_setup_clock_uncertainty(const DomainId src_domain, const DomainId sink_domain, const Time uncertainty) {
@@ -387,6 +427,17 @@ void TimingConstraints::set_source_latency(const DomainId domain, const ArrivalT
 
 void TimingConstraints::set_clock_domain_source(const NodeId node_id, const DomainId domain_id) {
     domain_sources_[domain_id] = node_id;
+    update_source_node_domains();
+}
+
+void TimingConstraints::update_source_node_domains() {
+    source_node_domains_.clear();
+    for(DomainId domain_id : clock_domains()) {
+        //If several domains share a source node, the first one is the node's domain
+        if(domain_sources_[domain_id]) {
+            source_node_domains_.emplace(domain_sources_[domain_id], domain_id);
+        }
+    }
 }
 
 void TimingConstraints::set_constant_generator(const NodeId node_id, bool is_constant_generator) {
@@ -411,6 +462,8 @@ void TimingConstraints::remap_nodes(const tatum::util::linear_map<NodeId,NodeId>
     }
     domain_sources_ = std::move(remapped_domain_sources);
 
+    update_source_node_domains();
+
     //Constant generators
     std::unordered_set<NodeId> remapped_constant_generators;
     for(NodeId node_id : constant_generators_) {
@@ -1,6 +1,7 @@
 #pragma once
 #include <map>
 #include <vector>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "tatum/util/tatum_linear_map.hpp"
@@ -65,6 +66,13 @@ class TimingConstraints {
         ///\param sink_domain The ID of the sink (capture) clock domain
         bool should_analyze(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node=NodeId::INVALID()) const;
 
+        ///Indicates whether the paths launched by src_domain should be analyzed for any capture domain.
+        ///Data arrival tags are only created for the launch domains where this is true, since the tags
+        ///of a domain whose paths are all cut (e.g. by set_false_path or set_clock_groups) could never
+        ///produce a required time or slack
+        ///\param src_domain The ID of the source (launch) clock domain
+        bool should_analyze_launch_domain(const DomainId src_domain) const;
+
         ///\returns The setup (max) constraint between src_domain and sink_domain at the specified capture_node_id
         Time setup_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node=NodeId::INVALID()) const;
 
@@ -163,10 +171,24 @@ class TimingConstraints {
         ///\returns A valid domain id if the node is a clock source
         DomainId find_node_source_clock_domain(const NodeId node_id) const;
 
+        ///Rebuilds source_node_domains_ from domain_sources_
+        void update_source_node_domains();
+
+        ///Records that a setup or hold constraint was set between src_domain and sink_domain
+        void record_domain_pair_constraint(const DomainId src_domain, const DomainId sink_domain, const NodeId capture_node);
+
         io_constraint_iterator find_io_constraint(const NodeId node_id, const DomainId domain_id, const std::multimap<NodeId,IoConstraint>& io_constraints) const;
         mutable_io_constraint_iterator find_io_constraint(const NodeId node_id, const DomainId domain_id, std::multimap<NodeId,IoConstraint>& io_constraints);
 
 
+    private: //Types
+        ///How the paths between a pair of clock domains are constrained
+        enum class PairConstraint : char {
+            NONE,           ///<Not analyzed
+            CAPTURE_NODES,  ///<Analyzed at the capture nodes with a per-node constraint only
+            ALL             ///<Analyzed at all capture nodes (there is a default constraint)
+        };
+
     private: //Data
         tatum::util::linear_map<DomainId,DomainId> domain_ids_;
         tatum::util::linear_map<DomainId,std::string> domain_names_;
@@ -180,6 +202,14 @@ class TimingConstraints {
         std::map<NodeDomainPair,Time> setup_constraints_;
         std::map<NodeDomainPair,Time> hold_constraints_;
 
+        //Summary of the setup/hold constraints of each domain pair [src_domain][sink_domain], so that
+        //should_analyze() answers without searching the constraint maps in the common cases.
+        //Rows and columns are only as long as the largest constrained domain id
+        tatum::util::linear_map<DomainId,std::vector<PairConstraint>> domain_pair_constraints_;
+
+        //Clock source node of each domain (inverse of domain_sources_)
+        std::unordered_map<NodeId,DomainId> source_node_domains_;
+
         std::map<DomainPair,Time> setup_clock_uncertainties_;
         std::map<DomainPair,Time> hold_clock_uncertainties_;
 
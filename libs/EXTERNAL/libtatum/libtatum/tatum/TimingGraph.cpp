@@ -176,6 +176,8 @@ LevelId TimingGraph::node_level(const NodeId node) const {
 
 
 NodeId TimingGraph::add_node(const NodeType type) {
+    expand_edges();
+
     //Invalidate the levelization
     is_levelized_ = false;
 
@@ -204,6 +206,8 @@ EdgeId TimingGraph::add_edge(const EdgeType type, const NodeId src_node, const N
     TATUM_ASSERT(valid_node_id(src_node));
     TATUM_ASSERT(valid_node_id(sink_node));
 
+    expand_edges();
+
     //Invalidate the levelization
     is_levelized_ = false;
 
@@ -232,10 +236,61 @@ EdgeId TimingGraph::add_edge(const EdgeType type, const NodeId src_node, const N
     return edge_id;
 }
 
+void TimingGraph::add_nodes_and_edges(size_t num_nodes, size_t num_edges) {
+    expand_edges();
+
+    //Invalidate the levelization
+    is_levelized_ = false;
+
+    size_t first_node = node_ids_.size();
+    for (size_t inode = first_node; inode < first_node + num_nodes; ++inode) {
+        node_ids_.push_back(NodeId(inode));
+    }
+    node_types_.resize(first_node + num_nodes, NodeType::IPIN);
+    node_out_edges_.resize(first_node + num_nodes);
+    node_in_edges_.resize(first_node + num_nodes);
+
+    size_t first_edge = edge_ids_.size();
+    for (size_t iedge = first_edge; iedge < first_edge + num_edges; ++iedge) {
+        edge_ids_.push_back(EdgeId(iedge));
+    }
+    edge_types_.resize(first_edge + num_edges, EdgeType::INTERCONNECT);
+    edge_src_nodes_.resize(first_edge + num_edges, NodeId::INVALID());
+    edge_sink_nodes_.resize(first_edge + num_edges, NodeId::INVALID());
+    edges_disabled_.resize(first_edge + num_edges, false);
+
+    //Verify sizes
+    TATUM_ASSERT(node_types_.size() == node_out_edges_.size());
+    TATUM_ASSERT(edge_sink_nodes_.size() == edge_src_nodes_.size());
+}
+
+void TimingGraph::set_node_type(const NodeId node_id, const NodeType type) {
+    TATUM_ASSERT(valid_node_id(node_id));
+    node_types_[node_id] = type;
+}
+
+void TimingGraph::set_edge(const EdgeId edge_id, const EdgeType type, const NodeId src_node, const NodeId sink_node) {
+    TATUM_ASSERT(valid_edge_id(edge_id));
+    TATUM_ASSERT(valid_node_id(src_node));
+    TATUM_ASSERT(valid_node_id(sink_node));
+    TATUM_ASSERT(!edge_src_nodes_[edge_id] && !edge_sink_nodes_[edge_id]);
+    TATUM_ASSERT(!edges_compacted_);
+
+    edge_types_[edge_id] = type;
+    edge_src_nodes_[edge_id] = src_node;
+    edge_sink_nodes_[edge_id] = sink_node;
+
+    //Update the nodes the edge references
+    node_out_edges_[src_node].push_back(edge_id);
+    node_in_edges_[sink_node].push_back(edge_id);
+}
+
 
 void TimingGraph::remove_node(const NodeId node_id) {
     TATUM_ASSERT(valid_node_id(node_id));
 
+    expand_edges();
+
     //Invalidate the levelization
     is_levelized_ = false;
 
@@ -259,6 +314,8 @@ void TimingGraph::remove_node(const NodeId node_id) {
 void TimingGraph::remove_edge(const EdgeId edge_id) {
     TATUM_ASSERT(valid_edge_id(edge_id));
 
+    expand_edges();
+
     //Invalidate the levelization
     is_levelized_ = false;
 
@@ -474,9 +531,69 @@ GraphIdMaps TimingGraph::optimize_layout() {
 
     levelize();
 
+    compact_edges();
+
     return {node_id_map, edge_id_map};
 }
 
+void TimingGraph::compact_edges() {
+    if (edges_compacted_) return;
+
+    TATUM_ASSERT_MSG(edge_ids_.size() <= std::numeric_limits<uint32_t>::max(), "Too many edges for compact edge offsets");
+
+    auto compact = [&](const tatum::util::linear_map<NodeId,std::vector<EdgeId>>& node_edges,
+                       std::vector<uint32_t>& offsets,
+                       std::vector<EdgeId>& edges) {
+        size_t num_edges = 0;
+        for (const auto& node_edge_refs : node_edges) {
+            num_edges += node_edge_refs.size();
+        }
+
+        offsets.clear();
+        offsets.reserve(node_edges.size() + 1);
+        edges.clear();
+        edges.reserve(num_edges);
+
+        for (const auto& node_edge_refs : node_edges) {
+            offsets.push_back(edges.size());
+            edges.insert(edges.end(), node_edge_refs.begin(), node_edge_refs.end());
+        }
+        offsets.push_back(edges.size());
+    };
+
+    compact(node_in_edges_, compact_in_edge_offsets_, compact_in_edges_);
+    compact(node_out_edges_, compact_out_edge_offsets_, compact_out_edges_);
+
+    //Release the per-node vectors
+    node_in_edges_ = tatum::util::linear_map<NodeId,std::vector<EdgeId>>();
+    node_out_edges_ = tatum::util::linear_map<NodeId,std::vector<EdgeId>>();
+
+    edges_compacted_ = true;
+}
+
+void TimingGraph::expand_edges() {
+    if (!edges_compacted_) return;
+
+    auto expand = [&](const std::vector<uint32_t>& offsets,
+                      const std::vector<EdgeId>& edges,
+                      tatum::util::linear_map<NodeId,std::vector<EdgeId>>& node_edges) {
+        node_edges.clear();
+        for (size_t inode = 0; inode < node_ids_.size(); ++inode) {
+            node_edges.emplace_back(edges.begin() + offsets[inode], edges.begin() + offsets[inode + 1]);
+        }
+    };
+
+    expand(compact_in_edge_offsets_, compact_in_edges_, node_in_edges_);
+    expand(compact_out_edge_offsets_, compact_out_edges_, node_out_edges_);
+
+    std::vector<uint32_t>().swap(compact_in_edge_offsets_);
+    std::vector<uint32_t>().swap(compact_out_edge_offsets_);
+    std::vector<EdgeId>().swap(compact_in_edges_);
+    std::vector<EdgeId>().swap(compact_out_edges_);
+
+    edges_compacted_ = false;
+}
+
 tatum::util::linear_map<EdgeId,EdgeId> TimingGraph::optimize_edge_layout() const {
     //Make all edges in a level be contiguous in memory
 
@@ -549,6 +666,8 @@ tatum::util::linear_map<NodeId,NodeId> TimingGraph::optimize_node_layout() const
 }
 
 void TimingGraph::remap_nodes(const tatum::util::linear_map<NodeId,NodeId>& node_id_map) {
+    expand_edges();
+
     is_levelized_ = false;
 
     //Update values
@@ -563,6 +682,8 @@ void TimingGraph::remap_nodes(const tatum::util::linear_map<NodeId,NodeId>& node
 }
 
 void TimingGraph::remap_edges(const tatum::util::linear_map<EdgeId,EdgeId>& edge_id_map) {
+    expand_edges();
+
     is_levelized_ = false;
 
     //Update values
@@ -595,12 +716,22 @@ bool TimingGraph::valid_level_id(const LevelId level_id) const {
 
 bool TimingGraph::validate_sizes() const {
     if (   node_ids_.size() != node_types_.size()
-        || node_ids_.size() != node_in_edges_.size()
-        || node_ids_.size() != node_out_edges_.size()
         || node_ids_.size() != node_levels_.size()) {
         throw tatum::Error("Inconsistent node attribute sizes");
     }
 
+    if (edges_compacted_) {
+        if (   node_ids_.size() + 1 != compact_in_edge_offsets_.size()
+            || node_ids_.size() + 1 != compact_out_edge_offsets_.size()
+            || compact_in_edges_.size() != compact_in_edge_offsets_.back()
+            || compact_out_edges_.size() != compact_out_edge_offsets_.back()) {
+            throw tatum::Error("Inconsistent compact node edge sizes");
+        }
+    } else if (   node_ids_.size() != node_in_edges_.size()
+               || node_ids_.size() != node_out_edges_.size()) {
+        throw tatum::Error("Inconsistent node attribute sizes");
+    }
+
     if (   edge_ids_.size() != edge_types_.size()
         || edge_ids_.size() != edge_sink_nodes_.size()
         || edge_ids_.size() != edge_src_nodes_.size()
@@ -622,7 +753,7 @@ bool TimingGraph::validate_values() const {
             throw tatum::Error("Invalid node id", node_id);
         }
 
-        for(EdgeId edge_id : node_in_edges_[node_id]) {
+        for(EdgeId edge_id : node_in_edges(node_id)) {
             if(!valid_edge_id(edge_id)) {
                 throw tatum::Error("Invalid node-in-edge reference", node_id, edge_id);
             }
@@ -632,7 +763,7 @@ bool TimingGraph::validate_values() const {
                 throw tatum::Error("Mismatched edge-sink/node-in-edge reference", node_id, edge_id);
             }
         }
-        for(EdgeId edge_id : node_out_edges_[node_id]) {
+        for(EdgeId edge_id : node_out_edges(node_id)) {
             if(!valid_edge_id(edge_id)) {
                 throw tatum::Error("Invalid node-out-edge reference", node_id, edge_id);
             }
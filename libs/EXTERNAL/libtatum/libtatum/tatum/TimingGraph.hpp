@@ -53,6 +53,7 @@
  * support is added), it may be a good idea apply these modifications automatically as needed.
  *
  */
+#include <cstdint>
 #include <vector>
 #include <set>
 #include <limits>
@@ -86,11 +87,23 @@ class TimingGraph {
 
         ///\param id The node id
         ///\returns A range of all out-going edges the node drives
-        edge_range node_out_edges(const NodeId id) const { return tatum::util::make_range(node_out_edges_[id].begin(), node_out_edges_[id].end()); }
+        edge_range node_out_edges(const NodeId id) const {
+            if (edges_compacted_) {
+                return tatum::util::make_range(compact_out_edges_.begin() + compact_out_edge_offsets_[size_t(id)],
+                                               compact_out_edges_.begin() + compact_out_edge_offsets_[size_t(id) + 1]);
+            }
+            return tatum::util::make_range(node_out_edges_[id].begin(), node_out_edges_[id].end());
+        }
 
         ///\param id The node id
         ///\returns A range of all in-coming edges the node drives
-        edge_range node_in_edges(const NodeId id) const { return tatum::util::make_range(node_in_edges_[id].begin(), node_in_edges_[id].end()); }
+        edge_range node_in_edges(const NodeId id) const {
+            if (edges_compacted_) {
+                return tatum::util::make_range(compact_in_edges_.begin() + compact_in_edge_offsets_[size_t(id)],
+                                               compact_in_edges_.begin() + compact_in_edge_offsets_[size_t(id) + 1]);
+            }
+            return tatum::util::make_range(node_in_edges_[id].begin(), node_in_edges_[id].end());
+        }
 
         ///\param id The Node id
         ///\returns The number of active (undisabled) edges terminating at the node
@@ -190,6 +203,10 @@ class TimingGraph {
         //\returns true if the timing graph is internally consistent, throws an exception if not
         bool validate() const;
 
+        //\returns true if the node edge references are stored in the compact (CSR) form
+        //\see compact_edges()
+        bool edges_compacted() const { return edges_compacted_; }
+
     public: //Mutators
         /*
          * Graph modifiers
@@ -207,6 +224,25 @@ class TimingGraph {
         ///\warning Graph will likely need to be re-levelized after modification
         EdgeId add_edge(const EdgeType type, const NodeId src_node, const NodeId sink_node);
 
+        ///Adds num_nodes nodes and num_edges edges to the timing graph in one go, for bulk
+        ///(e.g. parallel) construction. Their IDs follow the existing ones, and they must
+        ///then be given their types (and the edges their end nodes) with set_node_type() and
+        ///set_edge(), before the graph is used.
+        ///\param num_nodes The number of nodes to add
+        ///\param num_edges The number of edges to add
+        ///\warning Graph will likely need to be re-levelized after modification
+        void add_nodes_and_edges(size_t num_nodes, size_t num_edges);
+
+        ///Sets the type of a node added by add_nodes_and_edges()
+        ///\note May be called concurrently for different nodes
+        void set_node_type(const NodeId node_id, const NodeType type);
+
+        ///Sets the type and end nodes of an edge added by add_nodes_and_edges().
+        ///The edge is appended to the end nodes' edges, like add_edge() does.
+        ///\pre The edge's end nodes have not been set yet
+        ///\note May be called concurrently for edges which don't share an end node
+        void set_edge(const EdgeId edge_id, const EdgeType type, const NodeId src_node, const NodeId sink_node);
+
         ///Removes a node (and it's associated edges) from the timing graph
         ///\param node_id The node to remove
         ///\warning This will leave invalid ID references in the timing graph until compress() is called
@@ -244,6 +280,16 @@ class TimingGraph {
         ///\returns The mapping from old to new IDs
         GraphIdMaps optimize_layout();
 
+        ///Packs the in/out edge references of all nodes into two contiguous arrays
+        ///indexed by per-node offsets (i.e. compressed sparse row form), releasing
+        ///the per-node edge vectors. This removes a heap allocation and a vector
+        ///header per node and direction, and keeps each node's edges adjacent in memory.
+        ///
+        ///Node and edge IDs are unchanged. Any later modification of the graph's
+        ///structure transparently restores the per-node form.
+        ///\note Called by optimize_layout()
+        void compact_edges();
+
 
         ///Sets whether dangling combinational nodes is an error (if true) or not
         void set_allow_dangling_combinational_nodes(bool value) {
@@ -264,6 +310,9 @@ class TimingGraph {
 
         void force_levelize();
 
+        ///Restores the per-node edge vectors (which can be modified) from the compact form
+        void expand_edges();
+
         bool valid_node_id(const NodeId node_id) const;
         bool valid_edge_id(const EdgeId edge_id) const;
         bool valid_level_id(const LevelId level_id) const;
@@ -286,6 +335,15 @@ class TimingGraph {
         tatum::util::linear_map<NodeId,std::vector<EdgeId>> node_out_edges_; //Out going edge IDs for node
         tatum::util::linear_map<NodeId,LevelId> node_levels_; //Out going edge IDs for node
 
+        //Compacted node edge references (see compact_edges()). While edges_compacted_ is set
+        //node_in_edges_/node_out_edges_ are empty, and the edges of node i are
+        //compact_*_edges_[compact_*_edge_offsets_[i]..compact_*_edge_offsets_[i+1]-1]
+        bool edges_compacted_ = false;
+        std::vector<uint32_t> compact_in_edge_offsets_;
+        std::vector<uint32_t> compact_out_edge_offsets_;
+        std::vector<EdgeId> compact_in_edges_;
+        std::vector<EdgeId> compact_out_edges_;
+
         //Edge data
         tatum::util::linear_map<EdgeId,EdgeId> edge_ids_; //The edge IDs in the graph
         tatum::util::linear_map<EdgeId,EdgeType> edge_types_; //Type of edge
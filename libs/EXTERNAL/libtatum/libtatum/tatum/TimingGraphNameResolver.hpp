@@ -29,6 +29,12 @@ class TimingGraphNameResolver {
             //Default no edge delay breakdown
             return EdgeDelayBreakdown();
         }
+
+        //Returns true if the above methods may be called concurrently from multiple threads,
+        //allowing TimingReporter to generate the reports of different paths in parallel
+        virtual bool is_concurrency_safe() const {
+            return false;
+        }
 };
 
 } //namespace
@@ -3,6 +3,12 @@
 #include <sstream>
 #include <iomanip>
 #include <vector>
+#include <algorithm>
+#include <functional>
+
+#ifdef TATUM_USE_TBB
+# include <tbb/parallel_for.h>
+#endif
 
 #include "tatum/util/tatum_math.hpp"
 #include "tatum/util/OsFormatGuard.hpp"
@@ -63,6 +69,43 @@ void ReportTimingPathHelper::print_divider(std::ostream& os) const {
     os << "\n";
 }
 
+//Number of paths reported (concurrently) to memory before being written out.
+//Bounds the memory used by the in-flight reports, which may be large for detailed reports.
+constexpr size_t REPORT_PATH_BATCH_SIZE = 128;
+
+//Writes the reports produced by report_path(os, ipath) for ipath in [0, num_paths) to os, in order.
+//If concurrent, batches of paths are reported in parallel (each to its own buffer, which
+//starts with the formatting state of os), and the batch is then written out.
+static void report_paths(std::ostream& os, size_t num_paths, bool concurrent,
+                         const std::function<void(std::ostream&, size_t)>& report_path) {
+#ifdef TATUM_USE_TBB
+    if (concurrent) {
+        std::vector<std::string> path_reports;
+        for(size_t batch_begin = 0; batch_begin < num_paths; batch_begin += REPORT_PATH_BATCH_SIZE) {
+            size_t batch_size = std::min(REPORT_PATH_BATCH_SIZE, num_paths - batch_begin);
+            path_reports.resize(batch_size);
+
+            tbb::parallel_for(size_t(0), batch_size, [&](size_t i) {
+                std::ostringstream path_os;
+                path_os.copyfmt(os);
+                report_path(path_os, batch_begin + i);
+                path_reports[i] = path_os.str();
+            });
+
+            for(const std::string& path_report : path_reports) {
+                os << path_report;
+            }
+        }
+        return;
+    }
+#else
+    static_cast<void>(concurrent);
+#endif
+    for(size_t ipath = 0; ipath < num_paths; ++ipath) {
+        report_path(os, ipath);
+    }
+}
+
 }} //namespace
 
 namespace tatum {
@@ -221,12 +264,11 @@ void TimingReporter::report_timing(std::ostream& os,
     os << "# Output precision: " << precision_ << "\n";
     os << "\n";
 
-    size_t i = 0;
-    for(const auto& path : paths) {
-        os << "#Path " << ++i << "\n";
-        report_timing_path(os, path);
-        os << "\n";
-    }
+    detail::report_paths(os, paths.size(), name_resolver_.is_concurrency_safe(), [&](std::ostream& path_os, size_t ipath) {
+        path_os << "#Path " << ipath + 1 << "\n";
+        report_timing_path(path_os, paths[ipath]);
+        path_os << "\n";
+    });
 
     os << "#End of timing report\n";
 }
@@ -385,13 +427,11 @@ void TimingReporter::report_unconstrained(std::ostream& os, const NodeType type,
 void TimingReporter::report_skew(std::ostream& os, const std::vector<SkewPath>& skew_paths, TimingType timing_type) const {
     tatum::OsFormatGuard flag_guard(os);
 
-    int i = 1;
-    for (const auto& skew_path : skew_paths) {
-        os << "#Skew Path " << i << "\n";
-        report_skew_path(os, skew_path, timing_type); 
-        os << "\n";
-        ++i;
-    }
+    detail::report_paths(os, skew_paths.size(), name_resolver_.is_concurrency_safe(), [&](std::ostream& path_os, size_t ipath) {
+        path_os << "#Skew Path " << ipath + 1 << "\n";
+        report_skew_path(path_os, skew_paths[ipath], timing_type); 
+        path_os << "\n";
+    });
 }
 
 void TimingReporter::report_skew_path(std::ostream& os, const SkewPath& skew_path, TimingType timing_type) const {
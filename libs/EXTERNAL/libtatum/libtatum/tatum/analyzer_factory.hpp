@@ -45,6 +45,13 @@ namespace tatum {
  *                                                                                         timing_constraints,
  *                                                                                         delay_calculator);
  *
+ * Incremental analyzers are built by specifying an incremental graph walker, either
+ * serial (SerialIncrWalker) or parallel (ParallelIncrWalker):
+ *
+ *      auto incr_setup_analyzer = AnalyzerFactory<SetupAnalysis,ParallelIncrWalker>::make(timing_graph,
+ *                                                                                         timing_constraints,
+ *                                                                                         delay_calculator);
+ *
  * The AnalzyerFactory returns a std::unique_ptr to the appropriate TimingAnalyzer sub-class:
  *
  *      SetupAnalysis       =>  SetupTimingAnalyzer
@@ -176,6 +183,51 @@ struct AnalyzerFactory<SetupHoldAnalysis,SerialIncrWalker> {
     }
 };
 
+//Specialize for parallel incremental setup
+template<>
+struct AnalyzerFactory<SetupAnalysis,ParallelIncrWalker> {
+
+    static std::unique_ptr<SetupTimingAnalyzer> make(const TimingGraph& timing_graph,
+                                                         const TimingConstraints& timing_constraints,
+                                                         const DelayCalculator& delay_calc) {
+        return std::unique_ptr<SetupTimingAnalyzer>(
+                new detail::IncrSetupTimingAnalyzer<ParallelIncrWalker>(timing_graph, 
+                                                                      timing_constraints, 
+                                                                      delay_calc)
+                );
+    }
+};
+
+//Specialize for parallel incremental hold
+template<>
+struct AnalyzerFactory<HoldAnalysis,ParallelIncrWalker> {
+
+    static std::unique_ptr<HoldTimingAnalyzer> make(const TimingGraph& timing_graph,
+                                                         const TimingConstraints& timing_constraints,
+                                                         const DelayCalculator& delay_calc) {
+        return std::unique_ptr<HoldTimingAnalyzer>(
+                new detail::IncrHoldTimingAnalyzer<ParallelIncrWalker>(timing_graph, 
+                                                                     timing_constraints, 
+                                                                     delay_calc)
+                );
+    }
+};
+
+//Specialize for combined parallel incremental setup and hold
+template<>
+struct AnalyzerFactory<SetupHoldAnalysis,ParallelIncrWalker> {
+
+    static std::unique_ptr<SetupHoldTimingAnalyzer> make(const TimingGraph& timing_graph,
+                                                         const TimingConstraints& timing_constraints,
+                                                         const DelayCalculator& delay_calc) {
+        return std::unique_ptr<SetupHoldTimingAnalyzer>(
+                new detail::IncrSetupHoldTimingAnalyzer<ParallelIncrWalker>(timing_graph, 
+                                                                          timing_constraints, 
+                                                                          delay_calc)
+                );
+    }
+};
+
 } //namepsace
 
 #endif
@@ -0,0 +1,82 @@
+#pragma once
+#include <vector>
+
+#include "tatum/delay_calc/DelayCalculator.hpp"
+#include "tatum/util/tatum_assert.hpp"
+
+namespace tatum {
+
+/**
+ * A delay calculator which combines the delays of several delay corners
+ * (e.g. slow/typical/fast process, voltage and temperature corners), each
+ * described by its own DelayCalculator.
+ *
+ * Each edge reports the worst case of all corners for the analysis using
+ * the value: the largest max delay and setup time (used by setup analysis),
+ * and the smallest min delay and hold time (used by hold analysis). This
+ * allows the timing of all corners to be bounded with a single traversal
+ * per analysis, rather than one traversal for each corner:
+ *
+ *      MultiCornerDelayCalculator delay_calc({&slow_corner_calc, &fast_corner_calc});
+ *
+ *      auto analyzer = AnalyzerFactory<SetupHoldAnalysis>::make(timing_graph,
+ *                                                               timing_constraints,
+ *                                                               delay_calc);
+ *
+ * Since the worst corner is chosen independently for each edge, the arrival
+ * times of data paths are a (pessimistic) bound on those of every corner, and
+ * equal the worst corner's if a single corner is the worst for every edge (e.g.
+ * corners which scale all delays). Note that, as for a single corner, the same
+ * (max or min) delays are also used on both the launch and capture clock paths,
+ * so clock skew which only occurs in some corners is not bounded.
+ *
+ * The corner delay calculators are not owned, and must outlive this object.
+ */
+class MultiCornerDelayCalculator : public DelayCalculator {
+    public:
+        MultiCornerDelayCalculator(std::vector<const DelayCalculator*> corners)
+            : corners_(std::move(corners)) {
+            TATUM_ASSERT_MSG(!corners_.empty(), "Must have at least one delay corner");
+        }
+
+        size_t num_corners() const { return corners_.size(); }
+
+        const DelayCalculator& corner(size_t icorner) const { return *corners_[icorner]; }
+
+        Time max_edge_delay(const TimingGraph& tg, EdgeId edge_id) const override {
+            Time delay = corners_[0]->max_edge_delay(tg, edge_id);
+            for (size_t icorner = 1; icorner < corners_.size(); ++icorner) {
+                delay.max(corners_[icorner]->max_edge_delay(tg, edge_id));
+            }
+            return delay;
+        }
+
+        Time min_edge_delay(const TimingGraph& tg, EdgeId edge_id) const override {
+            Time delay = corners_[0]->min_edge_delay(tg, edge_id);
+            for (size_t icorner = 1; icorner < corners_.size(); ++icorner) {
+                delay.min(corners_[icorner]->min_edge_delay(tg, edge_id));
+            }
+            return delay;
+        }
+
+        Time setup_time(const TimingGraph& tg, EdgeId edge_id) const override {
+            Time tsu = corners_[0]->setup_time(tg, edge_id);
+            for (size_t icorner = 1; icorner < corners_.size(); ++icorner) {
+                tsu.max(corners_[icorner]->setup_time(tg, edge_id));
+            }
+            return tsu;
+        }
+
+        Time hold_time(const TimingGraph& tg, EdgeId edge_id) const override {
+            Time thld = corners_[0]->hold_time(tg, edge_id);
+            for (size_t icorner = 1; icorner < corners_.size(); ++icorner) {
+                thld.min(corners_[icorner]->hold_time(tg, edge_id));
+            }
+            return thld;
+        }
+
+    private:
+        std::vector<const DelayCalculator*> corners_;
+};
+
+} //namepsace
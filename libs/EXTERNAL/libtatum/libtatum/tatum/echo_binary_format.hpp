@@ -0,0 +1,121 @@
+#pragma once
+#include <cstdint>
+
+/*
+ * The binary echo format holds the same timing graph, constraints,
+ * delay model and analysis results as the text echo file (see echo_writer.hpp),
+ * as flat fixed-size records which can be loaded straight from a memory mapping,
+ * instead of being tokenized and parsed.
+ *
+ * The file is a BinaryEchoHeader, followed by the sections below in order.
+ * Each section is a uint64_t record count followed by its records:
+ *
+ *   nodes:       one uint8_t NodeType per node, in node id order
+ *   edges:       one BinaryEchoEdge per edge, in edge id order
+ *   domains:     one BinaryEchoDomain per clock domain, each followed by its name_size name characters
+ *   constraints: one BinaryEchoConstraint per constraint
+ *   delays:      one BinaryEchoDelay per edge, in edge id order
+ *   results:     one BinaryEchoResult per (non-NaN) tag or slack
+ *
+ * All values are in host byte order and records are not padded, so they should
+ * be copied out of the file (e.g. with memcpy) rather than accessed in place.
+ * Bump BINARY_ECHO_VERSION whenever the layout changes.
+ */
+namespace tatum { namespace echo_binary {
+
+constexpr char BINARY_ECHO_MAGIC[8] = {'T', 'A', 'T', 'U', 'M', 'B', 'I', 'N'};
+constexpr uint32_t BINARY_ECHO_VERSION = 1;
+
+enum class ConstraintKind : uint8_t {
+    CLOCK_SOURCE,
+    CONSTANT_GENERATOR,
+    MAX_INPUT_CONSTRAINT,
+    MIN_INPUT_CONSTRAINT,
+    MAX_OUTPUT_CONSTRAINT,
+    MIN_OUTPUT_CONSTRAINT,
+    SETUP_CONSTRAINT,
+    HOLD_CONSTRAINT,
+    SETUP_UNCERTAINTY,
+    HOLD_UNCERTAINTY,
+    EARLY_SOURCE_LATENCY,
+    LATE_SOURCE_LATENCY
+};
+
+enum class DelayKind : uint8_t {
+    EDGE_DELAY,     //first: min_delay, second: max_delay
+    SETUP_HOLD_TIME //first: setup_time, second: hold_time
+};
+
+//Same order as the text echo result types (and tatumparse::TagType)
+enum class ResultType : uint8_t {
+    SETUP_DATA_ARRIVAL,
+    SETUP_DATA_REQUIRED,
+    SETUP_LAUNCH_CLOCK,
+    SETUP_CAPTURE_CLOCK,
+    SETUP_SLACK,
+    HOLD_DATA_ARRIVAL,
+    HOLD_DATA_REQUIRED,
+    HOLD_LAUNCH_CLOCK,
+    HOLD_CAPTURE_CLOCK,
+    HOLD_SLACK
+};
+
+enum class ResultTarget : uint8_t {
+    NODE_TAG,
+    NODE_SLACK,
+    EDGE_SLACK
+};
+
+#pragma pack(push, 1)
+struct BinaryEchoHeader {
+    char magic[8];
+    uint32_t version;
+};
+
+struct BinaryEchoEdge {
+    int32_t src_node;
+    int32_t sink_node;
+    uint8_t type; //EdgeType
+    uint8_t disabled;
+};
+
+struct BinaryEchoDomain {
+    int32_t domain;
+    uint32_t name_size;
+};
+
+/*
+ * Which fields are used depends on kind:
+ *   CLOCK_SOURCE:                  node, domain
+ *   CONSTANT_GENERATOR:            node
+ *   *_INPUT/OUTPUT_CONSTRAINT:     node, domain, value
+ *   SETUP/HOLD_CONSTRAINT:         domain (launch), capture_domain, node (capture node, -1 if none), value
+ *   SETUP/HOLD_UNCERTAINTY:        domain (launch), capture_domain, value
+ *   EARLY/LATE_SOURCE_LATENCY:     domain, value
+ * Unused fields are -1 (or 0 for value).
+ */
+struct BinaryEchoConstraint {
+    uint8_t kind; //ConstraintKind
+    int32_t node;
+    int32_t domain;
+    int32_t capture_domain;
+    float value;
+};
+
+struct BinaryEchoDelay {
+    uint8_t kind; //DelayKind
+    float first;
+    float second;
+};
+
+struct BinaryEchoResult {
+    uint8_t type; //ResultType
+    uint8_t target; //ResultTarget
+    int32_t id; //Node or edge id, depending on target
+    int32_t launch_domain; //-1 if none
+    int32_t capture_domain; //-1 if none
+    float time;
+};
+#pragma pack(pop)
+
+}} //namespace
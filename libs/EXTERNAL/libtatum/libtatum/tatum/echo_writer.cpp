@@ -4,6 +4,7 @@
 #include <algorithm>
 
 #include "echo_writer.hpp"
+#include "echo_binary_format.hpp"
 
 #include "tatum/util/tatum_assert.hpp"
 #include "tatum/TimingGraph.hpp"
@@ -17,6 +18,7 @@ namespace tatum {
 void write_tags(std::ostream& os, const std::string& type, const TimingTags::tag_range tags, const NodeId node_id);
 void write_slacks(std::ostream& os, const std::string& type, const TimingTags::tag_range tags, const EdgeId edge);
 void write_slacks(std::ostream& os, const std::string& type, const TimingTags::tag_range tags, const NodeId edge);
+void add_binary_results(std::vector<echo_binary::BinaryEchoResult>& results, echo_binary::ResultType type, echo_binary::ResultTarget target, const TimingTags::tag_range tags, size_t id);
 
 void write_echo(std::string filename, const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const std::shared_ptr<const TimingAnalyzer> analyzer) {
     std::ofstream os(filename);
@@ -372,4 +374,209 @@ void write_slacks(std::ostream& os, const std::string& type, const TimingTags::t
     }
 }
 
+
+template<class T>
+static void write_binary_section(std::ostream& os, const std::vector<T>& records) {
+    uint64_t num_records = records.size();
+    os.write(reinterpret_cast<const char*>(&num_records), sizeof(num_records));
+    os.write(reinterpret_cast<const char*>(records.data()), sizeof(T) * records.size());
+}
+
+static echo_binary::BinaryEchoConstraint binary_constraint(echo_binary::ConstraintKind kind, int node, int domain, int capture_domain, float value) {
+    echo_binary::BinaryEchoConstraint constraint;
+    constraint.kind = static_cast<uint8_t>(kind);
+    constraint.node = node;
+    constraint.domain = domain;
+    constraint.capture_domain = capture_domain;
+    constraint.value = value;
+    return constraint;
+}
+
+void write_binary_echo(std::string filename, const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const std::shared_ptr<const TimingAnalyzer> analyzer) {
+    std::ofstream os(filename, std::ios::binary);
+
+    write_binary_echo(os, tg, tc, dc, analyzer);
+}
+
+void write_binary_echo(std::ostream& os, const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, const std::shared_ptr<const TimingAnalyzer> analyzer) {
+    using namespace echo_binary;
+
+    BinaryEchoHeader header;
+    std::copy(std::begin(BINARY_ECHO_MAGIC), std::end(BINARY_ECHO_MAGIC), header.magic);
+    header.version = BINARY_ECHO_VERSION;
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    //Timing graph
+    std::vector<uint8_t> nodes;
+    nodes.reserve(tg.nodes().size());
+    for(size_t node_idx = 0; node_idx < tg.nodes().size(); ++node_idx) {
+        nodes.push_back(static_cast<uint8_t>(tg.node_type(NodeId(node_idx))));
+    }
+    write_binary_section(os, nodes);
+
+    std::vector<BinaryEchoEdge> edges;
+    edges.reserve(tg.edges().size());
+    for(size_t edge_idx = 0; edge_idx < tg.edges().size(); ++edge_idx) {
+        EdgeId edge_id(edge_idx);
+
+        BinaryEchoEdge edge;
+        edge.src_node = size_t(tg.edge_src_node(edge_id));
+        edge.sink_node = size_t(tg.edge_sink_node(edge_id));
+        edge.type = static_cast<uint8_t>(tg.edge_type(edge_id));
+        edge.disabled = tg.edge_disabled(edge_id);
+        edges.push_back(edge);
+    }
+    write_binary_section(os, edges);
+
+    //Timing constraints
+    uint64_t num_domains = tc.clock_domains().size();
+    os.write(reinterpret_cast<const char*>(&num_domains), sizeof(num_domains));
+    for(auto domain_id : tc.clock_domains()) {
+        std::string name = tc.clock_domain_name(domain_id);
+
+        BinaryEchoDomain domain;
+        domain.domain = size_t(domain_id);
+        domain.name_size = name.size();
+        os.write(reinterpret_cast<const char*>(&domain), sizeof(domain));
+        os.write(name.data(), name.size());
+    }
+
+    std::vector<BinaryEchoConstraint> constraints;
+    for(auto domain_id : tc.clock_domains()) {
+        NodeId source_node_id = tc.clock_domain_source_node(domain_id);
+        if(source_node_id) {
+            constraints.push_back(binary_constraint(ConstraintKind::CLOCK_SOURCE, size_t(source_node_id), size_t(domain_id), -1, 0.));
+        }
+    }
+    for(auto node_id : tc.constant_generators()) {
+        constraints.push_back(binary_constraint(ConstraintKind::CONSTANT_GENERATOR, size_t(node_id), -1, -1, 0.));
+    }
+    for(DelayType delay_type : {DelayType::MAX, DelayType::MIN}) {
+        for(auto kv : tc.input_constraints(delay_type)) {
+            if(kv.second.constraint.valid()) {
+                constraints.push_back(binary_constraint(delay_type == DelayType::MAX ? ConstraintKind::MAX_INPUT_CONSTRAINT : ConstraintKind::MIN_INPUT_CONSTRAINT,
+                                                        size_t(kv.first), size_t(kv.second.domain), -1, kv.second.constraint.value()));
+            }
+        }
+    }
+    for(DelayType delay_type : {DelayType::MAX, DelayType::MIN}) {
+        for(auto kv : tc.output_constraints(delay_type)) {
+            if(kv.second.constraint.valid()) {
+                constraints.push_back(binary_constraint(delay_type == DelayType::MAX ? ConstraintKind::MAX_OUTPUT_CONSTRAINT : ConstraintKind::MIN_OUTPUT_CONSTRAINT,
+                                                        size_t(kv.first), size_t(kv.second.domain), -1, kv.second.constraint.value()));
+            }
+        }
+    }
+    for(auto kv : tc.setup_constraints()) {
+        if(kv.second.valid()) {
+            int capture_node = kv.first.capture_node ? int(size_t(kv.first.capture_node)) : -1;
+            constraints.push_back(binary_constraint(ConstraintKind::SETUP_CONSTRAINT, capture_node,
+                                                    size_t(kv.first.domain_pair.src_domain_id), size_t(kv.first.domain_pair.sink_domain_id), kv.second.value()));
+        }
+    }
+    for(auto kv : tc.hold_constraints()) {
+        if(kv.second.valid()) {
+            int capture_node = kv.first.capture_node ? int(size_t(kv.first.capture_node)) : -1;
+            constraints.push_back(binary_constraint(ConstraintKind::HOLD_CONSTRAINT, capture_node,
+                                                    size_t(kv.first.domain_pair.src_domain_id), size_t(kv.first.domain_pair.sink_domain_id), kv.second.value()));
+        }
+    }
+    for(auto kv : tc.setup_clock_uncertainties()) {
+        constraints.push_back(binary_constraint(ConstraintKind::SETUP_UNCERTAINTY, -1, size_t(kv.first.src_domain_id), size_t(kv.first.sink_domain_id), kv.second.value()));
+    }
+    for(auto kv : tc.hold_clock_uncertainties()) {
+        constraints.push_back(binary_constraint(ConstraintKind::HOLD_UNCERTAINTY, -1, size_t(kv.first.src_domain_id), size_t(kv.first.sink_domain_id), kv.second.value()));
+    }
+    for(auto kv : tc.source_latencies(ArrivalType::EARLY)) {
+        constraints.push_back(binary_constraint(ConstraintKind::EARLY_SOURCE_LATENCY, -1, size_t(kv.first), -1, kv.second.value()));
+    }
+    for(auto kv : tc.source_latencies(ArrivalType::LATE)) {
+        constraints.push_back(binary_constraint(ConstraintKind::LATE_SOURCE_LATENCY, -1, size_t(kv.first), -1, kv.second.value()));
+    }
+    write_binary_section(os, constraints);
+
+    //Delay model
+    std::vector<BinaryEchoDelay> delays;
+    delays.reserve(tg.edges().size());
+    for(size_t edge_idx = 0; edge_idx < tg.edges().size(); ++edge_idx) {
+        EdgeId edge_id(edge_idx);
+        NodeId src_node = tg.edge_src_node(edge_id);
+        NodeId sink_node = tg.edge_sink_node(edge_id);
+
+        BinaryEchoDelay delay;
+        if(tg.node_type(src_node) == NodeType::CPIN && tg.node_type(sink_node) == NodeType::SINK) {
+            delay.kind = static_cast<uint8_t>(DelayKind::SETUP_HOLD_TIME);
+            delay.first = dc.setup_time(tg, edge_id).value();
+            delay.second = dc.hold_time(tg, edge_id).value();
+        } else {
+            delay.kind = static_cast<uint8_t>(DelayKind::EDGE_DELAY);
+            delay.first = dc.min_edge_delay(tg, edge_id).value();
+            delay.second = dc.max_edge_delay(tg, edge_id).value();
+        }
+        delays.push_back(delay);
+    }
+    write_binary_section(os, delays);
+
+    //Analysis results, in the same order as write_analysis_result()
+    std::vector<BinaryEchoResult> results;
+    auto setup_analyzer = std::dynamic_pointer_cast<const SetupTimingAnalyzer>(analyzer);
+    if(setup_analyzer) {
+        const std::pair<ResultType, TagType> tag_types[] = {{ResultType::SETUP_DATA_ARRIVAL, TagType::DATA_ARRIVAL},
+                                                            {ResultType::SETUP_DATA_REQUIRED, TagType::DATA_REQUIRED},
+                                                            {ResultType::SETUP_LAUNCH_CLOCK, TagType::CLOCK_LAUNCH},
+                                                            {ResultType::SETUP_CAPTURE_CLOCK, TagType::CLOCK_CAPTURE}};
+        for(const auto& tag_type : tag_types) {
+            for(size_t node_idx = 0; node_idx < tg.nodes().size(); ++node_idx) {
+                add_binary_results(results, tag_type.first, ResultTarget::NODE_TAG, setup_analyzer->setup_tags(NodeId(node_idx), tag_type.second), node_idx);
+            }
+        }
+#ifdef TATUM_CALCULATE_EDGE_SLACKS
+        for(size_t edge_idx = 0; edge_idx < tg.edges().size(); ++edge_idx) {
+            add_binary_results(results, ResultType::SETUP_SLACK, ResultTarget::EDGE_SLACK, setup_analyzer->setup_slacks(EdgeId(edge_idx)), edge_idx);
+        }
+#endif
+        for(size_t node_idx = 0; node_idx < tg.nodes().size(); ++node_idx) {
+            add_binary_results(results, ResultType::SETUP_SLACK, ResultTarget::NODE_SLACK, setup_analyzer->setup_slacks(NodeId(node_idx)), node_idx);
+        }
+    }
+    auto hold_analyzer = std::dynamic_pointer_cast<const HoldTimingAnalyzer>(analyzer);
+    if(hold_analyzer) {
+        const std::pair<ResultType, TagType> tag_types[] = {{ResultType::HOLD_DATA_ARRIVAL, TagType::DATA_ARRIVAL},
+                                                            {ResultType::HOLD_DATA_REQUIRED, TagType::DATA_REQUIRED},
+                                                            {ResultType::HOLD_LAUNCH_CLOCK, TagType::CLOCK_LAUNCH},
+                                                            {ResultType::HOLD_CAPTURE_CLOCK, TagType::CLOCK_CAPTURE}};
+        for(const auto& tag_type : tag_types) {
+            for(size_t node_idx = 0; node_idx < tg.nodes().size(); ++node_idx) {
+                add_binary_results(results, tag_type.first, ResultTarget::NODE_TAG, hold_analyzer->hold_tags(NodeId(node_idx), tag_type.second), node_idx);
+            }
+        }
+#ifdef TATUM_CALCULATE_EDGE_SLACKS
+        for(size_t edge_idx = 0; edge_idx < tg.edges().size(); ++edge_idx) {
+            add_binary_results(results, ResultType::HOLD_SLACK, ResultTarget::EDGE_SLACK, hold_analyzer->hold_slacks(EdgeId(edge_idx)), edge_idx);
+        }
+#endif
+        for(size_t node_idx = 0; node_idx < tg.nodes().size(); ++node_idx) {
+            add_binary_results(results, ResultType::HOLD_SLACK, ResultTarget::NODE_SLACK, hold_analyzer->hold_slacks(NodeId(node_idx)), node_idx);
+        }
+    }
+    write_binary_section(os, results);
+}
+
+void add_binary_results(std::vector<echo_binary::BinaryEchoResult>& results, echo_binary::ResultType type, echo_binary::ResultTarget target, const TimingTags::tag_range tags, size_t id) {
+    for(const auto& tag : tags) {
+        float time = tag.time().value();
+
+        if(!std::isnan(time)) {
+            echo_binary::BinaryEchoResult result;
+            result.type = static_cast<uint8_t>(type);
+            result.target = static_cast<uint8_t>(target);
+            result.id = id;
+            result.launch_domain = tag.launch_clock_domain() ? int(size_t(tag.launch_clock_domain())) : -1;
+            result.capture_domain = tag.capture_clock_domain() ? int(size_t(tag.capture_clock_domain())) : -1;
+            result.time = time;
+            results.push_back(result);
+        }
+    }
+}
+
 }
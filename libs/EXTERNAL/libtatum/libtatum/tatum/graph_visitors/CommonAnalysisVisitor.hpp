@@ -229,23 +229,27 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_pre_traverse_node(const Timi
                 DomainId domain_id = tc.node_clock_domain(node_id);
                 TATUM_ASSERT(domain_id);
 
-                //The external clock may have latency
-                Time launch_source_latency = ops_.launch_source_latency(tc, domain_id);
-
-                //An input constraint means there is 'input_constraint' delay from when an external 
-                //signal is launched by its clock (external to the chip) until it arrives at the
-                //primary input
-                Time input_constraint = ops_.input_constraint(tc, node_id, domain_id);
-                TATUM_ASSERT(input_constraint.valid());
-
-                //Initialize a data tag based on input delay constraint
-                TimingTag input_tag = TimingTag(launch_source_latency + input_constraint, 
-                                                domain_id, 
-                                                DomainId::INVALID(), 
-                                                NodeId::INVALID(), //Origin
-                                                TagType::DATA_ARRIVAL);
+                //Paths from a launch domain which is cut from every capture domain are never
+                //analyzed, so no data tags are created for them
+                if(tc.should_analyze_launch_domain(domain_id)) {
+                    //The external clock may have latency
+                    Time launch_source_latency = ops_.launch_source_latency(tc, domain_id);
+
+                    //An input constraint means there is 'input_constraint' delay from when an external 
+                    //signal is launched by its clock (external to the chip) until it arrives at the
+                    //primary input
+                    Time input_constraint = ops_.input_constraint(tc, node_id, domain_id);
+                    TATUM_ASSERT(input_constraint.valid());
+
+                    //Initialize a data tag based on input delay constraint
+                    TimingTag input_tag = TimingTag(launch_source_latency + input_constraint, 
+                                                    domain_id, 
+                                                    DomainId::INVALID(), 
+                                                    NodeId::INVALID(), //Origin
+                                                    TagType::DATA_ARRIVAL);
 
-                ops_.merge_arr_tags(node_id, input_tag);
+                    ops_.merge_arr_tags(node_id, input_tag);
+                }
 
                 node_constrained = true;
             }
@@ -350,6 +354,10 @@ bool CommonAnalysisVisitor<AnalysisOps>::do_arrival_traverse_edge(const TimingGr
             const Time launch_edge_delay = ops_.launch_clock_edge_delay(dc, tg, edge_id);
 
             for(const TimingTag& src_launch_clk_tag : src_launch_clk_tags) {
+                //Data launched by a domain which is cut from every capture domain is never
+                //analyzed, so is not propagated (the clock tags are kept for the clock network)
+                if(!tc.should_analyze_launch_domain(src_launch_clk_tag.launch_clock_domain())) continue;
+
                 //Convert clock launch into data arrival
                 TimingTag data_arr_tag = src_launch_clk_tag;
                 data_arr_tag.set_type(TagType::DATA_ARRIVAL);
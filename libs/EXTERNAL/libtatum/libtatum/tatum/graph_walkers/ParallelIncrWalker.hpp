@@ -0,0 +1,492 @@
+#pragma once
+#include <algorithm>
+
+#ifdef TATUM_USE_TBB
+#include <tbb/concurrent_vector.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_for_each.h>
+#include <tbb/combinable.h>
+#endif
+
+#include "tatum/graph_walkers/TimingGraphWalker.hpp"
+#include "tatum/TimingGraph.hpp"
+#include "tatum/delay_calc/DelayCalculator.hpp"
+#include "tatum/graph_visitors/GraphVisitor.hpp"
+
+namespace tatum {
+
+/**
+ * A parallel graph walker which incrementally updates the timing graph.
+ *
+ * It performs the same incremental traversal as SerialIncrWalker (including
+ * its edge invalidation, see TATUM_INCR_BLOCK_INVALIDATION), but the nodes
+ * queued on each level of the invalidated cone are processed in parallel using
+ * Thread Building Blocks (TBB), as in ParallelLevelizedWalker. If TBB is not
+ * available it operates serially and is equivalent to SerialIncrWalker.
+ *
+ * Processing a node only changes the node's own tags, and the invalidation
+ * state of its own in/out edges, none of which are touched by any other node
+ * on the same level. Only the enqueuing of the nodes dependent on an updated
+ * node is shared between the threads: each thread records the nodes it enqueues
+ * (and the nodes it modifies) locally, and these are merged into the per-level
+ * queues between levels. Since the nodes of each level are sorted before being
+ * processed, the analysis result does not depend on the number of threads.
+ *
+ * As with SerialIncrWalker, the timing constraints are assumed not to change
+ * between updates.
+ */
+class ParallelIncrWalker : public TimingGraphWalker {
+    protected:
+        void invalidate_edge_impl(const EdgeId edge) override {
+            if (is_invalidated(edge)) return;
+
+            invalidated_edges_.push_back(edge);
+
+            mark_invalidated(edge);
+        }
+
+        void clear_invalidated_edges_impl() override {
+            //Only reset the flags which were set, which avoids re-initializing
+            //(and re-allocating) them for every edge on each update
+            for (EdgeId edge : invalidated_edges_) {
+                edge_invalidated_[edge] = false;
+            }
+            invalidated_edges_.clear();
+        }
+
+        node_range modified_nodes_impl() const override {
+            return tatum::util::make_range(nodes_modified_.cbegin(), nodes_modified_.cend());
+        }
+
+        void do_arrival_pre_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, GraphVisitor& visitor) override {
+            LevelId first_level = *tg.levels().begin();
+            auto nodes = tg.level_nodes(first_level);
+#if defined(TATUM_USE_TBB)
+            tbb::combinable<size_t> unconstrained_counter(zero);
+
+            tbb::parallel_for_each(nodes.begin(), nodes.end(), [&](auto node) {
+                bool constrained = visitor.do_arrival_pre_traverse_node(tg, tc, node);
+
+                if(!constrained) {
+                    unconstrained_counter.local() += 1;
+                }
+            });
+
+            num_unconstrained_startpoints_ = unconstrained_counter.combine(std::plus<size_t>());
+#else //Serial
+            num_unconstrained_startpoints_ = 0;
+            for(NodeId node_id : nodes) {
+                bool constrained = visitor.do_arrival_pre_traverse_node(tg, tc, node_id);
+
+                if(!constrained) {
+                    ++num_unconstrained_startpoints_;
+                }
+            }
+#endif
+        }
+
+        void do_required_pre_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, GraphVisitor& visitor) override {
+            const auto& po = tg.logical_outputs();
+#if defined(TATUM_USE_TBB)
+            tbb::combinable<size_t> unconstrained_counter(zero);
+
+            tbb::parallel_for_each(po.begin(), po.end(), [&](auto node) {
+                bool constrained = visitor.do_required_pre_traverse_node(tg, tc, node);
+
+                if(!constrained) {
+                    unconstrained_counter.local() += 1;
+                }
+            });
+
+            num_unconstrained_endpoints_ = unconstrained_counter.combine(std::plus<size_t>());
+#else //Serial
+            num_unconstrained_endpoints_ = 0;
+            for(NodeId node_id : po) {
+                bool constrained = visitor.do_required_pre_traverse_node(tg, tc, node_id);
+
+                if(!constrained) {
+                    ++num_unconstrained_endpoints_;
+                }
+            }
+#endif
+        }
+
+        void do_arrival_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            prepare_incr_update(tg);
+
+            //Note that max_level grows as updated nodes enqueue their fanout
+            for(int level_idx = incr_arr_update_.min_level; level_idx <= incr_arr_update_.max_level; ++level_idx) {
+                auto& level_nodes = incr_arr_update_.nodes_to_process[level_idx];
+
+                //Sorting the level nodes tends to help memory locality, and makes the
+                //traversal independent of the order the nodes were enqueued in
+                sort(level_nodes);
+
+                for_each_node(level_nodes, [&](NodeId node) {
+                    t_thread_updates& updates = local_updates();
+
+                    invalidate_node_for_arrival_traversal(node, tg, visitor, updates);
+
+                    bool node_updated = visitor.do_arrival_traverse_node(tg, tc, dc, node);
+
+                    if (node_updated) {
+                        //Record that this node was updated, for later efficient slack update
+                        updates.modified_nodes.push_back(node);
+
+                        //Queue this node's downstream dependencies for updating
+                        for (EdgeId edge : tg.node_out_edges(node)) {
+                            NodeId snk_node = tg.edge_sink_node(edge);
+                            enqueue_node(snk_node, edge, updates.arr_nodes);
+                        }
+                    }
+                });
+
+                merge_thread_updates(tg);
+            }
+        }
+
+        void do_required_traversal_impl(const TimingGraph& tg, const TimingConstraints& tc, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            //Note that min_level shrinks as updated nodes enqueue their fanin
+            for(int level_idx = incr_req_update_.max_level; level_idx >= incr_req_update_.min_level; --level_idx) {
+                auto& level_nodes = incr_req_update_.nodes_to_process[level_idx];
+
+                //Sorting the level nodes tends to help memory locality, and makes the
+                //traversal independent of the order the nodes were enqueued in
+                sort(level_nodes);
+
+                for_each_node(level_nodes, [&](NodeId node) {
+                    t_thread_updates& updates = local_updates();
+
+                    invalidate_node_for_required_traversal(node, tg, visitor);
+
+                    bool node_updated = visitor.do_required_traverse_node(tg, tc, dc, node);
+
+                    if (node_updated) {
+                        //Record that this node was updated, for later efficient slack update
+                        updates.modified_nodes.push_back(node);
+
+                        //Queue this node's upstream dependencies for updating
+                        for (EdgeId edge : tg.node_in_edges(node)) {
+                            NodeId src_node = tg.edge_src_node(edge);
+                            enqueue_node(src_node, edge, updates.req_nodes);
+                        }
+                    }
+                });
+
+                merge_thread_updates(tg);
+            }
+        }
+
+        void do_update_slack_impl(const TimingGraph& tg, const DelayCalculator& dc, GraphVisitor& visitor) override {
+            sort(nodes_modified_);
+
+            for_each_node(nodes_modified_, [&](NodeId node) {
+#ifdef TATUM_CALCULATE_EDGE_SLACKS
+                for (EdgeId edge : tg.node_in_edges(node)) {
+                    visitor.do_reset_edge(edge);
+                }
+#endif
+                visitor.do_reset_node_slack_tags(node);
+
+                visitor.do_slack_traverse_node(tg, dc, node);
+            });
+        }
+
+        void do_reset_impl(const TimingGraph& tg, GraphVisitor& visitor) override {
+            auto nodes = tg.nodes();
+#if defined(TATUM_USE_TBB)
+            tbb::parallel_for_each(nodes.begin(), nodes.end(), [&](auto node) {
+                visitor.do_reset_node(node);
+            });
+#   ifdef TATUM_CALCULATE_EDGE_SLACKS
+            auto edges = tg.edges();
+            tbb::parallel_for_each(edges.begin(), edges.end(), [&](auto edge) {
+                visitor.do_reset_edge(edge);
+            });
+#   endif
+#else //Serial
+            for(NodeId node_id : nodes) {
+                visitor.do_reset_node(node_id);
+            }
+#   ifdef TATUM_CALCULATE_EDGE_SLACKS
+            for(EdgeId edge_id : tg.edges()) {
+                visitor.do_reset_edge(edge_id);
+            }
+#   endif
+#endif
+        }
+
+        size_t num_unconstrained_startpoints_impl() const override { return num_unconstrained_startpoints_; }
+        size_t num_unconstrained_endpoints_impl() const override { return num_unconstrained_endpoints_; }
+    private:
+
+        /*
+         * The nodes enqueued/modified by one thread while processing a level
+         */
+        struct t_thread_updates {
+            std::vector<NodeId> arr_nodes;
+            std::vector<NodeId> req_nodes;
+            std::vector<NodeId> modified_nodes;
+        };
+
+        //Calls fn on each of the nodes, in parallel if possible
+        template<class Fn>
+        void for_each_node(const std::vector<NodeId>& nodes, const Fn& fn) {
+#if defined(TATUM_USE_TBB)
+            if (nodes.size() >= MIN_PARALLEL_LEVEL_NODES) {
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, nodes.size(), MIN_PARALLEL_LEVEL_NODES / 2), [&](const tbb::blocked_range<size_t>& range) {
+                    for (size_t inode = range.begin(); inode != range.end(); ++inode) {
+                        fn(nodes[inode]);
+                    }
+                });
+                return;
+            }
+#endif
+            //Serial (or too few nodes for parallel processing to pay off)
+            for (NodeId node : nodes) {
+                fn(node);
+            }
+        }
+
+        t_thread_updates& local_updates() {
+#if defined(TATUM_USE_TBB)
+            return thread_updates_.local();
+#else
+            return thread_updates_;
+#endif
+        }
+
+        //Moves the nodes recorded by each thread into the shared queues
+        void merge_thread_updates(const TimingGraph& tg) {
+#if defined(TATUM_USE_TBB)
+            for (t_thread_updates& updates : thread_updates_) {
+                merge_updates(tg, updates);
+            }
+#else
+            merge_updates(tg, thread_updates_);
+#endif
+        }
+
+        void merge_updates(const TimingGraph& tg, t_thread_updates& updates) {
+            for (NodeId node : updates.arr_nodes) {
+                incr_arr_update_.enqueue_node(tg, node);
+            }
+            for (NodeId node : updates.req_nodes) {
+                incr_req_update_.enqueue_node(tg, node);
+            }
+            for (NodeId node : updates.modified_nodes) {
+                enqueue_modified_node(node);
+            }
+            updates.arr_nodes.clear();
+            updates.req_nodes.clear();
+            updates.modified_nodes.clear();
+        }
+
+        bool is_invalidated(EdgeId edge) const {
+            if (edge_invalidated_.size() > size_t(edge)) {
+                return edge_invalidated_[edge];
+            }
+            return false; //Not yet marked, so not invalid
+        }
+
+        bool not_invalidated(EdgeId edge) const {
+            return !is_invalidated(edge);
+        }
+
+        void mark_invalidated(EdgeId edge) {
+            if (edge_invalidated_.size() <= size_t(edge)) {
+                edge_invalidated_.resize(size_t(edge)+1, false);
+            }
+            edge_invalidated_[edge] = true;
+        }
+
+        //Invalidates edge during a traversal. The invalidation flags are
+        //sized for every edge before the traversal, and each edge is only
+        //invalidated by the thread processing one of its end-points.
+        void invalidate_traversal_edge(EdgeId edge) {
+            if (edge_invalidated_[edge]) return;
+
+            edge_invalidated_[edge] = true;
+
+            invalidated_edges_.push_back(edge);
+        }
+
+        //Invalidates edge and records node (which was invalidated by edge) for processing
+        void enqueue_node(NodeId node, EdgeId invalidated_edge, std::vector<NodeId>& thread_nodes) {
+            invalidate_traversal_edge(invalidated_edge);
+            thread_nodes.push_back(node);
+        }
+
+        //Record the specified node as having been modified
+        void enqueue_modified_node(const NodeId node) {
+            if (node_is_modified_[node]) return;
+
+            node_is_modified_[node] = true;
+
+            nodes_modified_.push_back(node);
+        }
+
+        void sort(std::vector<NodeId>& nodes) {
+            std::sort(nodes.begin(), nodes.end());
+        }
+
+        void prepare_incr_update(const TimingGraph& tg) {
+            //Reset incremental traversal tracking data
+            for (NodeId node : nodes_modified_) {
+                node_is_modified_[node] = false;
+            }
+            nodes_modified_.clear();
+
+            if (node_is_modified_.size() < tg.nodes().size()) {
+                node_is_modified_.resize(tg.nodes().size(), false);
+            }
+            if (edge_invalidated_.size() < tg.edges().size()) {
+                edge_invalidated_.resize(tg.edges().size(), false);
+            }
+
+            incr_arr_update_.reset(tg);
+            incr_req_update_.reset(tg);
+
+            //Process the externally invalidated edges to prepare for the incremental traversal
+            for (EdgeId edge : invalidated_edges_) {
+                incr_arr_update_.enqueue_node(tg, tg.edge_sink_node(edge));
+                incr_req_update_.enqueue_node(tg, tg.edge_src_node(edge));
+            }
+        }
+
+        void invalidate_node_for_arrival_traversal(const NodeId node, const TimingGraph& tg, GraphVisitor& visitor, t_thread_updates& updates) {
+#ifdef TATUM_INCR_BLOCK_INVALIDATION
+            //Block invalidation
+            visitor.do_reset_node_arrival_tags(node);
+            static_cast<void>(tg);
+            static_cast<void>(updates);
+#else
+            //Edge invalidation (see SerialIncrWalker for details)
+            for (EdgeId edge : tg.node_in_edges(node)) {
+                if (not_invalidated(edge)) continue;
+
+                NodeId src_node = tg.edge_src_node(edge);
+                visitor.do_reset_node_arrival_tags_from_origin(node, /*origin=*/src_node);
+
+                EdgeType edge_type = tg.edge_type(edge);
+                if (edge_type == EdgeType::PRIMITIVE_CLOCK_CAPTURE) {
+                    //Required times of sinks are set from the clock capture during the arrival
+                    //traversal, so must be re-calculated, and the sink's fanin re-traversed for
+                    //required times
+                    visitor.do_reset_node_required_tags(node);
+
+                    for (EdgeId sink_in_edge : tg.node_in_edges(node)) {
+                        NodeId sink_src_node = tg.edge_src_node(sink_in_edge);
+                        enqueue_node(sink_src_node, sink_in_edge, updates.req_nodes);
+                    }
+                } else if (edge_type == EdgeType::PRIMITIVE_CLOCK_LAUNCH) {
+                    //Clock launch tags become data arrival tags at SOURCE nodes
+                    visitor.do_reset_node_arrival_tags(node);
+                }
+            }
+#endif
+        }
+
+        void invalidate_node_for_required_traversal(const NodeId node, const TimingGraph& tg, GraphVisitor& visitor) {
+#ifdef TATUM_INCR_BLOCK_INVALIDATION
+            //Block invalidation
+            visitor.do_reset_node_required_tags(node);
+            static_cast<void>(tg);
+#else
+            //Edge invalidation
+            for (EdgeId edge : tg.node_out_edges(node)) {
+                if (not_invalidated(edge)) continue;
+
+                NodeId snk_node = tg.edge_sink_node(edge);
+                visitor.do_reset_node_required_tags_from_origin(node, /*origin=*/snk_node);
+            }
+#endif
+        }
+
+        /*
+         * Helper struct to record incremental traversal information
+         */
+        struct t_incr_traversal_update {
+            public:
+
+                //The nodes per-level which need to be updated/processed
+                std::vector<std::vector<NodeId>> nodes_to_process;
+
+                //The range of levels which need to be updated
+                int min_level = 0;
+                int max_level = 0;
+
+                void enqueue_node(const TimingGraph& tg, NodeId node) {
+                    if (node_is_enqueued[node]) return;
+
+                    node_is_enqueued[node] = true;
+
+                    int level = size_t(tg.node_level(node));
+
+                    nodes_to_process[level].push_back(node);
+                    min_level = std::min(min_level, level);
+                    max_level = std::max(max_level, level);
+                }
+
+                //Empties the queues (only touching the levels which were used)
+                void reset(const TimingGraph& tg) {
+                    if (nodes_to_process.size() != tg.levels().size()) {
+                        nodes_to_process.clear();
+                        nodes_to_process.resize(tg.levels().size());
+                        node_is_enqueued.clear();
+                        min_level = 0;
+                        max_level = -1;
+                    }
+                    for (int level = min_level; level <= max_level; ++level) {
+                        for (NodeId node : nodes_to_process[level]) {
+                            node_is_enqueued[node] = false;
+                        }
+                        nodes_to_process[level].clear();
+                    }
+                    if (node_is_enqueued.size() < tg.nodes().size()) {
+                        node_is_enqueued.resize(tg.nodes().size(), false);
+                    }
+
+                    min_level = size_t(*(tg.levels().end() - 1));
+                    max_level = size_t(*tg.levels().begin());
+                }
+
+            private:
+                //Flags recording whether a node has already been enqueued
+                tatum::util::linear_map<NodeId,char> node_is_enqueued;
+        };
+
+        //Levels with fewer nodes than this are processed serially
+        static constexpr size_t MIN_PARALLEL_LEVEL_NODES = 64;
+
+#if defined(TATUM_USE_TBB)
+        //Function to initialize tbb:combinable<size_t> to zero (see ParallelLevelizedWalker)
+        static size_t zero() { return 0; }
+#endif
+
+        //State info about the incremental arr/req updates
+        t_incr_traversal_update incr_arr_update_;
+        t_incr_traversal_update incr_req_update_;
+
+        /** Set of invalidated edges, and flags for membership.
+         * The flags are chars (rather than bools) so that flags of distinct
+         * edges can be written concurrently */
+#ifdef TATUM_USE_TBB
+        tbb::concurrent_vector<EdgeId> invalidated_edges_;
+        tbb::enumerable_thread_specific<t_thread_updates> thread_updates_;
+#else
+        std::vector<EdgeId> invalidated_edges_;
+        t_thread_updates thread_updates_;
+#endif
+        tatum::util::linear_map<EdgeId,char> edge_invalidated_;
+
+        //Nodes which have been modified during timing update, and flags for membership
+        std::vector<NodeId> nodes_modified_;
+        tatum::util::linear_map<NodeId,char> node_is_modified_;
+
+        size_t num_unconstrained_startpoints_ = 0;
+        size_t num_unconstrained_endpoints_ = 0;
+};
+
+} //namepsace
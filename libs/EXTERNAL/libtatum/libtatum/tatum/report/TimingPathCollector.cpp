@@ -4,6 +4,11 @@
 #include "tatum/report/TimingReportTagRetriever.hpp"
 #include "tatum/report/timing_path_tracing.hpp"
 #include <map>
+#include <algorithm>
+
+#ifdef TATUM_USE_TBB
+# include <tbb/parallel_for.h>
+#endif
 
 namespace tatum {
 
@@ -12,9 +17,19 @@ std::vector<TimingPath> collect_worst_timing_paths(const TimingGraph& timing_gra
 std::vector<SkewPath> collect_worst_skew_paths(const TimingGraph& timing_graph, const TimingConstraints& timing_constraings,
                                               const detail::TagRetriever& tag_retriever, TimingType timing_type, size_t npaths);
 
-std::vector<TimingPath> collect_worst_timing_paths(const TimingGraph& timing_graph, const detail::TagRetriever& tag_retriever, size_t npaths) {
-    std::vector<TimingPath> paths;
+//Calls f(i) for each index in [0, num_indices), concurrently if possible
+template<class F>
+void for_each_index(size_t num_indices, const F& f) {
+#ifdef TATUM_USE_TBB
+    tbb::parallel_for(size_t(0), num_indices, f);
+#else
+    for(size_t i = 0; i < num_indices; ++i) {
+        f(i);
+    }
+#endif
+}
 
+std::vector<TimingPath> collect_worst_timing_paths(const TimingGraph& timing_graph, const detail::TagRetriever& tag_retriever, size_t npaths) {
     struct TagNode {
         TagNode(TimingTag t, NodeId n) noexcept
             : tag(t), node(n) {}
@@ -33,113 +48,144 @@ std::vector<TimingPath> collect_worst_timing_paths(const TimingGraph& timing_gra
         }
     }
 
-    //Sort in ascending slack order so most negative slacks are first
+    //Sort in ascending slack order so most negative slacks are first.
+    //Only the worst npaths are needed, so only they are sorted. Ties are broken by
+    //node and clock domains so the order does not depend on the sorting algorithm.
     auto ascending_slack_order = [](const TagNode& lhs, const TagNode& rhs) {
-        return lhs.tag.time() < rhs.tag.time();
+        if (lhs.tag.time() != rhs.tag.time()) {
+            return lhs.tag.time() < rhs.tag.time();
+        }
+        if (lhs.node != rhs.node) {
+            return lhs.node < rhs.node;
+        }
+        if (lhs.tag.launch_clock_domain() != rhs.tag.launch_clock_domain()) {
+            return lhs.tag.launch_clock_domain() < rhs.tag.launch_clock_domain();
+        }
+        return lhs.tag.capture_clock_domain() < rhs.tag.capture_clock_domain();
     };
-    std::sort(tags_and_sinks.begin(), tags_and_sinks.end(), ascending_slack_order);
-
+    size_t num_paths = std::min(npaths, tags_and_sinks.size());
+    std::partial_sort(tags_and_sinks.begin(), tags_and_sinks.begin() + num_paths, tags_and_sinks.end(), ascending_slack_order);
 
-    //Trace the paths for each tag/node pair
-    // The the map will sort the nodes and tags from worst to best slack (i.e. ascending slack order),
-    // so the first pair is the most critical end-point
-    for(const auto& tag_node : tags_and_sinks) {
-        NodeId sink_node = tag_node.node;
-        TimingTag sink_tag = tag_node.tag;
+    //Trace the paths for the worst tag/node pairs (first is the most critical end-point).
+    //The paths are independent, so are traced concurrently
+    std::vector<TimingPath> paths(num_paths);
+    for_each_index(num_paths, [&](size_t ipath) {
+        NodeId sink_node = tags_and_sinks[ipath].node;
+        TimingTag sink_tag = tags_and_sinks[ipath].tag;
 
-        TimingPath path = detail::trace_path(timing_graph, tag_retriever, sink_tag.launch_clock_domain(), sink_tag.capture_clock_domain(), sink_node); 
-
-        paths.push_back(path);
-
-        if(paths.size() >= npaths) break;
-    }
+        paths[ipath] = detail::trace_path(timing_graph, tag_retriever, sink_tag.launch_clock_domain(), sink_tag.capture_clock_domain(), sink_node); 
+    });
 
     return paths;
 }
 
 std::vector<SkewPath> collect_worst_skew_paths(const TimingGraph& timing_graph, const TimingConstraints& timing_constraints, 
                                                const detail::TagRetriever& tag_retriever, TimingType timing_type, size_t npaths) {
-    std::vector<SkewPath> paths;
+    struct TagNode {
+        TagNode(TimingTag t, NodeId n) noexcept
+            : tag(t), node(n) {}
 
+        TimingTag tag;
+        NodeId node;
+    };
+
+    //Collect the required times of all sinks, each of which has a skew path
+    std::vector<TagNode> required_tags_and_sinks;
     for(NodeId node : timing_graph.nodes()) {
         NodeType node_type = timing_graph.node_type(node);
         if (node_type != NodeType::SINK) continue;
 
-        const auto& required_tags = tag_retriever.tags(node, TagType::DATA_REQUIRED);
+        for (const TimingTag& required_tag : tag_retriever.tags(node, TagType::DATA_REQUIRED)) {
+            required_tags_and_sinks.emplace_back(required_tag, node);
+        }
+    }
+
+    //Trace the paths concurrently (in the same order as above, so the result does not depend on the
+    //scheduling). Paths launched by constant generators have no skew, and are then dropped.
+    std::vector<SkewPath> all_paths(required_tags_and_sinks.size());
+    std::vector<char> is_skew_path(required_tags_and_sinks.size(), false);
+    for_each_index(required_tags_and_sinks.size(), [&](size_t itag) {
+        NodeId node = required_tags_and_sinks[itag].node;
+        const TimingTag& required_tag = required_tags_and_sinks[itag].tag;
 
-        for (auto& required_tag : required_tags) {
-            SkewPath path;
+        SkewPath& path = all_paths[itag];
 
-            path.launch_domain = required_tag.launch_clock_domain();
-            path.capture_domain = required_tag.capture_clock_domain();
+        path.launch_domain = required_tag.launch_clock_domain();
+        path.capture_domain = required_tag.capture_clock_domain();
 
-            TimingSubPath data_arrival_path = detail::trace_data_arrival_path(timing_graph, tag_retriever, path.launch_domain, path.capture_domain, node);
+        TimingSubPath data_arrival_path = detail::trace_data_arrival_path(timing_graph, tag_retriever, path.launch_domain, path.capture_domain, node);
 
-            TATUM_ASSERT(!data_arrival_path.elements().empty());
-            auto& data_launch_elem = *data_arrival_path.elements().begin(); 
+        TATUM_ASSERT(!data_arrival_path.elements().empty());
+        auto& data_launch_elem = *data_arrival_path.elements().begin(); 
 
-            //Constant generators do not have skew
-            if (is_const_gen_tag(data_launch_elem.tag())) continue;
+        //Constant generators do not have skew
+        if (is_const_gen_tag(data_launch_elem.tag())) return;
 
-            path.data_launch_node = data_launch_elem.node();
-            path.data_capture_node = node;
+        path.data_launch_node = data_launch_elem.node();
+        path.data_capture_node = node;
 
-            path.clock_launch_path = detail::trace_clock_launch_path(timing_graph, tag_retriever, path.launch_domain, path.capture_domain, path.data_launch_node);
-            path.clock_capture_path = detail::trace_clock_capture_path(timing_graph, tag_retriever, path.launch_domain, path.capture_domain, path.data_capture_node);
+        path.clock_launch_path = detail::trace_clock_launch_path(timing_graph, tag_retriever, path.launch_domain, path.capture_domain, path.data_launch_node);
+        path.clock_capture_path = detail::trace_clock_capture_path(timing_graph, tag_retriever, path.launch_domain, path.capture_domain, path.data_capture_node);
 
-            if (path.clock_launch_path.elements().empty()) {
-                //Primary input
-                path.clock_launch_arrival = data_launch_elem.tag().time();
+        if (path.clock_launch_path.elements().empty()) {
+            //Primary input
+            path.clock_launch_arrival = data_launch_elem.tag().time();
 
-                //Adjust for input delay
-                if (timing_type == TimingType::SETUP) {
-                    path.clock_launch_arrival -= timing_constraints.input_constraint(path.data_launch_node, path.launch_domain, DelayType::MAX);
-                } else {
-                    TATUM_ASSERT(timing_type == TimingType::HOLD);
-                    path.clock_launch_arrival -= timing_constraints.input_constraint(path.data_launch_node, path.launch_domain, DelayType::MIN);
-                }
+            //Adjust for input delay
+            if (timing_type == TimingType::SETUP) {
+                path.clock_launch_arrival -= timing_constraints.input_constraint(path.data_launch_node, path.launch_domain, DelayType::MAX);
             } else {
-                //FF source
-                path.clock_launch_arrival = path_end(path.clock_launch_path);
+                TATUM_ASSERT(timing_type == TimingType::HOLD);
+                path.clock_launch_arrival -= timing_constraints.input_constraint(path.data_launch_node, path.launch_domain, DelayType::MIN);
             }
+        } else {
+            //FF source
+            path.clock_launch_arrival = path_end(path.clock_launch_path);
+        }
+
+        if (path.clock_capture_path.elements().empty()) {
+            //Primary output
+            path.clock_capture_arrival = required_tag.time();
 
-            if (path.clock_capture_path.elements().empty()) {
-                //Primary output
-                path.clock_capture_arrival = required_tag.time();
-
-                //Adjust for output delay and clock uncertainty
-                if (timing_type == TimingType::SETUP) {
-                    path.clock_capture_arrival += timing_constraints.output_constraint(path.data_capture_node, path.capture_domain, DelayType::MAX);
-                } else {
-                    TATUM_ASSERT(timing_type == TimingType::HOLD);
-                    path.clock_capture_arrival += timing_constraints.output_constraint(path.data_capture_node, path.capture_domain, DelayType::MIN);
-                }
-                //TODO: need to think about why we don't need to adjust for uncertainty on these paths...
+            //Adjust for output delay and clock uncertainty
+            if (timing_type == TimingType::SETUP) {
+                path.clock_capture_arrival += timing_constraints.output_constraint(path.data_capture_node, path.capture_domain, DelayType::MAX);
             } else {
-                //FF capture
-                path.clock_capture_arrival = path_end(path.clock_capture_path);
-
-                //Adjust for clock uncertainty
-                if (timing_type == TimingType::SETUP) {
-                    path.clock_capture_arrival -= timing_constraints.setup_clock_uncertainty(path.launch_domain, path.capture_domain);
-                } else {
-                    TATUM_ASSERT(timing_type == TimingType::HOLD);
-                    path.clock_capture_arrival += timing_constraints.hold_clock_uncertainty(path.launch_domain, path.capture_domain);
-                }
+                TATUM_ASSERT(timing_type == TimingType::HOLD);
+                path.clock_capture_arrival += timing_constraints.output_constraint(path.data_capture_node, path.capture_domain, DelayType::MIN);
             }
+            //TODO: need to think about why we don't need to adjust for uncertainty on these paths...
+        } else {
+            //FF capture
+            path.clock_capture_arrival = path_end(path.clock_capture_path);
 
-
-            //Record period constraint
+            //Adjust for clock uncertainty
             if (timing_type == TimingType::SETUP) {
-                path.clock_constraint = timing_constraints.setup_constraint(path.launch_domain, path.capture_domain);
+                path.clock_capture_arrival -= timing_constraints.setup_clock_uncertainty(path.launch_domain, path.capture_domain);
             } else {
                 TATUM_ASSERT(timing_type == TimingType::HOLD);
-                path.clock_constraint = timing_constraints.hold_constraint(path.launch_domain, path.capture_domain);
+                path.clock_capture_arrival += timing_constraints.hold_clock_uncertainty(path.launch_domain, path.capture_domain);
             }
+        }
+
+
+        //Record period constraint
+        if (timing_type == TimingType::SETUP) {
+            path.clock_constraint = timing_constraints.setup_constraint(path.launch_domain, path.capture_domain);
+        } else {
+            TATUM_ASSERT(timing_type == TimingType::HOLD);
+            path.clock_constraint = timing_constraints.hold_constraint(path.launch_domain, path.capture_domain);
+        }
 
-            path.clock_skew = path.clock_capture_arrival - path.clock_launch_arrival - path.clock_constraint;
+        path.clock_skew = path.clock_capture_arrival - path.clock_launch_arrival - path.clock_constraint;
 
-            paths.push_back(path);
+        is_skew_path[itag] = true;
+    });
+
+    std::vector<SkewPath> paths;
+    for (size_t ipath = 0; ipath < all_paths.size(); ++ipath) {
+        if (is_skew_path[ipath]) {
+            paths.push_back(std::move(all_paths[ipath]));
         }
     }
 
@@ -2,6 +2,7 @@
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <type_traits>
 
 #include "tatum/tags/TimingTag.hpp"
 #include "tatum/util/tatum_range.hpp"
@@ -24,6 +25,12 @@ namespace tatum {
  *
  * Note that to allow efficient iteration of tag ranges (by type) we ensure that tags of the
  * same type are adjacent in the storage vector (i.e. the vector is sorted by type)
+ *
+ * Up to NUM_INLINE_TAGS tags are stored inline (within the TimingTags object itself), and
+ * only larger sets of tags are heap allocated. Since the analyzers store the TimingTags of
+ * all nodes contiguously (indexed by node id, which follows the levelized traversal order
+ * once the graph layout is optimized) the tags of most nodes are then visited in storage
+ * order, without a per-node allocation (and pointer indirection) for each tag set.
  */
 class TimingTags {
     public:
@@ -31,8 +38,8 @@ class TimingTags {
         class Iterator;
     private:
         //In practice the vast majority of nodes have only a handful of tags,
-        //so we reserve space for some to avoid costly memory allocations
-        constexpr static size_t DEFAULT_TAGS_TO_RESERVE = 3;
+        //so we store that many inline to avoid costly memory allocations
+        constexpr static size_t NUM_INLINE_TAGS = 3;
         constexpr static size_t GROWTH_FACTOR = 2;
 
     public:
@@ -46,11 +53,11 @@ class TimingTags {
     public:
 
         //Constructors
-        TimingTags(size_t num_reserve=DEFAULT_TAGS_TO_RESERVE);
+        TimingTags(size_t num_reserve=NUM_INLINE_TAGS);
         TimingTags(const TimingTags&);
         TimingTags(TimingTags&&);
         TimingTags& operator=(TimingTags);
-        ~TimingTags() = default;
+        ~TimingTags();
         friend void swap(TimingTags& lhs, TimingTags& rhs);
 
         /*
@@ -163,6 +170,13 @@ class TimingTags {
 
         size_t capacity() const;
 
+        ///\returns true if the tags are stored inline
+        bool is_inline() const;
+
+        ///\returns A pointer to the first tag of the storage (inline or on the heap)
+        TimingTag* data();
+        const TimingTag* data() const;
+
         ///Finds a timing tag in the current set which matches tag
         ///\returns A pair of bool and iterator. 
         //          The bool is true if it is valid for iterator to be processed.
@@ -189,8 +203,8 @@ class TimingTags {
 
     private:
         //We don't expect many tags in a node so unsigned short's/unsigned char's
-        //should be more than sufficient. This also allows the class
-        //to be packed down to 16 bytes (8 for counters, 8 for pointer)
+        //should be more than sufficient. This also allows the counters to be
+        //packed down to 8 bytes (followed by the inline tags or heap pointer)
         //
         //In its current configuration we can store at most:
         //  65536           total tags (size_ and capacity_)
@@ -205,7 +219,18 @@ class TimingTags {
         unsigned char num_clock_capture_tags_ = 0;
         unsigned char num_data_arrival_tags_ = 0;
         unsigned char num_data_required_tags_ = 0;
-        std::unique_ptr<TimingTag[]> tags_;
+
+        //Tags are copied (and swapped) as raw storage
+        static_assert(std::is_trivially_copyable<TimingTag>::value, "TimingTag must be trivially copyable");
+
+        //The tags are stored inline while capacity_ <= NUM_INLINE_TAGS,
+        //and in a heap allocated array of capacity_ tags otherwise
+        union Storage {
+            Storage() {}
+
+            TimingTag inline_tags[NUM_INLINE_TAGS];
+            TimingTag* heap_tags;
+        } storage_;
 
 };
 
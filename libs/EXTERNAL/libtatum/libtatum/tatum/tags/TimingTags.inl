@@ -12,23 +12,24 @@ namespace tatum {
 
 inline TimingTags::TimingTags(size_t num_reserve)
     : size_(0)
-    , capacity_(num_reserve)
+    , capacity_(num_reserve > NUM_INLINE_TAGS ? num_reserve : NUM_INLINE_TAGS)
     , num_clock_launch_tags_(0)
     , num_clock_capture_tags_(0)
     , num_data_arrival_tags_(0)
-    , num_data_required_tags_(0)
-    , tags_(capacity_ ? new TimingTag[capacity_] : nullptr)
-    {}
+    , num_data_required_tags_(0) {
+    if (!is_inline()) {
+        storage_.heap_tags = new TimingTag[capacity_];
+    }
+}
 
 inline TimingTags::TimingTags(const TimingTags& other) 
-    : size_(other.size())
-    , capacity_(size_)
-    , num_clock_launch_tags_(other.num_clock_launch_tags_)
-    , num_clock_capture_tags_(other.num_clock_capture_tags_)
-    , num_data_arrival_tags_(other.num_data_arrival_tags_)
-    , num_data_required_tags_(other.num_data_required_tags_)
-    , tags_(capacity_ ? new TimingTag[capacity_] : nullptr) {
-    std::copy(other.tags_.get(), other.tags_.get() + other.size(), tags_.get());
+    : TimingTags(other.size()) {
+    size_ = other.size_;
+    num_clock_launch_tags_ = other.num_clock_launch_tags_;
+    num_clock_capture_tags_ = other.num_clock_capture_tags_;
+    num_data_arrival_tags_ = other.num_data_arrival_tags_;
+    num_data_required_tags_ = other.num_data_required_tags_;
+    std::copy(other.data(), other.data() + other.size(), data());
 }
 
 inline TimingTags::TimingTags(TimingTags&& other)
@@ -41,18 +42,24 @@ inline TimingTags& TimingTags::operator=(TimingTags other) {
     return *this;
 }
 
+inline TimingTags::~TimingTags() {
+    if (!is_inline()) {
+        delete[] storage_.heap_tags;
+    }
+}
+
 inline size_t TimingTags::size() const { 
     return size_;
 }
 
 inline TimingTags::iterator TimingTags::begin() {
-    auto iter = iterator(tags_.get());
+    auto iter = iterator(data());
 
     return iter;
 }
 
 inline TimingTags::const_iterator TimingTags::begin() const {
-    return const_iterator(tags_.get());
+    return const_iterator(data());
 }
 
 inline TimingTags::iterator TimingTags::begin(TagType type) {
@@ -90,8 +97,8 @@ inline TimingTags::iterator TimingTags::end() {
 }
 
 inline TimingTags::const_iterator TimingTags::end() const {
-    auto iter = const_iterator(tags_.get() + size_);
-    TATUM_ASSERT_SAFE(iter.p_ >= tags_.get() && iter.p_ <= tags_.get() + size());
+    auto iter = const_iterator(data() + size_);
+    TATUM_ASSERT_SAFE(iter.p_ >= data() && iter.p_ <= data() + size());
     return iter;
 }
 
@@ -123,7 +130,7 @@ inline TimingTags::const_iterator TimingTags::end(TagType type) const {
         default:
             TATUM_ASSERT_MSG(false, "Invalid tag type");
     }
-    TATUM_ASSERT_SAFE(iter.p_ >= tags_.get() && iter.p_ <= tags_.get() + size());
+    TATUM_ASSERT_SAFE(iter.p_ >= data() && iter.p_ <= data() + size());
     return iter;
 }
 
@@ -281,11 +288,21 @@ inline std::pair<bool,TimingTags::iterator> TimingTags::find_data_required_with_
 
 inline size_t TimingTags::capacity() const { return capacity_; }
 
+inline bool TimingTags::is_inline() const { return capacity_ <= NUM_INLINE_TAGS; }
+
+inline TimingTag* TimingTags::data() {
+    return is_inline() ? storage_.inline_tags : storage_.heap_tags;
+}
+
+inline const TimingTag* TimingTags::data() const {
+    return is_inline() ? storage_.inline_tags : storage_.heap_tags;
+}
+
 inline TimingTags::iterator TimingTags::insert(iterator iter, const TimingTag& tag) {
     size_t index = std::distance(begin(), iter);
     TATUM_ASSERT(index <= size());
 
-    if(capacity() == 0 || capacity() == size()) {
+    if(capacity() == size()) {
         //Grow and insert simultaneously
         grow_insert(index, tag);
     } else {
@@ -293,13 +310,11 @@ inline TimingTags::iterator TimingTags::insert(iterator iter, const TimingTag& t
         TATUM_ASSERT(size() + 1 <= capacity());
 
         //Shift everything one position right from end to index
-        //TODO: use std::copy_backward?
-        for(size_t i = size(); i != index; --i) {
-            tags_[i] = tags_[i - 1];
-        }
+        TimingTag* tags = data();
+        std::copy_backward(tags + index, tags + size(), tags + size() + 1);
 
         //Insert the new value in the hole at index created by shifting
-        tags_[index] = tag;
+        tags[index] = tag;
 
         //Update the sizes
         increment_size(tag.type());
@@ -309,15 +324,15 @@ inline TimingTags::iterator TimingTags::insert(iterator iter, const TimingTag& t
 }
 
 inline void TimingTags::grow_insert(size_t index, const TimingTag& tag) {
-    size_t new_capacity = (capacity() == 0) ? 1 : GROWTH_FACTOR * capacity();
+    size_t new_capacity = GROWTH_FACTOR * capacity();
 
     //We construct a new copy of ourselves at the new capacity and with the new
     //tag inserted
     TimingTags new_tags(new_capacity);
 
-    std::copy_n(tags_.get(), index, new_tags.tags_.get()); //Copy before index
-    new_tags.tags_[index] = tag; //Insert the new value
-    std::copy_n(tags_.get() + index, size() - index, new_tags.tags_.get() + index + 1); //Copy after index
+    std::copy_n(data(), index, new_tags.data()); //Copy before index
+    new_tags.data()[index] = tag; //Insert the new value
+    std::copy_n(data() + index, size() - index, new_tags.data() + index + 1); //Copy after index
 
     //Copy the sizes
     new_tags.size_ = size_;
@@ -357,7 +372,7 @@ inline void TimingTags::increment_size(TagType type) {
 }
 
 inline void swap(TimingTags& lhs, TimingTags& rhs) {
-    std::swap(lhs.tags_, rhs.tags_);
+    std::swap(lhs.storage_, rhs.storage_);
     std::swap(lhs.num_clock_launch_tags_, rhs.num_clock_launch_tags_);
     std::swap(lhs.num_clock_capture_tags_, rhs.num_clock_capture_tags_);
     std::swap(lhs.num_data_arrival_tags_, rhs.num_data_arrival_tags_);
@@ -0,0 +1,455 @@
+/*
+ * tatum_bench: Timing analysis throughput benchmark
+ *
+ * Loads one or more timing graph echo files (as written by tatum::write_echo(),
+ * e.g. the *timing_graph.echo dumps of a VPR run with --echo_file on), and
+ * measures the throughput of each graph walker:
+ *
+ *   - serial and parallel full (non-incremental) analysis, and
+ *   - serial and parallel incremental analysis, where before each update the
+ *     delays of a subset of edges are changed following an invalidation pattern:
+ *       'edge': uniformly random edges
+ *       'net':  all fan-out edges of randomly chosen drivers (OPINs), as occurs
+ *               when a placement move or re-route changes the delays of a net
+ *
+ * Throughput is reported as timing graph nodes per second (i.e. for incremental
+ * walkers the size of the graph divided by the update time), so the numbers of
+ * different walkers and designs are directly comparable, and can be tracked across
+ * releases (see --csv).
+ */
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "tatum/TimingGraph.hpp"
+#include "tatum/TimingConstraints.hpp"
+#include "tatum/analyzer_factory.hpp"
+#include "tatum/graph_walkers.hpp"
+#include "tatum/delay_calc/FixedDelayCalculator.hpp"
+
+#include "echo_loader.hpp"
+#include "util.hpp"
+
+#if defined(TATUM_USE_TBB)
+# include <tbb/global_control.h>
+# include <tbb/info.h>
+#endif
+
+using std::cout;
+
+using tatum::EdgeId;
+using tatum::NodeId;
+using tatum::Time;
+
+struct Args {
+    //Input files to load
+    std::vector<std::string> input_files;
+
+    //Analysis type to perform
+    std::string analysis_type = "setuphold";
+
+    //Concurrency (0 is machine concurrency)
+    size_t num_workers = 0;
+
+    //Number of timed full analysis runs per walker (after a warm-up run)
+    size_t num_runs = 10;
+
+    //Number of timed incremental updates per walker and invalidation pattern
+    size_t num_incr_runs = 10;
+
+    //Fraction of edges whose delays change before each incremental update
+    float edge_change_prob = 0.001;
+
+    //Invalidation patterns ('edge', 'net', or 'all')
+    std::string invalidation = "all";
+
+    //Optimize graph memory layout (as done by VPR)?
+    size_t opt_graph_layout = 1;
+
+    //Seed for the incremental delay changes
+    size_t seed = 1;
+
+    //File to write the results to as CSV
+    std::string csv_file;
+};
+
+struct BenchResult {
+    std::string design;
+    std::string walker;
+    std::string pattern;
+    size_t num_nodes = 0;
+    size_t num_runs = 0;
+    size_t edges_changed = 0; //Per update
+    double median_sec = 0.;
+};
+
+static void usage(std::string prog);
+static void cmd_error(std::string prog, std::string msg);
+static Args parse_args(int argc, char** argv);
+
+static std::vector<BenchResult> bench_design(const std::string& filename, const Args& args);
+
+template<class GraphWalker>
+static std::unique_ptr<tatum::TimingAnalyzer> make_analyzer(const std::string& analysis_type,
+                                                            const tatum::TimingGraph& tg,
+                                                            const tatum::TimingConstraints& tc,
+                                                            const tatum::DelayCalculator& dc);
+
+static double median(std::vector<double> values);
+
+static void usage(std::string prog) {
+    Args default_args;
+    cout << "Usage: " << prog << " [options] tg_file [tg_file...]\n";
+    cout << "\n";
+    cout << "  Positional Arguments:\n";
+    cout << "    tg_file:                               Timing graph echo file(s) to benchmark\n";
+    cout << "\n";
+    cout << "  Options:\n";
+    cout << "    --analysis_type ANALYSIS_TYPE:         Type of analysis to perform\n";
+    cout << "                                           'setuphold', 'setup', or 'hold'\n";
+    cout << "                                           (default " << default_args.analysis_type << ")\n";
+    cout << "    --num_workers NUM_WORKERS:             Number of parallel workers.\n";
+    cout << "                                           0 implies machine concurrency.\n";
+    cout << "                                           (default " << default_args.num_workers << ")\n";
+    cout << "    --num_runs NUM_RUNS:                   Number of timed full analysis runs per walker.\n";
+    cout << "                                           (default " << default_args.num_runs << ")\n";
+    cout << "    --num_incr_runs NUM_INCR_RUNS:         Number of timed incremental updates per walker and pattern.\n";
+    cout << "                                           (default " << default_args.num_incr_runs << ")\n";
+    cout << "    --edge_change_prob EDGE_CHANGE_PROB:   Fraction of edges changed before each incremental update.\n";
+    cout << "                                           (default " << default_args.edge_change_prob << ")\n";
+    cout << "    --invalidation PATTERN:                Incremental invalidation pattern\n";
+    cout << "                                           'edge', 'net', or 'all'\n";
+    cout << "                                           (default " << default_args.invalidation << ")\n";
+    cout << "    --opt_graph_layout OPT_LAYOUT:         Optimize graph layout.\n";
+    cout << "                                           0 implies no, non-zero implies yes.\n";
+    cout << "                                           (default " << default_args.opt_graph_layout << ")\n";
+    cout << "    --seed SEED:                           Seed for the incremental delay changes.\n";
+    cout << "                                           (default " << default_args.seed << ")\n";
+    cout << "    --csv CSV_FILE:                        Also write the results to the specified CSV file.\n";
+}
+
+static void cmd_error(std::string prog, std::string msg) {
+    cout << "Error: " << msg << "\n";
+    cout << "\n";
+    usage(prog);
+    exit(1);
+}
+
+static Args parse_args(int argc, char** argv) {
+    Args args;
+    auto prog = argv[0];
+
+    int i = 1;
+    while (i < argc) {
+        std::string arg_str(argv[i]);
+        if (arg_str == "-h" || arg_str == "--help") {
+            usage(prog);
+            exit(0);
+        } else if (arg_str.size() >= 2 && arg_str[0] == '-' && arg_str[1] == '-') {
+            if (i + 1 >= argc) {
+                cmd_error(prog, "Missing value for option '" + arg_str + "'");
+            }
+
+            if (arg_str == "--analysis_type") {
+                args.analysis_type = argv[i+1];
+            } else if (arg_str == "--invalidation") {
+                args.invalidation = argv[i+1];
+            } else if (arg_str == "--csv") {
+                args.csv_file = argv[i+1];
+            } else {
+                std::istringstream ss(argv[i+1]);
+                float arg_val;
+                ss >> arg_val;
+                if (ss.fail() || !ss.eof()) {
+                    cmd_error(prog, "Invalid option value '" + std::string(argv[i+1]) + "'");
+                }
+
+                if (arg_str == "--num_workers") {
+                    args.num_workers = arg_val;
+                } else if (arg_str == "--num_runs") {
+                    args.num_runs = arg_val;
+                } else if (arg_str == "--num_incr_runs") {
+                    args.num_incr_runs = arg_val;
+                } else if (arg_str == "--edge_change_prob") {
+                    args.edge_change_prob = arg_val;
+                } else if (arg_str == "--opt_graph_layout") {
+                    args.opt_graph_layout = arg_val;
+                } else if (arg_str == "--seed") {
+                    args.seed = arg_val;
+                } else {
+                    cmd_error(prog, "Unrecognized option '" + arg_str + "'");
+                }
+            }
+            i += 2;
+        } else {
+            args.input_files.push_back(arg_str);
+            i += 1;
+        }
+    }
+
+    if (args.input_files.empty()) {
+        cmd_error(prog, "Missing required positional argument 'tg_file'");
+    }
+    if (args.analysis_type != "setuphold" && args.analysis_type != "setup" && args.analysis_type != "hold") {
+        cmd_error(prog, "Unrecognized analysis type '" + args.analysis_type + "'");
+    }
+    if (args.invalidation != "all" && args.invalidation != "edge" && args.invalidation != "net") {
+        cmd_error(prog, "Unrecognized invalidation pattern '" + args.invalidation + "'");
+    }
+    if (args.edge_change_prob < 0. || args.edge_change_prob > 1.) {
+        cmd_error(prog, "--edge_change_prob must be in the range [0., 1.]");
+    }
+
+    return args;
+}
+
+int main(int argc, char** argv) {
+    Args args = parse_args(argc, argv);
+
+#if defined(TATUM_USE_TBB)
+    size_t num_workers = args.num_workers;
+    if (num_workers == 0) {
+        num_workers = tbb::info::default_concurrency();
+    }
+    tbb::global_control tbb_control(tbb::global_control::max_allowed_parallelism, num_workers);
+    cout << "Tatum executing with up to " << num_workers << " workers via TBB\n";
+#else //Serial
+    cout << "Tatum built with only serial execution support, parallel walkers run serially\n";
+#endif
+
+    std::vector<BenchResult> results;
+    for (const std::string& filename : args.input_files) {
+        auto design_results = bench_design(filename, args);
+        results.insert(results.end(), design_results.begin(), design_results.end());
+    }
+
+    cout << "\n";
+    cout << std::left << std::setw(24) << "design"
+         << std::setw(20) << "walker"
+         << std::setw(9) << "pattern"
+         << std::right << std::setw(10) << "nodes"
+         << std::setw(14) << "edges/update"
+         << std::setw(14) << "median (s)"
+         << std::setw(16) << "nodes/sec" << "\n";
+    for (const BenchResult& res : results) {
+        cout << std::left << std::setw(24) << res.design
+             << std::setw(20) << res.walker
+             << std::setw(9) << res.pattern
+             << std::right << std::setw(10) << res.num_nodes
+             << std::setw(14) << res.edges_changed
+             << std::setw(14) << std::scientific << std::setprecision(3) << res.median_sec
+             << std::setw(16) << res.num_nodes / res.median_sec
+             << std::defaultfloat << "\n";
+    }
+
+    if (!args.csv_file.empty()) {
+        std::ofstream csv(args.csv_file);
+        csv << "design,walker,pattern,nodes,runs,edges_per_update,median_sec,nodes_per_sec\n";
+        for (const BenchResult& res : results) {
+            csv << res.design << ","
+                << res.walker << ","
+                << res.pattern << ","
+                << res.num_nodes << ","
+                << res.num_runs << ","
+                << res.edges_changed << ","
+                << res.median_sec << ","
+                << res.num_nodes / res.median_sec << "\n";
+        }
+        if (!csv) {
+            cout << "Error: failed to write '" << args.csv_file << "'\n";
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+//Times num_runs full analyses (after an untimed warm-up run)
+static BenchResult bench_full(tatum::TimingAnalyzer& analyzer, size_t num_runs) {
+    analyzer.update_timing();
+
+    std::vector<double> run_times;
+    for (size_t i = 0; i < num_runs; ++i) {
+        analyzer.update_timing();
+        run_times.push_back(analyzer.get_profiling_data("analysis_sec"));
+    }
+
+    BenchResult res;
+    res.num_runs = num_runs;
+    res.median_sec = median(run_times);
+    return res;
+}
+
+//Randomly perturbs the delays of an edge
+static void perturb_edge_delay(const tatum::TimingGraph& tg, tatum::FixedDelayCalculator& dc, EdgeId edge, std::minstd_rand& rng) {
+    std::normal_distribution<float> normal_distr(0, 1e-10);
+
+    if (tg.edge_type(edge) == tatum::EdgeType::PRIMITIVE_CLOCK_CAPTURE) {
+        dc.set_setup_time(tg, edge, Time(std::max<float>(0, dc.setup_time(tg, edge).value() + normal_distr(rng))));
+        dc.set_hold_time(tg, edge, Time(std::max<float>(0, dc.hold_time(tg, edge).value() + normal_distr(rng))));
+    } else {
+        dc.set_max_edge_delay(tg, edge, Time(std::max<float>(0, dc.max_edge_delay(tg, edge).value() + normal_distr(rng))));
+        dc.set_min_edge_delay(tg, edge, Time(std::max<float>(0, dc.min_edge_delay(tg, edge).value() + normal_distr(rng))));
+    }
+}
+
+//Returns the edges whose delays change before each incremental update.
+//
+//The sets are generated up-front (from a fixed seed) so that every incremental
+//walker sees exactly the same sequence of changes.
+static std::vector<std::vector<EdgeId>> incr_edge_changes(const tatum::TimingGraph& tg, const std::string& pattern, const Args& args) {
+    std::minstd_rand rng(args.seed);
+    size_t num_edges_to_change = std::max<size_t>(1, args.edge_change_prob * tg.edges().size());
+
+    std::vector<NodeId> drivers;
+    if (pattern == "net") {
+        for (NodeId node : tg.nodes()) {
+            if (tg.node_type(node) == tatum::NodeType::OPIN && tg.node_out_edges(node).size() > 0) {
+                drivers.push_back(node);
+            }
+        }
+    }
+
+    std::vector<std::vector<EdgeId>> changes(args.num_incr_runs);
+    for (std::vector<EdgeId>& edges : changes) {
+        if (pattern == "net" && !drivers.empty()) {
+            std::uniform_int_distribution<size_t> driver_distr(0, drivers.size() - 1);
+            while (edges.size() < num_edges_to_change) {
+                NodeId driver = drivers[driver_distr(rng)];
+                edges.insert(edges.end(), tg.node_out_edges(driver).begin(), tg.node_out_edges(driver).end());
+            }
+        } else {
+            std::uniform_int_distribution<size_t> edge_distr(0, tg.edges().size() - 1);
+            while (edges.size() < num_edges_to_change) {
+                edges.push_back(EdgeId(edge_distr(rng)));
+            }
+        }
+    }
+    return changes;
+}
+
+//Times incremental updates applying the specified edge changes (after an untimed
+//initial full update)
+template<class GraphWalker>
+static BenchResult bench_incr(const tatum::TimingGraph& tg,
+                              const tatum::TimingConstraints& tc,
+                              const tatum::FixedDelayCalculator& orig_dc,
+                              const std::vector<std::vector<EdgeId>>& changes,
+                              const Args& args) {
+    //Each walker starts from the same delays
+    tatum::FixedDelayCalculator dc = orig_dc;
+    std::minstd_rand rng(args.seed);
+
+    auto analyzer = make_analyzer<GraphWalker>(args.analysis_type, tg, tc, dc);
+    analyzer->update_timing();
+
+    std::vector<double> run_times;
+    size_t num_edges_changed = 0;
+    for (const std::vector<EdgeId>& edges : changes) {
+        for (EdgeId edge : edges) {
+            perturb_edge_delay(tg, dc, edge, rng);
+            analyzer->invalidate_edge(edge);
+        }
+        num_edges_changed += edges.size();
+
+        analyzer->update_timing();
+        run_times.push_back(analyzer->get_profiling_data("analysis_sec"));
+    }
+
+    BenchResult res;
+    res.num_runs = changes.size();
+    res.edges_changed = changes.empty() ? 0 : num_edges_changed / changes.size();
+    res.median_sec = median(run_times);
+    return res;
+}
+
+static std::vector<BenchResult> bench_design(const std::string& filename, const Args& args) {
+    cout << "Loading " << filename << "\n";
+
+    EchoLoader loader;
+    tatum_parse_filename(filename, loader);
+
+    std::unique_ptr<tatum::TimingGraph> tg = loader.timing_graph();
+    tg->set_allow_dangling_combinational_nodes(true);
+    std::unique_ptr<tatum::TimingConstraints> tc = loader.timing_constraints();
+    std::unique_ptr<tatum::FixedDelayCalculator> dc = loader.delay_calculator();
+
+    tg->levelize();
+    tg->validate();
+
+    if (args.opt_graph_layout) {
+        auto id_maps = tg->optimize_layout();
+        remap_delay_calculator(*tg, *dc, id_maps.edge_id_map);
+        tc->remap_nodes(id_maps.node_id_map);
+    }
+
+    cout << "  Timing Graph Nodes: " << tg->nodes().size() << "\n";
+    cout << "  Timing Graph Edges: " << tg->edges().size() << "\n";
+    cout << "  Timing Graph Levels: " << tg->levels().size() << "\n";
+
+    //Name results by the file's base name
+    std::string design = filename.substr(filename.find_last_of('/') + 1);
+
+    std::vector<BenchResult> results;
+    auto add_result = [&](BenchResult res, std::string walker, std::string pattern) {
+        res.design = design;
+        res.walker = walker;
+        res.pattern = pattern;
+        res.num_nodes = tg->nodes().size();
+        cout << "  " << walker << " " << pattern << ": " << res.median_sec << " sec\n";
+        results.push_back(res);
+    };
+
+    {
+        auto analyzer = make_analyzer<tatum::SerialWalker>(args.analysis_type, *tg, *tc, *dc);
+        add_result(bench_full(*analyzer, args.num_runs), "serial", "full");
+    }
+    {
+        auto analyzer = make_analyzer<tatum::ParallelWalker>(args.analysis_type, *tg, *tc, *dc);
+        add_result(bench_full(*analyzer, args.num_runs), "parallel", "full");
+    }
+
+    for (std::string pattern : {"edge", "net"}) {
+        if (args.invalidation != "all" && args.invalidation != pattern) continue;
+
+        auto changes = incr_edge_changes(*tg, pattern, args);
+
+        add_result(bench_incr<tatum::SerialIncrWalker>(*tg, *tc, *dc, changes, args), "serial_incr", pattern);
+        add_result(bench_incr<tatum::ParallelIncrWalker>(*tg, *tc, *dc, changes, args), "parallel_incr", pattern);
+    }
+
+    return results;
+}
+
+template<class GraphWalker>
+static std::unique_ptr<tatum::TimingAnalyzer> make_analyzer(const std::string& analysis_type,
+                                                            const tatum::TimingGraph& tg,
+                                                            const tatum::TimingConstraints& tc,
+                                                            const tatum::DelayCalculator& dc) {
+    if (analysis_type == "setup") {
+        return tatum::AnalyzerFactory<tatum::SetupAnalysis,GraphWalker>::make(tg, tc, dc);
+    } else if (analysis_type == "hold") {
+        return tatum::AnalyzerFactory<tatum::HoldAnalysis,GraphWalker>::make(tg, tc, dc);
+    }
+    TATUM_ASSERT(analysis_type == "setuphold");
+    return tatum::AnalyzerFactory<tatum::SetupHoldAnalysis,GraphWalker>::make(tg, tc, dc);
+}
+
+static double median(std::vector<double> values) {
+    if (values.empty()) return 0.;
+
+    std::sort(values.begin(), values.end());
+
+    size_t size = values.size();
+    if (size % 2 == 0) {
+        return (values[size / 2 - 1] + values[size / 2]) / 2;
+    } else {
+        return values[size / 2];
+    }
+}
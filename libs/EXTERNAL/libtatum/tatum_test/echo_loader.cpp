@@ -1,4 +1,17 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "echo_loader.hpp"
+#include "tatum/echo_binary_format.hpp"
+
+static_assert(int(tatumparse::NodeType::CPIN) == int(tatum::NodeType::CPIN), "Binary echo node types are tatum node types");
+static_assert(int(tatumparse::EdgeType::INTERCONNECT) == int(tatum::EdgeType::INTERCONNECT), "Binary echo edge types are tatum edge types");
+static_assert(int(tatumparse::TagType::HOLD_SLACK) == int(tatum::echo_binary::ResultType::HOLD_SLACK), "Binary echo result types are tatumparse tag types");
 
 EchoLoader::EchoLoader() {
     tg_ = std::unique_ptr<tatum::TimingGraph>(new tatum::TimingGraph);
@@ -147,3 +160,173 @@ void EchoLoader::parse_error(const int curr_lineno, const std::string& near_text
     fprintf(stderr, "%s:%d Failed to parse echo file: %s near '%s'\n", filename_.c_str(), curr_lineno, msg.c_str(), near_text.c_str());
     std::exit(1);
 }
+
+namespace {
+
+//Reads the records of a memory mapped binary echo file, in order
+class BinaryEchoReader {
+public:
+    BinaryEchoReader(const char* data, size_t size)
+        : data_(data), end_(data + size) {}
+
+    template<class T>
+    bool read(T& value) {
+        if(size_t(end_ - data_) < sizeof(T)) return false;
+        std::memcpy(&value, data_, sizeof(T));
+        data_ += sizeof(T);
+        return true;
+    }
+
+    bool read_string(std::string& str, size_t size) {
+        if(size_t(end_ - data_) < size) return false;
+        str.assign(data_, size);
+        data_ += size;
+        return true;
+    }
+
+    bool at_end() const { return data_ == end_; }
+
+private:
+    const char* data_;
+    const char* end_;
+};
+
+bool replay_binary_echo(BinaryEchoReader& reader, tatumparse::Callback& callback) {
+    using namespace tatum::echo_binary;
+
+    BinaryEchoHeader header;
+    if(!reader.read(header)
+       || !std::equal(std::begin(BINARY_ECHO_MAGIC), std::end(BINARY_ECHO_MAGIC), header.magic)
+       || header.version != BINARY_ECHO_VERSION) {
+        return false;
+    }
+
+    //Timing graph
+    callback.start_graph();
+    uint64_t num_nodes = 0;
+    if(!reader.read(num_nodes)) return false;
+    for(uint64_t inode = 0; inode < num_nodes; ++inode) {
+        uint8_t type;
+        if(!reader.read(type)) return false;
+        callback.add_node(inode, static_cast<tatumparse::NodeType>(type), {}, {});
+    }
+
+    uint64_t num_edges = 0;
+    if(!reader.read(num_edges)) return false;
+    for(uint64_t iedge = 0; iedge < num_edges; ++iedge) {
+        BinaryEchoEdge edge;
+        if(!reader.read(edge)) return false;
+        callback.add_edge(iedge, static_cast<tatumparse::EdgeType>(edge.type), edge.src_node, edge.sink_node, edge.disabled);
+    }
+    callback.finish_graph();
+
+    //Timing constraints
+    callback.start_constraints();
+    uint64_t num_domains = 0;
+    if(!reader.read(num_domains)) return false;
+    for(uint64_t idomain = 0; idomain < num_domains; ++idomain) {
+        BinaryEchoDomain domain;
+        std::string name;
+        if(!reader.read(domain) || !reader.read_string(name, domain.name_size)) return false;
+        callback.add_clock_domain(domain.domain, name);
+    }
+
+    uint64_t num_constraints = 0;
+    if(!reader.read(num_constraints)) return false;
+    for(uint64_t iconstraint = 0; iconstraint < num_constraints; ++iconstraint) {
+        BinaryEchoConstraint constraint;
+        if(!reader.read(constraint)) return false;
+        switch(static_cast<ConstraintKind>(constraint.kind)) {
+            case ConstraintKind::CLOCK_SOURCE: callback.add_clock_source(constraint.node, constraint.domain); break;
+            case ConstraintKind::CONSTANT_GENERATOR: callback.add_constant_generator(constraint.node); break;
+            case ConstraintKind::MAX_INPUT_CONSTRAINT: callback.add_max_input_constraint(constraint.node, constraint.domain, constraint.value); break;
+            case ConstraintKind::MIN_INPUT_CONSTRAINT: callback.add_min_input_constraint(constraint.node, constraint.domain, constraint.value); break;
+            case ConstraintKind::MAX_OUTPUT_CONSTRAINT: callback.add_max_output_constraint(constraint.node, constraint.domain, constraint.value); break;
+            case ConstraintKind::MIN_OUTPUT_CONSTRAINT: callback.add_min_output_constraint(constraint.node, constraint.domain, constraint.value); break;
+            case ConstraintKind::SETUP_CONSTRAINT: callback.add_setup_constraint(constraint.domain, constraint.capture_domain, constraint.node, constraint.value); break;
+            case ConstraintKind::HOLD_CONSTRAINT: callback.add_hold_constraint(constraint.domain, constraint.capture_domain, constraint.node, constraint.value); break;
+            case ConstraintKind::SETUP_UNCERTAINTY: callback.add_setup_uncertainty(constraint.domain, constraint.capture_domain, constraint.value); break;
+            case ConstraintKind::HOLD_UNCERTAINTY: callback.add_hold_uncertainty(constraint.domain, constraint.capture_domain, constraint.value); break;
+            case ConstraintKind::EARLY_SOURCE_LATENCY: callback.add_early_source_latency(constraint.domain, constraint.value); break;
+            case ConstraintKind::LATE_SOURCE_LATENCY: callback.add_late_source_latency(constraint.domain, constraint.value); break;
+            default: return false;
+        }
+    }
+    callback.finish_constraints();
+
+    //Delay model
+    callback.start_delay_model();
+    uint64_t num_delays = 0;
+    if(!reader.read(num_delays)) return false;
+    for(uint64_t iedge = 0; iedge < num_delays; ++iedge) {
+        BinaryEchoDelay delay;
+        if(!reader.read(delay)) return false;
+        if(static_cast<DelayKind>(delay.kind) == DelayKind::SETUP_HOLD_TIME) {
+            callback.add_edge_setup_hold_time(iedge, delay.first, delay.second);
+        } else {
+            callback.add_edge_delay(iedge, delay.first, delay.second);
+        }
+    }
+    callback.finish_delay_model();
+
+    //Analysis results
+    callback.start_results();
+    uint64_t num_results = 0;
+    if(!reader.read(num_results)) return false;
+    for(uint64_t iresult = 0; iresult < num_results; ++iresult) {
+        BinaryEchoResult result;
+        if(!reader.read(result)) return false;
+        auto type = static_cast<tatumparse::TagType>(result.type);
+        switch(static_cast<ResultTarget>(result.target)) {
+            case ResultTarget::NODE_TAG: callback.add_node_tag(type, result.id, result.launch_domain, result.capture_domain, result.time); break;
+            case ResultTarget::NODE_SLACK: callback.add_node_slack(type, result.id, result.launch_domain, result.capture_domain, result.time); break;
+            case ResultTarget::EDGE_SLACK: callback.add_edge_slack(type, result.id, result.launch_domain, result.capture_domain, result.time); break;
+            default: return false;
+        }
+    }
+    callback.finish_results();
+
+    return reader.at_end();
+}
+
+} //namespace
+
+bool is_binary_echo_file(std::string filename) {
+    std::ifstream is(filename, std::ios::binary);
+    char magic[sizeof(tatum::echo_binary::BINARY_ECHO_MAGIC)];
+    return is.read(magic, sizeof(magic))
+           && std::equal(std::begin(magic), std::end(magic), std::begin(tatum::echo_binary::BINARY_ECHO_MAGIC));
+}
+
+void load_binary_echo_file(std::string filename, tatumparse::Callback& callback) {
+    callback.start_parse();
+    callback.filename(filename);
+
+    int fd = open(filename.c_str(), O_RDONLY);
+    struct stat file_stat;
+    if(fd == -1 || fstat(fd, &file_stat) == -1) {
+        if(fd != -1) close(fd);
+        callback.parse_error(0, "", "Failed to open binary echo file");
+        return;
+    }
+
+    size_t size = file_stat.st_size;
+    void* data = size ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+    if(data == MAP_FAILED) {
+        callback.parse_error(0, "", "Failed to map binary echo file");
+        return;
+    }
+    //The records are read front to back, once
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    BinaryEchoReader reader(static_cast<const char*>(data), size);
+    bool ok = replay_binary_echo(reader, callback);
+    munmap(data, size);
+
+    if(!ok) {
+        callback.parse_error(0, "", "Truncated or invalid binary echo file");
+        return;
+    }
+    callback.finish_parse();
+}
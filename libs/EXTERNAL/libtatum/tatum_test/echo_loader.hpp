@@ -83,5 +83,12 @@ private: //Data
     tatum::util::linear_map<tatum::EdgeId,tatum::Time> hold_times_;
 };
 
+//Returns true if the file starts with a binary echo header (see tatum/echo_binary_format.hpp)
+bool is_binary_echo_file(std::string filename);
+
+//Loads a binary echo file by memory mapping it, making the same callbacks as tatum_parse_filename()
+//does for a text echo file (except that add_node() gets no edge ids: they are implied by the edges)
+void load_binary_echo_file(std::string filename, tatumparse::Callback& callback);
+
 
 #endif
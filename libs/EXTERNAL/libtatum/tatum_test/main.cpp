@@ -73,12 +73,18 @@ struct Args {
     //Number of parallel runs to perform
     size_t num_parallel_runs = 30;
 
+    //Number of parallel incremental runs to perform
+    size_t num_parallel_incr_runs = 10;
+
     //Use unit delays instead of from file?
     float unit_delay = 0;
 
     //Write an echo file of resutls?
     std::string write_echo;
 
+    //Write a binary echo file of results?
+    std::string write_binary_echo;
+
     //Optimize graph memory layout?
     size_t opt_graph_layout = 0;
 
@@ -138,7 +144,7 @@ void usage(std::string prog) {
     cout << "Usage: " << prog << " [options] tg_file\n";
     cout << "\n";
     cout << "  Positional Arguments:\n";
-    cout << "    tg_file:                      The input file (or '-' for stdin)\n";
+    cout << "    tg_file:                      The input echo file, text or binary (or '-' for a text file on stdin)\n";
     cout << "\n";
     cout << "  Options:\n";
     cout << "    --analysis_type ANALYSIS_TYPE:             Type of analysis to perform\n";
@@ -153,6 +159,8 @@ void usage(std::string prog) {
     cout << "                                               (default " << default_args.num_serial_incr_runs << ")\n";
     cout << "    --num_parallel NUM_PARALLEL_RUNS:          Number of serial runs to perform.\n";
     cout << "                                               (default " << default_args.num_parallel_runs << ")\n";
+    cout << "    --num_parallel_incr NUM_PAR_INCR_RUNS:     Number of parallel incremental runs to perform.\n";
+    cout << "                                               (default " << default_args.num_parallel_incr_runs << ")\n";
     cout << "    --edge_change_prob EDGE_CHANGE_PROB:       Probability of an edge delay changing in a serial incremental run\n";
     cout << "                                               (default " << default_args.edge_change_prob << ")\n";
     cout << "    --unit_delay UNIT_DELAY:                   Use specified unit delay for all edges.\n";
@@ -161,6 +169,9 @@ void usage(std::string prog) {
     cout << "    --write_echo WRITE_ECHO:                   Write an echo file of restuls.\n";
     cout << "                                               empty implies no, non-empty implies write to specified file.\n";
     cout << "                                               (default " << default_args.write_echo << ")\n";
+    cout << "    --write_binary_echo WRITE_BINARY_ECHO:     Write a binary echo file of results, which loads much faster.\n";
+    cout << "                                               empty implies no, non-empty implies write to specified file.\n";
+    cout << "                                               (default " << default_args.write_binary_echo << ")\n";
     cout << "    --opt_graph_layout OPT_LAYOUT:             Optimize graph layout.\n";
     cout << "                                               0 implies no, non-zero implies yes.\n";
     cout << "                                               (default " << default_args.opt_graph_layout << ")\n";
@@ -208,6 +219,8 @@ Args parse_args(int argc, char** argv) {
         } else if (arg_str.size() >= 2 && arg_str[0] == '-' && arg_str[1] == '-') {
             if (arg_str == "--write_echo") {
                 args.write_echo = argv[i+1];
+            } else if (arg_str == "--write_binary_echo") {
+                args.write_binary_echo = argv[i+1];
             } else if (arg_str == "--analysis_type") {
                 args.analysis_type = argv[i+1];
             } else {
@@ -229,6 +242,8 @@ Args parse_args(int argc, char** argv) {
                     args.num_serial_incr_runs = arg_val;
                 } else if (argv[i] == std::string("--num_parallel")) { 
                     args.num_parallel_runs = arg_val;
+                } else if (argv[i] == std::string("--num_parallel_incr")) { 
+                    args.num_parallel_incr_runs = arg_val;
                 } else if (argv[i] == std::string("--edge_change_prob")) { 
                     args.edge_change_prob = arg_val;
                 } else if (argv[i] == std::string("--unit_delay")) { 
@@ -331,6 +346,8 @@ int main(int argc, char** argv) {
         EchoLoader loader;
         if(args.input_file == "-") {
             tatum_parse_file(stdin, loader);
+        } else if(is_binary_echo_file(args.input_file)) {
+            load_binary_echo_file(args.input_file, loader);
         } else {
             tatum_parse_filename(args.input_file, loader);
         }
@@ -553,6 +570,10 @@ int main(int argc, char** argv) {
         ofs.flush();
     }
 
+    if (!args.write_binary_echo.empty()) {
+        tatum::write_binary_echo(args.write_binary_echo, *timing_graph, *timing_constraints, *delay_calculator, serial_analyzer);
+    }
+
     std::cout << endl;
 
     if (args.num_serial_incr_runs) {
@@ -639,6 +660,60 @@ int main(int argc, char** argv) {
         cout << endl << "Net SerialIncr Analysis elapsed time: " << serial_incr_analyzer->get_profiling_data("total_analysis_sec") << " sec over " << serial_incr_analyzer->get_profiling_data("num_full_updates") << " full updates" << endl;
     }
 
+    if (args.num_parallel_incr_runs) {
+
+        std::shared_ptr<tatum::TimingAnalyzer> parallel_incr_analyzer;
+        if (args.analysis_type == "setuphold") {
+            parallel_incr_analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis,tatum::ParallelIncrWalker>::make(*timing_graph, *timing_constraints, *delay_calculator);
+        } else if (args.analysis_type == "setup") {
+            parallel_incr_analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis,tatum::ParallelIncrWalker>::make(*timing_graph, *timing_constraints, *delay_calculator);
+        } else if (args.analysis_type == "hold") {
+            parallel_incr_analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis,tatum::ParallelIncrWalker>::make(*timing_graph, *timing_constraints, *delay_calculator);
+        } else {
+            std::stringstream ss;
+            ss << "Unrecognized analysis type '" << args.analysis_type << "'";
+            cmd_error(argv[0], ss.str());
+        }
+
+        std::map<std::string,std::vector<double>> parallel_incr_prof_data;
+        {
+            cout << "Running ParallelIncr Analysis " << args.num_parallel_incr_runs << " times" << endl;
+
+            //Analyze
+            bool equivalent = profile_incr(args.num_parallel_incr_runs,
+                                           args.edge_change_prob,
+                                           args.verify,
+                                           *timing_graph,
+                                           parallel_incr_analyzer,
+                                           serial_analyzer,
+                                           *delay_calculator,
+                                           parallel_incr_prof_data);
+
+            if(!equivalent) {
+                cout << "Verification failed!\n";
+                exit_code = 1;
+            }
+
+            cout << endl;
+            cout << "ParallelIncr Analysis took " << std::setprecision(6) << std::setw(6) << arithmean_skip_first(parallel_incr_prof_data["analysis_sec"])*args.num_parallel_incr_runs << " sec";
+            if(parallel_incr_prof_data["analysis_sec"].size() > 0) {
+                cout << " AVG: " << arithmean_skip_first(parallel_incr_prof_data["analysis_sec"]);
+                cout << " Median: " << median_skip_first(parallel_incr_prof_data["analysis_sec"]);
+                cout << " Min: " << *std::min_element(parallel_incr_prof_data["analysis_sec"].begin(), parallel_incr_prof_data["analysis_sec"].end());
+                cout << " Max: " << *std::max_element(parallel_incr_prof_data["analysis_sec"].begin(), parallel_incr_prof_data["analysis_sec"].end());
+            }
+            cout << endl;
+
+            cout << "Verifying ParallelIncr Analysis took: " << std::accumulate(parallel_incr_prof_data["verify_sec"].begin(), parallel_incr_prof_data["verify_sec"].end(), 0.) << " sec" << endl;
+        }
+        cout << endl;
+
+        cout << "ParallelIncr Speed-Up: " << std::fixed << median(parallel_incr_prof_data["ref_analysis_sec"]) / median(parallel_incr_prof_data["analysis_sec"]) << "x" << endl;
+        cout << endl;
+
+        cout << endl << "Net ParallelIncr Analysis elapsed time: " << parallel_incr_analyzer->get_profiling_data("total_analysis_sec") << " sec over " << parallel_incr_analyzer->get_profiling_data("num_full_updates") << " full updates" << endl;
+    }
+
     if (args.num_parallel_runs) {
         std::shared_ptr<tatum::TimingAnalyzer> parallel_analyzer;
         if (args.analysis_type == "setuphold") {
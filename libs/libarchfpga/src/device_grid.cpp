@@ -1,10 +1,21 @@
 #include "device_grid.h"
 
+#include <algorithm>
 #include <utility>
 
+#include "vtr_hash.h"
+
+///@brief Are the tiles the same (in two columns)?
+static bool same_tiles(const t_grid_tile& lhs, const t_grid_tile& rhs) {
+    return lhs.type == rhs.type
+           && lhs.width_offset == rhs.width_offset
+           && lhs.height_offset == rhs.height_offset
+           && lhs.meta == rhs.meta;
+}
+
 DeviceGrid::DeviceGrid(std::string grid_name, vtr::NdMatrix<t_grid_tile, 3> grid)
-    : name_(std::move(grid_name))
-    , grid_(std::move(grid)) {
+    : name_(std::move(grid_name)) {
+    build_column_templates(grid);
     count_instances();
 }
 
@@ -20,7 +31,7 @@ size_t DeviceGrid::num_instances(t_physical_tile_type_ptr type, int layer_num) c
         return 0;
     }
 
-    int num_layers = (int)grid_.dim_size(0);
+    int num_layers = get_num_layers();
 
     if (layer_num == -1) {
         //Count all layers
@@ -42,40 +53,96 @@ size_t DeviceGrid::num_instances(t_physical_tile_type_ptr type, int layer_num) c
     return count;
 }
 
+std::vector<t_physical_tile_loc> DeviceGrid::tile_locations(t_physical_tile_type_ptr type, int layer_num) const {
+    std::vector<t_physical_tile_loc> locs;
+    int num_layers = get_num_layers();
+
+    int from_layer = (layer_num == -1) ? 0 : layer_num;
+    int to_layer = (layer_num == -1) ? num_layers - 1 : layer_num;
+    for (int curr_layer_num = from_layer; curr_layer_num <= to_layer; ++curr_layer_num) {
+        for (size_t x = 0; x < width(); ++x) {
+            const auto& root_ys = columns_[column_templates_[curr_layer_num][x]].root_ys;
+            auto iter = root_ys.find(type);
+            if (iter == root_ys.end()) continue;
+
+            for (int y : iter->second) {
+                locs.emplace_back(x, y, curr_layer_num);
+            }
+        }
+    }
+
+    return locs;
+}
+
 void DeviceGrid::clear() {
-    grid_.clear();
+    columns_.clear();
+    column_templates_.clear();
+    height_ = 0;
     instance_counts_.clear();
 }
 
-void DeviceGrid::count_instances() {
-    int num_layers = (int)grid_.dim_size(0);
-    instance_counts_.clear();
-    instance_counts_.resize(num_layers);
+void DeviceGrid::build_column_templates(const vtr::NdMatrix<t_grid_tile, 3>& grid) {
+    size_t num_layers = grid.dim_size(0);
+    height_ = grid.dim_size(2);
+    columns_.clear();
+    column_templates_.resize({num_layers, grid.dim_size(1)});
 
-    //Initialize the instance counts
-    for (int layer_num = 0; layer_num < num_layers; ++layer_num) {
+    //The templates with each column hash, to find the repeated columns
+    std::unordered_multimap<size_t, int> templates_by_hash;
+
+    for (size_t layer_num = 0; layer_num < num_layers; ++layer_num) {
         for (size_t x = 0; x < width(); ++x) {
-            for (size_t y = 0; y < height(); ++y) {
-                auto type = grid_[layer_num][x][y].type;
+            const t_grid_tile* column = grid[layer_num][x].data();
+
+            size_t hash = 0;
+            for (size_t y = 0; y < height_; ++y) {
+                vtr::hash_combine(hash, column[y].type);
+                vtr::hash_combine(hash, column[y].width_offset);
+                vtr::hash_combine(hash, column[y].height_offset);
+                vtr::hash_combine(hash, column[y].meta);
+            }
 
-                if (grid_[layer_num][x][y].width_offset == 0 && grid_[layer_num][x][y].height_offset == 0) {
-                    //Add capacity only if this is the root location
-                    instance_counts_[layer_num][type] = 0;
+            int template_index = -1;
+            auto range = templates_by_hash.equal_range(hash);
+            for (auto iter = range.first; iter != range.second; ++iter) {
+                const std::vector<t_grid_tile>& tiles = columns_[iter->second].tiles;
+                if (std::equal(tiles.begin(), tiles.end(), column, same_tiles)) {
+                    template_index = iter->second;
+                    break;
                 }
             }
+
+            if (template_index == -1) {
+                //A new distinct column
+                template_index = columns_.size();
+                columns_.emplace_back();
+                t_column_template& column_template = columns_.back();
+                column_template.tiles.assign(column, column + height_);
+                for (size_t y = 0; y < height_; ++y) {
+                    if (column[y].width_offset == 0 && column[y].height_offset == 0) {
+                        column_template.root_ys[column[y].type].push_back(y);
+                    }
+                }
+                templates_by_hash.emplace(hash, template_index);
+            }
+
+            column_templates_[layer_num][x] = template_index;
         }
     }
+}
 
-    //Count the number of blocks in the grid
+void DeviceGrid::count_instances() {
+    int num_layers = get_num_layers();
+    instance_counts_.clear();
+    instance_counts_.resize(num_layers);
+
+    //Count the number of blocks in the grid, from the root locations of each column template
     for (int layer_num = 0; layer_num < num_layers; ++layer_num) {
         for (size_t x = 0; x < width(); ++x) {
-            for (size_t y = 0; y < height(); ++y) {
-                auto type = grid_[layer_num][x][y].type;
-
-                if (grid_[layer_num][x][y].width_offset == 0 && grid_[layer_num][x][y].height_offset == 0) {
-                    //Add capacity only if this is the root location
-                    instance_counts_[layer_num][type] += type->capacity;
-                }
+            for (const auto& type_root_ys : columns_[column_templates_[layer_num][x]].root_ys) {
+                auto type = type_root_ys.first;
+                //Add capacity only at the root locations
+                instance_counts_[layer_num][type] += type->capacity * type_root_ys.second.size();
             }
         }
     }
@@ -2,8 +2,8 @@
 #define DEVICE_GRID
 
 #include <string>
+#include <unordered_map>
 #include <vector>
-#include <cmath>
 #include "vtr_ndmatrix.h"
 #include "physical_types.h"
 
@@ -18,7 +18,15 @@ struct t_grid_tile {
     const t_metadata_dict* meta = nullptr;
 };
 
-///@brief DeviceGrid represents the FPGA fabric. It is used to get information about different layers and tiles.
+/**
+ * @brief DeviceGrid represents the FPGA fabric. It is used to get information about different layers and tiles.
+ *
+ * The layouts (<fill>, <col>, <perimeter>, ...) repeat the same column over most of the device, so
+ * the grid is stored as its distinct columns (column templates) and, for each (layer, x), the index
+ * of its column template: the storage is width * num_layers + num_templates * height tiles instead
+ * of num_layers * width * height. The tiles of each type in a template are recorded when building,
+ * so the tiles of a given type can be found without visiting all the tiles.
+ */
 // TODO: All of the function that use helper functions of this class should pass the layer_num to the functions, and the default value of layer_num should be deleted eventually.
 class DeviceGrid {
   public:
@@ -30,19 +38,22 @@ class DeviceGrid {
 
     ///@brief Return the number of layers(number of dies)
     inline int get_num_layers() const {
-        return (int)grid_.dim_size(0);
+        return (int)column_templates_.dim_size(0);
     }
 
     ///@brief Return the width of the grid at the specified layer
-    size_t width() const { return grid_.dim_size(1); }
+    size_t width() const { return column_templates_.dim_size(1); }
     ///@brief Return the height of the grid at the specified layer
-    size_t height() const { return grid_.dim_size(2); }
+    size_t height() const { return height_; }
 
     ///@brief Return the size of the flattened grid on the given layer
     inline size_t grid_size() const {
-        return grid_.size();
+        return column_templates_.size() * height_;
     }
 
+    ///@brief Return the number of distinct columns (column templates) the grid is stored as
+    size_t num_column_templates() const { return columns_.size(); }
+
     ///@brief deallocate members of DeviceGrid
     void clear();
 
@@ -60,65 +71,70 @@ class DeviceGrid {
 
     ///@brief Return the t_physical_tile_type_ptr at the specified location
     inline t_physical_tile_type_ptr get_physical_type(const t_physical_tile_loc& tile_loc) const {
-        return grid_[tile_loc.layer_num][tile_loc.x][tile_loc.y].type;
+        return tile(tile_loc).type;
     }
 
     ///@brief Return the width offset of the tile at the specified location. The root location of the tile is where width_offset and height_offset are 0.
     inline int get_width_offset(const t_physical_tile_loc& tile_loc) const {
-        return grid_[tile_loc.layer_num][tile_loc.x][tile_loc.y].width_offset;
+        return tile(tile_loc).width_offset;
     }
 
     ///@brief Return the height offset of the tile at the specified location. The root location of the tile is where width_offset and height_offset are 0
     inline int get_height_offset(const t_physical_tile_loc& tile_loc) const {
-        return grid_[tile_loc.layer_num][tile_loc.x][tile_loc.y].height_offset;
+        return tile(tile_loc).height_offset;
     }
 
     ///@brief Return the metadata of the tile at the specified location
     inline const t_metadata_dict* get_metadata(const t_physical_tile_loc& tile_loc) const {
-        return grid_[tile_loc.layer_num][tile_loc.x][tile_loc.y].meta;
-    }
-
-    ///@brief Given t_grid_tile, return the x coordinate of the tile on the given layer - Used by serializer functions
-    inline int get_grid_loc_x(const t_grid_tile*& grid_loc) const {
-        int layer_num = std::floor(static_cast<int>(grid_loc - &grid_.get(0)) / (width() * height()));
-        auto diff = grid_loc - &grid_.get(layer_num * height() * width());
-
-        return diff / grid_.dim_size(2);
+        return tile(tile_loc).meta;
     }
 
-    ///@brief Given t_grid_tile, return the y coordinate of the tile on the given layer - Used by serializer functions
-    inline int get_grid_loc_y(const t_grid_tile*& grid_loc) const {
-        int layer_num = std::floor(static_cast<int>(grid_loc - &grid_.get(0)) / (width() * height()));
-        auto diff = grid_loc - &grid_.get(layer_num * height() * width());
-
-        return diff % grid_.dim_size(2);
+    /**
+     * @brief Return the root locations of the tiles of the specified type on the specified layer, ordered by x then y.
+     *        If the layer_num is -1, return those on all layers (ordered by layer first).
+     * @note Only the columns whose template contains the type are visited, so this is proportional to
+     *       the width of the grid and the number of tiles found, not to the size of the grid.
+     */
+    std::vector<t_physical_tile_loc> tile_locations(t_physical_tile_type_ptr type, int layer_num) const;
+
+    ///@brief Return the location of the nth tile of the flattened grid ([layer][x][y] order) - Used by serializer functions
+    inline t_physical_tile_loc get_grid_loc(size_t n) const {
+        size_t layer_size = width() * height();
+        size_t layer_num = n / layer_size;
+        size_t layer_index = n % layer_size;
+        return {int(layer_index / height()), int(layer_index % height()), int(layer_num)};
     }
 
-    ///@brief Given t_grid_tile, return the layer number of the tile - Used by serializer functions
-    inline int get_grid_loc_layer(const t_grid_tile*& grid_loc) const {
-        int layer_num = std::floor(static_cast<int>(grid_loc - &grid_.get(0)) / (width() * height()));
-        return layer_num;
+  private:
+    ///@brief The tile at the specified location, in its column template
+    inline const t_grid_tile& tile(const t_physical_tile_loc& tile_loc) const {
+        return columns_[column_templates_[tile_loc.layer_num][tile_loc.x]].tiles[tile_loc.y];
     }
 
-    ///@brief Return the nth t_grid_tile on the given layer of the flattened grid - Used by serializer functions
-    inline const t_grid_tile* get_grid_locs_grid_loc(int n) const {
-        return &grid_.get(n);
-    }
+    ///@brief Splits grid into its distinct columns (columns_ and column_templates_)
+    void build_column_templates(const vtr::NdMatrix<t_grid_tile, 3>& grid);
 
-  private:
     ///@brief count_instances() counts the number of each tile type on each layer and store it in instance_counts_. It is called in the constructor.
     void count_instances();
 
     std::string name_;
 
+    ///@brief A distinct column of the grid
+    struct t_column_template {
+        std::vector<t_grid_tile> tiles;                                         ///<The tiles of the column [0..height-1]
+        std::unordered_map<t_physical_tile_type_ptr, std::vector<int>> root_ys; ///<The y of the root locations of each type in the column
+    };
+
+    ///@brief The distinct columns of the grid [0..num_column_templates-1]
+    std::vector<t_column_template> columns_;
+
     /**
-     * @brief grid_ is a 3D matrix that represents the grid of the FPGA chip.
-     * @note The first dimension is the layer number (grid_[0] corresponds to the bottom layer), the second dimension is the x coordinate, and the third dimension is the y coordinate.
-     * @note Note that vtr::Matrix operator[] returns and intermediate type
-     * @note which can be used for indexing in the second dimension, allowing
-     * @note traditional 2-d indexing to be used
+     * @brief column_templates_ is the index in columns_ of each column of the FPGA chip.
+     * @note The first dimension is the layer number (column_templates_[0] corresponds to the bottom layer), the second dimension is the x coordinate.
      */
-    vtr::NdMatrix<t_grid_tile, 3> grid_; //This stores the grid of complex blocks. It is a a 3D matrix: [0..num_layers-1][0..grid.width()-1][0..grid_height()-1]
+    vtr::NdMatrix<int, 2> column_templates_; //[0..num_layers-1][0..grid.width()-1]
+
+    size_t height_ = 0;
 
     ///@brief instance_counts_ stores the number of each tile type on each layer. It is initialized in count_instances().
     std::vector<std::map<t_physical_tile_type_ptr, size_t>> instance_counts_; /* [layer_num][physical_tile_type_ptr] */
@@ -6,7 +6,6 @@
 #ifdef VTR_ENABLE_CAPNPROTO
 
 #    include <algorithm>
-#    include <kj/std/iostream.h>
 #    include <limits>
 #    include <map>
 #    include <regex>
@@ -14,9 +13,10 @@
 #    include <stdlib.h>
 #    include <string>
 #    include <string.h>
-#    include <zlib.h>
 #    include <sstream>
 
+#    include "capnp_message_file.h"
+
 #    include "vtr_assert.h"
 #    include "vtr_digest.h"
 #    include "vtr_log.h"
@@ -2510,39 +2510,13 @@ void FPGAInterchangeReadArch(const char* FPGAInterchangeDeviceFile,
                              std::vector<t_physical_tile_type>& PhysicalTileTypes,
                              std::vector<t_logical_block_type>& LogicalBlockTypes) {
 #ifdef VTR_ENABLE_CAPNPROTO
-    // Decompress GZipped capnproto device file
-    gzFile file = gzopen(FPGAInterchangeDeviceFile, "r");
-    VTR_ASSERT(file != Z_NULL);
-
-    std::vector<uint8_t> output_data;
-    output_data.resize(4096);
-    std::stringstream sstream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
-    while (true) {
-        int ret = gzread(file, output_data.data(), output_data.size());
-        VTR_ASSERT(ret >= 0);
-        if (ret > 0) {
-            sstream.write((const char*)output_data.data(), ret);
-            VTR_ASSERT(sstream);
-        } else {
-            VTR_ASSERT(ret == 0);
-            int error;
-            gzerror(file, &error);
-            VTR_ASSERT(error == Z_OK);
-            break;
-        }
-    }
-
-    VTR_ASSERT(gzclose(file) == Z_OK);
-
-    sstream.seekg(0);
-    kj::std::StdInputStream istream(sstream);
-
     // Reader options
     capnp::ReaderOptions reader_options;
     reader_options.nestingLimit = std::numeric_limits<int>::max();
     reader_options.traversalLimitInWords = std::numeric_limits<uint64_t>::max();
 
-    capnp::InputStreamMessageReader message_reader(istream, reader_options);
+    // The file is usually gzip compressed, but uncompressed files are memory mapped and read in place
+    CapnpMessageFile message_reader(FPGAInterchangeDeviceFile, reader_options);
 
     auto device_reader = message_reader.getRoot<DeviceResources::Device>();
 
@@ -0,0 +1,92 @@
+// test framework
+#include "catch2/catch_test_macros.hpp"
+
+#include "device_grid.h"
+
+namespace {
+
+TEST_CASE("Device grid column templates", "[device_grid]") {
+    t_physical_tile_type empty_tile;
+    empty_tile.name = "EMPTY";
+    empty_tile.capacity = 0;
+
+    t_physical_tile_type io_tile;
+    io_tile.name = "io";
+    io_tile.capacity = 8;
+
+    t_physical_tile_type clb_tile;
+    clb_tile.name = "clb";
+    clb_tile.capacity = 1;
+
+    // a 2-high block
+    t_physical_tile_type dsp_tile;
+    dsp_tile.name = "dsp";
+    dsp_tile.capacity = 1;
+    dsp_tile.height = 2;
+
+    // an 8x6 grid with an io perimeter, a dsp column at x = 4 and clbs elsewhere
+    const size_t width = 8;
+    const size_t height = 6;
+    vtr::NdMatrix<t_grid_tile, 3> tiles({1, width, height});
+    for (size_t x = 0; x < width; ++x) {
+        for (size_t y = 0; y < height; ++y) {
+            bool perimeter = (x == 0 || y == 0 || x == width - 1 || y == height - 1);
+            bool corner = (x == 0 || x == width - 1) && (y == 0 || y == height - 1);
+            auto& tile = tiles[0][x][y];
+            if (corner) {
+                tile.type = &empty_tile;
+            } else if (perimeter) {
+                tile.type = &io_tile;
+            } else if (x == 4) {
+                tile.type = &dsp_tile;
+                tile.height_offset = (y - 1) % 2;
+            } else {
+                tile.type = &clb_tile;
+            }
+        }
+    }
+
+    DeviceGrid grid("test", tiles);
+
+    // the left/right columns, the clb columns and the dsp column
+    REQUIRE(grid.num_column_templates() == 3);
+    REQUIRE(grid.width() == width);
+    REQUIRE(grid.height() == height);
+    REQUIRE(grid.grid_size() == width * height);
+
+    for (size_t x = 0; x < width; ++x) {
+        for (size_t y = 0; y < height; ++y) {
+            t_physical_tile_loc loc(x, y, 0);
+            REQUIRE(grid.get_physical_type(loc) == tiles[0][x][y].type);
+            REQUIRE(grid.get_width_offset(loc) == tiles[0][x][y].width_offset);
+            REQUIRE(grid.get_height_offset(loc) == tiles[0][x][y].height_offset);
+
+            t_physical_tile_loc flat_loc = grid.get_grid_loc(x * height + y);
+            REQUIRE(flat_loc.x == loc.x);
+            REQUIRE(flat_loc.y == loc.y);
+            REQUIRE(flat_loc.layer_num == 0);
+        }
+    }
+
+    REQUIRE(grid.num_instances(&io_tile, 0) == 8 * (2 * (width - 2) + 2 * (height - 2)));
+    REQUIRE(grid.num_instances(&clb_tile, -1) == 5 * (height - 2));
+    REQUIRE(grid.num_instances(&dsp_tile, 0) == 2);
+
+    // only the root locations, ordered by x then y
+    auto dsp_locs = grid.tile_locations(&dsp_tile, 0);
+    REQUIRE(dsp_locs.size() == 2);
+    REQUIRE((dsp_locs[0].x == 4 && dsp_locs[0].y == 1));
+    REQUIRE((dsp_locs[1].x == 4 && dsp_locs[1].y == 3));
+
+    auto clb_locs = grid.tile_locations(&clb_tile, -1);
+    REQUIRE(clb_locs.size() == 5 * (height - 2));
+    for (size_t i = 1; i < clb_locs.size(); ++i) {
+        REQUIRE((clb_locs[i - 1].x < clb_locs[i].x || (clb_locs[i - 1].x == clb_locs[i].x && clb_locs[i - 1].y < clb_locs[i].y)));
+    }
+
+    grid.clear();
+    REQUIRE(grid.grid_size() == 0);
+    REQUIRE(grid.tile_locations(&clb_tile, -1).empty());
+}
+
+} // namespace
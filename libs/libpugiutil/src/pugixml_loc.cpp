@@ -7,43 +7,58 @@ namespace pugiutil {
 
 //Return the line number from the given offset
 std::size_t loc_data::line(std::ptrdiff_t offset) const {
-    auto it = std::lower_bound(offsets_.begin(), offsets_.end(), offset);
-    std::size_t index = it - offsets_.begin();
-
-    return 1 + index;
+    return 1 + newlines_before(offset).first;
 }
 
 //Return the column number from the given offset
 std::size_t loc_data::col(std::ptrdiff_t offset) const {
-    auto it = std::lower_bound(offsets_.begin(), offsets_.end(), offset);
-    std::size_t index = it - offsets_.begin();
+    auto newlines = newlines_before(offset);
 
-    return index == 0 ? offset + 1 : offset - offsets_[index - 1];
+    return newlines.first == 0 ? offset + 1 : offset - newlines.second;
 }
 
-void loc_data::build_loc_data() {
-    FILE* f = fopen(filename_.c_str(), "rb");
-
-    if (f == nullptr) {
-        throw XmlError("Failed to open file", filename_);
+std::pair<std::size_t, std::ptrdiff_t> loc_data::newlines_before(std::ptrdiff_t offset) const {
+    if (!offsets_) {
+        //No file
+        return {0, -1};
     }
 
-    std::ptrdiff_t offset = 0;
+    std::lock_guard<std::mutex> lock(offsets_->mutex);
+    auto& newlines = offsets_->newlines;
 
-    char buffer[1024];
-    std::size_t size;
+    if (offsets_->scanned <= offset && !offsets_->at_eof) {
+        FILE* f = fopen(filename_.c_str(), "rb");
 
-    while ((size = fread(buffer, 1, sizeof(buffer), f)) > 0) {
-        for (std::size_t i = 0; i < size; ++i) {
-            if (buffer[i] == '\n') {
-                offsets_.push_back(offset + i);
+        if (f == nullptr) {
+            throw XmlError("Failed to open file", filename_);
+        }
+
+        if (fseek(f, offsets_->scanned, SEEK_SET) != 0) {
+            fclose(f);
+            throw XmlError("Failed to read file", filename_);
+        }
+
+        char buffer[1 << 16];
+        std::size_t size;
+
+        while (offsets_->scanned <= offset && (size = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+            for (std::size_t i = 0; i < size; ++i) {
+                if (buffer[i] == '\n') {
+                    newlines.push_back(offsets_->scanned + i);
+                }
             }
+
+            offsets_->scanned += size;
         }
+        offsets_->at_eof = offsets_->scanned <= offset;
 
-        offset += size;
+        fclose(f);
     }
 
-    fclose(f);
+    auto it = std::lower_bound(newlines.begin(), newlines.end(), offset);
+    std::size_t index = it - newlines.begin();
+
+    return {index, index == 0 ? -1 : newlines[index - 1]};
 }
 
 } // namespace pugiutil
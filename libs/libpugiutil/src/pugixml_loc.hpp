@@ -5,19 +5,25 @@
  * hanlding the retrieval of line numbers (useful for error messages)
  */
 
+#include <memory>
+#include <mutex>
 #include <vector>
 #include "pugixml.hpp"
 
 namespace pugiutil {
 
 //pugi offset to line/col data based on: https://stackoverflow.com/questions/21003471/convert-pugixmls-result-offset-to-column-line
+//
+//The line offsets are only looked for when a line/col is first asked for (i.e. when reporting an error
+//or a warning), and only as far into the file as the asked offset, so loading a large file (e.g. a packed
+//netlist) doesn't read it twice or store the offset of every line. Copies share the offsets found so far.
 class loc_data {
   public:
     loc_data() = default;
 
     loc_data(std::string filename_val)
-        : filename_(filename_val) {
-        build_loc_data();
+        : filename_(filename_val)
+        , offsets_(std::make_shared<LineOffsets>()) {
     }
 
     //The filename this location data is for
@@ -41,10 +47,20 @@ class loc_data {
     std::size_t col(std::ptrdiff_t offset) const;
 
   private:
-    void build_loc_data();
+    //The offsets of the newlines in the file, found so far
+    struct LineOffsets {
+        std::mutex mutex;
+        std::vector<std::ptrdiff_t> newlines;
+        std::ptrdiff_t scanned = 0; //Bytes of the file scanned for newlines
+        bool at_eof = false;
+    };
+
+    //Scans the file for newlines up to (and including) offset, and returns the number of
+    //newlines before offset and the offset of the last one (-1 if none)
+    std::pair<std::size_t, std::ptrdiff_t> newlines_before(std::ptrdiff_t offset) const;
 
     std::string filename_;
-    std::vector<std::ptrdiff_t> offsets_;
+    std::shared_ptr<LineOffsets> offsets_;
 };
 } // namespace pugiutil
 
@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
 #include "vtr_log.h"
 #include "vtr_memory.h"
 #include "vtr_util.h"
@@ -28,6 +33,9 @@ static void check_rr_edge(const RRGraphView& rr_graph,
 
 /************************ Subroutine definitions ****************************/
 
+//Graphs with fewer nodes (per thread) than this are not worth checking in parallel
+static constexpr size_t MIN_NODES_PER_CHECK_THREAD = 100000;
+
 class node_edge_sorter {
   public:
     bool operator()(const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) const {
@@ -59,24 +67,23 @@ void check_rr_graph(const RRGraphView& rr_graph,
         route_type = GLOBAL;
     }
 
-    auto total_edges_to_node = std::vector<int>(rr_graph.num_nodes());
-    auto switch_types_from_current_to_node = std::vector<unsigned char>(rr_graph.num_nodes());
+    //Edges may lead to any node, so the fan-in counts are shared by the threads checking the nodes
+    auto total_edges_to_node = std::vector<std::atomic<int>>(rr_graph.num_nodes());
     const int num_rr_switches = rr_graph.num_rr_switches();
 
-    std::vector<std::pair<int, int>> edges;
-
-    for (const RRNodeId& rr_node : rr_graph.nodes()) {
+    //Checks a node and its edges, using edges as scratch space
+    auto check_node_and_edges = [&](RRNodeId rr_node, std::vector<std::pair<int, int>>& edges) {
         size_t inode = (size_t)rr_node;
         rr_graph.validate_node(rr_node);
 
         /* Ignore any uninitialized rr_graph nodes */
         if (!rr_graph.node_is_initialized(rr_node)) {
-            continue;
+            return;
         }
 
         // Virtual clock network sink is special, ignore.
         if (rr_graph.is_virtual_clock_network_root(rr_node)) {
-            continue;
+            return;
         }
 
         t_rr_type rr_type = rr_graph.node_type(rr_node);
@@ -107,7 +114,7 @@ void check_rr_graph(const RRGraphView& rr_graph,
                           is_flat);
 
             edges.emplace_back(to_node, iedge);
-            total_edges_to_node[to_node]++;
+            total_edges_to_node[to_node].fetch_add(1, std::memory_order_relaxed);
 
             auto switch_type = rr_graph.edge_switch(rr_node, iedge);
 
@@ -175,7 +182,7 @@ void check_rr_graph(const RRGraphView& rr_graph,
             //
             //Identify any such edges with identical switches
             std::map<short, int> switch_counts;
-            for (const auto& to_edge : vtr::Range<decltype(edges)::const_iterator>(range.first, range.second)) {
+            for (const auto& to_edge : vtr::Range<std::vector<std::pair<int, int>>::const_iterator>(range.first, range.second)) {
                 auto edge = to_edge.second;
                 auto edge_switch = rr_graph.edge_switch(rr_node, edge);
 
@@ -217,7 +224,45 @@ void check_rr_graph(const RRGraphView& rr_graph,
             }
         }
 
-    } /* End for all rr_nodes */
+    };
+
+    //The nodes are checked in parallel over contiguous ranges of nodes. The first error found
+    //(by the lowest range) is re-thrown once all the threads are done, and stops the other threads.
+    const size_t num_nodes = rr_graph.num_nodes();
+    const size_t num_threads = std::clamp<size_t>(num_nodes / MIN_NODES_PER_CHECK_THREAD,
+                                                  1, std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::exception_ptr> thread_errors(num_threads);
+    std::atomic<bool> check_failed(false);
+
+    auto check_node_range = [&](size_t ithread) {
+        std::vector<std::pair<int, int>> edges;
+        try {
+            for (size_t inode = num_nodes * ithread / num_threads; inode < num_nodes * (ithread + 1) / num_threads; ++inode) {
+                if (check_failed.load(std::memory_order_relaxed)) {
+                    break;
+                }
+                check_node_and_edges(RRNodeId(inode), edges);
+            }
+        } catch (...) {
+            thread_errors[ithread] = std::current_exception();
+            check_failed = true;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t ithread = 1; ithread < num_threads; ++ithread) {
+        threads.emplace_back(check_node_range, ithread);
+    }
+    check_node_range(0);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (const std::exception_ptr& error : thread_errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
 
     // AM: For the time being, if is_flat is enabled, we don't have proper tests to check whether a node should have an incoming
     // edge or not
@@ -302,7 +347,7 @@ void check_rr_graph(const RRGraphView& rr_graph,
         } else { /* SOURCE.  No fanin for now; change if feedthroughs allowed. */
             if (total_edges_to_node[inode] != 0) {
                 VTR_LOG_ERROR("in check_rr_graph: SOURCE node %d has a fanin of %d, expected 0.\n",
-                              inode, total_edges_to_node[inode]);
+                              inode, total_edges_to_node[inode].load());
             }
         }
     }
@@ -48,6 +48,24 @@ class MetadataStorage {
         }
     }
 
+    // Call the given function with each <lookup key, metadata key, metadata value>,
+    // without building the map if it has not been built yet.
+    void for_each_metadata(std::function<void(const LookupKey&, vtr::interned_string, vtr::interned_string)> apply) const {
+        if (map_.empty()) {
+            for (const auto& entry : data_) {
+                apply(std::get<0>(entry), std::get<1>(entry), std::get<2>(entry));
+            }
+            return;
+        }
+        for (const auto& dict : map_) {
+            for (const auto& entry : dict.second) {
+                for (const auto& value : entry.second) {
+                    apply(dict.first, entry.first, value.as_string());
+                }
+            }
+        }
+    }
+
     typename vtr::flat_map<LookupKey, t_metadata_dict>::const_iterator find(const LookupKey& lookup_key) const {
         check_for_map();
 
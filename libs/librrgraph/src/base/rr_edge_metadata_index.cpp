@@ -0,0 +1,91 @@
+#include <algorithm>
+
+#include "rr_edge_metadata_index.h"
+#include "rr_graph_storage.h"
+
+void RREdgeMetadataIndex::build(const t_rr_graph_storage& node_storage, const MetadataStorage<std::tuple<int, int, short>>& edge_metadata) {
+    clear();
+
+    size_t num_edges = 0;
+    if (!node_storage.empty()) {
+        num_edges = size_t(node_storage.last_edge(RRNodeId(node_storage.size() - 1)));
+    }
+
+    /* Resolve the <source, sink, switch> key of each attribute to an edge id.
+     * Consecutive attributes usually share their key, so the last resolution is reused */
+    std::vector<std::tuple<RREdgeId, vtr::interned_string, vtr::interned_string>> entries;
+    std::tuple<int, int, short> last_key(-1, -1, -1);
+    RREdgeId last_edge = RREdgeId::INVALID();
+    edge_metadata.for_each_metadata([&](const std::tuple<int, int, short>& key, vtr::interned_string meta_key, vtr::interned_string meta_value) {
+        if (key != last_key) {
+            last_key = key;
+            last_edge = RREdgeId::INVALID();
+
+            RRNodeId src_node(std::get<0>(key));
+            RRNodeId sink_node(std::get<1>(key));
+            if (size_t(src_node) < node_storage.size()) {
+                for (RREdgeId edge : node_storage.edge_range(src_node)) {
+                    if (node_storage.edge_sink_node(edge) == sink_node && node_storage.edge_switch(edge) == std::get<2>(key)) {
+                        last_edge = edge;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (!last_edge.is_valid()) {
+            orphaned_ = true;
+            return;
+        }
+        entries.emplace_back(last_edge, meta_key, meta_value);
+    });
+
+    /* Keep the insertion order of the values of each edge, as t_metadata_dict does */
+    std::stable_sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+        return std::get<0>(lhs) < std::get<0>(rhs);
+    });
+
+    edge_first_entry_.resize(num_edges + 1, 0);
+    entry_keys_.reserve(entries.size());
+    entry_values_.reserve(entries.size());
+    size_t next_edge = 0;
+    for (const auto& entry : entries) {
+        for (; next_edge <= size_t(std::get<0>(entry)); ++next_edge) {
+            edge_first_entry_[RREdgeId(next_edge)] = entry_keys_.size();
+        }
+        entry_keys_.push_back(std::get<1>(entry));
+        entry_values_.emplace_back(std::get<2>(entry));
+    }
+    for (; next_edge <= num_edges; ++next_edge) {
+        edge_first_entry_[RREdgeId(next_edge)] = entry_keys_.size();
+    }
+
+    is_built_ = true;
+}
+
+void RREdgeMetadataIndex::clear() {
+    edge_first_entry_.clear();
+    entry_keys_.clear();
+    entry_values_.clear();
+    is_built_ = false;
+    orphaned_ = false;
+}
+
+const t_metadata_value* RREdgeMetadataIndex::one(RREdgeId edge, vtr::interned_string key) const {
+    VTR_ASSERT(is_built_);
+    if (size_t(edge) + 1 >= edge_first_entry_.size()) {
+        return nullptr;
+    }
+
+    const t_metadata_value* value = nullptr;
+    for (size_t ientry = edge_first_entry_[edge]; ientry < edge_first_entry_[RREdgeId(size_t(edge) + 1)]; ++ientry) {
+        if (entry_keys_[ientry] != key) {
+            continue;
+        }
+        if (value != nullptr) {
+            return nullptr;
+        }
+        value = &entry_values_[ientry];
+    }
+    return value;
+}
@@ -0,0 +1,68 @@
+#ifndef RR_EDGE_METADATA_INDEX_H
+#define RR_EDGE_METADATA_INDEX_H
+
+/**
+ * @file
+ * @brief This RREdgeMetadataIndex class is a read-only, flat (CSR-like) view
+ *        of the metadata of the routing resource edges, keyed by RREdgeId
+ *
+ * The edge metadata is stored (see MetadataStorage) with an
+ * <source rr_node, sink rr_node, switch> key, and a lookup goes through
+ * a map of per-edge dictionaries, each owning its own vectors. Once the
+ * routing resource graph is built, this index packs the same (interned)
+ * attributes of all the edges into one array sorted by edge, so that
+ * a lookup is an offset read followed by a short scan, and the index costs
+ * two interned strings per attribute, plus one offset per edge.
+ */
+#include <tuple>
+#include <vector>
+
+#include "vtr_vector.h"
+#include "physical_types.h"
+#include "rr_graph_fwd.h"
+#include "metadata_storage.h"
+
+class t_rr_graph_storage;
+
+class RREdgeMetadataIndex {
+    /* -- Mutators -- */
+  public:
+    /**
+     * @brief Build the index from the edge metadata of the given graph storage, whose edges must be partitioned
+     *
+     * The metadata of a <source, sink, switch> key is attached to the first edge of the source node matching it.
+     * The metadata whose key matches no edge is kept aside, see orphaned().
+     */
+    void build(const t_rr_graph_storage& node_storage, const MetadataStorage<std::tuple<int, int, short>>& edge_metadata);
+
+    /** @brief Drop the index, which should then be rebuilt before any lookup */
+    void clear();
+
+    /* -- Accessors -- */
+  public:
+    /** @brief Returns true if the index has been built since it was last cleared */
+    bool is_built() const { return is_built_; }
+
+    /** @brief Returns true if some metadata matched no edge of the graph when the index was built */
+    bool orphaned() const { return orphaned_; }
+
+    /**
+     * @brief Get the metadata value of an edge matching key
+     *
+     * Like t_metadata_dict::one(), returns nullptr if key is not found or if multiple values are present for key.
+     */
+    const t_metadata_value* one(RREdgeId edge, vtr::interned_string key) const;
+
+    /* -- Internal data storage -- */
+  private:
+    /* The attributes of edge are [edge_first_entry_[edge], edge_first_entry_[edge + 1]) in entry_keys_
+     * and entry_values_; the extra last offset avoids special-casing the last edge */
+    vtr::vector<RREdgeId, uint32_t> edge_first_entry_;
+    std::vector<vtr::interned_string> entry_keys_;
+    std::vector<t_metadata_value> entry_values_;
+
+    bool is_built_ = false;
+    bool orphaned_ = false;
+};
+
+#endif
@@ -3,13 +3,38 @@
 #include "vtr_time.h"
 #include <queue>
 #include <random>
+#include <tuple>
 //#include <algorithm>
 
 //#include "globals.h"
 
+// Position of (x, y) along a Hilbert curve filling a side x side square (side a power of two).
+static uint64_t hilbert_curve_index(uint32_t side, uint32_t x, uint32_t y) {
+    uint64_t d = 0;
+    for (uint32_t s = side / 2; s > 0; s /= 2) {
+        uint32_t rx = (x & s) ? 1 : 0;
+        uint32_t ry = (y & s) ? 1 : 0;
+        d += uint64_t(s) * s * ((3 * rx) ^ ry);
+        // Rotate the quadrant so the sub-curve is traversed in the right orientation
+        if (ry == 0) {
+            if (rx == 1) {
+                x = side - 1 - x;
+                y = side - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
 RRGraphBuilder::RRGraphBuilder() {}
 
 t_rr_graph_storage& RRGraphBuilder::rr_nodes() {
+    rr_edge_metadata_index_.clear();
+    return node_storage_;
+}
+
+const t_rr_graph_storage& RRGraphBuilder::rr_nodes() const {
     return node_storage_;
 }
 
@@ -22,9 +47,17 @@ MetadataStorage<int>& RRGraphBuilder::rr_node_metadata() {
 }
 
 MetadataStorage<std::tuple<int, int, short>>& RRGraphBuilder::rr_edge_metadata() {
+    rr_edge_metadata_index_.clear();
     return rr_edge_metadata_;
 }
 
+const RREdgeMetadataIndex& RRGraphBuilder::rr_edge_metadata_index() const {
+    if (!rr_edge_metadata_index_.is_built()) {
+        rr_edge_metadata_index_.build(node_storage_, rr_edge_metadata_);
+    }
+    return rr_edge_metadata_index_;
+}
+
 void RRGraphBuilder::add_node_to_all_locs(RRNodeId node) {
     t_rr_type node_type = node_storage_.node_type(node);
     short node_ptc_num = node_storage_.node_ptc_num(node);
@@ -77,6 +110,17 @@ void RRGraphBuilder::clear() {
     node_storage_.clear();
     rr_node_metadata_.clear();
     rr_edge_metadata_.clear();
+    rr_edge_metadata_index_.clear();
+    rr_segments_.clear();
+    rr_switch_inf_.clear();
+}
+
+void RRGraphBuilder::reset() {
+    node_lookup_.reset();
+    node_storage_.clear();
+    rr_node_metadata_.clear();
+    rr_edge_metadata_.clear();
+    rr_edge_metadata_index_.clear();
     rr_segments_.clear();
     rr_switch_inf_.clear();
 }
@@ -131,6 +175,35 @@ void RRGraphBuilder::reorder_nodes(e_rr_node_reorder_algorithm reorder_rr_graph_
     } else if (reorder_rr_graph_nodes_algorithm == RANDOM_SHUFFLE) {
         std::mt19937 g(reorder_rr_graph_nodes_seed);
         std::shuffle(src_order.begin(), src_order.end(), g);
+    } else if (reorder_rr_graph_nodes_algorithm == HILBERT_CURVE) {
+        // The router expands from a node to nodes which are physically close to it, so laying
+        // the nodes out along a space-filling curve over the grid keeps the working set of a
+        // net's expansion in few cache lines/pages. Nodes are keyed by the centre of their span
+        // so a long wire lands between the tiles it connects.
+        int max_coord = 0;
+        for (size_t i = 0; i < v_num; ++i) {
+            RRNodeId node(i);
+            max_coord = std::max<int>(max_coord, std::max(node_storage_.node_xhigh(node), node_storage_.node_yhigh(node)));
+        }
+        uint32_t curve_side = 1;
+        while (curve_side <= (uint32_t)max_coord) {
+            curve_side <<= 1;
+        }
+
+        vtr::vector<RRNodeId, uint64_t> curve_idx(v_num);
+        for (size_t i = 0; i < v_num; ++i) {
+            RRNodeId node(i);
+            uint32_t x = (node_storage_.node_xlow(node) + node_storage_.node_xhigh(node)) / 2;
+            uint32_t y = (node_storage_.node_ylow(node) + node_storage_.node_yhigh(node)) / 2;
+            curve_idx[node] = hilbert_curve_index(curve_side, x, y);
+        }
+
+        // Sort by layer, then along the curve. Nodes of one tile are kept grouped by type and ptc
+        std::stable_sort(src_order.begin(), src_order.end(),
+                         [&](RRNodeId a, RRNodeId b) -> bool {
+                             return std::make_tuple(node_storage_.node_layer(a), curve_idx[a], node_storage_.node_type(a), node_storage_.node_ptc_num(a))
+                                    < std::make_tuple(node_storage_.node_layer(b), curve_idx[b], node_storage_.node_type(b), node_storage_.node_ptc_num(b));
+                         });
     }
     vtr::vector<RRNodeId, RRNodeId> dest_order(v_num);
     cur_idx = 0;
@@ -139,6 +212,7 @@ void RRGraphBuilder::reorder_nodes(e_rr_node_reorder_algorithm reorder_rr_graph_
 
     VTR_ASSERT_SAFE(node_storage_.validate(rr_switch_inf_));
     node_storage_.reorder(dest_order, src_order);
+    node_storage_.sort_edges_by_sink_node(rr_switch_inf_);
     VTR_ASSERT_SAFE(node_storage_.validate(rr_switch_inf_));
 
     node_lookup().reorder(dest_order);
@@ -16,6 +16,7 @@
 #include "rr_graph_storage.h"
 #include "rr_spatial_lookup.h"
 #include "metadata_storage.h"
+#include "rr_edge_metadata_index.h"
 
 class RRGraphBuilder {
     /* -- Constructors -- */
@@ -36,6 +37,8 @@ class RRGraphBuilder {
   public:
     /** @brief Return a writable object for rr_nodes */
     t_rr_graph_storage& rr_nodes();
+    /** @brief Return a read-only object for rr_nodes */
+    const t_rr_graph_storage& rr_nodes() const;
     /** @brief Return a writable object for update the fast look-up of rr_node */
     RRSpatialLookup& node_lookup();
     /** .. warning:: The Metadata should stay as an independent data structure than rest of the internal data,
@@ -71,6 +74,11 @@ class RRGraphBuilder {
         return rr_edge_metadata_.end();
     }
 
+    /** @brief Return the flat look-up of the edge metadata by RREdgeId. It is built on first use, once the edges are partitioned.
+     * @note The look-up is dropped whenever the edges or the edge metadata may change (e.g., through rr_nodes() or rr_edge_metadata()),
+     * and building it is not thread-safe: call it once before any parallel lookups */
+    const RREdgeMetadataIndex& rr_edge_metadata_index() const;
+
     /** @brief Add a rr_segment to the routing resource graph. Return an valid id if successful.
      *  - Each rr_segment contains the detailed information of a routing track, which is denoted by a node in CHANX or CHANY type.
      * - It is frequently used by client functions in timing and routability prediction.
@@ -140,6 +148,12 @@ class RRGraphBuilder {
 
     /** @brief Clear all the underlying data storage */
     void clear();
+
+    /**
+     * @brief Clear all the nodes, edges, segments and switches, but keep the allocated structure
+     * of the node look-up, to rebuild the graph of the same device (e.g. at another channel width)
+     */
+    void reset();
     /** @brief reorder all the nodes
      * Reordering the rr-graph nodes may be helpful in
      *   - Increasing cache locality during routing
@@ -147,6 +161,9 @@ class RRGraphBuilder {
      * Reorder RRNodeId's using one of these algorithms:
      *   - DEGREE_BFS: Order by degree primarily, and BFS traversal order secondarily.
      *   - RANDOM_SHUFFLE: Shuffle using the specified seed. Great for testing.
+     *   - HILBERT_CURVE: Order by layer, then by the position of the node (centre of its span)
+     *     along a Hilbert curve over the grid, then by type and ptc. Physically close nodes,
+     *     which the router tends to expand together, end up close in memory.
      * The DEGREE_BFS algorithm was selected because it had the best performance of seven
      * existing algorithms here: https://github.com/SymbiFlow/vtr-rrgraph-reordering-tool
      * It might be worth further research, as the DEGREE_BFS algorithm is simple and
@@ -157,6 +174,9 @@ class RRGraphBuilder {
      * in the rr-graph before routing we check that no code depends on the rr-graph node order
      * Nonetheless, it does improve performance ~7% for the SymbiFlow Xilinx Artix 7 graph.
      *
+     * With any algorithm, the edges of each node are re-sorted by their new sink node ids
+     * (configurable edges first) after renumbering.
+     *
      * NOTE: Re-ordering will invalidate any references to rr_graph nodes, so this
      *       should generally be called before creating such references.
      */
@@ -277,6 +297,7 @@ class RRGraphBuilder {
 
     /** @brief It maps arch_switch_inf indicies to rr_switch_inf indicies. */
     inline void remap_rr_node_switch_indices(const t_arch_switch_fanin& switch_fanin) {
+        rr_edge_metadata_index_.clear();
         node_storage_.remap_rr_node_switch_indices(switch_fanin);
     }
 
@@ -334,9 +355,17 @@ class RRGraphBuilder {
     /** @brief Sorts edge data such that configurable edges appears before
      *  non-configurable edges. */
     inline void partition_edges() {
+        rr_edge_metadata_index_.clear();
         return node_storage_.partition_edges(rr_switch_inf_);
     }
 
+    /** @brief Free the per-edge source node array once the graph is complete.
+     * @note Edge sources are then found by a binary search of the per-node first edges,
+     * see t_rr_graph_storage::compact_edge_src_nodes() */
+    inline void compact_edge_src_nodes() {
+        node_storage_.compact_edge_src_nodes();
+    }
+
     /** @brief Init per node fan-in data.  Should only be called after all edges have
      * been allocated.
      * @note
@@ -357,6 +386,7 @@ class RRGraphBuilder {
         node_storage_.partitioned_ = false;
         node_storage_.remapped_edges_ = false;
         node_storage_.clear_node_first_edge();
+        rr_edge_metadata_index_.clear();
     }
 
     /* -- Internal data storage -- */
@@ -412,6 +442,10 @@ class RRGraphBuilder {
      * value:   map of <attribute_name, attribute_value>
      */
     MetadataStorage<std::tuple<int, int, short>> rr_edge_metadata_;
+    /**
+     * @brief Compact look-up of rr_edge_metadata_ by RREdgeId, see rr_edge_metadata_index()
+     */
+    mutable RREdgeMetadataIndex rr_edge_metadata_index_;
 };
 
 #endif
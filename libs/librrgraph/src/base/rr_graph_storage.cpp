@@ -5,8 +5,11 @@
 #include "vtr_error.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <type_traits>
 
 void t_rr_graph_storage::reserve_edges(size_t num_edges) {
+    restore_edge_src_nodes();
     edge_src_node_.reserve(num_edges);
     edge_dest_node_.reserve(num_edges);
     edge_switch_.reserve(num_edges);
@@ -16,6 +19,7 @@ void t_rr_graph_storage::reserve_edges(size_t num_edges) {
 void t_rr_graph_storage::emplace_back_edge(RRNodeId src, RRNodeId dest, short edge_switch, bool remapped) {
     // Cannot mutate edges once edges have been read!
     VTR_ASSERT(!edges_read_);
+    restore_edge_src_nodes();
     edge_src_node_.emplace_back(src);
     edge_dest_node_.emplace_back(dest);
     edge_switch_.emplace_back(edge_switch);
@@ -29,6 +33,7 @@ constexpr size_t kEdgeToNodeRatio = 10;
 void t_rr_graph_storage::alloc_and_load_edges(const t_rr_edge_info_set* rr_edges_to_create) {
     // Cannot mutate edges once edges have been read!
     VTR_ASSERT(!edges_read_);
+    restore_edge_src_nodes();
 
     size_t required_size = edge_src_node_.size() + rr_edges_to_create->size();
     if (edge_src_node_.capacity() < required_size) {
@@ -404,6 +409,41 @@ bool t_rr_graph_storage::verify_first_edges() const {
     return true;
 }
 
+void t_rr_graph_storage::compact_edge_src_nodes() {
+    VTR_ASSERT(partitioned_);
+    if (edge_src_nodes_compacted_) {
+        return;
+    }
+
+    VTR_ASSERT(node_first_edge_.size() == node_storage_.size() + 1);
+    edge_src_node_.clear();
+    edge_src_node_.shrink_to_fit();
+    edge_src_nodes_compacted_ = true;
+}
+
+RRNodeId t_rr_graph_storage::find_edge_src_node(const RREdgeId& edge) const {
+    // The source is the last node whose first edge is not after the edge. Nodes without
+    // edges share their first edge with the next node, so they never match.
+    auto first_edge_after = std::upper_bound(node_first_edge_.begin(), node_first_edge_.end(), edge);
+    VTR_ASSERT_SAFE(first_edge_after != node_first_edge_.begin());
+    return RRNodeId(std::distance(node_first_edge_.begin(), first_edge_after) - 1);
+}
+
+void t_rr_graph_storage::restore_edge_src_nodes() {
+    if (!edge_src_nodes_compacted_) {
+        return;
+    }
+
+    edge_src_node_.resize(edge_dest_node_.size());
+    for (size_t inode = 0; inode < node_storage_.size(); inode++) {
+        RRNodeId node(inode);
+        for (RREdgeId edge : edge_range(node)) {
+            edge_src_node_[edge] = node;
+        }
+    }
+    edge_src_nodes_compacted_ = false;
+}
+
 void t_rr_graph_storage::init_fan_in() {
     //Reset all fan-ins to zero
     edges_read_ = true;
@@ -494,7 +534,7 @@ void t_rr_graph_storage::remap_rr_node_switch_indices(const t_arch_switch_fanin&
     edges_read_ = true;
 
     VTR_ASSERT(!remapped_edges_);
-    for (size_t i = 0; i < edge_src_node_.size(); ++i) {
+    for (size_t i = 0; i < edge_dest_node_.size(); ++i) {
         RREdgeId edge(i);
         if(edge_remapped_[edge]) {
             continue;
@@ -531,6 +571,7 @@ void t_rr_graph_storage::partition_edges(const vtr::vector<RRSwitchId, t_rr_swit
 
     edges_read_ = true;
     VTR_ASSERT(remapped_edges_);
+    restore_edge_src_nodes();
     // This sort ensures two things:
     //  - Edges are stored in ascending source node order.  This is required
     //    by assign_first_edges()
@@ -628,7 +669,7 @@ const char* t_rr_graph_storage::node_side_string(RRNodeId id) const {
 }
 
 void t_rr_graph_storage::set_node_layer(RRNodeId id, short layer) {
-    node_layer_[id] = layer;
+    node_storage_[id].layer_ = layer;
 }
 
 void t_rr_graph_storage::set_node_ptc_twist_incr(RRNodeId id, short twist_incr){
@@ -752,7 +793,7 @@ void t_rr_graph_storage::set_node_cost_index(RRNodeId id, RRIndexedDataId new_co
 }
 
 void t_rr_graph_storage::set_node_rc_index(RRNodeId id, NodeRCIndex new_rc_index) {
-    node_storage_[id].rc_index_ = (size_t)new_rc_index;
+    node_rc_index_[id] = (size_t)new_rc_index;
 }
 
 void t_rr_graph_storage::set_node_capacity(RRNodeId id, short new_capacity) {
@@ -815,7 +856,7 @@ t_rr_graph_view t_rr_graph_storage::view() const {
         vtr::make_const_array_view_id(node_ptc_),
         vtr::make_const_array_view_id(node_first_edge_),
         vtr::make_const_array_view_id(node_fan_in_),
-        vtr::make_const_array_view_id(node_layer_),
+        vtr::make_const_array_view_id(node_rc_index_),
         node_name_,
         vtr::make_const_array_view_id(node_ptc_twist_incr_),
         vtr::make_const_array_view_id(edge_src_node_),
@@ -824,6 +865,129 @@ t_rr_graph_view t_rr_graph_storage::view() const {
         virtual_clock_network_root_idx_);
 }
 
+/* Each array of a native image is stored as its element size and count, followed
+ * by the raw elements. The element size catches images from builds with a
+ * different t_rr_node_data (etc.) layout. */
+template<typename T>
+static void write_native_array(std::ostream& out, const T* data, size_t count) {
+    static_assert(std::is_trivially_copyable<T>::value, "Native image arrays must be trivially copyable");
+    uint64_t header[2] = {sizeof(T), count};
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(data), sizeof(T) * count);
+}
+
+template<typename K, typename T, typename A>
+static void write_native_array(std::ostream& out, const vtr::vector<K, T, A>& vec) {
+    write_native_array(out, vec.data(), vec.size());
+}
+
+template<typename K, typename T, typename A>
+static bool read_native_array(std::istream& in, vtr::vector<K, T, A>& vec) {
+    uint64_t header[2];
+    if (!in.read(reinterpret_cast<char*>(header), sizeof(header)) || header[0] != sizeof(T)) {
+        return false;
+    }
+    vec.resize(header[1]);
+    return bool(in.read(reinterpret_cast<char*>(vec.data()), sizeof(T) * header[1]));
+}
+
+static void write_native_string(std::ostream& out, const std::string& str) {
+    write_native_array(out, str.data(), str.size());
+}
+
+static bool read_native_string(std::istream& in, std::string& str) {
+    uint64_t header[2];
+    if (!in.read(reinterpret_cast<char*>(header), sizeof(header)) || header[0] != sizeof(char)) {
+        return false;
+    }
+    str.resize(header[1]);
+    return bool(in.read(&str[0], header[1]));
+}
+
+void t_rr_graph_storage::write_native_image(std::ostream& out) const {
+    VTR_ASSERT(partitioned_);
+    VTR_ASSERT(node_storage_.size() == node_fan_in_.size());
+
+    write_native_array(out, node_storage_);
+    write_native_array(out, node_ptc_);
+    write_native_array(out, node_first_edge_);
+    write_native_array(out, node_fan_in_);
+    write_native_array(out, node_rc_index_);
+    write_native_array(out, node_ptc_twist_incr_);
+    write_native_array(out, edge_dest_node_);
+    write_native_array(out, edge_switch_);
+
+    uint64_t num_names = node_name_.size();
+    out.write(reinterpret_cast<const char*>(&num_names), sizeof(num_names));
+    for (const auto& node_name : node_name_) {
+        write_native_array(out, &node_name.first, 1);
+        write_native_string(out, node_name.second);
+    }
+
+    uint64_t num_clock_roots = virtual_clock_network_root_idx_.size();
+    out.write(reinterpret_cast<const char*>(&num_clock_roots), sizeof(num_clock_roots));
+    for (const auto& clock_root : virtual_clock_network_root_idx_) {
+        write_native_string(out, clock_root.first);
+        write_native_array(out, &clock_root.second, 1);
+    }
+}
+
+bool t_rr_graph_storage::read_native_image(std::istream& in) {
+    clear();
+
+    bool ok = read_native_array(in, node_storage_)
+              && read_native_array(in, node_ptc_)
+              && read_native_array(in, node_first_edge_)
+              && read_native_array(in, node_fan_in_)
+              && read_native_array(in, node_rc_index_)
+              && read_native_array(in, node_ptc_twist_incr_)
+              && read_native_array(in, edge_dest_node_)
+              && read_native_array(in, edge_switch_);
+
+    uint64_t num_names = 0;
+    ok = ok && in.read(reinterpret_cast<char*>(&num_names), sizeof(num_names));
+    for (uint64_t iname = 0; ok && iname < num_names; ++iname) {
+        vtr::vector<size_t, RRNodeId> node(1);
+        std::string name;
+        ok = read_native_array(in, node) && node.size() == 1 && read_native_string(in, name);
+        if (ok) {
+            node_name_.emplace(node[0], std::move(name));
+        }
+    }
+
+    uint64_t num_clock_roots = 0;
+    ok = ok && in.read(reinterpret_cast<char*>(&num_clock_roots), sizeof(num_clock_roots));
+    for (uint64_t iroot = 0; ok && iroot < num_clock_roots; ++iroot) {
+        std::string name;
+        vtr::vector<size_t, RRNodeId> node(1);
+        ok = read_native_string(in, name) && read_native_array(in, node) && node.size() == 1;
+        if (ok) {
+            virtual_clock_network_root_idx_.emplace(std::move(name), node[0]);
+        }
+    }
+
+    ok = ok
+         && node_ptc_.size() == node_storage_.size()
+         && node_rc_index_.size() == node_storage_.size()
+         && node_fan_in_.size() == node_storage_.size()
+         && node_first_edge_.size() == node_storage_.size() + 1
+         && node_first_edge_.back() == RREdgeId(edge_dest_node_.size())
+         && edge_switch_.size() == edge_dest_node_.size();
+    if (!ok) {
+        clear();
+        return false;
+    }
+
+    // The image is written from a finished graph
+    edges_read_ = true;
+    remapped_edges_ = true;
+    partitioned_ = true;
+    edge_src_nodes_compacted_ = true;
+    restore_edge_src_nodes();
+
+    return true;
+}
+
 // Given `order`, a vector mapping each RRNodeId to a new one (old -> new),
 // and `inverse_order`, its inverse (new -> old), update the t_rr_graph_storage
 // data structure to an isomorphic graph using the new RRNodeId's.
@@ -841,6 +1005,7 @@ t_rr_graph_view t_rr_graph_storage::view() const {
 void t_rr_graph_storage::reorder(const vtr::vector<RRNodeId, RRNodeId>& order,
                                  const vtr::vector<RRNodeId, RRNodeId>& inverse_order) {
     VTR_ASSERT(order.size() == inverse_order.size());
+    restore_edge_src_nodes();
     {
         auto old_node_storage = node_storage_;
 
@@ -886,4 +1051,41 @@ void t_rr_graph_storage::reorder(const vtr::vector<RRNodeId, RRNodeId>& order,
             node_fan_in_[order[RRNodeId(i)]] = old_node_fan_in[RRNodeId(i)];
         }
     }
+    {
+        auto old_node_rc_index = node_rc_index_;
+        for (size_t i = 0; i < node_rc_index_.size(); i++) {
+            node_rc_index_[order[RRNodeId(i)]] = old_node_rc_index[RRNodeId(i)];
+        }
+    }
+    {
+        auto old_node_ptc_twist_incr = node_ptc_twist_incr_;
+        for (size_t i = 0; i < node_ptc_twist_incr_.size(); i++) {
+            node_ptc_twist_incr_[order[RRNodeId(i)]] = old_node_ptc_twist_incr[RRNodeId(i)];
+        }
+    }
+    {
+        std::unordered_map<RRNodeId, std::string> old_node_name;
+        std::swap(old_node_name, node_name_);
+        for (auto& name : old_node_name) {
+            node_name_.emplace(order[name.first], std::move(name.second));
+        }
+        for (auto& root : virtual_clock_network_root_idx_) {
+            root.second = order[root.second];
+        }
+    }
+}
+
+void t_rr_graph_storage::sort_edges_by_sink_node(const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switches) {
+    VTR_ASSERT(partitioned_);
+    restore_edge_src_nodes();
+    // Same order as partition_edges(): by source node, configurable edges
+    // first, and then by sink node within each of those two groups.
+    std::stable_sort(
+        edge_sort_iterator(this, 0),
+        edge_sort_iterator(this, edge_src_node_.size()),
+        edge_compare_src_node_and_configurable_first(rr_switches));
+
+    assign_first_edges();
+
+    VTR_ASSERT_SAFE(validate(rr_switches));
 }
@@ -13,6 +13,7 @@
 #include "rr_edge.h"
 #include "vtr_log.h"
 #include "vtr_memory.h"
+#include "vtr_memory_usage.h"
 #include "vtr_strong_id_range.h"
 #include "vtr_array_view.h"
 #include<iostream>
@@ -41,9 +42,7 @@
  *             data t_rr_index_data (this indirection allows quick dynamic   *
  *             changes of rr base costs, and some memory storage savings for *
  *             fields that have only a few distinct values).                 *
- * rc_index: An integer index into a deduplicated table of R and C values.
- *           For example, two nodes that have identifical R/C values will
- *           have the same rc_index.
+ * layer: The die the node is located at (see t_rr_graph_storage::node_layer).
  * capacity:   Capacity of this node (number of routes that can use it).     *
  *                                                                           *
  * direction: if the node represents a track, this field                     *
@@ -55,7 +54,7 @@
  *       otherwise.                                                          */
 struct alignas(16) t_rr_node_data {
     int16_t cost_index_ = -1;
-    int16_t rc_index_ = -1;
+    int16_t layer_ = 0;
 
     int16_t xlow_ = -1;
     int16_t ylow_ = -1;
@@ -159,6 +158,23 @@ class t_rr_graph_storage {
     // and stored.
     t_rr_graph_view view() const;
 
+    /** @brief Write the node and edge arrays as a native binary image.
+     *
+     * The image is a raw copy of the flat arrays, so it can only be read back by a
+     * build of VPR with the same data layout (checked by read_native_image()). The
+     * edges must be partitioned. Edge source nodes are not written: they are
+     * recovered from the per-node first edges when the image is read.
+     */
+    void write_native_image(std::ostream& out) const;
+
+    /** @brief Replace the graph with an image written by write_native_image().
+     *
+     * The loaded graph is partitioned and its fan-in is initialized, so it is
+     * ready to use. Returns false (leaving the graph cleared) if the image is
+     * truncated or was written with a different data layout.
+     */
+    bool read_native_image(std::istream& in);
+
     /****************
      * Node methods *
      ****************/
@@ -169,7 +185,7 @@ class t_rr_graph_storage {
     const char* node_type_string(RRNodeId id) const;
 
     int16_t node_rc_index(RRNodeId id) const {
-        return node_storage_[id].rc_index_;
+        return node_rc_index_[id];
     }
 
     short node_xlow(RRNodeId id) const {
@@ -233,7 +249,7 @@ class t_rr_graph_storage {
      * The layer number start from the base die (base die: 0, the die above it: 1, etc.)
      */
     short node_layer(RRNodeId id) const{
-        return node_layer_[id];
+        return node_storage_[id].layer_;
     }
     
     /**
@@ -402,6 +418,9 @@ class t_rr_graph_storage {
     /** @brief Get the source node for the specified edge. */
     RRNodeId edge_src_node(const RREdgeId& edge) const {
         VTR_ASSERT_DEBUG(edge.is_valid());
+        if (edge_src_nodes_compacted_) {
+            return find_edge_src_node(edge);
+        }
         return edge_src_node_[edge];
     }
 
@@ -413,6 +432,15 @@ class t_rr_graph_storage {
 
     /** @brief Call the `apply` function with the edge id, source, and sink nodes of every edge. */
     void for_each_edge(std::function<void(RREdgeId, RRNodeId, RRNodeId)> apply) const {
+        if (edge_src_nodes_compacted_) {
+            for (size_t inode = 0; inode < node_storage_.size(); inode++) {
+                RRNodeId node(inode);
+                for (RREdgeId edge : edge_range(node)) {
+                    apply(edge, node, edge_dest_node_[edge]);
+                }
+            }
+            return;
+        }
         for (size_t i = 0; i < edge_dest_node_.size(); i++) {
             RREdgeId edge(i);
             apply(edge, edge_src_node_[edge], edge_dest_node_[edge]);
@@ -491,7 +519,7 @@ class t_rr_graph_storage {
         make_room_in_vector(&node_storage_, size_t(elem_position));
         node_ptc_.reserve(node_storage_.capacity());
         node_ptc_.resize(node_storage_.size());
-        node_layer_.resize(node_storage_.size());
+        node_rc_index_.resize(node_storage_.size(), -1);
         node_ptc_twist_incr_.resize(node_storage_.size());
     }
 
@@ -501,7 +529,7 @@ class t_rr_graph_storage {
         VTR_ASSERT(!edges_read_);
         node_storage_.reserve(size);
         node_ptc_.reserve(size);
-        node_layer_.reserve(size);
+        node_rc_index_.reserve(size);
     }
 
     /** @brief  Resize node storage to accomidate size RR nodes. */
@@ -510,7 +538,7 @@ class t_rr_graph_storage {
         VTR_ASSERT(!edges_read_);
         node_storage_.resize(size);
         node_ptc_.resize(size);
-        node_layer_.resize(size);
+        node_rc_index_.resize(size, -1);
     }
 
     /** @brief We only allocate the ptc twist increment array while building tileable rr-graphs */
@@ -536,7 +564,7 @@ class t_rr_graph_storage {
         node_ptc_.clear();
         node_first_edge_.clear();
         node_fan_in_.clear();
-        node_layer_.clear();
+        node_rc_index_.clear();
         node_name_.clear();
         virtual_clock_network_root_idx_.clear();
         node_ptc_twist_incr_.clear();
@@ -547,6 +575,7 @@ class t_rr_graph_storage {
         edges_read_ = false;
         partitioned_ = false;
         remapped_edges_ = false;
+        edge_src_nodes_compacted_ = false;
     }
 
     /** @brief
@@ -557,6 +586,20 @@ class t_rr_graph_storage {
         edge_remapped_.clear();
     }
 
+    /** @brief Free the per-edge source node array.
+     *
+     * Partitioned edges are stored in ascending source node order, so the source of an
+     * edge can be recovered by a binary search of node_first_edge_ instead, saving 4 bytes
+     * per edge at the cost of a slower edge_src_node(). Methods which add, sort or reorder
+     * edges rebuild the array first, so this can be called once the graph is complete.
+     */
+    void compact_edge_src_nodes();
+
+    /** @brief Has compact_edge_src_nodes() freed the per-edge source node array? */
+    bool edge_src_nodes_compacted() const {
+        return edge_src_nodes_compacted_;
+    }
+
     /** @brief Clear edge_remap data structure, and then initialize it with the given value */
     void init_edge_remap(bool val) {
         edge_remapped_.clear();
@@ -572,7 +615,7 @@ class t_rr_graph_storage {
         node_ptc_.shrink_to_fit();
         node_first_edge_.shrink_to_fit();
         node_fan_in_.shrink_to_fit();
-        node_layer_.shrink_to_fit();
+        node_rc_index_.shrink_to_fit();
         node_ptc_twist_incr_.shrink_to_fit();
         edge_src_node_.shrink_to_fit();
         edge_dest_node_.shrink_to_fit();
@@ -580,13 +623,32 @@ class t_rr_graph_storage {
         edge_remapped_.shrink_to_fit();
     }
 
+    /** @brief Return the (estimated) number of bytes held by the RR graph storage.
+     * This includes any unused capacity, so it should be called after shrink_to_fit()
+     * to measure the compacted graph.
+     */
+    size_t memory_usage() const {
+        return vtr::memory_usage(node_storage_)
+               + vtr::memory_usage(node_ptc_)
+               + vtr::memory_usage(node_first_edge_)
+               + vtr::memory_usage(node_fan_in_)
+               + vtr::memory_usage(node_rc_index_)
+               + vtr::memory_usage(node_name_)
+               + vtr::memory_usage(virtual_clock_network_root_idx_)
+               + vtr::memory_usage(node_ptc_twist_incr_)
+               + vtr::memory_usage(edge_src_node_)
+               + vtr::memory_usage(edge_dest_node_)
+               + vtr::memory_usage(edge_switch_)
+               + vtr::memory_usage(edge_remapped_);
+    }
+
     /** @brief Append 1 more RR node to the RR graph.*/
     void emplace_back() {
         // No edges can be assigned if mutating the rr node array.
         VTR_ASSERT(!edges_read_);
         node_storage_.emplace_back();
         node_ptc_.emplace_back();
-        node_layer_.emplace_back();
+        node_rc_index_.emplace_back(-1);
     }
 
     /** @brief Given `order`, a vector mapping each RRNodeId to a new one (old -> new),
@@ -598,6 +660,13 @@ class t_rr_graph_storage {
     void reorder(const vtr::vector<RRNodeId, RRNodeId>& order,
                  const vtr::vector<RRNodeId, RRNodeId>& inverse_order);
 
+    /** @brief Re-sort the (already partitioned) edges of each node by sink node id,
+     * keeping configurable edges first. reorder() keeps each node's edges in their
+     * old relative order, so this restores the ascending sink order partition_edges()
+     * produces and lets a node's fan-out be visited in memory order.
+     */
+    void sort_edges_by_sink_node(const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switches);
+
     /** @brief PTC set methods */
     void set_node_ptc_num(RRNodeId id, int);
     void set_node_pin_num(RRNodeId id, int);   //Same as set_ptc_num() by checks type() is consistent
@@ -773,6 +842,8 @@ class t_rr_graph_storage {
     }
 
     inline void clear_node_first_edge() {
+        // The edge sources can't be recovered without node_first_edge_
+        restore_edge_src_nodes();
         node_first_edge_.clear();
     }
 
@@ -791,6 +862,12 @@ class t_rr_graph_storage {
     /** @brief Verify that first_edge_ array correctly partitions rr edge data. */
     bool verify_first_edges() const;
 
+    /** @brief Source node of an edge when edge_src_node_ has been compacted away. */
+    RRNodeId find_edge_src_node(const RREdgeId& edge) const;
+
+    /** @brief Rebuild edge_src_node_ from node_first_edge_ if it was compacted away. */
+    void restore_edge_src_nodes();
+
     /*****************
      * Graph storage
      *
@@ -810,8 +887,11 @@ class t_rr_graph_storage {
     /** @brief
      * storage_ stores the core RR node data used by the router and is **very**
      * hot.
+     *
+     * The hot arrays use vtr::large_array_allocator, so they can be backed by huge pages
+     * or interleaved across NUMA nodes (see --large_alloc_policy).
      */
-    vtr::vector<RRNodeId, t_rr_node_data, vtr::aligned_allocator<t_rr_node_data>> node_storage_;
+    vtr::vector<RRNodeId, t_rr_node_data, vtr::large_array_allocator<t_rr_node_data>> node_storage_;
 
     /** @brief
      * The PTC data is cold data, and is generally not used during the inner
@@ -824,18 +904,17 @@ class t_rr_graph_storage {
      * of this vector is always storage_.size() + 1, where the last value is
      * always equal to the number of edges in the final graph.
      */
-    vtr::vector<RRNodeId, RREdgeId> node_first_edge_;
+    vtr::vector<RRNodeId, RREdgeId, vtr::large_array_allocator<RREdgeId>> node_first_edge_;
 
     /** @brief Fan in counts for each RR node. */
     vtr::vector<RRNodeId, t_edge_size> node_fan_in_;
 
     /** @brief
-     * Layer number that each RR node is located at
-     * Layer number refers to the die that the node belongs to. The layer number of base die is zero and die above it one, etc.
-     * This data is also considered as a hot data since it is used in inner loop of router, but since it didn't fit nicely into t_rr_node_data due to alignment issues, we had to store it
-     *in a separate vector.
+     * Index of each RR node into the deduplicated table of R and C values: nodes with identical R/C values have
+     * the same rc_index. It is only read once per evaluated node (unlike the coordinates, read by every bounding box
+     * and lookahead check), so it is kept out of t_rr_node_data to make room for the layer.
      */
-    vtr::vector<RRNodeId, short> node_layer_;
+    vtr::vector<RRNodeId, int16_t> node_rc_index_;
 
     /**
      * @brief Stores the assigned names for the RRNode IDs.
@@ -867,9 +946,9 @@ class t_rr_graph_storage {
     vtr::vector<RRNodeId, short> node_ptc_twist_incr_;
 
     /** @brief Edge storage */
-    vtr::vector<RREdgeId, RRNodeId> edge_src_node_;
-    vtr::vector<RREdgeId, RRNodeId> edge_dest_node_;
-    vtr::vector<RREdgeId, short> edge_switch_;
+    vtr::vector<RREdgeId, RRNodeId, vtr::large_array_allocator<RRNodeId>> edge_src_node_;
+    vtr::vector<RREdgeId, RRNodeId, vtr::large_array_allocator<RRNodeId>> edge_dest_node_;
+    vtr::vector<RREdgeId, short, vtr::large_array_allocator<short>> edge_switch_;
 
     /** @brief
      * The delay of certain switches specified in the architecture file depends on the number of inputs of the edge's sink node (pins or tracks).
@@ -916,6 +995,10 @@ class t_rr_graph_storage {
 
     /** @brief Set after partition_edges has been called. */
     bool partitioned_;
+
+    /** @brief Set by compact_edge_src_nodes(): edge_src_node_ is empty and edge
+     * sources are found from node_first_edge_ instead. */
+    bool edge_src_nodes_compacted_;
 };
 
 /**
@@ -937,7 +1020,7 @@ class t_rr_graph_view {
         const vtr::array_view_id<RRNodeId, const t_rr_node_ptc_data> node_ptc,
         const vtr::array_view_id<RRNodeId, const RREdgeId> node_first_edge,
         const vtr::array_view_id<RRNodeId, const t_edge_size> node_fan_in,
-        const vtr::array_view_id<RRNodeId, const short> node_layer,
+        const vtr::array_view_id<RRNodeId, const int16_t> node_rc_index,
         const std::unordered_map<RRNodeId, std::string>& node_name,
         const vtr::array_view_id<RRNodeId, const short> node_ptc_twist_incr,
         const vtr::array_view_id<RREdgeId, const RRNodeId> edge_src_node,
@@ -948,7 +1031,7 @@ class t_rr_graph_view {
         , node_ptc_(node_ptc)
         , node_first_edge_(node_first_edge)
         , node_fan_in_(node_fan_in)
-        , node_layer_(node_layer)
+        , node_rc_index_(node_rc_index)
         , node_name_(node_name)
         , node_ptc_twist_incr_(node_ptc_twist_incr)
         , edge_src_node_(edge_src_node)
@@ -970,7 +1053,7 @@ class t_rr_graph_view {
     const char* node_type_string(RRNodeId id) const;
 
     int16_t node_rc_index(RRNodeId id) const {
-        return node_storage_[id].rc_index_;
+        return node_rc_index_[id];
     }
 
     short node_xlow(RRNodeId id) const {
@@ -1020,7 +1103,7 @@ class t_rr_graph_view {
      * @return The layer number (die) where the RRNodeId is located.
      */
     short node_layer(RRNodeId id) const{
-        return node_layer_[id];
+        return node_storage_[id].layer_;
     }
 
     /**
@@ -1166,7 +1249,7 @@ class t_rr_graph_view {
     vtr::array_view_id<RRNodeId, const t_rr_node_ptc_data> node_ptc_;
     vtr::array_view_id<RRNodeId, const RREdgeId> node_first_edge_;
     vtr::array_view_id<RRNodeId, const t_edge_size> node_fan_in_;
-    vtr::array_view_id<RRNodeId, const short> node_layer_;
+    vtr::array_view_id<RRNodeId, const int16_t> node_rc_index_;
     const std::unordered_map<RRNodeId, std::string>& node_name_;
     vtr::array_view_id<RRNodeId, const short> node_ptc_twist_incr_;
     vtr::array_view_id<RREdgeId, const RRNodeId> edge_src_node_;
@@ -138,4 +138,50 @@ bool inter_layer_connections_limited_to_opin(const RRGraphView& rr_graph) {
     }
 
     return limited_to_opin;
-}
\ No newline at end of file
+}
+
+void find_wire_to_ipin_switches(const RRGraphView& rr_graph,
+                                size_t num_rr_switches,
+                                int* wire_to_ipin_switch,
+                                int* wire_to_ipin_switch_between_dice) {
+    //switch for same layer Track to IPIN connection
+    //first is index, second is count
+    std::vector<int> count_for_wire_to_ipin_switches(num_rr_switches, 0);
+    std::pair<int, int> most_frequent_switch(-1, 0);
+    //switch for different layer Track to IPIN connection
+    std::vector<int> count_for_wire_to_ipin_switches_between_dice(num_rr_switches, 0);
+    std::pair<int, int> most_frequent_switch_between_dice(-1, 0);
+
+    for (const RRNodeId& source_node : rr_graph.nodes()) {
+        t_rr_type source_type = rr_graph.node_type(source_node);
+        if (source_type != CHANX && source_type != CHANY) {
+            continue;
+        }
+        for (t_edge_size iconn = 0; iconn < rr_graph.num_edges(source_node); ++iconn) {
+            RRNodeId sink_node = rr_graph.edge_sink_node(source_node, iconn);
+            if (rr_graph.node_type(sink_node) != IPIN) {
+                continue;
+            }
+            size_t switch_id = rr_graph.edge_switch(source_node, iconn);
+
+            /*Keeps track of the number of the specific type of switch that connects a wire to an ipin
+             * use the pair data structure to keep the maximum*/
+            if (rr_graph.node_layer(sink_node) == rr_graph.node_layer(source_node)) {
+                count_for_wire_to_ipin_switches[switch_id]++;
+                if (count_for_wire_to_ipin_switches[switch_id] > most_frequent_switch.second) {
+                    most_frequent_switch.first = switch_id;
+                    most_frequent_switch.second = count_for_wire_to_ipin_switches[switch_id];
+                }
+            } else {
+                count_for_wire_to_ipin_switches_between_dice[switch_id]++;
+                if (count_for_wire_to_ipin_switches_between_dice[switch_id] > most_frequent_switch_between_dice.second) {
+                    most_frequent_switch_between_dice.first = switch_id;
+                    most_frequent_switch_between_dice.second = count_for_wire_to_ipin_switches_between_dice[switch_id];
+                }
+            }
+        }
+    }
+
+    *wire_to_ipin_switch = most_frequent_switch.first;
+    *wire_to_ipin_switch_between_dice = most_frequent_switch_between_dice.first;
+}
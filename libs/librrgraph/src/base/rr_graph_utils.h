@@ -56,4 +56,18 @@ int seg_index_of_sblock(const RRGraphView& rr_graph, int from_node, int to_node)
  * @return
  */
 bool inter_layer_connections_limited_to_opin(const RRGraphView& rr_graph);
+
+/**
+ * @brief Find the most used switch of the wire to IPIN edges. There should be only one such switch,
+ * but if there are more, the most frequent one is returned. Edges within a die and edges between
+ * dice are counted separately. A switch index is -1 if there are no edges of that kind.
+ * @param rr_graph
+ * @param num_rr_switches Number of RR switches the edges may use
+ * @param wire_to_ipin_switch Set to the most used switch between a wire and an IPIN on the same die
+ * @param wire_to_ipin_switch_between_dice Set to the most used switch between a wire and an IPIN on another die
+ */
+void find_wire_to_ipin_switches(const RRGraphView& rr_graph,
+                                size_t num_rr_switches,
+                                int* wire_to_ipin_switch,
+                                int* wire_to_ipin_switch_between_dice);
 #endif
\ No newline at end of file
@@ -23,6 +23,21 @@ void add_rr_node_metadata(MetadataStorage<int>& rr_node_metadata, int src_node,
 }
 
 const t_metadata_value* rr_edge_metadata(const RRGraphBuilder& rr_graph_builder, int src_node, int sink_id, short switch_id, vtr::interned_string key) {
+    const RREdgeMetadataIndex& index = rr_graph_builder.rr_edge_metadata_index();
+    const t_rr_graph_storage& node_storage = rr_graph_builder.rr_nodes();
+    if (size_t(src_node) < node_storage.size()) {
+        for (RREdgeId edge : node_storage.edge_range(RRNodeId(src_node))) {
+            if (node_storage.edge_sink_node(edge) == RRNodeId(sink_id) && node_storage.edge_switch(edge) == switch_id) {
+                return index.one(edge, key);
+            }
+        }
+    }
+
+    // Only metadata which matches no edge of the graph is left out of the index
+    if (!index.orphaned()) {
+        return nullptr;
+    }
+
     auto rr_edge = std::make_tuple(src_node, sink_id, switch_id);
 
     auto iter = rr_graph_builder.find_rr_edge_metadata(rr_edge);
@@ -56,6 +56,7 @@ enum e_rr_node_reorder_algorithm {
     DONT_REORDER,
     DEGREE_BFS,
     RANDOM_SHUFFLE,
+    HILBERT_CURVE,
 };
 
 ///@brief Type used to express rr_node edge index.
@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <limits>
+
 #include "vtr_assert.h"
+#include "vtr_memory_usage.h"
 #include "rr_spatial_lookup.h"
 
 RRSpatialLookup::RRSpatialLookup() {
@@ -47,6 +51,14 @@ RRNodeId RRSpatialLookup::find_node(int layer,
 
     VTR_ASSERT_SAFE(4 == rr_node_indices_[type].ndims());
 
+    if (frozen_) {
+        auto nodes = frozen_nodes(layer, node_x, node_y, type, node_side);
+        if (ptc >= nodes.second - nodes.first) {
+            return RRNodeId::INVALID();
+        }
+        return RRNodeId(nodes.first[ptc]);
+    }
+
     /* Sanity check to ensure the layer, x, y, side and ptc are in range
      * - Return an valid id by searching in look-up when all the parameters are in range
      * - Return an invalid id if any out-of-range is detected
@@ -107,6 +119,17 @@ std::vector<RRNodeId> RRSpatialLookup::find_nodes(int layer,
 
     VTR_ASSERT_SAFE(4 == rr_node_indices_[type].ndims());
 
+    if (frozen_) {
+        auto frozen = frozen_nodes(layer, node_x, node_y, type, side);
+        nodes.reserve(std::count_if(frozen.first, frozen.second, [](int node) { return RRNodeId(node).is_valid(); }));
+        for (const int* node = frozen.first; node != frozen.second; ++node) {
+            if (RRNodeId(*node)) {
+                nodes.push_back(RRNodeId(*node));
+            }
+        }
+        return nodes;
+    }
+
     /* Sanity check to ensure the x, y, side are in range 
      * - Return a list of valid ids by searching in look-up when all the parameters are in range
      * - Return an empty list if any out-of-range is detected
@@ -149,6 +172,27 @@ std::vector<RRNodeId> RRSpatialLookup::find_nodes(int layer,
     return nodes;
 }
 
+std::pair<const int*, const int*> RRSpatialLookup::frozen_nodes(size_t layer,
+                                                                size_t x,
+                                                                size_t y,
+                                                                t_rr_type type,
+                                                                e_side side) const {
+    VTR_ASSERT_SAFE(frozen_);
+
+    if (size_t(type) >= frozen_dims_.size()) {
+        return {nullptr, nullptr};
+    }
+
+    const auto& dims = frozen_dims_[type];
+    if (layer >= dims[0] || x >= dims[1] || y >= dims[2] || size_t(side) >= dims[3]) {
+        return {nullptr, nullptr};
+    }
+
+    size_t index = ((layer * dims[1] + x) * dims[2] + y) * dims[3] + side;
+    const int* node_ids = frozen_node_ids_.data();
+    return {node_ids + frozen_offsets_[type][index], node_ids + frozen_offsets_[type][index + 1]};
+}
+
 std::vector<RRNodeId> RRSpatialLookup::find_channel_nodes(int layer,
                                                           int x,
                                                           int y,
@@ -220,6 +264,9 @@ void RRSpatialLookup::reserve_nodes(int layer,
                                     t_rr_type type,
                                     int num_nodes,
                                     e_side side) {
+    if (frozen_) {
+        thaw();
+    }
     VTR_ASSERT_SAFE(4 == rr_node_indices_[type].ndims());
 
     /* For non-IPIN/OPIN nodes, the side should always be the TOP side which follows the convention in find_node() API! */
@@ -240,6 +287,9 @@ void RRSpatialLookup::add_node(RRNodeId node,
                                int ptc,
                                e_side side) {
     VTR_ASSERT(node); /* Must have a valid node id to be added */
+    if (frozen_) {
+        thaw();
+    }
     VTR_ASSERT_SAFE(4 == rr_node_indices_[type].ndims());
 
     /* For non-IPIN/OPIN nodes, the side should always be the TOP side which follows the convention in find_node() API! */
@@ -264,6 +314,9 @@ void RRSpatialLookup::mirror_nodes(const int layer,
                                    t_rr_type type,
                                    e_side side) {
     VTR_ASSERT(SOURCE == type || SINK == type);
+    if (frozen_) {
+        thaw();
+    }
     resize_nodes(layer, des_coord.x(), des_coord.y(), type, side);
     rr_node_indices_[type][layer][des_coord.x()][des_coord.y()][side] = rr_node_indices_[type][layer][src_coord.x()][src_coord.y()][side];
 }
@@ -277,6 +330,9 @@ void RRSpatialLookup::resize_nodes(int layer,
      * This may seldom happen because the rr_graph building function
      * should ensure the fast look-up well organized  
      */
+    if (frozen_) {
+        thaw();
+    }
     VTR_ASSERT(type < rr_node_indices_.size());
     VTR_ASSERT(x >= 0);
     VTR_ASSERT(y >= 0);
@@ -294,6 +350,15 @@ void RRSpatialLookup::resize_nodes(int layer,
 }
 
 void RRSpatialLookup::reorder(const vtr::vector<RRNodeId, RRNodeId> dest_order) {
+    if (frozen_) {
+        for (int& node : frozen_node_ids_) {
+            if (node != OPEN) {
+                node = size_t(dest_order[RRNodeId(node)]);
+            }
+        }
+        return;
+    }
+
     // update rr_node_indices, a map to optimize rr_index lookups
     for (auto& grid : rr_node_indices_) {
         for(size_t l = 0; l < grid.dim_size(0); l++) {
@@ -312,8 +377,113 @@ void RRSpatialLookup::reorder(const vtr::vector<RRNodeId, RRNodeId> dest_order)
     }
 }
 
+void RRSpatialLookup::freeze() {
+    if (frozen_) {
+        return;
+    }
+
+    size_t num_node_ids = 0;
+    for (const auto& data : rr_node_indices_) {
+        for (size_t i = 0; i < data.size(); ++i) {
+            num_node_ids += data.get(i).size();
+        }
+    }
+    VTR_ASSERT(num_node_ids <= std::numeric_limits<uint32_t>::max());
+
+    std::vector<int>().swap(frozen_node_ids_);
+    frozen_node_ids_.reserve(num_node_ids);
+
+    for (size_t type = 0; type < rr_node_indices_.size(); ++type) {
+        auto& data = rr_node_indices_[type];
+        auto& dims = frozen_dims_[type];
+        auto& offsets = frozen_offsets_[type];
+
+        for (size_t dim = 0; dim < dims.size(); ++dim) {
+            dims[dim] = data.empty() ? 0 : data.dim_size(dim);
+        }
+
+        offsets.clear();
+        offsets.reserve(dims[0] * dims[1] * dims[2] * dims[3] + 1);
+        for (size_t l = 0; l < dims[0]; l++) {
+            for (size_t x = 0; x < dims[1]; x++) {
+                for (size_t y = 0; y < dims[2]; y++) {
+                    for (size_t s = 0; s < dims[3]; s++) {
+                        offsets.push_back(frozen_node_ids_.size());
+                        const auto& nodes = data[l][x][y][s];
+                        frozen_node_ids_.insert(frozen_node_ids_.end(), nodes.begin(), nodes.end());
+                    }
+                }
+            }
+        }
+        offsets.push_back(frozen_node_ids_.size());
+
+        data.clear();
+    }
+
+    frozen_ = true;
+}
+
+void RRSpatialLookup::thaw() {
+    VTR_ASSERT(frozen_);
+
+    for (size_t type = 0; type < rr_node_indices_.size(); ++type) {
+        const auto& dims = frozen_dims_[type];
+        if (dims[0] * dims[1] * dims[2] * dims[3] == 0) {
+            continue;
+        }
+
+        auto& data = rr_node_indices_[type];
+        data.resize({dims[0], dims[1], dims[2], dims[3]});
+        for (size_t l = 0; l < dims[0]; l++) {
+            for (size_t x = 0; x < dims[1]; x++) {
+                for (size_t y = 0; y < dims[2]; y++) {
+                    for (size_t s = 0; s < dims[3]; s++) {
+                        auto nodes = frozen_nodes(l, x, y, t_rr_type(type), e_side(s));
+                        data[l][x][y][s].assign(nodes.first, nodes.second);
+                    }
+                }
+            }
+        }
+    }
+
+    for (auto& offsets : frozen_offsets_) {
+        std::vector<uint32_t>().swap(offsets);
+    }
+    std::vector<int>().swap(frozen_node_ids_);
+    frozen_ = false;
+}
+
 void RRSpatialLookup::clear() {
     for (auto& data : rr_node_indices_) {
         data.clear();
     }
+
+    for (auto& offsets : frozen_offsets_) {
+        std::vector<uint32_t>().swap(offsets);
+    }
+    std::vector<int>().swap(frozen_node_ids_);
+    frozen_ = false;
+}
+
+void RRSpatialLookup::reset() {
+    if (frozen_) {
+        thaw();
+    }
+    for (auto& data : rr_node_indices_) {
+        for (size_t i = 0; i < data.size(); ++i) {
+            data.get(i).clear();
+        }
+    }
+}
+
+size_t RRSpatialLookup::memory_usage() const {
+    size_t bytes = 0;
+    for (const auto& data : rr_node_indices_) {
+        bytes += vtr::memory_usage(data);
+    }
+    for (const auto& offsets : frozen_offsets_) {
+        bytes += vtr::memory_usage(offsets);
+    }
+    bytes += vtr::memory_usage(frozen_node_ids_);
+    return bytes;
 }
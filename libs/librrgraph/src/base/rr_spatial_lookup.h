@@ -14,6 +14,9 @@
  *
  *   - Update the look-up with new nodes
  *   - Find the id of a node with given information, e.g., x, y, type etc.
+ *   - Freeze the look-up once the routing resource graph is built, which
+ *     packs it into a flat (CSR-like) representation: far smaller than
+ *     the per-location vectors used while building, and as fast to query
  */
 #include "vtr_geometry.h"
 #include "vtr_vector.h"
@@ -224,9 +227,32 @@ class RRSpatialLookup {
     /** @brief Reorder the internal look up to be more memory efficient */
     void reorder(const vtr::vector<RRNodeId, RRNodeId> dest_order);
 
+    /**
+     * @brief Pack the look-up into its flat representation, and free the per-location vectors
+     *
+     * This is intended to be called once the routing resource graph is built. The look-up can
+     * still be modified afterwards (e.g. when adding the intra-cluster resources for flat
+     * routing), but the first modification unpacks it again, so it should be frozen again
+     * when done.
+     */
+    void freeze();
+
+    /** @brief Return true if the look-up is in its flat (frozen) representation */
+    bool frozen() const { return frozen_; }
+
     /** @brief Clear all the data inside */
     void clear();
 
+    /**
+     * @brief Remove all the nodes, but keep the allocated structure (the dimensions of the look-up
+     * and the capacity of each location), so that rebuilding the graph of the same device
+     * (e.g. at another channel width) does not re-allocate it
+     */
+    void reset();
+
+    /** @brief Return the (estimated) number of bytes held by the look-up */
+    size_t memory_usage() const;
+
     /* -- Internal data queries -- */
   private:
     /* An internal API to find all the nodes in a specific location with a given type
@@ -240,10 +266,29 @@ class RRSpatialLookup {
                                      t_rr_type type,
                                      e_side side = SIDES[0]) const;
 
+    /* Returns the range of (possibly invalid) node ids of the frozen look-up at a location,   *
+     * or an empty range (begin == end) if the location is out of range                        */
+    std::pair<const int*, const int*> frozen_nodes(size_t layer,
+                                                   size_t x,
+                                                   size_t y,
+                                                   t_rr_type type,
+                                                   e_side side) const;
+
+    /* Unpack the frozen look-up back into the per-location vectors, so it can be modified */
+    void thaw();
+
     /* -- Internal data storage -- */
   private:
     /* Fast look-up: TODO: Should rework the data type. Currently it is based on a 3-dimensional array mater where some dimensions must always be accessed with a specific index. Such limitation should be overcome */
     t_rr_node_indices rr_node_indices_;
+
+    /* Frozen look-up: the node ids of each type stored contiguously, location by location  *
+     * (in the row-major order of the (layer, x, y, side) dimensions). The ids at location i  *
+     * of a type are frozen_node_ids_[frozen_offsets_[type][i]..frozen_offsets_[type][i+1]-1] */
+    bool frozen_ = false;
+    std::array<std::array<size_t, 4>, NUM_RR_TYPES> frozen_dims_ = {};
+    std::array<std::vector<uint32_t>, NUM_RR_TYPES> frozen_offsets_;
+    std::vector<int> frozen_node_ids_;
 };
 
 #endif
@@ -0,0 +1,106 @@
+#ifdef VTR_ENABLE_ZLIB
+
+#    include "gzip_output_buffer.h"
+
+GzipOutputBuffer::GzipOutputBuffer(const char* file_name, size_t buffer_size)
+    : file_(gzopen(file_name, "wb"))
+    , fill_buffer_(buffer_size)
+    , compress_buffer_(buffer_size) {
+    setp(fill_buffer_.data(), fill_buffer_.data() + fill_buffer_.size());
+    if (file_ != nullptr) {
+        gzbuffer(file_, 1 << 17);
+        worker_ = std::thread(&GzipOutputBuffer::compress_loop, this);
+    }
+}
+
+GzipOutputBuffer::~GzipOutputBuffer() {
+    close();
+}
+
+bool GzipOutputBuffer::close() {
+    if (file_ == nullptr) {
+        return false;
+    }
+
+    hand_off_buffer();
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wait_for_worker(lock);
+        done_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+
+    if (gzclose(file_) != Z_OK) {
+        error_ = true;
+    }
+    file_ = nullptr;
+    return !error_;
+}
+
+GzipOutputBuffer::int_type GzipOutputBuffer::overflow(int_type ch) {
+    if (file_ == nullptr) {
+        return traits_type::eof();
+    }
+
+    hand_off_buffer();
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+int GzipOutputBuffer::sync() {
+    if (file_ == nullptr) {
+        return -1;
+    }
+
+    hand_off_buffer();
+    std::unique_lock<std::mutex> lock(mutex_);
+    wait_for_worker(lock);
+    return error_ ? -1 : 0;
+}
+
+void GzipOutputBuffer::hand_off_buffer() {
+    size_t size = pptr() - pbase();
+    if (size == 0) {
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wait_for_worker(lock);
+        std::swap(fill_buffer_, compress_buffer_);
+        compress_size_ = size;
+        has_work_ = true;
+    }
+    cv_.notify_all();
+
+    setp(fill_buffer_.data(), fill_buffer_.data() + fill_buffer_.size());
+}
+
+void GzipOutputBuffer::wait_for_worker(std::unique_lock<std::mutex>& lock) {
+    cv_.wait(lock, [this] { return !has_work_; });
+}
+
+void GzipOutputBuffer::compress_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this] { return has_work_ || done_; });
+        if (!has_work_) {
+            break;
+        }
+
+        // The writer never touches compress_buffer_ while has_work_ is set
+        lock.unlock();
+        bool ok = gzwrite(file_, compress_buffer_.data(), compress_size_) == int(compress_size_);
+        lock.lock();
+
+        error_ = error_ || !ok;
+        has_work_ = false;
+        cv_.notify_all();
+    }
+}
+
+#endif /* VTR_ENABLE_ZLIB */
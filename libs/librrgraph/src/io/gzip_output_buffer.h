@@ -0,0 +1,64 @@
+#ifndef GZIP_OUTPUT_BUFFER_H
+#define GZIP_OUTPUT_BUFFER_H
+
+#ifdef VTR_ENABLE_ZLIB
+
+#    include <condition_variable>
+#    include <mutex>
+#    include <streambuf>
+#    include <thread>
+#    include <vector>
+
+#    include <zlib.h>
+
+/**
+ * @brief A std::streambuf which gzip compresses everything written to it into a file.
+ *
+ * Compression runs on a worker thread: while the worker deflates one filled buffer,
+ * the writer keeps formatting into the other, so writing a large XML file costs little
+ * more than writing it uncompressed.
+ */
+class GzipOutputBuffer : public std::streambuf {
+  public:
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 4 << 20;
+
+    explicit GzipOutputBuffer(const char* file_name, size_t buffer_size = DEFAULT_BUFFER_SIZE);
+    ~GzipOutputBuffer() override;
+
+    GzipOutputBuffer(const GzipOutputBuffer&) = delete;
+    GzipOutputBuffer& operator=(const GzipOutputBuffer&) = delete;
+
+    /** Was the file opened successfully? */
+    bool is_open() const { return file_ != nullptr; }
+
+    /** Flush everything written so far and close the file. Returns false if any write failed */
+    bool close();
+
+  protected:
+    int_type overflow(int_type ch) override;
+    int sync() override;
+
+  private:
+    /** Pass the filled part of the fill buffer to the worker, waiting for it to finish the previous one */
+    void hand_off_buffer();
+    /** Wait until the worker has compressed everything handed to it */
+    void wait_for_worker(std::unique_lock<std::mutex>& lock);
+    void compress_loop();
+
+    gzFile file_;
+
+    std::vector<char> fill_buffer_;     // Formatted into by the writer
+    std::vector<char> compress_buffer_; // Compressed by the worker while has_work_ is set
+    size_t compress_size_ = 0;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool has_work_ = false;
+    bool done_ = false;
+    bool error_ = false;
+    std::thread worker_;
+};
+
+#endif /* VTR_ENABLE_ZLIB */
+
+#endif /* GZIP_OUTPUT_BUFFER_H */
@@ -0,0 +1,308 @@
+#include "rr_graph_native.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+#include "alloc_and_load_rr_indexed_data.h"
+#include "check_rr_graph.h"
+#include "get_parallel_segs.h"
+#include "rr_graph_utils.h"
+#include "vpr_error.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Identifies a native rr graph file. Bump the version whenever the layout written below changes */
+static constexpr char NATIVE_RR_GRAPH_MAGIC[8] = {'V', 'P', 'R', 'R', 'R', 'G', 'N', '\0'};
+static constexpr uint32_t NATIVE_RR_GRAPH_VERSION = 2;
+
+struct t_native_rr_graph_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_layers;
+    uint64_t grid_width;
+    uint64_t grid_height;
+    uint64_t num_segments;
+};
+
+template<typename T>
+static void write_pod(std::ostream& out, const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written directly");
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+static bool read_pod(std::istream& in, T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read directly");
+    return bool(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+static void write_int_vector(std::ostream& out, const std::vector<int>& vec) {
+    write_pod<uint64_t>(out, vec.size());
+    out.write(reinterpret_cast<const char*>(vec.data()), sizeof(int) * vec.size());
+}
+
+static bool read_int_vector(std::istream& in, std::vector<int>& vec) {
+    uint64_t size = 0;
+    if (!read_pod(in, size)) {
+        return false;
+    }
+    vec.resize(size);
+    return bool(in.read(reinterpret_cast<char*>(vec.data()), sizeof(int) * size));
+}
+
+static void write_string(std::ostream& out, const std::string& str) {
+    write_pod<uint64_t>(out, str.size());
+    out.write(str.data(), str.size());
+}
+
+static bool read_string(std::istream& in, std::string& str) {
+    uint64_t size = 0;
+    if (!read_pod(in, size)) {
+        return false;
+    }
+    str.resize(size);
+    return bool(in.read(&str[0], size));
+}
+
+static void write_switch(std::ostream& out, const t_rr_switch_inf& sw) {
+    write_pod(out, sw.R);
+    write_pod(out, sw.Cin);
+    write_pod(out, sw.Cout);
+    write_pod(out, sw.Cinternal);
+    write_pod(out, sw.Tdel);
+    write_pod(out, sw.mux_trans_size);
+    write_pod(out, sw.buf_size);
+    write_string(out, sw.name);
+    write_pod<int32_t>(out, sw.power_buffer_type);
+    write_pod(out, sw.power_buffer_size);
+    write_pod<uint8_t>(out, sw.intra_tile);
+    write_pod<int32_t>(out, int32_t(sw.type()));
+}
+
+static bool read_switch(std::istream& in, t_rr_switch_inf& sw) {
+    int32_t power_buffer_type = 0;
+    uint8_t intra_tile = 0;
+    int32_t type = 0;
+    bool ok = read_pod(in, sw.R)
+              && read_pod(in, sw.Cin)
+              && read_pod(in, sw.Cout)
+              && read_pod(in, sw.Cinternal)
+              && read_pod(in, sw.Tdel)
+              && read_pod(in, sw.mux_trans_size)
+              && read_pod(in, sw.buf_size)
+              && read_string(in, sw.name)
+              && read_pod(in, power_buffer_type)
+              && read_pod(in, sw.power_buffer_size)
+              && read_pod(in, intra_tile)
+              && read_pod(in, type);
+    if (ok) {
+        sw.power_buffer_type = e_power_buffer_type(power_buffer_type);
+        sw.intra_tile = intra_tile;
+        sw.set_type(SwitchType(type));
+    }
+    return ok;
+}
+
+void write_rr_graph_native(RRGraphBuilder* rr_graph_builder,
+                           const RRGraphView& rr_graph,
+                           const vtr::vector<RRIndexedDataId, t_rr_indexed_data>& rr_indexed_data,
+                           const std::vector<t_rr_rc_data>& rr_rc_data,
+                           const DeviceGrid& grid,
+                           const t_chan_width& chan_width,
+                           const char* file_name) {
+    vtr::ScopedStartFinishTimer timer("Writing native routing resource graph");
+
+    if (rr_graph_builder->rr_node_metadata().size() > 0 || rr_graph_builder->rr_edge_metadata().size() > 0) {
+        VTR_LOG_WARN("RR node/edge metadata is not written to native RR graph file '%s'\n", file_name);
+    }
+
+    std::ofstream out(file_name, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Failed to open '%s' for writing", file_name);
+    }
+
+    t_native_rr_graph_header header;
+    std::memcpy(header.magic, NATIVE_RR_GRAPH_MAGIC, sizeof(header.magic));
+    header.version = NATIVE_RR_GRAPH_VERSION;
+    header.num_layers = grid.get_num_layers();
+    header.grid_width = grid.width();
+    header.grid_height = grid.height();
+    header.num_segments = rr_graph.num_rr_segments();
+    write_pod(out, header);
+
+    write_pod<int32_t>(out, chan_width.max);
+    write_pod<int32_t>(out, chan_width.x_max);
+    write_pod<int32_t>(out, chan_width.y_max);
+    write_pod<int32_t>(out, chan_width.x_min);
+    write_pod<int32_t>(out, chan_width.y_min);
+    write_int_vector(out, chan_width.x_list);
+    write_int_vector(out, chan_width.y_list);
+
+    write_pod<uint64_t>(out, rr_graph.num_rr_switches());
+    for (const t_rr_switch_inf& sw : rr_graph.rr_switch()) {
+        write_switch(out, sw);
+    }
+
+    write_pod<uint64_t>(out, rr_rc_data.size());
+    for (const t_rr_rc_data& rc : rr_rc_data) {
+        write_pod(out, rc.R);
+        write_pod(out, rc.C);
+    }
+
+    std::vector<int> seg_index;
+    for (const t_rr_indexed_data& indexed_data : rr_indexed_data) {
+        seg_index.push_back(indexed_data.seg_index);
+    }
+    write_int_vector(out, seg_index);
+
+    rr_graph.rr_nodes().write_native_image(out);
+
+    if (!out) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Failed to write native RR graph file '%s'", file_name);
+    }
+}
+
+void load_rr_graph_native(RRGraphBuilder* rr_graph_builder,
+                          RRGraphView* rr_graph,
+                          const std::vector<t_physical_tile_type>& physical_tile_types,
+                          vtr::vector<RRIndexedDataId, t_rr_indexed_data>* rr_indexed_data,
+                          std::vector<t_rr_rc_data>* rr_rc_data,
+                          const DeviceGrid& grid,
+                          const t_graph_type graph_type,
+                          t_chan_width* chan_width,
+                          const enum e_base_cost_type base_cost_type,
+                          int* wire_to_rr_ipin_switch,
+                          int* wire_to_rr_ipin_switch_between_dice,
+                          const char* read_rr_graph_name,
+                          std::string* read_rr_graph_filename,
+                          bool do_check_rr_graph,
+                          bool echo_enabled,
+                          const char* echo_file_name,
+                          bool is_flat) {
+    std::ifstream in(read_rr_graph_name, std::ios::binary);
+    if (!in) {
+        vpr_throw(VPR_ERROR_ROUTE, read_rr_graph_name, 0, "Failed to open native RR graph file");
+    }
+
+    t_native_rr_graph_header header;
+    if (!read_pod(in, header) || std::memcmp(header.magic, NATIVE_RR_GRAPH_MAGIC, sizeof(header.magic)) != 0) {
+        vpr_throw(VPR_ERROR_ROUTE, read_rr_graph_name, 0, "Not a native RR graph file");
+    }
+    if (header.version != NATIVE_RR_GRAPH_VERSION) {
+        vpr_throw(VPR_ERROR_ROUTE, read_rr_graph_name, 0,
+                  "Native RR graph file version %u does not match the supported version %u",
+                  header.version, NATIVE_RR_GRAPH_VERSION);
+    }
+    if (header.num_layers != size_t(grid.get_num_layers()) || header.grid_width != grid.width() || header.grid_height != grid.height()) {
+        vpr_throw(VPR_ERROR_ROUTE, read_rr_graph_name, 0,
+                  "Native RR graph was written for a %zux%zu grid with %zu layers, but the device grid is %zux%zu with %d layers",
+                  size_t(header.grid_width), size_t(header.grid_height), size_t(header.num_layers),
+                  grid.width(), grid.height(), grid.get_num_layers());
+    }
+    if (header.num_segments != rr_graph->num_rr_segments()) {
+        vpr_throw(VPR_ERROR_ROUTE, read_rr_graph_name, 0,
+                  "Native RR graph has %zu segments, but the architecture has %zu",
+                  size_t(header.num_segments), rr_graph->num_rr_segments());
+    }
+
+    int32_t chan_width_fields[5];
+    bool ok = true;
+    for (int32_t& field : chan_width_fields) {
+        ok = ok && read_pod(in, field);
+    }
+    ok = ok && read_int_vector(in, chan_width->x_list) && read_int_vector(in, chan_width->y_list);
+    chan_width->max = chan_width_fields[0];
+    chan_width->x_max = chan_width_fields[1];
+    chan_width->y_max = chan_width_fields[2];
+    chan_width->x_min = chan_width_fields[3];
+    chan_width->y_min = chan_width_fields[4];
+
+    uint64_t num_switches = 0;
+    ok = ok && read_pod(in, num_switches);
+    auto& rr_switch_inf = rr_graph_builder->rr_switch();
+    rr_switch_inf.clear();
+    rr_switch_inf.resize(num_switches);
+    for (t_rr_switch_inf& sw : rr_switch_inf) {
+        ok = ok && read_switch(in, sw);
+    }
+
+    uint64_t num_rc_data = 0;
+    ok = ok && read_pod(in, num_rc_data);
+    rr_rc_data->clear();
+    rr_rc_data->reserve(num_rc_data);
+    for (uint64_t irc = 0; ok && irc < num_rc_data; ++irc) {
+        float R = 0.;
+        float C = 0.;
+        ok = read_pod(in, R) && read_pod(in, C);
+        rr_rc_data->emplace_back(R, C);
+    }
+
+    std::vector<int> seg_index;
+    ok = ok && read_int_vector(in, seg_index);
+
+    ok = ok && rr_graph_builder->rr_nodes().read_native_image(in);
+    if (!ok) {
+        vpr_throw(VPR_ERROR_ROUTE, read_rr_graph_name, 0,
+                  "Native RR graph file is truncated or was written by a VPR build with a different data layout");
+    }
+
+    /* Alloc and load the rr_node look up table. SINK and SOURCE, IPIN and OPIN
+     * share the same look-up table. CHANX and CHANY have individual look-ups */
+    for (t_rr_type rr_type : RR_TYPES) {
+        if (rr_type == CHANX) {
+            rr_graph_builder->node_lookup().resize_nodes(grid.get_num_layers(), grid.height(), grid.width(), rr_type, NUM_SIDES);
+        } else {
+            rr_graph_builder->node_lookup().resize_nodes(grid.get_num_layers(), grid.width(), grid.height(), rr_type, NUM_SIDES);
+        }
+    }
+    for (const RRNodeId& node : rr_graph->nodes()) {
+        rr_graph_builder->add_node_to_all_locs(node);
+    }
+
+    find_wire_to_ipin_switches(*rr_graph, rr_switch_inf.size(),
+                               wire_to_rr_ipin_switch, wire_to_rr_ipin_switch_between_dice);
+
+    std::vector<t_segment_inf> rr_segs;
+    rr_segs.reserve(rr_graph->num_rr_segments());
+    for (const t_segment_inf& rr_seg : rr_graph->rr_segments()) {
+        rr_segs.push_back(rr_seg);
+    }
+    t_unified_to_parallel_seg_index seg_index_map;
+    std::vector<t_segment_inf> segment_inf_x = get_parallel_segs(rr_segs, seg_index_map, X_AXIS);
+    std::vector<t_segment_inf> segment_inf_y = get_parallel_segs(rr_segs, seg_index_map, Y_AXIS);
+
+    alloc_and_load_rr_indexed_data(
+        *rr_graph,
+        grid,
+        rr_segs,
+        segment_inf_x,
+        segment_inf_y,
+        *rr_indexed_data,
+        *wire_to_rr_ipin_switch,
+        base_cost_type,
+        echo_enabled,
+        echo_file_name);
+
+    if (rr_indexed_data->size() != seg_index.size()) {
+        vpr_throw(VPR_ERROR_ROUTE, read_rr_graph_name, 0,
+                  "Native RR graph has %zu cost indices, but the architecture has %zu",
+                  seg_index.size(), rr_indexed_data->size());
+    }
+    for (size_t i = 0; i < seg_index.size(); ++i) {
+        (*rr_indexed_data)[RRIndexedDataId(i)].seg_index = seg_index[i];
+    }
+
+    read_rr_graph_filename->assign(read_rr_graph_name);
+
+    if (do_check_rr_graph) {
+        check_rr_graph(*rr_graph,
+                       physical_tile_types,
+                       *rr_indexed_data,
+                       grid,
+                       *chan_width,
+                       graph_type,
+                       is_flat);
+    }
+}
@@ -0,0 +1,52 @@
+/* Defines the functions used to write and load an rr graph in VPR's native binary format.
+ *
+ * A native rr graph file is a raw image of the flat arrays of t_rr_graph_storage, plus the
+ * rr switches, rc data and channel widths. Loading one is a bulk read of each array rather
+ * than a per node/edge parse, so it is much faster than the .xml or .bin (Cap'n Proto)
+ * formats, but it is only readable by a VPR build with the same data layout and it does
+ * not carry rr node/edge metadata. */
+
+#ifndef RR_GRAPH_NATIVE_H
+#define RR_GRAPH_NATIVE_H
+
+#include <string>
+#include <vector>
+
+#include "rr_graph_type.h"
+#include "rr_graph_cost.h"
+#include "rr_graph_builder.h"
+#include "rr_graph_view.h"
+#include "rr_node.h"
+#include "device_grid.h"
+#include "physical_types.h"
+
+/* File name extension of native rr graph files */
+constexpr const char* NATIVE_RR_GRAPH_EXTENSION = ".rrnative";
+
+void write_rr_graph_native(RRGraphBuilder* rr_graph_builder,
+                           const RRGraphView& rr_graph,
+                           const vtr::vector<RRIndexedDataId, t_rr_indexed_data>& rr_indexed_data,
+                           const std::vector<t_rr_rc_data>& rr_rc_data,
+                           const DeviceGrid& grid,
+                           const t_chan_width& chan_width,
+                           const char* file_name);
+
+void load_rr_graph_native(RRGraphBuilder* rr_graph_builder,
+                          RRGraphView* rr_graph,
+                          const std::vector<t_physical_tile_type>& physical_tile_types,
+                          vtr::vector<RRIndexedDataId, t_rr_indexed_data>* rr_indexed_data,
+                          std::vector<t_rr_rc_data>* rr_rc_data,
+                          const DeviceGrid& grid,
+                          const t_graph_type graph_type,
+                          t_chan_width* chan_width,
+                          const enum e_base_cost_type base_cost_type,
+                          int* wire_to_rr_ipin_switch,
+                          int* wire_to_rr_ipin_switch_between_dice,
+                          const char* read_rr_graph_name,
+                          std::string* read_rr_graph_filename,
+                          bool do_check_rr_graph,
+                          bool echo_enabled,
+                          const char* echo_file_name,
+                          bool is_flat);
+
+#endif /* RR_GRAPH_NATIVE_H */
@@ -15,6 +15,7 @@
 
 #include "rr_graph_reader.h"
 
+#include "rr_graph_native.h"
 #include "rr_graph_uxsdcxx_serializer.h"
 #include "rr_graph_uxsdcxx.h"
 
@@ -67,6 +68,30 @@ void load_rr_file(RRGraphBuilder* rr_graph_builder,
         rr_graph_builder->add_rr_segment(segment_inf[(iseg)]);
     }
 
+    if (vtr::check_file_name_extension(read_rr_graph_name, NATIVE_RR_GRAPH_EXTENSION)) {
+        if (read_edge_metadata) {
+            VTR_LOG_WARN("Native RR graph file '%s' has no edge metadata to read\n", read_rr_graph_name);
+        }
+        load_rr_graph_native(rr_graph_builder,
+                             rr_graph,
+                             physical_tile_types,
+                             rr_indexed_data,
+                             rr_rc_data,
+                             grid,
+                             graph_type,
+                             chan_width,
+                             base_cost_type,
+                             wire_to_rr_ipin_switch,
+                             wire_to_rr_ipin_switch_between_dice,
+                             read_rr_graph_name,
+                             read_rr_graph_filename,
+                             do_check_rr_graph,
+                             echo_enabled,
+                             echo_file_name,
+                             is_flat);
+        return;
+    }
+
     RrGraphSerializer reader(
         graph_type,
         base_cost_type,
@@ -111,7 +136,7 @@ void load_rr_file(RRGraphBuilder* rr_graph_builder,
     } else {
         VTR_LOG_WARN(
             "RR graph file '%s' may be in incorrect format. "
-            "Expecting .xml or .bin format\n",
-            read_rr_graph_name);
+            "Expecting .xml, .bin or %s format\n",
+            read_rr_graph_name, NATIVE_RR_GRAPH_EXTENSION);
     }
 }
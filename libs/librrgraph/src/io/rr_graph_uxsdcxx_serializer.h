@@ -21,6 +21,7 @@
 #include "device_grid.h"
 #include "alloc_and_load_rr_indexed_data.h"
 #include "get_parallel_segs.h"
+#include "rr_graph_utils.h"
 
 #include "vpr_error.h"
 #include "vtr_log.h"
@@ -241,7 +242,7 @@ struct RrGraphContextTypes : public uxsd::DefaultRrGraphContextTypes {
     using PinReadContext = const std::pair<const t_physical_tile_type*, int>;
     using PinClassReadContext = const std::pair<const t_physical_tile_type*, const t_class*>;
     using BlockTypeReadContext = const t_physical_tile_type*;
-    using GridLocReadContext = const t_grid_tile*;
+    using GridLocReadContext = t_physical_tile_loc;
     using NodeLocReadContext = const t_rr_node;
     using NodeTimingReadContext = const t_rr_node;
     using NodeSegmentReadContext = const t_rr_node;
@@ -1118,20 +1119,6 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
         return nullptr;
     }
     inline void finish_rr_graph_rr_edges(void*& /*ctx*/) final {
-        /*initialize a vector that keeps track of the number of wire to ipin switches
-         * There should be only one wire to ipin switch. In case there are more, make sure to
-         * store the most frequent switch */
-        const auto& rr_graph = (*rr_graph_);
-        std::vector<int> count_for_wire_to_ipin_switches;
-        count_for_wire_to_ipin_switches.resize(rr_switch_inf_->size(), 0);
-        //switch for same layer Track to IPIN connection
-        //first is index, second is count
-        std::pair<int, int> most_frequent_switch(-1, 0);
-        //switch for different layer Track to IPIN connection
-        std::vector<int> count_for_wire_to_ipin_switches_between_dice;
-        count_for_wire_to_ipin_switches_between_dice.resize(rr_switch_inf_->size(), 0);
-        std::pair<int,int> most_frequent_switch_between_dice(-1,0);
-
         // Partition the rr graph edges for efficient access to
         // configurable/non-configurable edge subsets. Must be done after RR
         // switches have been allocated.
@@ -1154,37 +1141,13 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
                         "switch_id %zu is larger than num_rr_switches %zu",
                         switch_id, rr_switch_inf_->size());
                 }
-                auto node = (*rr_nodes_)[source_node];
-
-                /*Keeps track of the number of the specific type of switch that connects a wire to an ipin
-                 * use the pair data structure to keep the maximum*/
-                if (rr_graph.node_type(node.id()) == CHANX || rr_graph.node_type(node.id()) == CHANY) {
-                    if(rr_graph.node_type(RRNodeId(sink_node)) == IPIN){
-                        if (rr_graph.node_layer(RRNodeId(sink_node)) == rr_graph.node_layer(RRNodeId(source_node))) {
-                            count_for_wire_to_ipin_switches[switch_id]++;
-                            if (count_for_wire_to_ipin_switches[switch_id] > most_frequent_switch.second) {
-                                most_frequent_switch.first = switch_id;
-                                most_frequent_switch.second = count_for_wire_to_ipin_switches[switch_id];
-                            }
-                        }
-                        else{
-                            VTR_ASSERT(rr_graph.node_layer(RRNodeId(sink_node)) != rr_graph.node_layer(RRNodeId(source_node)));
-                            count_for_wire_to_ipin_switches_between_dice[switch_id]++;
-                            if(count_for_wire_to_ipin_switches_between_dice[switch_id] > most_frequent_switch_between_dice.second){
-                                most_frequent_switch_between_dice.first = switch_id;
-                                most_frequent_switch_between_dice.second = count_for_wire_to_ipin_switches_between_dice[switch_id];
-                            }
-                        }
-                    }
-                }
             }
         }
 
         VTR_ASSERT(wire_to_rr_ipin_switch_ != nullptr);
-        *wire_to_rr_ipin_switch_ = most_frequent_switch.first;
-
         VTR_ASSERT(wire_to_rr_ipin_switch_between_dice_ != nullptr);
-        *wire_to_rr_ipin_switch_between_dice_ = most_frequent_switch_between_dice.first;
+        find_wire_to_ipin_switches(*rr_graph_, rr_switch_inf_->size(),
+                                   wire_to_rr_ipin_switch_, wire_to_rr_ipin_switch_between_dice_);
     }
 
     inline EdgeWalker get_rr_graph_rr_edges(void*& /*ctx*/) final {
@@ -1687,31 +1650,31 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
     inline void finish_rr_graph_grid(void*& /*ctx*/) final {
     }
 
-    inline int get_grid_loc_block_type_id(const t_grid_tile*& grid_loc) final {
-        return grid_loc->type->index;
+    inline int get_grid_loc_block_type_id(t_physical_tile_loc& grid_loc) final {
+        return grid_.get_physical_type(grid_loc)->index;
     }
-    inline int get_grid_loc_height_offset(const t_grid_tile*& grid_loc) final {
-        return grid_loc->height_offset;
+    inline int get_grid_loc_height_offset(t_physical_tile_loc& grid_loc) final {
+        return grid_.get_height_offset(grid_loc);
     }
-    inline int get_grid_loc_width_offset(const t_grid_tile*& grid_loc) final {
-        return grid_loc->width_offset;
+    inline int get_grid_loc_width_offset(t_physical_tile_loc& grid_loc) final {
+        return grid_.get_width_offset(grid_loc);
     }
-    inline int get_grid_loc_x(const t_grid_tile*& grid_loc) final {
-        return grid_.get_grid_loc_x(grid_loc);
+    inline int get_grid_loc_x(t_physical_tile_loc& grid_loc) final {
+        return grid_loc.x;
     }
-    inline int get_grid_loc_y(const t_grid_tile*& grid_loc) final {
-        return grid_.get_grid_loc_y(grid_loc);
+    inline int get_grid_loc_y(t_physical_tile_loc& grid_loc) final {
+        return grid_loc.y;
     }
 
-    inline int get_grid_loc_layer(const t_grid_tile*& grid_loc) final{
-        return grid_.get_grid_loc_layer(grid_loc);
+    inline int get_grid_loc_layer(t_physical_tile_loc& grid_loc) final{
+        return grid_loc.layer_num;
     }
 
     inline size_t num_grid_locs_grid_loc(void*& /*iter*/) final {
         return grid_.grid_size();
     }
-    inline const t_grid_tile* get_grid_locs_grid_loc(int n, void*& /*ctx*/) final {
-        return grid_.get_grid_locs_grid_loc(n);
+    inline t_physical_tile_loc get_grid_locs_grid_loc(int n, void*& /*ctx*/) final {
+        return grid_.get_grid_loc(n);
     }
 
     inline void set_grid_loc_layer(int layer_num, void*& /*ctx*/) final {
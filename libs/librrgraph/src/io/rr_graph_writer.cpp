@@ -6,10 +6,14 @@
  * details. Each tag has attributes to describe them */
 
 #include "rr_graph_writer.h"
+#include "rr_graph_native.h"
+#include "gzip_output_buffer.h"
 
 #include <cstdio>
 #include <fstream>
 #include <limits>
+#include <ostream>
+#include <vector>
 #include "rr_graph_uxsdcxx_serializer.h"
 #include "rr_graph_uxsdcxx.h"
 #ifdef VTR_ENABLE_CAPNPROTO
@@ -40,6 +44,16 @@ void write_rr_graph(RRGraphBuilder* rr_graph_builder,
                     bool echo_enabled,
                     const char* echo_file_name,
                     bool is_flat) {
+    if (vtr::check_file_name_extension(file_name, NATIVE_RR_GRAPH_EXTENSION)) {
+        write_rr_graph_native(rr_graph_builder,
+                              *rr_graph_view,
+                              *rr_indexed_data,
+                              *rr_rc_data,
+                              grid,
+                              *chan_width,
+                              file_name);
+        return;
+    }
 
     RrGraphSerializer reader(
         /*graph_type=*/t_graph_type(),
@@ -69,11 +83,35 @@ void write_rr_graph(RRGraphBuilder* rr_graph_builder,
         is_flat);
 
     if (vtr::check_file_name_extension(file_name, ".xml")) {
+        // The writer emits many small attribute strings, so give the stream a
+        // large buffer to keep the number of write calls down
+        std::vector<char> file_buffer(4 << 20);
         std::fstream fp;
+        fp.rdbuf()->pubsetbuf(file_buffer.data(), file_buffer.size());
         fp.open(file_name, std::fstream::out | std::fstream::trunc);
         fp.precision(std::numeric_limits<float>::max_digits10);
         void* context;
         uxsd::write_rr_graph_xml(reader, context, fp);
+#ifdef VTR_ENABLE_ZLIB
+    } else if (vtr::check_file_name_extension(file_name, ".gz")) {
+        // Gzip compressed XML (e.g. rr_graph.xml.gz), compressed on a worker
+        // thread while the XML is being formatted
+        GzipOutputBuffer gz_buffer(file_name);
+        if (!gz_buffer.is_open()) {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                            "Failed to open %s for writing",
+                            file_name);
+        }
+        std::ostream os(&gz_buffer);
+        os.precision(std::numeric_limits<float>::max_digits10);
+        void* context;
+        uxsd::write_rr_graph_xml(reader, context, os);
+        if (!gz_buffer.close()) {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                            "Failed to write %s",
+                            file_name);
+        }
+#endif
 #ifdef VTR_ENABLE_CAPNPROTO
     } else if (vtr::check_file_name_extension(file_name, ".bin")) {
         ::capnp::MallocMessageBuilder builder;
@@ -7,6 +7,8 @@
  */
 
 #include <string>
+#include <vector>
+#include <cstdint>
 
 #include "internal_bits.hpp"
 #include "rtl_int.hpp"
@@ -161,6 +163,186 @@ static VNumber sum_op(VNumber& a, VNumber& b, const bit_value_t& initial_carry,
     return result;
 }
 
+/**
+ * Word packed numbers, for the arithmetic which repeats many additions, shifts and
+ * comparisons on wide fully known numbers (multiplication, division and modulo).
+ * Each operation gives the same size, sign and bits as its bit by bit VNumber counterpart,
+ * but works 64 bits at a time. Numbers with x or z bits are never converted.
+ */
+class limb_number {
+  private:
+    static constexpr size_t LIMB_BITS = 64;
+
+    std::vector<uint64_t> limbs; // lsb first, the bits past the size are 0
+    size_t bit_size = 0;
+    bool sign = false;
+    bool defined_size = false;
+
+    static size_t limb_count(size_t bits) {
+        return (bits + LIMB_BITS - 1) / LIMB_BITS;
+    }
+
+    limb_number(size_t len, bool input_sign, bool this_defined_size)
+        : limbs(limb_count(len), 0)
+        , bit_size(len)
+        , sign(input_sign)
+        , defined_size(this_defined_size) {}
+
+    bool get_bit(size_t index) const {
+        return (limbs[index / LIMB_BITS] >> (index % LIMB_BITS)) & 1;
+    }
+
+    void clear_unused_bits() {
+        size_t used = bit_size % LIMB_BITS;
+        if (used)
+            limbs.back() &= (uint64_t(1) << used) - 1;
+    }
+
+    /* limb i of the number extended with its padding bit */
+    uint64_t get_limb(size_t i) const {
+        uint64_t pad = is_negative() ? ~uint64_t(0) : 0;
+        if (i >= limbs.size())
+            return pad;
+
+        size_t used = bit_size % LIMB_BITS;
+        if (used && i == limbs.size() - 1)
+            return limbs[i] | (pad << used);
+
+        return limbs[i];
+    }
+
+  public:
+    limb_number(VNumber& a)
+        : limb_number(a.size(), a.is_signed(), a.is_defined_size()) {
+        for (size_t i = 0; i < bit_size; i++)
+            if (a.get_bit_from_lsb(i) == _1)
+                limbs[i / LIMB_BITS] |= uint64_t(1) << (i % LIMB_BITS);
+    }
+
+    VNumber to_vnumber() const {
+        VNumber result(bit_size, _0, sign, defined_size);
+        for (size_t i = 0; i < bit_size; i++)
+            if (get_bit(i))
+                result.set_bit_from_lsb(i, _1);
+        return result;
+    }
+
+    size_t size() const {
+        return bit_size;
+    }
+
+    bool is_signed() const {
+        return sign;
+    }
+
+    bool is_negative() const {
+        return sign && get_bit(bit_size - 1);
+    }
+
+    /* same as VNumber(a, length) */
+    limb_number resize(size_t length) const {
+        limb_number result(length, sign, defined_size);
+        for (size_t i = 0; i < result.limbs.size(); i++)
+            result.limbs[i] = get_limb(i);
+        result.clear_unused_bits();
+        return result;
+    }
+
+    /* same as VNumber::twos_complement() */
+    limb_number twos_complement() const {
+        limb_number result(bit_size, sign, defined_size);
+        uint64_t carry = 1;
+        for (size_t i = 0; i < limbs.size(); i++) {
+            result.limbs[i] = ~limbs[i] + carry;
+            carry = (carry && result.limbs[i] == 0) ? 1 : 0;
+        }
+        result.clear_unused_bits();
+        return result;
+    }
+
+    /* same as sum_op(a, b, _0, is_twos_complement_subtraction) */
+    static limb_number sum(const limb_number& a, const limb_number& b, bool is_twos_complement_subtraction) {
+        size_t std_length = std::max(a.size(), b.size());
+        size_t new_length = (is_twos_complement_subtraction) ? (std_length) : (std_length + 1);
+
+        limb_number result(new_length, a.is_signed() && b.is_signed(), a.defined_size && b.defined_size);
+        uint64_t carry = 0;
+        for (size_t i = 0; i < result.limbs.size(); i++) {
+            uint64_t limb_a = a.get_limb(i);
+            uint64_t partial = limb_a + b.get_limb(i);
+            uint64_t total = partial + carry;
+            carry = (partial < limb_a || total < partial) ? 1 : 0;
+            result.limbs[i] = total;
+        }
+        result.clear_unused_bits();
+        return result;
+    }
+
+    /* same as V_MINUS(a, b) */
+    static limb_number minus(const limb_number& a, const limb_number& b) {
+        size_t std_length = std::max(a.size(), b.size());
+        limb_number padded_a = a.resize(std_length);
+        limb_number padded_b = b.resize(std_length);
+
+        limb_number complement = padded_b.twos_complement();
+        if (padded_b.is_negative() && complement.is_negative()) {
+            /* special case: 2's comp is identical to original, must pad */
+            complement = padded_b.resize(padded_b.size() + 1).twos_complement();
+        }
+
+        return sum(padded_a, complement, /* is_twos_complement_subtraction */ true);
+    }
+
+    /* same as shift_op(a, 1, sign_shift) */
+    limb_number shift_left_once(bool sign_shift) const {
+        limb_number result(bit_size + 1, sign_shift, defined_size);
+        uint64_t carry = 0;
+        for (size_t i = 0; i < result.limbs.size(); i++) {
+            uint64_t limb = (i < limbs.size()) ? limbs[i] : 0;
+            result.limbs[i] = (limb << 1) | carry;
+            carry = limb >> (LIMB_BITS - 1);
+        }
+        return result;
+    }
+
+    /* same as eval_op(a, b) */
+    static compare_bit compare(const limb_number& a_in, const limb_number& b_in) {
+        bool neg_a = a_in.is_negative();
+        bool neg_b = b_in.is_negative();
+
+        if (neg_a && !neg_b) {
+            return LT_EVAL;
+        } else if (!neg_a && neg_b) {
+            return GT_EVAL;
+        }
+
+        bool invert_result = (neg_a && neg_b);
+        limb_number a = (invert_result) ? a_in.twos_complement() : a_in;
+        limb_number b = (invert_result) ? b_in.twos_complement() : b_in;
+
+        size_t std_length = std::max(a.size(), b.size());
+        size_t top_limb = limb_count(std_length) - 1;
+        size_t used = std_length % LIMB_BITS;
+        for (size_t i = top_limb; i <= top_limb; i--) {
+            uint64_t limb_a = a.get_limb(i);
+            uint64_t limb_b = b.get_limb(i);
+            if (used && i == top_limb) {
+                uint64_t mask = (uint64_t(1) << used) - 1;
+                limb_a &= mask;
+                limb_b &= mask;
+            }
+
+            if (limb_a < limb_b) {
+                return (!invert_result) ? LT_EVAL : GT_EVAL;
+            } else if (limb_a > limb_b) {
+                return (!invert_result) ? GT_EVAL : LT_EVAL;
+            }
+        }
+
+        return EQ_EVAL;
+    }
+};
+
 static VNumber shift_op(VNumber& a, int64_t b, bool sign_shift) {
     VNumber to_return;
 
@@ -557,19 +739,21 @@ VNumber V_MULTIPLY(VNumber& a_in, VNumber& b_in) {
 
     bool invert_result = ((!neg_a && neg_b) || (neg_a && !neg_b));
 
-    VNumber result("0");
-    VNumber b_copy = b;
+    VNumber zero("0");
+    limb_number packed_result(zero);
+    limb_number b_copy(b);
 
     for (size_t i = 0; i < a.size(); i++) {
         bit_value_t bit_a = a.get_bit_from_lsb(i);
 
         if (bit_a == _1) {
-            result = V_ADD(result, b_copy);
+            packed_result = limb_number::sum(packed_result, b_copy, /* is_twos_complement_subtraction */ false);
         }
 
-        b_copy = shift_op(b_copy, 1, is_multiply_signed_operation);
+        b_copy = b_copy.shift_left_once(is_multiply_signed_operation);
     }
 
+    VNumber result = packed_result.to_vnumber();
     if (invert_result) {
         result = V_MINUS(result);
     }
@@ -683,23 +867,30 @@ VNumber V_DIV(VNumber& a_in, VNumber& b_in) {
         b = V_MINUS(b);
     }
 
-    while (eval_op(a, b).is_ge()) {
-        VNumber count("1");
-        VNumber tmp = b;
+    VNumber one("1");
+    limb_number packed_one(one);
+    limb_number packed_result(result);
+    limb_number packed_a(a);
+    limb_number packed_b(b);
+
+    while (limb_number::compare(packed_a, packed_b).is_ge()) {
+        limb_number count = packed_one;
+        limb_number tmp = packed_b;
 
         // initialize our variables
-        VNumber sub_with = tmp;
-        VNumber count_sub_with = count;
-        while (eval_op(tmp, a).is_le()) {
+        limb_number sub_with = tmp;
+        limb_number count_sub_with = count;
+        while (limb_number::compare(tmp, packed_a).is_le()) {
             sub_with = tmp;
             count_sub_with = count;
-            count = shift_op(count, 1, is_division_signed_operation);
-            tmp = shift_op(tmp, 1, is_division_signed_operation);
+            count = count.shift_left_once(is_division_signed_operation);
+            tmp = tmp.shift_left_once(is_division_signed_operation);
         }
-        a = V_MINUS(a, sub_with);
-        result = V_ADD(result, count_sub_with);
+        packed_a = limb_number::minus(packed_a, sub_with);
+        packed_result = limb_number::sum(packed_result, count_sub_with, /* is_twos_complement_subtraction */ false);
     }
 
+    result = packed_result.to_vnumber();
     return (neg_a != neg_b) ? V_MINUS(result) : result;
 }
 
@@ -727,17 +918,21 @@ VNumber V_MOD(VNumber& a_in, VNumber& b_in) {
 
     bool is_modulo_signed_operation = is_signed_operation(a, b);
 
-    while (eval_op(a, b).is_ge()) {
-        VNumber tmp = b;
-        VNumber sub_with = tmp;
+    limb_number packed_a(a);
+    limb_number packed_b(b);
+
+    while (limb_number::compare(packed_a, packed_b).is_ge()) {
+        limb_number tmp = packed_b;
+        limb_number sub_with = tmp;
 
-        while (eval_op(tmp, a).is_le()) {
+        while (limb_number::compare(tmp, packed_a).is_le()) {
             sub_with = tmp;
-            tmp = shift_op(tmp, 1, is_modulo_signed_operation);
+            tmp = tmp.shift_left_once(is_modulo_signed_operation);
         }
-        a = V_MINUS(a, sub_with);
+        packed_a = limb_number::minus(packed_a, sub_with);
     }
 
+    a = packed_a.to_vnumber();
     return (neg_a) ? V_MINUS(a) : a;
 }
 
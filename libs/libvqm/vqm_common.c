@@ -27,6 +27,10 @@
 //                 a 32 bit integer type to a 64 bit pointer type.
 //                 Also fixed various compiler warnings from casting and signed/unsigned
 //                 comparisons. (Kevin Murray)
+// October 14, 2026 - Cell types, port names and parameter names and values are now pooled,
+//                 so the many cells and bus wires sharing them do not each hold a copy.
+//                 The lexer no longer copies token strings during the counting pass, in
+//                 which they were never used nor freed.
 /////////////////////////////////////////////////////////////////////////////////////////////
 
 /*******************************************************************************************/
@@ -66,6 +70,11 @@
 
 #define ELEMENT_SIZE    sizeof(intptr_t)
 
+#define STRING_POOL_SIZE	65536
+/* Number of entries in the hash table of pooled strings. The strings pooled (cell types, port
+ * and parameter names and values) are few compared to the elements of the netlist.
+ */
+
 /*******************************************************************************************/
 /****************************           DECLARATIONS             ***************************/
 /*******************************************************************************************/
@@ -76,6 +85,8 @@ t_array_ref *node_list = NULL;
 t_array_ref *pin_list = NULL;
 t_hash_table *pin_hash = NULL;
 t_node	*most_recently_used_node = NULL;
+t_hash_table *string_pool = NULL;
+t_parsing_pass_type lexer_pass_type = ALLOCATE_PASS;
 
 /*  //Moved to vqm_common.h
  *void free_module(void *pointer);
@@ -94,6 +105,8 @@ t_hash_elem* get_hash_entry(char* key, t_hash_table* hash_table);
 void insert_hash(char* key, size_t value, t_hash_table* hash_table);
 t_index_pass find_position_for_net_in_array_by_hash(char* name, t_array_ref *net_list);
 t_node_port_association *create_node_port_association(char *port_name, int port_index, t_pin_def *pin, int wire_index);
+t_hash_elem* get_pooled_string_entry(char* string);
+void free_string_pool();
 /*******************************************************************************************/
 /****************************          IMPLEMENTATION            ***************************/
 /*******************************************************************************************/
@@ -119,6 +132,9 @@ void vqm_data_cleanup()
 		free(module_list);
 		module_list = NULL;
 	}
+	/* The pooled strings are only referenced by the modules freed above */
+	free_string_pool();
+
 	/* Set other reference lists to NULL */
 	module_list = NULL;
 	assignment_list = NULL;
@@ -204,7 +220,7 @@ void free_node(void *pointer)
 	if (node != NULL)
 	{
 		/* Free type */
-		free(node->type);
+		vqm_free_string(node->type);
 
 		/* Free name */
 		free(node->name);
@@ -231,11 +247,11 @@ void free_parameter(void *pointer)
 
 	if (param != NULL)
 	{
-		free(param->name);
+		vqm_free_string(param->name);
 
 		if (param->type == NODE_PARAMETER_STRING)
 		{
-			free(param->value.string_value);
+			vqm_free_string(param->value.string_value);
 		}
 
 		free(param);
@@ -250,7 +266,7 @@ void free_port_association(void *pointer)
 
 	if (association != NULL)
 	{
-		free(association->port_name);
+		vqm_free_string(association->port_name);
 		free(association);
 	}
 }
@@ -357,7 +373,7 @@ t_pin_def *add_pin(char *name, int left, int right, t_pin_def_type type, t_parse
 
         //Allocate twice as many spaces in the hash table as is needed, this should prevent
         //the table from becoming too full.
-        pin_hash->table = (t_hash_elem*) malloc(2*parse_info->number_of_pins*sizeof(t_hash_elem));
+        pin_hash->table = (t_hash_elem*) calloc(2*parse_info->number_of_pins, sizeof(t_hash_elem));
         pin_hash->size = 2*parse_info->number_of_pins;
     }
 
@@ -525,7 +541,7 @@ void add_node(char* type, char *name, t_array_ref **ports, t_parse_info* parse_i
 
 	VTR_ASSERT(my_node != NULL);
 
-	my_node->type = type;
+	my_node->type = pool_string(type);
 	my_node->name = name; /* Memory already allocated */
 	my_node->array_of_params = NULL;
 	my_node->number_of_params = 0;
@@ -558,8 +574,7 @@ void add_node(char* type, char *name, t_array_ref **ports, t_parse_info* parse_i
 
 				new_assoc->associated_net = net;
 				new_assoc->port_index = counter;
-				new_assoc->port_name = (char *) malloc(strlen(association->port_name)+1);
-				strcpy(new_assoc->port_name, (char*)malloc(strlen(association->port_name)));
+				new_assoc->port_name = association->port_name; /* Pooled, so it can be shared */
 				new_assoc->wire_index = wire_index;
 				wire_index += change;
 				m_ports->array_size = insert_element_at_index((intptr_t) new_assoc, m_ports, counter);
@@ -913,6 +928,9 @@ t_array_ref *associate_identifier_with_port_name(t_identifier_pass *identifier,
 
 	VTR_ASSERT(pin != NULL);
 
+	/* All the associations of the port share its name */
+	port_name = pool_string(port_name);
+
 	result = (t_array_ref *) malloc(sizeof(t_array_ref));
 	VTR_ASSERT(result != NULL);
 	result->array_size = 0;
@@ -938,16 +956,12 @@ t_array_ref *associate_identifier_with_port_name(t_identifier_pass *identifier,
 			int direction = (pin->left > pin->right) ? -1:1;
 			/* Assuming that each port has its left index greater than the right index and that the right index is always 0. */
 			int port = my_abs(pin->left - pin->right);
-			int port_name_length = strlen(port_name);
 
             append_array_element( (intptr_t) create_node_port_association(port_name, port, pin, pin->left), result);
 			port--;
 			for(index = pin->left+direction; index != pin->right + direction; index += direction)
 			{
-				char *temp_port_name = (char*)malloc(port_name_length+1);
-
-				strcpy(temp_port_name, port_name);
-                append_array_element((intptr_t)	create_node_port_association(temp_port_name, port, pin, index), result);
+                append_array_element((intptr_t)	create_node_port_association(port_name, port, pin, index), result);
 				port--;
 			}
 		}
@@ -1097,6 +1111,9 @@ t_array_ref *create_wire_port_connections(t_array_ref *concat_array, char *port_
 
 	identifier_list = create_array_of_net_to_port_assignments(concat_array);
 
+	/* All the wires connected to the port share its name */
+	port_name = pool_string(port_name);
+
 	connections = (t_array_ref *) malloc(sizeof(t_array_ref));
 
 	VTR_ASSERT(connections != NULL);
@@ -1107,7 +1124,6 @@ t_array_ref *create_wire_port_connections(t_array_ref *concat_array, char *port_
 	for(index = 0; index < identifier_list->array_size; index++)
 	{
 		t_identifier_pass *ident = (t_identifier_pass *) identifier_list->pointer[index];
-		char *temp;
 		size_t association_index;
 		t_array_ref *association;
 
@@ -1115,14 +1131,10 @@ t_array_ref *create_wire_port_connections(t_array_ref *concat_array, char *port_
 		{
 			continue;
 		}
-		/* Copy the name of the port */
-		temp = (char *)malloc(strlen(port_name)+1);
-		strcpy(temp, port_name);
-
 		/* Set port index that is array_size-1-index. This is to ensure that the first wire
 		 * listed in the concatenation set is associated with the Most significant bit of the port.
 		 */
-		association = associate_identifier_with_port_name(ident, temp, identifier_list->array_size - index - 1);
+		association = associate_identifier_with_port_name(ident, port_name, identifier_list->array_size - index - 1);
 		if (association != NULL)
 		{
 			for(association_index = 0; association_index < association->array_size; association_index++)
@@ -1132,17 +1144,12 @@ t_array_ref *create_wire_port_connections(t_array_ref *concat_array, char *port_
 			free(association->pointer);
 			free(association);
 		}
-		else
-		{
-			free(temp);
-		}
 		/* Free identifier */
 		free(ident->name);
 		free(ident);
 	}
 	free(identifier_list->pointer);
 	free(identifier_list);
-	free(port_name);
 	return connections;
 }
 
@@ -1278,7 +1285,7 @@ void define_instance_parameter(t_identifier_pass *identifier, char *parameter_na
 
 	VTR_ASSERT(param != NULL);
 
-	param->name = parameter_name;
+	param->name = pool_string(parameter_name);
 	if (string_value == NULL)
 	{
 		param->type = NODE_PARAMETER_INTEGER;
@@ -1287,7 +1294,7 @@ void define_instance_parameter(t_identifier_pass *identifier, char *parameter_na
 	else
 	{
 		param->type = NODE_PARAMETER_STRING;
-		param->value.string_value = string_value;
+		param->value.string_value = pool_string(string_value);
 	}
 
     t_array_ref* param_array_ref = append_array_element_wrapper((intptr_t) param, (intptr_t **) local_node->array_of_params, local_node->number_of_params);
@@ -1300,6 +1307,152 @@ void define_instance_parameter(t_identifier_pass *identifier, char *parameter_na
 }
 
 
+/*******************************************************************************************/
+/****************************          STRING FUNCTIONS          ***************************/
+/*******************************************************************************************/
+
+
+char *copy_token_string(const char *text, size_t length)
+/* Copy a token string for the parser. The counting pass does not use the token strings,
+ * so no copy is made then and NULL is returned.
+ */
+{
+	char *result;
+
+	if (lexer_pass_type == COUNT_PASS)
+	{
+		return NULL;
+	}
+
+	result = (char *) malloc(length+1);
+	VTR_ASSERT(result != NULL);
+
+	strncpy(result, text, length);
+	result[length] = 0;
+
+	return result;
+}
+
+
+t_hash_elem* get_pooled_string_entry(char* string)
+/* Returns the entry of the string pool holding a string equal to the given one, or NULL if
+ * there is none.
+ */
+{
+	t_hash_elem* entry;
+
+	if (string_pool == NULL)
+	{
+		return NULL;
+	}
+
+	for(entry = &string_pool->table[hash_func(string, string_pool)]; entry != NULL; entry = entry->next)
+	{
+		if (entry->key != NULL && strcmp(string, entry->key) == 0)
+		{
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+
+char *pool_string(char *string)
+/* Pool a string shared by many netlist elements, such as a cell type or a port name. The given
+ * string must have been allocated with malloc, and is owned by the pool from now on: the pooled
+ * string equal to it is returned, and the given string is freed if another one was pooled before.
+ * Pooled strings are freed by vqm_data_cleanup, and left alone by vqm_free_string.
+ */
+{
+	t_hash_elem* entry;
+
+	VTR_ASSERT(string != NULL);
+
+	if (string_pool == NULL)
+	{
+		string_pool = (t_hash_table*) malloc(sizeof(t_hash_table));
+		VTR_ASSERT(string_pool != NULL);
+
+		string_pool->table = (t_hash_elem*) calloc(STRING_POOL_SIZE, sizeof(t_hash_elem));
+		VTR_ASSERT(string_pool->table != NULL);
+		string_pool->size = STRING_POOL_SIZE;
+	}
+
+	entry = get_pooled_string_entry(string);
+	if (entry != NULL)
+	{
+		if (entry->key != string)
+		{
+			free(string);
+		}
+		return entry->key;
+	}
+
+	/* Add the string to the table, at the head of its list */
+	entry = &string_pool->table[hash_func(string, string_pool)];
+	if (entry->key != NULL)
+	{
+		t_hash_elem* new_entry = (t_hash_elem*) malloc(sizeof(t_hash_elem));
+		VTR_ASSERT(new_entry != NULL);
+
+		*new_entry = *entry;
+		entry->next = new_entry;
+	}
+	entry->key = string;
+	entry->value = 0;
+
+	return string;
+}
+
+
+VQM_DLL_API void vqm_free_string(char *string)
+/* Free a string of the VQM data structures, unless it is pooled. */
+{
+	t_hash_elem* entry;
+
+	if (string == NULL)
+	{
+		return;
+	}
+
+	entry = get_pooled_string_entry(string);
+	if (entry == NULL || entry->key != string)
+	{
+		free(string);
+	}
+}
+
+
+void free_string_pool()
+/* Free the pooled strings and the pool. */
+{
+	size_t index;
+
+	if (string_pool == NULL)
+	{
+		return;
+	}
+
+	for(index = 0; index < string_pool->size; index++)
+	{
+		t_hash_elem* entry = string_pool->table[index].next;
+
+		free(string_pool->table[index].key);
+		while(entry != NULL)
+		{
+			t_hash_elem* next = entry->next;
+
+			free(entry->key);
+			free(entry);
+			entry = next;
+		}
+	}
+	free(string_pool->table);
+	free(string_pool);
+	string_pool = NULL;
+}
+
+
 /*******************************************************************************************/
 /****************************         ARRAY FUNCTIONS            ***************************/
 /*******************************************************************************************/
@@ -42,6 +42,8 @@ extern t_array_ref *assignment_list;
 extern t_array_ref *node_list;
 extern t_array_ref *pin_list;
 extern t_hash_table *pin_hash;
+extern t_hash_table *string_pool;
+extern t_parsing_pass_type lexer_pass_type;
 
 /*******************************************************************************************/
 /****************************           DECLARATIONS             ***************************/
@@ -73,6 +75,8 @@ t_array_ref			*create_array_of_net_to_port_assignments(t_array_ref *con_array);
 void				define_instance_parameter(t_identifier_pass *identifier, char *parameter_name, char *string_value, int integer_value);
 void				add_concatenation_assignments(t_array_ref *con_array, t_pin_def *target_pin, t_boolean invert_wire, t_parse_info* parse_info);
 t_array_ref			*create_wire_port_connections(t_array_ref *concat_array, char *port_name);
+char				*copy_token_string(const char *text, size_t length);
+char				*pool_string(char *string);
 
 void print_hash_stats(t_hash_table* hash_table);
 
@@ -61,8 +61,9 @@ VQM_DLL_API t_module *vqm_parse_file(char *filename)
 	if (yyin != NULL)
 	{
 
-        //Initial pass to count items
+        //Initial pass to count items, the token strings are not needed
         printf("\tCounting Pass\n");
+        lexer_pass_type = COUNT_PASS;
 		yyparse(parse_info);
 		if (module_list != NULL)
 		{
@@ -90,8 +91,9 @@ VQM_DLL_API t_module *vqm_parse_file(char *filename)
 	if (yyin != NULL)
 	{
 
-        //Initial pass to count items
+        //Second pass to allocate items
         printf("\tAllocating Pass\n");
+        lexer_pass_type = ALLOCATE_PASS;
 		yyparse(parse_info);
 		if (module_list != NULL)
 		{
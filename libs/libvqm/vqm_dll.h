@@ -18,6 +18,10 @@
  * 3.		Free memory taken by the VQM data structures by calling the following function:
  *				vqm_data_cleanup();
  *
+ * Strings shared by many elements (cell types, port names, parameter names and values) are pooled,
+ * and only freed by vqm_data_cleanup(). A string taken out of the data structures before then must
+ * be released with vqm_free_string() rather than free().
+ *
  * Data structures:
  * The data structure returned by the vqm_parse_file function is a t_module structure. This structure consists of a module name,
  * an array of pins, an array of statements and an array of nodes. The array of pins contains a set of input, output and bidirectional
@@ -328,10 +332,12 @@ VQM_DLL_API t_array_ref *vqm_get_module_list();
 VQM_DLL_API t_module *vqm_parse_file(char *filename);
 VQM_DLL_API void vqm_data_cleanup();
 VQM_DLL_API int vqm_get_error_message(char *message_buffer, int length);
+VQM_DLL_API void vqm_free_string(char *string);
 #else
 t_array_ref *vqm_get_module_list();
 t_module *vqm_parse_file(char *filename);
 void vqm_data_cleanup();
+void vqm_free_string(char *string);
 #endif
 
 #endif
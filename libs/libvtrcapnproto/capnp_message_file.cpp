@@ -0,0 +1,93 @@
+#include "capnp_message_file.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <zlib.h>
+
+#include "vtr_error.h"
+#include "vtr_util.h"
+
+static bool is_gzip_file(const std::string& file);
+static kj::Array<::capnp::word> read_gzip_file(const std::string& file, size_t& num_words);
+
+CapnpMessageFile::CapnpMessageFile(const std::string& file, const ::capnp::ReaderOptions& options) {
+    kj::ArrayPtr<const ::capnp::word> words;
+    if (is_gzip_file(file)) {
+        size_t num_words = 0;
+        buffer_ = read_gzip_file(file, num_words);
+        words = kj::arrayPtr(const_cast<const ::capnp::word*>(buffer_.begin()), num_words);
+    } else {
+        mmap_ = std::make_unique<MmapFile>(file);
+        words = mmap_->getData();
+    }
+
+    try {
+        reader_ = std::make_unique<::capnp::FlatArrayMessageReader>(words, options);
+    } catch (kj::Exception& e) {
+        throw vtr::VtrError(vtr::string_fmt("Failed to read capnp message from '%s': %s", file.c_str(), e.getDescription().cStr()),
+                            e.getFile(), e.getLine());
+    }
+}
+
+///@brief Returns true if file starts with the gzip magic number
+static bool is_gzip_file(const std::string& file) {
+    FILE* fp = std::fopen(file.c_str(), "rb");
+    if (!fp) {
+        throw vtr::VtrError(vtr::string_fmt("Failed to open '%s'", file.c_str()), __FILE__, __LINE__);
+    }
+
+    unsigned char magic[2] = {0, 0};
+    size_t num_read = std::fread(magic, 1, sizeof(magic), fp);
+    std::fclose(fp);
+
+    return num_read == sizeof(magic) && magic[0] == 0x1f && magic[1] == 0x8b;
+}
+
+/**
+ * @brief Decompresses file into a buffer, whose first num_words words hold the decompressed data
+ *
+ * The buffer grows geometrically, so the data is copied O(1) times on average.
+ */
+static kj::Array<::capnp::word> read_gzip_file(const std::string& file, size_t& num_words) {
+    gzFile gz_file = gzopen(file.c_str(), "rb");
+    if (gz_file == Z_NULL) {
+        throw vtr::VtrError(vtr::string_fmt("Failed to open '%s'", file.c_str()), __FILE__, __LINE__);
+    }
+    gzbuffer(gz_file, 1024 * 1024);
+
+    auto buffer = kj::heapArray<::capnp::word>(1024 * 1024);
+    size_t num_bytes = 0;
+    while (true) {
+        size_t capacity = buffer.size() * sizeof(::capnp::word);
+        if (num_bytes == capacity) {
+            auto larger_buffer = kj::heapArray<::capnp::word>(2 * buffer.size());
+            std::memcpy(larger_buffer.begin(), buffer.begin(), num_bytes);
+            buffer = std::move(larger_buffer);
+            capacity = buffer.size() * sizeof(::capnp::word);
+        }
+
+        //gzread() reads at most INT_MAX bytes at a time
+        size_t to_read = std::min<size_t>(capacity - num_bytes, 1 << 30);
+        int ret = gzread(gz_file, reinterpret_cast<char*>(buffer.begin()) + num_bytes, to_read);
+        if (ret < 0) {
+            int error;
+            std::string message = gzerror(gz_file, &error);
+            gzclose(gz_file);
+            throw vtr::VtrError(vtr::string_fmt("Failed to decompress '%s': %s", file.c_str(), message.c_str()), __FILE__, __LINE__);
+        }
+        if (ret == 0) {
+            break; //End of file
+        }
+        num_bytes += ret;
+    }
+    gzclose(gz_file);
+
+    if (num_bytes % sizeof(::capnp::word) != 0) {
+        throw vtr::VtrError(vtr::string_fmt("Decompressed size of '%s' (%zu bytes) is not a multiple of capnp::word", file.c_str(), num_bytes),
+                            __FILE__, __LINE__);
+    }
+
+    num_words = num_bytes / sizeof(::capnp::word);
+    return buffer;
+}
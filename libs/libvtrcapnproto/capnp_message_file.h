@@ -0,0 +1,38 @@
+#ifndef CAPNP_MESSAGE_FILE_H_
+#define CAPNP_MESSAGE_FILE_H_
+
+#include <memory>
+#include <string>
+
+#include "capnp/serialize.h"
+#include "kj/array.h"
+
+#include "mmap_file.h"
+
+/**
+ * @brief Reads an (unpacked) capnp message from a file, which may be gzip compressed
+ *
+ * Uncompressed files are memory mapped and the message is read in place, without
+ * copying. Compressed files (e.g. FPGA interchange device and netlist files) are
+ * decompressed directly into a single word aligned buffer, which the message is
+ * then read from.
+ *
+ * The readers returned by getRoot() refer to the file's data, so they are only
+ * valid for the lifetime of the CapnpMessageFile.
+ */
+class CapnpMessageFile {
+  public:
+    CapnpMessageFile(const std::string& file, const ::capnp::ReaderOptions& options);
+
+    template<typename T>
+    typename T::Reader getRoot() {
+        return reader_->getRoot<T>();
+    }
+
+  private:
+    std::unique_ptr<MmapFile> mmap_;
+    kj::Array<::capnp::word> buffer_;
+    std::unique_ptr<::capnp::FlatArrayMessageReader> reader_;
+};
+
+#endif /* CAPNP_MESSAGE_FILE_H_ */
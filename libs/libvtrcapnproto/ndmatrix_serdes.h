@@ -56,7 +56,6 @@
 //      vtr::NdMatrix<Vec2, 3> mat_out;
 //      ToNdMatrix<3, Test::Vec2, Vec2>(&mat_out, test.getVectors(), FromVec2);
 //  }
-#include <functional>
 #include "vtr_ndmatrix.h"
 #include "vpr_error.h"
 #include "matrix.capnp.h"
@@ -68,16 +67,23 @@
 //  CapType = Source capnproto message type that is a single element the
 //            Matrix capnproto message.
 //  CType = Target C++ type that is a single element of vtr::NdMatrix.
+//  CopyFun = Type of copy_fun, deduced. It is called directly (not through a
+//            std::function), so the per-element conversion can be inlined.
 //
 // Arguments:
 //  m_out = Target vtr::NdMatrix.
 //  m_in = Source capnproto message reader.
-//  copy_fun = Function to convert from CapType to CType.
-template<size_t N, typename CapType, typename CType>
+//  copy_fun = Function to convert from CapType to CType, called as
+//             copy_fun(CType*, const CapType::Reader&).
+//
+// Note that the elements can't be used in place: each Entry of the data list
+// is a struct holding a pointer to its value, so the list isn't a flat array of
+// CType even for POD types.
+template<size_t N, typename CapType, typename CType, typename CopyFun>
 void ToNdMatrix(
     vtr::NdMatrix<CType, N>* m_out,
     const typename Matrix<CapType>::Reader& m_in,
-    const std::function<void(CType*, const typename CapType::Reader&)>& copy_fun) {
+    const CopyFun& copy_fun) {
     const auto& dims = m_in.getDims();
     if (N != dims.size()) {
         VPR_THROW(VPR_ERROR_OTHER,
@@ -112,17 +118,19 @@ void ToNdMatrix(
 //  CapType = Target capnproto message type that is a single element the
 //            Matrix capnproto message.
 //  CType = Source C++ type that is a single element of vtr::NdMatrix.
+//  CopyFun = Type of copy_fun, deduced.
 //
 // Arguments:
 //  m_out = Target capnproto message builder.
 //  m_in = Source vtr::NdMatrix.
-//  copy_fun = Function to convert from CType to CapType.
+//  copy_fun = Function to convert from CType to CapType, called as
+//             copy_fun(CapType::Builder*, const CType&).
 //
-template<size_t N, typename CapType, typename CType>
+template<size_t N, typename CapType, typename CType, typename CopyFun>
 void FromNdMatrix(
     typename Matrix<CapType>::Builder* m_out,
     const vtr::NdMatrix<CType, N>& m_in,
-    const std::function<void(typename CapType::Builder*, const CType&)>& copy_fun) {
+    const CopyFun& copy_fun) {
     size_t elements = 1;
     auto dims = m_out->initDims(N);
     for (size_t i = 0; i < N; ++i) {
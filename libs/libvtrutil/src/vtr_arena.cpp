@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <cstdint>
+
+#include "vtr_arena.h"
+#include "vtr_assert.h"
+
+namespace vtr {
+
+//Alignment of the blocks (and so the largest alignment allocations are guaranteed)
+constexpr size_t BLOCK_ALIGN = 64;
+
+Arena::Arena(size_t block_bytes)
+    : block_bytes_(block_bytes) {
+    VTR_ASSERT(block_bytes_ > 0);
+}
+
+Arena::~Arena() {
+    release();
+}
+
+void* Arena::allocate(size_t bytes, size_t align) {
+    VTR_ASSERT_SAFE((align & (align - 1)) == 0);
+    VTR_ASSERT(align <= BLOCK_ALIGN);
+
+    bytes = std::max<size_t>(bytes, 1);
+    bytes_allocated_ += bytes;
+
+    if (bytes > block_bytes_ / 4) {
+        //Large allocations get their own block, so they don't waste the rest of the current one
+        return new_block(bytes);
+    }
+
+    uintptr_t next = reinterpret_cast<uintptr_t>(next_);
+    uintptr_t aligned = (next + align - 1) & ~(uintptr_t(align) - 1);
+
+    if (!next_ || aligned + bytes > reinterpret_cast<uintptr_t>(end_)) {
+        next_ = new_block(block_bytes_);
+        end_ = next_ + block_bytes_;
+        aligned = reinterpret_cast<uintptr_t>(next_);
+    }
+
+    char* ptr = reinterpret_cast<char*>(aligned);
+    next_ = ptr + bytes;
+    return ptr;
+}
+
+void Arena::release() {
+    for (const t_block& block : blocks_) {
+        free_large(block.data, block.bytes);
+    }
+    std::vector<t_block>().swap(blocks_);
+
+    next_ = nullptr;
+    end_ = nullptr;
+    bytes_allocated_ = 0;
+    bytes_reserved_ = 0;
+}
+
+char* Arena::new_block(size_t bytes) {
+    char* data = static_cast<char*>(malloc_large(bytes, BLOCK_ALIGN));
+    blocks_.push_back({data, bytes});
+    bytes_reserved_ += bytes;
+    return data;
+}
+
+} // namespace vtr
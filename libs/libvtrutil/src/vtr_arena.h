@@ -0,0 +1,158 @@
+#ifndef VTR_ARENA_H
+#define VTR_ARENA_H
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "vtr_memory.h"
+
+namespace vtr {
+
+/**
+ * @brief A region of memory whose allocations are all freed together
+ *
+ * Allocations are carved (bump-pointer style) out of large blocks, and are only freed when the
+ * whole arena is released. This suits data structures which live for a whole stage of the flow
+ * (e.g. the per-net placer costs): they are packed together instead of being interleaved on the
+ * heap with longer lived allocations, so the memory can actually be returned to the operating
+ * system when the stage ends, instead of fragmenting the heap (and keeping the RSS high) for
+ * the rest of the flow.
+ *
+ * The blocks are allocated with malloc_large(), so blocks of the default size are mapped directly
+ * (following the large allocation policy) and unmapped by release().
+ *
+ * Since memory is only reclaimed by release(), containers which repeatedly grow (e.g. a vector
+ * which is push_back()'ed) waste their previous buffers; they should be reserved or sized up-front.
+ *
+ * Note that an Arena is not thread safe.
+ */
+class Arena {
+  public:
+    ///@brief The default size of the blocks allocations are carved out of
+    static constexpr size_t DEFAULT_BLOCK_BYTES = LARGE_ALLOC_MIN_BYTES;
+
+    explicit Arena(size_t block_bytes = DEFAULT_BLOCK_BYTES);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Allocates bytes, aligned to align (a power of two)
+     *
+     * Allocations larger than a quarter of the block size get a block of their own.
+     */
+    void* allocate(size_t bytes, size_t align);
+
+    ///@brief Frees all the allocations of the arena (which must no longer be used)
+    void release();
+
+    ///@brief Returns the bytes allocated from the arena since it was last released
+    size_t bytes_allocated() const { return bytes_allocated_; }
+
+    ///@brief Returns the bytes of the blocks currently held by the arena
+    size_t bytes_reserved() const { return bytes_reserved_; }
+
+  private:
+    struct t_block {
+        char* data;
+        size_t bytes;
+    };
+
+    ///@brief Allocates a block of bytes, and returns its start
+    char* new_block(size_t bytes);
+
+  private:
+    size_t block_bytes_;
+
+    std::vector<t_block> blocks_;
+    char* next_ = nullptr; ///<Next free byte of the current block
+    char* end_ = nullptr;  ///<One-past-the-end of the current block
+
+    size_t bytes_allocated_ = 0;
+    size_t bytes_reserved_ = 0;
+};
+
+/**
+ * @brief arena_allocator is a STL allocator which allocates from an Arena
+ *
+ * Deallocation is a no-op: the memory is reclaimed when the arena is released. A default
+ * constructed arena_allocator has no arena, and allocates from (and frees to) the heap, so
+ * containers can be declared (e.g. in a context) before an arena is assigned to them:
+ *
+ *      vtr::Arena arena;
+ *      vtr::vector<ClusterNetId, double, vtr::arena_allocator<double>> net_cost;
+ *
+ *      //The allocator (and so the arena) is propagated by assignment
+ *      net_cost = decltype(net_cost)(num_nets, 0., vtr::arena_allocator<double>(arena));
+ *
+ *      ...
+ *      vtr::release_memory(net_cost);
+ *      arena.release();
+ */
+template<class T>
+class arena_allocator {
+  public:
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template<class U>
+    struct rebind {
+        using other = arena_allocator<U>;
+    };
+
+    ///@brief An allocator using the heap
+    arena_allocator() noexcept = default;
+
+    ///@brief An allocator using the specified arena
+    explicit arena_allocator(Arena& arena) noexcept
+        : arena_(&arena) {}
+
+    template<class U>
+    arena_allocator(const arena_allocator<U>& other) noexcept
+        : arena_(other.arena()) {}
+
+    pointer allocate(size_type n, const void* /*hint*/ = 0) {
+        if (arena_) {
+            return static_cast<pointer>(arena_->allocate(sizeof(T) * n, alignof(T)));
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_type n) {
+        if (!arena_) {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+
+    ///@brief Returns the arena of the allocator (nullptr if it uses the heap)
+    Arena* arena() const noexcept { return arena_; }
+
+  private:
+    Arena* arena_ = nullptr;
+};
+
+///@brief arena_allocators are the same if they use the same arena (or both use the heap)
+template<typename T, typename U>
+bool operator==(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) {
+    return lhs.arena() == rhs.arena();
+}
+
+template<typename T, typename U>
+bool operator!=(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) {
+    return !(lhs == rhs);
+}
+
+} // namespace vtr
+
+#endif
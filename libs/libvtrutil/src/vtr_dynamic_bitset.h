@@ -1,16 +1,23 @@
 #ifndef VTR_DYNAMIC_BITSET
 #define VTR_DYNAMIC_BITSET
 
+#include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <vector>
 
+#include "vtr_assert.h"
+
 namespace vtr {
 /**
  * @brief A container to represent a set of flags either they are set or reset 
  *
  * It allocates any required length of bit at runtime. It is very useful in bit manipulation
+ *
+ * The bulk operations (bitwise operators, count(), and the searches and iteration over the set bits)
+ * work a whole storage word at a time. Their loops are kept simple so the compiler can vectorize them.
  */
-template<typename Index = size_t, typename Storage = unsigned int>
+template<typename Index = size_t, typename Storage = uint64_t>
 class dynamic_bitset {
   public:
     ///@brief Bits in underlying storage.
@@ -55,9 +62,9 @@ class dynamic_bitset {
         size_t index_value(index);
         VTR_ASSERT_SAFE(index_value < size());
         if (val) {
-            array_[index_value / kWidth] |= (1 << (index_value % kWidth));
+            array_[index_value / kWidth] |= (Storage(1) << (index_value % kWidth));
         } else {
-            array_[index_value / kWidth] &= ~(1u << (index_value % kWidth));
+            array_[index_value / kWidth] &= ~(Storage(1) << (index_value % kWidth));
         }
     }
 
@@ -65,17 +72,66 @@ class dynamic_bitset {
     bool get(Index index) const {
         size_t index_value(index);
         VTR_ASSERT_SAFE(index_value < size());
-        return (array_[index_value / kWidth] & (1u << (index_value % kWidth))) != 0;
+        return (array_[index_value / kWidth] & (Storage(1) << (index_value % kWidth))) != 0;
     }
 
     ///@brief Return count of set bits.
     constexpr size_t count(void) const {
         size_t out = 0;
         for (auto x : array_)
-            out += __builtin_popcount(x);
+            out += popcount(x);
         return out;
     }
 
+    ///@brief Return true if any bit is set
+    bool any() const {
+        return std::any_of(array_.begin(), array_.end(), [](Storage x) { return x != 0; });
+    }
+
+    ///@brief Return true if no bit is set
+    bool none() const {
+        return !any();
+    }
+
+    /**
+     * @brief Return the index of the first set bit at or after pos
+     *
+     * Returns size() if there is none.
+     */
+    size_t find_next_set(size_t pos) const {
+        return find_next<false>(pos);
+    }
+
+    /**
+     * @brief Return the index of the first unset bit at or after pos
+     *
+     * Returns size() if there is none.
+     */
+    size_t find_next_unset(size_t pos) const {
+        return find_next<true>(pos);
+    }
+
+    ///@brief Return the index of the first set bit (size() if there is none)
+    size_t find_first_set() const {
+        return find_next_set(0);
+    }
+
+    /**
+     * @brief Call fn(index) for every set bit, in increasing index order
+     *
+     * This skips whole words of unset bits, so it is much faster than testing every bit of a sparse bitset.
+     */
+    template<typename F>
+    void for_each_set(F&& fn) const {
+        for (size_t iword = 0; iword < array_.size(); iword++) {
+            Storage word = array_[iword];
+            while (word) {
+                fn(Index(iword * kWidth + count_trailing_zeros(word)));
+                word &= word - 1; //Clear the lowest set bit
+            }
+        }
+    }
+
     ///@brief Bitwise OR with rhs. Truncate the operation if one operand is smaller.
     constexpr dynamic_bitset<Index, Storage>& operator|=(const dynamic_bitset<Index, Storage>& x) {
         size_t n = std::min(array_.size(), x.array_.size());
@@ -92,6 +148,34 @@ class dynamic_bitset {
         return *this;
     }
 
+    ///@brief Bitwise XOR with rhs. Truncate the operation if one operand is smaller.
+    constexpr dynamic_bitset<Index, Storage>& operator^=(const dynamic_bitset<Index, Storage>& x) {
+        size_t n = std::min(array_.size(), x.array_.size());
+        for (size_t i = 0; i < n; i++)
+            array_[i] ^= x.array_[i];
+        return *this;
+    }
+
+    /**
+     * @brief Clear the bits which are set in rhs (i.e. *this &= ~rhs, without building ~rhs).
+     * Truncate the operation if one operand is smaller.
+     */
+    constexpr dynamic_bitset<Index, Storage>& and_not(const dynamic_bitset<Index, Storage>& x) {
+        size_t n = std::min(array_.size(), x.array_.size());
+        for (size_t i = 0; i < n; i++)
+            array_[i] &= ~x.array_[i];
+        return *this;
+    }
+
+    ///@brief Return true if both bitsets have the same size and bits
+    bool operator==(const dynamic_bitset<Index, Storage>& x) const {
+        return array_ == x.array_;
+    }
+
+    bool operator!=(const dynamic_bitset<Index, Storage>& x) const {
+        return !(*this == x);
+    }
+
     ///@brief Return inverted bitset.
     inline dynamic_bitset<Index, Storage> operator~(void) const {
         dynamic_bitset<Index, Storage> out(size());
@@ -101,6 +185,43 @@ class dynamic_bitset {
         return out;
     }
 
+  private:
+    static constexpr size_t popcount(Storage x) {
+        if constexpr (kWidth <= std::numeric_limits<unsigned int>::digits) {
+            return __builtin_popcount(x);
+        } else {
+            return __builtin_popcountll(x);
+        }
+    }
+
+    ///@brief Number of trailing zeros of x, which must not be 0
+    static constexpr size_t count_trailing_zeros(Storage x) {
+        if constexpr (kWidth <= std::numeric_limits<unsigned int>::digits) {
+            return __builtin_ctz(x);
+        } else {
+            return __builtin_ctzll(x);
+        }
+    }
+
+    ///@brief Find the first set bit (or unset bit if invert) at or after pos
+    template<bool invert>
+    size_t find_next(size_t pos) const {
+        size_t iword = pos / kWidth;
+        if (iword >= array_.size()) {
+            return size();
+        }
+
+        //Ignore the bits before pos in its word
+        Storage word = (invert ? ~array_[iword] : array_[iword]) & (std::numeric_limits<Storage>::max() << (pos % kWidth));
+        while (!word) {
+            if (++iword == array_.size()) {
+                return size();
+            }
+            word = invert ? ~array_[iword] : array_[iword];
+        }
+        return iword * kWidth + count_trailing_zeros(word);
+    }
+
   private:
     std::vector<Storage> array_;
 };
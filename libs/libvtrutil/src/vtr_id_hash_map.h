@@ -0,0 +1,328 @@
+#ifndef VTR_ID_HASH_MAP_H
+#define VTR_ID_HASH_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "vtr_assert.h"
+
+namespace vtr {
+
+namespace detail {
+
+/**
+ * @brief The open addressing hash table behind id_hash_map and id_hash_set
+ *
+ * Slots are stored contiguously in a power of two sized vector, and collisions are resolved by
+ * linear probing. A slot is empty when its key is K() (the INVALID() value of a vtr::StrongId),
+ * which therefore can't be inserted. Erasing shifts the following entries of the probe sequence
+ * back (instead of leaving a tombstone), so lookups never slow down as entries come and go.
+ *
+ * Keys are placed by Fibonacci hashing of size_t(key): since the ids are small dense integers,
+ * this (a multiplication and a shift) spreads them well enough without hashing.
+ */
+template<class K, class Slot, class KeyOf>
+class id_hash_table {
+  public:
+    template<bool is_const>
+    class iterator_base {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Slot;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<is_const, const Slot*, Slot*>;
+        using reference = std::conditional_t<is_const, const Slot&, Slot&>;
+
+        iterator_base() = default;
+        iterator_base(pointer slot, pointer end)
+            : slot_(slot)
+            , end_(end) {
+            skip_empty();
+        }
+
+        ///@brief Conversion from a non-const iterator
+        template<bool rhs_const, class = std::enable_if_t<is_const && !rhs_const>>
+        iterator_base(const iterator_base<rhs_const>& rhs)
+            : slot_(rhs.slot_)
+            , end_(rhs.end_) {}
+
+        reference operator*() const { return *slot_; }
+        pointer operator->() const { return slot_; }
+
+        iterator_base& operator++() {
+            ++slot_;
+            skip_empty();
+            return *this;
+        }
+
+        iterator_base operator++(int) {
+            iterator_base tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        friend bool operator==(const iterator_base& lhs, const iterator_base& rhs) { return lhs.slot_ == rhs.slot_; }
+        friend bool operator!=(const iterator_base& lhs, const iterator_base& rhs) { return lhs.slot_ != rhs.slot_; }
+
+      private:
+        void skip_empty() {
+            while (slot_ != end_ && KeyOf()(*slot_) == K()) {
+                ++slot_;
+            }
+        }
+
+        pointer slot_ = nullptr;
+        pointer end_ = nullptr;
+
+        template<bool>
+        friend class iterator_base;
+        friend class id_hash_table;
+    };
+
+    typedef iterator_base<false> iterator;
+    typedef iterator_base<true> const_iterator;
+
+  public:
+    iterator begin() { return iterator(slots_.data(), slots_.data() + slots_.size()); }
+    iterator end() { return iterator(slots_.data() + slots_.size(), slots_.data() + slots_.size()); }
+    const_iterator begin() const { return const_iterator(slots_.data(), slots_.data() + slots_.size()); }
+    const_iterator end() const { return const_iterator(slots_.data() + slots_.size(), slots_.data() + slots_.size()); }
+
+    ///@brief Returns the number of entries
+    size_t size() const { return size_; }
+
+    ///@brief Returns true if there are no entries
+    bool empty() const { return size_ == 0; }
+
+    ///@brief Returns 1 if there is an entry for key, and 0 otherwise
+    size_t count(const K& key) const { return find_slot(key) != NONE ? 1 : 0; }
+
+    ///@brief Returns an iterator to the entry of key, or end() if there is none
+    iterator find(const K& key) {
+        size_t islot = find_slot(key);
+        return islot != NONE ? iterator(slots_.data() + islot, slots_.data() + slots_.size()) : end();
+    }
+
+    const_iterator find(const K& key) const {
+        size_t islot = find_slot(key);
+        return islot != NONE ? const_iterator(slots_.data() + islot, slots_.data() + slots_.size()) : end();
+    }
+
+    ///@brief Removes the entry of key (if any), and returns the number of entries removed
+    size_t erase(const K& key) {
+        size_t islot = find_slot(key);
+        if (islot == NONE) {
+            return 0;
+        }
+
+        //Shift back the following entries of the probe sequence which may no longer be found past the hole
+        size_t mask = slots_.size() - 1;
+        size_t hole = islot;
+        for (size_t jslot = (hole + 1) & mask; KeyOf()(slots_[jslot]) != K(); jslot = (jslot + 1) & mask) {
+            size_t home = home_slot(KeyOf()(slots_[jslot]));
+            //Move the entry if its home isn't (cyclically) within (hole, jslot]
+            if (((jslot - home) & mask) >= ((jslot - hole) & mask)) {
+                slots_[hole] = std::move(slots_[jslot]);
+                hole = jslot;
+            }
+        }
+        slots_[hole] = Slot();
+        --size_;
+        return 1;
+    }
+
+    ///@brief Removes all the entries (keeping the capacity)
+    void clear() {
+        if (size_ > 0) {
+            std::fill(slots_.begin(), slots_.end(), Slot());
+            size_ = 0;
+        }
+    }
+
+    ///@brief Makes room for num_entries entries without rehashing
+    void reserve(size_t num_entries) {
+        size_t num_slots = MIN_SLOTS;
+        while (num_slots * MAX_LOAD_NUM < num_entries * MAX_LOAD_DEN) {
+            num_slots *= 2;
+        }
+        if (num_slots > slots_.size()) {
+            rehash(num_slots);
+        }
+    }
+
+  protected:
+    static constexpr size_t NONE = size_t(-1);
+    static constexpr size_t MIN_SLOTS = 8;
+    //Rehash when more than 3/4 of the slots are used
+    static constexpr size_t MAX_LOAD_NUM = 3;
+    static constexpr size_t MAX_LOAD_DEN = 4;
+
+    size_t home_slot(const K& key) const {
+        return size_t((uint64_t(size_t(key)) * 0x9e3779b97f4a7c15ull) >> shift_);
+    }
+
+    size_t find_slot(const K& key) const {
+        VTR_ASSERT_SAFE(key != K());
+        if (slots_.empty()) {
+            return NONE;
+        }
+        size_t mask = slots_.size() - 1;
+        for (size_t islot = home_slot(key);; islot = (islot + 1) & mask) {
+            const K& slot_key = KeyOf()(slots_[islot]);
+            if (slot_key == key) {
+                return islot;
+            }
+            if (slot_key == K()) {
+                return NONE;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the slot of key, inserting slot (which must have key) if there is none
+     *
+     * The bool is true if slot was inserted.
+     */
+    std::pair<size_t, bool> insert_slot(const K& key, Slot&& slot) {
+        VTR_ASSERT(key != K());
+        if ((size_ + 1) * MAX_LOAD_DEN > slots_.size() * MAX_LOAD_NUM) {
+            rehash(std::max(MIN_SLOTS, 2 * slots_.size()));
+        }
+        size_t mask = slots_.size() - 1;
+        size_t islot = home_slot(key);
+        for (;; islot = (islot + 1) & mask) {
+            const K& slot_key = KeyOf()(slots_[islot]);
+            if (slot_key == key) {
+                return {islot, false};
+            }
+            if (slot_key == K()) {
+                break;
+            }
+        }
+        slots_[islot] = std::move(slot);
+        ++size_;
+        return {islot, true};
+    }
+
+    void rehash(size_t num_slots) {
+        VTR_ASSERT_SAFE((num_slots & (num_slots - 1)) == 0);
+        std::vector<Slot> old_slots(num_slots);
+        std::swap(old_slots, slots_);
+
+        shift_ = 64;
+        for (size_t n = num_slots; n > 1; n /= 2) {
+            --shift_;
+        }
+
+        size_t mask = slots_.size() - 1;
+        for (Slot& slot : old_slots) {
+            const K& key = KeyOf()(slot);
+            if (key == K()) {
+                continue;
+            }
+            size_t islot = home_slot(key);
+            while (KeyOf()(slots_[islot]) != K()) {
+                islot = (islot + 1) & mask;
+            }
+            slots_[islot] = std::move(slot);
+        }
+    }
+
+  protected:
+    std::vector<Slot> slots_;
+    size_t size_ = 0;
+    int shift_ = 64;
+};
+
+template<class K, class T>
+struct pair_key {
+    const K& operator()(const std::pair<K, T>& slot) const { return slot.first; }
+};
+
+template<class K>
+struct identity_key {
+    const K& operator()(const K& slot) const { return slot; }
+};
+
+} // namespace detail
+
+/**
+ * @brief A std::unordered_map-like container keyed by vtr::StrongIds, using open addressing
+ *
+ * The entries (std::pair<K, T>) are stored in a single flat vector, so unlike the node based
+ * standard maps, inserting doesn't allocate (except to grow the table) and lookups touch few
+ * cache lines. It suits the hot, frequently cleared and refilled, maps from ids to small values
+ * of the packer and router. Unlike vtr::linear_map and vtr::vector_map, its size is proportional
+ * to the number of entries rather than to the largest key.
+ *
+ * K must be convertible to size_t, and K() (e.g. the INVALID() id) is reserved to mark empty slots.
+ * The key of an entry must not be modified through an iterator. Like std::unordered_map, the
+ * iteration order is unspecified; unlike it, inserting or erasing invalidates all the iterators and
+ * references to the entries.
+ */
+template<class K, class T>
+class id_hash_map : public detail::id_hash_table<K, std::pair<K, T>, detail::pair_key<K, T>> {
+    using base = detail::id_hash_table<K, std::pair<K, T>, detail::pair_key<K, T>>;
+
+  public:
+    typedef K key_type;
+    typedef T mapped_type;
+    typedef std::pair<K, T> value_type;
+    using typename base::const_iterator;
+    using typename base::iterator;
+
+    ///@brief Returns the value of key, inserting a default constructed one if there is none
+    T& operator[](const K& key) {
+        return this->slots_[this->insert_slot(key, value_type(key, T())).first].second;
+    }
+
+    ///@brief Returns the value of key, which must be in the map
+    const T& at(const K& key) const {
+        size_t islot = this->find_slot(key);
+        VTR_ASSERT(islot != base::NONE);
+        return this->slots_[islot].second;
+    }
+
+    ///@brief Inserts value if there is no entry for its key. Returns the entry, and whether it was inserted
+    std::pair<iterator, bool> insert(const value_type& value) {
+        auto result = this->insert_slot(value.first, value_type(value));
+        return {iterator(this->slots_.data() + result.first, this->slots_.data() + this->slots_.size()), result.second};
+    }
+};
+
+/**
+ * @brief A std::unordered_set-like container of vtr::StrongIds using open addressing
+ *
+ * See id_hash_map for the details and caveats.
+ */
+template<class K>
+class id_hash_set : public detail::id_hash_table<K, K, detail::identity_key<K>> {
+    using base = detail::id_hash_table<K, K, detail::identity_key<K>>;
+
+  public:
+    typedef K key_type;
+    typedef K value_type;
+    typedef typename base::const_iterator iterator;
+    typedef typename base::const_iterator const_iterator;
+
+    //Keys can't be modified through the iterators of a set
+    const_iterator begin() const { return base::begin(); }
+    const_iterator end() const { return base::end(); }
+
+    const_iterator find(const K& key) const { return base::find(key); }
+
+    ///@brief Inserts key. Returns its entry, and whether it was inserted
+    std::pair<const_iterator, bool> insert(const K& key) {
+        auto result = this->insert_slot(key, K(key));
+        return {const_iterator(this->slots_.data() + result.first, this->slots_.data() + this->slots_.size()), result.second};
+    }
+};
+
+} // namespace vtr
+
+#endif
@@ -1,6 +1,10 @@
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <math.h>
+#include <vector>
 
 #include "vtr_assert.h"
 #include "vtr_list.h"
@@ -15,6 +19,12 @@
 #    include <malloc.h>
 #endif
 
+#ifdef __linux__
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
 namespace vtr {
 
 #ifndef __GLIBC__
@@ -175,4 +185,130 @@ void free_chunk_memory(t_chunk* chunk_info) {
     chunk_info->next_mem_loc_ptr = nullptr;
 }
 
+static std::atomic<e_large_alloc_policy> f_large_alloc_policy(e_large_alloc_policy::DEFAULT);
+
+#ifdef __linux__
+namespace {
+
+constexpr size_t HUGE_PAGE_BYTES = 2 * 1024 * 1024;
+
+//From <numaif.h>, which would require libnuma
+constexpr int MPOL_INTERLEAVE_MODE = 3;
+constexpr unsigned long MPOL_F_MEMS_ALLOWED_FLAG = 1 << 2;
+constexpr unsigned long MAX_NUMA_NODES = 1024;
+
+size_t round_up_to_huge_pages(size_t bytes) {
+    return (bytes + HUGE_PAGE_BYTES - 1) / HUGE_PAGE_BYTES * HUGE_PAGE_BYTES;
+}
+
+//Maps bytes (a multiple of HUGE_PAGE_BYTES) of anonymous memory aligned to HUGE_PAGE_BYTES,
+//so it can be backed by transparent huge pages. Returns nullptr on failure.
+void* map_huge_page_aligned(size_t bytes) {
+    //Over-map and trim the mapping to the first aligned address
+    size_t mapped_bytes = bytes + HUGE_PAGE_BYTES;
+    void* mapped = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) {
+        return nullptr;
+    }
+
+    uintptr_t start = reinterpret_cast<uintptr_t>(mapped);
+    uintptr_t aligned = (start + HUGE_PAGE_BYTES - 1) & ~(uintptr_t(HUGE_PAGE_BYTES) - 1);
+    if (aligned > start) {
+        munmap(mapped, aligned - start);
+    }
+    size_t tail_bytes = (start + mapped_bytes) - (aligned + bytes);
+    if (tail_bytes > 0) {
+        munmap(reinterpret_cast<void*>(aligned + bytes), tail_bytes);
+    }
+    return reinterpret_cast<void*>(aligned);
+}
+
+//Interleaves the (not yet touched) pages of the mapping across the NUMA nodes this process may use
+void interleave_numa_nodes(void* ptr, size_t bytes) {
+    constexpr size_t BITS_PER_WORD = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> allowed_nodes(MAX_NUMA_NODES / BITS_PER_WORD, 0);
+    if (syscall(SYS_get_mempolicy, nullptr, allowed_nodes.data(), MAX_NUMA_NODES, nullptr, MPOL_F_MEMS_ALLOWED_FLAG) != 0) {
+        return; //Not a NUMA kernel
+    }
+    syscall(SYS_mbind, ptr, bytes, MPOL_INTERLEAVE_MODE, allowed_nodes.data(), MAX_NUMA_NODES, 0);
+}
+
+} // namespace
+#endif
+
+void set_large_alloc_policy(e_large_alloc_policy policy) {
+    f_large_alloc_policy.store(policy, std::memory_order_relaxed);
+}
+
+e_large_alloc_policy large_alloc_policy() {
+    return f_large_alloc_policy.load(std::memory_order_relaxed);
+}
+
+void* malloc_large(size_t bytes, size_t align) {
+#ifdef __linux__
+    if (bytes >= LARGE_ALLOC_MIN_BYTES) {
+        VTR_ASSERT(align <= HUGE_PAGE_BYTES);
+        size_t mapped_bytes = round_up_to_huge_pages(bytes);
+        e_large_alloc_policy policy = large_alloc_policy();
+
+        void* ptr = nullptr;
+#    ifdef MAP_HUGETLB
+        if (policy == e_large_alloc_policy::HUGE_PAGES) {
+            ptr = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            if (ptr == MAP_FAILED) {
+                static std::atomic<bool> warned(false);
+                if (!warned.exchange(true)) {
+                    VTR_LOG_WARN("Failed to allocate explicit huge pages (are any reserved in /proc/sys/vm/nr_hugepages?), using transparent huge pages instead\n");
+                }
+                ptr = nullptr;
+            }
+        }
+#    endif
+
+        if (!ptr) {
+            ptr = map_huge_page_aligned(mapped_bytes);
+            if (!ptr) {
+                throw std::bad_alloc();
+            }
+#    ifdef MADV_HUGEPAGE
+            if (policy == e_large_alloc_policy::TRANSPARENT_HUGE_PAGES || policy == e_large_alloc_policy::HUGE_PAGES) {
+                madvise(ptr, mapped_bytes, MADV_HUGEPAGE);
+            }
+#    endif
+            if (policy == e_large_alloc_policy::NUMA_INTERLEAVE) {
+                interleave_numa_nodes(ptr, mapped_bytes);
+            }
+        }
+        return ptr;
+    }
+#endif
+
+    void* data;
+    if (vtr::memalign(&data, std::max(align, alignof(std::max_align_t)), bytes) != 0) {
+        throw std::bad_alloc();
+    }
+    return data;
+}
+
+void free_large(void* ptr, size_t bytes) {
+    if (!ptr) {
+        return;
+    }
+
+#ifdef __linux__
+    if (bytes >= LARGE_ALLOC_MIN_BYTES) {
+        munmap(ptr, round_up_to_huge_pages(bytes));
+        return;
+    }
+#else
+    (void)bytes;
+#endif
+
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
 } // namespace vtr
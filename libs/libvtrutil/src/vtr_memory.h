@@ -146,6 +146,76 @@ bool operator==(const aligned_allocator<T>&, const aligned_allocator<T>&) {
     return true;
 }
 
+/**
+ * @brief How the memory of large arrays (see large_array_allocator) is allocated
+ *
+ * On dual-socket hosts the parallel router spends much of its time on TLB misses and accesses to
+ * the memory of the other socket, since the large arrays it reads (e.g. the RR graph) are built
+ * (and so placed on the memory of the socket of) the main thread.
+ */
+enum class e_large_alloc_policy {
+    DEFAULT,                ///<Regular pages, placed on the memory of the thread which first touches them
+    TRANSPARENT_HUGE_PAGES, ///<2 MiB aligned, and marked for transparent huge pages (madvise(MADV_HUGEPAGE))
+    HUGE_PAGES,             ///<Explicit (hugetlbfs) huge pages, falling back to transparent huge pages if none are reserved
+    NUMA_INTERLEAVE         ///<Pages interleaved across the memory of all the allowed NUMA nodes
+};
+
+///@brief Sets the policy used for subsequent allocations of large arrays
+void set_large_alloc_policy(e_large_alloc_policy policy);
+
+///@brief Returns the policy used for allocations of large arrays
+e_large_alloc_policy large_alloc_policy();
+
+///@brief Allocations of at least this many bytes are allocated as large arrays
+constexpr size_t LARGE_ALLOC_MIN_BYTES = 2 * 1024 * 1024;
+
+/**
+ * @brief Allocates bytes (aligned to at least align) according to the large allocation policy
+ *
+ * Allocations smaller than LARGE_ALLOC_MIN_BYTES (or on platforms without mmap()) are regular
+ * aligned allocations. Must be freed with free_large() with the same number of bytes.
+ */
+void* malloc_large(size_t bytes, size_t align);
+
+///@brief Frees an allocation of malloc_large()
+void free_large(void* ptr, size_t bytes);
+
+/**
+ * @brief large_array_allocator is a STL allocator for large arrays (e.g. per RR node or edge data)
+ *
+ * Large allocations follow the policy set by set_large_alloc_policy(), while small allocations are
+ * aligned like aligned_allocator.
+ */
+template<class T>
+struct large_array_allocator {
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    pointer allocate(size_type n, const void* /*hint*/ = 0) {
+        return static_cast<pointer>(malloc_large(sizeof(T) * n, alignof(T)));
+    }
+
+    void deallocate(T* p, size_type n) {
+        free_large(p, sizeof(T) * n);
+    }
+};
+
+///@brief All large_array_allocators are the same, since they have no state
+template<typename T, typename U>
+bool operator==(const large_array_allocator<T>&, const large_array_allocator<U>&) {
+    return true;
+}
+
+template<typename T, typename U>
+bool operator!=(const large_array_allocator<T>&, const large_array_allocator<U>&) {
+    return false;
+}
+
 } // namespace vtr
 
 #endif
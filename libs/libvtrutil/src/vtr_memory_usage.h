@@ -0,0 +1,139 @@
+#ifndef VTR_MEMORY_USAGE_H
+#define VTR_MEMORY_USAGE_H
+#include <cstddef>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "vtr_ndmatrix.h"
+#include "vtr_vector.h"
+#include "vtr_vector_map.h"
+
+/**
+ * @file
+ * @brief Estimates of the heap memory held by containers
+ *
+ * These are used to account for the memory of large data structures (e.g. the RR graph or
+ * the netlists), which is more useful for deciding what to compact than the process max RSS.
+ *
+ * Contiguous containers report their capacity (including unused capacity), while node based
+ * containers report an estimate of their nodes and buckets. The memory of the elements
+ * themselves is included for nested std::vectors but not for other element types (e.g. long
+ * std::string keys), so the results are lower bounds.
+ */
+
+namespace vtr {
+
+namespace detail {
+///@brief Estimated bookkeeping of a node of a std::map/std::set (colour and three pointers)
+constexpr size_t TREE_NODE_OVERHEAD = 4 * sizeof(void*);
+///@brief Estimated bookkeeping of a node of a std::unordered_map/std::unordered_set (next pointer and cached hash)
+constexpr size_t HASH_NODE_OVERHEAD = 2 * sizeof(void*);
+} // namespace detail
+
+///@brief Returns the bytes held by a std::vector
+template<typename T, typename Alloc>
+size_t memory_usage(const std::vector<T, Alloc>& vec) {
+    return vec.capacity() * sizeof(T);
+}
+
+///@brief Returns the bytes held by a std::vector<bool>, which stores one bit per element
+template<typename Alloc>
+size_t memory_usage(const std::vector<bool, Alloc>& vec) {
+    return (vec.capacity() + 7) / 8;
+}
+
+///@brief Returns the bytes held by a std::vector of std::vectors, including the inner vectors
+template<typename T, typename InnerAlloc, typename Alloc>
+size_t memory_usage(const std::vector<std::vector<T, InnerAlloc>, Alloc>& vecs) {
+    size_t bytes = vecs.capacity() * sizeof(std::vector<T, InnerAlloc>);
+    for (const auto& vec : vecs) {
+        bytes += memory_usage(vec);
+    }
+    return bytes;
+}
+
+///@brief Returns the bytes held by a vtr::vector
+template<typename K, typename V, typename Alloc>
+size_t memory_usage(const vector<K, V, Alloc>& vec) {
+    return vec.capacity() * sizeof(V);
+}
+
+///@brief Returns the bytes held by a vtr::vector of bools, which stores one bit per element
+template<typename K, typename Alloc>
+size_t memory_usage(const vector<K, bool, Alloc>& vec) {
+    return (vec.capacity() + 7) / 8;
+}
+
+///@brief Returns the bytes held by a vtr::vector of std::vectors, including the inner vectors
+template<typename K, typename T, typename InnerAlloc, typename Alloc>
+size_t memory_usage(const vector<K, std::vector<T, InnerAlloc>, Alloc>& vecs) {
+    size_t bytes = vecs.capacity() * sizeof(std::vector<T, InnerAlloc>);
+    for (const auto& vec : vecs) {
+        bytes += memory_usage(vec);
+    }
+    return bytes;
+}
+
+///@brief Returns the bytes held by a vtr::vector_map
+template<typename K, typename V, typename Sentinel>
+size_t memory_usage(const vector_map<K, V, Sentinel>& map) {
+    return map.capacity() * sizeof(V);
+}
+
+///@brief Returns the bytes held by a vtr::vector_map of bools, which stores one bit per element
+template<typename K, typename Sentinel>
+size_t memory_usage(const vector_map<K, bool, Sentinel>& map) {
+    return (map.capacity() + 7) / 8;
+}
+
+///@brief Returns the bytes held by a vtr::vector_map of std::vectors, including the inner vectors
+template<typename K, typename T, typename Alloc, typename Sentinel>
+size_t memory_usage(const vector_map<K, std::vector<T, Alloc>, Sentinel>& map) {
+    size_t bytes = map.capacity() * sizeof(std::vector<T, Alloc>);
+    for (const auto& vec : map) {
+        bytes += memory_usage(vec);
+    }
+    return bytes;
+}
+
+///@brief Returns the bytes held by a vtr::NdMatrix
+template<typename T, size_t N, typename MatrixAlloc>
+size_t memory_usage(const NdMatrix<T, N, MatrixAlloc>& matrix) {
+    return matrix.size() * sizeof(T);
+}
+
+///@brief Returns the bytes held by a vtr::NdMatrix of std::vectors, including the inner vectors
+template<typename T, typename Alloc, size_t N, typename MatrixAlloc>
+size_t memory_usage(const NdMatrix<std::vector<T, Alloc>, N, MatrixAlloc>& matrix) {
+    size_t bytes = matrix.size() * sizeof(std::vector<T, Alloc>);
+    for (size_t i = 0; i < matrix.size(); ++i) {
+        bytes += memory_usage(matrix.get(i));
+    }
+    return bytes;
+}
+
+///@brief Returns the (estimated) bytes held by a std::unordered_map
+template<typename K, typename V, typename Hash, typename Equal, typename Alloc>
+size_t memory_usage(const std::unordered_map<K, V, Hash, Equal, Alloc>& map) {
+    return map.size() * (sizeof(typename std::unordered_map<K, V, Hash, Equal, Alloc>::value_type) + detail::HASH_NODE_OVERHEAD)
+           + map.bucket_count() * sizeof(void*);
+}
+
+///@brief Returns the (estimated) bytes held by a std::unordered_set
+template<typename K, typename Hash, typename Equal, typename Alloc>
+size_t memory_usage(const std::unordered_set<K, Hash, Equal, Alloc>& set) {
+    return set.size() * (sizeof(K) + detail::HASH_NODE_OVERHEAD) + set.bucket_count() * sizeof(void*);
+}
+
+///@brief Returns the (estimated) bytes held by a std::map
+template<typename K, typename V, typename Compare, typename Alloc>
+size_t memory_usage(const std::map<K, V, Compare, Alloc>& map) {
+    return map.size() * (sizeof(typename std::map<K, V, Compare, Alloc>::value_type) + detail::TREE_NODE_OVERHEAD);
+}
+
+} // namespace vtr
+
+#endif
@@ -142,8 +142,11 @@ class NdMatrixProxy<T, 1> {
  * The indicies are calculated based on the dimensions to access the appropriate elements.
  * Since the indexing calculations are visible to the compiler at compile time they can be
  * optimized to be efficient.
+ *
+ * The elements are allocated with Allocator (e.g. vtr::arena_allocator, to allocate them from
+ * the arena of a stage of the flow).
  */
-template<typename T, size_t N>
+template<typename T, size_t N, typename Allocator = std::allocator<T>>
 class NdMatrixBase {
   public:
     static_assert(N >= 1, "Minimum dimension 1");
@@ -153,18 +156,29 @@ class NdMatrixBase {
         clear();
     }
 
+    ///@brief An empty matrix (all dimensions size zero) using the specified allocator
+    explicit NdMatrixBase(const Allocator& allocator)
+        : allocator_(allocator) {
+        clear();
+    }
+
     /**
      * @brief Specified dimension sizes:
      *
      *      [0..dim_sizes[0])
      *      [0..dim_sizes[1])
      *      ...
-     *      with optional fill value
+     *      with optional fill value and allocator
      */
-    NdMatrixBase(std::array<size_t, N> dim_sizes, T value = T()) {
+    NdMatrixBase(std::array<size_t, N> dim_sizes, T value = T(), const Allocator& allocator = Allocator())
+        : allocator_(allocator) {
         resize(dim_sizes, value);
     }
 
+    ~NdMatrixBase() {
+        free_data();
+    }
+
   public: //Accessors
     ///@brief Returns the size of the matrix (number of elements)
     size_t size() const {
@@ -215,10 +229,15 @@ class NdMatrixBase {
         return data_[i];
     }
 
+    ///@brief Returns the allocator of the elements
+    Allocator get_allocator() const {
+        return allocator_;
+    }
+
   public: //Mutators
     ///@brief Set all elements to 'value'
     void fill(T value) {
-        std::fill(data_.get(), data_.get() + size(), value);
+        std::fill(data_, data_ + size(), value);
     }
 
     /**
@@ -244,7 +263,7 @@ class NdMatrixBase {
 
     ///@brief Reset the matrix to size zero
     void clear() {
-        data_.reset(nullptr);
+        free_data();
         dim_sizes_.fill(0);
         dim_strides_.fill(0);
         size_ = 0;
@@ -253,13 +272,13 @@ class NdMatrixBase {
   public: //Lifetime management
     ///@brief Copy constructor
     NdMatrixBase(const NdMatrixBase& other)
-        : NdMatrixBase(other.dim_sizes_) {
-        std::copy(other.data_.get(), other.data_.get() + other.size(), data_.get());
+        : NdMatrixBase(other.dim_sizes_, T(), std::allocator_traits<Allocator>::select_on_container_copy_construction(other.allocator_)) {
+        std::copy(other.data_, other.data_ + other.size(), data_);
     }
 
     ///@brief Move constructor
     NdMatrixBase(NdMatrixBase&& other)
-        : NdMatrixBase() {
+        : NdMatrixBase(other.allocator_) {
         swap(*this, other);
     }
 
@@ -274,18 +293,43 @@ class NdMatrixBase {
     }
 
     ///@brief Swap two NdMatrixBase objects
-    friend void swap(NdMatrixBase<T, N>& m1, NdMatrixBase<T, N>& m2) {
+    friend void swap(NdMatrixBase& m1, NdMatrixBase& m2) {
         using std::swap;
         swap(m1.size_, m2.size_);
         swap(m1.dim_sizes_, m2.dim_sizes_);
         swap(m1.dim_strides_, m2.dim_strides_);
         swap(m1.data_, m2.data_);
+        swap(m1.data_size_, m2.data_size_);
+        swap(m1.allocator_, m2.allocator_);
     }
 
   private:
-    ///@brief Allocate space for all the elements
+    ///@brief Allocate space for all the elements (which are value initialized)
     void alloc() {
-        data_ = std::make_unique<T[]>(size());
+        free_data();
+        if (size_ == 0) {
+            return;
+        }
+
+        data_ = std::allocator_traits<Allocator>::allocate(allocator_, size_);
+        try {
+            std::uninitialized_value_construct_n(data_, size_);
+        } catch (...) {
+            std::allocator_traits<Allocator>::deallocate(allocator_, data_, size_);
+            data_ = nullptr;
+            throw;
+        }
+        data_size_ = size_;
+    }
+
+    ///@brief Destroy and free all the elements
+    void free_data() {
+        if (data_) {
+            std::destroy_n(data_, data_size_);
+            std::allocator_traits<Allocator>::deallocate(allocator_, data_, data_size_);
+        }
+        data_ = nullptr;
+        data_size_ = 0;
     }
 
     ///@brief Returns the size of the matrix (number of elements) calculated from the current dimensions
@@ -302,7 +346,9 @@ class NdMatrixBase {
     size_t size_ = 0;
     std::array<size_t, N> dim_sizes_;
     std::array<size_t, N> dim_strides_;
-    std::unique_ptr<T[]> data_ = nullptr;
+    T* data_ = nullptr;
+    size_t data_size_ = 0; ///<Number of elements allocated in data_
+    Allocator allocator_;
 };
 
 /**
@@ -335,14 +381,14 @@ class NdMatrixBase {
  *       //Resizing an existing matrix (all elements set to value 88)
  *       m3.resize({15,55}, 88)
  */
-template<typename T, size_t N>
-class NdMatrix : public NdMatrixBase<T, N> {
+template<typename T, size_t N, typename Allocator = std::allocator<T>>
+class NdMatrix : public NdMatrixBase<T, N, Allocator> {
     //General case
     static_assert(N >= 2, "Minimum dimension 2");
 
   public:
     ///@brief Use the base constructors
-    using NdMatrixBase<T, N>::NdMatrixBase;
+    using NdMatrixBase<T, N, Allocator>::NdMatrixBase;
 
   public:
     /**
@@ -359,7 +405,7 @@ class NdMatrix : public NdMatrixBase<T, N> {
         return NdMatrixProxy<T, N - 1>(
             this->dim_sizes_.data() + 1,                        //Pass the dimension information
             this->dim_strides_.data() + 1,                      //Pass the stride for the next dimension
-            this->data_.get() + this->dim_strides_[0] * index); //Advance to index in this dimension
+            this->data_ + this->dim_strides_[0] * index); //Advance to index in this dimension
     }
 
     /**
@@ -369,7 +415,7 @@ class NdMatrix : public NdMatrixBase<T, N> {
      */
     NdMatrixProxy<T, N - 1> operator[](size_t index) {
         //Call the const version, since returned by value don't need to worry about const
-        return const_cast<const NdMatrix<T, N>*>(this)->operator[](index);
+        return const_cast<const NdMatrix*>(this)->operator[](index);
     }
 };
 
@@ -378,11 +424,11 @@ class NdMatrix : public NdMatrixBase<T, N> {
  *
  * This is considered a specialization for N=1
  */
-template<typename T>
-class NdMatrix<T, 1> : public NdMatrixBase<T, 1> {
+template<typename T, typename Allocator>
+class NdMatrix<T, 1, Allocator> : public NdMatrixBase<T, 1, Allocator> {
   public:
     ///@brief Use the base constructors
-    using NdMatrixBase<T, 1>::NdMatrixBase;
+    using NdMatrixBase<T, 1, Allocator>::NdMatrixBase;
 
   public:
     ///@brief Access an element (immutable)
@@ -397,7 +443,7 @@ class NdMatrix<T, 1> : public NdMatrixBase<T, 1> {
     ///@brief Access an element (mutable)
     T& operator[](size_t index) {
         //Call the const version, and cast away const-ness
-        return const_cast<T&>(const_cast<const NdMatrix<T, 1>*>(this)->operator[](index));
+        return const_cast<T&>(const_cast<const NdMatrix*>(this)->operator[](index));
     }
 };
 
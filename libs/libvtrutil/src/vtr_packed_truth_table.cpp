@@ -0,0 +1,142 @@
+#include "vtr_packed_truth_table.h"
+
+#include <utility>
+
+#include "vtr_assert.h"
+
+namespace vtr {
+
+///@brief The minterms (bits of a word) where input i is TRUE, for the inputs inside a word
+static constexpr uint64_t kInputMasks[] = {
+    0xAAAAAAAAAAAAAAAAull,
+    0xCCCCCCCCCCCCCCCCull,
+    0xF0F0F0F0F0F0F0F0ull,
+    0xFF00FF00FF00FF00ull,
+    0xFFFF0000FFFF0000ull,
+    0xFFFFFFFF00000000ull};
+
+PackedTruthTable::PackedTruthTable(size_t num_inputs, bool value)
+    : num_inputs_(num_inputs) {
+    size_t num_words = num_inputs <= kWordInputs ? 1 : size_t(1) << (num_inputs - kWordInputs);
+    words_.assign(num_words, value ? word_mask() : 0);
+}
+
+uint64_t PackedTruthTable::word_mask() const {
+    if (num_inputs_ >= kWordInputs) return ~uint64_t(0);
+    return (uint64_t(1) << num_minterms()) - 1;
+}
+
+void PackedTruthTable::set_cube(const LogicValue* cube, size_t cube_size, bool value) {
+    VTR_ASSERT(cube_size <= num_inputs_);
+
+    //The minterms of the cube inside each word, and the words it covers
+    uint64_t in_word = word_mask();
+    size_t word_care = 0;
+    size_t word_value = 0;
+    for (size_t i = 0; i < num_inputs_; ++i) {
+        LogicValue input_value = i < cube_size ? cube[i] : LogicValue::FALSE;
+        if (input_value == LogicValue::DONT_CARE) continue;
+        VTR_ASSERT(input_value == LogicValue::TRUE || input_value == LogicValue::FALSE);
+
+        bool is_true = input_value == LogicValue::TRUE;
+        if (i < kWordInputs) {
+            in_word &= is_true ? kInputMasks[i] : ~kInputMasks[i];
+        } else {
+            size_t word_bit = size_t(1) << (i - kWordInputs);
+            word_care |= word_bit;
+            if (is_true) word_value |= word_bit;
+        }
+    }
+
+    for (size_t iword = 0; iword < words_.size(); ++iword) {
+        if ((iword & word_care) != word_value) continue;
+        if (value) {
+            words_[iword] |= in_word;
+        } else {
+            words_[iword] &= ~in_word;
+        }
+    }
+}
+
+void PackedTruthTable::swap_inputs(size_t a, size_t b) {
+    VTR_ASSERT(a < num_inputs_ && b < num_inputs_);
+    if (a == b) return;
+    if (a > b) std::swap(a, b);
+
+    if (b < kWordInputs) {
+        //Both inside the words: exchange the minterms where a=1,b=0 with those where a=0,b=1
+        size_t shift = (size_t(1) << b) - (size_t(1) << a);
+        uint64_t low = kInputMasks[a] & ~kInputMasks[b];
+        for (uint64_t& word : words_) {
+            uint64_t diff = ((word >> shift) ^ word) & low;
+            word ^= diff ^ (diff << shift);
+        }
+    } else if (a < kWordInputs) {
+        //a inside the words, b selecting them: exchange the minterms where a=1 in the b=0 words
+        //with those where a=0 in the b=1 words
+        size_t shift = size_t(1) << a;
+        size_t b_bit = size_t(1) << (b - kWordInputs);
+        for (size_t iword = 0; iword < words_.size(); ++iword) {
+            if (iword & b_bit) continue;
+            uint64_t& word0 = words_[iword];
+            uint64_t& word1 = words_[iword | b_bit];
+            uint64_t diff = ((word0 >> shift) ^ word1) & ~kInputMasks[a];
+            word1 ^= diff;
+            word0 ^= diff << shift;
+        }
+    } else {
+        //Both selecting words: exchange the words where a=1,b=0 with those where a=0,b=1
+        size_t a_bit = size_t(1) << (a - kWordInputs);
+        size_t b_bit = size_t(1) << (b - kWordInputs);
+        for (size_t iword = 0; iword < words_.size(); ++iword) {
+            if ((iword & a_bit) && !(iword & b_bit)) {
+                std::swap(words_[iword], words_[iword ^ a_bit ^ b_bit]);
+            }
+        }
+    }
+}
+
+void PackedTruthTable::permute_inputs(const std::vector<int>& permutation) {
+    VTR_ASSERT(permutation.size() == num_inputs_);
+
+    //Where each of the original inputs currently is, and which original input is at each position
+    std::vector<size_t> position(num_inputs_);
+    std::vector<size_t> input_at(num_inputs_);
+    for (size_t i = 0; i < num_inputs_; ++i) {
+        position[i] = i;
+        input_at[i] = i;
+    }
+
+    for (size_t i = 0; i < num_inputs_; ++i) {
+        VTR_ASSERT(permutation[i] >= 0 && size_t(permutation[i]) < num_inputs_);
+        size_t target = permutation[i];
+        size_t current = position[i];
+        if (current == target) continue;
+
+        swap_inputs(current, target);
+
+        size_t displaced = input_at[target];
+        input_at[target] = i;
+        input_at[current] = displaced;
+        position[i] = target;
+        position[displaced] = current;
+    }
+}
+
+bool PackedTruthTable::is_constant(bool value) const {
+    uint64_t constant_word = value ? word_mask() : 0;
+    for (uint64_t word : words_) {
+        if (word != constant_word) return false;
+    }
+    return true;
+}
+
+std::vector<LogicValue> PackedTruthTable::to_lut_mask() const {
+    std::vector<LogicValue> mask(num_minterms());
+    for (size_t minterm = 0; minterm < mask.size(); ++minterm) {
+        mask[minterm] = get(minterm) ? LogicValue::TRUE : LogicValue::FALSE;
+    }
+    return mask;
+}
+
+} // namespace vtr
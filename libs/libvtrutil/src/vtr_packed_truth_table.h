@@ -0,0 +1,101 @@
+#ifndef VTR_PACKED_TRUTH_TABLE_H
+#define VTR_PACKED_TRUTH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "vtr_logic.h"
+
+namespace vtr {
+
+/**
+ * @brief A single-output logic function stored as its minterm values, packed 64 to a word
+ *
+ * Minterm m is the value of the function when input i has the value of bit i of m
+ * (the LUT mask order). A function of num_inputs inputs takes max(1, 2^num_inputs / 64) words:
+ * a single word up to 6 inputs, and 4 words for an 8-input LUT, instead of a cube list of
+ * LogicValue vectors.
+ *
+ * The operations (setting a cube, swapping or permuting inputs, comparisons) work a whole word
+ * at a time, using the variable masks of the inputs inside a word.
+ */
+class PackedTruthTable {
+  public:
+    ///@brief An empty function of no inputs (a constant zero)
+    PackedTruthTable() = default;
+
+    ///@brief A constant \p value function of \p num_inputs inputs
+    explicit PackedTruthTable(size_t num_inputs, bool value = false);
+
+    size_t num_inputs() const { return num_inputs_; }
+    size_t num_minterms() const { return size_t(1) << num_inputs_; }
+
+    ///@brief Returns the function's value at \p minterm
+    bool get(size_t minterm) const {
+        return (words_[minterm / kWordBits] >> (minterm % kWordBits)) & 1;
+    }
+
+    ///@brief Sets the function's value at \p minterm
+    void set(size_t minterm, bool value) {
+        uint64_t bit = uint64_t(1) << (minterm % kWordBits);
+        if (value) {
+            words_[minterm / kWordBits] |= bit;
+        } else {
+            words_[minterm / kWordBits] &= ~bit;
+        }
+    }
+
+    /**
+     * @brief Sets the function to \p value over all the minterms of \p cube
+     *
+     * cube[i] is the value of input i (TRUE, FALSE or DONT_CARE). The cube may have fewer
+     * entries than there are inputs, the inputs past its end being FALSE.
+     */
+    void set_cube(const LogicValue* cube, size_t cube_size, bool value);
+    void set_cube(const std::vector<LogicValue>& cube, bool value) {
+        set_cube(cube.data(), cube.size(), value);
+    }
+
+    ///@brief Exchanges inputs \p a and \p b
+    void swap_inputs(size_t a, size_t b);
+
+    /**
+     * @brief Permutes the inputs: permutation[i] is the input which input i moves to
+     *
+     * permutation must map the inputs [0..num_inputs-1] to distinct inputs [0..num_inputs-1].
+     * Done as a sequence of swap_inputs(), at most num_inputs-1 of them.
+     */
+    void permute_inputs(const std::vector<int>& permutation);
+
+    ///@brief Is the function constant \p value?
+    bool is_constant(bool value) const;
+
+    ///@brief The minterm values as a LUT mask [0..num_minterms-1]
+    std::vector<LogicValue> to_lut_mask() const;
+
+    const std::vector<uint64_t>& words() const { return words_; }
+
+    bool operator==(const PackedTruthTable& other) const {
+        return num_inputs_ == other.num_inputs_ && words_ == other.words_;
+    }
+    bool operator!=(const PackedTruthTable& other) const {
+        return !(*this == other);
+    }
+
+  private:
+    static constexpr size_t kWordBits = 64;
+    ///@brief Inputs whose value is given by the bit index in a word (the others select the word)
+    static constexpr size_t kWordInputs = 6;
+
+    ///@brief The valid bits of the (single) word of a function with fewer than kWordInputs inputs
+    uint64_t word_mask() const;
+
+  private:
+    size_t num_inputs_ = 0;
+    std::vector<uint64_t> words_ = std::vector<uint64_t>(1, 0);
+};
+
+} // namespace vtr
+
+#endif
@@ -0,0 +1,16 @@
+#include "vtr_profiler_markers.h"
+
+#if defined(VTR_ENABLE_ITT_MARKERS)
+
+namespace vtr {
+namespace detail {
+
+__itt_domain* itt_domain() {
+    static __itt_domain* const domain = __itt_domain_create("VTR");
+    return domain;
+}
+
+} // namespace detail
+} // namespace vtr
+
+#endif
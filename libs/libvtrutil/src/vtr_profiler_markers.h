@@ -0,0 +1,107 @@
+#ifndef VTR_PROFILER_MARKERS_H
+#define VTR_PROFILER_MARKERS_H
+
+/**
+ * @file
+ * @brief Markers which let external profilers attribute time to parts of the flow
+ *
+ * Sampling profilers (e.g. perf or VTune) show where time is spent by function, but not in
+ * which router iteration, net or annealing temperature. These markers annotate such regions,
+ * and are compiled in with the VTR_PROFILER_MARKERS CMake option:
+ *
+ *  - itt:  Intel ITT tasks (in the "VTR" domain), shown on the timeline of VTune. The
+ *          argument of a marker is attached to its task as "<name>_arg" metadata.
+ *  - usdt: USDT (SystemTap style) probes in the "vtr" provider, named <name>__begin and
+ *          <name>__end, with the argument of a marker passed to its begin probe. These can
+ *          be traced with perf (e.g. 'perf probe sdt_vtr:route_net__begin') or bpftrace.
+ *  - none: The markers compile to nothing (the default).
+ *
+ * For example:
+ *
+ *       for (int itry = 1; itry <= max_iterations; ++itry) {
+ *           VTR_PROFILE_SCOPE_ARG(route_iteration, itry);
+ *
+ *           //Do the iteration
+ *       }
+ *
+ * The name must be an identifier (it is used to name the USDT probes), and at most one
+ * marker can be used per scope. Markers are cheap, but not free when compiled in, so they
+ * are only placed around regions that take at least a few microseconds (e.g. a net or a swap).
+ */
+
+#if defined(VTR_ENABLE_ITT_MARKERS)
+
+#    include <ittnotify.h>
+
+namespace vtr {
+namespace detail {
+
+///@brief Returns the ITT domain of VTR's tasks
+__itt_domain* itt_domain();
+
+///@brief An ITT task for the lifetime of the object
+class ScopedIttTask {
+  public:
+    explicit ScopedIttTask(__itt_string_handle* name) {
+        __itt_task_begin(itt_domain(), __itt_null, __itt_null, name);
+    }
+
+    ScopedIttTask(__itt_string_handle* name, __itt_string_handle* arg_name, long long arg)
+        : ScopedIttTask(name) {
+        __itt_metadata_add(itt_domain(), __itt_null, arg_name, __itt_metadata_s64, 1, &arg);
+    }
+
+    ~ScopedIttTask() {
+        __itt_task_end(itt_domain());
+    }
+
+    ScopedIttTask(const ScopedIttTask&) = delete;
+    ScopedIttTask& operator=(const ScopedIttTask&) = delete;
+};
+
+} // namespace detail
+} // namespace vtr
+
+#    define VTR_PROFILE_SCOPE(name)                                                                \
+        static __itt_string_handle* const vtr_itt_name_##name = __itt_string_handle_create(#name); \
+        vtr::detail::ScopedIttTask vtr_itt_task_##name(vtr_itt_name_##name)
+
+#    define VTR_PROFILE_SCOPE_ARG(name, arg)                                                             \
+        static __itt_string_handle* const vtr_itt_name_##name = __itt_string_handle_create(#name);       \
+        static __itt_string_handle* const vtr_itt_arg_##name = __itt_string_handle_create(#name "_arg"); \
+        vtr::detail::ScopedIttTask vtr_itt_task_##name(vtr_itt_name_##name, vtr_itt_arg_##name, static_cast<long long>(arg))
+
+#elif defined(VTR_ENABLE_USDT_MARKERS)
+
+#    include <sys/sdt.h>
+
+#    define VTR_PROFILE_SCOPE(name)             \
+        DTRACE_PROBE(vtr, name##__begin);       \
+        struct vtr_usdt_scope_##name {          \
+            ~vtr_usdt_scope_##name() {          \
+                DTRACE_PROBE(vtr, name##__end); \
+            }                                   \
+        } vtr_usdt_scope_var_##name
+
+#    define VTR_PROFILE_SCOPE_ARG(name, arg)                            \
+        DTRACE_PROBE1(vtr, name##__begin, static_cast<long long>(arg)); \
+        struct vtr_usdt_scope_##name {                                  \
+            ~vtr_usdt_scope_##name() {                                  \
+                DTRACE_PROBE(vtr, name##__end);                         \
+            }                                                           \
+        } vtr_usdt_scope_var_##name
+
+#else
+
+#    define VTR_PROFILE_SCOPE(name) \
+        do {                        \
+        } while (false)
+
+#    define VTR_PROFILE_SCOPE_ARG(name, arg) \
+        do {                                 \
+            (void)sizeof(arg);               \
+        } while (false)
+
+#endif
+
+#endif
@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <vector>
 #include <iterator>
+#include <memory>
 
 #include "vtr_assert.h"
 #include "vtr_array_view.h"
@@ -32,8 +33,11 @@ namespace vtr {
  * after another).
  * 
  * Expects Index0 and Index1 to be convertable to size_t.
+ *
+ * The elements (and row offsets) are allocated with Allocator (e.g. vtr::arena_allocator,
+ * to allocate them from the arena of a stage of the flow).
  */
-template<typename T, typename Index0 = size_t, typename Index1 = size_t>
+template<typename T, typename Index0 = size_t, typename Index1 = size_t, typename Allocator = std::allocator<T>>
 class FlatRaggedMatrix {
   public:
     ///@brief default constructor
@@ -46,15 +50,16 @@ class FlatRaggedMatrix {
      * 'row_length_callback' with the associated row index.
      */
     template<class Callback>
-    FlatRaggedMatrix(size_t nrows, Callback& row_length_callback, T default_value = T())
+    FlatRaggedMatrix(size_t nrows, Callback& row_length_callback, T default_value = T(), const Allocator& allocator = Allocator())
         : FlatRaggedMatrix(RowLengthIterator<Callback>(0, row_length_callback),
                            RowLengthIterator<Callback>(nrows, row_length_callback),
-                           default_value) {}
+                           default_value,
+                           allocator) {}
 
     ///@brief Constructs matrix from a container of row lengths
     template<class Container>
-    FlatRaggedMatrix(Container container, T default_value = T())
-        : FlatRaggedMatrix(std::begin(container), std::end(container), default_value) {}
+    FlatRaggedMatrix(Container container, T default_value = T(), const Allocator& allocator = Allocator())
+        : FlatRaggedMatrix(std::begin(container), std::end(container), default_value, allocator) {}
 
     /**
      * @brief Constructs matrix from an iterator range. 
@@ -62,7 +67,9 @@ class FlatRaggedMatrix {
      * The length of the range is the number of rows, and iterator values are the row lengths. 
      */
     template<class Iter>
-    FlatRaggedMatrix(Iter row_size_first, Iter row_size_last, T default_value = T()) {
+    FlatRaggedMatrix(Iter row_size_first, Iter row_size_last, T default_value = T(), const Allocator& allocator = Allocator())
+        : data_(allocator)
+        , first_elem_(allocator) {
         size_t nrows = std::distance(row_size_first, row_size_last);
         first_elem_.resize(nrows + 1, -1); //+1 for sentinel
 
@@ -146,13 +153,13 @@ class FlatRaggedMatrix {
     }
 
     ///@brief Swaps two matrices
-    void swap(FlatRaggedMatrix<T, Index0, Index1>& other) {
+    void swap(FlatRaggedMatrix& other) {
         std::swap(data_, other.data_);
         std::swap(first_elem_, other.first_elem_);
     }
 
     ///@brief Swaps two matrices
-    friend void swap(FlatRaggedMatrix<T, Index0, Index1>& lhs, FlatRaggedMatrix<T, Index0, Index1>& rhs) {
+    friend void swap(FlatRaggedMatrix& lhs, FlatRaggedMatrix& rhs) {
         lhs.swap(rhs);
     }
 
@@ -253,8 +260,10 @@ class FlatRaggedMatrix {
     };
 
   private:
-    std::vector<T> data_;
-    std::vector<int> first_elem_;
+    using IntAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<int>;
+
+    std::vector<T, Allocator> data_;
+    std::vector<int, IntAllocator> first_elem_;
 };
 
 } // namespace vtr
@@ -3,6 +3,7 @@
 #include "vtr_random.h"
 #include "vtr_util.h"
 #include "vtr_error.h"
+#include "vtr_assert.h"
 #include "specrand.h"
 
 #define CHECK_RAND
@@ -33,6 +34,10 @@ RandState get_random_state() {
     return random_state;
 }
 
+void set_random_state(RandState state) {
+    random_state = state;
+}
+
 int irand(int imax, RandState& state) {
 #ifdef SPEC_CPU
     /* SPEC CPU requires a different random number generator */
@@ -88,4 +93,60 @@ float frand() {
 #endif
 }
 
+/**
+ * Step of the splitmix64 generator, used to expand seeds into xoshiro256** states
+ * (as recommended by the xoshiro authors: it never produces an all zero state).
+ */
+static uint64_t splitmix64(uint64_t& x) {
+    uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+static inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+RandomStream::RandomStream(uint64_t seed, uint64_t stream) {
+    //Mix the stream index in, so nearby (seed, stream) pairs give unrelated states
+    uint64_t x = seed;
+    uint64_t stream_mix = stream;
+    x ^= splitmix64(stream_mix);
+    for (uint64_t& word : state_) {
+        word = splitmix64(x);
+    }
+}
+
+RandomStream RandomStream::split(uint64_t stream) const {
+    uint64_t seed = state_[0] ^ rotl(state_[1], 17) ^ rotl(state_[2], 31) ^ rotl(state_[3], 47);
+    return RandomStream(seed, stream);
+}
+
+uint64_t RandomStream::next() {
+    const uint64_t result = rotl(state_[1] * 5, 7) * 9;
+    const uint64_t t = state_[1] << 17;
+
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = rotl(state_[3], 45);
+
+    return result;
+}
+
+int RandomStream::irand(int imax) {
+    VTR_ASSERT_SAFE(imax >= 0);
+    //Scale the upper 32 bits to [0..imax] with a multiplication (rather than a slow, and more biased, modulus)
+    uint64_t range = uint64_t(imax) + 1;
+    return int(((next() >> 32) * range) >> 32);
+}
+
+float RandomStream::frand() {
+    //24 random bits, so every value is exactly representable and the result is < 1
+    return float(next() >> 40) * (1.f / float(1u << 24));
+}
+
 } // namespace vtr
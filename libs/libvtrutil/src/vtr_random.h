@@ -1,6 +1,7 @@
 #ifndef VTR_RANDOM_H
 #define VTR_RANDOM_H
 #include <algorithm> //For std::swap
+#include <cstdint>
 
 namespace vtr {
 /*********************** Portable random number generators *******************/
@@ -14,6 +15,9 @@ void srandom(int seed);
 ///@brief Return The random number generator state
 RandState get_random_state();
 
+///@brief Set the random number generator state, e.g. to one saved earlier by get_random_state()
+void set_random_state(RandState state);
+
 ///@brief Return a randomly generated integer less than or equal imax
 int irand(int imax);
 
@@ -41,5 +45,47 @@ void shuffle(Iter first, Iter last, RandState& rand_state) {
     }
 }
 
+/**
+ * @brief A fast, splittable pseudo-random number generator (xoshiro256**)
+ *
+ * Unlike the functions above, which share one global state, each RandomStream has its own state,
+ * so concurrent tasks can each draw from their own stream. The streams are derived deterministically:
+ * the stream built from a (seed, stream index) pair, or split() from a generator, is always the same,
+ * so giving each task (e.g. each index of a parallel loop) its own stream makes the results
+ * independent of the number of threads and of the order in which the tasks run.
+ *
+ * The sequences are portable (they don't depend on the compiler's standard library), and the
+ * generator isn't affected by SPEC_CPU.
+ */
+class RandomStream {
+  public:
+    ///@brief Creates the stream (of index stream) of the generator seeded with seed
+    explicit RandomStream(uint64_t seed, uint64_t stream = 0);
+
+    ///@brief Returns a new, independent, stream derived from the current state and the stream index
+    RandomStream split(uint64_t stream) const;
+
+    ///@brief Returns 64 random bits
+    uint64_t next();
+
+    ///@brief Returns a random integer in [0..imax]
+    int irand(int imax);
+
+    ///@brief Returns a random float in [0,1)
+    float frand();
+
+  private:
+    uint64_t state_[4];
+};
+
+///@brief Portable/invariant version of std::shuffle using a RandomStream
+template<typename Iter>
+void shuffle(Iter first, Iter last, RandomStream& rand_stream) {
+    for (auto i = (last - first) - 1; i > 0; --i) {
+        using std::swap;
+        swap(first[i], first[rand_stream.irand(i)]);
+    }
+}
+
 } // namespace vtr
 #endif
@@ -2,6 +2,7 @@
 
 #include "vtr_log.h"
 #include "vtr_rusage.h"
+#include "vtr_trace.h"
 
 #include <utility>
 
@@ -33,11 +34,18 @@ float Timer::delta_max_rss_mib() const {
 ///@brief Constructor
 ScopedActionTimer::ScopedActionTimer(std::string action_str)
     : action_(std::move(action_str))
-    , depth_(f_timer_depth++) {
+    , depth_(f_timer_depth++)
+    , traced_(trace_enabled()) {
+    if (traced_) {
+        trace_begin(action_);
+    }
 }
 
 ///@brief Destructor
 ScopedActionTimer::~ScopedActionTimer() {
+    if (traced_) {
+        trace_end(action_);
+    }
     --f_timer_depth;
 }
 
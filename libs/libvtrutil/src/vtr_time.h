@@ -54,6 +54,7 @@ class ScopedActionTimer : public Timer {
     const std::string action_;
     bool quiet_ = false;
     int depth_;
+    bool traced_; //Recorded as a trace span (see vtr_trace.h)
 };
 
 /**
@@ -0,0 +1,154 @@
+#include "vtr_trace.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "vtr_rusage.h"
+
+namespace vtr {
+
+namespace detail {
+std::atomic<bool> f_trace_enabled(false);
+} // namespace detail
+
+namespace {
+
+///@brief A Chrome trace event: span begin ('B') or end ('E'), or counter ('C')
+struct TraceEvent {
+    char phase;
+    std::string name;
+    long long timestamp_us;
+    size_t thread;
+    double value; ///<Counter value, or the peak resident set size (in MiB) at a span end
+};
+
+class TraceRecorder {
+  public:
+    ~TraceRecorder() {
+        finish();
+    }
+
+    void start(const std::string& filename) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        filename_ = filename;
+        start_ = clock::now();
+        events_.clear();
+        threads_.clear();
+        detail::f_trace_enabled = true;
+    }
+
+    void finish() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!detail::f_trace_enabled) {
+            return;
+        }
+        detail::f_trace_enabled = false;
+
+        std::ofstream os(filename_);
+        if (os) {
+            write(os);
+        }
+    }
+
+    void record(char phase, const std::string& name, double value) {
+        long long timestamp_us = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start_).count();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        //Number the threads in order of their first event
+        size_t thread = threads_.emplace(std::this_thread::get_id(), threads_.size()).first->second;
+        events_.push_back({phase, name, timestamp_us, thread, value});
+    }
+
+    void write_events(std::ostream& os) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        write(os);
+    }
+
+  private:
+    void write(std::ostream& os) const {
+        os << "{\"traceEvents\": [\n";
+        for (size_t i = 0; i < events_.size(); ++i) {
+            const TraceEvent& event = events_[i];
+            os << "{\"name\": ";
+            write_json_string(os, event.name);
+            os << ", \"ph\": \"" << event.phase << "\""
+               << ", \"ts\": " << event.timestamp_us
+               << ", \"pid\": 0, \"tid\": " << event.thread;
+            if (event.phase == 'C') {
+                os << ", \"args\": {\"value\": " << event.value << "}";
+            } else if (event.phase == 'E') {
+                os << ", \"args\": {\"max_rss_mib\": " << event.value << "}";
+            }
+            os << "}" << (i + 1 < events_.size() ? "," : "") << "\n";
+        }
+        os << "]}\n";
+    }
+
+    static void write_json_string(std::ostream& os, const std::string& str) {
+        os << '"';
+        for (char c : str) {
+            if (c == '"' || c == '\\') {
+                os << '\\' << c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                os << escaped;
+            } else {
+                os << c;
+            }
+        }
+        os << '"';
+    }
+
+    using clock = std::chrono::steady_clock;
+
+    std::mutex mutex_;
+    std::string filename_;
+    std::chrono::time_point<clock> start_;
+    std::vector<TraceEvent> events_;
+    std::unordered_map<std::thread::id, size_t> threads_;
+};
+
+TraceRecorder f_trace_recorder;
+
+constexpr float BYTE_TO_MIB = 1024 * 1024;
+
+} // namespace
+
+void trace_start(const std::string& filename) {
+    f_trace_recorder.start(filename);
+}
+
+void trace_finish() {
+    f_trace_recorder.finish();
+}
+
+void trace_begin(const std::string& name) {
+    if (trace_enabled()) {
+        f_trace_recorder.record('B', name, 0.);
+    }
+}
+
+void trace_end(const std::string& name) {
+    if (trace_enabled()) {
+        f_trace_recorder.record('E', name, get_max_rss() / BYTE_TO_MIB);
+    }
+}
+
+void trace_counter(const std::string& name, double value) {
+    if (trace_enabled()) {
+        f_trace_recorder.record('C', name, value);
+    }
+}
+
+void write_trace_events(std::ostream& os) {
+    f_trace_recorder.write_events(os);
+}
+
+} // namespace vtr
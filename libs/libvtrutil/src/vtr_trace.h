@@ -0,0 +1,85 @@
+#ifndef VTR_TRACE_H
+#define VTR_TRACE_H
+#include <atomic>
+#include <iosfwd>
+#include <string>
+
+/**
+ * @file
+ * @brief Machine readable performance trace of a run
+ *
+ * When enabled (with trace_start()) this records spans (e.g. each scoped timer, router
+ * iteration or annealing temperature) and counters (e.g. heap pushes, accepted swaps),
+ * and writes them as a Chrome trace (JSON, viewable in chrome://tracing or Perfetto)
+ * at exit. Every span end also records the peak resident set size.
+ *
+ * When disabled, recording an event costs a single check of a global flag.
+ */
+
+namespace vtr {
+
+namespace detail {
+extern std::atomic<bool> f_trace_enabled;
+} // namespace detail
+
+///@brief Starts recording trace events, to be written to filename
+void trace_start(const std::string& filename);
+
+///@brief Writes the recorded trace events to the file given to trace_start() and stops recording (also done at exit)
+void trace_finish();
+
+///@brief Returns true if trace events are being recorded
+inline bool trace_enabled() {
+    return detail::f_trace_enabled.load(std::memory_order_relaxed);
+}
+
+///@brief Records the start of a span on the calling thread
+void trace_begin(const std::string& name);
+
+///@brief Records the end of the most recent span started on the calling thread
+void trace_end(const std::string& name);
+
+///@brief Records the current value of a counter
+void trace_counter(const std::string& name, double value);
+
+///@brief Writes the events recorded so far in the Chrome trace event format
+void write_trace_events(std::ostream& os);
+
+/**
+ * @brief Records a span for its lifetime, if tracing is enabled when it is constructed
+ *
+ * For example:
+ *
+ *       for (int itry = 1; itry <= max_iterations; ++itry) {
+ *           vtr::ScopedTraceSpan span("Routing iteration");
+ *
+ *           //Do the iteration
+ *       }
+ */
+class ScopedTraceSpan {
+  public:
+    explicit ScopedTraceSpan(const char* name)
+        : name_(name)
+        , active_(trace_enabled()) {
+        if (active_) {
+            trace_begin(name_);
+        }
+    }
+
+    ~ScopedTraceSpan() {
+        if (active_) {
+            trace_end(name_);
+        }
+    }
+
+    ScopedTraceSpan(const ScopedTraceSpan&) = delete;
+    ScopedTraceSpan& operator=(const ScopedTraceSpan&) = delete;
+
+  private:
+    const char* name_;
+    bool active_;
+};
+
+} // namespace vtr
+
+#endif
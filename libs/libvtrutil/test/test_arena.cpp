@@ -0,0 +1,107 @@
+#include <cstdint>
+#include <numeric>
+#include <string>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_arena.h"
+#include "vtr_ndmatrix.h"
+#include "vtr_ragged_matrix.h"
+#include "vtr_vector.h"
+
+TEST_CASE("Arena Allocation", "[vtr_arena]") {
+    vtr::Arena arena(1024);
+    REQUIRE(arena.bytes_allocated() == 0);
+    REQUIRE(arena.bytes_reserved() == 0);
+
+    //Small allocations are carved out of one block, aligned as requested
+    for (size_t align : {1, 2, 8, 16, 64}) {
+        void* ptr = arena.allocate(3, align);
+        REQUIRE(reinterpret_cast<uintptr_t>(ptr) % align == 0);
+    }
+    REQUIRE(arena.bytes_allocated() == 15);
+    REQUIRE(arena.bytes_reserved() == 1024);
+
+    //Filling the block starts a new one
+    for (size_t i = 0; i < 10; ++i) {
+        arena.allocate(100, 4);
+    }
+    REQUIRE(arena.bytes_reserved() == 2048);
+
+    //Large allocations get their own block
+    arena.allocate(1000, 8);
+    REQUIRE(arena.bytes_reserved() == 3048);
+
+    arena.release();
+    REQUIRE(arena.bytes_allocated() == 0);
+    REQUIRE(arena.bytes_reserved() == 0);
+
+    //An arena can be reused once released
+    REQUIRE(arena.allocate(10, 8) != nullptr);
+    REQUIRE(arena.bytes_reserved() == 1024);
+}
+
+TEST_CASE("Arena Allocator", "[vtr_arena]") {
+    vtr::Arena arena;
+
+    //A default constructed allocator uses the heap
+    vtr::vector<size_t, std::string, vtr::arena_allocator<std::string>> heap_strings(10, "heap");
+    REQUIRE(heap_strings.get_allocator().arena() == nullptr);
+    REQUIRE(arena.bytes_allocated() == 0);
+
+    //The arena is propagated by assignment
+    vtr::vector<size_t, int, vtr::arena_allocator<int>> values;
+    values = decltype(values)(100, 0, vtr::arena_allocator<int>(arena));
+    REQUIRE(values.get_allocator().arena() == &arena);
+    REQUIRE(arena.bytes_allocated() == 100 * sizeof(int));
+
+    std::iota(values.begin(), values.end(), 0);
+    REQUIRE(values[size_t(99)] == 99);
+
+    vtr::release_memory(values);
+    REQUIRE(values.empty());
+    arena.release();
+}
+
+TEST_CASE("Arena NdMatrix", "[vtr_arena]") {
+    vtr::Arena arena;
+    vtr::arena_allocator<float> allocator(arena);
+
+    vtr::NdMatrix<float, 2, vtr::arena_allocator<float>> matrix({5, 10}, 1., allocator);
+    REQUIRE(matrix.size() == 50);
+    REQUIRE(arena.bytes_allocated() == 50 * sizeof(float));
+    matrix[4][9] = 3.;
+
+    //Copies use the same arena
+    auto copy = matrix;
+    REQUIRE(copy.get_allocator() == allocator);
+    REQUIRE(copy[4][9] == 3.);
+    REQUIRE(copy[0][0] == 1.);
+    REQUIRE(arena.bytes_allocated() == 100 * sizeof(float));
+
+    //Assignment propagates the arena
+    vtr::NdMatrix<float, 1, vtr::arena_allocator<float>> vec;
+    REQUIRE(vec.get_allocator().arena() == nullptr);
+    vec = vtr::NdMatrix<float, 1, vtr::arena_allocator<float>>({7}, 2., allocator);
+    REQUIRE(vec.get_allocator() == allocator);
+    REQUIRE(vec[6] == 2.);
+
+    matrix.clear();
+    copy.clear();
+    vec.clear();
+    arena.release();
+}
+
+TEST_CASE("Arena FlatRaggedMatrix", "[vtr_arena]") {
+    vtr::Arena arena;
+
+    std::vector<size_t> row_sizes = {1, 5, 3, 10};
+    vtr::FlatRaggedMatrix<float, size_t, size_t, vtr::arena_allocator<float>> ones(row_sizes, 1., vtr::arena_allocator<float>(arena));
+    REQUIRE(ones.size() == 19);
+    REQUIRE(ones[3].size() == 10);
+    REQUIRE(ones[3][9] == 1.);
+    REQUIRE(arena.bytes_allocated() > 0);
+
+    ones.clear();
+    arena.release();
+}
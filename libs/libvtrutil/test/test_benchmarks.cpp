@@ -0,0 +1,140 @@
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+
+#include "vtr_flat_map.h"
+#include "vtr_ndmatrix.h"
+#include "vtr_random.h"
+#include "vtr_strong_id.h"
+#include "vtr_vector_map.h"
+
+#include <string>
+#include <vector>
+
+/*
+ * Microbenchmarks of the containers on VPR's hot paths.
+ *
+ * These are hidden test cases, so they are not run by default (or by ctest).
+ * Run them with:
+ *
+ *      test_vtrutil "[benchmark]"
+ *
+ * The sizes are those of the structures in a run on a ~300x300 grid (e.g. the
+ * placer delay model or the router lookahead cost map).
+ */
+
+namespace {
+
+struct bench_tag;
+typedef vtr::StrongId<bench_tag> BenchId;
+
+constexpr size_t GRID_WIDTH = 300;
+constexpr size_t GRID_HEIGHT = 300;
+constexpr size_t NUM_LOOKUPS = 100000;
+
+//Random (dx, dy) pairs, as queried by the placer when evaluating moves
+std::vector<std::pair<size_t, size_t>> random_grid_offsets() {
+    vtr::RandState rand_state = 1;
+    std::vector<std::pair<size_t, size_t>> offsets(NUM_LOOKUPS);
+    for (auto& offset : offsets) {
+        offset.first = vtr::irand(GRID_WIDTH - 1, rand_state);
+        offset.second = vtr::irand(GRID_HEIGHT - 1, rand_state);
+    }
+    return offsets;
+}
+
+TEST_CASE("NdMatrix indexing", "[.benchmark][vtr_ndmatrix]") {
+    auto offsets = random_grid_offsets();
+
+    //Like the placer delay model: [from_layer][to_layer][dx][dy]
+    vtr::NdMatrix<float, 4> delays({1, 1, GRID_WIDTH, GRID_HEIGHT}, 1.);
+
+    //Like the router lookahead cost map: [from_layer][chan][seg][to_layer][dx][dy]
+    vtr::NdMatrix<float, 6> costs({1, 2, 4, 1, GRID_WIDTH, GRID_HEIGHT}, 1.);
+
+    BENCHMARK("4D random") {
+        float sum = 0.;
+        for (const auto& [dx, dy] : offsets) {
+            sum += delays[0][0][dx][dy];
+        }
+        return sum;
+    };
+
+    BENCHMARK("4D sequential") {
+        float sum = 0.;
+        for (size_t dx = 0; dx < GRID_WIDTH; ++dx) {
+            for (size_t dy = 0; dy < GRID_HEIGHT; ++dy) {
+                sum += delays[0][0][dx][dy];
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK("6D random") {
+        float sum = 0.;
+        for (size_t i = 0; i < offsets.size(); ++i) {
+            sum += costs[0][i % 2][i % 4][0][offsets[i].first][offsets[i].second];
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("vector_map lookup", "[.benchmark][vtr_vector_map]") {
+    //Like a per net or per block lookup of a large netlist
+    constexpr size_t NUM_KEYS = 1000000;
+
+    vtr::vector_map<BenchId, int> map;
+    for (size_t i = 0; i < NUM_KEYS; ++i) {
+        map.insert(BenchId(i), i);
+    }
+
+    vtr::RandState rand_state = 1;
+    std::vector<BenchId> keys(NUM_LOOKUPS);
+    for (auto& key : keys) {
+        key = BenchId(vtr::irand(NUM_KEYS - 1, rand_state));
+    }
+
+    BENCHMARK("operator[]") {
+        long sum = 0;
+        for (BenchId key : keys) {
+            sum += map[key];
+        }
+        return sum;
+    };
+
+    BENCHMARK("find") {
+        long sum = 0;
+        for (BenchId key : keys) {
+            sum += *map.find(key);
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("flat_map lookup", "[.benchmark][vtr_flat_map]") {
+    vtr::RandState rand_state = 1;
+
+    //Like the per column block maps of the compressed grids (small) and the
+    //per net maps of the netlists (large)
+    for (size_t num_keys : {32, 300, 100000}) {
+        std::vector<std::pair<int, int>> values;
+        for (size_t i = 0; i < num_keys; ++i) {
+            values.emplace_back(2 * i, i);
+        }
+        vtr::flat_map<int, int> map = vtr::make_flat_map(std::move(values));
+
+        std::vector<int> keys(NUM_LOOKUPS);
+        for (auto& key : keys) {
+            key = vtr::irand(2 * num_keys - 1, rand_state);
+        }
+
+        BENCHMARK("find (" + std::to_string(num_keys) + " keys)") {
+            size_t found = 0;
+            for (int key : keys) {
+                found += (map.find(key) != map.end());
+            }
+            return found;
+        };
+    }
+}
+
+} // namespace
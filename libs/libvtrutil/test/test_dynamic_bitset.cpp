@@ -0,0 +1,91 @@
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_dynamic_bitset.h"
+
+namespace {
+
+TEST_CASE("DynamicBitset Set Get", "[vtr_dynamic_bitset]") {
+    vtr::dynamic_bitset<> bits(200);
+    REQUIRE(bits.size() >= 200);
+    REQUIRE(bits.none());
+
+    //Bits in the upper half of the 64-bit words
+    for (size_t i : {0, 31, 32, 63, 64, 150, 199}) {
+        bits.set(i, true);
+    }
+    REQUIRE(bits.count() == 7);
+    REQUIRE(bits.get(63));
+    REQUIRE(!bits.get(62));
+
+    bits.set(63, false);
+    REQUIRE(!bits.get(63));
+    REQUIRE(bits.count() == 6);
+    REQUIRE(bits.any());
+}
+
+TEST_CASE("DynamicBitset Search", "[vtr_dynamic_bitset]") {
+    vtr::dynamic_bitset<> bits(300);
+    REQUIRE(bits.find_first_set() == bits.size());
+
+    bits.set(5, true);
+    bits.set(64, true);
+    bits.set(250, true);
+
+    REQUIRE(bits.find_first_set() == 5);
+    REQUIRE(bits.find_next_set(5) == 5);
+    REQUIRE(bits.find_next_set(6) == 64);
+    REQUIRE(bits.find_next_set(65) == 250);
+    REQUIRE(bits.find_next_set(251) == bits.size());
+    REQUIRE(bits.find_next_set(bits.size() + 10) == bits.size());
+
+    std::vector<size_t> set_bits;
+    bits.for_each_set([&](size_t i) { set_bits.push_back(i); });
+    std::vector<size_t> expected_set_bits = {5, 64, 250};
+    REQUIRE(set_bits == expected_set_bits);
+
+    bits.fill(true);
+    bits.set(0, false);
+    bits.set(130, false);
+    REQUIRE(bits.find_next_unset(0) == 0);
+    REQUIRE(bits.find_next_unset(1) == 130);
+    REQUIRE(bits.find_next_unset(131) == bits.size());
+}
+
+TEST_CASE("DynamicBitset Bulk Operations", "[vtr_dynamic_bitset]") {
+    vtr::dynamic_bitset<> a(100);
+    vtr::dynamic_bitset<> b(100);
+    for (size_t i = 0; i < 100; i += 2) {
+        a.set(i, true);
+    }
+    for (size_t i = 0; i < 100; i += 3) {
+        b.set(i, true);
+    }
+
+    auto a_or_b = a;
+    a_or_b |= b;
+    auto a_and_b = a;
+    a_and_b &= b;
+    auto a_xor_b = a;
+    a_xor_b ^= b;
+    auto a_and_not_b = a;
+    a_and_not_b.and_not(b);
+
+    for (size_t i = 0; i < 100; i++) {
+        bool in_a = i % 2 == 0;
+        bool in_b = i % 3 == 0;
+        REQUIRE(a_or_b.get(i) == (in_a || in_b));
+        REQUIRE(a_and_b.get(i) == (in_a && in_b));
+        REQUIRE(a_xor_b.get(i) == (in_a != in_b));
+        REQUIRE(a_and_not_b.get(i) == (in_a && !in_b));
+    }
+
+    auto not_b = ~b;
+    not_b &= a;
+    REQUIRE(not_b == a_and_not_b);
+    REQUIRE(a_and_b != a_or_b);
+    REQUIRE(a_and_b.count() == 17);
+}
+
+} // namespace
@@ -0,0 +1,85 @@
+#include <map>
+#include <set>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_id_hash_map.h"
+#include "vtr_random.h"
+#include "vtr_strong_id.h"
+
+namespace {
+
+struct test_id_tag;
+typedef vtr::StrongId<test_id_tag> TestId;
+
+TEST_CASE("IdHashMap Basic", "[vtr_id_hash_map]") {
+    vtr::id_hash_map<TestId, float> map;
+    REQUIRE(map.empty());
+    REQUIRE(map.find(TestId(3)) == map.end());
+    REQUIRE(map.count(TestId(3)) == 0);
+
+    map[TestId(3)] = 1.5;
+    map[TestId(7)] += 2.;
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.at(TestId(3)) == 1.5);
+    REQUIRE(map[TestId(7)] == 2.);
+
+    auto result = map.insert({TestId(3), 10.});
+    REQUIRE(!result.second);
+    REQUIRE(result.first->second == 1.5);
+
+    result = map.insert({TestId(0), 4.});
+    REQUIRE(result.second);
+    REQUIRE(map.find(TestId(0))->second == 4.);
+
+    REQUIRE(map.erase(TestId(3)) == 1);
+    REQUIRE(map.erase(TestId(3)) == 0);
+    REQUIRE(map.size() == 2);
+
+    size_t num_entries = 0;
+    for (const auto& entry : map) {
+        REQUIRE((entry.first == TestId(0) || entry.first == TestId(7)));
+        ++num_entries;
+    }
+    REQUIRE(num_entries == 2);
+
+    map.clear();
+    REQUIRE(map.empty());
+    REQUIRE(map.begin() == map.end());
+}
+
+TEST_CASE("IdHashMap Against std::map", "[vtr_id_hash_map]") {
+    vtr::id_hash_map<TestId, int> map;
+    vtr::id_hash_set<TestId> set;
+    std::map<TestId, int> ref_map;
+
+    //Random inserts and erases over a small key range, so the probe sequences collide
+    //and erasing shifts entries back
+    vtr::RandomStream rand_stream(1);
+    for (int i = 0; i < 20000; i++) {
+        TestId key(rand_stream.irand(500));
+        if (rand_stream.irand(2) == 0) {
+            REQUIRE(map.erase(key) == ref_map.erase(key));
+            set.erase(key);
+        } else {
+            map[key] += i;
+            ref_map[key] += i;
+            set.insert(key);
+        }
+    }
+
+    REQUIRE(map.size() == ref_map.size());
+    REQUIRE(set.size() == ref_map.size());
+    for (const auto& entry : ref_map) {
+        REQUIRE(map.at(entry.first) == entry.second);
+        REQUIRE(set.count(entry.first) == 1);
+    }
+    for (const auto& entry : map) {
+        REQUIRE(ref_map.count(entry.first) == 1);
+    }
+    for (TestId key : set) {
+        REQUIRE(ref_map.count(key) == 1);
+    }
+}
+
+} // namespace
@@ -0,0 +1,52 @@
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_memory.h"
+
+namespace {
+
+//Fills a vector with a large array allocator, which is large enough to be mapped under the given policy
+void check_large_array_allocator(vtr::e_large_alloc_policy policy) {
+    vtr::set_large_alloc_policy(policy);
+    REQUIRE(vtr::large_alloc_policy() == policy);
+
+    //Small (regular aligned) and large (mapped) allocations
+    for (size_t num_elements : {10, 1000000}) {
+        std::vector<uint64_t, vtr::large_array_allocator<uint64_t>> values(num_elements);
+        REQUIRE(reinterpret_cast<uintptr_t>(values.data()) % alignof(uint64_t) == 0);
+
+        std::iota(values.begin(), values.end(), 0);
+        REQUIRE(values.back() == num_elements - 1);
+
+        //Reallocate, copying the contents
+        values.resize(2 * num_elements, 7);
+        REQUIRE(values[num_elements - 1] == num_elements - 1);
+        REQUIRE(values.back() == 7);
+    }
+
+    vtr::set_large_alloc_policy(vtr::e_large_alloc_policy::DEFAULT);
+}
+
+} // namespace
+
+TEST_CASE("Large Array Allocator", "[vtr_memory]") {
+    check_large_array_allocator(vtr::e_large_alloc_policy::DEFAULT);
+    check_large_array_allocator(vtr::e_large_alloc_policy::TRANSPARENT_HUGE_PAGES);
+    check_large_array_allocator(vtr::e_large_alloc_policy::HUGE_PAGES);
+    check_large_array_allocator(vtr::e_large_alloc_policy::NUMA_INTERLEAVE);
+}
+
+TEST_CASE("Large Allocation Alignment", "[vtr_memory]") {
+    void* small = vtr::malloc_large(100, 64);
+    REQUIRE(reinterpret_cast<uintptr_t>(small) % 64 == 0);
+    vtr::free_large(small, 100);
+
+    void* large = vtr::malloc_large(vtr::LARGE_ALLOC_MIN_BYTES + 1, 64);
+    REQUIRE(reinterpret_cast<uintptr_t>(large) % 64 == 0);
+    vtr::free_large(large, vtr::LARGE_ALLOC_MIN_BYTES + 1);
+
+    vtr::free_large(nullptr, 100);
+}
@@ -0,0 +1,42 @@
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_memory_usage.h"
+#include "vtr_strong_id.h"
+#include "vtr_vector.h"
+
+struct memory_usage_test_tag;
+typedef vtr::StrongId<memory_usage_test_tag> MemoryTestId;
+
+TEST_CASE("Vector Memory Usage", "[vtr_memory_usage]") {
+    std::vector<int> vec;
+    REQUIRE(vtr::memory_usage(vec) == 0);
+
+    vec.reserve(100);
+    vec.push_back(1);
+    REQUIRE(vtr::memory_usage(vec) == vec.capacity() * sizeof(int));
+
+    vtr::vector<MemoryTestId, double> id_vec(10);
+    REQUIRE(vtr::memory_usage(id_vec) == id_vec.capacity() * sizeof(double));
+
+    std::vector<bool> bits(64);
+    REQUIRE(vtr::memory_usage(bits) == (bits.capacity() + 7) / 8);
+
+    std::vector<std::vector<int>> nested(2, std::vector<int>(10));
+    REQUIRE(vtr::memory_usage(nested) == nested.capacity() * sizeof(std::vector<int>) + vtr::memory_usage(nested[0]) + vtr::memory_usage(nested[1]));
+}
+
+TEST_CASE("Map Memory Usage", "[vtr_memory_usage]") {
+    std::unordered_map<int, int> map;
+    size_t empty_bytes = vtr::memory_usage(map);
+    for (int i = 0; i < 100; ++i) {
+        map[i] = i;
+    }
+    REQUIRE(vtr::memory_usage(map) >= empty_bytes + 100 * sizeof(std::pair<const int, int>));
+
+    vtr::NdMatrix<float, 3> matrix({2, 3, 4});
+    REQUIRE(vtr::memory_usage(matrix) == 2 * 3 * 4 * sizeof(float));
+
+    vtr::NdMatrix<std::vector<int>, 2> vec_matrix({2, 2});
+    vec_matrix[1][0].reserve(8);
+    REQUIRE(vtr::memory_usage(vec_matrix) == 4 * sizeof(std::vector<int>) + vec_matrix[1][0].capacity() * sizeof(int));
+}
@@ -0,0 +1,93 @@
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_packed_truth_table.h"
+#include "vtr_random.h"
+
+namespace {
+
+using vtr::LogicValue;
+using vtr::PackedTruthTable;
+
+//A random function, and its minterm values
+PackedTruthTable random_function(size_t num_inputs, vtr::RandState& rand_state, std::vector<bool>& values) {
+    PackedTruthTable function(num_inputs);
+    values.assign(function.num_minterms(), false);
+    for (size_t minterm = 0; minterm < function.num_minterms(); ++minterm) {
+        values[minterm] = vtr::irand(1, rand_state);
+        function.set(minterm, values[minterm]);
+    }
+    return function;
+}
+
+TEST_CASE("PackedTruthTable Constants", "[vtr_packed_truth_table]") {
+    for (size_t num_inputs : {0, 1, 5, 6, 7, 8}) {
+        PackedTruthTable zero(num_inputs, false);
+        PackedTruthTable one(num_inputs, true);
+        REQUIRE(zero.is_constant(false));
+        REQUIRE(!zero.is_constant(true));
+        REQUIRE(one.is_constant(true));
+        REQUIRE(one.get(one.num_minterms() - 1));
+
+        one.set(0, false);
+        REQUIRE(!one.is_constant(true));
+        REQUIRE(one.to_lut_mask()[0] == LogicValue::FALSE);
+        REQUIRE(one.to_lut_mask()[1 % one.num_minterms()] == (num_inputs == 0 ? LogicValue::FALSE : LogicValue::TRUE));
+    }
+}
+
+TEST_CASE("PackedTruthTable Cubes", "[vtr_packed_truth_table]") {
+    //The cube 1-0-1 over 8 inputs, the last 3 being FALSE
+    std::vector<LogicValue> cube = {LogicValue::TRUE, LogicValue::DONT_CARE, LogicValue::FALSE, LogicValue::DONT_CARE, LogicValue::TRUE};
+    PackedTruthTable function(8);
+    function.set_cube(cube, true);
+
+    for (size_t minterm = 0; minterm < function.num_minterms(); ++minterm) {
+        bool in_cube = (minterm & 1) && !(minterm & 4) && (minterm & 16) && minterm < 32;
+        REQUIRE(function.get(minterm) == in_cube);
+    }
+
+    //Clearing the cube again
+    function.set_cube(cube, false);
+    REQUIRE(function.is_constant(false));
+}
+
+TEST_CASE("PackedTruthTable Permute", "[vtr_packed_truth_table]") {
+    vtr::RandState rand_state = 1;
+    for (size_t num_inputs : {2, 4, 6, 7, 8}) {
+        std::vector<bool> values;
+        PackedTruthTable function = random_function(num_inputs, rand_state, values);
+
+        //A random permutation
+        std::vector<int> permutation(num_inputs);
+        for (size_t i = 0; i < num_inputs; ++i) {
+            permutation[i] = i;
+        }
+        vtr::shuffle(permutation.begin(), permutation.end(), rand_state);
+
+        PackedTruthTable permuted = function;
+        permuted.permute_inputs(permutation);
+
+        //Input i of minterm is input permutation[i] of the permuted minterm
+        for (size_t minterm = 0; minterm < function.num_minterms(); ++minterm) {
+            size_t permuted_minterm = 0;
+            for (size_t i = 0; i < num_inputs; ++i) {
+                if (minterm & (size_t(1) << i)) permuted_minterm |= size_t(1) << permutation[i];
+            }
+            REQUIRE(permuted.get(permuted_minterm) == values[minterm]);
+        }
+
+        //Swapping twice is the identity
+        for (size_t a = 0; a < num_inputs; ++a) {
+            for (size_t b = 0; b < num_inputs; ++b) {
+                PackedTruthTable swapped = function;
+                swapped.swap_inputs(a, b);
+                swapped.swap_inputs(b, a);
+                REQUIRE(swapped == function);
+            }
+        }
+    }
+}
+
+} // namespace
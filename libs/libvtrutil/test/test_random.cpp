@@ -14,3 +14,42 @@ TEST_CASE("shuffle", "[vtr_random/shuffle]") {
     std::vector<int> numbers_shuffled_1 = {5, 2, 4, 1, 3};
     REQUIRE(numbers == numbers_shuffled_1);
 }
+
+TEST_CASE("random_stream", "[vtr_random/random_stream]") {
+    vtr::RandomStream stream(42);
+    vtr::RandomStream same_stream(42);
+    vtr::RandomStream other_stream(42, 1);
+
+    //Streams are deterministic, and differ by seed and stream index
+    bool differs = false;
+    for (int i = 0; i < 100; i++) {
+        uint64_t value = stream.next();
+        REQUIRE(value == same_stream.next());
+        differs |= value != other_stream.next();
+    }
+    REQUIRE(differs);
+
+    //Split streams only depend on the generator's state and the stream index
+    vtr::RandomStream split_1 = stream.split(3);
+    vtr::RandomStream split_2 = same_stream.split(3);
+    for (int i = 0; i < 10; i++) {
+        REQUIRE(split_1.next() == split_2.next());
+    }
+
+    //Values are within range, and cover it
+    std::vector<int> counts(10, 0);
+    for (int i = 0; i < 10000; i++) {
+        int value = stream.irand(9);
+        REQUIRE(value >= 0);
+        REQUIRE(value <= 9);
+        counts[value]++;
+
+        float fvalue = stream.frand();
+        REQUIRE(fvalue >= 0.);
+        REQUIRE(fvalue < 1.);
+    }
+    for (int count : counts) {
+        REQUIRE(count > 800);
+    }
+    REQUIRE(stream.irand(0) == 0);
+}
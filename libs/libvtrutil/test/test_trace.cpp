@@ -0,0 +1,60 @@
+#include <cstdio>
+#include <sstream>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "vtr_time.h"
+#include "vtr_trace.h"
+
+TEST_CASE("Trace Disabled", "[vtr_trace]") {
+    REQUIRE(!vtr::trace_enabled());
+
+    {
+        vtr::ScopedTraceSpan span("not_recorded");
+        vtr::trace_counter("not_recorded", 1.);
+    }
+
+    std::stringstream ss;
+    vtr::write_trace_events(ss);
+    REQUIRE(ss.str().find("not_recorded") == std::string::npos);
+}
+
+TEST_CASE("Trace Events", "[vtr_trace]") {
+    vtr::trace_start("test_trace.json");
+    REQUIRE(vtr::trace_enabled());
+
+    {
+        vtr::ScopedTraceSpan span("outer");
+        {
+            vtr::ScopedFinishTimer timer("inner \"timer\"");
+            timer.quiet(true);
+        }
+        vtr::trace_counter("heap_pushes", 42.);
+    }
+
+    std::stringstream ss;
+    vtr::write_trace_events(ss);
+    std::string trace = ss.str();
+
+    size_t outer_begin = trace.find("{\"name\": \"outer\", \"ph\": \"B\"");
+    size_t inner_begin = trace.find("{\"name\": \"inner \\\"timer\\\"\", \"ph\": \"B\"");
+    size_t inner_end = trace.find("{\"name\": \"inner \\\"timer\\\"\", \"ph\": \"E\"");
+    size_t counter = trace.find("{\"name\": \"heap_pushes\", \"ph\": \"C\"");
+    size_t outer_end = trace.find("{\"name\": \"outer\", \"ph\": \"E\"");
+
+    REQUIRE(outer_begin != std::string::npos);
+    REQUIRE(inner_begin != std::string::npos);
+    REQUIRE(inner_end != std::string::npos);
+    REQUIRE(counter != std::string::npos);
+    REQUIRE(outer_end != std::string::npos);
+
+    REQUIRE(outer_begin < inner_begin);
+    REQUIRE(inner_begin < inner_end);
+    REQUIRE(inner_end < counter);
+    REQUIRE(counter < outer_end);
+    REQUIRE(trace.find("\"args\": {\"value\": 42}") != std::string::npos);
+
+    vtr::trace_finish();
+    REQUIRE(!vtr::trace_enabled());
+    std::remove("test_trace.json");
+}
@@ -31,6 +31,7 @@
 #include "config_t.h"
 #include "odin_types.h"
 #include "hash_table.h"
+#include "blif_stream.h"
 
 #include "vtr_util.h"
 #include "vtr_memory.h"
@@ -84,35 +85,27 @@ extern int num_lines;
 extern bool skip_reading_bit_map;
 extern bool insert_global_clock;
 
-extern FILE* file;
+extern blif_stream file;
 
 /**
  *---------------------------------------------------------------------------------------------
  * (function: getbline)
  * 
  * @brief reading blif file lines according to the blif file type.
- * For arbitrary long lines fgets does not work due
- * to size limit. However, the scenario in Odin is on the flipside
- * and we ought to use fgets to pass '\' and the line length are 
- * always fix and less than a const value
+ * The line buffer is allocated on the first call and reused by the
+ * following ones, the line length being always less than a const value
  * 
  * @param buf buffer pointer
- * @param size buffer size (in the case of using fgets)
+ * @param size buffer size
  * @param fd file stream
  * 
  * @return null pointer if end of the file, otherwise the read line
  *---------------------------------------------------------------------------------------------*/
-inline char* getbline(char*& buf, size_t size, FILE* fd) {
-    char* retval = NULL;
-    if (buf) {
-        vtr::free(buf);
-        buf = NULL;
-    }
+inline char* getbline(char*& buf, size_t size, blif_stream& fd) {
+    if (!buf)
+        buf = (char*)vtr::malloc(READ_BLIF_BUFFER * sizeof(char));
 
-    buf = (char*)vtr::malloc(READ_BLIF_BUFFER * sizeof(char));
-    retval = vtr::fgets(buf, size, fd);
-
-    return (retval);
+    return fd.gets(buf, size);
 }
 
 /**
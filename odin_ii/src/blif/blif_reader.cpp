@@ -26,6 +26,8 @@
 #include <cstdlib>
 #include <cstring>
 #include <cstdio>
+#include <string_view>
+#include <unordered_map>
 
 #include "odin_util.h"
 #include "odin_types.h"
@@ -45,9 +47,22 @@ int num_lines;
 bool skip_reading_bit_map;
 bool insert_global_clock;
 
-FILE* file;
+blif_stream file;
 netlist_t* blif_netlist;
-hash_table* output_nets_hash;
+
+/* the output nets by name: the keys view the net names (or constant strings) rather than copying them */
+static std::unordered_map<std::string_view, nnet_t*> output_nets_index;
+/* the clock of the latches without control, found on the first one (see search_clock_name) */
+static char* latch_clock_name = NULL;
+
+static nnet_t* get_output_net(const char* name) {
+    auto net = output_nets_index.find(name);
+    return (net != output_nets_index.end()) ? net->second : NULL;
+}
+
+static void add_output_net(const char* name, nnet_t* net) {
+    output_nets_index.emplace(name, net);
+}
 
 /**
  * -----------------------------------------------------------------------------------------------------------------------------
@@ -66,18 +81,20 @@ blif::reader::reader() {
 
     skip_reading_bit_map = false;
     /*Opening the blif file */
-    file = vtr::fopen(configuration.list_of_file_names[my_location.file].c_str(), "r");
-    if (file == NULL) {
+    if (!file.open(configuration.list_of_file_names[my_location.file].c_str())) {
         error_message(PARSE_ARGS, my_location, "cannot open file: %s\n", configuration.list_of_file_names[my_location.file].c_str());
     }
     line_count = 0;
     num_lines = count_blif_lines();
 
-    output_nets_hash = new hash_table();
+    output_nets_index.clear();
+    latch_clock_name = NULL;
 }
 
 blif::reader::~reader() {
-    delete output_nets_hash;
+    output_nets_index.clear();
+    vtr::free(latch_clock_name);
+    latch_clock_name = NULL;
 }
 
 void* blif::reader::_read() {
@@ -113,8 +130,8 @@ void* blif::reader::_read() {
 
     // Outputs netlist graph.
     check_netlist(blif_netlist);
-    // delete output_nets_hash;
-    fclose(file);
+    output_nets_index.clear();
+    file.close();
 
     /* clean up */
     vtr::free(buffer);
@@ -141,7 +158,7 @@ void* blif::reader::_read() {
 int blif::reader::read_tokens(char* buffer, hard_block_models* models) {
     /* Figures out which, if any token is at the start of this line and *
      * takes the appropriate action.                                    */
-    char* token = vtr::strtok(buffer, TOKENS, file, buffer);
+    char* token = file.strtok(buffer, TOKENS, buffer);
 
     if (token) {
         if (skip_reading_bit_map && ((token[0] == '0') || (token[0] == '1') || (token[0] == '-'))) {
@@ -177,33 +194,27 @@ int blif::reader::read_tokens(char* buffer, hard_block_models* models) {
  * -------------------------------------------------------------------------------------------
  */
 void blif::reader::find_top_module() {
-    fpos_t pos;
     int last_line = my_location.line;
-    fgetpos(file, &pos);
-    rewind(file);
+    size_t pos = file.tell();
+    file.rewind();
 
     char* top_module = NULL;
+    char* buffer = file.scratch_buffer();
 
     bool found = false;
     while (!found) {
-        char* buffer = NULL;
-        getbline(buffer, READ_BLIF_BUFFER, file);
+        file.gets(buffer, READ_BLIF_BUFFER);
         my_location.line += 1;
 
-        if (feof(file)) {
-            /* clean up */
-            vtr::free(buffer);
+        if (file.eof()) {
             break;
         }
 
-        char* token = vtr::strtok(buffer, TOKENS, file, buffer);
+        char* token = file.strtok(buffer, TOKENS, buffer);
         if (token && !strcmp(token, ".model")) {
-            top_module = vtr::strdup(vtr::strtok(NULL, TOKENS, file, buffer));
+            top_module = vtr::strdup(file.strtok(NULL, TOKENS, buffer));
             found = true;
         }
-
-        /* clean up */
-        vtr::free(buffer);
     }
 
     if (!found) {
@@ -216,7 +227,7 @@ void blif::reader::find_top_module() {
     }
 
     my_location.line = last_line;
-    fsetpos(file, &pos);
+    file.seek(pos);
 }
 
 /**
@@ -255,7 +266,7 @@ void blif::reader::hook_up_node(nnode_t* node) {
     for (j = 0; j < node->num_input_pins; j++) {
         npin_t* input_pin = node->input_pins[j];
 
-        nnet_t* output_net = (nnet_t*)output_nets_hash->get(input_pin->name);
+        nnet_t* output_net = get_output_net(input_pin->name);
 
         if (!output_net)
             error_message(PARSE_BLIF, my_location, "Error: Could not hook up the pin %s: not available.", input_pin->name);
@@ -274,14 +285,14 @@ void blif::reader::hook_up_node(nnode_t* node) {
  */
 void blif::reader::create_hard_block_nodes(hard_block_models* models) {
     char buffer[READ_BLIF_BUFFER];
-    char* subcircuit_name = vtr::strtok(NULL, TOKENS, file, buffer);
+    char* subcircuit_name = file.strtok(NULL, TOKENS, buffer);
 
     /* storing the names on the formal-actual parameter */
     char* token;
     int count = 0;
     // Contains strings of the form port[pin]=port~pin
     char** names_parameters = NULL;
-    while ((token = vtr::strtok(NULL, TOKENS, file, buffer)) != NULL) {
+    while ((token = file.strtok(NULL, TOKENS, buffer)) != NULL) {
         names_parameters = (char**)vtr::realloc(names_parameters, sizeof(char*) * (count + 1));
         names_parameters[count++] = vtr::strdup(token);
     }
@@ -422,7 +433,7 @@ void blif::reader::create_hard_block_nodes(hard_block_models* models) {
             add_driver_pin_to_net(new_net, new_pin);
 
             // Index the net by name.
-            output_nets_hash->add(name, new_net);
+            add_output_net(new_net->name, new_net);
         }
 
         // Name the node subcircuit_name~hard_block_number so that the name is unique.
@@ -457,7 +468,7 @@ void blif::reader::create_internal_node_and_driver() {
     char** names = NULL; // stores the names of the input and the output, last name stored would be of the output
     int input_count = 0;
     char buffer[READ_BLIF_BUFFER];
-    while ((ptr = vtr::strtok(NULL, TOKENS, file, buffer))) {
+    while ((ptr = file.strtok(NULL, TOKENS, buffer))) {
         names = (char**)vtr::realloc(names, sizeof(char*) * (input_count + 1));
         names[input_count++] = resolve_signal_name_based_on_blif_type(ptr);
     }
@@ -555,11 +566,11 @@ void blif::reader::create_internal_node_and_driver() {
 
         add_output_pin_to_node(new_node, new_pin, 0);
 
-        nnet_t* out_net = (nnet_t*)output_nets_hash->get(names[input_count - 1]);
+        nnet_t* out_net = get_output_net(names[input_count - 1]);
         if (out_net == nullptr) {
             out_net = allocate_nnet();
             out_net->name = vtr::strdup(new_node->name);
-            output_nets_hash->add(new_node->name, out_net);
+            add_output_net(out_net->name, out_net);
         }
         add_driver_pin_to_net(out_net, new_pin);
     }
@@ -618,7 +629,7 @@ void blif::reader::build_top_input_node(const char* name_str) {
 
     //output_nets_sc->data[sc_spot] = new_net;
 
-    output_nets_hash->add(temp_string, new_net);
+    add_output_net(new_net->name, new_net);
     vtr::free(temp_string);
 }
 
@@ -643,7 +654,7 @@ void blif::reader::add_top_input_nodes() {
 
     char* ptr;
     char buffer[READ_BLIF_BUFFER];
-    while ((ptr = vtr::strtok(NULL, TOKENS, file, buffer))) {
+    while ((ptr = file.strtok(NULL, TOKENS, buffer))) {
         build_top_input_node(ptr);
     }
 }
@@ -659,7 +670,7 @@ void blif::reader::rb_create_top_output_nodes() {
     char* ptr;
     char buffer[READ_BLIF_BUFFER];
 
-    while ((ptr = vtr::strtok(NULL, TOKENS, file, buffer))) {
+    while ((ptr = file.strtok(NULL, TOKENS, buffer))) {
         char* temp_string = resolve_signal_name_based_on_blif_type(ptr);
 
         /*add_a_fanout_pin_to_net((nnet_t*)output_nets_sc->data[sc_spot], new_pin);*/
@@ -763,9 +774,9 @@ bool blif::reader::verify_hard_block_ports_against_model(hard_block_ports* ports
  */
 hard_block_model* blif::reader::read_hard_block_model(char* name_subckt, hard_block_ports* ports) {
     // Store the current position in the file.
-    fpos_t pos;
     int last_line = my_location.line;
-    fgetpos(file, &pos);
+    size_t pos = file.tell();
+    char* buffer = file.scratch_buffer();
 
     hard_block_model* model;
 
@@ -773,12 +784,11 @@ hard_block_model* blif::reader::read_hard_block_model(char* name_subckt, hard_bl
         model = NULL;
 
         // Search the file for .model followed buy the subcircuit name.
-        char* buffer = NULL;
-        while (getbline(buffer, READ_BLIF_BUFFER, file)) {
+        while (file.gets(buffer, READ_BLIF_BUFFER)) {
             my_location.line += 1;
-            char* token = vtr::strtok(buffer, TOKENS, file, buffer);
+            char* token = file.strtok(buffer, TOKENS, buffer);
             // match .model followed by the subcircuit name.
-            if (token && !strcmp(token, ".model") && !strcmp(vtr::strtok(NULL, TOKENS, file, buffer), name_subckt)) {
+            if (token && !strcmp(token, ".model") && !strcmp(file.strtok(NULL, TOKENS, buffer), name_subckt)) {
                 model = (hard_block_model*)vtr::calloc(1, sizeof(hard_block_model));
                 model->name = vtr::strdup(name_subckt);
                 model->inputs = (hard_block_pins*)vtr::calloc(1, sizeof(hard_block_pins));
@@ -790,18 +800,18 @@ hard_block_model* blif::reader::read_hard_block_model(char* name_subckt, hard_bl
                 model->outputs->names = NULL;
 
                 // Read the inputs and outputs.
-                while (getbline(buffer, READ_BLIF_BUFFER, file)) {
-                    char* first_word = vtr::strtok(buffer, TOKENS, file, buffer);
+                while (file.gets(buffer, READ_BLIF_BUFFER)) {
+                    char* first_word = file.strtok(buffer, TOKENS, buffer);
                     if (first_word) {
                         if (!strcmp(first_word, ".inputs")) {
                             char* name;
-                            while ((name = vtr::strtok(NULL, TOKENS, file, buffer))) {
+                            while ((name = file.strtok(NULL, TOKENS, buffer))) {
                                 model->inputs->names = (char**)vtr::realloc(model->inputs->names, sizeof(char*) * (model->inputs->count + 1));
                                 model->inputs->names[model->inputs->count++] = vtr::strdup(name);
                             }
                         } else if (!strcmp(first_word, ".outputs")) {
                             char* name;
-                            while ((name = vtr::strtok(NULL, TOKENS, file, buffer))) {
+                            while ((name = file.strtok(NULL, TOKENS, buffer))) {
                                 model->outputs->names = (char**)vtr::realloc(model->outputs->names, sizeof(char*) * (model->outputs->count + 1));
                                 model->outputs->names[model->outputs->count++] = vtr::strdup(name);
                             }
@@ -814,10 +824,7 @@ hard_block_model* blif::reader::read_hard_block_model(char* name_subckt, hard_bl
             }
         }
 
-        /* clean up */
-        vtr::free(buffer);
-
-        if (!model || feof(file)) {
+        if (!model || file.eof()) {
             error_message(PARSE_BLIF, my_location, "A subcircuit model for '%s' with matching ports was not found.", name_subckt);
         }
 
@@ -843,7 +850,7 @@ hard_block_model* blif::reader::read_hard_block_model(char* name_subckt, hard_bl
 
     // Restore the original position in the file.
     my_location.line = last_line;
-    fsetpos(file, &pos);
+    file.seek(pos);
 
     return model;
 }
@@ -896,15 +903,15 @@ void blif::reader::rb_create_top_driver_nets(const char* instance_name_prefix) {
 
     /* CREATE the driver for the ZERO */
     blif_netlist->zero_net->name = make_full_ref_name(instance_name_prefix, NULL, NULL, zero_string, -1);
-    output_nets_hash->add(GND_NAME, blif_netlist->zero_net);
+    add_output_net(GND_NAME, blif_netlist->zero_net);
 
     /* CREATE the driver for the ONE and store twice */
     blif_netlist->one_net->name = make_full_ref_name(instance_name_prefix, NULL, NULL, one_string, -1);
-    output_nets_hash->add(VCC_NAME, blif_netlist->one_net);
+    add_output_net(VCC_NAME, blif_netlist->one_net);
 
     /* CREATE the driver for the PAD */
     blif_netlist->pad_net->name = make_full_ref_name(instance_name_prefix, NULL, NULL, pad_string, -1);
-    output_nets_hash->add(HBPAD_NAME, blif_netlist->pad_net);
+    add_output_net(HBPAD_NAME, blif_netlist->pad_net);
 
     blif_netlist->vcc_node->name = vtr::strdup(VCC_NAME);
     blif_netlist->gnd_node->name = vtr::strdup(GND_NAME);
@@ -938,7 +945,7 @@ void blif::reader::rb_look_for_clocks() {
  */
 void blif::reader::dum_parse(char* buffer) {
     /* Continue parsing to the end of this (possibly continued) line. */
-    while (vtr::strtok(NULL, TOKENS, file, buffer))
+    while (file.strtok(NULL, TOKENS, buffer))
         ;
 }
 
@@ -999,22 +1006,22 @@ operation_list blif::reader::assign_node_type_from_node_name(char* output_name)
 operation_list blif::reader::read_bit_map_find_unknown_gate(int input_count, nnode_t* node, char** names) {
     operation_list to_return = operation_list_END;
 
-    fpos_t pos;
     int last_line = my_location.line;
     const char* One = "1";
     const char* Zero = "0";
-    fgetpos(file, &pos);
+    size_t pos = file.tell();
 
     char** bit_map = NULL;
     char* output_bit_map = NULL; // to distinguish whether for the bit_map output is 1 or 0
     int line_count_bitmap = 0;   //stores the number of lines in a particular bit map
-    char* buffer = NULL;
+    char* buffer = file.scratch_buffer();
 
     if (!input_count) {
-        getbline(buffer, READ_BLIF_BUFFER, file);
+        if (!file.gets(buffer, READ_BLIF_BUFFER))
+            buffer[0] = '\0';
         my_location.line += 1;
 
-        char* ptr = vtr::strtok(buffer, "\t\n", file, buffer);
+        char* ptr = file.strtok(buffer, "\t\n", buffer);
         if (!ptr) {
             to_return = GND_NODE;
         } else if (!strcmp(ptr, " 1")) {
@@ -1026,16 +1033,17 @@ operation_list blif::reader::read_bit_map_find_unknown_gate(int input_count, nno
         }
     } else {
         while (1) {
-            getbline(buffer, READ_BLIF_BUFFER, file);
+            if (!file.gets(buffer, READ_BLIF_BUFFER))
+                buffer[0] = '\0';
             my_location.line += 1;
 
             if (!(buffer[0] == '0' || buffer[0] == '1' || buffer[0] == '-'))
                 break;
 
             bit_map = (char**)vtr::realloc(bit_map, sizeof(char*) * (line_count_bitmap + 1));
-            bit_map[line_count_bitmap++] = vtr::strdup(vtr::strtok(buffer, TOKENS, file, buffer));
+            bit_map[line_count_bitmap++] = vtr::strdup(file.strtok(buffer, TOKENS, buffer));
             if (output_bit_map != NULL) vtr::free(output_bit_map);
-            output_bit_map = vtr::strdup(vtr::strtok(NULL, TOKENS, file, buffer));
+            output_bit_map = vtr::strdup(file.strtok(NULL, TOKENS, buffer));
         }
 
         oassert(output_bit_map);
@@ -1246,8 +1254,6 @@ operation_list blif::reader::read_bit_map_find_unknown_gate(int input_count, nno
         }
     }
     /* clean up */
-    vtr::free(buffer);
-
     if (output_bit_map) {
         vtr::free(output_bit_map);
     }
@@ -1259,7 +1265,7 @@ operation_list blif::reader::read_bit_map_find_unknown_gate(int input_count, nno
     }
 
     my_location.line = last_line;
-    fsetpos(file, &pos);
+    file.seek(pos);
 
     return to_return;
 }
@@ -1280,7 +1286,7 @@ void blif::reader::create_latch_node_and_driver() {
     char* ptr = NULL;
 
     char buffer[READ_BLIF_BUFFER];
-    while ((ptr = vtr::strtok(NULL, TOKENS, file, buffer)) != NULL) {
+    while ((ptr = file.strtok(NULL, TOKENS, buffer)) != NULL) {
         input_token_count += 1;
         names = (char**)vtr::realloc(names, (sizeof(char*)) * (input_token_count));
 
@@ -1357,7 +1363,7 @@ void blif::reader::create_latch_node_and_driver() {
     add_output_pin_to_node(new_node, new_pin, 0);
     add_driver_pin_to_net(new_net, new_pin);
 
-    output_nets_hash->add(new_node->name, new_net);
+    add_output_net(new_node->name, new_net);
 
     /* Free the char** names */
     for (i = 0; i < input_token_count; i++)
@@ -1372,41 +1378,44 @@ void blif::reader::create_latch_node_and_driver() {
  * (function: search_clock_name)
  * 
  * @brief to search the clock if the control in the latch
- * is not mentioned
+ * is not mentioned. The search does not depend on the latch,
+ * so it is only done for the first one.
  * ---------------------------------------------------------------------------------------------
  */
 char* blif::reader::search_clock_name() {
-    fpos_t pos;
+    if (latch_clock_name)
+        return vtr::strdup(latch_clock_name);
+
     int last_line = my_location.line;
-    fgetpos(file, &pos);
-    rewind(file);
+    size_t pos = file.tell();
+    file.rewind();
 
     char* to_return = NULL;
     char** input_names = NULL;
     int input_names_count = 0;
     int found = 0;
+    char* buffer = file.scratch_buffer();
     while (!found) {
-        char* buffer = NULL;
-        getbline(buffer, READ_BLIF_BUFFER, file);
+        file.gets(buffer, READ_BLIF_BUFFER);
         my_location.line += 1;
 
         // not sure if this is needed
-        if (feof(file))
+        if (file.eof())
             break;
 
         char* ptr = NULL;
-        if ((ptr = vtr::strtok(buffer, TOKENS, file, buffer))) {
+        if ((ptr = file.strtok(buffer, TOKENS, buffer))) {
             if (!strcmp(ptr, ".end"))
                 break;
 
             if (!strcmp(ptr, ".inputs")) {
                 /* store the inputs in array of string */
-                while ((ptr = vtr::strtok(NULL, TOKENS, file, buffer))) {
+                while ((ptr = file.strtok(NULL, TOKENS, buffer))) {
                     input_names = (char**)vtr::realloc(input_names, sizeof(char*) * (input_names_count + 1));
                     input_names[input_names_count++] = vtr::strdup(ptr);
                 }
             } else if (!strcmp(ptr, ".names") || !strcmp(ptr, ".latch")) {
-                while ((ptr = vtr::strtok(NULL, TOKENS, file, buffer))) {
+                while ((ptr = file.strtok(NULL, TOKENS, buffer))) {
                     int i;
                     for (i = 0; i < input_names_count; i++) {
                         if (!strcmp(ptr, input_names[i])) {
@@ -1419,12 +1428,9 @@ char* blif::reader::search_clock_name() {
                 found = 1;
             }
         }
-
-        /* clean up */
-        vtr::free(buffer);
     }
     my_location.line = last_line;
-    fsetpos(file, &pos);
+    file.seek(pos);
 
     if (found) {
         to_return = input_names[0];
@@ -1437,6 +1443,7 @@ char* blif::reader::search_clock_name() {
         }
     }
 
+    latch_clock_name = vtr::strdup(to_return);
     vtr::free(input_names);
 
     return to_return;
@@ -1729,17 +1736,14 @@ hard_block_models* blif::reader::create_hard_block_models() {
  */
 int blif::reader::count_blif_lines() {
     int local_num_lines = 0;
-    char* buffer = NULL;
-    while (getbline(buffer, READ_BLIF_BUFFER, file)) {
+    char* buffer = file.scratch_buffer();
+    while (file.gets(buffer, READ_BLIF_BUFFER)) {
         if (strstr(buffer, ".end"))
             break;
         local_num_lines++;
     }
 
-    rewind(file);
-
-    /* clean up */
-    vtr::free(buffer);
+    file.rewind();
 
     return local_num_lines;
 }
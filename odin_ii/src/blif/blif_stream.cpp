@@ -0,0 +1,190 @@
+/*
+ * Copyright 2023 CAS—Atlantic (University of New Brunswick, CASA)
+ * 
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "blif_stream.h"
+#include "blif.h"
+#include "odin_error.h"
+
+#include "vtr_memory.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#    define BLIF_STREAM_MMAP
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+blif_stream::blif_stream()
+    : data(NULL)
+    , size(0)
+    , position(0)
+    , is_mapped(false)
+    , hit_end(false)
+    , cont(false)
+    , scratch(NULL) {}
+
+blif_stream::~blif_stream() {
+    close();
+    vtr::free(scratch);
+}
+
+bool blif_stream::open(const char* file_name) {
+    close();
+
+#ifdef BLIF_STREAM_MMAP
+    int fd = ::open(file_name, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == 0 && S_ISREG(file_stat.st_mode) && file_stat.st_size > 0) {
+        void* mapping = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            madvise(mapping, file_stat.st_size, MADV_SEQUENTIAL);
+            data = static_cast<const char*>(mapping);
+            size = file_stat.st_size;
+            is_mapped = true;
+        }
+    }
+    ::close(fd);
+
+    if (is_mapped)
+        return true;
+#endif
+
+    /* empty or not mappable: read the whole file instead */
+    FILE* fp = std::fopen(file_name, "rb");
+    if (fp == NULL)
+        return false;
+
+    char* buffer = NULL;
+    size_t capacity = 0;
+    size_t length_read = 0;
+    do {
+        capacity = capacity ? 2 * capacity : READ_BLIF_BUFFER;
+        buffer = (char*)vtr::realloc(buffer, capacity);
+        length_read += std::fread(buffer + length_read, 1, capacity - length_read, fp);
+    } while (length_read == capacity);
+    std::fclose(fp);
+
+    data = buffer;
+    size = length_read;
+    return true;
+}
+
+void blif_stream::close() {
+#ifdef BLIF_STREAM_MMAP
+    if (is_mapped)
+        munmap(const_cast<char*>(data), size);
+#endif
+    if (!is_mapped)
+        vtr::free(const_cast<char*>(data));
+
+    data = NULL;
+    size = 0;
+    position = 0;
+    is_mapped = false;
+    hit_end = false;
+    cont = false;
+}
+
+char* blif_stream::gets(char* buf, size_t buf_size) {
+    cont = false;
+
+    if (position >= size) {
+        hit_end = true;
+        return NULL;
+    }
+
+    const char* line = data + position;
+    const char* end = data + size;
+    const char* ptr = line;
+    while (ptr != end && *ptr != '\n' && *ptr != '\r' && *ptr != '#')
+        ptr++;
+
+    size_t length = ptr - line;
+    if (length + 2 > buf_size)
+        error_message(PARSE_BLIF, unknown_location,
+                      "line is too long for input buffer. All lines must be at most %zu characters long.\n", buf_size - 2);
+
+    memcpy(buf, line, length);
+    buf[length] = '\0';
+
+    if (ptr == end) {
+        /* no newline before end of file - last line must be returned */
+        hit_end = true;
+        position = size;
+    } else if (*ptr == '#') {
+        /* comment, skip the rest of the line */
+        const char* newline = static_cast<const char*>(memchr(ptr, '\n', end - ptr));
+        if (newline) {
+            position = newline + 1 - data;
+        } else {
+            hit_end = true;
+            position = size;
+        }
+    } else {
+        /* newline (cross-platform), a '\' at the end of the line continues it */
+        position = ptr + 1 - data;
+        if (length != 0 && buf[length - 1] == '\\') {
+            cont = true;
+            buf[length - 1] = '\n';
+        } else {
+            buf[length] = '\n';
+            buf[length + 1] = '\0';
+        }
+    }
+
+    return buf;
+}
+
+char* blif_stream::strtok(char* ptr, const char* tokens, char* buf) {
+    char* val = std::strtok(ptr, tokens);
+    while (val == NULL && cont) {
+        /* null value and a continuation line */
+        if (gets(buf, READ_BLIF_BUFFER) == NULL)
+            return NULL;
+
+        val = std::strtok(buf, tokens);
+    }
+    return val;
+}
+
+char* blif_stream::scratch_buffer() {
+    if (!scratch)
+        scratch = (char*)vtr::malloc(READ_BLIF_BUFFER * sizeof(char));
+
+    return scratch;
+}
+
+void blif_stream::seek(size_t pos) {
+    position = (pos < size) ? pos : size;
+    hit_end = false;
+    cont = false;
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2023 CAS—Atlantic (University of New Brunswick, CASA)
+ * 
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __BLIF_STREAM_H__
+#define __BLIF_STREAM_H__
+
+#include <cstddef>
+
+/**
+ * @brief A read-only view of a whole BLIF file, which is read line by line.
+ *
+ * The file is mapped in memory (or read at once where it cannot be mapped), so that
+ * the lines are copied straight from the mapping into the caller's buffer, and
+ * scanning ahead for a model or a bit map and coming back is a matter of moving
+ * an offset, instead of re-reading the file through stdio.
+ *
+ * The lines are read with the semantics of vtr::fgets/vtr::strtok: a '#' starts a
+ * comment running to the end of the line, and a line ending with '\' is continued
+ * on the next one.
+ */
+class blif_stream {
+  public:
+    blif_stream();
+    ~blif_stream();
+
+    blif_stream(const blif_stream&) = delete;
+    blif_stream& operator=(const blif_stream&) = delete;
+
+    /**
+     * @brief Opens the given file, returns false if it cannot be read
+     */
+    bool open(const char* file_name);
+
+    /**
+     * @brief Releases the file
+     */
+    void close();
+
+    /**
+     * @brief Copies the next line into buf, like vtr::fgets
+     *
+     * @param buf the line buffer
+     * @param buf_size the size of the line buffer
+     *
+     * @return null pointer if end of the file, otherwise buf
+     */
+    char* gets(char* buf, size_t buf_size);
+
+    /**
+     * @brief Returns the next token of the line, like vtr::strtok: the
+     * continuation lines are read into buf (of READ_BLIF_BUFFER characters)
+     */
+    char* strtok(char* ptr, const char* tokens, char* buf);
+
+    /**
+     * @brief A line buffer owned by the stream, for the scans ahead of the current line
+     */
+    char* scratch_buffer();
+
+    /**
+     * @brief The position of the next line, and whether the end of the file was hit,
+     * as fgetpos/fsetpos/rewind/feof would give them
+     */
+    size_t tell() const { return position; }
+    void seek(size_t pos);
+    void rewind() { seek(0); }
+    bool eof() const { return hit_end; }
+
+  private:
+    const char* data;
+    size_t size;
+    size_t position;
+
+    // true if data is mapped, otherwise it is allocated
+    bool is_mapped;
+    bool hit_end;
+    // was the last line continued? (used by strtok)
+    bool cont;
+
+    char* scratch;
+};
+
+#endif
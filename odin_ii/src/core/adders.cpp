@@ -435,6 +435,7 @@ void init_split_adder(nnode_t* node, nnode_t* ptr, int a, int sizea, int b, int
     /* Set the number of pins and re-locate previous pin entries */
     ptr->num_input_pins = current_sizea + current_sizeb + cin;
     ptr->input_pins = (npin_t**)vtr::malloc(sizeof(void*) * (current_sizea + current_sizeb + cin));
+    ptr->input_pins_capacity = ptr->num_input_pins;
     //if flaga or flagb = 1, the input pins should be empty.
     if (flaga == 1) {
         for (i = 0; i < current_sizea; i++)
@@ -579,6 +580,7 @@ void init_split_adder(nnode_t* node, nnode_t* ptr, int a, int sizea, int b, int
 
     ptr->num_output_pins = output;
     ptr->output_pins = (npin_t**)vtr::malloc(sizeof(void*) * output);
+    ptr->output_pins_capacity = ptr->num_output_pins;
     for (i = 0; i < output; i++)
         ptr->output_pins[i] = NULL;
 
@@ -24,6 +24,8 @@
  */
 
 #include <cstring>
+#include <map>
+#include <tuple>
 
 #include "odin_types.h"
 #include "odin_util.h"
@@ -38,8 +40,33 @@
 using vtr::t_linked_vptr;
 struct block_memory_information_t block_memories_info;
 
-void map_bram_to_mem_hardblocks(block_memory_t* bram, netlist_t* netlist);
-void map_rom_to_mem_hardblocks(block_memory_t* rom, netlist_t* netlist);
+/*
+ * The shape and port configuration of a block memory, which
+ * decide how it is mapped to the memory hard blocks
+ */
+struct block_memory_config_t {
+    bool read_only;
+    int width;
+    int depth;
+    long rd_ports;
+    long wr_ports;
+    bool same_addrs;
+
+    bool operator<(const block_memory_config_t& other) const {
+        return std::tie(read_only, width, depth, rd_ports, wr_ports, same_addrs)
+               < std::tie(other.read_only, other.width, other.depth, other.rd_ports, other.wr_ports, other.same_addrs);
+    }
+};
+
+/* maps a block memory to the memory hard blocks */
+typedef void (*block_memory_mapper_t)(block_memory_t* mem, netlist_t* netlist);
+/* the mapping resolved for each block memory configuration */
+typedef std::map<block_memory_config_t, block_memory_mapper_t> block_memory_mapping_cache;
+
+static block_memory_config_t get_block_memory_config(block_memory_t* mem, bool read_only);
+static block_memory_mapper_t resolve_rom_mapping(const block_memory_config_t& config, t_model* lutram_model);
+static block_memory_mapper_t resolve_bram_mapping(const block_memory_config_t& config, t_model* lutram_model);
+static void map_block_memory_to_mem_hardblocks(block_memory_t* mem, bool read_only, block_memory_mapping_cache& cache, t_model* lutram_model, netlist_t* netlist);
 
 static void create_r_single_port_ram(block_memory_t* rom, netlist_t* netlist);
 static void create_2r_dual_port_ram(block_memory_t* rom, netlist_t* netlist);
@@ -1011,28 +1038,49 @@ static void create_2rw_multiplexed_dual_port_ram(block_memory_t* bram, netlist_t
 }
 
 /**
- * (function: map_rom_to_mem_hardblocks)
+ * (function: get_block_memory_config)
  * 
- * @brief mapping a read-only memory to single_port_ram or 
- * dual_port_ram according to the number and source of its ports
+ * @brief extract the shape and port configuration of a block memory,
+ * i.e. everything its mapping to the memory hard blocks depends on
  * 
- * @param rom pointer to the read only memory
- * @param netlist pointer to the current netlist file
+ * @param mem pointer to the block memory or read only memory
+ * @param read_only whether mem is a read only memory
+ * 
+ * @return the configuration of the memory
  */
-void map_rom_to_mem_hardblocks(block_memory_t* rom, netlist_t* netlist) {
-    nnode_t* node = rom->node;
+static block_memory_config_t get_block_memory_config(block_memory_t* mem, bool read_only) {
+    nnode_t* node = mem->node;
 
-    int width = node->attributes->DBITS;
-    int depth = shift_left_value_with_overflow_check(0X1, node->attributes->ABITS, rom->loc);
+    block_memory_config_t config;
+    config.read_only = read_only;
+    config.width = node->attributes->DBITS;
+    config.depth = shift_left_value_with_overflow_check(0X1, node->attributes->ABITS, mem->loc);
+    /* since the data1_w + data2_w == data_out for DPRAM */
+    config.rd_ports = node->attributes->RD_PORTS;
+    config.wr_ports = node->attributes->WR_PORTS;
+    /* only the memories mapped by their address drivers need to compare them */
+    config.same_addrs = (!read_only && config.wr_ports == (config.rd_ports == 1)) ? check_same_addrs(mem) : false;
 
-    int rd_ports = node->attributes->RD_PORTS;
-    int wr_ports = node->attributes->WR_PORTS;
+    return (config);
+}
 
+/**
+ * (function: resolve_rom_mapping)
+ * 
+ * @brief find how a read-only memory with the given configuration is
+ * mapped to single_port_ram or dual_port_ram according to the number
+ * and source of its ports
+ * 
+ * @param config the read only memory configuration
+ * @param lutram_model the LUTRAM hard block of the architecture, if any
+ * 
+ * @return the routine mapping such memories, NULL if left unmapped
+ */
+static block_memory_mapper_t resolve_rom_mapping(const block_memory_config_t& config, t_model* lutram_model) {
     /* Read Only Memory validateion */
-    oassert(wr_ports == 0);
+    oassert(config.wr_ports == 0);
 
-    int rom_relative_area = depth * width;
-    t_model* lutram_model = find_hard_block(LUTRAM_string);
+    int rom_relative_area = config.depth * config.width;
 
     if (lutram_model != NULL
         && (LUTRAM_INFERENCE_THRESHOLD_MIN <= rom_relative_area)
@@ -1040,49 +1088,42 @@ void map_rom_to_mem_hardblocks(block_memory_t* rom, netlist_t* netlist) {
         /* map to LUTRAM */
         // nnode_t* lutram = NULL;
         /* TODO */
-    } else {
-        /* need to split the rom from the data width */
-        if (rd_ports == 1) {
-            /* create the ROM and allocate ports according to the SPRAM hard block */
-            create_r_single_port_ram(rom, netlist);
+        return (NULL);
+    }
 
-        } else if (rd_ports == 2) {
-            /* create the ROM and allocate ports according to the DPRAM hard block */
-            create_2r_dual_port_ram(rom, netlist);
+    /* need to split the rom from the data width */
+    if (config.rd_ports == 1) {
+        /* create the ROM and allocate ports according to the SPRAM hard block */
+        return (create_r_single_port_ram);
 
-        } else {
-            /* more than 2 read ports wil be handle using multiplexed ports and a SPRAM */
-            create_nr_single_port_ram(rom, netlist);
-        }
+    } else if (config.rd_ports == 2) {
+        /* create the ROM and allocate ports according to the DPRAM hard block */
+        return (create_2r_dual_port_ram);
+
+    } else {
+        /* more than 2 read ports wil be handle using multiplexed ports and a SPRAM */
+        return (create_nr_single_port_ram);
     }
 }
 
 /**
- * (function: map_bram_to_mem_hardblocks)
+ * (function: resolve_bram_mapping)
  * 
- * @brief mapping a block_memory (has both read and write access) to single_port_ram 
- * or dual_port_ram according to the number and source of its ports
+ * @brief find how a block_memory (has both read and write access) with the
+ * given configuration is mapped to single_port_ram or dual_port_ram
+ * according to the number and source of its ports
  * 
- * @param bram pointer to the block memory
- * @param netlist pointer to the current netlist file
+ * @param config the block memory configuration
+ * @param lutram_model the LUTRAM hard block of the architecture, if any
+ * 
+ * @return the routine mapping such memories, NULL if left unmapped
  */
-void map_bram_to_mem_hardblocks(block_memory_t* bram, netlist_t* netlist) {
-    nnode_t* node = bram->node;
-
-    int width = node->attributes->DBITS;
-    int depth = shift_left_value_with_overflow_check(0X1, node->attributes->ABITS, bram->loc);
-
-    /* since the data1_w + data2_w == data_out for DPRAM */
-    long rd_ports = node->attributes->RD_PORTS;
-    long wr_ports = node->attributes->WR_PORTS;
-
+static block_memory_mapper_t resolve_bram_mapping(const block_memory_config_t& config, t_model* lutram_model) {
     /**
      * Potential place for checking block ram if their relative 
      * size is less than a threshold, they could be mapped on LUTRAM
      */
-
-    int bram_relative_area = depth * width;
-    t_model* lutram_model = find_hard_block(LUTRAM_string);
+    int bram_relative_area = config.depth * config.width;
 
     if (lutram_model != NULL
         && (LUTRAM_INFERENCE_THRESHOLD_MIN <= bram_relative_area)
@@ -1090,44 +1131,78 @@ void map_bram_to_mem_hardblocks(block_memory_t* bram, netlist_t* netlist) {
         /* map to LUTRAM */
         // nnode_t* lutram = NULL;
         /* TODO */
-    } else {
-        if (wr_ports == (rd_ports == 1)) {
-            if (check_same_addrs(bram)) {
-                /* create a single port ram and allocate ports according to the SPRAM hard block */
-                create_rw_single_port_ram(bram, netlist);
-
-            } else {
-                /* create a dual port ram and allocate ports according to the DPRAM hard block */
-                create_rw_dual_port_ram(bram, netlist);
-            }
+        return (NULL);
+    }
 
-        } else if (rd_ports == 1 && wr_ports == 2) {
-            /* create a dual port ram and allocate ports according to the DPRAM hard block */
-            create_r2w_dual_port_ram(bram, netlist);
+    if (config.wr_ports == (config.rd_ports == 1)) {
+        if (config.same_addrs) {
+            /* create a single port ram and allocate ports according to the SPRAM hard block */
+            return (create_rw_single_port_ram);
 
-        } else if (rd_ports == 2 && wr_ports == 1) {
+        } else {
             /* create a dual port ram and allocate ports according to the DPRAM hard block */
-            create_2rw_dual_port_ram(bram, netlist);
+            return (create_rw_dual_port_ram);
+        }
 
-        } else if (rd_ports == 2 && wr_ports == 2) {
-            /* create a dual port ram and allocate ports according to the DPRAM hard block */
-            create_2r2w_dual_port_ram(bram, netlist);
+    } else if (config.rd_ports == 1 && config.wr_ports == 2) {
+        /* create a dual port ram and allocate ports according to the DPRAM hard block */
+        return (create_r2w_dual_port_ram);
 
-        } else {
-            /* create a dual port ram and muxed all read together and all writes together */
-            create_nrmw_dual_port_ram(bram, netlist);
-        }
+    } else if (config.rd_ports == 2 && config.wr_ports == 1) {
+        /* create a dual port ram and allocate ports according to the DPRAM hard block */
+        return (create_2rw_dual_port_ram);
+
+    } else if (config.rd_ports == 2 && config.wr_ports == 2) {
+        /* create a dual port ram and allocate ports according to the DPRAM hard block */
+        return (create_2r2w_dual_port_ram);
+
+    } else {
+        /* create a dual port ram and muxed all read together and all writes together */
+        return (create_nrmw_dual_port_ram);
     }
 }
 
+/**
+ * (function: map_block_memory_to_mem_hardblocks)
+ * 
+ * @brief mapping a block memory or read-only memory to single_port_ram
+ * or dual_port_ram. The mapping of each memory configuration is resolved
+ * once and reused by all the memories sharing it, which only have their
+ * own ports hooked to the hard blocks.
+ * 
+ * @param mem pointer to the block memory or read only memory
+ * @param read_only whether mem is a read only memory
+ * @param cache the mappings resolved so far, by memory configuration
+ * @param lutram_model the LUTRAM hard block of the architecture, if any
+ * @param netlist pointer to the current netlist file
+ */
+static void map_block_memory_to_mem_hardblocks(block_memory_t* mem, bool read_only, block_memory_mapping_cache& cache, t_model* lutram_model, netlist_t* netlist) {
+    block_memory_config_t config = get_block_memory_config(mem, read_only);
+
+    auto cached_mapper = cache.find(config);
+    if (cached_mapper == cache.end()) {
+        block_memory_mapper_t mapper = (read_only) ? resolve_rom_mapping(config, lutram_model) : resolve_bram_mapping(config, lutram_model);
+        cached_mapper = cache.emplace(config, mapper).first;
+    }
+
+    if (cached_mapper->second != NULL)
+        cached_mapper->second(mem, netlist);
+}
+
 /**
  * (function: iterate_block_memories)
  * 
- * @brief iterate over block memories to map them to DP/SPRAMs
+ * @brief iterate over block memories to map them to DP/SPRAMs.
+ * Designs usually instantiate many memories of the same configuration,
+ * so their mapping is resolved once per configuration.
  * 
  * @param netlist pointer to the current netlist file
  */
 void iterate_block_memories(netlist_t* netlist) {
+    /* the architecture memory model does not change while iterating */
+    t_model* lutram_model = find_hard_block(LUTRAM_string);
+    block_memory_mapping_cache cache;
+
     t_linked_vptr* ptr = block_memories_info.block_memory_list;
     while (ptr != NULL) {
         block_memory_t* bram = (block_memory_t*)ptr->data_vptr;
@@ -1135,7 +1210,7 @@ void iterate_block_memories(netlist_t* netlist) {
         /* validation */
         oassert(bram != NULL);
 
-        map_bram_to_mem_hardblocks(bram, netlist);
+        map_block_memory_to_mem_hardblocks(bram, false, cache, lutram_model, netlist);
         ptr = ptr->next;
     }
 
@@ -1146,7 +1221,7 @@ void iterate_block_memories(netlist_t* netlist) {
         /* validation */
         oassert(rom != NULL);
 
-        map_rom_to_mem_hardblocks(rom, netlist);
+        map_block_memory_to_mem_hardblocks(rom, true, cache, lutram_model, netlist);
         ptr = ptr->next;
     }
 }
@@ -573,6 +573,7 @@ void init_split_multiplier(nnode_t* node, nnode_t* ptr, int offa, int a, int off
     /* Set the number of pins and re-locate previous pin entries */
     ptr->num_input_pins = a + b;
     ptr->input_pins = (npin_t**)vtr::malloc(sizeof(void*) * (a + b));
+    ptr->input_pins_capacity = ptr->num_input_pins;
     for (i = 0; i < a; i++) {
         if (node_a)
             add_input_pin_to_node(ptr, copy_input_npin(node_a->input_pins[i]), i);
@@ -590,6 +591,7 @@ void init_split_multiplier(nnode_t* node, nnode_t* ptr, int offa, int a, int off
     /* Prep output pins for connecting to cascaded multipliers */
     ptr->num_output_pins = a + b;
     ptr->output_pins = (npin_t**)vtr::malloc(sizeof(void*) * (a + b));
+    ptr->output_pins_capacity = ptr->num_output_pins;
     for (i = 0; i < a + b; i++)
         ptr->output_pins[i] = NULL;
 
@@ -626,12 +628,14 @@ void init_multiplier_adder(nnode_t* node, nnode_t* parent, int a, int b) {
     /* Set the number of input pins and clear pin entries */
     node->num_input_pins = a + b;
     node->input_pins = (npin_t**)vtr::malloc(sizeof(void*) * (a + b));
+    node->input_pins_capacity = node->num_input_pins;
     for (i = 0; i < a + b; i++)
         node->input_pins[i] = NULL;
 
     /* Set the number of output pins and clear pin entries */
     node->num_output_pins = size;
     node->output_pins = (npin_t**)vtr::malloc(sizeof(void*) * size);
+    node->output_pins_capacity = node->num_output_pins;
     for (i = 0; i < size; i++)
         node->output_pins[i] = NULL;
 
@@ -221,6 +221,7 @@ void init_split_adder_for_sub(nnode_t* node, nnode_t* ptr, int a, int sizea, int
     /* Set the number of pins and re-locate previous pin entries */
     ptr->num_input_pins = current_sizea + current_sizeb + cin;
     ptr->input_pins = (npin_t**)vtr::malloc(sizeof(void*) * (current_sizea + current_sizeb + cin));
+    ptr->input_pins_capacity = ptr->num_input_pins;
     //the normal sub: if flaga or flagb = 1, the input pins should be empty.
     //the unary sub: all input pins for a should be null, input pins for b should be connected to node
     if (node->num_input_port_sizes == 1) {
@@ -303,6 +304,7 @@ void init_split_adder_for_sub(nnode_t* node, nnode_t* ptr, int a, int sizea, int
 
     ptr->num_output_pins = output;
     ptr->output_pins = (npin_t**)vtr::malloc(sizeof(void*) * output);
+    ptr->output_pins_capacity = ptr->num_output_pins;
     for (i = 0; i < output; i++)
         ptr->output_pins[i] = NULL;
 
@@ -24,7 +24,8 @@
  */
 
 #include <vector>
-#include <math.h> // ceil
+#include <algorithm> // stable_sort
+#include <math.h>    // ceil
 
 #include "mixing_optimization.h"
 #include "netlist_statistic.h"     // mixing_optimization_stats
@@ -55,6 +56,33 @@ void MixingOpt::perform(netlist_t*, std::vector<nnode_t*>&) {
     exit(0);
 }
 
+/**
+ * Returns the indices of the (at most blocks_count) heaviest hardenable nodes, heaviest first
+ * and in their original order among equal weights. This is the order in which repeatedly
+ * picking the first node of maximal weight would harden them, without rescanning all the
+ * nodes for every hardened one.
+ */
+template<typename Hardenable>
+static std::vector<size_t> heaviest_hardenable_nodes(std::vector<nnode_t*>& weighted_nodes, int blocks_count, Hardenable hardenable) {
+    std::vector<size_t> candidates;
+    for (size_t j = 0; j < weighted_nodes.size(); j++) {
+        if (weighted_nodes[j]
+            && weighted_nodes[j]->weight > -1
+            && hardenable(weighted_nodes[j])) {
+            candidates.push_back(j);
+        }
+    }
+
+    std::stable_sort(candidates.begin(), candidates.end(), [&](size_t a, size_t b) {
+        return weighted_nodes[a]->weight > weighted_nodes[b]->weight;
+    });
+
+    if (candidates.size() > (size_t)std::max(blocks_count, 0))
+        candidates.resize(std::max(blocks_count, 0));
+
+    return candidates;
+}
+
 MultsOpt::MultsOpt(int _exact)
     : MixingOpt(1.0, MULTIPLY) {
     this->_blocks_count = _exact;
@@ -86,27 +114,11 @@ void MultsOpt::assign_weights(netlist_t* netlist, std::vector<nnode_t*> nodes) {
 }
 
 void MultsOpt::perform(netlist_t* netlist, std::vector<nnode_t*>& weighted_nodes) {
-    size_t nodes_count = weighted_nodes.size();
-
-    // per optimization, instantiate hard logic
-    for (int i = 0; i < this->_blocks_count; i++) {
-        int maximal_cost = -1;
-        int index = -1;
-        for (size_t j = 0; j < nodes_count; j++) {
-            // if found a new maximal cost that is higher than a current maximum AND is not restricted by input
-            // params for minimal "hardenable" multiplier width
-            if (maximal_cost < weighted_nodes[j]->weight && this->hardenable(weighted_nodes[j])) {
-                maximal_cost = weighted_nodes[j]->weight;
-                index = j;
-            }
-        }
-
-        // if there are no suitable nodes left, leave the loop to
-        // implement remaining nodes in soft logic
-        if (index < 0)
-            break;
-
-        // indicate for future iterations the node was hardened
+    // per optimization, instantiate hard logic for the nodes of maximal cost which are not restricted
+    // by input params for minimal "hardenable" multiplier width
+    auto hardenable = [this](nnode_t* node) { return this->hardenable(node); };
+    for (size_t index : heaviest_hardenable_nodes(weighted_nodes, this->_blocks_count, hardenable)) {
+        // indicate the node was hardened
         weighted_nodes[index]->weight = -1;
 
         if (hard_multipliers) {
@@ -114,13 +126,10 @@ void MultsOpt::perform(netlist_t* netlist, std::vector<nnode_t*>& weighted_nodes
         }
     }
 
-    // From the end of the vector, remove all nodes that were implemented in hard logic. The remaining
+    // Remove all nodes that were implemented in hard logic. The remaining
     // nodes will be instantiated in soft_map_remaining_nodes
-    for (int i = nodes_count - 1; i >= 0; i--) {
-        if (weighted_nodes[i]->weight == -1) {
-            weighted_nodes.erase(weighted_nodes.begin() + i);
-        }
-    }
+    weighted_nodes.erase(std::remove_if(weighted_nodes.begin(), weighted_nodes.end(), [](nnode_t* node) { return node->weight == -1; }),
+                         weighted_nodes.end());
 }
 
 AddersOpt::AddersOpt(int _exact)
@@ -177,29 +186,11 @@ void AddersOpt::scale_counts() {
 }
 
 void AddersOpt::perform(netlist_t* netlist, std::vector<nnode_t*>& weighted_nodes) {
-    size_t nodes_count = weighted_nodes.size();
-
-    // per optimization, instantiate hard logic
-    for (int i = 0; i < this->_blocks_count; i++) {
-        int maximal_cost = -1;
-        int index = -1;
-        for (size_t j = 0; j < nodes_count; j++) {
-            // if found a new maximal cost that is higher than a current maximum AND is not restricted by input
-            // params for minimal "hardenable" adder width
-            if (weighted_nodes[j]
-                && maximal_cost < weighted_nodes[j]->weight
-                && this->hardenable(weighted_nodes[j])) {
-                maximal_cost = weighted_nodes[j]->weight;
-                index = j;
-            }
-        }
-
-        // if there are no suitable nodes left, leave the loop to
-        // implement remaining nodes in soft logic
-        if (index < 0)
-            break;
-
-        // indicate for future iterations the node was hardened
+    // per optimization, instantiate hard logic for the nodes of maximal cost which are not restricted
+    // by input params for minimal "hardenable" adder width
+    auto hardenable = [this](nnode_t* node) { return this->hardenable(node); };
+    for (size_t index : heaviest_hardenable_nodes(weighted_nodes, this->_blocks_count, hardenable)) {
+        // indicate the node was hardened
         weighted_nodes[index]->weight = -1;
 
         if (hard_adders) {
@@ -208,13 +199,9 @@ void AddersOpt::perform(netlist_t* netlist, std::vector<nnode_t*>& weighted_node
         }
     }
 
-    // From the end of the vector, remove all nodes that were implemented in hard logic. The remaining
+    // Remove all nodes that were implemented in hard logic. The remaining
     // nodes will be instantiated in soft_map_remaining_nodes
-    for (int i = nodes_count - 1; i >= 0; i--) {
-        if (weighted_nodes[i] == NULL) {
-            weighted_nodes.erase(weighted_nodes.begin() + i);
-        }
-    }
+    weighted_nodes.erase(std::remove(weighted_nodes.begin(), weighted_nodes.end(), nullptr), weighted_nodes.end());
 }
 
 void MixingOpt::set_blocks_needed(int new_count) {
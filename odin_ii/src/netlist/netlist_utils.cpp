@@ -34,11 +34,88 @@
 #include "vtr_util.h"
 #include "vtr_memory.h"
 
+#include <algorithm>
+#include <vector>
+
+/* number of objects allocated at a time by a netlist_object_pool */
+#define NETLIST_OBJECTS_PER_SLAB 4096
+
+/*---------------------------------------------------------------------------------------------
+ * (class: netlist_object_pool)
+ * 	Allocates the nodes, pins and nets of the netlists in slabs, rather than
+ * 	with a malloc per object. Freed objects are kept on a free list for reuse,
+ * 	and the slabs are freed all at once when the last object is freed (i.e.
+ * 	when the netlists are freed).
+ *-------------------------------------------------------------------------------------------*/
+template<typename T>
+class netlist_object_pool {
+  public:
+    T* allocate() {
+        void* allocated;
+        if (free_list) {
+            allocated = free_list;
+            free_list = free_list->next;
+        } else {
+            if (slab_used == NETLIST_OBJECTS_PER_SLAB || slabs.empty()) {
+                slabs.push_back((T*)vtr::malloc(sizeof(T) * NETLIST_OBJECTS_PER_SLAB));
+                slab_used = 0;
+            }
+            allocated = &slabs.back()[slab_used++];
+        }
+        num_allocated++;
+
+        return (T*)my_init_struct(allocated, sizeof(T));
+    }
+
+    void release(T* to_free) {
+        free_object_t* freed = (free_object_t*)to_free;
+        freed->next = free_list;
+        free_list = freed;
+
+        if (--num_allocated == 0) {
+            for (T* slab : slabs)
+                vtr::free(slab);
+            slabs.clear();
+            free_list = NULL;
+            slab_used = 0;
+        }
+    }
+
+  private:
+    struct free_object_t {
+        free_object_t* next;
+    };
+    static_assert(sizeof(T) >= sizeof(free_object_t), "netlist objects must be able to hold a free list link");
+
+    std::vector<T*> slabs;
+    long slab_used = 0;
+    long num_allocated = 0;
+    free_object_t* free_list = NULL;
+};
+
+static netlist_object_pool<nnode_t> nnode_pool;
+static netlist_object_pool<npin_t> npin_pool;
+static netlist_object_pool<nnet_t> nnet_pool;
+
+/*---------------------------------------------------------------------------------------------
+ * (function: grow_pin_array)
+ * 	Grows a pin array to hold at least size pins, doubling its capacity so
+ * 	that adding pins one at a time doesn't realloc every time
+ *-------------------------------------------------------------------------------------------*/
+template<typename S>
+static npin_t** grow_pin_array(npin_t** pins, S& capacity, S size) {
+    if (size > capacity) {
+        capacity = std::max(size, 2 * capacity);
+        pins = (npin_t**)vtr::realloc(pins, sizeof(npin_t*) * capacity);
+    }
+    return pins;
+}
+
 /*---------------------------------------------------------------------------------------------
  * (function: allocate_nnode)
  *-------------------------------------------------------------------------------------------*/
 nnode_t* allocate_nnode(loc_t loc) {
-    nnode_t* new_node = (nnode_t*)my_malloc_struct(sizeof(nnode_t));
+    nnode_t* new_node = nnode_pool.allocate();
 
     new_node->loc = loc;
     new_node->name = NULL;
@@ -49,8 +126,10 @@ nnode_t* allocate_nnode(loc_t loc) {
 
     new_node->input_pins = NULL;
     new_node->num_input_pins = 0;
+    new_node->input_pins_capacity = 0;
     new_node->output_pins = NULL;
     new_node->num_output_pins = 0;
+    new_node->output_pins_capacity = 0;
 
     new_node->input_port_sizes = NULL;
     new_node->num_input_port_sizes = 0;
@@ -102,7 +181,9 @@ nnode_t* free_nnode(nnode_t* to_free) {
                 vtr::free(to_free->input_pins[i]->name);
                 to_free->input_pins[i]->name = NULL;
             }
-            to_free->input_pins[i] = (npin_t*)vtr::free(to_free->input_pins[i]);
+            if (to_free->input_pins[i])
+                npin_pool.release(to_free->input_pins[i]);
+            to_free->input_pins[i] = NULL;
         }
 
         to_free->input_pins = (npin_t**)vtr::free(to_free->input_pins);
@@ -112,7 +193,9 @@ nnode_t* free_nnode(nnode_t* to_free) {
                 vtr::free(to_free->output_pins[i]->name);
                 to_free->output_pins[i]->name = NULL;
             }
-            to_free->output_pins[i] = (npin_t*)vtr::free(to_free->output_pins[i]);
+            if (to_free->output_pins[i])
+                npin_pool.release(to_free->output_pins[i]);
+            to_free->output_pins[i] = NULL;
         }
 
         to_free->output_pins = (npin_t**)vtr::free(to_free->output_pins);
@@ -129,8 +212,9 @@ nnode_t* free_nnode(nnode_t* to_free) {
         }
 
         /* now free the node */
+        nnode_pool.release(to_free);
     }
-    return (nnode_t*)vtr::free(to_free);
+    return NULL;
 }
 
 /*-------------------------------------------------------------------------
@@ -145,7 +229,7 @@ void allocate_more_input_pins(nnode_t* node, int width) {
         return;
     }
 
-    node->input_pins = (npin_t**)vtr::realloc(node->input_pins, sizeof(npin_t*) * (node->num_input_pins + width));
+    node->input_pins = grow_pin_array(node->input_pins, node->input_pins_capacity, node->num_input_pins + width);
     for (i = 0; i < width; i++) {
         node->input_pins[node->num_input_pins + i] = NULL;
     }
@@ -164,7 +248,7 @@ void allocate_more_output_pins(nnode_t* node, int width) {
         return;
     }
 
-    node->output_pins = (npin_t**)vtr::realloc(node->output_pins, sizeof(npin_t*) * (node->num_output_pins + width));
+    node->output_pins = grow_pin_array(node->output_pins, node->output_pins_capacity, node->num_output_pins + width);
     for (i = 0; i < width; i++) {
         node->output_pins[node->num_output_pins + i] = NULL;
     }
@@ -195,7 +279,7 @@ void add_input_port_information(nnode_t* node, int port_width) {
 npin_t* allocate_npin() {
     npin_t* new_pin;
 
-    new_pin = (npin_t*)my_malloc_struct(sizeof(npin_t));
+    new_pin = npin_pool.allocate();
 
     new_pin->name = NULL;
     new_pin->type = NO_ID;
@@ -231,8 +315,9 @@ npin_t* free_npin(npin_t* to_free) {
         to_free->mapping = NULL;
 
         /* now free the pin */
+        npin_pool.release(to_free);
     }
-    return (npin_t*)vtr::free(to_free);
+    return NULL;
 }
 
 /*-------------------------------------------------------------------------
@@ -282,13 +367,14 @@ npin_t* copy_input_npin(npin_t* copy_pin) {
  * (function: allocate_nnet)
  *-------------------------------------------------------------------------------------------*/
 nnet_t* allocate_nnet() {
-    nnet_t* new_net = (nnet_t*)my_malloc_struct(sizeof(nnet_t));
+    nnet_t* new_net = nnet_pool.allocate();
 
     new_net->name = NULL;
     new_net->driver_pins = NULL;
     new_net->num_driver_pins = 0;
     new_net->fanout_pins = NULL;
     new_net->num_fanout_pins = 0;
+    new_net->fanout_pins_capacity = 0;
     new_net->combined = false;
 
     new_net->net_data = NULL;
@@ -313,8 +399,9 @@ nnet_t* free_nnet(nnet_t* to_free) {
             vtr::free(to_free->driver_pins);
 
         /* now free the net */
+        nnet_pool.release(to_free);
     }
-    return (nnet_t*)vtr::free(to_free);
+    return NULL;
 }
 
 /*---------------------------------------------------------------------------
@@ -378,7 +465,7 @@ void add_fanout_pin_to_net(nnet_t* net, npin_t* pin) {
     oassert(pin != NULL);
     oassert(pin->type != OUTPUT);
     /* assumes the pin spots have been allocated and the pin */
-    net->fanout_pins = (npin_t**)vtr::realloc(net->fanout_pins, sizeof(npin_t*) * (net->num_fanout_pins + 1));
+    net->fanout_pins = grow_pin_array(net->fanout_pins, net->fanout_pins_capacity, net->num_fanout_pins + 1);
     net->fanout_pins[net->num_fanout_pins] = pin;
     net->num_fanout_pins++;
     /* record the node and pin spot in the pin */
@@ -30,6 +30,10 @@
 #include <sstream>
 #include <dlfcn.h>
 #include <thread>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <condition_variable>
 
 #include "simulate_blif.h"
 #include "odin_buffer.h"
@@ -113,6 +117,8 @@ static inline bool is_clock_node(nnode_t* node) {
                     || (std::string(node->name) == DEFAULT_CLOCK_NAME));
 }
 
+static void start_simulation_threads(int num_threads);
+static void stop_simulation_threads();
 static void simulate_cycle(int cycle, stages_t* s);
 static stages_t* simulate_first_cycle(netlist_t* netlist, int cycle, lines_t* output_lines);
 
@@ -237,8 +243,10 @@ void simulate_netlist(netlist_t* netlist) {
  */
 sim_data_t* init_simulation(netlist_t* netlist) {
     number_of_workers = global_args.parralelized_simulation.value();
-    if (number_of_workers > 1)
+    if (number_of_workers > 1) {
         printf("Executing simulation with maximum of %d threads\n", number_of_workers);
+        start_simulation_threads(number_of_workers);
+    }
 
     num_of_clock = 0;
 
@@ -334,6 +342,8 @@ sim_data_t* init_simulation(netlist_t* netlist) {
 }
 
 sim_data_t* terminate_simulation(sim_data_t* sim_data) {
+    stop_simulation_threads();
+
     free_stages(sim_data->stages);
 
     fclose(sim_data->act_out);
@@ -472,36 +482,112 @@ static void compute_and_store_part(int start, int end, int current_stage, stages
             compute_and_store_value(s->stages[current_stage][j], cycle);
 }
 
-static void simulate_cycle(int cycle, stages_t* s) {
-    double total_run_time = 0;
-    for (int i = 0; i < s->count; i++) {
-        double time = wall_time();
+/*
+ * Simulation threads, started once for the whole simulation.
+ *
+ * The nodes of a stage are handed out in chunks of SIM_NODES_PER_CHUNK from a
+ * shared counter, so a thread which finishes its chunk early takes the next one
+ * instead of waiting for a slower thread with a fixed share of the stage.
+ */
+class simulation_thread_pool {
+  public:
+    simulation_thread_pool(int num_threads) {
+        for (int i = 1; i < num_threads; i++)
+            threads.emplace_back(&simulation_thread_pool::run, this);
+    }
 
-        std::vector<std::thread> workers;
-        int previous_end = 0;
+    ~simulation_thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        work_cv.notify_all();
+        for (auto& thread : threads)
+            thread.join();
+    }
 
-        int nodes_per_thread = s->counts[i] / number_of_workers;
-        int remainder_nodes_per_thread = s->counts[i] % number_of_workers;
+    /*
+     * Computes all the nodes of a stage, using the calling thread and the pool threads.
+     */
+    void compute_stage(stages_t* s, int stage, int cycle) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            current_stages = s;
+            current_stage = stage;
+            current_cycle = cycle;
+            next_node = 0;
+            busy_threads = threads.size();
+            generation++;
+        }
+        work_cv.notify_all();
 
-        for (int id = 0; id < number_of_workers; id++) {
-            int start = previous_end;
-            int end = start + nodes_per_thread + ((remainder_nodes_per_thread > 0) ? 1 : 0);
+        compute_chunks();
 
-            remainder_nodes_per_thread -= 1;
-            previous_end = end + 1;
+        std::unique_lock<std::mutex> lock(mutex);
+        done_cv.wait(lock, [this] { return busy_threads == 0; });
+    }
 
-            if ((end - start) > 0) {
-                if (id < number_of_workers - 1) // if child threads
-                    workers.push_back(std::thread(compute_and_store_part, start, end, i, s, cycle));
-                else
-                    compute_and_store_part(start, end, i, s, cycle);
+  private:
+    void run() {
+        long seen_generation = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                work_cv.wait(lock, [&] { return stop || generation != seen_generation; });
+                if (stop)
+                    return;
+                seen_generation = generation;
             }
+
+            compute_chunks();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                busy_threads--;
+            }
+            done_cv.notify_one();
         }
+    }
+
+    void compute_chunks() {
+        int num_nodes = current_stages->counts[current_stage];
+        int start;
+        while ((start = next_node.fetch_add(SIM_NODES_PER_CHUNK)) < num_nodes)
+            compute_and_store_part(start, start + SIM_NODES_PER_CHUNK - 1, current_stage, current_stages, current_cycle);
+    }
+
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable work_cv; // signals a new stage (or stop) to the pool threads
+    std::condition_variable done_cv; // signals a pool thread finished the current stage
+    bool stop = false;
+    long generation = 0;
+    size_t busy_threads = 0;
+
+    // The stage being computed
+    stages_t* current_stages = NULL;
+    int current_stage = 0;
+    int current_cycle = 0;
+    std::atomic<int> next_node{0};
+};
+
+static std::unique_ptr<simulation_thread_pool> simulation_threads;
 
-        for (auto& worker : workers)
-            worker.join();
+static void start_simulation_threads(int num_threads) {
+    simulation_threads = std::make_unique<simulation_thread_pool>(num_threads);
+}
+
+static void stop_simulation_threads() {
+    simulation_threads.reset();
+}
 
-        total_run_time += wall_time() - time;
+static void simulate_cycle(int cycle, stages_t* s) {
+    for (int i = 0; i < s->count; i++) {
+        // Waking up the pool costs more than computing a few nodes
+        if (simulation_threads && s->counts[i] >= MIN_NODES_PER_WORKER)
+            simulation_threads->compute_stage(s, i, cycle);
+        else
+            compute_and_store_part(0, s->counts[i] - 1, i, s, cycle);
     }
 }
 
@@ -1619,12 +1705,17 @@ static void compute_generic_node(nnode_t* node, int cycle) {
     while (bit_map[0][lut_size] != 0)
         lut_size++;
 
+    // Read each input once, rather than once per line of the bit map
+    std::vector<BitSpace::bit_value_t> input_values(lut_size);
+    for (int j = 0; j < lut_size; j++)
+        input_values[j] = get_pin_value(node->input_pins[j], cycle);
+
     int found = 0;
     int i;
     for (i = 0; i < line_count_bitmap && (!found); i++) {
         int j;
         for (j = 0; j < lut_size; j++) {
-            BitSpace::bit_value_t value = get_pin_value(node->input_pins[j], cycle);
+            BitSpace::bit_value_t value = input_values[j];
             if (BitSpace::is_unk[value]) {
                 update_pin_value(node->output_pins[0], BitSpace::_x, cycle);
                 return;
@@ -45,6 +45,13 @@
 
 #define BUFFER_MAX_SIZE 1024
 
+/*
+ * Minimum number of nodes of a stage for it to be computed by several threads,
+ * and the number of nodes a thread takes at a time.
+ */
+#define MIN_NODES_PER_WORKER 64
+#define SIM_NODES_PER_CHUNK 16
+
 /*
  * Number of values to store for each pin at one time.
  * Determines how frequently we have to write to disk.
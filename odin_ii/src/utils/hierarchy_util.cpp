@@ -98,11 +98,10 @@ sc_hierarchy* copy_sc_hierarchy(sc_hierarchy* to_copy) {
 STRING_CACHE* copy_param_table_sc(STRING_CACHE* to_copy) {
     STRING_CACHE* sc;
 
-    sc = sc_new_string_cache();
+    sc = sc_copy_string_cache(to_copy);
 
-    for (long i = 0; i < to_copy->free; i++) {
-        long sc_spot = sc_add_string(sc, to_copy->string[i]);
-        sc->data[sc_spot] = (void*)ast_node_deep_copy((ast_node_t*)to_copy->data[i]);
+    for (long i = 0; i < sc->free; i++) {
+        sc->data[i] = (void*)ast_node_deep_copy((ast_node_t*)to_copy->data[i]);
     }
 
     return sc;
@@ -532,11 +532,13 @@ struct nnode_t {
 
     npin_t** input_pins; // the input pins
     long num_input_pins;
+    long input_pins_capacity; // allocated size of input_pins, when grown by allocate_more_input_pins
     int* input_port_sizes; // info about the input ports
     int num_input_port_sizes;
 
     npin_t** output_pins; // the output pins
     long num_output_pins;
+    long output_pins_capacity; // allocated size of output_pins, when grown by allocate_more_output_pins
     int* output_port_sizes; // info if there is ports
     int num_output_port_sizes;
 
@@ -612,8 +614,9 @@ struct nnet_t {
     int num_driver_pins;
     npin_t** driver_pins; // the pin that drives the net
 
-    npin_t** fanout_pins; // the pins pointed to by the net
-    int num_fanout_pins;  // the list size of pins
+    npin_t** fanout_pins;     // the pins pointed to by the net
+    int num_fanout_pins;      // the list size of pins
+    int fanout_pins_capacity; // the allocated size of fanout_pins
 
     short unique_net_data_id;
     void* net_data;
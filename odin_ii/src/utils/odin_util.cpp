@@ -676,17 +676,29 @@ std::string make_simple_name(char* input, const char* flatten_string, char flatt
  * (function: my_malloc_struct )
  *-----------------------------------------------------------------*/
 void* my_malloc_struct(long bytes_to_alloc) {
-    void* allocated = vtr::calloc(1, bytes_to_alloc);
-    static long int m_id = 0;
-
-    // ways to stop the execution at the point when a specific structure is built...note it needs to be m_id - 1 ... it's unique_id in most data structures
-    //oassert(m_id != 193);
+    void* allocated = vtr::malloc(bytes_to_alloc);
 
     if (allocated == NULL) {
         fprintf(stderr, "MEMORY FAILURE\n");
         oassert(0);
     }
 
+    return my_init_struct(allocated, bytes_to_alloc);
+}
+
+/*-----------------------------------------------------------------------
+ * (function: my_init_struct )
+ * 	Clears already allocated memory for a structure and marks its
+ * 	unique_id, as my_malloc_struct does for newly allocated memory
+ *-----------------------------------------------------------------*/
+void* my_init_struct(void* allocated, long bytes_to_alloc) {
+    static long int m_id = 0;
+
+    // ways to stop the execution at the point when a specific structure is built...note it needs to be m_id - 1 ... it's unique_id in most data structures
+    //oassert(m_id != 193);
+
+    memset(allocated, 0, bytes_to_alloc);
+
     /* mark the unique_id */
     *((long int*)allocated) = m_id++;
 
@@ -66,6 +66,7 @@ long int pow2(int to_the_power);
 std::string make_simple_name(char* input, const char* flatten_string, char flatten_char);
 
 void* my_malloc_struct(long bytes_to_alloc);
+void* my_init_struct(void* allocated, long bytes_to_alloc);
 
 void reverse_string(char* token, int length);
 char* append_string(const char* string, const char* appendage, ...);
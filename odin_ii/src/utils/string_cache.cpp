@@ -25,48 +25,76 @@
 
 #include <cstdio>
 #include <cstring>
+#include <cstdint>
+#include <algorithm>
 
 #include "string_cache.h"
 
 #include "vtr_util.h"
 #include "vtr_memory.h"
 
-unsigned long
-string_hash(STRING_CACHE* sc,
-            const char* string);
-void generate_sc_hash(STRING_CACHE* sc);
-
-unsigned long
-string_hash(STRING_CACHE* sc,
-            const char* string) {
-    long a, i, mod, mul;
-
-    a = 0;
-    mod = sc->mod;
-    mul = sc->mul;
-    for (i = 0; string[i]; i++)
-        a = (a * mul + (unsigned char)string[i]) % mod;
-    return a;
+static unsigned long string_hash(const char* string);
+static long find_string_spot(STRING_CACHE* sc, const char* string, unsigned long hash);
+static void index_string(STRING_CACHE* sc, long i);
+static void grow_string_cache(STRING_CACHE* sc, long size);
+static void generate_sc_index(STRING_CACHE* sc, long index_size);
+
+/* FNV-1a, which is much cheaper than a modulo per character */
+static unsigned long string_hash(const char* string) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (long i = 0; string[i]; i++) {
+        hash ^= (unsigned char)string[i];
+        hash *= 1099511628211ULL;
+    }
+    return (unsigned long)hash;
 }
 
-void generate_sc_hash(STRING_CACHE* sc) {
-    long i;
-    long hash;
-
-    if (sc->string_hash != NULL)
-        vtr::free(sc->string_hash);
-    if (sc->next_string != NULL)
-        vtr::free(sc->next_string);
-    sc->string_hash_size = sc->size * 2 + 11;
-    sc->string_hash = (long*)sc_do_alloc(sc->string_hash_size, sizeof(long));
-    sc->next_string = (long*)sc_do_alloc(sc->size, sizeof(long));
-    memset(sc->string_hash, 0xff, sc->string_hash_size * sizeof(long));
-    memset(sc->next_string, 0xff, sc->size * sizeof(long));
-    for (i = 0; i < sc->free; i++) {
-        hash = string_hash(sc, sc->string[i]) % sc->string_hash_size;
-        sc->next_string[i] = sc->string_hash[hash];
-        sc->string_hash[hash] = i;
+/* returns the spot of the index holding string, or the empty spot where it would be added */
+static long find_string_spot(STRING_CACHE* sc, const char* string, unsigned long hash) {
+    long mask = sc->string_index_size - 1;
+    long spot = hash & mask;
+    while (sc->string_index[spot] >= 0) {
+        long i = sc->string_index[spot];
+        if (sc->string_hash[i] == hash && !strcmp(sc->string[i], string))
+            break;
+        spot = (spot + 1) & mask;
     }
+    return spot;
+}
+
+static void index_string(STRING_CACHE* sc, long i) {
+    long mask = sc->string_index_size - 1;
+    long spot = sc->string_hash[i] & mask;
+    while (sc->string_index[spot] >= 0)
+        spot = (spot + 1) & mask;
+    sc->string_index[spot] = i;
+}
+
+/* makes room for at least size strings */
+static void grow_string_cache(STRING_CACHE* sc, long size) {
+    if (size > sc->size) {
+        sc->size = std::max(size, sc->size * 2 + 10);
+        sc->string = (char**)vtr::realloc(sc->string, sc->size * sizeof(char*));
+        sc->data = (void**)vtr::realloc(sc->data, sc->size * sizeof(void*));
+        sc->string_hash = (unsigned long*)vtr::realloc(sc->string_hash, sc->size * sizeof(unsigned long));
+    }
+
+    if (size * 2 > sc->string_index_size) {
+        long index_size = sc->string_index_size;
+        while (size * 2 > index_size)
+            index_size *= 2;
+        generate_sc_index(sc, index_size);
+    }
+}
+
+static void generate_sc_index(STRING_CACHE* sc, long index_size) {
+    if (sc->string_index != NULL)
+        vtr::free(sc->string_index);
+    sc->string_index_size = index_size;
+    sc->string_index = (long*)sc_do_alloc(sc->string_index_size, sizeof(long));
+    memset(sc->string_index, 0xff, sc->string_index_size * sizeof(long));
+    for (long i = 0; i < sc->free; i++)
+        index_string(sc, i);
 }
 
 STRING_CACHE*
@@ -75,72 +103,52 @@ sc_new_string_cache(void) {
 
     sc = (STRING_CACHE*)sc_do_alloc(1, sizeof(STRING_CACHE));
     sc->size = 100;
-    sc->string_hash_size = 0;
-    sc->string_hash = NULL;
-    sc->next_string = NULL;
     sc->free = 0;
     sc->string = (char**)sc_do_alloc(sc->size, sizeof(char*));
     sc->data = (void**)sc_do_alloc(sc->size, sizeof(void*));
-    sc->mod = 834535547;
-    sc->mul = 247999;
-    generate_sc_hash(sc);
+    sc->string_hash = (unsigned long*)sc_do_alloc(sc->size, sizeof(unsigned long));
+    sc->string_index = NULL;
+    generate_sc_index(sc, 256);
     return sc;
 }
 
 long sc_lookup_string(STRING_CACHE* sc,
                       const char* string) {
-    long i, hash;
-
     if (sc == NULL) {
         return -1;
     } else {
-        hash = string_hash(sc, string) % sc->string_hash_size;
-        i = sc->string_hash[hash];
-        while (i >= 0) {
-            if (!strcmp(sc->string[i], string))
-                return i;
-            i = sc->next_string[i];
-        }
-        return -1;
+        return sc->string_index[find_string_spot(sc, string, string_hash(string))];
     }
 }
 
-long sc_add_string(STRING_CACHE* sc,
-                   const char* string) {
-    long i;
-    long hash;
-    void* a;
-
-    i = sc_lookup_string(sc, string);
-    if (i >= 0)
-        return i;
-    if (sc->free >= sc->size) {
-        sc->size = sc->size * 2 + 10;
-
-        a = sc_do_alloc(sc->size, sizeof(char*));
-        if (sc->free > 0)
-            memcpy(a, sc->string, sc->free * sizeof(char*));
-        vtr::free(sc->string);
-        sc->string = (char**)a;
-
-        a = sc_do_alloc(sc->size, sizeof(void*));
-        if (sc->free > 0)
-            memcpy(a, sc->data, sc->free * sizeof(void*));
-        vtr::free(sc->data);
-        sc->data = (void**)a;
-
-        generate_sc_hash(sc);
+/* adds string, whose hash is already known, taking ownership of it if owned is set */
+static long add_hashed_string(STRING_CACHE* sc, char* string, unsigned long hash, bool owned) {
+    long spot = find_string_spot(sc, string, hash);
+    if (sc->string_index[spot] >= 0) {
+        if (owned)
+            vtr::free(string);
+        return sc->string_index[spot];
+    }
+
+    long i = sc->free;
+    if (i + 1 > sc->size || (i + 1) * 2 > sc->string_index_size) {
+        grow_string_cache(sc, i + 1);
+        spot = find_string_spot(sc, string, hash);
     }
-    i = sc->free;
+
     sc->free++;
-    sc->string[i] = vtr::strdup(string);
+    sc->string[i] = owned ? string : vtr::strdup(string);
     sc->data[i] = NULL;
-    hash = string_hash(sc, string) % sc->string_hash_size;
-    sc->next_string[i] = sc->string_hash[hash];
-    sc->string_hash[hash] = i;
+    sc->string_hash[i] = hash;
+    sc->string_index[spot] = i;
     return i;
 }
 
+long sc_add_string(STRING_CACHE* sc,
+                   const char* string) {
+    return add_hashed_string(sc, (char*)string, string_hash(string), false);
+}
+
 void* sc_do_alloc(long a,
                   long b) {
     void* r;
@@ -159,6 +167,27 @@ void* sc_do_alloc(long a,
     return r;
 }
 
+STRING_CACHE* sc_copy_string_cache(STRING_CACHE* to_copy) {
+    STRING_CACHE* sc;
+
+    sc = (STRING_CACHE*)sc_do_alloc(1, sizeof(STRING_CACHE));
+    sc->size = to_copy->size;
+    sc->free = to_copy->free;
+    sc->string = (char**)sc_do_alloc(sc->size, sizeof(char*));
+    sc->data = (void**)sc_do_alloc(sc->size, sizeof(void*));
+    sc->string_hash = (unsigned long*)sc_do_alloc(sc->size, sizeof(unsigned long));
+    sc->string_index_size = to_copy->string_index_size;
+    sc->string_index = (long*)sc_do_alloc(sc->string_index_size, sizeof(long));
+
+    for (long i = 0; i < sc->free; i++)
+        sc->string[i] = vtr::strdup(to_copy->string[i]);
+    memcpy(sc->data, to_copy->data, sc->free * sizeof(void*));
+    memcpy(sc->string_hash, to_copy->string_hash, sc->free * sizeof(unsigned long));
+    memcpy(sc->string_index, to_copy->string_index, sc->string_index_size * sizeof(long));
+
+    return sc;
+}
+
 STRING_CACHE* sc_free_string_cache(STRING_CACHE* sc) {
     if (sc != NULL) {
         if (sc->string != NULL) {
@@ -182,10 +211,10 @@ STRING_CACHE* sc_free_string_cache(STRING_CACHE* sc) {
         }
         sc->string_hash = NULL;
 
-        if (sc->next_string != NULL) {
-            vtr::free(sc->next_string);
+        if (sc->string_index != NULL) {
+            vtr::free(sc->string_index);
         }
-        sc->next_string = NULL;
+        sc->string_index = NULL;
 
         vtr::free(sc);
     }
@@ -196,11 +225,20 @@ STRING_CACHE* sc_free_string_cache(STRING_CACHE* sc) {
 
 void sc_merge_string_cache(STRING_CACHE** source_ref, STRING_CACHE* destination) {
     STRING_CACHE* source = (*source_ref);
-    for (int source_spot = 0; source_spot < source->free; source_spot++) {
-        long destination_spot = sc_add_string(destination, source->string[source_spot]);
-        destination->data[destination_spot] = source->data[source_spot];
 
-        source->data[source_spot] = NULL;
+    if (destination->free == 0) {
+        /* nothing to merge with, so the destination simply takes over the source */
+        std::swap(*source, *destination);
+    } else {
+        grow_string_cache(destination, destination->free + source->free);
+        for (long source_spot = 0; source_spot < source->free; source_spot++) {
+            /* the source strings are moved rather than copied */
+            long destination_spot = add_hashed_string(destination, source->string[source_spot], source->string_hash[source_spot], true);
+            destination->data[destination_spot] = source->data[source_spot];
+
+            source->string[source_spot] = NULL;
+            source->data[source_spot] = NULL;
+        }
     }
 
     /* now cleanup */
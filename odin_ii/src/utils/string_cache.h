@@ -28,14 +28,12 @@
 
 struct STRING_CACHE {
     long size;
-    long string_hash_size;
     long free;
-    long mod;
-    long mul;
     char** string;
     void** data;
-    long* string_hash;
-    long* next_string;
+    unsigned long* string_hash; // the hash of each string, so they are not rehashed to grow or merge the cache
+    long* string_index;         // open addressing index of the strings, -1 for an empty spot
+    long string_index_size;     // a power of 2, at least twice the number of strings
 };
 
 /* creates the hash where it is indexed by a string and the void ** holds the data */
@@ -46,6 +44,9 @@ long sc_lookup_string(STRING_CACHE* sc, const char* string);
 long sc_add_string(STRING_CACHE* sc, const char* string);
 void* sc_do_alloc(long, long);
 
+/* copies the cache (and its data pointers), without rehashing the strings */
+STRING_CACHE* sc_copy_string_cache(STRING_CACHE* sc);
+
 /* free the cache */
 STRING_CACHE* sc_free_string_cache(STRING_CACHE* sc);
 
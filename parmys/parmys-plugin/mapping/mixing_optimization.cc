@@ -17,7 +17,8 @@
  */
 #include "mixing_optimization.h"
 
-#include <stdint.h> // INT_MAX
+#include <algorithm> // stable_sort
+#include <stdint.h>  // INT_MAX
 #include <vector>
 
 #include "adder.h"                 // hard_adders
@@ -85,27 +86,25 @@ void MultsOpt::assign_weights(netlist_t *netlist, std::vector<nnode_t *> nodes)
 
 void MultsOpt::perform(netlist_t *netlist, std::vector<nnode_t *> &weighted_nodes)
 {
-    size_t nodes_count = weighted_nodes.size();
-
-    // per optimization, instantiate hard logic
-    for (int i = 0; i < this->_blocks_count; i++) {
-        int maximal_cost = -1;
-        int index = -1;
-        for (size_t j = 0; j < nodes_count; j++) {
-            // if found a new maximal cost that is higher than a current maximum AND is not restricted by input
-            // params for minimal "hardenable" multiplier width
-            if (maximal_cost < weighted_nodes[j]->weight && this->hardenable(weighted_nodes[j])) {
-                maximal_cost = weighted_nodes[j]->weight;
-                index = j;
-            }
+    // per optimization, instantiate hard logic for the nodes of maximal cost which are not restricted
+    // by input params for minimal "hardenable" multiplier width. Picking them in one sorted pass
+    // (heaviest first, in their original order among equal weights) rather than rescanning all the
+    // nodes for every hardened one
+    std::vector<size_t> candidates;
+    for (size_t j = 0; j < weighted_nodes.size(); j++) {
+        if (weighted_nodes[j]->weight > -1 && this->hardenable(weighted_nodes[j])) {
+            candidates.push_back(j);
         }
+    }
+
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [&](size_t a, size_t b) { return weighted_nodes[a]->weight > weighted_nodes[b]->weight; });
 
-        // if there are no suitable nodes left, leave the loop to
-        // implement remaining nodes in soft logic
-        if (index < 0)
-            break;
+    if (candidates.size() > (size_t)std::max(this->_blocks_count, 0))
+        candidates.resize(std::max(this->_blocks_count, 0));
 
-        // indicate for future iterations the node was hardened
+    for (size_t index : candidates) {
+        // indicate the node was hardened
         weighted_nodes[index]->weight = -1;
 
         if (hard_multipliers) {
@@ -113,13 +112,10 @@ void MultsOpt::perform(netlist_t *netlist, std::vector<nnode_t *> &weighted_node
         }
     }
 
-    // From the end of the vector, remove all nodes that were implemented in hard logic. The remaining
+    // Remove all nodes that were implemented in hard logic. The remaining
     // nodes will be instantiated in soft_map_remaining_nodes
-    for (int i = nodes_count - 1; i >= 0; i--) {
-        if (weighted_nodes[i]->weight == -1) {
-            weighted_nodes.erase(weighted_nodes.begin() + i);
-        }
-    }
+    weighted_nodes.erase(std::remove_if(weighted_nodes.begin(), weighted_nodes.end(), [](nnode_t *node) { return node->weight == -1; }),
+                         weighted_nodes.end());
 }
 
 void MixingOpt::set_blocks_needed(int new_count) { this->_blocks_count = new_count; }
@@ -17,8 +17,12 @@
  */
 #include "odin_globals.h"
 #include "odin_types.h"
+#include <algorithm>
+#include <atomic>
 #include <stdio.h>
 #include <string.h>
+#include <thread>
+#include <vector>
 
 #include "netlist_utils.h"
 #include "node_utils.h"
@@ -36,9 +40,14 @@
 
 USING_YOSYS_NAMESPACE
 
-void depth_first_traverse_partial_map(nnode_t *node, uintptr_t traverse_mark_number, netlist_t *netlist);
+/* the number of nodes mapped by a thread at once when mapping in parallel, each block's edits are applied in order */
+#define PARALLEL_PARTIAL_MAP_BLOCK_SIZE 256
+
+void depth_first_traverse_partial_map(nnode_t *node, uintptr_t traverse_mark_number, netlist_t *netlist, std::vector<nnode_t *> *parallel_nodes);
 
 void partial_map_node(nnode_t *node, short traverse_number, netlist_t *netlist);
+static bool is_self_contained_partial_map(nnode_t *node);
+static void parallel_partial_map_nodes(std::vector<nnode_t *> &nodes, short traverse_number, netlist_t *netlist, int num_threads);
 
 void instantiate_not_logic(nnode_t *node, short mark, netlist_t *netlist);
 bool eliminate_buffer(nnode_t *node, short, netlist_t *);
@@ -65,24 +74,34 @@ void partial_map_top(netlist_t *netlist) { depth_first_traversal_to_partial_map(
 
 /*---------------------------------------------------------------------------------------------
  * (function: depth_first_traversal_to_parital_map()
+ *
+ * With more than one thread (-j), the nodes whose mapping only involves their own pins
+ * (see is_self_contained_partial_map) are collected during the traversal, the others being
+ * mapped on the way as usual, and then mapped in parallel once the traversal is done.
  *-------------------------------------------------------------------------------------------*/
 void depth_first_traversal_to_partial_map(short marker_value, netlist_t *netlist)
 {
+    std::vector<nnode_t *> parallel_nodes;
+    std::vector<nnode_t *> *collected_nodes = (global_args.num_threads > 1) ? &parallel_nodes : NULL;
+
     for (int i = 0; i < netlist->num_top_input_nodes; i++) {
         if (netlist->top_input_nodes[i] != NULL) {
-            depth_first_traverse_partial_map(netlist->top_input_nodes[i], marker_value, netlist);
+            depth_first_traverse_partial_map(netlist->top_input_nodes[i], marker_value, netlist, collected_nodes);
         }
     }
 
-    depth_first_traverse_partial_map(netlist->gnd_node, marker_value, netlist);
-    depth_first_traverse_partial_map(netlist->vcc_node, marker_value, netlist);
-    depth_first_traverse_partial_map(netlist->pad_node, marker_value, netlist);
+    depth_first_traverse_partial_map(netlist->gnd_node, marker_value, netlist, collected_nodes);
+    depth_first_traverse_partial_map(netlist->vcc_node, marker_value, netlist, collected_nodes);
+    depth_first_traverse_partial_map(netlist->pad_node, marker_value, netlist, collected_nodes);
+
+    if (!parallel_nodes.empty())
+        parallel_partial_map_nodes(parallel_nodes, marker_value, netlist, global_args.num_threads);
 }
 
 /*---------------------------------------------------------------------------------------------
  * (function: depth_first_traverse)
  *-------------------------------------------------------------------------------------------*/
-void depth_first_traverse_partial_map(nnode_t *node, uintptr_t traverse_mark_number, netlist_t *netlist)
+void depth_first_traverse_partial_map(nnode_t *node, uintptr_t traverse_mark_number, netlist_t *netlist, std::vector<nnode_t *> *parallel_nodes)
 {
     if (node->traverse_visited != traverse_mark_number) {
 
@@ -95,7 +114,7 @@ void depth_first_traverse_partial_map(nnode_t *node, uintptr_t traverse_mark_num
                     for (int j = 0; j < next_net->num_fanout_pins; j++) {
                         if (next_net->fanout_pins[j]) {
                             if (next_net->fanout_pins[j]->node) {
-                                depth_first_traverse_partial_map(next_net->fanout_pins[j]->node, traverse_mark_number, netlist);
+                                depth_first_traverse_partial_map(next_net->fanout_pins[j]->node, traverse_mark_number, netlist, parallel_nodes);
                             }
                         }
                     }
@@ -103,8 +122,98 @@ void depth_first_traverse_partial_map(nnode_t *node, uintptr_t traverse_mark_num
             }
         }
 
-        partial_map_node(node, traverse_mark_number, netlist);
+        if (parallel_nodes && is_self_contained_partial_map(node))
+            parallel_nodes->push_back(node);
+        else
+            partial_map_node(node, traverse_mark_number, netlist);
+    }
+}
+
+/*---------------------------------------------------------------------------------------------
+ * (function: is_self_contained_partial_map)
+ * 	Returns true if partial_map_node only moves the pins of the node to the new nodes,
+ * 	connects them through new nets and adds pins to existing nets, without reading the
+ * 	rest of the netlist or global lists, so that it can map the node in parallel with others
+ *-------------------------------------------------------------------------------------------*/
+static bool is_self_contained_partial_map(nnode_t *node)
+{
+    /* the names of the new nodes extend the name of the node */
+    if (!node->name)
+        return false;
+
+    switch (node->type) {
+    case BITWISE_NOT:
+        return true;
+    case BITWISE_AND:
+    case BITWISE_OR:
+    case BITWISE_NAND:
+    case BITWISE_NOR:
+    case BITWISE_XNOR:
+    case BITWISE_XOR:
+        return node->num_input_port_sizes >= 1;
+    case LOGICAL_OR:
+    case LOGICAL_AND:
+    case LOGICAL_NOR:
+    case LOGICAL_NAND:
+    case LOGICAL_XOR:
+    case LOGICAL_XNOR:
+        return node->num_input_port_sizes == 2;
+    case LOGICAL_EQUAL:
+    case NOT_EQUAL:
+    case GTE:
+    case LTE:
+    case GT:
+    case LT:
+    case MULTI_PORT_MUX:
+    case MULTIPORT_nBIT_SMUX:
+        return true;
+    default:
+        /* buffers and shifts read and join the nets around them, arithmetic and hard
+         * blocks are chained or registered in global lists */
+        return false;
+    }
+}
+
+/*---------------------------------------------------------------------------------------------
+ * (function: parallel_partial_map_nodes)
+ * 	Maps the self contained nodes on num_threads threads, by blocks of consecutive nodes.
+ * 	The edits of the nets shared between blocks are applied in the order of the blocks
+ * 	afterward, and all blocks name their nodes from the same id: these names are unique
+ * 	as they extend the unique name of the node being mapped.
+ *-------------------------------------------------------------------------------------------*/
+static void parallel_partial_map_nodes(std::vector<nnode_t *> &nodes, short traverse_number, netlist_t *netlist, int num_threads)
+{
+    size_t num_blocks = (nodes.size() + PARALLEL_PARTIAL_MAP_BLOCK_SIZE - 1) / PARALLEL_PARTIAL_MAP_BLOCK_SIZE;
+    std::vector<deferred_netlist_edits_t> block_edits(num_blocks);
+    std::atomic<size_t> next_block(0);
+
+    auto map_blocks = [&]() {
+        for (size_t block = next_block++; block < num_blocks; block = next_block++) {
+            deferred_netlist_edits_t &edits = block_edits[block];
+            edits.name_id_base = unique_node_name_id;
+            edits.num_names = 0;
+
+            deferred_netlist_edits = &edits;
+            size_t end = std::min(nodes.size(), (block + 1) * PARALLEL_PARTIAL_MAP_BLOCK_SIZE);
+            for (size_t i = block * PARALLEL_PARTIAL_MAP_BLOCK_SIZE; i < end; i++)
+                partial_map_node(nodes[i], traverse_number, netlist);
+            deferred_netlist_edits = NULL;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < std::min<long>(num_threads, num_blocks); i++)
+        threads.emplace_back(map_blocks);
+    map_blocks();
+    for (std::thread &thread : threads)
+        thread.join();
+
+    long num_names = 0;
+    for (deferred_netlist_edits_t &edits : block_edits) {
+        apply_deferred_netlist_edits(&edits);
+        num_names = std::max(num_names, edits.num_names);
     }
+    unique_node_name_id += num_names;
 }
 
 /*----------------------------------------------------------------------
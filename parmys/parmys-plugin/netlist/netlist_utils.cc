@@ -29,6 +29,8 @@
 #include "vtr_memory.h"
 #include "vtr_util.h"
 
+thread_local deferred_netlist_edits_t *deferred_netlist_edits = NULL;
+
 /*---------------------------------------------------------------------------------------------
  * (function: allocate_nnode)
  *-------------------------------------------------------------------------------------------*/
@@ -286,6 +288,9 @@ nnet_t *allocate_nnet()
     new_net->net_data = NULL;
     new_net->unique_net_data_id = -1;
 
+    if (deferred_netlist_edits)
+        deferred_netlist_edits->nets.insert(new_net);
+
     return new_net;
 }
 
@@ -372,6 +377,14 @@ void add_fanout_pin_to_net(nnet_t *net, npin_t *pin)
     oassert(net != NULL);
     oassert(pin != NULL);
     oassert(pin->type != OUTPUT);
+    if (deferred_netlist_edits && !deferred_netlist_edits->nets.count(net)) {
+        /* the net is shared with other threads, the pin spot is allocated later */
+        deferred_netlist_edits->fanout_pins.push_back({net, pin});
+        pin->net = net;
+        pin->pin_net_idx = -1;
+        pin->type = INPUT;
+        return;
+    }
     /* assumes the pin spots have been allocated and the pin */
     net->fanout_pins = (npin_t **)vtr::realloc(net->fanout_pins, sizeof(npin_t *) * (net->num_fanout_pins + 1));
     net->fanout_pins[net->num_fanout_pins] = pin;
@@ -406,6 +419,14 @@ void add_driver_pin_to_net(nnet_t *net, npin_t *pin)
     oassert(net != NULL);
     oassert(pin != NULL);
     oassert(pin->type != INPUT);
+    if (deferred_netlist_edits && !deferred_netlist_edits->nets.count(net)) {
+        /* the net is shared with other threads, the pin spot is allocated later */
+        deferred_netlist_edits->driver_pins.push_back({net, pin});
+        pin->net = net;
+        pin->pin_net_idx = -1;
+        pin->type = OUTPUT;
+        return;
+    }
     /* assumes the pin spots have been allocated and the pin */
     net->num_driver_pins++;
     net->driver_pins = (npin_t **)vtr::realloc(net->driver_pins, net->num_driver_pins * sizeof(npin_t *));
@@ -416,6 +437,25 @@ void add_driver_pin_to_net(nnet_t *net, npin_t *pin)
     pin->pin_net_idx = net->num_driver_pins - 1;
 }
 
+/*---------------------------------------------------------------------------------------------
+ * (function: apply_deferred_netlist_edits)
+ * 	Adds the pins recorded while deferring the netlist edits to their nets, in order
+ *-------------------------------------------------------------------------------------------*/
+void apply_deferred_netlist_edits(deferred_netlist_edits_t *edits)
+{
+    oassert(deferred_netlist_edits == NULL);
+
+    for (auto &fanout : edits->fanout_pins)
+        add_fanout_pin_to_net(fanout.first, fanout.second);
+
+    for (auto &driver : edits->driver_pins)
+        add_driver_pin_to_net(driver.first, driver.second);
+
+    edits->fanout_pins.clear();
+    edits->driver_pins.clear();
+    edits->nets.clear();
+}
+
 /*---------------------------------------------------------------------------------------------
  * (function: join_nets)
  * 	Copies the fanouts from input net into net
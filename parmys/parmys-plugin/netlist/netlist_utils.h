@@ -20,6 +20,10 @@
 
 #include "odin_types.h"
 
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 nnode_t *allocate_nnode(loc_t loc);
 npin_t *allocate_npin();
 nnet_t *allocate_nnet();
@@ -87,4 +91,25 @@ void remove_fanout_pins_from_net(nnet_t *net, npin_t *pin, int id);
 extern void equalize_ports_size(nnode_t *&node, uintptr_t traverse_mark_number, netlist_t *netlist);
 extern void delete_npin(npin_t *pin);
 
+/**
+ * The netlist edits of nodes mapped in parallel with others (see partial_map_top).
+ * While a thread's deferred_netlist_edits is set, the pins it adds to nets it did
+ * not allocate are only recorded, to be added in order by apply_deferred_netlist_edits
+ * once the threads are done, and the nodes it creates are named with ids counted
+ * from name_id_base, so that the result does not depend on the number of threads.
+ */
+struct deferred_netlist_edits_t {
+    std::vector<std::pair<nnet_t *, npin_t *>> fanout_pins;
+    std::vector<std::pair<nnet_t *, npin_t *>> driver_pins;
+    // nets allocated while deferring, which are not shared with other threads
+    std::unordered_set<nnet_t *> nets;
+
+    long name_id_base;
+    long num_names;
+};
+
+extern thread_local deferred_netlist_edits_t *deferred_netlist_edits;
+
+void apply_deferred_netlist_edits(deferred_netlist_edits_t *edits);
+
 #endif // _NETLIST_UTILS_H_
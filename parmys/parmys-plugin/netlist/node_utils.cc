@@ -294,10 +294,11 @@ char *op_node_name(operation_list op, char *instance_prefix_name)
 {
     char *return_node_name;
 
-    /* create the unique name for this node */
-    return_node_name = make_full_ref_name(instance_prefix_name, NULL, NULL, name_based_on_op(op), unique_node_name_id);
+    /* create the unique name for this node, the names created while deferring the netlist edits
+     * are unique as they extend the name of the node being mapped, see partial_map_top */
+    long name_id = (deferred_netlist_edits) ? deferred_netlist_edits->name_id_base + deferred_netlist_edits->num_names++ : unique_node_name_id++;
 
-    unique_node_name_id++;
+    return_node_name = make_full_ref_name(instance_prefix_name, NULL, NULL, name_based_on_op(op), name_id);
 
     return return_node_name;
 }
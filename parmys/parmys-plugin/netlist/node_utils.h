@@ -20,6 +20,8 @@
 
 #include "odin_types.h"
 
+extern long unique_node_name_id;
+
 nnode_t *make_not_gate_with_input(npin_t *input_pin, nnode_t *node, short mark);
 
 nnode_t *make_not_gate(nnode_t *node, short mark);
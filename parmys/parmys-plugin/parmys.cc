@@ -18,6 +18,7 @@
 #include "kernel/celltypes.h"
 #include "kernel/yosys.h"
 
+#include <algorithm>
 #include <regex>
 
 #include "netlist_utils.h"
@@ -862,6 +863,9 @@ struct ParMYSPass : public Pass {
         log("    -viz\n");
         log("        visualizes the netlist at 3 different stages: elaborated, optimized, and mapped.\n");
         log("\n");
+        log("    -j num_threads\n");
+        log("        partially maps the logic, comparison and multiplexer cells on the given number of threads.\n");
+        log("\n");
     }
     void execute(std::vector<std::string> args, RTLIL::Design *design) override
     {
@@ -877,6 +881,7 @@ struct ParMYSPass : public Pass {
 
         global_args.exact_mults = -1;
         global_args.mults_ratio = -1.0;
+        global_args.num_threads = 1;
 
         log_header(design, "Starting parmys pass.\n");
 
@@ -918,6 +923,10 @@ struct ParMYSPass : public Pass {
                 global_args.mults_ratio = atof(args[++argidx].c_str());
                 continue;
             }
+            if (args[argidx] == "-j" && argidx + 1 < args.size()) {
+                global_args.num_threads = std::max(1, atoi(args[++argidx].c_str()));
+                continue;
+            }
         }
         extra_args(args, argidx, design);
 
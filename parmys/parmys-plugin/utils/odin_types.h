@@ -115,6 +115,9 @@ struct global_args_t {
     // Arguments for mixing hard and soft logic
     int exact_mults;
     float mults_ratio;
+
+    // Number of threads partially mapping the netlist
+    int num_threads;
 };
 
 extern const char *ZERO_GND_ZERO;
@@ -17,6 +17,7 @@
  */
 #include "odin_globals.h"
 #include "odin_types.h"
+#include <atomic>
 #include <cstdarg>
 #include <ctype.h>
 #include <errno.h>
@@ -121,7 +122,8 @@ std::string make_simple_name(char *input, const char *flatten_string, char flatt
 void *my_malloc_struct(long bytes_to_alloc)
 {
     void *allocated = vtr::calloc(1, bytes_to_alloc);
-    static long int m_id = 0;
+    // atomic as the netlist nodes may be mapped in parallel (see partial_map_top)
+    static std::atomic<long int> m_id(0);
 
     // ways to stop the execution at the point when a specific structure is built...note it needs to be m_id - 1 ... it's unique_id in most data
     // structures
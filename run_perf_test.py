@@ -0,0 +1,374 @@
+#!/usr/bin/env python3
+"""
+    Module for running the VPR performance (runtime and memory) regression test
+
+    Runs VPR on a suite of large benchmarks at several thread counts, records the
+    runtime and peak memory of each stage, and compares them with a baseline,
+    flagging regressions which are beyond the run to run noise of the baseline.
+"""
+from pathlib import Path
+import sys
+import argparse
+import json
+import re
+import statistics
+import subprocess
+import textwrap
+from prettytable import PrettyTable
+
+VTR_ROOT = Path(__file__).resolve().parent
+VTR_FLOW = VTR_ROOT / "vtr_flow"
+
+# The Titan benchmarks are downloaded with 'make get_titan_benchmarks'
+TITAN_CIRCUITS_DIR = VTR_FLOW / "benchmarks" / "titan_blif" / "titan_new" / "stratixiv"
+TITAN_ARCH = VTR_FLOW / "arch" / "titan" / "stratixiv_arch.timing.xml"
+
+PERF_SUITES = {
+    "vtr_reg_perf": {
+        "arch": TITAN_ARCH,
+        "circuits_dir": TITAN_CIRCUITS_DIR,
+        "circuits": [
+            "neuron_stratixiv_arch_timing",
+            "sparcT1_core_stratixiv_arch_timing",
+            "stereo_vision_stratixiv_arch_timing",
+            "cholesky_mc_stratixiv_arch_timing",
+        ],
+        "vpr_args": [
+            "--route_chan_width",
+            "300",
+            "--max_router_iterations",
+            "400",
+            "--router_lookahead",
+            "map",
+            "--seed",
+            "3",
+        ],
+    },
+}
+
+# Stages whose runtime and peak memory are tracked, as named by VPR's timers
+STAGES = ["Packing", "Placement", "Routing", "The entire flow of VPR"]
+
+# E.g. '# Placement took 12.34 seconds (max_rss 567.8 MiB, delta_rss +1.2 MiB)'
+STAGE_REGEX = re.compile(
+    r"^#?\s*(?P<stage>.+?) took (?P<sec>[0-9.]+) seconds \(max_rss (?P<mib>[0-9.]+) MiB"
+)
+
+
+class RawDefaultHelpFormatter(
+    argparse.ArgumentDefaultsHelpFormatter, argparse.RawDescriptionHelpFormatter
+):
+    """An argparse formatter which shows the defaults and keeps the description's formatting"""
+
+
+def vtr_command_argparser(prog=None):
+    """Parses the arguments of run_perf_test"""
+
+    description = textwrap.dedent(
+        """
+                    Runs the VPR performance regression test, which checks the runtime,
+                    peak memory and multi-thread scaling of each stage against a baseline.
+                    """
+    )
+    epilog = textwrap.dedent(
+        """
+                Examples
+                --------
+
+                    Create a baseline with the current build:
+
+                        %(prog)s vtr_reg_perf -create_baseline
+
+                    Check the current build against the baseline:
+
+                        %(prog)s vtr_reg_perf
+
+                The runs are done one at a time so they do not perturb each other's runtime.
+                """
+    )
+
+    parser = argparse.ArgumentParser(
+        prog=prog,
+        description=description,
+        epilog=epilog,
+        formatter_class=RawDefaultHelpFormatter,
+    )
+
+    parser.add_argument(
+        "perf_test",
+        choices=sorted(PERF_SUITES.keys()),
+        help="Performance regression test to be run",
+    )
+    parser.add_argument(
+        "-vpr",
+        default=str(VTR_ROOT / "build" / "vpr" / "vpr"),
+        help="VPR executable to profile",
+    )
+    parser.add_argument(
+        "-threads",
+        nargs="+",
+        type=int,
+        default=[1, 4, 16],
+        help="Thread counts (VPR's --num_workers) to run at",
+    )
+    parser.add_argument(
+        "-repeats",
+        type=int,
+        default=3,
+        help="Runs of each circuit and thread count, their median is compared",
+    )
+    parser.add_argument(
+        "-baseline",
+        default=None,
+        help="Baseline results file, <run_dir>/<perf_test>_baseline.json if not given",
+    )
+    parser.add_argument(
+        "-create_baseline",
+        default=False,
+        action="store_true",
+        help="Save the results as the new baseline instead of checking them",
+    )
+    parser.add_argument(
+        "-run_dir",
+        default=str(VTR_ROOT / "perf_runs"),
+        help="Directory to run VPR in and write the results to",
+    )
+    parser.add_argument(
+        "-runtime_tolerance",
+        type=float,
+        default=0.10,
+        help="Minimum relative runtime increase reported as a regression",
+    )
+    parser.add_argument(
+        "-memory_tolerance",
+        type=float,
+        default=0.05,
+        help="Minimum relative peak memory increase reported as a regression",
+    )
+    parser.add_argument(
+        "-scaling_tolerance",
+        type=float,
+        default=0.15,
+        help="Minimum relative speed-up decrease reported as a regression",
+    )
+
+    return parser
+
+
+def parse_stage_results(vpr_out):
+    """Returns {stage: (seconds, max_rss_mib)} for the tracked stages in a VPR log"""
+    results = {}
+    with open(vpr_out, "r") as log:
+        for line in log:
+            match = STAGE_REGEX.match(line)
+            if match and match.group("stage") in STAGES:
+                results[match.group("stage")] = (
+                    float(match.group("sec")),
+                    float(match.group("mib")),
+                )
+    return results
+
+
+def run_circuit(args, suite, circuit, threads, repeat):
+    """Runs VPR once, returning {stage: (seconds, max_rss_mib)}, or None if it failed"""
+    run_dir = (
+        Path(args.run_dir)
+        / args.perf_test
+        / circuit
+        / "threads_{}".format(threads)
+        / "run{}".format(repeat)
+    )
+    run_dir.mkdir(parents=True, exist_ok=True)
+
+    circuits_dir = Path(suite["circuits_dir"])
+    cmd = [args.vpr, str(suite["arch"]), str(circuits_dir / (circuit + ".blif"))]
+    sdc_file = circuits_dir / (circuit + ".sdc")
+    if sdc_file.is_file():
+        cmd += ["--sdc_file", str(sdc_file)]
+    cmd += suite["vpr_args"] + ["--num_workers", str(threads)]
+
+    vpr_out = run_dir / "vpr.out"
+    with open(vpr_out, "w") as log:
+        result = subprocess.call(cmd, cwd=run_dir, stdout=log, stderr=subprocess.STDOUT)
+    if result != 0:
+        print("FAILED {} with {} threads (see {})".format(circuit, threads, vpr_out))
+        return None
+    return parse_stage_results(vpr_out)
+
+
+def summarize_runs(runs):
+    """
+    Returns {stage: {"sec", "sec_spread", "mib"}} from the runs of a circuit: the
+    median runtime, its relative spread over the runs (the noise) and the largest
+    peak memory
+    """
+    summary = {}
+    for stage in STAGES:
+        secs = [run[stage][0] for run in runs if stage in run]
+        mibs = [run[stage][1] for run in runs if stage in run]
+        if not secs:
+            continue
+        median_sec = statistics.median(secs)
+        summary[stage] = {
+            "sec": median_sec,
+            "sec_spread": (max(secs) - min(secs)) / median_sec if median_sec > 0 else 0.0,
+            "mib": max(mibs),
+        }
+    return summary
+
+
+def run_suite(args):
+    """Runs the suite, returning {circuit: {threads: summary}} and the number of failed runs"""
+    suite = PERF_SUITES[args.perf_test]
+    results = {}
+    num_failures = 0
+    for circuit in suite["circuits"]:
+        results[circuit] = {}
+        for threads in args.threads:
+            runs = []
+            for repeat in range(args.repeats):
+                print(
+                    "Running {} with {} threads ({}/{})".format(
+                        circuit, threads, repeat + 1, args.repeats
+                    )
+                )
+                run = run_circuit(args, suite, circuit, threads, repeat)
+                if run is None:
+                    num_failures += 1
+                else:
+                    runs.append(run)
+            if runs:
+                results[circuit][str(threads)] = summarize_runs(runs)
+    return results, num_failures
+
+
+def speedup(circuit_results, stage, threads):
+    """The speed-up of a stage with 'threads' threads over the lowest thread count run"""
+    base_threads = min(circuit_results.keys(), key=int)
+    if stage not in circuit_results[base_threads]:
+        return None
+    if stage not in circuit_results.get(threads, {}):
+        return None
+    sec = circuit_results[threads][stage]["sec"]
+    if sec <= 0:
+        return None
+    return circuit_results[base_threads][stage]["sec"] / sec
+
+
+def check_results(args, results, baseline):
+    """Compares the results with the baseline and prints a report, returns the regressions"""
+    table = PrettyTable()
+    table.field_names = [
+        "circuit",
+        "threads",
+        "stage",
+        "runtime (s)",
+        "baseline (s)",
+        "peak memory (MiB)",
+        "baseline (MiB)",
+        "speed-up",
+        "baseline speed-up",
+        "status",
+    ]
+
+    num_regressions = 0
+    for circuit, circuit_results in results.items():
+        for threads, summary in circuit_results.items():
+            for stage, stage_results in summary.items():
+                base = baseline.get(circuit, {}).get(threads, {}).get(stage)
+                if base is None:
+                    table.add_row(
+                        [
+                            circuit,
+                            threads,
+                            stage,
+                            "%.2f" % stage_results["sec"],
+                            "-",
+                            "%.1f" % stage_results["mib"],
+                            "-",
+                            "-",
+                            "-",
+                            "no baseline",
+                        ]
+                    )
+                    continue
+
+                problems = []
+
+                # Runtime differences within the noise of the baseline runs are not regressions
+                runtime_tolerance = max(args.runtime_tolerance, 2 * base["sec_spread"])
+                if stage_results["sec"] > base["sec"] * (1 + runtime_tolerance):
+                    problems.append("runtime")
+                if stage_results["mib"] > base["mib"] * (1 + args.memory_tolerance):
+                    problems.append("memory")
+
+                stage_speedup = speedup(circuit_results, stage, threads)
+                base_speedup = speedup(baseline[circuit], stage, threads)
+                if (
+                    stage_speedup is not None
+                    and base_speedup is not None
+                    and stage_speedup < base_speedup * (1 - args.scaling_tolerance)
+                ):
+                    problems.append("scaling")
+
+                num_regressions += len(problems)
+                table.add_row(
+                    [
+                        circuit,
+                        threads,
+                        stage,
+                        "%.2f" % stage_results["sec"],
+                        "%.2f" % base["sec"],
+                        "%.1f" % stage_results["mib"],
+                        "%.1f" % base["mib"],
+                        "%.2f" % stage_speedup if stage_speedup is not None else "-",
+                        "%.2f" % base_speedup if base_speedup is not None else "-",
+                        "REGRESSED ({})".format(", ".join(problems)) if problems else "ok",
+                    ]
+                )
+    print(table)
+    return num_regressions
+
+
+def vtr_command_main(arg_list, prog=None):
+    """
+    Run the given performance regression test
+    """
+    args = vtr_command_argparser(prog).parse_args(arg_list)
+
+    if args.baseline:
+        baseline_file = Path(args.baseline)
+    else:
+        baseline_file = Path(args.run_dir) / "{}_baseline.json".format(args.perf_test)
+    if not args.create_baseline and not baseline_file.is_file():
+        print(
+            "Error: baseline {} does not exist (create it with -create_baseline)".format(
+                baseline_file
+            )
+        )
+        sys.exit(1)
+
+    results, num_failures = run_suite(args)
+
+    results_file = Path(args.run_dir) / "{}_results.json".format(args.perf_test)
+    results_file.parent.mkdir(parents=True, exist_ok=True)
+    with open(results_file, "w") as out:
+        json.dump(results, out, indent=2)
+
+    if args.create_baseline:
+        with open(baseline_file, "w") as out:
+            json.dump(results, out, indent=2)
+        print("Wrote baseline {}".format(baseline_file))
+        num_regressions = 0
+    else:
+        with open(baseline_file, "r") as base:
+            baseline = json.load(base)
+        num_regressions = check_results(args, results, baseline)
+        print("\nTest '{}' had {} performance regressions".format(args.perf_test, num_regressions))
+
+    print("Test '{}' had {} run failures".format(args.perf_test, num_failures))
+    sys.exit(num_failures + num_regressions)
+
+
+if __name__ == "__main__":
+    vtr_command_main(sys.argv[1:])
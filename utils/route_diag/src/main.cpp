@@ -7,8 +7,12 @@
 // used.
 //
 // Tool can either perform one route between a source (--source_rr_node) and
-// a sink (--sink_rr_node), or profile a source to all tiles (set
-// --source_rr_node and "--profile_source true").
+// a sink (--sink_rr_node), profile a source to all tiles (set
+// --source_rr_node and "--profile_source true"), or measure the accuracy, query
+// time and memory of router lookaheads against the true shortest path costs
+// between sampled wires and sinks (e.g. "--profile_lookaheads map compressed_map").
+#include <chrono>
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <ctime>
@@ -17,6 +21,8 @@
 #include "vtr_error.h"
 #include "vtr_memory.h"
 #include "vtr_log.h"
+#include "vtr_random.h"
+#include "vtr_rusage.h"
 #include "vtr_time.h"
 
 #include "tatum/error.hpp"
@@ -35,6 +41,7 @@
 #include "route_common.h"
 #include "route_net.h"
 #include "route_export.h"
+#include "route_utils.h"
 #include "rr_graph.h"
 #include "rr_graph2.h"
 #include "timing_place_lookup.h"
@@ -44,6 +51,9 @@ struct t_route_util_options {
     argparse::ArgValue<int> source_rr_node;
     argparse::ArgValue<int> sink_rr_node;
     argparse::ArgValue<bool> profile_source;
+    argparse::ArgValue<std::vector<std::string>> profile_lookaheads;
+    argparse::ArgValue<int> lookahead_profile_sources;
+    argparse::ArgValue<int> lookahead_profile_sinks_per_source;
 
     t_options options;
 };
@@ -98,8 +108,10 @@ static void do_one_route(const Netlist<>& net_list,
     RouterStats router_stats;
     auto router_lookahead = make_router_lookahead(det_routing_arch,
                                                   router_opts.lookahead_type,
+                                                  router_opts.router_lookahead_half_precision,
                                                   router_opts.write_router_lookahead,
                                                   router_opts.read_router_lookahead,
+                                                  router_opts.router_lookahead_cache_dir,
                                                   segment_inf,
                                                   is_flat);
 
@@ -130,7 +142,7 @@ static void do_one_route(const Netlist<>& net_list,
         VTR_ASSERT(cheapest.index == sink_node);
 
         vtr::optional<const RouteTreeNode&> rt_node_of_sink;
-        std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&cheapest, OPEN, nullptr, router_opts.flat_routing);
+        std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&cheapest, OPEN, nullptr, router_opts.flat_routing, router.get_rr_node_route_inf());
 
         //find delay
         float net_delay = rt_node_of_sink.value().Tdel;
@@ -139,7 +151,7 @@ static void do_one_route(const Netlist<>& net_list,
         tree.print();
         VTR_LOG("\n");
 
-        VTR_ASSERT_MSG(route_ctx.rr_node_route_inf[tree.root().inode].occ() <= rr_graph.node_capacity(tree.root().inode), "SOURCE should never be congested");
+        VTR_ASSERT_MSG(route_ctx.rr_node_cong_inf[tree.root().inode].occ() <= rr_graph.node_capacity(tree.root().inode), "SOURCE should never be congested");
     } else {
         VTR_LOG("Routing failed");
     }
@@ -163,8 +175,10 @@ static void profile_source(const Netlist<>& net_list,
 
     auto router_lookahead = make_router_lookahead(det_routing_arch,
                                                   router_opts.lookahead_type,
+                                                  router_opts.router_lookahead_half_precision,
                                                   router_opts.write_router_lookahead,
                                                   router_opts.read_router_lookahead,
+                                                  router_opts.router_lookahead_cache_dir,
                                                   segment_inf,
                                                   is_flat);
     RouterDelayProfiler profiler(net_list, router_lookahead.get(), is_flat);
@@ -239,6 +253,233 @@ static void profile_source(const Netlist<>& net_list,
     VTR_LOG("\n");
 }
 
+//A connection from a wire to a sink, with its true minimum delay and congestion costs
+struct t_lookahead_sample {
+    RRNodeId from_node;
+    RRNodeId sink_node;
+    float R_upstream;
+    float delay_cost;
+    float cong_cost;
+};
+
+//Returns the cost of the cheapest path (at the given criticality) from from_node
+//to every RR node, or NaN for those which are unreachable
+static vtr::vector<RRNodeId, float> find_all_min_costs_from_rr_node(ConnectionRouter<BinaryHeap>& router,
+                                                                    RRNodeId from_node,
+                                                                    float criticality) {
+    const auto& device_ctx = g_vpr_ctx.device();
+
+    t_bb bounding_box;
+    bounding_box.xmin = 0;
+    bounding_box.xmax = device_ctx.grid.width() + 1;
+    bounding_box.ymin = 0;
+    bounding_box.ymax = device_ctx.grid.height() + 1;
+    bounding_box.layer_min = 0;
+    bounding_box.layer_max = device_ctx.grid.get_num_layers() - 1;
+
+    t_conn_cost_params cost_params;
+    cost_params.criticality = criticality;
+    cost_params.astar_fac = 0.;
+    cost_params.bend_cost = 0.;
+
+    RouteTree tree(from_node);
+    RouterStats router_stats;
+    ConnectionParameters conn_params(ParentNetId::INVALID(), OPEN, false, std::unordered_map<RRNodeId, int>());
+    vtr::vector<RRNodeId, t_heap> shortest_paths = router.timing_driven_find_all_shortest_paths_from_route_tree(tree.root(),
+                                                                                                                cost_params,
+                                                                                                                bounding_box,
+                                                                                                                router_stats,
+                                                                                                                conn_params);
+    router.reset_path_costs();
+
+    vtr::vector<RRNodeId, float> costs(shortest_paths.size(), std::numeric_limits<float>::quiet_NaN());
+    for (size_t inode = 0; inode < shortest_paths.size(); ++inode) {
+        RRNodeId node(inode);
+        if (shortest_paths[node].index.is_valid()) {
+            costs[node] = shortest_paths[node].backward_path_cost;
+        }
+    }
+    return costs;
+}
+
+//Samples connections from random wires to random sinks, and finds their true costs
+static std::vector<t_lookahead_sample> sample_lookahead_connections(int num_from_nodes, int num_sinks_per_from_node, bool is_flat) {
+    vtr::ScopedStartFinishTimer timer("Finding shortest paths of sampled connections");
+    const auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+
+    //The router queries the lookahead mostly while expanding wires
+    std::vector<RRNodeId> wires;
+    std::vector<RRNodeId> sinks;
+    for (RRNodeId node : rr_graph.nodes()) {
+        t_rr_type type = rr_graph.node_type(node);
+        if (type == CHANX || type == CHANY) {
+            wires.push_back(node);
+        } else if (type == SINK) {
+            sinks.push_back(node);
+        }
+    }
+    if (wires.empty() || sinks.empty()) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "The RR graph has no wires or sinks to profile the router lookahead with\n");
+    }
+
+    auto no_op_lookahead = make_router_lookahead(t_det_routing_arch(), e_router_lookahead::NO_OP, /*half_precision=*/false,
+                                                 /*write_lookahead=*/"", /*read_lookahead=*/"", /*lookahead_cache_dir=*/"",
+                                                 /*segment_inf=*/{},
+                                                 is_flat);
+    ConnectionRouter<BinaryHeap> router(
+        device_ctx.grid,
+        *no_op_lookahead,
+        device_ctx.rr_graph.rr_nodes(),
+        &device_ctx.rr_graph,
+        device_ctx.rr_rc_data,
+        device_ctx.rr_graph.rr_switch(),
+        g_vpr_ctx.mutable_routing().rr_node_route_inf,
+        is_flat);
+
+    vtr::RandState rand_state = 1;
+    std::vector<t_lookahead_sample> samples;
+    for (int ifrom = 0; ifrom < num_from_nodes; ++ifrom) {
+        RRNodeId from_node = wires[vtr::irand(wires.size() - 1, rand_state)];
+
+        //Criticality 1 finds the minimum delay costs, and 0 the minimum congestion costs
+        vtr::vector<RRNodeId, float> delay_costs = find_all_min_costs_from_rr_node(router, from_node, 1.);
+        vtr::vector<RRNodeId, float> cong_costs = find_all_min_costs_from_rr_node(router, from_node, 0.);
+        float R_upstream = RouteTree(from_node).root().R_upstream;
+
+        for (int isink = 0; isink < num_sinks_per_from_node; ++isink) {
+            RRNodeId sink_node = sinks[vtr::irand(sinks.size() - 1, rand_state)];
+            if (std::isnan(delay_costs[sink_node]) || std::isnan(cong_costs[sink_node])) {
+                continue; //Unreachable
+            }
+            samples.push_back({from_node, sink_node, R_upstream, delay_costs[sink_node], cong_costs[sink_node]});
+        }
+    }
+    return samples;
+}
+
+static e_router_lookahead lookahead_type_from_name(const std::string& name) {
+    if (name == "classic") {
+        return e_router_lookahead::CLASSIC;
+    } else if (name == "map") {
+        return e_router_lookahead::MAP;
+    } else if (name == "compressed_map") {
+        return e_router_lookahead::COMPRESSED_MAP;
+    } else if (name == "extended_map") {
+        return e_router_lookahead::EXTENDED_MAP;
+    }
+    VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Unknown router lookahead '%s' (expected one of: classic, map, compressed_map, extended_map)\n", name.c_str());
+    return e_router_lookahead::NO_OP;
+}
+
+//Reports the mean relative error, overestimates (which make the router search inadmissible)
+//and histogram of the estimates of cost_type (the delay or congestion) of a lookahead
+static void print_lookahead_errors(const std::vector<float>& actual_costs,
+                                   const std::vector<float>& predicted_costs,
+                                   const char* cost_type) {
+    RouterProfile profile;
+    double sum_relative_error = 0.;
+    size_t num_compared = 0;
+    size_t num_overestimated = 0;
+    for (size_t i = 0; i < actual_costs.size(); ++i) {
+        profile.add_lookahead_error(actual_costs[i], predicted_costs[i]);
+        if (actual_costs[i] <= 0.) {
+            continue;
+        }
+        sum_relative_error += std::abs(predicted_costs[i] - actual_costs[i]) / actual_costs[i];
+        num_compared++;
+        if (predicted_costs[i] > actual_costs[i]) {
+            num_overestimated++;
+        }
+    }
+
+    VTR_LOG("  %s: mean relative error %.1f%%, overestimated %.1f%% of connections\n",
+            cost_type,
+            num_compared ? 100. * sum_relative_error / num_compared : 0.,
+            num_compared ? 100. * num_overestimated / num_compared : 0.);
+    print_lookahead_error_histogram(profile, vtr::string_fmt("true %s / estimated %s", cost_type, cost_type).c_str());
+}
+
+static void profile_lookaheads(const t_det_routing_arch& det_routing_arch,
+                               const t_router_opts& router_opts,
+                               const std::vector<t_segment_inf>& segment_inf,
+                               const std::vector<std::string>& lookahead_names,
+                               int num_from_nodes,
+                               int num_sinks_per_from_node,
+                               bool is_flat) {
+    vtr::ScopedStartFinishTimer timer("Profiling router lookaheads");
+
+    std::vector<e_router_lookahead> lookahead_types;
+    for (const std::string& lookahead_name : lookahead_names) {
+        lookahead_types.push_back(lookahead_type_from_name(lookahead_name));
+    }
+
+    /* Update base costs according to fanout and criticality rules */
+    update_rr_base_costs(1);
+
+    std::vector<t_lookahead_sample> samples = sample_lookahead_connections(num_from_nodes, num_sinks_per_from_node, is_flat);
+    VTR_LOG("Sampled %zu reachable connections from %d wires\n", samples.size(), num_from_nodes);
+
+    std::vector<float> actual_delays;
+    std::vector<float> actual_congs;
+    for (const t_lookahead_sample& sample : samples) {
+        actual_delays.push_back(sample.delay_cost);
+        actual_congs.push_back(sample.cong_cost);
+    }
+
+    t_conn_cost_params delay_params;
+    delay_params.criticality = 1.;
+    t_conn_cost_params cong_params;
+    cong_params.criticality = 0.;
+    t_conn_cost_params query_params;
+    query_params.criticality = router_opts.max_criticality;
+
+    //Queries are repeated to time them reliably
+    constexpr int NUM_QUERY_REPEATS = 10;
+
+    for (size_t ilookahead = 0; ilookahead < lookahead_types.size(); ++ilookahead) {
+        const std::string& lookahead_name = lookahead_names[ilookahead];
+        VTR_LOG("\n");
+        size_t rss_before = vtr::get_max_rss();
+        auto build_start = std::chrono::steady_clock::now();
+        auto router_lookahead = make_router_lookahead(det_routing_arch,
+                                                      lookahead_types[ilookahead],
+                                                      router_opts.router_lookahead_half_precision,
+                                                      /*write_lookahead=*/"",
+                                                      /*read_lookahead=*/"",
+                                                      /*lookahead_cache_dir=*/"",
+                                                      segment_inf,
+                                                      is_flat);
+        std::chrono::duration<double> build_time = std::chrono::steady_clock::now() - build_start;
+        size_t rss_after = vtr::get_max_rss();
+
+        std::vector<float> predicted_delays;
+        std::vector<float> predicted_congs;
+        for (const t_lookahead_sample& sample : samples) {
+            predicted_delays.push_back(router_lookahead->get_expected_delay_and_cong(sample.from_node, sample.sink_node, delay_params, sample.R_upstream).first);
+            predicted_congs.push_back(router_lookahead->get_expected_delay_and_cong(sample.from_node, sample.sink_node, cong_params, sample.R_upstream).second);
+        }
+
+        volatile float total_cost = 0.; //Keeps the timed queries from being optimized away
+        auto query_start = std::chrono::steady_clock::now();
+        for (int irepeat = 0; irepeat < NUM_QUERY_REPEATS; ++irepeat) {
+            for (const t_lookahead_sample& sample : samples) {
+                total_cost = total_cost + router_lookahead->get_expected_cost(sample.from_node, sample.sink_node, query_params, sample.R_upstream);
+            }
+        }
+        std::chrono::duration<double, std::nano> query_time = std::chrono::steady_clock::now() - query_start;
+        size_t num_queries = NUM_QUERY_REPEATS * samples.size();
+
+        VTR_LOG("Router lookahead '%s': build time %.2f seconds, peak memory increase %.1f MiB, query time %.1f ns\n",
+                lookahead_name.c_str(),
+                build_time.count(),
+                (rss_after - std::min(rss_before, rss_after)) / (1024. * 1024.),
+                num_queries ? query_time.count() / num_queries : 0.);
+        print_lookahead_errors(actual_delays, predicted_delays, "delay");
+        print_lookahead_errors(actual_congs, predicted_congs, "congestion");
+    }
+}
+
 static t_chan_width setup_chan_width(t_router_opts router_opts,
         t_chan_width_dist chan_width_dist) {
     /*we give plenty of tracks, this increases routability for the */
@@ -286,6 +527,21 @@ t_route_util_options read_route_util_options(int argc, const char** argv) {
             "Profile routes from source to IPINs at all locations."
             "This is similiar to the placer delay matrix construction.")
         .show_in(argparse::ShowIn::HELP_ONLY);
+    route_diag_grp.add_argument(args.profile_lookaheads, "--profile_lookaheads")
+        .help(
+            "Router lookaheads (any of classic, map, compressed_map and extended_map) to profile."
+            " Each is compared with the true minimum delay and congestion costs of connections from sampled"
+            " wires to sampled sinks, and its build time, memory and query time are reported.")
+        .nargs('+')
+        .show_in(argparse::ShowIn::HELP_ONLY);
+    route_diag_grp.add_argument(args.lookahead_profile_sources, "--lookahead_profile_sources")
+        .help("Number of wires to sample connections from, when profiling router lookaheads.")
+        .default_value("20")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+    route_diag_grp.add_argument(args.lookahead_profile_sinks_per_source, "--lookahead_profile_sinks_per_source")
+        .help("Number of sinks sampled for each wire, when profiling router lookaheads.")
+        .default_value("500")
+        .show_in(argparse::ShowIn::HELP_ONLY);
 
     parser.parse_args(argc, argv);
 
@@ -337,7 +593,15 @@ int main(int argc, const char **argv) {
             Arch.num_directs,
             is_flat);
 
-        if(route_options.profile_source) {
+        if (!route_options.profile_lookaheads.value().empty()) {
+            profile_lookaheads(vpr_setup.RoutingArch,
+                               vpr_setup.RouterOpts,
+                               vpr_setup.Segments,
+                               route_options.profile_lookaheads.value(),
+                               route_options.lookahead_profile_sources,
+                               route_options.lookahead_profile_sinks_per_source,
+                               is_flat);
+        } else if(route_options.profile_source) {
             profile_source(net_list,
                            vpr_setup.RoutingArch,
                            RRNodeId(route_options.source_rr_node),
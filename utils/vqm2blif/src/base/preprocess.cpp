@@ -1805,7 +1805,7 @@ void duplicate_and_split_multiclock_blocks(t_module* module, vector<t_node*>& mu
         char* old_type = split_node_a->type;
         split_node_a->type = (char*) vtr::malloc(sizeof(*split_node_a->type)*(new_len+1));
         snprintf(split_node_a->type, new_len+1, "%s%s", old_type, SPLIT_A_POSTFIX);
-        free(old_type);
+        vqm_free_string(old_type);
 
         //Give 'A' a unique name 
         new_len = strlen(split_node_a->name);
@@ -1821,7 +1821,7 @@ void duplicate_and_split_multiclock_blocks(t_module* module, vector<t_node*>& mu
         old_type = split_node_b->type;
         split_node_b->type = (char*) vtr::malloc(sizeof(*split_node_b->type)*(new_len+1));
         snprintf(split_node_b->type, new_len+1, "%s%s", old_type, SPLIT_B_POSTFIX);
-        free(old_type);
+        vqm_free_string(old_type);
 
         //Give 'B' a unique name 
         new_len = strlen(split_node_b->name);
@@ -847,7 +847,11 @@ void remap_lut_ports(t_node* vqm_node){
 
         // If the port name starts with data, then the port is a LUT input
         if(strncmp(vqm_port->port_name, "data", 4) == 0) {
-            vqm_port->port_name[4] = lut_in_start_char + lut_input_idx;
+            // Port names are shared between the ports of the netlist, so rename a copy
+            char* remapped_port_name = vtr::strdup(vqm_port->port_name);
+            remapped_port_name[4] = lut_in_start_char + lut_input_idx;
+            vqm_free_string(vqm_port->port_name);
+            vqm_port->port_name = remapped_port_name;
             lut_input_idx += 1;
         }
     }
@@ -5,6 +5,7 @@
 #include "globals.h"
 #include "echo_files.h"
 #include "read_xml_arch_file.h"
+#include "read_netlist.h"
 #include "CheckSetup.h"
 
 void CheckSetup(const t_packer_opts& PackerOpts,
@@ -23,6 +24,19 @@ void CheckSetup(const t_packer_opts& PackerOpts,
                         "Packing cannot be timing driven without timing analysis enabled\n");
     }
 
+    if (PackerOpts.pack_partition_size < 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The packer netlist partition size (%d) must not be negative.\n",
+                        PackerOpts.pack_partition_size);
+    }
+
+    if (PackerOpts.doPacking == STAGE_DO && is_packed_netlist_binary(PackerOpts.output_file)) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The packer writes .net XML files, not binary packed netlists (%s)."
+                        " Use --write_packed_netlist_binary to also produce a binary packed netlist.\n",
+                        PackerOpts.output_file.c_str());
+    }
+
     if ((GLOBAL == RouterOpts.route_type)
         && (PlacerOpts.place_algorithm.is_timing_driven())) {
         /* Works, but very weird.  Can't optimize timing well, since you're
@@ -44,6 +58,16 @@ void CheckSetup(const t_packer_opts& PackerOpts,
                         "A block location file requires that placement is enabled.\n");
     }
 
+    if (PlacerOpts.eco_net_file.empty() != PlacerOpts.eco_place_file.empty()) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "An ECO placement requires both the previous packing (--eco_net) and placement (--eco_place).\n");
+    }
+
+    if (PlacerOpts.doPlacement != STAGE_DO && !PlacerOpts.eco_place_file.empty()) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "An ECO placement requires that placement is run.\n");
+    }
+
     if (PlacerOpts.place_algorithm.is_timing_driven() &&
         PlacerOpts.place_static_move_prob.size() > NUM_PL_MOVE_TYPES) {
         VPR_FATAL_ERROR(VPR_ERROR_OTHER,
@@ -60,6 +84,81 @@ void CheckSetup(const t_packer_opts& PackerOpts,
                         NUM_PL_MOVE_TYPES);
     }
 
+    if (PlacerOpts.place_parallel_moves < 1) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The number of parallel placer moves (%d) must be at least 1.\n",
+                        PlacerOpts.place_parallel_moves);
+    }
+
+    if (PlacerOpts.analytic_placer_anneal_t_scale < 0.) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The analytic placer anneal temperature scale (%g) must not be negative.\n",
+                        PlacerOpts.analytic_placer_anneal_t_scale);
+    }
+
+    if (PlacerOpts.place_timing_update_accepted_moves < 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The number of accepted placer moves between timing updates (%d) must not be negative.\n",
+                        PlacerOpts.place_timing_update_accepted_moves);
+    }
+
+    if (PlacerOpts.place_seeds < 1) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The number of placement seeds (%d) must be at least 1.\n",
+                        PlacerOpts.place_seeds);
+    }
+
+    if (PlacerOpts.place_seeds_prune_margin < 0.) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The placement seed pruning margin (%g) must not be negative.\n",
+                        PlacerOpts.place_seeds_prune_margin);
+    }
+
+    if (PlacerOpts.place_congestion_weight < 0.) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The placement congestion cost weight (%g) must not be negative.\n",
+                        PlacerOpts.place_congestion_weight);
+    }
+
+    if (PlacerOpts.place_agent_update_window < 1) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The placement RL agent update window (%d) must be at least 1.\n",
+                        PlacerOpts.place_agent_update_window);
+    }
+
+    if (!PlacerOpts.place_checkpoint_file.empty()) {
+        if (PlacerOpts.place_checkpoint_interval < 1) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "The placement checkpoint interval (%d) must be at least 1.\n",
+                            PlacerOpts.place_checkpoint_interval);
+        }
+        if (PlacerOpts.place_seeds > 1) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Placement checkpoints are not supported with more than one placement seed.\n");
+        }
+    } else if (PlacerOpts.resume_place) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "Resuming placement requires a placement checkpoint file (--place_checkpoint_file).\n");
+    }
+
+    if (PlacerOpts.place_timing_sample_fanout < 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The placement timing sample fanout (%d) must not be negative.\n",
+                        PlacerOpts.place_timing_sample_fanout);
+    }
+
+    if (PlacerOpts.place_timing_sample_size < 1) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The placement timing sample size (%d) must be at least 1.\n",
+                        PlacerOpts.place_timing_sample_size);
+    }
+
+    if (PlacerOpts.place_check_sample_fraction < 0. || PlacerOpts.place_check_sample_fraction > 1.) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "The placement check sample fraction (%g) must be between 0 and 1.\n",
+                        PlacerOpts.place_check_sample_fraction);
+    }
+
     if (RouterOpts.doRouting) {
         if (!Timing.timing_analysis_enabled
             && (DEMAND_ONLY != RouterOpts.base_cost_type && DEMAND_ONLY_NORMALIZED_LENGTH != RouterOpts.base_cost_type)) {
@@ -68,6 +167,11 @@ void CheckSetup(const t_packer_opts& PackerOpts,
         }
     }
 
+    if (RouterOpts.doRouting != STAGE_DO && !RouterOpts.eco_route_file.empty()) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                        "An ECO routing requires that routing is run.\n");
+    }
+
     if (DETAILED == RouterOpts.route_type) {
         if ((Chans.chan_x_dist.type != UNIFORM)
             || (Chans.chan_y_dist.type != UNIFORM)) {
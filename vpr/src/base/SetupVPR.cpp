@@ -137,8 +137,12 @@ void SetupVPR(const t_options* Options,
     FileNameOpts->read_vpr_constraints_file = Options->read_vpr_constraints_file;
     FileNameOpts->write_vpr_constraints_file = Options->write_vpr_constraints_file;
     FileNameOpts->write_block_usage = Options->write_block_usage;
+    FileNameOpts->write_circuit_binary = Options->write_circuit_binary;
+    FileNameOpts->write_packed_netlist_binary = Options->write_packed_netlist_binary;
+    FileNameOpts->lb_type_rr_graph_cache = Options->lb_type_rr_graph_cache;
 
     FileNameOpts->verify_file_digests = Options->verify_file_digests;
+    FileNameOpts->async_output_file_writes = Options->async_output_file_writes;
 
     SetupNetlistOpts(*Options, *NetlistOpts);
     SetupPlacerOpts(*Options, PlacerOpts);
@@ -288,7 +292,7 @@ void SetupVPR(const t_options* Options,
     {
         vtr::ScopedStartFinishTimer t("Building complex block graph");
         alloc_and_load_all_pb_graphs(PowerOpts->do_power, RouterOpts->flat_routing);
-        *PackerRRGraphs = alloc_and_load_all_lb_type_rr_graph();
+        *PackerRRGraphs = alloc_and_load_all_lb_type_rr_graph(FileNameOpts->lb_type_rr_graph_cache, Arch->architecture_id);
     }
 
     if (RouterOpts->flat_routing) {
@@ -415,12 +419,15 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
     RouterOpts->do_check_rr_graph = Options.check_rr_graph;
     RouterOpts->astar_fac = Options.astar_fac;
     RouterOpts->router_profiler_astar_fac = Options.router_profiler_astar_fac;
+    RouterOpts->bidir_search_min_dist = Options.router_bidir_search_min_dist;
+    RouterOpts->bidir_search_max_criticality = Options.router_bidir_search_max_criticality;
     RouterOpts->bb_factor = Options.bb_factor;
     RouterOpts->criticality_exp = Options.criticality_exp;
     RouterOpts->max_criticality = Options.max_criticality;
     RouterOpts->max_router_iterations = Options.max_router_iterations;
     RouterOpts->init_wirelength_abort_threshold = Options.router_init_wirelength_abort_threshold;
     RouterOpts->min_incremental_reroute_fanout = Options.min_incremental_reroute_fanout;
+    RouterOpts->incremental_reroute_all_nets_iter = Options.incremental_reroute_all_nets_iter;
     RouterOpts->incr_reroute_delay_ripup = Options.incr_reroute_delay_ripup;
     RouterOpts->pres_fac_mult = Options.pres_fac_mult;
     RouterOpts->max_pres_fac = Options.max_pres_fac;
@@ -437,10 +444,12 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
     RouterOpts->router_algorithm = Options.RouterAlgorithm;
     RouterOpts->fixed_channel_width = Options.RouteChanWidth;
     RouterOpts->min_channel_width_hint = Options.min_route_chan_width_hint;
+    RouterOpts->min_chan_width_search_jobs = Options.min_route_chan_width_search_jobs;
     RouterOpts->read_rr_edge_metadata = Options.read_rr_edge_metadata;
     RouterOpts->reorder_rr_graph_nodes_algorithm = Options.reorder_rr_graph_nodes_algorithm;
     RouterOpts->reorder_rr_graph_nodes_threshold = Options.reorder_rr_graph_nodes_threshold;
     RouterOpts->reorder_rr_graph_nodes_seed = Options.reorder_rr_graph_nodes_seed;
+    RouterOpts->compact_rr_graph_edges = Options.compact_rr_graph_edges;
 
     RouterOpts->initial_pres_fac = Options.initial_pres_fac;
     RouterOpts->base_cost_type = Options.base_cost_type;
@@ -453,16 +462,21 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
     RouterOpts->routing_failure_predictor = Options.routing_failure_predictor;
     RouterOpts->routing_budgets_algorithm = Options.routing_budgets_algorithm;
     RouterOpts->save_routing_per_iteration = Options.save_routing_per_iteration;
+    RouterOpts->overlap_timing_update = Options.router_overlap_timing_update;
     RouterOpts->congested_routing_iteration_threshold_frac = Options.congested_routing_iteration_threshold_frac;
     RouterOpts->route_bb_update = Options.route_bb_update;
     RouterOpts->clock_modeling = Options.clock_modeling;
     RouterOpts->two_stage_clock_routing = Options.two_stage_clock_routing;
+    RouterOpts->net_order = Options.router_net_order;
+    RouterOpts->sink_order = Options.router_sink_order;
     RouterOpts->high_fanout_threshold = Options.router_high_fanout_threshold;
     RouterOpts->high_fanout_max_slope = Options.router_high_fanout_max_slope;
+    RouterOpts->high_fanout_batch_size = Options.router_high_fanout_batch_size;
     RouterOpts->router_debug_net = Options.router_debug_net;
     RouterOpts->router_debug_sink_rr = Options.router_debug_sink_rr;
     RouterOpts->router_debug_iteration = Options.router_debug_iteration;
     RouterOpts->lookahead_type = Options.router_lookahead_type;
+    RouterOpts->router_lookahead_half_precision = Options.router_lookahead_half_precision;
     RouterOpts->max_convergence_count = Options.router_max_convergence_count;
     RouterOpts->reconvergence_cpd_threshold = Options.router_reconvergence_cpd_threshold;
     RouterOpts->initial_timing = Options.router_initial_timing;
@@ -472,12 +486,28 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
 
     RouterOpts->write_router_lookahead = Options.write_router_lookahead;
     RouterOpts->read_router_lookahead = Options.read_router_lookahead;
+    RouterOpts->eco_route_file = Options.eco_route_file;
+    RouterOpts->router_lookahead_cache_dir = Options.router_lookahead_cache_dir;
 
     RouterOpts->write_intra_cluster_router_lookahead = Options.write_intra_cluster_router_lookahead;
     RouterOpts->read_intra_cluster_router_lookahead = Options.read_intra_cluster_router_lookahead;
 
     RouterOpts->router_heap = Options.router_heap;
     RouterOpts->exit_after_first_routing_iteration = Options.exit_after_first_routing_iteration;
+    RouterOpts->parallel_route_overlapping_nets = Options.parallel_route_overlapping_nets;
+    RouterOpts->parallel_route_batch_iters = Options.parallel_route_batch_iters;
+    RouterOpts->deterministic_parallel_route = Options.deterministic_parallel_route;
+    RouterOpts->report_parallel_route_load_balance = Options.report_parallel_route_load_balance;
+    RouterOpts->global_route_prepass = Options.router_global_route_prepass;
+    RouterOpts->report_router_profile = Options.report_router_profile;
+    if (RouterOpts->deterministic_parallel_route && RouterOpts->parallel_route_overlapping_nets) {
+        VTR_LOG_WARN("Disabling '--parallel_route_overlapping_nets': it is not compatible with '--deterministic_parallel_route'\n");
+        RouterOpts->parallel_route_overlapping_nets = false;
+    }
+    if (RouterOpts->deterministic_parallel_route && RouterOpts->parallel_route_batch_iters > 0) {
+        VTR_LOG_WARN("Disabling '--parallel_route_batch_iters': it is not compatible with '--deterministic_parallel_route'\n");
+        RouterOpts->parallel_route_batch_iters = 0;
+    }
 
     RouterOpts->check_route = Options.check_route;
     RouterOpts->timing_update_type = Options.timing_update_type;
@@ -589,8 +619,11 @@ void SetupPackerOpts(const t_options& Options,
     PackerOpts->device_layout = Options.device_layout;
 
     PackerOpts->timing_update_type = Options.timing_update_type;
+    PackerOpts->timing_update_interval = Options.pack_timing_update_interval;
+    PackerOpts->stream_output = Options.pack_stream_output;
     PackerOpts->pack_num_moves = Options.pack_num_moves;
     PackerOpts->pack_move_type = Options.pack_move_type;
+    PackerOpts->pack_partition_size = Options.pack_partition_size;
 }
 
 static void SetupNetlistOpts(const t_options& Options, t_netlist_opts& NetlistOpts) {
@@ -601,6 +634,7 @@ static void SetupNetlistOpts(const t_options& Options, t_netlist_opts& NetlistOp
     NetlistOpts.sweep_dangling_blocks = Options.sweep_dangling_blocks;
     NetlistOpts.sweep_constant_primary_outputs = Options.sweep_constant_primary_outputs;
     NetlistOpts.netlist_verbosity = Options.netlist_verbosity;
+    NetlistOpts.parallel_blif_read = Options.parallel_blif_read;
 }
 
 /**
@@ -616,6 +650,7 @@ static void SetupPlacerOpts(const t_options& Options, t_placer_opts* PlacerOpts)
 
     PlacerOpts->inner_loop_recompute_divider = Options.inner_loop_recompute_divider;
     PlacerOpts->quench_recompute_divider = Options.quench_recompute_divider;
+    PlacerOpts->place_timing_update_accepted_moves = Options.place_timing_update_accepted_moves;
 
     PlacerOpts->place_cost_exp = 1;
 
@@ -627,6 +662,8 @@ static void SetupPlacerOpts(const t_options& Options, t_placer_opts* PlacerOpts)
     PlacerOpts->place_quench_algorithm = Options.PlaceQuenchAlgorithm;
 
     PlacerOpts->constraints_file = Options.constraints_file;
+    PlacerOpts->eco_net_file = Options.eco_net_file;
+    PlacerOpts->eco_place_file = Options.eco_place_file;
 
     PlacerOpts->write_initial_place_file = Options.write_initial_place_file;
 
@@ -666,6 +703,7 @@ static void SetupPlacerOpts(const t_options& Options, t_placer_opts* PlacerOpts)
     PlacerOpts->effort_scaling = Options.place_effort_scaling;
     PlacerOpts->timing_update_type = Options.timing_update_type;
     PlacerOpts->enable_analytic_placer = Options.enable_analytic_placer;
+    PlacerOpts->analytic_placer_anneal_t_scale = Options.analytic_placer_anneal_t_scale;
     PlacerOpts->place_static_move_prob = vtr::vector<e_move_type, float>(Options.place_static_move_prob.value().begin(),
                                                                          Options.place_static_move_prob.value().end());
     PlacerOpts->place_high_fanout_net = Options.place_high_fanout_net;
@@ -675,6 +713,7 @@ static void SetupPlacerOpts(const t_options& Options, t_placer_opts* PlacerOpts)
     PlacerOpts->place_checkpointing = Options.place_checkpointing;
     PlacerOpts->place_agent_epsilon = Options.place_agent_epsilon;
     PlacerOpts->place_agent_gamma = Options.place_agent_gamma;
+    PlacerOpts->place_agent_update_window = Options.place_agent_update_window;
     PlacerOpts->place_dm_rlim = Options.place_dm_rlim;
     PlacerOpts->place_agent_space = Options.place_agent_space;
     PlacerOpts->place_reward_fun = Options.place_reward_fun;
@@ -684,6 +723,17 @@ static void SetupPlacerOpts(const t_options& Options, t_placer_opts* PlacerOpts)
     PlacerOpts->place_constraint_subtile = Options.place_constraint_subtile;
     PlacerOpts->floorplan_num_horizontal_partitions = Options.floorplan_num_horizontal_partitions;
     PlacerOpts->floorplan_num_vertical_partitions = Options.floorplan_num_vertical_partitions;
+    PlacerOpts->place_parallel_moves = Options.place_parallel_moves;
+    PlacerOpts->place_seeds = Options.place_seeds;
+    PlacerOpts->place_seeds_prune_margin = Options.place_seeds_prune_margin;
+    PlacerOpts->place_congestion_weight = Options.place_congestion_weight;
+    PlacerOpts->place_multilevel = Options.place_multilevel;
+    PlacerOpts->place_checkpoint_file = Options.place_checkpoint_file;
+    PlacerOpts->place_checkpoint_interval = Options.place_checkpoint_interval;
+    PlacerOpts->resume_place = Options.resume_place;
+    PlacerOpts->place_timing_sample_fanout = Options.place_timing_sample_fanout;
+    PlacerOpts->place_timing_sample_size = Options.place_timing_sample_size;
+    PlacerOpts->place_check_sample_fraction = Options.place_check_sample_fraction;
 
     PlacerOpts->seed = Options.Seed;
 
@@ -755,6 +805,8 @@ static void SetupNocOpts(const t_options& Options, t_noc_opts* NocOpts) {
         NocOpts->noc_sat_routing_num_workers = (int)Options.num_workers;
     }
     NocOpts->noc_sat_routing_log_search_progress = Options.noc_sat_routing_log_search_progress;
+    NocOpts->noc_sat_routing_time_limit = Options.noc_sat_routing_time_limit;
+    NocOpts->noc_enforce_deadlock_freedom = Options.noc_enforce_deadlock_freedom;
     NocOpts->noc_placement_file_name = Options.noc_placement_file_name;
 
 
@@ -266,6 +266,9 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
             case PARALLEL_DECOMP:
                 VTR_LOG("PARALLEL_DECOMP\n");
                 break;
+            case DISTRIBUTED:
+                VTR_LOG("DISTRIBUTED\n");
+                break;
             case TIMING_DRIVEN:
                 VTR_LOG("TIMING_DRIVEN\n");
                 break;
@@ -331,21 +334,28 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
         VTR_LOG("RouterOpts.max_pres_fac: %f\n", RouterOpts.max_pres_fac);
         VTR_LOG("RouterOpts.max_router_iterations: %d\n", RouterOpts.max_router_iterations);
         VTR_LOG("RouterOpts.min_incremental_reroute_fanout: %d\n", RouterOpts.min_incremental_reroute_fanout);
+        VTR_LOG("RouterOpts.incremental_reroute_all_nets_iter: %d\n", RouterOpts.incremental_reroute_all_nets_iter);
         VTR_LOG("RouterOpts.do_check_rr_graph: %s\n", RouterOpts.do_check_rr_graph ? "true" : "false");
+        VTR_LOG("RouterOpts.compact_rr_graph_edges: %s\n", RouterOpts.compact_rr_graph_edges ? "true" : "false");
         VTR_LOG("RouterOpts.verify_binary_search: %s\n", RouterOpts.verify_binary_search ? "true" : "false");
         VTR_LOG("RouterOpts.min_channel_width_hint: %d\n", RouterOpts.min_channel_width_hint);
+        VTR_LOG("RouterOpts.min_chan_width_search_jobs: %d\n", RouterOpts.min_chan_width_search_jobs);
         VTR_LOG("RouterOpts.read_rr_edge_metadata: %s\n", RouterOpts.read_rr_edge_metadata ? "true" : "false");
         VTR_LOG("RouterOpts.exit_after_first_routing_iteration: %s\n", RouterOpts.exit_after_first_routing_iteration ? "true" : "false");
 
         if (TIMING_DRIVEN == RouterOpts.router_algorithm) {
             VTR_LOG("RouterOpts.astar_fac: %f\n", RouterOpts.astar_fac);
             VTR_LOG("RouterOpts.router_profiler_astar_fac: %f\n", RouterOpts.router_profiler_astar_fac);
+            VTR_LOG("RouterOpts.bidir_search_min_dist: %d\n", RouterOpts.bidir_search_min_dist);
+            VTR_LOG("RouterOpts.bidir_search_max_criticality: %f\n", RouterOpts.bidir_search_max_criticality);
             VTR_LOG("RouterOpts.criticality_exp: %f\n", RouterOpts.criticality_exp);
             VTR_LOG("RouterOpts.max_criticality: %f\n", RouterOpts.max_criticality);
             VTR_LOG("RouterOpts.init_wirelength_abort_threshold: %f\n", RouterOpts.init_wirelength_abort_threshold);
             VTR_LOG("RouterOpts.save_routing_per_iteration: %s\n", RouterOpts.save_routing_per_iteration ? "true" : "false");
+            VTR_LOG("RouterOpts.overlap_timing_update: %s\n", RouterOpts.overlap_timing_update ? "true" : "false");
             VTR_LOG("RouterOpts.congested_routing_iteration_threshold_frac: %f\n", RouterOpts.congested_routing_iteration_threshold_frac);
             VTR_LOG("RouterOpts.high_fanout_threshold: %d\n", RouterOpts.high_fanout_threshold);
+            VTR_LOG("RouterOpts.high_fanout_batch_size: %d\n", RouterOpts.high_fanout_batch_size);
             VTR_LOG("RouterOpts.router_debug_net: %d\n", RouterOpts.router_debug_net);
             VTR_LOG("RouterOpts.router_debug_sink_rr: %d\n", RouterOpts.router_debug_sink_rr);
             VTR_LOG("RouterOpts.router_debug_iteration: %d\n", RouterOpts.router_debug_iteration);
@@ -369,6 +379,30 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
                     VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown route_bb_update\n");
             }
 
+            VTR_LOG("RouterOpts.net_order: ");
+            switch (RouterOpts.net_order) {
+                case e_router_net_order::FANOUT:
+                    VTR_LOG("FANOUT\n");
+                    break;
+                case e_router_net_order::ADAPTIVE:
+                    VTR_LOG("ADAPTIVE\n");
+                    break;
+                default:
+                    VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown net_order\n");
+            }
+
+            VTR_LOG("RouterOpts.sink_order: ");
+            switch (RouterOpts.sink_order) {
+                case e_router_sink_order::CRITICALITY:
+                    VTR_LOG("CRITICALITY\n");
+                    break;
+                case e_router_sink_order::PROXIMITY:
+                    VTR_LOG("PROXIMITY\n");
+                    break;
+                default:
+                    VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown sink_order\n");
+            }
+
             VTR_LOG("RouterOpts.lookahead_type: ");
             switch (RouterOpts.lookahead_type) {
                 case e_router_lookahead::CLASSIC:
@@ -389,6 +423,7 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
                 default:
                     VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown lookahead_type\n");
             }
+            VTR_LOG("RouterOpts.router_lookahead_half_precision: %s\n", RouterOpts.router_lookahead_half_precision ? "true" : "false");
 
             VTR_LOG("RouterOpts.initial_timing: ");
             switch (RouterOpts.initial_timing) {
@@ -413,6 +448,12 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
                 case e_heap_type::BUCKET_HEAP_APPROXIMATION:
                     VTR_LOG("BUCKET_HEAP_APPROXIMATION\n");
                     break;
+                case e_heap_type::FOUR_ARY_HEAP:
+                    VTR_LOG("FOUR_ARY_HEAP\n");
+                    break;
+                case e_heap_type::RADIX_HEAP:
+                    VTR_LOG("RADIX_HEAP\n");
+                    break;
                 default:
                     VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown router_heap\n");
             }
@@ -477,21 +518,28 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
         VTR_LOG("RouterOpts.max_pres_fac: %f\n", RouterOpts.max_pres_fac);
         VTR_LOG("RouterOpts.max_router_iterations: %d\n", RouterOpts.max_router_iterations);
         VTR_LOG("RouterOpts.min_incremental_reroute_fanout: %d\n", RouterOpts.min_incremental_reroute_fanout);
+        VTR_LOG("RouterOpts.incremental_reroute_all_nets_iter: %d\n", RouterOpts.incremental_reroute_all_nets_iter);
         VTR_LOG("RouterOpts.do_check_rr_graph: %s\n", RouterOpts.do_check_rr_graph ? "true" : "false");
+        VTR_LOG("RouterOpts.compact_rr_graph_edges: %s\n", RouterOpts.compact_rr_graph_edges ? "true" : "false");
         VTR_LOG("RouterOpts.verify_binary_search: %s\n", RouterOpts.verify_binary_search ? "true" : "false");
         VTR_LOG("RouterOpts.min_channel_width_hint: %d\n", RouterOpts.min_channel_width_hint);
+        VTR_LOG("RouterOpts.min_chan_width_search_jobs: %d\n", RouterOpts.min_chan_width_search_jobs);
         VTR_LOG("RouterOpts.read_rr_edge_metadata: %s\n", RouterOpts.read_rr_edge_metadata ? "true" : "false");
         VTR_LOG("RouterOpts.exit_after_first_routing_iteration: %s\n", RouterOpts.exit_after_first_routing_iteration ? "true" : "false");
         if (TIMING_DRIVEN == RouterOpts.router_algorithm) {
             VTR_LOG("RouterOpts.astar_fac: %f\n", RouterOpts.astar_fac);
             VTR_LOG("RouterOpts.router_profiler_astar_fac: %f\n", RouterOpts.router_profiler_astar_fac);
+            VTR_LOG("RouterOpts.bidir_search_min_dist: %d\n", RouterOpts.bidir_search_min_dist);
+            VTR_LOG("RouterOpts.bidir_search_max_criticality: %f\n", RouterOpts.bidir_search_max_criticality);
             VTR_LOG("RouterOpts.criticality_exp: %f\n", RouterOpts.criticality_exp);
             VTR_LOG("RouterOpts.max_criticality: %f\n", RouterOpts.max_criticality);
             VTR_LOG("RouterOpts.init_wirelength_abort_threshold: %f\n", RouterOpts.init_wirelength_abort_threshold);
             VTR_LOG("RouterOpts.incr_reroute_delay_ripup: %f\n", RouterOpts.incr_reroute_delay_ripup);
             VTR_LOG("RouterOpts.save_routing_per_iteration: %s\n", RouterOpts.save_routing_per_iteration ? "true" : "false");
+            VTR_LOG("RouterOpts.overlap_timing_update: %s\n", RouterOpts.overlap_timing_update ? "true" : "false");
             VTR_LOG("RouterOpts.congested_routing_iteration_threshold_frac: %f\n", RouterOpts.congested_routing_iteration_threshold_frac);
             VTR_LOG("RouterOpts.high_fanout_threshold: %d\n", RouterOpts.high_fanout_threshold);
+            VTR_LOG("RouterOpts.high_fanout_batch_size: %d\n", RouterOpts.high_fanout_batch_size);
             VTR_LOG("RouterOpts.router_debug_net: %d\n", RouterOpts.router_debug_net);
             VTR_LOG("RouterOpts.router_debug_sink_rr: %d\n", RouterOpts.router_debug_sink_rr);
             VTR_LOG("RouterOpts.router_debug_iteration: %d\n", RouterOpts.router_debug_iteration);
@@ -512,6 +560,30 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
                     VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown route_bb_update\n");
             }
 
+            VTR_LOG("RouterOpts.net_order: ");
+            switch (RouterOpts.net_order) {
+                case e_router_net_order::FANOUT:
+                    VTR_LOG("FANOUT\n");
+                    break;
+                case e_router_net_order::ADAPTIVE:
+                    VTR_LOG("ADAPTIVE\n");
+                    break;
+                default:
+                    VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown net_order\n");
+            }
+
+            VTR_LOG("RouterOpts.sink_order: ");
+            switch (RouterOpts.sink_order) {
+                case e_router_sink_order::CRITICALITY:
+                    VTR_LOG("CRITICALITY\n");
+                    break;
+                case e_router_sink_order::PROXIMITY:
+                    VTR_LOG("PROXIMITY\n");
+                    break;
+                default:
+                    VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown sink_order\n");
+            }
+
             VTR_LOG("RouterOpts.lookahead_type: ");
             switch (RouterOpts.lookahead_type) {
                 case e_router_lookahead::CLASSIC:
@@ -532,6 +604,7 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
                 default:
                     VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown lookahead_type\n");
             }
+            VTR_LOG("RouterOpts.router_lookahead_half_precision: %s\n", RouterOpts.router_lookahead_half_precision ? "true" : "false");
 
             VTR_LOG("RouterOpts.initial_timing: ");
             switch (RouterOpts.initial_timing) {
@@ -556,6 +629,12 @@ static void ShowRouterOpts(const t_router_opts& RouterOpts) {
                 case e_heap_type::BUCKET_HEAP_APPROXIMATION:
                     VTR_LOG("BUCKET_HEAP_APPROXIMATION\n");
                     break;
+                case e_heap_type::FOUR_ARY_HEAP:
+                    VTR_LOG("FOUR_ARY_HEAP\n");
+                    break;
+                case e_heap_type::RADIX_HEAP:
+                    VTR_LOG("RADIX_HEAP\n");
+                    break;
                 default:
                     VPR_FATAL_ERROR(VPR_ERROR_UNKNOWN, "Unknown router_heap\n");
             }
@@ -616,12 +695,18 @@ static void ShowPlacerOpts(const t_placer_opts& PlacerOpts,
             VTR_LOG("Using constraints file '%s'\n", PlacerOpts.constraints_file.c_str());
         }
 
+        if (!PlacerOpts.eco_place_file.empty()) {
+            VTR_LOG("PlacerOpts.eco_net_file: %s\n", PlacerOpts.eco_net_file.c_str());
+            VTR_LOG("PlacerOpts.eco_place_file: %s\n", PlacerOpts.eco_place_file.c_str());
+        }
+
         VTR_LOG("PlacerOpts.place_cost_exp: %f\n", PlacerOpts.place_cost_exp);
 
         VTR_LOG("PlacerOpts.place_chan_width: %d\n", PlacerOpts.place_chan_width);
 
         if (PlacerOpts.place_algorithm.is_timing_driven()) {
             VTR_LOG("PlacerOpts.inner_loop_recompute_divider: %d\n", PlacerOpts.inner_loop_recompute_divider);
+            VTR_LOG("PlacerOpts.place_timing_update_accepted_moves: %d\n", PlacerOpts.place_timing_update_accepted_moves);
             VTR_LOG("PlacerOpts.recompute_crit_iter: %d\n", PlacerOpts.recompute_crit_iter);
             VTR_LOG("PlacerOpts.timing_tradeoff: %f\n", PlacerOpts.timing_tradeoff);
             VTR_LOG("PlacerOpts.td_place_exp_first: %f\n", PlacerOpts.td_place_exp_first);
@@ -648,6 +733,18 @@ static void ShowPlacerOpts(const t_placer_opts& PlacerOpts,
         VTR_LOG("PlacerOpts.rlim_escape_fraction: %f\n", PlacerOpts.rlim_escape_fraction);
         VTR_LOG("PlacerOpts.move_stats_file: %s\n", PlacerOpts.move_stats_file.c_str());
         VTR_LOG("PlacerOpts.placement_saves_per_temperature: %d\n", PlacerOpts.placement_saves_per_temperature);
+        VTR_LOG("PlacerOpts.place_parallel_moves: %d\n", PlacerOpts.place_parallel_moves);
+        VTR_LOG("PlacerOpts.place_seeds: %d\n", PlacerOpts.place_seeds);
+        VTR_LOG("PlacerOpts.place_seeds_prune_margin: %f\n", PlacerOpts.place_seeds_prune_margin);
+        VTR_LOG("PlacerOpts.place_congestion_weight: %f\n", PlacerOpts.place_congestion_weight);
+        VTR_LOG("PlacerOpts.place_multilevel: %s\n", PlacerOpts.place_multilevel ? "true" : "false");
+        VTR_LOG("PlacerOpts.place_agent_update_window: %d\n", PlacerOpts.place_agent_update_window);
+        VTR_LOG("PlacerOpts.place_checkpoint_file: %s\n", PlacerOpts.place_checkpoint_file.c_str());
+        VTR_LOG("PlacerOpts.place_checkpoint_interval: %d\n", PlacerOpts.place_checkpoint_interval);
+        VTR_LOG("PlacerOpts.resume_place: %s\n", PlacerOpts.resume_place ? "true" : "false");
+        VTR_LOG("PlacerOpts.place_timing_sample_fanout: %d\n", PlacerOpts.place_timing_sample_fanout);
+        VTR_LOG("PlacerOpts.place_timing_sample_size: %d\n", PlacerOpts.place_timing_sample_size);
+        VTR_LOG("PlacerOpts.place_check_sample_fraction: %f\n", PlacerOpts.place_check_sample_fraction);
 
         VTR_LOG("PlacerOpts.effort_scaling: ");
         switch (PlacerOpts.effort_scaling) {
@@ -687,6 +784,7 @@ static void ShowNetlistOpts(const t_netlist_opts& NetlistOpts) {
     VTR_LOG("NetlistOpts.sweep_dangling_blocks         : %s\n", (NetlistOpts.sweep_dangling_blocks) ? "true" : "false");
     VTR_LOG("NetlistOpts.sweep_constant_primary_outputs: %s\n", (NetlistOpts.sweep_constant_primary_outputs) ? "true" : "false");
     VTR_LOG("NetlistOpts.netlist_verbosity             : %d\n", NetlistOpts.netlist_verbosity);
+    VTR_LOG("NetlistOpts.parallel_blif_read            : %s\n", (NetlistOpts.parallel_blif_read) ? "true" : "false");
 
     std::string const_gen_inference_strings[3] = {"NONE", "COMB", "COMB_SEQ"};
     if ((size_t)NetlistOpts.const_gen_inference > 3)
@@ -788,6 +886,9 @@ static void ShowPackerOpts(const t_packer_opts& PackerOpts) {
     VTR_LOG("PackerOpts.hill_climbing_flag: %s", (PackerOpts.hill_climbing_flag ? "true\n" : "false\n"));
     VTR_LOG("PackerOpts.inter_cluster_net_delay: %f\n", PackerOpts.inter_cluster_net_delay);
     VTR_LOG("PackerOpts.timing_driven: %s", (PackerOpts.timing_driven ? "true\n" : "false\n"));
+    VTR_LOG("PackerOpts.timing_update_interval: %d\n", PackerOpts.timing_update_interval);
+    VTR_LOG("PackerOpts.stream_output: %s", (PackerOpts.stream_output ? "true\n" : "false\n"));
+    VTR_LOG("PackerOpts.pack_partition_size: %d\n", PackerOpts.pack_partition_size);
     VTR_LOG("PackerOpts.target_external_pin_util: %s", vtr::join(PackerOpts.target_external_pin_util, " ").c_str());
     VTR_LOG("\n");
     VTR_LOG("\n");
@@ -806,6 +907,8 @@ static void ShowNocOpts(const t_noc_opts& NocOpts) {
     VTR_LOG("NocOpts.noc_sat_routing_latency_overrun_weighting: %d\n", NocOpts.noc_sat_routing_latency_overrun_weighting);
     VTR_LOG("NocOpts.noc_sat_routing_congestion_weighting: %d\n", NocOpts.noc_sat_routing_congestion_weighting);
     VTR_LOG("NocOpts.noc_sat_routing_num_workers: %d\n", NocOpts.noc_sat_routing_num_workers);
+    VTR_LOG("NocOpts.noc_sat_routing_time_limit: %g\n", NocOpts.noc_sat_routing_time_limit);
+    VTR_LOG("NocOpts.noc_enforce_deadlock_freedom: %s\n", NocOpts.noc_enforce_deadlock_freedom ? "true" : "false");
     VTR_LOG("NocOpts.noc_routing_algorithm: %s\n", NocOpts.noc_placement_file_name.c_str());
     VTR_LOG("\n");
 }
\ No newline at end of file
@@ -292,6 +292,13 @@ void AtomNetlist::shrink_to_fit_impl() {
     port_models_.shrink_to_fit();
 }
 
+size_t AtomNetlist::memory_usage_impl() const {
+    return vtr::memory_usage(block_models_)
+           + vtr::memory_usage(block_truth_tables_)
+           + vtr::memory_usage(port_models_)
+           + vtr::memory_usage(net_aliases_map_);
+}
+
 /*
  *
  * Sanity Checks
@@ -247,6 +247,9 @@ class AtomNetlist : public Netlist<AtomBlockId, AtomPortId, AtomPinId, AtomNetId
     ///@brief Shrinks internal data structures to required size to reduce memory consumption
     void shrink_to_fit_impl() override;
 
+    ///@brief Returns the (estimated) bytes held by the atom specific data
+    size_t memory_usage_impl() const override;
+
     /*
      * Sanity checks
      */
@@ -0,0 +1,325 @@
+/**
+ * @file
+ * @brief Reads and writes the binary atom netlist files declared in atom_netlist_binary.h
+ *
+ * Layout (see binary_file_io.h for the file container):
+ *   - header: netlist name and ID, the number of blocks, ports, pins and nets, and the
+ *     models used by the blocks (model name, then the names of the model ports used)
+ *   - the blocks of nets, then of blocks, ports and pins, each of up to
+ *     BINARY_ATOM_NETLIST_ITEMS_PER_CHUNK items in ID order
+ *
+ * Blocks, ports and nets refer to each other by their index in the file.
+ */
+
+#include "atom_netlist_binary.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+#include "atom_netlist.h"
+#include "binary_file_io.h"
+#include "vpr_error.h"
+
+/* Identifies a binary atom netlist file. Bump the version whenever the layout written below changes */
+static constexpr char BINARY_ATOM_NETLIST_MAGIC[8] = {'V', 'P', 'R', 'A', 'T', 'O', 'M', 'S'};
+static constexpr uint32_t BINARY_ATOM_NETLIST_VERSION = 1;
+
+///@brief Number of nets, blocks, ports or pins in each (independently encoded) block of a binary atom netlist file
+static constexpr size_t BINARY_ATOM_NETLIST_ITEMS_PER_CHUNK = 4096;
+
+static size_t num_chunks(size_t num_items) {
+    return (num_items + BINARY_ATOM_NETLIST_ITEMS_PER_CHUNK - 1) / BINARY_ATOM_NETLIST_ITEMS_PER_CHUNK;
+}
+
+///@brief Returns the valid ids of range (removed netlist components leave invalid ids until the netlist is compressed)
+template<typename Range>
+static auto valid_ids(const Range& range) {
+    std::vector<typename std::decay<decltype(*range.begin())>::type> ids;
+    for (auto id : range) {
+        if (id) {
+            ids.push_back(id);
+        }
+    }
+    return ids;
+}
+
+///@brief Returns the index of each id of ids, indexed by id
+template<typename Id>
+static std::vector<size_t> id_indices(const std::vector<Id>& ids, size_t num_ids) {
+    std::vector<size_t> indices(num_ids, 0);
+    for (size_t i = 0; i < ids.size(); ++i) {
+        indices[size_t(ids[i])] = i;
+    }
+    return indices;
+}
+
+static const t_model* find_model(const std::string& name, const t_model* user_models, const t_model* library_models, const char* filename) {
+    for (const t_model* models : {user_models, library_models}) {
+        for (const t_model* model = models; model; model = model->next) {
+            if (name == model->name) {
+                return model;
+            }
+        }
+    }
+    vpr_throw(VPR_ERROR_ATOM_NETLIST, filename, 0, "Failed to find matching architecture model for '%s'", name.c_str());
+}
+
+static const t_model_ports* find_model_port(const t_model* model, const std::string& name, const char* filename) {
+    for (const t_model_ports* ports : {model->inputs, model->outputs}) {
+        for (const t_model_ports* port = ports; port; port = port->next) {
+            if (name == port->name) {
+                return port;
+            }
+        }
+    }
+    vpr_throw(VPR_ERROR_ATOM_NETLIST, filename, 0, "Failed to find port '%s' on architecture model '%s'", name.c_str(), model->name);
+}
+
+void write_atom_netlist_binary(const AtomNetlist& netlist, const char* filename) {
+    vtr::ScopedStartFinishTimer timer(vtr::string_fmt("Write binary atom netlist %s", filename));
+
+    auto nets = valid_ids(netlist.nets());
+    auto blocks = valid_ids(netlist.blocks());
+    auto ports = valid_ids(netlist.ports());
+    auto pins = valid_ids(netlist.pins());
+
+    auto net_indices = id_indices(nets, netlist.nets().size());
+    auto block_indices = id_indices(blocks, netlist.blocks().size());
+    auto port_indices = id_indices(ports, netlist.ports().size());
+
+    //Number the models, and the ports of each model, in order of first use
+    std::unordered_map<const t_model*, size_t> model_indices;
+    std::vector<const t_model*> models;
+    std::unordered_map<const t_model_ports*, size_t> model_port_indices;
+    std::vector<std::vector<const t_model_ports*>> model_ports;
+    for (AtomBlockId blk_id : blocks) {
+        const t_model* model = netlist.block_model(blk_id);
+        if (model_indices.emplace(model, models.size()).second) {
+            models.push_back(model);
+            model_ports.emplace_back();
+        }
+    }
+    for (AtomPortId port_id : ports) {
+        const t_model_ports* model_port = netlist.port_model(port_id);
+        auto& ports_of_model = model_ports[model_indices.at(netlist.block_model(netlist.port_block(port_id)))];
+        if (model_port_indices.emplace(model_port, ports_of_model.size()).second) {
+            ports_of_model.push_back(model_port);
+        }
+    }
+
+    BinaryEncoder header;
+    header.write_string(netlist.netlist_name());
+    header.write_string(netlist.netlist_id());
+    header.write_uint(nets.size());
+    header.write_uint(blocks.size());
+    header.write_uint(ports.size());
+    header.write_uint(pins.size());
+    header.write_uint(models.size());
+    for (size_t imodel = 0; imodel < models.size(); ++imodel) {
+        header.write_string(models[imodel]->name);
+        header.write_uint(model_ports[imodel].size());
+        for (const t_model_ports* model_port : model_ports[imodel]) {
+            header.write_string(model_port->name);
+        }
+    }
+
+    size_t nets_begin = 0;
+    size_t blocks_begin = nets_begin + num_chunks(nets.size());
+    size_t ports_begin = blocks_begin + num_chunks(blocks.size());
+    size_t pins_begin = ports_begin + num_chunks(ports.size());
+    std::vector<std::string> chunks(pins_begin + num_chunks(pins.size()));
+
+    for_each_binary_block(chunks.size(), [&](size_t ichunk) {
+        BinaryEncoder encoder;
+
+        //Each chunk encodes items [begin, end) of one kind
+        auto item_range = [&](size_t kind_begin, size_t num_items) {
+            size_t begin = (ichunk - kind_begin) * BINARY_ATOM_NETLIST_ITEMS_PER_CHUNK;
+            return std::make_pair(begin, std::min(num_items, begin + BINARY_ATOM_NETLIST_ITEMS_PER_CHUNK));
+        };
+
+        if (ichunk < blocks_begin) {
+            auto [begin, end] = item_range(nets_begin, nets.size());
+            for (size_t inet = begin; inet < end; ++inet) {
+                encoder.write_string(netlist.net_name(nets[inet]));
+            }
+        } else if (ichunk < ports_begin) {
+            auto [begin, end] = item_range(blocks_begin, blocks.size());
+            for (size_t iblk = begin; iblk < end; ++iblk) {
+                AtomBlockId blk_id = blocks[iblk];
+                encoder.write_string(netlist.block_name(blk_id));
+                encoder.write_uint(model_indices.at(netlist.block_model(blk_id)));
+
+                const AtomNetlist::TruthTable& truth_table = netlist.block_truth_table(blk_id);
+                encoder.write_uint(truth_table.size());
+                for (const auto& row : truth_table) {
+                    encoder.write_uint(row.size());
+                    for (vtr::LogicValue value : row) {
+                        encoder.write_uint(size_t(value));
+                    }
+                }
+
+                for (auto name_values : {netlist.block_params(blk_id), netlist.block_attrs(blk_id)}) {
+                    encoder.write_uint(name_values.size());
+                    for (const auto& [name, value] : name_values) {
+                        encoder.write_string(name);
+                        encoder.write_string(value);
+                    }
+                }
+            }
+        } else if (ichunk < pins_begin) {
+            auto [begin, end] = item_range(ports_begin, ports.size());
+            for (size_t iport = begin; iport < end; ++iport) {
+                AtomPortId port_id = ports[iport];
+                encoder.write_uint(block_indices[size_t(netlist.port_block(port_id))]);
+                encoder.write_uint(model_port_indices.at(netlist.port_model(port_id)));
+            }
+        } else {
+            auto [begin, end] = item_range(pins_begin, pins.size());
+            for (size_t ipin = begin; ipin < end; ++ipin) {
+                AtomPinId pin_id = pins[ipin];
+                encoder.write_uint(port_indices[size_t(netlist.pin_port(pin_id))]);
+                encoder.write_uint(netlist.pin_port_bit(pin_id));
+                encoder.write_uint(net_indices[size_t(netlist.pin_net(pin_id))]);
+                encoder.write_uint(netlist.pin_type(pin_id) == PinType::DRIVER);
+                encoder.write_uint(netlist.pin_is_constant(pin_id));
+            }
+        }
+
+        chunks[ichunk] = std::move(encoder.data());
+    });
+
+    write_binary_file(filename, BINARY_ATOM_NETLIST_MAGIC, BINARY_ATOM_NETLIST_VERSION, header.data(), chunks, VPR_ERROR_ATOM_NETLIST);
+}
+
+AtomNetlist read_atom_netlist_binary(const char* filename,
+                                     const t_model* user_models,
+                                     const t_model* library_models) {
+    std::string header_data;
+    std::vector<std::string> chunks;
+    read_binary_file(filename, BINARY_ATOM_NETLIST_MAGIC, BINARY_ATOM_NETLIST_VERSION, header_data, chunks, VPR_ERROR_ATOM_NETLIST);
+
+    BinaryDecoder header(header_data);
+    std::string netlist_name = header.read_string();
+    std::string netlist_id = header.read_string();
+    size_t num_nets = header.read_uint();
+    size_t num_blocks = header.read_uint();
+    size_t num_ports = header.read_uint();
+    size_t num_pins = header.read_uint();
+
+    std::vector<const t_model*> models(header.read_uint());
+    std::vector<std::vector<const t_model_ports*>> model_ports(models.size());
+    for (size_t imodel = 0; header.ok() && imodel < models.size(); ++imodel) {
+        models[imodel] = find_model(header.read_string(), user_models, library_models, filename);
+        model_ports[imodel].resize(header.read_uint());
+        for (size_t iport = 0; header.ok() && iport < model_ports[imodel].size(); ++iport) {
+            model_ports[imodel][iport] = find_model_port(models[imodel], header.read_string(), filename);
+        }
+    }
+
+    size_t nets_begin = 0;
+    size_t blocks_begin = nets_begin + num_chunks(num_nets);
+    size_t ports_begin = blocks_begin + num_chunks(num_blocks);
+    size_t pins_begin = ports_begin + num_chunks(num_ports);
+    if (!header.ok() || !header.at_end() || chunks.size() != pins_begin + num_chunks(num_pins)) {
+        vpr_throw(VPR_ERROR_ATOM_NETLIST, filename, 0, "Binary atom netlist file header is truncated or corrupt");
+    }
+
+    AtomNetlist netlist(netlist_name, netlist_id);
+    netlist.set_block_types(find_model(MODEL_INPUT, user_models, library_models, filename),
+                            find_model(MODEL_OUTPUT, user_models, library_models, filename));
+
+    auto corrupt = [&](size_t ichunk) {
+        vpr_throw(VPR_ERROR_ATOM_NETLIST, filename, 0, "Binary atom netlist file is corrupt (block %zu)", ichunk);
+    };
+
+    //The netlist is built in ID order, so every component gets the same ID as in the written netlist
+    std::vector<AtomNetId> nets;
+    std::vector<AtomBlockId> blocks;
+    std::vector<AtomPortId> ports;
+    nets.reserve(num_nets);
+    blocks.reserve(num_blocks);
+    ports.reserve(num_ports);
+
+    for (size_t ichunk = 0; ichunk < chunks.size(); ++ichunk) {
+        BinaryDecoder decoder(chunks[ichunk]);
+
+        if (ichunk < blocks_begin) {
+            size_t end = std::min(num_nets, nets.size() + BINARY_ATOM_NETLIST_ITEMS_PER_CHUNK);
+            while (decoder.ok() && nets.size() < end) {
+                nets.push_back(netlist.create_net(decoder.read_string()));
+            }
+        } else if (ichunk < ports_begin) {
+            size_t end = std::min(num_blocks, blocks.size() + BINARY_ATOM_NETLIST_ITEMS_PER_CHUNK);
+            while (decoder.ok() && blocks.size() < end) {
+                std::string name = decoder.read_string();
+                size_t imodel = decoder.read_uint();
+                if (imodel >= models.size()) {
+                    corrupt(ichunk);
+                }
+
+                AtomNetlist::TruthTable truth_table(decoder.read_uint());
+                for (size_t irow = 0; decoder.ok() && irow < truth_table.size(); ++irow) {
+                    truth_table[irow].resize(decoder.read_uint());
+                    for (vtr::LogicValue& value : truth_table[irow]) {
+                        value = vtr::LogicValue(decoder.read_uint());
+                    }
+                }
+
+                AtomBlockId blk_id = netlist.create_block(name, models[imodel], truth_table);
+                blocks.push_back(blk_id);
+
+                size_t num_params = decoder.read_uint();
+                for (size_t iparam = 0; decoder.ok() && iparam < num_params; ++iparam) {
+                    std::string param_name = decoder.read_string();
+                    netlist.set_block_param(blk_id, param_name, decoder.read_string());
+                }
+                size_t num_attrs = decoder.read_uint();
+                for (size_t iattr = 0; decoder.ok() && iattr < num_attrs; ++iattr) {
+                    std::string attr_name = decoder.read_string();
+                    netlist.set_block_attr(blk_id, attr_name, decoder.read_string());
+                }
+            }
+        } else if (ichunk < pins_begin) {
+            size_t end = std::min(num_ports, ports.size() + BINARY_ATOM_NETLIST_ITEMS_PER_CHUNK);
+            while (decoder.ok() && ports.size() < end) {
+                size_t iblk = decoder.read_uint();
+                size_t imodel_port = decoder.read_uint();
+                if (iblk >= blocks.size()) {
+                    corrupt(ichunk);
+                }
+                const auto& ports_of_model = model_ports[std::distance(models.begin(), std::find(models.begin(), models.end(), netlist.block_model(blocks[iblk])))];
+                if (imodel_port >= ports_of_model.size()) {
+                    corrupt(ichunk);
+                }
+                ports.push_back(netlist.create_port(blocks[iblk], ports_of_model[imodel_port]));
+            }
+        } else {
+            size_t end = std::min(num_pins, (ichunk - pins_begin + 1) * BINARY_ATOM_NETLIST_ITEMS_PER_CHUNK);
+            for (size_t ipin = (ichunk - pins_begin) * BINARY_ATOM_NETLIST_ITEMS_PER_CHUNK; decoder.ok() && ipin < end; ++ipin) {
+                size_t iport = decoder.read_uint();
+                BitIndex port_bit = decoder.read_uint();
+                size_t inet = decoder.read_uint();
+                PinType pin_type = decoder.read_uint() ? PinType::DRIVER : PinType::SINK;
+                bool is_const = decoder.read_uint();
+                if (iport >= ports.size() || inet >= nets.size()) {
+                    corrupt(ichunk);
+                }
+                netlist.create_pin(ports[iport], port_bit, nets[inet], pin_type, is_const);
+            }
+        }
+
+        if (!decoder.ok() || !decoder.at_end()) {
+            corrupt(ichunk);
+        }
+    }
+
+    if (nets.size() != num_nets || blocks.size() != num_blocks || ports.size() != num_ports) {
+        vpr_throw(VPR_ERROR_ATOM_NETLIST, filename, 0, "Binary atom netlist file is truncated");
+    }
+
+    return netlist;
+}
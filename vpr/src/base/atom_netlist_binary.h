@@ -0,0 +1,29 @@
+#ifndef ATOM_NETLIST_BINARY_H
+#define ATOM_NETLIST_BINARY_H
+
+/**
+ * @file
+ * @brief Compact binary atom netlist files (.bin), see binary_file_io.h
+ *
+ * A binary atom netlist holds a netlist exactly as it was read (or built by a synthesis
+ * tool), before VPR cleans it up: its name and ID, and its blocks, ports, pins and nets
+ * in ID order, so reading it back gives the same IDs (and so the same results) as the
+ * original netlist. Models and model ports are stored by name, and looked up in the
+ * architecture's models when the file is read.
+ *
+ * The netlist ID is kept, so packings made from the original circuit file can be loaded
+ * with the binary netlist (and the other way round).
+ */
+
+#include "atom_netlist_fwd.h"
+#include "logic_types.h"
+
+///@brief Writes netlist to the binary atom netlist file filename
+void write_atom_netlist_binary(const AtomNetlist& netlist, const char* filename);
+
+///@brief Reads a netlist written by write_atom_netlist_binary(), using the given architecture models
+AtomNetlist read_atom_netlist_binary(const char* filename,
+                                     const t_model* user_models,
+                                     const t_model* library_models);
+
+#endif /* ATOM_NETLIST_BINARY_H */
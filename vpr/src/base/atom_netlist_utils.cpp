@@ -22,6 +22,7 @@ int infer_and_mark_constant_pins(AtomNetlist& netlist, e_const_gen_inference con
 
 ///@brief Marks all primtive output pins which have no combinationally connected inputs as constant pins
 int mark_undriven_primitive_outputs_as_constant(AtomNetlist& netlist, int verbosity);
+int mark_undriven_block_outputs_as_constant(AtomNetlist& netlist, AtomBlockId blk, int verbosity);
 
 ///@brief Marks all primtive output pins of blk which have only constant inputs as constant pins
 int infer_and_mark_block_pins_constant(AtomNetlist& netlist, AtomBlockId blk, e_const_gen_inference const_gen_inference_method, int verbosity);
@@ -38,6 +39,7 @@ bool is_buffer_lut(const AtomNetlist& netlist, const AtomBlockId blk);
 bool is_removable_block(const AtomNetlist& netlist, const AtomBlockId blk, std::string* reason = nullptr);
 bool is_removable_input(const AtomNetlist& netlist, const AtomBlockId blk, std::string* reason = nullptr);
 bool is_removable_output(const AtomNetlist& netlist, const AtomBlockId blk, std::string* reason = nullptr);
+bool is_constant_output(const AtomNetlist& netlist, const AtomBlockId blk);
 
 /**
  * @brief   Attempts to remove the specified buffer LUT blk from the netlist.
@@ -443,45 +445,52 @@ int mark_undriven_primitive_outputs_as_constant(AtomNetlist& netlist, int verbos
     for (AtomBlockId blk : netlist.blocks()) {
         if (!blk) continue;
 
-        //Don't mark primary I/Os as constants
-        if (netlist.block_type(blk) != AtomBlockType::BLOCK) continue;
+        num_pins_marked_constant += mark_undriven_block_outputs_as_constant(netlist, blk, verbosity);
+    }
 
-        for (AtomPortId output_port : netlist.block_output_ports(blk)) {
-            const t_model_ports* model_port = netlist.port_model(output_port);
+    return num_pins_marked_constant;
+}
 
-            //Don't mark sequential or clock generator ports as constants
-            if (!model_port->clock.empty() || model_port->is_clock) continue;
+int mark_undriven_block_outputs_as_constant(AtomNetlist& netlist, AtomBlockId blk, int verbosity) {
+    //Don't mark primary I/Os as constants
+    if (netlist.block_type(blk) != AtomBlockType::BLOCK) return 0;
 
-            //Find the upstream combinationally connected ports
-            std::vector<AtomPortId> upstream_ports = find_combinationally_connected_input_ports(netlist, output_port);
+    int num_pins_marked_constant = 0;
+    for (AtomPortId output_port : netlist.block_output_ports(blk)) {
+        const t_model_ports* model_port = netlist.port_model(output_port);
 
-            //Check if any of the 'upstream' input pins have connected nets
-            //
-            //Note that we only check to see whether they are *connected* not whether they are non-constant.
-            //Inference of pins as constant generators from upstream *constant nets* is handled elsewhere.
-            bool has_connected_inputs = false;
-            for (AtomPortId input_port : upstream_ports) {
-                for (AtomPinId input_pin : netlist.port_pins(input_port)) {
-                    AtomNetId input_net = netlist.pin_net(input_pin);
-
-                    if (input_net) {
-                        has_connected_inputs = true;
-                        break;
-                    }
+        //Don't mark sequential or clock generator ports as constants
+        if (!model_port->clock.empty() || model_port->is_clock) continue;
+
+        //Find the upstream combinationally connected ports
+        std::vector<AtomPortId> upstream_ports = find_combinationally_connected_input_ports(netlist, output_port);
+
+        //Check if any of the 'upstream' input pins have connected nets
+        //
+        //Note that we only check to see whether they are *connected* not whether they are non-constant.
+        //Inference of pins as constant generators from upstream *constant nets* is handled elsewhere.
+        bool has_connected_inputs = false;
+        for (AtomPortId input_port : upstream_ports) {
+            for (AtomPinId input_pin : netlist.port_pins(input_port)) {
+                AtomNetId input_net = netlist.pin_net(input_pin);
+
+                if (input_net) {
+                    has_connected_inputs = true;
+                    break;
                 }
             }
+        }
 
-            if (!has_connected_inputs) {
-                //The current output port has no inputs driving the primitive's internal
-                //timing edges. Therefore we treat all its pins as constant generators.
-                for (AtomPinId output_pin : netlist.port_pins(output_port)) {
-                    if (netlist.pin_is_constant(output_pin)) continue;
+        if (!has_connected_inputs) {
+            //The current output port has no inputs driving the primitive's internal
+            //timing edges. Therefore we treat all its pins as constant generators.
+            for (AtomPinId output_pin : netlist.port_pins(output_port)) {
+                if (netlist.pin_is_constant(output_pin)) continue;
 
-                    VTR_LOGV(verbosity > 1, "Marking pin '%s' as constant since it has no combinationally connected inputs\n",
-                             netlist.pin_name(output_pin).c_str());
-                    netlist.set_pin_is_constant(output_pin, true);
-                    ++num_pins_marked_constant;
-                }
+                VTR_LOGV(verbosity > 1, "Marking pin '%s' as constant since it has no combinationally connected inputs\n",
+                         netlist.pin_name(output_pin).c_str());
+                netlist.set_pin_is_constant(output_pin, true);
+                ++num_pins_marked_constant;
             }
         }
     }
@@ -746,8 +755,9 @@ bool is_buffer_lut(const AtomNetlist& netlist, const AtomBlockId blk) {
                 //
                 const auto& truth_table = netlist.block_truth_table(blk);
 
-                VTR_ASSERT_MSG(truth_table.size() == 1, "One truth-table row");
-                VTR_ASSERT_MSG(truth_table[0].size() == 2, "Two truth-table row entries");
+                for (const auto& row : truth_table) {
+                    if (row.size() != 2) return false; //Not a single-input truth table
+                }
 
                 //Check for valid buffer logic functions
                 // A LUT is a buffer provided it has the identity logic
@@ -761,9 +771,11 @@ bool is_buffer_lut(const AtomNetlist& netlist, const AtomBlockId blk) {
                 // .names int_buf out_buf
                 // 0 0
                 //
-                // both implement logical identity.
-                if ((truth_table[0][0] == vtr::LogicValue::TRUE && truth_table[0][1] == vtr::LogicValue::TRUE)
-                    || (truth_table[0][0] == vtr::LogicValue::FALSE && truth_table[0][1] == vtr::LogicValue::FALSE)) {
+                // both implement logical identity (as does any other
+                // cover of it, which comparing the packed functions catches).
+                vtr::PackedTruthTable identity(1);
+                identity.set(1, true);
+                if (pack_truth_table(truth_table, 1) == identity) {
                     //It is a buffer LUT
                     return true;
                 }
@@ -960,31 +972,32 @@ bool is_removable_output(const AtomNetlist& netlist, const AtomBlockId blk_id, s
     return true;
 }
 
+bool is_constant_output(const AtomNetlist& netlist, const AtomBlockId blk_id) {
+    if (netlist.block_type(blk_id) != AtomBlockType::OUTPAD) return false;
+
+    VTR_ASSERT(netlist.block_output_pins(blk_id).size() == 0);
+    VTR_ASSERT(netlist.block_clock_pins(blk_id).size() == 0);
+
+    for (AtomPinId pin_id : netlist.block_input_pins(blk_id)) {
+        AtomNetId net_id = netlist.pin_net(pin_id);
+
+        if (net_id && !netlist.net_is_constant(net_id)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 size_t sweep_constant_primary_outputs(AtomNetlist& netlist, int verbosity) {
     size_t removed_count = 0;
     for (AtomBlockId blk_id : netlist.blocks()) {
         if (!blk_id) continue;
 
-        if (netlist.block_type(blk_id) == AtomBlockType::OUTPAD) {
-            VTR_ASSERT(netlist.block_output_pins(blk_id).size() == 0);
-            VTR_ASSERT(netlist.block_clock_pins(blk_id).size() == 0);
-
-            bool all_inputs_are_const = true;
-            for (AtomPinId pin_id : netlist.block_input_pins(blk_id)) {
-                AtomNetId net_id = netlist.pin_net(pin_id);
-
-                if (net_id && !netlist.net_is_constant(net_id)) {
-                    all_inputs_are_const = false;
-                    break;
-                }
-            }
-
-            if (all_inputs_are_const) {
-                //All inputs are constant, so we should remove this output
-                VTR_LOGV_WARN(verbosity > 2, "Sweeping constant primary output '%s'\n", netlist.block_name(blk_id).c_str());
-                netlist.remove_block(blk_id);
-                removed_count++;
-            }
+        if (is_constant_output(netlist, blk_id)) {
+            //All inputs are constant, so we should remove this output
+            VTR_LOGV_WARN(verbosity > 2, "Sweeping constant primary output '%s'\n", netlist.block_name(blk_id).c_str());
+            netlist.remove_block(blk_id);
+            removed_count++;
         }
     }
     return removed_count;
@@ -1004,55 +1017,120 @@ size_t sweep_iterative(AtomNetlist& netlist,
     size_t constant_outputs_swept = 0;
     size_t constant_generators_marked = 0;
 
-    //We perform multiple passes of sweeping, since sweeping something may
-    //enable more things to be swept afterward.
-    //
-    //We keep sweeping until nothing else is removed
-    size_t pass_dangling_nets_swept;
-    size_t pass_dangling_blocks_swept;
-    size_t pass_dangling_inputs_swept;
-    size_t pass_dangling_outputs_swept;
-    size_t pass_constant_outputs_swept;
-    size_t pass_constant_generators_marked;
-    do {
-        pass_dangling_nets_swept = 0;
-        pass_dangling_blocks_swept = 0;
-        pass_dangling_inputs_swept = 0;
-        pass_dangling_outputs_swept = 0;
-        pass_constant_outputs_swept = 0;
-        pass_constant_generators_marked = 0;
-
-        if (should_sweep_ios) {
-            pass_dangling_inputs_swept += sweep_inputs(netlist, verbosity);
-            pass_dangling_outputs_swept += sweep_outputs(netlist, verbosity);
-        }
+    //Sweeping something may enable more things to be swept afterward (e.g. the driver of a net
+    //which lost its last sink), and so may marking constant generators (e.g. the sinks of a net
+    //which became constant). Rather than re-sweeping the whole netlist until nothing changes, every
+    //block and net is checked once, and afterwards only the neighbours of what was removed (or
+    //marked constant) are re-checked.
+    std::vector<AtomBlockId> block_worklist;
+    std::vector<AtomNetId> net_worklist;
+    std::vector<bool> block_queued(netlist.blocks().size(), false);
+    std::vector<bool> net_queued(netlist.nets().size(), false);
+
+    auto queue_block = [&](AtomBlockId blk_id) {
+        if (!blk_id || block_queued[size_t(blk_id)]) return;
+        block_queued[size_t(blk_id)] = true;
+        block_worklist.push_back(blk_id);
+    };
+    auto queue_net = [&](AtomNetId net_id) {
+        if (!net_id || net_queued[size_t(net_id)]) return;
+        net_queued[size_t(net_id)] = true;
+        net_worklist.push_back(net_id);
+    };
+
+    for (AtomBlockId blk_id : netlist.blocks()) {
+        queue_block(blk_id);
+    }
+    for (AtomNetId net_id : netlist.nets()) {
+        queue_net(net_id);
+    }
+    //Worklists are processed from the back, so they are first checked in netlist order
+    std::reverse(block_worklist.begin(), block_worklist.end());
+    std::reverse(net_worklist.begin(), net_worklist.end());
+
+    while (!net_worklist.empty() || !block_worklist.empty()) {
+        //Nets first, since removing them is what usually makes blocks removable
+        if (!net_worklist.empty()) {
+            AtomNetId net_id = net_worklist.back();
+            net_worklist.pop_back();
+            net_queued[size_t(net_id)] = false;
+
+            if (!should_sweep_nets || !netlist.valid_net_id(net_id)) continue;
 
-        if (should_sweep_blocks) {
-            pass_dangling_blocks_swept += sweep_blocks(netlist, verbosity);
+            bool has_driver = bool(netlist.net_driver(net_id));
+            bool has_sinks = netlist.net_sinks(net_id).size() != 0;
+            if (has_driver && has_sinks) continue;
+
+            VTR_LOGV_WARN(verbosity > 1 && !has_driver, "Net '%s' has no driver and will be removed\n", netlist.net_name(net_id).c_str());
+            VTR_LOGV_WARN(verbosity > 1 && !has_sinks, "Net '%s' has no sinks and will be removed\n", netlist.net_name(net_id).c_str());
+
+            //The blocks still connected to the net may become removable once it is gone
+            for (AtomPinId pin_id : netlist.net_pins(net_id)) {
+                if (pin_id) queue_block(netlist.pin_block(pin_id));
+            }
+            netlist.remove_net(net_id);
+            ++dangling_nets_swept;
+            continue;
         }
 
-        if (should_sweep_nets) {
-            pass_dangling_nets_swept += sweep_nets(netlist, verbosity);
+        AtomBlockId blk_id = block_worklist.back();
+        block_worklist.pop_back();
+        block_queued[size_t(blk_id)] = false;
+
+        if (!netlist.valid_block_id(blk_id)) continue;
+
+        std::string reason;
+        size_t* swept_count = nullptr;
+        switch (netlist.block_type(blk_id)) {
+            case AtomBlockType::INPAD:
+                if (should_sweep_ios && is_removable_input(netlist, blk_id, &reason)) {
+                    VTR_LOGV_WARN(verbosity > 1, "Primary input '%s' will be swept (%s)\n", netlist.block_name(blk_id).c_str(), reason.c_str());
+                    swept_count = &dangling_inputs_swept;
+                }
+                break;
+            case AtomBlockType::OUTPAD:
+                if (should_sweep_ios && is_removable_output(netlist, blk_id, &reason)) {
+                    VTR_LOGV_WARN(verbosity > 1, "Primary output '%s' will be swept (%s)\n", netlist.block_name(blk_id).c_str(), reason.c_str());
+                    swept_count = &dangling_outputs_swept;
+                } else if (should_sweep_constant_primary_outputs && is_constant_output(netlist, blk_id)) {
+                    VTR_LOGV_WARN(verbosity > 2, "Sweeping constant primary output '%s'\n", netlist.block_name(blk_id).c_str());
+                    swept_count = &constant_outputs_swept;
+                }
+                break;
+            default:
+                if (should_sweep_blocks && is_removable_block(netlist, blk_id, &reason)) {
+                    VTR_LOGV_WARN(verbosity > 1, "Block '%s' will be swept (%s)\n", netlist.block_name(blk_id).c_str(), reason.c_str());
+                    swept_count = &dangling_blocks_swept;
+                }
+                break;
         }
 
-        if (should_sweep_constant_primary_outputs) {
-            pass_constant_outputs_swept += sweep_constant_primary_outputs(netlist, verbosity);
+        if (swept_count) {
+            //The nets of the block lose a driver or a sink, so may become removable
+            for (AtomPinId pin_id : netlist.block_pins(blk_id)) {
+                if (pin_id) queue_net(netlist.pin_net(pin_id));
+            }
+            netlist.remove_block(blk_id);
+            ++*swept_count;
+            continue;
         }
 
-        pass_constant_generators_marked += mark_constant_generators(netlist, const_gen_inference_method, verbosity);
-
-        dangling_nets_swept += pass_dangling_nets_swept;
-        dangling_blocks_swept += pass_dangling_blocks_swept;
-        dangling_inputs_swept += pass_dangling_inputs_swept;
-        dangling_outputs_swept += pass_dangling_outputs_swept;
-        constant_outputs_swept += pass_constant_outputs_swept;
-        constant_generators_marked += pass_constant_generators_marked;
-    } while (pass_dangling_nets_swept != 0
-             || pass_dangling_blocks_swept != 0
-             || pass_dangling_inputs_swept != 0
-             || pass_dangling_outputs_swept != 0
-             || pass_constant_outputs_swept != 0
-             || pass_constant_generators_marked != 0);
+        //The block stays, but its outputs may have become constant
+        int num_marked = mark_undriven_block_outputs_as_constant(netlist, blk_id, verbosity)
+                         + infer_and_mark_block_pins_constant(netlist, blk_id, const_gen_inference_method, verbosity);
+        if (num_marked > 0) {
+            constant_generators_marked += num_marked;
+
+            //Which may in turn make the blocks they drive constant (or constant primary outputs)
+            for (AtomPinId pin_id : netlist.block_output_pins(blk_id)) {
+                AtomNetId net_id = netlist.pin_net(pin_id);
+                if (!net_id) continue;
+                for (AtomPinId sink_pin_id : netlist.net_sinks(net_id)) {
+                    if (sink_pin_id) queue_block(netlist.pin_block(sink_pin_id));
+                }
+            }
+        }
+    }
 
     VTR_LOGV(verbosity > 0, "Swept input(s)      : %zu\n", dangling_inputs_swept);
     VTR_LOGV(verbosity > 0, "Swept output(s)     : %zu (%zu dangling, %zu constant)\n",
@@ -1247,40 +1325,26 @@ AtomNetlist::TruthTable expand_truth_table(const AtomNetlist::TruthTable& truth_
 }
 
 std::vector<vtr::LogicValue> truth_table_to_lut_mask(const AtomNetlist::TruthTable& truth_table, const size_t num_inputs) {
+    for (const auto& row : truth_table) {
+        VTR_ASSERT(row.size() - 1 == num_inputs);
+    }
+    return pack_truth_table(truth_table, num_inputs).to_lut_mask();
+}
+
+vtr::PackedTruthTable pack_truth_table(const AtomNetlist::TruthTable& truth_table, const size_t num_inputs) {
     bool on_set = truth_table_encodes_on_set(truth_table);
 
-    //Initialize the lut mask
-    size_t mask_bits = std::pow(2, num_inputs);
-    std::vector<vtr::LogicValue> mask;
-    if (on_set) {
-        //If we are encoding the on-set the background value is false
-        mask = std::vector<vtr::LogicValue>(mask_bits, vtr::LogicValue::FALSE);
-    } else {
-        //If we are encoding the off-set the background value is true
-        mask = std::vector<vtr::LogicValue>(mask_bits, vtr::LogicValue::TRUE);
-    }
+    //If we are encoding the on-set the background value is false,
+    //if we are encoding the off-set the background value is true
+    vtr::PackedTruthTable packed(num_inputs, !on_set);
 
     for (const auto& row : truth_table) {
         //Each row in the truth table (excluding the output) is a cube,
-        //and may need to be expanded to account for don't cares
-
-        std::vector<vtr::LogicValue> cube(row.begin(), --row.end());
-        VTR_ASSERT(cube.size() == num_inputs);
-
-        std::vector<size_t> minterms;
-
-        for (auto minterm : cube_to_minterms(cube)) {
-            //Mark the minterms in the mask
-
-            VTR_ASSERT(minterm < mask.size());
-            if (on_set) {
-                mask[minterm] = vtr::LogicValue::TRUE;
-            } else {
-                mask[minterm] = vtr::LogicValue::FALSE;
-            }
-        }
+        //don't cares are expanded a whole word at a time
+        VTR_ASSERT(row.size() - 1 <= num_inputs);
+        packed.set_cube(row.data(), row.size() - 1, on_set);
     }
-    return mask;
+    return packed;
 }
 
 std::vector<size_t> cube_to_minterms(std::vector<vtr::LogicValue> cube) {
@@ -3,6 +3,7 @@
 #include <cstdio>
 #include <set>
 #include "atom_netlist.h"
+#include "vtr_packed_truth_table.h"
 
 /**
  * @file
@@ -25,9 +26,13 @@ void absorb_buffer_luts(AtomNetlist& netlist, int verbosity);
  */
 
 /**
- * @brief Repeatedly sweeps the netlist removing blocks and nets
+ * @brief Sweeps the netlist removing blocks and nets
  *        until nothing more can be swept. If sweep_ios is true also sweeps
  *        primary-inputs and primary-outputs
+ *
+ * Uses worklists of the blocks and nets which may have become sweepable
+ * (the neighbours of those removed or marked constant), so each removal
+ * only re-checks its neighbourhood rather than the whole netlist.
  */
 size_t sweep_iterative(AtomNetlist& netlist,
                        bool should_sweep_dangling_ios,
@@ -87,6 +92,18 @@ AtomNetlist::TruthTable permute_truth_table(const AtomNetlist::TruthTable& truth
 ///@brief Convers a truth table to a lut mask (sequence of binary values representing minterms)
 std::vector<vtr::LogicValue> truth_table_to_lut_mask(const AtomNetlist::TruthTable& truth_table, const size_t num_inputs);
 
+/**
+ * @brief Converts a truth table to a packed truth table with num_inputs inputs
+ *
+ * The inputs past those of the truth table are FALSE in all its cubes, as with expand_truth_table(),
+ * so the packed truth table can be permuted or read as a LUT mask directly (without building the
+ * expanded or permuted cube lists).
+ *
+ *   @param truth_table   The truth table to pack
+ *   @param num_inputs    The number of inputs to use (at least those of the truth table)
+ */
+vtr::PackedTruthTable pack_truth_table(const AtomNetlist::TruthTable& truth_table, const size_t num_inputs);
+
 /**
  * @brief Convers a logic cube (potnetially including don't cares) into
  *        a sequence of minterm numbers
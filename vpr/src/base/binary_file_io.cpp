@@ -0,0 +1,226 @@
+#include "binary_file_io.h"
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <type_traits>
+
+#ifdef VTR_ENABLE_ZLIB
+#    include <zlib.h>
+#endif
+
+#include "vtr_digest.h"
+#include "vtr_path.h"
+
+#include "output_file_writer.h"
+
+/* Layout of a binary file:
+ *   - magic (8 chars), version (uint32), header size (uint64), header
+ *   - number of blocks (uint64), then the uncompressed and stored size (uint64s) of each block
+ *   - the blocks' data
+ * A block is compressed if it is stored in fewer bytes than its uncompressed size. */
+
+template<typename T>
+static void append_pod(std::string& out, const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written directly");
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+static bool read_pod(const std::string& in, size_t& pos, T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read directly");
+    if (in.size() - pos < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, in.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+
+void BinaryEncoder::write_uint(uint64_t value) {
+    while (value >= 0x80) {
+        data_.push_back(char(value | 0x80));
+        value >>= 7;
+    }
+    data_.push_back(char(value));
+}
+
+void BinaryEncoder::write_int(int64_t value) {
+    write_uint((uint64_t(value) << 1) ^ uint64_t(value >> 63));
+}
+
+void BinaryEncoder::write_string(const std::string& str) {
+    write_uint(str.size());
+    data_.append(str);
+}
+
+uint64_t BinaryDecoder::read_uint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (pos_ == end_) {
+            ok_ = false;
+            return 0;
+        }
+        uint8_t byte = uint8_t(*pos_++);
+        value |= uint64_t(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+    ok_ = false; //Over-long encoding
+    return 0;
+}
+
+int64_t BinaryDecoder::read_int() {
+    uint64_t value = read_uint();
+    return int64_t(value >> 1) ^ -int64_t(value & 1);
+}
+
+std::string BinaryDecoder::read_string() {
+    uint64_t size = read_uint();
+    if (size > uint64_t(end_ - pos_)) {
+        ok_ = false;
+        return std::string();
+    }
+    std::string str(pos_, size);
+    pos_ += size;
+    return str;
+}
+
+bool is_binary_file_name(const std::string& filename) {
+    return vtr::split_ext(filename)[1] == ".bin";
+}
+
+std::string write_binary_file(const char* filename,
+                              const char* magic,
+                              uint32_t version,
+                              const std::string& header,
+                              std::vector<std::string>& blocks,
+                              e_vpr_error error_type) {
+    std::vector<uint64_t> raw_sizes(blocks.size());
+    for (size_t iblock = 0; iblock < blocks.size(); ++iblock) {
+        raw_sizes[iblock] = blocks[iblock].size();
+    }
+
+#ifdef VTR_ENABLE_ZLIB
+    //Compression dominates the cost of writing, so favour speed over size
+    for_each_binary_block(blocks.size(), [&](size_t iblock) {
+        std::string& block = blocks[iblock];
+        uLongf compressed_size = compressBound(block.size());
+        std::string compressed(compressed_size, '\0');
+        int status = compress2(reinterpret_cast<Bytef*>(&compressed[0]), &compressed_size,
+                               reinterpret_cast<const Bytef*>(block.data()), block.size(), Z_BEST_SPEED);
+        if (status == Z_OK && compressed_size < block.size()) {
+            compressed.resize(compressed_size);
+            block = std::move(compressed);
+        }
+    });
+#endif
+
+    std::string contents;
+    contents.append(magic, 8);
+    append_pod<uint32_t>(contents, version);
+    append_pod<uint64_t>(contents, header.size());
+    contents.append(header);
+    append_pod<uint64_t>(contents, blocks.size());
+    for (size_t iblock = 0; iblock < blocks.size(); ++iblock) {
+        append_pod<uint64_t>(contents, raw_sizes[iblock]);
+        append_pod<uint64_t>(contents, blocks[iblock].size());
+    }
+    for (std::string& block : blocks) {
+        contents.append(block);
+        std::string().swap(block); //Release each block once it is copied
+    }
+
+    std::istringstream contents_stream(contents);
+    std::string digest = vtr::secure_digest_stream(contents_stream);
+
+    write_output_file(filename, std::move(contents), error_type);
+
+    return digest;
+}
+
+void read_binary_file(const char* filename,
+                      const char* magic,
+                      uint32_t version,
+                      std::string& header,
+                      std::vector<std::string>& blocks,
+                      e_vpr_error error_type) {
+    FILE* fp = std::fopen(filename, "rb");
+    if (!fp) {
+        vpr_throw(error_type, filename, 0, "Cannot open '%s'", filename);
+    }
+
+    std::string contents;
+    char buf[64 * 1024];
+    size_t num_read;
+    while ((num_read = std::fread(buf, 1, sizeof(buf), fp)) > 0) {
+        contents.append(buf, num_read);
+    }
+    std::fclose(fp);
+
+    size_t pos = 0;
+    uint32_t file_version = 0;
+    if (contents.size() < 8 || std::memcmp(contents.data(), magic, 8) != 0) {
+        vpr_throw(error_type, filename, 0, "'%s' is not a %.8s file", filename, magic);
+    }
+    pos += 8;
+    if (!read_pod(contents, pos, file_version) || file_version != version) {
+        vpr_throw(error_type, filename, 0, "'%s' has unsupported version %u (expected %u)", filename, file_version, version);
+    }
+
+    uint64_t header_size = 0;
+    uint64_t num_blocks = 0;
+    bool ok = read_pod(contents, pos, header_size) && header_size <= contents.size() - pos;
+    if (ok) {
+        header = contents.substr(pos, header_size);
+        pos += header_size;
+        ok = read_pod(contents, pos, num_blocks) && num_blocks <= (contents.size() - pos) / (2 * sizeof(uint64_t));
+    }
+
+    //Locate each block's data
+    std::vector<uint64_t> raw_sizes(ok ? num_blocks : 0);
+    std::vector<uint64_t> stored_sizes(ok ? num_blocks : 0);
+    for (size_t iblock = 0; ok && iblock < num_blocks; ++iblock) {
+        ok = read_pod(contents, pos, raw_sizes[iblock]) && read_pod(contents, pos, stored_sizes[iblock]);
+    }
+    std::vector<size_t> offsets(raw_sizes.size());
+    for (size_t iblock = 0; ok && iblock < num_blocks; ++iblock) {
+        offsets[iblock] = pos;
+        ok = stored_sizes[iblock] <= contents.size() - pos && stored_sizes[iblock] <= raw_sizes[iblock];
+        pos += stored_sizes[iblock];
+    }
+    if (!ok) {
+        vpr_throw(error_type, filename, 0, "'%s' is truncated or corrupt", filename);
+    }
+
+    blocks.clear();
+    blocks.resize(num_blocks);
+    std::vector<char> block_ok(num_blocks, true);
+    for_each_binary_block(num_blocks, [&](size_t iblock) {
+        const char* stored = contents.data() + offsets[iblock];
+        if (stored_sizes[iblock] == raw_sizes[iblock]) {
+            blocks[iblock].assign(stored, stored_sizes[iblock]);
+            return;
+        }
+#ifdef VTR_ENABLE_ZLIB
+        blocks[iblock].resize(raw_sizes[iblock]);
+        uLongf raw_size = raw_sizes[iblock];
+        int status = uncompress(reinterpret_cast<Bytef*>(&blocks[iblock][0]), &raw_size,
+                                reinterpret_cast<const Bytef*>(stored), stored_sizes[iblock]);
+        block_ok[iblock] = (status == Z_OK && raw_size == raw_sizes[iblock]);
+#else
+        block_ok[iblock] = false;
+#endif
+    });
+
+    for (size_t iblock = 0; iblock < num_blocks; ++iblock) {
+        if (!block_ok[iblock]) {
+#ifdef VTR_ENABLE_ZLIB
+            vpr_throw(error_type, filename, 0, "'%s' is corrupt (block %zu failed to decompress)", filename, iblock);
+#else
+            vpr_throw(error_type, filename, 0, "'%s' is compressed, but VPR was built without zlib", filename);
+#endif
+        }
+    }
+}
@@ -0,0 +1,118 @@
+#ifndef BINARY_FILE_IO_H
+#define BINARY_FILE_IO_H
+
+/**
+ * @file
+ * @brief Helpers shared by VPR's compact binary file formats (.place.bin and .route.bin)
+ *
+ * A binary file holds an identifying magic string and version, a header, and a sequence of
+ * independently encoded blocks. Blocks are zlib compressed (when VPR is built with zlib) and
+ * can be encoded and decoded in parallel. Integers are stored as variable length (LEB128)
+ * integers, so small values (e.g. the difference between consecutive RR node ids) take a
+ * single byte.
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
+#include "vpr_error.h"
+
+///@brief Appends variable length encoded values to a byte buffer
+class BinaryEncoder {
+  public:
+    void write_uint(uint64_t value);
+
+    ///@brief Writes a signed value (zig-zag encoded, so small negative values are also short)
+    void write_int(int64_t value);
+
+    void write_string(const std::string& str);
+
+    std::string& data() { return data_; }
+
+  private:
+    std::string data_;
+};
+
+/**
+ * @brief Reads the values written by a BinaryEncoder
+ *
+ * Reading past the end of the data returns zero values and clears ok(), so
+ * callers only need to check for truncation once they are done.
+ */
+class BinaryDecoder {
+  public:
+    explicit BinaryDecoder(const std::string& data)
+        : pos_(data.data())
+        , end_(data.data() + data.size()) {}
+
+    uint64_t read_uint();
+    int64_t read_int();
+    std::string read_string();
+
+    ///@brief Returns true if all the data has been read
+    bool at_end() const { return pos_ == end_; }
+
+    ///@brief Returns false if a read went past the end of the data
+    bool ok() const { return ok_; }
+
+  private:
+    const char* pos_;
+    const char* end_;
+    bool ok_ = true;
+};
+
+///@brief Returns true if filename names a binary file (i.e. ends in .bin), rather than a text file
+bool is_binary_file_name(const std::string& filename);
+
+/**
+ * @brief Writes a binary file
+ *
+ *   @param filename   The file to write
+ *   @param magic      The 8 character string identifying the kind of file
+ *   @param version    The version of the file's layout
+ *   @param header     The encoded header
+ *   @param blocks     The encoded blocks (released once the file's contents are assembled)
+ *   @param error_type The type of error reported if the file cannot be written
+ *
+ * The file is written with write_output_file(), so may be written in the background.
+ *
+ * @return The secure digest of the file's contents (i.e. vtr::secure_digest_file() of the written file)
+ */
+std::string write_binary_file(const char* filename,
+                              const char* magic,
+                              uint32_t version,
+                              const std::string& header,
+                              std::vector<std::string>& blocks,
+                              e_vpr_error error_type);
+
+/**
+ * @brief Reads a file written by write_binary_file(), decompressing its blocks
+ *
+ * An error of error_type is thrown if the file cannot be read, or if it does
+ * not have the expected magic string and version.
+ */
+void read_binary_file(const char* filename,
+                      const char* magic,
+                      uint32_t version,
+                      std::string& header,
+                      std::vector<std::string>& blocks,
+                      e_vpr_error error_type);
+
+///@brief Calls fn(iblock) for each block in [0, num_blocks), in parallel when built with TBB
+template<typename F>
+void for_each_binary_block(size_t num_blocks, const F& fn) {
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), num_blocks, [&](size_t iblock) { fn(iblock); });
+#else
+    for (size_t iblock = 0; iblock < num_blocks; ++iblock) {
+        fn(iblock);
+    }
+#endif
+}
+
+#endif /* BINARY_FILE_IO_H */
@@ -265,6 +265,18 @@ void ClusteredNetlist::shrink_to_fit_impl() {
     //Net data
 }
 
+size_t ClusteredNetlist::memory_usage_impl() const {
+    size_t bytes = vtr::memory_usage(block_pbs_)
+                   + vtr::memory_usage(block_types_)
+                   + vtr::memory_usage(block_logical_pins_)
+                   + vtr::memory_usage(blocks_per_type_)
+                   + vtr::memory_usage(pin_logical_index_);
+    for (const auto& type_blocks : blocks_per_type_) {
+        bytes += vtr::memory_usage(type_blocks.second);
+    }
+    return bytes;
+}
+
 /*
  *
  * Sanity Checks
@@ -0,0 +1,175 @@
+#include "device_snapshot.h"
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+
+#include "vtr_digest.h"
+#include "vtr_log.h"
+#include "vtr_util.h"
+
+#include "vpr_error.h"
+
+/* Bump the version whenever the contents of a snapshot change */
+static constexpr int DEVICE_SNAPSHOT_VERSION = 1;
+
+static constexpr const char* DEVICE_SNAPSHOT_MANIFEST = "manifest.txt";
+static constexpr const char* DEVICE_SNAPSHOT_RR_GRAPH = "rr_graph.rrnative";
+static constexpr const char* DEVICE_SNAPSHOT_ROUTER_LOOKAHEAD = "router_lookahead.capnp";
+static constexpr const char* DEVICE_SNAPSHOT_PLACE_DELAY_MODEL = "place_delay_model.capnp";
+static constexpr const char* DEVICE_SNAPSHOT_LB_TYPE_RR_GRAPH = "lb_type_rr_graph.capnp";
+
+static std::map<std::string, std::string> device_snapshot_key(const t_options& args);
+static void write_device_snapshot_manifest(const std::string& snapshot_dir, const t_options& args);
+static void check_device_snapshot_manifest(const std::string& snapshot_dir, t_options& args);
+static std::string snapshot_file(const std::string& snapshot_dir, const char* name);
+
+void set_device_snapshot_options(t_options& args) {
+    using argparse::Provenance;
+
+    bool write_snapshot = args.write_device_snapshot.provenance() == Provenance::SPECIFIED;
+    bool read_snapshot = args.read_device_snapshot.provenance() == Provenance::SPECIFIED;
+    if (!write_snapshot && !read_snapshot) {
+        return;
+    }
+
+    if (write_snapshot && read_snapshot) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Only one of %s and %s may be specified\n",
+                        args.write_device_snapshot.argument_name().c_str(),
+                        args.read_device_snapshot.argument_name().c_str());
+    }
+
+    if (write_snapshot) {
+        //The RR graph (and everything built from it) depends on the channel width,
+        //so a snapshot is only meaningful for a fixed channel width
+        if (args.RouteChanWidth.provenance() != Provenance::SPECIFIED) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER, "--route_chan_width must be specified with %s\n",
+                            args.write_device_snapshot.argument_name().c_str());
+        }
+
+        std::string snapshot_dir = args.write_device_snapshot;
+        std::error_code ec;
+        std::filesystem::create_directories(snapshot_dir, ec);
+        if (ec) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to create device snapshot directory '%s': %s\n",
+                            snapshot_dir.c_str(), ec.message().c_str());
+        }
+
+        write_device_snapshot_manifest(snapshot_dir, args);
+
+        if (args.write_rr_graph_file.provenance() != Provenance::SPECIFIED) {
+            args.write_rr_graph_file.set(snapshot_file(snapshot_dir, DEVICE_SNAPSHOT_RR_GRAPH), Provenance::INFERRED);
+        }
+        if (args.write_router_lookahead.provenance() != Provenance::SPECIFIED) {
+            args.write_router_lookahead.set(snapshot_file(snapshot_dir, DEVICE_SNAPSHOT_ROUTER_LOOKAHEAD), Provenance::INFERRED);
+        }
+        if (args.write_placement_delay_lookup.provenance() != Provenance::SPECIFIED) {
+            args.write_placement_delay_lookup.set(snapshot_file(snapshot_dir, DEVICE_SNAPSHOT_PLACE_DELAY_MODEL), Provenance::INFERRED);
+        }
+        if (args.lb_type_rr_graph_cache.provenance() != Provenance::SPECIFIED) {
+            args.lb_type_rr_graph_cache.set(snapshot_file(snapshot_dir, DEVICE_SNAPSHOT_LB_TYPE_RR_GRAPH), Provenance::INFERRED);
+        }
+
+        VTR_LOG("Writing device snapshot to '%s'\n", snapshot_dir.c_str());
+    } else {
+        std::string snapshot_dir = args.read_device_snapshot;
+
+        check_device_snapshot_manifest(snapshot_dir, args);
+
+        //Parts of the device which were not built when the snapshot was written
+        //(e.g. no lookahead for the classic router lookahead) are built as usual
+        std::string rr_graph_file = snapshot_file(snapshot_dir, DEVICE_SNAPSHOT_RR_GRAPH);
+        if (args.read_rr_graph_file.provenance() != Provenance::SPECIFIED && vtr::file_exists(rr_graph_file.c_str())) {
+            args.read_rr_graph_file.set(rr_graph_file, Provenance::INFERRED);
+        }
+        std::string lookahead_file = snapshot_file(snapshot_dir, DEVICE_SNAPSHOT_ROUTER_LOOKAHEAD);
+        if (args.read_router_lookahead.provenance() != Provenance::SPECIFIED && vtr::file_exists(lookahead_file.c_str())) {
+            args.read_router_lookahead.set(lookahead_file, Provenance::INFERRED);
+        }
+        std::string delay_model_file = snapshot_file(snapshot_dir, DEVICE_SNAPSHOT_PLACE_DELAY_MODEL);
+        if (args.read_placement_delay_lookup.provenance() != Provenance::SPECIFIED && vtr::file_exists(delay_model_file.c_str())) {
+            args.read_placement_delay_lookup.set(delay_model_file, Provenance::INFERRED);
+        }
+        std::string lb_type_rr_graph_file = snapshot_file(snapshot_dir, DEVICE_SNAPSHOT_LB_TYPE_RR_GRAPH);
+        if (args.lb_type_rr_graph_cache.provenance() != Provenance::SPECIFIED && vtr::file_exists(lb_type_rr_graph_file.c_str())) {
+            args.lb_type_rr_graph_cache.set(lb_type_rr_graph_file, Provenance::INFERRED);
+        }
+
+        //The RR graph was checked when the snapshot was written, and the manifest verifies it was
+        //built from the same architecture and options, so it is not re-checked unless requested
+        if (args.check_rr_graph.provenance() != Provenance::SPECIFIED) {
+            args.check_rr_graph.set(false, Provenance::INFERRED);
+        }
+
+        VTR_LOG("Reading device snapshot from '%s'\n", snapshot_dir.c_str());
+    }
+}
+
+///@brief Returns the architecture and options the contents of a device snapshot depend on
+static std::map<std::string, std::string> device_snapshot_key(const t_options& args) {
+    std::map<std::string, std::string> key;
+    key["version"] = std::to_string(DEVICE_SNAPSHOT_VERSION);
+    key["arch_id"] = vtr::secure_digest_file(args.ArchFile);
+    key["device"] = args.device_layout;
+    key["route_chan_width"] = std::to_string(args.RouteChanWidth.value());
+    key["router_lookahead"] = std::to_string(int(args.router_lookahead_type.value()));
+    key["router_lookahead_half_precision"] = std::to_string(bool(args.router_lookahead_half_precision));
+    key["flat_routing"] = std::to_string(bool(args.flat_routing));
+    key["place_delay_model"] = std::to_string(int(args.place_delay_model.value()));
+    key["place_delay_model_reducer"] = std::to_string(int(args.place_delay_model_reducer.value()));
+    key["base_cost_type"] = std::to_string(int(args.base_cost_type.value()));
+    return key;
+}
+
+static void write_device_snapshot_manifest(const std::string& snapshot_dir, const t_options& args) {
+    std::string manifest_file = snapshot_file(snapshot_dir, DEVICE_SNAPSHOT_MANIFEST);
+
+    std::ofstream manifest(manifest_file);
+    for (const auto& [name, value] : device_snapshot_key(args)) {
+        manifest << name << " " << value << "\n";
+    }
+
+    if (!manifest) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to write device snapshot manifest '%s'\n", manifest_file.c_str());
+    }
+}
+
+static void check_device_snapshot_manifest(const std::string& snapshot_dir, t_options& args) {
+    std::string manifest_file = snapshot_file(snapshot_dir, DEVICE_SNAPSHOT_MANIFEST);
+
+    std::ifstream manifest(manifest_file);
+    if (!manifest) {
+        VPR_FATAL_ERROR(VPR_ERROR_OTHER, "'%s' is not a device snapshot (missing %s)\n",
+                        snapshot_dir.c_str(), DEVICE_SNAPSHOT_MANIFEST);
+    }
+
+    std::map<std::string, std::string> snapshot_key;
+    std::string line;
+    while (std::getline(manifest, line)) {
+        std::vector<std::string> tokens = vtr::split(line);
+        if (tokens.size() == 2) {
+            snapshot_key[tokens[0]] = tokens[1];
+        }
+    }
+
+    //The channel width is part of the snapshot, so use it unless it was specified
+    if (args.RouteChanWidth.provenance() != argparse::Provenance::SPECIFIED && snapshot_key.count("route_chan_width")) {
+        args.RouteChanWidth.set(vtr::atoi(snapshot_key["route_chan_width"]), argparse::Provenance::INFERRED);
+    }
+
+    for (const auto& [name, value] : device_snapshot_key(args)) {
+        auto iter = snapshot_key.find(name);
+        std::string snapshot_value = (iter != snapshot_key.end()) ? iter->second : "<missing>";
+        if (snapshot_value != value) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER,
+                            "Device snapshot '%s' does not match the current architecture and options"
+                            " (%s is '%s' in the snapshot, but '%s' now)\n",
+                            snapshot_dir.c_str(), name.c_str(), snapshot_value.c_str(), value.c_str());
+        }
+    }
+}
+
+static std::string snapshot_file(const std::string& snapshot_dir, const char* name) {
+    return (std::filesystem::path(snapshot_dir) / name).string();
+}
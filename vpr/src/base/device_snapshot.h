@@ -0,0 +1,30 @@
+#ifndef DEVICE_SNAPSHOT_H
+#define DEVICE_SNAPSHOT_H
+
+/**
+ * @file
+ * @brief Device snapshots, which let later VPR runs skip building the device
+ *
+ * A device snapshot is a directory holding the most expensive parts of the device context to
+ * build: the RR graph (as a native binary image), the router lookahead, the placement delay
+ * model and the intra-cluster routing graphs of the packer. A manifest records the architecture file digest and the options they were built with,
+ * so a snapshot is only used with the device it was made for.
+ *
+ * --write_device_snapshot and --read_device_snapshot are resolved into the corresponding
+ * --write_rr_graph/--read_rr_graph, --write_router_lookahead/--read_router_lookahead and
+ * --write_placement_delay_lookup/--read_placement_delay_lookup and --lb_type_rr_graph_cache
+ * files; explicitly specified files take precedence.
+ */
+
+#include "read_options.h"
+
+/**
+ * @brief Resolves --write_device_snapshot/--read_device_snapshot into the files which make up the snapshot
+ *
+ * When writing, the snapshot directory and its manifest are created. When reading, the manifest is
+ * checked against the architecture and options (an error is thrown on a mismatch), and the channel
+ * width is taken from the snapshot unless specified.
+ */
+void set_device_snapshot_options(t_options& args);
+
+#endif /* DEVICE_SNAPSHOT_H */
@@ -0,0 +1,433 @@
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "pugixml.hpp"
+
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+#include "vtr_util.h"
+
+#include "vpr_error.h"
+#include "vpr_utils.h"
+
+#include "binary_file_io.h"
+#include "eco.h"
+#include "globals.h"
+#include "old_traceback.h"
+#include "physical_types_util.h"
+#include "place_macro.h"
+#include "read_netlist.h"
+#include "route_common.h"
+#include "route_net.h"
+
+///@brief The constraints file fixing the unchanged clusters, written to the working directory
+static constexpr const char* ECO_FIXED_CLUSTERS_FILE = "eco_fixed_clusters.place";
+
+static std::unordered_map<std::string, size_t> read_cluster_contents(const char* net_file);
+static std::unordered_map<std::string, t_pl_loc> read_eco_place(const char* place_file);
+static ClusterBlockId find_constrained_block(const std::string& name);
+static bool restore_net_routing(const Netlist<>& net_list, ParentNetId net_id, std::vector<t_trace>& traces);
+static bool is_legal_traceback(const std::vector<t_trace>& traces);
+
+void setup_eco_placement(t_placer_opts& placer_opts, const char* net_file, const t_arch& arch) {
+    vtr::ScopedStartFinishTimer timer("Set up ECO placement");
+
+    const auto& clb_nlist = g_vpr_ctx.clustering().clb_nlist;
+    const auto& grid = g_vpr_ctx.device().grid;
+    const auto& floorplanning_ctx = g_vpr_ctx.floorplanning();
+
+    std::unordered_map<std::string, size_t> contents = read_cluster_contents(net_file);
+    std::unordered_map<std::string, size_t> prev_contents = read_cluster_contents(placer_opts.eco_net_file.c_str());
+    std::unordered_map<std::string, t_pl_loc> prev_locs = read_eco_place(placer_opts.eco_place_file.c_str());
+
+    //Blocks placed by the user (--fix_clusters) are left to the user's constraints
+    std::vector<std::string> user_constraints;
+    std::unordered_set<ClusterBlockId> user_fixed_blocks;
+    if (!placer_opts.constraints_file.empty()) {
+        std::ifstream fp(placer_opts.constraints_file);
+        if (!fp) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE_F, "'%s' - Cannot open constraints file.\n", placer_opts.constraints_file.c_str());
+        }
+        std::string line;
+        while (std::getline(fp, line)) {
+            std::vector<std::string> tokens = vtr::split(line);
+            if (!tokens.empty() && tokens[0][0] != '#')
+                user_fixed_blocks.insert(find_constrained_block(tokens[0]));
+            user_constraints.push_back(line);
+        }
+    }
+
+    vtr::vector<ClusterBlockId, bool> keep(clb_nlist.blocks().size(), false);
+    for (ClusterBlockId blk_id : clb_nlist.blocks()) {
+        const std::string& name = clb_nlist.block_name(blk_id);
+
+        auto contents_it = contents.find(name);
+        auto prev_contents_it = prev_contents.find(name);
+        auto prev_loc_it = prev_locs.find(name);
+        if (contents_it == contents.end() || prev_contents_it == prev_contents.end() || prev_loc_it == prev_locs.end())
+            continue; //New cluster
+        if (contents_it->second != prev_contents_it->second)
+            continue; //Changed cluster
+        if (user_fixed_blocks.count(blk_id))
+            continue;
+
+        //The previous location should still be legal, unless the constraints changed
+        const t_pl_loc& loc = prev_loc_it->second;
+        if (loc.x < 0 || loc.x >= int(grid.width()) || loc.y < 0 || loc.y >= int(grid.height()) || loc.layer < 0 || loc.layer >= grid.get_num_layers())
+            continue;
+        if (!is_sub_tile_compatible(grid.get_physical_type({loc.x, loc.y, loc.layer}), clb_nlist.block_type(blk_id), loc.sub_tile))
+            continue;
+        if (size_t(blk_id) < floorplanning_ctx.cluster_constraints.size()) {
+            const PartitionRegion& pr = floorplanning_ctx.cluster_constraints[blk_id];
+            if (!pr.empty() && !pr.is_loc_in_part_reg(loc))
+                continue;
+        }
+
+        keep[blk_id] = true;
+    }
+
+    //A macro can only be placed as a whole, so it is only kept if all its members are unchanged
+    for (const t_pl_macro& pl_macro : alloc_and_load_placement_macros(arch.Directs, arch.num_directs)) {
+        bool keep_macro = std::all_of(pl_macro.members.begin(), pl_macro.members.end(), [&](const t_pl_macro_member& member) {
+            return keep[member.blk_index];
+        });
+        if (!keep_macro) {
+            for (const t_pl_macro_member& member : pl_macro.members)
+                keep[member.blk_index] = false;
+        }
+    }
+
+    std::ofstream fp(ECO_FIXED_CLUSTERS_FILE);
+    if (!fp) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE_F, "'%s' - Cannot write ECO constraints file.\n", ECO_FIXED_CLUSTERS_FILE);
+    }
+    fp << "#Unchanged clusters of " << placer_opts.eco_net_file << ", at their locations in " << placer_opts.eco_place_file << "\n";
+
+    size_t num_kept = 0;
+    for (ClusterBlockId blk_id : clb_nlist.blocks()) {
+        if (!keep[blk_id])
+            continue;
+        const t_pl_loc& loc = prev_locs.at(clb_nlist.block_name(blk_id));
+        fp << clb_nlist.block_name(blk_id) << "\t" << loc.x << "\t" << loc.y << "\t" << loc.sub_tile << "\t" << loc.layer << "\n";
+        ++num_kept;
+    }
+
+    if (!user_constraints.empty()) {
+        fp << "#From " << placer_opts.constraints_file << "\n";
+        for (const std::string& line : user_constraints)
+            fp << line << "\n";
+    }
+    fp.close();
+
+    VTR_LOG("ECO: %zu of %zu clusters are unchanged and keep their locations, %zu new or changed clusters will be placed\n",
+            num_kept, clb_nlist.blocks().size(), clb_nlist.blocks().size() - num_kept);
+
+    placer_opts.constraints_file = ECO_FIXED_CLUSTERS_FILE;
+}
+
+void load_eco_routing(const Netlist<>& net_list,
+                      const char* route_file,
+                      NetPinsMatrix<float>& net_delay,
+                      TimingInfo* timing_info,
+                      NetPinTimingInvalidator* pin_timing_invalidator) {
+    vtr::ScopedStartFinishTimer timer("Load ECO routing");
+
+    const auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    if (is_binary_file_name(route_file)) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "The ECO flow matches nets by name, which binary routing files don't record: '%s' must be a .route file\n", route_file);
+    }
+
+    std::ifstream fp(route_file);
+    if (!fp) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "'%s' - Cannot open routing file.\n", route_file);
+    }
+
+    //The net being read, and its traceback so far. Invalid once it can't be restored
+    ParentNetId net_id = ParentNetId::INVALID();
+    std::vector<t_trace> traces;
+    std::unordered_set<ParentNetId> seen_nets;
+
+    size_t num_restored = 0;
+    auto finish_net = [&]() {
+        if (net_id && restore_net_routing(net_list, net_id, traces)) {
+            for (size_t ipin = 1; ipin < net_list.net_pins(net_id).size(); ipin++) {
+                update_net_delay_from_isink(net_delay[net_id].data(), route_ctx.route_trees[net_id].value(), ipin, net_list, net_id, timing_info, pin_timing_invalidator);
+            }
+            ++num_restored;
+        }
+        net_id = ParentNetId::INVALID();
+        traces.clear();
+    };
+
+    std::string line;
+    int lineno = 0;
+    while (std::getline(fp, line)) {
+        ++lineno;
+        std::vector<std::string> tokens = vtr::split(line);
+        if (tokens.empty() || tokens[0][0] == '#') {
+            continue;
+        } else if (tokens[0] == "Array" && tokens.size() >= 5) {
+            if (vtr::atou(tokens[2]) != device_ctx.grid.width() || vtr::atou(tokens[4]) != device_ctx.grid.height()) {
+                vpr_throw(VPR_ERROR_ROUTE, route_file, lineno,
+                          "Device dimensions %sx%s of the previous routing do not match the current %zux%zu",
+                          tokens[2].c_str(), tokens[4].c_str(), device_ctx.grid.width(), device_ctx.grid.height());
+            }
+        } else if (tokens[0] == "Net" && tokens.size() >= 3) {
+            finish_net();
+
+            //Global nets ("Net 3 (clk): global net connecting:") aren't routed
+            bool is_global = line.find("global net") != std::string::npos;
+            std::string name = tokens[2];
+            if (!name.empty() && name.back() == ':')
+                name.pop_back();
+            if (name.size() >= 2 && name.front() == '(' && name.back() == ')')
+                name = name.substr(1, name.size() - 2);
+
+            ParentNetId new_net_id = net_list.find_net(name);
+            if (!is_global && new_net_id && seen_nets.insert(new_net_id).second)
+                net_id = new_net_id;
+        } else if (tokens[0] == "Node:" && net_id) {
+            //Node: <id> <type> (<layer>,<x>,<y>) [to (<x>,<y>)] <Pad:|Pin:|Track:|Class:> <ptc> [<pin>] Switch: <id> [Net_pin_index: <index>]
+            bool is_legal = tokens.size() >= 8;
+            RRNodeId inode;
+            if (is_legal) {
+                size_t index = vtr::atou(tokens[1]);
+                is_legal = index < rr_graph.num_nodes();
+                inode = RRNodeId(index);
+            }
+            if (is_legal)
+                is_legal = tokens[2] == rr_graph.node_type_string(inode);
+            if (is_legal) {
+                int layer, x, y;
+                is_legal = std::sscanf(tokens[3].c_str(), "(%d,%d,%d)", &layer, &x, &y) == 3
+                           && layer == rr_graph.node_layer(inode) && x == rr_graph.node_xlow(inode) && y == rr_graph.node_ylow(inode);
+            }
+
+            t_trace trace;
+            trace.next = nullptr;
+            trace.index = size_t(inode);
+            trace.iswitch = OPEN;
+            trace.net_pin_index = OPEN;
+            bool has_ptc = false, has_switch = false;
+            for (size_t itoken = 4; is_legal && itoken + 1 < tokens.size(); itoken++) {
+                const std::string& token = tokens[itoken];
+                if (!has_ptc && (token == "Pad:" || token == "Pin:" || token == "Track:" || token == "Class:")) {
+                    has_ptc = true;
+                    is_legal = vtr::atoi(tokens[itoken + 1]) == rr_graph.node_ptc_num(inode);
+                } else if (token == "Switch:") {
+                    has_switch = true;
+                    trace.iswitch = vtr::atoi(tokens[itoken + 1]);
+                } else if (token == "Net_pin_index:") {
+                    trace.net_pin_index = vtr::atoi(tokens[itoken + 1]);
+                }
+            }
+
+            if (is_legal && has_ptc && has_switch) {
+                traces.push_back(trace);
+            } else {
+                //Not the same RR graph: this net will be routed from scratch
+                net_id = ParentNetId::INVALID();
+                traces.clear();
+            }
+        }
+    }
+    finish_net();
+
+    size_t num_nets = 0;
+    for (ParentNetId inet : net_list.nets()) {
+        if (!net_list.net_is_ignored(inet) && !net_list.net_sinks(inet).empty())
+            ++num_nets;
+    }
+    VTR_LOG("ECO: restored the routing of %zu of %zu nets from '%s', %zu new or changed nets will be routed\n",
+            num_restored, num_nets, route_file, num_nets - num_restored);
+    if (num_restored == 0 && num_nets > 0) {
+        VTR_LOG_WARN("No routing could be restored from '%s': was it routed on the same device, with the same channel width?\n", route_file);
+    }
+}
+
+/**
+ * @brief Returns the contents of each (top-level) cluster of a .net file, by name
+ *
+ * The contents are hashed from the cluster's type, mode and everything within its <block> element
+ * (ports with the nets on them, and the blocks inside it). The instance number ("clb[12]") is left out,
+ * since it moves with any cluster added or removed before it.
+ */
+static std::unordered_map<std::string, size_t> read_cluster_contents(const char* net_file) {
+    if (is_packed_netlist_binary(net_file)) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "The ECO flow compares the clusters of .net files: '%s' must be a .net file\n", net_file);
+    }
+
+    pugi::xml_document doc;
+    pugi::xml_parse_result result = doc.load_file(net_file);
+    if (!result) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Cannot read packed netlist '%s': %s\n", net_file, result.description());
+    }
+
+    std::unordered_map<std::string, size_t> contents;
+    for (pugi::xml_node block : doc.child("block").children("block")) {
+        std::string instance = block.attribute("instance").value();
+
+        std::ostringstream os;
+        os << instance.substr(0, instance.find('[')) << " " << block.attribute("mode").value() << "\n";
+        for (pugi::xml_node child : block.children())
+            child.print(os, "", pugi::format_raw);
+
+        contents[block.attribute("name").value()] = std::hash<std::string>()(os.str());
+    }
+    return contents;
+}
+
+///@brief Returns the location of each block of a (text) .place file, by name
+static std::unordered_map<std::string, t_pl_loc> read_eco_place(const char* place_file) {
+    const auto& grid = g_vpr_ctx.device().grid;
+
+    if (is_binary_file_name(place_file)) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE_F, "The ECO flow matches clusters by name, which binary placement files don't record: '%s' must be a .place file\n", place_file);
+    }
+
+    std::ifstream fp(place_file);
+    if (!fp) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE_F, "'%s' - Cannot open place file.\n", place_file);
+    }
+
+    std::unordered_map<std::string, t_pl_loc> locs;
+    std::string line;
+    int lineno = 0;
+    while (std::getline(fp, line)) {
+        ++lineno;
+        std::vector<std::string> tokens = vtr::split(line);
+        if (tokens.empty() || tokens[0][0] == '#' || tokens[0] == "Netlist_File:") {
+            continue;
+        } else if (tokens[0] == "Array" && tokens.size() >= 5) {
+            if (vtr::atou(tokens[2]) != grid.width() || vtr::atou(tokens[4]) != grid.height()) {
+                vpr_throw(VPR_ERROR_PLACE_F, place_file, lineno,
+                          "Device dimensions %sx%s of the previous placement do not match the current %zux%zu",
+                          tokens[2].c_str(), tokens[4].c_str(), grid.width(), grid.height());
+            }
+        } else if (tokens.size() >= 4) {
+            //<name> <x> <y> <sub_tile> [<layer>] [#<block number>]
+            int layer = (tokens.size() >= 5 && tokens[4][0] != '#') ? vtr::atoi(tokens[4]) : 0;
+            locs[tokens[0]] = t_pl_loc(vtr::atoi(tokens[1]), vtr::atoi(tokens[2]), vtr::atoi(tokens[3]), layer);
+        } else {
+            vpr_throw(VPR_ERROR_PLACE_F, place_file, lineno, "Invalid line '%s' in file", line.c_str());
+        }
+    }
+    return locs;
+}
+
+///@brief Returns the cluster a constraints file refers to by name (of the cluster, or one of its atoms), as read_constraints() does
+static ClusterBlockId find_constrained_block(const std::string& name) {
+    const auto& atom_ctx = g_vpr_ctx.atom();
+
+    ClusterBlockId blk_id = g_vpr_ctx.clustering().clb_nlist.find_block(name);
+    if (!blk_id) {
+        AtomBlockId atom_blk_id = atom_ctx.nlist.find_block(name);
+        if (atom_blk_id)
+            blk_id = atom_ctx.lookup.atom_clb(atom_blk_id);
+    }
+    return blk_id;
+}
+
+/**
+ * @brief Restores the route tree of net_id from its traceback in the previous routing
+ *
+ * Only if the traceback is a legal route tree in the current RR graph, and its SINKs are the sinks
+ * of the net. The net pin indices of its SINKs are renumbered to the current pins of the net.
+ * Returns false (leaving the net unrouted) otherwise.
+ */
+static bool restore_net_routing(const Netlist<>& net_list, ParentNetId net_id, std::vector<t_trace>& traces) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    if (net_list.net_is_ignored(net_id) || net_list.net_sinks(net_id).empty() || traces.empty())
+        return false;
+
+    const std::vector<RRNodeId>& terminals = route_ctx.net_rr_terminals[net_id];
+    if (RRNodeId(traces[0].index) != terminals[0] || !is_legal_traceback(traces))
+        return false;
+
+    //Pins of each SINK (several pins of a net may connect to the same SINK)
+    std::unordered_map<RRNodeId, std::vector<int>> sink_pins;
+    for (size_t ipin = terminals.size() - 1; ipin >= 1; ipin--)
+        sink_pins[terminals[ipin]].push_back(ipin);
+
+    for (t_trace& trace : traces) {
+        if (rr_graph.node_type(RRNodeId(trace.index)) != SINK)
+            continue;
+        auto it = sink_pins.find(RRNodeId(trace.index));
+        if (it == sink_pins.end() || it->second.empty())
+            return false; //Not a sink of the net anymore
+        trace.net_pin_index = it->second.back();
+        it->second.pop_back();
+    }
+    for (const auto& kv : sink_pins) {
+        if (!kv.second.empty())
+            return false; //A new sink
+    }
+
+    for (size_t itrace = 0; itrace + 1 < traces.size(); itrace++)
+        traces[itrace].next = &traces[itrace + 1];
+    traces.back().next = nullptr;
+
+    //Rebuilt for the net, so that it knows which sinks it reaches
+    vtr::optional<RouteTree> traceback_tree = TracebackCompat::traceback_to_route_tree(traces.data());
+    route_ctx.route_trees[net_id] = RouteTree(net_id, traceback_tree->to_records());
+    pathfinder_update_cost_from_route_tree(route_ctx.route_trees[net_id]->root(), 1);
+    return true;
+}
+
+/**
+ * @brief Checks that a traceback is a legal route tree in the current RR graph
+ *
+ * Each branch starts from a node already in the tree, follows RR graph edges with the switches
+ * they have, and ends at a SINK. Unlike validate_traceback(), doesn't error out: an illegal
+ * traceback only means the net has to be routed again.
+ */
+static bool is_legal_traceback(const std::vector<t_trace>& traces) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+
+    std::unordered_set<int> seen_nodes;
+    for (size_t itrace = 0; itrace < traces.size(); itrace++) {
+        const t_trace& trace = traces[itrace];
+        RRNodeId inode(trace.index);
+        bool is_sink = rr_graph.node_type(inode) == SINK;
+
+        //After the SINK ending a branch comes the node the next branch starts from
+        bool is_branch_point = itrace > 0 && rr_graph.node_type(RRNodeId(traces[itrace - 1].index)) == SINK;
+        if (is_branch_point) {
+            if (!seen_nodes.count(trace.index))
+                return false;
+        } else if (!seen_nodes.insert(trace.index).second && !is_sink) {
+            return false; //A node can only be used once (except SINKs, which may be reached for several pins)
+        }
+
+        if (is_sink && !is_branch_point) {
+            if (trace.iswitch != OPEN)
+                return false;
+            continue;
+        }
+
+        if (trace.iswitch == OPEN || itrace + 1 == traces.size())
+            return false; //A branch has to end at a SINK
+
+        RRNodeId next_node(traces[itrace + 1].index);
+        bool found = false;
+        for (t_edge_size iedge = 0; iedge < rr_graph.num_edges(inode); iedge++) {
+            if (rr_graph.edge_sink_node(inode, iedge) == next_node && rr_graph.edge_switch(inode, iedge) == trace.iswitch) {
+                found = true;
+                break;
+            }
+        }
+        if (!found)
+            return false;
+    }
+    return true;
+}
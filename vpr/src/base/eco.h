@@ -0,0 +1,49 @@
+#ifndef ECO_H
+#define ECO_H
+
+/**
+ * @file
+ * @brief Engineering change order (ECO) flow: implements a slightly changed design incrementally,
+ *        from a previous implementation of it
+ *
+ * The previous implementation is given by its .net, .place and .route files (--eco_net, --eco_place
+ * and --eco_route). Clusters and nets are matched with the previous ones by name:
+ *  - A cluster is unchanged if the previous packing had a cluster of the same name, type and contents
+ *    (the same <block> in the .net file, including the nets on its pins). Unchanged clusters are fixed
+ *    at their previous locations, so the placer only places the new and changed ones around them.
+ *  - A net is unchanged if its previous routing is still legal in the current RR graph and connects
+ *    the same source to the same sinks. Unchanged nets start routing with their previous route tree,
+ *    which the router then only rips up if it is congested (or too slow), like any other routed net.
+ */
+
+#include "NetPinTimingInvalidator.h"
+#include "netlist.h"
+#include "physical_types.h"
+#include "timing_info.h"
+#include "vpr_net_pins_matrix.h"
+#include "vpr_types.h"
+
+/**
+ * @brief Fixes the unchanged clusters at their locations in placer_opts.eco_place_file
+ *
+ * Compares the clusters of net_file (the current packing) with those of placer_opts.eco_net_file.
+ * The locations of the unchanged clusters are written to a constraints file, together with those of
+ * placer_opts.constraints_file (--fix_clusters) if any, which becomes the new placer_opts.constraints_file.
+ * A placement macro only keeps its locations if all its members are unchanged.
+ */
+void setup_eco_placement(t_placer_opts& placer_opts, const char* net_file, const t_arch& arch);
+
+/**
+ * @brief Loads the routing of the unchanged nets from route_file (a .route file of the previous implementation)
+ *
+ * Called once the routing structures are initialized: the route trees of the unchanged nets are
+ * restored (with their occupancy and net delays, invalidating the changed delays for the incremental
+ * timing update), and the other nets are left unrouted.
+ */
+void load_eco_routing(const Netlist<>& net_list,
+                      const char* route_file,
+                      NetPinsMatrix<float>& net_delay,
+                      TimingInfo* timing_info,
+                      NetPinTimingInvalidator* pin_timing_invalidator);
+
+#endif /* ECO_H */
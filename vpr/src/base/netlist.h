@@ -414,6 +414,7 @@
  *
  */
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include "vtr_range.h"
@@ -495,6 +496,12 @@ class Netlist {
      */
     bool is_compressed() const;
 
+    /**
+     * @brief Returns the (estimated) number of bytes held by the netlist, including the data of derived netlists
+     * @note  Unused capacity is included, so this is most meaningful after the netlist is compressed
+     */
+    size_t memory_usage() const;
+
     ///@brief Returns whether the net is ignored i.e. not routed
     bool net_is_ignored(const NetId id) const;
 
@@ -960,7 +967,7 @@ class Netlist {
      *
      *   @param str   The string to look for
      */
-    StringId find_string(const std::string& str) const;
+    StringId find_string(std::string_view str) const;
 
     /**
      * @brief Returns the BlockId of the specifed block if it exists or BlockId::INVALID() if not
@@ -987,6 +994,15 @@ class Netlist {
      */
     StringId create_string(const std::string& str);
 
+  private: //Private Base Members
+    ///@brief Returns the slot of string_table_ holding str's id, or the empty slot it would be stored in
+    size_t find_string_slot(std::string_view str) const;
+
+    ///@brief Re-builds string_table_ with the specified number of slots (a power of two)
+    void rebuild_string_table(size_t num_slots);
+
+  protected:
+
     /**
      * @brief Updates net cross-references for the specified pin
      *
@@ -1027,6 +1043,9 @@ class Netlist {
     ///@brief Removes invalid and reorders nets
     void clean_nets(const vtr::vector_map<NetId, NetId>& net_id_map);
 
+    ///@brief Removes strings which are no longer the name of any block, port or net
+    void clean_strings();
+
     ///@brief Re-builds fast look-ups
     void rebuild_lookups();
 
@@ -1080,6 +1099,7 @@ class Netlist {
     //The functions follow the Non-Virtual Interface (NVI) idiom, and
     //are called from this class in their respective non-impl() functions.
     virtual void shrink_to_fit_impl() {}
+    virtual size_t memory_usage_impl() const { return 0; }
 
     virtual bool validate_block_sizes_impl(size_t /*num_blocks*/) const { return true; }
     virtual bool validate_port_sizes_impl(size_t /*num_ports*/) const { return true; }
@@ -1158,7 +1178,11 @@ class Netlist {
   private: //Fast lookups
     vtr::vector_map<StringId, BlockId> block_name_to_block_id_;
     vtr::vector_map<StringId, NetId> net_name_to_net_id_;
-    std::unordered_map<std::string, StringId> string_to_string_id_;
+
+    //Open addressing (linear probing) hash table of the ids of strings_, located by the hash of
+    //each string. Only the ids are stored, so names are not duplicated as look-up keys, and
+    //strings can be looked up without constructing a std::string.
+    std::vector<StringId> string_table_;
     vtr::vector_map<NetId, bool> net_is_ignored_; ///<Boolean mapping indicating if the net is ignored
     vtr::vector_map<NetId, bool> net_is_global_;  ///<Boolean mapping indicating if the net is global
 };
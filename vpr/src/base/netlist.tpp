@@ -3,6 +3,7 @@
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_memory_usage.h"
 #include "vpr_error.h"
 /*
  *
@@ -68,6 +69,41 @@ bool Netlist<BlockId, PortId, PinId, NetId>::is_compressed() const {
     return !is_dirty();
 }
 
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+size_t Netlist<BlockId, PortId, PinId, NetId>::memory_usage() const {
+    size_t bytes = 0;
+
+    //Block data
+    bytes += vtr::memory_usage(block_ids_) + vtr::memory_usage(block_names_);
+    bytes += vtr::memory_usage(block_ports_) + vtr::memory_usage(block_pins_);
+    bytes += vtr::memory_usage(block_num_input_ports_) + vtr::memory_usage(block_num_output_ports_) + vtr::memory_usage(block_num_clock_ports_);
+    bytes += vtr::memory_usage(block_num_input_pins_) + vtr::memory_usage(block_num_output_pins_) + vtr::memory_usage(block_num_clock_pins_);
+    bytes += vtr::memory_usage(block_params_) + vtr::memory_usage(block_attrs_);
+
+    //Port data
+    bytes += vtr::memory_usage(port_ids_) + vtr::memory_usage(port_names_) + vtr::memory_usage(port_blocks_);
+    bytes += vtr::memory_usage(port_pins_) + vtr::memory_usage(port_widths_) + vtr::memory_usage(port_types_);
+
+    //Pin data
+    bytes += vtr::memory_usage(pin_ids_) + vtr::memory_usage(pin_ports_) + vtr::memory_usage(pin_port_bits_);
+    bytes += vtr::memory_usage(pin_nets_) + vtr::memory_usage(pin_net_indices_) + vtr::memory_usage(pin_is_constant_);
+
+    //Net data
+    bytes += vtr::memory_usage(net_ids_) + vtr::memory_usage(net_names_) + vtr::memory_usage(net_pins_);
+    bytes += vtr::memory_usage(net_is_ignored_) + vtr::memory_usage(net_is_global_);
+
+    //String data (including the characters, although short strings may be stored inline)
+    bytes += vtr::memory_usage(string_ids_) + vtr::memory_usage(strings_);
+    for (const std::string& str : strings_) {
+        bytes += str.capacity();
+    }
+
+    //Fast lookups
+    bytes += vtr::memory_usage(block_name_to_block_id_) + vtr::memory_usage(net_name_to_net_id_) + vtr::memory_usage(string_table_);
+
+    return bytes + memory_usage_impl();
+}
+
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 bool Netlist<BlockId, PortId, PinId, NetId>::net_is_ignored(const NetId id) const {
     VTR_ASSERT_SAFE(valid_net_id(id));
@@ -1112,7 +1148,7 @@ typename Netlist<BlockId, PortId, PinId, NetId>::IdRemapper Netlist<BlockId, Por
     clean_pins(id_remapper.pin_id_map_);
     clean_ports(id_remapper.port_id_map_);
     clean_blocks(id_remapper.block_id_map_);
-    //TODO: clean strings
+    clean_strings();
     //TODO: iterative cleaning?
 
     //Now we re-build all the cross references
@@ -1279,6 +1315,53 @@ void Netlist<BlockId, PortId, PinId, NetId>::clean_nets(const vtr::vector_map<Ne
     VTR_ASSERT_MSG(all_valid(net_ids_), "All Ids should be valid");
 }
 
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+void Netlist<BlockId, PortId, PinId, NetId>::clean_strings() {
+    //Names of removed (and re-named) blocks and nets are otherwise kept until the netlist is destroyed
+    vtr::vector_map<StringId, StringId> string_id_map(string_ids_.size(), StringId::INVALID());
+    size_t num_strings = 0;
+    auto keep_string = [&](StringId& str_id) {
+        if (!string_id_map[str_id]) {
+            string_id_map[str_id] = StringId(num_strings++);
+        }
+        str_id = string_id_map[str_id];
+    };
+
+    //Note: blocks, ports and nets have already been cleaned
+    for (StringId& str_id : block_names_) {
+        keep_string(str_id);
+    }
+    for (StringId& str_id : port_names_) {
+        keep_string(str_id);
+    }
+    for (StringId& str_id : net_names_) {
+        keep_string(str_id);
+    }
+
+    vtr::vector_map<StringId, std::string> new_strings(num_strings);
+    for (StringId str_id : string_ids_) {
+        StringId new_id = string_id_map[str_id];
+        if (new_id) {
+            new_strings[new_id] = std::move(strings_[str_id]);
+        }
+    }
+    strings_ = std::move(new_strings);
+
+    string_ids_.clear();
+    for (size_t i = 0; i < num_strings; ++i) {
+        string_ids_.push_back(StringId(i));
+    }
+
+    //Size the look-up to be at most half full
+    size_t num_slots = 64;
+    while (num_slots < 2 * (num_strings + 1)) {
+        num_slots *= 2;
+    }
+    rebuild_string_table(num_slots);
+
+    VTR_ASSERT(validate_string_sizes());
+}
+
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
 void Netlist<BlockId, PortId, PinId, NetId>::rebuild_lookups() {
     //We iterate through the reverse-lookups and update the values (i.e. ids)
@@ -1873,17 +1956,38 @@ bool Netlist<BlockId, PortId, PinId, NetId>::verify_block_invariants() const {
  *
  */
 template<typename BlockId, typename PortId, typename PinId, typename NetId>
-typename Netlist<BlockId, PortId, PinId, NetId>::StringId Netlist<BlockId, PortId, PinId, NetId>::find_string(const std::string& str) const {
-    auto iter = string_to_string_id_.find(str);
-    if (iter != string_to_string_id_.end()) {
-        StringId str_id = iter->second;
+typename Netlist<BlockId, PortId, PinId, NetId>::StringId Netlist<BlockId, PortId, PinId, NetId>::find_string(std::string_view str) const {
+    if (string_table_.empty()) {
+        return StringId::INVALID();
+    }
 
-        VTR_ASSERT_SAFE(str_id);
-        VTR_ASSERT_SAFE(strings_[str_id] == str);
+    StringId str_id = string_table_[find_string_slot(str)];
 
-        return str_id;
-    } else {
-        return StringId::INVALID();
+    VTR_ASSERT_SAFE(!str_id || strings_[str_id] == str);
+
+    return str_id;
+}
+
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+size_t Netlist<BlockId, PortId, PinId, NetId>::find_string_slot(std::string_view str) const {
+    VTR_ASSERT_SAFE(!string_table_.empty());
+
+    size_t mask = string_table_.size() - 1;
+    size_t slot = std::hash<std::string_view>()(str) & mask;
+    while (string_table_[slot] && strings_[string_table_[slot]] != str) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+template<typename BlockId, typename PortId, typename PinId, typename NetId>
+void Netlist<BlockId, PortId, PinId, NetId>::rebuild_string_table(size_t num_slots) {
+    VTR_ASSERT((num_slots & (num_slots - 1)) == 0);
+    VTR_ASSERT(num_slots > string_ids_.size());
+
+    string_table_.assign(num_slots, StringId::INVALID());
+    for (StringId str_id : string_ids_) {
+        string_table_[find_string_slot(strings_[str_id])] = str_id;
     }
 }
 
@@ -2017,20 +2121,23 @@ typename Netlist<BlockId, PortId, PinId, NetId>::StringId Netlist<BlockId, PortI
     if (!str_id) {
         //Not found, create
 
+        //Keep the look-up at most half full, so probe sequences stay short
+        if (2 * (string_ids_.size() + 1) > string_table_.size()) {
+            rebuild_string_table(std::max<size_t>(2 * string_table_.size(), 64));
+        }
+
         //Reserve an id
         str_id = StringId(string_ids_.size());
         string_ids_.push_back(str_id);
 
-        //Store the reverse look-up
-        auto key = str;
-        string_to_string_id_[key] = str_id;
-
         //Initialize the data
         strings_.emplace_back(str);
+
+        //Store the reverse look-up
+        string_table_[find_string_slot(str)] = str_id;
     }
 
     //Check post-conditions: sizes
-    VTR_ASSERT(string_to_string_id_.size() == string_ids_.size());
     VTR_ASSERT(strings_.size() == string_ids_.size());
 
     //Check post-conditions: values
@@ -12,6 +12,10 @@
 #include <cmath>
 #include <regex>
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 #include "vtr_assert.h"
 #include "vtr_util.h"
 #include "vtr_log.h"
@@ -131,6 +135,72 @@ std::string join_identifier(std::string lhs, std::string rhs);
 // Unconnected net prefix
 const std::string unconn_prefix = "__vpr__unconn";
 
+///@brief Number of items (e.g. cell instances) formatted together by print_items()
+constexpr size_t PRINT_CHUNK_SIZE = 1024;
+
+///@brief Number of chunks formatted (and held in memory) at a time by print_items()
+constexpr size_t PRINT_CHUNKS_PER_BATCH = 256;
+
+/**
+ * @brief Prints num_items items to os in order, formatting chunks of items in parallel (when built with TBB)
+ *
+ * print_item(os, unconn_count, i) prints item i, and uses (and increments) unconn_count to name any
+ * unconnected nets it creates. The unconnected nets of a chunk can only be numbered once those of all
+ * earlier chunks are known, so each chunk is first formatted as though it were the first; chunks which
+ * created unconnected nets after earlier ones did are then formatted again with the correct numbering.
+ * The output is identical to printing the items one by one.
+ *
+ * Returns the updated unconn_count.
+ */
+template<typename F>
+size_t print_items(std::ostream& os, size_t num_items, size_t unconn_count, const F& print_item) {
+#ifdef VPR_USE_TBB
+    size_t num_chunks = (num_items + PRINT_CHUNK_SIZE - 1) / PRINT_CHUNK_SIZE;
+    for (size_t batch_begin = 0; batch_begin < num_chunks; batch_begin += PRINT_CHUNKS_PER_BATCH) {
+        size_t batch_size = std::min(PRINT_CHUNKS_PER_BATCH, num_chunks - batch_begin);
+
+        std::vector<std::string> chunk_text(batch_size);
+        std::vector<size_t> chunk_unconn_count(batch_size); //Number of unconnected nets created by each chunk
+        auto print_chunk = [&](size_t ichunk, size_t first_unconn) {
+            std::ostringstream chunk_os;
+            size_t chunk_unconn = first_unconn;
+            size_t begin = (batch_begin + ichunk) * PRINT_CHUNK_SIZE;
+            size_t end = std::min(begin + PRINT_CHUNK_SIZE, num_items);
+            for (size_t i = begin; i < end; ++i) {
+                print_item(chunk_os, chunk_unconn, i);
+            }
+            chunk_text[ichunk] = chunk_os.str();
+            chunk_unconn_count[ichunk] = chunk_unconn - first_unconn;
+        };
+
+        tbb::parallel_for(size_t(0), batch_size, [&](size_t ichunk) {
+            print_chunk(ichunk, 0);
+        });
+
+        std::vector<size_t> first_unconn(batch_size);
+        for (size_t ichunk = 0; ichunk < batch_size; ++ichunk) {
+            first_unconn[ichunk] = unconn_count;
+            unconn_count += chunk_unconn_count[ichunk];
+        }
+
+        tbb::parallel_for(size_t(0), batch_size, [&](size_t ichunk) {
+            if (chunk_unconn_count[ichunk] > 0 && first_unconn[ichunk] > 0) {
+                print_chunk(ichunk, first_unconn[ichunk]);
+            }
+        });
+
+        for (const std::string& text : chunk_text) {
+            os.write(text.data(), text.size());
+        }
+    }
+#else
+    for (size_t i = 0; i < num_items; ++i) {
+        print_item(os, unconn_count, i);
+    }
+#endif
+    return unconn_count;
+}
+
 //A combinational timing arc
 class Arc {
   public:
@@ -851,6 +921,14 @@ class NetlistWriterVisitor : public NetlistVisitor {
     NetlistWriterVisitor& operator=(NetlistWriterVisitor&& rhs) = delete;
 
   private: //Internal types
+    ///@brief A connection between the driver and a sink of a logical net (implemented by an fpga_interconnect instance)
+    struct InterconnectConn {
+        const std::string* driver_wire;
+        tatum::NodeId driver_tnode;
+        const std::string* sink_wire;
+        tatum::NodeId sink_tnode;
+    };
+
   private: //NetlistVisitor interface functions
     void visit_top_impl(const char* top_level_name) override {
         top_module_name_ = top_level_name;
@@ -946,28 +1024,22 @@ class NetlistWriterVisitor : public NetlistVisitor {
         //Interconnect between cell instances
         verilog_os_ << "\n";
         verilog_os_ << indent(depth + 1) << "//Interconnect\n";
-        for (const auto& kv : logical_net_sinks_) {
-            auto atom_net_id = kv.first;
-            auto driver_iter = logical_net_drivers_.find(atom_net_id);
-            VTR_ASSERT(driver_iter != logical_net_drivers_.end());
-            const auto& driver_wire = driver_iter->second.first;
-
-            for (auto& sink_wire_tnode_pair : kv.second) {
-                std::string inst_name = interconnect_name(driver_wire, sink_wire_tnode_pair.first);
-                verilog_os_ << indent(depth + 1) << "fpga_interconnect " << escape_verilog_identifier(inst_name) << " (\n";
-                verilog_os_ << indent(depth + 2) << ".datain(" << escape_verilog_identifier(driver_wire) << "),\n";
-                verilog_os_ << indent(depth + 2) << ".dataout(" << escape_verilog_identifier(sink_wire_tnode_pair.first) << ")\n";
-                verilog_os_ << indent(depth + 1) << ");\n\n";
-            }
-        }
+        std::vector<InterconnectConn> conns = interconnect_conns();
+        print_items(verilog_os_, conns.size(), 0, [&](std::ostream& os, size_t& /*unconn_count*/, size_t iconn) {
+            const InterconnectConn& conn = conns[iconn];
+            std::string inst_name = interconnect_name(*conn.driver_wire, *conn.sink_wire);
+            os << indent(depth + 1) << "fpga_interconnect " << escape_verilog_identifier(inst_name) << " (\n";
+            os << indent(depth + 2) << ".datain(" << escape_verilog_identifier(*conn.driver_wire) << "),\n";
+            os << indent(depth + 2) << ".dataout(" << escape_verilog_identifier(*conn.sink_wire) << ")\n";
+            os << indent(depth + 1) << ");\n\n";
+        });
 
         //All the cell instances (to an internal buffer for now)
         std::stringstream instances_ss;
 
-        size_t unconn_count = 0;
-        for (auto& inst : cell_instances_) {
-            inst->print_verilog(instances_ss, unconn_count, depth + 1);
-        }
+        size_t unconn_count = print_items(instances_ss, cell_instances_.size(), 0, [&](std::ostream& os, size_t& inst_unconn_count, size_t iinst) {
+            cell_instances_[iinst]->print_verilog(os, inst_unconn_count, depth + 1);
+        });
 
         //Unconnected wires declarations
         if (unconn_count) {
@@ -1018,25 +1090,18 @@ class NetlistWriterVisitor : public NetlistVisitor {
         //All interconnect between elements
         blif_os_ << "\n";
         blif_os_ << indent(depth) << "#Interconnect\n";
-        for (const auto& kv : logical_net_sinks_) {
-            auto atom_net_id = kv.first;
-            auto driver_iter = logical_net_drivers_.find(atom_net_id);
-            VTR_ASSERT(driver_iter != logical_net_drivers_.end());
-            const auto& driver_wire = driver_iter->second.first;
-
-            for (auto& sink_wire_tnode_pair : kv.second) {
-                blif_os_ << indent(depth) << ".names " << driver_wire << " " << sink_wire_tnode_pair.first << "\n";
-                blif_os_ << indent(depth) << "1 1\n";
-            }
-        }
+        std::vector<InterconnectConn> conns = interconnect_conns();
+        print_items(blif_os_, conns.size(), 0, [&](std::ostream& os, size_t& /*unconn_count*/, size_t iconn) {
+            os << indent(depth) << ".names " << *conns[iconn].driver_wire << " " << *conns[iconn].sink_wire << "\n";
+            os << indent(depth) << "1 1\n";
+        });
 
         //The cells
         blif_os_ << "\n";
         blif_os_ << indent(depth) << "#Cell instances\n";
-        size_t unconn_count = 0;
-        for (auto& inst : cell_instances_) {
-            inst->print_blif(blif_os_, unconn_count);
-        }
+        print_items(blif_os_, cell_instances_.size(), 0, [&](std::ostream& os, size_t& unconn_count, size_t iinst) {
+            cell_instances_[iinst]->print_blif(os, unconn_count);
+        });
 
         blif_os_ << "\n";
         blif_os_ << indent(depth) << ".end\n";
@@ -1055,40 +1120,39 @@ class NetlistWriterVisitor : public NetlistVisitor {
         sdf_os_ << "\n";
 
         //Interconnect
-        for (const auto& kv : logical_net_sinks_) {
-            auto atom_net_id = kv.first;
-            auto driver_iter = logical_net_drivers_.find(atom_net_id);
-            VTR_ASSERT(driver_iter != logical_net_drivers_.end());
-            auto driver_wire = driver_iter->second.first;
-            auto driver_tnode = driver_iter->second.second;
+        std::vector<InterconnectConn> conns = interconnect_conns();
 
-            for (auto& sink_wire_tnode_pair : kv.second) {
-                auto sink_wire = sink_wire_tnode_pair.first;
-                auto sink_tnode = sink_wire_tnode_pair.second;
+        //The delay calculator caches delays as they are calculated, so only the formatting is parallel
+        std::vector<double> delays(conns.size());
+        for (size_t iconn = 0; iconn < conns.size(); ++iconn) {
+            delays[iconn] = get_delay_ps(conns[iconn].driver_tnode, conns[iconn].sink_tnode);
+        }
 
-                sdf_os_ << indent(depth + 1) << "(CELL\n";
-                sdf_os_ << indent(depth + 2) << "(CELLTYPE \"fpga_interconnect\")\n";
-                sdf_os_ << indent(depth + 2) << "(INSTANCE " << escape_sdf_identifier(interconnect_name(driver_wire, sink_wire)) << ")\n";
-                sdf_os_ << indent(depth + 2) << "(DELAY\n";
-                sdf_os_ << indent(depth + 3) << "(ABSOLUTE\n";
+        print_items(sdf_os_, conns.size(), 0, [&](std::ostream& os, size_t& /*unconn_count*/, size_t iconn) {
+            const InterconnectConn& conn = conns[iconn];
 
-                double delay = get_delay_ps(driver_tnode, sink_tnode);
+            os << indent(depth + 1) << "(CELL\n";
+            os << indent(depth + 2) << "(CELLTYPE \"fpga_interconnect\")\n";
+            os << indent(depth + 2) << "(INSTANCE " << escape_sdf_identifier(interconnect_name(*conn.driver_wire, *conn.sink_wire)) << ")\n";
+            os << indent(depth + 2) << "(DELAY\n";
+            os << indent(depth + 3) << "(ABSOLUTE\n";
 
-                std::stringstream delay_triple;
-                delay_triple << "(" << delay << ":" << delay << ":" << delay << ")";
+            double delay = delays[iconn];
 
-                sdf_os_ << indent(depth + 4) << "(IOPATH datain dataout " << delay_triple.str() << " " << delay_triple.str() << ")\n";
-                sdf_os_ << indent(depth + 3) << ")\n";
-                sdf_os_ << indent(depth + 2) << ")\n";
-                sdf_os_ << indent(depth + 1) << ")\n";
-                sdf_os_ << indent(depth) << "\n";
-            }
-        }
+            std::stringstream delay_triple;
+            delay_triple << "(" << delay << ":" << delay << ":" << delay << ")";
+
+            os << indent(depth + 4) << "(IOPATH datain dataout " << delay_triple.str() << " " << delay_triple.str() << ")\n";
+            os << indent(depth + 3) << ")\n";
+            os << indent(depth + 2) << ")\n";
+            os << indent(depth + 1) << ")\n";
+            os << indent(depth) << "\n";
+        });
 
         //Cells
-        for (const auto& inst : cell_instances_) {
-            inst->print_sdf(sdf_os_, depth + 1);
-        }
+        print_items(sdf_os_, cell_instances_.size(), 0, [&](std::ostream& os, size_t& /*unconn_count*/, size_t iinst) {
+            cell_instances_[iinst]->print_sdf(os, depth + 1);
+        });
 
         sdf_os_ << indent(depth) << ")\n";
     }
@@ -1853,11 +1917,13 @@ class NetlistWriterVisitor : public NetlistVisitor {
         //Retrieve the truth table
         const auto& truth_table = atom_ctx.nlist.block_truth_table(atom_ctx.lookup.pb_atom(atom));
 
-        //Apply the permutation
-        auto permuted_truth_table = permute_truth_table(truth_table, num_inputs, permute);
+        //Apply the permutation (on the packed truth table, whose extra inputs are filled
+        //in the same way as the permuted cubes)
+        vtr::PackedTruthTable packed_truth_table = pack_truth_table(truth_table, num_inputs);
+        packed_truth_table.permute_inputs(permute);
 
         //Convert to lut mask
-        LogicVec lut_mask = truth_table_to_lut_mask(permuted_truth_table, num_inputs);
+        LogicVec lut_mask = packed_truth_table.to_lut_mask();
 
 #ifdef DEBUG_LUT_MASK
         std::cout << "\tLUT_MASK: " << lut_mask << std::endl;
@@ -2081,6 +2147,22 @@ class NetlistWriterVisitor : public NetlistVisitor {
     }
 
     ///@brief Returns the delay in pico-seconds from source_tnode to sink_tnode
+    ///@brief Returns the connections between logical net drivers and sinks, in the order they are written
+    std::vector<InterconnectConn> interconnect_conns() const {
+        std::vector<InterconnectConn> conns;
+        for (const auto& kv : logical_net_sinks_) {
+            auto atom_net_id = kv.first;
+            auto driver_iter = logical_net_drivers_.find(atom_net_id);
+            VTR_ASSERT(driver_iter != logical_net_drivers_.end());
+
+            for (const auto& sink_wire_tnode_pair : kv.second) {
+                conns.push_back({&driver_iter->second.first, driver_iter->second.second,
+                                 &sink_wire_tnode_pair.first, sink_wire_tnode_pair.second});
+            }
+        }
+        return conns;
+    }
+
     double get_delay_ps(tatum::NodeId source_tnode, tatum::NodeId sink_tnode) {
         auto& timing_ctx = g_vpr_ctx.timing();
 
@@ -30,7 +30,7 @@ void TracebackCompat::traceback_to_route_tree_x(t_trace* trace, RouteTree& tree,
     const auto& rr_graph = device_ctx.rr_graph;
     RRNodeId inode = RRNodeId(trace->index);
 
-    RouteTreeNode* new_node = new RouteTreeNode(inode, parent_switch, parent);
+    RouteTreeNode* new_node = tree._arena.alloc(inode, parent_switch, parent);
     tree.add_node(parent, new_node);
     new_node->net_pin_index = trace->net_pin_index;
     new_node->R_upstream = std::numeric_limits<float>::quiet_NaN();
@@ -130,7 +130,7 @@ void print_traceback(const t_trace* trace) {
             VTR_LOG("*"); //Reached non-configurably
         }
 
-        if (route_ctx.rr_node_route_inf[inode].occ() > rr_graph.node_capacity(inode)) {
+        if (route_ctx.rr_node_cong_inf[inode].occ() > rr_graph.node_capacity(inode)) {
             VTR_LOG(" x"); //Overused
         }
         VTR_LOG("\n");
@@ -0,0 +1,134 @@
+#include "output_file_writer.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+static bool write_file(const std::string& filename, const std::string& contents);
+
+/**
+ * @brief Writes the queued files in order on a single background thread
+ *
+ * The thread is started by the first queued write, and joined on destruction so no
+ * write is lost if VPR exits (e.g. due to an error) without waiting for the writes.
+ */
+class OutputFileWriter {
+  public:
+    ~OutputFileWriter() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            exit_ = true;
+        }
+        cv_.notify_all();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    void enqueue(const std::string& filename, std::string contents, e_vpr_error error_type) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_.push_back({filename, std::move(contents), error_type});
+            if (!thread_.joinable()) {
+                thread_ = std::thread([this] { run(); });
+            }
+        }
+        cv_.notify_all();
+    }
+
+    ///@brief Waits until all queued files have been written, returning the first failed write (if any)
+    bool wait(std::string& failed_filename, e_vpr_error& failed_error_type) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] { return pending_.empty() && !writing_; });
+
+        bool failed = failed_;
+        failed_filename = failed_filename_;
+        failed_error_type = failed_error_type_;
+        failed_ = false;
+        return !failed;
+    }
+
+  private:
+    struct t_pending_file {
+        std::string filename;
+        std::string contents;
+        e_vpr_error error_type;
+    };
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this] { return exit_ || !pending_.empty(); });
+            if (pending_.empty()) {
+                return; //Exiting, and nothing left to write
+            }
+
+            t_pending_file file = std::move(pending_.front());
+            pending_.pop_front();
+            writing_ = true;
+
+            lock.unlock();
+            bool ok = write_file(file.filename, file.contents);
+            lock.lock();
+
+            writing_ = false;
+            if (!ok && !failed_) {
+                failed_ = true;
+                failed_filename_ = file.filename;
+                failed_error_type_ = file.error_type;
+            }
+            done_cv_.notify_all();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;      ///<Signals new files to write (or exit) to the writer thread
+    std::condition_variable done_cv_; ///<Signals a completed write to waiters
+    std::deque<t_pending_file> pending_;
+    bool writing_ = false;
+    bool exit_ = false;
+
+    bool failed_ = false;
+    std::string failed_filename_;
+    e_vpr_error failed_error_type_ = VPR_ERROR_OTHER;
+
+    std::thread thread_;
+};
+
+static bool async_output_file_writes = false;
+static OutputFileWriter output_file_writer;
+
+void set_async_output_file_writes(bool enabled) {
+    async_output_file_writes = enabled;
+}
+
+void write_output_file(const std::string& filename, std::string contents, e_vpr_error error_type) {
+    if (async_output_file_writes) {
+        output_file_writer.enqueue(filename, std::move(contents), error_type);
+        return;
+    }
+
+    if (!write_file(filename, contents)) {
+        vpr_throw(error_type, filename.c_str(), 0, "Failed to write '%s'", filename.c_str());
+    }
+}
+
+void finish_output_file_writes() {
+    std::string failed_filename;
+    e_vpr_error failed_error_type;
+    if (!output_file_writer.wait(failed_filename, failed_error_type)) {
+        vpr_throw(failed_error_type, failed_filename.c_str(), 0, "Failed to write '%s'", failed_filename.c_str());
+    }
+}
+
+static bool write_file(const std::string& filename, const std::string& contents) {
+    FILE* fp = std::fopen(filename.c_str(), "wb");
+    if (!fp) {
+        return false;
+    }
+    bool ok = std::fwrite(contents.data(), 1, contents.size(), fp) == contents.size();
+    ok &= (std::fclose(fp) == 0);
+    return ok;
+}
@@ -0,0 +1,37 @@
+#ifndef OUTPUT_FILE_WRITER_H
+#define OUTPUT_FILE_WRITER_H
+
+/**
+ * @file
+ * @brief Writes output files, optionally on a background thread
+ *
+ * Output files (e.g. the .place and .route files) are formatted in memory and handed to
+ * write_output_file(). With asynchronous writes enabled (--async_output_file_writes), writing
+ * the contents to disk (which can be slow, e.g. on networked filesystems) happens on a
+ * background thread while the flow continues. Files are written in the order they were
+ * requested, and finish_output_file_writes() waits for all outstanding writes, reporting any
+ * which failed.
+ */
+
+#include <string>
+
+#include "vpr_error.h"
+
+///@brief Sets whether write_output_file() returns before the file has been written
+void set_async_output_file_writes(bool enabled);
+
+/**
+ * @brief Writes contents to filename
+ *
+ *   @param filename   The file to write
+ *   @param contents   The complete contents of the file
+ *   @param error_type The type of error reported if the file cannot be written
+ *
+ * When writing asynchronously a failed write is reported by the next call to finish_output_file_writes().
+ */
+void write_output_file(const std::string& filename, std::string contents, e_vpr_error error_type);
+
+///@brief Waits for any outstanding asynchronous writes, and throws an error if any of them failed
+void finish_output_file_writes();
+
+#endif /* OUTPUT_FILE_WRITER_H */
@@ -6,6 +6,19 @@
 #include <cstdlib>
 #include <cmath>
 #include <algorithm>
+#include <chrono>
+#include <functional>
+#include <cstring>
+#include <map>
+#include <set>
+
+#ifndef _WIN32
+#    include <csignal>
+#    include <cerrno>
+#    include <fcntl.h>
+#    include <sys/wait.h>
+#    include <unistd.h>
+#endif
 
 #include "vtr_util.h"
 #include "vtr_memory.h"
@@ -39,11 +52,25 @@
 #include "timing_info.h"
 #include "tatum/echo_writer.hpp"
 
+#ifndef NO_GRAPHICS
+#    include "draw_global.h"
+#endif
+
 /******************* Subroutines local to this module ************************/
 
 static int compute_chan_width(int cfactor, t_chan chan_dist, float distance, float separation, t_graph_type graph_directionality);
 static float comp_width(t_chan* chan, float x, float separation);
 
+static bool can_speculate_min_chan_width(const t_router_opts& router_opts);
+static void speculative_min_chan_width_search(const std::function<bool(int)>& try_width,
+                                              int num_jobs,
+                                              int initial_width,
+                                              int width_step,
+                                              int min_width,
+                                              int max_width,
+                                              int& low,
+                                              int& high);
+
 /************************* Subroutine Definitions ****************************/
 
 /**
@@ -149,6 +176,51 @@ int binary_search_place_and_route(const Netlist<>& placement_net_list,
 
     attempt_count = 0;
 
+    if (router_opts.min_chan_width_search_jobs > 1 && can_speculate_min_chan_width(router_opts)) {
+        auto try_width = [&](int width) {
+            if (placer_opts.place_freq == PLACE_ALWAYS) {
+                placer_opts.place_chan_width = width;
+                try_place(placement_net_list, placer_opts, annealing_sched, router_opts, analysis_opts, noc_opts,
+                          arch->Chans, det_routing_arch, segment_inf,
+                          arch->Directs, arch->num_directs,
+                          false);
+            }
+            return route(router_net_list,
+                         width,
+                         router_opts,
+                         analysis_opts,
+                         det_routing_arch,
+                         segment_inf,
+                         net_delay,
+                         timing_info,
+                         delay_calc,
+                         arch->Chans,
+                         arch->Directs,
+                         arch->num_directs,
+                         ScreenUpdatePriority::MINOR,
+                         is_flat);
+        };
+
+        //Widths below Fs / 3 are never tried (see below), and widths above 1000 are assumed unroutable
+        speculative_min_chan_width_search(try_width,
+                                          router_opts.min_chan_width_search_jobs,
+                                          current,
+                                          udsd_multiplier,
+                                          (det_routing_arch->Fs + 2) / 3,
+                                          1000,
+                                          low,
+                                          high);
+
+        //Finish the search in this process, which also produces the routing of the best width
+        if (high != -1) {
+            current = high;
+            high = -1;
+        } else if (low != -1) {
+            current = 2 * low;
+        }
+        current = current + current % udsd_multiplier;
+    }
+
     while (final == -1) {
         VTR_LOG("\n");
         VTR_LOG("Attempting to route at %d channels (binary search bounds: [%d, %d])\n", current, low, high);
@@ -559,6 +631,223 @@ static float comp_width(t_chan* chan, float x, float separation) {
     return (val);
 }
 
+/**
+ * @brief Returns true if the minimum channel width search can route candidate widths concurrently
+ *
+ * The candidates are routed by forked processes, which is only supported on POSIX platforms, for the
+ * binary search (not the Wneed = f(Fs) search), and when there is no graphics or server session which
+ * the forked processes would interfere with.
+ */
+static bool can_speculate_min_chan_width(const t_router_opts& router_opts) {
+#ifdef _WIN32
+    VTR_LOG_WARN("Concurrent minimum channel width search is not supported on this platform, searching sequentially.\n");
+    return false;
+#else
+    if (router_opts.fixed_channel_width != NO_FIXED_CHANNEL_WIDTH) {
+        VTR_LOG_WARN("Concurrent minimum channel width search is not supported with a fixed channel width, searching sequentially.\n");
+        return false;
+    }
+#    ifndef NO_GRAPHICS
+    if (get_draw_state_vars()->show_graphics) {
+        VTR_LOG_WARN("Concurrent minimum channel width search is not supported with graphics, searching sequentially.\n");
+        return false;
+    }
+#    endif
+#    ifndef NO_SERVER
+    if (g_vpr_ctx.server().gate_io.is_running()) {
+        VTR_LOG_WARN("Concurrent minimum channel width search is not supported in server mode, searching sequentially.\n");
+        return false;
+    }
+#    endif
+    return true;
+#endif
+}
+
+#ifndef _WIN32
+/**
+ * @brief Routes at width in a forked (child) process, returning its pid (or -1 if it could not be forked)
+ *
+ * The child exits with status 0 if the width is routable and 1 if it is not. Its output is discarded,
+ * since it would be interleaved with the output of the other attempts.
+ */
+static pid_t fork_route_attempt(const std::function<bool(int)>& try_width, int width) {
+    //Flush the buffered output, so it isn't also written by the child
+    fflush(nullptr);
+
+    pid_t pid = fork();
+    if (pid != 0) {
+        return pid;
+    }
+
+    vtr::set_log_file(nullptr);
+    int null_fd = open("/dev/null", O_WRONLY);
+    if (null_fd >= 0) {
+        dup2(null_fd, STDOUT_FILENO);
+        dup2(null_fd, STDERR_FILENO);
+        close(null_fd);
+    }
+
+    int status = 2;
+    try {
+        status = try_width(width) ? 0 : 1;
+    } catch (...) {
+        status = 2;
+    }
+
+    //Skip the destructors and exit handlers, which would tear down the state shared with the parent
+    _exit(status);
+}
+#endif
+
+/**
+ * @brief Narrows the bounds of the minimum channel width search by routing several widths concurrently
+ *
+ * Each candidate width is routed by a forked process, which shares the placement (and the rest of the
+ * state) of this process copy-on-write, and builds its own RR graph and routing. Once a width is found
+ * routable, the attempts at larger widths are cancelled (and once a width is found unroutable, those at
+ * smaller widths), and new candidates are started within the narrowed bounds:
+ *
+ *  - with both bounds, the candidates evenly divide the interval between them
+ *  - with only an upper bound, they repeatedly halve it
+ *  - with only a lower bound (or none), they repeatedly double it (or the initial width)
+ *
+ * On return, high is the smallest width found routable (or -1 if none was), and low the largest width
+ * found unroutable (or -1). Since the routings stay in the child processes, the caller must re-route at
+ * the chosen width.
+ */
+static void speculative_min_chan_width_search(const std::function<bool(int)>& try_width,
+                                              int num_jobs,
+                                              int initial_width,
+                                              int width_step,
+                                              int min_width,
+                                              int max_width,
+                                              int& low,
+                                              int& high) {
+#ifdef _WIN32
+    (void)try_width;
+    (void)num_jobs;
+    (void)initial_width;
+    (void)width_step;
+    (void)min_width;
+    (void)max_width;
+    (void)low;
+    (void)high;
+#else
+    struct t_route_attempt {
+        int width;
+        std::chrono::steady_clock::time_point start;
+    };
+    std::map<pid_t, t_route_attempt> running;
+    std::set<int> tried;
+
+    auto search_done = [&]() {
+        return high != -1 && high - std::max(low, 0) <= width_step;
+    };
+
+    //Returns up to num_candidates untried widths within the current bounds
+    auto next_candidates = [&](int num_candidates) {
+        std::vector<int> candidates;
+        auto add_candidate = [&](int width) {
+            width = std::max(width, min_width);
+            width = width + width % width_step;
+            if (width <= std::max(low, 0) || (high != -1 && width >= high) || width > max_width) return;
+            if (tried.count(width) || std::find(candidates.begin(), candidates.end(), width) != candidates.end()) return;
+            if (int(candidates.size()) < num_candidates) candidates.push_back(width);
+        };
+
+        if (high != -1 && low != -1) {
+            for (int i = 1; i <= num_jobs; ++i) {
+                add_candidate(low + (high - low) * i / (num_jobs + 1));
+            }
+        } else if (high != -1) {
+            //Halve down to the minimum width
+            for (int width = high / 2; int(candidates.size()) < num_candidates; width /= 2) {
+                add_candidate(width);
+                if (width <= min_width) break;
+            }
+        } else {
+            int width = (low != -1) ? 2 * low : initial_width;
+            for (int i = 0; i < num_jobs && width <= max_width; ++i, width *= 2) {
+                add_candidate(width);
+            }
+        }
+        return candidates;
+    };
+
+    auto cancel_attempts = [&](const std::function<bool(int)>& dominated) {
+        for (auto iter = running.begin(); iter != running.end();) {
+            if (dominated(iter->second.width)) {
+                kill(iter->first, SIGKILL);
+                waitpid(iter->first, nullptr, 0);
+                VTR_LOG("Cancelled speculative routing at %d channels\n", iter->second.width);
+                iter = running.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    };
+
+    VTR_LOG("\n");
+    VTR_LOG("Searching for the minimum channel width with up to %d concurrent routing attempts\n", num_jobs);
+
+    while (!search_done()) {
+        //Start new attempts in the free slots
+        for (int width : next_candidates(num_jobs - running.size())) {
+            pid_t pid = fork_route_attempt(try_width, width);
+            if (pid < 0) {
+                VTR_LOG_WARN("Failed to start a routing attempt at %d channels (%s).\n", width, strerror(errno));
+                break;
+            }
+            tried.insert(width);
+            running[pid] = {width, std::chrono::steady_clock::now()};
+            VTR_LOG("Attempting to route at %d channels (search bounds: [%d, %d])\n", width, low, high);
+        }
+
+        if (running.empty()) {
+            break; //No more candidates
+        }
+
+        int status = 0;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0) {
+            if (errno == EINTR) continue;
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Failed to wait for the routing attempts (%s).\n", strerror(errno));
+        }
+
+        auto iter = running.find(pid);
+        if (iter == running.end()) {
+            continue; //Not an attempt
+        }
+        t_route_attempt attempt = iter->second;
+        running.erase(iter);
+
+        float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - attempt.start).count();
+        bool routable = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        if (!routable && !(WIFEXITED(status) && WEXITSTATUS(status) == 1)) {
+            VTR_LOG_WARN("Routing attempt at %d channels did not complete, treating it as unroutable.\n", attempt.width);
+        }
+        VTR_LOG("Routing at %d channels %s (%.2f seconds)\n", attempt.width, routable ? "succeeded" : "failed", elapsed);
+
+        if (routable) {
+            if (attempt.width > low && (high == -1 || attempt.width < high)) {
+                high = attempt.width;
+                cancel_attempts([&](int width) { return width > high; });
+            }
+        } else if (high == -1 || attempt.width < high) {
+            if (attempt.width > low) {
+                low = attempt.width;
+                cancel_attempts([&](int width) { return width < low; });
+            }
+        }
+    }
+
+    //Stop any remaining attempts (e.g. if the search finished)
+    cancel_attempts([](int) { return true; });
+
+    VTR_LOG("Concurrent search bounds: [%d, %d]\n", low, high);
+#endif
+}
+
 /**
  * @brief After placement, logical pins for blocks, and nets must be updated to correspond with physical pins of type.
  *
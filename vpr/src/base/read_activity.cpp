@@ -1,4 +1,7 @@
+#include <cstdlib>
 #include <cstring>
+#include <fstream>
+#include <string>
 
 #include "read_activity.h"
 
@@ -9,59 +12,84 @@
 
 #include "atom_netlist.h"
 
-static bool add_activity_to_net(const AtomNetlist& netlist, std::unordered_map<AtomNetId, t_net_power>& atom_net_power, char* net_name, float probability, float density);
+static float parse_activity_value(const char* value, const char* activity_file, int line_num);
 
-static bool add_activity_to_net(const AtomNetlist& netlist, std::unordered_map<AtomNetId, t_net_power>& atom_net_power, char* net_name, float probability, float density) {
-    AtomNetId net_id = netlist.find_net(net_name);
-    if (net_id) {
-        atom_net_power[net_id].probability = probability;
-        atom_net_power[net_id].density = density;
-        return false;
+/**
+ * @brief Converts a probability or density of the activity file
+ *
+ * Like vtr::atof() this rejects values with trailing characters, but without building
+ * a string stream for every value (there are two values per net of the netlist).
+ */
+static float parse_activity_value(const char* value, const char* activity_file, int line_num) {
+    char* end = nullptr;
+    float result = 0.;
+    if (value) {
+        result = std::strtof(value, &end);
     }
 
-    VTR_LOG_WARN(
-        "Net %s found in activity file, but it does not exist in the .blif file.\n",
-        net_name);
-    return true;
+    if (!value || end == value || *end != '\0') {
+        vpr_throw(VPR_ERROR_BLIF_F, activity_file, line_num,
+                  "Failed to convert '%s' to float\n", value ? value : "");
+    }
+    return result;
 }
 
 std::unordered_map<AtomNetId, t_net_power> read_activity(const AtomNetlist& netlist, const char* activity_file) {
-    char buf[vtr::bufsize];
-    char* ptr;
-    char* word1;
-    char* word2;
-    char* word3;
-
-    FILE* act_file_hdl;
-
     std::unordered_map<AtomNetId, t_net_power> atom_net_power;
 
+    atom_net_power.reserve(netlist.nets().size());
     for (auto net_id : netlist.nets()) {
         atom_net_power[net_id].probability = -1.0;
         atom_net_power[net_id].density = -1.0;
     }
 
-    act_file_hdl = vtr::fopen(activity_file, "r");
-    if (act_file_hdl == nullptr) {
+    std::ifstream act_file(activity_file);
+    if (!act_file) {
         VPR_FATAL_ERROR(VPR_ERROR_BLIF_F,
                         "Error: could not open activity file: %s\n", activity_file);
     }
 
-    ptr = vtr::fgets(buf, vtr::bufsize, act_file_hdl);
-    while (ptr != nullptr) {
-        word1 = strtok(buf, TOKENS);
-        word2 = strtok(nullptr, TOKENS);
-        word3 = strtok(nullptr, TOKENS);
-        add_activity_to_net(netlist, atom_net_power, word1, vtr::atof(word2), vtr::atof(word3));
+    //Stream the file a line at a time through a reused buffer, the nets are looked up
+    //by name in the netlist's own string index
+    std::string line;
+    std::string net_name;
+    int line_num = 0;
+    while (std::getline(act_file, line)) {
+        ++line_num;
+
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.resize(comment);
+        }
+
+        char* word1 = strtok(&line[0], TOKENS "\r");
+        if (!word1) {
+            continue; //Blank line
+        }
+        char* word2 = strtok(nullptr, TOKENS "\r");
+        char* word3 = strtok(nullptr, TOKENS "\r");
+        float probability = parse_activity_value(word2, activity_file, line_num);
+        float density = parse_activity_value(word3, activity_file, line_num);
+
+        net_name.assign(word1);
+        AtomNetId net_id = netlist.find_net(net_name);
+        if (!net_id) {
+            VTR_LOG_WARN(
+                "Net %s found in activity file, but it does not exist in the .blif file.\n",
+                word1);
+            continue;
+        }
 
-        ptr = vtr::fgets(buf, vtr::bufsize, act_file_hdl);
+        t_net_power& net_power = atom_net_power[net_id];
+        net_power.probability = probability;
+        net_power.density = density;
     }
-    fclose(act_file_hdl);
 
     /* Make sure all nets have an activity value */
     for (auto net_id : netlist.nets()) {
-        if (atom_net_power[net_id].probability < 0.0
-            || atom_net_power[net_id].density < 0.0) {
+        const t_net_power& net_power = atom_net_power[net_id];
+        if (net_power.probability < 0.0
+            || net_power.density < 0.0) {
             VPR_FATAL_ERROR(VPR_ERROR_BLIF_F,
                             "Error: Activity file does not contain signal %s\n",
                             netlist.net_name(net_id).c_str());
@@ -23,6 +23,7 @@
 
 #include "blifparse.hpp"
 #include "atom_netlist.h"
+#include "atom_netlist_utils.h"
 
 #include "vtr_assert.h"
 #include "vtr_util.h"
@@ -35,6 +36,7 @@
 #include "vpr_error.h"
 #include "globals.h"
 #include "read_blif.h"
+#include "read_blif_parallel.h"
 #include "arch_types.h"
 #include "echo_files.h"
 #include "hash.h"
@@ -135,11 +137,11 @@ struct BlifAllocCallback : public blifparse::Callback {
         VTR_ASSERT_MSG(blk_model->outputs->size == 1, ".names model has non-single-bit output");
 
         //Convert the single-output cover to a netlist truth table
-        AtomNetlist::TruthTable truth_table;
-        for (const auto& row : so_cover) {
-            truth_table.emplace_back();
-            for (auto val : row) {
-                truth_table[truth_table.size() - 1].push_back(to_vtr_logic_value(val));
+        AtomNetlist::TruthTable truth_table(so_cover.size());
+        for (size_t irow = 0; irow < so_cover.size(); ++irow) {
+            truth_table[irow].reserve(so_cover[irow].size());
+            for (auto val : so_cover[irow]) {
+                truth_table[irow].push_back(to_vtr_logic_value(val));
             }
         }
 
@@ -154,10 +156,13 @@ struct BlifAllocCallback : public blifparse::Callback {
             curr_model().create_pin(input_port_id, i, net_id, PinType::SINK);
         }
 
-        //Figure out if the output is a constant generator
+        //Figure out if the output is a constant generator (a function of no inputs, whatever its cover)
         bool output_is_const = false;
-        if (truth_table.empty()
-            || (truth_table.size() == 1 && truth_table[0].size() == 1 && truth_table[0][0] == vtr::LogicValue::FALSE)) {
+        vtr::PackedTruthTable function;
+        if (nets.size() == 1) {
+            function = pack_truth_table(truth_table, 0);
+        }
+        if (nets.size() == 1 && function.is_constant(false)) {
             //An empty truth table in BLIF corresponds to a constant-zero
             //  e.g.
             //
@@ -173,7 +178,7 @@ struct BlifAllocCallback : public blifparse::Callback {
             //
             output_is_const = true;
             VTR_LOG("Found constant-zero generator '%s'\n", nets[nets.size() - 1].c_str());
-        } else if (truth_table.size() == 1 && truth_table[0].size() == 1 && truth_table[0][0] == vtr::LogicValue::TRUE) {
+        } else if (nets.size() == 1 && function.is_constant(true)) {
             //A single-entry truth table with value '1' in BLIF corresponds to a constant-one
             //  e.g.
             //
@@ -740,12 +745,17 @@ bool is_real_param(const std::string& param) {
 AtomNetlist read_blif(e_circuit_format circuit_format,
                       const char* blif_file,
                       const t_model* user_models,
-                      const t_model* library_models) {
+                      const t_model* library_models,
+                      bool parallel_read) {
     AtomNetlist netlist;
     std::string netlist_id = vtr::secure_digest_file(blif_file);
 
     BlifAllocCallback alloc_callback(circuit_format, netlist, netlist_id, user_models, library_models);
-    blifparse::blif_parse_filename(blif_file, alloc_callback);
+    if (parallel_read) {
+        blif_parse_filename_parallel(blif_file, alloc_callback);
+    } else {
+        blifparse::blif_parse_filename(blif_file, alloc_callback);
+    }
 
     return netlist;
 }
@@ -0,0 +1,726 @@
+/**
+ * @file
+ * @brief Parallel BLIF/EBLIF parser
+ *
+ * The file is split into chunks which begin at a .names, .subckt or .latch statement (these
+ * make up nearly all of a flattened netlist). Each chunk is tokenized independently into a list
+ * of statements, and the statements of each chunk are then replayed (in file order) to the
+ * blifparse::Callback, which builds the netlist and resolves the net names.
+ *
+ * With TBB these steps form a pipeline: chunks are found serially, tokenized in parallel and
+ * replayed serially, so tokenization overlaps with building the netlist, and only a bounded
+ * number of tokenized chunks are held in memory at once.
+ *
+ * The tokenizer follows the rules of the blifparse lexer and grammar (blif_lexer.l and blif_parser.y).
+ */
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_pipeline.h>
+#    include <tbb/task_arena.h>
+#endif
+
+#include "vtr_assert.h"
+#include "vtr_util.h"
+
+#include "read_blif_parallel.h"
+
+/* Approximate size of the chunks the file is split into */
+static constexpr size_t BLIF_CHUNK_SIZE = 4 * 1024 * 1024;
+
+namespace {
+
+/* Contents of a BLIF file, memory mapped where supported */
+class BlifFileBuffer {
+  public:
+    explicit BlifFileBuffer(const char* filename);
+    ~BlifFileBuffer();
+
+    BlifFileBuffer(const BlifFileBuffer&) = delete;
+    BlifFileBuffer& operator=(const BlifFileBuffer&) = delete;
+
+    ///@brief Returns true if the file was opened
+    bool ok() const { return ok_; }
+
+    const char* begin() const { return data_; }
+    const char* end() const { return data_ + size_; }
+
+  private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool ok_ = false;
+    bool mapped_ = false;
+    std::vector<char> contents_; ///<File contents, if the file could not be mapped
+};
+
+enum class e_blif_statement {
+    MODEL,
+    INPUTS,
+    OUTPUTS,
+    NAMES,
+    SUBCKT,
+    LATCH,
+    BLACKBOX,
+    END,
+    CONN,
+    CNAME,
+    ATTR,
+    PARAM
+};
+
+/* A tokenized BLIF statement */
+struct t_blif_statement {
+    e_blif_statement type;
+    int line; ///<Line of the statement, relative to the start of its chunk
+
+    /* The arguments of the statement:
+     *  - .subckt: the model, followed by the port/net pairs
+     *  - .latch: the input, output and control nets (empty if unspecified)
+     *  - .attr/.param: the name and value (empty if unspecified)
+     *  - Otherwise the strings following the keyword */
+    std::vector<std::string> strings;
+
+    std::vector<std::vector<blifparse::LogicValue>> so_cover; ///<.names single output cover
+
+    blifparse::LatchType latch_type = blifparse::LatchType::UNSPECIFIED;
+    blifparse::LogicValue latch_init = blifparse::LogicValue::UNKOWN;
+};
+
+/* A range of the file, and the statements it contains once tokenized */
+struct t_blif_chunk {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+
+    std::vector<t_blif_statement> statements;
+    int num_lines = 0; ///<Number of line endings in the chunk
+
+    /* The first syntax error in the chunk (if any). It is reported once the
+     * statements preceding it have been replayed, as the serial parser would. */
+    bool has_error = false;
+    int error_line = 0;
+    std::string error_near_text;
+    std::string error_msg;
+};
+
+/* Tokenizes the statements of a chunk */
+class BlifChunkParser {
+  public:
+    explicit BlifChunkParser(t_blif_chunk& chunk)
+        : chunk_(chunk)
+        , pos_(chunk.begin) {}
+
+    void parse();
+
+  private:
+    enum class e_token_type {
+        STRING,
+        EQ
+    };
+
+    struct t_token {
+        e_token_type type;
+        std::string_view text;
+    };
+
+    bool next_line();
+    void parse_statement(e_blif_statement type);
+    void parse_so_cover_row();
+    bool is_line_continuation(const char* p) const;
+    bool is_string(size_t itoken) const;
+    void error(int line, std::string_view near_text, const char* msg);
+
+    t_blif_chunk& chunk_;
+    const char* pos_;
+    int line_ = 0;       ///<Current line, relative to the start of the chunk
+    int token_line_ = 0; ///<Line of the first token of the current line
+    std::vector<t_token> tokens_;
+};
+
+/* Passes the statements of each chunk to the callback */
+class BlifChunkReplayer {
+  public:
+    explicit BlifChunkReplayer(blifparse::Callback& callback)
+        : callback_(callback) {}
+
+    void replay(t_blif_chunk& chunk);
+
+    ///@brief Returns true if a syntax error was reported
+    bool failed() const { return failed_; }
+
+  private:
+    blifparse::Callback& callback_;
+    int line_offset_ = 0; ///<Number of lines in the chunks replayed so far
+    bool failed_ = false;
+};
+
+} // namespace
+
+static const char* find_chunk_end(const char* begin, const char* file_begin, const char* file_end);
+static bool starts_chunk(const char* line, const char* file_begin, const char* file_end);
+
+void blif_parse_filename_parallel(const char* filename, blifparse::Callback& callback) {
+    BlifFileBuffer file(filename);
+    if (!file.ok()) {
+        callback.parse_error(0, "", vtr::string_fmt("Could not open file '%s'.\n", filename));
+        return;
+    }
+
+    callback.start_parse();
+    callback.filename(filename);
+
+    BlifChunkReplayer replayer(callback);
+
+    const char* next_chunk_begin = file.begin();
+    auto next_chunk = [&]() {
+        std::shared_ptr<t_blif_chunk> chunk;
+        if (next_chunk_begin != file.end()) {
+            chunk = std::make_shared<t_blif_chunk>();
+            chunk->begin = next_chunk_begin;
+            chunk->end = find_chunk_end(next_chunk_begin, file.begin(), file.end());
+            next_chunk_begin = chunk->end;
+        }
+        return chunk;
+    };
+
+#ifdef VPR_USE_TBB
+    size_t max_live_chunks = 2 * tbb::this_task_arena::max_concurrency();
+
+    tbb::parallel_pipeline(max_live_chunks,
+                           tbb::make_filter<void, std::shared_ptr<t_blif_chunk>>(tbb::filter_mode::serial_in_order,
+                                                                                 [&](tbb::flow_control& fc) {
+                                                                                     auto chunk = next_chunk();
+                                                                                     if (!chunk) {
+                                                                                         fc.stop();
+                                                                                     }
+                                                                                     return chunk;
+                                                                                 })
+                               & tbb::make_filter<std::shared_ptr<t_blif_chunk>, std::shared_ptr<t_blif_chunk>>(tbb::filter_mode::parallel,
+                                                                                                                [](std::shared_ptr<t_blif_chunk> chunk) {
+                                                                                                                    BlifChunkParser(*chunk).parse();
+                                                                                                                    return chunk;
+                                                                                                                })
+                               & tbb::make_filter<std::shared_ptr<t_blif_chunk>, void>(tbb::filter_mode::serial_in_order,
+                                                                                       [&](std::shared_ptr<t_blif_chunk> chunk) {
+                                                                                           replayer.replay(*chunk);
+                                                                                       }));
+#else
+    for (auto chunk = next_chunk(); chunk; chunk = next_chunk()) {
+        BlifChunkParser(*chunk).parse();
+        replayer.replay(*chunk);
+    }
+#endif
+
+    if (replayer.failed()) {
+        callback.parse_error(0, "", "File failed to parse.\n");
+    }
+
+    callback.finish_parse();
+}
+
+/* Returns the end of the chunk starting at begin: the start of the first line beginning a
+ * .names/.subckt/.latch statement at least BLIF_CHUNK_SIZE bytes later (or the end of the file) */
+static const char* find_chunk_end(const char* begin, const char* file_begin, const char* file_end) {
+    if (size_t(file_end - begin) <= BLIF_CHUNK_SIZE) {
+        return file_end;
+    }
+
+    const char* pos = begin + BLIF_CHUNK_SIZE;
+    while (true) {
+        pos = static_cast<const char*>(std::memchr(pos, '\n', file_end - pos));
+        if (!pos) {
+            return file_end;
+        }
+        ++pos; //Start of the next line
+
+        if (starts_chunk(pos, file_begin, file_end)) {
+            return pos;
+        }
+    }
+}
+
+/* Returns true if a chunk can start at line, i.e. line begins a .names, .subckt or .latch
+ * statement (and is not the continuation of the previous line) */
+static bool starts_chunk(const char* line, const char* file_begin, const char* file_end) {
+    //Is the previous line continued onto this one?
+    const char* prev_end = line - 1; //The previous line's '\n'
+    if (prev_end > file_begin && prev_end[-1] == '\r') {
+        --prev_end;
+    }
+    if (prev_end > file_begin && prev_end[-1] == '\\') {
+        return false;
+    }
+
+    const char* pos = line;
+    while (pos != file_end && (*pos == ' ' || *pos == '\t')) {
+        ++pos;
+    }
+
+    for (const char* keyword : {".names", ".subckt", ".latch"}) {
+        size_t len = std::strlen(keyword);
+        if (size_t(file_end - pos) > len && std::memcmp(pos, keyword, len) == 0) {
+            char next = pos[len];
+            if (next == ' ' || next == '\t' || next == '\r' || next == '\n') {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+namespace {
+
+BlifFileBuffer::BlifFileBuffer(const char* filename) {
+#ifndef _WIN32
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == 0) {
+        size_ = file_stat.st_size;
+        if (size_ == 0) {
+            ok_ = true;
+        } else {
+            void* addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                data_ = static_cast<const char*>(addr);
+                mapped_ = true;
+                ok_ = true;
+            }
+        }
+    }
+    close(fd);
+
+    if (ok_) {
+        return;
+    }
+#endif
+
+    //Fall back to reading the whole file
+    FILE* infile = std::fopen(filename, "rb");
+    if (!infile) {
+        return;
+    }
+
+    char buf[64 * 1024];
+    size_t num_read;
+    while ((num_read = std::fread(buf, 1, sizeof(buf), infile)) > 0) {
+        contents_.insert(contents_.end(), buf, buf + num_read);
+    }
+    std::fclose(infile);
+
+    data_ = contents_.data();
+    size_ = contents_.size();
+    ok_ = true;
+}
+
+BlifFileBuffer::~BlifFileBuffer() {
+#ifndef _WIN32
+    if (mapped_) {
+        munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+}
+
+void BlifChunkParser::parse() {
+    //Whether cover rows (which belong to the preceding .names) may follow
+    bool in_names = false;
+
+    while (!chunk_.has_error && next_line()) {
+        if (tokens_.empty()) {
+            //A comment line, which ends any .names cover (as in the serial parser)
+            in_names = false;
+            continue;
+        }
+
+        std::string_view keyword = tokens_[0].text;
+        if (tokens_[0].type != e_token_type::STRING || keyword[0] != '.') {
+            if (in_names) {
+                parse_so_cover_row();
+            } else {
+                error(token_line_, keyword, "syntax error");
+            }
+            continue;
+        }
+
+        in_names = false;
+        if (keyword == ".names") {
+            parse_statement(e_blif_statement::NAMES);
+            in_names = true;
+        } else if (keyword == ".subckt") {
+            parse_statement(e_blif_statement::SUBCKT);
+        } else if (keyword == ".latch") {
+            parse_statement(e_blif_statement::LATCH);
+        } else if (keyword == ".model") {
+            parse_statement(e_blif_statement::MODEL);
+        } else if (keyword == ".inputs") {
+            parse_statement(e_blif_statement::INPUTS);
+        } else if (keyword == ".outputs") {
+            parse_statement(e_blif_statement::OUTPUTS);
+        } else if (keyword == ".end") {
+            parse_statement(e_blif_statement::END);
+        } else if (keyword == ".blackbox") {
+            parse_statement(e_blif_statement::BLACKBOX);
+        } else if (keyword == ".conn") {
+            parse_statement(e_blif_statement::CONN);
+        } else if (keyword == ".cname") {
+            parse_statement(e_blif_statement::CNAME);
+        } else if (keyword == ".attr") {
+            parse_statement(e_blif_statement::ATTR);
+        } else if (keyword == ".param") {
+            parse_statement(e_blif_statement::PARAM);
+        } else {
+            error(token_line_, keyword, "syntax error");
+        }
+    }
+
+    chunk_.num_lines = line_;
+}
+
+/* Reads the tokens of the next (logical) line into tokens_, joining continued lines.
+ * Returns false at the end of the chunk, or on error. Blank lines are skipped, while
+ * comment lines are returned without tokens. */
+bool BlifChunkParser::next_line() {
+    tokens_.clear();
+
+    const char* end = chunk_.end;
+    while (pos_ != end) {
+        char c = *pos_;
+        if (c == ' ' || c == '\t' || c == '\r') {
+            ++pos_;
+        } else if (c == '\n') {
+            ++pos_;
+            ++line_;
+            if (!tokens_.empty()) {
+                return true;
+            }
+        } else if (c == '#') {
+            //Comments extend to the end of the line, and end it
+            const char* eol = static_cast<const char*>(std::memchr(pos_, '\n', end - pos_));
+            if (eol) {
+                pos_ = eol + 1;
+                ++line_;
+            } else {
+                pos_ = end;
+            }
+            return true;
+        } else if (c == '\\' && is_line_continuation(pos_)) {
+            pos_ = static_cast<const char*>(std::memchr(pos_, '\n', end - pos_)) + 1;
+            ++line_;
+
+            //A continuation followed by a blank line ends the line
+            const char* next = pos_;
+            while (next != end && (*next == ' ' || *next == '\t' || *next == '\r')) {
+                ++next;
+            }
+            if (next != end && *next == '\n') {
+                pos_ = next + 1;
+                ++line_;
+                return true;
+            }
+        } else {
+            if (tokens_.empty()) {
+                token_line_ = line_;
+            }
+
+            if (c == '=') {
+                tokens_.push_back({e_token_type::EQ, std::string_view(pos_, 1)});
+                ++pos_;
+            } else if (c == '"') {
+                //Quoted strings (including the quotes) end on the same line
+                const char* close = pos_ + 1;
+                while (close != end && *close != '"' && *close != '\n' && *close != '\r') {
+                    ++close;
+                }
+                if (close == end || *close != '"') {
+                    error(line_, std::string_view(pos_, 1), "Unrecognized character");
+                    return false;
+                }
+                tokens_.push_back({e_token_type::STRING, std::string_view(pos_, close + 1 - pos_)});
+                pos_ = close + 1;
+            } else {
+                const char* start = pos_;
+                while (pos_ != end && *pos_ != ' ' && *pos_ != '\t' && *pos_ != '\r' && *pos_ != '\n'
+                       && *pos_ != '=' && *pos_ != '"') {
+                    ++pos_;
+                }
+
+                //Strings may contain, but not end with, a backslash: the only
+                //backslash allowed at the end of a string is a line continuation
+                if (pos_[-1] == '\\') {
+                    if (pos_ - 1 != start && pos_[-2] != '\\' && is_line_continuation(pos_ - 1)) {
+                        --pos_;
+                    } else {
+                        error(line_, std::string_view(pos_ - 1, 1), "Unrecognized character");
+                        return false;
+                    }
+                }
+                tokens_.push_back({e_token_type::STRING, std::string_view(start, pos_ - start)});
+            }
+        }
+    }
+
+    //The last line may not be terminated
+    return !tokens_.empty();
+}
+
+/* Creates a statement of the given type from the tokens of the current line */
+void BlifChunkParser::parse_statement(e_blif_statement type) {
+    size_t num_args = tokens_.size() - 1;
+
+    t_blif_statement statement;
+    statement.type = type;
+    statement.line = token_line_;
+
+    bool valid = true;
+    switch (type) {
+        case e_blif_statement::MODEL:
+        case e_blif_statement::CNAME:
+            valid = (num_args == 1 && is_string(1));
+            break;
+        case e_blif_statement::CONN:
+            valid = (num_args == 2 && is_string(1) && is_string(2));
+            break;
+        case e_blif_statement::ATTR:
+        case e_blif_statement::PARAM:
+            valid = (num_args == 1 || num_args == 2) && is_string(1) && (num_args == 1 || is_string(2));
+            break;
+        case e_blif_statement::BLACKBOX:
+        case e_blif_statement::END:
+            valid = (num_args == 0);
+            break;
+        case e_blif_statement::INPUTS:
+        case e_blif_statement::OUTPUTS:
+        case e_blif_statement::NAMES:
+            for (size_t i = 1; i < tokens_.size(); ++i) {
+                valid &= is_string(i);
+            }
+            break;
+        case e_blif_statement::SUBCKT:
+            //The model, followed by port=net connections
+            valid = (num_args >= 1 && (num_args - 1) % 3 == 0 && is_string(1));
+            for (size_t i = 2; valid && i < tokens_.size(); i += 3) {
+                valid = is_string(i) && tokens_[i + 1].type == e_token_type::EQ && is_string(i + 2);
+            }
+            break;
+        case e_blif_statement::LATCH: {
+            //Input and output, optionally followed by the type and control, and/or the initial value
+            auto is_latch_init = [&](size_t i) {
+                return tokens_[i].text == "0" || tokens_[i].text == "1" || tokens_[i].text == "2" || tokens_[i].text == "3";
+            };
+            auto is_latch_type = [&](size_t i) {
+                return tokens_[i].text == "fe" || tokens_[i].text == "re" || tokens_[i].text == "ah" || tokens_[i].text == "al" || tokens_[i].text == "as";
+            };
+            auto is_latch_control = [&](size_t i) {
+                return tokens_[i].text == "NIL" || (is_string(i) && !is_latch_init(i) && !is_latch_type(i));
+            };
+            auto is_latch_net = [&](size_t i) {
+                return is_latch_control(i) && tokens_[i].text != "NIL";
+            };
+
+            valid = (num_args >= 2 && is_latch_net(1) && is_latch_net(2));
+            if (valid && num_args == 3) {
+                valid = is_latch_init(3);
+            } else if (valid && num_args >= 4) {
+                valid = num_args <= 5 && is_latch_type(3) && is_latch_control(4) && (num_args == 4 || is_latch_init(5));
+            }
+            if (!valid) {
+                break;
+            }
+
+            statement.strings.emplace_back(tokens_[1].text);
+            statement.strings.emplace_back(tokens_[2].text);
+            statement.strings.emplace_back();
+            if (num_args >= 4) {
+                std::string_view latch_type = tokens_[3].text;
+                if (latch_type == "fe") {
+                    statement.latch_type = blifparse::LatchType::FALLING_EDGE;
+                } else if (latch_type == "re") {
+                    statement.latch_type = blifparse::LatchType::RISING_EDGE;
+                } else if (latch_type == "ah") {
+                    statement.latch_type = blifparse::LatchType::ACTIVE_HIGH;
+                } else if (latch_type == "al") {
+                    statement.latch_type = blifparse::LatchType::ACTIVE_LOW;
+                } else {
+                    statement.latch_type = blifparse::LatchType::ASYNCHRONOUS;
+                }
+
+                if (tokens_[4].text != "NIL") {
+                    statement.strings[2] = std::string(tokens_[4].text);
+                }
+            }
+            if (num_args == 3 || num_args == 5) {
+                char latch_init = tokens_[num_args].text[0];
+                if (latch_init == '0') {
+                    statement.latch_init = blifparse::LogicValue::FALSE;
+                } else if (latch_init == '1') {
+                    statement.latch_init = blifparse::LogicValue::TRUE;
+                } else if (latch_init == '2') {
+                    statement.latch_init = blifparse::LogicValue::DONT_CARE;
+                } else {
+                    statement.latch_init = blifparse::LogicValue::UNKOWN;
+                }
+            }
+            break;
+        }
+    }
+
+    if (!valid) {
+        error(token_line_, tokens_[0].text, "syntax error");
+        return;
+    }
+
+    if (type != e_blif_statement::LATCH) {
+        statement.strings.reserve(tokens_.size() - 1);
+        for (size_t i = 1; i < tokens_.size(); ++i) {
+            if (tokens_[i].type == e_token_type::STRING) {
+                statement.strings.emplace_back(tokens_[i].text);
+            }
+        }
+        if ((type == e_blif_statement::ATTR || type == e_blif_statement::PARAM) && num_args == 1) {
+            statement.strings.emplace_back(); //No value
+        }
+    }
+
+    chunk_.statements.push_back(std::move(statement));
+}
+
+/* Adds the current line as a row of the single output cover of the preceding .names */
+void BlifChunkParser::parse_so_cover_row() {
+    t_blif_statement& names = chunk_.statements.back();
+
+    std::vector<blifparse::LogicValue> row;
+    row.reserve(names.strings.size());
+    for (const t_token& token : tokens_) {
+        for (char c : token.text) {
+            if (c == '0') {
+                row.push_back(blifparse::LogicValue::FALSE);
+            } else if (c == '1') {
+                row.push_back(blifparse::LogicValue::TRUE);
+            } else if (c == '-') {
+                row.push_back(blifparse::LogicValue::DONT_CARE);
+            } else {
+                error(token_line_, token.text, "Unrecognized character");
+                return;
+            }
+        }
+    }
+
+    if (row.size() != names.strings.size()) {
+        error(token_line_, tokens_.back().text,
+              vtr::string_fmt("Mismatched .names single-output cover row."
+                              " names connected to %zu net(s), but cover row has %zu element(s)",
+                              names.strings.size(), row.size())
+                  .c_str());
+        return;
+    }
+
+    names.so_cover.push_back(std::move(row));
+}
+
+/* Returns true if p points to a backslash ending the line */
+bool BlifChunkParser::is_line_continuation(const char* p) const {
+    const char* end = chunk_.end;
+    VTR_ASSERT_SAFE(*p == '\\');
+    if (p + 1 != end && p[1] == '\n') {
+        return true;
+    }
+    return p + 2 < end && p[1] == '\r' && p[2] == '\n';
+}
+
+bool BlifChunkParser::is_string(size_t itoken) const {
+    return tokens_[itoken].type == e_token_type::STRING;
+}
+
+void BlifChunkParser::error(int line, std::string_view near_text, const char* msg) {
+    if (!chunk_.has_error) {
+        chunk_.has_error = true;
+        chunk_.error_line = line;
+        chunk_.error_near_text = std::string(near_text);
+        chunk_.error_msg = msg;
+    }
+}
+
+void BlifChunkReplayer::replay(t_blif_chunk& chunk) {
+    if (failed_) {
+        return;
+    }
+
+    for (t_blif_statement& statement : chunk.statements) {
+        std::vector<std::string>& strings = statement.strings;
+
+        callback_.lineno(line_offset_ + statement.line + 1);
+        switch (statement.type) {
+            case e_blif_statement::MODEL:
+                callback_.begin_model(std::move(strings[0]));
+                break;
+            case e_blif_statement::INPUTS:
+                callback_.inputs(std::move(strings));
+                break;
+            case e_blif_statement::OUTPUTS:
+                callback_.outputs(std::move(strings));
+                break;
+            case e_blif_statement::NAMES:
+                callback_.names(std::move(strings), std::move(statement.so_cover));
+                break;
+            case e_blif_statement::SUBCKT: {
+                std::vector<std::string> ports;
+                std::vector<std::string> nets;
+                ports.reserve(strings.size() / 2);
+                nets.reserve(strings.size() / 2);
+                for (size_t i = 1; i + 1 < strings.size(); i += 2) {
+                    ports.push_back(std::move(strings[i]));
+                    nets.push_back(std::move(strings[i + 1]));
+                }
+                callback_.subckt(std::move(strings[0]), std::move(ports), std::move(nets));
+                break;
+            }
+            case e_blif_statement::LATCH:
+                callback_.latch(std::move(strings[0]), std::move(strings[1]), statement.latch_type, std::move(strings[2]), statement.latch_init);
+                break;
+            case e_blif_statement::BLACKBOX:
+                callback_.blackbox();
+                break;
+            case e_blif_statement::END:
+                callback_.end_model();
+                break;
+            case e_blif_statement::CONN:
+                callback_.conn(std::move(strings[0]), std::move(strings[1]));
+                break;
+            case e_blif_statement::CNAME:
+                callback_.cname(std::move(strings[0]));
+                break;
+            case e_blif_statement::ATTR:
+                callback_.attr(std::move(strings[0]), std::move(strings[1]));
+                break;
+            case e_blif_statement::PARAM:
+                callback_.param(std::move(strings[0]), std::move(strings[1]));
+                break;
+        }
+    }
+
+    if (chunk.has_error) {
+        failed_ = true;
+        callback_.parse_error(line_offset_ + chunk.error_line + 1, chunk.error_near_text, chunk.error_msg);
+    }
+
+    line_offset_ += chunk.num_lines;
+
+    //Release the statements' memory as soon as they are consumed
+    chunk.statements = std::vector<t_blif_statement>();
+}
+
+} // namespace
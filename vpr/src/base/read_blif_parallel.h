@@ -0,0 +1,20 @@
+#ifndef READ_BLIF_PARALLEL_H
+#define READ_BLIF_PARALLEL_H
+
+#include "blifparse.hpp"
+
+/**
+ * @brief Parses the BLIF/EBLIF file filename, calling callback for each statement
+ *
+ * This is a drop-in replacement for blifparse::blif_parse_filename() aimed at large
+ * flattened netlists. The (memory mapped) file is split into chunks at .names/.subckt/.latch
+ * statements, the chunks are tokenized in parallel (when built with TBB), and the resulting
+ * statements are passed to the callback serially and in file order, so the callback sees
+ * the same sequence of calls as with the flex/bison parser.
+ *
+ * The only difference is that the line number reported for a statement is that of its
+ * first (rather than last) line.
+ */
+void blif_parse_filename_parallel(const char* filename, blifparse::Callback& callback);
+
+#endif /* READ_BLIF_PARALLEL_H */
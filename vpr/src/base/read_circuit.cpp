@@ -1,9 +1,11 @@
 #include "read_circuit.h"
 #include "read_blif.h"
 #include "read_interchange_netlist.h"
+#include "atom_netlist_binary.h"
 #include "atom_netlist.h"
 #include "atom_netlist_utils.h"
 #include "echo_files.h"
+#include "binary_file_io.h"
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -27,13 +29,8 @@ AtomNetlist read_and_process_circuit(e_circuit_format circuit_format, t_vpr_setu
     const char* circuit_file = vpr_setup.PackerOpts.circuit_file_name.c_str();
     const t_model* user_models = vpr_setup.user_models;
     const t_model* library_models = vpr_setup.library_models;
-    e_const_gen_inference const_gen_inference = vpr_setup.NetlistOpts.const_gen_inference;
-    bool should_absorb_buffers = vpr_setup.NetlistOpts.absorb_buffer_luts;
-    bool should_sweep_dangling_primary_ios = vpr_setup.NetlistOpts.sweep_dangling_primary_ios;
-    bool should_sweep_dangling_nets = vpr_setup.NetlistOpts.sweep_dangling_nets;
-    bool should_sweep_dangling_blocks = vpr_setup.NetlistOpts.sweep_dangling_blocks;
-    bool should_sweep_constant_primary_outputs = vpr_setup.NetlistOpts.sweep_constant_primary_outputs;
     int verbosity = vpr_setup.NetlistOpts.netlist_verbosity;
+    bool parallel_blif_read = vpr_setup.NetlistOpts.parallel_blif_read;
 
     if (circuit_format == e_circuit_format::AUTO) {
         auto name_ext = vtr::split_ext(circuit_file);
@@ -43,8 +40,10 @@ AtomNetlist read_and_process_circuit(e_circuit_format circuit_format, t_vpr_setu
             circuit_format = e_circuit_format::BLIF;
         } else if (name_ext[1] == ".eblif") {
             circuit_format = e_circuit_format::EBLIF;
+        } else if (is_binary_file_name(circuit_file)) {
+            circuit_format = e_circuit_format::BINARY;
         } else {
-            VPR_FATAL_ERROR(VPR_ERROR_ATOM_NETLIST, "Failed to determine file format for '%s' expected .blif or .eblif extension",
+            VPR_FATAL_ERROR(VPR_ERROR_ATOM_NETLIST, "Failed to determine file format for '%s' expected .blif, .eblif or .bin extension",
                             circuit_file);
         }
     }
@@ -56,19 +55,40 @@ AtomNetlist read_and_process_circuit(e_circuit_format circuit_format, t_vpr_setu
         switch (circuit_format) {
             case e_circuit_format::BLIF:
             case e_circuit_format::EBLIF:
-                netlist = read_blif(circuit_format, circuit_file, user_models, library_models);
+                netlist = read_blif(circuit_format, circuit_file, user_models, library_models, parallel_blif_read);
                 break;
             case e_circuit_format::FPGA_INTERCHANGE:
                 netlist = read_interchange_netlist(circuit_file, arch);
                 break;
+            case e_circuit_format::BINARY:
+                netlist = read_atom_netlist_binary(circuit_file, user_models, library_models);
+                break;
             default:
                 VPR_FATAL_ERROR(VPR_ERROR_ATOM_NETLIST,
-                                "Unable to identify circuit file format for '%s'. Expect [blif|eblif|fpga-interchange]!\n",
+                                "Unable to identify circuit file format for '%s'. Expect [blif|eblif|fpga-interchange|binary]!\n",
                                 circuit_file);
                 break;
         }
     }
 
+    if (!vpr_setup.FileNameOpts.write_circuit_binary.empty()) {
+        write_atom_netlist_binary(netlist, vpr_setup.FileNameOpts.write_circuit_binary.c_str());
+    }
+
+    process_atom_circuit(netlist, vpr_setup);
+
+    return netlist;
+}
+
+void process_atom_circuit(AtomNetlist& netlist, const t_vpr_setup& vpr_setup) {
+    e_const_gen_inference const_gen_inference = vpr_setup.NetlistOpts.const_gen_inference;
+    bool should_absorb_buffers = vpr_setup.NetlistOpts.absorb_buffer_luts;
+    bool should_sweep_dangling_primary_ios = vpr_setup.NetlistOpts.sweep_dangling_primary_ios;
+    bool should_sweep_dangling_nets = vpr_setup.NetlistOpts.sweep_dangling_nets;
+    bool should_sweep_dangling_blocks = vpr_setup.NetlistOpts.sweep_dangling_blocks;
+    bool should_sweep_constant_primary_outputs = vpr_setup.NetlistOpts.sweep_constant_primary_outputs;
+    int verbosity = vpr_setup.NetlistOpts.netlist_verbosity;
+
     if (isEchoFileEnabled(E_ECHO_ATOM_NETLIST_ORIG)) {
         print_netlist_as_blif(getEchoFileName(E_ECHO_ATOM_NETLIST_ORIG), netlist);
     }
@@ -87,8 +107,6 @@ AtomNetlist read_and_process_circuit(e_circuit_format circuit_format, t_vpr_setu
     }
 
     show_circuit_stats(netlist);
-
-    return netlist;
 }
 
 static void process_circuit(AtomNetlist& netlist,
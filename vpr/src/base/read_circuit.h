@@ -8,8 +8,19 @@ enum class e_circuit_format {
     AUTO,            ///<Infer from file extension
     BLIF,            ///<Strict structural BLIF
     EBLIF,           ///<Structural blif with extensions
-    FPGA_INTERCHANGE ///<FPGA Interhange logical netlis format
+    FPGA_INTERCHANGE, ///<FPGA Interhange logical netlis format
+    BINARY            ///<Binary atom netlist (see atom_netlist_binary.h)
 };
 
 AtomNetlist read_and_process_circuit(e_circuit_format circuit_format, t_vpr_setup& vpr_setup, t_arch& arch);
+
+/**
+ * @brief Cleans up (sweeps, absorbs buffers, ...) an atom netlist built in memory, as
+ *        read_and_process_circuit() does for the netlists it reads.
+ *
+ * This lets a synthesis tool linked with VPR hand its netlist over directly, without
+ * writing and re-parsing a BLIF (see vpr_init_with_options()). The netlist's blocks must
+ * use the models of vpr_setup.
+ */
+void process_atom_circuit(AtomNetlist& netlist, const t_vpr_setup& vpr_setup);
 #endif
@@ -15,18 +15,16 @@
 
 #    include <cmath>
 #    include <limits>
-#    include <kj/std/iostream.h>
 #    include <regex>
 #    include <string>
 #    include <unordered_map>
 #    include <unordered_set>
-#    include <zlib.h>
 #    include <iostream>
-#    include <sstream>
 
 #    include "LogicalNetlist.capnp.h"
 #    include "capnp/serialize.h"
 #    include "capnp/serialize-packed.h"
+#    include "capnp_message_file.h"
 
 #    include "vtr_assert.h"
 #    include "vtr_hash.h"
@@ -532,39 +530,13 @@ AtomNetlist read_interchange_netlist(const char* ic_netlist_file,
     AtomNetlist netlist;
     std::string netlist_id = vtr::secure_digest_file(ic_netlist_file);
 
-    // Decompress GZipped capnproto device file
-    gzFile file = gzopen(ic_netlist_file, "r");
-    VTR_ASSERT(file != Z_NULL);
-
-    std::vector<uint8_t> output_data;
-    output_data.resize(4096);
-    std::stringstream sstream(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
-    while (true) {
-        int ret = gzread(file, output_data.data(), output_data.size());
-        VTR_ASSERT(ret >= 0);
-        if (ret > 0) {
-            sstream.write((const char*)output_data.data(), ret);
-            VTR_ASSERT(sstream);
-        } else {
-            VTR_ASSERT(ret == 0);
-            int error;
-            gzerror(file, &error);
-            VTR_ASSERT(error == Z_OK);
-            break;
-        }
-    }
-
-    VTR_ASSERT(gzclose(file) == Z_OK);
-
-    sstream.seekg(0);
-    kj::std::StdInputStream istream(sstream);
-
     // Reader options
     capnp::ReaderOptions reader_options;
     reader_options.nestingLimit = std::numeric_limits<int>::max();
     reader_options.traversalLimitInWords = std::numeric_limits<uint64_t>::max();
 
-    capnp::InputStreamMessageReader message_reader(istream, reader_options);
+    // The file is usually gzip compressed, but uncompressed files are memory mapped and read in place
+    CapnpMessageFile message_reader(ic_netlist_file, reader_options);
 
     auto netlist_reader = message_reader.getRoot<LogicalNetlist::Netlist>();
 
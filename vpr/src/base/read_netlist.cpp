@@ -4,12 +4,16 @@
  * @date    May 2009
  *
  * @brief Read a circuit netlist in XML format and populate the netlist data structures for VPR
+ *
+ * Binary packed netlists (see packed_netlist.capnp) are converted from, and loaded exactly
+ * like, the .net XML files, but are read in place from a memory mapped file.
  */
 
 #include <cstdio>
 #include <cstring>
 #include <ctime>
 #include <map>
+#include <unordered_map>
 
 #include "pugixml.hpp"
 #include "pugixml_loc.hpp"
@@ -21,6 +25,7 @@
 #include "vtr_digest.h"
 #include "vtr_memory.h"
 #include "vtr_token.h"
+#include "vtr_time.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -33,16 +38,196 @@
 #include "read_netlist.h"
 #include "pb_type_graph.h"
 
+#ifdef VTR_ENABLE_CAPNPROTO
+#    include "capnp/serialize.h"
+#    include "packed_netlist.capnp.h"
+#    include "mmap_file.h"
+#    include "serdes_utils.h"
+#else
+#    define DISABLE_ERROR                               \
+        "is disabled because VTR_ENABLE_CAPNPROTO=OFF." \
+        "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
+#endif /* VTR_ENABLE_CAPNPROTO */
+
 static const char* netlist_file_name = nullptr;
 
-static void processPorts(pugi::xml_node Parent, t_pb* pb, t_pb_routes& pb_route, const pugiutil::loc_data& loc_data);
+/**
+ * @brief An element of a packed netlist loaded from a .net XML file
+ *
+ * The netlist is processed through this interface (shared with BinaryNetlistNode),
+ * so that .net files and binary packed netlists are loaded by the same code.
+ */
+class XmlNetlistNode {
+  public:
+    XmlNetlistNode(pugi::xml_node node, const pugiutil::loc_data* loc_data)
+        : node_(node)
+        , loc_data_(loc_data) {}
+
+    explicit operator bool() const { return bool(node_); }
+
+    const char* name() const { return node_.name(); }
+    const char* text() const { return node_.text().get(); }
+    int line() const { return loc_data_->line(node_); }
+
+    ///@brief Returns the value of the attribute attr_name, or default_value if it does not exist
+    const char* attribute(const char* attr_name, const char* default_value = nullptr) const {
+        auto attr = node_.attribute(attr_name);
+        return attr ? attr.value() : default_value;
+    }
+
+    ///@brief Returns the value of the attribute attr_name, which must exist
+    const char* required_attribute(const char* attr_name) const {
+        return pugiutil::get_attribute(node_, attr_name, *loc_data_).value();
+    }
+
+    XmlNetlistNode child(const char* child_name) const { return XmlNetlistNode(node_.child(child_name), loc_data_); }
+    XmlNetlistNode next_sibling(const char* sibling_name) const { return XmlNetlistNode(node_.next_sibling(sibling_name), loc_data_); }
+
+    XmlNetlistNode first_child(const char* child_name, pugiutil::ReqOpt req_opt = pugiutil::REQUIRED) const {
+        return XmlNetlistNode(pugiutil::get_first_child(node_, child_name, *loc_data_, req_opt), loc_data_);
+    }
+
+    XmlNetlistNode single_child(const char* child_name, pugiutil::ReqOpt req_opt = pugiutil::REQUIRED) const {
+        return XmlNetlistNode(pugiutil::get_single_child(node_, child_name, *loc_data_, req_opt), loc_data_);
+    }
+
+    size_t count_children(const char* child_name, pugiutil::ReqOpt req_opt) const {
+        return pugiutil::count_children(node_, child_name, *loc_data_, req_opt);
+    }
+
+  private:
+    pugi::xml_node node_;
+    const pugiutil::loc_data* loc_data_;
+};
+
+#ifdef VTR_ENABLE_CAPNPROTO
+/* Elements nest two capnp pointers (the children list and the element) deeper than their parent,
+ * which exceeds capnp's default nesting limit of 64 for deep pb hierarchies */
+static constexpr int PACKED_NETLIST_BINARY_NESTING_LIMIT = 1024;
+
+/**
+ * @brief An element of a binary packed netlist
+ *
+ * Elements are read in place from the (memory mapped) Cap'n Proto message. Binary packed
+ * netlists carry no line numbers, so errors are reported at line 0.
+ */
+class BinaryNetlistNode {
+  public:
+    ///@brief Constructs the root element, names holds the netlist's element and attribute names
+    BinaryNetlistNode(VprPackedNetlistElement::Reader element, const std::vector<const char*>* names)
+        : element_(element)
+        , names_(names)
+        , valid_(true) {}
+
+    explicit operator bool() const { return valid_; }
+
+    const char* name() const { return lookup_name(element_.getName()); }
+    const char* text() const { return element_.getText().cStr(); }
+    int line() const { return 0; }
+
+    ///@brief Returns the value of the attribute attr_name, or default_value if it does not exist
+    const char* attribute(const char* attr_name, const char* default_value = nullptr) const {
+        for (auto attr : element_.getAttributes()) {
+            if (strcmp(lookup_name(attr.getName()), attr_name) == 0) {
+                return attr.getValue().cStr();
+            }
+        }
+        return default_value;
+    }
+
+    ///@brief Returns the value of the attribute attr_name, which must exist
+    const char* required_attribute(const char* attr_name) const {
+        const char* value = attribute(attr_name);
+        if (!value) {
+            throw pugiutil::XmlError(vtr::string_fmt("Expected '%s' attribute on node '%s'", attr_name, name()),
+                                     netlist_file_name, line());
+        }
+        return value;
+    }
+
+    BinaryNetlistNode child(const char* child_name) const {
+        return find_element(element_.getChildren(), 0, child_name);
+    }
+
+    BinaryNetlistNode next_sibling(const char* sibling_name) const {
+        return find_element(siblings_, index_ + 1, sibling_name);
+    }
+
+    BinaryNetlistNode first_child(const char* child_name, pugiutil::ReqOpt req_opt = pugiutil::REQUIRED) const {
+        BinaryNetlistNode first = child(child_name);
+        if (!first && req_opt == pugiutil::REQUIRED) {
+            throw pugiutil::XmlError(vtr::string_fmt("Missing required child node '%s' in parent node '%s'", child_name, name()),
+                                     netlist_file_name, line());
+        }
+        return first;
+    }
+
+    BinaryNetlistNode single_child(const char* child_name, pugiutil::ReqOpt req_opt = pugiutil::REQUIRED) const {
+        BinaryNetlistNode single = first_child(child_name, req_opt);
+        if (single && single.next_sibling(child_name)) {
+            throw pugiutil::XmlError(vtr::string_fmt("Multiple child '%s' nodes found in parent node '%s' (only one expected)", child_name, name()),
+                                     netlist_file_name, line());
+        }
+        return single;
+    }
+
+    size_t count_children(const char* child_name, pugiutil::ReqOpt req_opt) const {
+        size_t count = 0;
+        for (auto cur = first_child(child_name, req_opt); cur; cur = cur.next_sibling(child_name)) {
+            ++count;
+        }
+        return count;
+    }
+
+  private:
+    BinaryNetlistNode() = default;
+
+    const char* lookup_name(uint32_t name_id) const {
+        if (name_id >= names_->size()) {
+            throw pugiutil::XmlError(vtr::string_fmt("Invalid name index %u", name_id), netlist_file_name, line());
+        }
+        return (*names_)[name_id];
+    }
+
+    ///@brief Returns the first element named element_name in elements, starting from index first
+    BinaryNetlistNode find_element(::capnp::List<VprPackedNetlistElement>::Reader elements, unsigned first, const char* element_name) const {
+        for (unsigned i = first; i < elements.size(); ++i) {
+            if (strcmp(lookup_name(elements[i].getName()), element_name) == 0) {
+                BinaryNetlistNode node;
+                node.element_ = elements[i];
+                node.siblings_ = elements;
+                node.index_ = i;
+                node.names_ = names_;
+                node.valid_ = true;
+                return node;
+            }
+        }
+        return BinaryNetlistNode();
+    }
 
-static void processPb(pugi::xml_node Parent, const ClusterBlockId index, t_pb* pb, t_pb_routes& pb_route, int* num_primitives, const pugiutil::loc_data& loc_data, ClusteredNetlist* clb_nlist);
+    VprPackedNetlistElement::Reader element_;
+    ::capnp::List<VprPackedNetlistElement>::Reader siblings_; ///<Elements with the same parent (including this one)
+    unsigned index_ = 0;                                      ///<Index of this element in siblings_
+    const std::vector<const char*>* names_ = nullptr;
+    bool valid_ = false;
+};
 
-static void processComplexBlock(pugi::xml_node Parent,
+static void write_packed_netlist_element(VprPackedNetlistElement::Builder element, pugi::xml_node node, std::unordered_map<std::string, uint32_t>& name_ids);
+#endif /* VTR_ENABLE_CAPNPROTO */
+
+template<typename NetlistNode>
+static void processNetlist(const NetlistNode& top, const t_arch* arch, bool verify_file_digests, int verbosity, ClusteredNetlist& clb_nlist);
+
+template<typename NetlistNode>
+static void processPorts(const NetlistNode& Parent, t_pb* pb, t_pb_routes& pb_route);
+
+template<typename NetlistNode>
+static void processPb(const NetlistNode& Parent, const ClusterBlockId index, t_pb* pb, t_pb_routes& pb_route, int* num_primitives, ClusteredNetlist* clb_nlist);
+
+template<typename NetlistNode>
+static void processComplexBlock(const NetlistNode& Parent,
                                 const ClusterBlockId index,
                                 int* num_primitives,
-                                const pugiutil::loc_data& loc_data,
                                 ClusteredNetlist* clb_nlist);
 
 static int add_net_to_hash(t_hash** nhash, const char* net_name, int* ncount);
@@ -71,151 +256,63 @@ ClusteredNetlist read_netlist(const char* net_file,
                               bool verify_file_digests,
                               int verbosity) {
     clock_t begin = clock();
-    size_t bcount = 0;
-    std::vector<std::string> circuit_inputs, circuit_outputs, circuit_clocks;
 
     auto& atom_ctx = g_vpr_ctx.mutable_atom();
 
-    int num_primitives = 0;
-
     /* Parse the file */
     VTR_LOG("Begin loading packed FPGA netlist file.\n");
 
-    //Save an identifier for the netlist based on it's contents
-    auto clb_nlist = ClusteredNetlist(net_file, vtr::secure_digest_file(net_file));
-
-    pugi::xml_document doc;
-    pugiutil::loc_data loc_data;
-    try {
-        loc_data = pugiutil::load_xml(doc, net_file);
-    } catch (pugiutil::XmlError& e) {
-        vpr_throw(VPR_ERROR_NET_F, net_file, 0,
-                  "Failed to load netlist file '%s' (%s).\n", net_file, e.what());
-    }
-
-    try {
-        /* Save netlist file's name in file-scoped variable */
-        netlist_file_name = net_file;
-
-        /* Root node should be block */
-        auto top = doc.child("block");
-        if (!top) {
-            vpr_throw(VPR_ERROR_NET_F, net_file, loc_data.line(top),
-                      "Root element must be 'block'.\n");
-        }
+    /* Save netlist file's name in file-scoped variable */
+    netlist_file_name = net_file;
 
-        /* Check top-level netlist attributes */
-        auto top_name = top.attribute("name");
-        if (!top_name) {
-            vpr_throw(VPR_ERROR_NET_F, net_file, loc_data.line(top),
-                      "Root element must have a 'name' attribute.\n");
-        }
+    ClusteredNetlist clb_nlist;
+    if (is_packed_netlist_binary(net_file)) {
+#ifdef VTR_ENABLE_CAPNPROTO
+        MmapFile f(net_file);
+        ::capnp::ReaderOptions opts = default_large_capnp_opts();
+        opts.nestingLimit = PACKED_NETLIST_BINARY_NESTING_LIMIT;
+        ::capnp::FlatArrayMessageReader reader(f.getData(), opts);
 
-        VTR_LOG("Netlist generated from file '%s'.\n", top_name.value());
+        auto packed_netlist = reader.getRoot<VprPackedNetlist>();
 
-        //Verify top level attributes
-        auto top_instance = pugiutil::get_attribute(top, "instance", loc_data);
+        //The netlist id is that of the .net file the binary netlist was written from
+        clb_nlist = ClusteredNetlist(net_file, packed_netlist.getNetlistId().cStr());
 
-        if (strcmp(top_instance.value(), "FPGA_packed_netlist[0]") != 0) {
-            vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(top),
-                      "Expected top instance to be \"FPGA_packed_netlist[0]\", found \"%s\".",
-                      top_instance.value());
+        std::vector<const char*> names;
+        for (auto name : packed_netlist.getNames()) {
+            names.push_back(name.cStr());
         }
 
-        auto architecture_id = top.attribute("architecture_id");
-        if (architecture_id) {
-            //Netlist file has an architecture id, make sure it is
-            //consistent with the loaded architecture file.
-            //
-            //Note that we currently don't require that the architecture_id exists,
-            //to remain compatible with old .net files
-            std::string arch_id = architecture_id.value();
-            if (arch_id != arch->architecture_id) {
-                auto msg = vtr::string_fmt(
-                    "Netlist was generated from a different architecture file"
-                    " (loaded architecture ID: %s, netlist file architecture ID: %s)",
-                    arch->architecture_id, arch_id.c_str());
-                if (verify_file_digests) {
-                    vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(top), msg.c_str());
-                } else {
-                    VTR_LOGF_WARN(netlist_file_name, loc_data.line(top), "%s\n", msg.c_str());
-                }
-            }
+        try {
+            processNetlist(BinaryNetlistNode(packed_netlist.getRoot(), &names), arch, verify_file_digests, verbosity, clb_nlist);
+        } catch (pugiutil::XmlError& e) {
+            vpr_throw(VPR_ERROR_NET_F, e.filename_c_str(), e.line(),
+                      "Error loading post-pack netlist (%s)", e.what());
         }
-
-        auto atom_netlist_id = top.attribute("atom_netlist_id");
-        if (atom_netlist_id) {
-            //Netlist file has an_atom netlist_id, make sure it is
-            //consistent with the loaded atom netlist.
-            //
-            //Note that we currently don't require that the atom_netlist_id exists,
-            //to remain compatible with old .net files
-            std::string atom_nl_id = atom_netlist_id.value();
-            if (atom_nl_id != atom_ctx.nlist.netlist_id()) {
-                auto msg = vtr::string_fmt(
-                    "Netlist was generated from a different atom netlist file"
-                    " (loaded atom netlist ID: %s, packed netlist atom netlist ID: %s)",
-                    atom_nl_id.c_str(), atom_ctx.nlist.netlist_id().c_str());
-                if (verify_file_digests) {
-                    vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(top), msg.c_str());
-                } else {
-                    VTR_LOGF_WARN(netlist_file_name, loc_data.line(top), "%s\n", msg.c_str());
-                }
-            }
+#else
+        VPR_THROW(VPR_ERROR_NET_F, "Reading binary packed netlists " DISABLE_ERROR);
+#endif
+    } else {
+        //Save an identifier for the netlist based on it's contents
+        clb_nlist = ClusteredNetlist(net_file, vtr::secure_digest_file(net_file));
+
+        pugi::xml_document doc;
+        pugiutil::loc_data loc_data;
+        try {
+            loc_data = pugiutil::load_xml(doc, net_file);
+        } catch (pugiutil::XmlError& e) {
+            vpr_throw(VPR_ERROR_NET_F, net_file, 0,
+                      "Failed to load netlist file '%s' (%s).\n", net_file, e.what());
         }
 
-        //Collect top level I/Os
-        auto top_inputs = pugiutil::get_single_child(top, "inputs", loc_data);
-        circuit_inputs = vtr::split(top_inputs.text().get());
-
-        auto top_outputs = pugiutil::get_single_child(top, "outputs", loc_data);
-        circuit_outputs = vtr::split(top_outputs.text().get());
-
-        auto top_clocks = pugiutil::get_single_child(top, "clocks", loc_data);
-        circuit_clocks = vtr::split(top_clocks.text().get());
-
-        /* Parse all CLB blocks and all nets*/
-
-        //Reset atom/pb mapping (it is reloaded from the packed netlist file)
-        for (auto blk_id : atom_ctx.nlist.blocks())
-            atom_ctx.lookup.set_atom_pb(blk_id, nullptr);
-
-        //Count the number of blocks for allocation
-        bcount = pugiutil::count_children(top, "block", loc_data, pugiutil::ReqOpt::OPTIONAL);
-        if (bcount == 0)
-            VTR_LOG_WARN("Packed netlist contains no clustered blocks\n");
-
-        /* Process netlist */
-        unsigned i = 0;
-        for (auto curr_block = top.child("block"); curr_block; curr_block = curr_block.next_sibling("block")) {
-            processComplexBlock(curr_block, ClusterBlockId(i), &num_primitives, loc_data, &clb_nlist);
-            i++;
+        try {
+            processNetlist(XmlNetlistNode(doc.child("block"), &loc_data), arch, verify_file_digests, verbosity, clb_nlist);
+        } catch (pugiutil::XmlError& e) {
+            vpr_throw(VPR_ERROR_NET_F, e.filename_c_str(), e.line(),
+                      "Error loading post-pack netlist (%s)", e.what());
         }
-        VTR_ASSERT(bcount == i);
-        VTR_ASSERT(clb_nlist.blocks().size() == i);
-        VTR_ASSERT(num_primitives >= 0);
-        VTR_ASSERT(static_cast<size_t>(num_primitives) == atom_ctx.nlist.blocks().size());
-
-        /* Error check */
-        for (auto blk_id : atom_ctx.nlist.blocks()) {
-            if (atom_ctx.lookup.atom_pb(blk_id) == nullptr) {
-                VPR_FATAL_ERROR(VPR_ERROR_NET_F,
-                                ".blif file and .net file do not match, .net file missing atom %s.\n",
-                                atom_ctx.nlist.block_name(blk_id).c_str());
-            }
-        }
-        /* TODO: Add additional check to make sure net connections match */
-        mark_constant_generators(clb_nlist, verbosity);
-
-        load_external_nets_and_cb(clb_nlist);
-    } catch (pugiutil::XmlError& e) {
-        vpr_throw(VPR_ERROR_NET_F, e.filename_c_str(), e.line(),
-                  "Error loading post-pack netlist (%s)", e.what());
     }
 
-    /* TODO: create this function later
-     * check_top_IO_matches_IO_blocks(circuit_inputs, circuit_outputs, circuit_clocks, blist, bcount); */
-
     /* load mapping between external nets and all nets */
     for (auto net_id : atom_ctx.nlist.nets()) {
         atom_ctx.lookup.set_atom_clb_net(net_id, ClusterNetId::INVALID());
@@ -271,17 +368,145 @@ ClusteredNetlist read_netlist(const char* net_file,
     return clb_nlist;
 }
 
+/**
+ * @brief Loads the packed netlist rooted at top into clb_nlist
+ *
+ * NetlistNode is XmlNetlistNode for .net files, or BinaryNetlistNode for binary packed netlists.
+ */
+template<typename NetlistNode>
+static void processNetlist(const NetlistNode& top, const t_arch* arch, bool verify_file_digests, int verbosity, ClusteredNetlist& clb_nlist) {
+    size_t bcount = 0;
+    std::vector<std::string> circuit_inputs, circuit_outputs, circuit_clocks;
+
+    auto& atom_ctx = g_vpr_ctx.mutable_atom();
+
+    int num_primitives = 0;
+
+    /* Root node should be block */
+    if (!top || strcmp(top.name(), "block") != 0) {
+        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, top.line(),
+                  "Root element must be 'block'.\n");
+    }
+
+    /* Check top-level netlist attributes */
+    const char* top_name = top.attribute("name");
+    if (!top_name) {
+        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, top.line(),
+                  "Root element must have a 'name' attribute.\n");
+    }
+
+    VTR_LOG("Netlist generated from file '%s'.\n", top_name);
+
+    //Verify top level attributes
+    const char* top_instance = top.required_attribute("instance");
+
+    if (strcmp(top_instance, "FPGA_packed_netlist[0]") != 0) {
+        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, top.line(),
+                  "Expected top instance to be \"FPGA_packed_netlist[0]\", found \"%s\".",
+                  top_instance);
+    }
+
+    const char* architecture_id = top.attribute("architecture_id");
+    if (architecture_id) {
+        //Netlist file has an architecture id, make sure it is
+        //consistent with the loaded architecture file.
+        //
+        //Note that we currently don't require that the architecture_id exists,
+        //to remain compatible with old .net files
+        std::string arch_id = architecture_id;
+        if (arch_id != arch->architecture_id) {
+            auto msg = vtr::string_fmt(
+                "Netlist was generated from a different architecture file"
+                " (loaded architecture ID: %s, netlist file architecture ID: %s)",
+                arch->architecture_id, arch_id.c_str());
+            if (verify_file_digests) {
+                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, top.line(), msg.c_str());
+            } else {
+                VTR_LOGF_WARN(netlist_file_name, top.line(), "%s\n", msg.c_str());
+            }
+        }
+    }
+
+    const char* atom_netlist_id = top.attribute("atom_netlist_id");
+    if (atom_netlist_id) {
+        //Netlist file has an_atom netlist_id, make sure it is
+        //consistent with the loaded atom netlist.
+        //
+        //Note that we currently don't require that the atom_netlist_id exists,
+        //to remain compatible with old .net files
+        std::string atom_nl_id = atom_netlist_id;
+        if (atom_nl_id != atom_ctx.nlist.netlist_id()) {
+            auto msg = vtr::string_fmt(
+                "Netlist was generated from a different atom netlist file"
+                " (loaded atom netlist ID: %s, packed netlist atom netlist ID: %s)",
+                atom_nl_id.c_str(), atom_ctx.nlist.netlist_id().c_str());
+            if (verify_file_digests) {
+                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, top.line(), msg.c_str());
+            } else {
+                VTR_LOGF_WARN(netlist_file_name, top.line(), "%s\n", msg.c_str());
+            }
+        }
+    }
+
+    //Collect top level I/Os
+    auto top_inputs = top.single_child("inputs");
+    circuit_inputs = vtr::split(top_inputs.text());
+
+    auto top_outputs = top.single_child("outputs");
+    circuit_outputs = vtr::split(top_outputs.text());
+
+    auto top_clocks = top.single_child("clocks");
+    circuit_clocks = vtr::split(top_clocks.text());
+
+    /* Parse all CLB blocks and all nets*/
+
+    //Reset atom/pb mapping (it is reloaded from the packed netlist file)
+    for (auto blk_id : atom_ctx.nlist.blocks())
+        atom_ctx.lookup.set_atom_pb(blk_id, nullptr);
+
+    //Count the number of blocks for allocation
+    bcount = top.count_children("block", pugiutil::ReqOpt::OPTIONAL);
+    if (bcount == 0)
+        VTR_LOG_WARN("Packed netlist contains no clustered blocks\n");
+
+    /* Process netlist */
+    unsigned i = 0;
+    for (auto curr_block = top.child("block"); curr_block; curr_block = curr_block.next_sibling("block")) {
+        processComplexBlock(curr_block, ClusterBlockId(i), &num_primitives, &clb_nlist);
+        i++;
+    }
+    VTR_ASSERT(bcount == i);
+    VTR_ASSERT(clb_nlist.blocks().size() == i);
+    VTR_ASSERT(num_primitives >= 0);
+    VTR_ASSERT(static_cast<size_t>(num_primitives) == atom_ctx.nlist.blocks().size());
+
+    /* Error check */
+    for (auto blk_id : atom_ctx.nlist.blocks()) {
+        if (atom_ctx.lookup.atom_pb(blk_id) == nullptr) {
+            VPR_FATAL_ERROR(VPR_ERROR_NET_F,
+                            ".blif file and .net file do not match, .net file missing atom %s.\n",
+                            atom_ctx.nlist.block_name(blk_id).c_str());
+        }
+    }
+    /* TODO: Add additional check to make sure net connections match */
+    mark_constant_generators(clb_nlist, verbosity);
+
+    load_external_nets_and_cb(clb_nlist);
+
+    /* TODO: create this function later
+     * check_top_IO_matches_IO_blocks(circuit_inputs, circuit_outputs, circuit_clocks, blist, bcount); */
+}
+
 /**
  * @brief  XML parser to populate CLB info and to update nets with the nets of this CLB
  *
  *   @param clb_nlist  Array of CLBs in the netlist
  *   @param index      index of the CLB to allocate and load information into
- *   @param loc_data   xml location info for error reporting
  */
-static void processComplexBlock(pugi::xml_node clb_block,
+template<typename NetlistNode>
+static void processComplexBlock(const NetlistNode& clb_block,
                                 const ClusterBlockId index,
                                 int* num_primitives,
-                                const pugiutil::loc_data& loc_data,
                                 ClusteredNetlist* clb_nlist) {
     bool found;
     int i, num_tokens = 0;
@@ -292,16 +517,16 @@ static void processComplexBlock(pugi::xml_node clb_block,
     auto& atom_ctx = g_vpr_ctx.mutable_atom();
 
     //Parse cb attributes
-    auto block_name = pugiutil::get_attribute(clb_block, "name", loc_data);
-    auto block_inst = pugiutil::get_attribute(clb_block, "instance", loc_data);
-    tokens = GetTokensFromString(block_inst.value(), &num_tokens);
+    auto block_name = clb_block.required_attribute("name");
+    auto block_inst = clb_block.required_attribute("instance");
+    tokens = GetTokensFromString(block_inst, &num_tokens);
     if (num_tokens != 4 || tokens[0].type != TOKEN_STRING
         || tokens[1].type != TOKEN_OPEN_SQUARE_BRACKET
         || tokens[2].type != TOKEN_INT
         || tokens[3].type != TOKEN_CLOSE_SQUARE_BRACKET) {
-        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(clb_block),
+        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, clb_block.line(),
                   "Unknown syntax for instance %s in %s. Expected pb_type[instance_number].\n",
-                  block_inst.value(), clb_block.name());
+                  block_inst, clb_block.name());
     }
     VTR_ASSERT(ClusterBlockId(vtr::atoi(tokens[2].data)) == index);
 
@@ -309,16 +534,16 @@ static void processComplexBlock(pugi::xml_node clb_block,
     for (const auto& type : device_ctx.logical_block_types) {
         if (strcmp(type.name, tokens[0].data) == 0) {
             t_pb* pb = new t_pb;
-            pb->name = vtr::strdup(block_name.value());
-            clb_nlist->create_block(block_name.value(), pb, &type);
+            pb->name = vtr::strdup(block_name);
+            clb_nlist->create_block(block_name, pb, &type);
             pb_type = clb_nlist->block_type(index)->pb_type;
             found = true;
             break;
         }
     }
     if (!found) {
-        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(clb_block),
-                  "Unknown cb type %s for cb %s #%lu.\n", block_inst.value(), clb_nlist->block_name(index).c_str(), size_t(index));
+        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, clb_block.line(),
+                  "Unknown cb type %s for cb %s #%lu.\n", block_inst, clb_nlist->block_name(index).c_str(), size_t(index));
     }
 
     //Parse all pbs and CB internal nets
@@ -327,21 +552,21 @@ static void processComplexBlock(pugi::xml_node clb_block,
     clb_nlist->block_pb(index)->pb_graph_node = clb_nlist->block_type(index)->pb_graph_head;
     clb_nlist->block_pb(index)->pb_route = alloc_pb_route(clb_nlist->block_pb(index)->pb_graph_node);
 
-    auto clb_mode = pugiutil::get_attribute(clb_block, "mode", loc_data);
+    auto clb_mode = clb_block.required_attribute("mode");
 
     found = false;
     for (i = 0; i < pb_type->num_modes; i++) {
-        if (strcmp(clb_mode.value(), pb_type->modes[i].name) == 0) {
+        if (strcmp(clb_mode, pb_type->modes[i].name) == 0) {
             clb_nlist->block_pb(index)->mode = i;
             found = true;
         }
     }
     if (!found) {
-        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(clb_block),
-                  "Unknown mode %s for cb %s #%d.\n", clb_mode.value(), clb_nlist->block_name(index).c_str(), index);
+        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, clb_block.line(),
+                  "Unknown mode %s for cb %s #%d.\n", clb_mode, clb_nlist->block_name(index).c_str(), index);
     }
 
-    processPb(clb_block, index, clb_nlist->block_pb(index), clb_nlist->block_pb(index)->pb_route, num_primitives, loc_data, clb_nlist);
+    processPb(clb_block, index, clb_nlist->block_pb(index), clb_nlist->block_pb(index)->pb_route, num_primitives, clb_nlist);
     load_internal_to_block_net_nums(clb_nlist->block_type(index), clb_nlist->block_pb(index)->pb_route);
 
     //clb_nlist->block_pb(index)->pb_route.shrink_to_fit();
@@ -355,20 +580,20 @@ static void processComplexBlock(pugi::xml_node clb_block,
  * e.g. block attributes or parameters, which must be of the form
  * `<attributes><attribute name="attrName">attrValue</attribute> ... </attributes>`
  */
-template<typename T>
-void processAttrsParams(pugi::xml_node Parent, const char* child_name, T& atom_net_range, const pugiutil::loc_data& loc_data) {
+template<typename NetlistNode, typename T>
+void processAttrsParams(const NetlistNode& Parent, const char* child_name, T& atom_net_range) {
     std::map<std::string, std::string> kvs;
     if (Parent) {
-        for (auto Cur = pugiutil::get_first_child(Parent, child_name, loc_data, pugiutil::OPTIONAL); Cur; Cur = Cur.next_sibling(child_name)) {
-            std::string cname = pugiutil::get_attribute(Cur, "name", loc_data).value();
-            std::string cval = Cur.text().get();
+        for (auto Cur = Parent.first_child(child_name, pugiutil::OPTIONAL); Cur; Cur = Cur.next_sibling(child_name)) {
+            std::string cname = Cur.required_attribute("name");
+            std::string cval = Cur.text();
             bool found = false;
             // Look for corresponding key-value in range from AtomNetlist
             for (auto bitem : atom_net_range) {
                 if (bitem.first == cname) {
                     if (bitem.second != cval) {
                         // Found in AtomNetlist range, but values don't match
-                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(Cur),
+                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, Cur.line(),
                                   ".net file and .blif file do not match, %s %s set to \"%s\" in .net file but \"%s\" in .blif file.\n",
                                   child_name, cname.c_str(), cval.c_str(), bitem.second.c_str());
                     }
@@ -377,7 +602,7 @@ void processAttrsParams(pugi::xml_node Parent, const char* child_name, T& atom_n
                 }
             }
             if (!found) // Not found in AtomNetlist range
-                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(Cur),
+                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, Cur.line(),
                           ".net file and .blif file do not match, %s %s missing in .blif file.\n",
                           child_name, cname.c_str());
             kvs[cname] = cval;
@@ -386,7 +611,7 @@ void processAttrsParams(pugi::xml_node Parent, const char* child_name, T& atom_n
     // Check for attrs/params in AtomNetlist but not in .net file
     for (auto bitem : atom_net_range) {
         if (kvs.find(bitem.first) == kvs.end())
-            vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(Parent),
+            vpr_throw(VPR_ERROR_NET_F, netlist_file_name, Parent.line(),
                       ".net file and .blif file do not match, %s %s missing in .net file.\n",
                       child_name, bitem.first.c_str());
     }
@@ -397,9 +622,9 @@ void processAttrsParams(pugi::xml_node Parent, const char* child_name, T& atom_n
  *
  *   @param Parent     XML tag for this pb_type
  *   @param pb         physical block to use
- *   @param loc_data   xml location info for error reporting
  */
-static void processPb(pugi::xml_node Parent, const ClusterBlockId index, t_pb* pb, t_pb_routes& pb_route, int* num_primitives, const pugiutil::loc_data& loc_data, ClusteredNetlist* clb_nlist) {
+template<typename NetlistNode>
+static void processPb(const NetlistNode& Parent, const ClusterBlockId index, t_pb* pb, t_pb_routes& pb_route, int* num_primitives, ClusteredNetlist* clb_nlist) {
     int i, j, pb_index;
     bool found;
     const t_pb_type* pb_type;
@@ -409,14 +634,14 @@ static void processPb(pugi::xml_node Parent, const ClusterBlockId index, t_pb* p
 
     auto& atom_ctx = g_vpr_ctx.mutable_atom();
 
-    auto inputs = pugiutil::get_single_child(Parent, "inputs", loc_data);
-    processPorts(inputs, pb, pb_route, loc_data);
+    auto inputs = Parent.single_child("inputs");
+    processPorts(inputs, pb, pb_route);
 
-    auto outputs = pugiutil::get_single_child(Parent, "outputs", loc_data);
-    processPorts(outputs, pb, pb_route, loc_data);
+    auto outputs = Parent.single_child("outputs");
+    processPorts(outputs, pb, pb_route);
 
-    auto clocks = pugiutil::get_single_child(Parent, "clocks", loc_data);
-    processPorts(clocks, pb, pb_route, loc_data);
+    auto clocks = Parent.single_child("clocks");
+    processPorts(clocks, pb, pb_route);
 
     int num_in_ports = 0;
     int begin_out_port;
@@ -446,8 +671,8 @@ static void processPb(pugi::xml_node Parent, const ClusterBlockId index, t_pb* p
         end_clock_port = begin_clock_port + num_clock_ports;
     }
 
-    auto attrs = pugiutil::get_single_child(Parent, "attributes", loc_data, pugiutil::OPTIONAL);
-    auto params = pugiutil::get_single_child(Parent, "parameters", loc_data, pugiutil::OPTIONAL);
+    auto attrs = Parent.single_child("attributes", pugiutil::OPTIONAL);
+    auto params = Parent.single_child("parameters", pugiutil::OPTIONAL);
 
     pb_type = pb->pb_graph_node->pb_type;
 
@@ -482,8 +707,8 @@ static void processPb(pugi::xml_node Parent, const ClusterBlockId index, t_pb* p
 
         auto atom_attrs = atom_ctx.nlist.block_attrs(blk_id);
         auto atom_params = atom_ctx.nlist.block_params(blk_id);
-        processAttrsParams(attrs, "attribute", atom_attrs, loc_data);
-        processAttrsParams(params, "parameter", atom_params, loc_data);
+        processAttrsParams(attrs, "attribute", atom_attrs);
+        processAttrsParams(params, "parameter", atom_params);
 
         (*num_primitives)++;
     } else {
@@ -498,15 +723,15 @@ static void processPb(pugi::xml_node Parent, const ClusterBlockId index, t_pb* p
         for (auto child = Parent.child("block"); child; child = child.next_sibling("block")) {
             VTR_ASSERT(strcmp(child.name(), "block") == 0);
 
-            auto instance_type = pugiutil::get_attribute(child, "instance", loc_data);
-            tokens = GetTokensFromString(instance_type.value(), &num_tokens);
+            auto instance_type = child.required_attribute("instance");
+            tokens = GetTokensFromString(instance_type, &num_tokens);
             if (num_tokens != 4 || tokens[0].type != TOKEN_STRING
                 || tokens[1].type != TOKEN_OPEN_SQUARE_BRACKET
                 || tokens[2].type != TOKEN_INT
                 || tokens[3].type != TOKEN_CLOSE_SQUARE_BRACKET) {
-                vpr_throw(VPR_ERROR_NET_F, loc_data.filename_c_str(), loc_data.line(child),
+                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, child.line(),
                           "Unknown syntax for instance %s in %s. Expected pb_type[instance_number].\n",
-                          instance_type.value(), child.name());
+                          instance_type, child.name());
             }
 
             found = false;
@@ -515,19 +740,19 @@ static void processPb(pugi::xml_node Parent, const ClusterBlockId index, t_pb* p
                 if (strcmp(pb_type->modes[pb->mode].pb_type_children[i].name, tokens[0].data) == 0) {
                     pb_index = vtr::atoi(tokens[2].data);
                     if (pb_index < 0) {
-                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(child),
+                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, child.line(),
                                   "Instance number %d is negative instance %s in %s.\n",
-                                  pb_index, instance_type.value(), child.name());
+                                  pb_index, instance_type, child.name());
                     }
                     if (pb_index >= pb_type->modes[pb->mode].pb_type_children[i].num_pb) {
-                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(child),
+                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, child.line(),
                                   "Instance number exceeds # of pb available for instance %s in %s.\n",
-                                  instance_type.value(), child.name());
+                                  instance_type, child.name());
                     }
                     if (pb->child_pbs[i][pb_index].pb_graph_node != nullptr) {
-                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(child),
+                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, child.line(),
                                   "node is used by two different blocks %s and %s.\n",
-                                  instance_type.value(),
+                                  instance_type,
                                   pb->child_pbs[i][pb_index].name);
                     }
                     pb->child_pbs[i][pb_index].pb_graph_node = &pb->pb_graph_node->child_pb_graph_nodes[pb->mode][i][pb_index];
@@ -536,59 +761,59 @@ static void processPb(pugi::xml_node Parent, const ClusterBlockId index, t_pb* p
                 }
             }
             if (!found) {
-                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(child),
-                          "Unknown pb type %s.\n", instance_type.value());
+                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, child.line(),
+                          "Unknown pb type %s.\n", instance_type);
             }
 
-            auto name = pugiutil::get_attribute(child, "name", loc_data);
-            if (0 != strcmp(name.value(), "open")) {
-                pb->child_pbs[i][pb_index].name = vtr::strdup(name.value());
+            auto name = child.required_attribute("name");
+            if (0 != strcmp(name, "open")) {
+                pb->child_pbs[i][pb_index].name = vtr::strdup(name);
 
                 /* Parse all pbs and CB internal nets*/
                 atom_ctx.lookup.set_atom_pb(AtomBlockId::INVALID(), &pb->child_pbs[i][pb_index]);
 
-                auto mode = child.attribute("mode");
+                const char* mode = child.attribute("mode", "");
                 pb->child_pbs[i][pb_index].mode = 0;
                 found = false;
                 for (j = 0; j < pb->child_pbs[i][pb_index].pb_graph_node->pb_type->num_modes; j++) {
-                    if (strcmp(mode.value(), pb->child_pbs[i][pb_index].pb_graph_node->pb_type->modes[j].name) == 0) {
+                    if (strcmp(mode, pb->child_pbs[i][pb_index].pb_graph_node->pb_type->modes[j].name) == 0) {
                         pb->child_pbs[i][pb_index].mode = j;
                         found = true;
                     }
                 }
                 if (!found && !pb->child_pbs[i][pb_index].is_primitive()) {
-                    vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(child),
-                              "Unknown mode %s for cb %s #%d.\n", mode.value(),
+                    vpr_throw(VPR_ERROR_NET_F, netlist_file_name, child.line(),
+                              "Unknown mode %s for cb %s #%d.\n", mode,
                               pb->child_pbs[i][pb_index].name, pb_index);
                 }
                 pb->child_pbs[i][pb_index].parent_pb = pb;
 
-                processPb(child, index, &pb->child_pbs[i][pb_index], pb_route, num_primitives, loc_data, clb_nlist);
+                processPb(child, index, &pb->child_pbs[i][pb_index], pb_route, num_primitives, clb_nlist);
             } else {
                 /* physical block has no used primitives but it may have used routing */
                 pb->child_pbs[i][pb_index].name = nullptr;
                 atom_ctx.lookup.set_atom_pb(AtomBlockId::INVALID(), &pb->child_pbs[i][pb_index]);
 
-                auto lookahead1 = pugiutil::get_first_child(child, "outputs", loc_data, pugiutil::OPTIONAL);
+                auto lookahead1 = child.first_child("outputs", pugiutil::OPTIONAL);
                 if (lookahead1) {
-                    pugiutil::get_first_child(lookahead1, "port", loc_data); //Check that port child tag exists
-                    auto mode = pugiutil::get_attribute(child, "mode", loc_data);
+                    lookahead1.first_child("port"); //Check that port child tag exists
+                    auto mode = child.required_attribute("mode");
 
                     pb->child_pbs[i][pb_index].mode = 0;
                     found = false;
                     for (j = 0; j < pb->child_pbs[i][pb_index].pb_graph_node->pb_type->num_modes; j++) {
-                        if (strcmp(mode.value(), pb->child_pbs[i][pb_index].pb_graph_node->pb_type->modes[j].name) == 0) {
+                        if (strcmp(mode, pb->child_pbs[i][pb_index].pb_graph_node->pb_type->modes[j].name) == 0) {
                             pb->child_pbs[i][pb_index].mode = j;
                             found = true;
                         }
                     }
                     if (!found && !pb->child_pbs[i][pb_index].is_primitive()) {
-                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(child),
-                                  "Unknown mode %s for cb %s #%d.\n", mode.value(),
+                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, child.line(),
+                                  "Unknown mode %s for cb %s #%d.\n", mode,
                                   pb->child_pbs[i][pb_index].name, pb_index);
                     }
                     pb->child_pbs[i][pb_index].parent_pb = pb;
-                    processPb(child, index, &pb->child_pbs[i][pb_index], pb_route, num_primitives, loc_data, clb_nlist);
+                    processPb(child, index, &pb->child_pbs[i][pb_index], pb_route, num_primitives, clb_nlist);
                 }
             }
             freeTokens(tokens, num_tokens);
@@ -617,7 +842,8 @@ static int add_net_to_hash(t_hash** nhash, const char* net_name, int* ncount) {
     return hash_value->index;
 }
 
-static void processPorts(pugi::xml_node Parent, t_pb* pb, t_pb_routes& pb_route, const pugiutil::loc_data& loc_data) {
+template<typename NetlistNode>
+static void processPorts(const NetlistNode& Parent, t_pb* pb, t_pb_routes& pb_route) {
     int i, j, num_tokens;
     int in_port = 0, out_port = 0, clock_port = 0;
     std::vector<std::string> pins;
@@ -627,8 +853,8 @@ static void processPorts(pugi::xml_node Parent, t_pb* pb, t_pb_routes& pb_route,
 
     auto& atom_ctx = g_vpr_ctx.atom();
 
-    for (auto Cur = pugiutil::get_first_child(Parent, "port", loc_data, pugiutil::OPTIONAL); Cur; Cur = Cur.next_sibling("port")) {
-        auto port_name = pugiutil::get_attribute(Cur, "name", loc_data);
+    for (auto Cur = Parent.first_child("port", pugiutil::OPTIONAL); Cur; Cur = Cur.next_sibling("port")) {
+        auto port_name = Cur.required_attribute("name");
 
         //Determine the port index on the pb
         //
@@ -638,7 +864,7 @@ static void processPorts(pugi::xml_node Parent, t_pb* pb, t_pb_routes& pb_route,
         in_port = out_port = clock_port = 0;
         found = false;
         for (i = 0; i < pb->pb_graph_node->pb_type->num_ports; i++) {
-            if (0 == strcmp(pb->pb_graph_node->pb_type->ports[i].name, port_name.value())) {
+            if (0 == strcmp(pb->pb_graph_node->pb_type->ports[i].name, port_name)) {
                 found = true;
                 break;
             }
@@ -654,37 +880,37 @@ static void processPorts(pugi::xml_node Parent, t_pb* pb, t_pb_routes& pb_route,
             }
         }
         if (!found) {
-            vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(Cur),
-                      "Unknown port %s for pb %s[%d].\n", port_name.value(),
+            vpr_throw(VPR_ERROR_NET_F, netlist_file_name, Cur.line(),
+                      "Unknown port %s for pb %s[%d].\n", port_name,
                       pb->pb_graph_node->pb_type->name,
                       pb->pb_graph_node->placement_index);
         }
 
         //Extract all the pins for this port
-        pins = vtr::split(Cur.text().get());
+        pins = vtr::split(Cur.text());
         num_tokens = pins.size();
 
         //Check that the number of pins from the netlist file matches the pb port's number of pins
         if (0 == strcmp(Parent.name(), "inputs")) {
             if (num_tokens != pb->pb_graph_node->num_input_pins[in_port]) {
-                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(Cur),
+                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, Cur.line(),
                           "Incorrect # pins %d found (expected %d) for input port %s for pb %s[%d].\n",
-                          num_tokens, pb->pb_graph_node->num_input_pins[in_port], port_name.value(), pb->pb_graph_node->pb_type->name,
+                          num_tokens, pb->pb_graph_node->num_input_pins[in_port], port_name, pb->pb_graph_node->pb_type->name,
                           pb->pb_graph_node->placement_index);
             }
         } else if (0 == strcmp(Parent.name(), "outputs")) {
             if (num_tokens != pb->pb_graph_node->num_output_pins[out_port]) {
-                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(Cur),
+                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, Cur.line(),
                           "Incorrect # pins %d found (expected %d) for output port %s for pb %s[%d].\n",
-                          num_tokens, pb->pb_graph_node->num_output_pins[out_port], port_name.value(), pb->pb_graph_node->pb_type->name,
+                          num_tokens, pb->pb_graph_node->num_output_pins[out_port], port_name, pb->pb_graph_node->pb_type->name,
                           pb->pb_graph_node->placement_index);
             }
         } else {
             VTR_ASSERT(0 == strcmp(Parent.name(), "clocks"));
             if (num_tokens != pb->pb_graph_node->num_clock_pins[clock_port]) {
-                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(Cur),
+                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, Cur.line(),
                           "Incorrect # pins %d found for clock port %s for pb %s[%d].\n",
-                          num_tokens, pb->pb_graph_node->num_clock_pins[clock_port], port_name.value(), pb->pb_graph_node->pb_type->name,
+                          num_tokens, pb->pb_graph_node->num_clock_pins[clock_port], port_name, pb->pb_graph_node->pb_type->name,
                           pb->pb_graph_node->placement_index);
             }
         }
@@ -772,7 +998,7 @@ static void processPorts(pugi::xml_node Parent, t_pb* pb, t_pb_routes& pb_route,
                     delete[] pin_node;
                     delete[] num_ptrs;
                     if (!found) {
-                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(Cur),
+                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, Cur.line(),
                                   "Unknown interconnect %s connecting to pin %s.\n",
                                   interconnect_name.c_str(), pin_name.c_str());
                     }
@@ -841,7 +1067,7 @@ static void processPorts(pugi::xml_node Parent, t_pb* pb, t_pb_routes& pb_route,
                     delete[] pin_node;
                     delete[] num_ptrs;
                     if (!found) {
-                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(Cur),
+                        vpr_throw(VPR_ERROR_NET_F, netlist_file_name, Cur.line(),
                                   "Unknown interconnect %s connecting to pin %s.\n",
                                   interconnect_name.c_str(), pin_name.c_str());
                     }
@@ -851,24 +1077,24 @@ static void processPorts(pugi::xml_node Parent, t_pb* pb, t_pb_routes& pb_route,
     }
 
     //Record any port rotation mappings
-    for (auto pin_rot_map = pugiutil::get_first_child(Parent, "port_rotation_map", loc_data, pugiutil::OPTIONAL);
+    for (auto pin_rot_map = Parent.first_child("port_rotation_map", pugiutil::OPTIONAL);
          pin_rot_map;
          pin_rot_map = pin_rot_map.next_sibling("port_rotation_map")) {
-        auto port_name = pugiutil::get_attribute(pin_rot_map, "name", loc_data).value();
+        auto port_name = pin_rot_map.required_attribute("name");
 
         const t_port* pb_gport = find_pb_graph_port(pb->pb_graph_node, port_name);
 
         if (pb_gport == nullptr) {
-            vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(pin_rot_map),
+            vpr_throw(VPR_ERROR_NET_F, netlist_file_name, pin_rot_map.line(),
                       "Failed to find port with name '%s' on pb %s[%d]\n",
                       port_name,
                       pb->pb_graph_node->pb_type->name, pb->pb_graph_node->placement_index);
         }
 
-        auto pin_mapping = vtr::split(pin_rot_map.text().get());
+        auto pin_mapping = vtr::split(pin_rot_map.text());
 
         if (size_t(pb_gport->num_pins) != pin_mapping.size()) {
-            vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(pin_rot_map),
+            vpr_throw(VPR_ERROR_NET_F, netlist_file_name, pin_rot_map.line(),
                       "Incorrect # pins %zu (expected %d) found for port %s rotation map in pb %s[%d].\n",
                       pin_mapping.size(), pb_gport->num_pins, port_name, pb->pb_graph_node->pb_type->name,
                       pb->pb_graph_node->placement_index);
@@ -880,7 +1106,7 @@ static void processPorts(pugi::xml_node Parent, t_pb* pb, t_pb_routes& pb_route,
             int atom_pin_index = vtr::atoi(pin_mapping[ipin]);
 
             if (atom_pin_index < 0) {
-                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, loc_data.line(pin_rot_map),
+                vpr_throw(VPR_ERROR_NET_F, netlist_file_name, pin_rot_map.line(),
                           "Invalid pin number %d in port rotation map (must be >= 0)\n", atom_pin_index);
             }
 
@@ -1267,3 +1493,82 @@ void set_atom_pin_mapping(const ClusteredNetlist& clb_nlist, const AtomBlockId a
     //Save the mapping
     atom_ctx.lookup.set_atom_pin_pb_graph_pin(atom_pin, gpin);
 }
+
+bool is_packed_netlist_binary(const std::string& net_file) {
+    return vtr::check_file_name_extension(net_file, ".capnp");
+}
+
+#ifdef VTR_ENABLE_CAPNPROTO
+
+void write_packed_netlist_binary(const ClusteredNetlist& clb_nlist, const std::string& binary_file) {
+    vtr::ScopedStartFinishTimer timer(vtr::string_fmt("Write binary packed netlist '%s'", binary_file.c_str()));
+
+    const std::string& net_file = clb_nlist.netlist_name();
+
+    pugi::xml_document doc;
+    try {
+        pugiutil::load_xml(doc, net_file);
+    } catch (pugiutil::XmlError& e) {
+        vpr_throw(VPR_ERROR_NET_F, net_file.c_str(), 0,
+                  "Failed to load netlist file '%s' (%s).\n", net_file.c_str(), e.what());
+    }
+
+    ::capnp::MallocMessageBuilder builder;
+
+    auto packed_netlist = builder.initRoot<VprPackedNetlist>();
+    packed_netlist.setNetlistId(clb_nlist.netlist_id());
+
+    std::unordered_map<std::string, uint32_t> name_ids;
+    write_packed_netlist_element(packed_netlist.initRoot(), doc.document_element(), name_ids);
+
+    auto names = packed_netlist.initNames(name_ids.size());
+    for (const auto& kv : name_ids) {
+        names.set(kv.second, kv.first.c_str());
+    }
+
+    writeMessageToFile(binary_file, &builder);
+}
+
+static uint32_t packed_netlist_name_id(const char* name, std::unordered_map<std::string, uint32_t>& name_ids) {
+    return name_ids.insert(std::make_pair(name, name_ids.size())).first->second;
+}
+
+static void write_packed_netlist_element(VprPackedNetlistElement::Builder element, pugi::xml_node node, std::unordered_map<std::string, uint32_t>& name_ids) {
+    element.setName(packed_netlist_name_id(node.name(), name_ids));
+
+    const char* text = node.text().get();
+    if (*text) {
+        element.setText(text);
+    }
+
+    auto attrs = element.initAttributes(std::distance(node.attributes_begin(), node.attributes_end()));
+    unsigned iattr = 0;
+    for (pugi::xml_attribute attr : node.attributes()) {
+        attrs[iattr].setName(packed_netlist_name_id(attr.name(), name_ids));
+        attrs[iattr].setValue(attr.value());
+        ++iattr;
+    }
+
+    size_t num_children = 0;
+    for (pugi::xml_node child : node.children()) {
+        if (child.type() == pugi::node_element) {
+            ++num_children;
+        }
+    }
+
+    auto children = element.initChildren(num_children);
+    unsigned ichild = 0;
+    for (pugi::xml_node child : node.children()) {
+        if (child.type() == pugi::node_element) {
+            write_packed_netlist_element(children[ichild++], child, name_ids);
+        }
+    }
+}
+
+#else /* VTR_ENABLE_CAPNPROTO */
+
+void write_packed_netlist_binary(const ClusteredNetlist& /*clb_nlist*/, const std::string& /*binary_file*/) {
+    VPR_THROW(VPR_ERROR_NET_F, "Writing binary packed netlists " DISABLE_ERROR);
+}
+
+#endif /* VTR_ENABLE_CAPNPROTO */
@@ -3,8 +3,8 @@
  * @author Jason Luu
  * @date   May 2009
  *
- * @brief Read a circuit netlist in XML format and populate
- *        the netlist data structures for VPR
+ * @brief Read a circuit netlist in XML (or binary packed netlist) format
+ *        and populate the netlist data structures for VPR
  */
 
 #ifndef READ_NETLIST_H
@@ -17,6 +17,17 @@ ClusteredNetlist read_netlist(const char* net_file,
                               bool verify_file_digests,
                               int verbosity);
 
+///@brief Returns true if net_file names a binary (Cap'n Proto) packed netlist rather than a .net XML file
+bool is_packed_netlist_binary(const std::string& net_file);
+
+/**
+ * @brief Converts the .net XML file clb_nlist was loaded from to a binary packed netlist file
+ *
+ * read_netlist() loads the binary file exactly as it would the .net file, and gives it the
+ * same netlist id so placement and routing files made from either remain interchangeable.
+ */
+void write_packed_netlist_binary(const ClusteredNetlist& clb_nlist, const std::string& binary_file);
+
 void set_atom_pin_mapping(const ClusteredNetlist& clb_nlist,
                           const AtomBlockId atom_blk,
                           const AtomPortId atom_port,
@@ -6,8 +6,10 @@
 #include "argparse.hpp"
 
 #include "vtr_log.h"
+#include "vtr_memory.h"
 #include "vtr_util.h"
 #include "vtr_path.h"
+#include "device_snapshot.h"
 #include <string>
 
 using argparse::ConvertedValue;
@@ -103,6 +105,8 @@ struct ParseCircuitFormat {
             conv_value.set_value(e_circuit_format::EBLIF);
         else if (str == "fpga-interchange")
             conv_value.set_value(e_circuit_format::FPGA_INTERCHANGE);
+        else if (str == "binary")
+            conv_value.set_value(e_circuit_format::BINARY);
         else {
             std::stringstream msg;
             msg << "Invalid conversion from '" << str << "' to e_circuit_format (expected one of: " << argparse::join(default_choices(), ", ") << ")";
@@ -120,6 +124,8 @@ struct ParseCircuitFormat {
             conv_value.set_value("blif");
         else if (val == e_circuit_format::EBLIF)
             conv_value.set_value("eblif");
+        else if (val == e_circuit_format::BINARY)
+            conv_value.set_value("binary");
         else {
             VTR_ASSERT(val == e_circuit_format::FPGA_INTERCHANGE);
             conv_value.set_value("fpga-interchange");
@@ -129,9 +135,48 @@ struct ParseCircuitFormat {
     }
 
     std::vector<std::string> default_choices() {
-        return {"auto", "blif", "eblif", "fpga-interchange"};
+        return {"auto", "blif", "eblif", "fpga-interchange", "binary"};
+    }
+};
+struct ParseLargeAllocPolicy {
+    ConvertedValue<vtr::e_large_alloc_policy> from_str(const std::string& str) {
+        ConvertedValue<vtr::e_large_alloc_policy> conv_value;
+        if (str == "default")
+            conv_value.set_value(vtr::e_large_alloc_policy::DEFAULT);
+        else if (str == "thp")
+            conv_value.set_value(vtr::e_large_alloc_policy::TRANSPARENT_HUGE_PAGES);
+        else if (str == "huge_pages")
+            conv_value.set_value(vtr::e_large_alloc_policy::HUGE_PAGES);
+        else if (str == "numa_interleave")
+            conv_value.set_value(vtr::e_large_alloc_policy::NUMA_INTERLEAVE);
+        else {
+            std::stringstream msg;
+            msg << "Invalid conversion from '" << str << "' to e_large_alloc_policy (expected one of: " << argparse::join(default_choices(), ", ") << ")";
+            conv_value.set_error(msg.str());
+        }
+        return conv_value;
+    }
+
+    ConvertedValue<std::string> to_str(vtr::e_large_alloc_policy val) {
+        ConvertedValue<std::string> conv_value;
+        if (val == vtr::e_large_alloc_policy::DEFAULT)
+            conv_value.set_value("default");
+        else if (val == vtr::e_large_alloc_policy::TRANSPARENT_HUGE_PAGES)
+            conv_value.set_value("thp");
+        else if (val == vtr::e_large_alloc_policy::HUGE_PAGES)
+            conv_value.set_value("huge_pages");
+        else {
+            VTR_ASSERT(val == vtr::e_large_alloc_policy::NUMA_INTERLEAVE);
+            conv_value.set_value("numa_interleave");
+        }
+        return conv_value;
+    }
+
+    std::vector<std::string> default_choices() {
+        return {"default", "thp", "huge_pages", "numa_interleave"};
     }
 };
+
 struct ParseRoutePredictor {
     ConvertedValue<e_routing_failure_predictor> from_str(const std::string& str) {
         ConvertedValue<e_routing_failure_predictor> conv_value;
@@ -175,6 +220,8 @@ struct ParseRouterAlgorithm {
             conv_value.set_value(PARALLEL);
         else if (str == "parallel_decomp")
             conv_value.set_value(PARALLEL_DECOMP);
+        else if (str == "distributed")
+            conv_value.set_value(DISTRIBUTED);
         else if (str == "timing_driven")
             conv_value.set_value(TIMING_DRIVEN);
         else {
@@ -189,6 +236,10 @@ struct ParseRouterAlgorithm {
         ConvertedValue<std::string> conv_value;
         if (val == PARALLEL)
             conv_value.set_value("parallel");
+        else if (val == PARALLEL_DECOMP)
+            conv_value.set_value("parallel_decomp");
+        else if (val == DISTRIBUTED)
+            conv_value.set_value("distributed");
         else {
             VTR_ASSERT(val == TIMING_DRIVEN);
             conv_value.set_value("timing_driven");
@@ -197,7 +248,7 @@ struct ParseRouterAlgorithm {
     }
 
     std::vector<std::string> default_choices() {
-        return {"parallel", "timing_driven"};
+        return {"parallel", "parallel_decomp", "distributed", "timing_driven"};
     }
 };
 
@@ -210,6 +261,8 @@ struct ParseNodeReorderAlgorithm {
             conv_value.set_value(DEGREE_BFS);
         else if (str == "random_shuffle")
             conv_value.set_value(RANDOM_SHUFFLE);
+        else if (str == "hilbert_curve")
+            conv_value.set_value(HILBERT_CURVE);
         else {
             std::stringstream msg;
             msg << "Invalid conversion from '" << str << "' to e_rr_node_reorder_algorithm (expected one of: " << argparse::join(default_choices(), ", ") << ")";
@@ -224,15 +277,17 @@ struct ParseNodeReorderAlgorithm {
             conv_value.set_value("none");
         else if (val == DEGREE_BFS)
             conv_value.set_value("degree_bfs");
-        else {
-            VTR_ASSERT(val == RANDOM_SHUFFLE);
+        else if (val == RANDOM_SHUFFLE)
             conv_value.set_value("random_shuffle");
+        else {
+            VTR_ASSERT(val == HILBERT_CURVE);
+            conv_value.set_value("hilbert_curve");
         }
         return conv_value;
     }
 
     std::vector<std::string> default_choices() {
-        return {"none", "degree_bfs", "random_shuffle"};
+        return {"none", "degree_bfs", "random_shuffle", "hilbert_curve"};
     }
 };
 
@@ -1056,6 +1111,68 @@ struct ParseRouterFirstIterTiming {
     }
 };
 
+struct ParseRouterNetOrder {
+    ConvertedValue<e_router_net_order> from_str(const std::string& str) {
+        ConvertedValue<e_router_net_order> conv_value;
+        if (str == "fanout")
+            conv_value.set_value(e_router_net_order::FANOUT);
+        else if (str == "adaptive")
+            conv_value.set_value(e_router_net_order::ADAPTIVE);
+        else {
+            std::stringstream msg;
+            msg << "Invalid conversion from '" << str << "' to e_router_net_order (expected one of: " << argparse::join(default_choices(), ", ") << ")";
+            conv_value.set_error(msg.str());
+        }
+        return conv_value;
+    }
+
+    ConvertedValue<std::string> to_str(e_router_net_order val) {
+        ConvertedValue<std::string> conv_value;
+        if (val == e_router_net_order::FANOUT)
+            conv_value.set_value("fanout");
+        else {
+            VTR_ASSERT(val == e_router_net_order::ADAPTIVE);
+            conv_value.set_value("adaptive");
+        }
+        return conv_value;
+    }
+
+    std::vector<std::string> default_choices() {
+        return {"fanout", "adaptive"};
+    }
+};
+
+struct ParseRouterSinkOrder {
+    ConvertedValue<e_router_sink_order> from_str(const std::string& str) {
+        ConvertedValue<e_router_sink_order> conv_value;
+        if (str == "criticality")
+            conv_value.set_value(e_router_sink_order::CRITICALITY);
+        else if (str == "proximity")
+            conv_value.set_value(e_router_sink_order::PROXIMITY);
+        else {
+            std::stringstream msg;
+            msg << "Invalid conversion from '" << str << "' to e_router_sink_order (expected one of: " << argparse::join(default_choices(), ", ") << ")";
+            conv_value.set_error(msg.str());
+        }
+        return conv_value;
+    }
+
+    ConvertedValue<std::string> to_str(e_router_sink_order val) {
+        ConvertedValue<std::string> conv_value;
+        if (val == e_router_sink_order::CRITICALITY)
+            conv_value.set_value("criticality");
+        else {
+            VTR_ASSERT(val == e_router_sink_order::PROXIMITY);
+            conv_value.set_value("proximity");
+        }
+        return conv_value;
+    }
+
+    std::vector<std::string> default_choices() {
+        return {"criticality", "proximity"};
+    }
+};
+
 struct ParseRouterHeap {
     ConvertedValue<e_heap_type> from_str(const std::string& str) {
         ConvertedValue<e_heap_type> conv_value;
@@ -1063,6 +1180,10 @@ struct ParseRouterHeap {
             conv_value.set_value(e_heap_type::BINARY_HEAP);
         else if (str == "bucket")
             conv_value.set_value(e_heap_type::BUCKET_HEAP_APPROXIMATION);
+        else if (str == "four_ary")
+            conv_value.set_value(e_heap_type::FOUR_ARY_HEAP);
+        else if (str == "radix")
+            conv_value.set_value(e_heap_type::RADIX_HEAP);
         else {
             std::stringstream msg;
             msg << "Invalid conversion from '" << str << "' to e_heap_type (expected one of: " << argparse::join(default_choices(), ", ") << ")";
@@ -1075,6 +1196,10 @@ struct ParseRouterHeap {
         ConvertedValue<std::string> conv_value;
         if (val == e_heap_type::BINARY_HEAP)
             conv_value.set_value("binary");
+        else if (val == e_heap_type::FOUR_ARY_HEAP)
+            conv_value.set_value("four_ary");
+        else if (val == e_heap_type::RADIX_HEAP)
+            conv_value.set_value("radix");
         else {
             VTR_ASSERT(val == e_heap_type::BUCKET_HEAP_APPROXIMATION);
             conv_value.set_value("bucket");
@@ -1083,7 +1208,7 @@ struct ParseRouterHeap {
     }
 
     std::vector<std::string> default_choices() {
-        return {"binary", "bucket"};
+        return {"binary", "bucket", "four_ary", "radix"};
     }
 };
 
@@ -1470,6 +1595,49 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("on")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    gen_grp.add_argument<bool, ParseOnOff>(args.async_output_file_writes, "--async_output_file_writes")
+        .help(
+            "Write the placement and routing files on a background thread, while the flow continues."
+            " Useful when writing to slow (e.g. networked) filesystems."
+            " All writes complete before VPR exits")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    gen_grp.add_argument(args.trace_file, "--trace_file")
+        .help(
+            "Records a performance trace of the run (nested spans of each stage, router iteration and"
+            " annealing temperature, with counters and peak memory), written to this file at exit"
+            " in the Chrome trace event (JSON) format")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    gen_grp.add_argument<bool, ParseOnOff>(args.report_memory_usage, "--report_memory_usage")
+        .help(
+            "Reports the (estimated) memory held by the major data structures of each context"
+            " (e.g. the RR graph, netlists, router lookahead and timing graph) after each stage")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    gen_grp.add_argument(args.memory_usage_file, "--memory_usage_file")
+        .help(
+            "Writes the memory usage of each context's data structures after each stage to this file,"
+            " in CSV format (stage,context,structure,bytes). Implies --report_memory_usage")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    gen_grp.add_argument<vtr::e_large_alloc_policy, ParseLargeAllocPolicy>(args.large_alloc_policy, "--large_alloc_policy")
+        .help(
+            "How the large arrays used by the router (e.g. the RR graph nodes and edges, and the router's"
+            " per node search state) are allocated:\n"
+            " * default: regular pages, on the memory of the thread which first touches them\n"
+            " * thp: transparent huge pages (reduces TLB misses)\n"
+            " * huge_pages: explicit huge pages (which must be reserved, see /proc/sys/vm/nr_hugepages),"
+            " falling back to transparent huge pages\n"
+            " * numa_interleave: pages interleaved across the NUMA nodes (balances the memory traffic"
+            " of parallel routing on multi-socket hosts)")
+        .default_value("default")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     gen_grp.add_argument(args.target_device_utilization, "--target_utilization")
         .help(
             "Sets the target device utilization."
@@ -1513,6 +1681,16 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("off")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    gen_grp.add_argument<bool, ParseOnOff>(args.pipeline_device_creation, "--pipeline_device_creation")
+        .help(
+            "Controls whether the routing resource graph and the router lookahead are built on a background"
+            " thread while packing runs, instead of once packing is done."
+            " This only applies to fixed size devices (--device) with a fixed channel width (--route_chan_width),"
+            " since otherwise they depend on the packing."
+            " Packing and device creation messages may then be interleaved in the log.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     gen_grp.add_argument<bool, ParseOnOff>(args.strict_checks, "--strict_checks")
         .help(
             "Controls whether VPR enforces some consistency checks strictly (as errors) or treats them as warnings."
@@ -1582,20 +1760,29 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
             "           .cname - Custom name for atom primitive\n"
             "           .param - Parameter on atom primitive\n"
             "           .attr  - Attribute on atom primitive\n"
-            " * fpga-interchage: Logical netlist in FPGA Interchange schema format\n")
+            " * fpga-interchage: Logical netlist in FPGA Interchange schema format\n"
+            " * binary: Binary atom netlist written by --write_circuit_binary (.bin)\n")
         .default_value("auto")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.NetFile, "--net_file")
-        .help("Path to packed netlist file")
+        .help(
+            "Path to packed netlist file."
+            " Files ending in .capnp are binary packed netlists written by --write_packed_netlist_binary,"
+            " which can only be loaded (not produced) by packing.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.PlaceFile, "--place_file")
-        .help("Path to placement file")
+        .help(
+            "Path to placement file."
+            " Files ending in .bin (e.g. circuit.place.bin) are read and written in a compact binary format.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.RouteFile, "--route_file")
-        .help("Path to routing file")
+        .help(
+            "Path to routing file."
+            " Files ending in .bin (e.g. circuit.route.bin) are read and written in a compact binary format,"
+            " which is much faster to load with --analysis.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.SDCFile, "--sdc_file")
@@ -1605,12 +1792,14 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
     file_grp.add_argument(args.read_rr_graph_file, "--read_rr_graph")
         .help(
             "The routing resource graph file to load."
-            " The loaded routing resource graph overrides any routing architecture specified in the architecture file.")
+            " The loaded routing resource graph overrides any routing architecture specified in the architecture file."
+            " Files ending in .rrnative are native binary images written by --write_rr_graph, which load much faster"
+            " but only with the same VPR build and without metadata.")
         .metavar("RR_GRAPH_FILE")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     file_grp.add_argument(args.write_rr_graph_file, "--write_rr_graph")
-        .help("Writes the routing resource graph to the specified file")
+        .help("Writes the routing resource graph to the specified file (.xml, .xml.gz for gzip compressed XML, .bin for Cap'n Proto, or .rrnative for a native binary image)")
         .metavar("RR_GRAPH_FILE")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
@@ -1627,6 +1816,28 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .help("Writes out new floorplanning constraints based on current placement to the specified XML file.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    file_grp.add_argument(args.eco_net_file, "--eco_net")
+        .help(
+            "Packed netlist (.net) of a previous implementation of the design, for an incremental (ECO) placement with --eco_place."
+            " Clusters with the same name, type and contents as in this netlist are unchanged.")
+        .metavar("PREV_NET_FILE")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    file_grp.add_argument(args.eco_place_file, "--eco_place")
+        .help(
+            "Placement (.place) of a previous implementation of the design, for an incremental (ECO) placement with --eco_net."
+            " The unchanged clusters are fixed at their previous locations, and only the new and changed ones are placed.")
+        .metavar("PREV_PLACE_FILE")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    file_grp.add_argument(args.eco_route_file, "--eco_route")
+        .help(
+            "Routing (.route) of a previous implementation of the design, for an incremental (ECO) routing."
+            " Nets with the same name and terminals keep their previous routing (unless it becomes congested),"
+            " and only the new and changed nets are routed.")
+        .metavar("PREV_ROUTE_FILE")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     file_grp.add_argument(args.read_router_lookahead, "--read_router_lookahead")
         .help(
             "Reads the lookahead data from the specified file instead of computing it.")
@@ -1640,6 +1851,15 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .help("Writes the lookahead data to the specified file.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    file_grp.add_argument(args.router_lookahead_cache_dir, "--router_lookahead_cache_dir")
+        .help(
+            "Directory used to cache computed router lookaheads between runs."
+            " Each lookahead is stored under a digest of the architecture, device grid, channel widths,"
+            " segments and lookahead type, and is read back instead of being recomputed whenever"
+            " a later run uses the same parameters. Only map and extended_map lookaheads are cached."
+            " Ignored if --read_router_lookahead is specified. Empty (the default) disables the cache.")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     file_grp.add_argument(args.write_intra_cluster_router_lookahead, "--write_intra_cluster_router_lookahead")
         .help("Writes the intra-cluster lookahead data to the specified file.")
         .show_in(argparse::ShowIn::HELP_ONLY);
@@ -1653,6 +1873,23 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .help("Writes the placement delay lookup to the specified file.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    file_grp.add_argument(args.write_device_snapshot, "--write_device_snapshot")
+        .help(
+            "Writes a snapshot of the device (RR graph, router lookahead, placement delay model and intra-cluster routing graphs)"
+            " to the specified directory as they are built, so later runs on the same device can read"
+            " them back with --read_device_snapshot instead of rebuilding them."
+            " Requires --route_chan_width.")
+        .metavar("SNAPSHOT_DIR")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    file_grp.add_argument(args.read_device_snapshot, "--read_device_snapshot")
+        .help(
+            "Reads the RR graph, router lookahead, placement delay model and intra-cluster routing graphs from a snapshot written by"
+            " --write_device_snapshot. The snapshot must have been written with the same architecture"
+            " file and device options; the channel width defaults to that of the snapshot.")
+        .metavar("SNAPSHOT_DIR")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     file_grp.add_argument(args.out_file_prefix, "--outfile_prefix")
         .help("Prefix for output files")
         .show_in(argparse::ShowIn::HELP_ONLY);
@@ -1661,6 +1898,27 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .help("Writes the cluster-level block types usage summary to the specified JSON, XML or TXT file.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    file_grp.add_argument(args.write_circuit_binary, "--write_circuit_binary")
+        .help(
+            "Writes a binary copy of the atom netlist, as read from the circuit file, to the specified .bin file."
+            " Passing that file as the circuit in later runs loads the same netlist much faster than the BLIF,"
+            " and the packings, placements and routings made from either file are interchangeable.")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    file_grp.add_argument(args.write_packed_netlist_binary, "--write_packed_netlist_binary")
+        .help(
+            "Writes a binary (Cap'n Proto) copy of the packed netlist to the specified .capnp file once the packing is loaded."
+            " Passing that file as --net_file in later runs loads the same packing much faster than the .net XML,"
+            " and placements and routings made from either file are interchangeable.")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    file_grp.add_argument(args.lb_type_rr_graph_cache, "--lb_type_rr_graph_cache")
+        .help(
+            "Caches the intra-cluster routing graphs (used by the packer) in the specified .capnp file."
+            " If the file holds the graphs of the same architecture (checked by its digest) they are loaded from it,"
+            " otherwise they are built and written to it for later runs.")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& netlist_grp = parser.add_argument_group("netlist options");
 
     netlist_grp.add_argument<bool, ParseOnOff>(args.absorb_buffer_luts, "--absorb_buffer_luts")
@@ -1709,6 +1967,15 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("1")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    netlist_grp.add_argument<bool, ParseOnOff>(args.parallel_blif_read, "--parallel_blif_read")
+        .help(
+            "Reads BLIF/EBLIF circuits by splitting the file into chunks which are"
+            " tokenized in parallel (using up to --num_workers threads), and then"
+            " building the netlist from them in file order."
+            " The resulting netlist is identical, but this is faster for large netlists.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& pack_grp = parser.add_argument_group("packing options");
 
     pack_grp.add_argument<bool, ParseOnOff>(args.connection_driven_clustering, "--connection_driven_clustering")
@@ -1844,6 +2111,25 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("4")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    pack_grp.add_argument(args.pack_timing_update_interval, "--pack_timing_update_interval")
+        .help(
+            "When timing driven, re-analyzes timing every time this many clusters have been formed,"
+            " using the intra-cluster delays of the connections routed within the clusters formed so far"
+            " (instead of the inter-cluster delay assumed before packing)."
+            " Only the changed connections are re-analyzed with --timing_update_type incremental."
+            " 0 disables the updates (the criticalities of the initial pre-packing analysis are used throughout).")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    pack_grp.add_argument<bool, ParseOnOff>(args.pack_stream_output, "--pack_stream_output")
+        .help(
+            "Controls whether the packed netlist (.net) file is written incrementally, each cluster being"
+            " written as soon as it is formed, instead of being built in memory once packing is done."
+            " This lowers the peak memory of writing large netlists, and lets partial results be inspected"
+            " while packing. The file is rewritten if packing is re-attempted.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     pack_grp.add_argument(args.pack_feasible_block_array_size, "--pack_feasible_block_array_size")
         .help(
             "This value is used to determine the max size of the\n"
@@ -1875,6 +2161,15 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("semiDirectedSwap")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    pack_grp.add_argument<int>(args.pack_partition_size, "--pack_partition_size")
+        .help(
+            "When greater than zero, the atom netlist is partitioned (using multilevel heavy-edge coarsening)"
+            " into parts of at most this many atoms before packing, and each part is used as a clustering"
+            " attraction group. Values close to the capacity of the logic blocks work best."
+            " 0 disables netlist partitioning.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& place_grp = parser.add_argument_group("placement options");
 
     place_grp.add_argument(args.Seed, "--seed")
@@ -2030,6 +2325,14 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("false")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_grp.add_argument(args.analytic_placer_anneal_t_scale, "--analytic_placer_anneal_t_scale")
+        .help(
+            "With --enable_analytic_placer, a positive value refines the analytic placement with a short anneal"
+            " before the quench. The anneal starts at this fraction of the temperature the annealer would"
+            " normally start at, so it only makes local improvements. 0 goes straight to the quench.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     place_grp.add_argument(args.place_static_move_prob, "--place_static_move_prob")
         .help(
             "The percentage probabilities of different moves in Simulated Annealing placement. "
@@ -2101,6 +2404,14 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("0.05")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_grp.add_argument(args.place_agent_update_window, "--place_agent_update_window")
+        .help(
+            "Number of move outcomes the placement RL agent accumulates before updating its Q-table and action probabilities. "
+            "1 updates the agent after every move; larger values reduce the per-move cost of the agent "
+            "at the expense of it reacting more slowly.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     place_grp.add_argument(args.place_dm_rlim, "--place_dm_rlim")
         .help(
             "The maximum range limit of any directed move other than the uniform move. "
@@ -2159,6 +2470,104 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("0")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_grp.add_argument(args.place_parallel_moves, "--place_parallel_moves")
+        .help(
+            "Number of moves the annealer proposes as one batch. The moves of a batch which do not "
+            "share any block, location or net are evaluated in parallel (using up to --num_workers threads), "
+            "and then accepted or rejected in the order they were proposed, so results do not depend on the "
+            "number of threads. A value of 1 evaluates every move on its own.\n"
+            "Only used with the bounding_box and criticality_timing placement algorithms without a NoC; "
+            "other configurations always evaluate moves one at a time.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_seeds, "--place_seeds")
+        .help(
+            "Number of annealing runs to do, using the placer seeds --seed, --seed + 1, ... "
+            "The runs are done one after another in this VPR process, sharing the device, routing "
+            "resource graph and placement delay model, and the best resulting placement is kept "
+            "(by wirelength cost, and estimated critical path delay for timing driven placement). "
+            "Runs which fall clearly behind the best earlier run are stopped early "
+            "(see --place_seeds_prune_margin).")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_seeds_prune_margin, "--place_seeds_prune_margin")
+        .help(
+            "With --place_seeds, a run is stopped once the annealer has started shrinking its range "
+            "limit and its quality at some temperature is worse than that of the best finished run "
+            "at the same temperature by more than this fraction. "
+            "A large value effectively disables stopping runs early.")
+        .default_value("0.1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_congestion_weight, "--place_congestion_weight")
+        .help(
+            "Weight of the routing congestion cost in the annealer's cost function, relative to the "
+            "(normalized) wirelength cost. The congestion is estimated with a RUDY map of the net "
+            "bounding boxes against the channel widths, which is kept up to date after every accepted move; "
+            "the cost of a net is its wirelength times the average channel overuse in its bounding box. "
+            "0 disables the congestion cost (the final placement's estimated congestion is still reported). "
+            "Only used with cube bounding boxes, and evaluates moves one at a time "
+            "(see --place_parallel_moves).")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument<bool, ParseOnOff>(args.place_multilevel, "--place_multilevel")
+        .help(
+            "Start the annealer from a multilevel global placement instead of the default initial placement. "
+            "The clustered netlist is coarsened by merging strongly connected blocks of the same type "
+            "(keeping placement macros whole and leaving blocks with floorplan constraints out), the coarsest "
+            "netlist is annealed over bins of tiles, and each finer level is refined with a short "
+            "low-temperature anneal. The initial placement then legalizes the result, and the annealer "
+            "refines it starting with a small range limit. Only supported on single layer devices.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_checkpoint_file, "--place_checkpoint_file")
+        .help(
+            "File to which the annealer periodically saves its full state (block locations, annealing "
+            "schedule, RL agent Q-tables and random number generator state), so that an interrupted "
+            "placement can be continued with --resume_place. Disabled if empty.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_checkpoint_interval, "--place_checkpoint_interval")
+        .help("Number of annealing temperatures between saves of --place_checkpoint_file")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument<bool, ParseOnOff>(args.resume_place, "--resume_place")
+        .help(
+            "Continue the anneal from the state saved in --place_checkpoint_file instead of starting "
+            "from the initial placement. If the file does not exist yet the placement starts from scratch, "
+            "so the same command line can be rerun after the placer was interrupted.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_timing_sample_fanout, "--place_timing_sample_fanout")
+        .help(
+            "For nets with at least this many sinks, the timing cost change of moving the net's driver is "
+            "estimated from only its --place_timing_sample_size most critical connections (chosen again "
+            "whenever the criticalities are updated). Accepted moves still update the timing cost exactly. "
+            "Only used by the criticality_timing placement algorithm. 0 disables sampling.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_timing_sample_size, "--place_timing_sample_size")
+        .help("Number of connections of each sampled net (see --place_timing_sample_fanout) used to estimate its timing cost change")
+        .default_value("64")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_check_sample_fraction, "--place_check_sample_fraction")
+        .help(
+            "Fraction (0 to 1) of randomly chosen blocks, placement macros and nets whose locations and "
+            "bounding box costs are checked against the placement data structures after each annealing "
+            "temperature. The full placement check is always done before and after the anneal; this catches "
+            "inconsistencies closer to the move which caused them. 0 disables the intermediate checks.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     /*
      * place_grp.add_argument(args.place_timing_cost_func, "--place_timing_cost_func")
      * .help(
@@ -2230,6 +2639,16 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("0")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    place_timing_grp.add_argument(args.place_timing_update_accepted_moves, "--place_timing_update_accepted_moves")
+        .help(
+            "If non-zero, timing analysis is also performed during placement (and the quench) each time"
+            " this many moves have been accepted since the last analysis, so that criticalities stay fresh"
+            " late in the anneal. With --timing_update_type incremental only the fan-out cones of the moved"
+            " connections are re-analyzed; the fraction of the timing graph this touched is reported at the"
+            " end of placement. 0 disables these extra analyses.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     place_timing_grp.add_argument(args.place_exp_first, "--td_place_exp_first")
         .help(
             "Controls how critical a connection is as a function of slack at the start of placement."
@@ -2393,6 +2812,16 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
             " Good hints can speed-up determining the minimum channel width.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_grp.add_argument(args.min_route_chan_width_search_jobs, "--min_route_chan_width_search_jobs")
+        .help(
+            "Number of channel widths routed concurrently when searching for the minimum channel width."
+            " Each attempt is routed by a forked process with its own RR graph and routing (so uses that much"
+            " more memory), and attempts which can no longer improve the result are cancelled."
+            " The final (and any --verify_binary_search) routing is performed sequentially."
+            " A value of 1 searches sequentially.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_grp.add_argument<bool, ParseOnOff>(args.verify_binary_search, "--verify_binary_search")
         .help(
             "Force the router to verify the minimum channel width by routing at"
@@ -2405,9 +2834,65 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
             "Specifies the router algorithm to use.\n"
             " * timing driven: focuses on routability and circuit speed [default]\n"
             " * parallel: timing_driven with nets in different regions of the chip routed in parallel\n"
-            " * parallel_decomp: timing_driven with additional parallelism obtained by decomposing high-fanout nets, possibly reducing quality\n")
+            " * parallel_decomp: timing_driven with additional parallelism obtained by decomposing high-fanout nets, possibly reducing quality\n"
+            " * distributed: timing_driven with the regions of the chip routed by several processes, possibly on different hosts."
+            " VPR must be compiled with MPI support and started by mpirun, with the same options and inputs for every process\n")
         .default_value("timing_driven")
-        .choices({"parallel", "parallel_decomp", "timing_driven"})
+        .choices({"parallel", "parallel_decomp", "distributed", "timing_driven"})
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_grp.add_argument<bool, ParseOnOff>(args.parallel_route_overlapping_nets, "--parallel_route_overlapping_nets")
+        .help(
+            "Used with '--router_algorithm parallel'. Also routes nets with overlapping bounding boxes"
+            " concurrently, updating RR node occupancy atomically. Nets which end up sharing an overused"
+            " node are rerouted serially afterwards. Uses an extra copy of the RR node search state per"
+            " thread and is not deterministic.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_grp.add_argument(args.parallel_route_batch_iters, "--parallel_route_batch_iters")
+        .help(
+            "Used with '--router_algorithm parallel'. In this many first routing iterations, all the nets are routed"
+            " concurrently in a single batch, ignoring the partition tree: each thread searches with its own copy of"
+            " the RR node search state and RR node occupancy is updated atomically. Congestion is light in the first"
+            " iterations, so the overuse left by nets which did not see each other is left to the next iterations."
+            " Not deterministic.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_grp.add_argument<bool, ParseOnOff>(args.deterministic_parallel_route, "--deterministic_parallel_route")
+        .help(
+            "Used with '--router_algorithm parallel' and 'parallel_decomp'. Makes the routing result independent"
+            " of the number of worker threads and their scheduling, so that runs are bit-identical."
+            " The netlist partitioning no longer adapts to the thread count, and"
+            " '--parallel_route_overlapping_nets' is disabled.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_grp.add_argument<bool, ParseOnOff>(args.report_parallel_route_load_balance, "--report_parallel_route_load_balance")
+        .help(
+            "Used with '--router_algorithm parallel' and 'parallel_decomp'. After each routing iteration, prints"
+            " how busy the worker threads were (time, nets and heap pops per thread) and how long the root"
+            " and the longest chain of the netlist partition tree took to route.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_grp.add_argument<bool, ParseOnOff>(args.router_global_route_prepass, "--router_global_route_prepass")
+        .help(
+            "Before the first routing iteration, globally routes the nets over a coarse grid of 4x4 tile cells"
+            " (with a few rounds of rip-up and reroute). Each net's route bounding box is then shrunk to its pins"
+            " and the cells its global route goes through, and the channels of the cells which stay congested"
+            " start with a history cost.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_grp.add_argument<bool, ParseOnOff>(args.report_router_profile, "--report_router_profile")
+        .help(
+            "After routing, prints per connection counters of the connection router: expansions per connection,"
+            " the fraction of them which were not on the final path, bounding box retries and a histogram of the"
+            " lookahead error (the path cost over the cost estimated from the net source). These help tune"
+            " '--astar_fac' and the router lookahead.")
+        .default_value("off")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     route_grp.add_argument(args.min_incremental_reroute_fanout, "--min_incremental_reroute_fanout")
@@ -2415,6 +2900,15 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("16")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_grp.add_argument(args.incremental_reroute_all_nets_iter, "--incremental_reroute_all_nets_iter")
+        .help(
+            "The routing iteration from which nets of any fanout are re-routed incrementally:"
+            " only the connections through overused nodes (or forced to reroute for delay) are ripped up"
+            " and re-routed, instead of the whole net."
+            " Useful when few nodes remain overused in late iterations. -1 disables.")
+        .default_value("-1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_grp.add_argument<bool, ParseOnOff>(args.exit_after_first_routing_iteration, "--exit_after_first_routing_iteration")
         .help("Causes VPR to exit after the first routing iteration (useful for saving graphics)")
         .default_value("off")
@@ -2435,9 +2929,11 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
             "Specifies the node reordering algorithm to use.\n"
             " * none: don't reorder nodes\n"
             " * degree_bfs: sort by degree and then by BFS\n"
-            " * random_shuffle: a random shuffle\n")
+            " * random_shuffle: a random shuffle\n"
+            " * hilbert_curve: sort by layer, then by the position of the node along a Hilbert curve\n"
+            "                  over the device grid, so nodes which are close on the chip are close in memory\n")
         .default_value("none")
-        .choices({"none", "degree_bfs", "random_shuffle"})
+        .choices({"none", "degree_bfs", "random_shuffle", "hilbert_curve"})
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     route_grp.add_argument(args.reorder_rr_graph_nodes_threshold, "--reorder_rr_graph_nodes_threshold")
@@ -2452,6 +2948,14 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("1")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_grp.add_argument<bool, ParseOnOff>(args.compact_rr_graph_edges, "--compact_rr_graph_edges")
+        .help(
+            "Once the RR graph is built, free the source node stored for every edge and look it up"
+            " from the per-node edge offsets instead. Reduces RR graph edge memory by about 40%,"
+            " at the cost of slower edge source lookups (used when tracing back paths).")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_grp.add_argument<bool, ParseOnOff>(args.flat_routing, "--flat_routing")
         .help("Enable VPR's flat routing (routing the nets from the source primitive to the destination primitive)")
         .default_value("off")
@@ -2484,6 +2988,21 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("1.2")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_timing_grp.add_argument(args.router_bidir_search_min_dist, "--router_bidir_search_min_dist")
+        .help(
+            "Connections whose source and sink are at least this far apart (Manhattan distance in grid tiles)"
+            " and whose criticality is at most --router_bidir_search_max_criticality are routed with a"
+            " bidirectional search: a backward wave expanded from the sink meets the usual forward A* wave."
+            " This reduces the number of nodes visited when the lookahead is loose, at some cost in path quality"
+            " since the backward wave estimates delay without the upstream resistance. -1 disables.")
+        .default_value("-1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument(args.router_bidir_search_max_criticality, "--router_bidir_search_max_criticality")
+        .help("Maximum criticality of a connection to be routed with the bidirectional search (see --router_bidir_search_min_dist)")
+        .default_value("0.3")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_timing_grp.add_argument(args.max_criticality, "--max_criticality")
         .help(
             "Sets the maximum fraction of routing cost derived from delay (vs routability) for any net."
@@ -2541,6 +3060,15 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("off")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.router_overlap_timing_update, "--router_overlap_timing_update")
+        .help(
+            "Controls whether the timing analysis after each routing iteration runs concurrently with the"
+            " iteration's congestion bookkeeping (local OPIN reservation, present/historical cost and"
+            " wirelength updates) rather than after it. The results are unchanged."
+            " Only has an effect if VPR was built with TBB support.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_timing_grp.add_argument<float>(args.congested_routing_iteration_threshold_frac, "--congested_routing_iteration_threshold")
         .help(
             "Controls when the router enters a high effort mode to resolve lingering routing congestion."
@@ -2556,6 +3084,29 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("dynamic")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_timing_grp.add_argument<e_router_net_order, ParseRouterNetOrder>(args.router_net_order, "--router_net_order")
+        .help(
+            "Controls the order in which the router routes the nets (within each partition of the parallel routers):\n"
+            " * fanout  : nets with more sinks are routed first\n"
+            " * adaptive: nets with the most critical sinks, and whose previous\n"
+            "             routes used the most historically congested nodes,\n"
+            "             are routed first (ties are broken by fanout)\n")
+        .default_value("fanout")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_timing_grp.add_argument<e_router_sink_order, ParseRouterSinkOrder>(args.router_sink_order, "--router_sink_order")
+        .help(
+            "Controls the order in which the router routes the sinks of a net:\n"
+            " * criticality: the most timing critical sinks are routed first\n"
+            " * proximity  : the sinks closest to the already routed part of\n"
+            "                the net are routed first, so that each connection\n"
+            "                starts from a nearby part of the route tree. The\n"
+            "                distance is scaled by (1 - criticality), so that\n"
+            "                critical sinks still come first. Nets with many\n"
+            "                sinks keep the criticality order.\n")
+        .default_value("criticality")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_timing_grp.add_argument<int>(args.router_high_fanout_threshold, "--router_high_fanout_threshold")
         .help(
             "Specifies the net fanout beyond which a net is considered high fanout."
@@ -2571,6 +3122,14 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("0.1")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_timing_grp.add_argument<int>(args.router_high_fanout_batch_size, "--router_high_fanout_batch_size")
+        .help(
+            "Maximum number of spatially close, non-critical sinks of a high fanout net"
+            " which are routed by a single (shared) wavefront expansion."
+            " Values less than 2 route each sink with its own expansion")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_timing_grp.add_argument<e_router_lookahead, ParseRouterLookahead>(args.router_lookahead_type, "--router_lookahead")
         .help(
             "Controls what lookahead the router uses to calculate cost of completing a connection.\n"
@@ -2589,6 +3148,15 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("map")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    route_timing_grp.add_argument<bool, ParseOnOff>(args.router_lookahead_half_precision, "--router_lookahead_half_precision")
+        .help(
+            "Stores the wire cost map of the map router lookahead with 16-bit (bfloat16) instead of 32-bit"
+            " floating point delay and congestion values. This makes the map three times smaller, so more of it"
+            " stays in cache during routing, at the cost of a relative error of at most 2^-8 in each value"
+            " (the actual maximum error is reported when the lookahead is built).")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     route_timing_grp.add_argument(args.router_max_convergence_count, "--router_max_convergence_count")
         .help(
             "Controls how many times the router is allowed to converge to a legal routing before halting."
@@ -2631,7 +3199,13 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
             " * bucket: A bucket heap approximation is used. The bucket heap\n"
             " *         is faster because it is only a heap approximation.\n"
             " *         Testing has shown the approximation results in\n"
-            " *         similiar QoR with less CPU work.\n")
+            " *         similiar QoR with less CPU work.\n"
+            " * four_ary: A cache-aligned 4-ary heap is used. Costs are stored\n"
+            " *         inline with each heap entry, reducing cache misses\n"
+            " *         during heap operations on large RR graphs.\n"
+            " * radix: An exact radix heap is used. It exploits that the costs\n"
+            " *         popped are nearly monotone to avoid most comparisons,\n"
+            " *         without the approximation of the bucket heap.\n")
         .default_value("binary")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
@@ -2687,7 +3261,9 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .show_in(argparse::ShowIn::HELP_ONLY);
 
     route_timing_grp.add_argument<bool, ParseOnOff>(args.check_rr_graph, "--check_rr_graph")
-        .help("Controls whether to check the rr graph when reading from disk.")
+        .help(
+            "Controls whether to check the rr graph when reading from disk."
+            " Defaults to off when the rr graph is read from a device snapshot.")
         .default_value("on")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
@@ -2912,6 +3488,26 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("off")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    noc_grp.add_argument<double>(args.noc_sat_routing_time_limit, "--noc_sat_routing_time_limit")
+        .help(
+            "The maximum time (in seconds) the SAT solver may spend routing traffic flows.\n"
+            "When the limit is reached, the best routing found so far is used even if it is not proven optimal. "
+            "The search starts from the current traffic flow routes, so a routing at least as good as "
+            "the current one is usually found quickly. "
+            "A non-positive value means no time limit.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    noc_grp.add_argument<bool, ParseOnOff>(args.noc_enforce_deadlock_freedom, "--noc_enforce_deadlock_freedom")
+        .help(
+            "Rejects placement moves whose traffic flow routes would form a cycle in the NoC channel dependency graph "
+            "(i.e. could deadlock). The graph is updated incrementally as traffic flows are re-routed.\n"
+            "Turn model routing algorithms are deadlock free by construction; this is intended for routing "
+            "algorithms which are not (e.g. bfs_routing). "
+            "It has no effect if the initial traffic flow routes already contain a cycle.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     noc_grp.add_argument<std::string>(args.noc_placement_file_name, "--noc_placement_file_name")
         .help(
             "Name of the output file that contains the NoC placement information."
@@ -2924,7 +3520,9 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
 
     server_grp.add_argument<bool, ParseOnOff>(args.is_server_mode_enabled, "--server")
         .help("Run in server mode."
-              "Accept client application connection and respond to requests." )
+              "Accept client application connection and respond to requests."
+              " Without graphics (--disp off), requests are served on the loaded design"
+              " once the flow completes, until VPR is terminated." )
         .action(argparse::Action::STORE_TRUE)
         .default_value("off");
 
@@ -3118,6 +3716,11 @@ void set_conditional_defaults(t_options& args) {
             args.router_initial_timing.set(e_router_initial_timing::ALL_CRITICAL, Provenance::INFERRED);
         }
     }
+
+    /*
+     * Device snapshot (once the options it depends on are resolved)
+     */
+    set_device_snapshot_options(args);
 }
 
 bool verify_args(const t_options& args) {
@@ -4,6 +4,7 @@
 
 #include "vpr_types.h"
 #include "constant_nets.h"
+#include "vtr_memory.h"
 #include "argparse_value.hpp"
 #include "argparse.hpp"
 
@@ -31,16 +32,27 @@ struct t_options {
     argparse::ArgValue<std::string> read_vpr_constraints_file;
     argparse::ArgValue<std::string> write_vpr_constraints_file;
 
+    argparse::ArgValue<std::string> eco_net_file;
+    argparse::ArgValue<std::string> eco_place_file;
+    argparse::ArgValue<std::string> eco_route_file;
+
     argparse::ArgValue<std::string> write_placement_delay_lookup;
     argparse::ArgValue<std::string> read_placement_delay_lookup;
 
     argparse::ArgValue<std::string> write_router_lookahead;
     argparse::ArgValue<std::string> read_router_lookahead;
+    argparse::ArgValue<std::string> router_lookahead_cache_dir;
 
     argparse::ArgValue<std::string> write_intra_cluster_router_lookahead;
     argparse::ArgValue<std::string> read_intra_cluster_router_lookahead;
 
     argparse::ArgValue<std::string> write_block_usage;
+    argparse::ArgValue<std::string> write_circuit_binary;
+    argparse::ArgValue<std::string> write_packed_netlist_binary;
+    argparse::ArgValue<std::string> lb_type_rr_graph_cache;
+
+    argparse::ArgValue<std::string> write_device_snapshot;
+    argparse::ArgValue<std::string> read_device_snapshot;
 
     /* Stage Options */
     argparse::ArgValue<bool> do_packing;
@@ -63,12 +75,18 @@ struct t_options {
     argparse::ArgValue<e_timing_update_type> timing_update_type;
     argparse::ArgValue<bool> CreateEchoFile;
     argparse::ArgValue<bool> verify_file_digests;
+    argparse::ArgValue<bool> async_output_file_writes;
+    argparse::ArgValue<std::string> trace_file;
+    argparse::ArgValue<bool> report_memory_usage;
+    argparse::ArgValue<std::string> memory_usage_file;
+    argparse::ArgValue<vtr::e_large_alloc_policy> large_alloc_policy;
     argparse::ArgValue<std::string> device_layout;
     argparse::ArgValue<float> target_device_utilization;
     argparse::ArgValue<e_constant_net_method> constant_net_method;
     argparse::ArgValue<e_clock_modeling> clock_modeling;
     argparse::ArgValue<bool> two_stage_clock_routing;
     argparse::ArgValue<bool> exit_before_pack;
+    argparse::ArgValue<bool> pipeline_device_creation;
     argparse::ArgValue<bool> strict_checks;
     argparse::ArgValue<std::string> disable_errors;
     argparse::ArgValue<std::string> suppress_warnings;
@@ -87,6 +105,7 @@ struct t_options {
     argparse::ArgValue<bool> sweep_dangling_blocks;
     argparse::ArgValue<bool> sweep_constant_primary_outputs;
     argparse::ArgValue<int> netlist_verbosity;
+    argparse::ArgValue<bool> parallel_blif_read;
 
     /* Clustering options */
     argparse::ArgValue<bool> connection_driven_clustering;
@@ -100,12 +119,15 @@ struct t_options {
     argparse::ArgValue<std::vector<std::string>> target_external_pin_util;
     argparse::ArgValue<bool> pack_prioritize_transitive_connectivity;
     argparse::ArgValue<int> pack_transitive_fanout_threshold;
+    argparse::ArgValue<int> pack_timing_update_interval;
+    argparse::ArgValue<bool> pack_stream_output;
     argparse::ArgValue<int> pack_feasible_block_array_size;
     argparse::ArgValue<std::vector<std::string>> pack_high_fanout_threshold;
     argparse::ArgValue<int> pack_verbosity;
     argparse::ArgValue<bool> use_attraction_groups;
     argparse::ArgValue<int> pack_num_moves;
     argparse::ArgValue<std::string> pack_move_type;
+    argparse::ArgValue<int> pack_partition_size;
     /* Placement options */
     argparse::ArgValue<int> Seed;
     argparse::ArgValue<bool> ShowPlaceTiming;
@@ -129,6 +151,7 @@ struct t_options {
     argparse::ArgValue<e_place_effort_scaling> place_effort_scaling;
     argparse::ArgValue<e_place_delta_delay_algorithm> place_delta_delay_matrix_calculation_method;
     argparse::ArgValue<bool> enable_analytic_placer;
+    argparse::ArgValue<float> analytic_placer_anneal_t_scale;
     argparse::ArgValue<std::vector<float>> place_static_move_prob;
     argparse::ArgValue<int> place_high_fanout_net;
     argparse::ArgValue<e_place_bounding_box_mode> place_bounding_box_mode;
@@ -138,6 +161,7 @@ struct t_options {
     argparse::ArgValue<bool> place_checkpointing;
     argparse::ArgValue<float> place_agent_epsilon;
     argparse::ArgValue<float> place_agent_gamma;
+    argparse::ArgValue<int> place_agent_update_window;
     argparse::ArgValue<float> place_dm_rlim;
     argparse::ArgValue<e_agent_space> place_agent_space;
     argparse::ArgValue<e_agent_algorithm> place_agent_algorithm;
@@ -147,6 +171,17 @@ struct t_options {
     argparse::ArgValue<bool> place_constraint_subtile;
     argparse::ArgValue<int> floorplan_num_horizontal_partitions;
     argparse::ArgValue<int> floorplan_num_vertical_partitions;
+    argparse::ArgValue<int> place_parallel_moves;
+    argparse::ArgValue<int> place_seeds;
+    argparse::ArgValue<float> place_seeds_prune_margin;
+    argparse::ArgValue<float> place_congestion_weight;
+    argparse::ArgValue<bool> place_multilevel;
+    argparse::ArgValue<std::string> place_checkpoint_file;
+    argparse::ArgValue<int> place_checkpoint_interval;
+    argparse::ArgValue<bool> resume_place;
+    argparse::ArgValue<int> place_timing_sample_fanout;
+    argparse::ArgValue<int> place_timing_sample_size;
+    argparse::ArgValue<float> place_check_sample_fraction;
 
     argparse::ArgValue<int> placer_debug_block;
     argparse::ArgValue<int> placer_debug_net;
@@ -167,6 +202,8 @@ struct t_options {
     argparse::ArgValue<int> noc_sat_routing_congestion_weighting_factor;
     argparse::ArgValue<int> noc_sat_routing_num_workers;
     argparse::ArgValue<bool> noc_sat_routing_log_search_progress;
+    argparse::ArgValue<double> noc_sat_routing_time_limit;
+    argparse::ArgValue<bool> noc_enforce_deadlock_freedom;
     argparse::ArgValue<std::string> noc_placement_file_name;
 
     /* Timing-driven placement options only */
@@ -174,6 +211,7 @@ struct t_options {
     argparse::ArgValue<int> RecomputeCritIter;
     argparse::ArgValue<int> inner_loop_recompute_divider;
     argparse::ArgValue<int> quench_recompute_divider;
+    argparse::ArgValue<int> place_timing_update_accepted_moves;
     argparse::ArgValue<float> place_exp_first;
     argparse::ArgValue<float> place_exp_last;
     argparse::ArgValue<float> place_delay_offset;
@@ -200,23 +238,34 @@ struct t_options {
     argparse::ArgValue<e_route_type> RouteType;
     argparse::ArgValue<int> RouteChanWidth;
     argparse::ArgValue<int> min_route_chan_width_hint; ///<Hint to binary search router about what the min chan width is
+    argparse::ArgValue<int> min_route_chan_width_search_jobs; ///<Number of channel widths routed concurrently by the binary search
     argparse::ArgValue<bool> verify_binary_search;
     argparse::ArgValue<e_router_algorithm> RouterAlgorithm;
     argparse::ArgValue<int> min_incremental_reroute_fanout;
+    argparse::ArgValue<int> incremental_reroute_all_nets_iter;
     argparse::ArgValue<bool> read_rr_edge_metadata;
     argparse::ArgValue<bool> exit_after_first_routing_iteration;
+    argparse::ArgValue<bool> parallel_route_overlapping_nets;
+    argparse::ArgValue<int> parallel_route_batch_iters;
+    argparse::ArgValue<bool> deterministic_parallel_route;
+    argparse::ArgValue<bool> report_parallel_route_load_balance;
+    argparse::ArgValue<bool> router_global_route_prepass;
+    argparse::ArgValue<bool> report_router_profile;
     argparse::ArgValue<e_check_route_option> check_route;
     argparse::ArgValue<size_t> max_logged_overused_rr_nodes;
     argparse::ArgValue<bool> generate_rr_node_overuse_report;
     argparse::ArgValue<e_rr_node_reorder_algorithm> reorder_rr_graph_nodes_algorithm;
     argparse::ArgValue<int> reorder_rr_graph_nodes_threshold;
     argparse::ArgValue<int> reorder_rr_graph_nodes_seed;
+    argparse::ArgValue<bool> compact_rr_graph_edges;
     argparse::ArgValue<bool> flat_routing;
     argparse::ArgValue<bool> has_choking_spot;
 
     /* Timing-driven router options only */
     argparse::ArgValue<float> astar_fac;
     argparse::ArgValue<float> router_profiler_astar_fac;
+    argparse::ArgValue<int> router_bidir_search_min_dist;
+    argparse::ArgValue<float> router_bidir_search_max_criticality;
     argparse::ArgValue<float> max_criticality;
     argparse::ArgValue<float> criticality_exp;
     argparse::ArgValue<float> router_init_wirelength_abort_threshold;
@@ -224,19 +273,24 @@ struct t_options {
     argparse::ArgValue<e_routing_failure_predictor> routing_failure_predictor;
     argparse::ArgValue<e_routing_budgets_algorithm> routing_budgets_algorithm;
     argparse::ArgValue<bool> save_routing_per_iteration;
+    argparse::ArgValue<bool> router_overlap_timing_update;
     argparse::ArgValue<float> congested_routing_iteration_threshold_frac;
     argparse::ArgValue<e_route_bb_update> route_bb_update;
     argparse::ArgValue<int> router_high_fanout_threshold;
     argparse::ArgValue<float> router_high_fanout_max_slope;
+    argparse::ArgValue<int> router_high_fanout_batch_size;
     argparse::ArgValue<int> router_debug_net;
     argparse::ArgValue<int> router_debug_sink_rr;
     argparse::ArgValue<int> router_debug_iteration;
     argparse::ArgValue<e_router_lookahead> router_lookahead_type;
+    argparse::ArgValue<bool> router_lookahead_half_precision;
     argparse::ArgValue<int> router_max_convergence_count;
     argparse::ArgValue<float> router_reconvergence_cpd_threshold;
     argparse::ArgValue<bool> router_update_lower_bound_delays;
     argparse::ArgValue<std::string> router_first_iteration_timing_report_file;
     argparse::ArgValue<e_router_initial_timing> router_initial_timing;
+    argparse::ArgValue<e_router_net_order> router_net_order;
+    argparse::ArgValue<e_router_sink_order> router_sink_order;
     argparse::ArgValue<e_heap_type> router_heap;
 
     /* Analysis options */
@@ -1,6 +1,7 @@
 #include <cstdio>
 #include <cstring>
 #include <fstream>
+#include <sstream>
 #include <algorithm>
 
 #include "vtr_assert.h"
@@ -16,6 +17,8 @@
 #include "read_place.h"
 #include "read_xml_arch_file.h"
 #include "place_util.h"
+#include "binary_file_io.h"
+#include "output_file_writer.h"
 
 void read_place_header(
     std::ifstream& placement_file,
@@ -29,11 +32,32 @@ void read_place_body(
     const char* place_file,
     bool is_place_file);
 
+static void read_place_binary(const char* net_file,
+                              const char* place_file,
+                              bool verify_file_digests,
+                              const DeviceGrid& grid);
+
+static void print_place_binary(const char* net_file,
+                               const char* net_id,
+                               const char* place_file);
+
+/* Identifies a binary placement file. Bump the version whenever the layout written below changes */
+static constexpr char BINARY_PLACE_MAGIC[8] = {'V', 'P', 'R', 'P', 'L', 'A', 'C', 'E'};
+static constexpr uint32_t BINARY_PLACE_VERSION = 1;
+
+///@brief Number of blocks in each (independently encoded) block of a binary placement file
+static constexpr size_t BINARY_PLACE_BLOCKS_PER_CHUNK = 4096;
+
 void read_place(
     const char* net_file,
     const char* place_file,
     bool verify_file_digests,
     const DeviceGrid& grid) {
+    if (is_binary_file_name(place_file)) {
+        read_place_binary(net_file, place_file, verify_file_digests, grid);
+        return;
+    }
+
     std::ifstream fstream(place_file);
     if (!fstream) {
         VPR_FATAL_ERROR(VPR_ERROR_PLACE_F,
@@ -310,37 +334,199 @@ void read_place_body(std::ifstream& placement_file,
 void print_place(const char* net_file,
                  const char* net_id,
                  const char* place_file) {
-    FILE* fp;
+    if (is_binary_file_name(place_file)) {
+        print_place_binary(net_file, net_id, place_file);
+        return;
+    }
 
     auto& device_ctx = g_vpr_ctx.device();
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_ctx = g_vpr_ctx.mutable_placement();
 
-    fp = fopen(place_file, "w");
-
-    fprintf(fp, "Netlist_File: %s Netlist_ID: %s\n",
-            net_file,
-            net_id);
-    fprintf(fp, "Array size: %zu x %zu logic blocks\n\n", device_ctx.grid.width(), device_ctx.grid.height());
-    fprintf(fp, "#block name\tx\ty\tsubblk\tlayer\tblock number\n");
-    fprintf(fp, "#----------\t--\t--\t------\t-----\t------------\n");
+    //Formatted in memory, so the file can be written in the background (see output_file_writer.h)
+    std::string contents;
+    contents += vtr::string_fmt("Netlist_File: %s Netlist_ID: %s\n",
+                                net_file,
+                                net_id);
+    contents += vtr::string_fmt("Array size: %zu x %zu logic blocks\n\n", device_ctx.grid.width(), device_ctx.grid.height());
+    contents += "#block name\tx\ty\tsubblk\tlayer\tblock number\n";
+    contents += "#----------\t--\t--\t------\t-----\t------------\n";
 
     if (!place_ctx.block_locs.empty()) { //Only if placement exists
         for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
-            fprintf(fp, "%s\t", cluster_ctx.clb_nlist.block_pb(blk_id)->name);
+            contents += vtr::string_fmt("%s\t", cluster_ctx.clb_nlist.block_pb(blk_id)->name);
             if (strlen(cluster_ctx.clb_nlist.block_pb(blk_id)->name) < 8)
-                fprintf(fp, "\t");
-
-            fprintf(fp, "%d\t%d\t%d\t%d",
-                    place_ctx.block_locs[blk_id].loc.x,
-                    place_ctx.block_locs[blk_id].loc.y,
-                    place_ctx.block_locs[blk_id].loc.sub_tile,
-                    place_ctx.block_locs[blk_id].loc.layer);
-            fprintf(fp, "\t#%zu\n", size_t(blk_id));
+                contents += "\t";
+
+            contents += vtr::string_fmt("%d\t%d\t%d\t%d",
+                                        place_ctx.block_locs[blk_id].loc.x,
+                                        place_ctx.block_locs[blk_id].loc.y,
+                                        place_ctx.block_locs[blk_id].loc.sub_tile,
+                                        place_ctx.block_locs[blk_id].loc.layer);
+            contents += vtr::string_fmt("\t#%zu\n", size_t(blk_id));
         }
     }
-    fclose(fp);
 
     //Calculate the ID of the placement
+    std::istringstream contents_stream(contents);
+    place_ctx.placement_id = vtr::secure_digest_stream(contents_stream);
+
+    write_output_file(place_file, std::move(contents), VPR_ERROR_PLACE_F);
+}
+
+/**
+ * @brief Reads a binary placement file (.place.bin) written by print_place_binary()
+ *
+ * The netlist and grid checks match those of read_place_header(). The block names and
+ * locations are decoded in parallel, and applied in file order.
+ */
+static void read_place_binary(const char* net_file,
+                              const char* place_file,
+                              bool verify_file_digests,
+                              const DeviceGrid& grid) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+
+    VTR_LOG("Reading %s.\n", place_file);
+    VTR_LOG("\n");
+
+    std::string header_data;
+    std::vector<std::string> chunks;
+    read_binary_file(place_file, BINARY_PLACE_MAGIC, BINARY_PLACE_VERSION, header_data, chunks, VPR_ERROR_PLACE_F);
+
+    BinaryDecoder header(header_data);
+    std::string place_netlist_file = header.read_string();
+    std::string place_netlist_id = header.read_string();
+    size_t place_file_width = header.read_uint();
+    size_t place_file_height = header.read_uint();
+    size_t num_blocks = header.read_uint();
+    if (!header.ok() || chunks.size() != (num_blocks + BINARY_PLACE_BLOCKS_PER_CHUNK - 1) / BINARY_PLACE_BLOCKS_PER_CHUNK) {
+        vpr_throw(VPR_ERROR_PLACE_F, place_file, 0, "Binary placement file header is truncated or corrupt");
+    }
+
+    if (place_netlist_id != cluster_ctx.clb_nlist.netlist_id()) {
+        auto msg = vtr::string_fmt(
+            "The packed netlist file that generated placement (File: '%s' ID: '%s')"
+            " does not match current netlist (File: '%s' ID: '%s')",
+            place_netlist_file.c_str(), place_netlist_id.c_str(),
+            net_file, cluster_ctx.clb_nlist.netlist_id().c_str());
+        if (verify_file_digests) {
+            vpr_throw(VPR_ERROR_PLACE_F, place_file, 0, msg.c_str());
+        } else {
+            VTR_LOGF_WARN(place_file, 0, "%s\n", msg.c_str());
+        }
+    }
+
+    if (grid.width() != place_file_width || grid.height() != place_file_height) {
+        vpr_throw(VPR_ERROR_PLACE_F, place_file, 0,
+                  "Current FPGA size (%d x %d) is different from size when placement generated (%d x %d)",
+                  grid.width(), grid.height(), place_file_width, place_file_height);
+    }
+
+    //Decode the block names and locations
+    std::vector<std::pair<std::string, t_pl_loc>> block_locs(num_blocks);
+    for_each_binary_block(chunks.size(), [&](size_t ichunk) {
+        BinaryDecoder decoder(chunks[ichunk]);
+
+        size_t end = std::min(num_blocks, (ichunk + 1) * BINARY_PLACE_BLOCKS_PER_CHUNK);
+        for (size_t iblk = ichunk * BINARY_PLACE_BLOCKS_PER_CHUNK; iblk < end; ++iblk) {
+            block_locs[iblk].first = decoder.read_string();
+            t_pl_loc& loc = block_locs[iblk].second;
+            loc.x = decoder.read_int();
+            loc.y = decoder.read_int();
+            loc.sub_tile = decoder.read_int();
+            loc.layer = decoder.read_int();
+        }
+
+        if (!decoder.ok() || !decoder.at_end()) {
+            vpr_throw(VPR_ERROR_PLACE_F, place_file, 0, "Binary placement file is corrupt (chunk %zu)", ichunk);
+        }
+    });
+
+    vtr::vector_map<ClusterBlockId, bool> seen_blocks;
+    for (auto block_id : cluster_ctx.clb_nlist.blocks()) {
+        seen_blocks.insert(block_id, false);
+    }
+
+    for (size_t iblk = 0; iblk < num_blocks; ++iblk) {
+        const std::string& block_name = block_locs[iblk].first;
+
+        //Blocks are written in netlist order, so avoid the name lookup if possible
+        ClusterBlockId blk_id(iblk);
+        if (iblk >= cluster_ctx.clb_nlist.blocks().size() || cluster_ctx.clb_nlist.block_name(blk_id) != block_name) {
+            blk_id = cluster_ctx.clb_nlist.find_block(block_name);
+        }
+
+        if (blk_id == ClusterBlockId::INVALID()) {
+            VTR_LOG_WARN("Block %s has an invalid name and it is going to be skipped.\n", block_name.c_str());
+            continue;
+        }
+
+        if (seen_blocks[blk_id]) {
+            vpr_throw(VPR_ERROR_PLACE_F, place_file, 0,
+                      "Block %s is specified more than once in the placement file", block_name.c_str());
+        }
+
+        set_block_location(blk_id, block_locs[iblk].second);
+        seen_blocks[blk_id] = true;
+    }
+
+    for (auto block_id : cluster_ctx.clb_nlist.blocks()) {
+        if (!seen_blocks[block_id]) {
+            VPR_THROW(VPR_ERROR_PLACE, "Block %d has not been read from the place file. \n", block_id);
+        }
+    }
+
+    //Want to make a hash for place file to be used during routing for error checking
     place_ctx.placement_id = vtr::secure_digest_file(place_file);
+
+    VTR_LOG("Successfully read %s.\n", place_file);
+    VTR_LOG("\n");
+}
+
+/**
+ * @brief Prints out the placement of the circuit to a binary placement file (.place.bin)
+ *
+ * The file holds the same information as a .place file: the netlist and grid size the
+ * placement was made for, followed by the name and location of every block.
+ */
+static void print_place_binary(const char* net_file,
+                               const char* net_id,
+                               const char* place_file) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+
+    //Only if placement exists
+    size_t num_blocks = place_ctx.block_locs.empty() ? 0 : cluster_ctx.clb_nlist.blocks().size();
+    std::vector<ClusterBlockId> blocks(cluster_ctx.clb_nlist.blocks().begin(), cluster_ctx.clb_nlist.blocks().end());
+
+    BinaryEncoder header;
+    header.write_string(net_file ? net_file : "");
+    header.write_string(net_id ? net_id : "");
+    header.write_uint(device_ctx.grid.width());
+    header.write_uint(device_ctx.grid.height());
+    header.write_uint(num_blocks);
+
+    std::vector<std::string> chunks((num_blocks + BINARY_PLACE_BLOCKS_PER_CHUNK - 1) / BINARY_PLACE_BLOCKS_PER_CHUNK);
+    for_each_binary_block(chunks.size(), [&](size_t ichunk) {
+        BinaryEncoder encoder;
+
+        size_t end = std::min(num_blocks, (ichunk + 1) * BINARY_PLACE_BLOCKS_PER_CHUNK);
+        for (size_t iblk = ichunk * BINARY_PLACE_BLOCKS_PER_CHUNK; iblk < end; ++iblk) {
+            ClusterBlockId blk_id = blocks[iblk];
+            const t_pl_loc& loc = place_ctx.block_locs[blk_id].loc;
+
+            encoder.write_string(cluster_ctx.clb_nlist.block_pb(blk_id)->name);
+            encoder.write_int(loc.x);
+            encoder.write_int(loc.y);
+            encoder.write_int(loc.sub_tile);
+            encoder.write_int(loc.layer);
+        }
+
+        chunks[ichunk] = std::move(encoder.data());
+    });
+
+    //Calculate the ID of the placement
+    place_ctx.placement_id = write_binary_file(place_file, BINARY_PLACE_MAGIC, BINARY_PLACE_VERSION, header.data(), chunks, VPR_ERROR_PLACE_F);
 }
@@ -47,10 +47,16 @@
 #include "route_tree.h"
 #include "read_route.h"
 #include "binary_heap.h"
+#include "binary_file_io.h"
+#include "output_file_writer.h"
 
 #include "old_traceback.h"
 
 /*************Functions local to this module*************/
+static void alloc_route_structs(const Netlist<>& net_list, const t_router_opts& router_opts);
+static void read_route_text(const Netlist<>& net_list, const char* route_file, const t_router_opts& router_opts, bool verify_file_digests, bool is_flat);
+static void read_route_binary(const Netlist<>& net_list, const char* route_file, const t_router_opts& router_opts, bool verify_file_digests, bool is_flat);
+static void process_binary_net(const Netlist<>& net_list, ParentNetId net_id, BinaryDecoder& decoder, const char* route_file);
 static void process_route(const Netlist<>& net_list, std::ifstream& fp, const char* filename, int& lineno, bool is_flat);
 static void process_nodes(const Netlist<>& net_list, std::ifstream& fp, ClusterNetId inet, const char* filename, int& lineno);
 static void process_nets(const Netlist<>& net_list, std::ifstream& fp, ClusterNetId inet, std::string name, std::vector<std::string> input_tokens, const char* filename, int& lineno, bool is_flat);
@@ -59,7 +65,8 @@ static void format_coordinates(int& layer_num, int& x, int& y, std::string coord
 static void format_pin_info(std::string& pb_name, std::string& port_name, int& pb_pin_num, std::string input);
 static std::string format_name(std::string name);
 static bool check_rr_graph_connectivity(RRNodeId prev_node, RRNodeId node);
-void print_route(const Netlist<>& net_list, FILE* fp, bool is_flat);
+void print_route(const Netlist<>& net_list, std::string& out, bool is_flat);
+static std::string print_route_binary(const Netlist<>& net_list, const char* placement_file, const char* route_file, bool is_flat);
 
 /*************Global Functions****************************/
 
@@ -71,11 +78,60 @@ void print_route(const Netlist<>& net_list, FILE* fp, bool is_flat);
  */
 bool read_route(const char* route_file, const t_router_opts& router_opts, bool verify_file_digests, bool is_flat) {
     auto& device_ctx = g_vpr_ctx.mutable_device();
-    auto& place_ctx = g_vpr_ctx.placement();
     bool flat_router = router_opts.flat_routing;
     /* Begin parsing the file */
     VTR_LOG("Begin loading FPGA routing file.\n");
 
+    const Netlist<>& router_net_list = (flat_router) ? (const Netlist<>&)g_vpr_ctx.atom().nlist : (const Netlist<>&)g_vpr_ctx.clustering().clb_nlist;
+
+    if (is_binary_file_name(route_file)) {
+        read_route_binary(router_net_list, route_file, router_opts, verify_file_digests, is_flat);
+    } else {
+        read_route_text(router_net_list, route_file, router_opts, verify_file_digests, is_flat);
+    }
+
+    /*Correctly set up the clb opins*/
+    BinaryHeap small_heap;
+    small_heap.init_heap(device_ctx.grid);
+    if (!flat_router) {
+        reserve_locally_used_opins(&small_heap, router_opts.initial_pres_fac,
+                                   router_opts.acc_fac, false, flat_router);
+    }
+    recompute_occupancy_from_scratch(router_net_list,
+                                     flat_router);
+
+    /* Note: This pres_fac is not necessarily correct since it isn't the first routing iteration*/
+    OveruseInfo overuse_info(device_ctx.rr_graph.num_nodes());
+    pathfinder_update_acc_cost_and_overuse_info(router_opts.acc_fac, overuse_info);
+    if (!flat_router) {
+        reserve_locally_used_opins(&small_heap, router_opts.initial_pres_fac,
+                                   router_opts.acc_fac, true, flat_router);
+    }
+
+    /* Finished loading in the routing, now check it*/
+    recompute_occupancy_from_scratch(router_net_list,
+                                     flat_router);
+    bool is_feasible = feasible_routing();
+
+    VTR_LOG("Finished loading route file\n");
+
+    return is_feasible;
+}
+
+///@brief Allocates the routing structures the loaded routing is stored in
+static void alloc_route_structs(const Netlist<>& net_list, const t_router_opts& router_opts) {
+    alloc_and_load_rr_node_route_structs();
+    init_route_structs(net_list,
+                       router_opts.bb_factor,
+                       router_opts.has_choking_spot,
+                       router_opts.flat_routing);
+}
+
+///@brief Reads a (text) .route file
+static void read_route_text(const Netlist<>& net_list, const char* route_file, const t_router_opts& router_opts, bool verify_file_digests, bool is_flat) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& place_ctx = g_vpr_ctx.placement();
+
     std::string header_str;
 
     std::ifstream fp;
@@ -105,12 +161,7 @@ bool read_route(const char* route_file, const t_router_opts& router_opts, bool v
     }
 
     /*Allocate necessary routing structures*/
-    alloc_and_load_rr_node_route_structs();
-    const Netlist<>& router_net_list = (flat_router) ? (const Netlist<>&)g_vpr_ctx.atom().nlist : (const Netlist<>&)g_vpr_ctx.clustering().clb_nlist;
-    init_route_structs(router_net_list,
-                       router_opts.bb_factor,
-                       router_opts.has_choking_spot,
-                       flat_router);
+    alloc_route_structs(net_list, router_opts);
 
     /*Check dimensions*/
     std::getline(fp, header_str);
@@ -124,36 +175,9 @@ bool read_route(const char* route_file, const t_router_opts& router_opts, bool v
     }
 
     /* Read in every net */
-    process_route(router_net_list, fp, route_file, lineno, is_flat);
+    process_route(net_list, fp, route_file, lineno, is_flat);
 
     fp.close();
-
-    /*Correctly set up the clb opins*/
-    BinaryHeap small_heap;
-    small_heap.init_heap(device_ctx.grid);
-    if (!flat_router) {
-        reserve_locally_used_opins(&small_heap, router_opts.initial_pres_fac,
-                                   router_opts.acc_fac, false, flat_router);
-    }
-    recompute_occupancy_from_scratch(router_net_list,
-                                     flat_router);
-
-    /* Note: This pres_fac is not necessarily correct since it isn't the first routing iteration*/
-    OveruseInfo overuse_info(device_ctx.rr_graph.num_nodes());
-    pathfinder_update_acc_cost_and_overuse_info(router_opts.acc_fac, overuse_info);
-    if (!flat_router) {
-        reserve_locally_used_opins(&small_heap, router_opts.initial_pres_fac,
-                                   router_opts.acc_fac, true, flat_router);
-    }
-
-    /* Finished loading in the routing, now check it*/
-    recompute_occupancy_from_scratch(router_net_list,
-                                     flat_router);
-    bool is_feasible = feasible_routing();
-
-    VTR_LOG("Finished loading route file\n");
-
-    return is_feasible;
 }
 
 ///@brief Walks through every net and add the routing appropriately
@@ -566,8 +590,260 @@ static bool check_rr_graph_connectivity(RRNodeId prev_node, RRNodeId node) {
     return false;
 }
 
+/* Identifies a binary route file. Bump the version whenever the layout written below changes */
+static constexpr char BINARY_ROUTE_MAGIC[8] = {'V', 'P', 'R', 'R', 'O', 'U', 'T', 'E'};
+static constexpr uint32_t BINARY_ROUTE_VERSION = 1;
+
+///@brief Number of nets in each (independently encoded) block of a binary route file
+static constexpr size_t BINARY_ROUTE_NETS_PER_BLOCK = 1024;
+
+///@brief How a net is stored in a binary route file
+enum class e_binary_route_net : uint64_t {
+    UNROUTED = 0, ///<No routing
+    ROUTED,       ///<Followed by the traceback of the net's route tree
+    LOCAL_ONLY,   ///<Used in local cluster only
+    GLOBAL        ///<Global net, never routed
+};
+
+/**
+ * @brief Reads a binary route file (.route.bin) written by print_route_binary()
+ *
+ * The file identifies the RR nodes used by each net, so the netlist, placement and RR graph
+ * (rather than every node's coordinates, as in a .route file) are checked against the those
+ * the routing was created with. The nets are decoded in parallel.
+ */
+static void read_route_binary(const Netlist<>& net_list, const char* route_file, const t_router_opts& router_opts, bool verify_file_digests, bool is_flat) {
+    auto& device_ctx = g_vpr_ctx.device();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    std::string header_data;
+    std::vector<std::string> blocks;
+    read_binary_file(route_file, BINARY_ROUTE_MAGIC, BINARY_ROUTE_VERSION, header_data, blocks, VPR_ERROR_ROUTE);
+
+    BinaryDecoder header(header_data);
+    std::string placement_file = header.read_string();
+    std::string placement_id = header.read_string();
+    std::string netlist_id = header.read_string();
+    bool file_is_flat = header.read_uint();
+    size_t grid_width = header.read_uint();
+    size_t grid_height = header.read_uint();
+    size_t num_rr_nodes = header.read_uint();
+    size_t num_nets = header.read_uint();
+    if (!header.ok()) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, 0, "Binary routing file header is truncated or corrupt");
+    }
+
+    if (placement_id != place_ctx.placement_id) {
+        auto msg = vtr::string_fmt(
+            "Placement file %s specified in the routing file"
+            " does not match the loaded placement (ID %s != %s)",
+            placement_file.c_str(), placement_id.c_str(), place_ctx.placement_id.c_str());
+        if (verify_file_digests) {
+            vpr_throw(VPR_ERROR_ROUTE, route_file, 0, msg.c_str());
+        } else {
+            VTR_LOGF_WARN(route_file, 0, "%s\n", msg.c_str());
+        }
+    }
+
+    if (file_is_flat != is_flat) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                  "The routing file was created %s flat routing; re-run vpr %s the --flat_routing option",
+                  file_is_flat ? "with" : "without", file_is_flat ? "with" : "without");
+    }
+
+    if (netlist_id != net_list.netlist_id()) {
+        auto msg = vtr::string_fmt(
+            "The netlist that generated the routing (ID %s) does not match the current netlist (ID %s)",
+            netlist_id.c_str(), net_list.netlist_id().c_str());
+        if (verify_file_digests) {
+            vpr_throw(VPR_ERROR_ROUTE, route_file, 0, msg.c_str());
+        } else {
+            VTR_LOGF_WARN(route_file, 0, "%s\n", msg.c_str());
+        }
+    }
+
+    if (grid_width != device_ctx.grid.width() || grid_height != device_ctx.grid.height()) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                  "Device dimensions %zux%zu specified in the routing file does not match given %zux%zu",
+                  grid_width, grid_height, device_ctx.grid.width(), device_ctx.grid.height());
+    }
+
+    if (num_rr_nodes != device_ctx.rr_graph.num_nodes()) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                  "The routing file was created with an RR graph of %zu nodes, but the current RR graph has %zu nodes",
+                  num_rr_nodes, device_ctx.rr_graph.num_nodes());
+    }
+
+    std::vector<ParentNetId> nets(net_list.nets().begin(), net_list.nets().end());
+    if (num_nets != nets.size() || blocks.size() != (num_nets + BINARY_ROUTE_NETS_PER_BLOCK - 1) / BINARY_ROUTE_NETS_PER_BLOCK) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                  "The routing file has %zu nets, but the netlist has %zu nets",
+                  num_nets, nets.size());
+    }
+
+    /*Allocate necessary routing structures*/
+    alloc_route_structs(net_list, router_opts);
+
+    /* Read in every net */
+    for_each_binary_block(blocks.size(), [&](size_t iblock) {
+        BinaryDecoder decoder(blocks[iblock]);
+
+        size_t end = std::min(num_nets, (iblock + 1) * BINARY_ROUTE_NETS_PER_BLOCK);
+        for (size_t inet = iblock * BINARY_ROUTE_NETS_PER_BLOCK; inet < end; ++inet) {
+            process_binary_net(net_list, nets[inet], decoder, route_file);
+        }
+
+        if (!decoder.ok() || !decoder.at_end()) {
+            vpr_throw(VPR_ERROR_ROUTE, route_file, 0, "Binary routing file is corrupt (block %zu)", iblock);
+        }
+    });
+}
+
+///@brief Reads the routing of net_id from a binary route file, and builds its route tree
+static void process_binary_net(const Netlist<>& net_list, ParentNetId net_id, BinaryDecoder& decoder, const char* route_file) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    auto net_type = e_binary_route_net(decoder.read_uint());
+    if (net_type == e_binary_route_net::GLOBAL) {
+        if (!net_list.net_is_ignored(net_id)) {
+            vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                      "Net %zu should be a global net", size_t(net_id));
+        }
+        return;
+    }
+
+    if (net_list.net_is_ignored(net_id)) {
+        VTR_LOG_WARN("Net %zu (%s) is marked as global in the netlist, but is non-global in the .route file\n", size_t(net_id), net_list.net_name(net_id).c_str());
+    }
+
+    if (net_type == e_binary_route_net::LOCAL_ONLY) {
+        if (net_list.net_sinks(net_id).size() != 0) {
+            vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                      "Net %zu should be used in local cluster only, reserved one CLB pin", size_t(net_id));
+        }
+        return;
+    } else if (net_type == e_binary_route_net::UNROUTED) {
+        return;
+    } else if (net_type != e_binary_route_net::ROUTED) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, 0, "Binary routing file is corrupt (net %zu)", size_t(net_id));
+    }
+
+    //The traceback, with the nodes stored as the difference from the previous node
+    size_t num_traces = decoder.read_uint();
+    if (!decoder.ok() || num_traces == 0 || num_traces > rr_graph.num_nodes() * 2) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, 0, "Binary routing file is corrupt (net %zu)", size_t(net_id));
+    }
+
+    std::vector<t_trace> traces(num_traces);
+    int64_t inode = 0;
+    RRNodeId prev_node(-1);
+    for (size_t itrace = 0; itrace < num_traces; ++itrace) {
+        inode += decoder.read_int();
+        int iswitch = int(decoder.read_uint()) - 1;
+        if (inode < 0 || size_t(inode) >= rr_graph.num_nodes() || iswitch >= int(rr_graph.num_rr_switches())) {
+            vpr_throw(VPR_ERROR_ROUTE, route_file, 0, "Binary routing file is corrupt (net %zu)", size_t(net_id));
+        }
+
+        RRNodeId rr_node(inode);
+        if (itrace == 0 && rr_graph.node_type(rr_node) != SOURCE) {
+            vpr_throw(VPR_ERROR_ROUTE, route_file, 0,
+                      "First node in routing has to be a source type");
+        }
+
+        /* Check for connectivity, this throws an exception when a dangling net is encountered in the routing file */
+        if (!check_rr_graph_connectivity(prev_node, rr_node)) {
+            vpr_throw(VPR_ERROR_ROUTE, route_file, 0, "Dangling branch at net %zu, nodes %zu -> %zu", size_t(net_id), size_t(prev_node), size_t(rr_node));
+        }
+        prev_node = rr_node;
+
+        t_trace& trace = traces[itrace];
+        trace.index = int(inode);
+        trace.iswitch = short(iswitch);
+        trace.net_pin_index = (rr_graph.node_type(rr_node) == SINK) ? int(decoder.read_uint()) - 1 : OPEN;
+        trace.next = (itrace + 1 < num_traces) ? &traces[itrace + 1] : nullptr;
+    }
+
+    if (!decoder.ok()) {
+        vpr_throw(VPR_ERROR_ROUTE, route_file, 0, "Binary routing file is corrupt (net %zu)", size_t(net_id));
+    }
+
+    /* Convert to route_tree after reading */
+    VTR_ASSERT(validate_traceback(traces.data()));
+    route_ctx.route_trees[net_id] = TracebackCompat::traceback_to_route_tree(traces.data());
+}
+
+/**
+ * @brief Writes the routing to a binary route file (.route.bin)
+ *
+ * Each net's traceback is stored as in a .route file, but only by RR node (as the difference
+ * from the previous node), switch and net pin index. Blocks of nets are encoded in parallel.
+ */
+static std::string print_route_binary(const Netlist<>& net_list, const char* placement_file, const char* route_file, bool is_flat) {
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+    auto& route_ctx = g_vpr_ctx.routing();
+
+    std::vector<ParentNetId> nets(net_list.nets().begin(), net_list.nets().end());
+
+    BinaryEncoder header;
+    header.write_string(placement_file ? placement_file : "");
+    header.write_string(place_ctx.placement_id);
+    header.write_string(net_list.netlist_id());
+    header.write_uint(is_flat);
+    header.write_uint(device_ctx.grid.width());
+    header.write_uint(device_ctx.grid.height());
+    header.write_uint(rr_graph.num_nodes());
+    header.write_uint(nets.size());
+
+    std::vector<std::string> blocks((nets.size() + BINARY_ROUTE_NETS_PER_BLOCK - 1) / BINARY_ROUTE_NETS_PER_BLOCK);
+    for_each_binary_block(blocks.size(), [&](size_t iblock) {
+        BinaryEncoder encoder;
+
+        size_t end = std::min(nets.size(), (iblock + 1) * BINARY_ROUTE_NETS_PER_BLOCK);
+        for (size_t inet = iblock * BINARY_ROUTE_NETS_PER_BLOCK; inet < end; ++inet) {
+            ParentNetId net_id = nets[inet];
+
+            if (net_list.net_is_ignored(net_id)) {
+                encoder.write_uint(uint64_t(e_binary_route_net::GLOBAL));
+            } else if (net_list.net_sinks(net_id).size() == 0) {
+                encoder.write_uint(uint64_t(e_binary_route_net::LOCAL_ONLY));
+            } else if (route_ctx.route_trees.empty() || !route_ctx.route_trees[net_id]) {
+                encoder.write_uint(uint64_t(e_binary_route_net::UNROUTED));
+            } else {
+                encoder.write_uint(uint64_t(e_binary_route_net::ROUTED));
+
+                t_trace* head = TracebackCompat::traceback_from_route_tree(route_ctx.route_trees[net_id].value());
+
+                size_t num_traces = 0;
+                for (t_trace* tptr = head; tptr != nullptr; tptr = tptr->next) {
+                    ++num_traces;
+                }
+                encoder.write_uint(num_traces);
+
+                int64_t prev_inode = 0;
+                for (t_trace* tptr = head; tptr != nullptr; tptr = tptr->next) {
+                    encoder.write_int(tptr->index - prev_inode);
+                    encoder.write_uint(tptr->iswitch + 1); //OPEN (-1) at the end of a branch
+                    if (rr_graph.node_type(RRNodeId(tptr->index)) == SINK) {
+                        encoder.write_uint(tptr->net_pin_index + 1);
+                    }
+                    prev_inode = tptr->index;
+                }
+
+                free_traceback(head);
+            }
+        }
+
+        blocks[iblock] = std::move(encoder.data());
+    });
+
+    return write_binary_file(route_file, BINARY_ROUTE_MAGIC, BINARY_ROUTE_VERSION, header.data(), blocks, VPR_ERROR_ROUTE);
+}
+
 void print_route(const Netlist<>& net_list,
-                 FILE* fp,
+                 std::string& out,
                  bool is_flat) {
     auto& place_ctx = g_vpr_ctx.placement();
     auto& device_ctx = g_vpr_ctx.device();
@@ -579,9 +855,9 @@ void print_route(const Netlist<>& net_list,
 
     for (auto net_id : net_list.nets()) {
         if (!net_list.net_is_ignored(net_id)) {
-            fprintf(fp, "\n\nNet %zu (%s)\n\n", size_t(net_id), net_list.net_name(net_id).c_str());
+            out += vtr::string_fmt("\n\nNet %zu (%s)\n\n", size_t(net_id), net_list.net_name(net_id).c_str());
             if (net_list.net_sinks(net_id).size() == false) {
-                fprintf(fp, "\n\nUsed in local cluster only, reserved one CLB pin\n\n");
+                out += "\n\nUsed in local cluster only, reserved one CLB pin\n\n";
             } else {
                 if (!route_ctx.route_trees[net_id])
                     continue;
@@ -596,35 +872,35 @@ void print_route(const Netlist<>& net_list,
                     int jlow = rr_graph.node_ylow(inode);
                     int layer_num = rr_graph.node_layer(inode);
 
-                    fprintf(fp, "Node:\t%zu\t%6s (%d,%d,%d) ", size_t(inode),
+                    out += vtr::string_fmt("Node:\t%zu\t%6s (%d,%d,%d) ", size_t(inode),
                             rr_graph.node_type_string(inode), layer_num, ilow, jlow);
 
                     if ((ilow != rr_graph.node_xhigh(inode))
                         || (jlow != rr_graph.node_yhigh(inode)))
-                        fprintf(fp, "to (%d,%d) ", rr_graph.node_xhigh(inode),
+                        out += vtr::string_fmt("to (%d,%d) ", rr_graph.node_xhigh(inode),
                                 rr_graph.node_yhigh(inode));
 
                     switch (rr_type) {
                         case IPIN:
                         case OPIN:
                             if (is_io_type(device_ctx.grid.get_physical_type({ilow, jlow, layer_num}))) {
-                                fprintf(fp, " Pad: ");
+                                out += " Pad: ";
                             } else { /* IO Pad. */
-                                fprintf(fp, " Pin: ");
+                                out += " Pin: ";
                             }
                             break;
 
                         case CHANX:
                         case CHANY:
-                            fprintf(fp, " Track: ");
+                            out += " Track: ";
                             break;
 
                         case SOURCE:
                         case SINK:
                             if (is_io_type(device_ctx.grid.get_physical_type({ilow, jlow, layer_num}))) {
-                                fprintf(fp, " Pad: ");
+                                out += " Pad: ";
                             } else { /* IO Pad. */
-                                fprintf(fp, " Class: ");
+                                out += " Class: ";
                             }
                             break;
 
@@ -635,7 +911,7 @@ void print_route(const Netlist<>& net_list,
                             break;
                     }
 
-                    fprintf(fp, "%d  ", rr_graph.node_ptc_num(inode));
+                    out += vtr::string_fmt("%d  ", rr_graph.node_ptc_num(inode));
 
                     auto physical_tile = device_ctx.grid.get_physical_type({ilow, jlow, layer_num});
                     if (!is_io_type(physical_tile) && (rr_type == IPIN || rr_type == OPIN)) {
@@ -657,19 +933,19 @@ void print_route(const Netlist<>& net_list,
                             pb_pin = get_pb_pin_from_pin_physical_num(physical_tile, pin_num);
                         }
                         const t_pb_type* pb_type = pb_pin->parent_node->pb_type;
-                        fprintf(fp, " %s.%s[%d] ", pb_type->name, pb_pin->port->name, pb_pin->pin_number);
+                        out += vtr::string_fmt(" %s.%s[%d] ", pb_type->name, pb_pin->port->name, pb_pin->pin_number);
                     }
 
                     /* Uncomment line below if you're debugging and want to see the switch types *
                      * used in the routing.                                                      */
-                    fprintf(fp, "Switch: %d", int(tptr->iswitch));
+                    out += vtr::string_fmt("Switch: %d", int(tptr->iswitch));
 
                     //Save net pin index for sinks
                     if (rr_type == SINK) {
-                        fprintf(fp, " Net_pin_index: %d", tptr->net_pin_index);
+                        out += vtr::string_fmt(" Net_pin_index: %d", tptr->net_pin_index);
                     }
 
-                    fprintf(fp, "\n");
+                    out += "\n";
 
                     tptr = tptr->next;
                 }
@@ -677,7 +953,7 @@ void print_route(const Netlist<>& net_list,
                 free_traceback(head);
             }
         } else { /* Global net.  Never routed. */
-            fprintf(fp, "\n\nNet %zu (%s): global net connecting:\n\n", size_t(net_id),
+            out += vtr::string_fmt("\n\nNet %zu (%s): global net connecting:\n\n", size_t(net_id),
                     net_list.net_name(net_id).c_str());
 
             for (auto pin_id : net_list.net_pins(net_id)) {
@@ -685,7 +961,7 @@ void print_route(const Netlist<>& net_list,
                 int iclass = get_block_pin_class_num(block_id, pin_id, is_flat);
                 t_block_loc blk_loc;
                 blk_loc = get_block_loc(block_id, is_flat);
-                fprintf(fp, "Block %s (#%zu) at (%d,%d), Pin class %d.\n",
+                out += vtr::string_fmt("Block %s (#%zu) at (%d,%d), Pin class %d.\n",
                         net_list.block_name(block_id).c_str(),
                         size_t(block_id),
                         blk_loc.loc.x,
@@ -701,23 +977,28 @@ void print_route(const Netlist<>& net_list,
                  const char* placement_file,
                  const char* route_file,
                  bool is_flat) {
-    FILE* fp;
-
-    fp = fopen(route_file, "w");
+    if (is_binary_file_name(route_file)) {
+        //Save the digest of the route file
+        g_vpr_ctx.mutable_routing().routing_id = print_route_binary(net_list, placement_file, route_file, is_flat);
+        return;
+    }
 
     auto& place_ctx = g_vpr_ctx.placement();
     auto& device_ctx = g_vpr_ctx.device();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    fprintf(fp, "Placement_File: %s Placement_ID: %s\n", placement_file, place_ctx.placement_id.c_str());
+    //Formatted in memory, so the file can be written in the background (see output_file_writer.h)
+    std::string contents;
+    contents += vtr::string_fmt("Placement_File: %s Placement_ID: %s\n", placement_file, place_ctx.placement_id.c_str());
 
-    fprintf(fp, "Array size: %zu x %zu logic blocks.\n", device_ctx.grid.width(), device_ctx.grid.height());
-    fprintf(fp, "\nRouting:");
+    contents += vtr::string_fmt("Array size: %zu x %zu logic blocks.\n", device_ctx.grid.width(), device_ctx.grid.height());
+    contents += "\nRouting:";
 
-    print_route(net_list, fp, is_flat);
-
-    fclose(fp);
+    print_route(net_list, contents, is_flat);
 
     //Save the digest of the route file
-    route_ctx.routing_id = vtr::secure_digest_file(route_file);
+    std::istringstream contents_stream(contents);
+    route_ctx.routing_id = vtr::secure_digest_stream(contents_stream);
+
+    write_output_file(route_file, std::move(contents), VPR_ERROR_ROUTE);
 }
@@ -16,13 +16,16 @@
 #include <ctime>
 #include <chrono>
 #include <cmath>
+#include <future>
 #include <sstream>
 
 #include "vtr_assert.h"
 #include "vtr_math.h"
 #include "vtr_log.h"
+#include "vtr_memory.h"
 #include "vtr_version.h"
 #include "vtr_time.h"
+#include "vtr_trace.h"
 #include "vtr_path.h"
 
 #include "vpr_types.h"
@@ -32,6 +35,8 @@
 #include "read_netlist.h"
 #include "check_netlist.h"
 #include "read_blif.h"
+#include "read_circuit.h"
+#include "atom_netlist_binary.h"
 #include "draw.h"
 #include "place_and_route.h"
 #include "pack.h"
@@ -44,6 +49,8 @@
 #include "stats.h"
 #include "read_options.h"
 #include "echo_files.h"
+#include "output_file_writer.h"
+#include "vpr_memory_usage.h"
 #include "read_xml_arch_file.h"
 #include "SetupVPR.h"
 #include "ShowSetup.h"
@@ -88,6 +95,7 @@
 #include "read_route.h"
 #include "read_blif.h"
 #include "read_place.h"
+#include "eco.h"
 
 #include "arch_util.h"
 
@@ -113,6 +121,12 @@ static void free_complex_block_types();
 static void free_device(const t_det_routing_arch& routing_arch);
 static void free_circuit();
 
+static bool can_create_device_during_packing(const t_vpr_setup& vpr_setup);
+static std::future<void> vpr_start_device_creation(t_vpr_setup& vpr_setup, const t_arch& arch);
+static void vpr_finish_device_creation(std::future<void>& device_creation, t_vpr_setup& vpr_setup, const t_arch& arch);
+static void report_device_grid(const t_vpr_setup& vpr_setup);
+static bool loaded_routing_needs_timing(const t_vpr_setup& vpr_setup);
+
 static void get_intercluster_switch_fanin_estimates(const t_vpr_setup& vpr_setup,
                                                     const t_arch& arch,
                                                     const int wire_segment_length,
@@ -198,7 +212,10 @@ void vpr_init(const int argc, const char** argv, t_options* options, t_vpr_setup
  * 2. Read Circuit
  * 3. Sanity check all three
  */
-void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_arch* arch) {
+void vpr_init_with_options(const t_options* options,
+                           t_vpr_setup* vpr_setup,
+                           t_arch* arch,
+                           const std::function<AtomNetlist(const t_vpr_setup&, const t_arch&)>& build_circuit) {
     //Set the number of parallel workers
     // We determine the number of workers in the following order:
     //  1. An explicitly specified command-line argument
@@ -242,6 +259,7 @@ void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_a
     vpr_setup->clock_modeling = options->clock_modeling;
     vpr_setup->two_stage_clock_routing = options->two_stage_clock_routing;
     vpr_setup->exit_before_pack = options->exit_before_pack;
+    vpr_setup->pipeline_device_creation = options->pipeline_device_creation;
     vpr_setup->num_workers = num_workers;
 
     VTR_LOG("\n");
@@ -252,6 +270,20 @@ void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_a
     /* Determine whether echo is on or off */
     setEchoEnabled(options->CreateEchoFile);
 
+    /* Determine whether output files are written in the background */
+    set_async_output_file_writes(options->async_output_file_writes);
+
+    /* Record a performance trace of the run if requested */
+    if (!options->trace_file.value().empty()) {
+        vtr::trace_start(options->trace_file.value());
+    }
+
+    /* Determine whether the memory usage of each context is reported after each stage */
+    set_memory_usage_reporting(options->report_memory_usage, options->memory_usage_file);
+
+    /* Determine how the large arrays (e.g. of the RR graph) are allocated */
+    vtr::set_large_alloc_policy(options->large_alloc_policy);
+
     /*
      * Initialize the functions names for which VPR_ERRORs
      * are demoted to VTR_LOG_WARNs
@@ -321,9 +353,17 @@ void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_a
     /* flush any messages to user still in stdout that hasn't gotten displayed */
     fflush(stdout);
 
-    /* Read blif file and sweep unused components */
+    /* Read blif file (or take the netlist built in memory) and sweep unused components */
     auto& atom_ctx = g_vpr_ctx.mutable_atom();
-    atom_ctx.nlist = read_and_process_circuit(options->circuit_format, *vpr_setup, *arch);
+    if (build_circuit) {
+        atom_ctx.nlist = build_circuit(*vpr_setup, *arch);
+        if (!vpr_setup->FileNameOpts.write_circuit_binary.empty()) {
+            write_atom_netlist_binary(atom_ctx.nlist, vpr_setup->FileNameOpts.write_circuit_binary.c_str());
+        }
+        process_atom_circuit(atom_ctx.nlist, *vpr_setup);
+    } else {
+        atom_ctx.nlist = read_and_process_circuit(options->circuit_format, *vpr_setup, *arch);
+    }
 
     if (vpr_setup->PowerOpts.do_power) {
         //Load the net activity file for power estimation
@@ -386,16 +426,31 @@ bool vpr_flow(t_vpr_setup& vpr_setup, t_arch& arch) {
     tbb::global_control c(tbb::global_control::max_allowed_parallelism, vpr_setup.num_workers);
 #endif
 
+    //Start building the parts of the device which don't depend on the packing (if requested)
+    std::future<void> device_creation;
+    if (vpr_setup.pipeline_device_creation) {
+        if (can_create_device_during_packing(vpr_setup)) {
+            device_creation = vpr_start_device_creation(vpr_setup, arch);
+        } else {
+            VTR_LOG_WARN("The device can only be created during packing with a fixed device layout (--device) and channel width (--route_chan_width): creating it after packing\n");
+        }
+    }
+
     { //Pack
         bool pack_success = vpr_pack_flow(vpr_setup, arch);
 
         if (!pack_success) {
             return false; //Unimplementable
         }
+        report_memory_usage("packing");
+    }
+    if (device_creation.valid()) {
+        vpr_finish_device_creation(device_creation, vpr_setup, arch);
+    } else {
+        // For the time being, we decided to create the flat graph after placement is done. Thus, the is_flat parameter for this function
+        //, since it is called before routing, should be false.
+        vpr_create_device(vpr_setup, arch, false);
     }
-    // For the time being, we decided to create the flat graph after placement is done. Thus, the is_flat parameter for this function
-    //, since it is called before routing, should be false.
-    vpr_create_device(vpr_setup, arch, false);
 
     // TODO: Placer still assumes that cluster net list is used - graphics can not work with flat routing yet
     vpr_init_graphics(vpr_setup, arch, false);
@@ -410,20 +465,28 @@ bool vpr_flow(t_vpr_setup& vpr_setup, t_arch& arch) {
             std::cout << "failed placement" << std::endl;
             return false; //Unimplementable
         }
+        report_memory_usage("placement");
     }
     bool is_flat = vpr_setup.RouterOpts.flat_routing;
     const Netlist<>& router_net_list = is_flat ? (const Netlist<>&)g_vpr_ctx.atom().nlist : (const Netlist<>&)g_vpr_ctx.clustering().clb_nlist;
     RouteStatus route_status;
     { //Route
         route_status = vpr_route_flow(router_net_list, vpr_setup, arch, is_flat);
+        report_memory_usage("routing");
     }
     { //Analysis
         vpr_analysis_flow(router_net_list, vpr_setup, arch, route_status, is_flat);
+        report_memory_usage("analysis");
     }
 
+    vpr_run_headless_server(vpr_setup);
+
     //close the graphics
     vpr_close_graphics(vpr_setup);
 
+    //Wait for any output files still being written
+    finish_output_file_writes();
+
     return route_status.success();
 }
 
@@ -440,6 +503,69 @@ void vpr_create_device(t_vpr_setup& vpr_setup, const t_arch& arch, bool is_flat)
     }
 }
 
+/**
+ * @brief Returns true if the device grid and routing resource graph don't depend on the packing, so they can be
+ *        built while packing runs
+ *
+ * Named device layouts have a fixed size, and the routing resource graph is only built before placement if the
+ * channel width is known.
+ */
+static bool can_create_device_during_packing(const t_vpr_setup& vpr_setup) {
+    return vpr_setup.device_layout != "auto"
+           && vpr_setup.PlacerOpts.place_chan_width != NO_FIXED_CHANNEL_WIDTH;
+}
+
+/**
+ * @brief Builds the device grid and clock networks, and starts building the routing resource graph (and the router
+ *        lookahead the placer uses) on a background thread, so they are built while packing runs
+ *
+ * The packer only reads the (fixed) device grid and the architecture, while the background thread only writes the
+ * routing resource graph and the router lookahead cache, which the packer doesn't use. The NoC is set up once
+ * packing is done by vpr_finish_device_creation(), since it reads the clustered netlist.
+ */
+static std::future<void> vpr_start_device_creation(t_vpr_setup& vpr_setup, const t_arch& arch) {
+    auto& device_ctx = g_vpr_ctx.mutable_device();
+    VTR_ASSERT(can_create_device_during_packing(vpr_setup));
+
+    VTR_LOG("Creating the device while packing\n");
+
+    //The grid of a fixed layout doesn't depend on the number of clusters
+    device_ctx.arch = &arch;
+    device_ctx.grid = create_device_grid(vpr_setup.device_layout, arch.grid_layouts, std::map<t_logical_block_type_ptr, size_t>(), vpr_setup.PackerOpts.target_device_utilization);
+
+    vpr_setup_clock_networks(vpr_setup, arch);
+
+    return std::async(std::launch::async, [&vpr_setup, &arch]() {
+        vtr::ScopedStartFinishTimer timer("Create Device (during packing)");
+        vpr_create_rr_graph(vpr_setup, arch, vpr_setup.PlacerOpts.place_chan_width, false);
+
+        //A loaded placement doesn't need the placer's lookahead
+        if (vpr_setup.PlacerOpts.doPlacement == STAGE_DO && placer_needs_lookahead(vpr_setup)) {
+            get_cached_router_lookahead(
+                vpr_setup.RoutingArch,
+                vpr_setup.RouterOpts.lookahead_type,
+                vpr_setup.RouterOpts.router_lookahead_half_precision,
+                vpr_setup.RouterOpts.write_router_lookahead,
+                vpr_setup.RouterOpts.read_router_lookahead,
+                vpr_setup.RouterOpts.router_lookahead_cache_dir,
+                vpr_setup.Segments,
+                false);
+        }
+    });
+}
+
+///@brief Waits for the device started by vpr_start_device_creation(), and completes it now that packing is done
+static void vpr_finish_device_creation(std::future<void>& device_creation, t_vpr_setup& vpr_setup, const t_arch& arch) {
+    {
+        vtr::ScopedStartFinishTimer timer("Wait for Device");
+        device_creation.get(); //Re-throws any error raised while creating the device
+    }
+
+    report_device_grid(vpr_setup);
+
+    vpr_setup_noc(vpr_setup, arch);
+}
+
 /**
  * @brief Allocs globals: chan_width_x, chan_width_y, device_ctx.grid
  *
@@ -467,10 +593,25 @@ void vpr_create_device_grid(const t_vpr_setup& vpr_setup, const t_arch& Arch) {
     float target_device_utilization = vpr_setup.PackerOpts.target_device_utilization;
     device_ctx.grid = create_device_grid(vpr_setup.device_layout, Arch.grid_layouts, num_type_instances, target_device_utilization);
 
+    report_device_grid(vpr_setup);
+}
+
+///@brief Reports the size of the device grid, and its utilization by the clustered netlist
+static void report_device_grid(const t_vpr_setup& vpr_setup) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& device_ctx = g_vpr_ctx.device();
+
     VTR_ASSERT_MSG(device_ctx.grid.get_num_layers() <= MAX_NUM_LAYERS,
                    "Number of layers should be less than MAX_NUM_LAYERS. "
                    "If you need more layers, please increase the value of MAX_NUM_LAYERS in vpr_types.h");
 
+    //Record the resource requirement
+    std::map<t_logical_block_type_ptr, size_t> num_type_instances;
+    for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
+        num_type_instances[cluster_ctx.clb_nlist.block_type(blk_id)]++;
+    }
+    float target_device_utilization = vpr_setup.PackerOpts.target_device_utilization;
+
     /*
      *Report on the device
      */
@@ -697,6 +838,15 @@ void vpr_load_packing(t_vpr_setup& vpr_setup, const t_arch& arch) {
                                          vpr_setup.FileNameOpts.verify_file_digests,
                                          vpr_setup.PackerOpts.pack_verbosity);
 
+    if (!vpr_setup.FileNameOpts.write_packed_netlist_binary.empty()) {
+        if (is_packed_netlist_binary(vpr_setup.FileNameOpts.NetFile)) {
+            VTR_LOG_WARN("Packed netlist '%s' is already binary, not writing '%s'\n",
+                         vpr_setup.FileNameOpts.NetFile.c_str(), vpr_setup.FileNameOpts.write_packed_netlist_binary.c_str());
+        } else {
+            write_packed_netlist_binary(cluster_ctx.clb_nlist, vpr_setup.FileNameOpts.write_packed_netlist_binary);
+        }
+    }
+
     process_constant_nets(g_vpr_ctx.mutable_atom().nlist,
                           g_vpr_ctx.atom().lookup,
                           cluster_ctx.clb_nlist,
@@ -717,6 +867,11 @@ bool vpr_place_flow(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_a
         //pass
     } else {
         if (placer_opts.doPlacement == STAGE_DO) {
+            //Keep the unchanged clusters of a previous implementation where they were
+            if (!placer_opts.eco_place_file.empty()) {
+                setup_eco_placement(vpr_setup.PlacerOpts, filename_opts.NetFile.c_str(), arch);
+            }
+
             //Do the actual placement
             vpr_place(net_list, vpr_setup, arch);
 
@@ -749,8 +904,10 @@ void vpr_place(const Netlist<>& net_list, t_vpr_setup& vpr_setup, const t_arch&
         get_cached_router_lookahead(
             vpr_setup.RoutingArch,
             vpr_setup.RouterOpts.lookahead_type,
+            vpr_setup.RouterOpts.router_lookahead_half_precision,
             vpr_setup.RouterOpts.write_router_lookahead,
             vpr_setup.RouterOpts.read_router_lookahead,
+            vpr_setup.RouterOpts.router_lookahead_cache_dir,
             vpr_setup.Segments,
             is_flat);
     }
@@ -823,9 +980,12 @@ RouteStatus vpr_route_flow(const Netlist<>& net_list,
         //Initialize the delay calculator
         std::shared_ptr<SetupHoldTimingInfo> timing_info = nullptr;
         std::shared_ptr<RoutingDelayCalculator> routing_delay_calc = nullptr;
-        if (vpr_setup.Timing.timing_analysis_enabled) {
+        bool routing_timing = vpr_setup.Timing.timing_analysis_enabled
+                              && (router_opts.doRouting == STAGE_DO || loaded_routing_needs_timing(vpr_setup));
+        if (routing_timing) {
             auto& atom_ctx = g_vpr_ctx.atom();
             routing_delay_calc = std::make_shared<RoutingDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, net_delay, is_flat);
+            routing_delay_calc->set_precompute_edge_delays(router_opts.timing_update_type != e_timing_update_type::INCREMENTAL);
             timing_info = make_setup_hold_timing_info(routing_delay_calc, router_opts.timing_update_type);
 #ifndef NO_SERVER
             if (g_vpr_ctx.server().gate_io.is_running()) {
@@ -834,7 +994,8 @@ RouteStatus vpr_route_flow(const Netlist<>& net_list,
             }
 #endif /* NO_SERVER */
         } else {
-            /* No delay calculator (segfault if the code calls into it) and wirelength driven routing */
+            /* No delay calculator (segfault if the code calls into it) and wirelength driven routing, or a loaded
+             * routing which is only timed by the final analysis */
             timing_info = make_constant_timing_info(0);
         }
 
@@ -868,6 +1029,7 @@ RouteStatus vpr_route_flow(const Netlist<>& net_list,
                                             chan_width,
                                             timing_info,
                                             net_delay,
+                                            routing_timing,
                                             is_flat);
         }
 
@@ -904,7 +1066,7 @@ RouteStatus vpr_route_flow(const Netlist<>& net_list,
         }
 
         //Echo files
-        if (vpr_setup.Timing.timing_analysis_enabled) {
+        if (routing_timing) {
             if (isEchoFileEnabled(E_ECHO_FINAL_ROUTING_TIMING_GRAPH)) {
                 auto& timing_ctx = g_vpr_ctx.timing();
                 tatum::write_echo(getEchoFileName(E_ECHO_FINAL_ROUTING_TIMING_GRAPH),
@@ -938,8 +1100,10 @@ RouteStatus vpr_route_fixed_W(const Netlist<>& net_list,
     get_cached_router_lookahead(
         vpr_setup.RoutingArch,
         vpr_setup.RouterOpts.lookahead_type,
+        vpr_setup.RouterOpts.router_lookahead_half_precision,
         vpr_setup.RouterOpts.write_router_lookahead,
         vpr_setup.RouterOpts.read_router_lookahead,
+        vpr_setup.RouterOpts.router_lookahead_cache_dir,
         vpr_setup.Segments,
         is_flat);
 
@@ -1008,6 +1172,7 @@ RouteStatus vpr_load_routing(t_vpr_setup& vpr_setup,
                              int fixed_channel_width,
                              std::shared_ptr<SetupHoldTimingInfo> timing_info,
                              NetPinsMatrix<float>& net_delay,
+                             bool update_timing,
                              bool is_flat) {
     vtr::ScopedStartFinishTimer timer("Load Routing");
     if (NO_FIXED_CHANNEL_WIDTH == fixed_channel_width) {
@@ -1019,7 +1184,7 @@ RouteStatus vpr_load_routing(t_vpr_setup& vpr_setup,
     //Load the routing from a file
     bool is_legal = read_route(filename_opts.RouteFile.c_str(), vpr_setup.RouterOpts, filename_opts.verify_file_digests, is_flat);
     const Netlist<>& router_net_list = is_flat ? (const Netlist<>&)g_vpr_ctx.atom().nlist : (const Netlist<>&)g_vpr_ctx.clustering().clb_nlist;
-    if (vpr_setup.Timing.timing_analysis_enabled) {
+    if (update_timing) {
         //Update timing info
         load_net_delay_from_routing(router_net_list,
                                     net_delay);
@@ -1030,6 +1195,20 @@ RouteStatus vpr_load_routing(t_vpr_setup& vpr_setup,
     return RouteStatus(is_legal, fixed_channel_width);
 }
 
+/**
+ * @brief Returns true if something other than the final analysis uses the timing of a loaded routing
+ *
+ * The final analysis (vpr_analysis()) times the loaded routing on its own, so when only analysing a stored
+ * implementation the routing stage only needs its timing for the graphics, the server and the echo files.
+ */
+static bool loaded_routing_needs_timing(const t_vpr_setup& vpr_setup) {
+    return vpr_setup.ShowGraphics
+           || vpr_setup.SaveGraphics
+           || !vpr_setup.GraphicsCommands.empty()
+           || vpr_setup.ServerOpts.is_server_mode_enabled
+           || isEchoFileEnabled(E_ECHO_FINAL_ROUTING_TIMING_GRAPH);
+}
+
 void vpr_create_rr_graph(t_vpr_setup& vpr_setup, const t_arch& arch, int chan_width_fac, bool is_flat) {
     auto& device_ctx = g_vpr_ctx.mutable_device();
     auto det_routing_arch = &vpr_setup.RoutingArch;
@@ -1091,6 +1270,18 @@ void vpr_init_server(const t_vpr_setup& vpr_setup) {
 #endif /* NO_SERVER */
 }
 
+void vpr_run_headless_server(const t_vpr_setup& vpr_setup) {
+#ifndef NO_SERVER
+    //With graphics requests are served by the graphics main loop, whenever it is waiting for the user
+    if (vpr_setup.ServerOpts.is_server_mode_enabled && !vpr_setup.ShowGraphics) {
+        VTR_LOG("Serving client requests on port %d without graphics\n", vpr_setup.ServerOpts.port_num);
+        server::run_headless();
+    }
+#else
+    (void)(vpr_setup);
+#endif /* NO_SERVER */
+}
+
 void vpr_close_graphics(const t_vpr_setup& /*vpr_setup*/) {
     /* Close down X Display */
     free_draw_structs();
@@ -1228,10 +1419,17 @@ static void free_atoms() {
     atom_ctx.lookup = AtomLookup();
 }
 
+static void free_packing() {
+    auto& helper_ctx = g_vpr_ctx.mutable_cl_helper();
+    vtr::release_memory(helper_ctx.atom_noc_grp_id);
+    helper_ctx.stage_arena.release();
+}
+
 static void free_placement() {
     auto& place_ctx = g_vpr_ctx.mutable_placement();
     place_ctx.block_locs.clear();
     place_ctx.grid_blocks.clear();
+    place_ctx.stage_arena.release();
 }
 
 static void free_routing() {
@@ -1242,8 +1440,11 @@ static void free_routing() {
     routing_ctx.rr_blk_source.clear();
     routing_ctx.rr_blk_source.clear();
     routing_ctx.rr_node_route_inf.clear();
+    routing_ctx.rr_node_cong_inf.clear();
+    routing_ctx.rr_reverse_edges.clear();
     routing_ctx.net_status.clear();
-    routing_ctx.route_bb.clear();
+    vtr::release_memory(routing_ctx.route_bb);
+    routing_ctx.stage_arena.release();
 }
 
 /**
@@ -1258,6 +1459,7 @@ void vpr_free_vpr_data_structures(t_arch& Arch,
     free_arch(&Arch);
     free_device(vpr_setup.RoutingArch);
     free_echo_file_info();
+    free_packing();
     free_placement();
     free_routing();
     free_atoms();
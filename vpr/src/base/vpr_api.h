@@ -27,6 +27,7 @@
 #ifndef VPR_API_H
 #define VPR_API_H
 
+#include <functional>
 #include <vector>
 #include "physical_types.h"
 #include "vpr_types.h"
@@ -46,7 +47,18 @@
  */
 void vpr_init(const int argc, const char** argv, t_options* options, t_vpr_setup* vpr_setup, t_arch* arch);
 void vpr_initialize_logging();
-void vpr_init_with_options(const t_options* options, t_vpr_setup* vpr_setup, t_arch* arch);
+
+/**
+ * @brief Initializes VPR from parsed options.
+ *
+ * @param build_circuit If given, called once the architecture is loaded to build the atom
+ *                      netlist in memory (using the models of the setup) in place of reading
+ *                      the circuit file. The netlist is then cleaned up as a read one would be.
+ */
+void vpr_init_with_options(const t_options* options,
+                           t_vpr_setup* vpr_setup,
+                           t_arch* arch,
+                           const std::function<AtomNetlist(const t_vpr_setup&, const t_arch&)>& build_circuit = nullptr);
 
 bool vpr_flow(t_vpr_setup& vpr_setup, t_arch& arch); //Run the VPR CAD flow
 
@@ -103,12 +115,13 @@ RouteStatus vpr_route_min_W(const Netlist<>& net_list,
                             NetPinsMatrix<float>& net_delay,
                             bool is_flat);
 
-///@brief Loads a previous routing
+///@brief Loads a previous routing, and updates timing_info with its delays if update_timing is set
 RouteStatus vpr_load_routing(t_vpr_setup& vpr_setup,
                              const t_arch& arch,
                              int fixed_channel_width,
                              std::shared_ptr<SetupHoldTimingInfo> timing_info,
                              NetPinsMatrix<float>& net_delay,
+                             bool update_timing,
                              bool is_flat);
 
 /* Analysis */
@@ -141,6 +154,9 @@ void vpr_create_rr_graph(t_vpr_setup& vpr_setup, const t_arch& arch, int chan_wi
 void vpr_init_graphics(const t_vpr_setup& vpr_setup, const t_arch& arch, bool is_flat);
 void vpr_init_server(const t_vpr_setup& vpr_setup);
 
+///@brief Serves client requests on the loaded design when running in server mode without graphics
+void vpr_run_headless_server(const t_vpr_setup& vpr_setup);
+
 void vpr_close_graphics(const t_vpr_setup& vpr_setup);
 
 void vpr_setup_clock_networks(t_vpr_setup& vpr_setup, const t_arch& Arch);
@@ -6,6 +6,7 @@
 #include <mutex>
 
 #include "vpr_types.h"
+#include "vtr_dynamic_bitset.h"
 #include "vtr_ndmatrix.h"
 #include "vtr_optional.h"
 #include "vtr_vector.h"
@@ -25,6 +26,7 @@
 #include "clock_connection_builders.h"
 #include "route_tree.h"
 #include "router_lookahead.h"
+#include "rr_graph_reverse_edges.h"
 #include "place_macro.h"
 #include "compressed_grid.h"
 #include "metadata_storage.h"
@@ -323,6 +325,13 @@ struct ClusteringContext : public Context {
  * in packing or placement stages.
  */
 struct ClusteringHelperContext : public Context {
+    /**
+     * @brief Arena of the data structures only needed during packing (e.g. atom_noc_grp_id)
+     *
+     * Released at the end of packing, so their memory is returned instead of fragmenting the heap.
+     */
+    vtr::Arena stage_arena;
+
     // A map used to save the number of used instances from each logical block type.
     std::map<t_logical_block_type_ptr, size_t> num_used_type_instances;
 
@@ -359,7 +368,7 @@ struct ClusteringHelperContext : public Context {
     /** Stores the NoC group ID of each atom block. Atom blocks that belong
      * to different NoC groups can't be clustered with each other into the
      * same clustered block.*/
-    vtr::vector<AtomBlockId, NocGroupId> atom_noc_grp_id;
+    vtr::vector<AtomBlockId, NocGroupId, vtr::arena_allocator<NocGroupId>> atom_noc_grp_id;
 
     ~ClusteringHelperContext() {
         delete[] primitives_list;
@@ -383,6 +392,14 @@ struct PackingMultithreadingContext : public Context {
  * or related placer algorithm state.
  */
 struct PlacementContext : public Context {
+    /**
+     * @brief Arena of the placer's data structures which are only needed during placement
+     *
+     * (e.g. the per-net costs of PlacerCostContext). Released when the placer frees its structures,
+     * so their memory is returned instead of fragmenting the heap.
+     */
+    vtr::Arena stage_arena;
+
     ///@brief Clustered block placement locations
     vtr::vector_map<ClusterBlockId, t_block_loc> block_locs;
 
@@ -404,6 +421,16 @@ struct PlacementContext : public Context {
      */
     t_compressed_block_grids compressed_block_grids;
 
+    /**
+     * @brief Floorplan legal locations of the constrained blocks, in their compressed grids
+     *
+     * Blocks of the same type and constraints share their legal sites. Blocks which are unconstrained,
+     * or have no legality bitmap (see FloorplanningContext), have no legal sites (OPEN). Built by
+     * load_cluster_legal_compressed_sites(), and used by the move generators to only propose legal locations.
+     */
+    std::vector<t_compressed_legal_sites> compressed_legal_sites;
+    vtr::vector<ClusterBlockId, int> cluster_legal_sites_ids;
+
     /**
      * @brief SHA256 digest of the .place file
      *
@@ -431,6 +458,13 @@ struct PlacementContext : public Context {
  * or related router algorithmic state.
  */
 struct RoutingContext : public Context {
+    /**
+     * @brief Arena of the data structures which are rebuilt for each routing (e.g. route_bb)
+     *
+     * Released before they are rebuilt and when the routing structures are freed.
+     */
+    vtr::Arena stage_arena;
+
     /* [0..num_nets-1] of linked list start pointers.  Defines the routing.  */
     vtr::vector<ParentNetId, vtr::optional<RouteTree>> route_trees;
 
@@ -442,7 +476,12 @@ struct RoutingContext : public Context {
 
     vtr::vector<ParentBlockId, std::vector<RRNodeId>> rr_blk_source; /* [0..num_blocks-1][0..num_class-1] */
 
-    vtr::vector<RRNodeId, t_rr_node_route_inf> rr_node_route_inf; /* [0..device_ctx.num_rr_nodes-1] */
+    t_rr_node_route_inf_vector rr_node_route_inf; /* [0..device_ctx.num_rr_nodes-1] */
+
+    vtr::vector<RRNodeId, t_rr_node_cong_inf> rr_node_cong_inf; /* [0..device_ctx.num_rr_nodes-1] */
+
+    /* Fan-in lookup for the RR graph, only built when the bidirectional connection router search is enabled */
+    RRReverseEdges rr_reverse_edges;
 
     vtr::vector<ParentNetId, std::vector<std::vector<int>>> net_terminal_groups;
 
@@ -463,7 +502,7 @@ struct RoutingContext : public Context {
     t_net_routing_status net_status;
 
     ///@brief Limits area within which each net must be routed.
-    vtr::vector<ParentNetId, t_bb> route_bb; /* [0..cluster_ctx.clb_nlist.nets().size()-1]*/
+    t_net_bb_vector route_bb; /* [0..cluster_ctx.clb_nlist.nets().size()-1]*/
 
     t_clb_opins_used clb_opins_used_locally; //[0..cluster_ctx.clb_nlist.blocks().size()-1][0..num_class-1]
 
@@ -520,6 +559,20 @@ struct FloorplanningContext : public Context {
      */
     vtr::vector<ClusterBlockId, PartitionRegion> cluster_constraints;
 
+    /**
+     * @brief Legality bitmaps of the cluster constraints, used by cluster_floorplanning_legal()
+     *
+     * Clusters with the same constraints share a bitmap (in cluster_constraint_bitmaps) of the grid
+     * tiles their constraints allow, indexed by ((layer * width) + x) * height + y. Clusters which are
+     * unconstrained, or whose constraints select sub-tiles, have no bitmap (OPEN) and are checked
+     * against their regions instead.
+     *
+     * They are built by load_cluster_constraint_bitmaps() once the cluster constraints are final for
+     * placement, and have to be rebuilt if the cluster constraints change.
+     */
+    vtr::vector<ClusterBlockId, int> cluster_constraint_bitmap_ids;
+    std::vector<vtr::dynamic_bitset<>> cluster_constraint_bitmaps;
+
     std::vector<Region> overfull_regions;
 };
 
@@ -590,6 +643,18 @@ struct ServerContext : public Context {
      */
     std::vector<tatum::TimingPath> crit_paths;
 
+    /**
+     * @brief Stores the text of each path in the last critical path report sent to the client.
+     *
+     * Used to send only the paths which changed when a delta report is requested.
+     */
+    std::vector<std::string> crit_path_report_paths;
+
+    /**
+     * @brief Stores the options the last critical path report was calculated with.
+     */
+    std::string crit_path_report_options;
+
     /**
      * @brief Stores the selected critical path elements.
      *
@@ -0,0 +1,199 @@
+#include "vpr_memory_usage.h"
+
+#include <fstream>
+
+#include "globals.h"
+#include "vpr_error.h"
+#include "vtr_log.h"
+#include "vtr_memory_usage.h"
+
+static bool memory_usage_reporting = false;
+static std::string memory_usage_csv_file;
+static bool memory_usage_csv_started = false;
+
+static size_t compressed_grid_memory_usage(const t_compressed_block_grid& compressed_grid);
+static size_t route_tree_memory_usage(const RouteTree& tree);
+static size_t timing_graph_memory_usage(const tatum::TimingGraph& timing_graph);
+
+std::vector<t_memory_usage_entry> memory_usage(const DeviceContext& device_ctx) {
+    size_t non_config_bytes = vtr::memory_usage(device_ctx.rr_non_config_node_sets)
+                              + vtr::memory_usage(device_ctx.rr_node_to_non_config_node_set);
+
+    size_t switch_fanin_bytes = vtr::memory_usage(device_ctx.switch_fanin_remap);
+    for (const auto& fanin_remap : device_ctx.switch_fanin_remap) {
+        switch_fanin_bytes += vtr::memory_usage(fanin_remap);
+    }
+
+    return {
+        {"Device", "rr_graph storage", device_ctx.rr_graph.rr_nodes().memory_usage()},
+        {"Device", "rr_graph node lookup", device_ctx.rr_graph.node_lookup().memory_usage()},
+        {"Device", "rr_indexed_data", vtr::memory_usage(device_ctx.rr_indexed_data)},
+        {"Device", "rr_rc_data", vtr::memory_usage(device_ctx.rr_rc_data)},
+        {"Device", "rr_non_config_node_sets", non_config_bytes},
+        {"Device", "switch_fanin_remap", switch_fanin_bytes},
+    };
+}
+
+std::vector<t_memory_usage_entry> memory_usage(const AtomContext& atom_ctx) {
+    return {
+        {"Atom", "nlist", atom_ctx.nlist.memory_usage()},
+    };
+}
+
+std::vector<t_memory_usage_entry> memory_usage(const ClusteringContext& cluster_ctx) {
+    return {
+        {"Clustering", "clb_nlist", cluster_ctx.clb_nlist.memory_usage()},
+    };
+}
+
+std::vector<t_memory_usage_entry> memory_usage(const PlacementContext& place_ctx) {
+    size_t compressed_grid_bytes = vtr::memory_usage(place_ctx.compressed_block_grids);
+    for (const t_compressed_block_grid& compressed_grid : place_ctx.compressed_block_grids) {
+        compressed_grid_bytes += compressed_grid_memory_usage(compressed_grid);
+    }
+
+    return {
+        {"Placement", "block_locs", vtr::memory_usage(place_ctx.block_locs)},
+        {"Placement", "physical_pins", vtr::memory_usage(place_ctx.physical_pins)},
+        {"Placement", "compressed_block_grids", compressed_grid_bytes},
+    };
+}
+
+std::vector<t_memory_usage_entry> memory_usage(const RoutingContext& route_ctx) {
+    size_t route_tree_bytes = vtr::memory_usage(route_ctx.route_trees);
+    for (const auto& tree : route_ctx.route_trees) {
+        if (tree) {
+            route_tree_bytes += route_tree_memory_usage(tree.value());
+        }
+    }
+
+    size_t trace_node_bytes = vtr::memory_usage(route_ctx.trace_nodes);
+    for (const auto& nodes : route_ctx.trace_nodes) {
+        trace_node_bytes += vtr::memory_usage(nodes);
+    }
+
+    size_t net_terminal_bytes = vtr::memory_usage(route_ctx.net_rr_terminals)
+                                + vtr::memory_usage(route_ctx.net_terminal_groups)
+                                + vtr::memory_usage(route_ctx.net_terminal_group_num);
+
+    const RouterLookahead* router_lookahead = route_ctx.cached_router_lookahead_.get(route_ctx.router_lookahead_cache_key_);
+
+    return {
+        {"Routing", "route_trees", route_tree_bytes},
+        {"Routing", "trace_nodes", trace_node_bytes},
+        {"Routing", "net_rr_terminals", net_terminal_bytes},
+        {"Routing", "rr_blk_source", vtr::memory_usage(route_ctx.rr_blk_source)},
+        {"Routing", "rr_node_route_inf", vtr::memory_usage(route_ctx.rr_node_route_inf)},
+        {"Routing", "rr_node_cong_inf", vtr::memory_usage(route_ctx.rr_node_cong_inf)},
+        {"Routing", "non_configurable_bitset", route_ctx.non_configurable_bitset.size() / 8},
+        {"Routing", "route_bb", vtr::memory_usage(route_ctx.route_bb)},
+        {"Routing", "router lookahead", router_lookahead ? router_lookahead->memory_usage() : 0},
+    };
+}
+
+std::vector<t_memory_usage_entry> memory_usage(const TimingContext& timing_ctx) {
+    return {
+        {"Timing", "timing graph (approx.)", timing_ctx.graph ? timing_graph_memory_usage(*timing_ctx.graph) : 0},
+    };
+}
+
+std::vector<t_memory_usage_entry> memory_usage(const VprContext& vpr_ctx) {
+    std::vector<t_memory_usage_entry> entries;
+    for (auto context_entries : {memory_usage(vpr_ctx.device()),
+                                 memory_usage(vpr_ctx.atom()),
+                                 memory_usage(vpr_ctx.clustering()),
+                                 memory_usage(vpr_ctx.placement()),
+                                 memory_usage(vpr_ctx.routing()),
+                                 memory_usage(vpr_ctx.timing())}) {
+        entries.insert(entries.end(), context_entries.begin(), context_entries.end());
+    }
+    return entries;
+}
+
+void set_memory_usage_reporting(bool enabled, const std::string& csv_file) {
+    memory_usage_reporting = enabled || !csv_file.empty();
+    memory_usage_csv_file = csv_file;
+    memory_usage_csv_started = false;
+}
+
+void report_memory_usage(const char* stage) {
+    if (!memory_usage_reporting) return;
+
+    std::vector<t_memory_usage_entry> entries = memory_usage(g_vpr_ctx);
+
+    size_t total_bytes = 0;
+    for (const t_memory_usage_entry& entry : entries) {
+        total_bytes += entry.bytes;
+    }
+
+    constexpr double MIB = 1024 * 1024;
+    VTR_LOG("\n");
+    VTR_LOG("Memory usage after %s (estimated, by context):\n", stage);
+    VTR_LOG("%-12s %-26s %12s %7s\n", "Context", "Structure", "MiB", "%");
+    VTR_LOG("%-12s %-26s %12s %7s\n", "-------", "---------", "---", "-");
+    for (const t_memory_usage_entry& entry : entries) {
+        if (entry.bytes == 0) continue;
+        VTR_LOG("%-12s %-26s %12.1f %6.1f%%\n",
+                entry.context.c_str(), entry.structure.c_str(), entry.bytes / MIB,
+                total_bytes > 0 ? 100. * entry.bytes / total_bytes : 0.);
+    }
+    VTR_LOG("%-12s %-26s %12.1f\n", "Total", "", total_bytes / MIB);
+    VTR_LOG("\n");
+
+    if (!memory_usage_csv_file.empty()) {
+        std::ofstream csv(memory_usage_csv_file, memory_usage_csv_started ? std::ios::app : std::ios::trunc);
+        if (!csv) {
+            VPR_FATAL_ERROR(VPR_ERROR_OTHER, "Failed to open memory usage file '%s'", memory_usage_csv_file.c_str());
+        }
+        if (!memory_usage_csv_started) {
+            csv << "stage,context,structure,bytes\n";
+            memory_usage_csv_started = true;
+        }
+        for (const t_memory_usage_entry& entry : entries) {
+            csv << stage << "," << entry.context << "," << entry.structure << "," << entry.bytes << "\n";
+        }
+    }
+}
+
+static size_t compressed_grid_memory_usage(const t_compressed_block_grid& compressed_grid) {
+    size_t bytes = vtr::memory_usage(compressed_grid.compressed_to_grid_x)
+                   + vtr::memory_usage(compressed_grid.compressed_to_grid_y)
+                   + vtr::memory_usage(compressed_grid.compressed_to_grid_layer)
+                   + vtr::memory_usage(compressed_grid.grid)
+                   + vtr::memory_usage(compressed_grid.compatible_sub_tiles_for_tile);
+
+    for (const auto& layer_columns : compressed_grid.grid) {
+        for (const auto& column : layer_columns) {
+            bytes += column.size() * sizeof(std::pair<int, t_physical_tile_loc>);
+        }
+    }
+    for (const auto& sub_tiles : compressed_grid.compatible_sub_tiles_for_tile) {
+        bytes += vtr::memory_usage(sub_tiles.second);
+    }
+    return bytes;
+}
+
+static size_t route_tree_memory_usage(const RouteTree& tree) {
+    //Each node is allocated individually, and indexed by RR node in an unordered_map
+    size_t num_nodes = 0;
+    for (const RouteTreeNode& rt_node : tree.all_nodes()) {
+        (void)rt_node;
+        ++num_nodes;
+    }
+    return num_nodes * (sizeof(RouteTreeNode) + sizeof(std::pair<RRNodeId, RouteTreeNode*>) + vtr::detail::HASH_NODE_OVERHEAD + sizeof(void*));
+}
+
+static size_t timing_graph_memory_usage(const tatum::TimingGraph& timing_graph) {
+    //The timing graph's storage is private to tatum, so estimate it from its size: each node has an
+    //id, type, level, its in/out edge lists and an entry in its level, and each edge has an id, type,
+    //source and sink, disabled flag and is referenced by the edge lists of its source and sink
+    size_t num_nodes = timing_graph.nodes().size();
+    size_t num_edges = timing_graph.edges().size();
+    size_t num_levels = timing_graph.levels().size();
+
+    size_t node_bytes = 2 * sizeof(tatum::NodeId) + sizeof(tatum::NodeType) + sizeof(tatum::LevelId) + 2 * sizeof(std::vector<tatum::EdgeId>);
+    size_t edge_bytes = 3 * sizeof(tatum::EdgeId) + sizeof(tatum::EdgeType) + 2 * sizeof(tatum::NodeId) + sizeof(bool);
+    size_t level_bytes = sizeof(tatum::LevelId) + sizeof(std::vector<tatum::NodeId>);
+
+    return num_nodes * node_bytes + num_edges * edge_bytes + num_levels * level_bytes;
+}
@@ -0,0 +1,58 @@
+#ifndef VPR_MEMORY_USAGE_H
+#define VPR_MEMORY_USAGE_H
+
+/**
+ * @file
+ * @brief Accounting of the memory held by the major data structures of each context
+ *
+ * The process max RSS (as reported by the stage timers) shows how much memory VPR used, but
+ * not where it went. These functions break it down by context (see vpr_context.h) and data
+ * structure, e.g. the RR graph storage, the router lookahead or the clustered netlist.
+ *
+ * The sizes are estimates: contiguous containers are counted by capacity and node based
+ * containers by an estimate of their nodes, while the memory of some element types (e.g. strings
+ * in maps, the t_pb hierarchies) is not counted. They are best treated as lower bounds.
+ *
+ * With --report_memory_usage the breakdown is printed after each stage of the flow, and with
+ * --memory_usage_file it is also appended to a CSV file with the columns:
+ *
+ *      stage,context,structure,bytes
+ */
+
+#include <string>
+#include <vector>
+
+#include "vpr_context.h"
+
+///@brief The memory held by one data structure
+struct t_memory_usage_entry {
+    std::string context;   ///<Context holding the structure (e.g. "Device")
+    std::string structure; ///<Name of the structure (e.g. "rr_graph storage")
+    size_t bytes;          ///<Estimated bytes held by the structure
+};
+
+/*
+ * Per context accounting
+ */
+std::vector<t_memory_usage_entry> memory_usage(const DeviceContext& device_ctx);
+std::vector<t_memory_usage_entry> memory_usage(const AtomContext& atom_ctx);
+std::vector<t_memory_usage_entry> memory_usage(const ClusteringContext& cluster_ctx);
+std::vector<t_memory_usage_entry> memory_usage(const PlacementContext& place_ctx);
+std::vector<t_memory_usage_entry> memory_usage(const RoutingContext& route_ctx);
+std::vector<t_memory_usage_entry> memory_usage(const TimingContext& timing_ctx);
+
+///@brief Returns the accounting of all the contexts of vpr_ctx
+std::vector<t_memory_usage_entry> memory_usage(const VprContext& vpr_ctx);
+
+/**
+ * @brief Sets whether report_memory_usage() prints the breakdown
+ *
+ *   @param enabled  Whether to print the breakdown
+ *   @param csv_file If not empty, the breakdown is also written to this file (which enables reporting)
+ */
+void set_memory_usage_reporting(bool enabled, const std::string& csv_file);
+
+///@brief Prints (and exports) the memory breakdown of g_vpr_ctx after the named stage, if enabled
+void report_memory_usage(const char* stage);
+
+#endif /* VPR_MEMORY_USAGE_H */
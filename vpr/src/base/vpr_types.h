@@ -24,6 +24,8 @@
 #ifndef VPR_TYPES_H
 #define VPR_TYPES_H
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -36,6 +38,7 @@
 #include "clock_modeling.h"
 #include "heap_type.h"
 
+#include "vtr_arena.h"
 #include "vtr_assert.h"
 #include "vtr_ndmatrix.h"
 #include "vtr_vector.h"
@@ -133,6 +136,16 @@ enum class e_router_initial_timing {
     LOOKAHEAD
 };
 
+enum class e_router_net_order {
+    FANOUT,  ///<Nets with more sinks are routed first
+    ADAPTIVE ///<Nets with more critical sinks and more congested previous routes are routed first
+};
+
+enum class e_router_sink_order {
+    CRITICALITY, ///<The most critical sinks of a net are routed first
+    PROXIMITY    ///<The sinks closest to the already routed part of the net are routed first, weighted by criticality
+};
+
 enum class e_const_gen_inference {
     NONE,    ///<No constant generator inference
     COMB,    ///<Only combinational constant generator inference
@@ -453,6 +466,10 @@ class t_cluster_placement_stats {
     // Each cluster_placement_primitive is associated with and index (key of the map) for easier lookup, insertion and deletion.
     std::vector<std::unordered_map<int, t_cluster_placement_primitive*>> valid_primitives;
 
+    // Vector of size num_pb_types [0.. num_pb_types-1]. Bit of each primitive pb_type in the per-atom feasibility masks of its model,
+    // or 0 if the model has too many primitive pb_types to be tracked (see cluster_placement.cpp)
+    std::vector<uint64_t> primitive_feasibility_bits;
+
   public:
     // Moves primitives that are inflight to the tried map
     void move_inflight_to_tried();
@@ -611,6 +628,9 @@ struct t_bb {
     int layer_max = OPEN;
 };
 
+///@brief The bounding box of each net, allocated from the arena of the stage using them (see RoutingContext::stage_arena)
+typedef vtr::vector<ParentNetId, t_bb, vtr::arena_allocator<t_bb>> t_net_bb_vector;
+
 /**
  * @brief Stores a 2D bounding box in terms of the minimum and maximum x and y
  * @note layer_num indicates the layer that the bounding box is on.
@@ -913,7 +933,11 @@ struct t_file_name_opts {
     std::string read_vpr_constraints_file;
     std::string write_vpr_constraints_file;
     std::string write_block_usage;
+    std::string write_circuit_binary; ///<Binary atom netlist file to write once the circuit is loaded (empty if none)
+    std::string write_packed_netlist_binary;
+    std::string lb_type_rr_graph_cache; ///<Cache file of the intra-cluster routing graphs (empty if none)
     bool verify_file_digests;
+    bool async_output_file_writes; ///<Write output files (e.g. .place, .route) on a background thread
 };
 
 ///@brief Options for netlist loading
@@ -926,6 +950,8 @@ struct t_netlist_opts {
     bool sweep_constant_primary_outputs = false;
 
     int netlist_verbosity = 1; ///<Verbose output during netlist cleaning
+
+    bool parallel_blif_read = false; ///<Tokenize BLIF/EBLIF files in parallel chunks
 };
 
 ///@brief Should a stage in the CAD flow be skipped, loaded from a file, or performed
@@ -973,9 +999,12 @@ struct t_packer_opts {
     enum e_packer_algorithm packer_algorithm;
     std::string device_layout;
     e_timing_update_type timing_update_type;
+    int timing_update_interval; ///<Number of clusters formed between timing updates during packing (0 for none)
+    bool stream_output;         ///<Write each cluster to the .net file as soon as it is formed
     bool use_attraction_groups;
     int pack_num_moves;
     std::string pack_move_type;
+    int pack_partition_size;
 };
 
 /**
@@ -1177,6 +1206,11 @@ enum class e_move_type;
  *   @param constraints_file
  *              File that specifies locations of locked down (constrained)
  *              blocks for placement. Empty string means no constraints file.
+ *   @param eco_net_file
+ *   @param eco_place_file
+ *              Packing (.net) and placement (.place) of a previous implementation of
+ *              the design: the clusters it has unchanged keep their locations (see eco.h).
+ *              Empty strings mean no ECO placement.
  *   @param write_initial_place_file
  *              Write the initial placement into this file. Empty string means
  *              the initial placement is not written.
@@ -1222,11 +1256,14 @@ struct t_placer_opts {
     int place_chan_width;
     enum e_pad_loc_type pad_loc_type;
     std::string constraints_file;
+    std::string eco_net_file;
+    std::string eco_place_file;
     std::string write_initial_place_file;
     enum pfreq place_freq;
     int recompute_crit_iter;
     int inner_loop_recompute_divider;
     int quench_recompute_divider;
+    int place_timing_update_accepted_moves;
     float td_place_exp_first;
     int seed;
     float td_place_exp_last;
@@ -1261,6 +1298,13 @@ struct t_placer_opts {
     e_agent_algorithm place_agent_algorithm;
     float place_agent_epsilon;
     float place_agent_gamma;
+
+    /**
+     * @brief Number of move outcomes the RL agent accumulates before it updates its
+     * Q-table and action probabilities (1 updates it after every move).
+     */
+    int place_agent_update_window;
+
     float place_dm_rlim;
     e_agent_space place_agent_space;
     //int place_timing_cost_func;
@@ -1271,6 +1315,66 @@ struct t_placer_opts {
     int floorplan_num_horizontal_partitions;
     int floorplan_num_vertical_partitions;
 
+    /**
+     * @brief Number of moves the annealer proposes and evaluates together.
+     *
+     * Moves of a batch which touch disjoint blocks, locations and nets are
+     * evaluated in parallel and then accepted or rejected one by one in
+     * proposal order. 1 evaluates every move on its own (serial annealer).
+     */
+    int place_parallel_moves;
+
+    /**
+     * @brief Number of annealing runs, with seeds seed, seed + 1, ..., done one after
+     * another in this process. The best resulting placement is kept.
+     *
+     * The runs share the device, routing resource graph and placement delay model,
+     * which are only built once.
+     */
+    int place_seeds;
+
+    /**
+     * @brief A run of a --place_seeds portfolio is stopped once its quality at some
+     * temperature is worse than the best finished run's at the same temperature
+     * by more than this fraction.
+     */
+    float place_seeds_prune_margin;
+
+    /**
+     * @brief Weight of the RUDY routing congestion cost, relative to the normalized
+     * wirelength cost (see PlacerCongestionMap). 0 disables the congestion cost.
+     */
+    float place_congestion_weight;
+
+    /**
+     * @brief Start the annealer from a multilevel global placement (see
+     * multilevel_global_placement()) rather than the default initial placement.
+     */
+    bool place_multilevel;
+
+    /**
+     * @brief File the annealer saves its full state to every place_checkpoint_interval
+     * temperatures (disabled if empty). With resume_place, an existing checkpoint in
+     * this file is continued instead of starting a new anneal.
+     */
+    std::string place_checkpoint_file;
+    int place_checkpoint_interval;
+    bool resume_place;
+
+    /**
+     * @brief Moves of the driver of a net with at least this many sinks (0: never) estimate
+     * the net's timing cost change from its place_timing_sample_size most critical connections.
+     */
+    int place_timing_sample_fanout;
+    int place_timing_sample_size;
+
+    /**
+     * @brief Fraction (0 to 1) of the blocks, macros and nets whose placement and
+     * bounding box cost are checked after each annealing temperature (0: only the
+     * full checks before and after the anneal are done).
+     */
+    float place_check_sample_fraction;
+
     int placer_debug_block;
     int placer_debug_net;
 
@@ -1291,6 +1395,12 @@ struct t_placer_opts {
      * of the annealing placer for local improvement
      */
     bool enable_analytic_placer;
+
+    /**
+     * @brief If positive, the analytic placement is refined by annealing from this
+     * fraction of the annealer's usual starting temperature before the quench.
+     */
+    float analytic_placer_anneal_t_scale;
 };
 
 /* All the parameters controlling the router's operation are in this        *
@@ -1309,6 +1419,8 @@ struct t_placer_opts {
  * min_incremental_reroute_fanout: Minimum fanout a net needs to have       *
  *              for incremental reroute to be applied to it through route   *
  *              tree pruning. Larger circuits should get larger thresholds  *
+ * incremental_reroute_all_nets_iter: Routing iteration from which all nets *
+ *              get incrementally rerouted regardless of fanout. -1 if never*
  * bb_factor:  Linear distance a route can go outside the net bounding      *
  *             box.                                                         *
  * route_type:  GLOBAL or DETAILED.                                         *
@@ -1330,6 +1442,11 @@ struct t_placer_opts {
  *             an essentially breadth-first search, astar_fac = 1 is near   *
  *             the usual astar algorithm and astar_fac > 1 are more         *
  *             aggressive.                                                  *
+ * bidir_search_min_dist: Minimum source-sink Manhattan distance for a      *
+ *             connection to be routed with a bidirectional search. -1 if   *
+ *             never.                                                       *
+ * bidir_search_max_criticality: Maximum criticality of a connection to be  *
+ *             routed with a bidirectional search.                          *
  * max_criticality: The maximum criticality factor (from 0 to 1) any sink   *
  *                  will ever have (i.e. clip criticality to this number).  *
  * criticality_exp: Set criticality to (path_length(sink) / longest_path) ^ *
@@ -1344,6 +1461,7 @@ struct t_placer_opts {
 enum e_router_algorithm {
     PARALLEL,
     PARALLEL_DECOMP,
+    DISTRIBUTED,
     TIMING_DRIVEN,
 };
 
@@ -1410,15 +1528,19 @@ struct t_router_opts {
     float bend_cost;
     int max_router_iterations;
     int min_incremental_reroute_fanout;
+    int incremental_reroute_all_nets_iter;
     e_incr_reroute_delay_ripup incr_reroute_delay_ripup;
     int bb_factor;
     enum e_route_type route_type;
     int fixed_channel_width;
     int min_channel_width_hint; ///<Hint to binary search of what the minimum channel width is
+    int min_chan_width_search_jobs; ///<Number of channel widths the binary search routes concurrently (1 for a sequential search)
     enum e_router_algorithm router_algorithm;
     enum e_base_cost_type base_cost_type;
     float astar_fac;
     float router_profiler_astar_fac;
+    int bidir_search_min_dist;
+    float bidir_search_max_criticality;
     float max_criticality;
     float criticality_exp;
     float init_wirelength_abort_threshold;
@@ -1431,32 +1553,46 @@ struct t_router_opts {
     enum e_routing_failure_predictor routing_failure_predictor;
     enum e_routing_budgets_algorithm routing_budgets_algorithm;
     bool save_routing_per_iteration;
+    bool overlap_timing_update; ///<Run each iteration's timing update concurrently with its congestion bookkeeping
     float congested_routing_iteration_threshold_frac;
     e_route_bb_update route_bb_update;
     enum e_clock_modeling clock_modeling; ///<How clock pins and nets should be handled
     bool two_stage_clock_routing;         ///<How clock nets on dedicated networks should be routed
     int high_fanout_threshold;
     float high_fanout_max_slope;
+    int high_fanout_batch_size;
     int router_debug_net;
     int router_debug_sink_rr;
     int router_debug_iteration;
     e_router_lookahead lookahead_type;
+    bool router_lookahead_half_precision;
     int max_convergence_count;
     float reconvergence_cpd_threshold;
     e_router_initial_timing initial_timing;
     bool update_lower_bound_delays;
+    e_router_net_order net_order;
+    e_router_sink_order sink_order;
 
     std::string first_iteration_timing_report_file;
     bool strict_checks;
 
     std::string write_router_lookahead;
     std::string read_router_lookahead;
+    std::string router_lookahead_cache_dir;
 
     std::string write_intra_cluster_router_lookahead;
     std::string read_intra_cluster_router_lookahead;
 
+    std::string eco_route_file; ///<Routing (.route) of a previous implementation of the design: its unchanged nets keep their routing (see eco.h)
+
     e_heap_type router_heap;
     bool exit_after_first_routing_iteration;
+    bool parallel_route_overlapping_nets;    ///<Route nets with overlapping bounding boxes concurrently in the parallel router
+    int parallel_route_batch_iters;          ///<Route all the nets concurrently in this many first iterations of the parallel router
+    bool deterministic_parallel_route;       ///<Make the parallel routers produce the same result regardless of thread count and scheduling
+    bool report_parallel_route_load_balance; ///<Print the load balance of each iteration of the parallel routers
+    bool global_route_prepass;               ///<Globally route the nets over a coarse grid first, to tighten their bounding boxes and seed the history costs
+    bool report_router_profile;              ///<Print the per connection counters of the connection router at the end of routing
 
     e_check_route_option check_route;
     e_timing_update_type timing_update_type;
@@ -1473,6 +1609,9 @@ struct t_router_opts {
     e_rr_node_reorder_algorithm reorder_rr_graph_nodes_algorithm = DONT_REORDER;
     int reorder_rr_graph_nodes_threshold = 0;
     int reorder_rr_graph_nodes_seed = 1;
+
+    // Drop the per-edge source node array of the RR graph once it is built, to save memory
+    bool compact_rr_graph_edges = false;
 };
 
 struct t_analysis_opts {
@@ -1509,6 +1648,8 @@ struct t_noc_opts {
     int noc_sat_routing_congestion_weighting;         ///<controls the importance of reducing the number of congested NoC links in SAT routing [0-inf)
     int noc_sat_routing_num_workers;                  ///<the number of parallel worker threads that the SAT solver can use to explore the solution space
     bool noc_sat_routing_log_search_progress;         ///<indicates whether the detailed log of the SAT solver's search progress in printed
+    bool noc_enforce_deadlock_freedom;                ///<indicates whether placement moves whose NoC routes could deadlock are rejected
+    double noc_sat_routing_time_limit;                ///<the maximum time (in seconds) the SAT solver may search for a routing, after which the best routing found is used. Non-positive means no limit
     std::string noc_placement_file_name;              ///<is the name of the output file that contains the NoC placement information
 };
 
@@ -1722,32 +1863,61 @@ constexpr bool is_src_sink(e_rr_type type) { return (type == SOURCE || type == S
  * @brief Extra information about each rr_node needed only during routing
  *        (i.e. during the maze expansion).
  *
+ * This is the 'hot' per-node search state which is read and written on every
+ * neighbour expansion. The congestion state (which changes only when a net is
+ * ripped-up/committed) is kept in a separate array (t_rr_node_cong_inf), so
+ * the wavefront expansion only streams the bytes it compares.
+ *
  *   @param prev_edge  ID of the edge (globally unique edge ID in the RR Graph)
  *                     that was used to reach this node from the previous node.
  *                     If there is no predecessor, prev_edge = NO_PREVIOUS.
- *   @param acc_cost   Accumulated cost term from previous Pathfinder iterations.
  *   @param path_cost  Total cost of the path up to and including this node +
  *                     the expected cost to the target if the timing_driven router
  *                     is being used.
  *   @param backward_path_cost  Total cost of the path up to and including this
  *                     node.
- *   @param occ        The current occupancy of the associated rr node
  */
 struct t_rr_node_route_inf {
     RREdgeId prev_edge;
 
-    float acc_cost;
     float path_cost;
     float backward_path_cost;
+};
+
+/**
+ * @brief PathFinder congestion information about each rr_node
+ *
+ *   @param acc_cost   Accumulated cost term from previous Pathfinder iterations.
+ *   @param occ        The current occupancy of the associated rr node
+ *
+ * occ is atomic so that nets with overlapping bounding boxes can be routed
+ * concurrently (see ParallelNetlistRouter). All accesses are relaxed, which
+ * compile to plain loads/stores on the serial paths.
+ */
+struct t_rr_node_cong_inf {
+    float acc_cost;
+
+    t_rr_node_cong_inf() = default;
+    t_rr_node_cong_inf(const t_rr_node_cong_inf& other)
+        : acc_cost(other.acc_cost)
+        , occ_(other.occ()) {}
+    t_rr_node_cong_inf& operator=(const t_rr_node_cong_inf& other) {
+        acc_cost = other.acc_cost;
+        set_occ(other.occ());
+        return *this;
+    }
 
   public: //Accessors
-    short occ() const { return occ_; }
+    short occ() const { return occ_.load(std::memory_order_relaxed); }
 
   public: //Mutators
-    void set_occ(int new_occ) { occ_ = new_occ; }
+    void set_occ(int new_occ) { occ_.store(new_occ, std::memory_order_relaxed); }
+
+    ///@brief Atomically adds delta to the occupancy and returns the new occupancy
+    short add_occ(int delta) { return occ_.fetch_add(delta, std::memory_order_relaxed) + delta; }
 
   private: //Data
-    short occ_ = 0;
+    std::atomic<short> occ_{0};
 };
 
 /**
@@ -1876,6 +2046,7 @@ struct t_vpr_setup {
     e_clock_modeling clock_modeling;           ///<How clocks should be handled
     bool two_stage_clock_routing;              ///<How clocks should be routed in the presence of a dedicated clock network
     bool exit_before_pack;                     ///<Exits early before starting packing (useful for collecting statistics without running/loading any stages)
+    bool pipeline_device_creation;             ///<Builds the routing resource graph and router lookahead while packing (if they don't depend on it)
     unsigned int num_workers;                  ///Maximum number of worker threads (determined from an env var or cmdline option)
 };
 
@@ -558,6 +558,8 @@ void free_draw_structs() {
      * structure gets freed twice.													 */
     t_draw_coords* draw_coords = get_draw_coords_vars();
 
+    finish_save_graphics();
+
     if (draw_coords != nullptr) {
         delete[] draw_coords->tile_x;
         draw_coords->tile_x = nullptr;
@@ -592,6 +594,7 @@ void init_draw_coords(float width_val) {
             draw_state->draw_rr_node[inode].color = DEFAULT_RR_NODE_COLOR;
             draw_state->draw_rr_node[inode].node_highlighted = false;
         }
+        build_draw_rr_node_bins();
     }
     draw_coords->tile_width = width_val;
     draw_coords->pin_size = 0.3;
@@ -63,6 +63,24 @@
 constexpr float SB_EDGE_TURN_ARROW_POSITION = 0.2;
 constexpr float SB_EDGE_STRAIGHT_ARROW_POSITION = 0.95;
 
+//Width and height (in grid tiles) of the bins of the rr node spatial index
+constexpr int DRAW_RR_BIN_SIZE = 8;
+
+//Arrows (and their switch point labels) along wires are not drawn if they
+//would be smaller than this many pixels on screen
+constexpr float MIN_RR_CHAN_ARROW_SCREEN_SIZE = 2.;
+
+//Range of grid tiles in the visible world
+struct t_draw_rr_view {
+    int xmin;
+    int xmax;
+    int ymin;
+    int ymax;
+};
+
+static t_draw_rr_view get_draw_rr_view(ezgl::renderer* g);
+static void draw_rr_node(RRNodeId inode, ezgl::renderer* g);
+
 /* Draws the routing resources that exist in the FPGA, if the user wants
  * them drawn.
  */
@@ -81,7 +99,6 @@ void draw_rr(ezgl::renderer* g) {
     g->set_line_dash(ezgl::line_dash::none);
 
     for (const RRNodeId inode : device_ctx.rr_graph.nodes()) {
-        int layer_num = rr_graph.node_layer(inode);
         int transparency_factor = get_rr_node_transparency(inode);
         if (!draw_state->draw_rr_node[inode].node_highlighted) {
             /* If not highlighted node, assign color based on type. */
@@ -108,47 +125,125 @@ void draw_rr(ezgl::renderer* g) {
         }
 
         draw_state->draw_rr_node[inode].color.alpha = transparency_factor;
+    }
 
-        if (!draw_state->draw_layer_display[layer_num].visible)
-            continue; // skip drawing if layer is not visible
-
-        /* Now call drawing routines to draw the node. */
-        switch (rr_graph.node_type(inode)) {
-            case SINK:
-                draw_rr_src_sink(inode, draw_state->draw_rr_node[inode].color, g);
-                break;
-            case SOURCE:
-                draw_rr_edges(inode, g);
-                draw_rr_src_sink(inode, draw_state->draw_rr_node[inode].color, g);
-                break;
+    /* Only draw the nodes in (or next to) the visible tiles. Each node is drawn *
+     * from the first bin in view it overlaps, so it is drawn once.             */
+    t_draw_rr_view view = get_draw_rr_view(g);
+    const auto& bins = draw_state->draw_rr_node_bins;
+    if (view.xmin <= view.xmax && view.ymin <= view.ymax && bins.size() > 0) {
+        int bin_xmin = view.xmin / DRAW_RR_BIN_SIZE;
+        int bin_xmax = std::min<int>(view.xmax / DRAW_RR_BIN_SIZE, bins.dim_size(0) - 1);
+        int bin_ymin = view.ymin / DRAW_RR_BIN_SIZE;
+        int bin_ymax = std::min<int>(view.ymax / DRAW_RR_BIN_SIZE, bins.dim_size(1) - 1);
+
+        for (int bin_x = bin_xmin; bin_x <= bin_xmax; ++bin_x) {
+            for (int bin_y = bin_ymin; bin_y <= bin_ymax; ++bin_y) {
+                for (RRNodeId inode : bins[bin_x][bin_y]) {
+                    if (rr_graph.node_xhigh(inode) < view.xmin || rr_graph.node_xlow(inode) > view.xmax
+                        || rr_graph.node_yhigh(inode) < view.ymin || rr_graph.node_ylow(inode) > view.ymax) {
+                        continue; //Not in view
+                    }
+                    if (std::max(rr_graph.node_xlow(inode) / DRAW_RR_BIN_SIZE, bin_xmin) != bin_x
+                        || std::max(rr_graph.node_ylow(inode) / DRAW_RR_BIN_SIZE, bin_ymin) != bin_y) {
+                        continue; //Drawn from another bin
+                    }
 
-            case CHANX:
-                draw_rr_chan(inode, draw_state->draw_rr_node[inode].color, g);
-                draw_rr_edges(inode, g);
-                break;
+                    draw_rr_node(inode, g);
+                }
+            }
+        }
+    }
 
-            case CHANY:
-                draw_rr_chan(inode, draw_state->draw_rr_node[inode].color, g);
-                draw_rr_edges(inode, g);
-                break;
+    drawroute(HIGHLIGHTED, g);
+}
 
-            case IPIN:
-                draw_rr_pin(inode, draw_state->draw_rr_node[inode].color, g);
-                draw_rr_edges(inode, g);
-                break;
+void build_draw_rr_node_bins() {
+    t_draw_state* draw_state = get_draw_state_vars();
+    auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
 
-            case OPIN:
-                draw_rr_pin(inode, draw_state->draw_rr_node[inode].color, g);
-                draw_rr_edges(inode, g);
-                break;
+    size_t num_bins_x = (device_ctx.grid.width() + DRAW_RR_BIN_SIZE - 1) / DRAW_RR_BIN_SIZE;
+    size_t num_bins_y = (device_ctx.grid.height() + DRAW_RR_BIN_SIZE - 1) / DRAW_RR_BIN_SIZE;
+    draw_state->draw_rr_node_bins = vtr::NdMatrix<std::vector<RRNodeId>, 2>({num_bins_x, num_bins_y});
 
-            default:
-                vpr_throw(VPR_ERROR_OTHER, __FILE__, __LINE__,
-                          "in draw_rr: Unexpected rr_node type: %d.\n", rr_graph.node_type(inode));
+    for (const RRNodeId inode : rr_graph.nodes()) {
+        for (int bin_x = rr_graph.node_xlow(inode) / DRAW_RR_BIN_SIZE; bin_x <= rr_graph.node_xhigh(inode) / DRAW_RR_BIN_SIZE; ++bin_x) {
+            for (int bin_y = rr_graph.node_ylow(inode) / DRAW_RR_BIN_SIZE; bin_y <= rr_graph.node_yhigh(inode) / DRAW_RR_BIN_SIZE; ++bin_y) {
+                draw_state->draw_rr_node_bins[bin_x][bin_y].push_back(inode);
+            }
         }
     }
+}
 
-    drawroute(HIGHLIGHTED, g);
+/* Returns the grid tiles in the visible world, extended by one tile on each *
+ * side so edges to the nodes just outside the view are still drawn.         */
+static t_draw_rr_view get_draw_rr_view(ezgl::renderer* g) {
+    t_draw_coords* draw_coords = get_draw_coords_vars();
+    auto& device_ctx = g_vpr_ctx.device();
+
+    ezgl::rectangle world = g->get_visible_world();
+
+    const float* tile_x_end = draw_coords->tile_x + device_ctx.grid.width();
+    const float* tile_y_end = draw_coords->tile_y + device_ctx.grid.height();
+
+    //Index of the first tile starting after each edge of the view
+    int xmin = std::upper_bound(draw_coords->tile_x, tile_x_end, world.left()) - draw_coords->tile_x;
+    int xmax = std::upper_bound(draw_coords->tile_x, tile_x_end, world.right()) - draw_coords->tile_x;
+    int ymin = std::upper_bound(draw_coords->tile_y, tile_y_end, world.bottom()) - draw_coords->tile_y;
+    int ymax = std::upper_bound(draw_coords->tile_y, tile_y_end, world.top()) - draw_coords->tile_y;
+
+    //The tile (and channel) containing each edge of the view, plus one tile of margin
+    t_draw_rr_view view;
+    view.xmin = std::max(xmin - 2, 0);
+    view.xmax = std::min<int>(xmax, device_ctx.grid.width() - 1);
+    view.ymin = std::max(ymin - 2, 0);
+    view.ymax = std::min<int>(ymax, device_ctx.grid.height() - 1);
+    return view;
+}
+
+static void draw_rr_node(RRNodeId inode, ezgl::renderer* g) {
+    t_draw_state* draw_state = get_draw_state_vars();
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+
+    int layer_num = rr_graph.node_layer(inode);
+    if (!draw_state->draw_layer_display[layer_num].visible)
+        return; // skip drawing if layer is not visible
+
+    /* Now call drawing routines to draw the node. */
+    switch (rr_graph.node_type(inode)) {
+        case SINK:
+            draw_rr_src_sink(inode, draw_state->draw_rr_node[inode].color, g);
+            break;
+        case SOURCE:
+            draw_rr_edges(inode, g);
+            draw_rr_src_sink(inode, draw_state->draw_rr_node[inode].color, g);
+            break;
+
+        case CHANX:
+            draw_rr_chan(inode, draw_state->draw_rr_node[inode].color, g);
+            draw_rr_edges(inode, g);
+            break;
+
+        case CHANY:
+            draw_rr_chan(inode, draw_state->draw_rr_node[inode].color, g);
+            draw_rr_edges(inode, g);
+            break;
+
+        case IPIN:
+            draw_rr_pin(inode, draw_state->draw_rr_node[inode].color, g);
+            draw_rr_edges(inode, g);
+            break;
+
+        case OPIN:
+            draw_rr_pin(inode, draw_state->draw_rr_node[inode].color, g);
+            draw_rr_edges(inode, g);
+            break;
+
+        default:
+            vpr_throw(VPR_ERROR_OTHER, __FILE__, __LINE__,
+                      "in draw_rr: Unexpected rr_node type: %d.\n", rr_graph.node_type(inode));
+    }
 }
 
 void draw_rr_chan(RRNodeId inode, const ezgl::color color, ezgl::renderer* g) {
@@ -184,6 +279,12 @@ void draw_rr_chan(RRNodeId inode, const ezgl::color color, ezgl::renderer* g) {
         g->set_line_width(0);
     }
 
+    //When zoomed out the arrows, labels and muxes along the wire are too small to see
+    float zoom = g->get_visible_screen().width() / g->get_visible_world().width();
+    if (DEFAULT_ARROW_SIZE * zoom < MIN_RR_CHAN_ARROW_SCREEN_SIZE) {
+        return;
+    }
+
     e_side mux_dir = TOP;
     int coord_min = -1;
     int coord_max = -1;
@@ -51,6 +51,10 @@
  * them drawn. */
 void draw_rr(ezgl::renderer* g);
 
+/* Builds the spatial index used by draw_rr to skip the routing resources *
+ * outside the visible world. Called whenever the rr graph changes. */
+void build_draw_rr_node_bins();
+
 /* Draws all the edges that the user wants shown between inode and what it
  * connects to.  inode is assumed to be a CHANX, CHANY, or IPIN. */
 void draw_rr_edges(RRNodeId from_node, ezgl::renderer* g);
@@ -28,6 +28,7 @@
 #    include "vpr_types.h"
 #    include "vtr_color_map.h"
 #    include "vtr_vector.h"
+#    include "vtr_ndmatrix.h"
 #    include "breakpoint.h"
 #    include "manual_moves.h"
 
@@ -249,6 +250,14 @@ struct t_draw_state {
      */
     vtr::vector<RRNodeId, t_draw_rr_node> draw_rr_node;
 
+    /**
+     * @brief spatial index of the routing resources, used to only draw those in view.
+     *
+     * Each bin holds the rr nodes whose span overlaps a square of DRAW_RR_BIN_SIZE x DRAW_RR_BIN_SIZE
+     * grid tiles. [0..num_bins_x-1][0..num_bins_y-1]
+     */
+    vtr::NdMatrix<std::vector<RRNodeId>, 2> draw_rr_node_bins;
+
     std::shared_ptr<const SetupTimingInfo> setup_timing_info;
 
     ///@brief pointer to architecture info. const
@@ -1,6 +1,8 @@
 #ifndef NO_GRAPHICS
 
 #    include <cstdio>
+#    include <deque>
+#    include <future>
 #    include <sstream>
 
 #    include "globals.h"
@@ -12,6 +14,15 @@
 
 extern ezgl::rectangle initial_world;
 
+//Maximum number of PNG images being written in the background, which bounds
+//the memory held by rendered images waiting to be written
+constexpr size_t MAX_PENDING_PNG_WRITES = 4;
+
+//PNG images being encoded and written in the background, oldest first
+static std::deque<std::future<bool>> pending_png_writes;
+
+static void write_png_async(cairo_surface_t* surface, const std::string& file_name);
+
 void save_graphics_from_button(GtkWidget* /*widget*/, gint response_id, gpointer data) {
     auto dialog = static_cast<GtkWidget*>(data);
 
@@ -72,7 +83,11 @@ void save_graphics(std::string extension, std::string file_name) {
     } else if (extension == "png") {
         constexpr int IMAGE_WIDTH_PIXELS = 2048;
         int image_height_pixels = IMAGE_WIDTH_PIXELS * float(initial_world.height()) / initial_world.width();
-        result = canvas->print_png(file_name.c_str(), IMAGE_WIDTH_PIXELS, image_height_pixels);
+        cairo_surface_t* surface = canvas->render_image_surface(IMAGE_WIDTH_PIXELS, image_height_pixels);
+        result = (surface != nullptr);
+        if (result) {
+            write_png_async(surface, file_name);
+        }
     } else if (extension == "svg") {
         result = canvas->print_svg(file_name.c_str(), initial_world.width(), initial_world.height());
     } else {
@@ -82,6 +97,31 @@ void save_graphics(std::string extension, std::string file_name) {
     VTR_ASSERT_MSG(result == true, "Failed to save graphics");
 }
 
+/* Encoding (compressing) and writing a large PNG takes about as long as drawing  *
+ * it. Only the drawing uses the graphics state, so the image is written on a     *
+ * separate thread while VPR continues.                                           */
+static void write_png_async(cairo_surface_t* surface, const std::string& file_name) {
+    while (pending_png_writes.size() >= MAX_PENDING_PNG_WRITES) {
+        bool written = pending_png_writes.front().get();
+        pending_png_writes.pop_front();
+        VTR_ASSERT_MSG(written, "Failed to save graphics");
+    }
+
+    pending_png_writes.push_back(std::async(std::launch::async, [surface, file_name]() {
+        bool written = (cairo_surface_write_to_png(surface, file_name.c_str()) == CAIRO_STATUS_SUCCESS);
+        cairo_surface_destroy(surface);
+        return written;
+    }));
+}
+
+void finish_save_graphics() {
+    while (!pending_png_writes.empty()) {
+        bool written = pending_png_writes.front().get();
+        pending_png_writes.pop_front();
+        VTR_ASSERT_MSG(written, "Failed to save graphics");
+    }
+}
+
 void save_graphics_dialog_box(GtkWidget* /*widget*/, ezgl::application* /*app*/) {
     GObject* main_window;
     GtkWidget* content_area;
@@ -16,6 +16,9 @@
 #    include "ezgl/graphics.hpp"
 
 void save_graphics(std::string extension, std::string file_name);
+
+/* PNG images are written in the background; waits until all of them are written */
+void finish_save_graphics();
 void save_graphics_dialog_box(GtkWidget* /*widget*/, ezgl::application* /*app*/);
 void save_graphics_from_button(GtkWidget* /*widget*/, gint response_id, gpointer data);
 
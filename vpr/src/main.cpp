@@ -29,6 +29,10 @@
 
 #include "globals.h"
 
+#ifdef VPR_USE_MPI
+#    include <mpi.h>
+#endif
+
 /**
  * VPR program
  * Generate FPGA architecture given architecture description
@@ -42,6 +46,14 @@
  * 4.  Clean up
  */
 int main(int argc, const char** argv) {
+#ifdef VPR_USE_MPI
+    /* Every process started by mpirun runs the whole flow: only the distributed router splits up the work */
+    MPI_Init(nullptr, nullptr);
+    struct MpiFinalizer {
+        ~MpiFinalizer() { MPI_Finalize(); }
+    } mpi_finalizer;
+#endif
+
     vtr::ScopedFinishTimer t("The entire flow of VPR");
 
     t_options Options = t_options();
@@ -57,6 +57,9 @@ class BFSRouting : public NocRouting {
                     std::vector<NocLinkId>& flow_route,
                     const NocStorage& noc_model) override;
 
+    ///@brief BFS finds the same route between two routers for all traffic flows
+    bool routes_depend_on_traffic_flow() const override { return false; }
+
     // internally used helper functions
   private:
     /**
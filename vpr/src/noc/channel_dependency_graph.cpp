@@ -2,6 +2,7 @@
 #include "channel_dependency_graph.h"
 #include "vtr_assert.h"
 
+#include <algorithm>
 #include <stack>
 
 ChannelDependencyGraph::ChannelDependencyGraph(const NocStorage& noc_model,
@@ -125,4 +126,173 @@ bool ChannelDependencyGraph::has_cycles() {
 
     // if no vertex in the graph points to at least one of its ancestors, the graph does not have any cycles
     return false;
-}
\ No newline at end of file
+}
+
+ChannelDependencyGraph::ChannelDependencyGraph(size_t n_links) {
+    adjacency_list_.resize(n_links);
+    dependency_counts_.resize(n_links);
+    reverse_adjacency_list_.resize(n_links);
+    visited_.resize(n_links, false);
+
+    // initially there are no dependencies, so any order is a topological order
+    topological_order_.resize(n_links);
+    for (NocLinkId noc_link_id : topological_order_.keys()) {
+        topological_order_[noc_link_id] = (size_t)noc_link_id;
+    }
+}
+
+bool ChannelDependencyGraph::add_route(const std::vector<NocLinkId>& route) {
+    for (size_t i = 0; i + 1 < route.size(); i++) {
+        if (!add_dependency(route[i], route[i + 1])) {
+            // undo the dependencies already added for this route
+            for (size_t j = 0; j < i; j++) {
+                remove_dependency(route[j], route[j + 1]);
+            }
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void ChannelDependencyGraph::remove_route(const std::vector<NocLinkId>& route) {
+    for (size_t i = 0; i + 1 < route.size(); i++) {
+        remove_dependency(route[i], route[i + 1]);
+    }
+}
+
+bool ChannelDependencyGraph::add_dependency(NocLinkId from_link, NocLinkId to_link) {
+    VTR_ASSERT(from_link != to_link);
+
+    auto& neighbors = adjacency_list_[from_link];
+    auto it = std::find(neighbors.begin(), neighbors.end(), to_link);
+    if (it != neighbors.end()) {
+        // the dependency already exists, so it is already consistent with the topological order
+        dependency_counts_[from_link][it - neighbors.begin()]++;
+        return true;
+    }
+
+    if (!reorder(from_link, to_link)) {
+        return false;
+    }
+
+    neighbors.push_back(to_link);
+    dependency_counts_[from_link].push_back(1);
+    reverse_adjacency_list_[to_link].push_back(from_link);
+    return true;
+}
+
+void ChannelDependencyGraph::remove_dependency(NocLinkId from_link, NocLinkId to_link) {
+    auto& neighbors = adjacency_list_[from_link];
+    auto it = std::find(neighbors.begin(), neighbors.end(), to_link);
+    VTR_ASSERT(it != neighbors.end());
+
+    size_t index = it - neighbors.begin();
+    auto& counts = dependency_counts_[from_link];
+    if (--counts[index] > 0) {
+        return;
+    }
+
+    // no route uses this dependency anymore. Removing a dependency never invalidates the topological order.
+    neighbors[index] = neighbors.back();
+    neighbors.pop_back();
+    counts[index] = counts.back();
+    counts.pop_back();
+
+    auto& reverse_neighbors = reverse_adjacency_list_[to_link];
+    auto reverse_it = std::find(reverse_neighbors.begin(), reverse_neighbors.end(), from_link);
+    VTR_ASSERT(reverse_it != reverse_neighbors.end());
+    *reverse_it = reverse_neighbors.back();
+    reverse_neighbors.pop_back();
+}
+
+bool ChannelDependencyGraph::reorder(NocLinkId from_link, NocLinkId to_link) {
+    const int lower_bound = topological_order_[to_link];
+    const int upper_bound = topological_order_[from_link];
+
+    // the new dependency already agrees with the topological order
+    if (lower_bound > upper_bound) {
+        return true;
+    }
+
+    forward_nodes_.clear();
+    backward_nodes_.clear();
+
+    auto reset_visited = [this]() {
+        for (NocLinkId noc_link_id : forward_nodes_) {
+            visited_[noc_link_id] = false;
+        }
+        for (NocLinkId noc_link_id : backward_nodes_) {
+            visited_[noc_link_id] = false;
+        }
+    };
+
+    // Find the nodes reachable from to_link which are ordered before from_link.
+    // If from_link itself is reachable, the new dependency closes a cycle.
+    // Nodes are recorded when first visited, so all visited flags are reset even if the search stops early.
+    std::vector<NocLinkId> stack{to_link};
+    visited_[to_link] = true;
+    forward_nodes_.push_back(to_link);
+    while (!stack.empty()) {
+        NocLinkId noc_link_id = stack.back();
+        stack.pop_back();
+
+        for (NocLinkId neighbor_id : adjacency_list_[noc_link_id]) {
+            if (neighbor_id == from_link) {
+                reset_visited();
+                return false;
+            }
+            if (!visited_[neighbor_id] && topological_order_[neighbor_id] < upper_bound) {
+                visited_[neighbor_id] = true;
+                forward_nodes_.push_back(neighbor_id);
+                stack.push_back(neighbor_id);
+            }
+        }
+    }
+
+    // Find the nodes which reach from_link and are ordered after to_link
+    stack.push_back(from_link);
+    visited_[from_link] = true;
+    backward_nodes_.push_back(from_link);
+    while (!stack.empty()) {
+        NocLinkId noc_link_id = stack.back();
+        stack.pop_back();
+
+        for (NocLinkId neighbor_id : reverse_adjacency_list_[noc_link_id]) {
+            if (!visited_[neighbor_id] && topological_order_[neighbor_id] > lower_bound) {
+                visited_[neighbor_id] = true;
+                backward_nodes_.push_back(neighbor_id);
+                stack.push_back(neighbor_id);
+            }
+        }
+    }
+
+    reset_visited();
+
+    // Re-use the positions of the visited nodes, placing all the nodes which reach from_link
+    // before all the nodes reachable from to_link (each group keeps its relative order)
+    auto by_order = [this](NocLinkId a, NocLinkId b) {
+        return topological_order_[a] < topological_order_[b];
+    };
+    std::sort(backward_nodes_.begin(), backward_nodes_.end(), by_order);
+    std::sort(forward_nodes_.begin(), forward_nodes_.end(), by_order);
+
+    reordered_positions_.clear();
+    for (NocLinkId noc_link_id : backward_nodes_) {
+        reordered_positions_.push_back(topological_order_[noc_link_id]);
+    }
+    for (NocLinkId noc_link_id : forward_nodes_) {
+        reordered_positions_.push_back(topological_order_[noc_link_id]);
+    }
+    std::sort(reordered_positions_.begin(), reordered_positions_.end());
+
+    size_t i_position = 0;
+    for (NocLinkId noc_link_id : backward_nodes_) {
+        topological_order_[noc_link_id] = reordered_positions_[i_position++];
+    }
+    for (NocLinkId noc_link_id : forward_nodes_) {
+        topological_order_[noc_link_id] = reordered_positions_[i_position++];
+    }
+
+    return true;
+}
@@ -15,6 +15,16 @@
  * Vi to Vj, where Vi and Vj are nodes in CDG that are associated with Li and Lj.
  * Absence of cycles in the formed CDG guarantees deadlock freedom.
  *
+ * A CDG can either be built at once from all traffic flow routes and checked
+ * for cycles with has_cycles(), or built incrementally with add_route() and
+ * remove_route() as traffic flow routes change (e.g. during placement). An
+ * incrementally built CDG is kept acyclic: add_route() refuses any route whose
+ * dependencies would form a cycle. To do so without searching the whole graph,
+ * a topological order of the CDG nodes is maintained and only the nodes between
+ * the endpoints of a new out-of-order dependency are visited and reordered, as in:
+ * Pearce, D. J., & Kelly, P. H. (2007). A dynamic topological sort algorithm for
+ * directed acyclic graphs. ACM Journal of Experimental Algorithmics, 11, 1-7.
+ *
  * To learn more about channel dependency graph, refer to the following papers:
  * 1) Glass, C. J., & Ni, L. M. (1992). The turn model for adaptive routing.
  * ACM SIGARCH Computer Architecture News, 20(2), 278-287.
@@ -52,9 +62,63 @@ class ChannelDependencyGraph {
      */
     bool has_cycles();
 
+    /**
+     * @brief Constructs an empty CDG, to which traffic flow routes are
+     * added incrementally with add_route() and removed with remove_route().
+     *
+     * @param n_links The total number of NoC links.
+     */
+    explicit ChannelDependencyGraph(size_t n_links);
+
+    /**
+     * @brief Adds the dependencies between consecutive links of a traffic
+     * flow route to an incrementally built CDG, unless they would form a cycle.
+     *
+     * @param route The links traversed by a traffic flow, in traversal order.
+     * @return True if the route was added. False if adding it would create a
+     * cycle (i.e. possible deadlock), in which case the CDG is left unchanged.
+     */
+    bool add_route(const std::vector<NocLinkId>& route);
+
+    /**
+     * @brief Removes a traffic flow route previously added with add_route().
+     *
+     * @param route The links traversed by the traffic flow, in traversal order.
+     */
+    void remove_route(const std::vector<NocLinkId>& route);
+
   private:
+    /**
+     * @brief Adds a dependency from one link to another, keeping the topological
+     * order valid. Returns false (without adding it) if it would create a cycle.
+     */
+    bool add_dependency(NocLinkId from_link, NocLinkId to_link);
+
+    ///@brief Removes one occurrence of a dependency added by add_dependency()
+    void remove_dependency(NocLinkId from_link, NocLinkId to_link);
+
+    /**
+     * @brief Reorders the topological order so that from_link comes before to_link.
+     * Returns false if this is impossible because to_link already reaches from_link.
+     */
+    bool reorder(NocLinkId from_link, NocLinkId to_link);
+
     /** An adjacency list used to represent channel dependency graph.*/
     vtr::vector<NocLinkId, std::vector<NocLinkId>> adjacency_list_;
+
+    /* The members below are only used by incrementally built CDGs */
+
+    /** The number of routes which use each dependency in adjacency_list_ (same indexing).*/
+    vtr::vector<NocLinkId, std::vector<int>> dependency_counts_;
+    /** The incoming neighbors of each node, used to search backwards when reordering.*/
+    vtr::vector<NocLinkId, std::vector<NocLinkId>> reverse_adjacency_list_;
+    /** The position of each node in a topological order of the CDG.*/
+    vtr::vector<NocLinkId, int> topological_order_;
+    /** Scratch space for reorder()*/
+    vtr::vector<NocLinkId, bool> visited_;
+    std::vector<NocLinkId> forward_nodes_;
+    std::vector<NocLinkId> backward_nodes_;
+    std::vector<int> reordered_positions_;
 };
 
 #endif //VTR_CHANNEL_DEPENDENCY_GRAPH_H
@@ -61,6 +61,21 @@ class NocRouting {
                             NocTrafficFlowId traffic_flow_id,
                             std::vector<NocLinkId>& flow_route,
                             const NocStorage& noc_model) = 0;
+
+    /**
+     * @brief Returns whether the route found by route_flow() can depend on
+     * the traffic flow being routed (e.g. when choosing between several
+     * minimal routes based on the traffic flow id), rather than only on the
+     * source and destination routers.
+     *
+     * Routes found by algorithms which only depend on the source and
+     * destination routers can be shared between traffic flows, and are
+     * cached by the placer.
+     *
+     * @return True unless the derived class guarantees that the route only
+     * depends on the source and destination routers.
+     */
+    virtual bool routes_depend_on_traffic_flow() const { return true; }
 };
 
 #endif
@@ -179,6 +179,20 @@ static orsat::LinearExpr create_objective(orsat::CpModelBuilder& cp_model,
                                           int congestion_weight,
                                           bool minimize_aggregate_bandwidth);
 
+/**
+ * @brief Gives the current traffic flow routes to the SAT solver as a solution hint.
+ *
+ * Every (traffic flow, link) variable is hinted, so the hint is a complete assignment
+ * of the routing variables. Starting from the current (usually good) routing lets the
+ * solver find a feasible solution and a tight bound on the objective quickly, which
+ * matters most when the search is time limited.
+ *
+ * @param cp_model The CP model builder object. Hints are added to this model.
+ * @param flow_link_vars Boolean variable container for (traffic flow, link) pairs.
+ */
+static void add_current_route_hints(orsat::CpModelBuilder& cp_model,
+                                    const t_flow_link_var_map& flow_link_vars);
+
 /**
  * @brief Converts the activated (traffic flow, link) boolean variables to
  * traffic flow routes.
@@ -575,17 +589,6 @@ static orsat::LinearExpr create_objective(orsat::CpModelBuilder& cp_model,
                                           int latency_overrun_weight,
                                           int congestion_weight,
                                           bool minimize_aggregate_bandwidth) {
-    const auto& noc_ctx = g_vpr_ctx.noc();
-    const auto& traffic_flow_storage = noc_ctx.noc_traffic_flows_storage;
-
-    // use the current routing solution as a hint for the SAT solver
-    // This will help the solver by giving a good starting point and tighter initial lower bound on the objective function
-    for (auto traffic_flow_id : traffic_flow_storage.get_all_traffic_flow_id()) {
-        for (auto route_link_id : traffic_flow_storage.get_traffic_flow_route(traffic_flow_id)) {
-            cp_model.AddHint(flow_link_vars[{traffic_flow_id, route_link_id}], true);
-        }
-    }
-
     orsat::LinearExpr latency_overrun_sum;
     for (auto& [traffic_flow_id, latency_overrun_var] : latency_overrun_vars) {
         latency_overrun_sum += latency_overrun_var;
@@ -611,6 +614,21 @@ static orsat::LinearExpr create_objective(orsat::CpModelBuilder& cp_model,
     return objective;
 }
 
+static void add_current_route_hints(orsat::CpModelBuilder& cp_model,
+                                    const t_flow_link_var_map& flow_link_vars) {
+    const auto& noc_ctx = g_vpr_ctx.noc();
+    const auto& traffic_flow_storage = noc_ctx.noc_traffic_flows_storage;
+
+    // use the current routing solution as a hint for the SAT solver
+    // This will help the solver by giving a good starting point and tighter initial lower bound on the objective function
+    for (const auto& [key, var] : flow_link_vars) {
+        auto [traffic_flow_id, noc_link_id] = key;
+        const std::vector<NocLinkId>& route = traffic_flow_storage.get_traffic_flow_route(traffic_flow_id);
+        bool in_route = std::find(route.begin(), route.end(), noc_link_id) != route.end();
+        cp_model.AddHint(var, in_route);
+    }
+}
+
 
 vtr::vector<NocTrafficFlowId, std::vector<NocLinkId>> noc_sat_route(bool minimize_aggregate_bandwidth,
                                                                     const t_noc_opts& noc_opts,
@@ -654,12 +672,18 @@ vtr::vector<NocTrafficFlowId, std::vector<NocLinkId>> noc_sat_route(bool minimiz
 
     cp_model.Minimize(objective);
 
+    add_current_route_hints(cp_model, flow_link_vars);
+
     orsat::SatParameters sat_params;
     if (noc_opts.noc_sat_routing_num_workers > 0) {
         sat_params.set_num_workers(noc_opts.noc_sat_routing_num_workers);
     }
     sat_params.set_random_seed(seed);
     sat_params.set_log_search_progress(noc_opts.noc_sat_routing_log_search_progress);
+    if (noc_opts.noc_sat_routing_time_limit > 0.) {
+        // the best solution found within the time limit is used
+        sat_params.set_max_time_in_seconds(noc_opts.noc_sat_routing_time_limit);
+    }
 
     orsat::Model model;
     model.Add(NewSatParameters(sat_params));
@@ -668,6 +692,10 @@ vtr::vector<NocTrafficFlowId, std::vector<NocLinkId>> noc_sat_route(bool minimiz
 
     if (response.status() == orsat::CpSolverStatus::FEASIBLE ||
         response.status() == orsat::CpSolverStatus::OPTIMAL) {
+        if (response.status() == orsat::CpSolverStatus::FEASIBLE && noc_opts.noc_sat_routing_time_limit > 0.) {
+            VTR_LOG("NoC SAT routing stopped after %g seconds before proving optimality; using the best routing found\n",
+                    response.wall_time());
+        }
         auto routes = convert_vars_to_routes(flow_link_vars, response);
         return routes;
     }
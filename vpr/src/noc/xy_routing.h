@@ -92,6 +92,9 @@ class XYRouting : public TurnModelRouting {
   public:
     ~XYRouting() override;
 
+    ///@brief XY routing has a single route between two routers, regardless of the traffic flow
+    bool routes_depend_on_traffic_flow() const override { return false; }
+
   private:
     const std::vector<TurnModelRouting::Direction>& get_legal_directions(NocRouterId src_router_id,
                                                                          NocRouterId curr_router_id,
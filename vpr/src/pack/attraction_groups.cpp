@@ -1,4 +1,5 @@
 #include "attraction_groups.h"
+#include "netlist_partitioner.h"
 
 AttractionInfo::AttractionInfo(bool attraction_groups_on) {
     const auto& floorplanning_ctx = g_vpr_ctx.floorplanning();
@@ -128,6 +129,34 @@ void AttractionInfo::create_att_groups_for_all_regions() {
     VTR_LOG("%d clustering attraction groups created. \n", attraction_groups.size());
 }
 
+void AttractionInfo::create_att_groups_from_netlist_partition(int target_part_size) {
+    auto& atom_ctx = g_vpr_ctx.atom();
+
+    //clear the data structures before continuing
+    atom_attraction_group.clear();
+    attraction_groups.clear();
+
+    //Initialize every atom to have no attraction group id
+    int num_atoms = atom_ctx.nlist.blocks().size();
+
+    atom_attraction_group.resize(num_atoms);
+    fill(atom_attraction_group.begin(), atom_attraction_group.end(), AttractGroupId::INVALID());
+
+    for (auto& part_atoms : partition_atom_netlist(target_part_size)) {
+        AttractionGroup group_info;
+        group_info.group_atoms = std::move(part_atoms);
+
+        attraction_groups.push_back(group_info);
+    }
+
+    //Then, fill in the group id for the atoms that do have an attraction group
+    assign_atom_attraction_ids();
+
+    att_group_pulls = 1;
+
+    VTR_LOG("%d clustering attraction groups created from the netlist partition. \n", attraction_groups.size());
+}
+
 void AttractionInfo::assign_atom_attraction_ids() {
     //Fill in the group id for the atoms that do have an attraction group
     int num_att_grps = attraction_groups.size();
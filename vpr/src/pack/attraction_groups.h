@@ -61,6 +61,12 @@ class AttractionInfo {
      */
     void create_att_groups_for_all_regions();
 
+    /*
+     * Create attraction groups from a partitioning of the atom netlist into parts of at
+     * most target_part_size atoms (see netlist_partitioner.h).
+     */
+    void create_att_groups_from_netlist_partition(int target_part_size);
+
     void assign_atom_attraction_ids();
 
     //Setters and getters for the class
@@ -45,6 +45,7 @@
 #include "vtr_log.h"
 #include "vtr_math.h"
 #include "vtr_memory.h"
+#include "vtr_profiler_markers.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -197,6 +198,10 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
                               clustering_data, net_output_feeds_driving_block_input,
                               unclustered_list_head_size, cluster_stats.num_molecules);
 
+    if (packer_opts.stream_output) {
+        clustering_data.output_writer = std::make_unique<ClusteringXmlStreamWriter>(packer_opts.global_clocks, is_clock, arch->architecture_id, packer_opts.output_file.c_str());
+    }
+
     auto primitive_candidate_block_types = identify_primitive_candidate_block_types();
     // find the cluster type that has lut primitives
     auto logic_block_type = identify_logic_block_type(primitive_candidate_block_types);
@@ -220,6 +225,10 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
     // Assign gain scores to atoms and sort them based on the scores.
     auto seed_atoms = initialize_seed_atoms(packer_opts.cluster_seed_type, max_molecule_stats, atom_criticality);
 
+    /* Timing edges whose delays changed since the last timing update, and the clusters formed since then */
+    std::vector<tatum::EdgeId> modified_timing_edges;
+    int clusters_since_timing_update = 0;
+
     /* index of next most timing critical block */
     int seed_index = 0;
     istart = get_highest_gain_seed_molecule(seed_index, seed_atoms);
@@ -236,6 +245,7 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
         for (detailed_routing_stage = (int)E_DETAILED_ROUTE_AT_END_ONLY; !is_cluster_legal && detailed_routing_stage != (int)E_DETAILED_ROUTE_INVALID; detailed_routing_stage++) {
             // Use the total number created clusters so far as the ID for the new cluster
             ClusterBlockId clb_index(helper_ctx.total_clb_num);
+            VTR_PROFILE_SCOPE_ARG(pack_cluster, size_t(clb_index));
 
             VTR_LOGV(verbosity > 2, "Complex block %d:\n", helper_ctx.total_clb_num);
 
@@ -375,6 +385,22 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
 
             if (is_cluster_legal) {
                 istart = save_cluster_routing_and_pick_new_seed(packer_opts, helper_ctx.total_clb_num, seed_atoms, num_blocks_hill_added, clustering_data.intra_lb_routing, seed_index, cluster_stats, router_data);
+
+                //Periodically re-analyze timing with the intra-cluster delays of the clusters formed so far,
+                //so the timing gains of later clusters use up-to-date criticalities
+                if (packer_opts.timing_driven && packer_opts.timing_update_interval > 0 && clustering_data.intra_lb_routing[clb_index]) {
+                    load_cluster_intra_lb_net_delays(clb_index, *clustering_data.intra_lb_routing[clb_index],
+                                                     lb_type_rr_graphs[cluster_ctx.clb_nlist.block_type(clb_index)->index],
+                                                     *clustering_delay_calc, modified_timing_edges);
+                    if (++clusters_since_timing_update >= packer_opts.timing_update_interval) {
+                        update_packing_timing(*timing_info, modified_timing_edges);
+                        clusters_since_timing_update = 0;
+                        cluster_stats.blocks_since_last_analysis = 0;
+                    }
+                }
+                if (clustering_data.output_writer) {
+                    clustering_data.output_writer->write_cluster(clb_index, clustering_data.intra_lb_routing[clb_index]);
+                }
                 store_cluster_info_and_free(packer_opts, clb_index, logic_block_type, le_pb_type, le_count, clb_inter_blk_nets);
             } else {
                 free_data_and_requeue_used_mols_if_illegal(clb_index, saved_seed_index, num_used_type_instances, helper_ctx.total_clb_num, seed_index);
@@ -26,9 +26,26 @@
 #include "hash.h"
 #include "cluster_placement.h"
 
+/****************************************/
+/*Local Data							*/
+/****************************************/
+
+/* Checking whether an atom fits a primitive pb_type walks all ports of the pb_type, and the packer repeats
+ * this check for the same atoms and pb_types many times. Each primitive pb_type is therefore given a bit
+ * among the primitive pb_types of its model, and the result for every pb_type of an atom's model is
+ * computed once and stored as a mask, turning later checks into a bitwise and. */
+static constexpr size_t MAX_FEASIBILITY_BITS = 63;
+static constexpr uint64_t FEASIBILITY_MASK_COMPUTED = uint64_t(1) << MAX_FEASIBILITY_BITS;
+
+static std::unordered_map<const t_model*, std::vector<const t_pb_type*>> model_primitive_pb_types; ///<primitive pb_types of each model, in bit order
+static std::unordered_map<const t_pb_type*, uint64_t> primitive_pb_type_bits;                     ///<bit of each primitive pb_type (0 if not tracked)
+static vtr::vector<AtomBlockId, uint64_t> atom_feasibility_masks;                                  ///<feasible primitive pb_types of each atom's model
+
 /****************************************/
 /*Local Function Declaration			*/
 /****************************************/
+static void load_primitive_feasibility_bits(t_cluster_placement_stats* cluster_placement_stats);
+static bool primitive_type_feasible_by_bit(const AtomBlockId blk_id, const t_pb_type* cur_pb_type, uint64_t pb_type_bit);
 static void load_cluster_placement_stats_for_pb_graph_node(t_cluster_placement_stats* cluster_placement_stats,
                                                            t_pb_graph_node* pb_graph_node);
 static void update_primitive_cost_or_status(const t_pb_graph_node* pb_graph_node,
@@ -60,6 +77,12 @@ t_cluster_placement_stats* alloc_and_load_cluster_placement_stats() {
     // Allocate array of cluster placement stats, one for each device_ctx.block_types
     cluster_placement_stats_list = new t_cluster_placement_stats[device_ctx.logical_block_types.size()];
 
+    // Atom feasibility masks are recomputed lazily
+    model_primitive_pb_types.clear();
+    primitive_pb_type_bits.clear();
+    atom_feasibility_masks.clear();
+    atom_feasibility_masks.resize(g_vpr_ctx.atom().nlist.blocks().size(), 0);
+
     // For each block type, initialize the cluster_placement_stats and load it with the primitives in this type
     for (const auto& type : device_ctx.logical_block_types) {
         cluster_placement_stats_list[type.index] = t_cluster_placement_stats();
@@ -67,11 +90,67 @@ t_cluster_placement_stats* alloc_and_load_cluster_placement_stats() {
             cluster_placement_stats_list[type.index].curr_molecule = nullptr;
             load_cluster_placement_stats_for_pb_graph_node(&cluster_placement_stats_list[type.index],
                                                            type.pb_graph_head);
+            load_primitive_feasibility_bits(&cluster_placement_stats_list[type.index]);
         }
     }
     return cluster_placement_stats_list;
 }
 
+/**
+ * Assign feasibility mask bits to the primitive pb_types of cluster_placement_stats which do not have one yet
+ */
+static void load_primitive_feasibility_bits(t_cluster_placement_stats* cluster_placement_stats) {
+    cluster_placement_stats->primitive_feasibility_bits.resize(cluster_placement_stats->num_pb_types);
+    for (int i = 0; i < cluster_placement_stats->num_pb_types; i++) {
+        const t_pb_type* pb_type = cluster_placement_stats->valid_primitives[i].begin()->second->pb_graph_node->pb_type;
+        auto result = primitive_pb_type_bits.insert({pb_type, 0});
+        if (result.second) {
+            std::vector<const t_pb_type*>& model_pb_types = model_primitive_pb_types[pb_type->model];
+            if (model_pb_types.size() < MAX_FEASIBILITY_BITS) {
+                result.first->second = uint64_t(1) << model_pb_types.size();
+            }
+            model_pb_types.push_back(pb_type);
+        }
+        cluster_placement_stats->primitive_feasibility_bits[i] = result.first->second;
+    }
+}
+
+/**
+ * Same as primitive_type_feasible(), using (and filling in) the feasibility mask of blk_id for the
+ * primitive pb_types of its model. pb_type_bit is the bit of cur_pb_type, 0 if it has no bit.
+ */
+static bool primitive_type_feasible_by_bit(const AtomBlockId blk_id, const t_pb_type* cur_pb_type, uint64_t pb_type_bit) {
+    if (pb_type_bit == 0) {
+        return primitive_type_feasible(blk_id, cur_pb_type);
+    }
+
+    const t_model* model = g_vpr_ctx.atom().nlist.block_model(blk_id);
+    if (cur_pb_type->model != model) {
+        //Primitive and atom do not match
+        return false;
+    }
+
+    uint64_t& mask = atom_feasibility_masks[blk_id];
+    if (!(mask & FEASIBILITY_MASK_COMPUTED)) {
+        mask = FEASIBILITY_MASK_COMPUTED;
+        const std::vector<const t_pb_type*>& model_pb_types = model_primitive_pb_types[model];
+        for (size_t ibit = 0; ibit < std::min(model_pb_types.size(), MAX_FEASIBILITY_BITS); ibit++) {
+            if (primitive_type_feasible(blk_id, model_pb_types[ibit])) {
+                mask |= uint64_t(1) << ibit;
+            }
+        }
+    }
+    return mask & pb_type_bit;
+}
+
+bool cached_primitive_type_feasible(const AtomBlockId blk_id, const t_pb_type* cur_pb_type) {
+    if (cur_pb_type == nullptr) {
+        return false;
+    }
+    auto bit = primitive_pb_type_bits.find(cur_pb_type);
+    return primitive_type_feasible_by_bit(blk_id, cur_pb_type, bit != primitive_pb_type_bits.end() ? bit->second : 0);
+}
+
 /**
  * get next list of primitives for list of atom blocks
  *
@@ -131,7 +210,7 @@ bool get_next_primitive_list(t_cluster_placement_stats* cluster_placement_stats,
     for (i = 0; i < cluster_placement_stats->num_pb_types; i++) {
         if (!cluster_placement_stats->valid_primitives[i].empty()) {
             t_cluster_placement_primitive* cur_cluster_placement_primitive = cluster_placement_stats->valid_primitives[i].begin()->second;
-            if (primitive_type_feasible(molecule->atom_block_ids[molecule->root], cur_cluster_placement_primitive->pb_graph_node->pb_type)) {
+            if (primitive_type_feasible_by_bit(molecule->atom_block_ids[molecule->root], cur_cluster_placement_primitive->pb_graph_node->pb_type, cluster_placement_stats->primitive_feasibility_bits[i])) {
                 // Iterate over the unordered_multimap of the valid primitives of a specific pb primitive type
                 for (auto it = cluster_placement_stats->valid_primitives[i].begin(); it != cluster_placement_stats->valid_primitives[i].end(); /*loop increment is done inside the loop*/) {
                     //Lazily remove invalid primitives
@@ -379,8 +458,8 @@ static float try_place_molecule(const t_pack_molecule* molecule,
     float cost = HUGE_POSITIVE_FLOAT;
     list_size = get_array_size_of_molecule(molecule);
 
-    if (primitive_type_feasible(molecule->atom_block_ids[molecule->root],
-                                root->pb_type)) {
+    if (cached_primitive_type_feasible(molecule->atom_block_ids[molecule->root],
+                                       root->pb_type)) {
         if (root->cluster_placement_primitive->valid) {
             for (i = 0; i < list_size; i++) {
                 primitives_list[i] = nullptr;
@@ -461,7 +540,7 @@ static bool expand_forced_pack_molecule_placement(const t_pack_molecule* molecul
                 next_primitive = next_pin->parent_node;
                 /* Check for legality of placement, if legal, expand from legal placement, if not, return false */
                 if (molecule->atom_block_ids[next_block->block_id] && primitives_list[next_block->block_id] == nullptr) {
-                    if (next_primitive->cluster_placement_primitive->valid && primitive_type_feasible(molecule->atom_block_ids[next_block->block_id], next_primitive->pb_type)) {
+                    if (next_primitive->cluster_placement_primitive->valid && cached_primitive_type_feasible(molecule->atom_block_ids[next_block->block_id], next_primitive->pb_type)) {
                         primitives_list[next_block->block_id] = next_primitive;
                         *cost += next_primitive->cluster_placement_primitive->base_cost + next_primitive->cluster_placement_primitive->incremental_cost;
                         if (!expand_forced_pack_molecule_placement(molecule, next_block, primitives_list, cost)) {
@@ -597,8 +676,8 @@ bool exists_free_primitive_for_atom_block(t_cluster_placement_stats* cluster_pla
 
     /* might have a primitive in flight that's still valid */
     if (!cluster_placement_stats->in_flight_empty()) {
-        if (primitive_type_feasible(blk_id,
-                                    cluster_placement_stats->in_flight_type())) {
+        if (cached_primitive_type_feasible(blk_id,
+                                           cluster_placement_stats->in_flight_type())) {
             return true;
         }
     }
@@ -606,7 +685,7 @@ bool exists_free_primitive_for_atom_block(t_cluster_placement_stats* cluster_pla
     /* Look through list of available primitives to see if any valid */
     for (i = 0; i < cluster_placement_stats->num_pb_types; i++) {
         //for (auto& primitive : cluster_placement_stats->valid_primitives[i]) {
-        if (!cluster_placement_stats->valid_primitives[i].empty() && primitive_type_feasible(blk_id, cluster_placement_stats->valid_primitives[i].begin()->second->pb_graph_node->pb_type)) {
+        if (!cluster_placement_stats->valid_primitives[i].empty() && primitive_type_feasible_by_bit(blk_id, cluster_placement_stats->valid_primitives[i].begin()->second->pb_graph_node->pb_type, cluster_placement_stats->primitive_feasibility_bits[i])) {
             for (auto it = cluster_placement_stats->valid_primitives[i].begin(); it != cluster_placement_stats->valid_primitives[i].end();) {
                 if (it->second->valid)
                     return true;
@@ -22,6 +22,9 @@ void reset_cluster_placement_stats(
     t_cluster_placement_stats* cluster_placement_stats);
 
 int get_array_size_of_molecule(const t_pack_molecule* molecule);
+/* Same result as primitive_type_feasible(), but remembers the result for each atom and primitive pb_type */
+bool cached_primitive_type_feasible(const AtomBlockId blk_id, const t_pb_type* cur_pb_type);
+
 bool exists_free_primitive_for_atom_block(
     t_cluster_placement_stats* cluster_placement_stats,
     const AtomBlockId blk_id);
@@ -18,9 +18,14 @@
 #include <map>
 #include <queue>
 #include <cmath>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_hash.h"
 
 #include "vpr_error.h"
 #include "vpr_types.h"
@@ -69,6 +74,51 @@ class reservable_pq : public std::priority_queue<T, U, V> {
     size_type cur_cap;
 };
 
+/* Hash of a canonical intra-logic block routing problem (see make_route_cache_key) */
+struct t_route_cache_key_hash {
+    size_t operator()(const std::vector<int>& key) const noexcept {
+        size_t seed = key.size();
+        for (int val : key) {
+            vtr::hash_combine(seed, val);
+        }
+        return seed;
+    }
+};
+
+/* Outcome of a previous call to try_intra_lb_route() on an identical routing problem */
+struct t_route_cache_entry {
+    bool is_routed = false;
+    bool try_expand_all_modes = false;
+    std::vector<t_lb_trace> rt_trees; /* [0..num_nets-1] Route tree of each net, only stored if is_routed */
+};
+
+/* Results of previous intra-logic block routes, shared by all router data of all logic block types.
+ * Since the router is deterministic, a cluster whose nets, terminals and rr node modes match an earlier
+ * trial routes exactly as that trial did, which happens very often while packing. */
+static std::unordered_map<std::vector<int>, t_route_cache_entry, t_route_cache_key_hash> route_cache;
+
+/* Guards route_cache, so clusters can be routed concurrently (e.g. by find_feasible_mol_moves()) */
+static std::mutex route_cache_mutex;
+
+/* Upper bound on the number of cached routes; the cache is flushed once it is reached to bound memory */
+static constexpr size_t MAX_ROUTE_CACHE_ENTRIES = 1 << 16;
+
+/* Per lb rr node arrays of a router data instance */
+struct t_lb_router_node_buffers {
+    std::unique_ptr<t_lb_rr_node_stats[]> lb_rr_node_stats;
+    std::unique_ptr<t_explored_node_tb[]> explored_node_tb;
+};
+
+/* Node arrays released by free_router_data(), by number of lb rr nodes. The packer creates router data for
+ * every cluster it opens, so alloc_and_load_router_data() reuses these instead of allocating new ones. */
+static std::unordered_map<size_t, std::vector<t_lb_router_node_buffers>> free_node_buffers;
+
+/* Guards free_node_buffers */
+static std::mutex free_node_buffers_mutex;
+
+/* Expansion priority queue shared by all routes of a thread, so its storage is only grown once */
+static thread_local reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node> expansion_pq;
+
 /*****************************************************************************************
  * Internal functions declarations
  ******************************************************************************************/
@@ -107,6 +157,7 @@ static bool is_route_success(t_lb_router_data* router_data);
 static t_lb_trace* find_node_in_rt(t_lb_trace* rt, int rt_index);
 static void reset_explored_node_tb(t_lb_router_data* router_data);
 static void save_and_reset_lb_route(t_lb_router_data* router_data);
+static std::vector<int> make_route_cache_key(const t_lb_router_data* router_data);
 static void load_trace_to_pb_route(t_pb_routes& pb_route, const int total_pins, const AtomNetId net_id, const int prev_pin_id, const t_lb_trace* trace);
 
 static std::string describe_lb_type_rr_node(int inode,
@@ -139,10 +190,26 @@ t_lb_router_data* alloc_and_load_router_data(std::vector<t_lb_type_rr_node>* lb_
 
     router_data->lb_type_graph = lb_type_graph;
     size = router_data->lb_type_graph->size();
-    router_data->lb_rr_node_stats = new t_lb_rr_node_stats[size];
-    router_data->explored_node_tb = new t_explored_node_tb[size];
+    t_lb_router_node_buffers buffers;
+    {
+        std::lock_guard<std::mutex> lock(free_node_buffers_mutex);
+        std::vector<t_lb_router_node_buffers>& free_buffers = free_node_buffers[size];
+        if (!free_buffers.empty()) {
+            buffers = std::move(free_buffers.back());
+            free_buffers.pop_back();
+        }
+    }
+    if (!buffers.lb_rr_node_stats) {
+        router_data->lb_rr_node_stats = new t_lb_rr_node_stats[size];
+        router_data->explored_node_tb = new t_explored_node_tb[size];
+    } else {
+        router_data->lb_rr_node_stats = buffers.lb_rr_node_stats.release();
+        router_data->explored_node_tb = buffers.explored_node_tb.release();
+        std::fill(router_data->lb_rr_node_stats, router_data->lb_rr_node_stats + size, t_lb_rr_node_stats());
+        std::fill(router_data->explored_node_tb, router_data->explored_node_tb + size, t_explored_node_tb());
+    }
     router_data->intra_lb_nets = new std::vector<t_intra_lb_net>;
-    router_data->atoms_added = new std::map<AtomBlockId, bool>;
+    router_data->atoms_added = new vtr::id_hash_set<AtomBlockId>;
     router_data->lb_type = type;
 
     return router_data;
@@ -151,9 +218,15 @@ t_lb_router_data* alloc_and_load_router_data(std::vector<t_lb_type_rr_node>* lb_
 /* free data used by router */
 void free_router_data(t_lb_router_data* router_data) {
     if (router_data != nullptr && router_data->lb_type_graph != nullptr) {
-        delete[] router_data->lb_rr_node_stats;
+        /* Keep the node arrays for the next router data of the same size */
+        t_lb_router_node_buffers buffers;
+        buffers.lb_rr_node_stats.reset(router_data->lb_rr_node_stats);
+        buffers.explored_node_tb.reset(router_data->explored_node_tb);
+        {
+            std::lock_guard<std::mutex> lock(free_node_buffers_mutex);
+            free_node_buffers[router_data->lb_type_graph->size()].push_back(std::move(buffers));
+        }
         router_data->lb_rr_node_stats = nullptr;
-        delete[] router_data->explored_node_tb;
         router_data->explored_node_tb = nullptr;
         router_data->lb_type_graph = nullptr;
         delete router_data->atoms_added;
@@ -252,7 +325,7 @@ void add_atom_as_target(t_lb_router_data* router_data, const AtomBlockId blk_id)
     const t_pb* pb;
     auto& atom_ctx = g_vpr_ctx.atom();
 
-    std::map<AtomBlockId, bool>& atoms_added = *router_data->atoms_added;
+    vtr::id_hash_set<AtomBlockId>& atoms_added = *router_data->atoms_added;
 
     if (atoms_added.count(blk_id) > 0) {
         VPR_FATAL_ERROR(VPR_ERROR_PACK, "Atom %s added twice to router\n", atom_ctx.nlist.block_name(blk_id).c_str());
@@ -262,7 +335,7 @@ void add_atom_as_target(t_lb_router_data* router_data, const AtomBlockId blk_id)
 
     VTR_ASSERT(pb);
 
-    atoms_added[blk_id] = true;
+    atoms_added.insert(blk_id);
 
     set_reset_pb_modes(router_data, pb, true);
 
@@ -277,7 +350,7 @@ void add_atom_as_target(t_lb_router_data* router_data, const AtomBlockId blk_id)
 void remove_atom_from_target(t_lb_router_data* router_data, const AtomBlockId blk_id) {
     auto& atom_ctx = g_vpr_ctx.atom();
 
-    std::map<AtomBlockId, bool>& atoms_added = *router_data->atoms_added;
+    vtr::id_hash_set<AtomBlockId>& atoms_added = *router_data->atoms_added;
 
     const t_pb* pb = atom_ctx.lookup.atom_pb(blk_id);
 
@@ -411,10 +484,20 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
     mode_status->is_mode_conflict = false;
     mode_status->try_expand_all_modes = false;
 
+    /* Routing with the current modes only reads the nets and the rr node modes, so it can be replayed from
+     * the route cache. Expanding all modes also depends on (and updates) the illegal modes of the pb_graph_nodes,
+     * and verbose routing would skip the debug output, so neither uses the cache. */
+    bool use_route_cache = !mode_status->expand_all_modes && verbosity <= 3;
+    std::vector<int> route_cache_key;
+    if (use_route_cache) {
+        route_cache_key = make_route_cache_key(router_data);
+    }
+
     t_expansion_node exp_node;
 
     /* Stores state info during route */
-    reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node> pq;
+    auto& pq = expansion_pq;
+    pq.clear();
 
     reset_explored_node_tb(router_data);
 
@@ -428,6 +511,35 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
         router_data->lb_rr_node_stats[inode].occ = 0;
     }
 
+    if (use_route_cache) {
+        bool is_cached = false;
+        bool is_cached_routed = false;
+        {
+            std::lock_guard<std::mutex> lock(route_cache_mutex);
+            auto cached = route_cache.find(route_cache_key);
+            if (cached != route_cache.end()) {
+                const t_route_cache_entry& entry = cached->second;
+                is_cached = true;
+                is_cached_routed = entry.is_routed;
+                if (entry.is_routed) {
+                    VTR_ASSERT(entry.rt_trees.size() == lb_nets.size());
+                    for (unsigned int inet = 0; inet < lb_nets.size(); inet++) {
+                        lb_nets[inet].rt_tree = new t_lb_trace(entry.rt_trees[inet]);
+                    }
+                } else if (entry.try_expand_all_modes) {
+                    mode_status->try_expand_all_modes = true;
+                    mode_status->expand_all_modes = true;
+                }
+            }
+        }
+        if (is_cached) {
+            if (is_cached_routed) {
+                save_and_reset_lb_route(router_data);
+            }
+            return is_cached_routed;
+        }
+    }
+
     std::unordered_map<const t_pb_graph_node*, const t_mode*> mode_map;
 
     /*	Iteratively remove congestion until a successful route is found.
@@ -513,6 +625,23 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
         router_data->pres_con_fac *= router_data->params.pres_fac_mult;
     }
 
+    if (use_route_cache) {
+        std::lock_guard<std::mutex> lock(route_cache_mutex);
+        if (route_cache.size() >= MAX_ROUTE_CACHE_ENTRIES) {
+            route_cache.clear();
+        }
+        t_route_cache_entry& entry = route_cache[std::move(route_cache_key)];
+        entry.is_routed = is_routed;
+        entry.try_expand_all_modes = mode_status->try_expand_all_modes;
+        if (is_routed) {
+            entry.rt_trees.reserve(lb_nets.size());
+            for (const t_intra_lb_net& lb_net : lb_nets) {
+                VTR_ASSERT(lb_net.rt_tree != nullptr);
+                entry.rt_trees.push_back(*lb_net.rt_tree);
+            }
+        }
+    }
+
     if (is_routed) {
         save_and_reset_lb_route(router_data);
     } else {
@@ -1493,6 +1622,41 @@ static std::string describe_congested_rr_nodes(const std::vector<int>& congested
     return description;
 }
 
+/* Build a key which uniquely identifies the routing problem of the current cluster: its logic block type, the
+ * terminals of each net in routing order and the modes set on the rr nodes */
+static std::vector<int> make_route_cache_key(const t_lb_router_data* router_data) {
+    const std::vector<t_intra_lb_net>& lb_nets = *router_data->intra_lb_nets;
+    const std::vector<t_lb_type_rr_node>& lb_type_graph = *router_data->lb_type_graph;
+
+    std::vector<int> key;
+    key.push_back(router_data->lb_type->index);
+    key.push_back(lb_nets.size());
+    for (const t_intra_lb_net& lb_net : lb_nets) {
+        key.push_back(lb_net.terminals.size());
+        key.insert(key.end(), lb_net.terminals.begin(), lb_net.terminals.end());
+    }
+    for (unsigned int inode = 0; inode < lb_type_graph.size(); inode++) {
+        if (router_data->lb_rr_node_stats[inode].mode != -1) {
+            key.push_back(inode);
+            key.push_back(router_data->lb_rr_node_stats[inode].mode);
+        }
+    }
+    return key;
+}
+
+void free_cluster_router_pools() {
+    {
+        std::lock_guard<std::mutex> lock(route_cache_mutex);
+        route_cache.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(free_node_buffers_mutex);
+        free_node_buffers.clear();
+    }
+    //Only frees the queue of the calling thread; those of other threads are freed when they exit
+    expansion_pq = reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node>();
+}
+
 void reset_intra_lb_route(t_lb_router_data* router_data) {
     for (auto& node : *router_data->lb_type_graph) {
         auto* pin = node.pb_graph_pin;
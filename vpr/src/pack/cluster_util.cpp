@@ -5,8 +5,36 @@
 #include "output_clustering.h"
 
 #include "vtr_math.h"
+#include "vtr_random.h"
 #include "SetupGrid.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
+/**
+ * @brief Calls fn(blk) for every atom block, on several threads if VPR is built with TBB.
+ *
+ * fn may read the atom netlist and molecules, but must only write data belonging to blk,
+ * so that the results do not depend on the number of threads.
+ */
+template<typename Fn>
+static void parallel_for_each_atom_block(const Fn& fn) {
+    auto blocks = g_vpr_ctx.atom().nlist.blocks();
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), blocks.size(), [&](size_t i) {
+        fn(*(blocks.begin() + i));
+    });
+#else
+    for (AtomBlockId blk : blocks) {
+        fn(blk);
+    }
+#endif
+}
+
+///@brief Seed of the random streams picking the candidate atoms of attraction group pulls
+constexpr uint64_t ATTRACTION_GROUP_PULL_SEED = 1;
+
 /**********************************/
 /* Global variables in clustering */
 /**********************************/
@@ -216,13 +244,100 @@ void calc_init_packing_timing(const t_packer_opts& packer_opts,
     }
 
     //Calculate true criticalities of each block
-    for (AtomBlockId blk : atom_ctx.nlist.blocks()) {
+    parallel_for_each_atom_block([&](AtomBlockId blk) {
         for (AtomPinId in_pin : atom_ctx.nlist.block_input_pins(blk)) {
             //Max criticality over incoming nets
             float crit = timing_info->setup_pin_criticality(in_pin);
             atom_criticality[blk] = std::max(atom_criticality[blk], crit);
         }
+    });
+}
+
+/* Returns the delay of the pb_graph interconnect edge from driver to sink (0 if there is none) */
+static float pb_graph_edge_delay(const t_pb_graph_pin* driver, const t_pb_graph_pin* sink) {
+    for (int iedge = 0; iedge < driver->num_output_edges; iedge++) {
+        const t_pb_graph_edge* edge = driver->output_edges[iedge];
+        for (int ipin = 0; ipin < edge->num_output_pins; ipin++) {
+            if (edge->output_pins[ipin] == sink) {
+                return edge->delay_max;
+            }
+        }
     }
+    return 0.;
+}
+
+/* Records the delay from the root of the intra-cluster route tree to each of the nodes under trace */
+static void load_lb_trace_delays(const t_lb_trace& trace,
+                                 float delay,
+                                 const std::vector<t_lb_type_rr_node>& lb_type_rr_graph,
+                                 std::unordered_map<int, float>& node_delays) {
+    node_delays[trace.current_node] = delay;
+
+    const t_pb_graph_pin* pin = lb_type_rr_graph[trace.current_node].pb_graph_pin;
+    for (const t_lb_trace& next_trace : trace.next_nodes) {
+        //Sources and sinks have no pb_graph_pin, and no delay to (or from) their pin
+        const t_pb_graph_pin* next_pin = lb_type_rr_graph[next_trace.current_node].pb_graph_pin;
+        float edge_delay = (pin && next_pin) ? pb_graph_edge_delay(pin, next_pin) : 0.;
+        load_lb_trace_delays(next_trace, delay + edge_delay, lb_type_rr_graph, node_delays);
+    }
+}
+
+void load_cluster_intra_lb_net_delays(const ClusterBlockId clb_index,
+                                      const std::vector<t_intra_lb_net>& lb_nets,
+                                      const std::vector<t_lb_type_rr_node>& lb_type_rr_graph,
+                                      PreClusterDelayCalculator& clustering_delay_calc,
+                                      std::vector<tatum::EdgeId>& modified_timing_edges) {
+    auto& atom_ctx = g_vpr_ctx.atom();
+    auto& timing_graph = *g_vpr_ctx.timing().graph;
+
+    std::unordered_map<int, float> node_delays;
+    for (const t_intra_lb_net& lb_net : lb_nets) {
+        if (!lb_net.rt_tree) {
+            continue;
+        }
+
+        //Only connections whose driver is in the cluster are routed entirely within it
+        AtomPinId driver_pin = atom_ctx.nlist.net_driver(lb_net.atom_net_id);
+        if (!driver_pin || atom_ctx.lookup.atom_clb(atom_ctx.nlist.pin_block(driver_pin)) != clb_index) {
+            continue;
+        }
+
+        node_delays.clear();
+        load_lb_trace_delays(*lb_net.rt_tree, 0., lb_type_rr_graph, node_delays);
+
+        for (size_t iterm = 1; iterm < lb_net.terminals.size() && iterm < lb_net.atom_pins.size(); iterm++) {
+            AtomPinId sink_pin = lb_net.atom_pins[iterm];
+            if (!sink_pin || atom_ctx.lookup.atom_clb(atom_ctx.nlist.pin_block(sink_pin)) != clb_index) {
+                continue;
+            }
+
+            auto iter = node_delays.find(lb_net.terminals[iterm]);
+            if (iter == node_delays.end()) {
+                continue;
+            }
+
+            clustering_delay_calc.set_intra_cluster_connection_delay(sink_pin, iter->second);
+
+            tatum::NodeId sink_tnode = atom_ctx.lookup.atom_pin_tnode(sink_pin);
+            if (!sink_tnode) {
+                continue;
+            }
+            for (tatum::EdgeId edge : timing_graph.node_in_edges(sink_tnode)) {
+                if (timing_graph.edge_type(edge) == tatum::EdgeType::INTERCONNECT) {
+                    modified_timing_edges.push_back(edge);
+                }
+            }
+        }
+    }
+}
+
+void update_packing_timing(SetupTimingInfo& timing_info, std::vector<tatum::EdgeId>& modified_timing_edges) {
+    for (tatum::EdgeId edge : modified_timing_edges) {
+        timing_info.invalidate_delay(edge);
+    }
+    modified_timing_edges.clear();
+
+    timing_info.update();
 }
 
 //Free the clustering data structures
@@ -245,6 +360,8 @@ void free_clustering_data(const t_packer_opts& packer_opts,
 
     delete[] clustering_data.unclustered_list_head;
     delete[] clustering_data.memory_pool;
+
+    clustering_data.output_writer.reset();
 }
 
 //check the clustering and output it
@@ -252,7 +369,8 @@ void check_and_output_clustering(const t_packer_opts& packer_opts,
                                  const std::unordered_set<AtomNetId>& is_clock,
                                  const t_arch* arch,
                                  const int& num_clb,
-                                 const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing) {
+                                 const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing,
+                                 ClusteringXmlStreamWriter* output_writer) {
     auto& cluster_ctx = g_vpr_ctx.mutable_clustering();
 
     VTR_ASSERT(num_clb == (int)cluster_ctx.clb_nlist.blocks().size());
@@ -262,7 +380,12 @@ void check_and_output_clustering(const t_packer_opts& packer_opts,
         echo_clusters(getEchoFileName(E_ECHO_CLUSTERS));
     }
 
-    output_clustering(intra_lb_routing, packer_opts.global_clocks, is_clock, arch->architecture_id, packer_opts.output_file.c_str(), false);
+    if (output_writer) {
+        //The clusters were already written as they were formed
+        output_writer->finish();
+    } else {
+        output_clustering(intra_lb_routing, packer_opts.global_clocks, is_clock, arch->architecture_id, packer_opts.output_file.c_str(), false);
+    }
 
     VTR_ASSERT(cluster_ctx.clb_nlist.blocks().size() == intra_lb_routing.size());
 }
@@ -420,13 +543,14 @@ void remove_molecule_from_pb_stats_candidates(t_pack_molecule* molecule,
     //Otherwise, shift the molecules while removing the specified molecule
     for (int j = molecule_index; j < pb->pb_stats->num_feasible_blocks - 1; j++) {
         pb->pb_stats->feasible_blocks[j] = pb->pb_stats->feasible_blocks[j + 1];
+        pb->pb_stats->feasible_blocks_gain[j] = pb->pb_stats->feasible_blocks_gain[j + 1];
     }
     pb->pb_stats->num_feasible_blocks--;
 }
 
 /* Add blk to list of feasible blocks sorted according to gain */
 void add_molecule_to_pb_stats_candidates(t_pack_molecule* molecule,
-                                         std::map<AtomBlockId, float>& gain,
+                                         vtr::id_hash_map<AtomBlockId, float>& gain,
                                          t_pb* pb,
                                          int max_queue_size,
                                          AttractionInfo& attraction_groups) {
@@ -453,40 +577,53 @@ void add_molecule_to_pb_stats_candidates(t_pack_molecule* molecule,
         }
     }
 
+    t_pack_molecule** feasible_blocks = pb->pb_stats->feasible_blocks;
+    std::vector<float>& feasible_blocks_gain = pb->pb_stats->feasible_blocks_gain;
+
     for (i = 0; i < pb->pb_stats->num_feasible_blocks; i++) {
-        if (pb->pb_stats->feasible_blocks[i] == molecule) {
+        if (feasible_blocks[i] == molecule) {
             return; // already in queue, do nothing
         }
     }
 
+    /* The gains of the feasible blocks do not change while the list is valid, so they are computed once on
+     * insertion instead of for every comparison */
+    float molecule_gain = get_molecule_gain(molecule, gain, cluster_att_grp, attraction_groups, num_molecule_failures);
+
     if (pb->pb_stats->num_feasible_blocks >= max_queue_size - 1) {
         /* maximum size for array, remove smallest gain element and sort */
-        if (get_molecule_gain(molecule, gain, cluster_att_grp, attraction_groups, num_molecule_failures) > get_molecule_gain(pb->pb_stats->feasible_blocks[0], gain, cluster_att_grp, attraction_groups, num_molecule_failures)) {
+        if (molecule_gain > feasible_blocks_gain[0]) {
             /* single loop insertion sort */
             for (j = 0; j < pb->pb_stats->num_feasible_blocks - 1; j++) {
-                if (get_molecule_gain(molecule, gain, cluster_att_grp, attraction_groups, num_molecule_failures) <= get_molecule_gain(pb->pb_stats->feasible_blocks[j + 1], gain, cluster_att_grp, attraction_groups, num_molecule_failures)) {
-                    pb->pb_stats->feasible_blocks[j] = molecule;
+                if (molecule_gain <= feasible_blocks_gain[j + 1]) {
+                    feasible_blocks[j] = molecule;
+                    feasible_blocks_gain[j] = molecule_gain;
                     break;
                 } else {
-                    pb->pb_stats->feasible_blocks[j] = pb->pb_stats->feasible_blocks[j + 1];
+                    feasible_blocks[j] = feasible_blocks[j + 1];
+                    feasible_blocks_gain[j] = feasible_blocks_gain[j + 1];
                 }
             }
             if (j == pb->pb_stats->num_feasible_blocks - 1) {
-                pb->pb_stats->feasible_blocks[j] = molecule;
+                feasible_blocks[j] = molecule;
+                feasible_blocks_gain[j] = molecule_gain;
             }
         }
     } else {
         /* Expand array and single loop insertion sort */
         for (j = pb->pb_stats->num_feasible_blocks - 1; j >= 0; j--) {
-            if (get_molecule_gain(pb->pb_stats->feasible_blocks[j], gain, cluster_att_grp, attraction_groups, num_molecule_failures) > get_molecule_gain(molecule, gain, cluster_att_grp, attraction_groups, num_molecule_failures)) {
-                pb->pb_stats->feasible_blocks[j + 1] = pb->pb_stats->feasible_blocks[j];
+            if (feasible_blocks_gain[j] > molecule_gain) {
+                feasible_blocks[j + 1] = feasible_blocks[j];
+                feasible_blocks_gain[j + 1] = feasible_blocks_gain[j];
             } else {
-                pb->pb_stats->feasible_blocks[j + 1] = molecule;
+                feasible_blocks[j + 1] = molecule;
+                feasible_blocks_gain[j + 1] = molecule_gain;
                 break;
             }
         }
         if (j < 0) {
-            pb->pb_stats->feasible_blocks[0] = molecule;
+            feasible_blocks[0] = molecule;
+            feasible_blocks_gain[0] = molecule_gain;
         }
         pb->pb_stats->num_feasible_blocks++;
     }
@@ -630,7 +767,7 @@ bool primitive_feasible(const AtomBlockId blk_id, t_pb* cur_pb) {
     }
 
     //Generic feasibility check
-    return primitive_type_feasible(blk_id, cur_pb_type);
+    return cached_primitive_type_feasible(blk_id, cur_pb_type);
 }
 
 bool primitive_memory_sibling_feasible(const AtomBlockId blk_id, const t_pb_type* cur_pb_type, const AtomBlockId sibling_blk_id) {
@@ -814,6 +951,7 @@ void alloc_and_load_pb_stats(t_pb* pb, const int feasible_block_array_size) {
     pb->pb_stats->lookahead_output_pins_used = std::vector<std::vector<AtomNetId>>(pb->pb_graph_node->num_output_pin_class);
     pb->pb_stats->num_feasible_blocks = NOT_VALID;
     pb->pb_stats->feasible_blocks = new t_pack_molecule*[feasible_block_array_size];
+    pb->pb_stats->feasible_blocks_gain.assign(feasible_block_array_size, 0.);
 
     for (int i = 0; i < feasible_block_array_size; i++)
         pb->pb_stats->feasible_blocks[i] = nullptr;
@@ -1346,16 +1484,28 @@ bool atom_cluster_floorplanning_check(AtomBlockId blk_id,
         const PartitionRegion& atom_pr = floorplanning_ctx.constraints.get_partition_pr(partid);
 
         //intersect it with the pr of the current cluster
-        PartitionRegion cluster_pr = floorplanning_ctx.cluster_constraints[clb_index];
+        const PartitionRegion& current_cluster_pr = floorplanning_ctx.cluster_constraints[clb_index];
 
-        if (cluster_pr.empty()) {
+        if (current_cluster_pr.empty()) {
             temp_cluster_pr = atom_pr;
             cluster_pr_needs_update = true;
             VTR_LOGV(verbosity > 3,
                      "\t\t\t Intersect: Atom block %d has floorplanning constraints, passed cluster %d which has empty PR\n",
                      blk_id, clb_index);
             return true;
-        } else {
+        }
+
+        //Most atoms join a cluster of their own partition, whose PR doesn't change by intersecting it again
+        if (current_cluster_pr.get_regions() == atom_pr.get_regions()) {
+            cluster_pr_needs_update = false;
+            VTR_LOGV(verbosity > 3,
+                     "\t\t\t Intersect: Atom block %d passed cluster %d, which has the same PR\n",
+                     blk_id, clb_index);
+            return true;
+        }
+
+        PartitionRegion cluster_pr = current_cluster_pr;
+        {
             //update cluster_pr with the intersection of the cluster's PartitionRegion
             //and the atom's PartitionRegion
             update_cluster_part_reg(cluster_pr, atom_pr);
@@ -1496,6 +1646,7 @@ void update_connection_gain_values(const AtomNetId net_id, const AtomBlockId clu
                 if (cur_pb->pb_stats->connectiongain.count(blk_id) == 0) {
                     cur_pb->pb_stats->connectiongain[blk_id] = 0;
                 }
+                cur_pb->pb_stats->gain_update_blocks.push_back(blk_id);
 
                 if (num_internal_connections > 1) {
                     cur_pb->pb_stats->connectiongain[blk_id] -= 1 / (float)(num_open_connections + 1.5 * num_stuck_connections + 1 + 0.1);
@@ -1516,6 +1667,7 @@ void update_connection_gain_values(const AtomNetId net_id, const AtomBlockId clu
             if (cur_pb->pb_stats->connectiongain.count(blk_id) == 0) {
                 cur_pb->pb_stats->connectiongain[blk_id] = 0;
             }
+            cur_pb->pb_stats->gain_update_blocks.push_back(blk_id);
             if (num_internal_connections > 1) {
                 cur_pb->pb_stats->connectiongain[blk_id] -= 1 / (float)(num_open_connections + 1.5 * num_stuck_connections + 0.1 + 1);
             }
@@ -1769,8 +1921,10 @@ void update_timing_gain_values(const AtomNetId net_id,
                 if (cur_pb->pb_stats->timinggain.count(blk_id) == 0) {
                     cur_pb->pb_stats->timinggain[blk_id] = 0;
                 }
-                if (timinggain > cur_pb->pb_stats->timinggain[blk_id])
+                if (timinggain > cur_pb->pb_stats->timinggain[blk_id]) {
                     cur_pb->pb_stats->timinggain[blk_id] = timinggain;
+                    cur_pb->pb_stats->gain_update_blocks.push_back(blk_id);
+                }
             }
         }
     }
@@ -1789,8 +1943,10 @@ void update_timing_gain_values(const AtomNetId net_id,
                 if (cur_pb->pb_stats->timinggain.count(new_blk_id) == 0) {
                     cur_pb->pb_stats->timinggain[new_blk_id] = 0;
                 }
-                if (timinggain > cur_pb->pb_stats->timinggain[new_blk_id])
+                if (timinggain > cur_pb->pb_stats->timinggain[new_blk_id]) {
                     cur_pb->pb_stats->timinggain[new_blk_id] = timinggain;
+                    cur_pb->pb_stats->gain_update_blocks.push_back(new_blk_id);
+                }
             }
         }
     }
@@ -1864,6 +2020,7 @@ void mark_and_update_partial_gain(const AtomNetId net_id,
                         cur_pb->pb_stats->sharinggain[blk_id]++;
                         cur_pb->pb_stats->hillgain[blk_id]++;
                     }
+                    cur_pb->pb_stats->gain_update_blocks.push_back(blk_id);
                 }
             }
         }
@@ -1900,7 +2057,18 @@ void update_total_gain(float alpha, float beta, bool timing_driven, bool connect
 
     cluster_att_grp_id = cur_pb->pb_stats->attraction_grp_id;
 
-    for (AtomBlockId blk_id : cur_pb->pb_stats->marked_blocks) {
+    /* The total gain only depends on the partial gains, so only the marked blocks whose partial gains
+     * (or total gain) changed since the last update need to be recomputed. Blocks are marked exactly
+     * when they get a sharing gain. */
+    std::vector<AtomBlockId>& gain_update_blocks = cur_pb->pb_stats->gain_update_blocks;
+    std::sort(gain_update_blocks.begin(), gain_update_blocks.end());
+    gain_update_blocks.erase(std::unique(gain_update_blocks.begin(), gain_update_blocks.end()), gain_update_blocks.end());
+
+    for (AtomBlockId blk_id : gain_update_blocks) {
+        if (cur_pb->pb_stats->sharinggain.count(blk_id) == 0) {
+            continue; //Not a marked block
+        }
+
         //Initialize connectiongain and sharinggain if
         //they have not previously been updated for the block
         if (cur_pb->pb_stats->connectiongain.count(blk_id) == 0) {
@@ -1944,6 +2112,7 @@ void update_total_gain(float alpha, float beta, bool timing_driven, bool connect
                                              + (1.0 - alpha) * (float)cur_pb->pb_stats->gain[blk_id];
         }
     }
+    gain_update_blocks.clear();
 }
 
 /*****************************************/
@@ -2229,7 +2398,10 @@ void start_new_cluster(t_cluster_placement_stats* cluster_placement_stats,
         num_instances += device_ctx.grid.num_instances(equivalent_tile, -1);
     }
 
-    if (num_used_type_instances[block_type] > num_instances) {
+    //(A grid which is already the requested fixed size layout, e.g. built while packing by
+    //--pipeline_device_creation, would be rebuilt identically, so it is kept)
+    if (num_used_type_instances[block_type] > num_instances
+        && (device_layout_name == "auto" || device_ctx.grid.name() != device_layout_name)) {
         device_ctx.grid = create_device_grid(device_layout_name, arch->grid_layouts, num_used_type_instances, target_device_utilization);
     }
 }
@@ -2466,14 +2638,11 @@ void add_cluster_molecule_candidates_by_attraction_group(t_pb* cur_pb,
         return;
     }
 
-    int min = 0;
-    int max = num_available_atoms - 1;
+    //Each pull of a group draws from its own stream, so the packing is reproducible
+    vtr::RandomStream rand_stream(ATTRACTION_GROUP_PULL_SEED, (uint64_t(size_t(grp_id)) << 32) | cur_pb->pb_stats->pulled_from_atom_groups);
 
     for (int j = 0; j < 500; j++) {
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_int_distribution<> distr(min, max);
-        int selected_atom = distr(gen);
+        int selected_atom = rand_stream.irand(num_available_atoms - 1);
 
         //AtomBlockId blk_id = group.group_atoms[selected_atom];
         AtomBlockId blk_id = available_atoms[selected_atom];
@@ -2730,7 +2899,7 @@ std::vector<AtomBlockId> initialize_seed_atoms(const e_cluster_seed seed_type,
 
     } else if (seed_type == e_cluster_seed::MAX_INPUTS) {
         //By number of used molecule input pins
-        for (auto blk : atom_ctx.nlist.blocks()) {
+        parallel_for_each_atom_block([&](AtomBlockId blk) {
             int max_molecule_inputs = 0;
             auto molecule_rng = atom_ctx.atom_molecules.equal_range(blk);
             for (const auto& kv : vtr::make_range(molecule_rng.first, molecule_rng.second)) {
@@ -2743,11 +2912,11 @@ std::vector<AtomBlockId> initialize_seed_atoms(const e_cluster_seed seed_type,
             }
 
             atom_gains[blk] = max_molecule_inputs;
-        }
+        });
 
     } else if (seed_type == e_cluster_seed::BLEND) {
         //By blended gain (criticality and inputs used)
-        for (auto blk : atom_ctx.nlist.blocks()) {
+        parallel_for_each_atom_block([&](AtomBlockId blk) {
             /* Score seed gain of each block as a weighted sum of timing criticality,
              * number of tightly coupled blocks connected to it, and number of external inputs */
             float seed_blend_fac = 0.5;
@@ -2769,12 +2938,12 @@ std::vector<AtomBlockId> initialize_seed_atoms(const e_cluster_seed seed_type,
                 max_blend_gain = std::max(max_blend_gain, blend_gain);
             }
             atom_gains[blk] = max_blend_gain;
-        }
+        });
 
     } else if (seed_type == e_cluster_seed::MAX_PINS || seed_type == e_cluster_seed::MAX_INPUT_PINS) {
         //By pins per molecule (i.e. available pins on primitives, not pins in use)
 
-        for (auto blk : atom_ctx.nlist.blocks()) {
+        parallel_for_each_atom_block([&](AtomBlockId blk) {
             int max_molecule_pins = 0;
             auto molecule_rng = atom_ctx.atom_molecules.equal_range(blk);
             for (const auto& kv : vtr::make_range(molecule_rng.first, molecule_rng.second)) {
@@ -2797,10 +2966,10 @@ std::vector<AtomBlockId> initialize_seed_atoms(const e_cluster_seed seed_type,
                 max_molecule_pins = std::max(max_molecule_pins, molecule_pins);
             }
             atom_gains[blk] = max_molecule_pins;
-        }
+        });
 
     } else if (seed_type == e_cluster_seed::BLEND2) {
-        for (auto blk : atom_ctx.nlist.blocks()) {
+        parallel_for_each_atom_block([&](AtomBlockId blk) {
             float max_gain = 0;
             auto molecule_rng = atom_ctx.atom_molecules.equal_range(blk);
             for (const auto& kv : vtr::make_range(molecule_rng.first, molecule_rng.second)) {
@@ -2841,7 +3010,7 @@ std::vector<AtomBlockId> initialize_seed_atoms(const e_cluster_seed seed_type,
             }
 
             atom_gains[blk] = max_gain;
-        }
+        });
 
     } else {
         VPR_FATAL_ERROR(VPR_ERROR_PACK, "Unrecognized cluster seed type");
@@ -2903,7 +3072,7 @@ t_pack_molecule* get_highest_gain_seed_molecule(int& seed_index, const std::vect
  * + molecule_base_gain*some_factor
  * - introduced_input_nets_of_unrelated_blocks_pulled_in_by_molecule*some_other_factor
  */
-float get_molecule_gain(t_pack_molecule* molecule, std::map<AtomBlockId, float>& blk_gain, AttractGroupId cluster_attraction_group_id, AttractionInfo& attraction_groups, int num_molecule_failures) {
+float get_molecule_gain(t_pack_molecule* molecule, vtr::id_hash_map<AtomBlockId, float>& blk_gain, AttractGroupId cluster_attraction_group_id, AttractionInfo& attraction_groups, int num_molecule_failures) {
     float gain;
     int i;
     int num_introduced_inputs_of_indirectly_related_block;
@@ -3367,6 +3536,7 @@ void load_transitive_fanout_candidates(ClusterBlockId clb_index,
                                 } else {
                                     pb_stats->gain[blk_id] += 0.001;
                                 }
+                                pb_stats->gain_update_blocks.push_back(blk_id);
                                 auto rng = atom_ctx.atom_molecules.equal_range(blk_id);
                                 for (const auto& kv : vtr::make_range(rng.first, rng.second)) {
                                     t_pack_molecule* molecule = kv.second;
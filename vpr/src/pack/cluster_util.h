@@ -14,6 +14,8 @@
 #include "tatum/echo_writer.hpp"
 #include "tatum/TimingReporter.hpp"
 
+#include "output_clustering.h"
+
 /**
  * @file
  * @brief This file includes useful structs and functions for building and modifying clustering
@@ -102,6 +104,9 @@ struct t_clustering_data {
      * twice is when one connection is an output and the other is an input, *
      * so this should take care of all multiple connections.                */
     std::unordered_map<AtomNetId, int> net_output_feeds_driving_block_input;
+
+    /* Writes each cluster to the packed netlist file as it is formed (only with --pack_stream_output on) */
+    std::unique_ptr<ClusteringXmlStreamWriter> output_writer;
 };
 
 /***********************************/
@@ -118,16 +123,28 @@ void calc_init_packing_timing(const t_packer_opts& packer_opts,
                               std::shared_ptr<SetupTimingInfo>& timing_info,
                               vtr::vector<AtomBlockId, float>& atom_criticality);
 
+//record the intra-cluster delays of the connections routed within the (legal) cluster clb_index,
+//and append the timing edges of these connections to modified_timing_edges
+void load_cluster_intra_lb_net_delays(const ClusterBlockId clb_index,
+                                      const std::vector<t_intra_lb_net>& lb_nets,
+                                      const std::vector<t_lb_type_rr_node>& lb_type_rr_graph,
+                                      PreClusterDelayCalculator& clustering_delay_calc,
+                                      std::vector<tatum::EdgeId>& modified_timing_edges);
+
+//incrementally update the packing timing analysis after the delays of modified_timing_edges changed
+void update_packing_timing(SetupTimingInfo& timing_info, std::vector<tatum::EdgeId>& modified_timing_edges);
+
 //free the clustering data structures
 void free_clustering_data(const t_packer_opts& packer_opts,
                           t_clustering_data& clustering_data);
 
-//check clustering legality and output it
+//check clustering legality and output it (output_writer, if not null, has already written the clusters and is finished)
 void check_and_output_clustering(const t_packer_opts& packer_opts,
                                  const std::unordered_set<AtomNetId>& is_clock,
                                  const t_arch* arch,
                                  const int& num_clb,
-                                 const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing);
+                                 const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing,
+                                 ClusteringXmlStreamWriter* output_writer);
 
 void get_max_cluster_size_and_pb_depth(int& max_cluster_size,
                                        int& max_pb_depth);
@@ -139,7 +156,7 @@ bool check_cluster_legality(const int& verbosity,
 bool is_atom_blk_in_pb(const AtomBlockId blk_id, const t_pb* pb);
 
 void add_molecule_to_pb_stats_candidates(t_pack_molecule* molecule,
-                                         std::map<AtomBlockId, float>& gain,
+                                         vtr::id_hash_map<AtomBlockId, float>& gain,
                                          t_pb* pb,
                                          int max_queue_size,
                                          AttractionInfo& attraction_groups);
@@ -451,7 +468,7 @@ std::vector<AtomBlockId> initialize_seed_atoms(const e_cluster_seed seed_type,
 
 t_pack_molecule* get_highest_gain_seed_molecule(int& seed_index, const std::vector<AtomBlockId>& seed_atoms);
 
-float get_molecule_gain(t_pack_molecule* molecule, std::map<AtomBlockId, float>& blk_gain, AttractGroupId cluster_attraction_group_id, AttractionInfo& attraction_groups, int num_molecule_failures);
+float get_molecule_gain(t_pack_molecule* molecule, vtr::id_hash_map<AtomBlockId, float>& blk_gain, AttractGroupId cluster_attraction_group_id, AttractionInfo& attraction_groups, int num_molecule_failures);
 
 int compare_molecule_gain(const void* a, const void* b);
 int net_sinks_reachable_in_cluster(const t_pb_graph_pin* driver_pb_gpin, const int depth, const AtomNetId net_id);
@@ -18,6 +18,7 @@
  * Date: July 22, 2013
  */
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <vector>
@@ -27,12 +28,28 @@
 #include "vtr_memory.h"
 
 #include "vtr_util.h"
+#include "vtr_log.h"
 #include "physical_types.h"
 #include "vpr_types.h"
+#include "vpr_error.h"
 #include "globals.h"
 #include "pack_types.h"
 #include "lb_type_rr_graph.h"
 
+#ifdef VTR_ENABLE_CAPNPROTO
+#    include "capnp/serialize.h"
+#    include "lb_type_rr_graph.capnp.h"
+#    include "mmap_file.h"
+#    include "serdes_utils.h"
+#else
+#    define DISABLE_ERROR                               \
+        "is disabled because VTR_ENABLE_CAPNPROTO=OFF." \
+        "Re-compile with CMake option VTR_ENABLE_CAPNPROTO=ON to enable."
+#endif /* VTR_ENABLE_CAPNPROTO */
+
+/* Bump whenever the lb_type_rr_graphs are built differently, so stale caches are rebuilt */
+static constexpr unsigned LB_TYPE_RR_GRAPH_CACHE_VERSION = 1;
+
 /*****************************************************************************************
  * Internal functions declarations
  ******************************************************************************************/
@@ -43,6 +60,9 @@ static void alloc_and_load_lb_type_rr_graph_for_pb_graph_node(const t_pb_graph_n
                                                               const int ext_rr_index);
 static float get_cost_of_pb_edge(t_pb_graph_edge* edge);
 static void print_lb_type_rr_graph(FILE* fp, const std::vector<t_lb_type_rr_node>& lb_type_rr_graph);
+#ifdef VTR_ENABLE_CAPNPROTO
+static void load_pb_graph_pins_by_cluster_index(t_pb_graph_node* pb_graph_node, std::vector<t_pb_graph_pin*>& pins);
+#endif
 
 /*****************************************************************************************
  * Constructor/Destructor functions
@@ -69,6 +89,30 @@ std::vector<t_lb_type_rr_node>* alloc_and_load_all_lb_type_rr_graph() {
     return lb_type_rr_graphs;
 }
 
+/* Returns the lb_type_rr_graphs of the architecture identified by architecture_id, loading them from
+ * cache_file if it holds the graphs of that architecture. Otherwise they are built and written to cache_file
+ * (if it is not empty) for later runs. Nothing is cached for architectures without an id.
+ */
+std::vector<t_lb_type_rr_node>* alloc_and_load_all_lb_type_rr_graph(const std::string& cache_file, const char* architecture_id) {
+    if (cache_file.empty() || architecture_id == nullptr) {
+        return alloc_and_load_all_lb_type_rr_graph();
+    }
+
+    std::vector<t_lb_type_rr_node>* lb_type_rr_graphs = nullptr;
+    if (vtr::file_exists(cache_file.c_str())) {
+        lb_type_rr_graphs = read_lb_type_rr_graphs(cache_file, architecture_id);
+        if (lb_type_rr_graphs) {
+            VTR_LOG("Loaded intra-cluster routing graphs from '%s'\n", cache_file.c_str());
+            return lb_type_rr_graphs;
+        }
+        VTR_LOG("Intra-cluster routing graph cache '%s' does not match the architecture, rebuilding it\n", cache_file.c_str());
+    }
+
+    lb_type_rr_graphs = alloc_and_load_all_lb_type_rr_graph();
+    write_lb_type_rr_graphs(cache_file, lb_type_rr_graphs, architecture_id);
+    return lb_type_rr_graphs;
+}
+
 /* Free routing resource graph for all logic block types */
 void free_all_lb_type_rr_graph(std::vector<t_lb_type_rr_node>* lb_type_rr_graphs) {
     if (lb_type_rr_graphs == nullptr) {
@@ -126,6 +170,156 @@ int get_lb_type_rr_graph_edge_mode(std::vector<t_lb_type_rr_node>& lb_type_rr_gr
     return -1;
 }
 
+/*****************************************************************************************
+ * Serialization functions
+ ******************************************************************************************/
+
+#ifndef VTR_ENABLE_CAPNPROTO
+
+void write_lb_type_rr_graphs(const std::string& /*file*/, const std::vector<t_lb_type_rr_node>* /*lb_type_rr_graphs*/, const char* /*architecture_id*/) {
+    VPR_THROW(VPR_ERROR_PACK, "write_lb_type_rr_graphs " DISABLE_ERROR);
+}
+
+std::vector<t_lb_type_rr_node>* read_lb_type_rr_graphs(const std::string& /*file*/, const char* /*architecture_id*/) {
+    VPR_THROW(VPR_ERROR_PACK, "read_lb_type_rr_graphs " DISABLE_ERROR);
+}
+
+#else /* VTR_ENABLE_CAPNPROTO */
+
+/* Write the lb_type_rr_graphs of all the logical block types, built for the architecture identified by architecture_id */
+void write_lb_type_rr_graphs(const std::string& file, const std::vector<t_lb_type_rr_node>* lb_type_rr_graphs, const char* architecture_id) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    ::capnp::MallocMessageBuilder builder;
+    auto cache = builder.initRoot<VprLbTypeRrGraphs>();
+    cache.setVersion(LB_TYPE_RR_GRAPH_CACHE_VERSION);
+    cache.setArchitectureId(architecture_id);
+
+    auto graphs = cache.initGraphs(device_ctx.logical_block_types.size());
+    for (const auto& type : device_ctx.logical_block_types) {
+        auto graph = graphs[type.index];
+        graph.setTypeName(type.name);
+
+        const auto& lb_type_rr_graph = lb_type_rr_graphs[type.index];
+        auto nodes = graph.initNodes(lb_type_rr_graph.size());
+        for (size_t inode = 0; inode < lb_type_rr_graph.size(); inode++) {
+            const t_lb_type_rr_node& src = lb_type_rr_graph[inode];
+            auto node = nodes[inode];
+            node.setCapacity(src.capacity);
+            node.setNumModes(src.num_modes);
+            node.setType(src.type);
+            node.setIntrinsicCost(src.intrinsic_cost);
+            node.setPbGraphPin(src.pb_graph_pin ? src.pb_graph_pin->pin_count_in_cluster : -1);
+
+            //Sinks have a fanout allocated even though they have no modes
+            if (src.num_fanout) {
+                auto num_fanout = node.initNumFanout(std::max(src.num_modes, 1));
+                for (unsigned imode = 0; imode < num_fanout.size(); imode++) {
+                    num_fanout.set(imode, src.num_fanout[imode]);
+                }
+            }
+
+            if (src.outedges) {
+                auto outedges = node.initOutedges(src.num_modes);
+                for (int imode = 0; imode < src.num_modes; imode++) {
+                    int num_edges = src.outedges[imode] ? src.num_fanout[imode] : 0;
+                    auto edges = outedges.init(imode, num_edges);
+                    for (int iedge = 0; iedge < num_edges; iedge++) {
+                        edges[iedge].setNodeIndex(src.outedges[imode][iedge].node_index);
+                        edges[iedge].setIntrinsicCost(src.outedges[imode][iedge].intrinsic_cost);
+                    }
+                }
+            }
+        }
+    }
+
+    writeMessageToFile(file, &builder);
+}
+
+/* Read the lb_type_rr_graphs of all the logical block types from file. Returns nullptr if they
+ * were not built for the architecture identified by architecture_id (or by another version of VPR).
+ */
+std::vector<t_lb_type_rr_node>* read_lb_type_rr_graphs(const std::string& file, const char* architecture_id) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    MmapFile f(file);
+    ::capnp::ReaderOptions opts = default_large_capnp_opts();
+    ::capnp::FlatArrayMessageReader reader(f.getData(), opts);
+
+    auto cache = reader.getRoot<VprLbTypeRrGraphs>();
+    auto graphs = cache.getGraphs();
+    if (cache.getVersion() != LB_TYPE_RR_GRAPH_CACHE_VERSION
+        || cache.getArchitectureId() != architecture_id
+        || graphs.size() != device_ctx.logical_block_types.size()) {
+        return nullptr;
+    }
+    for (const auto& type : device_ctx.logical_block_types) {
+        if (graphs[type.index].getTypeName() != type.name) {
+            return nullptr;
+        }
+    }
+
+    std::vector<t_lb_type_rr_node>* lb_type_rr_graphs = new std::vector<t_lb_type_rr_node>[device_ctx.logical_block_types.size()];
+
+    for (const auto& type : device_ctx.logical_block_types) {
+        auto nodes = graphs[type.index].getNodes();
+
+        //The pb_graph_pins of the nodes are stored by their pin number within the cluster
+        std::vector<t_pb_graph_pin*> pb_graph_pins;
+        if (type.pb_graph_head) {
+            pb_graph_pins.resize(type.pb_graph_head->total_pb_pins, nullptr);
+            load_pb_graph_pins_by_cluster_index(type.pb_graph_head, pb_graph_pins);
+        }
+
+        auto& lb_type_rr_graph = lb_type_rr_graphs[type.index];
+        lb_type_rr_graph.resize(nodes.size());
+        for (size_t inode = 0; inode < nodes.size(); inode++) {
+            auto node = nodes[inode];
+            t_lb_type_rr_node& dst = lb_type_rr_graph[inode];
+            dst.capacity = node.getCapacity();
+            dst.num_modes = node.getNumModes();
+            dst.type = static_cast<e_lb_rr_type>(node.getType());
+            dst.intrinsic_cost = node.getIntrinsicCost();
+
+            int pin_index = node.getPbGraphPin();
+            if (pin_index != OPEN) {
+                if (pin_index < 0 || pin_index >= (int)pb_graph_pins.size() || !pb_graph_pins[pin_index]) {
+                    free_all_lb_type_rr_graph(lb_type_rr_graphs);
+                    VPR_FATAL_ERROR(VPR_ERROR_PACK, "Intra-cluster routing graph cache '%s' refers to pin %d, which does not exist in block type '%s'\n",
+                                    file.c_str(), pin_index, type.name);
+                }
+                dst.pb_graph_pin = pb_graph_pins[pin_index];
+            }
+
+            if (node.hasNumFanout()) {
+                auto num_fanout = node.getNumFanout();
+                dst.num_fanout = new short[num_fanout.size()];
+                for (unsigned imode = 0; imode < num_fanout.size(); imode++) {
+                    dst.num_fanout[imode] = num_fanout[imode];
+                }
+            }
+
+            if (node.hasOutedges()) {
+                auto outedges = node.getOutedges();
+                VTR_ASSERT((int)outedges.size() == dst.num_modes);
+                dst.outedges = new t_lb_type_rr_node_edge*[dst.num_modes];
+                for (int imode = 0; imode < dst.num_modes; imode++) {
+                    auto edges = outedges[imode];
+                    dst.outedges[imode] = new t_lb_type_rr_node_edge[edges.size()];
+                    for (unsigned iedge = 0; iedge < edges.size(); iedge++) {
+                        dst.outedges[imode][iedge].node_index = edges[iedge].getNodeIndex();
+                        dst.outedges[imode][iedge].intrinsic_cost = edges[iedge].getIntrinsicCost();
+                    }
+                }
+            }
+        }
+    }
+
+    return lb_type_rr_graphs;
+}
+
+#endif /* VTR_ENABLE_CAPNPROTO */
+
 /*****************************************************************************************
  * Debug functions
  ******************************************************************************************/
@@ -672,3 +866,29 @@ static void print_lb_type_rr_graph(FILE* fp, const std::vector<t_lb_type_rr_node
         fprintf(fp, "\n");
     }
 }
+
+#ifdef VTR_ENABLE_CAPNPROTO
+/* Record the pins of pb_graph_node and its descendants by their pin number within the cluster */
+static void load_pb_graph_pins_by_cluster_index(t_pb_graph_node* pb_graph_node, std::vector<t_pb_graph_pin*>& pins) {
+    auto load_pins = [&](t_pb_graph_pin** port_pins, int num_ports, int* num_pins) {
+        for (int iport = 0; iport < num_ports; iport++) {
+            for (int ipin = 0; ipin < num_pins[iport]; ipin++) {
+                t_pb_graph_pin* pin = &port_pins[iport][ipin];
+                VTR_ASSERT(pin->pin_count_in_cluster >= 0 && pin->pin_count_in_cluster < (int)pins.size());
+                pins[pin->pin_count_in_cluster] = pin;
+            }
+        }
+    };
+    load_pins(pb_graph_node->input_pins, pb_graph_node->num_input_ports, pb_graph_node->num_input_pins);
+    load_pins(pb_graph_node->output_pins, pb_graph_node->num_output_ports, pb_graph_node->num_output_pins);
+    load_pins(pb_graph_node->clock_pins, pb_graph_node->num_clock_ports, pb_graph_node->num_clock_pins);
+
+    for (int imode = 0; imode < pb_graph_node->pb_type->num_modes; imode++) {
+        for (int ichild = 0; ichild < pb_graph_node->pb_type->modes[imode].num_pb_type_children; ichild++) {
+            for (int inst = 0; inst < pb_graph_node->pb_type->modes[imode].pb_type_children[ichild].num_pb; inst++) {
+                load_pb_graph_pins_by_cluster_index(&pb_graph_node->child_pb_graph_nodes[imode][ichild][inst], pins);
+            }
+        }
+    }
+}
+#endif
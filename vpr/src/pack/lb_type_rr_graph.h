@@ -8,10 +8,13 @@
 #ifndef LB_TYPE_RR_GRAPH_H
 #define LB_TYPE_RR_GRAPH_H
 
+#include <string>
+
 #include "pack_types.h"
 
 /* Constructors/Destructors */
 std::vector<t_lb_type_rr_node>* alloc_and_load_all_lb_type_rr_graph();
+std::vector<t_lb_type_rr_node>* alloc_and_load_all_lb_type_rr_graph(const std::string& cache_file, const char* architecture_id);
 void free_all_lb_type_rr_graph(std::vector<t_lb_type_rr_node>* lb_type_rr_graphs);
 
 /* Accessor functions */
@@ -19,6 +22,10 @@ int get_lb_type_rr_graph_ext_source_index(t_logical_block_type_ptr lb_type);
 int get_lb_type_rr_graph_ext_sink_index(t_logical_block_type_ptr lb_type);
 int get_lb_type_rr_graph_edge_mode(std::vector<t_lb_type_rr_node>& lb_type_rr_graph, int src_index, int dst_index);
 
+/* Serialization (Cap'n Proto) */
+void write_lb_type_rr_graphs(const std::string& file, const std::vector<t_lb_type_rr_node>* lb_type_rr_graphs, const char* architecture_id);
+std::vector<t_lb_type_rr_node>* read_lb_type_rr_graphs(const std::string& file, const char* architecture_id);
+
 /* Debug functions */
 void echo_lb_type_rr_graphs(char* filename, std::vector<t_lb_type_rr_node>* lb_type_rr_graphs);
 
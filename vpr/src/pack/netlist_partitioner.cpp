@@ -0,0 +1,306 @@
+#include <algorithm>
+
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+#include "globals.h"
+#include "atom_netlist.h"
+#include "netlist_partitioner.h"
+
+/* Nets with more pins than this are ignored: they say little about which atoms belong together,
+ * and rating them would dominate the run time */
+static constexpr size_t PARTITION_MAX_NET_PINS = 64;
+
+/* Coarsening stops once a level removes less than this fraction of the vertices */
+static constexpr float PARTITION_MIN_LEVEL_REDUCTION = 0.05;
+
+/* Upper bound on the number of coarsening levels */
+static constexpr int PARTITION_MAX_LEVELS = 32;
+
+/* Number of atom level refinement passes */
+static constexpr int PARTITION_REFINEMENT_PASSES = 2;
+
+/* One level of the multilevel hierarchy */
+struct t_partition_hypergraph {
+    std::vector<int> vertex_weights;           ///<[0..num_vertices-1] number of atoms represented by each vertex
+    std::vector<std::vector<int>> vertex_nets; ///<[0..num_vertices-1] nets connected to each vertex
+    std::vector<std::vector<int>> net_pins;    ///<[0..num_nets-1] vertices connected by each net (sorted, no duplicates)
+};
+
+static t_partition_hypergraph build_atom_hypergraph();
+static void load_vertex_nets(t_partition_hypergraph& graph);
+static int cluster_vertices(const t_partition_hypergraph& graph, int max_weight, std::vector<int>& vertex_cluster);
+static t_partition_hypergraph contract_hypergraph(const t_partition_hypergraph& graph, const std::vector<int>& vertex_cluster, int num_clusters);
+static void refine_atom_parts(const t_partition_hypergraph& atom_graph, int max_weight, int num_parts, std::vector<int>& atom_part);
+
+std::vector<std::vector<AtomBlockId>> partition_atom_netlist(int target_part_size) {
+    vtr::ScopedStartFinishTimer timer("Partition atom netlist");
+    VTR_ASSERT(target_part_size > 0);
+
+    const t_partition_hypergraph atom_graph = build_atom_hypergraph();
+    const size_t num_atoms = atom_graph.vertex_weights.size();
+
+    //Coarsen, keeping track of the coarsest vertex each atom belongs to
+    std::vector<int> atom_part(num_atoms);
+    for (size_t iatom = 0; iatom < num_atoms; iatom++) {
+        atom_part[iatom] = iatom;
+    }
+
+    t_partition_hypergraph graph = atom_graph;
+    std::vector<int> vertex_cluster;
+    int num_parts = num_atoms;
+    for (int ilevel = 0; ilevel < PARTITION_MAX_LEVELS; ilevel++) {
+        size_t num_vertices = graph.vertex_weights.size();
+        int num_clusters = cluster_vertices(graph, target_part_size, vertex_cluster);
+        if (num_clusters == (int)num_vertices) {
+            break;
+        }
+
+        for (int& part : atom_part) {
+            part = vertex_cluster[part];
+        }
+        num_parts = num_clusters;
+
+        if (num_clusters > (1. - PARTITION_MIN_LEVEL_REDUCTION) * num_vertices) {
+            break;
+        }
+        graph = contract_hypergraph(graph, vertex_cluster, num_clusters);
+    }
+
+    refine_atom_parts(atom_graph, target_part_size, num_parts, atom_part);
+
+    std::vector<std::vector<AtomBlockId>> part_atoms(num_parts);
+    for (size_t iatom = 0; iatom < num_atoms; iatom++) {
+        part_atoms[atom_part[iatom]].push_back(AtomBlockId(iatom));
+    }
+
+    std::vector<std::vector<AtomBlockId>> parts;
+    size_t num_part_atoms = 0;
+    for (auto& atoms : part_atoms) {
+        if (atoms.size() > 1) {
+            num_part_atoms += atoms.size();
+            parts.push_back(std::move(atoms));
+        }
+    }
+
+    VTR_LOG("Partitioned %zu of %zu atoms into %zu parts (target part size %d)\n",
+            num_part_atoms, num_atoms, parts.size(), target_part_size);
+
+    return parts;
+}
+
+/* Build the hypergraph of the atom netlist, with one vertex per atom block (indexed by its id) */
+static t_partition_hypergraph build_atom_hypergraph() {
+    const AtomNetlist& atom_nlist = g_vpr_ctx.atom().nlist;
+
+    t_partition_hypergraph graph;
+    graph.vertex_weights.assign(atom_nlist.blocks().size(), 1);
+
+    std::vector<int> pins;
+    for (AtomNetId net_id : atom_nlist.nets()) {
+        if (atom_nlist.net_is_constant(net_id) || atom_nlist.net_pins(net_id).size() > PARTITION_MAX_NET_PINS) {
+            continue;
+        }
+
+        pins.clear();
+        for (AtomPinId pin_id : atom_nlist.net_pins(net_id)) {
+            AtomBlockId blk_id = atom_nlist.pin_block(pin_id);
+            //Primary I/Os are packed into their own cluster types, so they do not join any part
+            if (atom_nlist.block_type(blk_id) == AtomBlockType::BLOCK) {
+                pins.push_back(size_t(blk_id));
+            }
+        }
+        std::sort(pins.begin(), pins.end());
+        pins.erase(std::unique(pins.begin(), pins.end()), pins.end());
+
+        if (pins.size() > 1) {
+            graph.net_pins.push_back(pins);
+        }
+    }
+
+    load_vertex_nets(graph);
+    return graph;
+}
+
+static void load_vertex_nets(t_partition_hypergraph& graph) {
+    graph.vertex_nets.assign(graph.vertex_weights.size(), std::vector<int>());
+    for (size_t inet = 0; inet < graph.net_pins.size(); inet++) {
+        for (int vertex : graph.net_pins[inet]) {
+            graph.vertex_nets[vertex].push_back(inet);
+        }
+    }
+}
+
+/*
+ * Cluster the vertices of graph using the heavy-edge rating: a vertex which has not been clustered yet
+ * joins the neighbouring cluster C maximizing
+ *
+ *      sum_{nets e connecting the vertex and C} (1 / (|e| - 1)) / (weight(vertex) * weight(C))
+ *
+ * provided the merged cluster does not weigh more than max_weight. Vertices are visited in index order and
+ * ties go to the lowest cluster, so the result is deterministic.
+ *
+ * Returns the number of clusters, and fills vertex_cluster with the (consecutively numbered) cluster of each vertex.
+ */
+static int cluster_vertices(const t_partition_hypergraph& graph, int max_weight, std::vector<int>& vertex_cluster) {
+    const size_t num_vertices = graph.vertex_weights.size();
+
+    //Clusters are identified by their first vertex until they are renumbered at the end
+    std::vector<int> cluster(num_vertices);
+    std::vector<int> cluster_weight(graph.vertex_weights);
+    std::vector<int> cluster_size(num_vertices, 1);
+    for (size_t vertex = 0; vertex < num_vertices; vertex++) {
+        cluster[vertex] = vertex;
+    }
+
+    std::vector<float> rating(num_vertices, 0.);
+    std::vector<int> rated_clusters;
+    for (size_t vertex = 0; vertex < num_vertices; vertex++) {
+        if (cluster_size[cluster[vertex]] > 1) {
+            continue; //Already clustered
+        }
+
+        for (int inet : graph.vertex_nets[vertex]) {
+            const std::vector<int>& pins = graph.net_pins[inet];
+            float net_rating = 1. / (pins.size() - 1);
+            for (int other : pins) {
+                if (other == (int)vertex) {
+                    continue;
+                }
+                int other_cluster = cluster[other];
+                if (rating[other_cluster] == 0.) {
+                    rated_clusters.push_back(other_cluster);
+                }
+                rating[other_cluster] += net_rating;
+            }
+        }
+
+        int vertex_weight = graph.vertex_weights[vertex];
+        int best_cluster = -1;
+        float best_score = 0.;
+        for (int rated_cluster : rated_clusters) {
+            if (cluster_weight[rated_cluster] + vertex_weight <= max_weight) {
+                float score = rating[rated_cluster] / (vertex_weight * cluster_weight[rated_cluster]);
+                if (score > best_score || (score == best_score && rated_cluster < best_cluster)) {
+                    best_score = score;
+                    best_cluster = rated_cluster;
+                }
+            }
+            rating[rated_cluster] = 0.;
+        }
+        rated_clusters.clear();
+
+        if (best_cluster >= 0) {
+            cluster_size[cluster[vertex]] = 0;
+            cluster[vertex] = best_cluster;
+            cluster_weight[best_cluster] += vertex_weight;
+            cluster_size[best_cluster]++;
+        }
+    }
+
+    //Number the clusters consecutively, in order of their first vertex
+    std::vector<int> cluster_index(num_vertices, -1);
+    int num_clusters = 0;
+    vertex_cluster.resize(num_vertices);
+    for (size_t vertex = 0; vertex < num_vertices; vertex++) {
+        int& index = cluster_index[cluster[vertex]];
+        if (index < 0) {
+            index = num_clusters++;
+        }
+        vertex_cluster[vertex] = index;
+    }
+    return num_clusters;
+}
+
+/* Build the next coarser level, with one vertex per cluster. Nets left with a single vertex are removed;
+ * parallel nets are kept, which is equivalent to merging them into one heavier net for the rating. */
+static t_partition_hypergraph contract_hypergraph(const t_partition_hypergraph& graph, const std::vector<int>& vertex_cluster, int num_clusters) {
+    t_partition_hypergraph coarse;
+    coarse.vertex_weights.assign(num_clusters, 0);
+    for (size_t vertex = 0; vertex < graph.vertex_weights.size(); vertex++) {
+        coarse.vertex_weights[vertex_cluster[vertex]] += graph.vertex_weights[vertex];
+    }
+
+    std::vector<int> pins;
+    for (const std::vector<int>& net_pins : graph.net_pins) {
+        pins.clear();
+        for (int vertex : net_pins) {
+            pins.push_back(vertex_cluster[vertex]);
+        }
+        std::sort(pins.begin(), pins.end());
+        pins.erase(std::unique(pins.begin(), pins.end()), pins.end());
+
+        if (pins.size() > 1) {
+            coarse.net_pins.push_back(pins);
+        }
+    }
+
+    load_vertex_nets(coarse);
+    return coarse;
+}
+
+/* Move each atom to the part it is most strongly connected to (using the rating of cluster_vertices()
+ * without the weight normalization), as long as that part has room for it */
+static void refine_atom_parts(const t_partition_hypergraph& atom_graph, int max_weight, int num_parts, std::vector<int>& atom_part) {
+    std::vector<int> part_weight(num_parts, 0);
+    for (int part : atom_part) {
+        part_weight[part]++;
+    }
+
+    std::vector<float> connectivity(num_parts, 0.);
+    std::vector<int> connected_parts;
+    size_t num_moves = 0;
+    for (int ipass = 0; ipass < PARTITION_REFINEMENT_PASSES; ipass++) {
+        size_t num_pass_moves = 0;
+        for (size_t atom = 0; atom < atom_part.size(); atom++) {
+            int cur_part = atom_part[atom];
+            if (part_weight[cur_part] == 1) {
+                continue; //Not in a part, leave it to the packer
+            }
+
+            for (int inet : atom_graph.vertex_nets[atom]) {
+                const std::vector<int>& pins = atom_graph.net_pins[inet];
+                float net_rating = 1. / (pins.size() - 1);
+                for (int other : pins) {
+                    if (other == (int)atom) {
+                        continue;
+                    }
+                    int other_part = atom_part[other];
+                    if (connectivity[other_part] == 0.) {
+                        connected_parts.push_back(other_part);
+                    }
+                    connectivity[other_part] += net_rating;
+                }
+            }
+
+            int best_part = cur_part;
+            float best_connectivity = connectivity[cur_part];
+            for (int part : connected_parts) {
+                if (part != cur_part && part_weight[part] + 1 <= max_weight && part_weight[part] > 1
+                    && (connectivity[part] > best_connectivity || (connectivity[part] == best_connectivity && best_part != cur_part && part < best_part))) {
+                    best_connectivity = connectivity[part];
+                    best_part = part;
+                }
+            }
+            for (int part : connected_parts) {
+                connectivity[part] = 0.;
+            }
+            connected_parts.clear();
+
+            if (best_part != cur_part) {
+                part_weight[cur_part]--;
+                part_weight[best_part]++;
+                atom_part[atom] = best_part;
+                ++num_pass_moves;
+            }
+        }
+
+        num_moves += num_pass_moves;
+        if (num_pass_moves == 0) {
+            break;
+        }
+    }
+
+    VTR_LOG("Partition refinement moved %zu atoms\n", num_moves);
+}
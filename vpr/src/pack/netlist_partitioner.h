@@ -0,0 +1,32 @@
+#ifndef NETLIST_PARTITIONER_H
+#define NETLIST_PARTITIONER_H
+
+/**
+ * @file
+ * @brief Multilevel partitioning of the atom netlist into small, densely connected parts.
+ *
+ * The atom netlist is viewed as a hypergraph with one vertex per atom block and one hyperedge per
+ * low fanout net. As in the coarsening phase of multilevel partitioners (e.g. hMETIS, KaHyPar),
+ * vertices are repeatedly merged into the neighbouring cluster they share the heaviest nets with,
+ * until no cluster can grow further without exceeding the target part size. The clusters of the
+ * coarsest level are the parts, which are then refined on the atom level by moving atoms to the
+ * part they are most strongly connected to.
+ *
+ * The parts are used by the packer as attraction groups (see AttractionInfo).
+ */
+
+#include <vector>
+
+#include "atom_netlist_fwd.h"
+
+/**
+ * @brief Partitions the atom netlist into parts of at most target_part_size atoms.
+ *
+ * Primary I/Os, nets with a single block and nets with a very high fanout are ignored.
+ *
+ * @return The atoms of each part with at least two atoms. Atoms which were not merged with
+ *         any other atom are not in any part.
+ */
+std::vector<std::vector<AtomBlockId>> partition_atom_netlist(int target_part_size);
+
+#endif
@@ -39,7 +39,8 @@ void update_noc_reachability_partitions(const std::vector<AtomBlockId>& noc_atom
 
     vtr::vector<AtomBlockId, bool> atom_visited(n_atoms, false);
 
-    cl_helper_ctx.atom_noc_grp_id.resize(n_atoms, NocGroupId::INVALID());
+    cl_helper_ctx.atom_noc_grp_id = decltype(cl_helper_ctx.atom_noc_grp_id)(n_atoms, NocGroupId::INVALID(),
+                                                                            vtr::arena_allocator<NocGroupId>(cl_helper_ctx.stage_arena));
 
     int noc_grp_id_cnt = 0;
 
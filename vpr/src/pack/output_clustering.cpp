@@ -6,12 +6,14 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <sstream>
 #include <vector>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_digest.h"
 #include "vtr_memory.h"
+#include "vtr_util.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -33,6 +35,7 @@
 
 static void print_clustering_stats_header();
 static void print_clustering_stats(char* block_name, int num_block_type, float num_inputs_clocks, float num_outputs);
+static pugi::xml_node clustering_xml_top_block(pugi::xml_node parent_node, bool global_clocks, const std::unordered_set<AtomNetId>& is_clock, const std::string& architecture_id, const char* out_fname, bool skip_clustering);
 
 /**************** Subroutine definitions ************************************/
 
@@ -564,7 +567,6 @@ static void clustering_xml_block(pugi::xml_node parent_node, t_logical_block_typ
  * the cluster, in essentially a graph based format.                   */
 void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing, bool global_clocks, const std::unordered_set<AtomNetId>& is_clock, const std::string& architecture_id, const char* out_fname, bool skip_clustering) {
     auto& device_ctx = g_vpr_ctx.device();
-    auto& atom_ctx = g_vpr_ctx.atom();
     auto& cluster_ctx = g_vpr_ctx.mutable_clustering();
 
     if (!intra_lb_routing.empty()) {
@@ -578,7 +580,31 @@ void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_
 
     pugi::xml_document out_xml;
 
-    pugi::xml_node block_node = out_xml.append_child("block");
+    pugi::xml_node block_node = clustering_xml_top_block(out_xml, global_clocks, is_clock, architecture_id, out_fname, skip_clustering);
+
+    if (skip_clustering == false) {
+        for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
+            /* TODO: Must do check that total CLB pins match top-level pb pins, perhaps check this earlier? */
+            clustering_xml_block(block_node, cluster_ctx.clb_nlist.block_type(blk_id), pb_graph_pin_lookup_from_index_by_type, cluster_ctx.clb_nlist.block_pb(blk_id), size_t(blk_id), cluster_ctx.clb_nlist.block_pb(blk_id)->pb_route);
+        }
+    }
+
+    out_xml.save_file(out_fname);
+
+    print_stats();
+
+    if (!intra_lb_routing.empty()) {
+        for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
+            cluster_ctx.clb_nlist.block_pb(blk_id)->pb_route.clear();
+        }
+    }
+}
+
+/* Appends the top-level block of the packed netlist (with the netlist inputs, outputs and clocks) to parent_node */
+static pugi::xml_node clustering_xml_top_block(pugi::xml_node parent_node, bool global_clocks, const std::unordered_set<AtomNetId>& is_clock, const std::string& architecture_id, const char* out_fname, bool skip_clustering) {
+    auto& atom_ctx = g_vpr_ctx.atom();
+
+    pugi::xml_node block_node = parent_node.append_child("block");
     block_node.append_attribute("name") = out_fname;
     block_node.append_attribute("instance") = "FPGA_packed_netlist[0]";
     block_node.append_attribute("architecture_id") = architecture_id.c_str();
@@ -630,22 +656,56 @@ void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_
         block_node.append_child("clocks").text().set(vtr::join(clocks.begin(), clocks.end(), " ").c_str());
     }
 
-    if (skip_clustering == false) {
-        for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
-            /* TODO: Must do check that total CLB pins match top-level pb pins, perhaps check this earlier? */
-            clustering_xml_block(block_node, cluster_ctx.clb_nlist.block_type(blk_id), pb_graph_pin_lookup_from_index_by_type, cluster_ctx.clb_nlist.block_pb(blk_id), size_t(blk_id), cluster_ctx.clb_nlist.block_pb(blk_id)->pb_route);
-        }
+    return block_node;
+}
+
+ClusteringXmlStreamWriter::ClusteringXmlStreamWriter(bool global_clocks, const std::unordered_set<AtomNetId>& is_clock, const std::string& architecture_id, const char* out_fname)
+    : out_(out_fname)
+    , out_fname_(out_fname)
+    , pb_graph_pin_lookup_from_index_by_type_(g_vpr_ctx.device().logical_block_types) {
+    if (!out_) {
+        VPR_FATAL_ERROR(VPR_ERROR_PACK, "Failed to open packed netlist file '%s' for writing\n", out_fname);
     }
 
-    out_xml.save_file(out_fname);
+    //Print the document with only the top-level block, and leave the block open (i.e. drop its end tag)
+    //so the clusters can be appended to it
+    pugi::xml_document top_xml;
+    clustering_xml_top_block(top_xml, global_clocks, is_clock, architecture_id, out_fname, false);
+
+    std::ostringstream top_text;
+    top_xml.save(top_text);
+    std::string text = top_text.str();
+    const std::string end_tag = "</block>\n";
+    VTR_ASSERT(text.size() >= end_tag.size() && text.compare(text.size() - end_tag.size(), end_tag.size(), end_tag) == 0);
+    text.resize(text.size() - end_tag.size());
+    out_ << text;
+}
 
-    print_stats();
+void ClusteringXmlStreamWriter::write_cluster(ClusterBlockId blk_id, const std::vector<t_intra_lb_net>* intra_lb_nets) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    VTR_ASSERT_MSG(size_t(blk_id) == num_clusters_written_, "Clusters must be written in order");
+    ++num_clusters_written_;
 
-    if (!intra_lb_routing.empty()) {
-        for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
-            cluster_ctx.clb_nlist.block_pb(blk_id)->pb_route.clear();
-        }
+    t_pb* pb = cluster_ctx.clb_nlist.block_pb(blk_id);
+    t_pb_routes pb_route = alloc_and_load_pb_route(intra_lb_nets, pb->pb_graph_node);
+
+    pugi::xml_document cluster_xml;
+    clustering_xml_block(cluster_xml, cluster_ctx.clb_nlist.block_type(blk_id), pb_graph_pin_lookup_from_index_by_type_, pb, size_t(blk_id), pb_route);
+
+    //Indented one level, as a child of the top-level block
+    cluster_xml.first_child().print(out_, "\t", pugi::format_default, pugi::encoding_auto, 1);
+}
+
+void ClusteringXmlStreamWriter::finish() {
+    VTR_ASSERT_MSG(num_clusters_written_ == g_vpr_ctx.clustering().clb_nlist.blocks().size(), "All the clusters must be written");
+
+    out_ << "</block>\n";
+    out_.close();
+    if (!out_) {
+        VPR_FATAL_ERROR(VPR_ERROR_PACK, "Failed to write packed netlist file '%s'\n", out_fname_.c_str());
     }
+
+    print_stats();
 }
 
 /********************************************************************
@@ -1,12 +1,40 @@
 #ifndef OUTPUT_CLUSTERING_H
 #define OUTPUT_CLUSTERING_H
+#include <fstream>
+#include <string>
 #include <vector>
 #include <unordered_set>
 #include "vpr_types.h"
 #include "pack_types.h"
+#include "vpr_utils.h"
 
 void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing, bool global_clocks, const std::unordered_set<AtomNetId>& is_clock, const std::string& architecture_id, const char* out_fname, bool skip_clustering);
 
 void write_packing_results_to_xml(const bool& global_clocks, const std::string& architecture_id, const char* out_fname);
 
+/**
+ * @brief Writes the packed netlist file incrementally, one cluster at a time
+ *
+ * The top-level block (with the netlist inputs, outputs and clocks) is written on construction, each cluster
+ * is written by write_cluster() as soon as it is formed (instead of building the whole document in memory
+ * once packing is done, as output_clustering() does), and finish() closes the file. The clusters must be
+ * written in order of their ids, which makes the file identical to the one written by output_clustering().
+ */
+class ClusteringXmlStreamWriter {
+  public:
+    ClusteringXmlStreamWriter(bool global_clocks, const std::unordered_set<AtomNetId>& is_clock, const std::string& architecture_id, const char* out_fname);
+
+    ///@brief Writes the cluster blk_id, whose intra-cluster routing is intra_lb_nets
+    void write_cluster(ClusterBlockId blk_id, const std::vector<t_intra_lb_net>* intra_lb_nets);
+
+    ///@brief Closes the file (once all the clusters have been written) and prints the clustering statistics
+    void finish();
+
+  private:
+    std::ofstream out_;
+    std::string out_fname_;
+    IntraLbPbPinLookup pb_graph_pin_lookup_from_index_by_type_;
+    size_t num_clusters_written_ = 0;
+};
+
 #endif
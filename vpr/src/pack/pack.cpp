@@ -15,6 +15,7 @@
 #include "pack_types.h"
 #include "pack.h"
 #include "cluster.h"
+#include "cluster_router.h"
 #include "SetupGrid.h"
 #include "re_cluster.h"
 #include "noc_aware_cluster_util.h"
@@ -95,6 +96,10 @@ bool try_pack(t_packer_opts* packer_opts,
      * only turn on in later iterations if some floorplan regions turn out to be overfull.
      */
     AttractionInfo attraction_groups(false);
+    if (packer_opts->pack_partition_size > 0) {
+        //Seed the first iteration with groups of densely connected atoms
+        attraction_groups.create_att_groups_from_netlist_partition(packer_opts->pack_partition_size);
+    }
     VTR_LOG("%d attraction groups were created during prepacking.\n", attraction_groups.num_attraction_groups());
     VTR_LOG("Finish prepacking.\n");
 
@@ -245,6 +250,8 @@ bool try_pack(t_packer_opts* packer_opts,
             g_vpr_ctx.mutable_atom().lookup.set_atom_clb_net(net, ClusterNetId::INVALID());
         }
         g_vpr_ctx.mutable_floorplanning().cluster_constraints.clear();
+        g_vpr_ctx.mutable_floorplanning().cluster_constraint_bitmap_ids.clear();
+        g_vpr_ctx.mutable_floorplanning().cluster_constraint_bitmaps.clear();
         //attraction_groups.reset_attraction_groups();
 
         free_cluster_placement_stats(helper_ctx.cluster_placement_stats);
@@ -269,10 +276,11 @@ bool try_pack(t_packer_opts* packer_opts,
     /******************** End **************************/
 
     //check clustering and output it
-    check_and_output_clustering(*packer_opts, is_clock, arch, helper_ctx.total_clb_num, clustering_data.intra_lb_routing);
+    check_and_output_clustering(*packer_opts, is_clock, arch, helper_ctx.total_clb_num, clustering_data.intra_lb_routing, clustering_data.output_writer.get());
 
     // Free Data Structures
     free_clustering_data(*packer_opts, clustering_data);
+    free_cluster_router_pools();
 
     VTR_LOG("\n");
     VTR_LOG("Netlist conversion complete.\n");
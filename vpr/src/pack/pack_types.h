@@ -13,6 +13,7 @@
 #include "arch_types.h"
 #include "atom_netlist_fwd.h"
 #include "attraction_groups.h"
+#include "vtr_id_hash_map.h"
 
 /**************************************************************************
  * Packing Algorithm Enumerations
@@ -35,14 +36,14 @@ const std::vector<const char*> lb_rr_type_str{
 /* Stores statistical information for a physical cluster_ctx.blocks such as costs and usages */
 struct t_pb_stats {
     /* Packing statistics */
-    std::map<AtomBlockId, float> gain; /* Attraction (inverse of cost) function */
+    vtr::id_hash_map<AtomBlockId, float> gain; /* Attraction (inverse of cost) function */
 
-    std::map<AtomBlockId, float> timinggain;     /* The timing criticality score of this atom cluster_ctx.blocks.
+    vtr::id_hash_map<AtomBlockId, float> timinggain;     /* The timing criticality score of this atom cluster_ctx.blocks.
                                                   * Determined by the most critical atom net
                                                   * between this atom cluster_ctx.blocks and any atom cluster_ctx.blocks in
                                                   * the current pb */
-    std::map<AtomBlockId, float> connectiongain; /* Weighted sum of connections to attraction function */
-    std::map<AtomBlockId, float> sharinggain;    /* How many nets on an atom cluster_ctx.blocks are already in the pb under consideration */
+    vtr::id_hash_map<AtomBlockId, float> connectiongain; /* Weighted sum of connections to attraction function */
+    vtr::id_hash_map<AtomBlockId, float> sharinggain;    /* How many nets on an atom cluster_ctx.blocks are already in the pb under consideration */
 
     /* This is the gain used for hill-climbing. It stores*
      * the reduction in the number of pins that adding this atom cluster_ctx.blocks to the the*
@@ -50,13 +51,13 @@ struct t_pb_stats {
      * addition of an atom cluster_ctx.blocks to a pb may reduce the number of inputs     *
      * required if it shares inputs with all other BLEs and it's output is  *
      * used by all other child pbs in this parent pb.                               */
-    std::map<AtomBlockId, float> hillgain;
+    vtr::id_hash_map<AtomBlockId, float> hillgain;
 
     /*
      * stores the number of times atoms have failed to be packed into the cluster
      * key: root block id of the molecule, value: number of times the molecule has failed to be packed into the cluster
      */
-    std::map<AtomBlockId, int> atom_failures;
+    vtr::id_hash_map<AtomBlockId, int> atom_failures;
 
     int pulled_from_atom_groups;
     int num_att_group_atoms_used;
@@ -65,6 +66,7 @@ struct t_pb_stats {
 
     std::vector<AtomNetId> marked_nets;     //List of nets with the num_pins_of_net_in_pb and gain entries altered
     std::vector<AtomBlockId> marked_blocks; //List of blocks with the num_pins_of_net_in_pb and gain entries altered
+    std::vector<AtomBlockId> gain_update_blocks; //Blocks whose gain entries changed since the last update of their total gain (may contain duplicates)
 
     int num_child_blocks_in_pb;
 
@@ -76,7 +78,7 @@ struct t_pb_stats {
 
     /* How many pins of each atom net are contained in the *
      * currently open pb?                                  */
-    std::map<AtomNetId, int> num_pins_of_net_in_pb;
+    vtr::id_hash_map<AtomNetId, int> num_pins_of_net_in_pb;
 
     /* Record of pins of class used */
     std::vector<std::unordered_map<size_t, AtomNetId>> input_pins_used;  /* [0..pb_graph_node->num_pin_classes-1] nets using this input pin class */
@@ -94,7 +96,8 @@ struct t_pb_stats {
      * Sorted in ascending gain order so that the last cluster_ctx.blocks is the most desirable (this makes it easy to pop blocks off the list
      */
     t_pack_molecule** feasible_blocks;
-    int num_feasible_blocks; /* [0..num_marked_models-1] */
+    std::vector<float> feasible_blocks_gain; /* [0..max_array_size-1] Molecule gain of each feasible block */
+    int num_feasible_blocks;                 /* [0..num_marked_models-1] */
 };
 
 /**************************************************************************
@@ -246,7 +249,7 @@ struct t_lb_router_data {
     /* Saved nets */
     std::vector<t_intra_lb_net>* saved_lb_nets; /* Save vector of intra logic cluster_ctx.blocks nets and their connections */
 
-    std::map<AtomBlockId, bool>* atoms_added; /* map that records which atoms are added to cluster router */
+    vtr::id_hash_set<AtomBlockId>* atoms_added; /* set of the atoms which are added to cluster router */
 
     /* Logical-to-physical mapping info */
     t_lb_rr_node_stats* lb_rr_node_stats; /* [0..lb_type_graph->size()-1] Stats for each logic cluster_ctx.blocks rr node instance */
@@ -14,7 +14,11 @@
 #include <cstdio>
 #include <cstring>
 #include <cinttypes>
+#include <algorithm>
 #include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "vtr_util.h"
 #include "vtr_assert.h"
@@ -39,6 +43,24 @@
 static vtr::t_linked_vptr* edges_head;
 static vtr::t_linked_vptr* num_edges_head;
 
+/* The tokens of a port string, along with the number of pin sets it specifies.
+ * The same port strings (e.g. a mode's interconnect, or the pins of a packed netlist's blocks)
+ * are resolved once for every instance of their pb_type, so each distinct string is only
+ * tokenized and checked once. */
+struct t_port_string_tokens {
+    t_token* tokens = nullptr;
+    int num_tokens = 0;
+    int num_sets = 0;
+
+    t_port_string_tokens() = default;
+    t_port_string_tokens(const t_port_string_tokens&) = delete;
+    t_port_string_tokens& operator=(const t_port_string_tokens&) = delete;
+    ~t_port_string_tokens() {
+        freeTokens(tokens, num_tokens);
+    }
+};
+static std::unordered_map<std::string, t_port_string_tokens> port_string_tokens;
+
 /* TODO: Software engineering decision needed: Move this file to libarch?
  *
  */
@@ -83,8 +105,9 @@ static bool realloc_and_load_pb_graph_pin_ptrs_at_var(const int line_num,
                                                       const bool is_input_to_interc,
                                                       const t_token* tokens,
                                                       int* token_index,
-                                                      int* num_pins,
-                                                      t_pb_graph_pin*** pb_graph_pins);
+                                                      std::vector<t_pb_graph_pin*>& pb_graph_pins);
+
+static const t_port_string_tokens& get_port_string_tokens(const int line_num, const char* port_string);
 
 static t_pb_graph_pin* get_pb_graph_pin_from_name(const char* port_name,
                                                   const t_pb_graph_node* pb,
@@ -635,6 +658,8 @@ void free_pb_graph_edges() {
         delete cur_num;
         delete cur;
     }
+
+    port_string_tokens.clear();
 }
 
 static void alloc_and_load_interconnect_pins(t_interconnect_pins* interc_pins,
@@ -911,94 +936,111 @@ t_pb_graph_pin*** alloc_and_load_port_pin_ptrs_from_string(const int line_num,
                                                            int* num_sets,
                                                            const bool is_input_to_interc,
                                                            const bool interconnect_error_check) {
-    t_token* tokens;
-    int num_tokens, curr_set;
+    int curr_set;
     int i;
     bool in_squig_bracket, success = false;
 
     t_pb_graph_pin*** pb_graph_pins;
 
-    num_tokens = 0;
-    tokens = GetTokensFromString(port_string, &num_tokens);
-    *num_sets = 0;
-    in_squig_bracket = false;
+    const t_port_string_tokens& port_tokens = get_port_string_tokens(line_num, port_string);
+    const t_token* tokens = port_tokens.tokens;
+    int num_tokens = port_tokens.num_tokens;
+    *num_sets = port_tokens.num_sets;
 
-    /* count the number of sets available */
+    std::vector<std::vector<t_pb_graph_pin*>> set_pins(*num_sets);
+
+    curr_set = 0;
+    in_squig_bracket = false;
     for (i = 0; i < num_tokens; i++) {
         VTR_ASSERT(tokens[i].type != TOKEN_NULL);
         if (tokens[i].type == TOKEN_OPEN_SQUIG_BRACKET) {
-            if (in_squig_bracket) {
-                vpr_throw(VPR_ERROR_ARCH, get_arch_file_name(), line_num,
-                          "{ inside { in port %s\n", port_string);
-            }
             in_squig_bracket = true;
         } else if (tokens[i].type == TOKEN_CLOSE_SQUIG_BRACKET) {
-            if (!in_squig_bracket) {
+            if (set_pins[curr_set].empty()) {
                 vpr_throw(VPR_ERROR_ARCH, get_arch_file_name(), line_num,
-                          "No matching '{' for '}' in port %s\n", port_string);
+                          "No data contained in {} in port %s\n", port_string);
             }
-            (*num_sets)++;
+            curr_set++;
             in_squig_bracket = false;
-        } else if (tokens[i].type == TOKEN_DOT) {
+        } else if (tokens[i].type == TOKEN_STRING) {
+            try {
+                success = realloc_and_load_pb_graph_pin_ptrs_at_var(line_num,
+                                                                    pb_graph_parent_node, pb_graph_children_nodes,
+                                                                    interconnect_error_check, is_input_to_interc, tokens, &i,
+                                                                    set_pins[curr_set]);
+            } catch (VprError& e) {
+                vpr_throw(VPR_ERROR_ARCH, get_arch_file_name(), line_num,
+                          "Syntax error processing port string '%s' (%s)\n", port_string, e.what());
+            }
+            VTR_ASSERT(success);
+
             if (!in_squig_bracket) {
-                (*num_sets)++;
+                curr_set++;
             }
         }
     }
-
-    if (in_squig_bracket) {
-        (*num_sets)++;
-        vpr_throw(VPR_ERROR_ARCH, get_arch_file_name(), line_num,
-                  "No matching '{' for '}' in port %s\n", port_string);
-    }
+    VTR_ASSERT(curr_set == *num_sets);
 
     pb_graph_pins = new t_pb_graph_pin**[*num_sets];
     *num_ptrs = new int[*num_sets];
     for (i = 0; i < *num_sets; i++) {
+        (*num_ptrs)[i] = set_pins[i].size();
         pb_graph_pins[i] = nullptr;
-        (*num_ptrs)[i] = 0;
+        if (!set_pins[i].empty()) {
+            pb_graph_pins[i] = new t_pb_graph_pin*[set_pins[i].size()];
+            std::copy(set_pins[i].begin(), set_pins[i].end(), pb_graph_pins[i]);
+        }
     }
+    return pb_graph_pins;
+}
 
-    curr_set = 0;
-    for (i = 0; i < num_tokens; i++) {
-        VTR_ASSERT(tokens[i].type != TOKEN_NULL);
-        if (tokens[i].type == TOKEN_OPEN_SQUIG_BRACKET) {
+/**
+ * returns the (cached) tokens of a port string, and the number of pin sets it specifies
+ */
+static const t_port_string_tokens& get_port_string_tokens(const int line_num, const char* port_string) {
+    auto iter = port_string_tokens.find(port_string);
+    if (iter != port_string_tokens.end()) {
+        return iter->second;
+    }
+
+    t_port_string_tokens port_tokens;
+    port_tokens.tokens = GetTokensFromString(port_string, &port_tokens.num_tokens);
+
+    /* count the number of sets available */
+    bool in_squig_bracket = false;
+    for (int i = 0; i < port_tokens.num_tokens; i++) {
+        const t_token& token = port_tokens.tokens[i];
+        VTR_ASSERT(token.type != TOKEN_NULL);
+        if (token.type == TOKEN_OPEN_SQUIG_BRACKET) {
             if (in_squig_bracket) {
                 vpr_throw(VPR_ERROR_ARCH, get_arch_file_name(), line_num,
                           "{ inside { in port %s\n", port_string);
             }
             in_squig_bracket = true;
-        } else if (tokens[i].type == TOKEN_CLOSE_SQUIG_BRACKET) {
-            if ((*num_ptrs)[curr_set] == 0) {
-                vpr_throw(VPR_ERROR_ARCH, get_arch_file_name(), line_num,
-                          "No data contained in {} in port %s\n", port_string);
-            }
+        } else if (token.type == TOKEN_CLOSE_SQUIG_BRACKET) {
             if (!in_squig_bracket) {
                 vpr_throw(VPR_ERROR_ARCH, get_arch_file_name(), line_num,
                           "No matching '{' for '}' in port %s\n", port_string);
             }
-            curr_set++;
+            port_tokens.num_sets++;
             in_squig_bracket = false;
-        } else if (tokens[i].type == TOKEN_STRING) {
-            try {
-                success = realloc_and_load_pb_graph_pin_ptrs_at_var(line_num,
-                                                                    pb_graph_parent_node, pb_graph_children_nodes,
-                                                                    interconnect_error_check, is_input_to_interc, tokens, &i,
-                                                                    &((*num_ptrs)[curr_set]), &pb_graph_pins[curr_set]);
-            } catch (VprError& e) {
-                vpr_throw(VPR_ERROR_ARCH, get_arch_file_name(), line_num,
-                          "Syntax error processing port string '%s' (%s)\n", port_string, e.what());
-            }
-            VTR_ASSERT(success);
-
+        } else if (token.type == TOKEN_DOT) {
             if (!in_squig_bracket) {
-                curr_set++;
+                port_tokens.num_sets++;
             }
         }
     }
-    VTR_ASSERT(curr_set == *num_sets);
-    freeTokens(tokens, num_tokens);
-    return pb_graph_pins;
+
+    if (in_squig_bracket) {
+        vpr_throw(VPR_ERROR_ARCH, get_arch_file_name(), line_num,
+                  "No matching '{' for '}' in port %s\n", port_string);
+    }
+
+    t_port_string_tokens& cached_tokens = port_string_tokens[port_string];
+    std::swap(cached_tokens.tokens, port_tokens.tokens);
+    std::swap(cached_tokens.num_tokens, port_tokens.num_tokens);
+    cached_tokens.num_sets = port_tokens.num_sets;
+    return cached_tokens;
 }
 
 /**
@@ -1257,9 +1299,8 @@ static void alloc_and_load_mux_interc_edges(t_interconnect* interconnect,
 
 /**
  * populate array of pb graph pins for a single variable of type pb_type[int:int].port[int:int]
- * pb_graph_pins: pointer to array from [0..num_port_pins] of pb_graph_pin pointers
+ * pb_graph_pins: pb_graph_pin pointers of the set, the variable's pins are appended to it
  * tokens: array of tokens to scan
- * num_pins: current number of pins in pb_graph_pin array
  */
 static bool realloc_and_load_pb_graph_pin_ptrs_at_var(const int line_num,
                                                       const t_pb_graph_node* pb_graph_parent_node,
@@ -1268,8 +1309,7 @@ static bool realloc_and_load_pb_graph_pin_ptrs_at_var(const int line_num,
                                                       const bool is_input_to_interc,
                                                       const t_token* tokens,
                                                       int* token_index,
-                                                      int* num_pins,
-                                                      t_pb_graph_pin*** pb_graph_pins) {
+                                                      std::vector<t_pb_graph_pin*>& pb_graph_pins) {
     int i, j, ipin, ipb;
     int pb_msb, pb_lsb;
     int pin_msb, pin_lsb;
@@ -1482,18 +1522,7 @@ static bool realloc_and_load_pb_graph_pin_ptrs_at_var(const int line_num,
         add_or_subtract_pin = 1;
     }
 
-    int prev_num_pins = *num_pins;
-    *num_pins += (abs(pb_msb - pb_lsb) + 1) * (abs(pin_msb - pin_lsb) + 1);
-
-    if (prev_num_pins > 0) {
-        std::vector<t_pb_graph_pin*> temp(*pb_graph_pins, *pb_graph_pins + prev_num_pins);
-        delete[] * pb_graph_pins;
-        *pb_graph_pins = new t_pb_graph_pin*[*num_pins];
-        for (i = 0; i < prev_num_pins; i++)
-            (*pb_graph_pins)[i] = temp[i];
-    } else {
-        *pb_graph_pins = new t_pb_graph_pin*[*num_pins];
-    }
+    pb_graph_pins.reserve(pb_graph_pins.size() + (abs(pb_msb - pb_lsb) + 1) * (abs(pin_msb - pin_lsb) + 1));
 
     i = j = 0;
 
@@ -1503,14 +1532,14 @@ static bool realloc_and_load_pb_graph_pin_ptrs_at_var(const int line_num,
         ipin = pin_lsb;
         j = 0;
         while (ipin != pin_msb + add_or_subtract_pin) {
-            int idx = prev_num_pins + i * (abs(pin_msb - pin_lsb) + 1) + j;
-            (*pb_graph_pins)[idx] = get_pb_graph_pin_from_name(port_name, &pb_node_array[ipb], ipin);
-            if ((*pb_graph_pins)[idx] == nullptr) {
+            t_pb_graph_pin* pb_graph_pin = get_pb_graph_pin_from_name(port_name, &pb_node_array[ipb], ipin);
+            if (pb_graph_pin == nullptr) {
                 vpr_throw(VPR_ERROR_ARCH, get_arch_file_name(), line_num,
                           "Pin %s.%s[%d] cannot be found",
                           pb_node_array[ipb].pb_type->name, port_name, ipin);
             }
-            iport = (*pb_graph_pins)[idx]->port;
+            pb_graph_pins.push_back(pb_graph_pin);
+            iport = pb_graph_pin->port;
             if (!iport) {
                 return false;
             }
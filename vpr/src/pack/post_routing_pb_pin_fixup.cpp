@@ -2,6 +2,10 @@
  * This file includes functions to fix up the pb pin mapping results 
  * after routing optimization
  *******************************************************************/
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 /* Headers from vtrutil library */
 #include "vtr_time.h"
 #include "vtr_assert.h"
@@ -18,6 +22,40 @@
 /* Include global variables of VPR */
 #include "globals.h"
 
+/********************************************************************
+ * The fix-up results of a clustered block
+ * Each block only touches its own pb and routing traces,
+ * which allows the blocks to be fixed up independently.
+ * All the updates to the shared netlist lookups are kept here
+ * and merged into the contexts once every block is done
+ *******************************************************************/
+struct t_cluster_pin_fixup {
+    /* Pins whose nets changed after routing, see ClusteringContext::post_routing_clb_pin_nets */
+    std::map<int, ClusterNetId> pin_nets;
+    /* See ClusteringContext::pre_routing_net_pin_mapping */
+    std::map<int, int> pin_mapping;
+    /* The atom pins redirected to new pb_graph pins, in the order they were found */
+    std::vector<std::pair<AtomPinId, const t_pb_graph_pin*>> atom_pins;
+
+    size_t num_mismatches = 0;
+    size_t num_fixup = 0;
+};
+
+/********************************************************************
+ * Find the pb_graph pin an atom pin is currently mapped to,
+ * considering the redirects already found for its block
+ *******************************************************************/
+static const t_pb_graph_pin* find_atom_pin_pb_graph_pin(const AtomContext& atom_ctx,
+                                                        const t_cluster_pin_fixup& fixup,
+                                                        const AtomPinId& atom_pin) {
+    for (auto it = fixup.atom_pins.rbegin(); it != fixup.atom_pins.rend(); ++it) {
+        if (it->first == atom_pin) {
+            return it->second;
+        }
+    }
+    return atom_ctx.lookup.atom_pin_pb_graph_pin(atom_pin);
+}
+
 /********************************************************************
  * Give a given pin index, find the side where this pin is located 
  * on the physical tile
@@ -50,11 +88,11 @@ static std::vector<e_side> find_physical_tile_pin_side(t_physical_tile_type_ptr
 static void update_cluster_pin_with_post_routing_results(const Netlist<>& net_list,
                                                          const AtomContext& atom_ctx,
                                                          const DeviceContext& device_ctx,
-                                                         ClusteringContext& clustering_ctx,
+                                                         const ClusteringContext& clustering_ctx,
                                                          const vtr::vector<RRNodeId, ParentNetId>& rr_node_nets,
                                                          const t_pl_loc& grid_coord,
                                                          const ClusterBlockId& blk_id,
-                                                         size_t& num_mismatches,
+                                                         t_cluster_pin_fixup& fixup,
                                                          const bool& verbose,
                                                          bool is_flat) {
     const int sub_tile_z = grid_coord.sub_tile;
@@ -228,7 +266,7 @@ static void update_cluster_pin_with_post_routing_results(const Netlist<>& net_li
         }
 
         /* Update the clustering context with net modification */
-        clustering_ctx.post_routing_clb_pin_nets[blk_id][pb_graph_pin->pin_count_in_cluster] = cluster_equivalent_net_id;
+        fixup.pin_nets[pb_graph_pin->pin_count_in_cluster] = cluster_equivalent_net_id;
 
         std::string routing_net_name("unmapped");
         if (clustering_ctx.clb_nlist.valid_net_id(cluster_equivalent_net_id)) {
@@ -252,7 +290,7 @@ static void update_cluster_pin_with_post_routing_results(const Netlist<>& net_li
                  cluster_net_name.c_str());
 
         /* Update counter */
-        num_mismatches++;
+        fixup.num_mismatches++;
     }
 }
 
@@ -265,6 +303,7 @@ static void update_cluster_pin_with_post_routing_results(const Netlist<>& net_li
  *******************************************************************/
 static int find_target_pb_route_from_equivalent_pins(const AtomContext& atom_ctx,
                                                      const ClusteringContext& clustering_ctx,
+                                                     const t_cluster_pin_fixup& fixup,
                                                      const ClusterBlockId& blk_id,
                                                      t_pb* pb,
                                                      const t_pb_graph_pin* source_pb_graph_pin,
@@ -301,10 +340,10 @@ static int find_target_pb_route_from_equivalent_pins(const AtomContext& atom_ctx
             continue;
         }
 
-        auto remapped_result = clustering_ctx.post_routing_clb_pin_nets.at(blk_id).find(pin);
+        auto remapped_result = fixup.pin_nets.find(pin);
 
         /* Skip this pin if it is consistent in pre- and post- routing results */
-        if (remapped_result == clustering_ctx.post_routing_clb_pin_nets.at(blk_id).end()) {
+        if (remapped_result == fixup.pin_nets.end()) {
             continue;
         }
 
@@ -491,6 +530,7 @@ static AtomPinId find_mapped_atom_pin(const AtomContext& atom_ctx,
 static std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> cache_atom_pin_to_pb_pin_mapping(const AtomContext& atom_ctx,
                                                                                                    const IntraLbPbPinLookup& intra_lb_pb_pin_lookup,
                                                                                                    const ClusteringContext& clustering_ctx,
+                                                                                                   const t_cluster_pin_fixup& fixup,
                                                                                                    const ClusterBlockId& blk_id,
                                                                                                    t_pb* pb,
                                                                                                    t_logical_block_type_ptr logical_block) {
@@ -510,10 +550,10 @@ static std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> cache_atom_pin
         VTR_ASSERT(pb_graph_pin->parent_node == pb->pb_graph_node);
         VTR_ASSERT(pb_graph_pin->parent_node->is_root());
 
-        auto remapped_result = clustering_ctx.post_routing_clb_pin_nets.at(blk_id).find(pb_graph_pin->pin_count_in_cluster);
+        auto remapped_result = fixup.pin_nets.find(pb_graph_pin->pin_count_in_cluster);
 
         /* Skip this pin: it is consistent in pre- and post- routing results */
-        if (remapped_result == clustering_ctx.post_routing_clb_pin_nets.at(blk_id).end()) {
+        if (remapped_result == fixup.pin_nets.end()) {
             continue;
         }
 
@@ -593,14 +633,14 @@ static void rec_remove_downstream_pb_routes(t_pb_routes& curr_pb_routes,
  *  - modify any routing traces for global nets,
  *    which should be handled in another function!!!
  *******************************************************************/
-static void update_cluster_regular_routing_traces_with_post_routing_results(AtomContext& atom_ctx,
+static void update_cluster_regular_routing_traces_with_post_routing_results(const AtomContext& atom_ctx,
                                                                             const std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>>& previous_atom_pin_to_pb_pin_mapping,
-                                                                            ClusteringContext& clustering_ctx,
+                                                                            const ClusteringContext& clustering_ctx,
                                                                             const ClusterBlockId& blk_id,
                                                                             t_pb* pb,
                                                                             t_logical_block_type_ptr logical_block,
                                                                             t_pb_routes& new_pb_routes,
-                                                                            size_t& num_fixup,
+                                                                            t_cluster_pin_fixup& fixup,
                                                                             const bool& verbose) {
     /* Go through each pb_graph pin at the top level
      * and build the new routing traces
@@ -625,15 +665,15 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
         VTR_ASSERT(pb_graph_pin->parent_node == pb->pb_graph_node);
         VTR_ASSERT(pb_graph_pin->parent_node->is_root());
 
-        auto remapped_result = clustering_ctx.post_routing_clb_pin_nets.at(blk_id).find(pb_graph_pin->pin_count_in_cluster);
+        auto remapped_result = fixup.pin_nets.find(pb_graph_pin->pin_count_in_cluster);
 
         /* Skip this pin: it is consistent in pre- and post- routing results */
-        if (remapped_result == clustering_ctx.post_routing_clb_pin_nets.at(blk_id).end()) {
+        if (remapped_result == fixup.pin_nets.end()) {
             continue;
         }
 
         /* Update only when there is a remapping! */
-        VTR_ASSERT_SAFE(remapped_result != clustering_ctx.post_routing_clb_pin_nets[blk_id].end());
+        VTR_ASSERT_SAFE(remapped_result != fixup.pin_nets.end());
 
         /* Cache the remapped net id */
         AtomNetId remapped_net = atom_ctx.lookup.atom_net(remapped_result->second);
@@ -671,6 +711,7 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
          */
         int pb_route_id = find_target_pb_route_from_equivalent_pins(atom_ctx,
                                                                     clustering_ctx,
+                                                                    fixup,
                                                                     blk_id,
                                                                     pb,
                                                                     pb_graph_pin,
@@ -678,7 +719,7 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                                                                     verbose);
 
         /* Record the previous pin mapping for finding the correct pin index during timing analysis */
-        clustering_ctx.pre_routing_net_pin_mapping[blk_id][pb_graph_pin->pin_count_in_cluster] = pb_route_id;
+        fixup.pin_mapping[pb_graph_pin->pin_count_in_cluster] = pb_route_id;
 
         /* Remove the old pb_route and insert the new one */
         new_pb_routes.insert(std::make_pair(pb_graph_pin->pin_count_in_cluster, t_pb_route()));
@@ -805,13 +846,12 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                 VTR_LOGV(verbose,
                          "Redirect atom pin '%lu' mapping from '%s' to '%s' for net '%s'.\n",
                          size_t(orig_mapped_atom_pin),
-                         atom_ctx.lookup.atom_pin_pb_graph_pin(orig_mapped_atom_pin)->to_string().c_str(),
+                         find_atom_pin_pb_graph_pin(atom_ctx, fixup, orig_mapped_atom_pin)->to_string().c_str(),
                          new_sink_pb_pin_to_add->to_string().c_str(),
                          atom_ctx.nlist.net_name(remapped_net).c_str());
 
-                /* Update the pin binding in atom netlist fast look-up */
-                atom_ctx.lookup.set_atom_pin_pb_graph_pin(orig_mapped_atom_pin, new_sink_pb_pin_to_add);
-                VTR_ASSERT(new_sink_pb_pin_to_add == atom_ctx.lookup.atom_pin_pb_graph_pin(orig_mapped_atom_pin));
+                /* Record the pin binding for the atom netlist fast look-up */
+                fixup.atom_pins.emplace_back(orig_mapped_atom_pin, new_sink_pb_pin_to_add);
 
                 /* Update the pin rotation map */
                 t_pb* atom_pb = pb->find_mutable_pb(new_sink_pb_pin_to_add->parent_node);
@@ -851,13 +891,12 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                         VTR_LOGV(verbose,
                                  "Redirect atom pin '%lu' mapping from '%s' to '%s' for net '%s'.\n",
                                  size_t(orig_mapped_atom_pin),
-                                 atom_ctx.lookup.atom_pin_pb_graph_pin(orig_mapped_atom_pin)->to_string().c_str(),
+                                 find_atom_pin_pb_graph_pin(atom_ctx, fixup, orig_mapped_atom_pin)->to_string().c_str(),
                                  next_pb_pin->to_string().c_str(),
                                  atom_ctx.nlist.net_name(remapped_net).c_str());
 
-                        /* Update the pin binding in atom netlist fast look-up */
-                        atom_ctx.lookup.set_atom_pin_pb_graph_pin(orig_mapped_atom_pin, next_pb_pin);
-                        VTR_ASSERT(next_pb_pin == atom_ctx.lookup.atom_pin_pb_graph_pin(orig_mapped_atom_pin));
+                        /* Record the pin binding for the atom netlist fast look-up */
+                        fixup.atom_pins.emplace_back(orig_mapped_atom_pin, next_pb_pin);
 
                         /* Update the pin rotation map */
                         t_pb* atom_pb = pb->find_mutable_pb(next_pb_pin->parent_node);
@@ -874,7 +913,7 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                  atom_ctx.nlist.net_name(remapped_net).c_str());
 
         /* Update fixup counter */
-        num_fixup++;
+        fixup.num_fixup++;
     }
 }
 
@@ -887,12 +926,12 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
  *    which should be handled in another function!!!
  *******************************************************************/
 static void update_cluster_global_routing_traces_with_post_routing_results(const AtomContext& atom_ctx,
-                                                                           ClusteringContext& clustering_ctx,
+                                                                           const ClusteringContext& clustering_ctx,
                                                                            const ClusterBlockId& blk_id,
                                                                            t_pb* pb,
                                                                            t_logical_block_type_ptr logical_block,
                                                                            t_pb_routes& new_pb_routes,
-                                                                           size_t& num_fixup,
+                                                                           t_cluster_pin_fixup& fixup,
                                                                            const bool& verbose) {
     /* Reassign global nets to unused pins in the same port where they were mapped
      * NO optimization is done here!!! First find first fit
@@ -925,15 +964,15 @@ static void update_cluster_global_routing_traces_with_post_routing_results(const
 
         AtomNetId global_atom_net_id = atom_ctx.lookup.atom_net(global_net_id);
 
-        auto remapped_result = clustering_ctx.post_routing_clb_pin_nets.at(blk_id).find(pb_graph_pin->pin_count_in_cluster);
+        auto remapped_result = fixup.pin_nets.find(pb_graph_pin->pin_count_in_cluster);
 
         /* Skip this pin: it is consistent in pre- and post- routing results */
-        if (remapped_result == clustering_ctx.post_routing_clb_pin_nets.at(blk_id).end()) {
+        if (remapped_result == fixup.pin_nets.end()) {
             continue;
         }
 
         /* Update only when there is a remapping! */
-        VTR_ASSERT_SAFE(remapped_result != clustering_ctx.post_routing_clb_pin_nets[blk_id].end());
+        VTR_ASSERT_SAFE(remapped_result != fixup.pin_nets.end());
 
         VTR_LOGV(verbose,
                  "Remapping clustered block '%s' global net '%s' to unused pin as %s\r",
@@ -963,8 +1002,8 @@ static void update_cluster_global_routing_traces_with_post_routing_results(const
         }
 
         /* Update the remapping nets for this global net */
-        clustering_ctx.post_routing_clb_pin_nets[blk_id][unused_pb_graph_pin->pin_count_in_cluster] = global_net_id;
-        clustering_ctx.pre_routing_net_pin_mapping[blk_id][unused_pb_graph_pin->pin_count_in_cluster] = pb_route_id;
+        fixup.pin_nets[unused_pb_graph_pin->pin_count_in_cluster] = global_net_id;
+        fixup.pin_mapping[unused_pb_graph_pin->pin_count_in_cluster] = pb_route_id;
 
         VTR_LOGV(verbose,
                  "Remap clustered block '%s' global net '%s' to pin '%s'\n",
@@ -973,7 +1012,7 @@ static void update_cluster_global_routing_traces_with_post_routing_results(const
                  unused_pb_graph_pin->to_string().c_str());
 
         /* Update fixup counter */
-        num_fixup++;
+        fixup.num_fixup++;
     }
 }
 
@@ -986,14 +1025,14 @@ static void update_cluster_global_routing_traces_with_post_routing_results(const
  *   - This function should be called AFTER the function
  *       update_cluster_pin_with_post_routing_results()
  *******************************************************************/
-static void update_cluster_routing_traces_with_post_routing_results(AtomContext& atom_ctx,
+static void update_cluster_routing_traces_with_post_routing_results(const AtomContext& atom_ctx,
                                                                     const IntraLbPbPinLookup& intra_lb_pb_pin_lookup,
-                                                                    ClusteringContext& clustering_ctx,
+                                                                    const ClusteringContext& clustering_ctx,
                                                                     const ClusterBlockId& blk_id,
-                                                                    size_t& num_fixup,
+                                                                    t_cluster_pin_fixup& fixup,
                                                                     const bool& verbose) {
     /* Skip block where no remapping is applied */
-    if (clustering_ctx.post_routing_clb_pin_nets.find(blk_id) == clustering_ctx.post_routing_clb_pin_nets.end()) {
+    if (fixup.pin_nets.empty()) {
         return;
     }
 
@@ -1004,7 +1043,7 @@ static void update_cluster_routing_traces_with_post_routing_results(AtomContext&
     t_pb_routes new_pb_routes = pb->pb_route;
 
     /* Cache the current mapping between atom pin to pb_graph pin in this block */
-    std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> previous_atom_pin_to_pb_pin_mapping = cache_atom_pin_to_pb_pin_mapping(const_cast<const AtomContext&>(atom_ctx), intra_lb_pb_pin_lookup, const_cast<const ClusteringContext&>(clustering_ctx), blk_id, pb, logical_block);
+    std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> previous_atom_pin_to_pb_pin_mapping = cache_atom_pin_to_pb_pin_mapping(atom_ctx, intra_lb_pb_pin_lookup, clustering_ctx, fixup, blk_id, pb, logical_block);
 
     update_cluster_regular_routing_traces_with_post_routing_results(atom_ctx,
                                                                     previous_atom_pin_to_pb_pin_mapping,
@@ -1013,16 +1052,16 @@ static void update_cluster_routing_traces_with_post_routing_results(AtomContext&
                                                                     pb,
                                                                     logical_block,
                                                                     new_pb_routes,
-                                                                    num_fixup,
+                                                                    fixup,
                                                                     verbose);
 
-    update_cluster_global_routing_traces_with_post_routing_results(const_cast<const AtomContext&>(atom_ctx),
+    update_cluster_global_routing_traces_with_post_routing_results(atom_ctx,
                                                                    clustering_ctx,
                                                                    blk_id,
                                                                    pb,
                                                                    logical_block,
                                                                    new_pb_routes,
-                                                                   num_fixup,
+                                                                   fixup,
                                                                    verbose);
 
     /* Replace old pb_routes with the new one */
@@ -1067,15 +1106,11 @@ void sync_netlists_to_routing(const Netlist<>& net_list,
 
     IntraLbPbPinLookup intra_lb_pb_pin_lookup(device_ctx.logical_block_types);
 
-    /* Count the number of mismatches and fix-up */
-    size_t num_mismatches = 0;
-    size_t num_fixup = 0;
-
+    /* Collect the clustered blocks to fix up, in netlist order */
+    std::vector<ClusterBlockId> clb_blk_ids;
     std::unordered_set<ClusterBlockId> seen_block_ids;
     seen_block_ids.reserve(clustering_ctx.clb_nlist.blocks().size());
-    /* Update the core logic (center blocks of the FPGA) */
     for (const ParentBlockId& blk_id : net_list.blocks()) {
-        /* We know the entrance to grid info and mapping results, do the fix-up for this block */
         ClusterBlockId clb_blk_id;
         if (is_flat) {
             clb_blk_id = atom_look_up.atom_clb(convert_to_atom_block_id(blk_id));
@@ -1085,26 +1120,69 @@ void sync_netlists_to_routing(const Netlist<>& net_list,
         VTR_ASSERT(clb_blk_id != ClusterBlockId::INVALID());
 
         if (seen_block_ids.insert(clb_blk_id).second) {
-            update_cluster_pin_with_post_routing_results(net_list,
-                                                         atom_ctx,
-                                                         device_ctx,
-                                                         clustering_ctx,
-                                                         rr_node_nets,
-                                                         placement_ctx.block_locs[clb_blk_id].loc,
-                                                         clb_blk_id,
-                                                         num_mismatches,
-                                                         verbose,
-                                                         is_flat);
-
-            update_cluster_routing_traces_with_post_routing_results(atom_ctx,
-                                                                    intra_lb_pb_pin_lookup,
-                                                                    clustering_ctx,
-                                                                    clb_blk_id,
-                                                                    num_fixup,
-                                                                    verbose);
+            clb_blk_ids.push_back(clb_blk_id);
+        }
+    }
+
+    /* Fix up each clustered block on its own: a block only modifies its own pb,
+     * the updates to the shared lookups are kept in its fix-up results
+     */
+    std::vector<t_cluster_pin_fixup> fixups(clb_blk_ids.size());
+    auto fixup_block = [&](size_t iblk) {
+        const ClusterBlockId& clb_blk_id = clb_blk_ids[iblk];
+        update_cluster_pin_with_post_routing_results(net_list,
+                                                     atom_ctx,
+                                                     device_ctx,
+                                                     clustering_ctx,
+                                                     rr_node_nets,
+                                                     placement_ctx.block_locs[clb_blk_id].loc,
+                                                     clb_blk_id,
+                                                     fixups[iblk],
+                                                     verbose,
+                                                     is_flat);
+
+        update_cluster_routing_traces_with_post_routing_results(atom_ctx,
+                                                                intra_lb_pb_pin_lookup,
+                                                                clustering_ctx,
+                                                                clb_blk_id,
+                                                                fixups[iblk],
+                                                                verbose);
+    };
+
+#ifdef VPR_USE_TBB
+    /* Keep the verbose messages of each block together */
+    if (!verbose) {
+        tbb::parallel_for(size_t(0), clb_blk_ids.size(), fixup_block);
+    } else
+#endif
+    {
+        for (size_t iblk = 0; iblk < clb_blk_ids.size(); ++iblk) {
+            fixup_block(iblk);
         }
     }
 
+    /* Merge the fix-up results, in netlist order */
+    size_t num_mismatches = 0;
+    size_t num_fixup = 0;
+    for (size_t iblk = 0; iblk < clb_blk_ids.size(); ++iblk) {
+        t_cluster_pin_fixup& fixup = fixups[iblk];
+        if (!fixup.pin_nets.empty()) {
+            clustering_ctx.post_routing_clb_pin_nets[clb_blk_ids[iblk]] = std::move(fixup.pin_nets);
+        }
+        if (!fixup.pin_mapping.empty()) {
+            clustering_ctx.pre_routing_net_pin_mapping[clb_blk_ids[iblk]] = std::move(fixup.pin_mapping);
+        }
+
+        /* Update the pin binding in atom netlist fast look-up */
+        for (const auto& atom_pin : fixup.atom_pins) {
+            atom_ctx.lookup.set_atom_pin_pb_graph_pin(atom_pin.first, atom_pin.second);
+            VTR_ASSERT(atom_pin.second == atom_ctx.lookup.atom_pin_pb_graph_pin(atom_pin.first));
+        }
+
+        num_mismatches += fixup.num_mismatches;
+        num_fixup += fixup.num_fixup;
+    }
+
     /* Print a short summary */
     VTR_LOG("Found %lu mismatches between routing and packing results.\n",
             num_mismatches);
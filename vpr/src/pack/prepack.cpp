@@ -10,12 +10,17 @@
  * March 12, 2012
  */
 
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <map>
 #include <queue>
 #include <utility>
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 #include "vtr_util.h"
 #include "vtr_assert.h"
 #include "vtr_memory.h"
@@ -43,8 +48,8 @@ static void backward_infer_pattern(t_pb_graph_pin* pb_graph_pin);
 
 static std::vector<t_pack_patterns> alloc_and_init_pattern_list_from_hash(std::unordered_map<std::string, int> pattern_names);
 
-static t_pb_graph_edge* find_expansion_edge_of_pattern(const int pattern_index,
-                                                       const t_pb_graph_node* pb_graph_node);
+static void find_expansion_edges_of_patterns(const t_pb_graph_node* pb_graph_node,
+                                             std::vector<t_pb_graph_edge*>& expansion_edges);
 
 static void forward_expand_pack_pattern_from_edge(const t_pb_graph_edge* expansion_edge,
                                                   t_pack_patterns* list_of_packing_patterns,
@@ -67,8 +72,19 @@ static t_pack_molecule* try_create_molecule(t_pack_patterns* list_of_pack_patter
                                             const int pack_pattern_index,
                                             AtomBlockId blk_id);
 
+static t_pack_molecule* expand_molecule(t_pack_patterns* pack_pattern,
+                                        const AtomBlockId blk_id,
+                                        std::vector<AtomBlockId>* checked_atoms);
+
+static void commit_molecule(t_pack_molecule* molecule, const AtomBlockId blk_id);
+
+static void create_pattern_molecules(t_pack_patterns* list_of_pack_patterns,
+                                     const int pack_pattern_index,
+                                     t_pack_molecule*& list_of_molecules_head);
+
 static bool try_expand_molecule(t_pack_molecule* molecule,
-                                const AtomBlockId blk_id);
+                                const AtomBlockId blk_id,
+                                std::vector<AtomBlockId>* checked_atoms);
 
 static void print_pack_molecules(const char* fname,
                                  const t_pack_patterns* list_of_pack_patterns,
@@ -130,11 +146,19 @@ std::vector<t_pack_patterns> alloc_and_load_pack_patterns() {
 
     list_of_packing_patterns = alloc_and_init_pattern_list_from_hash(pattern_names);
 
+    /* find the first edge of each pattern in each block type, walking each pb_graph once
+     * (rather than once per pattern) */
+    std::vector<std::vector<t_pb_graph_edge*>> type_expansion_edges(device_ctx.logical_block_types.size());
+    for (auto& type : device_ctx.logical_block_types) {
+        type_expansion_edges[type.index].resize(pattern_names.size(), nullptr);
+        find_expansion_edges_of_patterns(type.pb_graph_head, type_expansion_edges[type.index]);
+    }
+
     /* load packing patterns by traversing the edges to find edges belonging to pattern */
     for (size_t i = 0; i < pattern_names.size(); i++) {
         for (auto& type : device_ctx.logical_block_types) {
             // find an edge that belongs to this pattern
-            expansion_edge = find_expansion_edge_of_pattern(i, type.pb_graph_head);
+            expansion_edge = type_expansion_edges[type.index][i];
             if (!expansion_edge) {
                 continue;
             }
@@ -367,71 +391,54 @@ void free_pack_pattern(t_pack_patterns* pack_pattern) {
 }
 
 /**
- * Locate first edge that belongs to pattern index
+ * Locate the first edge that belongs to each pattern index (entries already set are kept)
  */
-static t_pb_graph_edge* find_expansion_edge_of_pattern(const int pattern_index,
-                                                       const t_pb_graph_node* pb_graph_node) {
-    int i, j, k, m;
-    t_pb_graph_edge* edge;
-    /* Iterate over all edges to discover if an edge in current physical block belongs to a pattern
-     * If edge does, then return that edge
+static void find_expansion_edges_of_patterns(const t_pb_graph_node* pb_graph_node,
+                                             std::vector<t_pb_graph_edge*>& expansion_edges) {
+    /* Iterate over all edges to record the first edge (in depth-first order, pins of a node before
+     * its children) in the current physical block which belongs to each pattern
      */
-
     if (pb_graph_node == nullptr) {
-        return nullptr;
+        return;
     }
 
-    for (i = 0; i < pb_graph_node->num_input_ports; i++) {
-        for (j = 0; j < pb_graph_node->num_input_pins[i]; j++) {
-            auto& input_pin = pb_graph_node->input_pins[i][j];
-            for (k = 0; k < input_pin.num_output_edges; k++) {
-                for (m = 0; m < input_pin.output_edges[k]->num_pack_patterns; m++) {
-                    if (input_pin.output_edges[k]->pack_pattern_indices[m] == pattern_index) {
-                        return input_pin.output_edges[k];
-                    }
+    auto record_pin_edges = [&](const t_pb_graph_pin& pin) {
+        for (int k = 0; k < pin.num_output_edges; k++) {
+            for (int m = 0; m < pin.output_edges[k]->num_pack_patterns; m++) {
+                int pattern_index = pin.output_edges[k]->pack_pattern_indices[m];
+                if (expansion_edges[pattern_index] == nullptr) {
+                    expansion_edges[pattern_index] = pin.output_edges[k];
                 }
             }
         }
+    };
+
+    for (int i = 0; i < pb_graph_node->num_input_ports; i++) {
+        for (int j = 0; j < pb_graph_node->num_input_pins[i]; j++) {
+            record_pin_edges(pb_graph_node->input_pins[i][j]);
+        }
     }
 
-    for (i = 0; i < pb_graph_node->num_output_ports; i++) {
-        for (j = 0; j < pb_graph_node->num_output_pins[i]; j++) {
-            auto& output_pin = pb_graph_node->output_pins[i][j];
-            for (k = 0; k < output_pin.num_output_edges; k++) {
-                for (m = 0; m < output_pin.output_edges[k]->num_pack_patterns; m++) {
-                    if (output_pin.output_edges[k]->pack_pattern_indices[m] == pattern_index) {
-                        return output_pin.output_edges[k];
-                    }
-                }
-            }
+    for (int i = 0; i < pb_graph_node->num_output_ports; i++) {
+        for (int j = 0; j < pb_graph_node->num_output_pins[i]; j++) {
+            record_pin_edges(pb_graph_node->output_pins[i][j]);
         }
     }
 
-    for (i = 0; i < pb_graph_node->num_clock_ports; i++) {
-        for (j = 0; j < pb_graph_node->num_clock_pins[i]; j++) {
-            auto& clock_pin = pb_graph_node->clock_pins[i][j];
-            for (k = 0; k < clock_pin.num_output_edges; k++) {
-                for (m = 0; m < clock_pin.output_edges[k]->num_pack_patterns; m++) {
-                    if (clock_pin.output_edges[k]->pack_pattern_indices[m] == pattern_index) {
-                        return clock_pin.output_edges[k];
-                    }
-                }
-            }
+    for (int i = 0; i < pb_graph_node->num_clock_ports; i++) {
+        for (int j = 0; j < pb_graph_node->num_clock_pins[i]; j++) {
+            record_pin_edges(pb_graph_node->clock_pins[i][j]);
         }
     }
 
-    for (i = 0; i < pb_graph_node->pb_type->num_modes; i++) {
+    for (int i = 0; i < pb_graph_node->pb_type->num_modes; i++) {
         auto& pb_mode = pb_graph_node->pb_type->modes[i];
-        for (j = 0; j < pb_mode.num_pb_type_children; j++) {
-            for (k = 0; k < pb_mode.pb_type_children[j].num_pb; k++) {
-                edge = find_expansion_edge_of_pattern(pattern_index, &pb_graph_node->child_pb_graph_nodes[i][j][k]);
-                if (edge != nullptr) {
-                    return edge;
-                }
+        for (int j = 0; j < pb_mode.num_pb_type_children; j++) {
+            for (int k = 0; k < pb_mode.pb_type_children[j].num_pb; k++) {
+                find_expansion_edges_of_patterns(&pb_graph_node->child_pb_graph_nodes[i][j][k], expansion_edges);
             }
         }
     }
-    return nullptr;
 }
 
 /**
@@ -813,36 +820,7 @@ t_pack_molecule* alloc_and_load_pack_molecules(t_pack_patterns* list_of_pack_pat
         VTR_ASSERT(is_used[best_pattern] == false);
         is_used[best_pattern] = true;
 
-        auto blocks = atom_ctx.nlist.blocks();
-        for (auto blk_iter = blocks.begin(); blk_iter != blocks.end(); ++blk_iter) {
-            auto blk_id = *blk_iter;
-
-            cur_molecule = try_create_molecule(list_of_pack_patterns, best_pattern, blk_id);
-            if (cur_molecule != nullptr) {
-                cur_molecule->next = list_of_molecules_head;
-                /* In the event of multiple molecules with the same atom block pattern,
-                 * bias to use the molecule with less costly physical resources first */
-                /* TODO: Need to normalize magical number 100 */
-                cur_molecule->base_gain = cur_molecule->num_blocks - (cur_molecule->pack_pattern->base_cost / 100);
-                list_of_molecules_head = cur_molecule;
-
-                //Note: atom_molecules is an (ordered) multimap so the last molecule
-                //      inserted for a given blk_id will be the last valid element
-                //      in the equal_range
-                auto rng = atom_ctx.atom_molecules.equal_range(blk_id); //The range of molecules matching this block
-                bool range_empty = (rng.first == rng.second);
-                bool cur_was_last_inserted = false;
-                if (!range_empty) {
-                    auto last_valid_iter = --rng.second; //Iterator to last element (only valid if range is not empty)
-                    cur_was_last_inserted = (last_valid_iter->second == cur_molecule);
-                }
-                if (range_empty || !cur_was_last_inserted) {
-                    /* molecule did not cover current atom (possibly because molecule created is
-                     * part of a long chain that extends past multiple logic blocks), try again */
-                    --blk_iter;
-                }
-            }
-        }
+        create_pattern_molecules(list_of_pack_patterns, best_pattern, list_of_molecules_head);
     }
     delete[] is_used;
 
@@ -851,9 +829,24 @@ t_pack_molecule* alloc_and_load_pack_molecules(t_pack_patterns* list_of_pack_pat
      *
      * If a block belongs to a molecule, then carrying the single atoms around can make the packing problem
      * more difficult because now it needs to consider splitting molecules.
+     *
+     * The lowest cost primitives are independent of each other, so they are found in parallel first.
      */
-    for (auto blk_id : atom_ctx.nlist.blocks()) {
-        t_pb_graph_node* best = get_expected_lowest_cost_primitive_for_atom_block(blk_id);
+    auto blocks = atom_ctx.nlist.blocks();
+    std::vector<t_pb_graph_node*> best_primitives(blocks.size(), nullptr);
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), blocks.size(), [&](size_t i) {
+        best_primitives[i] = get_expected_lowest_cost_primitive_for_atom_block(*(blocks.begin() + i));
+    });
+#else
+    for (size_t i = 0; i < blocks.size(); i++) {
+        best_primitives[i] = get_expected_lowest_cost_primitive_for_atom_block(*(blocks.begin() + i));
+    }
+#endif
+
+    for (size_t i = 0; i < blocks.size(); i++) {
+        AtomBlockId blk_id = *(blocks.begin() + i);
+        t_pb_graph_node* best = best_primitives[i];
         if (!best) {
             /* Free the molecules in the linked list to avoid memory leakage */
             cur_molecule = list_of_molecules_head;
@@ -934,10 +927,6 @@ static void free_pack_pattern_block(t_pack_pattern_block* pattern_block, t_pack_
 static t_pack_molecule* try_create_molecule(t_pack_patterns* list_of_pack_patterns,
                                             const int pack_pattern_index,
                                             AtomBlockId blk_id) {
-    t_pack_molecule* molecule;
-
-    auto& atom_mutable_ctx = g_vpr_ctx.mutable_atom();
-
     auto pack_pattern = &list_of_pack_patterns[pack_pattern_index];
 
     // Check pack pattern validity
@@ -952,7 +941,26 @@ static t_pack_molecule* try_create_molecule(t_pack_patterns* list_of_pack_patter
         if (!blk_id) return nullptr;
     }
 
-    molecule = new t_pack_molecule;
+    t_pack_molecule* molecule = expand_molecule(pack_pattern, blk_id, nullptr);
+    if (molecule) {
+        // Success! commit molecule
+        commit_molecule(molecule, blk_id);
+    }
+
+    return molecule;
+}
+
+/**
+ * Returns the molecule of pack_pattern rooted at the atom blk_id, or nullptr if it can't be formed
+ * from the atoms not yet in a molecule. The atom_molecules are only read (not updated), so this
+ * can be called concurrently.
+ *
+ * If checked_atoms isn't null, the atoms whose membership to a molecule were checked are appended to it.
+ */
+static t_pack_molecule* expand_molecule(t_pack_patterns* pack_pattern,
+                                        const AtomBlockId blk_id,
+                                        std::vector<AtomBlockId>* checked_atoms) {
+    t_pack_molecule* molecule = new t_pack_molecule;
     molecule->valid = true;
     molecule->type = MOLECULE_FORCED_PACK;
     molecule->pack_pattern = pack_pattern;
@@ -960,31 +968,129 @@ static t_pack_molecule* try_create_molecule(t_pack_patterns* list_of_pack_patter
     molecule->num_blocks = pack_pattern->num_blocks;
     molecule->root = pack_pattern->root_block->block_id;
 
-    if (try_expand_molecule(molecule, blk_id)) {
-        // Success! commit molecule
+    if (!try_expand_molecule(molecule, blk_id, checked_atoms)) {
+        // Failed to create molecule
+        delete molecule;
+        return nullptr;
+    }
 
-        // update chain info for chain molecules
-        if (molecule->pack_pattern->is_chain) {
-            init_molecule_chain_info(blk_id, molecule);
+    return molecule;
+}
+
+/* Links the atoms of the (expanded) molecule, rooted at the atom blk_id, to it */
+static void commit_molecule(t_pack_molecule* molecule, const AtomBlockId blk_id) {
+    auto& atom_mutable_ctx = g_vpr_ctx.mutable_atom();
+
+    // update chain info for chain molecules
+    if (molecule->pack_pattern->is_chain) {
+        init_molecule_chain_info(blk_id, molecule);
+    }
+
+    // update the atom_molcules with the atoms that are mapped to this molecule
+    for (int i = 0; i < molecule->pack_pattern->num_blocks; i++) {
+        auto blk_id2 = molecule->atom_block_ids[i];
+        if (!blk_id2) {
+            VTR_ASSERT(molecule->pack_pattern->is_block_optional[i]);
+            continue;
         }
 
-        // update the atom_molcules with the atoms that are mapped to this molecule
-        for (int i = 0; i < molecule->pack_pattern->num_blocks; i++) {
-            auto blk_id2 = molecule->atom_block_ids[i];
-            if (!blk_id2) {
-                VTR_ASSERT(molecule->pack_pattern->is_block_optional[i]);
-                continue;
+        atom_mutable_ctx.atom_molecules.insert({blk_id2, molecule});
+    }
+}
+
+/**
+ * Creates the molecules of the pack pattern pack_pattern_index, using first-fit in atom block order,
+ * and adds them at the head of list_of_molecules_head.
+ *
+ * With TBB, the molecules rooted at each atom of non-chain patterns are first expanded speculatively
+ * in parallel (against the molecules of the previously processed patterns), then committed serially
+ * in atom block order: a speculative molecule (or failure) is kept unless one of the atoms its
+ * expansion checked was claimed by a molecule committed before it, in which case it is re-created.
+ * This gives the same molecules as the serial first-fit loop.
+ *
+ * Chains stay serial: their roots are searched up the chain for the furthest atom not yet in a molecule,
+ * so the molecule found from an atom depends on all the molecules created before it.
+ */
+static void create_pattern_molecules(t_pack_patterns* list_of_pack_patterns,
+                                     const int pack_pattern_index,
+                                     t_pack_molecule*& list_of_molecules_head) {
+    auto& atom_ctx = g_vpr_ctx.atom();
+    auto blocks = atom_ctx.nlist.blocks();
+
+    std::vector<t_pack_molecule*> speculative_molecules;
+    std::vector<std::vector<AtomBlockId>> speculative_checked_atoms;
+    //Atoms claimed by the molecules of this pattern (only tracked when speculating)
+    vtr::vector<AtomBlockId, bool> claimed;
+
+#ifdef VPR_USE_TBB
+    t_pack_patterns* pack_pattern = &list_of_pack_patterns[pack_pattern_index];
+    if (!pack_pattern->is_chain && pack_pattern->num_blocks > 0 && pack_pattern->root_block != nullptr) {
+        speculative_molecules.resize(blocks.size(), nullptr);
+        speculative_checked_atoms.resize(blocks.size());
+        claimed.resize(blocks.size(), false);
+        tbb::parallel_for(size_t(0), blocks.size(), [&](size_t i) {
+            speculative_molecules[i] = expand_molecule(pack_pattern, *(blocks.begin() + i), &speculative_checked_atoms[i]);
+        });
+    }
+#endif
+
+    for (size_t i = 0; i < blocks.size(); i++) {
+        AtomBlockId blk_id = *(blocks.begin() + i);
+
+        t_pack_molecule* cur_molecule = nullptr;
+        if (!speculative_molecules.empty()) {
+            const auto& checked_atoms = speculative_checked_atoms[i];
+            bool speculation_valid = std::none_of(checked_atoms.begin(), checked_atoms.end(),
+                                                  [&](AtomBlockId checked_blk_id) { return claimed[checked_blk_id]; });
+            if (speculation_valid) {
+                cur_molecule = speculative_molecules[i];
+                if (cur_molecule) {
+                    commit_molecule(cur_molecule, blk_id);
+                }
+            } else {
+                delete speculative_molecules[i];
+                cur_molecule = try_create_molecule(list_of_pack_patterns, pack_pattern_index, blk_id);
+            }
+            vtr::release_memory(speculative_checked_atoms[i]);
+        } else {
+            cur_molecule = try_create_molecule(list_of_pack_patterns, pack_pattern_index, blk_id);
+        }
+
+        while (cur_molecule != nullptr) {
+            cur_molecule->next = list_of_molecules_head;
+            /* In the event of multiple molecules with the same atom block pattern,
+             * bias to use the molecule with less costly physical resources first */
+            /* TODO: Need to normalize magical number 100 */
+            cur_molecule->base_gain = cur_molecule->num_blocks - (cur_molecule->pack_pattern->base_cost / 100);
+            list_of_molecules_head = cur_molecule;
+
+            if (!claimed.empty()) {
+                for (AtomBlockId molecule_blk_id : cur_molecule->atom_block_ids) {
+                    if (molecule_blk_id) {
+                        claimed[molecule_blk_id] = true;
+                    }
+                }
             }
 
-            atom_mutable_ctx.atom_molecules.insert({blk_id2, molecule});
+            //Note: atom_molecules is an (ordered) multimap so the last molecule
+            //      inserted for a given blk_id will be the last valid element
+            //      in the equal_range
+            auto rng = atom_ctx.atom_molecules.equal_range(blk_id); //The range of molecules matching this block
+            bool range_empty = (rng.first == rng.second);
+            bool cur_was_last_inserted = false;
+            if (!range_empty) {
+                auto last_valid_iter = --rng.second; //Iterator to last element (only valid if range is not empty)
+                cur_was_last_inserted = (last_valid_iter->second == cur_molecule);
+            }
+            if (!range_empty && cur_was_last_inserted) {
+                break;
+            }
+
+            /* molecule did not cover current atom (possibly because molecule created is
+             * part of a long chain that extends past multiple logic blocks), try again */
+            cur_molecule = try_create_molecule(list_of_pack_patterns, pack_pattern_index, blk_id);
         }
-    } else {
-        // Failed to create molecule
-        delete molecule;
-        return nullptr;
     }
-
-    return molecule;
 }
 
 /**
@@ -999,9 +1105,11 @@ static t_pack_molecule* try_create_molecule(t_pack_patterns* list_of_pack_patter
  *      molecule       : the molecule we are trying to expand
  *      atom_molecules : map of atom block ids that are assigned a molecule and a pointer to this molecule
  *      blk_id         : chosen to be the root of this molecule and the code is expanding from
+ *      checked_atoms  : if not null, the atoms checked against atom_molecules are appended to it
  */
 static bool try_expand_molecule(t_pack_molecule* molecule,
-                                const AtomBlockId blk_id) {
+                                const AtomBlockId blk_id,
+                                std::vector<AtomBlockId>* checked_atoms) {
     auto& atom_ctx = g_vpr_ctx.atom();
 
     // root block of the pack pattern, which is the starting point of this pattern
@@ -1035,7 +1143,12 @@ static bool try_expand_molecule(t_pack_molecule* molecule,
             continue;
         }
 
-        if (!block_id || !primitive_type_feasible(block_id, pattern_block->pb_type) || (molecule_atom_block_id && molecule_atom_block_id != block_id) || atom_ctx.atom_molecules.find(block_id) != atom_ctx.atom_molecules.end()) {
+        bool block_fits = block_id && primitive_type_feasible(block_id, pattern_block->pb_type) && !(molecule_atom_block_id && molecule_atom_block_id != block_id);
+        if (block_fits && checked_atoms) {
+            checked_atoms->push_back(block_id);
+        }
+
+        if (!block_fits || atom_ctx.atom_molecules.find(block_id) != atom_ctx.atom_molecules.end()) {
             // Stopping conditions, if:
             // 1) this is an invalid atom block (nothing)
             // 2) this atom block cannot fit in this primitive type
@@ -1302,7 +1415,6 @@ static int compare_pack_pattern(const t_pack_patterns* pattern_a, const t_pack_p
  * list_of_pack_pattern: ptr to current chain pattern
  */
 static AtomBlockId find_new_root_atom_for_chain(const AtomBlockId blk_id, const t_pack_patterns* list_of_pack_pattern) {
-    AtomBlockId new_root_blk_id;
     t_pb_graph_pin* root_ipin;
     t_pb_graph_node* root_pb_graph_node;
     t_model_ports* model_port;
@@ -1318,32 +1430,35 @@ static AtomBlockId find_new_root_atom_for_chain(const AtomBlockId blk_id, const
         return AtomBlockId::INVALID();
     }
 
-    /* Assign driver furthest up the chain that matches the root node and is unassigned to a molecule as the root */
+    /* Assign driver furthest up the chain that matches the root node and is unassigned to a molecule as the root.
+     * The chain is walked iteratively, since long carry chains would otherwise recurse very deeply */
     model_port = root_ipin->port->model_port;
 
-    // find the block id of the atom block driving the input of this block
-    AtomBlockId driver_blk_id = atom_ctx.nlist.find_atom_pin_driver(blk_id, model_port, root_ipin->pin_number);
+    AtomBlockId root_blk_id = blk_id;
+    while (true) {
+        // find the block id of the atom block driving the input of this block
+        AtomBlockId driver_blk_id = atom_ctx.nlist.find_atom_pin_driver(root_blk_id, model_port, root_ipin->pin_number);
 
-    // if there is no driver block for this net
-    // then it is the furthest up the chain
-    if (!driver_blk_id) {
-        return blk_id;
-    }
-    // check if driver atom is already packed
-    auto rng = atom_ctx.atom_molecules.equal_range(driver_blk_id);
-    bool rng_empty = (rng.first == rng.second);
-    if (!rng_empty) {
-        /* Driver is used/invalid, so current block is the furthest up the chain, return it */
-        return blk_id;
-    }
+        // if there is no driver block for this net
+        // then it is the furthest up the chain
+        if (!driver_blk_id) {
+            return root_blk_id;
+        }
+        // check if driver atom is already packed
+        auto rng = atom_ctx.atom_molecules.equal_range(driver_blk_id);
+        bool rng_empty = (rng.first == rng.second);
+        if (!rng_empty) {
+            /* Driver is used/invalid, so current block is the furthest up the chain, return it */
+            return root_blk_id;
+        }
 
-    // didn't find furthest atom up the chain, keep searching further up the chain
-    new_root_blk_id = find_new_root_atom_for_chain(driver_blk_id, list_of_pack_pattern);
+        // a driver which doesn't match the root node ends the chain
+        if (primitive_type_feasible(driver_blk_id, root_pb_graph_node->pb_type) == false) {
+            return root_blk_id;
+        }
 
-    if (!new_root_blk_id) {
-        return blk_id;
-    } else {
-        return new_root_blk_id;
+        // didn't find furthest atom up the chain, keep searching further up the chain
+        root_blk_id = driver_blk_id;
     }
 }
 
@@ -1,4 +1,9 @@
 #include "re_cluster.h"
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 #include "re_cluster_util.h"
 #include "initial_placement.h"
 #include "cluster_placement.h"
@@ -280,3 +285,78 @@ bool swap_two_molecules(t_pack_molecule* molecule_1,
     return true;
 }
 #endif
+
+/* Returns true if old_clb still routes once molecule is removed. Only reads the clustering, so it can be
+ * called concurrently. */
+static bool is_mol_removal_legal(const t_pack_molecule* molecule,
+                                 const ClusterBlockId& old_clb,
+                                 const std::unordered_set<AtomBlockId>& old_clb_atoms) {
+    auto& helper_ctx = g_vpr_ctx.cl_helper();
+
+    std::unordered_set<AtomBlockId> remaining_atoms(old_clb_atoms);
+    int molecule_size = get_array_size_of_molecule(molecule);
+    for (int i_atom = 0; i_atom < molecule_size; i_atom++) {
+        if (molecule->atom_block_ids[i_atom]) {
+            remaining_atoms.erase(molecule->atom_block_ids[i_atom]);
+        }
+    }
+
+    t_lb_router_data* router_data = lb_load_router_data(helper_ctx.lb_type_rr_graphs, old_clb, &remaining_atoms);
+    bool is_legal = is_cluster_legal(router_data);
+    free_router_data(router_data);
+    return is_legal;
+}
+
+std::vector<t_mol_move_candidate> find_feasible_mol_moves(const std::vector<t_mol_move_candidate>& candidates,
+                                                          int verbosity) {
+    //Serially reject the incompatible candidates, and collect the distinct molecules to remove.
+    //The clb-->atoms lookup is built lazily, so it is also completed here before routing concurrently.
+    std::vector<t_pack_molecule*> molecules;
+    std::vector<ClusterBlockId> old_clbs;
+    std::unordered_map<const t_pack_molecule*, int> molecule_index;
+    std::vector<int> candidate_molecule(candidates.size(), OPEN);
+    for (size_t i = 0; i < candidates.size(); i++) {
+        t_pack_molecule* molecule = candidates[i].molecule;
+        ClusterBlockId old_clb = atom_to_cluster(molecule->atom_block_ids[molecule->root]);
+
+        if (old_clb == candidates[i].new_clb) {
+            VTR_LOGV(verbosity > 4, "Move aborted. The molecule is already in the new cluster.\n");
+            continue;
+        }
+        if (!check_type_and_mode_compitability(old_clb, candidates[i].new_clb, verbosity)) {
+            continue;
+        }
+        if (cluster_to_atoms(old_clb)->size() == 1) {
+            VTR_LOGV(verbosity > 4, "Atom: %zu move failed. This is the last atom in its cluster.\n", size_t(molecule->atom_block_ids[molecule->root]));
+            continue;
+        }
+
+        auto result = molecule_index.insert(std::make_pair(molecule, int(molecules.size())));
+        if (result.second) {
+            molecules.push_back(molecule);
+            old_clbs.push_back(old_clb);
+        }
+        candidate_molecule[i] = result.first->second;
+    }
+
+    //Route the old clusters without their molecules
+    std::vector<char> is_removal_legal(molecules.size(), false);
+    auto& helper_ctx = g_vpr_ctx.cl_helper();
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), molecules.size(), [&](size_t i) {
+        is_removal_legal[i] = is_mol_removal_legal(molecules[i], old_clbs[i], helper_ctx.atoms_lookup[old_clbs[i]]);
+    });
+#else
+    for (size_t i = 0; i < molecules.size(); i++) {
+        is_removal_legal[i] = is_mol_removal_legal(molecules[i], old_clbs[i], helper_ctx.atoms_lookup[old_clbs[i]]);
+    }
+#endif
+
+    std::vector<t_mol_move_candidate> feasible_moves;
+    for (size_t i = 0; i < candidates.size(); i++) {
+        if (candidate_molecule[i] != OPEN && is_removal_legal[candidate_molecule[i]]) {
+            feasible_moves.push_back(candidates[i]);
+        }
+    }
+    return feasible_moves;
+}
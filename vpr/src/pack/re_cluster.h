@@ -57,4 +57,26 @@ bool swap_two_molecules(t_pack_molecule* molecule_1,
                         bool during_packing,
                         int verbosity,
                         t_clustering_data& clustering_data);
+
+///@brief A candidate move of a molecule to an existing cluster
+struct t_mol_move_candidate {
+    t_pack_molecule* molecule = nullptr;
+    ClusterBlockId new_clb;
+};
+
+/**
+ * @brief This function screens a batch of candidate molecule moves, and returns (in order) those which may be legal.
+ *
+ * A candidate is kept if the old and new clusters are compatible and the old cluster still routes once the
+ * molecule is removed. The removals are routed concurrently (when VPR is built with TBB), each on router data
+ * of its own built from a copy of the old cluster atoms, and only once per distinct molecule; the clustering
+ * is not modified.
+ *
+ * Packing the molecule into the new cluster updates the shared pb and atom lookup state, so it is only checked
+ * when the move is applied with move_mol_to_existing_cluster() (which may still reject the move). Since the
+ * candidates are evaluated against the current clustering, applying a candidate may invalidate the others
+ * involving the same clusters.
+ */
+std::vector<t_mol_move_candidate> find_feasible_mol_moves(const std::vector<t_mol_move_candidate>& candidates,
+                                                          int verbosity);
 #endif
@@ -71,6 +71,7 @@ void create_move_generators(std::unique_ptr<MoveGenerator>& move_generator,
                                                                             placer_opts.place_agent_epsilon);
             }
             karmed_bandit_agent1->set_step(placer_opts.place_agent_gamma, move_lim);
+            karmed_bandit_agent1->set_update_window(placer_opts.place_agent_update_window);
             move_generator = std::make_unique<SimpleRLMoveGenerator>(karmed_bandit_agent1,
                                                                      noc_attraction_weight,
                                                                      placer_opts.place_high_fanout_net);
@@ -79,6 +80,7 @@ void create_move_generators(std::unique_ptr<MoveGenerator>& move_generator,
                                                                         e_agent_space::MOVE_TYPE,
                                                                         placer_opts.place_agent_epsilon);
             karmed_bandit_agent2->set_step(placer_opts.place_agent_gamma, move_lim);
+            karmed_bandit_agent2->set_update_window(placer_opts.place_agent_update_window);
             move_generator2 = std::make_unique<SimpleRLMoveGenerator>(karmed_bandit_agent2,
                                                                       noc_attraction_weight,
                                                                       placer_opts.place_high_fanout_net);
@@ -95,6 +97,7 @@ void create_move_generators(std::unique_ptr<MoveGenerator>& move_generator,
                                                                       e_agent_space::MOVE_TYPE);
             }
             karmed_bandit_agent1->set_step(placer_opts.place_agent_gamma, move_lim);
+            karmed_bandit_agent1->set_update_window(placer_opts.place_agent_update_window);
             move_generator = std::make_unique<SimpleRLMoveGenerator>(karmed_bandit_agent1,
                                                                      noc_attraction_weight,
                                                                      placer_opts.place_high_fanout_net);
@@ -102,6 +105,7 @@ void create_move_generators(std::unique_ptr<MoveGenerator>& move_generator,
             karmed_bandit_agent2 = std::make_unique<SoftmaxAgent>(second_state_avail_moves,
                                                                   e_agent_space::MOVE_TYPE);
             karmed_bandit_agent2->set_step(placer_opts.place_agent_gamma, move_lim);
+            karmed_bandit_agent2->set_update_window(placer_opts.place_agent_update_window);
             move_generator2 = std::make_unique<SimpleRLMoveGenerator>(karmed_bandit_agent2,
                                                                       noc_attraction_weight,
                                                                       placer_opts.place_high_fanout_net);
@@ -16,6 +16,10 @@
 #    include "vpr_utils.h"
 #    include "place_util.h"
 
+#    ifdef VPR_USE_TBB
+#        include <tbb/parallel_invoke.h>
+#    endif
+
 // Templated struct for constructing and solving matrix equations in analytic placer
 template<typename T>
 struct EquationSystem {
@@ -283,8 +287,16 @@ void AnalyticPlacer::build_solve_type(t_logical_block_type_ptr run, int iter) {
     setup_solve_blks(run);
     // build and solve matrix equation for both x, y
     // passing -1 as iter to build_solve_direction() signals build_equation() not to add pseudo-connections
-    build_solve_direction(false, (iter == 0) ? -1 : iter, ap_cfg.buildSolveIter);
-    build_solve_direction(true, (iter == 0) ? -1 : iter, ap_cfg.buildSolveIter);
+    // the x and y problems only read and write their own coordinate of blk_locs, so they are solved concurrently
+    // (the block types are still solved one after another: each type's legalization feeds the next type's equations)
+    auto solve_x = [&]() { build_solve_direction(false, (iter == 0) ? -1 : iter, ap_cfg.buildSolveIter); };
+    auto solve_y = [&]() { build_solve_direction(true, (iter == 0) ? -1 : iter, ap_cfg.buildSolveIter); };
+#    ifdef VPR_USE_TBB
+    tbb::parallel_invoke(solve_x, solve_y);
+#    else
+    solve_x();
+    solve_y();
+#    endif
     update_macros(); // update macro member locations, since only macro head is solved
 }
 
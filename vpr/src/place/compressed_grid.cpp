@@ -13,20 +13,14 @@ std::vector<t_compressed_block_grid> create_compressed_block_grids() {
         block_locations[block_type_num].resize(num_layers);
     }
 
-    for (int layer_num = 0; layer_num < num_layers; layer_num++) {
-        for (int x = 0; x < (int)grid.width(); ++x) {
-            for (int y = 0; y < (int)grid.height(); ++y) {
-                int width_offset = grid.get_width_offset({x, y, layer_num});
-                int height_offset = grid.get_height_offset(t_physical_tile_loc(x, y, layer_num));
-                if (width_offset == 0 && height_offset == 0) {
-                    const auto& type = grid.get_physical_type({x, y, layer_num});
-                    auto equivalent_sites = get_equivalent_sites_set(type);
-
-                    for (auto& block : equivalent_sites) {
-                        //Only record at block root location
-                        block_locations[block->index][layer_num].emplace_back(x, y);
-                    }
-                }
+    for (const auto& physical_tile : device_ctx.physical_tile_types) {
+        auto equivalent_sites = get_equivalent_sites_set(&physical_tile);
+        if (equivalent_sites.empty()) continue;
+
+        //Only record at block root locations
+        for (const t_physical_tile_loc& loc : grid.tile_locations(&physical_tile, -1)) {
+            for (auto& block : equivalent_sites) {
+                block_locations[block->index][loc.layer_num].emplace_back(loc.x, loc.y);
             }
         }
     }
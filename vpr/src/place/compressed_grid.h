@@ -109,6 +109,18 @@ struct t_compressed_block_grid {
 //the may be physically far apart
 typedef std::vector<t_compressed_block_grid> t_compressed_block_grids;
 
+/**
+ * @brief The locations of a compressed block grid which a floorplan constraint allows
+ *
+ * Stored (like the compressed grid) by sorted columns, each with the sorted rows of its
+ * legal locations, so the legal locations within a compressed search range can be counted
+ * and sampled without visiting the illegal ones.
+ */
+struct t_compressed_legal_sites {
+    std::vector<std::vector<int>> columns;           // [0...num_layers-1][0...num_legal_columns-1] -> cx
+    std::vector<std::vector<std::vector<int>>> rows; // [0...num_layers-1][0...num_legal_columns-1] -> sorted cy of the column's legal locations
+};
+
 std::vector<t_compressed_block_grid> create_compressed_block_grids();
 
 t_compressed_block_grid create_compressed_block_grid(const std::vector<std::vector<vtr::Point<int>>>& locations, int num_layers);
@@ -4,8 +4,13 @@
 #    include <iostream>
 #    include <vector>
 #    include <queue>
+#    include <optional>
 #    include <cstdlib>
 
+#    ifdef VPR_USE_TBB
+#        include <tbb/parallel_for.h>
+#    endif
+
 #    include "analytic_placer.h"
 #    include "vpr_types.h"
 #    include "vtr_time.h"
@@ -63,48 +68,68 @@ void CutSpreader::cutSpread() {
     expand_regions();        // expand overused regions until they have enough sub_tiles to accommodate their logic blks
 
     /*
-     * workqueue is a FIFO queue used to recursively cut-spread.
-     *
-     * In the region vector, the regions not in merged_regions (not absorbed in expansion process)
-     * are the initial regions placed in workqueue to cut-spread.
+     * Regions are cut in waves. The first wave holds the regions that are not in merged_regions
+     * (not absorbed in expansion process).
      *
-     * After each of these initial regions are cut and spread, their child sub-regions
-     * (left and right) are placed at the back of workqueue, with alternated cut direction.
-     * This process continues until base case of region with only 1 block is reached,
-     * indicated by BASE_CASE return value.
+     * After each region of a wave is cut and spread, its child sub-regions (left and right) are
+     * placed in the next wave, with alternated cut direction. This process continues until base
+     * case of region with only 1 block is reached, indicated by BASE_CASE return value.
      *
      * Return value of CUT_FAIL indicates that cutting is unsuccessful. This usually happens
      * when regions are quite small: for example, region only has 1 column so a vertical cut
      * is impossible. In this case cut in the other direction is attempted.
+     *
+     * The regions of a wave never overlap and cut_region() only touches the grid locations and
+     * blocks inside the region it cuts, so the regions of a wave are cut in parallel. Processing
+     * the waves in order visits the regions in the same order as a FIFO workqueue would, and the
+     * children IDs are reserved in wave order, so the result doesn't depend on the number of threads.
      */
-    std::queue<std::pair<int, bool>> workqueue;
+    std::vector<std::pair<int, bool>> wave, next_wave;
 
-    // put initial regions into workqueue
+    // put initial regions into the first wave
     for (auto& r : regions) {
         if (!merged_regions.count(r.id))
-            workqueue.emplace(r.id, false);
+            wave.emplace_back(r.id, false);
     }
 
-    while (!workqueue.empty()) {
-        auto front = workqueue.front();
-        workqueue.pop();
-        auto& r = regions.at(front.first);
-
-        auto res = cut_region(r, front.second);
-        if (res == BASE_CASE) // only 1 block left, base case
-            continue;
-        if (res != CUT_FAIL) { // cut-spread successful
-                               // place children regions in workqueue
-            workqueue.emplace(res.first, !front.second);
-            workqueue.emplace(res.second, !front.second);
-        } else {                                      // cut-spread unsuccessful
-            auto res2 = cut_region(r, !front.second); // try other direction
-            if (res2 != CUT_FAIL) {
-                // place children regions in workqueue
-                workqueue.emplace(res2.first, front.second);
-                workqueue.emplace(res2.second, front.second);
+    while (!wave.empty()) {
+        // reserve 2 children IDs for each region of the wave, so that regions is not resized while cutting
+        int first_child_id = int(regions.size());
+        regions.resize(regions.size() + 2 * wave.size(), SpreaderRegion{AP_NO_REGION, {}, 0, 0});
+
+        // cut direction that succeeded for each region of the wave, or nullopt if no children were created
+        std::vector<std::optional<bool>> cut_dir(wave.size());
+        auto cut_wave_region = [&](size_t i) {
+            auto& r = regions.at(wave[i].first);
+            int child_id = first_child_id + 2 * int(i);
+
+            auto res = cut_region(r, wave[i].second, child_id);
+            if (res == BASE_CASE) // only 1 block left, base case
+                return;
+            if (res != CUT_FAIL) { // cut-spread successful
+                cut_dir[i] = wave[i].second;
+            } else if (cut_region(r, !wave[i].second, child_id) != CUT_FAIL) { // try other direction
+                cut_dir[i] = !wave[i].second;
             }
+        };
+
+#    ifdef VPR_USE_TBB
+        tbb::parallel_for(size_t(0), wave.size(), cut_wave_region);
+#    else
+        for (size_t i = 0; i < wave.size(); i++)
+            cut_wave_region(i);
+#    endif
+
+        // place children regions in the next wave
+        next_wave.clear();
+        for (size_t i = 0; i < wave.size(); i++) {
+            if (!cut_dir[i])
+                continue;
+            int child_id = first_child_id + 2 * int(i);
+            next_wave.emplace_back(child_id, !*cut_dir[i]);
+            next_wave.emplace_back(child_id + 1, !*cut_dir[i]);
         }
+        std::swap(wave, next_wave);
     }
 }
 
@@ -397,12 +422,14 @@ void CutSpreader::expand_regions() {
  *
  *  @param r	region to cut & spread
  *  @param dir	direction, true for y, false for x
+ *  @param first_child_id	ID of the left sub-region, the right sub-region gets first_child_id + 1.
+ *  						Both entries must already exist in regions.
  *
  *  @return		a pair of sub-region IDs created from cutting region r.
  *  			BASE_CASE if base case is reached
  *  			CUT_FAIL if cut unsuccessful, need to cut in the other direction
  */
-std::pair<int, int> CutSpreader::cut_region(SpreaderRegion& r, bool dir) {
+std::pair<int, int> CutSpreader::cut_region(SpreaderRegion& r, bool dir, int first_child_id) {
     const DeviceContext& device_ctx = g_vpr_ctx.device();
     const ClusteredNetlist& clb_nlist = g_vpr_ctx.clustering().clb_nlist;
     PlacementContext& place_ctx = g_vpr_ctx.mutable_placement();
@@ -477,12 +504,12 @@ std::pair<int, int> CutSpreader::cut_region(SpreaderRegion& r, bool dir) {
     // The n_tiles will be final while n_blks may change by perturbing the source cut to eliminate
     // overutilization in subareas
     SpreaderRegion rl, rr;
-    rl.id = int(regions.size());
+    rl.id = first_child_id;
     rl.bb = dir ? vtr::Rect<int>{r.bb.xmin(), trimmed_l, r.bb.xmax(), best_tgt_cut}
                 : vtr::Rect<int>{trimmed_l, r.bb.ymin(), best_tgt_cut, r.bb.ymax()};
     rl.n_blks = left_blks_n;
     rl.n_tiles = left_tiles_n;
-    rr.id = int(regions.size()) + 1;
+    rr.id = first_child_id + 1;
     rr.bb = dir ? vtr::Rect<int>{r.bb.xmin(), best_tgt_cut + 1, r.bb.xmax(), trimmed_r}
                 : vtr::Rect<int>{best_tgt_cut + 1, r.bb.ymin(), trimmed_r, r.bb.ymax()};
     rr.n_blks = right_blks_n;
@@ -521,9 +548,9 @@ std::pair<int, int> CutSpreader::cut_region(SpreaderRegion& r, bool dir) {
     linear_spread_subarea(cut_blks, dir, 0, pivot + 1, rl);
     linear_spread_subarea(cut_blks, dir, pivot + 1, cut_blks.size(), rr);
 
-    // push subareas back to regions so that they can be accessed by their IDs later
-    regions.push_back(rl);
-    regions.push_back(rr);
+    // store subareas in their reserved entries of regions so that they can be accessed by their IDs later
+    regions[rl.id] = rl;
+    regions[rr.id] = rr;
 
     return std::make_pair(rl.id, rr.id);
 }
@@ -61,10 +61,10 @@
  * original locations in their source bins to new spread location in target bins.
  *
  * This cutting and spreading is repeated recursively. The cut-spreading process returns the left and right
- * (or top and bottom) subareas, which are pushed into a workqueue FIFO. Their direction of cut in the next
+ * (or top and bottom) subareas, which are put in the next wave of regions to cut. Their direction of cut in the next
  * cut-spreading process is alternated, i.e. if the first cut is in y direction, the resulting left and right
  * sub-areas are further cut in x direction, each producing 2 subareas top and bottom, and so forth.
- * The first region in the FIFO is then popped and goes through cut-spreading. This process is repeated until the base
+ * The regions of a wave don't overlap, so they go through cut-spreading in parallel. This process is repeated until the base
  * case of only 1 block in the region is reached. At this point the placement is mostly not overutilized and ready
  * for strict legalization.
  *
@@ -307,12 +307,14 @@ class CutSpreader {
      *
      *  @param r	region to cut & spread
      *  @param dir	direction, true for y, false for x
+     *  @param first_child_id	ID of the left sub-region, the right sub-region gets first_child_id + 1.
+     *  						Both entries must already exist in regions.
      *
      *  @return		a pair of sub-region IDs created from cutting region r.
      *  			BASE_CASE if base case is reached
      *  			CUT_FAIL if cut unsuccessful, need to cut in the other direction
      */
-    std::pair<int, int> cut_region(SpreaderRegion& r, bool dir);
+    std::pair<int, int> cut_region(SpreaderRegion& r, bool dir, int first_child_id);
 
     /*
      * Helper function in strict_legalize()
@@ -1,6 +1,7 @@
 
 #include "directed_moves_util.h"
 #include "centroid_move_generator.h"
+#include "placer_globals.h"
 
 void get_coordinate_of_pin(ClusterPinId pin, t_physical_tile_loc& tile_loc) {
     auto& device_ctx = g_vpr_ctx.device();
@@ -19,6 +20,54 @@ void get_coordinate_of_pin(ClusterPinId pin, t_physical_tile_loc& tile_loc) {
     tile_loc.y = std::max(std::min(tile_loc.y, (int)grid.height() - 2), 1); //-2 for no perim channels
 }
 
+void load_net_sink_coord_sums() {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_move_ctx = g_placer_ctx.mutable_move();
+
+    place_move_ctx.sink_pin_coords.resize(cluster_ctx.clb_nlist.pins().size());
+    place_move_ctx.net_sink_coord_sums.resize(cluster_ctx.clb_nlist.nets().size());
+
+    for (ClusterNetId net_id : cluster_ctx.clb_nlist.nets()) {
+        t_net_sink_coord_sum& sink_sum = place_move_ctx.net_sink_coord_sums[net_id];
+        sink_sum = t_net_sink_coord_sum();
+        if (cluster_ctx.clb_nlist.net_is_ignored(net_id))
+            continue;
+
+        for (ClusterPinId sink_pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
+            t_physical_tile_loc& tile_loc = place_move_ctx.sink_pin_coords[sink_pin_id];
+            get_coordinate_of_pin(sink_pin_id, tile_loc);
+            sink_sum.x += tile_loc.x;
+            sink_sum.y += tile_loc.y;
+            sink_sum.layer += tile_loc.layer_num;
+        }
+    }
+}
+
+void update_net_sink_coord_sums(const t_pl_blocks_to_be_moved& blocks_affected) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_move_ctx = g_placer_ctx.mutable_move();
+
+    for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; ++iblk) {
+        ClusterBlockId blk = blocks_affected.moved_blocks[iblk].block_num;
+
+        for (ClusterPinId pin_id : cluster_ctx.clb_nlist.block_pins(blk)) {
+            ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(pin_id);
+            if (cluster_ctx.clb_nlist.pin_type(pin_id) == PinType::DRIVER || cluster_ctx.clb_nlist.net_is_ignored(net_id))
+                continue;
+
+            t_physical_tile_loc tile_loc;
+            get_coordinate_of_pin(pin_id, tile_loc);
+
+            t_physical_tile_loc& old_tile_loc = place_move_ctx.sink_pin_coords[pin_id];
+            t_net_sink_coord_sum& sink_sum = place_move_ctx.net_sink_coord_sums[net_id];
+            sink_sum.x += tile_loc.x - old_tile_loc.x;
+            sink_sum.y += tile_loc.y - old_tile_loc.y;
+            sink_sum.layer += tile_loc.layer_num - old_tile_loc.layer_num;
+            old_tile_loc = tile_loc;
+        }
+    }
+}
+
 void calculate_centroid_loc(ClusterBlockId b_from,
                             bool timing_weights,
                             t_pl_loc& centroid,
@@ -58,6 +107,17 @@ void calculate_centroid_loc(ClusterBlockId b_from,
             if (cluster_ctx.clb_nlist.net_is_ignored(net_id))
                 continue;
 
+            if (!timing_weights) {
+                // All sinks have the same weight, so their cached coordinate sum gives the same result
+                // as visiting each of them, without the cost of doing so for high fanout nets
+                const t_net_sink_coord_sum& sink_sum = g_placer_ctx.move().net_sink_coord_sums[net_id];
+                acc_x += sink_sum.x;
+                acc_y += sink_sum.y;
+                acc_layer += sink_sum.layer;
+                acc_weight += cluster_ctx.clb_nlist.net_sinks(net_id).size();
+                continue;
+            }
+
             for (auto sink_pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
                 /* Ignore if one of the sinks is the block itself      *
                  * This case rarely happens but causes QoR degradation */
@@ -3,6 +3,7 @@
 
 #include "globals.h"
 #include "timing_place.h"
+#include "move_transactions.h"
 
 /**
  * @brief enum represents the different reward functions
@@ -19,6 +20,21 @@ e_reward_function string_to_reward(const std::string& st);
 ///@brief Helper function that returns the x, y coordinates of a pin
 void get_coordinate_of_pin(ClusterPinId pin, t_physical_tile_loc& tile_loc);
 
+/**
+ * @brief Computes the sink pin coordinates and their per-net sums (placer move context) from scratch
+ *
+ * Must be called once the placement to anneal is loaded and its physical pins are synced, before any
+ * centroid move is proposed.
+ */
+void load_net_sink_coord_sums();
+
+/**
+ * @brief Updates the cached sink pin coordinates and their per-net sums for a committed move
+ *
+ * @param blocks_affected The committed move. Its blocks must already be at their new locations.
+ */
+void update_net_sink_coord_sums(const t_pl_blocks_to_be_moved& blocks_affected);
+
 /**
  * @brief Calculates the exact centroid location
  *
@@ -3,6 +3,7 @@
 #include "initial_placement.h"
 #include "noc_place_utils.h"
 #include "noc_place_checkpoint.h"
+#include "noc_place_tempering.h"
 #include "place_constraints.h"
 
 #include "sat_routing.h"
@@ -10,8 +11,20 @@
 #include "vtr_math.h"
 #include "vtr_time.h"
 
+#include <algorithm>
 #include <limits>
 #include <queue>
+#include <unordered_map>
+
+#ifdef VPR_USE_TBB
+#include <tbb/global_control.h>
+#endif
+
+///@brief Largest number of physical router pairs whose routes are tabulated for parallel tempering
+static constexpr size_t MAX_NOC_TEMPERING_ROUTE_PAIRS = 1 << 18;
+
+///@brief Number of replicas annealed in parallel by the initial NoC placement
+static constexpr int NUM_NOC_TEMPERING_REPLICAS = 8;
 
 /**
  * @brief Evaluates whether a NoC router swap should be accepted or not.
@@ -44,12 +57,40 @@ static void place_constrained_noc_router(ClusterBlockId router_blk_id);
 static void place_noc_routers_randomly(std::vector<ClusterBlockId>& unfixed_routers,
                                        int seed);
 
+/**
+ * @brief Builds the parallel tempering model of the current NoC router placement.
+ *
+ * The model tabulates the route between each pair of physical routers, so it is
+ * only built when routes only depend on their end routers, moves do not need
+ * deadlock checks, and each physical router has a single location for a router
+ * cluster.
+ *
+ *   @param noc_opts Contains weighting factors for NoC cost terms.
+ *   @param norm_factors Normalization factors of the NoC cost terms.
+ *   @param model Filled with the tempering model.
+ *   @param router_phy Filled with the physical router of each router cluster,
+ *   in get_router_clusters_in_netlist() order.
+ *   @param phy_locs Filled with the location of each physical router.
+ *
+ * @return False if the placement can not be modelled.
+ */
+static bool build_noc_tempering_model(const t_noc_opts& noc_opts,
+                                      const NocCostTerms& norm_factors,
+                                      t_noc_tempering_model& model,
+                                      std::vector<int>& router_phy,
+                                      std::vector<t_pl_loc>& phy_locs);
+
 /**
  * @brief Runs a simulated annealing optimizer for NoC routers.
  *
+ * When several threads are available and the placement can be modelled (see
+ * build_noc_tempering_model()), the routers are placed by parallel tempering
+ * instead of a single annealer.
+ *
  *   @param noc_opts Contains weighting factors for NoC cost terms.
+ *   @param seed Seeds the parallel tempering.
  */
-static void noc_routers_anneal(const t_noc_opts& noc_opts);
+static void noc_routers_anneal(const t_noc_opts& noc_opts, int seed);
 
 static bool accept_noc_swap(double delta_cost, double prob) {
     if (delta_cost <= 0.0) {
@@ -166,7 +207,153 @@ static void place_noc_routers_randomly(std::vector<ClusterBlockId>& unfixed_rout
     } // end for of random router placement
 }
 
-static void noc_routers_anneal(const t_noc_opts& noc_opts) {
+static bool build_noc_tempering_model(const t_noc_opts& noc_opts,
+                                      const NocCostTerms& norm_factors,
+                                      t_noc_tempering_model& model,
+                                      std::vector<int>& router_phy,
+                                      std::vector<t_pl_loc>& phy_locs) {
+    auto& noc_ctx = g_vpr_ctx.noc();
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& device_ctx = g_vpr_ctx.device();
+
+    const NocStorage& noc_model = noc_ctx.noc_model;
+    const NocTrafficFlows& noc_traffic_flows_storage = noc_ctx.noc_traffic_flows_storage;
+    const auto& noc_phy_routers = noc_model.get_noc_routers();
+    const std::vector<ClusterBlockId>& router_blk_ids = noc_traffic_flows_storage.get_router_clusters_in_netlist();
+    const size_t num_phy = noc_phy_routers.size();
+
+    if (noc_opts.noc_enforce_deadlock_freedom
+        || noc_ctx.noc_flows_router->routes_depend_on_traffic_flow()
+        || device_ctx.grid.get_num_layers() > 1
+        || num_phy * num_phy > MAX_NOC_TEMPERING_ROUTE_PAIRS
+        || router_blk_ids.empty()
+        || noc_traffic_flows_storage.get_all_traffic_flow_id().empty()) {
+        return false;
+    }
+
+    const auto router_block_type = cluster_ctx.clb_nlist.block_type(router_blk_ids[0]);
+    const auto& compressed_noc_grid = place_ctx.compressed_block_grids[router_block_type->index];
+
+    std::unordered_map<ClusterBlockId, int> router_index;
+    for (int router = 0; router < (int)router_blk_ids.size(); ++router) {
+        router_index[router_blk_ids[router]] = router;
+    }
+
+    // Physical routers, on a grid compressed to the rows and columns holding them
+    phy_locs.clear();
+    std::vector<int> xs, ys;
+    for (const NocRouter& phy_router : noc_phy_routers) {
+        t_physical_tile_loc phy_loc = phy_router.get_router_physical_location();
+        const auto& phy_type = device_ctx.grid.get_physical_type(phy_loc);
+        const auto& compatible_sub_tiles = compressed_noc_grid.compatible_sub_tiles_for_tile.at(phy_type->index);
+        if (compatible_sub_tiles.size() != 1) {
+            return false;
+        }
+
+        phy_locs.emplace_back(phy_loc, compatible_sub_tiles[0]);
+        xs.push_back(phy_loc.x);
+        ys.push_back(phy_loc.y);
+    }
+    std::sort(xs.begin(), xs.end());
+    xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+    std::sort(ys.begin(), ys.end());
+    ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+    model.phy_at.resize({xs.size(), ys.size()}, -1);
+    model.phy_x.resize(num_phy);
+    model.phy_y.resize(num_phy);
+    model.phy_blocked.assign(num_phy, false);
+    for (int phy = 0; phy < (int)num_phy; ++phy) {
+        model.phy_x[phy] = std::lower_bound(xs.begin(), xs.end(), phy_locs[phy].x) - xs.begin();
+        model.phy_y[phy] = std::lower_bound(ys.begin(), ys.end(), phy_locs[phy].y) - ys.begin();
+        model.phy_at[model.phy_x[phy]][model.phy_y[phy]] = phy;
+
+        ClusterBlockId blk_id = place_ctx.grid_blocks.block_at_location(phy_locs[phy]);
+        if (blk_id != EMPTY_BLOCK_ID && blk_id != INVALID_BLOCK_ID && !router_index.count(blk_id)) {
+            model.phy_blocked[phy] = true;
+        }
+    }
+
+    // Router clusters
+    router_phy.resize(router_blk_ids.size());
+    model.router_fixed.resize(router_blk_ids.size());
+    model.router_legal_phy.assign(router_blk_ids.size(), {});
+    for (int router = 0; router < (int)router_blk_ids.size(); ++router) {
+        ClusterBlockId blk_id = router_blk_ids[router];
+        router_phy[router] = (size_t)noc_model.get_router_at_grid_location(place_ctx.block_locs[blk_id].loc);
+        model.router_fixed[router] = place_ctx.block_locs[blk_id].is_fixed;
+
+        if (is_cluster_constrained(blk_id)) {
+            model.router_legal_phy[router].resize(num_phy);
+            for (size_t phy = 0; phy < num_phy; ++phy) {
+                model.router_legal_phy[router][phy] = cluster_floorplanning_legal(blk_id, phy_locs[phy]);
+            }
+        }
+    }
+
+    // Traffic flows
+    model.flows.clear();
+    for (const auto& traffic_flow_id : noc_traffic_flows_storage.get_all_traffic_flow_id()) {
+        const t_noc_traffic_flow& traffic_flow = noc_traffic_flows_storage.get_single_noc_traffic_flow(traffic_flow_id);
+        model.flows.push_back({router_index.at(traffic_flow.source_router_cluster_id),
+                               router_index.at(traffic_flow.sink_router_cluster_id),
+                               traffic_flow.traffic_flow_bandwidth,
+                               double(traffic_flow.traffic_flow_priority),
+                               traffic_flow.max_traffic_flow_latency});
+    }
+    model.load_router_flows();
+
+    model.link_bandwidth.clear();
+    for (const NocLink& link : noc_model.get_noc_links()) {
+        model.link_bandwidth.push_back(link.get_bandwidth());
+    }
+
+    // Route (and unscaled latency) between each pair of physical routers
+    const NocTrafficFlowId any_traffic_flow_id = noc_traffic_flows_storage.get_all_traffic_flow_id()[0];
+    const t_noc_traffic_flow unit_traffic_flow("", "", ClusterBlockId::INVALID(), ClusterBlockId::INVALID(),
+                                               0., std::numeric_limits<double>::infinity(), 1);
+    std::vector<NocLinkId> route;
+    model.route_offsets.assign(1, 0);
+    model.route_links.clear();
+    model.route_latency.clear();
+    try {
+        for (const NocRouter& src_router : noc_phy_routers) {
+            for (const NocRouter& sink_router : noc_phy_routers) {
+                NocRouterId src_router_id = noc_model.convert_router_id(src_router.get_router_user_id());
+                NocRouterId sink_router_id = noc_model.convert_router_id(sink_router.get_router_user_id());
+
+                route.clear();
+                if (src_router_id != sink_router_id) {
+                    noc_ctx.noc_flows_router->route_flow(src_router_id, sink_router_id, any_traffic_flow_id, route, noc_model);
+                }
+
+                for (NocLinkId link_id : route) {
+                    model.route_links.push_back((size_t)link_id);
+                }
+                model.route_offsets.push_back(model.route_links.size());
+
+                if (route.empty() && noc_model.get_detailed_router_latency()) {
+                    model.route_latency.push_back(src_router.get_latency());
+                } else {
+                    model.route_latency.push_back(calculate_traffic_flow_latency_cost(route, noc_model, unit_traffic_flow).first);
+                }
+            }
+        }
+    } catch (const VprError&) {
+        // Some pair of physical routers can not be routed, leave it to the sequential annealer
+        return false;
+    }
+
+    model.aggregate_bandwidth_factor = noc_opts.noc_placement_weighting * norm_factors.aggregate_bandwidth * noc_opts.noc_aggregate_bandwidth_weighting;
+    model.latency_factor = noc_opts.noc_placement_weighting * norm_factors.latency * noc_opts.noc_latency_weighting;
+    model.latency_overrun_factor = noc_opts.noc_placement_weighting * norm_factors.latency_overrun * noc_opts.noc_latency_constraints_weighting;
+    model.congestion_factor = noc_opts.noc_placement_weighting * norm_factors.congestion * noc_opts.noc_congestion_weighting;
+
+    return true;
+}
+
+static void noc_routers_anneal(const t_noc_opts& noc_opts, int seed) {
     auto& noc_ctx = g_vpr_ctx.noc();
 
     // Only NoC related costs are considered
@@ -203,6 +390,36 @@ static void noc_routers_anneal(const t_noc_opts& noc_opts) {
     // The checkpoint stored the placement with the lowest cost.
     NoCPlacementCheckpoint checkpoint;
 
+#ifdef VPR_USE_TBB
+    const size_t num_workers = tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism);
+#else
+    const size_t num_workers = 1;
+#endif
+
+    t_noc_tempering_model tempering_model;
+    std::vector<int> router_phy;
+    std::vector<t_pl_loc> phy_locs;
+    if (num_workers > 1 && build_noc_tempering_model(noc_opts, costs.noc_cost_norm_factors, tempering_model, router_phy, phy_locs)) {
+        t_noc_tempering_params params;
+        params.num_replicas = NUM_NOC_TEMPERING_REPLICAS;
+        params.moves_per_replica = std::max(N_MOVES / NUM_NOC_TEMPERING_REPLICAS, 1);
+
+        vtr::RandState rand_state = seed;
+        double start_cost = NocTemperingReplica(tempering_model, router_phy).cost();
+        double tempered_cost = temper_noc_placement(tempering_model, router_phy, params, rand_state);
+
+        if (tempered_cost < start_cost) {
+            const std::vector<ClusterBlockId>& router_blk_ids = noc_ctx.noc_traffic_flows_storage.get_router_clusters_in_netlist();
+            std::unordered_map<ClusterBlockId, t_pl_loc> router_locations;
+            for (size_t router = 0; router < router_blk_ids.size(); ++router) {
+                router_locations[router_blk_ids[router]] = phy_locs[router_phy[router]];
+            }
+            checkpoint.save_checkpoint(tempered_cost, router_locations);
+            checkpoint.restore_checkpoint(costs);
+        }
+        return;
+    }
+
     /* Algorithm overview:
      * In each iteration, one logical NoC router and a physical NoC router are selected randomly.
      * If the selected physical NoC router is occupied, two logical NoC routers are swapped.
@@ -229,11 +446,11 @@ static void noc_routers_anneal(const t_noc_opts& noc_opts) {
             apply_move_blocks(blocks_affected);
 
             NocCostTerms noc_delta_c;
-            find_affected_noc_routers_and_update_noc_costs(blocks_affected, noc_delta_c);
+            bool move_is_deadlock_free = find_affected_noc_routers_and_update_noc_costs(blocks_affected, noc_delta_c);
             double delta_cost = calculate_noc_cost(noc_delta_c, costs.noc_cost_norm_factors, noc_opts);
 
             double prob = starting_prob - i_move * prob_step;
-            bool move_accepted = accept_noc_swap(delta_cost, prob);
+            bool move_accepted = accept_noc_swap(delta_cost, prob) && move_is_deadlock_free;
 
             if (move_accepted) {
                 costs.cost += delta_cost;
@@ -286,7 +503,7 @@ void initial_noc_placement(const t_noc_opts& noc_opts, const t_placer_opts& plac
     initial_noc_routing({});
 
     // Run the simulated annealing optimizer for NoC routers
-    noc_routers_anneal(noc_opts);
+    noc_routers_anneal(noc_opts, placer_opts.seed);
 
     // check if there is any cycles
     bool has_cycle = noc_routing_has_cycle();
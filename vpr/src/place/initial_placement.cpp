@@ -35,6 +35,10 @@ static constexpr int SORT_WEIGHT_PER_FAILED_BLOCK = 10;
 // The amount of weight that will be added to each tile which is outside the floorplanning constraints
 static constexpr int SORT_WEIGHT_PER_TILES_OUTSIDE_OF_PR = 100;
 
+/* The target locations of the blocks during the current initial_placement() call, if any *
+ * (e.g. from the multilevel global placement)                                            */
+static const vtr::vector<ClusterBlockId, t_pl_loc>* f_block_targets = nullptr;
+
 /**
  * @brief Set chosen grid locations to EMPTY block id before each placement iteration
  *   
@@ -64,6 +68,7 @@ static void clear_all_grid_locs();
  *   @param pad_loc_type Used to check whether an io block needs to be marked as fixed.
  *   @param blk_types_empty_locs_in_grid First location (lowest y) and number of remaining blocks in each column for the blk_id type.
  *   @param block_scores The block_scores (ranking of what to place next) for unplaced blocks connected to this macro should be updated.
+ *   @param search_cursors Cursors for the exhaustive placement, see try_place_macro_exhaustively(). May be null.
  * 
  * @return true if macro was placed, false if not.
  */
@@ -71,7 +76,8 @@ static bool place_macro(int macros_max_num_tries,
                         const t_pl_macro& pl_macro,
                         enum e_pad_loc_type pad_loc_type,
                         std::vector<t_grid_empty_locs_block_type>* blk_types_empty_locs_in_grid,
-                        vtr::vector<ClusterBlockId, t_block_score>& block_scores);
+                        vtr::vector<ClusterBlockId, t_block_score>& block_scores,
+                        t_exhaustive_search_cursors* search_cursors);
 
 /*
  * Assign scores to each block based on macro size and floorplanning constraints.
@@ -167,6 +173,22 @@ static std::vector<ClusterBlockId> find_centroid_loc(const t_pl_macro& pl_macro,
  */
 static bool find_centroid_neighbor(t_pl_loc& centroid_loc, t_logical_block_type_ptr block_type, bool search_for_empty);
 
+/**
+ * @brief Tries to place a macro at an empty location close to the target location of its head
+ * (see initial_placement()).
+ *
+ *   @param pl_macro The macro to be placed.
+ *   @param pr The PartitionRegion of the macro.
+ *   @param block_type Logical block type of the macro blocks.
+ *   @param pad_loc_type Used to check whether an io block needs to be marked as fixed.
+ *
+ * @return true if the macro gets placed, false if not.
+ */
+static bool try_target_placement(const t_pl_macro& pl_macro,
+                                 const PartitionRegion& pr,
+                                 t_logical_block_type_ptr block_type,
+                                 enum e_pad_loc_type pad_loc_type);
+
 /**
  * @brief  tries to place a macro at a centroid location of its placed connections.
  *
@@ -424,6 +446,32 @@ static std::vector<ClusterBlockId> find_centroid_loc(const t_pl_macro& pl_macro,
     return connected_blocks_to_update;
 }
 
+static bool try_target_placement(const t_pl_macro& pl_macro,
+                                 const PartitionRegion& pr,
+                                 t_logical_block_type_ptr block_type,
+                                 enum e_pad_loc_type pad_loc_type) {
+    t_pl_loc target_loc = (*f_block_targets)[pl_macro.members[0].blk_index];
+    if (!is_loc_on_chip({target_loc.x, target_loc.y, target_loc.layer})) {
+        return false;
+    }
+
+    //The blocks targeting the same area are spread over its empty locations
+    if (!find_centroid_neighbor(target_loc, block_type, true)) {
+        return false;
+    }
+
+    if (!pr.is_loc_in_part_reg(target_loc)) {
+        return false;
+    }
+
+    if (!try_place_macro(pl_macro, target_loc)) {
+        return false;
+    }
+
+    fix_IO_block_types(pl_macro, target_loc, pad_loc_type);
+    return true;
+}
+
 static bool try_centroid_placement(const t_pl_macro& pl_macro, PartitionRegion& pr, t_logical_block_type_ptr block_type, enum e_pad_loc_type pad_loc_type, vtr::vector<ClusterBlockId, t_block_score>& block_scores) {
     t_pl_loc centroid_loc(OPEN, OPEN, OPEN, OPEN);
     std::vector<ClusterBlockId> unplaced_blocks_to_update_their_score;
@@ -659,7 +707,33 @@ bool try_place_macro_randomly(const t_pl_macro& pl_macro, const PartitionRegion&
     return legal;
 }
 
-bool try_place_macro_exhaustively(const t_pl_macro& pl_macro, const PartitionRegion& pr, t_logical_block_type_ptr block_type, enum e_pad_loc_type pad_loc_type) {
+static bool has_empty_compatible_sub_tile(t_pl_loc loc, t_logical_block_type_ptr block_type, int region_sub_tile) {
+    const auto& place_ctx = g_vpr_ctx.placement();
+
+    if (region_sub_tile != NO_SUBTILE) {
+        loc.sub_tile = region_sub_tile;
+        return place_ctx.grid_blocks.block_at_location(loc) == EMPTY_BLOCK_ID;
+    }
+
+    auto tile_type = g_vpr_ctx.device().grid.get_physical_type({loc.x, loc.y, loc.layer});
+    for (const auto& sub_tile : tile_type->sub_tiles) {
+        if (is_sub_tile_compatible(tile_type, block_type, sub_tile.capacity.low)) {
+            for (int st = sub_tile.capacity.low; st <= sub_tile.capacity.high; st++) {
+                loc.sub_tile = st;
+                if (place_ctx.grid_blocks.block_at_location(loc) == EMPTY_BLOCK_ID) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+bool try_place_macro_exhaustively(const t_pl_macro& pl_macro,
+                                  const PartitionRegion& pr,
+                                  t_logical_block_type_ptr block_type,
+                                  enum e_pad_loc_type pad_loc_type,
+                                  t_exhaustive_search_cursors* search_cursors) {
     const auto& compressed_block_grid = g_vpr_ctx.placement().compressed_block_grids[block_type->index];
     auto& place_ctx = g_vpr_ctx.mutable_placement();
 
@@ -682,7 +756,24 @@ bool try_place_macro_exhaustively(const t_pl_macro& pl_macro, const PartitionReg
             continue;
         }
 
-        for (int cx = min_cx; cx <= max_cx && placed == false; cx++) {
+        // Skip the locations that previous searches of this region found full
+        t_exhaustive_search_cursor* cursor = nullptr;
+        int start_cx = min_cx;
+        int start_row = 0;
+        if (search_cursors != nullptr) {
+            cursor = &(*search_cursors)[std::make_tuple(block_type->index,
+                                                        reg_coord.xmin, reg_coord.ymin, reg_coord.xmax, reg_coord.ymax,
+                                                        layer_num, regions[reg].get_sub_tile())];
+            if (cursor->cx != OPEN) {
+                start_cx = cursor->cx;
+                start_row = cursor->row;
+            }
+        }
+
+        // The cursor follows the search as long as every location visited so far is full
+        bool full_so_far = true;
+
+        for (int cx = start_cx; cx <= max_cx && placed == false; cx++) {
             const auto& block_rows = compressed_block_grid.get_column_block_map(cx, layer_num);
             auto y_lower_iter = block_rows.begin();
             auto y_upper_iter = block_rows.end();
@@ -691,7 +782,7 @@ bool try_place_macro_exhaustively(const t_pl_macro& pl_macro, const PartitionReg
 
             VTR_ASSERT(y_range >= 0);
 
-            for (int dy = 0; dy < y_range && placed == false; dy++) {
+            for (int dy = (cx == start_cx) ? start_row : 0; dy < y_range && placed == false; dy++) {
                 int cy = (y_lower_iter + dy)->first;
 
                 auto grid_loc = compressed_block_grid.compressed_loc_to_grid_loc({cx, cy, layer_num});
@@ -735,6 +826,16 @@ bool try_place_macro_exhaustively(const t_pl_macro& pl_macro, const PartitionReg
                         }
                     }
                 }
+
+                if (cursor != nullptr && full_so_far) {
+                    if (has_empty_compatible_sub_tile(to_loc, block_type, regions[reg].get_sub_tile())) {
+                        full_so_far = false;
+                    } else if (dy + 1 < y_range) {
+                        *cursor = {cx, dy + 1};
+                    } else {
+                        *cursor = {cx + 1, 0};
+                    }
+                }
             }
         }
     }
@@ -814,7 +915,8 @@ static bool place_macro(int macros_max_num_tries,
                         const t_pl_macro& pl_macro,
                         enum e_pad_loc_type pad_loc_type,
                         std::vector<t_grid_empty_locs_block_type>* blk_types_empty_locs_in_grid,
-                        vtr::vector<ClusterBlockId, t_block_score>& block_scores) {
+                        vtr::vector<ClusterBlockId, t_block_score>& block_scores,
+                        t_exhaustive_search_cursors* search_cursors) {
     ClusterBlockId blk_id;
     blk_id = pl_macro.members[0].blk_index;
     VTR_LOGV_DEBUG(g_vpr_ctx.placement().f_placer_debug, "\t\tHead of the macro is Block %d\n", size_t(blk_id));
@@ -859,6 +961,11 @@ static bool place_macro(int macros_max_num_tries,
         macro_placed = try_dense_placement(pl_macro, pr, block_type, pad_loc_type, blk_types_empty_locs_in_grid);
     }
 
+    if (!macro_placed && f_block_targets != nullptr) {
+        VTR_LOGV_DEBUG(g_vpr_ctx.placement().f_placer_debug, "\t\t\tTry target placement\n");
+        macro_placed = try_target_placement(pl_macro, pr, block_type, pad_loc_type);
+    }
+
     if (!macro_placed) {
         VTR_LOGV_DEBUG(g_vpr_ctx.placement().f_placer_debug, "\t\t\tTry centroid placement\n");
         macro_placed = try_centroid_placement(pl_macro, pr, block_type, pad_loc_type, block_scores);
@@ -879,7 +986,7 @@ static bool place_macro(int macros_max_num_tries,
 
         // Exhaustive placement of carry macros
         VTR_LOGV_DEBUG(g_vpr_ctx.placement().f_placer_debug, "\t\t\tTry exhaustive placement\n");
-        macro_placed = try_place_macro_exhaustively(pl_macro, pr, block_type, pad_loc_type);
+        macro_placed = try_place_macro_exhaustively(pl_macro, pr, block_type, pad_loc_type, search_cursors);
     }
     return macro_placed;
 }
@@ -977,6 +1084,10 @@ static void place_all_blocks([[maybe_unused]] const t_placer_opts& placer_opts,
         std::vector<ClusterBlockId> heap_blocks(blocks.begin(), blocks.end());
         std::make_heap(heap_blocks.begin(), heap_blocks.end(), criteria);
 
+        //blocks are only added to the grid until the next iteration clears it, so the exhaustive
+        //placement can skip the locations it already found full in this iteration
+        t_exhaustive_search_cursors search_cursors;
+
         while (!heap_blocks.empty()) {
             std::pop_heap(heap_blocks.begin(), heap_blocks.end(), criteria);
             auto blk_id = heap_blocks.back();
@@ -991,7 +1102,7 @@ static void place_all_blocks([[maybe_unused]] const t_placer_opts& placer_opts,
 
             blocks_placed_since_heap_update++;
 
-            bool block_placed = place_one_block(blk_id, pad_loc_type, &blk_types_empty_locs_in_grid[blk_id_type->index], &block_scores);
+            bool block_placed = place_one_block(blk_id, pad_loc_type, &blk_types_empty_locs_in_grid[blk_id_type->index], &block_scores, &search_cursors);
 
             //update heap based on update_heap_freq calculated above
             if (blocks_placed_since_heap_update % (update_heap_freq) == 0) {
@@ -1093,7 +1204,8 @@ static void clear_all_grid_locs() {
 bool place_one_block(const ClusterBlockId& blk_id,
                      enum e_pad_loc_type pad_loc_type,
                      std::vector<t_grid_empty_locs_block_type>* blk_types_empty_locs_in_grid,
-                     vtr::vector<ClusterBlockId, t_block_score>* block_scores) {
+                     vtr::vector<ClusterBlockId, t_block_score>* block_scores,
+                     t_exhaustive_search_cursors* search_cursors) {
     auto& place_ctx = g_vpr_ctx.placement();
 
     //Check if block has already been placed
@@ -1111,7 +1223,7 @@ bool place_one_block(const ClusterBlockId& blk_id,
     if (imacro != -1) { //If the block belongs to a macro, pass that macro to the placement routines
         VTR_LOGV_DEBUG(g_vpr_ctx.placement().f_placer_debug, "\tBelongs to a macro %d\n", imacro);
         pl_macro = place_ctx.pl_macros[imacro];
-        placed_macro = place_macro(MAX_NUM_TRIES_TO_PLACE_MACROS_RANDOMLY, pl_macro, pad_loc_type, blk_types_empty_locs_in_grid, (*block_scores));
+        placed_macro = place_macro(MAX_NUM_TRIES_TO_PLACE_MACROS_RANDOMLY, pl_macro, pad_loc_type, blk_types_empty_locs_in_grid, (*block_scores), search_cursors);
     } else {
         //If it does not belong to a macro, create a macro with the one block and then pass to the placement routines
         //This is done so that the initial placement flow can be the same whether the block belongs to a macro or not
@@ -1121,7 +1233,7 @@ bool place_one_block(const ClusterBlockId& blk_id,
         macro_member.blk_index = blk_id;
         macro_member.offset = block_offset;
         pl_macro.members.push_back(macro_member);
-        placed_macro = place_macro(MAX_NUM_TRIES_TO_PLACE_MACROS_RANDOMLY, pl_macro, pad_loc_type, blk_types_empty_locs_in_grid, (*block_scores));
+        placed_macro = place_macro(MAX_NUM_TRIES_TO_PLACE_MACROS_RANDOMLY, pl_macro, pad_loc_type, blk_types_empty_locs_in_grid, (*block_scores), search_cursors);
     }
 
     return placed_macro;
@@ -1129,9 +1241,12 @@ bool place_one_block(const ClusterBlockId& blk_id,
 
 void initial_placement(const t_placer_opts& placer_opts,
                        const char* constraints_file,
-                       const t_noc_opts& noc_opts) {
+                       const t_noc_opts& noc_opts,
+                       const vtr::vector<ClusterBlockId, t_pl_loc>* block_targets) {
     vtr::ScopedStartFinishTimer timer("Initial Placement");
 
+    f_block_targets = block_targets;
+
     /* Initialize the grid blocks to empty.
      * Initialize all the blocks to unplaced.
      */
@@ -1164,6 +1279,8 @@ void initial_placement(const t_placer_opts& placer_opts,
     //Place all blocks
     place_all_blocks(placer_opts, block_scores, placer_opts.pad_loc_type, constraints_file);
 
+    f_block_targets = nullptr;
+
     // ensure all blocks are placed and that NoC routing has no cycles
     check_initial_placement_legality();
 
@@ -5,11 +5,29 @@
 #include "place_macro.h"
 #include "partition_region.h"
 
+#include <map>
+#include <tuple>
+
 /* The maximum number of tries when trying to place a macro at a    *
  * random location before trying exhaustive placement - find the first     *
  * legal position and place it during initial placement.                  */
 constexpr int MAX_NUM_TRIES_TO_PLACE_MACROS_RANDOMLY = 8;
 
+/**
+ * @brief Where try_place_macro_exhaustively() resumes its search of a floorplan region for a block type.
+ *
+ * Every location the search visits before (cx, row) is known to have no empty sub_tile compatible
+ * with the block type. This stays true as long as blocks are only added to the grid, so the cursors
+ * must be discarded whenever blocks are removed from it.
+ */
+struct t_exhaustive_search_cursor {
+    int cx = OPEN; //Compressed x of the column to resume from, OPEN to start from the beginning of the region
+    int row = 0;   //Index into the column's block map to resume from
+};
+
+///@brief Search cursors indexed by (logical block type index, region xmin, ymin, xmax, ymax, layer, sub_tile)
+typedef std::map<std::tuple<int, int, int, int, int, int, int>, t_exhaustive_search_cursor> t_exhaustive_search_cursors;
+
 /**
  * @brief Used to assign each block a score for how difficult it is to place. 
  * The higher numbers indicate a block is expected to be more difficult to place.
@@ -69,13 +87,17 @@ bool try_place_macro_randomly(const t_pl_macro& pl_macro,
  *   constrained.
  *   @param block_type Logical block type of the macro blocks.
  *   @param pad_loc_type Used to check whether an io block needs to be marked as fixed.
+ *   @param search_cursors If not null, the search of each region resumes from where previous searches found
+ *   the region full instead of its first location, and the cursors are advanced over the locations found full.
+ *   This keeps placing many blocks exhaustively in a crowded region linear in its size.
  *
  * @return true if the macro gets placed, false if not.
  */
 bool try_place_macro_exhaustively(const t_pl_macro& pl_macro,
                                   const PartitionRegion& pr,
                                   t_logical_block_type_ptr block_type,
-                                  enum e_pad_loc_type pad_loc_type);
+                                  enum e_pad_loc_type pad_loc_type,
+                                  t_exhaustive_search_cursors* search_cursors = nullptr);
 
 /**
  * @brief Places the macro if the head position passed in is legal, and all the resulting
@@ -110,10 +132,13 @@ bool is_block_placed(ClusterBlockId blk_id);
  *   @param constraints_file Used to read block locations if any constraints is available.
  *   @param noc_enabled Used to check whether the user turned on the noc
  * optimization during placement.
+ *   @param block_targets If not null, each macro (or block) whose head has a target location
+ * (e.g. from multilevel_global_placement()) is first placed at an empty location close to it.
  */
 void initial_placement(const t_placer_opts& placer_opts,
                        const char* constraints_file,
-                       const t_noc_opts& noc_opts);
+                       const t_noc_opts& noc_opts,
+                       const vtr::vector<ClusterBlockId, t_pl_loc>* block_targets = nullptr);
 
 /**
  * @brief Looks for a valid placement location for block.
@@ -121,9 +146,14 @@ void initial_placement(const t_placer_opts& placer_opts,
  *   @param blk_id The block that should be placed.
  *   @param pad_loc_type Used to check whether an io block needs to be marked as fixed.
  *   @param blk_types_empty_locs_in_grid First location (lowest y) and number of remaining blocks in each column for the blk_id type
+ *   @param search_cursors Cursors for the exhaustive search, see try_place_macro_exhaustively()
  *   
  * 
  * @return true if the block gets placed, false if not.
  */
-bool place_one_block(const ClusterBlockId& blk_id, enum e_pad_loc_type pad_loc_type, std::vector<t_grid_empty_locs_block_type>* blk_types_empty_locs_in_grid, vtr::vector<ClusterBlockId, t_block_score>* block_scores);
+bool place_one_block(const ClusterBlockId& blk_id,
+                     enum e_pad_loc_type pad_loc_type,
+                     std::vector<t_grid_empty_locs_block_type>* blk_types_empty_locs_in_grid,
+                     vtr::vector<ClusterBlockId, t_block_score>* block_scores,
+                     t_exhaustive_search_cursors* search_cursors = nullptr);
 #endif
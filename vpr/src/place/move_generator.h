@@ -70,6 +70,27 @@ class MoveGenerator {
      *  @param reward_fun: the name of the reward function used
      */
     virtual void process_outcome(double /*reward*/, e_reward_function /*reward_fun*/) {}
+
+    /**
+     * @brief Identifies the action the generator took for the move it proposed last
+     *
+     * When several moves are proposed before any outcome is known (batched moves), the
+     * placer passes this back through set_proposed_action_id() right before the move's
+     * process_outcome(), so the feedback is credited to the action which made that move.
+     * Generators which do not learn from the outcomes can keep the defaults.
+     */
+    virtual size_t proposed_action_id() const { return 0; }
+    virtual void set_proposed_action_id(size_t /*action_id*/) {}
+
+    /**
+     * @brief Returns everything the generator has learned from the move outcomes so far
+     *
+     * Used to save the annealer's state to a placement checkpoint file, from which
+     * set_learned_state() restores it. Returns false if the state does not fit this
+     * generator. Generators which do not learn from the outcomes can keep the defaults.
+     */
+    virtual std::vector<double> learned_state() const { return {}; }
+    virtual bool set_learned_state(const std::vector<double>& state) { return state.empty(); }
 };
 
 #endif
@@ -38,6 +38,10 @@ struct t_pl_blocks_to_be_moved {
     std::unordered_set<t_pl_loc> moved_to;
 
     std::vector<ClusterPinId> affected_pins;
+
+    //Nets driven by a moved block whose timing cost change only covers their sampled connections,
+    //see PlacerTimingContext::sampled_sink_ipins
+    std::vector<ClusterNetId> sampled_timing_nets;
 };
 
 enum class e_block_move_result {
@@ -18,6 +18,45 @@ bool f_placer_breakpoint_reached = false;
 //Records counts of reasons for aborted moves
 static std::map<std::string, size_t, std::less<>> f_move_abort_reasons;
 
+/**
+ * @brief A set of the integers [0..max_index] which is cleared in O(1).
+ *
+ * Each entry records the generation in which it was last inserted, so clearing
+ * only starts a new generation. find_compatible_compressed_loc_in_range() tracks
+ * the columns and rows it already tried with these rather than with hash sets, so
+ * proposing a move does not allocate memory.
+ */
+class t_tried_index_set {
+  public:
+    void clear(int max_index) {
+        if (generations_.size() < size_t(max_index) + 1) {
+            generations_.resize(size_t(max_index) + 1, 0);
+        }
+        if (++generation_ == 0) { //Wrapped around, forget the old generations
+            std::fill(generations_.begin(), generations_.end(), 0);
+            generation_ = 1;
+        }
+        size_ = 0;
+    }
+
+    //Returns false if index was already inserted since the last clear()
+    bool insert(int index) {
+        if (generations_[index] == generation_) {
+            return false;
+        }
+        generations_[index] = generation_;
+        ++size_;
+        return true;
+    }
+
+    int size() const { return size_; }
+
+  private:
+    std::vector<unsigned> generations_;
+    unsigned generation_ = 0;
+    int size_ = 0;
+};
+
 void log_move_abort(std::string_view reason) {
     auto it = f_move_abort_reasons.find(reason);
     if (it != f_move_abort_reasons.end()) {
@@ -742,6 +781,114 @@ ClusterBlockId pick_from_highly_critical_block(ClusterNetId& net_from, int& pin_
     return ClusterBlockId::INVALID();
 }
 
+/**
+ * @brief Picks uniformly a floorplan legal compressed location (other than from_loc) within search_range
+ *
+ * Returns false if the search range holds no other legal location.
+ */
+static bool find_legal_site_in_range(const t_compressed_legal_sites& sites,
+                                     const t_physical_tile_loc& from_loc,
+                                     const t_bb& search_range,
+                                     t_physical_tile_loc& to_loc,
+                                     int to_layer_num) {
+    const std::vector<int>& columns = sites.columns[to_layer_num];
+    const std::vector<std::vector<int>>& rows = sites.rows[to_layer_num];
+
+    size_t first_column = std::lower_bound(columns.begin(), columns.end(), search_range.xmin) - columns.begin();
+    size_t last_column = std::upper_bound(columns.begin(), columns.end(), search_range.xmax) - columns.begin();
+
+    //Count the legal locations of the columns in range, noting the index of from_loc (which isn't a candidate)
+    static thread_local std::vector<int> num_sites_up_to_column;
+    num_sites_up_to_column.clear();
+    int num_sites = 0;
+    int from_index = OPEN;
+    for (size_t icol = first_column; icol < last_column; icol++) {
+        const std::vector<int>& column_rows = rows[icol];
+        auto lower_iter = std::lower_bound(column_rows.begin(), column_rows.end(), search_range.ymin);
+        auto upper_iter = std::upper_bound(column_rows.begin(), column_rows.end(), search_range.ymax);
+
+        if (columns[icol] == from_loc.x && from_loc.layer_num == to_layer_num) {
+            auto from_iter = std::lower_bound(lower_iter, upper_iter, from_loc.y);
+            if (from_iter != upper_iter && *from_iter == from_loc.y) {
+                from_index = num_sites + (from_iter - lower_iter);
+            }
+        }
+
+        num_sites += upper_iter - lower_iter;
+        num_sites_up_to_column.push_back(num_sites);
+    }
+
+    int num_candidates = num_sites - (from_index != OPEN ? 1 : 0);
+    if (num_candidates <= 0) {
+        VTR_LOGV_DEBUG(g_vpr_ctx.placement().f_placer_debug, "\tCouldn't find any floorplan legal position in the given search range\n");
+        return false;
+    }
+
+    int index = vtr::irand(num_candidates - 1);
+    if (from_index != OPEN && index >= from_index) {
+        index++;
+    }
+
+    size_t icol = std::upper_bound(num_sites_up_to_column.begin(), num_sites_up_to_column.end(), index) - num_sites_up_to_column.begin();
+    int column_index = index - (icol > 0 ? num_sites_up_to_column[icol - 1] : 0);
+    const std::vector<int>& column_rows = rows[first_column + icol];
+    auto lower_iter = std::lower_bound(column_rows.begin(), column_rows.end(), search_range.ymin);
+
+    to_loc.x = columns[first_column + icol];
+    to_loc.y = *(lower_iter + column_index);
+    to_loc.layer_num = to_layer_num;
+    return true;
+}
+
+/**
+ * @brief Finds a compressed location within search_range for b_from to move to
+ *
+ * Blocks with precomputed floorplan legal sites sample only those; other constrained blocks
+ * have the range intersected with their constraints first, which doesn't exclude all illegal locations.
+ */
+static bool find_compressed_loc_in_range_for_block(t_logical_block_type_ptr type,
+                                                   ClusterBlockId b_from,
+                                                   int delta_cx,
+                                                   const t_physical_tile_loc& from_loc,
+                                                   t_bb& search_range,
+                                                   t_physical_tile_loc& to_loc,
+                                                   bool is_median,
+                                                   int to_layer_num) {
+    const auto& place_ctx = g_vpr_ctx.placement();
+    if (size_t(b_from) < place_ctx.cluster_legal_sites_ids.size()) {
+        int sites_id = place_ctx.cluster_legal_sites_ids[b_from];
+        if (sites_id != OPEN) {
+            return find_legal_site_in_range(place_ctx.compressed_legal_sites[sites_id],
+                                            from_loc,
+                                            search_range,
+                                            to_loc,
+                                            to_layer_num);
+        }
+    }
+
+    //TODO: constraints should be adapted to 3D architecture
+    if (is_cluster_constrained(b_from)) {
+        bool intersect = intersect_range_limit_with_floorplan_constraints(type,
+                                                                          b_from,
+                                                                          search_range,
+                                                                          delta_cx,
+                                                                          to_layer_num);
+        if (!intersect) {
+            return false;
+        }
+    }
+
+    //TODO: For now, we only move the blocks on the same tile
+    return find_compatible_compressed_loc_in_range(type,
+                                                   delta_cx,
+                                                   from_loc,
+                                                   search_range,
+                                                   to_loc,
+                                                   is_median,
+                                                   to_layer_num,
+                                                   false);
+}
+
 bool find_to_loc_uniform(t_logical_block_type_ptr type,
                          float rlim,
                          const t_pl_loc from,
@@ -775,28 +922,14 @@ bool find_to_loc_uniform(t_logical_block_type_ptr type,
     int delta_cx = search_range.xmax - search_range.xmin;
 
     t_physical_tile_loc to_compressed_loc;
-    bool legal = false;
-
-    //TODO: constraints should be adapted to 3D architecture
-    if (is_cluster_constrained(b_from)) {
-        bool intersect = intersect_range_limit_with_floorplan_constraints(type,
-                                                                          b_from,
-                                                                          search_range,
-                                                                          delta_cx,
-                                                                          to_layer_num);
-        if (!intersect) {
-            return false;
-        }
-    }
-    //TODO: For now, we only move the blocks on the same tile
-    legal = find_compatible_compressed_loc_in_range(type,
-                                                    delta_cx,
-                                                    compressed_locs[to_layer_num],
-                                                    search_range,
-                                                    to_compressed_loc,
-                                                    false,
-                                                    to_layer_num,
-                                                    false);
+    bool legal = find_compressed_loc_in_range_for_block(type,
+                                                        b_from,
+                                                        delta_cx,
+                                                        compressed_locs[to_layer_num],
+                                                        search_range,
+                                                        to_compressed_loc,
+                                                        false,
+                                                        to_layer_num);
 
     if (!legal) {
         //No valid position found
@@ -874,27 +1007,14 @@ bool find_to_loc_median(t_logical_block_type_ptr blk_type,
                       to_layer_num);
 
     t_physical_tile_loc to_compressed_loc;
-    bool legal = false;
-
-    if (is_cluster_constrained(b_from)) {
-        bool intersect = intersect_range_limit_with_floorplan_constraints(blk_type,
-                                                                          b_from,
-                                                                          search_range,
-                                                                          delta_cx,
-                                                                          to_layer_num);
-        if (!intersect) {
-            return false;
-        }
-    }
-
-    legal = find_compatible_compressed_loc_in_range(blk_type,
-                                                    delta_cx,
-                                                    from_compressed_locs[to_layer_num],
-                                                    search_range,
-                                                    to_compressed_loc,
-                                                    true,
-                                                    to_layer_num,
-                                                    false);
+    bool legal = find_compressed_loc_in_range_for_block(blk_type,
+                                                        b_from,
+                                                        delta_cx,
+                                                        from_compressed_locs[to_layer_num],
+                                                        search_range,
+                                                        to_compressed_loc,
+                                                        true,
+                                                        to_layer_num);
 
     if (!legal) {
         //No valid position found
@@ -960,28 +1080,14 @@ bool find_to_loc_centroid(t_logical_block_type_ptr blk_type,
     delta_cx = search_range.xmax - search_range.xmin;
 
     t_physical_tile_loc to_compressed_loc;
-    bool legal = false;
-
-    if (is_cluster_constrained(b_from)) {
-        bool intersect = intersect_range_limit_with_floorplan_constraints(blk_type,
-                                                                          b_from,
-                                                                          search_range,
-                                                                          delta_cx,
-                                                                          to_layer_num);
-        if (!intersect) {
-            return false;
-        }
-    }
-
-    //TODO: For now, we only move the blocks on the same tile
-    legal = find_compatible_compressed_loc_in_range(blk_type,
-                                                    delta_cx,
-                                                    from_compressed_loc[to_layer_num],
-                                                    search_range,
-                                                    to_compressed_loc,
-                                                    false,
-                                                    to_layer_num,
-                                                    false);
+    bool legal = find_compressed_loc_in_range_for_block(blk_type,
+                                                        b_from,
+                                                        delta_cx,
+                                                        from_compressed_loc[to_layer_num],
+                                                        search_range,
+                                                        to_compressed_loc,
+                                                        false,
+                                                        to_layer_num);
 
     if (!legal) {
         //No valid position found
@@ -1076,7 +1182,10 @@ bool find_compatible_compressed_loc_in_range(t_logical_block_type_ptr type,
     VTR_ASSERT(to_layer_num == from_loc.layer_num);
     const auto& compressed_block_grid = g_vpr_ctx.placement().compressed_block_grids[type->index];
     to_loc.layer_num = to_layer_num;
-    std::unordered_set<int> tried_cx_to;
+    //Reused across calls (one per thread) to avoid allocating for every proposed move
+    static thread_local t_tried_index_set tried_cx_to;
+    static thread_local t_tried_index_set tried_dy;
+    tried_cx_to.clear(delta_cx);
     bool legal = false;
     int possibilities;
     if (is_median)
@@ -1084,17 +1193,17 @@ bool find_compatible_compressed_loc_in_range(t_logical_block_type_ptr type,
     else
         possibilities = delta_cx;
 
-    while (!legal && (int)tried_cx_to.size() < possibilities) { //Until legal or all possibilities exhaused
+    while (!legal && tried_cx_to.size() < possibilities) { //Until legal or all possibilities exhaused
         //Pick a random x-location within [min_cx, max_cx],
         //until we find a legal swap, or have exhuasted all possiblites
-        to_loc.x = search_range.xmin + vtr::irand(delta_cx);
+        int dx = vtr::irand(delta_cx);
+        to_loc.x = search_range.xmin + dx;
 
         VTR_ASSERT(to_loc.x >= search_range.xmin);
         VTR_ASSERT(to_loc.x <= search_range.xmax);
 
         //Record this x location as tried
-        auto res = tried_cx_to.insert(to_loc.x);
-        if (!res.second) {
+        if (!tried_cx_to.insert(dx)) {
             continue; //Already tried this position
         }
 
@@ -1134,14 +1243,15 @@ bool find_compatible_compressed_loc_in_range(t_logical_block_type_ptr type,
         //At this point we know y_lower_iter and y_upper_iter
         //bound the range of valid blocks at this x-location, which
         //are within rlim_y
-        std::unordered_set<int> tried_dy;
-        while (!legal && (int)tried_dy.size() < y_range) { //Until legal or all possibilities exhausted
+        if (y_range > 0) {
+            tried_dy.clear(y_range - 1);
+        }
+        while (!legal && tried_dy.size() < y_range) { //Until legal or all possibilities exhausted
             //Randomly pick a y location
             int dy = vtr::irand(y_range - 1);
 
             //Record this y location as tried
-            auto res2 = tried_dy.insert(dy);
-            if (!res2.second) {
+            if (!tried_dy.insert(dy)) {
                 continue; //Already tried this position
             }
 
@@ -0,0 +1,513 @@
+/**
+ * @file multilevel_place.cpp
+ * @brief Defines the multilevel global placement declared in multilevel_place.h.
+ */
+
+#include "multilevel_place.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+#include "globals.h"
+#include "physical_types_util.h"
+#include "place_constraints.h"
+#include "place_macro.h"
+
+/* Side (in tiles) of the bins the multilevel placer places the nodes in */
+static constexpr int ML_BIN_SIZE = 4;
+
+/* Nets with more pins barely pull their blocks together, and are not seen by the multilevel placer */
+static constexpr size_t ML_MAX_NET_SIZE = 64;
+
+/* Coarsening stops once a netlist has no more nodes than this... */
+static constexpr size_t ML_MIN_COARSE_NODES = 64;
+
+/* ...or a level would keep more than this fraction of the nodes of the level below */
+static constexpr float ML_MIN_COARSENING_RATIO = 0.9;
+
+static constexpr size_t ML_MAX_LEVELS = 16;
+
+/* The coarsest netlist is annealed from a random placement... */
+static constexpr float ML_COARSEST_START_T_FACTOR = 2.;
+static constexpr int ML_COARSEST_MAX_TEMPS = 100;
+
+/* ...and every level below only refined locally */
+static constexpr float ML_REFINE_START_T_FACTOR = 0.1;
+static constexpr int ML_REFINE_MAX_TEMPS = 5;
+static constexpr int ML_REFINE_RLIM = 2;
+
+/* Resolution of the random numbers in [0, 1) of the annealer */
+static constexpr int ML_RAND_RESOLUTION = 1 << 20;
+
+static double ml_rand01(vtr::RandState& rand_state) {
+    return double(vtr::irand(ML_RAND_RESOLUTION - 1, rand_state)) / ML_RAND_RESOLUTION;
+}
+
+///@brief The HPWL (in bins) of a net, with node moved_node in bin moved_bin (pass OPEN to move none).
+static int ml_net_hpwl(const t_ml_netlist& netlist,
+                       const t_ml_bins& bins,
+                       const std::vector<int>& node_bins,
+                       int inet,
+                       int moved_node,
+                       int moved_bin) {
+    int xmin = std::numeric_limits<int>::max();
+    int xmax = std::numeric_limits<int>::min();
+    int ymin = xmin;
+    int ymax = xmax;
+    for (int node : netlist.net_nodes[inet]) {
+        int ibin = (node == moved_node) ? moved_bin : node_bins[node];
+        int x = bins.bin_x(ibin);
+        int y = bins.bin_y(ibin);
+        xmin = std::min(xmin, x);
+        xmax = std::max(xmax, x);
+        ymin = std::min(ymin, y);
+        ymax = std::max(ymax, y);
+    }
+    return (xmax - xmin) + (ymax - ymin);
+}
+
+void t_ml_netlist::load_node_nets() {
+    node_nets.assign(num_nodes(), std::vector<int>());
+    for (size_t inet = 0; inet < num_nets(); ++inet) {
+        for (int node : net_nodes[inet]) {
+            node_nets[node].push_back(inet);
+        }
+    }
+}
+
+int match_ml_nodes(const t_ml_netlist& netlist,
+                   const std::vector<int>& max_type_weight,
+                   std::vector<int>& parents,
+                   vtr::RandState& rand_state) {
+    const size_t num_nodes = netlist.num_nodes();
+    VTR_ASSERT(netlist.node_nets.size() == num_nodes);
+
+    parents.assign(num_nodes, OPEN);
+
+    std::vector<int> order(num_nodes);
+    std::iota(order.begin(), order.end(), 0);
+    vtr::shuffle(order.begin(), order.end(), rand_state);
+
+    //Connection of the current node to each of its candidate neighbours
+    std::vector<double> connections(num_nodes, 0.);
+    std::vector<int> neighbours;
+
+    int num_parents = 0;
+    for (int node : order) {
+        if (parents[node] != OPEN) {
+            continue;
+        }
+
+        int type = netlist.node_type[node];
+        int weight = netlist.node_weight[node];
+
+        neighbours.clear();
+        for (int inet : netlist.node_nets[node]) {
+            const auto& net_nodes = netlist.net_nodes[inet];
+            double net_connection = 1. / (net_nodes.size() - 1);
+            for (int other : net_nodes) {
+                if (other == node
+                    || parents[other] != OPEN
+                    || netlist.node_type[other] != type
+                    || weight + netlist.node_weight[other] > max_type_weight[type]) {
+                    continue;
+                }
+                if (connections[other] == 0.) {
+                    neighbours.push_back(other);
+                }
+                connections[other] += net_connection;
+            }
+        }
+
+        int best_neighbour = OPEN;
+        double best_score = 0.;
+        for (int other : neighbours) {
+            double score = connections[other] / (weight + netlist.node_weight[other]);
+            if (score > best_score) {
+                best_score = score;
+                best_neighbour = other;
+            }
+            connections[other] = 0.;
+        }
+
+        parents[node] = num_parents;
+        if (best_neighbour != OPEN) {
+            parents[best_neighbour] = num_parents;
+        }
+        ++num_parents;
+    }
+
+    return num_parents;
+}
+
+t_ml_netlist contract_ml_netlist(const t_ml_netlist& netlist,
+                                 const std::vector<int>& parents,
+                                 int num_parents) {
+    VTR_ASSERT(parents.size() == netlist.num_nodes());
+
+    t_ml_netlist coarse_netlist;
+    coarse_netlist.node_type.assign(num_parents, OPEN);
+    coarse_netlist.node_weight.assign(num_parents, 0);
+    for (size_t node = 0; node < netlist.num_nodes(); ++node) {
+        int parent = parents[node];
+        VTR_ASSERT(coarse_netlist.node_type[parent] == OPEN || coarse_netlist.node_type[parent] == netlist.node_type[node]);
+        coarse_netlist.node_type[parent] = netlist.node_type[node];
+        coarse_netlist.node_weight[parent] += netlist.node_weight[node];
+    }
+
+    //Last net each coarse node was added to, to add each of them once per net
+    std::vector<int> parent_net(num_parents, OPEN);
+    std::vector<int> coarse_nodes;
+    for (size_t inet = 0; inet < netlist.num_nets(); ++inet) {
+        coarse_nodes.clear();
+        for (int node : netlist.net_nodes[inet]) {
+            int parent = parents[node];
+            if (parent_net[parent] != int(inet)) {
+                parent_net[parent] = inet;
+                coarse_nodes.push_back(parent);
+            }
+        }
+
+        //Nets inside a coarse node no longer cost anything
+        if (coarse_nodes.size() >= 2) {
+            coarse_netlist.net_nodes.push_back(coarse_nodes);
+            coarse_netlist.net_weight.push_back(netlist.net_weight[inet]);
+        }
+    }
+
+    coarse_netlist.load_node_nets();
+    return coarse_netlist;
+}
+
+double ml_placement_cost(const t_ml_netlist& netlist,
+                         const t_ml_bins& bins,
+                         const std::vector<int>& node_bins,
+                         double overflow_weight) {
+    double cost = 0.;
+    for (size_t inet = 0; inet < netlist.num_nets(); ++inet) {
+        cost += netlist.net_weight[inet] * ml_net_hpwl(netlist, bins, node_bins, inet, OPEN, OPEN);
+    }
+
+    vtr::NdMatrix<int, 2> usage({bins.capacity.dim_size(0), size_t(bins.num_bins())}, 0);
+    for (size_t node = 0; node < netlist.num_nodes(); ++node) {
+        usage[netlist.node_type[node]][node_bins[node]] += netlist.node_weight[node];
+    }
+    for (size_t itype = 0; itype < usage.dim_size(0); ++itype) {
+        for (int ibin = 0; ibin < bins.num_bins(); ++ibin) {
+            cost += overflow_weight * std::max(usage[itype][ibin] - bins.capacity[itype][ibin], 0);
+        }
+    }
+
+    return cost;
+}
+
+double ml_overflow_weight(const t_ml_netlist& netlist) {
+    double net_pins = 0.;
+    for (size_t inet = 0; inet < netlist.num_nets(); ++inet) {
+        net_pins += netlist.net_weight[inet] * netlist.net_nodes[inet].size();
+    }
+    double clusters = std::accumulate(netlist.node_weight.begin(), netlist.node_weight.end(), 0.);
+
+    if (net_pins == 0. || clusters == 0.) {
+        return 1.;
+    }
+    return 2. * net_pins / clusters;
+}
+
+double anneal_ml_placement(const t_ml_netlist& netlist,
+                           const t_ml_bins& bins,
+                           std::vector<int>& node_bins,
+                           const t_ml_anneal_params& params,
+                           vtr::RandState& rand_state) {
+    const size_t num_nodes = netlist.num_nodes();
+    const size_t num_nets = netlist.num_nets();
+    VTR_ASSERT(node_bins.size() == num_nodes);
+    VTR_ASSERT(netlist.node_nets.size() == num_nodes);
+
+    const double overflow_weight = ml_overflow_weight(netlist);
+    double cost = ml_placement_cost(netlist, bins, node_bins, overflow_weight);
+    if (num_nodes == 0) {
+        return cost;
+    }
+
+    vtr::NdMatrix<int, 2> usage({bins.capacity.dim_size(0), size_t(bins.num_bins())}, 0);
+    for (size_t node = 0; node < num_nodes; ++node) {
+        usage[netlist.node_type[node]][node_bins[node]] += netlist.node_weight[node];
+    }
+
+    std::vector<int> net_hpwl(num_nets);
+    for (size_t inet = 0; inet < num_nets; ++inet) {
+        net_hpwl[inet] = ml_net_hpwl(netlist, bins, node_bins, inet, OPEN, OPEN);
+    }
+
+    //Proposes to move a random node to a random bin within the range limit with capacity for its type
+    auto propose_move = [&](int& node, int& to_bin) {
+        node = vtr::irand(num_nodes - 1, rand_state);
+        int from_bin = node_bins[node];
+        int xlow = std::max(bins.bin_x(from_bin) - params.rlim, 0);
+        int xhigh = std::min(bins.bin_x(from_bin) + params.rlim, bins.width - 1);
+        int ylow = std::max(bins.bin_y(from_bin) - params.rlim, 0);
+        int yhigh = std::min(bins.bin_y(from_bin) + params.rlim, bins.height - 1);
+        to_bin = bins.bin(xlow + vtr::irand(xhigh - xlow, rand_state),
+                          ylow + vtr::irand(yhigh - ylow, rand_state));
+        return to_bin != from_bin && bins.capacity[netlist.node_type[node]][to_bin] > 0;
+    };
+
+    //Returns the change in cost of a move, and loads the new HPWL of the node's nets
+    std::vector<int> new_net_hpwl;
+    auto move_delta_cost = [&](int node, int to_bin) {
+        int type = netlist.node_type[node];
+        int weight = netlist.node_weight[node];
+        int from_bin = node_bins[node];
+
+        double delta = 0.;
+        new_net_hpwl.clear();
+        for (int inet : netlist.node_nets[node]) {
+            new_net_hpwl.push_back(ml_net_hpwl(netlist, bins, node_bins, inet, node, to_bin));
+            delta += netlist.net_weight[inet] * (new_net_hpwl.back() - net_hpwl[inet]);
+        }
+
+        int from_usage = usage[type][from_bin];
+        int to_usage = usage[type][to_bin];
+        int from_capacity = bins.capacity[type][from_bin];
+        int to_capacity = bins.capacity[type][to_bin];
+        int delta_overflow = std::max(from_usage - weight - from_capacity, 0) - std::max(from_usage - from_capacity, 0)
+                             + std::max(to_usage + weight - to_capacity, 0) - std::max(to_usage - to_capacity, 0);
+        delta += overflow_weight * delta_overflow;
+
+        return delta;
+    };
+
+    auto commit_move = [&](int node, int to_bin) {
+        int type = netlist.node_type[node];
+        usage[type][node_bins[node]] -= netlist.node_weight[node];
+        usage[type][to_bin] += netlist.node_weight[node];
+        node_bins[node] = to_bin;
+
+        const auto& node_nets = netlist.node_nets[node];
+        for (size_t i = 0; i < node_nets.size(); ++i) {
+            net_hpwl[node_nets[i]] = new_net_hpwl[i];
+        }
+    };
+
+    const int moves_per_temp = params.moves_per_node * num_nodes;
+
+    //The starting temperature is relative to the average cost change of random moves
+    double sum_abs_delta = 0.;
+    int num_sampled_moves = 0;
+    for (int imove = 0; imove < moves_per_temp; ++imove) {
+        int node, to_bin;
+        if (propose_move(node, to_bin)) {
+            sum_abs_delta += std::abs(move_delta_cost(node, to_bin));
+            ++num_sampled_moves;
+        }
+    }
+    if (num_sampled_moves == 0 || sum_abs_delta == 0.) {
+        //Nothing can move, or no move changes anything
+        return cost;
+    }
+    double t = params.start_t_factor * sum_abs_delta / num_sampled_moves;
+
+    for (int itemp = 0; itemp < params.max_temps; ++itemp) {
+        int num_accepted = 0;
+        for (int imove = 0; imove < moves_per_temp; ++imove) {
+            int node, to_bin;
+            if (!propose_move(node, to_bin)) {
+                continue;
+            }
+
+            double delta = move_delta_cost(node, to_bin);
+            if (delta <= 0. || ml_rand01(rand_state) < std::exp(-delta / t)) {
+                commit_move(node, to_bin);
+                cost += delta;
+                ++num_accepted;
+            }
+        }
+
+        t *= params.alpha;
+
+        //Same exit criterion as the annealer's
+        if (num_accepted == 0 || (num_nets > 0 && t < 0.005 * cost / num_nets)) {
+            break;
+        }
+    }
+
+    return cost;
+}
+
+vtr::vector<ClusterBlockId, t_pl_loc> multilevel_global_placement(const t_placer_opts& placer_opts) {
+    vtr::ScopedStartFinishTimer timer("Multilevel Global Placement");
+
+    const auto& device_ctx = g_vpr_ctx.device();
+    const auto& cluster_ctx = g_vpr_ctx.clustering();
+    const auto& place_ctx = g_vpr_ctx.placement();
+    const auto& grid = device_ctx.grid;
+    const auto& clb_nlist = cluster_ctx.clb_nlist;
+
+    if (grid.get_num_layers() > 1) {
+        VTR_LOG_WARN("Multilevel placement only supports single layer devices: using the default initial placement\n");
+        return vtr::vector<ClusterBlockId, t_pl_loc>();
+    }
+
+    vtr::RandState rand_state = placer_opts.seed;
+
+    /* Count the sub_tiles of each logical block type in each bin */
+    const size_t num_types = device_ctx.logical_block_types.size();
+    t_ml_bins bins;
+    bins.width = (grid.width() + ML_BIN_SIZE - 1) / ML_BIN_SIZE;
+    bins.height = (grid.height() + ML_BIN_SIZE - 1) / ML_BIN_SIZE;
+    bins.capacity.resize({num_types, size_t(bins.num_bins())}, 0);
+    for (size_t x = 0; x < grid.width(); ++x) {
+        for (size_t y = 0; y < grid.height(); ++y) {
+            t_physical_tile_loc tile_loc(x, y, 0);
+            if (grid.get_width_offset(tile_loc) != 0 || grid.get_height_offset(tile_loc) != 0) {
+                continue;
+            }
+            int ibin = bins.bin(x / ML_BIN_SIZE, y / ML_BIN_SIZE);
+            for (const t_sub_tile& sub_tile : grid.get_physical_type(tile_loc)->sub_tiles) {
+                for (t_logical_block_type_ptr site : sub_tile.equivalent_sites) {
+                    bins.capacity[site->index][ibin] += sub_tile.capacity.total();
+                }
+            }
+        }
+    }
+
+    //Bins with room for each type, and the largest number of clusters of each type a node may hold
+    std::vector<std::vector<int>> type_bins(num_types);
+    std::vector<int> max_type_weight(num_types, 1);
+    for (size_t itype = 0; itype < num_types; ++itype) {
+        for (int ibin = 0; ibin < bins.num_bins(); ++ibin) {
+            if (bins.capacity[itype][ibin] > 0) {
+                type_bins[itype].push_back(ibin);
+                max_type_weight[itype] = std::max(max_type_weight[itype], bins.capacity[itype][ibin]);
+            }
+        }
+    }
+
+    /* Build the finest netlist: a node per macro and per block outside of macros */
+    t_ml_netlist netlist;
+    vtr::vector<ClusterBlockId, int> block_nodes(clb_nlist.blocks().size(), OPEN);
+    std::vector<ClusterBlockId> node_blocks;
+
+    auto add_node = [&](ClusterBlockId head_blk, int weight) {
+        node_blocks.push_back(head_blk);
+        netlist.node_type.push_back(clb_nlist.block_type(head_blk)->index);
+        netlist.node_weight.push_back(weight);
+        return int(node_blocks.size()) - 1;
+    };
+
+    //Blocks which are left to the initial placement
+    auto is_excluded = [&](ClusterBlockId blk_id) {
+        auto block_type = clb_nlist.block_type(blk_id);
+        return is_cluster_constrained(blk_id)
+               || type_bins[block_type->index].empty()
+               || (placer_opts.pad_loc_type == RANDOM && is_io_type(pick_physical_type(block_type)));
+    };
+
+    for (const t_pl_macro& pl_macro : place_ctx.pl_macros) {
+        bool excluded = std::any_of(pl_macro.members.begin(), pl_macro.members.end(),
+                                    [&](const t_pl_macro_member& member) { return is_excluded(member.blk_index); });
+        if (excluded) {
+            continue;
+        }
+        int node = add_node(pl_macro.members[0].blk_index, pl_macro.members.size());
+        for (const t_pl_macro_member& member : pl_macro.members) {
+            block_nodes[member.blk_index] = node;
+        }
+    }
+
+    for (ClusterBlockId blk_id : clb_nlist.blocks()) {
+        int imacro;
+        get_imacro_from_iblk(&imacro, blk_id, place_ctx.pl_macros);
+        if (imacro == OPEN && !is_excluded(blk_id)) {
+            block_nodes[blk_id] = add_node(blk_id, 1);
+        }
+    }
+
+    std::vector<int> net_nodes;
+    for (ClusterNetId net_id : clb_nlist.nets()) {
+        if (clb_nlist.net_is_ignored(net_id) || clb_nlist.net_pins(net_id).size() > ML_MAX_NET_SIZE) {
+            continue;
+        }
+
+        net_nodes.clear();
+        for (ClusterPinId pin_id : clb_nlist.net_pins(net_id)) {
+            int node = block_nodes[clb_nlist.pin_block(pin_id)];
+            if (node != OPEN && std::find(net_nodes.begin(), net_nodes.end(), node) == net_nodes.end()) {
+                net_nodes.push_back(node);
+            }
+        }
+        if (net_nodes.size() >= 2) {
+            netlist.net_nodes.push_back(net_nodes);
+            netlist.net_weight.push_back(1.);
+        }
+    }
+    netlist.load_node_nets();
+
+    /* Coarsen */
+    std::vector<t_ml_netlist> levels;
+    std::vector<std::vector<int>> level_parents;
+    levels.push_back(std::move(netlist));
+    while (levels.size() < ML_MAX_LEVELS && levels.back().num_nodes() > ML_MIN_COARSE_NODES) {
+        std::vector<int> parents;
+        int num_parents = match_ml_nodes(levels.back(), max_type_weight, parents, rand_state);
+        if (num_parents > ML_MIN_COARSENING_RATIO * levels.back().num_nodes()) {
+            break;
+        }
+        levels.push_back(contract_ml_netlist(levels.back(), parents, num_parents));
+        level_parents.push_back(std::move(parents));
+    }
+
+    /* Anneal the coarsest netlist from a random placement */
+    const t_ml_netlist& coarsest = levels.back();
+    std::vector<int> node_bins(coarsest.num_nodes());
+    for (size_t node = 0; node < coarsest.num_nodes(); ++node) {
+        const auto& bins_of_type = type_bins[coarsest.node_type[node]];
+        node_bins[node] = bins_of_type[vtr::irand(bins_of_type.size() - 1, rand_state)];
+    }
+
+    t_ml_anneal_params coarsest_params;
+    coarsest_params.start_t_factor = ML_COARSEST_START_T_FACTOR;
+    coarsest_params.max_temps = ML_COARSEST_MAX_TEMPS;
+    coarsest_params.rlim = std::max(bins.width, bins.height);
+    double cost = anneal_ml_placement(coarsest, bins, node_bins, coarsest_params, rand_state);
+    VTR_LOG("Multilevel placement level %zu: %zu nodes, %zu nets, cost %g\n",
+            levels.size() - 1, coarsest.num_nodes(), coarsest.num_nets(), cost);
+
+    /* Uncoarsen, refining each level from the placement of its parents */
+    t_ml_anneal_params refine_params;
+    refine_params.start_t_factor = ML_REFINE_START_T_FACTOR;
+    refine_params.max_temps = ML_REFINE_MAX_TEMPS;
+    refine_params.rlim = ML_REFINE_RLIM;
+    for (int ilevel = int(levels.size()) - 2; ilevel >= 0; --ilevel) {
+        const t_ml_netlist& level = levels[ilevel];
+        const std::vector<int>& parents = level_parents[ilevel];
+
+        std::vector<int> child_bins(level.num_nodes());
+        for (size_t node = 0; node < level.num_nodes(); ++node) {
+            child_bins[node] = node_bins[parents[node]];
+        }
+        node_bins = std::move(child_bins);
+
+        cost = anneal_ml_placement(level, bins, node_bins, refine_params, rand_state);
+        VTR_LOG("Multilevel placement level %d: %zu nodes, %zu nets, cost %g\n",
+                ilevel, level.num_nodes(), level.num_nets(), cost);
+    }
+
+    /* Target a random tile of the bin of each node */
+    vtr::vector<ClusterBlockId, t_pl_loc> block_targets(clb_nlist.blocks().size());
+    for (size_t node = 0; node < node_blocks.size(); ++node) {
+        int ibin = node_bins[node];
+        int x = std::min<int>(bins.bin_x(ibin) * ML_BIN_SIZE + vtr::irand(ML_BIN_SIZE - 1, rand_state), grid.width() - 1);
+        int y = std::min<int>(bins.bin_y(ibin) * ML_BIN_SIZE + vtr::irand(ML_BIN_SIZE - 1, rand_state), grid.height() - 1);
+        block_targets[node_blocks[node]] = t_pl_loc(x, y, 0, 0);
+    }
+
+    return block_targets;
+}
@@ -0,0 +1,155 @@
+#ifndef VPR_MULTILEVEL_PLACE_H
+#define VPR_MULTILEVEL_PLACE_H
+
+/**
+ * @file multilevel_place.h
+ * @brief Multilevel global placement of the clustered netlist (--place_multilevel).
+ *
+ * The clustered netlist is coarsened level by level, by merging pairs of strongly connected
+ * nodes of the same logical block type (heavy-edge matching), until it stops shrinking. The
+ * coarsest netlist is then annealed over a grid of bins (groups of tiles), with a wirelength
+ * (HPWL in bins) cost and a penalty for the nodes exceeding the capacity of the bins for their
+ * type. It is then uncoarsened one level at a time: the children of a node start in its bin,
+ * and a short low-temperature anneal with a small range limit refines their positions.
+ *
+ * The bin of each cluster is used as the target location of the initial placement, which
+ * legalizes it (see initial_placement()), and the annealer then refines the legal placement.
+ *
+ * Placement macros are kept whole, as single nodes of their head block, and blocks with
+ * floorplan constraints are left to the initial placement.
+ */
+
+#include <vector>
+
+#include "vtr_ndmatrix.h"
+#include "vtr_random.h"
+#include "vtr_vector.h"
+
+#include "vpr_types.h"
+
+/**
+ * @brief A netlist of the multilevel placer: clusters at the finest level, groups of them above.
+ */
+struct t_ml_netlist {
+    ///@brief Logical block type of each node: only nodes of the same type are merged [0..num_nodes-1]
+    std::vector<int> node_type;
+
+    ///@brief Number of clusters in each node [0..num_nodes-1]
+    std::vector<int> node_weight;
+
+    ///@brief Distinct nodes of each net, at least 2 [0..num_nets-1]
+    std::vector<std::vector<int>> net_nodes;
+
+    ///@brief Weight of each net in the wirelength cost [0..num_nets-1]
+    std::vector<float> net_weight;
+
+    ///@brief Nets of each node, loaded by load_node_nets() [0..num_nodes-1]
+    std::vector<std::vector<int>> node_nets;
+
+    size_t num_nodes() const { return node_type.size(); }
+    size_t num_nets() const { return net_nodes.size(); }
+
+    ///@brief Loads node_nets from net_nodes.
+    void load_node_nets();
+};
+
+/**
+ * @brief Matches each node with its most strongly connected unmatched neighbour of the same
+ *        type, in a random order.
+ *
+ * The connection between two nodes is the sum, over the nets they share, of 1 / (net size - 1),
+ * divided by their combined weight so that small nodes are matched first. Pairs heavier than
+ * the max_type_weight of their type are not formed.
+ *
+ * @param parents Loaded with the coarse node of each node [0..num_nodes-1]
+ * @return The number of coarse nodes.
+ */
+int match_ml_nodes(const t_ml_netlist& netlist,
+                   const std::vector<int>& max_type_weight,
+                   std::vector<int>& parents,
+                   vtr::RandState& rand_state);
+
+/**
+ * @brief Returns the coarse netlist of a matching: each net connects the coarse nodes of
+ *        its nodes, and the nets left with a single coarse node are dropped.
+ */
+t_ml_netlist contract_ml_netlist(const t_ml_netlist& netlist,
+                                 const std::vector<int>& parents,
+                                 int num_parents);
+
+/**
+ * @brief The bins the multilevel placer places the nodes in.
+ */
+struct t_ml_bins {
+    int width = 0;
+    int height = 0;
+
+    ///@brief Number of clusters of each type which fit in each bin, [0..num_types-1][0..width*height-1]
+    vtr::NdMatrix<int, 2> capacity;
+
+    int num_bins() const { return width * height; }
+    int bin(int x, int y) const { return x * height + y; }
+    int bin_x(int ibin) const { return ibin / height; }
+    int bin_y(int ibin) const { return ibin % height; }
+};
+
+/**
+ * @brief The schedule of an anneal of the multilevel placer.
+ */
+struct t_ml_anneal_params {
+    ///@brief The starting temperature, relative to the average cost change of random moves
+    float start_t_factor = 1.;
+
+    ///@brief Temperatures are multiplied by alpha after each round of moves
+    float alpha = 0.9;
+
+    ///@brief The largest number of temperatures
+    int max_temps = 100;
+
+    ///@brief Moves tried per node at each temperature
+    int moves_per_node = 10;
+
+    ///@brief Largest distance (in bins, along x and y) a node moves by
+    int rlim = 1;
+};
+
+/**
+ * @brief Returns the cost of a placement of the nodes into the bins: the weighted HPWL of the
+ *        nets (in bins) plus overflow_weight times the clusters placed over the bin capacities.
+ */
+double ml_placement_cost(const t_ml_netlist& netlist,
+                         const t_ml_bins& bins,
+                         const std::vector<int>& node_bins,
+                         double overflow_weight);
+
+/**
+ * @brief Returns the weight of the capacity overflow in the cost of a netlist: twice the
+ *        average weighted number of nets of a cluster, so that moving a node into a full
+ *        bin costs more than it can save in wirelength.
+ */
+double ml_overflow_weight(const t_ml_netlist& netlist);
+
+/**
+ * @brief Anneals the placement of the nodes into the bins (see ml_placement_cost()).
+ *
+ * Nodes are only moved to bins with some capacity for their type.
+ *
+ * @param node_bins The starting bin of each node, updated with the final one [0..num_nodes-1]
+ * @return The final cost.
+ */
+double anneal_ml_placement(const t_ml_netlist& netlist,
+                           const t_ml_bins& bins,
+                           std::vector<int>& node_bins,
+                           const t_ml_anneal_params& params,
+                           vtr::RandState& rand_state);
+
+/**
+ * @brief Performs the multilevel global placement of the clustered netlist on the device.
+ *
+ * @return The target location of each block to be placed by initial_placement(): the head of
+ *         each macro and each unconstrained block. Other blocks have an INVALID target (x == OPEN).
+ *         Empty if the device is not supported (multiple layers).
+ */
+vtr::vector<ClusterBlockId, t_pl_loc> multilevel_global_placement(const t_placer_opts& placer_opts);
+
+#endif
@@ -32,6 +32,14 @@ void NoCPlacementCheckpoint::save_checkpoint(double cost) {
     cost_ = cost;
 }
 
+void NoCPlacementCheckpoint::save_checkpoint(double cost, const std::unordered_map<ClusterBlockId, t_pl_loc>& router_locations) {
+    for (const auto& [router_bid, loc] : router_locations) {
+        router_locations_.at(router_bid) = loc;
+    }
+    valid_ = true;
+    cost_ = cost;
+}
+
 void NoCPlacementCheckpoint::restore_checkpoint(t_placer_costs& costs) {
     const auto& noc_ctx = g_vpr_ctx.noc();
     const auto& device_ctx = g_vpr_ctx.device();
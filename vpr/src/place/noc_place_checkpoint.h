@@ -40,6 +40,14 @@ class NoCPlacementCheckpoint {
      */
     void save_checkpoint(double cost);
 
+    /**
+     * @brief Saves the given NoC router placement as a checkpoint
+     *
+     *  @param cost: The placement cost associated with the given placement
+     *  @param router_locations: The location of each router cluster
+     */
+    void save_checkpoint(double cost, const std::unordered_map<ClusterBlockId, t_pl_loc>& router_locations);
+
     /**
      * @brief Loads the save checkpoint into global placement data structues.
      *
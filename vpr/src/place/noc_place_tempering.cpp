@@ -0,0 +1,320 @@
+#include "noc_place_tempering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "vtr_assert.h"
+
+#ifdef VPR_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+///@brief Number of random moves sampled to set the hottest temperature
+static constexpr int NOC_TEMPERING_TEMPERATURE_SAMPLES = 1000;
+
+///@brief Number of locations tried by propose_move() before giving up
+static constexpr int NOC_TEMPERING_MOVE_TRIES = 10;
+
+static constexpr int NOC_TEMPERING_RAND_RESOLUTION = 1 << 24;
+
+///@brief Returns a random number in [0, 1)
+static double rand_unit(vtr::RandState& rand_state) {
+    return double(vtr::irand(NOC_TEMPERING_RAND_RESOLUTION - 1, rand_state)) / NOC_TEMPERING_RAND_RESOLUTION;
+}
+
+void t_noc_tempering_model::load_router_flows() {
+    router_flows.assign(num_routers(), {});
+    for (int flow = 0; flow < (int)flows.size(); ++flow) {
+        router_flows[flows[flow].src_router].push_back(flow);
+        if (flows[flow].sink_router != flows[flow].src_router) {
+            router_flows[flows[flow].sink_router].push_back(flow);
+        }
+    }
+}
+
+NocTemperingReplica::NocTemperingReplica(const t_noc_tempering_model& model, std::vector<int> router_phy)
+    : model_(&model)
+    , router_phy_(std::move(router_phy))
+    , phy_router_(model.num_phy_routers(), -1)
+    , link_usage_(model.link_bandwidth.size(), 0.)
+    , flow_costs_(model.flows.size())
+    , link_stamp_(model.link_bandwidth.size(), 0)
+    , flow_stamp_(model.flows.size(), 0) {
+    VTR_ASSERT(router_phy_.size() == model.num_routers());
+
+    for (size_t phy = 0; phy < model.num_phy_routers(); ++phy) {
+        if (model.phy_blocked[phy]) {
+            phy_router_[phy] = -2;
+        }
+    }
+    for (int router = 0; router < (int)router_phy_.size(); ++router) {
+        VTR_ASSERT(phy_router_[router_phy_[router]] == -1);
+        phy_router_[router_phy_[router]] = router;
+    }
+
+    for (int flow = 0; flow < (int)model.flows.size(); ++flow) {
+        change_flow_route(flow, 1.);
+        flow_costs_[flow] = flow_costs(flow);
+        aggregate_bandwidth_ += flow_costs_[flow].aggregate_bandwidth;
+        latency_ += flow_costs_[flow].latency;
+        latency_overrun_ += flow_costs_[flow].latency_overrun;
+    }
+    for (int link = 0; link < (int)link_usage_.size(); ++link) {
+        congestion_ += link_congestion(link);
+    }
+
+    cost_ = aggregate_bandwidth_ * model.aggregate_bandwidth_factor
+            + latency_ * model.latency_factor
+            + latency_overrun_ * model.latency_overrun_factor
+            + congestion_ * model.congestion_factor;
+
+    best_cost_ = cost_;
+    best_router_phy_ = router_phy_;
+}
+
+NocTemperingReplica::t_flow_costs NocTemperingReplica::flow_costs(int flow) const {
+    const t_noc_tempering_flow& flow_info = model_->flows[flow];
+    size_t route = model_->route_index(router_phy_[flow_info.src_router], router_phy_[flow_info.sink_router]);
+    size_t num_links = model_->route_offsets[route + 1] - model_->route_offsets[route];
+    double latency = model_->route_latency[route];
+
+    t_flow_costs costs;
+    costs.aggregate_bandwidth = flow_info.priority * flow_info.bandwidth * num_links;
+    costs.latency = flow_info.priority * latency;
+    costs.latency_overrun = flow_info.priority * std::max(latency - flow_info.max_latency, 0.);
+    return costs;
+}
+
+double NocTemperingReplica::link_congestion(int link) const {
+    double bandwidth = model_->link_bandwidth[link];
+    return std::max(link_usage_[link] - bandwidth, 0.) / bandwidth;
+}
+
+void NocTemperingReplica::change_flow_route(int flow, double bandwidth_sign) {
+    const t_noc_tempering_flow& flow_info = model_->flows[flow];
+    size_t route = model_->route_index(router_phy_[flow_info.src_router], router_phy_[flow_info.sink_router]);
+
+    for (size_t ilink = model_->route_offsets[route]; ilink < model_->route_offsets[route + 1]; ++ilink) {
+        int link = model_->route_links[ilink];
+        if (link_stamp_[link] != stamp_) {
+            link_stamp_[link] = stamp_;
+            prev_link_usages_.emplace_back(link, link_usage_[link]);
+        }
+        link_usage_[link] += bandwidth_sign * flow_info.bandwidth;
+    }
+}
+
+bool NocTemperingReplica::propose_move(float rlim, vtr::RandState& rand_state, int& router, int& to_phy) const {
+    const t_noc_tempering_model& model = *model_;
+
+    router = vtr::irand((int)model.num_routers() - 1, rand_state);
+    if (model.router_fixed[router]) {
+        return false;
+    }
+
+    int from_phy = router_phy_[router];
+    int range = std::max(int(rlim), 1);
+    int xlow = std::max(model.phy_x[from_phy] - range, 0);
+    int xhigh = std::min(model.phy_x[from_phy] + range, (int)model.phy_at.dim_size(0) - 1);
+    int ylow = std::max(model.phy_y[from_phy] - range, 0);
+    int yhigh = std::min(model.phy_y[from_phy] + range, (int)model.phy_at.dim_size(1) - 1);
+
+    for (int itry = 0; itry < NOC_TEMPERING_MOVE_TRIES; ++itry) {
+        to_phy = model.phy_at[xlow + vtr::irand(xhigh - xlow, rand_state)][ylow + vtr::irand(yhigh - ylow, rand_state)];
+        if (to_phy < 0 || to_phy == from_phy || !model.is_legal(router, to_phy)) {
+            continue;
+        }
+
+        int other = phy_router_[to_phy];
+        if (other == -2 || (other >= 0 && (model.router_fixed[other] || !model.is_legal(other, from_phy)))) {
+            continue;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+void NocTemperingReplica::reroute_flows(int router) {
+    for (int flow : model_->router_flows[router]) {
+        if (flow_stamp_[flow] != stamp_) {
+            flow_stamp_[flow] = stamp_;
+            prev_flow_costs_.emplace_back(flow, flow_costs_[flow]);
+            change_flow_route(flow, -1.);
+        }
+    }
+}
+
+double NocTemperingReplica::apply_move(int router, int to_phy) {
+    ++stamp_;
+    prev_link_usages_.clear();
+    prev_flow_costs_.clear();
+    prev_cost_ = cost_;
+
+    moved_router_ = router;
+    moved_from_phy_ = router_phy_[router];
+    moved_to_phy_ = to_phy;
+    int other = phy_router_[to_phy];
+
+    //Remove the routes of the flows of the moved routers, then move them and add their new routes
+    reroute_flows(router);
+    if (other >= 0) {
+        reroute_flows(other);
+    }
+
+    router_phy_[router] = to_phy;
+    phy_router_[to_phy] = router;
+    phy_router_[moved_from_phy_] = other;
+    if (other >= 0) {
+        router_phy_[other] = moved_from_phy_;
+    }
+
+    for (const auto& [flow, prev_costs] : prev_flow_costs_) {
+        change_flow_route(flow, 1.);
+        flow_costs_[flow] = flow_costs(flow);
+        aggregate_bandwidth_ += flow_costs_[flow].aggregate_bandwidth - prev_costs.aggregate_bandwidth;
+        latency_ += flow_costs_[flow].latency - prev_costs.latency;
+        latency_overrun_ += flow_costs_[flow].latency_overrun - prev_costs.latency_overrun;
+    }
+
+    //Links in both the old and new routes of a flow are only logged once, with their usage before the move
+    for (const auto& [link, prev_usage] : prev_link_usages_) {
+        double bandwidth = model_->link_bandwidth[link];
+        congestion_ += link_congestion(link) - std::max(prev_usage - bandwidth, 0.) / bandwidth;
+    }
+
+    cost_ = aggregate_bandwidth_ * model_->aggregate_bandwidth_factor
+            + latency_ * model_->latency_factor
+            + latency_overrun_ * model_->latency_overrun_factor
+            + congestion_ * model_->congestion_factor;
+
+    return cost_ - prev_cost_;
+}
+
+void NocTemperingReplica::commit_move() {
+    moved_router_ = -1;
+
+    if (cost_ < best_cost_) {
+        best_cost_ = cost_;
+        best_router_phy_ = router_phy_;
+    }
+}
+
+void NocTemperingReplica::revert_move() {
+    VTR_ASSERT(moved_router_ >= 0);
+
+    int other = phy_router_[moved_from_phy_];
+    router_phy_[moved_router_] = moved_from_phy_;
+    phy_router_[moved_from_phy_] = moved_router_;
+    phy_router_[moved_to_phy_] = other;
+    if (other >= 0) {
+        router_phy_[other] = moved_to_phy_;
+    }
+
+    for (const auto& [link, prev_usage] : prev_link_usages_) {
+        double bandwidth = model_->link_bandwidth[link];
+        congestion_ += std::max(prev_usage - bandwidth, 0.) / bandwidth - link_congestion(link);
+        link_usage_[link] = prev_usage;
+    }
+    for (const auto& [flow, prev_costs] : prev_flow_costs_) {
+        aggregate_bandwidth_ += prev_costs.aggregate_bandwidth - flow_costs_[flow].aggregate_bandwidth;
+        latency_ += prev_costs.latency - flow_costs_[flow].latency;
+        latency_overrun_ += prev_costs.latency_overrun - flow_costs_[flow].latency_overrun;
+        flow_costs_[flow] = prev_costs;
+    }
+
+    cost_ = prev_cost_;
+    moved_router_ = -1;
+}
+
+double temper_noc_placement(const t_noc_tempering_model& model,
+                            std::vector<int>& router_phy,
+                            const t_noc_tempering_params& params,
+                            vtr::RandState& rand_state) {
+    const int num_replicas = std::max(params.num_replicas, 1);
+    const float max_rlim = std::max(model.phy_at.dim_size(0), model.phy_at.dim_size(1));
+
+    NocTemperingReplica start(model, router_phy);
+
+    //At the hottest temperature, an average uphill move is accepted with probability 0.5
+    double uphill_delta_sum = 0.;
+    int num_uphill = 0;
+    for (int isample = 0; isample < NOC_TEMPERING_TEMPERATURE_SAMPLES; ++isample) {
+        int router, to_phy;
+        if (start.propose_move(max_rlim, rand_state, router, to_phy)) {
+            double delta_cost = start.apply_move(router, to_phy);
+            start.revert_move();
+            if (delta_cost > 0.) {
+                uphill_delta_sum += delta_cost;
+                ++num_uphill;
+            }
+        }
+    }
+    if (num_uphill == 0) {
+        //No move makes the placement worse (or no move is possible): nothing to anneal
+        return start.cost();
+    }
+    const double hot_temperature = uphill_delta_sum / num_uphill / std::log(2.);
+
+    //Replica k anneals at temperatures[k], from the hottest (with the largest range limit) to the coldest
+    std::vector<double> temperatures(num_replicas);
+    std::vector<float> rlims(num_replicas);
+    std::vector<vtr::RandState> rand_states(num_replicas);
+    for (int k = 0; k < num_replicas; ++k) {
+        double frac = (num_replicas > 1) ? double(k) / (num_replicas - 1) : 1.;
+        temperatures[k] = hot_temperature * std::pow(params.cold_temperature_ratio, frac);
+        rlims[k] = 1.f + (max_rlim - 1.f) * float(1. - frac);
+        rand_states[k] = vtr::irand(std::numeric_limits<int>::max() - 1, rand_state);
+    }
+
+    std::vector<NocTemperingReplica> replicas(num_replicas, start);
+
+    auto anneal_replica = [&](int k, int num_moves) {
+        NocTemperingReplica& replica = replicas[k];
+        vtr::RandState& replica_rand_state = rand_states[k];
+        for (int imove = 0; imove < num_moves; ++imove) {
+            int router, to_phy;
+            if (!replica.propose_move(rlims[k], replica_rand_state, router, to_phy)) {
+                continue;
+            }
+
+            double delta_cost = replica.apply_move(router, to_phy);
+            if (delta_cost <= 0. || rand_unit(replica_rand_state) < std::exp(-delta_cost / temperatures[k])) {
+                replica.commit_move();
+            } else {
+                replica.revert_move();
+            }
+        }
+    };
+
+    const int moves_per_exchange = std::max(params.moves_per_exchange, 1);
+    for (int moves_done = 0, iround = 0; moves_done < params.moves_per_replica; moves_done += moves_per_exchange, ++iround) {
+        int num_moves = std::min(moves_per_exchange, params.moves_per_replica - moves_done);
+
+#ifdef VPR_USE_TBB
+        tbb::parallel_for(0, num_replicas, [&](int k) {
+            anneal_replica(k, num_moves);
+        });
+#else
+        for (int k = 0; k < num_replicas; ++k) {
+            anneal_replica(k, num_moves);
+        }
+#endif
+
+        //Exchange the placements of neighbouring temperatures, alternating between the even and odd pairs
+        for (int k = iround % 2; k + 1 < num_replicas; k += 2) {
+            double exponent = (replicas[k].cost() - replicas[k + 1].cost()) * (1. / temperatures[k] - 1. / temperatures[k + 1]);
+            if (exponent >= 0. || rand_unit(rand_state) < std::exp(exponent)) {
+                std::swap(replicas[k], replicas[k + 1]);
+            }
+        }
+    }
+
+    auto best_replica = std::min_element(replicas.begin(), replicas.end(), [](const NocTemperingReplica& lhs, const NocTemperingReplica& rhs) {
+        return lhs.best_cost() < rhs.best_cost();
+    });
+    router_phy = best_replica->best_router_phy();
+
+    return best_replica->best_cost();
+}
@@ -0,0 +1,201 @@
+#ifndef VPR_NOC_PLACE_TEMPERING_H
+#define VPR_NOC_PLACE_TEMPERING_H
+
+/**
+ * @file noc_place_tempering.h
+ * @brief Parallel tempering of the initial NoC router placement.
+ *
+ * The initial NoC placement only moves the NoC router clusters between the physical routers,
+ * and its cost only depends on the routes of the traffic flows between them. When the routes
+ * only depend on their end routers, the route (and latency) between each pair of physical
+ * routers is found once, and each replica of the placement evaluates its moves from this table,
+ * with its own link bandwidth usages, without touching the global placement and NoC state.
+ *
+ * Several replicas are annealed in parallel, each at a fixed temperature (geometrically spaced,
+ * with a range limit shrinking with the temperature). After each round of moves, the replicas
+ * at neighbouring temperatures exchange their placements with probability
+ * min(1, exp((cost_i - cost_j) * (1 / T_i - 1 / T_j))): hot replicas explore, and the good
+ * placements they find sink to the cold replicas, which refine them. The result only depends
+ * on the seed and the number of replicas, not on the number of threads.
+ */
+
+#include <vector>
+
+#include "vtr_ndmatrix.h"
+#include "vtr_random.h"
+
+/**
+ * @brief A traffic flow of the tempering model, between two logical routers.
+ */
+struct t_noc_tempering_flow {
+    int src_router;
+    int sink_router;
+    double bandwidth;
+    double priority;
+    double max_latency;
+};
+
+/**
+ * @brief The initial NoC placement problem: logical routers (the NoC router clusters) are
+ *        placed on physical routers, at most one per physical router.
+ */
+struct t_noc_tempering_model {
+    ///@brief Compressed grid coordinates of each physical router [0..num_phy_routers-1]
+    std::vector<int> phy_x;
+    std::vector<int> phy_y;
+
+    ///@brief Physical router at each compressed grid location, or -1
+    vtr::NdMatrix<int, 2> phy_at;
+
+    ///@brief Physical routers holding other (non-router) blocks, which are never moved [0..num_phy_routers-1]
+    std::vector<char> phy_blocked;
+
+    ///@brief Links of the route between each pair of physical routers, route(src, sink) is
+    ///       route_links[route_offsets[src * num_phy_routers + sink]..route_offsets[src * num_phy_routers + sink + 1]-1]
+    std::vector<size_t> route_offsets;
+    std::vector<int> route_links;
+
+    ///@brief Latency of the route between each pair of physical routers [src * num_phy_routers + sink]
+    std::vector<double> route_latency;
+
+    ///@brief Bandwidth of each link [0..num_links-1]
+    std::vector<double> link_bandwidth;
+
+    ///@brief Whether each logical router is fixed [0..num_routers-1]
+    std::vector<char> router_fixed;
+
+    ///@brief Physical routers each logical router may be placed on: empty if any, else a flag per physical router
+    std::vector<std::vector<char>> router_legal_phy;
+
+    ///@brief Traffic flows of each logical router [0..num_routers-1]
+    std::vector<std::vector<int>> router_flows;
+
+    std::vector<t_noc_tempering_flow> flows;
+
+    ///@brief Factor of each cost term (aggregate bandwidth, latency, latency overrun, congestion) in the
+    ///       placement cost: the term's normalization factor times its weight
+    double aggregate_bandwidth_factor = 0.;
+    double latency_factor = 0.;
+    double latency_overrun_factor = 0.;
+    double congestion_factor = 0.;
+
+    size_t num_phy_routers() const { return phy_x.size(); }
+    size_t num_routers() const { return router_fixed.size(); }
+    size_t route_index(int src_phy, int sink_phy) const { return size_t(src_phy) * num_phy_routers() + sink_phy; }
+
+    ///@brief Returns whether logical router may be placed on physical router phy
+    bool is_legal(int router, int phy) const {
+        return router_legal_phy[router].empty() || router_legal_phy[router][phy];
+    }
+
+    ///@brief Loads router_flows from flows
+    void load_router_flows();
+};
+
+/**
+ * @brief A placement of the logical routers of a tempering model, with its costs, which
+ *        can apply and revert moves incrementally.
+ */
+class NocTemperingReplica {
+  public:
+    /**
+     * @param router_phy The physical router of each logical router [0..num_routers-1]
+     */
+    NocTemperingReplica(const t_noc_tempering_model& model, std::vector<int> router_phy);
+
+    ///@brief The placement cost
+    double cost() const { return cost_; }
+
+    ///@brief The physical router of each logical router
+    const std::vector<int>& router_phy() const { return router_phy_; }
+
+    ///@brief The lowest cost met since the replica was created, and its placement
+    double best_cost() const { return best_cost_; }
+    const std::vector<int>& best_router_phy() const { return best_router_phy_; }
+
+    /**
+     * @brief Picks a random movable logical router and a physical router within rlim of it
+     *        (compressed grid units, along x and y) to move it to, swapping it with the
+     *        router placed there, if any.
+     *
+     * @return False if no legal move was found.
+     */
+    bool propose_move(float rlim, vtr::RandState& rand_state, int& router, int& to_phy) const;
+
+    ///@brief Applies a move proposed by propose_move(), and returns its change in cost
+    double apply_move(int router, int to_phy);
+
+    ///@brief Keeps the last move applied
+    void commit_move();
+
+    ///@brief Undoes the last move applied
+    void revert_move();
+
+  private:
+    struct t_flow_costs {
+        double aggregate_bandwidth = 0.;
+        double latency = 0.;
+        double latency_overrun = 0.;
+    };
+
+    t_flow_costs flow_costs(int flow) const;
+    double link_congestion(int link) const;
+    void reroute_flows(int router);
+    void change_flow_route(int flow, double bandwidth_sign);
+
+    const t_noc_tempering_model* model_;
+    std::vector<int> router_phy_;
+    std::vector<int> phy_router_; // -1 if empty, -2 if blocked
+    std::vector<double> link_usage_;
+    std::vector<t_flow_costs> flow_costs_;
+
+    double aggregate_bandwidth_ = 0.;
+    double latency_ = 0.;
+    double latency_overrun_ = 0.;
+    double congestion_ = 0.;
+    double cost_ = 0.;
+
+    double best_cost_;
+    std::vector<int> best_router_phy_;
+
+    // Undo log of the last move: the moved routers, and the link usages and flow costs it changed
+    int moved_router_ = -1;
+    int moved_from_phy_ = -1;
+    int moved_to_phy_ = -1;
+    double prev_cost_ = 0.;
+    std::vector<std::pair<int, double>> prev_link_usages_;
+    std::vector<std::pair<int, t_flow_costs>> prev_flow_costs_;
+    std::vector<int> link_stamp_;
+    std::vector<int> flow_stamp_;
+    int stamp_ = 0;
+};
+
+/**
+ * @brief The schedule of a parallel tempering of the initial NoC placement.
+ */
+struct t_noc_tempering_params {
+    ///@brief Number of replicas (and of temperatures)
+    int num_replicas = 8;
+
+    ///@brief Moves tried by each replica
+    int moves_per_replica = 100000;
+
+    ///@brief Moves tried by each replica between exchanges
+    int moves_per_exchange = 1000;
+
+    ///@brief The coldest temperature, relative to the hottest one
+    double cold_temperature_ratio = 1e-3;
+};
+
+/**
+ * @brief Improves a placement of the tempering model by parallel tempering (see the file comment).
+ *
+ * @param router_phy The starting placement, updated with the best placement found [0..num_routers-1]
+ * @return The cost of the best placement.
+ */
+double temper_noc_placement(const t_noc_tempering_model& model,
+                            std::vector<int>& router_phy,
+                            const t_noc_tempering_params& params,
+                            vtr::RandState& rand_state);
+
+#endif
@@ -5,6 +5,7 @@
 #include "vtr_log.h"
 #include "vtr_assert.h"
 #include "vtr_random.h"
+#include "vtr_hash.h"
 
 #include "channel_dependency_graph.h"
 #include "noc_routing_algorithm_creator.h"
@@ -17,6 +18,9 @@
 #endif
 
 #include <fstream>
+#include <memory>
+#include <unordered_map>
+#include <utility>
 
 /********************** Variables local to noc_place_utils.c pp***************************/
 /* Proposed and actual cost of a noc traffic flow used for each move assessment */
@@ -28,8 +32,30 @@ static std::vector<NocTrafficFlowId> affected_traffic_flows;
 /* Proposed and actual congestion cost of a NoC link used for each move assessment */
 static vtr::vector<NocLinkId, double> link_congestion_costs, proposed_link_congestion_costs;
 
-/* Keeps track of NoC links whose bandwidth usage have been updated at each attempted placement move*/
-static std::unordered_set<NocLinkId> affected_noc_links;
+/* Keeps track of NoC links whose bandwidth usage may have been updated at each attempted placement move.
+ * is_noc_link_affected marks the links in affected_noc_links, so each link is only added once. */
+static std::vector<NocLinkId> affected_noc_links;
+static vtr::vector<NocLinkId, bool> is_noc_link_affected;
+
+/* Routes of the affected traffic flows before they were re-routed by the current placement move.
+ * Used to revert the routes of a rejected move without re-routing them.
+ * Only valid (for the flows in affected_traffic_flows) while prev_traffic_flow_routes_valid is true. */
+static vtr::vector<NocTrafficFlowId, std::vector<NocLinkId>> prev_traffic_flow_routes;
+static bool prev_traffic_flow_routes_valid = false;
+
+/* Routes found between pairs of NoC routers, shared by all traffic flows between them.
+ * Only used with routing algorithms whose routes do not depend on the traffic flow.
+ * The cache is only valid for the NoC model and routing algorithm it was built with. */
+static std::unordered_map<std::pair<NocRouterId, NocRouterId>, std::vector<NocLinkId>, vtr::hash_pair> noc_route_cache;
+static const NocStorage* noc_route_cache_model = nullptr;
+static const NocRouting* noc_route_cache_router = nullptr;
+
+/* Channel dependency graph of the current traffic flow routes, used to reject moves whose routes could deadlock.
+ * Only built when deadlock freedom is enforced, and the initial routes are deadlock free. */
+static bool enforce_noc_deadlock_freedom = false;
+static std::unique_ptr<ChannelDependencyGraph> noc_channel_dependency_graph;
+/* Whether the channel dependency graph holds the routes proposed by the current move (rather than the previous ones) */
+static bool noc_channel_dependency_graph_has_proposed_routes = false;
 /*********************************************************** *****************************/
 
 /**
@@ -47,16 +73,27 @@ static bool select_random_router_cluster(ClusterBlockId& b_from,
                                          t_logical_block_type_ptr& cluster_from_type);
 
 /**
- * @brief Given two traffic flow routes, finds links that appear
- * only in one route.
+ * @brief Adds the links of a traffic flow route to the links affected by the current move.
  *
- * @param prev_links Previous route before re-routing the traffic flow
- * @param curr_links Current route after re-routing the traffic flow
+ * @param traffic_flow_route The route (before or after re-routing) of a re-routed traffic flow.
+ */
+static void mark_affected_noc_links(const std::vector<NocLinkId>& traffic_flow_route);
+
+/**
+ * @brief Builds the channel dependency graph of the current traffic flow routes
+ * if deadlock freedom is enforced. If the routes already contain a cycle,
+ * deadlock freedom can not be enforced, and no graph is built.
+ */
+static void build_noc_channel_dependency_graph();
+
+/**
+ * @brief Replaces the previous routes of the affected traffic flows with their
+ * current (proposed) routes in the channel dependency graph, unless this would
+ * create a cycle.
  *
- * @return Unique links that appear only in one of the given routes
+ * @return True if the proposed routes are deadlock free and were added.
  */
-static std::vector<NocLinkId> find_affected_links_by_flow_reroute(std::vector<NocLinkId>& prev_links,
-                                                                  std::vector<NocLinkId>& curr_links);
+static bool update_noc_channel_dependency_graph();
 
 void initial_noc_routing(const vtr::vector<NocTrafficFlowId, std::vector<NocLinkId>>& new_traffic_flow_routes) {
     // need to update the link usages within after routing all the traffic flows
@@ -68,6 +105,12 @@ void initial_noc_routing(const vtr::vector<NocTrafficFlowId, std::vector<NocLink
     VTR_ASSERT(new_traffic_flow_routes.size() == (size_t)noc_traffic_flows_storage.get_number_of_traffic_flows() ||
                new_traffic_flow_routes.empty());
 
+    // all routes are found again, so forget any routes found with a previous NoC model or routing algorithm
+    noc_route_cache.clear();
+    noc_route_cache_model = nullptr;
+    noc_route_cache_router = nullptr;
+    prev_traffic_flow_routes_valid = false;
+
     /* We need all the traffic flow ids to be able to access them. The range
      * of traffic flow ids go from 0 to the total number of traffic flows within
      * the NoC.
@@ -91,6 +134,8 @@ void initial_noc_routing(const vtr::vector<NocTrafficFlowId, std::vector<NocLink
         // update the links used in the found traffic flow route, links' bandwidth should be incremented since the traffic flow is routed
         update_traffic_flow_link_usage(curr_traffic_flow_route, noc_ctx.noc_model, 1, curr_traffic_flow.traffic_flow_bandwidth);
     }
+
+    build_noc_channel_dependency_graph();
 }
 
 void reinitialize_noc_routing(t_placer_costs& costs,
@@ -115,7 +160,7 @@ void reinitialize_noc_routing(t_placer_costs& costs,
     costs.noc_cost_terms.congestion = comp_noc_congestion_cost();
 }
 
-void find_affected_noc_routers_and_update_noc_costs(const t_pl_blocks_to_be_moved& blocks_affected,
+bool find_affected_noc_routers_and_update_noc_costs(const t_pl_blocks_to_be_moved& blocks_affected,
                                                     NocCostTerms& delta_c) {
     /* For speed, delta_c is passed by reference instead of being returned.
      * We expect delta cost terms to be zero to ensure correctness.
@@ -133,8 +178,17 @@ void find_affected_noc_routers_and_update_noc_costs(const t_pl_blocks_to_be_move
     std::unordered_set<NocTrafficFlowId> updated_traffic_flows;
 
     affected_traffic_flows.clear();
+
+    is_noc_link_affected.resize(noc_ctx.noc_model.get_number_of_noc_links(), false);
+    for (NocLinkId link_id : affected_noc_links) {
+        is_noc_link_affected[link_id] = false;
+    }
     affected_noc_links.clear();
 
+    // the routes of the re-routed traffic flows are saved so the move can be reverted without re-routing
+    prev_traffic_flow_routes.resize(noc_traffic_flows_storage.get_number_of_traffic_flows());
+    prev_traffic_flow_routes_valid = true;
+
     // go through the moved blocks and process them only if they are NoC routers
     for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; ++iblk) {
         ClusterBlockId blk = blocks_affected.moved_blocks[iblk].block_num;
@@ -174,12 +228,23 @@ void find_affected_noc_routers_and_update_noc_costs(const t_pl_blocks_to_be_move
         // compute how much the congestion cost changes with this swap
         delta_c.congestion += proposed_link_congestion_costs[link] - link_congestion_costs[link];
     }
+
+    noc_channel_dependency_graph_has_proposed_routes = false;
+    if (noc_channel_dependency_graph && !affected_traffic_flows.empty()) {
+        return update_noc_channel_dependency_graph();
+    }
+
+    return true;
 }
 
 void commit_noc_costs() {
     // used to access NoC links
     auto& noc_ctx = g_vpr_ctx.mutable_noc();
 
+    // the move is kept, so the previous routes are no longer needed
+    prev_traffic_flow_routes_valid = false;
+    noc_channel_dependency_graph_has_proposed_routes = false;
+
     // Iterate over all the traffic flows affected by the proposed router swap
     for (auto& traffic_flow_id : affected_traffic_flows) {
         // update the traffic flow costs
@@ -219,8 +284,26 @@ std::vector<NocLinkId>& route_traffic_flow(NocTrafficFlowId traffic_flow_id,
     NocRouterId source_router_block_id = noc_model.get_router_at_grid_location(place_ctx.block_locs[logical_source_router_block_id].loc);
     NocRouterId sink_router_block_id = noc_model.get_router_at_grid_location(place_ctx.block_locs[logical_sink_router_block_id].loc);
 
-    // route the current traffic flow
     std::vector<NocLinkId>& curr_traffic_flow_route = noc_traffic_flows_storage.get_mutable_traffic_flow_route(traffic_flow_id);
+
+    // traffic flows between the same pair of routers share their route, so re-use it if it was already found
+    if (!noc_flows_router.routes_depend_on_traffic_flow()) {
+        if (noc_route_cache_model != &noc_model || noc_route_cache_router != &noc_flows_router) {
+            noc_route_cache.clear();
+            noc_route_cache_model = &noc_model;
+            noc_route_cache_router = &noc_flows_router;
+        }
+
+        auto [cached_route, inserted] = noc_route_cache.try_emplace({source_router_block_id, sink_router_block_id});
+        if (inserted) {
+            noc_flows_router.route_flow(source_router_block_id, sink_router_block_id, traffic_flow_id, cached_route->second, noc_model);
+        }
+        curr_traffic_flow_route = cached_route->second;
+
+        return curr_traffic_flow_route;
+    }
+
+    // route the current traffic flow
     noc_flows_router.route_flow(source_router_block_id, sink_router_block_id, traffic_flow_id, curr_traffic_flow_route, noc_model);
 
     return curr_traffic_flow_route;
@@ -255,9 +338,9 @@ void re_route_associated_traffic_flows(ClusterBlockId moved_block_router_id,
     for (auto traffic_flow_id : assoc_traffic_flows) {
         // first check to see whether we have already re-routed the current traffic flow and only re-route it if we haven't already.
         if (updated_traffic_flows.find(traffic_flow_id) == updated_traffic_flows.end()) {
-            // get all links for this flow route before it is rerouted
-            // The returned const std::vector<NocLinkId>& is copied so that we can modify (sort) it
-            std::vector<NocLinkId> prev_traffic_flow_links = noc_traffic_flows_storage.get_traffic_flow_route(traffic_flow_id);
+            // remember the route before it is re-routed, in case the move is reverted
+            std::vector<NocLinkId>& prev_traffic_flow_links = prev_traffic_flow_routes[traffic_flow_id];
+            prev_traffic_flow_links = noc_traffic_flows_storage.get_traffic_flow_route(traffic_flow_id);
 
             // now update the current traffic flow by re-routing it based on the new locations of its src and destination routers
             re_route_traffic_flow(traffic_flow_id, noc_traffic_flows_storage, noc_model, noc_flows_router);
@@ -265,15 +348,10 @@ void re_route_associated_traffic_flows(ClusterBlockId moved_block_router_id,
             // now make sure we don't update this traffic flow a second time by adding it to the group of updated traffic flows
             updated_traffic_flows.insert(traffic_flow_id);
 
-            // get all links for this flow route after it is rerouted
-            std::vector<NocLinkId> curr_traffic_flow_links = noc_traffic_flows_storage.get_traffic_flow_route(traffic_flow_id);
-
-            // find links that appear in the old route or the new one, but not both of them
-            // these are the links whose bandwidth utilization is affected by rerouting
-            auto unique_links = find_affected_links_by_flow_reroute(prev_traffic_flow_links, curr_traffic_flow_links);
-
-            // update the static data structure to remember which links were affected by router swap
-            affected_noc_links.insert(unique_links.begin(), unique_links.end());
+            // the links in the old and new routes are the ones whose bandwidth utilization may be affected by rerouting.
+            // Links in both routes keep their utilization, so their congestion costs are recomputed unchanged.
+            mark_affected_noc_links(prev_traffic_flow_links);
+            mark_affected_noc_links(noc_traffic_flows_storage.get_traffic_flow_route(traffic_flow_id));
 
             // update global datastructures to indicate that the current traffic flow was affected due to router cluster blocks being swapped
             affected_traffic_flows.push_back(traffic_flow_id);
@@ -286,6 +364,34 @@ void revert_noc_traffic_flow_routes(const t_pl_blocks_to_be_moved& blocks_affect
 
     NocTrafficFlows& noc_traffic_flows_storage = noc_ctx.noc_traffic_flows_storage;
 
+    // If the routes before the move were saved when the affected traffic flows were re-routed,
+    // restore them instead of re-routing the traffic flows
+    if (prev_traffic_flow_routes_valid) {
+        // restore the previous routes in the channel dependency graph, if the proposed ones were added
+        if (noc_channel_dependency_graph_has_proposed_routes) {
+            for (NocTrafficFlowId traffic_flow_id : affected_traffic_flows) {
+                noc_channel_dependency_graph->remove_route(noc_traffic_flows_storage.get_traffic_flow_route(traffic_flow_id));
+            }
+            for (NocTrafficFlowId traffic_flow_id : affected_traffic_flows) {
+                bool added = noc_channel_dependency_graph->add_route(prev_traffic_flow_routes[traffic_flow_id]);
+                VTR_ASSERT(added);
+            }
+            noc_channel_dependency_graph_has_proposed_routes = false;
+        }
+
+        for (NocTrafficFlowId traffic_flow_id : affected_traffic_flows) {
+            const t_noc_traffic_flow& curr_traffic_flow = noc_traffic_flows_storage.get_single_noc_traffic_flow(traffic_flow_id);
+            std::vector<NocLinkId>& traffic_flow_route = noc_traffic_flows_storage.get_mutable_traffic_flow_route(traffic_flow_id);
+
+            update_traffic_flow_link_usage(traffic_flow_route, noc_ctx.noc_model, -1, curr_traffic_flow.traffic_flow_bandwidth);
+            std::swap(traffic_flow_route, prev_traffic_flow_routes[traffic_flow_id]);
+            update_traffic_flow_link_usage(traffic_flow_route, noc_ctx.noc_model, 1, curr_traffic_flow.traffic_flow_bandwidth);
+        }
+
+        prev_traffic_flow_routes_valid = false;
+        return;
+    }
+
     // keeps track of traffic flows that have been reverted
     // This is useful for cases where two moved routers were part of the same traffic flow and prevents us from re-routing the same flow twice.
     std::unordered_set<NocTrafficFlowId> reverted_traffic_flows;
@@ -314,6 +420,11 @@ void revert_noc_traffic_flow_routes(const t_pl_blocks_to_be_moved& blocks_affect
             }
         }
     }
+
+    // the routes were not updated incrementally, so the channel dependency graph is rebuilt
+    if (noc_channel_dependency_graph && !reverted_traffic_flows.empty()) {
+        build_noc_channel_dependency_graph();
+    }
 }
 
 void re_route_traffic_flow(NocTrafficFlowId traffic_flow_id,
@@ -745,9 +856,11 @@ std::vector<NocLink> get_top_n_congested_links(int n) {
     return std::vector<NocLink>{noc_links.begin(), noc_links.begin() + pick_n};
 }
 
-void allocate_and_load_noc_placement_structs() {
+void allocate_and_load_noc_placement_structs(bool enforce_deadlock_freedom) {
     auto& noc_ctx = g_vpr_ctx.noc();
 
+    enforce_noc_deadlock_freedom = enforce_deadlock_freedom;
+
     int number_of_traffic_flows = noc_ctx.noc_traffic_flows_storage.get_number_of_traffic_flows();
 
     traffic_flow_costs.resize(number_of_traffic_flows, {INVALID_NOC_COST_TERM, INVALID_NOC_COST_TERM});
@@ -767,6 +880,18 @@ void free_noc_placement_structs() {
     vtr::release_memory(link_congestion_costs);
     vtr::release_memory(proposed_link_congestion_costs);
     vtr::release_memory(affected_noc_links);
+    vtr::release_memory(is_noc_link_affected);
+
+    vtr::release_memory(prev_traffic_flow_routes);
+    prev_traffic_flow_routes_valid = false;
+
+    noc_route_cache.clear();
+    noc_route_cache_model = nullptr;
+    noc_route_cache_router = nullptr;
+
+    enforce_noc_deadlock_freedom = false;
+    noc_channel_dependency_graph.reset();
+    noc_channel_dependency_graph_has_proposed_routes = false;
 }
 
 /* Below are functions related to the feature that forces to the placer to swap router blocks for a certain percentage of the total number of swaps */
@@ -974,24 +1099,59 @@ void print_noc_costs(std::string_view header, const t_placer_costs& costs, const
         get_number_of_congested_noc_links());
 }
 
-static std::vector<NocLinkId> find_affected_links_by_flow_reroute(std::vector<NocLinkId>& prev_links,
-                                                                  std::vector<NocLinkId>& curr_links) {
-    // Sort both link containers
-    std::stable_sort(prev_links.begin(), prev_links.end());
-    std::stable_sort(curr_links.begin(), curr_links.end());
+static void mark_affected_noc_links(const std::vector<NocLinkId>& traffic_flow_route) {
+    for (NocLinkId link_id : traffic_flow_route) {
+        if (!is_noc_link_affected[link_id]) {
+            is_noc_link_affected[link_id] = true;
+            affected_noc_links.push_back(link_id);
+        }
+    }
+}
 
-    // stores links that appear either in prev_links or curr_links but not both of them
-    std::vector<NocLinkId> unique_links;
+static void build_noc_channel_dependency_graph() {
+    noc_channel_dependency_graph.reset();
+    noc_channel_dependency_graph_has_proposed_routes = false;
 
-    // find links that are unique to prev_links
-    std::set_difference(prev_links.begin(), prev_links.end(),
-                        curr_links.begin(), curr_links.end(),
-                        std::back_inserter(unique_links));
+    if (!enforce_noc_deadlock_freedom) {
+        return;
+    }
 
-    // find links that are unique to curr_links
-    std::set_difference(curr_links.begin(), curr_links.end(),
-                        prev_links.begin(), prev_links.end(),
-                        std::back_inserter(unique_links));
+    const auto& noc_ctx = g_vpr_ctx.noc();
+    const NocTrafficFlows& noc_traffic_flows_storage = noc_ctx.noc_traffic_flows_storage;
 
-    return unique_links;
-}
\ No newline at end of file
+    auto channel_dependency_graph = std::make_unique<ChannelDependencyGraph>(noc_ctx.noc_model.get_number_of_noc_links());
+    for (const auto& traffic_flow_id : noc_traffic_flows_storage.get_all_traffic_flow_id()) {
+        if (!channel_dependency_graph->add_route(noc_traffic_flows_storage.get_traffic_flow_route(traffic_flow_id))) {
+            VTR_LOG_WARN("NoC traffic flow routes contain a cycle in the channel dependency graph, so deadlock freedom is not enforced during placement.\n");
+            return;
+        }
+    }
+
+    noc_channel_dependency_graph = std::move(channel_dependency_graph);
+}
+
+static bool update_noc_channel_dependency_graph() {
+    const auto& noc_ctx = g_vpr_ctx.noc();
+    const NocTrafficFlows& noc_traffic_flows_storage = noc_ctx.noc_traffic_flows_storage;
+
+    for (NocTrafficFlowId traffic_flow_id : affected_traffic_flows) {
+        noc_channel_dependency_graph->remove_route(prev_traffic_flow_routes[traffic_flow_id]);
+    }
+
+    for (size_t i = 0; i < affected_traffic_flows.size(); i++) {
+        if (!noc_channel_dependency_graph->add_route(noc_traffic_flows_storage.get_traffic_flow_route(affected_traffic_flows[i]))) {
+            // the proposed routes could deadlock, so restore the previous (deadlock free) routes
+            for (size_t j = 0; j < i; j++) {
+                noc_channel_dependency_graph->remove_route(noc_traffic_flows_storage.get_traffic_flow_route(affected_traffic_flows[j]));
+            }
+            for (NocTrafficFlowId traffic_flow_id : affected_traffic_flows) {
+                bool added = noc_channel_dependency_graph->add_route(prev_traffic_flow_routes[traffic_flow_id]);
+                VTR_ASSERT(added);
+            }
+            return false;
+        }
+    }
+
+    noc_channel_dependency_graph_has_proposed_routes = true;
+    return true;
+}
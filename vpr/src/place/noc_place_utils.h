@@ -110,8 +110,13 @@ void reinitialize_noc_routing(t_placer_costs& costs,
  * @param noc_latency_delta_c The change in the overall
  * NoC latency cost caused by a placer move is stored
  * here.
+ * @return False if deadlock freedom is enforced (see
+ * allocate_and_load_noc_placement_structs()) and the re-routed traffic
+ * flows would create a cycle in the channel dependency graph. Such a move
+ * must be rejected (and reverted with revert_noc_traffic_flow_routes()).
+ * True otherwise.
  */
-void find_affected_noc_routers_and_update_noc_costs(const t_pl_blocks_to_be_moved& blocks_affected,
+bool find_affected_noc_routers_and_update_noc_costs(const t_pl_blocks_to_be_moved& blocks_affected,
                                                     NocCostTerms& delta_c);
 
 /**
@@ -144,6 +149,10 @@ void commit_noc_costs();
  * the router cluster blocks are identified. Then the traffic flow
  * is routed and updated.
  *
+ * If the routing algorithm's routes only depend on the source and destination
+ * routers, the route is found once for each pair of routers and shared by
+ * all traffic flows between them.
+ *
  * Note that this function does not update the link bandwidth utilization.
  * update_traffic_flow_link_usage() should be called after this function
  * to update the link utilization for the new route. If the flow is re-routed
@@ -224,8 +233,9 @@ void re_route_associated_traffic_flows(ClusterBlockId moved_router_block_id,
  * router blocks that were supposed to be moved during placement but are
  * back to their original positions. 
  * 
- * The routing function is called to find the original traffic flow route
- * again.
+ * If the traffic flows were re-routed by find_affected_noc_routers_and_update_noc_costs()
+ * for this move, their routes before the move are restored. Otherwise the
+ * routing function is called to find the original traffic flow route again.
  * 
  * @param blocks_affected Contains all the blocks that were moved in
  * the current placement iteration. This includes the cluster ids of
@@ -485,8 +495,14 @@ std::vector<double> get_top_n_congestion_ratios(int n);
  * initialize the datastructures here.
  * 
  * This should be called before starting the simulated annealing placement.
+ *
+ * @param enforce_deadlock_freedom If true, a channel dependency graph of the
+ * traffic flow routes is maintained as they change, and moves whose routes
+ * could deadlock are reported by find_affected_noc_routers_and_update_noc_costs().
+ * This is only needed for routing algorithms which are not deadlock free by
+ * construction (i.e. not turn model algorithms).
  */
-void allocate_and_load_noc_placement_structs();
+void allocate_and_load_noc_placement_structs(bool enforce_deadlock_freedom = false);
 
 /**
  * @brief We delete the static datastructures which were created in
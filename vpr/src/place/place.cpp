@@ -6,6 +6,7 @@
 #include <numeric>
 #include <chrono>
 #include <optional>
+#include <unordered_set>
 
 #include "NetPinTimingInvalidator.h"
 #include "vtr_assert.h"
@@ -14,6 +15,8 @@
 #include "vtr_random.h"
 #include "vtr_geometry.h"
 #include "vtr_time.h"
+#include "vtr_profiler_markers.h"
+#include "vtr_trace.h"
 #include "vtr_math.h"
 #include "vtr_ndmatrix.h"
 
@@ -41,6 +44,7 @@
 #include "place_delay_model.h"
 #include "place_timing_update.h"
 #include "move_transactions.h"
+#include "directed_moves_util.h"
 #include "move_utils.h"
 #include "read_place.h"
 #include "place_constraints.h"
@@ -70,6 +74,14 @@
 
 #include "noc_place_utils.h"
 
+#include "place_congestion.h"
+#include "multilevel_place.h"
+#include "progressupdate.h"
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 /*  define the RL agent's reward function factor constant. This factor controls the weight of bb cost *
  *  compared to the timing cost in the agent's reward function. The reward is calculated as           *
  * -1*(1.5-REWARD_BB_TIMING_RELATIVE_WEIGHT)*timing_cost + (1+REWARD_BB_TIMING_RELATIVE_WEIGHT)*bb_cost)
@@ -92,11 +104,19 @@ using std::min;
  * cost computation. 0.01 means that there is a 1% error tolerance.       */
 static constexpr double ERROR_TOL = .01;
 
+/* Congestion costs below this are only round-off of the accumulated move  *
+ * deltas, and are not checked against the recomputed one.                */
+static constexpr double MIN_EXPECTED_CONGESTION_COST = 1.e-3;
+
 /* This defines the maximum number of swap attempts before invoking the   *
  * once-in-a-while placement legality check as well as floating point     *
  * variables round-offs check.                                            */
 static constexpr int MAX_MOVES_BEFORE_RECOMPUTE = 500000;
 
+/* The annealer refines a multilevel global placement locally: it starts with *
+ * this range limit (in tiles) instead of the whole device.                   */
+static constexpr float MULTILEVEL_FIRST_RLIM = 8.;
+
 /* Flags for the states of the bounding box.                              *
  * Stored as char for memory efficiency.                                  */
 #define NOT_UPDATED_YET 'N'
@@ -117,50 +137,17 @@ enum e_cost_methods {
 constexpr float INVALID_DELAY = std::numeric_limits<float>::quiet_NaN();
 constexpr float INVALID_COST = std::numeric_limits<double>::quiet_NaN();
 
+/* Wirelength cost and estimated critical path delay of an annealing run, *
+ * used to compare the runs of a --place_seeds portfolio.                 */
+struct t_seed_progress {
+    double bb_cost;
+    float cpd;
+};
+
 /********************** Variables local to place.c ***************************/
 
-/* Cost of a net, and a temporary cost of a net used during move assessment. */
-static vtr::vector<ClusterNetId, double> net_cost, proposed_net_cost;
-
-/* [0...cluster_ctx.clb_nlist.nets().size()-1]                                               *
- * A flag array to indicate whether the specific bounding box has been updated   *
- * in this particular swap or not. If it has been updated before, the code       *
- * must use the updated data, instead of the out-of-date data passed into the    *
- * subroutine, particularly used in try_swap(). The value NOT_UPDATED_YET        *
- * indicates that the net has not been updated before, UPDATED_ONCE indicated    *
- * that the net has been updated once, if it is going to be updated again, the   *
- * values from the previous update must be used. GOT_FROM_SCRATCH is only        *
- * applicable for nets larger than SMALL_NETS and it indicates that the          *
- * particular bounding box cannot be updated incrementally before, hence the     *
- * bounding box is got from scratch, so the bounding box would definitely be     *
- * right, DO NOT update again.                                                   */
-static vtr::vector<ClusterNetId, char> bb_updated_before;
-
-/* The arrays below are used to precompute the inverse of the average   *
- * number of tracks per channel between [subhigh] and [sublow].  Access *
- * them as chan?_place_cost_fac[subhigh][sublow].  They are used to     *
- * speed up the computation of the cost function that takes the length  *
- * of the net bounding box in each dimension, divided by the average    *
- * number of tracks in that direction; for other cost functions they    *
- * will never be used.                                                  *
- */
-static vtr::NdMatrix<float, 2> chanx_place_cost_fac({0, 0}); //[0...device_ctx.grid.width()-2]
-static vtr::NdMatrix<float, 2> chany_place_cost_fac({0, 0}); //[0...device_ctx.grid.height()-2]
-
-/* The following arrays are used by the try_swap function for speed.   */
-/* [0...cluster_ctx.clb_nlist.nets().size()-1] */
-static vtr::vector<ClusterNetId, t_bb> ts_bb_edge_new, ts_bb_coord_new;
-static vtr::vector<ClusterNetId, std::vector<t_2D_bb>> layer_ts_bb_edge_new, layer_ts_bb_coord_new;
-static vtr::Matrix<int> ts_layer_sink_pin_count;
-static std::vector<ClusterNetId> ts_nets_to_update;
-
-/* These file-scoped variables keep track of the number of swaps       *
- * rejected, accepted or aborted. The total number of swap attempts    *
- * is the sum of the three number.                                     */
-static int num_swap_rejected = 0;
-static int num_swap_accepted = 0;
-static int num_swap_aborted = 0;
-static int num_ts_called = 0;
+/* The per-net cost state, and the scratch data and counters used to  *
+ * evaluate moves, are kept in g_placer_ctx.cost() and .swap().       */
 
 /* Expected crossing counts for nets with different #'s of pins.  From *
  * ICCAD 94 pp. 690 - 695 (with linear interpolation applied by me).   *
@@ -273,6 +260,8 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
 static void alloc_and_load_try_swap_structs(const bool cube_bb);
 static void free_try_swap_structs();
 
+static void alloc_and_load_batched_moves(int num_parallel_moves);
+
 static void free_placement_structs(const t_placer_opts& placer_opts, const t_noc_opts& noc_opts);
 
 static void alloc_and_load_for_fast_cost_update(float place_cost_exp);
@@ -283,10 +272,26 @@ static double comp_bb_cost(e_cost_methods method);
 
 static double comp_layer_bb_cost(e_cost_methods method);
 
+static bool congestion_cost_enabled(const t_placer_opts& placer_opts);
+
+static void load_congestion_map();
+
+static double comp_congestion_cost();
+
+static double recompute_congestion_cost();
+
+static double update_congestion_delta_costs(int num_nets_affected,
+                                            const std::vector<ClusterNetId>& nets_to_update);
+
+static void commit_congestion_costs(int num_nets_affected,
+                                    const std::vector<ClusterNetId>& nets_to_update);
+
 static void update_move_nets(int num_nets_affected,
+                             const std::vector<ClusterNetId>& nets_to_update,
                              const bool cube_bb);
 
-static void reset_move_nets(int num_nets_affected);
+static void reset_move_nets(int num_nets_affected,
+                            const std::vector<ClusterNetId>& nets_to_update);
 
 static e_move_result try_swap(const t_annealing_state* state,
                               t_placer_costs* costs,
@@ -305,6 +310,28 @@ static e_move_result try_swap(const t_annealing_state* state,
                               float timing_bb_factor,
                               bool manual_move_enabled);
 
+static bool can_batch_moves(const t_placer_opts& placer_opts,
+                            const t_noc_opts& noc_opts,
+                            const t_place_algorithm& place_algorithm);
+
+static int try_swap_batch(const t_annealing_state* state,
+                          t_placer_costs* costs,
+                          t_placer_statistics* stats,
+                          MoveGenerator& move_generator,
+                          SetupTimingInfo* timing_info,
+                          NetPinTimingInvalidator* pin_timing_invalidator,
+                          const PlaceDelayModel* delay_model,
+                          PlacerCriticalities* criticalities,
+                          const t_placer_opts& placer_opts,
+                          MoveTypeStat& move_type_stat,
+                          const t_place_algorithm& place_algorithm,
+                          float timing_bb_factor,
+                          int max_moves);
+
+static bool claim_batched_move(t_batched_move& move);
+
+static bool deferred_move_still_applies(const t_pl_blocks_to_be_moved& blocks_affected);
+
 static void check_place(const t_placer_costs& costs,
                         const PlaceDelayModel* delay_model,
                         const PlacerCriticalities* criticalities,
@@ -318,7 +345,12 @@ static int check_placement_costs(const t_placer_costs& costs,
 
 static int check_placement_consistency();
 static int check_block_placement_consistency();
+static int check_grid_column_consistency(int layer_num, int i, std::vector<ClusterBlockId>& found_blocks);
 static int check_macro_placement_consistency();
+static int check_single_macro_placement_consistency(size_t imacro);
+static void check_placement_sample(float sample_fraction, vtr::RandState& rand_state);
+static int check_sampled_block_placement(ClusterBlockId blk_id);
+static int check_sampled_net_cost(ClusterNetId net_id);
 
 static float starting_t(const t_annealing_state* state,
                         t_placer_costs* costs,
@@ -424,10 +456,13 @@ static int find_affected_nets_and_update_costs(
     const PlaceDelayModel* delay_model,
     const PlacerCriticalities* criticalities,
     t_pl_blocks_to_be_moved& blocks_affected,
+    std::vector<ClusterNetId>& nets_to_update,
     double& bb_delta_c,
     double& timing_delta_c);
 
-static void record_affected_net(const ClusterNetId net, int& num_affected_nets);
+static void record_affected_net(const ClusterNetId net,
+                                std::vector<ClusterNetId>& nets_to_update,
+                                int& num_affected_nets);
 
 static void update_net_bb(const ClusterNetId net,
                           const t_pl_blocks_to_be_moved& blocks_affected,
@@ -446,12 +481,24 @@ static void update_td_delta_costs(const PlaceDelayModel* delay_model,
                                   const ClusterNetId net,
                                   const ClusterPinId pin,
                                   t_pl_blocks_to_be_moved& blocks_affected,
-                                  double& delta_timing_cost);
+                                  double& delta_timing_cost,
+                                  bool use_sampled_connections);
+
+static void update_sampled_timing_connections(const t_placer_opts& placer_opts,
+                                              const PlacerCriticalities& criticalities);
+
+static void complete_sampled_td_costs(const PlaceDelayModel* delay_model,
+                                      const PlacerCriticalities& criticalities,
+                                      float timing_tradeoff,
+                                      t_pl_blocks_to_be_moved& blocks_affected,
+                                      t_placer_costs* costs);
 
 static void update_placement_cost_normalization_factors(t_placer_costs* costs, const t_placer_opts& placer_opts, const t_noc_opts& noc_opts);
 
 static double get_total_cost(t_placer_costs* costs, const t_placer_opts& placer_opts, const t_noc_opts& noc_opts);
 
+static double wirelength_crossing_count(size_t fanout);
+
 static double get_net_cost(ClusterNetId net_id, const t_bb& bbptr);
 
 static double get_net_layer_cost(ClusterNetId /* net_id */,
@@ -539,12 +586,24 @@ static void print_place_status(const t_annealing_state& state,
                                bool noc_enabled,
                                const NocCostTerms& noc_cost_terms);
 
+static void trace_place_status(const t_annealing_state& state,
+                               const t_placer_statistics& stats,
+                               const t_placer_costs& costs);
+
 static void print_resources_utilization();
 
 static void print_placement_swaps_stats(const t_annealing_state& state);
 
 static void print_placement_move_types_stats(const MoveTypeStat& move_type_stat);
 
+static double seed_relative_quality(const t_placer_opts& placer_opts,
+                                    const t_seed_progress& progress,
+                                    const t_seed_progress& reference);
+
+static bool should_prune_seed(const t_placer_opts& placer_opts,
+                              const std::vector<t_seed_progress>& trajectory,
+                              const std::vector<t_seed_progress>& best_trajectory);
+
 /*****************************************************************************/
 void try_place(const Netlist<>& net_list,
                const t_placer_opts& placer_opts,
@@ -558,6 +617,7 @@ void try_place(const Netlist<>& net_list,
                t_direct_inf* directs,
                int num_directs,
                bool is_flat) {
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
     /* Does almost all the work of placing a circuit.  Width_fac gives the   *
      * width of the widest channel.  Place_cost_exp says what exponent the   *
      * width should be taken to when calculating costs.  This allows a       *
@@ -612,10 +672,10 @@ void try_place(const Netlist<>& net_list,
         net_list.blocks().size());
 
     /* init file scope variables */
-    num_swap_rejected = 0;
-    num_swap_accepted = 0;
-    num_swap_aborted = 0;
-    num_ts_called = 0;
+    swap_ctx.num_swap_rejected = 0;
+    swap_ctx.num_swap_accepted = 0;
+    swap_ctx.num_swap_aborted = 0;
+    swap_ctx.num_ts_called = 0;
 
     if (placer_opts.place_algorithm.is_timing_driven()) {
         /*do this before the initial placement to avoid messing up the initial placement */
@@ -643,6 +703,10 @@ void try_place(const Netlist<>& net_list,
     VTR_LOG("Bounding box mode is %s\n", (cube_bb ? "Cube" : "Per-layer"));
     VTR_LOG("\n");
 
+    if (placer_opts.place_congestion_weight > 0. && !cube_bb) {
+        VTR_LOG_WARN("The placement congestion cost is only supported with the cube bounding box: ignoring --place_congestion_weight\n");
+    }
+
     int move_lim = 1;
     move_lim = (int)(annealing_sched.inner_num
                      * pow(net_list.blocks().size(), 1.3333));
@@ -658,34 +722,6 @@ void try_place(const Netlist<>& net_list,
         normalize_noc_cost_weighting_factor(const_cast<t_noc_opts&>(noc_opts));
     }
 
-    initial_placement(placer_opts,
-                      placer_opts.constraints_file.c_str(),
-                      noc_opts);
-
-    if (!placer_opts.write_initial_place_file.empty()) {
-        print_place(nullptr,
-                    nullptr,
-                    (placer_opts.write_initial_place_file + ".init.place").c_str());
-    }
-
-#ifdef ENABLE_ANALYTIC_PLACE
-    /*
-     * Analytic Placer:
-     *  Passes in the initial_placement via vpr_context, and passes its placement back via locations marked on
-     *  both the clb_netlist and the gird.
-     *  Most of anneal is disabled later by setting initial temperature to 0 and only further optimizes in quench
-     */
-    if (placer_opts.enable_analytic_placer) {
-        AnalyticPlacer{}.ap_place();
-    }
-
-#endif /* ENABLE_ANALYTIC_PLACE */
-
-    // Update physical pin values
-    for (auto block_id : cluster_ctx.clb_nlist.blocks()) {
-        place_sync_external_block_connections(block_id);
-    }
-
     const int width_fac = placer_opts.place_chan_width;
     init_draw_coords((float)width_fac);
 
@@ -695,270 +731,504 @@ void try_place(const Netlist<>& net_list,
     ClusteredPinAtomPinsLookup netlist_pin_lookup(cluster_ctx.clb_nlist,
                                                   atom_ctx.nlist, pb_gpin_lookup);
 
-    /* Gets initial cost and loads bounding boxes. */
+    //allocate move type statistics vectors
+    MoveTypeStat move_type_stat;
+    move_type_stat.blk_type_moves.resize({device_ctx.logical_block_types.size(), (int)e_move_type::NUMBER_OF_AUTO_MOVES}, 0);
+    move_type_stat.accepted_moves.resize({device_ctx.logical_block_types.size(), (int)e_move_type::NUMBER_OF_AUTO_MOVES}, 0);
+    move_type_stat.rejected_moves.resize({device_ctx.logical_block_types.size(), (int)e_move_type::NUMBER_OF_AUTO_MOVES}, 0);
 
-    if (placer_opts.place_algorithm.is_timing_driven()) {
-        if (cube_bb) {
-            costs.bb_cost = comp_bb_cost(NORMAL);
-        } else {
-            VTR_ASSERT_SAFE(!cube_bb);
-            costs.bb_cost = comp_layer_bb_cost(NORMAL);
+    auto pre_quench_timing_stats = timing_ctx.stats;
+    auto post_quench_timing_stats = timing_ctx.stats;
+
+    /* With --place_seeds, everything from the initial placement to the quench is *
+     * repeated for each seed, and the best placement found is kept               */
+    const int num_seeds = placer_opts.place_seeds;
+    int best_seed = -1;
+    t_seed_progress best_seed_result{0., 0.};
+    std::vector<t_seed_progress> best_seed_trajectory, seed_trajectory;
+    std::unique_ptr<t_annealing_state> best_seed_state;
+    t_placement_checkpoint best_seed_placement;
+
+    for (int iseed = 0; iseed < num_seeds; ++iseed) {
+        t_placer_opts seed_placer_opts = placer_opts;
+        seed_placer_opts.seed += iseed;
+        bool seed_pruned = false;
+        seed_trajectory.clear();
+
+        if (num_seeds > 1) {
+            VTR_LOG("\nPlacement seed %d (%d of %d)\n", seed_placer_opts.seed, iseed + 1, num_seeds);
+        }
+        if (iseed > 0) {
+            vtr::srandom(seed_placer_opts.seed);
+            costs = t_placer_costs(placer_opts.place_algorithm);
+            placement_checkpoint = t_placement_checkpoint();
+            create_move_generators(move_generator, move_generator2, placer_opts, move_lim, noc_opts.noc_centroid_weight);
         }
 
-        first_crit_exponent = placer_opts.td_place_exp_first; /*this will be modified when rlim starts to change */
+        vtr::vector<ClusterBlockId, t_pl_loc> block_targets;
+        if (placer_opts.place_multilevel) {
+            block_targets = multilevel_global_placement(seed_placer_opts);
+        }
 
-        num_connections = count_connections();
-        VTR_LOG("\n");
-        VTR_LOG("There are %d point to point connections in this circuit.\n",
-                num_connections);
-        VTR_LOG("\n");
+        initial_placement(seed_placer_opts,
+                          placer_opts.constraints_file.c_str(),
+                          noc_opts,
+                          block_targets.empty() ? nullptr : &block_targets);
+
+        /* With --resume_place, the anneal continues from the last saved checkpoint *
+         * (if there is one) rather than from the initial placement                  */
+        t_annealer_checkpoint annealer_checkpoint;
+        const bool resume_anneal = placer_opts.resume_place
+                                   && annealer_checkpoint.read(placer_opts.place_checkpoint_file);
+        if (resume_anneal) {
+            VTR_LOG("Resuming placement from checkpoint '%s'\n", placer_opts.place_checkpoint_file.c_str());
+            annealer_checkpoint.restore_placement();
+        }
 
-        //Update the point-to-point delays from the initial placement
-        comp_td_connection_delays(place_delay_model.get());
+        if (!placer_opts.write_initial_place_file.empty()) {
+            print_place(nullptr,
+                        nullptr,
+                        (placer_opts.write_initial_place_file + ".init.place").c_str());
+        }
 
+#ifdef ENABLE_ANALYTIC_PLACE
         /*
-         * Initialize timing analysis
+         * Analytic Placer:
+         *  Passes in the initial_placement via vpr_context, and passes its placement back via locations marked on
+         *  both the clb_netlist and the gird.
+         *  Most of anneal is disabled later by setting initial temperature to 0 and only further optimizes in quench
          */
-        // For placement, we don't use flat-routing
-        placement_delay_calc = std::make_shared<PlacementDelayCalculator>(atom_ctx.nlist,
-                                                                          atom_ctx.lookup,
-                                                                          p_timing_ctx.connection_delay,
-                                                                          is_flat);
-        placement_delay_calc->set_tsu_margin_relative(
-            placer_opts.tsu_rel_margin);
-        placement_delay_calc->set_tsu_margin_absolute(
-            placer_opts.tsu_abs_margin);
-
-        timing_info = make_setup_timing_info(placement_delay_calc,
-                                             placer_opts.timing_update_type);
-
-        placer_setup_slacks = std::make_unique<PlacerSetupSlacks>(
-            cluster_ctx.clb_nlist, netlist_pin_lookup);
-
-        placer_criticalities = std::make_unique<PlacerCriticalities>(
-            cluster_ctx.clb_nlist, netlist_pin_lookup);
-
-        pin_timing_invalidator = make_net_pin_timing_invalidator(
-            placer_opts.timing_update_type,
-            net_list,
-            netlist_pin_lookup,
-            atom_ctx.nlist,
-            atom_ctx.lookup,
-            *timing_info->timing_graph(),
-            is_flat);
-
-        //First time compute timing and costs, compute from scratch
-        PlaceCritParams crit_params;
-        crit_params.crit_exponent = first_crit_exponent;
-        crit_params.crit_limit = placer_opts.place_crit_limit;
+        if (placer_opts.enable_analytic_placer && !resume_anneal) {
+            AnalyticPlacer{}.ap_place();
+        }
 
-        initialize_timing_info(crit_params, place_delay_model.get(),
-                               placer_criticalities.get(), placer_setup_slacks.get(),
-                               pin_timing_invalidator.get(), timing_info.get(), &costs);
+#endif /* ENABLE_ANALYTIC_PLACE */
 
-        critical_path = timing_info->least_slack_critical_path();
+        // Update physical pin values
+        for (auto block_id : cluster_ctx.clb_nlist.blocks()) {
+            place_sync_external_block_connections(block_id);
+        }
 
-        /* Write out the initial timing echo file */
-        if (isEchoFileEnabled(E_ECHO_INITIAL_PLACEMENT_TIMING_GRAPH)) {
-            tatum::write_echo(
-                getEchoFileName(E_ECHO_INITIAL_PLACEMENT_TIMING_GRAPH),
-                *timing_ctx.graph, *timing_ctx.constraints,
-                *placement_delay_calc, timing_info->analyzer());
+        /* Loads the sink coordinates used by centroid moves. */
+        load_net_sink_coord_sums();
 
-            tatum::NodeId debug_tnode = id_or_pin_name_to_tnode(
-                analysis_opts.echo_dot_timing_graph_node);
-            write_setup_timing_graph_dot(
-                getEchoFileName(E_ECHO_INITIAL_PLACEMENT_TIMING_GRAPH)
-                    + std::string(".dot"),
-                *timing_info, debug_tnode);
-        }
+        /* Gets initial cost and loads bounding boxes. */
 
-        outer_crit_iter_count = 1;
+        if (placer_opts.place_algorithm.is_timing_driven()) {
+            if (cube_bb) {
+                costs.bb_cost = comp_bb_cost(NORMAL);
+            } else {
+                VTR_ASSERT_SAFE(!cube_bb);
+                costs.bb_cost = comp_layer_bb_cost(NORMAL);
+            }
 
-        /* Initialize the normalization factors. Calling costs.update_norm_factors() *
-         * here would fail the golden results of strong_sdc benchmark                */
-        costs.timing_cost_norm = 1 / costs.timing_cost;
-        costs.bb_cost_norm = 1 / costs.bb_cost;
-    } else {
-        VTR_ASSERT(placer_opts.place_algorithm == BOUNDING_BOX_PLACE);
+            first_crit_exponent = placer_opts.td_place_exp_first; /*this will be modified when rlim starts to change */
 
-        /* Total cost is the same as wirelength cost normalized*/
-        if (cube_bb) {
-            costs.bb_cost = comp_bb_cost(NORMAL);
+            num_connections = count_connections();
+            VTR_LOG("\n");
+            VTR_LOG("There are %d point to point connections in this circuit.\n",
+                    num_connections);
+            VTR_LOG("\n");
+
+            //Update the point-to-point delays from the initial placement
+            comp_td_connection_delays(place_delay_model.get());
+
+            /*
+             * Initialize timing analysis
+             */
+            // For placement, we don't use flat-routing
+            placement_delay_calc = std::make_shared<PlacementDelayCalculator>(atom_ctx.nlist,
+                                                                              atom_ctx.lookup,
+                                                                              p_timing_ctx.connection_delay,
+                                                                              is_flat);
+            placement_delay_calc->set_tsu_margin_relative(
+                placer_opts.tsu_rel_margin);
+            placement_delay_calc->set_tsu_margin_absolute(
+                placer_opts.tsu_abs_margin);
+            //Incremental updates only query the edges around the moved blocks, which are cheaper to calculate on demand
+            placement_delay_calc->set_precompute_edge_delays(placer_opts.timing_update_type != e_timing_update_type::INCREMENTAL);
+
+            timing_info = make_setup_timing_info(placement_delay_calc,
+                                                 placer_opts.timing_update_type);
+
+            placer_setup_slacks = std::make_unique<PlacerSetupSlacks>(
+                cluster_ctx.clb_nlist, netlist_pin_lookup);
+
+            placer_criticalities = std::make_unique<PlacerCriticalities>(
+                cluster_ctx.clb_nlist, netlist_pin_lookup);
+
+            pin_timing_invalidator = make_net_pin_timing_invalidator(
+                placer_opts.timing_update_type,
+                net_list,
+                netlist_pin_lookup,
+                atom_ctx.nlist,
+                atom_ctx.lookup,
+                *timing_info->timing_graph(),
+                is_flat);
+
+            //First time compute timing and costs, compute from scratch
+            PlaceCritParams crit_params;
+            crit_params.crit_exponent = first_crit_exponent;
+            crit_params.crit_limit = placer_opts.place_crit_limit;
+
+            initialize_timing_info(crit_params, place_delay_model.get(),
+                                   placer_criticalities.get(), placer_setup_slacks.get(),
+                                   pin_timing_invalidator.get(), timing_info.get(), &costs);
+            update_sampled_timing_connections(placer_opts, *placer_criticalities);
+
+            critical_path = timing_info->least_slack_critical_path();
+
+            /* Write out the initial timing echo file */
+            if (isEchoFileEnabled(E_ECHO_INITIAL_PLACEMENT_TIMING_GRAPH)) {
+                tatum::write_echo(
+                    getEchoFileName(E_ECHO_INITIAL_PLACEMENT_TIMING_GRAPH),
+                    *timing_ctx.graph, *timing_ctx.constraints,
+                    *placement_delay_calc, timing_info->analyzer());
+
+                tatum::NodeId debug_tnode = id_or_pin_name_to_tnode(
+                    analysis_opts.echo_dot_timing_graph_node);
+                write_setup_timing_graph_dot(
+                    getEchoFileName(E_ECHO_INITIAL_PLACEMENT_TIMING_GRAPH)
+                        + std::string(".dot"),
+                    *timing_info, debug_tnode);
+            }
+
+            outer_crit_iter_count = 1;
+
+            /* Initialize the normalization factors. Calling costs.update_norm_factors() *
+             * here would fail the golden results of strong_sdc benchmark                */
+            costs.timing_cost_norm = 1 / costs.timing_cost;
+            costs.bb_cost_norm = 1 / costs.bb_cost;
         } else {
-            VTR_ASSERT_SAFE(!cube_bb);
-            costs.bb_cost = comp_layer_bb_cost(NORMAL);
+            VTR_ASSERT(placer_opts.place_algorithm == BOUNDING_BOX_PLACE);
+
+            /* Total cost is the same as wirelength cost normalized*/
+            if (cube_bb) {
+                costs.bb_cost = comp_bb_cost(NORMAL);
+            } else {
+                VTR_ASSERT_SAFE(!cube_bb);
+                costs.bb_cost = comp_layer_bb_cost(NORMAL);
+            }
+            costs.bb_cost_norm = 1 / costs.bb_cost;
+
+            /* Timing cost and normalization factors are not used */
+            costs.timing_cost = INVALID_COST;
+            costs.timing_cost_norm = INVALID_COST;
+
+            /* Other initializations */
+            outer_crit_iter_count = 0;
+            num_connections = 0;
+            first_crit_exponent = 0;
         }
-        costs.bb_cost_norm = 1 / costs.bb_cost;
 
-        /* Timing cost and normalization factors are not used */
-        costs.timing_cost = INVALID_COST;
-        costs.timing_cost_norm = INVALID_COST;
+        if (noc_opts.noc) {
+            // get the costs associated with the NoC
+            costs.noc_cost_terms.aggregate_bandwidth = comp_noc_aggregate_bandwidth_cost();
+            std::tie(costs.noc_cost_terms.latency, costs.noc_cost_terms.latency_overrun) = comp_noc_latency_cost();
+            costs.noc_cost_terms.congestion = comp_noc_congestion_cost();
 
-        /* Other initializations */
-        outer_crit_iter_count = 0;
-        num_connections = 0;
-        first_crit_exponent = 0;
-    }
+            // initialize all the noc normalization factors
+            update_noc_normalization_factors(costs);
+        }
 
-    if (noc_opts.noc) {
-        // get the costs associated with the NoC
-        costs.noc_cost_terms.aggregate_bandwidth = comp_noc_aggregate_bandwidth_cost();
-        std::tie(costs.noc_cost_terms.latency, costs.noc_cost_terms.latency_overrun) = comp_noc_latency_cost();
-        costs.noc_cost_terms.congestion = comp_noc_congestion_cost();
+        if (congestion_cost_enabled(placer_opts)) {
+            costs.congestion_cost = comp_congestion_cost();
+        }
 
-        // initialize all the noc normalization factors
-        update_noc_normalization_factors(costs);
-    }
+        // set the starting total placement cost
+        costs.cost = get_total_cost(&costs, placer_opts, noc_opts);
 
-    // set the starting total placement cost
-    costs.cost = get_total_cost(&costs, placer_opts, noc_opts);
+        //Sanity check that initial placement is legal
+        check_place(costs,
+                    place_delay_model.get(),
+                    placer_criticalities.get(),
+                    placer_opts.place_algorithm,
+                    noc_opts);
 
-    //Sanity check that initial placement is legal
-    check_place(costs,
-                place_delay_model.get(),
-                placer_criticalities.get(),
-                placer_opts.place_algorithm,
-                noc_opts);
+        //Initial placement statistics
+        VTR_LOG("Initial placement cost: %g bb_cost: %g td_cost: %g\n", costs.cost,
+                costs.bb_cost, costs.timing_cost);
+        if (noc_opts.noc) {
+            print_noc_costs("Initial NoC Placement Costs", costs, noc_opts);
+        }
+        if (placer_opts.place_algorithm.is_timing_driven()) {
+            VTR_LOG(
+                "Initial placement estimated Critical Path Delay (CPD): %g ns\n",
+                1e9 * critical_path.delay());
+            VTR_LOG(
+                "Initial placement estimated setup Total Negative Slack (sTNS): %g ns\n",
+                1e9 * timing_info->setup_total_negative_slack());
+            VTR_LOG(
+                "Initial placement estimated setup Worst Negative Slack (sWNS): %g ns\n",
+                1e9 * timing_info->setup_worst_negative_slack());
+            VTR_LOG("\n");
 
-    //Initial placement statistics
-    VTR_LOG("Initial placement cost: %g bb_cost: %g td_cost: %g\n", costs.cost,
-            costs.bb_cost, costs.timing_cost);
-    if (noc_opts.noc) {
-        print_noc_costs("Initial NoC Placement Costs", costs, noc_opts);
-    }
-    if (placer_opts.place_algorithm.is_timing_driven()) {
-        VTR_LOG(
-            "Initial placement estimated Critical Path Delay (CPD): %g ns\n",
-            1e9 * critical_path.delay());
-        VTR_LOG(
-            "Initial placement estimated setup Total Negative Slack (sTNS): %g ns\n",
-            1e9 * timing_info->setup_total_negative_slack());
+            VTR_LOG("Initial placement estimated setup slack histogram:\n");
+            print_histogram(
+                create_setup_slack_histogram(*timing_info->setup_analyzer()));
+        }
+
+        size_t num_macro_members = 0;
+        for (auto& macro : g_vpr_ctx.placement().pl_macros) {
+            num_macro_members += macro.members.size();
+        }
         VTR_LOG(
-            "Initial placement estimated setup Worst Negative Slack (sWNS): %g ns\n",
-            1e9 * timing_info->setup_worst_negative_slack());
+            "Placement contains %zu placement macros involving %zu blocks (average macro size %f)\n",
+            g_vpr_ctx.placement().pl_macros.size(), num_macro_members,
+            float(num_macro_members) / g_vpr_ctx.placement().pl_macros.size());
         VTR_LOG("\n");
 
-        VTR_LOG("Initial placement estimated setup slack histogram:\n");
-        print_histogram(
-            create_setup_slack_histogram(*timing_info->setup_analyzer()));
-    }
+        sprintf(msg,
+                "Initial Placement.  Cost: %g  BB Cost: %g  TD Cost %g \t Channel Factor: %d",
+                costs.cost, costs.bb_cost, costs.timing_cost, width_fac);
 
-    size_t num_macro_members = 0;
-    for (auto& macro : g_vpr_ctx.placement().pl_macros) {
-        num_macro_members += macro.members.size();
-    }
-    VTR_LOG(
-        "Placement contains %zu placement macros involving %zu blocks (average macro size %f)\n",
-        g_vpr_ctx.placement().pl_macros.size(), num_macro_members,
-        float(num_macro_members) / g_vpr_ctx.placement().pl_macros.size());
-    VTR_LOG("\n");
+        //Draw the initial placement
+        update_screen(ScreenUpdatePriority::MAJOR, msg, PLACEMENT, timing_info);
 
-    sprintf(msg,
-            "Initial Placement.  Cost: %g  BB Cost: %g  TD Cost %g \t Channel Factor: %d",
-            costs.cost, costs.bb_cost, costs.timing_cost, width_fac);
+        if (placer_opts.placement_saves_per_temperature >= 1) {
+            std::string filename = vtr::string_fmt("placement_%03d_%03d.place", 0,
+                                                   0);
+            VTR_LOG("Saving initial placement to file: %s\n", filename.c_str());
+            print_place(nullptr, nullptr, filename.c_str());
+        }
 
-    //Draw the initial placement
-    update_screen(ScreenUpdatePriority::MAJOR, msg, PLACEMENT, timing_info);
+        first_move_lim = get_initial_move_lim(placer_opts, annealing_sched);
 
-    if (placer_opts.placement_saves_per_temperature >= 1) {
-        std::string filename = vtr::string_fmt("placement_%03d_%03d.place", 0,
-                                               0);
-        VTR_LOG("Saving initial placement to file: %s\n", filename.c_str());
-        print_place(nullptr, nullptr, filename.c_str());
-    }
+        if (placer_opts.inner_loop_recompute_divider != 0) {
+            inner_recompute_limit = (int)(0.5
+                                          + (float)first_move_lim
+                                                / (float)placer_opts.inner_loop_recompute_divider);
+        } else {
+            /*don't do an inner recompute */
+            inner_recompute_limit = first_move_lim + 1;
+        }
 
-    first_move_lim = get_initial_move_lim(placer_opts, annealing_sched);
+        /* calculate the number of moves in the quench that we should recompute timing after based on the value of *
+         * the commandline option quench_recompute_divider                                                         */
+        int quench_recompute_limit;
+        if (placer_opts.quench_recompute_divider != 0) {
+            quench_recompute_limit = (int)(0.5
+                                           + (float)move_lim
+                                                 / (float)placer_opts.quench_recompute_divider);
+        } else {
+            /*don't do an quench recompute */
+            quench_recompute_limit = first_move_lim + 1;
+        }
 
-    if (placer_opts.inner_loop_recompute_divider != 0) {
-        inner_recompute_limit = (int)(0.5
-                                      + (float)first_move_lim
-                                            / (float)placer_opts.inner_loop_recompute_divider);
-    } else {
-        /*don't do an inner recompute */
-        inner_recompute_limit = first_move_lim + 1;
-    }
+        //allocate helper vectors that are used by many move generators
+        place_move_ctx.X_coord.resize(10, 0);
+        place_move_ctx.Y_coord.resize(10, 0);
+        place_move_ctx.layer_coord.resize(10, 0);
 
-    /* calculate the number of moves in the quench that we should recompute timing after based on the value of *
-     * the commandline option quench_recompute_divider                                                         */
-    int quench_recompute_limit;
-    if (placer_opts.quench_recompute_divider != 0) {
-        quench_recompute_limit = (int)(0.5
-                                       + (float)move_lim
-                                             / (float)placer_opts.quench_recompute_divider);
-    } else {
-        /*don't do an quench recompute */
-        quench_recompute_limit = first_move_lim + 1;
-    }
+        /* Get the first range limiter */
+        first_rlim = (float)max(device_ctx.grid.width() - 1,
+                                device_ctx.grid.height() - 1);
+        place_move_ctx.first_rlim = first_rlim;
 
-    //allocate helper vectors that are used by many move generators
-    place_move_ctx.X_coord.resize(10, 0);
-    place_move_ctx.Y_coord.resize(10, 0);
-    place_move_ctx.layer_coord.resize(10, 0);
+        /* Set the temperature low to ensure that initial placement quality will be preserved */
+        first_t = EPSILON;
 
-    //allocate move type statistics vectors
-    MoveTypeStat move_type_stat;
-    move_type_stat.blk_type_moves.resize({device_ctx.logical_block_types.size(), (int)e_move_type::NUMBER_OF_AUTO_MOVES}, 0);
-    move_type_stat.accepted_moves.resize({device_ctx.logical_block_types.size(), (int)e_move_type::NUMBER_OF_AUTO_MOVES}, 0);
-    move_type_stat.rejected_moves.resize({device_ctx.logical_block_types.size(), (int)e_move_type::NUMBER_OF_AUTO_MOVES}, 0);
+        float start_rlim = first_rlim;
+        if (!block_targets.empty()) {
+            start_rlim = std::min(first_rlim, MULTILEVEL_FIRST_RLIM);
+        }
 
-    /* Get the first range limiter */
-    first_rlim = (float)max(device_ctx.grid.width() - 1,
-                            device_ctx.grid.height() - 1);
-    place_move_ctx.first_rlim = first_rlim;
+        t_annealing_state state(annealing_sched,
+                                first_t,
+                                start_rlim,
+                                first_move_lim,
+                                first_crit_exponent,
+                                device_ctx.grid.get_num_layers());
+
+        /* Update the starting temperature for placement annealing to a more appropriate value *
+         * (a resumed anneal restores its temperature from the checkpoint below instead)        */
+        if (!resume_anneal) {
+            state.t = starting_t(&state, &costs, annealing_sched,
+                                 place_delay_model.get(), placer_criticalities.get(),
+                                 placer_setup_slacks.get(), timing_info.get(), *move_generator,
+                                 *manual_move_generator, pin_timing_invalidator.get(),
+                                 blocks_affected, placer_opts, noc_opts, move_type_stat);
+        }
 
-    /* Set the temperature low to ensure that initial placement quality will be preserved */
-    first_t = EPSILON;
+        if (!placer_opts.move_stats_file.empty()) {
+            f_move_stats_file = std::unique_ptr<FILE, decltype(&vtr::fclose)>(
+                vtr::fopen(placer_opts.move_stats_file.c_str(), "w"),
+                vtr::fclose);
+            LOG_MOVE_STATS_HEADER();
+        }
 
-    t_annealing_state state(annealing_sched,
-                            first_t,
-                            first_rlim,
-                            first_move_lim,
-                            first_crit_exponent,
-                            device_ctx.grid.get_num_layers());
+        tot_iter = 0;
+        moves_since_cost_recompute = 0;
 
-    /* Update the starting temperature for placement annealing to a more appropriate value */
-    state.t = starting_t(&state, &costs, annealing_sched,
-                         place_delay_model.get(), placer_criticalities.get(),
-                         placer_setup_slacks.get(), timing_info.get(), *move_generator,
-                         *manual_move_generator, pin_timing_invalidator.get(),
-                         blocks_affected, placer_opts, noc_opts, move_type_stat);
+        bool skip_anneal = false;
 
-    if (!placer_opts.move_stats_file.empty()) {
-        f_move_stats_file = std::unique_ptr<FILE, decltype(&vtr::fclose)>(
-            vtr::fopen(placer_opts.move_stats_file.c_str(), "w"),
-            vtr::fclose);
-        LOG_MOVE_STATS_HEADER();
-    }
+#ifdef ENABLE_ANALYTIC_PLACE
+        // Analytic placer: When enabled, skip most of the annealing and go straight to quench,
+        // or only refine the analytic placement with a low temperature anneal
+        // TODO: refactor goto label.
+        if (placer_opts.enable_analytic_placer && !resume_anneal) {
+            if (placer_opts.analytic_placer_anneal_t_scale > 0.) {
+                state.t *= placer_opts.analytic_placer_anneal_t_scale;
+                state.restart_t = state.t;
+                VTR_LOG("Refining the analytic placement from temperature %g\n", state.t);
+            } else {
+                skip_anneal = true;
+            }
+        }
+#endif /* ENABLE_ANALYTIC_PLACE */
 
-    tot_iter = 0;
-    moves_since_cost_recompute = 0;
+        //RL agent state definition
+        e_agent_state agent_state = e_agent_state::EARLY_IN_THE_ANNEAL;
 
-    bool skip_anneal = false;
+        std::unique_ptr<MoveGenerator> current_move_generator;
 
-#ifdef ENABLE_ANALYTIC_PLACE
-    // Analytic placer: When enabled, skip most of the annealing and go straight to quench
-    // TODO: refactor goto label.
-    if (placer_opts.enable_analytic_placer)
-        skip_anneal = true;
-#endif /* ENABLE_ANALYTIC_PLACE */
+        //Define the timing bb weight factor for the agent's reward function
+        float timing_bb_factor = REWARD_BB_TIMING_RELATIVE_WEIGHT;
+
+        if (resume_anneal) {
+            annealer_checkpoint.restore_annealer_state(state, agent_state, tot_iter, outer_crit_iter_count,
+                                                       *move_generator, *move_generator2);
 
-    //RL agent state definition
-    e_agent_state agent_state = e_agent_state::EARLY_IN_THE_ANNEAL;
+            if (placer_opts.place_algorithm.is_timing_driven()) {
+                //The criticalities were computed for the first temperature, recompute them for the restored one
+                PlaceCritParams crit_params;
+                crit_params.crit_exponent = state.crit_exponent;
+                crit_params.crit_limit = placer_opts.place_crit_limit;
+                perform_full_timing_update(crit_params, place_delay_model.get(), placer_criticalities.get(),
+                                           placer_setup_slacks.get(), pin_timing_invalidator.get(),
+                                           timing_info.get(), &costs);
+                critical_path = timing_info->least_slack_critical_path();
+            }
+            VTR_LOG("Resumed the anneal at temperature %d (t = %g)\n", state.num_temps, state.t);
+        }
+        const int resumed_num_temps = state.num_temps;
+
+        //Chooses the nets and blocks of the intermediate checks, without perturbing the annealer's random sequence
+        vtr::RandState check_rand_state = placer_opts.seed;
+
+        if (skip_anneal == false) {
+            //Table header
+            VTR_LOG("\n");
+            print_place_status_header(noc_opts.noc);
+
+            /* Outer loop of the simulated annealing begins */
+            do {
+                vtr::Timer temperature_timer;
+                vtr::ScopedTraceSpan temperature_trace_span("Annealing temperature");
+                VTR_PROFILE_SCOPE_ARG(anneal_temperature, state.num_temps);
+
+                //Save the annealer state between temperatures, so that an interrupted anneal can be resumed
+                if (!placer_opts.place_checkpoint_file.empty()
+                    && state.num_temps > resumed_num_temps
+                    && state.num_temps % placer_opts.place_checkpoint_interval == 0) {
+                    annealer_checkpoint.save(state, agent_state, tot_iter, outer_crit_iter_count,
+                                             *move_generator, *move_generator2);
+                    annealer_checkpoint.write(placer_opts.place_checkpoint_file);
+                }
 
-    std::unique_ptr<MoveGenerator> current_move_generator;
+                outer_loop_update_timing_info(placer_opts, noc_opts, &costs, num_connections,
+                                              state.crit_exponent, &outer_crit_iter_count,
+                                              place_delay_model.get(), placer_criticalities.get(),
+                                              placer_setup_slacks.get(), pin_timing_invalidator.get(),
+                                              timing_info.get());
 
-    //Define the timing bb weight factor for the agent's reward function
-    float timing_bb_factor = REWARD_BB_TIMING_RELATIVE_WEIGHT;
+                if (placer_opts.place_algorithm.is_timing_driven()) {
+                    critical_path = timing_info->least_slack_critical_path();
+                    sTNS = timing_info->setup_total_negative_slack();
+                    sWNS = timing_info->setup_worst_negative_slack();
 
-    if (skip_anneal == false) {
-        //Table header
-        VTR_LOG("\n");
-        print_place_status_header(noc_opts.noc);
+                    //see if we should save the current placement solution as a checkpoint
+
+                    if (placer_opts.place_checkpointing
+                        && agent_state == e_agent_state::LATE_IN_THE_ANNEAL) {
+                        save_placement_checkpoint_if_needed(placement_checkpoint,
+                                                            timing_info, costs, critical_path.delay());
+                    }
+                }
+
+                //move the appropriate move_generator to be the current used move generator
+                assign_current_move_generator(move_generator, move_generator2,
+                                              agent_state, placer_opts, false, current_move_generator);
+
+                //do a complete inner loop iteration
+                placement_inner_loop(&state, placer_opts, noc_opts,
+                                     inner_recompute_limit,
+                                     &stats, &costs, &moves_since_cost_recompute,
+                                     pin_timing_invalidator.get(), place_delay_model.get(),
+                                     placer_criticalities.get(), placer_setup_slacks.get(),
+                                     *current_move_generator, *manual_move_generator,
+                                     blocks_affected, timing_info.get(),
+                                     placer_opts.place_algorithm, move_type_stat,
+                                     timing_bb_factor);
+
+                //move the update used move_generator to its original variable
+                update_move_generator(move_generator, move_generator2, agent_state,
+                                      placer_opts, false, current_move_generator);
+
+                tot_iter += state.move_lim;
+                ++state.num_temps;
+
+                print_place_status(state, stats, temperature_timer.elapsed_sec(),
+                                   critical_path.delay(), sTNS, sWNS, tot_iter,
+                                   noc_opts.noc, costs.noc_cost_terms);
+                trace_place_status(state, stats, costs);
+
+                if (placer_opts.place_check_sample_fraction > 0.) {
+                    check_placement_sample(placer_opts.place_check_sample_fraction, check_rand_state);
+                }
+#ifndef NO_SERVER
+                server::update_placement_progress(state, stats, temperature_timer.elapsed_sec(), critical_path.delay());
+#endif /* NO_SERVER */
+
+                if (placer_opts.place_algorithm.is_timing_driven()
+                    && placer_opts.place_agent_multistate
+                    && agent_state == e_agent_state::EARLY_IN_THE_ANNEAL) {
+                    if (state.alpha < 0.85 && state.alpha > 0.6) {
+                        agent_state = e_agent_state::LATE_IN_THE_ANNEAL;
+                        VTR_LOG("Agent's 2nd state: \n");
+                    }
+                }
+
+                sprintf(msg, "Cost: %g  BB Cost %g  TD Cost %g  Temperature: %g",
+                        costs.cost, costs.bb_cost, costs.timing_cost, state.t);
+                update_screen(ScreenUpdatePriority::MINOR, msg, PLACEMENT,
+                              timing_info);
+
+                //#ifdef VERBOSE
+                //            if (getEchoEnabled()) {
+                //                print_clb_placement("first_iteration_clb_placement.echo");
+                //            }
+                //#endif
+
+                //Stop this seed if it is clearly losing against the best earlier one
+                if (num_seeds > 1) {
+                    seed_trajectory.push_back({costs.bb_cost, critical_path.delay()});
+                    if (state.rlim < first_rlim
+                        && should_prune_seed(placer_opts, seed_trajectory, best_seed_trajectory)) {
+                        seed_pruned = true;
+                        break;
+                    }
+                }
+            } while (state.outer_loop_update(stats.success_rate, costs, placer_opts,
+                                             annealing_sched));
+            /* Outer loop of the simulated annealing ends */
+        } //skip_anneal ends
+
+        if (seed_pruned) {
+            VTR_LOG("\nPlacement seed %d stopped after %d temperatures: more than %g%% worse than seed %d\n",
+                    seed_placer_opts.seed, state.num_temps, 100 * placer_opts.place_seeds_prune_margin,
+                    placer_opts.seed + best_seed);
+            continue;
+        }
+
+        /* Start Quench */
+        state.t = 0;                         //Freeze out: only accept solutions that improve placement.
+        state.move_lim = state.move_lim_max; //Revert the move limit to initial value.
 
-        /* Outer loop of the simulated annealing begins */
-        do {
-            vtr::Timer temperature_timer;
+        pre_quench_timing_stats = timing_ctx.stats;
+        { /* Quench */
+
+            vtr::ScopedFinishTimer temperature_timer("Placement Quench");
 
             outer_loop_update_timing_info(placer_opts, noc_opts, &costs, num_connections,
                                           state.crit_exponent, &outer_crit_iter_count,
@@ -966,138 +1236,120 @@ void try_place(const Netlist<>& net_list,
                                           placer_setup_slacks.get(), pin_timing_invalidator.get(),
                                           timing_info.get());
 
-            if (placer_opts.place_algorithm.is_timing_driven()) {
-                critical_path = timing_info->least_slack_critical_path();
-                sTNS = timing_info->setup_total_negative_slack();
-                sWNS = timing_info->setup_worst_negative_slack();
-
-                //see if we should save the current placement solution as a checkpoint
-
-                if (placer_opts.place_checkpointing
-                    && agent_state == e_agent_state::LATE_IN_THE_ANNEAL) {
-                    save_placement_checkpoint_if_needed(placement_checkpoint,
-                                                        timing_info, costs, critical_path.delay());
-                }
-            }
-
             //move the appropriate move_generator to be the current used move generator
             assign_current_move_generator(move_generator, move_generator2,
-                                          agent_state, placer_opts, false, current_move_generator);
+                                          agent_state, placer_opts, true, current_move_generator);
 
-            //do a complete inner loop iteration
+            /* Run inner loop again with temperature = 0 so as to accept only swaps
+             * which reduce the cost of the placement */
             placement_inner_loop(&state, placer_opts, noc_opts,
-                                 inner_recompute_limit,
+                                 quench_recompute_limit,
                                  &stats, &costs, &moves_since_cost_recompute,
                                  pin_timing_invalidator.get(), place_delay_model.get(),
                                  placer_criticalities.get(), placer_setup_slacks.get(),
                                  *current_move_generator, *manual_move_generator,
                                  blocks_affected, timing_info.get(),
-                                 placer_opts.place_algorithm, move_type_stat,
+                                 placer_opts.place_quench_algorithm, move_type_stat,
                                  timing_bb_factor);
 
             //move the update used move_generator to its original variable
             update_move_generator(move_generator, move_generator2, agent_state,
-                                  placer_opts, false, current_move_generator);
+                                  placer_opts, true, current_move_generator);
 
             tot_iter += state.move_lim;
             ++state.num_temps;
 
+            if (placer_opts.place_quench_algorithm.is_timing_driven()) {
+                critical_path = timing_info->least_slack_critical_path();
+                sTNS = timing_info->setup_total_negative_slack();
+                sWNS = timing_info->setup_worst_negative_slack();
+            }
+
             print_place_status(state, stats, temperature_timer.elapsed_sec(),
                                critical_path.delay(), sTNS, sWNS, tot_iter,
                                noc_opts.noc, costs.noc_cost_terms);
+            trace_place_status(state, stats, costs);
+#ifndef NO_SERVER
+            server::update_placement_progress(state, stats, temperature_timer.elapsed_sec(), critical_path.delay());
+#endif /* NO_SERVER */
+        }
+        post_quench_timing_stats = timing_ctx.stats;
 
-            if (placer_opts.place_algorithm.is_timing_driven()
-                && placer_opts.place_agent_multistate
-                && agent_state == e_agent_state::EARLY_IN_THE_ANNEAL) {
-                if (state.alpha < 0.85 && state.alpha > 0.6) {
-                    agent_state = e_agent_state::LATE_IN_THE_ANNEAL;
-                    VTR_LOG("Agent's 2nd state: \n");
-                }
+        //Final timing analysis
+        PlaceCritParams crit_params;
+        crit_params.crit_exponent = state.crit_exponent;
+        crit_params.crit_limit = placer_opts.place_crit_limit;
+
+        if (placer_opts.place_algorithm.is_timing_driven()) {
+            perform_full_timing_update(crit_params, place_delay_model.get(),
+                                       placer_criticalities.get(), placer_setup_slacks.get(),
+                                       pin_timing_invalidator.get(), timing_info.get(), &costs);
+            VTR_LOG("post-quench CPD = %g (ns) \n",
+                    1e9 * timing_info->least_slack_critical_path().delay());
+        }
+
+        //See if our latest checkpoint is better than the current placement solution
+        if (placer_opts.place_checkpointing)
+            restore_best_placement(placement_checkpoint, timing_info, costs,
+                                   placer_criticalities, placer_setup_slacks, place_delay_model,
+                                   pin_timing_invalidator, crit_params, noc_opts);
+
+        //Keep this placement if it is the best of the seeds so far
+        t_seed_progress seed_result{costs.bb_cost, 0.};
+        if (placer_opts.place_algorithm.is_timing_driven()) {
+            seed_result.cpd = timing_info->least_slack_critical_path().delay();
+        }
+        if (best_seed < 0 || seed_relative_quality(placer_opts, seed_result, best_seed_result) < 1.) {
+            best_seed = iseed;
+            best_seed_result = seed_result;
+            best_seed_trajectory.swap(seed_trajectory);
+            best_seed_state = std::make_unique<t_annealing_state>(state);
+            if (num_seeds > 1) {
+                best_seed_placement.save_placement(costs, seed_result.cpd);
             }
+        }
+    }
 
-            sprintf(msg, "Cost: %g  BB Cost %g  TD Cost %g  Temperature: %g",
-                    costs.cost, costs.bb_cost, costs.timing_cost, state.t);
-            update_screen(ScreenUpdatePriority::MINOR, msg, PLACEMENT,
-                          timing_info);
-
-            //#ifdef VERBOSE
-            //            if (getEchoEnabled()) {
-            //                print_clb_placement("first_iteration_clb_placement.echo");
-            //            }
-            //#endif
-        } while (state.outer_loop_update(stats.success_rate, costs, placer_opts,
-                                         annealing_sched));
-        /* Outer loop of the simulated annealing ends */
-    } //skip_anneal ends
-
-    /* Start Quench */
-    state.t = 0;                         //Freeze out: only accept solutions that improve placement.
-    state.move_lim = state.move_lim_max; //Revert the move limit to initial value.
+    //Seeds run after the best one have replaced its placement: restore it
+    if (best_seed != num_seeds - 1) {
+        VTR_LOG("\nRestoring the placement of seed %d\n", placer_opts.seed + best_seed);
+        costs = best_seed_placement.restore_placement();
 
-    auto pre_quench_timing_stats = timing_ctx.stats;
-    { /* Quench */
-
-        vtr::ScopedFinishTimer temperature_timer("Placement Quench");
-
-        outer_loop_update_timing_info(placer_opts, noc_opts, &costs, num_connections,
-                                      state.crit_exponent, &outer_crit_iter_count,
-                                      place_delay_model.get(), placer_criticalities.get(),
-                                      placer_setup_slacks.get(), pin_timing_invalidator.get(),
-                                      timing_info.get());
-
-        //move the appropriate move_generator to be the current used move generator
-        assign_current_move_generator(move_generator, move_generator2,
-                                      agent_state, placer_opts, true, current_move_generator);
-
-        /* Run inner loop again with temperature = 0 so as to accept only swaps
-         * which reduce the cost of the placement */
-        placement_inner_loop(&state, placer_opts, noc_opts,
-                             quench_recompute_limit,
-                             &stats, &costs, &moves_since_cost_recompute,
-                             pin_timing_invalidator.get(), place_delay_model.get(),
-                             placer_criticalities.get(), placer_setup_slacks.get(),
-                             *current_move_generator, *manual_move_generator,
-                             blocks_affected, timing_info.get(),
-                             placer_opts.place_quench_algorithm, move_type_stat,
-                             timing_bb_factor);
-
-        //move the update used move_generator to its original variable
-        update_move_generator(move_generator, move_generator2, agent_state,
-                              placer_opts, true, current_move_generator);
-
-        tot_iter += state.move_lim;
-        ++state.num_temps;
-
-        if (placer_opts.place_quench_algorithm.is_timing_driven()) {
-            critical_path = timing_info->least_slack_critical_path();
-            sTNS = timing_info->setup_total_negative_slack();
-            sWNS = timing_info->setup_worst_negative_slack();
+        for (auto block_id : cluster_ctx.clb_nlist.blocks()) {
+            place_sync_external_block_connections(block_id);
         }
 
-        print_place_status(state, stats, temperature_timer.elapsed_sec(),
-                           critical_path.delay(), sTNS, sWNS, tot_iter,
-                           noc_opts.noc, costs.noc_cost_terms);
-    }
-    auto post_quench_timing_stats = timing_ctx.stats;
+        if (cube_bb) {
+            costs.bb_cost = comp_bb_cost(NORMAL);
+        } else {
+            VTR_ASSERT_SAFE(!cube_bb);
+            costs.bb_cost = comp_layer_bb_cost(NORMAL);
+        }
 
-    //Final timing analysis
-    PlaceCritParams crit_params;
-    crit_params.crit_exponent = state.crit_exponent;
-    crit_params.crit_limit = placer_opts.place_crit_limit;
+        if (placer_opts.place_algorithm.is_timing_driven()) {
+            PlaceCritParams crit_params;
+            crit_params.crit_exponent = best_seed_state->crit_exponent;
+            crit_params.crit_limit = placer_opts.place_crit_limit;
 
-    if (placer_opts.place_algorithm.is_timing_driven()) {
-        perform_full_timing_update(crit_params, place_delay_model.get(),
-                                   placer_criticalities.get(), placer_setup_slacks.get(),
-                                   pin_timing_invalidator.get(), timing_info.get(), &costs);
-        VTR_LOG("post-quench CPD = %g (ns) \n",
-                1e9 * timing_info->least_slack_critical_path().delay());
-    }
+            placer_criticalities->set_recompute_required();
+            placer_setup_slacks->set_recompute_required();
+            comp_td_connection_delays(place_delay_model.get());
+            perform_full_timing_update(crit_params, place_delay_model.get(),
+                                       placer_criticalities.get(), placer_setup_slacks.get(),
+                                       pin_timing_invalidator.get(), timing_info.get(), &costs);
+        }
+
+        if (noc_opts.noc) {
+            reinitialize_noc_routing(costs, {});
+        }
 
-    //See if our latest checkpoint is better than the current placement solution
-    if (placer_opts.place_checkpointing)
-        restore_best_placement(placement_checkpoint, timing_info, costs,
-                               placer_criticalities, placer_setup_slacks, place_delay_model,
-                               pin_timing_invalidator, crit_params, noc_opts);
+        if (congestion_cost_enabled(placer_opts)) {
+            costs.congestion_cost = comp_congestion_cost();
+        }
+
+        costs.cost = get_total_cost(&costs, placer_opts, noc_opts);
+    }
+    const t_annealing_state& state = *best_seed_state;
 
     if (placer_opts.placement_saves_per_temperature >= 1) {
         std::string filename = vtr::string_fmt("placement_%03d_%03d.place",
@@ -1128,7 +1380,7 @@ void try_place(const Netlist<>& net_list,
 
     //Some stats
     VTR_LOG("\n");
-    VTR_LOG("Swaps called: %d\n", num_ts_called);
+    VTR_LOG("Swaps called: %d\n", swap_ctx.num_ts_called);
     report_aborted_moves();
 
     if (placer_opts.place_algorithm.is_timing_driven()) {
@@ -1165,6 +1417,16 @@ void try_place(const Netlist<>& net_list,
             costs.cost, costs.bb_cost, costs.timing_cost, width_fac);
     VTR_LOG("Placement cost: %g, bb_cost: %g, td_cost: %g, \n", costs.cost,
             costs.bb_cost, costs.timing_cost);
+    if (cube_bb) {
+        //Report the RUDY congestion estimate of the final placement, whether or not the placer optimized it
+        auto& congestion_map = g_placer_ctx.mutable_move().congestion_map;
+        if (congestion_map.empty()) {
+            congestion_map.init(device_ctx.grid, device_ctx.chan_width);
+        }
+        load_congestion_map();
+        VTR_LOG("Placement estimated max channel utilization: %.3f, overused channels: %.2f%%\n",
+                congestion_map.max_utilization(), 100. * congestion_map.overused_fraction());
+    }
     // print the noc costs info
     if (noc_opts.noc) {
         print_noc_costs("\nNoC Placement Costs", costs, noc_opts);
@@ -1202,6 +1464,14 @@ void try_place(const Netlist<>& net_list,
             p_runtime_ctx.f_update_td_costs_nets_elapsed_sec,
             p_runtime_ctx.f_update_td_costs_sum_nets_elapsed_sec,
             p_runtime_ctx.f_update_td_costs_total_elapsed_sec);
+
+    if (p_runtime_ctx.accepted_move_timing_updates > 0) {
+        size_t num_tnodes = timing_ctx.graph->nodes().size();
+        double avg_tnodes = double(p_runtime_ctx.accepted_move_timing_update_nodes) / p_runtime_ctx.accepted_move_timing_updates;
+        VTR_LOG("Accepted move timing updates: %zu, each updating %.0f of %zu timing graph nodes on average (%.1f%%)\n",
+                p_runtime_ctx.accepted_move_timing_updates, avg_tnodes, num_tnodes,
+                100. * avg_tnodes / std::max<size_t>(num_tnodes, 1));
+    }
 }
 
 /* Function to update the setup slacks and criticalities before the inner loop of the annealing/quench */
@@ -1234,6 +1504,7 @@ static void outer_loop_update_timing_info(const t_placer_opts& placer_opts,
             //Update all timing related classes
             perform_full_timing_update(crit_params, delay_model, criticalities,
                                        setup_slacks, pin_timing_invalidator, timing_info, costs);
+            update_sampled_timing_connections(placer_opts, *criticalities);
 
             *outer_crit_iter_count = 0;
         }
@@ -1263,6 +1534,7 @@ static void placement_inner_loop(const t_annealing_state* state,
                                  const t_place_algorithm& place_algorithm,
                                  MoveTypeStat& move_type_stat,
                                  float timing_bb_factor) {
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
     int inner_crit_iter_count, inner_iter;
 
     int inner_placement_save_count = 0; //How many times have we dumped placement to a file this temperature?
@@ -1270,25 +1542,61 @@ static void placement_inner_loop(const t_annealing_state* state,
     stats->reset();
 
     inner_crit_iter_count = 1;
+    int num_accepted_at_timing_update = swap_ctx.num_swap_accepted;
 
     bool manual_move_enabled = false;
 
+    // Moves are either done one at a time by try_swap(), or in batches by try_swap_batch().
+    // A batch never spans one of the periodic updates below, so these see the same state
+    // either way.
+    const bool batch_moves = !swap_ctx.batched_moves.empty() && can_batch_moves(placer_opts, noc_opts, place_algorithm);
+    int num_batched_moves_left = 0;
+    if (swap_ctx.has_deferred_move) {
+        // Proposed for a different temperature (and maybe move generator)
+        clear_move_blocks(swap_ctx.batched_moves.back().blocks_affected);
+        swap_ctx.has_deferred_move = false;
+    }
+
     /* Inner loop begins */
     for (inner_iter = 0; inner_iter < state->move_lim; inner_iter++) {
-        e_move_result swap_result = try_swap(state, costs, move_generator,
-                                             manual_move_generator, timing_info, pin_timing_invalidator,
-                                             blocks_affected, delay_model, criticalities, setup_slacks,
-                                             placer_opts, noc_opts, move_type_stat, place_algorithm,
-                                             timing_bb_factor, manual_move_enabled);
+        if (batch_moves) {
+            if (num_batched_moves_left == 0) {
+                int max_moves = state->move_lim - inner_iter;
+                if (place_algorithm.is_timing_driven()) {
+                    max_moves = std::min(max_moves, std::max(0, inner_recompute_limit - inner_crit_iter_count) + 1);
+                }
+                max_moves = std::min(max_moves, std::max(0, MAX_MOVES_BEFORE_RECOMPUTE - *moves_since_cost_recompute) + 1);
+                if (placer_opts.placement_saves_per_temperature >= 1) {
+                    int save_period = state->move_lim / placer_opts.placement_saves_per_temperature;
+                    if (save_period > 0) {
+                        max_moves = std::min(max_moves, (save_period - (inner_iter + 1) % save_period) % save_period + 1);
+                    }
+                }
 
-        if (swap_result == ACCEPTED) {
-            /* Move was accepted.  Update statistics that are useful for the annealing schedule. */
-            stats->single_swap_update(*costs);
-            num_swap_accepted++;
-        } else if (swap_result == ABORTED) {
-            num_swap_aborted++;
-        } else { // swap_result == REJECTED
-            num_swap_rejected++;
+                num_batched_moves_left = try_swap_batch(state, costs, stats, move_generator,
+                                                        timing_info, pin_timing_invalidator,
+                                                        delay_model, criticalities, placer_opts,
+                                                        move_type_stat, place_algorithm,
+                                                        timing_bb_factor, max_moves);
+            }
+            // try_swap_batch() has already updated the statistics for this move
+            --num_batched_moves_left;
+        } else {
+            e_move_result swap_result = try_swap(state, costs, move_generator,
+                                                 manual_move_generator, timing_info, pin_timing_invalidator,
+                                                 blocks_affected, delay_model, criticalities, setup_slacks,
+                                                 placer_opts, noc_opts, move_type_stat, place_algorithm,
+                                                 timing_bb_factor, manual_move_enabled);
+
+            if (swap_result == ACCEPTED) {
+                /* Move was accepted.  Update statistics that are useful for the annealing schedule. */
+                stats->single_swap_update(*costs);
+                swap_ctx.num_swap_accepted++;
+            } else if (swap_result == ABORTED) {
+                swap_ctx.num_swap_aborted++;
+            } else { // swap_result == REJECTED
+                swap_ctx.num_swap_rejected++;
+            }
         }
 
         if (place_algorithm.is_timing_driven()) {
@@ -1299,6 +1607,7 @@ static void placement_inner_loop(const t_annealing_state* state,
                 && inner_iter != state->move_lim - 1) { /*on last iteration don't recompute */
 
                 inner_crit_iter_count = 0;
+                num_accepted_at_timing_update = swap_ctx.num_swap_accepted;
 #ifdef VERBOSE
                 VTR_LOG("Inner loop recompute criticalities\n");
 #endif
@@ -1311,6 +1620,25 @@ static void placement_inner_loop(const t_annealing_state* state,
                 perform_full_timing_update(crit_params, delay_model,
                                            criticalities, setup_slacks, pin_timing_invalidator,
                                            timing_info, costs);
+            } else if (placer_opts.place_timing_update_accepted_moves > 0
+                       && swap_ctx.num_swap_accepted - num_accepted_at_timing_update >= placer_opts.place_timing_update_accepted_moves
+                       && inner_iter != state->move_lim - 1) {
+                /* Enough moves were accepted since the last analysis to make the criticalities *
+                 * stale. Only the connections these moves changed have been invalidated, so an *
+                 * incremental analyzer only walks their fan-out cones.                         */
+                num_accepted_at_timing_update = swap_ctx.num_swap_accepted;
+
+                PlaceCritParams crit_params;
+                crit_params.crit_exponent = state->crit_exponent;
+                crit_params.crit_limit = placer_opts.place_crit_limit;
+
+                perform_full_timing_update(crit_params, delay_model,
+                                           criticalities, setup_slacks, pin_timing_invalidator,
+                                           timing_info, costs);
+
+                auto& p_runtime_ctx = g_placer_ctx.mutable_runtime();
+                ++p_runtime_ctx.accepted_move_timing_updates;
+                p_runtime_ctx.accepted_move_timing_update_nodes += timing_info->setup_analyzer()->modified_nodes().size();
             }
             inner_crit_iter_count++;
         }
@@ -1385,6 +1713,15 @@ static void recompute_costs_from_scratch(const t_placer_opts& placer_opts,
         costs->cost = new_bb_cost * costs->bb_cost_norm;
     }
 
+    if (congestion_cost_enabled(placer_opts)) {
+        double new_congestion_cost = recompute_congestion_cost();
+        // The congestion cost of a placement without overused channels is 0 (up to round-off)
+        if (new_congestion_cost > MIN_EXPECTED_CONGESTION_COST) {
+            check_and_print_cost(new_congestion_cost, costs->congestion_cost, "congestion_cost");
+        }
+        costs->congestion_cost = new_congestion_cost;
+    }
+
     if (noc_opts.noc) {
         NocCostTerms new_noc_cost;
         recompute_noc_costs(new_noc_cost);
@@ -1449,6 +1786,7 @@ static float starting_t(const t_annealing_state* state,
                         const t_placer_opts& placer_opts,
                         const t_noc_opts& noc_opts,
                         MoveTypeStat& move_type_stat) {
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
     if (annealing_sched.type == USER_SCHED) {
         return (annealing_sched.init_t);
     }
@@ -1487,11 +1825,11 @@ static float starting_t(const t_annealing_state* state,
             num_accepted++;
             av += costs->cost;
             sum_of_squares += costs->cost * costs->cost;
-            num_swap_accepted++;
+            swap_ctx.num_swap_accepted++;
         } else if (swap_result == ABORTED) {
-            num_swap_aborted++;
+            swap_ctx.num_swap_aborted++;
         } else {
-            num_swap_rejected++;
+            swap_ctx.num_swap_rejected++;
         }
     }
 
@@ -1520,48 +1858,53 @@ static float starting_t(const t_annealing_state* state,
 }
 
 static void update_move_nets(int num_nets_affected,
+                             const std::vector<ClusterNetId>& nets_to_update,
                              const bool cube_bb) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
     /* update net cost functions and reset flags. */
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_move_ctx = g_placer_ctx.mutable_move();
 
     for (int inet_affected = 0; inet_affected < num_nets_affected;
          inet_affected++) {
-        ClusterNetId net_id = ts_nets_to_update[inet_affected];
+        ClusterNetId net_id = nets_to_update[inet_affected];
 
         if (cube_bb) {
-            place_move_ctx.bb_coords[net_id] = ts_bb_coord_new[net_id];
+            place_move_ctx.bb_coords[net_id] = swap_ctx.ts_bb_coord_new[net_id];
         } else {
-            place_move_ctx.layer_bb_coords[net_id] = layer_ts_bb_coord_new[net_id];
+            place_move_ctx.layer_bb_coords[net_id] = swap_ctx.layer_ts_bb_coord_new[net_id];
         }
 
         for (int layer_num = 0; layer_num < g_vpr_ctx.device().grid.get_num_layers(); layer_num++) {
-            place_move_ctx.num_sink_pin_layer[size_t(net_id)][layer_num] = ts_layer_sink_pin_count[size_t(net_id)][layer_num];
+            place_move_ctx.num_sink_pin_layer[size_t(net_id)][layer_num] = swap_ctx.ts_layer_sink_pin_count[size_t(net_id)][layer_num];
         }
 
         if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET) {
             if (cube_bb) {
-                place_move_ctx.bb_num_on_edges[net_id] = ts_bb_edge_new[net_id];
+                place_move_ctx.bb_num_on_edges[net_id] = swap_ctx.ts_bb_edge_new[net_id];
             } else {
-                place_move_ctx.layer_bb_num_on_edges[net_id] = layer_ts_bb_edge_new[net_id];
+                place_move_ctx.layer_bb_num_on_edges[net_id] = swap_ctx.layer_ts_bb_edge_new[net_id];
             }
         }
 
-        net_cost[net_id] = proposed_net_cost[net_id];
+        cost_ctx.net_cost[net_id] = cost_ctx.proposed_net_cost[net_id];
 
         /* negative proposed_net_cost value is acting as a flag. */
-        proposed_net_cost[net_id] = -1;
-        bb_updated_before[net_id] = NOT_UPDATED_YET;
+        cost_ctx.proposed_net_cost[net_id] = -1;
+        cost_ctx.bb_updated_before[net_id] = NOT_UPDATED_YET;
     }
 }
 
-static void reset_move_nets(int num_nets_affected) {
+static void reset_move_nets(int num_nets_affected,
+                            const std::vector<ClusterNetId>& nets_to_update) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
     /* Reset the net cost function flags first. */
     for (int inet_affected = 0; inet_affected < num_nets_affected;
          inet_affected++) {
-        ClusterNetId net_id = ts_nets_to_update[inet_affected];
-        proposed_net_cost[net_id] = -1;
-        bb_updated_before[net_id] = NOT_UPDATED_YET;
+        ClusterNetId net_id = nets_to_update[inet_affected];
+        cost_ctx.proposed_net_cost[net_id] = -1;
+        cost_ctx.bb_updated_before[net_id] = NOT_UPDATED_YET;
     }
 }
 
@@ -1597,6 +1940,8 @@ static e_move_result try_swap(const t_annealing_state* state,
                               const t_place_algorithm& place_algorithm,
                               float timing_bb_factor,
                               bool manual_move_enabled) {
+    VTR_PROFILE_SCOPE(try_swap);
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
     /* Picks some block and moves it to another spot.  If this spot is   *
      * occupied, switch the blocks.  Assess the change in cost function. *
      * rlim is the range limiter.                                        *
@@ -1613,7 +1958,7 @@ static e_move_result try_swap(const t_annealing_state* state,
     // move type and block type chosen by the agent
     t_propose_action proposed_action{e_move_type::UNIFORM, -1};
 
-    num_ts_called++;
+    swap_ctx.num_ts_called++;
 
     MoveOutcomeStats move_outcome_stats;
 
@@ -1700,7 +2045,7 @@ static e_move_result try_swap(const t_annealing_state* state,
         //delays and timing costs and store them in proposed_* data structures.
         int num_nets_affected = find_affected_nets_and_update_costs(
             place_algorithm, delay_model, criticalities, blocks_affected,
-            bb_delta_c, timing_delta_c);
+            swap_ctx.ts_nets_to_update, bb_delta_c, timing_delta_c);
 
         //For setup slack analysis, we first do a timing analysis to get the newest
         //slack values resulted from the proposed block moves. If the move turns out
@@ -1755,10 +2100,18 @@ static e_move_result try_swap(const t_annealing_state* state,
             delta_c = bb_delta_c * costs->bb_cost_norm;
         }
 
+        /* Add the change in the routing congestion of the moved nets */
+        double congestion_delta_c = 0.;
+        if (congestion_cost_enabled(placer_opts)) {
+            congestion_delta_c = update_congestion_delta_costs(num_nets_affected, swap_ctx.ts_nets_to_update);
+            delta_c += placer_opts.place_congestion_weight * congestion_delta_c * costs->bb_cost_norm;
+        }
+
         NocCostTerms noc_delta_c; // change in NoC cost
+        bool noc_move_is_deadlock_free = true;
         /* Update the NoC datastructure and costs*/
         if (noc_opts.noc) {
-            find_affected_noc_routers_and_update_noc_costs(blocks_affected, noc_delta_c);
+            noc_move_is_deadlock_free = find_affected_noc_routers_and_update_noc_costs(blocks_affected, noc_delta_c);
 
             // Include the NoC delta costs in the total cost change for this swap
             delta_c += calculate_noc_cost(noc_delta_c, costs->noc_cost_norm_factors, noc_opts);
@@ -1774,6 +2127,11 @@ static e_move_result try_swap(const t_annealing_state* state,
         }
 #endif //NO_GRAPHICS
 
+        //Moves whose NoC routes could deadlock are never accepted
+        if (!noc_move_is_deadlock_free) {
+            move_outcome = REJECTED;
+        }
+
         if (move_outcome == ACCEPTED) {
             costs->cost += delta_c;
             costs->bb_cost += bb_delta_c;
@@ -1790,6 +2148,10 @@ static e_move_result try_swap(const t_annealing_state* state,
             if (place_algorithm == CRITICALITY_TIMING_PLACE) {
                 costs->timing_cost += timing_delta_c;
 
+                /* Add the exact timing cost change of any sampled high-fanout nets */
+                complete_sampled_td_costs(delay_model, *criticalities, timing_tradeoff,
+                                          blocks_affected, costs);
+
                 /* Invalidates timing of modified connections for incremental *
                  * timing updates. These invalidations are accumulated for a  *
                  * big timing update in the outer loop.                       */
@@ -1801,12 +2163,19 @@ static e_move_result try_swap(const t_annealing_state* state,
                 commit_td_cost(blocks_affected);
             }
 
+            /* Move the committed nets in the congestion map, before their bounding boxes are updated */
+            if (congestion_cost_enabled(placer_opts)) {
+                costs->congestion_cost += congestion_delta_c;
+                commit_congestion_costs(num_nets_affected, swap_ctx.ts_nets_to_update);
+            }
+
             /* Update net cost functions and reset flags. */
-            update_move_nets(num_nets_affected,
+            update_move_nets(num_nets_affected, swap_ctx.ts_nets_to_update,
                              g_vpr_ctx.placement().cube_bb);
 
             /* Update clb data structures since we kept the move. */
             commit_move_blocks(blocks_affected);
+            update_net_sink_coord_sums(blocks_affected);
 
             if (proposed_action.logical_blk_type_index != -1) { //if the agent proposed the block type, then collect the block type stat
                 ++move_type_stat.accepted_moves[proposed_action.logical_blk_type_index][(int)proposed_action.move_type];
@@ -1827,7 +2196,7 @@ static e_move_result try_swap(const t_annealing_state* state,
             VTR_ASSERT_SAFE(move_outcome == REJECTED);
 
             /* Reset the net cost function flags first. */
-            reset_move_nets(num_nets_affected);
+            reset_move_nets(num_nets_affected, swap_ctx.ts_nets_to_update);
 
             /* Restore the place_ctx.block_locs data structures to their state before the move. */
             revert_move_blocks(blocks_affected);
@@ -1912,6 +2281,288 @@ static e_move_result try_swap(const t_annealing_state* state,
     return move_outcome;
 }
 
+/**
+ * @brief Can placement_inner_loop() use try_swap_batch() for this configuration?
+ *
+ * Batched moves are only evaluated with the wirelength and criticality timing
+ * costs: slack timing analyses each move on its own, NoC costs are kept in
+ * shared per-router state, the congestion cost prices each move against the
+ * channel demand of all the nets, and the move stats/placer debug logging
+ * assume one move at a time.
+ */
+static bool can_batch_moves(const t_placer_opts& placer_opts,
+                            const t_noc_opts& noc_opts,
+                            const t_place_algorithm& place_algorithm) {
+    return placer_opts.place_parallel_moves > 1
+           && (place_algorithm == BOUNDING_BOX_PLACE || place_algorithm == CRITICALITY_TIMING_PLACE)
+           && !noc_opts.noc
+           && !congestion_cost_enabled(placer_opts)
+           && !f_move_stats_file
+           && !g_vpr_ctx.placement().f_placer_debug;
+}
+
+/**
+ * @brief Claims the blocks, locations and nets of a proposed move for the current batch.
+ *
+ * Returns false (claiming nothing) if any of them is already claimed by an earlier
+ * move of the batch. Moves with disjoint blocks, locations and nets do not see
+ * each other: the bounding box and connection delays of a net only depend on the
+ * blocks on that net. So such moves can be applied together, evaluated in parallel,
+ * and then accepted or rejected in any order with the same result as one by one.
+ */
+static bool claim_batched_move(t_batched_move& move) {
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    const auto& blocks_affected = move.blocks_affected;
+
+    size_t num_pins = 0;
+    for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; ++iblk) {
+        const t_pl_moved_block& moved_block = blocks_affected.moved_blocks[iblk];
+        if (swap_ctx.block_batch_stamp[moved_block.block_num] == swap_ctx.batch_stamp
+            || swap_ctx.batch_locs.count(moved_block.old_loc)
+            || swap_ctx.batch_locs.count(moved_block.new_loc)) {
+            return false;
+        }
+
+        for (ClusterPinId blk_pin : cluster_ctx.clb_nlist.block_pins(moved_block.block_num)) {
+            ClusterNetId net_id = cluster_ctx.clb_nlist.pin_net(blk_pin);
+            if (!cluster_ctx.clb_nlist.net_is_ignored(net_id) && swap_ctx.net_batch_stamp[net_id] == swap_ctx.batch_stamp) {
+                return false;
+            }
+            ++num_pins;
+        }
+    }
+
+    for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; ++iblk) {
+        const t_pl_moved_block& moved_block = blocks_affected.moved_blocks[iblk];
+        swap_ctx.block_batch_stamp[moved_block.block_num] = swap_ctx.batch_stamp;
+        swap_ctx.batch_locs.insert(moved_block.old_loc);
+        swap_ctx.batch_locs.insert(moved_block.new_loc);
+
+        for (ClusterPinId blk_pin : cluster_ctx.clb_nlist.block_pins(moved_block.block_num)) {
+            swap_ctx.net_batch_stamp[cluster_ctx.clb_nlist.pin_net(blk_pin)] = swap_ctx.batch_stamp;
+        }
+    }
+
+    // find_affected_nets_and_update_costs() records each affected net once
+    if (move.nets_to_update.size() < num_pins) {
+        move.nets_to_update.resize(num_pins);
+    }
+    return true;
+}
+
+/**
+ * @brief Is a move proposed before the previous batch was committed still a legal move?
+ *
+ * The earlier batch may have moved one of its blocks, or a block into one of the locations
+ * it moves a block to.
+ */
+static bool deferred_move_still_applies(const t_pl_blocks_to_be_moved& blocks_affected) {
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    for (int iblk = 0; iblk < blocks_affected.num_moved_blocks; ++iblk) {
+        const t_pl_moved_block& moved_block = blocks_affected.moved_blocks[iblk];
+        if (place_ctx.block_locs[moved_block.block_num].loc != moved_block.old_loc) {
+            return false;
+        }
+
+        // Any block now at the destination must be one this move moves away
+        if (place_ctx.grid_blocks.block_at_location(moved_block.new_loc) != EMPTY_BLOCK_ID
+            && !blocks_affected.moved_from.count(moved_block.new_loc)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Proposes up to max_moves moves, evaluates them in parallel and then accepts or
+ * rejects them one by one in proposal order.
+ *
+ * This is try_swap() for several moves. The moves of a batch are proposed from the same
+ * placement, and only moves which share no block, location or net with an earlier move of
+ * the batch are kept (see claim_batched_move()). The first conflicting proposal ends the
+ * batch, and is kept for the next one if it is still legal by then. Since the moves of a
+ * batch are independent, and random numbers are only drawn by the serial propose and
+ * accept steps, the result does not depend on the number of threads.
+ *
+ * Updates the costs, the placer statistics and the swap counters for every move.
+ *
+ * @return The number of moves processed, at most max_moves.
+ */
+static int try_swap_batch(const t_annealing_state* state,
+                          t_placer_costs* costs,
+                          t_placer_statistics* stats,
+                          MoveGenerator& move_generator,
+                          SetupTimingInfo* timing_info,
+                          NetPinTimingInvalidator* pin_timing_invalidator,
+                          const PlaceDelayModel* delay_model,
+                          PlacerCriticalities* criticalities,
+                          const t_placer_opts& placer_opts,
+                          MoveTypeStat& move_type_stat,
+                          const t_place_algorithm& place_algorithm,
+                          float timing_bb_factor,
+                          int max_moves) {
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
+    VTR_ASSERT_SAFE(max_moves >= 1);
+    const int deferred_idx = int(swap_ctx.batched_moves.size()) - 1;
+    max_moves = std::min(max_moves, deferred_idx);
+
+    ++swap_ctx.batch_stamp;
+    swap_ctx.batch_locs.clear();
+
+    /* Propose the moves of the batch */
+    int num_moves = 0;
+    if (swap_ctx.has_deferred_move) {
+        swap_ctx.has_deferred_move = false;
+        std::swap(swap_ctx.batched_moves[0], swap_ctx.batched_moves[deferred_idx]);
+        if (deferred_move_still_applies(swap_ctx.batched_moves[0].blocks_affected)) {
+            bool claimed = claim_batched_move(swap_ctx.batched_moves[0]);
+            VTR_ASSERT(claimed);
+            num_moves = 1;
+        } else {
+            clear_move_blocks(swap_ctx.batched_moves[0].blocks_affected);
+        }
+    }
+
+    while (num_moves < max_moves) {
+        t_batched_move& move = swap_ctx.batched_moves[num_moves];
+
+        float rlim;
+        if (placer_opts.rlim_escape_fraction > 0. && vtr::frand() < placer_opts.rlim_escape_fraction) {
+            rlim = std::numeric_limits<float>::infinity();
+        } else {
+            rlim = state->rlim;
+        }
+
+        move.proposed_action = {e_move_type::UNIFORM, -1};
+        move.create_move_outcome = move_generator.propose_move(move.blocks_affected, move.proposed_action, rlim, placer_opts, criticalities);
+        move.action_id = move_generator.proposed_action_id();
+
+        if (move.create_move_outcome == e_create_move::VALID && !claim_batched_move(move)) {
+            std::swap(swap_ctx.batched_moves[num_moves], swap_ctx.batched_moves[deferred_idx]);
+            swap_ctx.has_deferred_move = true;
+            break;
+        }
+        ++num_moves;
+    }
+
+    /* Apply all the moves, then evaluate them in parallel. Each move only touches *
+     * the per-net scratch data (ts_*, proposed_*) of its own nets.                 */
+    for (int imove = 0; imove < num_moves; ++imove) {
+        if (swap_ctx.batched_moves[imove].create_move_outcome == e_create_move::VALID) {
+            apply_move_blocks(swap_ctx.batched_moves[imove].blocks_affected);
+        }
+    }
+
+    auto evaluate_move = [&](int imove) {
+        t_batched_move& move = swap_ctx.batched_moves[imove];
+        if (move.create_move_outcome != e_create_move::VALID) {
+            return;
+        }
+        move.bb_delta_c = 0.;
+        move.timing_delta_c = 0.;
+        move.num_nets_affected = find_affected_nets_and_update_costs(
+            place_algorithm, delay_model, criticalities, move.blocks_affected,
+            move.nets_to_update, move.bb_delta_c, move.timing_delta_c);
+    };
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(0, num_moves, evaluate_move);
+#else
+    for (int imove = 0; imove < num_moves; ++imove) {
+        evaluate_move(imove);
+    }
+#endif
+
+    /* Accept or reject the moves in proposal order */
+    for (int imove = 0; imove < num_moves; ++imove) {
+        t_batched_move& move = swap_ctx.batched_moves[imove];
+
+        swap_ctx.num_ts_called++;
+
+        if (move.proposed_action.logical_blk_type_index != -1) {
+            ++move_type_stat.blk_type_moves[move.proposed_action.logical_blk_type_index][(int)move.proposed_action.move_type];
+        }
+
+        MoveOutcomeStats move_outcome_stats;
+        double delta_c = 0;
+        e_move_result move_outcome = ABORTED;
+
+        if (move.create_move_outcome == e_create_move::VALID) {
+            if (place_algorithm == CRITICALITY_TIMING_PLACE) {
+                delta_c = (1 - placer_opts.timing_tradeoff) * move.bb_delta_c * costs->bb_cost_norm
+                          + placer_opts.timing_tradeoff * move.timing_delta_c * costs->timing_cost_norm;
+            } else {
+                VTR_ASSERT_SAFE(place_algorithm == BOUNDING_BOX_PLACE);
+                delta_c = move.bb_delta_c * costs->bb_cost_norm;
+            }
+
+            move_outcome = assess_swap(delta_c, state->t);
+
+            if (move_outcome == ACCEPTED) {
+                costs->cost += delta_c;
+                costs->bb_cost += move.bb_delta_c;
+
+                if (place_algorithm == CRITICALITY_TIMING_PLACE) {
+                    costs->timing_cost += move.timing_delta_c;
+                    complete_sampled_td_costs(delay_model, *criticalities, placer_opts.timing_tradeoff,
+                                              move.blocks_affected, costs);
+
+                    invalidate_affected_connections(move.blocks_affected,
+                                                    pin_timing_invalidator, timing_info);
+                    commit_td_cost(move.blocks_affected);
+                }
+
+                update_move_nets(move.num_nets_affected, move.nets_to_update,
+                                 g_vpr_ctx.placement().cube_bb);
+                commit_move_blocks(move.blocks_affected);
+                update_net_sink_coord_sums(move.blocks_affected);
+
+                if (move.proposed_action.logical_blk_type_index != -1) {
+                    ++move_type_stat.accepted_moves[move.proposed_action.logical_blk_type_index][(int)move.proposed_action.move_type];
+                }
+
+                stats->single_swap_update(*costs);
+                swap_ctx.num_swap_accepted++;
+            } else {
+                VTR_ASSERT_SAFE(move_outcome == REJECTED);
+
+                reset_move_nets(move.num_nets_affected, move.nets_to_update);
+                revert_move_blocks(move.blocks_affected);
+
+                if (place_algorithm == CRITICALITY_TIMING_PLACE) {
+                    revert_td_cost(move.blocks_affected);
+                }
+
+                if (move.proposed_action.logical_blk_type_index != -1) {
+                    ++move_type_stat.rejected_moves[move.proposed_action.logical_blk_type_index][(int)move.proposed_action.move_type];
+                }
+
+                swap_ctx.num_swap_rejected++;
+            }
+
+            move_outcome_stats.delta_cost_norm = delta_c;
+            move_outcome_stats.delta_bb_cost_norm = move.bb_delta_c * costs->bb_cost_norm;
+            move_outcome_stats.delta_timing_cost_norm = move.timing_delta_c * costs->timing_cost_norm;
+
+            move_outcome_stats.delta_bb_cost_abs = move.bb_delta_c;
+            move_outcome_stats.delta_timing_cost_abs = move.timing_delta_c;
+        } else {
+            swap_ctx.num_swap_aborted++;
+        }
+        move_outcome_stats.outcome = move_outcome;
+
+        // Credit the outcome to the action which proposed this move, not the batch's last one
+        move_generator.set_proposed_action_id(move.action_id);
+        calculate_reward_and_process_outcome(placer_opts, move_outcome_stats,
+                                             delta_c, timing_bb_factor, move_generator);
+
+        clear_move_blocks(move.blocks_affected);
+    }
+
+    return num_moves;
+}
+
 static bool is_cube_bb(const e_place_bounding_box_mode place_bb_mode,
                        const RRGraphView& rr_graph) {
     bool cube_bb;
@@ -1970,8 +2621,11 @@ static int find_affected_nets_and_update_costs(
     const PlaceDelayModel* delay_model,
     const PlacerCriticalities* criticalities,
     t_pl_blocks_to_be_moved& blocks_affected,
+    std::vector<ClusterNetId>& nets_to_update,
     double& bb_delta_c,
     double& timing_delta_c) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
     VTR_ASSERT_SAFE(bb_delta_c == 0.);
     VTR_ASSERT_SAFE(timing_delta_c == 0.);
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -1996,7 +2650,7 @@ static int find_affected_nets_and_update_costs(
                 continue;
 
             /* Record effected nets */
-            record_affected_net(net_id, num_affected_nets);
+            record_affected_net(net_id, nets_to_update, num_affected_nets);
 
             /* Update the net bounding boxes. */
             if (cube_bb) {
@@ -2006,9 +2660,12 @@ static int find_affected_nets_and_update_costs(
             }
 
             if (place_algorithm.is_timing_driven()) {
-                /* Determine the change in connection delay and timing cost. */
+                /* Determine the change in connection delay and timing cost. Only      *
+                 * moves which are accepted or rejected before being committed can use *
+                 * the sampled connections of high-fanout nets.                        */
                 update_td_delta_costs(delay_model, *criticalities, net_id,
-                                      blk_pin, blocks_affected, timing_delta_c);
+                                      blk_pin, blocks_affected, timing_delta_c,
+                                      place_algorithm == CRITICALITY_TIMING_PLACE);
             }
         }
     }
@@ -2017,18 +2674,18 @@ static int find_affected_nets_and_update_costs(
      * boxes are up-to-date). The cost is only updated once per net. */
     for (int inet_affected = 0; inet_affected < num_affected_nets;
          inet_affected++) {
-        ClusterNetId net_id = ts_nets_to_update[inet_affected];
+        ClusterNetId net_id = nets_to_update[inet_affected];
 
         if (cube_bb) {
-            proposed_net_cost[net_id] = get_net_cost(net_id,
-                                                     ts_bb_coord_new[net_id]);
+            cost_ctx.proposed_net_cost[net_id] = get_net_cost(net_id,
+                                                     swap_ctx.ts_bb_coord_new[net_id]);
         } else {
-            proposed_net_cost[net_id] = get_net_layer_cost(net_id,
-                                                           layer_ts_bb_coord_new[net_id],
-                                                           ts_layer_sink_pin_count[size_t(net_id)]);
+            cost_ctx.proposed_net_cost[net_id] = get_net_layer_cost(net_id,
+                                                           swap_ctx.layer_ts_bb_coord_new[net_id],
+                                                           swap_ctx.ts_layer_sink_pin_count[size_t(net_id)]);
         }
 
-        bb_delta_c += proposed_net_cost[net_id] - net_cost[net_id];
+        bb_delta_c += cost_ctx.proposed_net_cost[net_id] - cost_ctx.net_cost[net_id];
     }
 
     return num_affected_nets;
@@ -2036,15 +2693,17 @@ static int find_affected_nets_and_update_costs(
 
 ///@brief Record effected nets.
 static void record_affected_net(const ClusterNetId net,
+                                std::vector<ClusterNetId>& nets_to_update,
                                 int& num_affected_nets) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
     /* Record effected nets. */
-    if (proposed_net_cost[net] < 0.) {
+    if (cost_ctx.proposed_net_cost[net] < 0.) {
         /* Net not marked yet. */
-        ts_nets_to_update[num_affected_nets] = net;
+        nets_to_update[num_affected_nets] = net;
         num_affected_nets++;
 
         /* Flag to say we've marked this net. */
-        proposed_net_cost[net] = 1.;
+        cost_ctx.proposed_net_cost[net] = 1.;
     }
 }
 
@@ -2059,15 +2718,17 @@ static void update_net_bb(const ClusterNetId net,
                           int iblk,
                           const ClusterBlockId blk,
                           const ClusterPinId blk_pin) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     if (cluster_ctx.clb_nlist.net_sinks(net).size() < SMALL_NET) {
         //For small nets brute-force bounding box update is faster
 
-        if (bb_updated_before[net] == NOT_UPDATED_YET) { //Only once per-net
+        if (cost_ctx.bb_updated_before[net] == NOT_UPDATED_YET) { //Only once per-net
             get_non_updateable_bb(net,
-                                  ts_bb_coord_new[net],
-                                  ts_layer_sink_pin_count[size_t(net)]);
+                                  swap_ctx.ts_bb_coord_new[net],
+                                  swap_ctx.ts_layer_sink_pin_count[size_t(net)]);
         }
     } else {
         //For large nets, update bounding box incrementally
@@ -2088,9 +2749,9 @@ static void update_net_bb(const ClusterNetId net,
             blocks_affected.moved_blocks[iblk].new_loc.y + pin_height_offset,
             blocks_affected.moved_blocks[iblk].new_loc.layer);
         update_bb(net,
-                  ts_bb_edge_new[net],
-                  ts_bb_coord_new[net],
-                  ts_layer_sink_pin_count[size_t(net)],
+                  swap_ctx.ts_bb_edge_new[net],
+                  swap_ctx.ts_bb_coord_new[net],
+                  swap_ctx.ts_layer_sink_pin_count[size_t(net)],
                   pin_old_loc,
                   pin_new_loc,
                   src_pin);
@@ -2102,15 +2763,17 @@ static void update_net_layer_bb(const ClusterNetId net,
                                 int iblk,
                                 const ClusterBlockId blk,
                                 const ClusterPinId blk_pin) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     if (cluster_ctx.clb_nlist.net_sinks(net).size() < SMALL_NET) {
         //For small nets brute-force bounding box update is faster
 
-        if (bb_updated_before[net] == NOT_UPDATED_YET) { //Only once per-net
+        if (cost_ctx.bb_updated_before[net] == NOT_UPDATED_YET) { //Only once per-net
             get_non_updateable_layer_bb(net,
-                                        layer_ts_bb_coord_new[net],
-                                        ts_layer_sink_pin_count[size_t(net)]);
+                                        swap_ctx.layer_ts_bb_coord_new[net],
+                                        swap_ctx.ts_layer_sink_pin_count[size_t(net)]);
         }
     } else {
         //For large nets, update bounding box incrementally
@@ -2129,14 +2792,14 @@ static void update_net_layer_bb(const ClusterNetId net,
             blocks_affected.moved_blocks[iblk].new_loc.x + pin_width_offset,
             blocks_affected.moved_blocks[iblk].new_loc.y + pin_height_offset,
             blocks_affected.moved_blocks[iblk].new_loc.layer);
-        auto pin_dir = get_pin_type_from_pin_physical_num(blk_type, iblk_pin);
+        bool src_pin = cluster_ctx.clb_nlist.pin_type(blk_pin) == PinType::DRIVER;
         update_layer_bb(net,
-                        layer_ts_bb_edge_new[net],
-                        layer_ts_bb_coord_new[net],
-                        ts_layer_sink_pin_count[size_t(net)],
+                        swap_ctx.layer_ts_bb_edge_new[net],
+                        swap_ctx.layer_ts_bb_coord_new[net],
+                        swap_ctx.ts_layer_sink_pin_count[size_t(net)],
                         pin_old_loc,
                         pin_new_loc,
-                        pin_dir == e_pin_type::DRIVER);
+                        src_pin);
     }
 }
 
@@ -2174,15 +2837,39 @@ static void update_td_delta_costs(const PlaceDelayModel* delay_model,
                                   const ClusterNetId net,
                                   const ClusterPinId pin,
                                   t_pl_blocks_to_be_moved& blocks_affected,
-                                  double& delta_timing_cost) {
+                                  double& delta_timing_cost,
+                                  bool use_sampled_connections) {
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
     const auto& connection_delay = g_placer_ctx.timing().connection_delay;
     auto& connection_timing_cost = g_placer_ctx.mutable_timing().connection_timing_cost;
     auto& proposed_connection_delay = g_placer_ctx.mutable_timing().proposed_connection_delay;
     auto& proposed_connection_timing_cost = g_placer_ctx.mutable_timing().proposed_connection_timing_cost;
+    const auto& sampled_sink_ipins = g_placer_ctx.timing().sampled_sink_ipins[net];
+
+    if (cluster_ctx.clb_nlist.pin_type(pin) == PinType::DRIVER
+        && use_sampled_connections && !sampled_sink_ipins.empty()) {
+        /* This pin drives a high-fanout net: only estimate the change from its  *
+         * sampled connections. The others are added by complete_sampled_td_costs *
+         * if the move is accepted.                                              */
+        for (int ipin : sampled_sink_ipins) {
+            float temp_delay = comp_td_single_connection_delay(delay_model, net,
+                                                               ipin);
+            if (temp_delay == connection_delay[net][ipin]) {
+                continue;
+            }
 
-    if (cluster_ctx.clb_nlist.pin_type(pin) == PinType::DRIVER) {
+            proposed_connection_delay[net][ipin] = temp_delay;
+
+            proposed_connection_timing_cost[net][ipin] = criticalities.criticality(net, ipin) * temp_delay;
+            delta_timing_cost += proposed_connection_timing_cost[net][ipin]
+                                 - connection_timing_cost[net][ipin];
+
+            ClusterPinId sink_pin = cluster_ctx.clb_nlist.net_pin(net, ipin);
+            blocks_affected.affected_pins.push_back(sink_pin);
+        }
+        blocks_affected.sampled_timing_nets.push_back(net);
+    } else if (cluster_ctx.clb_nlist.pin_type(pin) == PinType::DRIVER) {
         /* This pin is a net driver on a moved block. */
         /* Recompute all point to point connection delays for the net sinks. */
         for (size_t ipin = 1; ipin < cluster_ctx.clb_nlist.net_pins(net).size();
@@ -2209,29 +2896,125 @@ static void update_td_delta_costs(const PlaceDelayModel* delay_model,
         /* This pin is a net sink on a moved block */
         VTR_ASSERT_SAFE(cluster_ctx.clb_nlist.pin_type(pin) == PinType::SINK);
 
-        /* Check if this sink's net is driven by a moved block */
-        if (!driven_by_moved_block(net, blocks_affected)) {
-            /* Get the sink pin index in the net */
-            int ipin = cluster_ctx.clb_nlist.pin_net_index(pin);
+        /* Check if this sink's net is driven by a moved block */
+        if (!driven_by_moved_block(net, blocks_affected)) {
+            /* Get the sink pin index in the net */
+            int ipin = cluster_ctx.clb_nlist.pin_net_index(pin);
+
+            float temp_delay = comp_td_single_connection_delay(delay_model, net,
+                                                               ipin);
+            /* If the delay hasn't changed, do not mark this pin as affected */
+            if (temp_delay == connection_delay[net][ipin]) {
+                return;
+            }
+
+            /* Calculate proposed delay and cost values */
+            proposed_connection_delay[net][ipin] = temp_delay;
+
+            proposed_connection_timing_cost[net][ipin] = criticalities.criticality(net, ipin) * temp_delay;
+            delta_timing_cost += proposed_connection_timing_cost[net][ipin]
+                                 - connection_timing_cost[net][ipin];
+
+            /* Record this connection in blocks_affected.affected_pins */
+            blocks_affected.affected_pins.push_back(pin);
+        }
+    }
+}
+
+/**
+ * @brief Chooses the connections which stand in for each high-fanout net when
+ *        a move of the net's driver is evaluated (see update_td_delta_costs()).
+ *
+ * With --place_timing_sample_fanout, every net with at least that many sinks
+ * is represented by its place_timing_sample_size most critical connections.
+ * Called whenever the criticalities are recomputed, ties are broken by sink
+ * index so that the choice is deterministic.
+ */
+static void update_sampled_timing_connections(const t_placer_opts& placer_opts,
+                                              const PlacerCriticalities& criticalities) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& sampled_sink_ipins = g_placer_ctx.mutable_timing().sampled_sink_ipins;
+
+    const size_t sample_fanout = placer_opts.place_timing_sample_fanout;
+    const size_t sample_size = placer_opts.place_timing_sample_size;
+
+    for (ClusterNetId net_id : cluster_ctx.clb_nlist.nets()) {
+        std::vector<int>& ipins = sampled_sink_ipins[net_id];
+        size_t num_sinks = cluster_ctx.clb_nlist.net_sinks(net_id).size();
+
+        if (sample_fanout == 0 || num_sinks < sample_fanout || num_sinks <= sample_size
+            || cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+            ipins.clear();
+            continue;
+        }
+
+        ipins.resize(num_sinks);
+        std::iota(ipins.begin(), ipins.end(), 1);
+        std::nth_element(ipins.begin(), ipins.begin() + sample_size, ipins.end(),
+                         [&](int lhs, int rhs) {
+                             float lhs_crit = criticalities.criticality(net_id, lhs);
+                             float rhs_crit = criticalities.criticality(net_id, rhs);
+                             return lhs_crit > rhs_crit || (lhs_crit == rhs_crit && lhs < rhs);
+                         });
+        ipins.resize(sample_size);
+        std::sort(ipins.begin(), ipins.end());
+    }
+}
+
+/**
+ * @brief Completes the timing cost change of an accepted move, whose change for
+ *        the high-fanout nets it moved the driver of was only estimated from their
+ *        sampled connections.
+ *
+ * Computes the delays of the other connections of these nets, and records the
+ * ones which changed in blocks_affected.affected_pins, so that commit_td_cost()
+ * and the timing graph invalidation see every changed connection. The costs are
+ * then corrected by the timing cost change the sampled connections missed.
+ */
+static void complete_sampled_td_costs(const PlaceDelayModel* delay_model,
+                                      const PlacerCriticalities& criticalities,
+                                      float timing_tradeoff,
+                                      t_pl_blocks_to_be_moved& blocks_affected,
+                                      t_placer_costs* costs) {
+    if (blocks_affected.sampled_timing_nets.empty()) {
+        return;
+    }
+
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& p_timing_ctx = g_placer_ctx.mutable_timing();
+    const auto& connection_delay = p_timing_ctx.connection_delay;
+    auto& connection_timing_cost = p_timing_ctx.connection_timing_cost;
+    auto& proposed_connection_delay = p_timing_ctx.proposed_connection_delay;
+    auto& proposed_connection_timing_cost = p_timing_ctx.proposed_connection_timing_cost;
+
+    double missed_timing_delta_c = 0.;
+    for (ClusterNetId net : blocks_affected.sampled_timing_nets) {
+        const std::vector<int>& sampled_ipins = p_timing_ctx.sampled_sink_ipins[net];
+        auto next_sampled = sampled_ipins.begin();
 
-            float temp_delay = comp_td_single_connection_delay(delay_model, net,
-                                                               ipin);
-            /* If the delay hasn't changed, do not mark this pin as affected */
+        for (int ipin = 1; ipin < int(cluster_ctx.clb_nlist.net_pins(net).size()); ipin++) {
+            //The sampled connections are already accounted for
+            if (next_sampled != sampled_ipins.end() && *next_sampled == ipin) {
+                ++next_sampled;
+                continue;
+            }
+
+            float temp_delay = comp_td_single_connection_delay(delay_model, net, ipin);
             if (temp_delay == connection_delay[net][ipin]) {
-                return;
+                continue;
             }
 
-            /* Calculate proposed delay and cost values */
             proposed_connection_delay[net][ipin] = temp_delay;
-
             proposed_connection_timing_cost[net][ipin] = criticalities.criticality(net, ipin) * temp_delay;
-            delta_timing_cost += proposed_connection_timing_cost[net][ipin]
-                                 - connection_timing_cost[net][ipin];
+            missed_timing_delta_c += proposed_connection_timing_cost[net][ipin]
+                                     - connection_timing_cost[net][ipin];
 
-            /* Record this connection in blocks_affected.affected_pins */
-            blocks_affected.affected_pins.push_back(pin);
+            blocks_affected.affected_pins.push_back(cluster_ctx.clb_nlist.net_pin(net, ipin));
         }
     }
+
+    costs->timing_cost += missed_timing_delta_c;
+    costs->cost += timing_tradeoff * missed_timing_delta_c * costs->timing_cost_norm;
 }
 
 /**
@@ -2247,6 +3030,11 @@ static void update_td_delta_costs(const PlaceDelayModel* delay_model,
  * @param noc_opts Determines if placement includes the NoC
  */
 static void update_placement_cost_normalization_factors(t_placer_costs* costs, const t_placer_opts& placer_opts, const t_noc_opts& noc_opts) {
+    /* Refresh the congestion map the moves of the next temperature are priced against */
+    if (congestion_cost_enabled(placer_opts)) {
+        costs->congestion_cost = comp_congestion_cost();
+    }
+
     /* Update the cost normalization factors */
     costs->update_norm_factors();
 
@@ -2282,6 +3070,11 @@ static double get_total_cost(t_placer_costs* costs, const t_placer_opts& placer_
         total_cost = (1 - placer_opts.timing_tradeoff) * (costs->bb_cost * costs->bb_cost_norm) + (placer_opts.timing_tradeoff) * (costs->timing_cost * costs->timing_cost_norm);
     }
 
+    if (congestion_cost_enabled(placer_opts)) {
+        // the congestion cost is priced in wirelength units
+        total_cost += placer_opts.place_congestion_weight * costs->congestion_cost * costs->bb_cost_norm;
+    }
+
     if (noc_opts.noc) {
         // in noc mode we include noc aggregate bandwidth and noc latency
         total_cost += calculate_noc_cost(costs->noc_cost_terms, costs->noc_cost_norm_factors, noc_opts);
@@ -2372,6 +3165,7 @@ static e_move_result assess_swap(double delta_c, double t) {
 }
 
 static double recompute_bb_cost() {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
     /* Recomputes the cost to eliminate roundoff that may have accrued.  *
      * This routine does as little work as possible to compute this new  *
      * cost.                                                             */
@@ -2383,7 +3177,7 @@ static double recompute_bb_cost() {
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {       /* for each net ... */
         if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) { /* Do only if not ignored. */
             /* Bounding boxes don't have to be recomputed; they're correct. */
-            cost += net_cost[net_id];
+            cost += cost_ctx.net_cost[net_id];
         }
     }
 
@@ -2481,6 +3275,28 @@ static bool driven_by_moved_block(const ClusterNetId net,
     return false;
 }
 
+/* Calls net_fn(net_id) for each net which is not ignored. The calls may run *
+ * in parallel, so net_fn must only write the data of the net it is given.   */
+template<typename NetFn>
+static void for_each_unignored_net(const NetFn& net_fn) {
+    auto& clb_nlist = g_vpr_ctx.clustering().clb_nlist;
+
+    auto process_net = [&](size_t inet) {
+        ClusterNetId net_id(inet);
+        if (!clb_nlist.net_is_ignored(net_id)) {
+            net_fn(net_id);
+        }
+    };
+
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), clb_nlist.nets().size(), process_net);
+#else
+    for (size_t inet = 0; inet < clb_nlist.nets().size(); ++inet) {
+        process_net(inet);
+    }
+#endif
+}
+
 /* Finds the cost from scratch.  Done only when the placement   *
  * has been radically changed (i.e. after initial placement).   *
  * Otherwise find the cost change incrementally.  If method     *
@@ -2490,29 +3306,34 @@ static bool driven_by_moved_block(const ClusterNetId net,
  * cost which can be used to check the correctness of the       *
  * other routine.                                               */
 static double comp_bb_cost(e_cost_methods method) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
     double cost = 0;
     double expected_wirelength = 0.0;
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_move_ctx = g_placer_ctx.mutable_move();
 
+    for_each_unignored_net([&](ClusterNetId net_id) {
+        /* Small nets don't use incremental updating on their bounding boxes, *
+         * so they can use a fast bounding box calculator.                    */
+        if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET
+            && method == NORMAL) {
+            get_bb_from_scratch(net_id,
+                                place_move_ctx.bb_coords[net_id],
+                                place_move_ctx.bb_num_on_edges[net_id],
+                                place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
+        } else {
+            get_non_updateable_bb(net_id,
+                                  place_move_ctx.bb_coords[net_id],
+                                  place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
+        }
+
+        cost_ctx.net_cost[net_id] = get_net_cost(net_id, place_move_ctx.bb_coords[net_id]);
+    });
+
+    /* Summed in net order, so the cost does not depend on the number of threads */
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {       /* for each net ... */
         if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) { /* Do only if not ignored. */
-            /* Small nets don't use incremental updating on their bounding boxes, *
-             * so they can use a fast bounding box calculator.                    */
-            if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET
-                && method == NORMAL) {
-                get_bb_from_scratch(net_id,
-                                    place_move_ctx.bb_coords[net_id],
-                                    place_move_ctx.bb_num_on_edges[net_id],
-                                    place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
-            } else {
-                get_non_updateable_bb(net_id,
-                                      place_move_ctx.bb_coords[net_id],
-                                      place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
-            }
-
-            net_cost[net_id] = get_net_cost(net_id, place_move_ctx.bb_coords[net_id]);
-            cost += net_cost[net_id];
+            cost += cost_ctx.net_cost[net_id];
             if (method == CHECK)
                 expected_wirelength += get_net_wirelength_estimate(net_id, place_move_ctx.bb_coords[net_id]);
         }
@@ -2527,31 +3348,36 @@ static double comp_bb_cost(e_cost_methods method) {
 }
 
 static double comp_layer_bb_cost(e_cost_methods method) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
     double cost = 0;
     double expected_wirelength = 0.0;
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_move_ctx = g_placer_ctx.mutable_move();
 
+    for_each_unignored_net([&](ClusterNetId net_id) {
+        /* Small nets don't use incremental updating on their bounding boxes, *
+         * so they can use a fast bounding box calculator.                    */
+        if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET
+            && method == NORMAL) {
+            get_layer_bb_from_scratch(net_id,
+                                      place_move_ctx.layer_bb_num_on_edges[net_id],
+                                      place_move_ctx.layer_bb_coords[net_id],
+                                      place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
+        } else {
+            get_non_updateable_layer_bb(net_id,
+                                        place_move_ctx.layer_bb_coords[net_id],
+                                        place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
+        }
+
+        cost_ctx.net_cost[net_id] = get_net_layer_cost(net_id,
+                                                       place_move_ctx.layer_bb_coords[net_id],
+                                                       place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
+    });
+
+    /* Summed in net order, so the cost does not depend on the number of threads */
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {       /* for each net ... */
         if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) { /* Do only if not ignored. */
-            /* Small nets don't use incremental updating on their bounding boxes, *
-             * so they can use a fast bounding box calculator.                    */
-            if (cluster_ctx.clb_nlist.net_sinks(net_id).size() >= SMALL_NET
-                && method == NORMAL) {
-                get_layer_bb_from_scratch(net_id,
-                                          place_move_ctx.layer_bb_num_on_edges[net_id],
-                                          place_move_ctx.layer_bb_coords[net_id],
-                                          place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
-            } else {
-                get_non_updateable_layer_bb(net_id,
-                                            place_move_ctx.layer_bb_coords[net_id],
-                                            place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
-            }
-
-            net_cost[net_id] = get_net_layer_cost(net_id,
-                                                  place_move_ctx.layer_bb_coords[net_id],
-                                                  place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
-            cost += net_cost[net_id];
+            cost += cost_ctx.net_cost[net_id];
             if (method == CHECK)
                 expected_wirelength += get_net_layer_wirelength_estimate(net_id,
                                                                          place_move_ctx.layer_bb_coords[net_id],
@@ -2567,6 +3393,116 @@ static double comp_layer_bb_cost(e_cost_methods method) {
     return cost;
 }
 
+///@brief Is the RUDY congestion cost part of the placement cost?
+static bool congestion_cost_enabled(const t_placer_opts& placer_opts) {
+    return placer_opts.place_congestion_weight > 0. && g_vpr_ctx.placement().cube_bb;
+}
+
+///@brief The congestion map crossing count of a net, the same as its wirelength cost's.
+static double net_congestion_crossing(ClusterNetId net_id) {
+    return wirelength_crossing_count(g_vpr_ctx.clustering().clb_nlist.net_pins(net_id).size());
+}
+
+/**
+ * @brief Rebuilds the congestion map from the committed net bounding boxes and
+ *        updates its channel utilization.
+ *
+ * Rebuilding it (rather than only updating the utilization) also drops the round-off
+ * accumulated by the incremental moves of the nets.
+ */
+static void load_congestion_map() {
+    auto& congestion_map = g_placer_ctx.mutable_move().congestion_map;
+    const auto& place_move_ctx = g_placer_ctx.move();
+
+    const auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    //Serial: all the nets add to the same map
+    congestion_map.clear_demand();
+    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
+        if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+            congestion_map.add_net(place_move_ctx.bb_coords[net_id], net_congestion_crossing(net_id));
+        }
+    }
+
+    congestion_map.update_utilization();
+}
+
+/**
+ * @brief Refreshes the congestion map and returns the congestion cost of all the nets.
+ *
+ * The moves until the next call are priced against this utilization snapshot, so the
+ * cost of a net only changes with its own bounding box.
+ */
+static double comp_congestion_cost() {
+    load_congestion_map();
+
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
+    if (cost_ctx.net_congestion_cost.empty()) {
+        //Only the map is wanted (e.g. for reporting)
+        return 0.;
+    }
+    return recompute_congestion_cost();
+}
+
+///@brief Recomputes the congestion cost of all the nets from the current utilization snapshot.
+static double recompute_congestion_cost() {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
+    const auto& place_move_ctx = g_placer_ctx.move();
+    const auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    double cost = 0.;
+    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
+        if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+            continue;
+        }
+        cost_ctx.net_congestion_cost[net_id] = place_move_ctx.congestion_map.net_congestion_cost(place_move_ctx.bb_coords[net_id],
+                                                                                                 net_congestion_crossing(net_id));
+        cost += cost_ctx.net_congestion_cost[net_id];
+    }
+    return cost;
+}
+
+/**
+ * @brief Computes the congestion cost of the nets affected by the proposed move from their
+ *        proposed bounding boxes, and returns the change in the congestion cost.
+ */
+static double update_congestion_delta_costs(int num_nets_affected,
+                                            const std::vector<ClusterNetId>& nets_to_update) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
+    const auto& congestion_map = g_placer_ctx.move().congestion_map;
+    const auto& swap_ctx = g_placer_ctx.swap();
+
+    double congestion_delta_c = 0.;
+    for (int inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
+        ClusterNetId net_id = nets_to_update[inet_affected];
+        cost_ctx.proposed_net_congestion_cost[net_id] = congestion_map.net_congestion_cost(swap_ctx.ts_bb_coord_new[net_id],
+                                                                                           net_congestion_crossing(net_id));
+        congestion_delta_c += cost_ctx.proposed_net_congestion_cost[net_id] - cost_ctx.net_congestion_cost[net_id];
+    }
+    return congestion_delta_c;
+}
+
+/**
+ * @brief Moves the demand of the nets affected by an accepted move to their new bounding
+ *        boxes, and commits their congestion costs.
+ *
+ * Must be called before update_move_nets() replaces the committed bounding boxes.
+ */
+static void commit_congestion_costs(int num_nets_affected,
+                                    const std::vector<ClusterNetId>& nets_to_update) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
+    auto& place_move_ctx = g_placer_ctx.mutable_move();
+    const auto& swap_ctx = g_placer_ctx.swap();
+
+    for (int inet_affected = 0; inet_affected < num_nets_affected; inet_affected++) {
+        ClusterNetId net_id = nets_to_update[inet_affected];
+        double crossing = net_congestion_crossing(net_id);
+        place_move_ctx.congestion_map.remove_net(place_move_ctx.bb_coords[net_id], crossing);
+        place_move_ctx.congestion_map.add_net(swap_ctx.ts_bb_coord_new[net_id], crossing);
+        cost_ctx.net_congestion_cost[net_id] = cost_ctx.proposed_net_congestion_cost[net_id];
+    }
+}
+
 /* Allocates the major structures needed only by the placer, primarily for *
  * computing costs quickly and such.                                       */
 static void alloc_and_load_placement_structs(float place_cost_exp,
@@ -2574,6 +3510,8 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
                                              const t_noc_opts& noc_opts,
                                              t_direct_inf* directs,
                                              int num_directs) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
     int max_pins_per_clb;
     unsigned int ipin;
 
@@ -2614,6 +3552,7 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
         p_timing_ctx.proposed_connection_timing_cost = make_net_pins_matrix<
             double>(cluster_ctx.clb_nlist, 0.);
         p_timing_ctx.net_timing_cost.resize(num_nets, 0.);
+        p_timing_ctx.sampled_sink_ipins.resize(num_nets);
 
         for (auto net_id : cluster_ctx.clb_nlist.nets()) {
             for (ipin = 1; ipin < cluster_ctx.clb_nlist.net_pins(net_id).size();
@@ -2631,8 +3570,9 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
         }
     }
 
-    net_cost.resize(num_nets, -1.);
-    proposed_net_cost.resize(num_nets, -1.);
+    vtr::Arena& arena = place_ctx.stage_arena;
+    cost_ctx.net_cost = decltype(cost_ctx.net_cost)(num_nets, -1., vtr::arena_allocator<double>(arena));
+    cost_ctx.proposed_net_cost = decltype(cost_ctx.proposed_net_cost)(num_nets, -1., vtr::arena_allocator<double>(arena));
 
     if (cube_bb) {
         place_move_ctx.bb_coords.resize(num_nets, t_bb());
@@ -2644,30 +3584,42 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
     }
 
     place_move_ctx.num_sink_pin_layer.resize({num_nets, size_t(num_layers)});
-    for (size_t flat_idx = 0; flat_idx < ts_layer_sink_pin_count.size(); flat_idx++) {
-        auto& elem = ts_layer_sink_pin_count.get(flat_idx);
+    for (size_t flat_idx = 0; flat_idx < swap_ctx.ts_layer_sink_pin_count.size(); flat_idx++) {
+        auto& elem = swap_ctx.ts_layer_sink_pin_count.get(flat_idx);
         elem = OPEN;
     }
 
     /* Used to store costs for moves not yet made and to indicate when a net's   *
      * cost has been recomputed. proposed_net_cost[inet] < 0 means net's cost hasn't *
      * been recomputed.                                                          */
-    bb_updated_before.resize(num_nets, NOT_UPDATED_YET);
+    cost_ctx.bb_updated_before = decltype(cost_ctx.bb_updated_before)(num_nets, NOT_UPDATED_YET, vtr::arena_allocator<char>(arena));
+
+    if (congestion_cost_enabled(placer_opts)) {
+        place_move_ctx.congestion_map.init(device_ctx.grid, device_ctx.chan_width);
+        cost_ctx.net_congestion_cost = decltype(cost_ctx.net_congestion_cost)(num_nets, 0., vtr::arena_allocator<double>(arena));
+        cost_ctx.proposed_net_congestion_cost = decltype(cost_ctx.proposed_net_congestion_cost)(num_nets, 0., vtr::arena_allocator<double>(arena));
+    }
 
     alloc_and_load_for_fast_cost_update(place_cost_exp);
 
     alloc_and_load_try_swap_structs(cube_bb);
 
+    if (can_batch_moves(placer_opts, noc_opts, placer_opts.place_algorithm)
+        || can_batch_moves(placer_opts, noc_opts, placer_opts.place_quench_algorithm)) {
+        alloc_and_load_batched_moves(placer_opts.place_parallel_moves);
+    }
+
     place_ctx.pl_macros = alloc_and_load_placement_macros(directs, num_directs);
 
     if (noc_opts.noc) {
-        allocate_and_load_noc_placement_structs();
+        allocate_and_load_noc_placement_structs(noc_opts.noc_enforce_deadlock_freedom);
     }
 }
 
 /* Frees the major structures needed by the placer (and not needed       *
  * elsewhere).   */
 static void free_placement_structs(const t_placer_opts& placer_opts, const t_noc_opts& noc_opts) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
     auto& place_move_ctx = g_placer_ctx.mutable_move();
 
     if (placer_opts.place_algorithm.is_timing_driven()) {
@@ -2679,12 +3631,13 @@ static void free_placement_structs(const t_placer_opts& placer_opts, const t_noc
         vtr::release_memory(p_timing_ctx.proposed_connection_timing_cost);
         vtr::release_memory(p_timing_ctx.proposed_connection_delay);
         vtr::release_memory(p_timing_ctx.net_timing_cost);
+        vtr::release_memory(p_timing_ctx.sampled_sink_ipins);
     }
 
     free_placement_macros_structs();
 
-    vtr::release_memory(net_cost);
-    vtr::release_memory(proposed_net_cost);
+    vtr::release_memory(cost_ctx.net_cost);
+    vtr::release_memory(cost_ctx.proposed_net_cost);
     vtr::release_memory(place_move_ctx.bb_num_on_edges);
     vtr::release_memory(place_move_ctx.bb_coords);
 
@@ -2693,10 +3646,20 @@ static void free_placement_structs(const t_placer_opts& placer_opts, const t_noc
 
     place_move_ctx.num_sink_pin_layer.clear();
 
-    vtr::release_memory(bb_updated_before);
+    vtr::release_memory(place_move_ctx.sink_pin_coords);
+    vtr::release_memory(place_move_ctx.net_sink_coord_sums);
+
+    vtr::release_memory(cost_ctx.bb_updated_before);
+
+    place_move_ctx.congestion_map.clear();
+    vtr::release_memory(cost_ctx.net_congestion_cost);
+    vtr::release_memory(cost_ctx.proposed_net_congestion_cost);
 
     free_fast_cost_update();
 
+    //All the users of the placement stage arena have been freed
+    g_vpr_ctx.mutable_placement().stage_arena.release();
+
     free_try_swap_structs();
 
     if (noc_opts.noc) {
@@ -2705,6 +3668,7 @@ static void free_placement_structs(const t_placer_opts& placer_opts, const t_noc
 }
 
 static void alloc_and_load_try_swap_structs(const bool cube_bb) {
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
     /* Allocate the local bb_coordinate storage, etc. only once. */
     /* Allocate with size cluster_ctx.clb_nlist.nets().size() for any number of nets affected. */
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -2714,36 +3678,60 @@ static void alloc_and_load_try_swap_structs(const bool cube_bb) {
     const int num_layers = g_vpr_ctx.device().grid.get_num_layers();
 
     if (cube_bb) {
-        ts_bb_edge_new.resize(num_nets, t_bb());
-        ts_bb_coord_new.resize(num_nets, t_bb());
+        swap_ctx.ts_bb_edge_new.resize(num_nets, t_bb());
+        swap_ctx.ts_bb_coord_new.resize(num_nets, t_bb());
     } else {
         VTR_ASSERT_SAFE(!cube_bb);
-        layer_ts_bb_edge_new.resize(num_nets, std::vector<t_2D_bb>(num_layers, t_2D_bb()));
-        layer_ts_bb_coord_new.resize(num_nets, std::vector<t_2D_bb>(num_layers, t_2D_bb()));
+        swap_ctx.layer_ts_bb_edge_new.resize(num_nets, std::vector<t_2D_bb>(num_layers, t_2D_bb()));
+        swap_ctx.layer_ts_bb_coord_new.resize(num_nets, std::vector<t_2D_bb>(num_layers, t_2D_bb()));
     }
 
-    ts_layer_sink_pin_count.resize({num_nets, size_t(num_layers)});
-    for (size_t flat_idx = 0; flat_idx < ts_layer_sink_pin_count.size(); flat_idx++) {
-        auto& elem = ts_layer_sink_pin_count.get(flat_idx);
+    swap_ctx.ts_layer_sink_pin_count.resize({num_nets, size_t(num_layers)});
+    for (size_t flat_idx = 0; flat_idx < swap_ctx.ts_layer_sink_pin_count.size(); flat_idx++) {
+        auto& elem = swap_ctx.ts_layer_sink_pin_count.get(flat_idx);
         elem = OPEN;
     }
 
-    ts_nets_to_update.resize(num_nets, ClusterNetId::INVALID());
+    swap_ctx.ts_nets_to_update.resize(num_nets, ClusterNetId::INVALID());
 
     auto& place_ctx = g_vpr_ctx.mutable_placement();
     place_ctx.compressed_block_grids = create_compressed_block_grids();
 }
 
 static void free_try_swap_structs() {
-    vtr::release_memory(ts_bb_edge_new);
-    vtr::release_memory(ts_bb_coord_new);
-    vtr::release_memory(layer_ts_bb_edge_new);
-    vtr::release_memory(layer_ts_bb_coord_new);
-    ts_layer_sink_pin_count.clear();
-    vtr::release_memory(ts_nets_to_update);
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
+    vtr::release_memory(swap_ctx.ts_bb_edge_new);
+    vtr::release_memory(swap_ctx.ts_bb_coord_new);
+    vtr::release_memory(swap_ctx.layer_ts_bb_edge_new);
+    vtr::release_memory(swap_ctx.layer_ts_bb_coord_new);
+    swap_ctx.ts_layer_sink_pin_count.clear();
+    vtr::release_memory(swap_ctx.ts_nets_to_update);
+
+    vtr::release_memory(swap_ctx.batched_moves);
+    swap_ctx.has_deferred_move = false;
+    vtr::release_memory(swap_ctx.block_batch_stamp);
+    vtr::release_memory(swap_ctx.net_batch_stamp);
+    swap_ctx.batch_locs.clear();
 
     auto& place_ctx = g_vpr_ctx.mutable_placement();
     vtr::release_memory(place_ctx.compressed_block_grids);
+    vtr::release_memory(place_ctx.compressed_legal_sites);
+    vtr::release_memory(place_ctx.cluster_legal_sites_ids);
+}
+
+static void alloc_and_load_batched_moves(int num_parallel_moves) {
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    // Most moves touch a handful of blocks; record_block_move() grows the list for larger ones
+    constexpr size_t INITIAL_MAX_BLOCKS = 8;
+    swap_ctx.batched_moves.clear();
+    swap_ctx.batched_moves.resize(num_parallel_moves + 1, t_batched_move(INITIAL_MAX_BLOCKS));
+    swap_ctx.has_deferred_move = false;
+
+    swap_ctx.block_batch_stamp.resize(cluster_ctx.clb_nlist.blocks().size(), 0);
+    swap_ctx.net_batch_stamp.resize(cluster_ctx.clb_nlist.nets().size(), 0);
+    swap_ctx.batch_stamp = 0;
 }
 
 /* This routine finds the bounding box of each net from scratch (i.e.   *
@@ -2885,16 +3873,6 @@ static void get_layer_bb_from_scratch(ClusterNetId net_id,
                                       vtr::NdMatrixProxy<int, 1> layer_pin_sink_count) {
     auto& device_ctx = g_vpr_ctx.device();
     const int num_layers = device_ctx.grid.get_num_layers();
-    std::vector<int> xmin(num_layers, OPEN);
-    std::vector<int> xmax(num_layers, OPEN);
-    std::vector<int> ymin(num_layers, OPEN);
-    std::vector<int> ymax(num_layers, OPEN);
-    std::vector<int> xmin_edge(num_layers, OPEN);
-    std::vector<int> xmax_edge(num_layers, OPEN);
-    std::vector<int> ymin_edge(num_layers, OPEN);
-    std::vector<int> ymax_edge(num_layers, OPEN);
-
-    std::vector<int> num_sink_pin_layer(num_layers, 0);
 
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_ctx = g_vpr_ctx.placement();
@@ -2911,15 +3889,20 @@ static void get_layer_bb_from_scratch(ClusterNetId net_id,
     x_src = max(min<int>(x_src, grid.width() - 2), 1);
     y_src = max(min<int>(y_src, grid.height() - 2), 1);
 
+    /* The per-layer boxes are built in place in coords and num_on_edges, so this *
+     * runs without allocating on every move that shrinks a net's box.          */
     for (int layer_num = 0; layer_num < num_layers; layer_num++) {
-        xmin[layer_num] = x_src;
-        ymin[layer_num] = y_src;
-        xmax[layer_num] = x_src;
-        ymax[layer_num] = y_src;
-        xmin_edge[layer_num] = 1;
-        ymin_edge[layer_num] = 1;
-        xmax_edge[layer_num] = 1;
-        ymax_edge[layer_num] = 1;
+        layer_pin_sink_count[layer_num] = 0;
+        coords[layer_num].xmin = x_src;
+        coords[layer_num].ymin = y_src;
+        coords[layer_num].xmax = x_src;
+        coords[layer_num].ymax = y_src;
+        coords[layer_num].layer_num = layer_num;
+        num_on_edges[layer_num].xmin = 1;
+        num_on_edges[layer_num].ymin = 1;
+        num_on_edges[layer_num].xmax = 1;
+        num_on_edges[layer_num].ymax = 1;
+        num_on_edges[layer_num].layer_num = layer_num;
     }
 
     for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
@@ -2927,7 +3910,7 @@ static void get_layer_bb_from_scratch(ClusterNetId net_id,
         int pnum = tile_pin_index(pin_id);
         int layer = place_ctx.block_locs[bnum].loc.layer;
         VTR_ASSERT(layer >= 0 && layer < num_layers);
-        num_sink_pin_layer[layer]++;
+        layer_pin_sink_count[layer]++;
         int x = place_ctx.block_locs[bnum].loc.x
                 + physical_tile_type(bnum)->pin_width_offset[pnum];
         int y = place_ctx.block_locs[bnum].loc.y
@@ -2943,49 +3926,35 @@ static void get_layer_bb_from_scratch(ClusterNetId net_id,
         x = max(min<int>(x, grid.width() - 2), 1);  //-2 for no perim channels
         y = max(min<int>(y, grid.height() - 2), 1); //-2 for no perim channels
 
-        if (x == xmin[layer]) {
-            xmin_edge[layer]++;
+        t_2D_bb& layer_coords = coords[layer];
+        t_2D_bb& layer_edges = num_on_edges[layer];
+
+        if (x == layer_coords.xmin) {
+            layer_edges.xmin++;
         }
-        if (x == xmax[layer]) { /* Recall that xmin could equal xmax -- don't use else */
-            xmax_edge[layer]++;
-        } else if (x < xmin[layer]) {
-            xmin[layer] = x;
-            xmin_edge[layer] = 1;
-        } else if (x > xmax[layer]) {
-            xmax[layer] = x;
-            xmax_edge[layer] = 1;
+        if (x == layer_coords.xmax) { /* Recall that xmin could equal xmax -- don't use else */
+            layer_edges.xmax++;
+        } else if (x < layer_coords.xmin) {
+            layer_coords.xmin = x;
+            layer_edges.xmin = 1;
+        } else if (x > layer_coords.xmax) {
+            layer_coords.xmax = x;
+            layer_edges.xmax = 1;
         }
 
-        if (y == ymin[layer]) {
-            ymin_edge[layer]++;
+        if (y == layer_coords.ymin) {
+            layer_edges.ymin++;
         }
-        if (y == ymax[layer]) {
-            ymax_edge[layer]++;
-        } else if (y < ymin[layer]) {
-            ymin[layer] = y;
-            ymin_edge[layer] = 1;
-        } else if (y > ymax[layer]) {
-            ymax[layer] = y;
-            ymax_edge[layer] = 1;
+        if (y == layer_coords.ymax) {
+            layer_edges.ymax++;
+        } else if (y < layer_coords.ymin) {
+            layer_coords.ymin = y;
+            layer_edges.ymin = 1;
+        } else if (y > layer_coords.ymax) {
+            layer_coords.ymax = y;
+            layer_edges.ymax = 1;
         }
     }
-
-    /* Copy the coordinates and number on edges information into the proper   *
-     * structures.                                                            */
-    for (int layer_num = 0; layer_num < num_layers; layer_num++) {
-        layer_pin_sink_count[layer_num] = num_sink_pin_layer[layer_num];
-        coords[layer_num].xmin = xmin[layer_num];
-        coords[layer_num].xmax = xmax[layer_num];
-        coords[layer_num].ymin = ymin[layer_num];
-        coords[layer_num].ymax = ymax[layer_num];
-        coords[layer_num].layer_num = layer_num;
-
-        num_on_edges[layer_num].xmin = xmin_edge[layer_num];
-        num_on_edges[layer_num].xmax = xmax_edge[layer_num];
-        num_on_edges[layer_num].ymin = ymin_edge[layer_num];
-        num_on_edges[layer_num].ymax = ymax_edge[layer_num];
-        num_on_edges[layer_num].layer_num = layer_num;
-    }
 }
 
 static double wirelength_crossing_count(size_t fanout) {
@@ -3061,6 +4030,7 @@ static double get_net_cost(ClusterNetId net_id, const t_bb& bbptr) {
 
     double ncost, crossing;
     auto& cluster_ctx = g_vpr_ctx.clustering();
+    const auto& cost_ctx = g_placer_ctx.cost();
 
     crossing = wirelength_crossing_count(
         cluster_ctx.clb_nlist.net_pins(net_id).size());
@@ -3073,10 +4043,10 @@ static double get_net_cost(ClusterNetId net_id, const t_bb& bbptr) {
      * channel capacity.   Do this for x, then y direction and add.  */
 
     ncost = (bbptr.xmax - bbptr.xmin + 1) * crossing
-            * chanx_place_cost_fac[bbptr.ymax][bbptr.ymin - 1];
+            * cost_ctx.chanx_place_cost_fac[bbptr.ymax][bbptr.ymin - 1];
 
     ncost += (bbptr.ymax - bbptr.ymin + 1) * crossing
-             * chany_place_cost_fac[bbptr.xmax][bbptr.xmin - 1];
+             * cost_ctx.chany_place_cost_fac[bbptr.xmax][bbptr.xmin - 1];
 
     return (ncost);
 }
@@ -3090,6 +4060,7 @@ static double get_net_layer_cost(ClusterNetId /* net_id */,
     double ncost = 0.;
     double crossing = 0.;
     int num_layers = g_vpr_ctx.device().grid.get_num_layers();
+    const auto& cost_ctx = g_placer_ctx.cost();
 
     for (int layer_num = 0; layer_num < num_layers; layer_num++) {
         VTR_ASSERT(layer_pin_sink_count[layer_num] != OPEN);
@@ -3106,10 +4077,10 @@ static double get_net_layer_cost(ClusterNetId /* net_id */,
          * channel capacity.   Do this for x, then y direction and add.  */
 
         ncost += (bbptr[layer_num].xmax - bbptr[layer_num].xmin + 1) * crossing
-                 * chanx_place_cost_fac[bbptr[layer_num].ymax][bbptr[layer_num].ymin - 1];
+                 * cost_ctx.chanx_place_cost_fac[bbptr[layer_num].ymax][bbptr[layer_num].ymin - 1];
 
         ncost += (bbptr[layer_num].ymax - bbptr[layer_num].ymin + 1) * crossing
-                 * chany_place_cost_fac[bbptr[layer_num].xmax][bbptr[layer_num].xmin - 1];
+                 * cost_ctx.chany_place_cost_fac[bbptr[layer_num].xmax][bbptr[layer_num].xmin - 1];
     }
 
     return (ncost);
@@ -3207,9 +4178,6 @@ static void get_non_updateable_layer_bb(ClusterNetId net_id,
 
     auto& device_ctx = g_vpr_ctx.device();
     int num_layers = device_ctx.grid.get_num_layers();
-    for (int layer_num = 0; layer_num < device_ctx.grid.get_num_layers(); layer_num++) {
-        num_sink_layer[layer_num] = 0;
-    }
 
     int pnum;
 
@@ -3224,10 +4192,15 @@ static void get_non_updateable_layer_bb(ClusterNetId net_id,
     int src_y = place_ctx.block_locs[bnum].loc.y
                 + physical_tile_type(bnum)->pin_height_offset[pnum];
 
-    std::vector<int> xmin(num_layers, src_x);
-    std::vector<int> ymin(num_layers, src_y);
-    std::vector<int> xmax(num_layers, src_x);
-    std::vector<int> ymax(num_layers, src_y);
+    /* Built in place in bb_coord_new: this runs for every small net touched by *
+     * every move, so it must not allocate.                                     */
+    for (int layer_num = 0; layer_num < num_layers; layer_num++) {
+        num_sink_layer[layer_num] = 0;
+        bb_coord_new[layer_num].xmin = src_x;
+        bb_coord_new[layer_num].ymin = src_y;
+        bb_coord_new[layer_num].xmax = src_x;
+        bb_coord_new[layer_num].ymax = src_y;
+    }
 
     for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
         bnum = cluster_ctx.clb_nlist.pin_block(pin_id);
@@ -3239,16 +4212,18 @@ static void get_non_updateable_layer_bb(ClusterNetId net_id,
 
         int layer_num = place_ctx.block_locs[bnum].loc.layer;
         num_sink_layer[layer_num]++;
-        if (x < xmin[layer_num]) {
-            xmin[layer_num] = x;
-        } else if (x > xmax[layer_num]) {
-            xmax[layer_num] = x;
+
+        t_2D_bb& layer_bb = bb_coord_new[layer_num];
+        if (x < layer_bb.xmin) {
+            layer_bb.xmin = x;
+        } else if (x > layer_bb.xmax) {
+            layer_bb.xmax = x;
         }
 
-        if (y < ymin[layer_num]) {
-            ymin[layer_num] = y;
-        } else if (y > ymax[layer_num]) {
-            ymax[layer_num] = y;
+        if (y < layer_bb.ymin) {
+            layer_bb.ymin = y;
+        } else if (y > layer_bb.ymax) {
+            layer_bb.ymax = y;
         }
     }
 
@@ -3261,10 +4236,10 @@ static void get_non_updateable_layer_bb(ClusterNetId net_id,
      * is 0).  See route_common.cpp for a channel diagram.               */
     for (int layer_num = 0; layer_num < num_layers; layer_num++) {
         bb_coord_new[layer_num].layer_num = layer_num;
-        bb_coord_new[layer_num].xmin = max(min<int>(xmin[layer_num], device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
-        bb_coord_new[layer_num].ymin = max(min<int>(ymin[layer_num], device_ctx.grid.height() - 2), 1); //-2 for no perim channels
-        bb_coord_new[layer_num].xmax = max(min<int>(xmax[layer_num], device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
-        bb_coord_new[layer_num].ymax = max(min<int>(ymax[layer_num], device_ctx.grid.height() - 2), 1); //-2 for no perim channels
+        bb_coord_new[layer_num].xmin = max(min<int>(bb_coord_new[layer_num].xmin, device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
+        bb_coord_new[layer_num].ymin = max(min<int>(bb_coord_new[layer_num].ymin, device_ctx.grid.height() - 2), 1); //-2 for no perim channels
+        bb_coord_new[layer_num].xmax = max(min<int>(bb_coord_new[layer_num].xmax, device_ctx.grid.width() - 2), 1);  //-2 for no perim channels
+        bb_coord_new[layer_num].ymax = max(min<int>(bb_coord_new[layer_num].ymax, device_ctx.grid.height() - 2), 1); //-2 for no perim channels
     }
 }
 
@@ -3275,6 +4250,7 @@ static void update_bb(ClusterNetId net_id,
                       t_physical_tile_loc pin_old_loc,
                       t_physical_tile_loc pin_new_loc,
                       bool src_pin) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
     /* Updates the bounding box of a net by storing its coordinates in    *
      * the bb_coord_new data structure and the number of blocks on each   *
      * edge in the bb_edge_new data structure.  This routine should only  *
@@ -3303,18 +4279,18 @@ static void update_bb(ClusterNetId net_id,
     pin_old_loc.layer_num = max(min<int>(pin_old_loc.layer_num, device_ctx.grid.get_num_layers() - 1), 0);
 
     /* Check if the net had been updated before. */
-    if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+    if (cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
         /* The net had been updated from scratch, DO NOT update again! */
         return;
     }
 
-    vtr::NdMatrixProxy<int, 1> curr_num_sink_pin_layer = (bb_updated_before[net_id] == NOT_UPDATED_YET) ? place_move_ctx.num_sink_pin_layer[size_t(net_id)] : num_sink_pin_layer_new;
+    vtr::NdMatrixProxy<int, 1> curr_num_sink_pin_layer = (cost_ctx.bb_updated_before[net_id] == NOT_UPDATED_YET) ? place_move_ctx.num_sink_pin_layer[size_t(net_id)] : num_sink_pin_layer_new;
 
-    if (bb_updated_before[net_id] == NOT_UPDATED_YET) {
+    if (cost_ctx.bb_updated_before[net_id] == NOT_UPDATED_YET) {
         /* The net had NOT been updated before, could use the old values */
         curr_bb_edge = &place_move_ctx.bb_num_on_edges[net_id];
         curr_bb_coord = &place_move_ctx.bb_coords[net_id];
-        bb_updated_before[net_id] = UPDATED_ONCE;
+        cost_ctx.bb_updated_before[net_id] = UPDATED_ONCE;
     } else {
         /* The net had been updated before, must use the new values */
         curr_bb_coord = &bb_coord_new;
@@ -3330,7 +4306,7 @@ static void update_bb(ClusterNetId net_id,
         if (pin_old_loc.x == curr_bb_coord->xmax) { /* Old position at xmax. */
             if (curr_bb_edge->xmax == 1) {
                 get_bb_from_scratch(net_id, bb_coord_new, bb_edge_new, num_sink_pin_layer_new);
-                bb_updated_before[net_id] = GOT_FROM_SCRATCH;
+                cost_ctx.bb_updated_before[net_id] = GOT_FROM_SCRATCH;
                 return;
             } else {
                 bb_edge_new.xmax = curr_bb_edge->xmax - 1;
@@ -3362,7 +4338,7 @@ static void update_bb(ClusterNetId net_id,
         if (pin_old_loc.x == curr_bb_coord->xmin) { /* Old position at xmin. */
             if (curr_bb_edge->xmin == 1) {
                 get_bb_from_scratch(net_id, bb_coord_new, bb_edge_new, num_sink_pin_layer_new);
-                bb_updated_before[net_id] = GOT_FROM_SCRATCH;
+                cost_ctx.bb_updated_before[net_id] = GOT_FROM_SCRATCH;
                 return;
             } else {
                 bb_edge_new.xmin = curr_bb_edge->xmin - 1;
@@ -3403,7 +4379,7 @@ static void update_bb(ClusterNetId net_id,
         if (pin_old_loc.y == curr_bb_coord->ymax) { /* Old position at ymax. */
             if (curr_bb_edge->ymax == 1) {
                 get_bb_from_scratch(net_id, bb_coord_new, bb_edge_new, num_sink_pin_layer_new);
-                bb_updated_before[net_id] = GOT_FROM_SCRATCH;
+                cost_ctx.bb_updated_before[net_id] = GOT_FROM_SCRATCH;
                 return;
             } else {
                 bb_edge_new.ymax = curr_bb_edge->ymax - 1;
@@ -3435,7 +4411,7 @@ static void update_bb(ClusterNetId net_id,
         if (pin_old_loc.y == curr_bb_coord->ymin) { /* Old position at ymin. */
             if (curr_bb_edge->ymin == 1) {
                 get_bb_from_scratch(net_id, bb_coord_new, bb_edge_new, num_sink_pin_layer_new);
-                bb_updated_before[net_id] = GOT_FROM_SCRATCH;
+                cost_ctx.bb_updated_before[net_id] = GOT_FROM_SCRATCH;
                 return;
             } else {
                 bb_edge_new.ymin = curr_bb_edge->ymin - 1;
@@ -3485,7 +4461,7 @@ static void update_bb(ClusterNetId net_id,
             if (pin_old_loc.layer_num == curr_bb_coord->layer_max) {
                 if (curr_bb_edge->layer_max == 1) {
                     get_bb_from_scratch(net_id, bb_coord_new, bb_edge_new, num_sink_pin_layer_new);
-                    bb_updated_before[net_id] = GOT_FROM_SCRATCH;
+                    cost_ctx.bb_updated_before[net_id] = GOT_FROM_SCRATCH;
                     return;
                 } else {
                     bb_edge_new.layer_max = curr_bb_edge->layer_max - 1;
@@ -3514,7 +4490,7 @@ static void update_bb(ClusterNetId net_id,
             if (pin_old_loc.layer_num == curr_bb_coord->layer_min) {
                 if (curr_bb_edge->layer_min == 1) {
                     get_bb_from_scratch(net_id, bb_coord_new, bb_edge_new, num_sink_pin_layer_new);
-                    bb_updated_before[net_id] = GOT_FROM_SCRATCH;
+                    cost_ctx.bb_updated_before[net_id] = GOT_FROM_SCRATCH;
                     return;
                 } else {
                     bb_edge_new.layer_min = curr_bb_edge->layer_min - 1;
@@ -3551,8 +4527,8 @@ static void update_bb(ClusterNetId net_id,
         bb_edge_new.layer_max = curr_bb_edge->layer_max;
     }
 
-    if (bb_updated_before[net_id] == NOT_UPDATED_YET) {
-        bb_updated_before[net_id] = UPDATED_ONCE;
+    if (cost_ctx.bb_updated_before[net_id] == NOT_UPDATED_YET) {
+        cost_ctx.bb_updated_before[net_id] = UPDATED_ONCE;
     }
 }
 
@@ -3563,6 +4539,7 @@ static void update_layer_bb(ClusterNetId net_id,
                             t_physical_tile_loc pin_old_loc,
                             t_physical_tile_loc pin_new_loc,
                             bool is_output_pin) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
     /* Updates the bounding box of a net by storing its coordinates in    *
      * the bb_coord_new data structure and the number of blocks on each   *
      * edge in the bb_edge_new data structure.  This routine should only  *
@@ -3587,18 +4564,18 @@ static void update_layer_bb(ClusterNetId net_id,
     pin_old_loc.y = max(min<int>(pin_old_loc.y, device_ctx.grid.height() - 2), 1); //-2 for no perim channels
 
     /* Check if the net had been updated before. */
-    if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+    if (cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
         /* The net had been updated from scratch, DO NOT update again! */
         return;
     }
 
-    const vtr::NdMatrixProxy<int, 1> curr_layer_pin_sink_count = (bb_updated_before[net_id] == NOT_UPDATED_YET) ? place_move_ctx.num_sink_pin_layer[size_t(net_id)] : bb_pin_sink_count_new;
+    const vtr::NdMatrixProxy<int, 1> curr_layer_pin_sink_count = (cost_ctx.bb_updated_before[net_id] == NOT_UPDATED_YET) ? place_move_ctx.num_sink_pin_layer[size_t(net_id)] : bb_pin_sink_count_new;
 
-    if (bb_updated_before[net_id] == NOT_UPDATED_YET) {
+    if (cost_ctx.bb_updated_before[net_id] == NOT_UPDATED_YET) {
         /* The net had NOT been updated before, could use the old values */
         curr_bb_edge = &place_move_ctx.layer_bb_num_on_edges[net_id];
         curr_bb_coord = &place_move_ctx.layer_bb_coords[net_id];
-        bb_updated_before[net_id] = UPDATED_ONCE;
+        cost_ctx.bb_updated_before[net_id] = UPDATED_ONCE;
     } else {
         /* The net had been updated before, must use the new values */
         curr_bb_edge = &bb_edge_new;
@@ -3641,8 +4618,8 @@ static void update_layer_bb(ClusterNetId net_id,
                              bb_coord_new);
     }
 
-    if (bb_updated_before[net_id] == NOT_UPDATED_YET) {
-        bb_updated_before[net_id] = UPDATED_ONCE;
+    if (cost_ctx.bb_updated_before[net_id] == NOT_UPDATED_YET) {
+        cost_ctx.bb_updated_before[net_id] = UPDATED_ONCE;
     }
 }
 
@@ -3654,6 +4631,7 @@ static inline void update_bb_same_layer(ClusterNetId net_id,
                                         vtr::NdMatrixProxy<int, 1> bb_pin_sink_count_new,
                                         std::vector<t_2D_bb>& bb_edge_new,
                                         std::vector<t_2D_bb>& bb_coord_new) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
     int x_old = pin_old_loc.x;
     int x_new = pin_new_loc.x;
 
@@ -3673,7 +4651,7 @@ static inline void update_bb_same_layer(ClusterNetId net_id,
                            curr_bb_coord[layer_num].xmax,
                            bb_edge_new[layer_num].xmax,
                            bb_coord_new[layer_num].xmax);
-            if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+            if (cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
                 return;
             }
         }
@@ -3696,7 +4674,7 @@ static inline void update_bb_same_layer(ClusterNetId net_id,
                            curr_bb_coord[layer_num].xmin,
                            bb_edge_new[layer_num].xmin,
                            bb_coord_new[layer_num].xmin);
-            if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+            if (cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
                 return;
             }
         }
@@ -3720,7 +4698,7 @@ static inline void update_bb_same_layer(ClusterNetId net_id,
                            curr_bb_coord[layer_num].ymax,
                            bb_edge_new[layer_num].ymax,
                            bb_coord_new[layer_num].ymax);
-            if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+            if (cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
                 return;
             }
         }
@@ -3743,7 +4721,7 @@ static inline void update_bb_same_layer(ClusterNetId net_id,
                            curr_bb_coord[layer_num].ymin,
                            bb_edge_new[layer_num].ymin,
                            bb_coord_new[layer_num].ymin);
-            if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+            if (cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
                 return;
             }
         }
@@ -3766,6 +4744,7 @@ static inline void update_bb_layer_changed(ClusterNetId net_id,
                                            vtr::NdMatrixProxy<int, 1> bb_pin_sink_count_new,
                                            std::vector<t_2D_bb>& bb_edge_new,
                                            std::vector<t_2D_bb>& bb_coord_new) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
     int x_old = pin_old_loc.x;
 
     int y_old = pin_old_loc.y;
@@ -3783,7 +4762,7 @@ static inline void update_bb_layer_changed(ClusterNetId net_id,
                        curr_bb_coord[old_layer_num].xmax,
                        bb_edge_new[old_layer_num].xmax,
                        bb_coord_new[old_layer_num].xmax);
-        if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+        if (cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
             return;
         }
     } else if (x_old == curr_bb_coord[old_layer_num].xmin) {
@@ -3795,7 +4774,7 @@ static inline void update_bb_layer_changed(ClusterNetId net_id,
                        curr_bb_coord[old_layer_num].xmin,
                        bb_edge_new[old_layer_num].xmin,
                        bb_coord_new[old_layer_num].xmin);
-        if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+        if (cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
             return;
         }
     }
@@ -3809,7 +4788,7 @@ static inline void update_bb_layer_changed(ClusterNetId net_id,
                        curr_bb_coord[old_layer_num].ymax,
                        bb_edge_new[old_layer_num].ymax,
                        bb_coord_new[old_layer_num].ymax);
-        if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+        if (cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
             return;
         }
     } else if (y_old == curr_bb_coord[old_layer_num].ymin) {
@@ -3821,7 +4800,7 @@ static inline void update_bb_layer_changed(ClusterNetId net_id,
                        curr_bb_coord[old_layer_num].ymin,
                        bb_edge_new[old_layer_num].ymin,
                        bb_coord_new[old_layer_num].ymin);
-        if (bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
+        if (cost_ctx.bb_updated_before[net_id] == GOT_FROM_SCRATCH) {
             return;
         }
     }
@@ -3857,12 +4836,13 @@ static inline void update_bb_edge(ClusterNetId net_id,
                                   const int& old_edge_coord,
                                   int& new_num_block_on_edge,
                                   int& new_edge_coord) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
     if (old_num_block_on_edge == 1) {
         get_layer_bb_from_scratch(net_id,
                                   bb_edge_new,
                                   bb_coord_new,
                                   bb_layer_pin_sink_count);
-        bb_updated_before[net_id] = GOT_FROM_SCRATCH;
+        cost_ctx.bb_updated_before[net_id] = GOT_FROM_SCRATCH;
         return;
     } else {
         new_num_block_on_edge = old_num_block_on_edge - 1;
@@ -3908,11 +4888,13 @@ static void add_block_to_bb(const t_physical_tile_loc& new_pin_loc,
 }
 
 static void free_fast_cost_update() {
-    chanx_place_cost_fac.clear();
-    chany_place_cost_fac.clear();
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
+    cost_ctx.chanx_place_cost_fac.clear();
+    cost_ctx.chany_place_cost_fac.clear();
 }
 
 static void alloc_and_load_for_fast_cost_update(float place_cost_exp) {
+    auto& cost_ctx = g_placer_ctx.mutable_cost();
     /* Allocates and loads the chanx_place_cost_fac and chany_place_cost_fac *
      * arrays with the inverse of the average number of tracks per channel   *
      * between [subhigh] and [sublow].  This is only useful for the cost     *
@@ -3939,18 +4921,19 @@ static void alloc_and_load_for_fast_cost_update(float place_cost_exp) {
     //for (size_t i = 0; i < device_ctx.grid.width(); i++)
     //    chany_place_cost_fac[i] = new float[(i + 1)];
 
-    chanx_place_cost_fac.resize({device_ctx.grid.height(), device_ctx.grid.height() + 1});
-    chany_place_cost_fac.resize({device_ctx.grid.width(), device_ctx.grid.width() + 1});
+    vtr::arena_allocator<float> allocator(g_vpr_ctx.mutable_placement().stage_arena);
+    cost_ctx.chanx_place_cost_fac = decltype(cost_ctx.chanx_place_cost_fac)({device_ctx.grid.height(), device_ctx.grid.height() + 1}, 0., allocator);
+    cost_ctx.chany_place_cost_fac = decltype(cost_ctx.chany_place_cost_fac)({device_ctx.grid.width(), device_ctx.grid.width() + 1}, 0., allocator);
 
     /* First compute the number of tracks between channel high and channel *
      * low, inclusive, in an efficient manner.                             */
 
-    chanx_place_cost_fac[0][0] = device_ctx.chan_width.x_list[0];
+    cost_ctx.chanx_place_cost_fac[0][0] = device_ctx.chan_width.x_list[0];
 
     for (size_t high = 1; high < device_ctx.grid.height(); high++) {
-        chanx_place_cost_fac[high][high] = device_ctx.chan_width.x_list[high];
+        cost_ctx.chanx_place_cost_fac[high][high] = device_ctx.chan_width.x_list[high];
         for (size_t low = 0; low < high; low++) {
-            chanx_place_cost_fac[high][low] = chanx_place_cost_fac[high - 1][low]
+            cost_ctx.chanx_place_cost_fac[high][low] = cost_ctx.chanx_place_cost_fac[high - 1][low]
                                               + device_ctx.chan_width.x_list[high];
         }
     }
@@ -3970,27 +4953,27 @@ static void alloc_and_load_for_fast_cost_update(float place_cost_exp) {
              * will result in infinite wiring capacity normalization       *
              * factor, and extremely bad placer behaviour. Hence we change *
              * this to a small (1 track) channel capacity instead.         */
-            if (chanx_place_cost_fac[high][low] == 0.0f) {
+            if (cost_ctx.chanx_place_cost_fac[high][low] == 0.0f) {
                 VTR_LOG_WARN("CHANX place cost fac is 0 at %d %d\n", high, low);
-                chanx_place_cost_fac[high][low] = 1.0f;
+                cost_ctx.chanx_place_cost_fac[high][low] = 1.0f;
             }
 
-            chanx_place_cost_fac[high][low] = (high - low + 1.)
-                                              / chanx_place_cost_fac[high][low];
-            chanx_place_cost_fac[high][low] = pow(
-                (double)chanx_place_cost_fac[high][low],
+            cost_ctx.chanx_place_cost_fac[high][low] = (high - low + 1.)
+                                              / cost_ctx.chanx_place_cost_fac[high][low];
+            cost_ctx.chanx_place_cost_fac[high][low] = pow(
+                (double)cost_ctx.chanx_place_cost_fac[high][low],
                 (double)place_cost_exp);
         }
 
     /* Now do the same thing for the y-directed channels.  First get the  *
      * number of tracks between channel high and channel low, inclusive.  */
 
-    chany_place_cost_fac[0][0] = device_ctx.chan_width.y_list[0];
+    cost_ctx.chany_place_cost_fac[0][0] = device_ctx.chan_width.y_list[0];
 
     for (size_t high = 1; high < device_ctx.grid.width(); high++) {
-        chany_place_cost_fac[high][high] = device_ctx.chan_width.y_list[high];
+        cost_ctx.chany_place_cost_fac[high][high] = device_ctx.chan_width.y_list[high];
         for (size_t low = 0; low < high; low++) {
-            chany_place_cost_fac[high][low] = chany_place_cost_fac[high - 1][low]
+            cost_ctx.chany_place_cost_fac[high][low] = cost_ctx.chany_place_cost_fac[high - 1][low]
                                               + device_ctx.chan_width.y_list[high];
         }
     }
@@ -4005,15 +4988,15 @@ static void alloc_and_load_for_fast_cost_update(float place_cost_exp) {
              * will result in infinite wiring capacity normalization       *
              * factor, and extremely bad placer behaviour. Hence we change *
              * this to a small (1 track) channel capacity instead.         */
-            if (chany_place_cost_fac[high][low] == 0.0f) {
+            if (cost_ctx.chany_place_cost_fac[high][low] == 0.0f) {
                 VTR_LOG_WARN("CHANY place cost fac is 0 at %d %d\n", high, low);
-                chany_place_cost_fac[high][low] = 1.0f;
+                cost_ctx.chany_place_cost_fac[high][low] = 1.0f;
             }
 
-            chany_place_cost_fac[high][low] = (high - low + 1.)
-                                              / chany_place_cost_fac[high][low];
-            chany_place_cost_fac[high][low] = pow(
-                (double)chany_place_cost_fac[high][low],
+            cost_ctx.chany_place_cost_fac[high][low] = (high - low + 1.)
+                                              / cost_ctx.chany_place_cost_fac[high][low];
+            cost_ctx.chany_place_cost_fac[high][low] = pow(
+                (double)cost_ctx.chany_place_cost_fac[high][low],
                 (double)place_cost_exp);
         }
 }
@@ -4104,71 +5087,33 @@ static int check_block_placement_consistency() {
     int error = 0;
 
     auto& cluster_ctx = g_vpr_ctx.clustering();
-    auto& place_ctx = g_vpr_ctx.placement();
     auto& device_ctx = g_vpr_ctx.device();
 
-    vtr::vector<ClusterBlockId, int> bdone(
-        cluster_ctx.clb_nlist.blocks().size(), 0);
+    /* Step through device grid and placement, one column of one layer at a time. *
+     * The columns are independent, so each records the blocks it found, which    *
+     * are counted afterwards.                                                    */
+    const size_t width = device_ctx.grid.width();
+    const size_t num_columns = device_ctx.grid.get_num_layers() * width;
+    std::vector<int> column_errors(num_columns, 0);
+    std::vector<std::vector<ClusterBlockId>> column_blocks(num_columns);
 
-    /* Step through device grid and placement. Check it against blocks */
-    for (int layer_num = 0; layer_num < (int)device_ctx.grid.get_num_layers(); layer_num++) {
-        for (int i = 0; i < (int)device_ctx.grid.width(); i++) {
-            for (int j = 0; j < (int)device_ctx.grid.height(); j++) {
-                const t_physical_tile_loc tile_loc(i, j, layer_num);
-                const auto& type = device_ctx.grid.get_physical_type(tile_loc);
-                if (place_ctx.grid_blocks.get_usage(tile_loc) > type->capacity) {
-                    VTR_LOG_ERROR(
-                        "%d blocks were placed at grid location (%d,%d,%d), but location capacity is %d.\n",
-                        place_ctx.grid_blocks.get_usage(tile_loc), i, j, layer_num,
-                        type->capacity);
-                    error++;
-                }
-                int usage_check = 0;
-                for (int k = 0; k < type->capacity; k++) {
-                    auto bnum = place_ctx.grid_blocks.block_at_location({i, j, k, layer_num});
-                    if (EMPTY_BLOCK_ID == bnum || INVALID_BLOCK_ID == bnum)
-                        continue;
-
-                    auto logical_block = cluster_ctx.clb_nlist.block_type(bnum);
-                    auto physical_tile = type;
-
-                    if (physical_tile_type(bnum) != physical_tile) {
-                        VTR_LOG_ERROR(
-                            "Block %zu type (%s) does not match grid location (%zu,%zu, %d) type (%s).\n",
-                            size_t(bnum), logical_block->name, i, j, layer_num, physical_tile->name);
-                        error++;
-                    }
+    auto check_column = [&](size_t icolumn) {
+        column_errors[icolumn] = check_grid_column_consistency(icolumn / width, icolumn % width, column_blocks[icolumn]);
+    };
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), num_columns, check_column);
+#else
+    for (size_t icolumn = 0; icolumn < num_columns; ++icolumn) {
+        check_column(icolumn);
+    }
+#endif
 
-                    auto& loc = place_ctx.block_locs[bnum].loc;
-                    if (loc.x != i || loc.y != j || loc.layer != layer_num
-                        || !is_sub_tile_compatible(physical_tile, logical_block,
-                                                   loc.sub_tile)) {
-                        VTR_LOG_ERROR(
-                            "Block %zu's location is (%d,%d,%d) but found in grid at (%zu,%zu,%d,%d).\n",
-                            size_t(bnum),
-                            loc.x,
-                            loc.y,
-                            loc.sub_tile,
-                            tile_loc.x,
-                            tile_loc.y,
-                            tile_loc.layer_num,
-                            layer_num);
-                        error++;
-                    }
-                    ++usage_check;
-                    bdone[bnum]++;
-                }
-                if (usage_check != place_ctx.grid_blocks.get_usage(tile_loc)) {
-                    VTR_LOG_ERROR(
-                        "%d block(s) were placed at location (%d,%d,%d), but location contains %d block(s).\n",
-                        place_ctx.grid_blocks.get_usage(tile_loc),
-                        tile_loc.x,
-                        tile_loc.y,
-                        tile_loc.layer_num,
-                        usage_check);
-                    error++;
-                }
-            }
+    vtr::vector<ClusterBlockId, int> bdone(
+        cluster_ctx.clb_nlist.blocks().size(), 0);
+    for (size_t icolumn = 0; icolumn < num_columns; ++icolumn) {
+        error += column_errors[icolumn];
+        for (ClusterBlockId bnum : column_blocks[icolumn]) {
+            bdone[bnum]++;
         }
     }
 
@@ -4183,45 +5128,261 @@ static int check_block_placement_consistency() {
     return error;
 }
 
-int check_macro_placement_consistency() {
+/* Checks the blocks placed in column i of layer layer_num against their locations, *
+ * and appends them to found_blocks. Returns the number of errors found.            */
+static int check_grid_column_consistency(int layer_num, int i, std::vector<ClusterBlockId>& found_blocks) {
     int error = 0;
-    auto& place_ctx = g_vpr_ctx.placement();
-
-    auto& pl_macros = place_ctx.pl_macros;
 
-    /* Check the pl_macro placement are legal - blocks are in the proper relative position. */
-    for (size_t imacro = 0; imacro < place_ctx.pl_macros.size(); imacro++) {
-        auto head_iblk = pl_macros[imacro].members[0].blk_index;
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& device_ctx = g_vpr_ctx.device();
 
-        for (size_t imember = 0; imember < pl_macros[imacro].members.size();
-             imember++) {
-            auto member_iblk = pl_macros[imacro].members[imember].blk_index;
+    for (int j = 0; j < (int)device_ctx.grid.height(); j++) {
+        const t_physical_tile_loc tile_loc(i, j, layer_num);
+        const auto& type = device_ctx.grid.get_physical_type(tile_loc);
+        if (place_ctx.grid_blocks.get_usage(tile_loc) > type->capacity) {
+            VTR_LOG_ERROR(
+                "%d blocks were placed at grid location (%d,%d,%d), but location capacity is %d.\n",
+                place_ctx.grid_blocks.get_usage(tile_loc), i, j, layer_num,
+                type->capacity);
+            error++;
+        }
+        int usage_check = 0;
+        for (int k = 0; k < type->capacity; k++) {
+            auto bnum = place_ctx.grid_blocks.block_at_location({i, j, k, layer_num});
+            if (EMPTY_BLOCK_ID == bnum || INVALID_BLOCK_ID == bnum)
+                continue;
 
-            // Compute the suppossed member's x,y,z location
-            t_pl_loc member_pos = place_ctx.block_locs[head_iblk].loc
-                                  + pl_macros[imacro].members[imember].offset;
+            auto logical_block = cluster_ctx.clb_nlist.block_type(bnum);
+            auto physical_tile = type;
 
-            // Check the place_ctx.block_locs data structure first
-            if (place_ctx.block_locs[member_iblk].loc != member_pos) {
+            if (physical_tile_type(bnum) != physical_tile) {
                 VTR_LOG_ERROR(
-                    "Block %zu in pl_macro #%zu is not placed in the proper orientation.\n",
-                    size_t(member_iblk), imacro);
+                    "Block %zu type (%s) does not match grid location (%zu,%zu, %d) type (%s).\n",
+                    size_t(bnum), logical_block->name, i, j, layer_num, physical_tile->name);
                 error++;
             }
 
-            // Then check the place_ctx.grid data structure
-            if (place_ctx.grid_blocks.block_at_location(member_pos)
-                != member_iblk) {
+            auto& loc = place_ctx.block_locs[bnum].loc;
+            if (loc.x != i || loc.y != j || loc.layer != layer_num
+                || !is_sub_tile_compatible(physical_tile, logical_block,
+                                           loc.sub_tile)) {
                 VTR_LOG_ERROR(
-                    "Block %zu in pl_macro #%zu is not placed in the proper orientation.\n",
-                    size_t(member_iblk), imacro);
+                    "Block %zu's location is (%d,%d,%d) but found in grid at (%zu,%zu,%d,%d).\n",
+                    size_t(bnum),
+                    loc.x,
+                    loc.y,
+                    loc.sub_tile,
+                    tile_loc.x,
+                    tile_loc.y,
+                    tile_loc.layer_num,
+                    layer_num);
                 error++;
             }
-        } // Finish going through all the members
-    }     // Finish going through all the macros
+            ++usage_check;
+            found_blocks.push_back(bnum);
+        }
+        if (usage_check != place_ctx.grid_blocks.get_usage(tile_loc)) {
+            VTR_LOG_ERROR(
+                "%d block(s) were placed at location (%d,%d,%d), but location contains %d block(s).\n",
+                place_ctx.grid_blocks.get_usage(tile_loc),
+                tile_loc.x,
+                tile_loc.y,
+                tile_loc.layer_num,
+                usage_check);
+            error++;
+        }
+    }
+
+    return error;
+}
+
+int check_macro_placement_consistency() {
+    int error = 0;
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    /* Check the pl_macro placement are legal - blocks are in the proper relative position. */
+    std::vector<int> macro_errors(place_ctx.pl_macros.size(), 0);
+    auto check_macro = [&](size_t imacro) {
+        macro_errors[imacro] = check_single_macro_placement_consistency(imacro);
+    };
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), place_ctx.pl_macros.size(), check_macro);
+#else
+    for (size_t imacro = 0; imacro < place_ctx.pl_macros.size(); imacro++) {
+        check_macro(imacro);
+    }
+#endif
+
+    for (int macro_error : macro_errors) {
+        error += macro_error;
+    }
+    return error;
+}
+
+/* Checks that the members of macro imacro are in the proper relative position. *
+ * Returns the number of errors found.                                          */
+static int check_single_macro_placement_consistency(size_t imacro) {
+    int error = 0;
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    auto& pl_macros = place_ctx.pl_macros;
+
+    auto head_iblk = pl_macros[imacro].members[0].blk_index;
+
+    for (size_t imember = 0; imember < pl_macros[imacro].members.size();
+         imember++) {
+        auto member_iblk = pl_macros[imacro].members[imember].blk_index;
+
+        // Compute the suppossed member's x,y,z location
+        t_pl_loc member_pos = place_ctx.block_locs[head_iblk].loc
+                              + pl_macros[imacro].members[imember].offset;
+
+        // Check the place_ctx.block_locs data structure first
+        if (place_ctx.block_locs[member_iblk].loc != member_pos) {
+            VTR_LOG_ERROR(
+                "Block %zu in pl_macro #%zu is not placed in the proper orientation.\n",
+                size_t(member_iblk), imacro);
+            error++;
+        }
+
+        // Then check the place_ctx.grid data structure
+        if (place_ctx.grid_blocks.block_at_location(member_pos)
+            != member_iblk) {
+            VTR_LOG_ERROR(
+                "Block %zu in pl_macro #%zu is not placed in the proper orientation.\n",
+                size_t(member_iblk), imacro);
+            error++;
+        }
+    } // Finish going through all the members
+    return error;
+}
+
+/* Checks a random sample of sample_fraction of the blocks, macros and nets against  *
+ * the placement data structures. Cheaper than check_place(), so it can run between  *
+ * annealing temperatures, to catch an inconsistency soon after the move causing it. *
+ * The timing and NoC costs are only checked by the full check_place().              */
+static void check_placement_sample(float sample_fraction, vtr::RandState& rand_state) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    /* Draws (with replacement) the indices of the checked items among num_items */
+    auto sample_indices = [&](size_t num_items) {
+        std::vector<size_t> indices;
+        if (num_items == 0) {
+            return indices;
+        }
+        size_t num_samples = std::ceil(sample_fraction * num_items);
+        indices.reserve(num_samples);
+        for (size_t isample = 0; isample < num_samples; ++isample) {
+            indices.push_back(vtr::irand(num_items - 1, rand_state));
+        }
+        return indices;
+    };
+    std::vector<size_t> sampled_blocks = sample_indices(cluster_ctx.clb_nlist.blocks().size());
+    std::vector<size_t> sampled_macros = sample_indices(place_ctx.pl_macros.size());
+    std::vector<size_t> sampled_nets = sample_indices(cluster_ctx.clb_nlist.nets().size());
+
+    std::vector<int> block_errors(sampled_blocks.size(), 0);
+    std::vector<int> macro_errors(sampled_macros.size(), 0);
+    std::vector<int> net_errors(sampled_nets.size(), 0);
+    auto check_block = [&](size_t isample) {
+        block_errors[isample] = check_sampled_block_placement(ClusterBlockId(sampled_blocks[isample]));
+    };
+    auto check_macro = [&](size_t isample) {
+        macro_errors[isample] = check_single_macro_placement_consistency(sampled_macros[isample]);
+    };
+    auto check_net = [&](size_t isample) {
+        ClusterNetId net_id(sampled_nets[isample]);
+        if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+            net_errors[isample] = check_sampled_net_cost(net_id);
+        }
+    };
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), sampled_blocks.size(), check_block);
+    tbb::parallel_for(size_t(0), sampled_macros.size(), check_macro);
+    tbb::parallel_for(size_t(0), sampled_nets.size(), check_net);
+#else
+    for (size_t isample = 0; isample < sampled_blocks.size(); ++isample) {
+        check_block(isample);
+    }
+    for (size_t isample = 0; isample < sampled_macros.size(); ++isample) {
+        check_macro(isample);
+    }
+    for (size_t isample = 0; isample < sampled_nets.size(); ++isample) {
+        check_net(isample);
+    }
+#endif
+
+    int error = std::accumulate(block_errors.begin(), block_errors.end(), 0)
+                + std::accumulate(macro_errors.begin(), macro_errors.end(), 0)
+                + std::accumulate(net_errors.begin(), net_errors.end(), 0);
+    if (error != 0) {
+        VPR_ERROR(VPR_ERROR_PLACE,
+                  "\nSampled placement consistency check (%zu blocks, %zu macros, %zu nets) found %d errors.\n"
+                  "Aborting program.\n",
+                  sampled_blocks.size(), sampled_macros.size(), sampled_nets.size(), error);
+    }
+}
+
+/* Checks that blk_id is found in the grid at its location, on a compatible tile. *
+ * Returns the number of errors found.                                           */
+static int check_sampled_block_placement(ClusterBlockId blk_id) {
+    int error = 0;
+
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+    auto& device_ctx = g_vpr_ctx.device();
+
+    const t_pl_loc& loc = place_ctx.block_locs[blk_id].loc;
+    const auto& physical_tile = device_ctx.grid.get_physical_type({loc.x, loc.y, loc.layer});
+    auto logical_block = cluster_ctx.clb_nlist.block_type(blk_id);
+
+    if (physical_tile_type(blk_id) != physical_tile
+        || !is_sub_tile_compatible(physical_tile, logical_block, loc.sub_tile)) {
+        VTR_LOG_ERROR(
+            "Block %zu type (%s) does not match its location (%d,%d,%d,%d) type (%s).\n",
+            size_t(blk_id), logical_block->name, loc.x, loc.y, loc.sub_tile, loc.layer, physical_tile->name);
+        error++;
+    }
+
+    if (place_ctx.grid_blocks.block_at_location(loc) != blk_id) {
+        VTR_LOG_ERROR(
+            "Block %zu's location is (%d,%d,%d,%d) but it is not found there in the grid.\n",
+            size_t(blk_id), loc.x, loc.y, loc.sub_tile, loc.layer);
+        error++;
+    }
+
     return error;
 }
 
+/* Checks the bounding box cost of net_id against its cost recomputed from scratch. *
+ * Returns the number of errors found.                                             */
+static int check_sampled_net_cost(ClusterNetId net_id) {
+    const auto& cost_ctx = g_placer_ctx.cost();
+    int num_layers = g_vpr_ctx.device().grid.get_num_layers();
+
+    vtr::Matrix<int> num_sink_pin_layer({1, size_t(num_layers)});
+    double net_cost_check;
+    if (g_vpr_ctx.placement().cube_bb) {
+        t_bb bb_coord;
+        get_non_updateable_bb(net_id, bb_coord, num_sink_pin_layer[0]);
+        net_cost_check = get_net_cost(net_id, bb_coord);
+    } else {
+        std::vector<t_2D_bb> layer_bb_coord(num_layers, t_2D_bb());
+        get_non_updateable_layer_bb(net_id, layer_bb_coord, num_sink_pin_layer[0]);
+        net_cost_check = get_net_layer_cost(net_id, layer_bb_coord, num_sink_pin_layer[0]);
+    }
+
+    if (fabs(net_cost_check - cost_ctx.net_cost[net_id]) > cost_ctx.net_cost[net_id] * ERROR_TOL) {
+        VTR_LOG_ERROR(
+            "Net %zu cost check: %g and cost: %g differ.\n",
+            size_t(net_id), net_cost_check, cost_ctx.net_cost[net_id]);
+        return 1;
+    }
+    return 0;
+}
+
 #ifdef VERBOSE
 void print_clb_placement(const char* fname) {
     /* Prints out the clb placements to a file.  */
@@ -4333,6 +5494,21 @@ static void print_place_status(const t_annealing_state& state,
     fflush(stdout);
 }
 
+///@brief Records the state of the anneal after a temperature as trace counters (see vtr_trace.h)
+static void trace_place_status(const t_annealing_state& state,
+                               const t_placer_statistics& stats,
+                               const t_placer_costs& costs) {
+    if (!vtr::trace_enabled()) {
+        return;
+    }
+
+    vtr::trace_counter("Placer temperature", state.t);
+    vtr::trace_counter("Placer accepted swaps", stats.success_sum);
+    vtr::trace_counter("Placer success rate", stats.success_rate);
+    vtr::trace_counter("Placer cost", costs.cost);
+    vtr::trace_counter("Placer range limit", state.rlim);
+}
+
 static void print_resources_utilization() {
     auto& place_ctx = g_vpr_ctx.placement();
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -4375,23 +5551,24 @@ static void print_resources_utilization() {
 }
 
 static void print_placement_swaps_stats(const t_annealing_state& state) {
-    size_t total_swap_attempts = num_swap_rejected + num_swap_accepted
-                                 + num_swap_aborted;
+    auto& swap_ctx = g_placer_ctx.mutable_swap();
+    size_t total_swap_attempts = swap_ctx.num_swap_rejected + swap_ctx.num_swap_accepted
+                                 + swap_ctx.num_swap_aborted;
     VTR_ASSERT(total_swap_attempts > 0);
 
     size_t num_swap_print_digits = ceil(log10(total_swap_attempts));
-    float reject_rate = (float)num_swap_rejected / total_swap_attempts;
-    float accept_rate = (float)num_swap_accepted / total_swap_attempts;
-    float abort_rate = (float)num_swap_aborted / total_swap_attempts;
+    float reject_rate = (float)swap_ctx.num_swap_rejected / total_swap_attempts;
+    float accept_rate = (float)swap_ctx.num_swap_accepted / total_swap_attempts;
+    float abort_rate = (float)swap_ctx.num_swap_aborted / total_swap_attempts;
     VTR_LOG("Placement number of temperatures: %d\n", state.num_temps);
     VTR_LOG("Placement total # of swap attempts: %*d\n", num_swap_print_digits,
             total_swap_attempts);
     VTR_LOG("\tSwaps accepted: %*d (%4.1f %%)\n", num_swap_print_digits,
-            num_swap_accepted, 100 * accept_rate);
+            swap_ctx.num_swap_accepted, 100 * accept_rate);
     VTR_LOG("\tSwaps rejected: %*d (%4.1f %%)\n", num_swap_print_digits,
-            num_swap_rejected, 100 * reject_rate);
+            swap_ctx.num_swap_rejected, 100 * reject_rate);
     VTR_LOG("\tSwaps aborted: %*d (%4.1f %%)\n", num_swap_print_digits,
-            num_swap_aborted, 100 * abort_rate);
+            swap_ctx.num_swap_aborted, 100 * abort_rate);
 }
 
 static void print_placement_move_types_stats(const MoveTypeStat& move_type_stat) {
@@ -4484,6 +5661,33 @@ static void calculate_reward_and_process_outcome(
     }
 }
 
+/* Returns how much worse (> 1) or better (< 1) a seed's progress is than the reference.  *
+ * Wirelength is compared for all placers, and for timing driven placement it is blended *
+ * with the critical path delay using the timing tradeoff.                               */
+static double seed_relative_quality(const t_placer_opts& placer_opts,
+                                    const t_seed_progress& progress,
+                                    const t_seed_progress& reference) {
+    double quality = (reference.bb_cost > 0.) ? progress.bb_cost / reference.bb_cost : 1.;
+    if (placer_opts.place_algorithm.is_timing_driven() && reference.cpd > 0.) {
+        double tradeoff = placer_opts.timing_tradeoff;
+        quality = (1. - tradeoff) * quality + tradeoff * progress.cpd / reference.cpd;
+    }
+    return quality;
+}
+
+/* Returns true if a seed is worse at its latest temperature than the best finished *
+ * seed was at the same temperature (or its last one) by more than the margin.      */
+static bool should_prune_seed(const t_placer_opts& placer_opts,
+                              const std::vector<t_seed_progress>& trajectory,
+                              const std::vector<t_seed_progress>& best_trajectory) {
+    if (trajectory.empty() || best_trajectory.empty()) {
+        return false;
+    }
+    size_t itemp = std::min(trajectory.size(), best_trajectory.size()) - 1;
+    return seed_relative_quality(placer_opts, trajectory.back(), best_trajectory[itemp])
+           > 1. + placer_opts.place_seeds_prune_margin;
+}
+
 bool placer_needs_lookahead(const t_vpr_setup& vpr_setup) {
     return (vpr_setup.PlacerOpts.place_algorithm.is_timing_driven());
 }
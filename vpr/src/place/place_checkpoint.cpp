@@ -1,3 +1,8 @@
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+
 #include "place_checkpoint.h"
 #include "noc_place_utils.h"
 
@@ -69,3 +74,189 @@ void restore_best_placement(t_placement_checkpoint& placement_checkpoint,
         VTR_LOG("\nCheckpoint restored\n");
     }
 }
+
+/* Version of the checkpoint file format, written on its first line */
+static constexpr int ANNEALER_CHECKPOINT_VERSION = 1;
+
+static void write_learned_state(std::ofstream& out, const char* name, const std::vector<double>& state) {
+    out << name << " " << state.size();
+    for (double value : state) {
+        out << " " << value;
+    }
+    out << "\n";
+}
+
+static bool read_learned_state(std::ifstream& in, const char* name, std::vector<double>& state) {
+    std::string key;
+    size_t size;
+    if (!(in >> key >> size) || key != name) {
+        return false;
+    }
+    state.resize(size);
+    for (double& value : state) {
+        if (!(in >> value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void t_annealer_checkpoint::save(const t_annealing_state& state,
+                                 e_agent_state curr_agent_state,
+                                 int curr_tot_iter,
+                                 int curr_outer_crit_iter_count,
+                                 const MoveGenerator& move_generator,
+                                 const MoveGenerator& move_generator2) {
+    block_locs = g_vpr_ctx.placement().block_locs;
+
+    t = state.t;
+    restart_t = state.restart_t;
+    alpha = state.alpha;
+    num_temps = state.num_temps;
+    rlim = state.rlim;
+    crit_exponent = state.crit_exponent;
+    move_lim = state.move_lim;
+    move_lim_max = state.move_lim_max;
+
+    agent_state = curr_agent_state;
+    tot_iter = curr_tot_iter;
+    outer_crit_iter_count = curr_outer_crit_iter_count;
+    rand_state = vtr::get_random_state();
+
+    move_generator_state = move_generator.learned_state();
+    move_generator2_state = move_generator2.learned_state();
+}
+
+void t_annealer_checkpoint::restore_placement() const {
+    auto& mutable_place_ctx = g_vpr_ctx.mutable_placement();
+    mutable_place_ctx.block_locs = block_locs;
+    load_grid_blocks_from_block_locs();
+}
+
+void t_annealer_checkpoint::restore_annealer_state(t_annealing_state& state,
+                                                   e_agent_state& curr_agent_state,
+                                                   int& curr_tot_iter,
+                                                   int& curr_outer_crit_iter_count,
+                                                   MoveGenerator& move_generator,
+                                                   MoveGenerator& move_generator2) const {
+    state.t = t;
+    state.restart_t = restart_t;
+    state.alpha = alpha;
+    state.num_temps = num_temps;
+    state.rlim = rlim;
+    state.crit_exponent = crit_exponent;
+    state.move_lim = move_lim;
+    state.move_lim_max = move_lim_max;
+
+    curr_agent_state = agent_state;
+    curr_tot_iter = tot_iter;
+    curr_outer_crit_iter_count = outer_crit_iter_count;
+    vtr::set_random_state(rand_state);
+
+    if (!move_generator.set_learned_state(move_generator_state)
+        || !move_generator2.set_learned_state(move_generator2_state)) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE,
+                        "The placement checkpoint was saved with different placer move options (e.g. --RL_agent_placement or --place_agent_space).\n");
+    }
+}
+
+void t_annealer_checkpoint::write(const std::string& filename) const {
+    //Write to a temporary file first, so that an interruption while writing never destroys the previous checkpoint
+    std::string tmp_filename = filename + ".tmp";
+    {
+        std::ofstream out(tmp_filename);
+        if (!out) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE_F,
+                            "'%s' - Cannot open placement checkpoint file for writing.\n",
+                            tmp_filename.c_str());
+        }
+
+        //Enough digits for every float and double to be read back exactly
+        out << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+        out << "vpr_annealer_checkpoint " << ANNEALER_CHECKPOINT_VERSION << "\n";
+        out << "annealing_state " << t << " " << restart_t << " " << alpha << " " << num_temps << " "
+            << rlim << " " << crit_exponent << " " << move_lim << " " << move_lim_max << "\n";
+        out << "progress " << int(agent_state) << " " << tot_iter << " " << outer_crit_iter_count << "\n";
+        out << "random_state " << rand_state << "\n";
+        write_learned_state(out, "move_generator", move_generator_state);
+        write_learned_state(out, "move_generator2", move_generator2_state);
+
+        out << "blocks " << block_locs.size() << "\n";
+        for (const auto& block_loc : block_locs) {
+            const t_pl_loc& loc = block_loc.loc;
+            out << loc.x << " " << loc.y << " " << loc.sub_tile << " " << loc.layer << "\n";
+        }
+
+        out.close();
+        if (!out) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE_F,
+                            "'%s' - Failed to write placement checkpoint file.\n",
+                            tmp_filename.c_str());
+        }
+    }
+
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE_F,
+                        "'%s' - Cannot replace placement checkpoint file.\n",
+                        filename.c_str());
+    }
+}
+
+bool t_annealer_checkpoint::read(const std::string& filename) {
+    std::ifstream in(filename);
+    if (!in) {
+        return false;
+    }
+
+    auto bad_file = [&]() {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE_F,
+                        "'%s' - Invalid placement checkpoint file.\n",
+                        filename.c_str());
+    };
+
+    std::string key;
+    int version;
+    if (!(in >> key >> version) || key != "vpr_annealer_checkpoint") {
+        bad_file();
+    }
+    if (version != ANNEALER_CHECKPOINT_VERSION) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE_F,
+                        "'%s' - Placement checkpoint file version %d is not supported (expected %d).\n",
+                        filename.c_str(), version, ANNEALER_CHECKPOINT_VERSION);
+    }
+
+    int agent_state_value;
+    if (!(in >> key >> t >> restart_t >> alpha >> num_temps >> rlim >> crit_exponent >> move_lim >> move_lim_max)
+        || key != "annealing_state"
+        || !(in >> key >> agent_state_value >> tot_iter >> outer_crit_iter_count) || key != "progress"
+        || !(in >> key >> rand_state) || key != "random_state"
+        || !read_learned_state(in, "move_generator", move_generator_state)
+        || !read_learned_state(in, "move_generator2", move_generator2_state)) {
+        bad_file();
+    }
+    agent_state = e_agent_state(agent_state_value);
+
+    size_t num_blocks;
+    if (!(in >> key >> num_blocks) || key != "blocks") {
+        bad_file();
+    }
+
+    const auto& place_ctx = g_vpr_ctx.placement();
+    if (num_blocks != place_ctx.block_locs.size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE_F,
+                        "'%s' - The placement checkpoint has %zu blocks, but the clustered netlist has %zu.\n",
+                        filename.c_str(), num_blocks, place_ctx.block_locs.size());
+    }
+
+    //Fixed blocks (e.g. constrained by --fix_clusters) keep their flag from the initial placement
+    block_locs = place_ctx.block_locs;
+    for (auto& block_loc : block_locs) {
+        t_pl_loc& loc = block_loc.loc;
+        if (!(in >> loc.x >> loc.y >> loc.sub_tile >> loc.layer)) {
+            bad_file();
+        }
+    }
+
+    return true;
+}
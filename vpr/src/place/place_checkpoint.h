@@ -10,6 +10,8 @@
 
 #include "place_delay_model.h"
 #include "place_timing_update.h"
+#include "RL_agent_util.h"
+#include "vtr_random.h"
 //Placement checkpoint
 /**
  * @brief Data structure that stores the placement state and saves it as a checkpoint.
@@ -46,6 +48,63 @@ class t_placement_checkpoint {
     bool cp_is_valid();
 };
 
+/**
+ * @brief The full state of the annealer between two temperatures, which can be saved to
+ * and read back from a file (--place_checkpoint_file) to resume an interrupted placement.
+ *
+ * Besides the block locations it holds the annealing schedule state, the placer's
+ * progress counters, what the move generators (RL agents) have learned and the state of
+ * the random number generator, so that the resumed anneal continues where it stopped.
+ * Costs and timing are not saved: they are recomputed from the restored placement.
+ */
+class t_annealer_checkpoint {
+  private:
+    vtr::vector_map<ClusterBlockId, t_block_loc> block_locs;
+
+    float t;
+    float restart_t;
+    float alpha;
+    int num_temps;
+    float rlim;
+    float crit_exponent;
+    int move_lim;
+    int move_lim_max;
+
+    e_agent_state agent_state;
+    int tot_iter;
+    int outer_crit_iter_count;
+    vtr::RandState rand_state;
+
+    std::vector<double> move_generator_state;
+    std::vector<double> move_generator2_state;
+
+  public:
+    //save the current block locations, annealer state and random number generator state
+    void save(const t_annealing_state& state,
+              e_agent_state curr_agent_state,
+              int curr_tot_iter,
+              int curr_outer_crit_iter_count,
+              const MoveGenerator& move_generator,
+              const MoveGenerator& move_generator2);
+
+    //restore the saved block locations into the placement context
+    void restore_placement() const;
+
+    //restore the saved annealer and random number generator state. Errors out if the move generators don't match the saved ones
+    void restore_annealer_state(t_annealing_state& state,
+                                e_agent_state& curr_agent_state,
+                                int& curr_tot_iter,
+                                int& curr_outer_crit_iter_count,
+                                MoveGenerator& move_generator,
+                                MoveGenerator& move_generator2) const;
+
+    //write the checkpoint to filename, replacing any earlier checkpoint only once the new one is complete
+    void write(const std::string& filename) const;
+
+    //read the checkpoint from filename. Returns false if the file doesn't exist, and errors out if it is not a valid checkpoint for this netlist
+    bool read(const std::string& filename);
+};
+
 //save placement checkpoint if checkpointing is enabled and checkpoint conditions occured
 void save_placement_checkpoint_if_needed(t_placement_checkpoint& placement_checkpoint, std::shared_ptr<SetupTimingInfo> timing_info, t_placer_costs& costs, float cpd);
 
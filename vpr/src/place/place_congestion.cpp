@@ -0,0 +1,124 @@
+/**
+ * @file place_congestion.cpp
+ * @brief Defines the PlacerCongestionMap declared in place_congestion.h.
+ */
+
+#include "place_congestion.h"
+
+#include <algorithm>
+
+#include "vtr_assert.h"
+#include "vtr_memory.h"
+
+void PlacerCongestionMap::init(const DeviceGrid& grid, const t_chan_width& chan_width) {
+    width_ = grid.width();
+    height_ = grid.height();
+
+    VTR_ASSERT(chan_width.x_list.size() >= height_);
+    VTR_ASSERT(chan_width.y_list.size() >= width_);
+    chanx_width_.assign(chan_width.x_list.begin(), chan_width.x_list.begin() + height_);
+    chany_width_.assign(chan_width.y_list.begin(), chan_width.y_list.begin() + width_);
+
+    chanx_demand_diff_.resize({width_ + 1, height_ + 1}, 0.);
+    chany_demand_diff_.resize({width_ + 1, height_ + 1}, 0.);
+    overuse_sums_.resize({width_ + 1, height_ + 1}, 0.);
+
+    clear_demand();
+}
+
+void PlacerCongestionMap::clear() {
+    width_ = 0;
+    height_ = 0;
+    vtr::release_memory(chanx_width_);
+    vtr::release_memory(chany_width_);
+    chanx_demand_diff_.clear();
+    chany_demand_diff_.clear();
+    overuse_sums_.clear();
+    max_utilization_ = 0.;
+    num_overused_channels_ = 0;
+}
+
+void PlacerCongestionMap::clear_demand() {
+    chanx_demand_diff_.fill(0.);
+    chany_demand_diff_.fill(0.);
+    overuse_sums_.fill(0.);
+    max_utilization_ = 0.;
+    num_overused_channels_ = 0;
+}
+
+void PlacerCongestionMap::add_demand(const t_bb& bb, double crossing) {
+    VTR_ASSERT_SAFE(bb.xmin >= 0 && size_t(bb.xmax) < width_);
+    VTR_ASSERT_SAFE(bb.ymin >= 0 && size_t(bb.ymax) < height_);
+
+    int bb_width = bb.xmax - bb.xmin + 1;
+    int bb_height = bb.ymax - bb.ymin + 1;
+
+    //Each horizontal track of the net spans the box, and the crossing count of
+    //them are spread over its rows (and the other way round for vertical tracks)
+    double chanx_demand = crossing / bb_height;
+    double chany_demand = crossing / bb_width;
+
+    auto add_box_demand = [&](vtr::NdMatrix<double, 2>& demand_diff, double demand) {
+        demand_diff[bb.xmin][bb.ymin] += demand;
+        demand_diff[bb.xmax + 1][bb.ymin] -= demand;
+        demand_diff[bb.xmin][bb.ymax + 1] -= demand;
+        demand_diff[bb.xmax + 1][bb.ymax + 1] += demand;
+    };
+    add_box_demand(chanx_demand_diff_, chanx_demand);
+    add_box_demand(chany_demand_diff_, chany_demand);
+}
+
+void PlacerCongestionMap::update_utilization() {
+    max_utilization_ = 0.;
+    num_overused_channels_ = 0;
+
+    //Prefix sums of the difference arrays of the previous and current columns
+    std::vector<double> prev_chanx_demand(height_, 0.), chanx_demand(height_);
+    std::vector<double> prev_chany_demand(height_, 0.), chany_demand(height_);
+
+    for (size_t x = 0; x < width_; ++x) {
+        for (size_t y = 0; y < height_; ++y) {
+            chanx_demand[y] = chanx_demand_diff_[x][y] + prev_chanx_demand[y];
+            chany_demand[y] = chany_demand_diff_[x][y] + prev_chany_demand[y];
+            if (y > 0) {
+                chanx_demand[y] += chanx_demand[y - 1] - prev_chanx_demand[y - 1];
+                chany_demand[y] += chany_demand[y - 1] - prev_chany_demand[y - 1];
+            }
+
+            //Channels without tracks count as a single track, as in the placer's wiring cost
+            float chanx_util = chanx_demand[y] / std::max(chanx_width_[y], 1);
+            float chany_util = chany_demand[y] / std::max(chany_width_[x], 1);
+
+            max_utilization_ = std::max({max_utilization_, chanx_util, chany_util});
+            num_overused_channels_ += (chanx_util > 1.) + (chany_util > 1.);
+
+            double overuse = std::max(chanx_util - 1., 0.) + std::max(chany_util - 1., 0.);
+            overuse_sums_[x + 1][y + 1] = overuse + overuse_sums_[x][y + 1] + overuse_sums_[x + 1][y] - overuse_sums_[x][y];
+        }
+        std::swap(prev_chanx_demand, chanx_demand);
+        std::swap(prev_chany_demand, chany_demand);
+    }
+}
+
+double PlacerCongestionMap::net_congestion_cost(const t_bb& bb, double crossing) const {
+    VTR_ASSERT_SAFE(bb.xmin >= 0 && size_t(bb.xmax) < width_);
+    VTR_ASSERT_SAFE(bb.ymin >= 0 && size_t(bb.ymax) < height_);
+
+    int bb_width = bb.xmax - bb.xmin + 1;
+    int bb_height = bb.ymax - bb.ymin + 1;
+
+    double overuse = overuse_sums_[bb.xmax + 1][bb.ymax + 1] - overuse_sums_[bb.xmin][bb.ymax + 1]
+                     - overuse_sums_[bb.xmax + 1][bb.ymin] + overuse_sums_[bb.xmin][bb.ymin];
+
+    //Round-off of the summed-area table may leave a tiny negative overuse
+    overuse = std::max(overuse, 0.);
+
+    return (bb_width + bb_height) * crossing * overuse / (bb_width * bb_height);
+}
+
+float PlacerCongestionMap::overused_fraction() const {
+    if (empty()) {
+        return 0.;
+    }
+    return float(num_overused_channels_) / (2 * width_ * height_);
+}
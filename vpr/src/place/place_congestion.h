@@ -0,0 +1,94 @@
+#ifndef VPR_PLACE_CONGESTION_H
+#define VPR_PLACE_CONGESTION_H
+
+/**
+ * @file place_congestion.h
+ * @brief RUDY (Rectangular Uniform wire DensitY) routing congestion estimate of a placement.
+ *
+ * Each net is assumed to spread its expected wirelength uniformly over its bounding box:
+ * a net with crossing count q and a w x h bounding box uses q / h horizontal and q / w
+ * vertical tracks in every tile of the box. The sum over all nets, divided by the channel
+ * widths, estimates the channel utilization the router will see.
+ *
+ * The demand is kept as 2D difference arrays, so adding or removing a net takes O(1) whatever
+ * the size of its bounding box, and the map can follow every committed placer move. The per-tile
+ * utilization is only materialized by update_utilization(), which also builds the summed-area
+ * table net_congestion_cost() prices a bounding box with, in O(1).
+ *
+ * The map is 2D: a net spanning several layers uses the channels of its x/y extent once.
+ */
+
+#include <vector>
+
+#include "vtr_ndmatrix.h"
+
+#include "device_grid.h"
+#include "rr_graph_type.h"
+#include "vpr_types.h"
+
+class PlacerCongestionMap {
+  public:
+    ///@brief Sizes the (empty) map for the device grid and its channel widths.
+    void init(const DeviceGrid& grid, const t_chan_width& chan_width);
+
+    ///@brief Releases the map.
+    void clear();
+
+    ///@brief Has the map been initialized?
+    bool empty() const { return width_ == 0; }
+
+    ///@brief Removes the demand of all the nets.
+    void clear_demand();
+
+    ///@brief Adds the demand of a net with the bounding box bb and the crossing count crossing.
+    void add_net(const t_bb& bb, double crossing) { add_demand(bb, crossing); }
+
+    ///@brief Removes the demand added by add_net() for the same bb and crossing.
+    void remove_net(const t_bb& bb, double crossing) { add_demand(bb, -crossing); }
+
+    ///@brief Recomputes the channel utilization of every tile from the current demand.
+    void update_utilization();
+
+    /**
+     * @brief Returns the congestion cost of a net with the bounding box bb and the crossing
+     *        count crossing, based on the utilization of the last update_utilization().
+     *
+     * It is the wirelength estimate of the net, (w + h) * crossing, times the average channel
+     * overuse (utilization above 1) inside its bounding box, so it is 0 for nets which only
+     * cross channels within their capacity.
+     */
+    double net_congestion_cost(const t_bb& bb, double crossing) const;
+
+    ///@brief The highest channel utilization of the last update_utilization().
+    float max_utilization() const { return max_utilization_; }
+
+    ///@brief The fraction of the channels used above their capacity by the last update_utilization().
+    float overused_fraction() const;
+
+  private:
+    void add_demand(const t_bb& bb, double crossing);
+
+  private:
+    size_t width_ = 0;
+    size_t height_ = 0;
+
+    ///@brief Channel widths, of chanx by row [0..height-1] and of chany by column [0..width-1].
+    std::vector<int> chanx_width_;
+    std::vector<int> chany_width_;
+
+    ///@brief 2D difference arrays of the chanx/chany track demand, [0..width][0..height].
+    vtr::NdMatrix<double, 2> chanx_demand_diff_;
+    vtr::NdMatrix<double, 2> chany_demand_diff_;
+
+    /**
+     * @brief Summed-area table of the channel overuse of the last update_utilization().
+     *
+     * overuse_sums_[x + 1][y + 1] is the overuse of the tiles [0..x][0..y].
+     */
+    vtr::NdMatrix<double, 2> overuse_sums_;
+
+    float max_utilization_ = 0.;
+    size_t num_overused_channels_ = 0;
+};
+
+#endif
@@ -8,6 +8,10 @@
  *  the placement stage of VPR.
  */
 
+#include <algorithm>
+#include <array>
+#include <map>
+
 #include "globals.h"
 #include "place_constraints.h"
 #include "place_util.h"
@@ -202,6 +206,115 @@ void propagate_place_constraints() {
             }
         }
     }
+
+    load_cluster_constraint_bitmaps();
+    load_cluster_legal_compressed_sites();
+}
+
+void load_cluster_constraint_bitmaps() {
+    auto& floorplanning_ctx = g_vpr_ctx.mutable_floorplanning();
+    auto& device_ctx = g_vpr_ctx.device();
+
+    const int width = device_ctx.grid.width();
+    const int height = device_ctx.grid.height();
+    const int num_layers = device_ctx.grid.get_num_layers();
+
+    floorplanning_ctx.cluster_constraint_bitmaps.clear();
+    floorplanning_ctx.cluster_constraint_bitmap_ids.clear();
+    floorplanning_ctx.cluster_constraint_bitmap_ids.resize(floorplanning_ctx.cluster_constraints.size(), OPEN);
+
+    //Blocks constrained to the same partition(s) share their bitmap
+    std::map<std::vector<std::array<int, 5>>, int> bitmap_ids;
+
+    for (ClusterBlockId blk_id : floorplanning_ctx.cluster_constraints.keys()) {
+        const std::vector<Region>& regions = floorplanning_ctx.cluster_constraints[blk_id].get_regions();
+        if (regions.empty()) {
+            continue;
+        }
+
+        //A tile bitmap can't tell sub-tiles apart, so such blocks are checked against their regions
+        bool has_sub_tile = std::any_of(regions.begin(), regions.end(), [](const Region& region) {
+            return region.get_sub_tile() != NO_SUBTILE;
+        });
+        if (has_sub_tile) {
+            continue;
+        }
+
+        std::vector<std::array<int, 5>> key;
+        for (const Region& region : regions) {
+            const RegionRectCoord rect = region.get_region_rect();
+            key.push_back({rect.xmin, rect.ymin, rect.xmax, rect.ymax, rect.layer_num});
+        }
+
+        auto result = bitmap_ids.emplace(key, floorplanning_ctx.cluster_constraint_bitmaps.size());
+        if (result.second) {
+            vtr::dynamic_bitset<> bitmap(size_t(num_layers) * width * height);
+            for (const Region& region : regions) {
+                const RegionRectCoord rect = region.get_region_rect();
+                if (rect.layer_num < 0 || rect.layer_num >= num_layers) {
+                    continue;
+                }
+                for (int x = std::max(rect.xmin, 0); x <= std::min(rect.xmax, width - 1); x++) {
+                    for (int y = std::max(rect.ymin, 0); y <= std::min(rect.ymax, height - 1); y++) {
+                        bitmap.set((size_t(rect.layer_num) * width + x) * height + y, true);
+                    }
+                }
+            }
+            floorplanning_ctx.cluster_constraint_bitmaps.push_back(std::move(bitmap));
+        }
+        floorplanning_ctx.cluster_constraint_bitmap_ids[blk_id] = result.first->second;
+    }
+}
+
+void load_cluster_legal_compressed_sites() {
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+    const auto& floorplanning_ctx = g_vpr_ctx.floorplanning();
+    const auto& cluster_ctx = g_vpr_ctx.clustering();
+    const int num_layers = g_vpr_ctx.device().grid.get_num_layers();
+
+    place_ctx.compressed_legal_sites.clear();
+    place_ctx.cluster_legal_sites_ids.clear();
+    if (place_ctx.compressed_block_grids.empty()) {
+        return;
+    }
+    place_ctx.cluster_legal_sites_ids.resize(floorplanning_ctx.cluster_constraint_bitmap_ids.size(), OPEN);
+
+    //Blocks of the same type sharing a bitmap share their legal sites
+    std::map<std::pair<int, int>, int> legal_sites_ids;
+
+    for (ClusterBlockId blk_id : floorplanning_ctx.cluster_constraint_bitmap_ids.keys()) {
+        int bitmap_id = floorplanning_ctx.cluster_constraint_bitmap_ids[blk_id];
+        if (bitmap_id == OPEN) {
+            continue;
+        }
+
+        t_logical_block_type_ptr type = cluster_ctx.clb_nlist.block_type(blk_id);
+        auto result = legal_sites_ids.emplace(std::make_pair(bitmap_id, type->index), place_ctx.compressed_legal_sites.size());
+        if (result.second) {
+            const auto& compressed_block_grid = place_ctx.compressed_block_grids[type->index];
+
+            t_compressed_legal_sites sites;
+            sites.columns.resize(num_layers);
+            sites.rows.resize(num_layers);
+            for (int layer_num = 0; layer_num < num_layers && layer_num < (int)compressed_block_grid.grid.size(); layer_num++) {
+                for (int cx = 0; cx < (int)compressed_block_grid.get_num_columns(layer_num); cx++) {
+                    std::vector<int> legal_rows;
+                    for (const auto& row : compressed_block_grid.get_column_block_map(cx, layer_num)) {
+                        t_physical_tile_loc grid_loc = compressed_block_grid.compressed_loc_to_grid_loc({cx, row.first, layer_num});
+                        if (cluster_floorplanning_legal(blk_id, t_pl_loc(grid_loc.x, grid_loc.y, 0, layer_num))) {
+                            legal_rows.push_back(row.first);
+                        }
+                    }
+                    if (!legal_rows.empty()) {
+                        sites.columns[layer_num].push_back(cx);
+                        sites.rows[layer_num].push_back(std::move(legal_rows));
+                    }
+                }
+            }
+            place_ctx.compressed_legal_sites.push_back(std::move(sites));
+        }
+        place_ctx.cluster_legal_sites_ids[blk_id] = result.first->second;
+    }
 }
 
 /*returns true if location is compatible with floorplanning constraints, false if not*/
@@ -212,6 +325,21 @@ void propagate_place_constraints() {
 bool cluster_floorplanning_legal(ClusterBlockId blk_id, const t_pl_loc& loc) {
     auto& floorplanning_ctx = g_vpr_ctx.floorplanning();
 
+    //Use the legality bitmap of the block, if it has one
+    if (size_t(blk_id) < floorplanning_ctx.cluster_constraint_bitmap_ids.size()) {
+        int bitmap_id = floorplanning_ctx.cluster_constraint_bitmap_ids[blk_id];
+        if (bitmap_id != OPEN) {
+            const auto& grid = g_vpr_ctx.device().grid;
+            if (loc.layer < 0 || loc.layer >= grid.get_num_layers()
+                || loc.x < 0 || loc.x >= int(grid.width())
+                || loc.y < 0 || loc.y >= int(grid.height())) {
+                return false;
+            }
+            size_t index = (size_t(loc.layer) * grid.width() + loc.x) * grid.height() + loc.y;
+            return floorplanning_ctx.cluster_constraint_bitmaps[bitmap_id].get(index);
+        }
+    }
+
     bool floorplanning_good = false;
 
     bool cluster_constrained = is_cluster_constrained(blk_id);
@@ -220,7 +348,7 @@ bool cluster_floorplanning_legal(ClusterBlockId blk_id, const t_pl_loc& loc) {
         //not constrained so will not have floorplanning issues
         floorplanning_good = true;
     } else {
-        PartitionRegion pr = floorplanning_ctx.cluster_constraints[blk_id];
+        const PartitionRegion& pr = floorplanning_ctx.cluster_constraints[blk_id];
         bool in_pr = pr.is_loc_in_part_reg(loc);
 
         //if location is in partitionregion, floorplanning is respected
@@ -244,26 +372,54 @@ void load_cluster_constraints() {
 
     floorplanning_ctx.cluster_constraints.resize(cluster_ctx.clb_nlist.blocks().size());
 
+    //The bitmaps are built from the final constraints, by propagate_place_constraints()
+    floorplanning_ctx.cluster_constraint_bitmap_ids.clear();
+    floorplanning_ctx.cluster_constraint_bitmaps.clear();
+
+    //Most clusters only hold atoms of one or two partitions, so the intersections
+    //of pairs of partitions are cached
+    std::map<std::pair<PartitionId, PartitionId>, PartitionRegion> partition_intersections;
+
     for (auto cluster_id : cluster_ctx.clb_nlist.blocks()) {
         std::unordered_set<AtomBlockId>* atoms = cluster_to_atoms(cluster_id);
         PartitionRegion empty_pr;
         floorplanning_ctx.cluster_constraints[cluster_id] = empty_pr;
 
+        //The partitions the cluster's PartitionRegion was intersected from
+        std::vector<PartitionId> cluster_partitions;
+
         //if there are any constrained atoms in the cluster,
         //we update the cluster's PartitionRegion
         for (auto atom : *atoms) {
             PartitionId partid = floorplanning_ctx.constraints.get_atom_partition(atom);
 
             if (partid != PartitionId::INVALID()) {
-                PartitionRegion pr = floorplanning_ctx.constraints.get_partition_pr(partid);
+                //Intersecting with the same partition again doesn't change the legal area
+                if (std::find(cluster_partitions.begin(), cluster_partitions.end(), partid) != cluster_partitions.end()) {
+                    continue;
+                }
+
+                const PartitionRegion& pr = floorplanning_ctx.constraints.get_partition_pr(partid);
                 if (floorplanning_ctx.cluster_constraints[cluster_id].empty()) {
                     floorplanning_ctx.cluster_constraints[cluster_id] = pr;
+                    cluster_partitions.push_back(partid);
                 } else {
-                    PartitionRegion intersect_pr = intersection(pr, floorplanning_ctx.cluster_constraints[cluster_id]);
+                    PartitionRegion intersect_pr;
+                    if (cluster_partitions.size() == 1) {
+                        auto key = std::make_pair(partid, cluster_partitions[0]);
+                        auto iter = partition_intersections.find(key);
+                        if (iter == partition_intersections.end()) {
+                            iter = partition_intersections.emplace(key, intersection(pr, floorplanning_ctx.cluster_constraints[cluster_id])).first;
+                        }
+                        intersect_pr = iter->second;
+                    } else {
+                        intersect_pr = intersection(pr, floorplanning_ctx.cluster_constraints[cluster_id]);
+                    }
                     if (intersect_pr.empty()) {
                         VTR_LOG_ERROR("Cluster block %zu has atoms with incompatible floorplan constraints.\n", size_t(cluster_id));
                     } else {
                         floorplanning_ctx.cluster_constraints[cluster_id] = intersect_pr;
+                        cluster_partitions.push_back(partid);
                     }
                 }
             }
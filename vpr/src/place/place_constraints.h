@@ -63,6 +63,20 @@ PartitionRegion update_macro_member_pr(PartitionRegion& head_pr, const t_pl_offs
  */
 void propagate_place_constraints();
 
+/*
+ * Builds the floorplan legality bitmaps of the cluster constraints (see FloorplanningContext),
+ * which let cluster_floorplanning_legal() check a location without scanning the regions of the block.
+ * This is done by propagate_place_constraints(), and must be redone whenever the cluster constraints change.
+ */
+void load_cluster_constraint_bitmaps();
+
+/*
+ * Builds the compressed grid locations which are legal for each constrained block (see PlacementContext),
+ * from the legality bitmaps of the cluster constraints. This is done by propagate_place_constraints(),
+ * once the compressed block grids exist.
+ */
+void load_cluster_legal_compressed_sites();
+
 void print_macro_constraint_error(const t_pl_macro& pl_macro);
 
 inline bool floorplan_legal(const t_pl_blocks_to_be_moved& blocks_affected) {
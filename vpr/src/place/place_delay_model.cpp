@@ -4,6 +4,7 @@
  *        routines related to the placer delay model.
  */
 
+#include <cmath>
 #include <queue>
 #include "place_delay_model.h"
 #include "globals.h"
@@ -89,11 +90,16 @@ float OverrideDelayModel::delay(const t_physical_tile_loc& from_loc, int from_pi
     override_key.delta_y = to_loc.y - from_loc.y;
 
     float delay_val = std::numeric_limits<float>::quiet_NaN();
-    auto override_iter = delay_overrides_.find(override_key);
-    if (override_iter != delay_overrides_.end()) {
-        //Found an override
-        delay_val = override_iter->second;
+    if (override_lookup_valid_) {
+        delay_val = find_delay_override(override_key);
     } else {
+        auto override_iter = delay_overrides_.find(override_key);
+        if (override_iter != delay_overrides_.end()) {
+            delay_val = override_iter->second;
+        }
+    }
+
+    if (std::isnan(delay_val)) {
         //Fall back to the base delay model if no override was found
         delay_val = base_delay_model_->delay(from_loc, from_pin, to_loc, to_pin);
     }
@@ -101,6 +107,99 @@ float OverrideDelayModel::delay(const t_physical_tile_loc& from_loc, int from_pi
     return delay_val;
 }
 
+float OverrideDelayModel::find_delay_override(const t_override& key) const {
+    constexpr float NO_OVERRIDE = std::numeric_limits<float>::quiet_NaN();
+
+    if (size_t(key.from_type) >= override_type_pairs_.dim_size(0) || size_t(key.to_type) >= override_type_pairs_.dim_size(1)) {
+        return NO_OVERRIDE;
+    }
+    int class_pairs_index = override_type_pairs_[key.from_type][key.to_type];
+    if (class_pairs_index == OPEN) {
+        return NO_OVERRIDE;
+    }
+
+    const auto& class_pairs = override_class_pairs_[class_pairs_index];
+    if (size_t(key.from_class) >= class_pairs.dim_size(0) || size_t(key.to_class) >= class_pairs.dim_size(1)) {
+        return NO_OVERRIDE;
+    }
+    int deltas_index = class_pairs[key.from_class][key.to_class];
+    if (deltas_index == OPEN) {
+        return NO_OVERRIDE;
+    }
+
+    const auto& deltas = override_deltas_[deltas_index];
+    size_t delta_x = key.delta_x - deltas.delta_x_min;
+    size_t delta_y = key.delta_y - deltas.delta_y_min;
+    if (delta_x >= deltas.delays.dim_size(0) || delta_y >= deltas.delays.dim_size(1)) {
+        return NO_OVERRIDE;
+    }
+    return deltas.delays[delta_x][delta_y];
+}
+
+void OverrideDelayModel::build_override_lookup() {
+    override_class_pairs_.clear();
+    override_deltas_.clear();
+
+    int max_type = -1;
+    for (const auto& kv : delay_overrides_) {
+        max_type = std::max<int>({max_type, kv.first.from_type, kv.first.to_type});
+    }
+    override_type_pairs_.resize({size_t(max_type + 1), size_t(max_type + 1)}, OPEN);
+
+    //delay_overrides_ is sorted by (from_type, to_type, from_class, to_class), so all the overrides
+    //of a type pair, and of a class pair within it, are contiguous
+    auto begin = delay_overrides_.begin();
+    while (begin != delay_overrides_.end()) {
+        const t_override& first_key = begin->first;
+        auto end = std::find_if(begin, delay_overrides_.end(), [&](const auto& kv) {
+            return kv.first.from_type != first_key.from_type || kv.first.to_type != first_key.to_type;
+        });
+
+        int max_from_class = 0;
+        int max_to_class = 0;
+        for (auto iter = begin; iter != end; ++iter) {
+            max_from_class = std::max<int>(max_from_class, iter->first.from_class);
+            max_to_class = std::max<int>(max_to_class, iter->first.to_class);
+        }
+
+        override_type_pairs_[first_key.from_type][first_key.to_type] = override_class_pairs_.size();
+        override_class_pairs_.emplace_back(std::array<size_t, 2>{size_t(max_from_class + 1), size_t(max_to_class + 1)}, OPEN);
+        auto& class_pairs = override_class_pairs_.back();
+
+        while (begin != end) {
+            const t_override& class_key = begin->first;
+            auto class_end = std::find_if(begin, end, [&](const auto& kv) {
+                return kv.first.from_class != class_key.from_class || kv.first.to_class != class_key.to_class;
+            });
+
+            t_override_deltas deltas;
+            int delta_x_max = class_key.delta_x;
+            int delta_y_max = class_key.delta_y;
+            deltas.delta_x_min = class_key.delta_x;
+            deltas.delta_y_min = class_key.delta_y;
+            for (auto iter = begin; iter != class_end; ++iter) {
+                deltas.delta_x_min = std::min<int>(deltas.delta_x_min, iter->first.delta_x);
+                deltas.delta_y_min = std::min<int>(deltas.delta_y_min, iter->first.delta_y);
+                delta_x_max = std::max<int>(delta_x_max, iter->first.delta_x);
+                delta_y_max = std::max<int>(delta_y_max, iter->first.delta_y);
+            }
+
+            deltas.delays.resize({size_t(delta_x_max - deltas.delta_x_min + 1), size_t(delta_y_max - deltas.delta_y_min + 1)},
+                                 std::numeric_limits<float>::quiet_NaN());
+            for (auto iter = begin; iter != class_end; ++iter) {
+                deltas.delays[iter->first.delta_x - deltas.delta_x_min][iter->first.delta_y - deltas.delta_y_min] = iter->second;
+            }
+
+            class_pairs[class_key.from_class][class_key.to_class] = override_deltas_.size();
+            override_deltas_.push_back(std::move(deltas));
+
+            begin = class_end;
+        }
+    }
+
+    override_lookup_valid_ = true;
+}
+
 void OverrideDelayModel::set_delay_override(int from_type, int from_class, int to_type, int to_class, int delta_x, int delta_y, float delay_val) {
     t_override override_key;
     override_key.from_type = from_type;
@@ -114,6 +213,9 @@ void OverrideDelayModel::set_delay_override(int from_type, int from_class, int t
     if (!res.second) {                 //Key already exists
         res.first->second = delay_val; //Overwrite existing delay
     }
+
+    //The dense look-up must be re-built to include the new override
+    override_lookup_valid_ = false;
 }
 
 void OverrideDelayModel::dump_echo(std::string filepath) const {
@@ -149,6 +251,14 @@ float OverrideDelayModel::get_delay_override(int from_type, int from_class, int
     key.delta_x = delta_x;
     key.delta_y = delta_y;
 
+    if (override_lookup_valid_) {
+        float delay_val = find_delay_override(key);
+        if (std::isnan(delay_val)) {
+            VPR_THROW(VPR_ERROR_PLACE, "Key not found.");
+        }
+        return delay_val;
+    }
+
     auto iter = delay_overrides_.find(key);
     if (iter == delay_overrides_.end()) {
         VPR_THROW(VPR_ERROR_PLACE, "Key not found.");
@@ -294,6 +404,8 @@ void OverrideDelayModel::read(const std::string& file) {
     }
 
     delay_overrides_ = vtr::make_flat_map2(std::move(overrides_arr));
+
+    build_override_lookup();
 }
 
 void OverrideDelayModel::write(const std::string& file) const {
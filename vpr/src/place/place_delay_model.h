@@ -161,6 +161,14 @@ class OverrideDelayModel : public PlaceDelayModel {
     void compute_override_delay_model(RouterDelayProfiler& router,
                                       const t_router_opts& router_opts);
 
+    /**
+     * @brief Builds the dense look-up of the delay overrides from delay_overrides_.
+     *
+     * Until it is (re-)built, e.g. while overrides are being set, delay() falls back
+     * to searching delay_overrides_.
+     */
+    void build_override_lookup();
+
     /**
      * @brief Structure that allows delays to be queried from the delay model.
      *
@@ -214,6 +222,28 @@ class OverrideDelayModel : public PlaceDelayModel {
      */
     vtr::flat_map2<t_override, float> delay_overrides_;
 
+    /**
+     * @brief Dense look-up of delay_overrides_, so delay() is a few array accesses.
+     *
+     * override_type_pairs_[from_type][to_type] indexes (or is OPEN if there are no overrides
+     * between the types) override_class_pairs_, whose [from_class][to_class] entry indexes
+     * (or is OPEN) override_deltas_, which holds the override delays of a (from_type,
+     * from_class, to_type, to_class) over the bounding box of its (delta_x, delta_y), with
+     * NaN where there is no override.
+     */
+    struct t_override_deltas {
+        int delta_x_min = 0;
+        int delta_y_min = 0;
+        vtr::NdMatrix<float, 2> delays;
+    };
+    bool override_lookup_valid_ = false;
+    vtr::NdMatrix<int, 2> override_type_pairs_;
+    std::vector<vtr::NdMatrix<int, 2>> override_class_pairs_;
+    std::vector<t_override_deltas> override_deltas_;
+
+    ///@brief Returns the override delay of the key from the dense look-up, or NaN if there is none
+    float find_delay_override(const t_override& key) const;
+
     /**
      * operator< treats memory layout of t_override as an array of short.
      * This requires all members of t_override are shorts and there is no
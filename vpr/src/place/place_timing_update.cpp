@@ -3,6 +3,10 @@
  * @brief Defines the routines declared in place_timing_update.h.
  */
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 #include "vtr_time.h"
 
 #include "placer_globals.h"
@@ -62,6 +66,8 @@ void initialize_timing_info(const PlaceCritParams& crit_params,
     p_runtime_ctx.f_update_td_costs_nets_elapsed_sec = 0.f;
     p_runtime_ctx.f_update_td_costs_sum_nets_elapsed_sec = 0.f;
     p_runtime_ctx.f_update_td_costs_total_elapsed_sec = 0.f;
+    p_runtime_ctx.accepted_move_timing_updates = 0;
+    p_runtime_ctx.accepted_move_timing_update_nodes = 0;
 }
 
 /**
@@ -252,6 +258,7 @@ void update_td_costs(const PlaceDelayModel* delay_model, const PlacerCriticaliti
     //Update the modified pin timing costs
     {
         vtr::Timer timer;
+        std::vector<PlacerTimingCosts::ConnectionCost> new_timing_costs;
         auto clb_pins_modified = place_crit.pins_with_modified_criticality();
         for (ClusterPinId clb_pin : clb_pins_modified) {
             if (clb_nlist.pin_type(clb_pin) == PinType::DRIVER) continue;
@@ -264,11 +271,24 @@ void update_td_costs(const PlaceDelayModel* delay_model, const PlacerCriticaliti
             int ipin = clb_nlist.pin_net_index(clb_pin);
             VTR_ASSERT_SAFE(ipin >= 1 && ipin < int(clb_nlist.net_pins(clb_net).size()));
 
-            double new_timing_cost = comp_td_connection_cost(delay_model, place_crit, clb_net, ipin);
+            new_timing_costs.push_back({clb_net, ipin, 0.});
+        }
 
-            //Record new value
-            connection_timing_cost[clb_net][ipin] = new_timing_cost;
+        //The connection costs only read the delays and criticalities
+        auto compute_timing_cost = [&](size_t iconn) {
+            auto& new_timing_cost = new_timing_costs[iconn];
+            new_timing_cost.cost = comp_td_connection_cost(delay_model, place_crit, new_timing_cost.net, new_timing_cost.ipin);
+        };
+#ifdef VPR_USE_TBB
+        tbb::parallel_for(size_t(0), new_timing_costs.size(), compute_timing_cost);
+#else
+        for (size_t iconn = 0; iconn < new_timing_costs.size(); ++iconn) {
+            compute_timing_cost(iconn);
         }
+#endif
+
+        //Record new values
+        connection_timing_cost.set_connection_costs(new_timing_costs);
 
         p_runtime_ctx.f_update_td_costs_connections_elapsed_sec += timer.elapsed_sec();
     }
@@ -308,18 +328,41 @@ void comp_td_costs(const PlaceDelayModel* delay_model, const PlacerCriticalities
     auto& connection_timing_cost = p_timing_ctx.connection_timing_cost;
     auto& net_timing_cost = p_timing_ctx.net_timing_cost;
 
+    std::vector<PlacerTimingCosts::ConnectionCost> new_timing_costs;
     for (auto net_id : cluster_ctx.clb_nlist.nets()) {
         if (cluster_ctx.clb_nlist.net_is_ignored(net_id)) continue;
 
         for (size_t ipin = 1; ipin < cluster_ctx.clb_nlist.net_pins(net_id).size(); ipin++) {
-            float conn_timing_cost = comp_td_connection_cost(delay_model, place_crit, net_id, ipin);
+            new_timing_costs.push_back({net_id, int(ipin), 0.});
+        }
+    }
 
-            /* Record new value */
-            connection_timing_cost[net_id][ipin] = conn_timing_cost;
+    /* As in update_td_costs(), the connection costs are computed in parallel, *
+     * but recorded as one batch since the cost tree is shared by all nets     */
+    auto compute_timing_cost = [&](size_t iconn) {
+        auto& new_timing_cost = new_timing_costs[iconn];
+        new_timing_cost.cost = float(comp_td_connection_cost(delay_model, place_crit, new_timing_cost.net, new_timing_cost.ipin));
+    };
+    /* Store net timing cost for more efficient incremental updating */
+    auto compute_net_timing_cost = [&](size_t inet) {
+        ClusterNetId net_id(inet);
+        if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+            net_timing_cost[net_id] = sum_td_net_cost(net_id);
         }
-        /* Store net timing cost for more efficient incremental updating */
-        net_timing_cost[net_id] = sum_td_net_cost(net_id);
+    };
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), new_timing_costs.size(), compute_timing_cost);
+    connection_timing_cost.set_connection_costs(new_timing_costs);
+    tbb::parallel_for(size_t(0), cluster_ctx.clb_nlist.nets().size(), compute_net_timing_cost);
+#else
+    for (size_t iconn = 0; iconn < new_timing_costs.size(); ++iconn) {
+        compute_timing_cost(iconn);
     }
+    connection_timing_cost.set_connection_costs(new_timing_costs);
+    for (size_t inet = 0; inet < cluster_ctx.clb_nlist.nets().size(); ++inet) {
+        compute_net_timing_cost(inet);
+    }
+#endif
     /* Make sure timing cost does not go above MIN_TIMING_COST. */
     *timing_cost = sum_td_costs();
 }
@@ -62,6 +62,9 @@ struct NocCostTerms {
  *   @param cost The weighted average of the wiring cost and the timing cost.
  *   @param bb_cost The bounding box cost, aka the wiring cost.
  *   @param timing_cost The timing cost, which is connection delay * criticality.
+ *   @param congestion_cost The RUDY routing congestion cost of the nets (see
+ *              PlacerCongestionMap). Only computed when --place_congestion_weight
+ *              is positive, and normalized with bb_cost_norm.
  *
  *   @param bb_cost_norm The normalization factor for the wiring cost.
  *   @param timing_cost_norm The normalization factor for the timing cost, which
@@ -85,6 +88,7 @@ class t_placer_costs {
     double cost = 0.;
     double bb_cost = 0.;
     double timing_cost = 0.;
+    double congestion_cost = 0.;
     double bb_cost_norm = 0.;
     double timing_cost_norm = 0.;
 
@@ -11,6 +11,10 @@
 #include "vpr_context.h"
 #include "vpr_net_pins_matrix.h"
 #include "timing_place.h"
+#include "move_utils.h"
+#include "place_congestion.h"
+
+#include <unordered_set>
 
 /**
  * @brief State relating to the timing driven data.
@@ -74,6 +78,17 @@ struct PlacerTimingContext : public Context {
      * Index range: [0..cluster_ctx.clb_nlist.nets().size()-1]
      */
     vtr::vector<ClusterNetId, double> net_timing_cost;
+
+    /**
+     * @brief Sink indices (ascending) of the connections used to estimate the timing cost
+     *        change of moving the driver of each high-fanout net.
+     *
+     * Empty for nets whose connections are all evaluated, which is every net unless
+     * --place_timing_sample_fanout is set.
+     *
+     * Index range: [0..cluster_ctx.clb_nlist.nets().size()-1]
+     */
+    vtr::vector<ClusterNetId, std::vector<int>> sampled_sink_ipins;
 };
 
 /**
@@ -84,6 +99,20 @@ struct PlacerRuntimeContext : public Context {
     float f_update_td_costs_nets_elapsed_sec;
     float f_update_td_costs_sum_nets_elapsed_sec;
     float f_update_td_costs_total_elapsed_sec;
+
+    // Timing analyses triggered by --place_timing_update_accepted_moves, and how many
+    // timing graph nodes they updated in total (out of num_nodes for each analysis)
+    size_t accepted_move_timing_updates = 0;
+    size_t accepted_move_timing_update_nodes = 0;
+};
+
+/**
+ * @brief Sum of the sink pin coordinates of a net, maintained incrementally as moves are committed
+ */
+struct t_net_sink_coord_sum {
+    int64_t x = 0;
+    int64_t y = 0;
+    int64_t layer = 0;
 };
 
 /**
@@ -106,6 +135,14 @@ struct PlacerMoveContext : public Context {
     // [0..cluster_ctx.clb_nlist.nets().size()-1]. Store the number of blocks on each layer ()
     vtr::Matrix<int> num_sink_pin_layer;
 
+    // [0..cluster_ctx.clb_nlist.pins().size()-1]. Coordinates of each sink pin (as returned by get_coordinate_of_pin())
+    // for the committed block positions. Only valid for pins of nets that are not ignored.
+    vtr::vector<ClusterPinId, t_physical_tile_loc> sink_pin_coords;
+
+    // [0..cluster_ctx.clb_nlist.nets().size()-1]. Sum of the sink_pin_coords of each net, so that the centroid move
+    // can account for all sinks of a net driven by the moving block without visiting each of them
+    vtr::vector<ClusterNetId, t_net_sink_coord_sum> net_sink_coord_sums;
+
     // The first range limit calculated by the anneal
     float first_rlim;
 
@@ -119,6 +156,112 @@ struct PlacerMoveContext : public Context {
 
     // Container to save the highly critical pins (higher than a timing criticality limit setted by commandline option)
     std::vector<std::pair<ClusterNetId, int>> highly_crit_pins;
+
+    // RUDY estimate of the channel demand of the committed net bounding boxes. Only maintained when
+    // the congestion cost is enabled (--place_congestion_weight > 0)
+    PlacerCongestionMap congestion_map;
+};
+
+/**
+ * @brief Wirelength (bounding box) cost state of the nets
+ *
+ * These are allocated from the placement stage arena (PlacementContext::stage_arena).
+ */
+struct PlacerCostContext : public Context {
+    // [0..cluster_ctx.clb_nlist.nets().size()-1]. Cost of each net for the committed block positions
+    vtr::vector<ClusterNetId, double, vtr::arena_allocator<double>> net_cost;
+
+    // [0..cluster_ctx.clb_nlist.nets().size()-1]. Cost of each net affected by the proposed move.
+    // Negative for nets the move does not affect.
+    vtr::vector<ClusterNetId, double, vtr::arena_allocator<double>> proposed_net_cost;
+
+    /**
+     * @brief Whether the bounding box of each net has been updated by the proposed move.
+     *
+     * If it has been updated before, the updated data must be used instead of the out of date
+     * data in PlacerMoveContext. NOT_UPDATED_YET indicates that the net has not been updated,
+     * UPDATED_ONCE that it has been updated once; if it is updated again, the values from the
+     * previous update must be used. GOT_FROM_SCRATCH is only applicable for nets larger than
+     * SMALL_NET and indicates that the bounding box could not be updated incrementally and was
+     * computed from scratch, so it is right and must NOT be updated again.
+     * Stored as char for memory efficiency.
+     *
+     * Index range: [0..cluster_ctx.clb_nlist.nets().size()-1]
+     */
+    vtr::vector<ClusterNetId, char, vtr::arena_allocator<char>> bb_updated_before;
+
+    // [0..cluster_ctx.clb_nlist.nets().size()-1]. Congestion cost of each net for the committed block positions,
+    // priced against the congestion map of the last update_utilization(). Only used with the congestion cost enabled.
+    vtr::vector<ClusterNetId, double, vtr::arena_allocator<double>> net_congestion_cost;
+
+    // [0..cluster_ctx.clb_nlist.nets().size()-1]. Congestion cost of each net affected by the proposed move.
+    vtr::vector<ClusterNetId, double, vtr::arena_allocator<double>> proposed_net_congestion_cost;
+
+    /**
+     * @brief The inverse of the average number of tracks per channel between [subhigh] and [sublow].
+     *
+     * Access them as chan?_place_cost_fac[subhigh][sublow]. They are used to speed up the
+     * computation of the cost function that takes the length of the net bounding box in each
+     * dimension, divided by the average number of tracks in that direction.
+     */
+    vtr::NdMatrix<float, 2, vtr::arena_allocator<float>> chanx_place_cost_fac{{0, 0}}; //[0...device_ctx.grid.width()-2]
+    vtr::NdMatrix<float, 2, vtr::arena_allocator<float>> chany_place_cost_fac{{0, 0}}; //[0...device_ctx.grid.height()-2]
+};
+
+/**
+ * @brief A move proposed as part of a batch of moves evaluated together
+ *
+ * Holds the scratch data PlacerSwapContext keeps for the single move of try_swap().
+ */
+struct t_batched_move {
+    explicit t_batched_move(size_t max_blocks)
+        : blocks_affected(max_blocks) {}
+
+    t_pl_blocks_to_be_moved blocks_affected;
+    t_propose_action proposed_action{e_move_type::UNIFORM, -1};
+    size_t action_id = 0;
+    e_create_move create_move_outcome = e_create_move::ABORT;
+    std::vector<ClusterNetId> nets_to_update;
+    int num_nets_affected = 0;
+    double bb_delta_c = 0.;
+    double timing_delta_c = 0.;
+};
+
+/**
+ * @brief Scratch data used to evaluate proposed moves, and the move counts
+ */
+struct PlacerSwapContext : public Context {
+    // [0..cluster_ctx.clb_nlist.nets().size()-1]. New bounding boxes of the nets affected by the proposed move
+    vtr::vector<ClusterNetId, t_bb> ts_bb_edge_new;
+    vtr::vector<ClusterNetId, t_bb> ts_bb_coord_new;
+    vtr::vector<ClusterNetId, std::vector<t_2D_bb>> layer_ts_bb_edge_new;
+    vtr::vector<ClusterNetId, std::vector<t_2D_bb>> layer_ts_bb_coord_new;
+    vtr::Matrix<int> ts_layer_sink_pin_count;
+
+    // The nets affected by the proposed move
+    std::vector<ClusterNetId> ts_nets_to_update;
+
+    /**
+     * @brief Moves of the current batch (see --place_parallel_moves)
+     *
+     * There is one more entry than the batch size: the last one holds a move deferred
+     * to the next batch because it conflicted with one of the current batch.
+     */
+    std::vector<t_batched_move> batched_moves;
+    bool has_deferred_move = false;
+
+    // Moves of one batch must not share blocks, locations or nets. The batch which last
+    // claimed each block/net is recorded, so nothing needs to be cleared between batches.
+    vtr::vector<ClusterBlockId, int> block_batch_stamp;
+    vtr::vector<ClusterNetId, int> net_batch_stamp;
+    std::unordered_set<t_pl_loc> batch_locs;
+    int batch_stamp = 0;
+
+    // Number of moves rejected, accepted or aborted. The total number of move attempts is their sum.
+    int num_swap_rejected = 0;
+    int num_swap_accepted = 0;
+    int num_swap_aborted = 0;
+    int num_ts_called = 0;
 };
 
 /**
@@ -145,8 +288,16 @@ class PlacerContext : public Context {
     const PlacerMoveContext& move() const { return move_; }
     PlacerMoveContext& mutable_move() { return move_; }
 
+    const PlacerCostContext& cost() const { return cost_; }
+    PlacerCostContext& mutable_cost() { return cost_; }
+
+    const PlacerSwapContext& swap() const { return swap_; }
+    PlacerSwapContext& mutable_swap() { return swap_; }
+
   private:
     PlacerTimingContext timing_;
     PlacerRuntimeContext runtime_;
     PlacerMoveContext move_;
+    PlacerCostContext cost_;
+    PlacerSwapContext swap_;
 };
@@ -106,12 +106,27 @@ std::vector<int> KArmedBanditAgent::get_available_logical_blk_types_() {
 }
 
 void KArmedBanditAgent::process_outcome(double reward, e_reward_function reward_fun) {
-    ++num_action_chosen_[last_action_];
     if (reward_fun == RUNTIME_AWARE || reward_fun == WL_BIASED_RUNTIME_AWARE) {
         e_move_type move_type = action_to_move_type_(last_action_);
         reward /= time_elapsed_[move_type];
     }
 
+    if (update_window_ > 1) {
+        //Only accumulate the reward, the q-table is updated once the window is full
+        pending_reward_sum_[last_action_] += reward;
+        ++pending_num_chosen_[last_action_];
+        if (++num_pending_outcomes_ == update_window_) {
+            apply_pending_outcomes_();
+
+            if (agent_info_file_) {
+                write_agent_info(last_action_, reward);
+            }
+        }
+        return;
+    }
+
+    ++num_action_chosen_[last_action_];
+
     //Determine step size
     float step = 0.;
     if (exp_alpha_ < 0.) {
@@ -127,6 +142,7 @@ void KArmedBanditAgent::process_outcome(double reward, e_reward_function reward_
 
     //Update the estimated value of the last action
     q_[last_action_] += delta_q;
+    update_action_selection_();
 
     //write agent internal q-table and actions into a file for debugging purposes
     //agent_info_file_ variable is a NULL pointer by default
@@ -136,6 +152,37 @@ void KArmedBanditAgent::process_outcome(double reward, e_reward_function reward_
     }
 }
 
+void KArmedBanditAgent::apply_pending_outcomes_() {
+    for (size_t i = 0; i < num_available_actions_; ++i) {
+        size_t num_chosen = pending_num_chosen_[i];
+        if (num_chosen == 0) {
+            continue;
+        }
+        num_action_chosen_[i] += num_chosen;
+        double mean_reward = pending_reward_sum_[i] / num_chosen;
+
+        //Determine step size for the whole window
+        float step = 0.;
+        if (exp_alpha_ < 0.) {
+            //Same result as num_chosen incremental average updates
+            step = (float)num_chosen / (float)num_action_chosen_[i];
+        } else if (exp_alpha_ <= 1) {
+            //num_chosen exponentially weighted updates, each with the mean reward of the window
+            step = 1 - std::pow(1 - exp_alpha_, (float)num_chosen);
+        } else {
+            VTR_ASSERT_MSG(false, "Invalid step size");
+        }
+
+        q_[i] += step * (mean_reward - q_[i]);
+
+        pending_reward_sum_[i] = 0.;
+        pending_num_chosen_[i] = 0;
+    }
+    num_pending_outcomes_ = 0;
+
+    update_action_selection_();
+}
+
 void KArmedBanditAgent::write_agent_info(int last_action, double reward) {
     fseek(agent_info_file_, 0, SEEK_END);
     fprintf(agent_info_file_, "%d,", last_action);
@@ -174,6 +221,44 @@ void KArmedBanditAgent::set_step(float gamma, int move_lim) {
     }
 }
 
+void KArmedBanditAgent::set_update_window(size_t update_window) {
+    VTR_ASSERT(update_window >= 1);
+    update_window_ = update_window;
+    num_pending_outcomes_ = 0;
+    pending_reward_sum_ = std::vector<double>(num_available_actions_, 0.);
+    pending_num_chosen_ = std::vector<size_t>(num_available_actions_, 0);
+}
+
+std::vector<double> KArmedBanditAgent::learned_state() const {
+    //Layout: q_, num_action_chosen_, pending_reward_sum_, pending_num_chosen_ (one entry per action), num_pending_outcomes_
+    std::vector<double> state;
+    state.reserve(4 * num_available_actions_ + 1);
+    state.insert(state.end(), q_.begin(), q_.end());
+    state.insert(state.end(), num_action_chosen_.begin(), num_action_chosen_.end());
+    state.insert(state.end(), pending_reward_sum_.begin(), pending_reward_sum_.end());
+    state.insert(state.end(), pending_num_chosen_.begin(), pending_num_chosen_.end());
+    state.push_back(num_pending_outcomes_);
+    return state;
+}
+
+bool KArmedBanditAgent::set_learned_state(const std::vector<double>& state) {
+    const size_t n = num_available_actions_;
+    if (state.size() != 4 * n + 1 || pending_reward_sum_.size() != n || pending_num_chosen_.size() != n) {
+        return false;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        q_[i] = state[i];
+        num_action_chosen_[i] = state[n + i];
+        pending_reward_sum_[i] = state[2 * n + i];
+        pending_num_chosen_[i] = state[3 * n + i];
+    }
+    num_pending_outcomes_ = state[4 * n];
+
+    update_action_selection_();
+    return true;
+}
+
 int KArmedBanditAgent::agent_to_phy_blk_type(const int idx) {
     return action_logical_blk_type_.at(idx);
 }
@@ -205,6 +290,7 @@ void EpsilonGreedyAgent::init_q_scores_() {
     }
 
     set_epsilon_action_prob();
+    update_action_selection_();
 }
 
 t_propose_action EpsilonGreedyAgent::propose_action() {
@@ -220,11 +306,8 @@ t_propose_action EpsilonGreedyAgent::propose_action() {
     } else {
         /* Greedy (Exploit)
          * For probability 1-epsilon, choose the greedy move_type */
-        auto itr = std::max_element(q_.begin(), q_.end());
-        VTR_ASSERT(itr != q_.end());
-        auto action_type_q_pos = itr - q_.begin();
         //Mark the q_table location that agent used to update its value after processing the move outcome
-        last_action_ = action_type_q_pos;
+        last_action_ = greedy_action_;
     }
 
     t_propose_action proposed_action{action_to_move_type_(last_action_),
@@ -236,6 +319,13 @@ t_propose_action EpsilonGreedyAgent::propose_action() {
     return proposed_action;
 }
 
+void EpsilonGreedyAgent::update_action_selection_() {
+    //The greedy action only changes with the q-table, so it is found here rather than on every proposal
+    auto itr = std::max_element(q_.begin(), q_.end());
+    VTR_ASSERT(itr != q_.end());
+    greedy_action_ = itr - q_.begin();
+}
+
 void EpsilonGreedyAgent::set_epsilon(float epsilon) {
     VTR_LOG("Setting egreedy epsilon: %g\n", epsilon);
     epsilon_ = epsilon;
@@ -293,7 +383,7 @@ void SoftmaxAgent::init_q_scores_() {
 }
 
 t_propose_action SoftmaxAgent::propose_action() {
-    set_action_prob_();
+    //The action probabilities only change with the q-table, so update_action_selection_() keeps them up to date
 
     float p = vtr::frand();
     auto itr = std::lower_bound(cumm_action_prob_.begin(), cumm_action_prob_.end(), p);
@@ -50,6 +50,33 @@ class KArmedBanditAgent {
      */
     void set_step(float gamma, int move_lim);
 
+    /**
+     * @brief Set the number of move outcomes accumulated before the q-table is updated
+     *
+     *   @param update_window With a window of 1 (default), process_outcome() updates the q-table and action
+     *   probabilities after every move. Larger windows only accumulate each reward and update the q-table
+     *   and action probabilities once per window, can be specified by the command-line option
+     *   "--place_agent_update_window"
+     */
+    void set_update_window(size_t update_window);
+
+    /**
+     * @brief Return the agent's q-table, action counts and pending update window as one flat vector,
+     * so that a placement checkpoint can save them
+     */
+    std::vector<double> learned_state() const;
+
+    /**
+     * @brief Restore a state returned by learned_state()
+     *
+     * @return False (leaving the agent unchanged) if the state was saved by an agent with a different number of actions
+     */
+    bool set_learned_state(const std::vector<double>& state);
+
+    ///@brief The action (q-table entry) chosen by the last propose_action(), which process_outcome() updates
+    size_t last_action() const { return last_action_; }
+    void set_last_action(size_t action) { last_action_ = action; }
+
   protected:
     /**
      * @brief Converts an action index to a move type.
@@ -83,6 +110,12 @@ class KArmedBanditAgent {
      */
     inline int agent_to_phy_blk_type(int idx);
 
+    /**
+     * @brief Called whenever the q-table changes, so that the derived agent can update
+     * how it chooses its next actions.
+     */
+    virtual void update_action_selection_() {}
+
   protected:
     float exp_alpha_ = -1;                      //Step size for q_ updates (< 0 implies use incremental average)
     std::vector<e_move_type> available_moves_;  //All available moves from which the agent can choose
@@ -92,6 +125,11 @@ class KArmedBanditAgent {
     std::vector<size_t> num_action_chosen_;     //Number of times each arm has been pulled (n)
     std::vector<float> q_;                      //Estimated value of each arm (Q)
     size_t last_action_;                        //type of the last action (move type) proposed
+
+    size_t update_window_ = 1;                //Number of move outcomes accumulated before the q-table is updated
+    size_t num_pending_outcomes_ = 0;         //Number of move outcomes accumulated in the current window
+    std::vector<double> pending_reward_sum_;  //Sum of the rewards each action received in the current window
+    std::vector<size_t> pending_num_chosen_;  //Number of times each action has been chosen in the current window
     /* Ratios of the average runtime to calculate each move type              */
     /* These ratios are useful for different reward functions                 *
      * The vector is calculated by averaging many runs on different circuits  */
@@ -108,6 +146,11 @@ class KArmedBanditAgent {
      */
     static std::vector<int> get_available_logical_blk_types_();
 
+    /**
+     * @brief Update the q-table with the move outcomes accumulated in the current window
+     */
+    void apply_pending_outcomes_();
+
   private:
     std::vector<int> action_logical_blk_type_;
 };
@@ -146,8 +189,11 @@ class EpsilonGreedyAgent : public KArmedBanditAgent {
      */
     void init_q_scores_();
 
+    void update_action_selection_() override;
+
   private:
     float epsilon_ = 0.1;                         //How often to perform a non-greedy exploration action
+    size_t greedy_action_ = 0;                    //The action with the highest estimated value (Q)
     std::vector<float> cumm_epsilon_action_prob_; //The accumulative probability of choosing each action
 };
 
@@ -184,6 +230,8 @@ class SoftmaxAgent : public KArmedBanditAgent {
      */
     void set_action_prob_();
 
+    void update_action_selection_() override { set_action_prob_(); }
+
   private:
     std::vector<float> exp_q_;            //The clipped and scaled exponential of the estimated Q value for each action
     std::vector<float> action_prob_;      //The probability of choosing each action
@@ -227,6 +275,12 @@ class SimpleRLMoveGenerator : public MoveGenerator {
 
     // Receives feedback about the outcome of the previously proposed move
     void process_outcome(double reward, e_reward_function reward_fun) override;
+
+    size_t proposed_action_id() const override { return karmed_bandit_agent->last_action(); }
+    void set_proposed_action_id(size_t action_id) override { karmed_bandit_agent->set_last_action(action_id); }
+
+    std::vector<double> learned_state() const override { return karmed_bandit_agent->learned_state(); }
+    bool set_learned_state(const std::vector<double>& state) override { return karmed_bandit_agent->set_learned_state(state); }
 };
 
 template<class T, class>
@@ -5,6 +5,11 @@
 
 #include <cstdio>
 #include <cmath>
+#include <vector>
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
 
 #include "vtr_util.h"
 #include "vtr_memory.h"
@@ -61,14 +66,31 @@ void PlacerCriticalities::update_criticalities(const SetupTimingInfo* timing_inf
      * For every pin on every net (or, equivalently, for every tedge ending
      * in that pin), timing_place_crit_ = criticality^(criticality exponent) */
 
+    /* Compute the new criticalities of the affected pins, which are independent of each other.
+     * The placer likes a great deal of contrast between criticalities.
+     * Since path criticality varies much more than timing, we "sharpen" timing
+     * criticality by taking it to some power, crit_exponent (between 1 and 8 by default). */
+    auto modified_pins = cluster_pins_with_modified_criticality_.begin();
+    std::vector<float> new_crits(cluster_pins_with_modified_criticality_.size());
+    auto compute_criticality = [&](size_t ipin) {
+        // Routing for placement is not flat (at least for the time being)
+        float clb_pin_crit = calculate_clb_net_pin_criticality(*timing_info, pin_lookup_, ParentPinId(size_t(modified_pins[ipin])), false);
+        new_crits[ipin] = pow(clb_pin_crit, crit_params.crit_exponent);
+    };
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), new_crits.size(), compute_criticality);
+#else
+    for (size_t ipin = 0; ipin < new_crits.size(); ++ipin) {
+        compute_criticality(ipin);
+    }
+#endif
+
     /* Update the affected pins */
-    for (ClusterPinId clb_pin : cluster_pins_with_modified_criticality_) {
+    for (size_t ipin = 0; ipin < new_crits.size(); ++ipin) {
+        ClusterPinId clb_pin = modified_pins[ipin];
         ClusterNetId clb_net = clb_nlist_.pin_net(clb_pin);
         int pin_index_in_net = clb_nlist_.pin_net_index(clb_pin);
-        // Routing for placement is not flat (at least for the time being)
-        float clb_pin_crit = calculate_clb_net_pin_criticality(*timing_info, pin_lookup_, ParentPinId(size_t(clb_pin)), false);
-
-        float new_crit = pow(clb_pin_crit, crit_params.crit_exponent);
+        float new_crit = new_crits[ipin];
         /*
          * Update the highly critical pins container
          *
@@ -86,9 +108,6 @@ void PlacerCriticalities::update_criticalities(const SetupTimingInfo* timing_inf
                 place_move_ctx.highly_crit_pins.push_back(std::make_pair(clb_net, pin_index_in_net));
         }
 
-        /* The placer likes a great deal of contrast between criticalities.
-         * Since path criticality varies much more than timing, we "sharpen" timing
-         * criticality by taking it to some power, crit_exponent (between 1 and 8 by default). */
         timing_place_crit_[clb_net][pin_index_in_net] = new_crit;
     }
 
@@ -196,15 +215,24 @@ void PlacerSetupSlacks::update_setup_slacks(const SetupTimingInfo* timing_info)
         recompute_setup_slacks();
     }
 
-    /* Update the affected pins */
-    for (ClusterPinId clb_pin : cluster_pins_with_modified_setup_slack_) {
+    /* Update the affected pins, each pin being written to its own entry */
+    auto modified_pins = cluster_pins_with_modified_setup_slack_.begin();
+    auto update_setup_slack = [&](size_t ipin) {
+        ClusterPinId clb_pin = modified_pins[ipin];
         ClusterNetId clb_net = clb_nlist_.pin_net(clb_pin);
         int pin_index_in_net = clb_nlist_.pin_net_index(clb_pin);
 
         float clb_pin_setup_slack = calculate_clb_net_pin_setup_slack(*timing_info, pin_lookup_, clb_pin);
 
         timing_place_setup_slacks_[clb_net][pin_index_in_net] = clb_pin_setup_slack;
+    };
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), cluster_pins_with_modified_setup_slack_.size(), update_setup_slack);
+#else
+    for (size_t ipin = 0; ipin < cluster_pins_with_modified_setup_slack_.size(); ++ipin) {
+        update_setup_slack(ipin);
     }
+#endif
 
     /* Setup slacks updated. In sync with timing info.     */
     /* Can be incrementally updated on the next iteration. */
@@ -35,6 +35,8 @@
  */
 
 #pragma once
+#include <algorithm>
+
 #include "vtr_vec_id_set.h"
 #include "timing_info_fwd.h"
 #include "clustered_netlist_utils.h"
@@ -349,6 +351,10 @@ class PlacerSetupSlacks {
  *
  * PlacerTimingCosts's invalidate() method marks the cost element's ancestors as invalid (NaN)
  * so they will be re-calculated by PlacerTimingCosts' total_cost() method.
+ *
+ * When many connection costs change at once, set_connection_costs() updates them as a batch:
+ * it recomputes the modified intermediate costs one tree level at a time, so the ancestors
+ * shared by the modified connections are only visited once.
  */
 class PlacerTimingCosts {
   public:
@@ -480,6 +486,53 @@ class PlacerTimingCosts {
         return NetProxy(this, net_connection_costs);
     }
 
+    ///@brief The new cost of a single connection, for set_connection_costs().
+    struct ConnectionCost {
+        ClusterNetId net;
+        int ipin;
+        double cost;
+    };
+
+    /**
+     * @brief Sets the costs of a batch of connections and updates the intermediate
+     *        costs above the modified ones.
+     *
+     * The modified intermediate nodes are collected level by level, from the leaves
+     * up to the root, and each is recomputed once however many of its descendants
+     * changed. The sums are the same as those of total_cost().
+     */
+    void set_connection_costs(const std::vector<ConnectionCost>& new_costs) {
+        std::vector<size_t> level_nodes;
+        for (const ConnectionCost& new_cost : new_costs) {
+            VTR_ASSERT_SAFE(net_start_indicies_[new_cost.net] >= 0);
+
+            size_t icost = net_start_indicies_[new_cost.net] + new_cost.ipin;
+            if (new_cost.cost != connection_costs_[icost]) {
+                connection_costs_[icost] = new_cost.cost;
+                level_nodes.push_back(parent(icost));
+            }
+        }
+
+        //All the leaves are in the last level, so each pass handles a single level
+        std::vector<size_t> next_level_nodes;
+        while (!level_nodes.empty()) {
+            std::sort(level_nodes.begin(), level_nodes.end());
+            level_nodes.erase(std::unique(level_nodes.begin(), level_nodes.end()), level_nodes.end());
+
+            next_level_nodes.clear();
+            for (size_t inode : level_nodes) {
+                //Children below an already-invalidated node are recomputed as well
+                connection_costs_[inode] = total_cost_recurr(left_child(inode))
+                                           + total_cost_recurr(right_child(inode));
+
+                if (inode != 0) {
+                    next_level_nodes.push_back(parent(inode));
+                }
+            }
+            std::swap(level_nodes, next_level_nodes);
+        }
+    }
+
     void clear() {
         connection_costs_.clear();
         net_start_indicies_.clear();
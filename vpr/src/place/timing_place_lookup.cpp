@@ -34,6 +34,12 @@
 #include "router_delay_profiling.h"
 #include "place_delay_model.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/enumerable_thread_specific.h>
+#    include <tbb/global_control.h>
+#    include <tbb/parallel_for.h>
+#endif
+
 /*To compute delay between blocks we calculate the delay between */
 /*different nodes in the FPGA.  From this procedure we generate
  * a lookup table which tells us the delay between different locations in*/
@@ -64,6 +70,17 @@ struct t_profile_info {
     int max_delta_y;
 };
 
+//The source location and the range of sink locations of one delta delay computation
+struct t_delta_delay_sample_region {
+    int layer_num;
+    int source_x;
+    int source_y;
+    int start_x;
+    int start_y;
+    int end_x;
+    int end_y;
+};
+
 /*** Function Prototypes *****/
 static t_chan_width setup_chan_width(const t_router_opts& router_opts,
                                      t_chan_width_dist chan_width_dist);
@@ -133,6 +150,9 @@ static vtr::NdMatrix<float, 3> compute_delta_delays(
     size_t longest_length,
     bool is_flat);
 
+static void merge_sampled_delta_delays(vtr::Matrix<std::vector<float>>& matrix,
+                                       const vtr::Matrix<std::vector<float>>& region_matrix);
+
 float delay_reduce(std::vector<float>& delays, e_reducer reducer);
 
 static vtr::NdMatrix<float, 3> compute_delta_delay_model(
@@ -191,8 +211,10 @@ std::unique_ptr<PlaceDelayModel> compute_place_delay_model(const t_placer_opts&
 
     const RouterLookahead* router_lookahead = get_cached_router_lookahead(*det_routing_arch,
                                                                           router_opts.lookahead_type,
+                                                                          router_opts.router_lookahead_half_precision,
                                                                           router_opts.write_router_lookahead,
                                                                           router_opts.read_router_lookahead,
+                                                                          router_opts.router_lookahead_cache_dir,
                                                                           segment_inf,
                                                                           is_flat);
 
@@ -256,6 +278,8 @@ void OverrideDelayModel::compute(
     base_delay_model_ = std::make_unique<DeltaDelayModel>(cross_layer_delay_, delays, false);
 
     compute_override_delay_model(route_profiler, router_opts);
+
+    build_override_lookup();
 }
 
 void SimpleDelayModel::compute(
@@ -441,7 +465,7 @@ static void add_delay_to_matrix(
 }
 
 static void generic_compute_matrix_dijkstra_expansion(
-    RouterDelayProfiler& /*route_profiler*/,
+    RouterDelayProfiler& route_profiler,
     vtr::Matrix<std::vector<float>>& matrix,
     int layer_num,
     int source_x,
@@ -489,7 +513,7 @@ static void generic_compute_matrix_dijkstra_expansion(
         RRNodeId source_rr_node = device_ctx.rr_graph.node_lookup().find_node(layer_num, source_x, source_y, SOURCE, driver_ptc);
 
         VTR_ASSERT(source_rr_node != RRNodeId::INVALID());
-        auto delays = calculate_all_path_delays_from_rr_node(source_rr_node, router_opts, is_flat);
+        auto delays = calculate_all_path_delays_from_rr_node(source_rr_node, router_opts, is_flat, route_profiler.worker_rr_node_route_inf());
 
         bool path_to_all_sinks = true;
         for (int sink_x = start_x; sink_x <= end_x; sink_x++) {
@@ -660,9 +684,30 @@ static vtr::NdMatrix<float, 3> compute_delta_delays(
 
     vtr::NdMatrix<float, 3> delta_delays({static_cast<unsigned long>(grid.get_num_layers()), grid.width(), grid.height()});
 
-    for (int layer_num = 0; layer_num < grid.get_num_layers(); layer_num++) {
-        vtr::Matrix<std::vector<float>> sampled_delta_delays({grid.width(), grid.height()});
+    std::set<std::string> allowed_types;
+    if (!placer_opts.allowed_tiles_for_delay_model.empty()) {
+        auto allowed_types_vector = vtr::split(placer_opts.allowed_tiles_for_delay_model, ",");
+        for (const auto& type : allowed_types_vector) {
+            allowed_types.insert(type);
+        }
+    }
 
+    t_compute_delta_delay_matrix generic_compute_matrix;
+    switch (placer_opts.place_delta_delay_matrix_calculation_method) {
+        case e_place_delta_delay_algorithm::ASTAR_ROUTE:
+            generic_compute_matrix = generic_compute_matrix_iterative_astar;
+            break;
+        case e_place_delta_delay_algorithm::DIJKSTRA_EXPANSION:
+            generic_compute_matrix = generic_compute_matrix_dijkstra_expansion;
+            break;
+        default:
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Unknown place_delta_delay_matrix_calculation_method %d", placer_opts.place_delta_delay_matrix_calculation_method);
+    }
+
+    //The regions to profile, in the order their delays are collected
+    std::vector<t_delta_delay_sample_region> regions;
+
+    for (int layer_num = 0; layer_num < grid.get_num_layers(); layer_num++) {
         size_t mid_x = vtr::nint(grid.width() / 2);
         size_t mid_y = vtr::nint(grid.height() / 2);
 
@@ -677,14 +722,6 @@ static vtr::NdMatrix<float, 3> compute_delta_delays(
             high_y = std::max(grid.height() - longest_length, mid_y);
         }
 
-        std::set<std::string> allowed_types;
-        if (!placer_opts.allowed_tiles_for_delay_model.empty()) {
-            auto allowed_types_vector = vtr::split(placer_opts.allowed_tiles_for_delay_model, ",");
-            for (const auto& type : allowed_types_vector) {
-                allowed_types.insert(type);
-            }
-        }
-
         //   +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
         //   +                 |                       |               +
         //   +        A        |           B           |       C       +
@@ -733,29 +770,11 @@ static vtr::NdMatrix<float, 3> compute_delta_delays(
         }
         VTR_ASSERT(src_type != nullptr);
 
-        t_compute_delta_delay_matrix generic_compute_matrix;
-        switch (placer_opts.place_delta_delay_matrix_calculation_method) {
-            case e_place_delta_delay_algorithm::ASTAR_ROUTE:
-                generic_compute_matrix = generic_compute_matrix_iterative_astar;
-                break;
-            case e_place_delta_delay_algorithm::DIJKSTRA_EXPANSION:
-                generic_compute_matrix = generic_compute_matrix_dijkstra_expansion;
-                break;
-            default:
-                VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Unknown place_delta_delay_matrix_calculation_method %d", placer_opts.place_delta_delay_matrix_calculation_method);
-        }
-
-#ifdef VERBOSE
-        VTR_LOG("Computing from lower left edge (%d,%d):\n", x, y);
-#endif
-        generic_compute_matrix(route_profiler, sampled_delta_delays,
-                               layer_num,
-                               x, y,
-                               x, y,
-                               grid.width() - 1, grid.height() - 1,
-                               router_opts,
-                               measure_directconnect, allowed_types,
-                               is_flat);
+        //Computing from lower left edge
+        regions.push_back({layer_num,
+                           x, y,
+                           x, y,
+                           (int)grid.width() - 1, (int)grid.height() - 1});
 
         //Find the lowest x location on the bottom edge with a non-empty block
         src_type = nullptr;
@@ -776,77 +795,115 @@ static vtr::NdMatrix<float, 3> compute_delta_delays(
             }
         }
         VTR_ASSERT(src_type != nullptr);
-#ifdef VERBOSE
-        VTR_LOG("Computing from left bottom edge (%d,%d):\n", x, y);
-#endif
-        generic_compute_matrix(route_profiler, sampled_delta_delays,
-                               layer_num,
-                               x, y,
-                               x, y,
-                               grid.width() - 1, grid.height() - 1,
-                               router_opts,
-                               measure_directconnect, allowed_types,
-                               is_flat);
+
+        //Computing from left bottom edge
+        regions.push_back({layer_num,
+                           x, y,
+                           x, y,
+                           (int)grid.width() - 1, (int)grid.height() - 1});
 
         //Since the other delta delay values may have suffered from edge effects,
         //we recalculate deltas within regions B, C, E, F
-#ifdef VERBOSE
-        VTR_LOG("Computing from low/low:\n");
-#endif
-        generic_compute_matrix(route_profiler, sampled_delta_delays,
-                               layer_num,
-                               low_x, low_y,
-                               low_x, low_y,
-                               grid.width() - 1, grid.height() - 1,
-                               router_opts,
-                               measure_directconnect, allowed_types,
-                               is_flat);
+        regions.push_back({layer_num,
+                           (int)low_x, (int)low_y,
+                           (int)low_x, (int)low_y,
+                           (int)grid.width() - 1, (int)grid.height() - 1});
 
         //Since the other delta delay values may have suffered from edge effects,
         //we recalculate deltas within regions D, E, G, H
-#ifdef VERBOSE
-        VTR_LOG("Computing from high/high:\n");
-#endif
-        generic_compute_matrix(route_profiler, sampled_delta_delays,
-                               layer_num,
-                               high_x, high_y,
-                               0, 0,
-                               high_x, high_y,
-                               router_opts,
-                               measure_directconnect, allowed_types,
-                               is_flat);
+        regions.push_back({layer_num,
+                           (int)high_x, (int)high_y,
+                           0, 0,
+                           (int)high_x, (int)high_y});
 
         //Since the other delta delay values may have suffered from edge effects,
         //we recalculate deltas within regions A, B, D, E
-#ifdef VERBOSE
-        VTR_LOG("Computing from high/low:\n");
-#endif
-        generic_compute_matrix(route_profiler, sampled_delta_delays,
-                               layer_num,
-                               high_x, low_y,
-                               0, low_y,
-                               high_x, grid.height() - 1,
-                               router_opts,
-                               measure_directconnect, allowed_types,
-                               is_flat);
+        regions.push_back({layer_num,
+                           (int)high_x, (int)low_y,
+                           0, (int)low_y,
+                           (int)high_x, (int)grid.height() - 1});
 
         //Since the other delta delay values may have suffered from edge effects,
         //we recalculate deltas within regions E, F, H, I
+        regions.push_back({layer_num,
+                           (int)low_x, (int)high_y,
+                           (int)low_x, 0,
+                           (int)grid.width() - 1, (int)high_y});
+    }
+
+    //Each A* route is independent, so split those regions into one column of sinks each
+    //to spread the work evenly. A Dijkstra expansion covers its whole region at once.
+    if (placer_opts.place_delta_delay_matrix_calculation_method == e_place_delta_delay_algorithm::ASTAR_ROUTE) {
+        std::vector<t_delta_delay_sample_region> column_regions;
+        for (const t_delta_delay_sample_region& region : regions) {
+            for (int sink_x = region.start_x; sink_x <= region.end_x; sink_x++) {
+                t_delta_delay_sample_region column_region = region;
+                column_region.start_x = sink_x;
+                column_region.end_x = sink_x;
+                column_regions.push_back(column_region);
+            }
+        }
+        regions = std::move(column_regions);
+    }
+
+    std::vector<vtr::Matrix<std::vector<float>>> sampled_delta_delays(grid.get_num_layers(), vtr::Matrix<std::vector<float>>({grid.width(), grid.height()}));
+
+    auto compute_region = [&](const t_delta_delay_sample_region& region, RouterDelayProfiler& profiler, vtr::Matrix<std::vector<float>>& matrix) {
 #ifdef VERBOSE
-        VTR_LOG("Computing from low/high:\n");
+        VTR_LOG("Computing from (%d,%d,%d):\n", region.source_x, region.source_y, region.layer_num);
 #endif
-        generic_compute_matrix(route_profiler, sampled_delta_delays,
-                               layer_num,
-                               low_x, high_y,
-                               low_x, 0,
-                               grid.width() - 1, high_y,
+        generic_compute_matrix(profiler, matrix,
+                               region.layer_num,
+                               region.source_x, region.source_y,
+                               region.start_x, region.start_y,
+                               region.end_x, region.end_y,
                                router_opts,
                                measure_directconnect, allowed_types,
                                is_flat);
+    };
+
+    size_t num_workers = 1;
+#ifdef VPR_USE_TBB
+    num_workers = tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism);
+#endif
 
-        for (size_t dx = 0; dx < sampled_delta_delays.dim_size(0); ++dx) {
-            for (size_t dy = 0; dy < sampled_delta_delays.dim_size(1); ++dy) {
-                delta_delays[layer_num][dx][dy] = delay_reduce(sampled_delta_delays[dx][dy], placer_opts.delay_model_reducer);
+    if (num_workers <= 1) {
+        for (const t_delta_delay_sample_region& region : regions) {
+            compute_region(region, route_profiler, sampled_delta_delays[region.layer_num]);
+        }
+    } else {
+#ifdef VPR_USE_TBB
+        //Every region is profiled into its own matrix by a worker with its own profiler, and the
+        //matrices are then merged in region order, so the delays collected at each delta (and hence
+        //the reduced delay) are the same as when computing serially. Regions are processed in
+        //windows to bound the number of region matrices alive at once.
+        update_rr_base_costs(1);
+        tbb::enumerable_thread_specific<std::unique_ptr<RouterDelayProfiler>> worker_profilers([&]() {
+            return route_profiler.make_worker();
+        });
+
+        const size_t window_size = 4 * num_workers;
+        std::vector<vtr::Matrix<std::vector<float>>> region_delays(window_size);
+        for (size_t window_begin = 0; window_begin < regions.size(); window_begin += window_size) {
+            size_t window_end = std::min(window_begin + window_size, regions.size());
+
+            tbb::parallel_for(window_begin, window_end, [&](size_t iregion) {
+                vtr::Matrix<std::vector<float>>& matrix = region_delays[iregion - window_begin];
+                matrix = vtr::Matrix<std::vector<float>>({grid.width(), grid.height()});
+                compute_region(regions[iregion], *worker_profilers.local(), matrix);
+            });
+
+            for (size_t iregion = window_begin; iregion < window_end; iregion++) {
+                merge_sampled_delta_delays(sampled_delta_delays[regions[iregion].layer_num], region_delays[iregion - window_begin]);
+            }
+        }
+#endif
+    }
+
+    for (int layer_num = 0; layer_num < grid.get_num_layers(); layer_num++) {
+        for (size_t dx = 0; dx < sampled_delta_delays[layer_num].dim_size(0); ++dx) {
+            for (size_t dy = 0; dy < sampled_delta_delays[layer_num].dim_size(1); ++dy) {
+                delta_delays[layer_num][dx][dy] = delay_reduce(sampled_delta_delays[layer_num][dx][dy], placer_opts.delay_model_reducer);
             }
         }
     }
@@ -854,6 +911,25 @@ static vtr::NdMatrix<float, 3> compute_delta_delays(
     return delta_delays;
 }
 
+static void merge_sampled_delta_delays(vtr::Matrix<std::vector<float>>& matrix,
+                                       const vtr::Matrix<std::vector<float>>& region_matrix) {
+    //Replays the updates the region made to its own (initially empty) matrix onto matrix
+    for (size_t delta_x = 0; delta_x < region_matrix.dim_size(0); delta_x++) {
+        for (size_t delta_y = 0; delta_y < region_matrix.dim_size(1); delta_y++) {
+            for (float delay : region_matrix[delta_x][delta_y]) {
+                if (delay == EMPTY_DELTA) {
+                    if (matrix[delta_x][delta_y].empty()) {
+                        //Only set empty target if we don't already have a valid delta delay
+                        matrix[delta_x][delta_y].push_back(EMPTY_DELTA);
+                    }
+                } else {
+                    add_delay_to_matrix(&matrix, delta_x, delta_y, delay);
+                }
+            }
+        }
+    }
+}
+
 float delay_reduce(std::vector<float>& delays, e_reducer reducer) {
     if (delays.size() == 0) {
         return IMPOSSIBLE_DELTA;
@@ -21,6 +21,8 @@
  */
 
 /************************* INCLUDES *********************************/
+#include <unordered_map>
+
 #include "vtr_assert.h"
 
 #include "power_lowlevel.h"
@@ -34,9 +36,17 @@ static void power_calc_transistor_capacitance(float* C_d, float* C_s, float* C_g
 static float power_calc_leakage_st(e_tx_type transistor_type, float size);
 static float power_calc_leakage_st_pass_transistor(float size, float v_ds);
 static float power_calc_leakage_gate(e_tx_type transistor_type, float size);
+static const t_transistor_size_inf& power_get_transistor_size_inf(e_tx_type transistor_type, float size);
 /*static float power_calc_buffer_sc_levr(
  * t_power_buffer_strength_inf * buffer_strength, int input_mux_size);*/
 
+/************************* GLOBALS **********************************/
+
+/* Interpolated transistor properties, for each transistor size used [NMOS/PMOS].
+ * The architecture only uses a handful of sizes, so each is looked up once rather
+ * than searching and interpolating the technology tables for every component. */
+static std::unordered_map<float, t_transistor_size_inf> f_transistor_size_inf_cache[2];
+
 /************************* FUNCTION DEFINITIONS *********************/
 
 /**
@@ -47,6 +57,11 @@ void power_lowlevel_init() {
 
     auto& power_ctx = g_vpr_ctx.power();
 
+    /* The technology may have changed */
+    for (auto& cache : f_transistor_size_inf_cache) {
+        cache.clear();
+    }
+
     power_calc_transistor_capacitance(&C_d, &C_s, &C_g, NMOS, 1.0);
     power_ctx.commonly_used->NMOS_1X_C_d = C_d;
     power_ctx.commonly_used->NMOS_1X_C_g = C_g;
@@ -236,44 +251,11 @@ void power_calc_inverter_with_input(t_power_usage * power_usage,
  * - size: (W/L) size of the transistor
  */
 static void power_calc_transistor_capacitance(float* C_d, float* C_s, float* C_g, e_tx_type transistor_type, float size) {
-    t_transistor_size_inf* tx_info_lower;
-    t_transistor_size_inf* tx_info_upper;
-    bool error;
-
-    /* Initialize to 0 */
-    *C_d = 0.;
-    *C_s = 0.;
-    *C_g = 0.;
-
-    error = power_find_transistor_info(&tx_info_lower, &tx_info_upper,
-                                       transistor_type, size);
-    if (error) {
-        return;
-    }
-
-    if (tx_info_lower == nullptr) {
-        /* No lower bound */
-        *C_d = tx_info_upper->C_d;
-        *C_s = tx_info_upper->C_s;
-        *C_g = tx_info_upper->C_g;
-    } else if (tx_info_upper == nullptr) {
-        /* No upper bound */
-        *C_d = tx_info_lower->C_d;
-        *C_s = tx_info_lower->C_s;
-        *C_g = tx_info_lower->C_g;
-    } else {
-        /* Linear approximation between sizes */
-        float percent_upper = (size - tx_info_lower->size)
-                              / (tx_info_upper->size - tx_info_lower->size);
-        *C_d = (1 - percent_upper) * tx_info_lower->C_d
-               + percent_upper * tx_info_upper->C_d;
-        *C_s = (1 - percent_upper) * tx_info_lower->C_s
-               + percent_upper * tx_info_upper->C_s;
-        *C_g = (1 - percent_upper) * tx_info_lower->C_g
-               + percent_upper * tx_info_upper->C_g;
-    }
+    const t_transistor_size_inf& tx_info = power_get_transistor_size_inf(transistor_type, size);
 
-    return;
+    *C_d = tx_info.C_d;
+    *C_s = tx_info.C_s;
+    *C_g = tx_info.C_g;
 }
 
 /**
@@ -283,34 +265,8 @@ static void power_calc_transistor_capacitance(float* C_d, float* C_s, float* C_g
  * - size: (W/L) of transistor
  */
 static float power_calc_leakage_st(e_tx_type transistor_type, float size) {
-    t_transistor_size_inf* tx_info_lower;
-    t_transistor_size_inf* tx_info_upper;
-    bool error;
-    float current;
-
-    error = power_find_transistor_info(&tx_info_lower, &tx_info_upper,
-                                       transistor_type, size);
-    if (error) {
-        return 0;
-    }
-
-    if (tx_info_lower == nullptr) {
-        /* No lower bound */
-        current = tx_info_upper->leakage_subthreshold;
-
-    } else if (tx_info_upper == nullptr) {
-        /* No upper bound */
-        current = tx_info_lower->leakage_subthreshold;
-    } else {
-        /* Linear approximation between sizes */
-        float percent_upper = (size - tx_info_lower->size)
-                              / (tx_info_upper->size - tx_info_lower->size);
-        current = (1 - percent_upper) * tx_info_lower->leakage_subthreshold
-                  + percent_upper * tx_info_upper->leakage_subthreshold;
-    }
-
     auto& power_ctx = g_vpr_ctx.power();
-    return current * power_ctx.tech->Vdd;
+    return power_get_transistor_size_inf(transistor_type, size).leakage_subthreshold * power_ctx.tech->Vdd;
 }
 
 /**
@@ -319,34 +275,65 @@ static float power_calc_leakage_st(e_tx_type transistor_type, float size) {
  * - size: (W/L) of transistor
  */
 static float power_calc_leakage_gate(e_tx_type transistor_type, float size) {
+    auto& power_ctx = g_vpr_ctx.power();
+    return power_get_transistor_size_inf(transistor_type, size).leakage_gate * power_ctx.tech->Vdd;
+}
+
+/**
+ * Returns the properties (capacitances and leakage currents) of a transistor,
+ * linearly interpolated between the closest sizes in the technology file.
+ * If no transistor information exists, all properties are 0.
+ * - transistor_type: NMOS or PMOS
+ * - size: (W/L) of transistor
+ */
+static const t_transistor_size_inf& power_get_transistor_size_inf(e_tx_type transistor_type, float size) {
+    auto& cache = f_transistor_size_inf_cache[transistor_type];
+    auto iter = cache.find(size);
+    if (iter != cache.end()) {
+        return iter->second;
+    }
+
     t_transistor_size_inf* tx_info_lower;
     t_transistor_size_inf* tx_info_upper;
     bool error;
-    float current;
+
+    /* Initialize to 0 */
+    t_transistor_size_inf tx_info;
+    tx_info.size = size;
+    tx_info.leakage_subthreshold = 0.;
+    tx_info.leakage_gate = 0.;
+    tx_info.C_g = 0.;
+    tx_info.C_s = 0.;
+    tx_info.C_d = 0.;
 
     error = power_find_transistor_info(&tx_info_lower, &tx_info_upper,
                                        transistor_type, size);
-    if (error) {
-        return 0;
-    }
-
-    if (tx_info_lower == nullptr) {
-        /* No lower bound */
-        current = tx_info_upper->leakage_gate;
-
-    } else if (tx_info_upper == nullptr) {
-        /* No upper bound */
-        current = tx_info_lower->leakage_gate;
-    } else {
-        /* Linear approximation between sizes */
-        float percent_upper = (size - tx_info_lower->size)
-                              / (tx_info_upper->size - tx_info_lower->size);
-        current = (1 - percent_upper) * tx_info_lower->leakage_gate
-                  + percent_upper * tx_info_upper->leakage_gate;
+    if (!error) {
+        if (tx_info_lower == nullptr) {
+            /* No lower bound */
+            tx_info = *tx_info_upper;
+        } else if (tx_info_upper == nullptr) {
+            /* No upper bound */
+            tx_info = *tx_info_lower;
+        } else {
+            /* Linear approximation between sizes */
+            float percent_upper = (size - tx_info_lower->size)
+                                  / (tx_info_upper->size - tx_info_lower->size);
+            tx_info.leakage_subthreshold = (1 - percent_upper) * tx_info_lower->leakage_subthreshold
+                                           + percent_upper * tx_info_upper->leakage_subthreshold;
+            tx_info.leakage_gate = (1 - percent_upper) * tx_info_lower->leakage_gate
+                                   + percent_upper * tx_info_upper->leakage_gate;
+            tx_info.C_d = (1 - percent_upper) * tx_info_lower->C_d
+                          + percent_upper * tx_info_upper->C_d;
+            tx_info.C_s = (1 - percent_upper) * tx_info_lower->C_s
+                          + percent_upper * tx_info_upper->C_s;
+            tx_info.C_g = (1 - percent_upper) * tx_info_lower->C_g
+                          + percent_upper * tx_info_upper->C_g;
+        }
+        tx_info.size = size;
     }
 
-    auto& power_ctx = g_vpr_ctx.power();
-    return current * power_ctx.tech->Vdd;
+    return cache.emplace(size, tx_info).first->second;
 }
 
 /**
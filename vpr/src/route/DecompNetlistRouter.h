@@ -21,6 +21,20 @@ const int MIN_DECOMP_SINKS = 8;
 /** Minimum # of fanouts of a virtual net to consider decomp. */
 const int MIN_DECOMP_SINKS_VNET = 8;
 
+/* The limits above are only the starting point: after each iteration which decomposed nets, the
+ * router adapts them (see DecompNetlistRouter::adapt_decomposition()). While the threads are
+ * underutilized and routing converges, decomposition gets more aggressive. When routing stops
+ * converging, decomposition backs off. */
+
+/** Thread utilization below which decomposition should be more aggressive */
+const float DECOMP_TARGET_UTILIZATION = 0.75;
+
+/** Bounds of the adapted decomposition depth, sink thresholds and last decomposition iteration */
+const int MAX_ADAPTIVE_DECOMP_DEPTH = 3;
+const int MIN_ADAPTIVE_DECOMP_SINKS = 4;
+const int MAX_ADAPTIVE_DECOMP_SINKS = 64;
+const int MAX_ADAPTIVE_DECOMP_ITER = 2 * MAX_DECOMP_ITER;
+
 template<typename HeapType>
 class DecompNetlistRouter : public NetlistRouter {
   public:
@@ -35,7 +49,7 @@ class DecompNetlistRouter : public NetlistRouter {
         NetPinTimingInvalidator* pin_timing_invalidator,
         route_budgets& budgeting_inf,
         const RoutingPredictor& routing_predictor,
-        const vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>>& choking_spots,
+        const vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>>& choking_spots,
         bool is_flat)
         : _routers_th(_make_router(router_lookahead, is_flat))
         , _net_list(net_list)
@@ -65,6 +79,11 @@ class DecompNetlistRouter : public NetlistRouter {
   private:
     /** Should we decompose this net? */
     bool should_decompose_net(ParentNetId net_id, const PartitionTreeNode& node);
+    /** Should we decompose this virtual net? */
+    bool should_decompose_vnet(const VirtualNet& vnet, const PartitionTreeNode& node);
+    /** Tune the decomposition limits for the next iteration from the load balance and
+     * convergence of this one */
+    void adapt_decomposition(const RouteIterResults& results);
     /** Get a bitset with sinks to route before net decomposition */
     vtr::dynamic_bitset<> get_decomposition_mask(ParentNetId net_id, const PartitionTreeNode& node);
     /** Get a bitset with sinks to route before virtual net decomposition */
@@ -107,7 +126,7 @@ class DecompNetlistRouter : public NetlistRouter {
     NetPinTimingInvalidator* _pin_timing_invalidator;
     route_budgets& _budgeting_inf;
     const RoutingPredictor& _routing_predictor;
-    const vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>>& _choking_spots;
+    const vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>>& _choking_spots;
     bool _is_flat;
 
     /** Cached routing parameters for current iteration (inputs to \see route_netlist()) */
@@ -121,6 +140,16 @@ class DecompNetlistRouter : public NetlistRouter {
 
     /** Is decomposition disabled for this net? [0.._net_list.size()-1] */
     vtr::vector<ParentNetId, bool> _is_decomp_disabled;
+
+    /** Current (adapted) decomposition limits: see MAX_DECOMP_ITER, MAX_DECOMP_DEPTH,
+     * MIN_DECOMP_SINKS and MIN_DECOMP_SINKS_VNET */
+    int _decomp_max_iter = MAX_DECOMP_ITER;
+    int _decomp_max_depth = MAX_DECOMP_DEPTH;
+    int _decomp_min_sinks = MIN_DECOMP_SINKS;
+    int _decomp_min_sinks_vnet = MIN_DECOMP_SINKS_VNET;
+
+    /** Number of nets rerouted in the previous iteration, to tell whether routing converges */
+    size_t _prev_num_rerouted_nets = std::numeric_limits<size_t>::max();
 };
 
 #include "DecompNetlistRouter.tpp"
@@ -26,6 +26,7 @@ inline RouteIterResults DecompNetlistRouter<HeapType>::route_netlist(int itry, f
     PartitionTree tree(_net_list);
 
     /* Put the root node on the task queue, which will add its child nodes when it's finished. Wait until the entire tree gets routed. */
+    vtr::Timer iteration_timer;
     tbb::task_group g;
     route_partition_tree_node(g, tree.root());
     g.wait();
@@ -33,13 +34,59 @@ inline RouteIterResults DecompNetlistRouter<HeapType>::route_netlist(int itry, f
     /* Combine results from threads */
     RouteIterResults out;
     for (auto& results : _results_th) {
+        out.load_balance.thread_busy_sec.push_back(results.busy_sec);
+        out.load_balance.thread_nets_routed.push_back(results.stats.nets_routed);
+        out.load_balance.thread_heap_pops.push_back(results.stats.heap_pops);
         out.stats.combine(results.stats);
         out.rerouted_nets.insert(out.rerouted_nets.end(), results.rerouted_nets.begin(), results.rerouted_nets.end());
         out.is_routable &= results.is_routable;
     }
+    out.load_balance.wall_sec = iteration_timer.elapsed_sec();
+    out.load_balance.root_sec = tree.root().route_sec;
+    out.load_balance.critical_path_sec = partition_tree_critical_path_sec(tree.root());
+    /* Which thread routed which net depends on scheduling */
+    if (_router_opts.deterministic_parallel_route)
+        std::sort(out.rerouted_nets.begin(), out.rerouted_nets.end());
+
+    adapt_decomposition(out);
     return out;
 }
 
+template<typename HeapType>
+void DecompNetlistRouter<HeapType>::adapt_decomposition(const RouteIterResults& results) {
+    size_t num_rerouted_nets = results.rerouted_nets.size();
+    bool converging = num_rerouted_nets <= _prev_num_rerouted_nets;
+    _prev_num_rerouted_nets = num_rerouted_nets;
+
+    /* Nothing to tune once decomposition is over. The utilization depends on wall times, so
+     * tuning from it would make the routing depend on scheduling */
+    if (_itry > _decomp_max_iter || _router_opts.deterministic_parallel_route)
+        return;
+
+    if (!converging) {
+        /* Decomposed nets disturb the net ordering and make congestion harder to resolve: back off */
+        if (_decomp_max_depth > 1) {
+            _decomp_max_depth--;
+            _decomp_min_sinks = std::min(2 * _decomp_min_sinks, MAX_ADAPTIVE_DECOMP_SINKS);
+            _decomp_min_sinks_vnet = std::min(2 * _decomp_min_sinks_vnet, MAX_ADAPTIVE_DECOMP_SINKS);
+        } else {
+            _decomp_max_iter = _itry;
+        }
+    } else if (results.load_balance.utilization() < DECOMP_TARGET_UTILIZATION) {
+        /* Threads are waiting on the upper levels of the partition tree: decompose more nets,
+         * more deeply, and for longer */
+        _decomp_max_depth = std::min(_decomp_max_depth + 1, MAX_ADAPTIVE_DECOMP_DEPTH);
+        _decomp_min_sinks = std::max(_decomp_min_sinks / 2, MIN_ADAPTIVE_DECOMP_SINKS);
+        _decomp_min_sinks_vnet = std::max(_decomp_min_sinks_vnet / 2, MIN_ADAPTIVE_DECOMP_SINKS);
+        if (_itry == _decomp_max_iter)
+            _decomp_max_iter = std::min(_decomp_max_iter + 1, MAX_ADAPTIVE_DECOMP_ITER);
+    }
+
+    PartitionTreeDebug::log("Decomposition after iteration " + std::to_string(_itry) + ": depth " + std::to_string(_decomp_max_depth)
+                            + ", min sinks " + std::to_string(_decomp_min_sinks) + "/" + std::to_string(_decomp_min_sinks_vnet)
+                            + ", until iteration " + std::to_string(_decomp_max_iter));
+}
+
 template<typename HeapType>
 void DecompNetlistRouter<HeapType>::set_rcv_enabled(bool x) {
     if (x)
@@ -80,24 +127,25 @@ bool DecompNetlistRouter<HeapType>::should_decompose_net(ParentNetId net_id, con
     if (_is_decomp_disabled[net_id])
         return false;
     /* We are past the iteration to try decomposition */
-    if (_itry > MAX_DECOMP_ITER)
+    if (_itry > _decomp_max_iter)
         return false;
     /* Net is too small */
     int num_sinks = _net_list.net_sinks(net_id).size();
-    if (num_sinks < MIN_DECOMP_SINKS)
+    if (num_sinks < _decomp_min_sinks)
         return false;
 
     return true;
 }
 
 /** Should we decompose this virtual net? (see partition_tree.h) */
-inline bool should_decompose_vnet(const VirtualNet& vnet, const PartitionTreeNode& node) {
+template<typename HeapType>
+bool DecompNetlistRouter<HeapType>::should_decompose_vnet(const VirtualNet& vnet, const PartitionTreeNode& node) {
     /* We're at a partition tree leaf: no more nodes to delegate newly created vnets to */
     if (!node.left || !node.right)
         return false;
 
     /* Vnet has been decomposed too many times */
-    if (vnet.times_decomposed >= MAX_DECOMP_DEPTH)
+    if (vnet.times_decomposed >= _decomp_max_depth)
         return false;
 
     /* Cutline doesn't go through vnet (a valid case: it wasn't there when partition tree was being built) */
@@ -111,7 +159,7 @@ inline bool should_decompose_vnet(const VirtualNet& vnet, const PartitionTreeNod
 
     /* Vnet is too small */
     int num_sinks = get_vnet_sink_mask(vnet).count();
-    if (num_sinks < MIN_DECOMP_SINKS_VNET)
+    if (num_sinks < _decomp_min_sinks_vnet)
         return false;
 
     return true;
@@ -121,17 +169,23 @@ template<typename HeapType>
 void DecompNetlistRouter<HeapType>::route_partition_tree_node(tbb::task_group& g, PartitionTreeNode& node) {
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    /* Sort so that nets with the most sinks are routed first.
+    /* Sort so that nets with the highest routing priority, then the most sinks, are routed first.
      * We want to interleave virtual nets with regular ones, so sort an "index vector"
      * instead where indices >= node.nets.size() refer to node.vnets.
-     * Virtual nets use their parent net's #fanouts in sorting while regular
-     * nets use their own #fanouts. */
+     * Virtual nets use their parent net's priority and #fanouts in sorting while regular
+     * nets use their own. */
     std::vector<size_t> order(node.nets.size() + node.vnets.size());
     std::iota(order.begin(), order.end(), 0);
+    auto order_net_id = [&](size_t i) {
+        return i < node.nets.size() ? node.nets[i] : node.vnets[i - node.nets.size()].net_id;
+    };
+    std::vector<float> priority(order.size());
+    for (size_t i : order)
+        priority[i] = get_net_routing_priority(_net_list, order_net_id(i), _router_opts, _timing_info.get(), _netlist_pin_lookup, _is_flat);
     std::stable_sort(order.begin(), order.end(), [&](size_t i, size_t j) -> bool {
-        ParentNetId id1 = i < node.nets.size() ? node.nets[i] : node.vnets[i - node.nets.size()].net_id;
-        ParentNetId id2 = j < node.nets.size() ? node.nets[j] : node.vnets[j - node.nets.size()].net_id;
-        return _net_list.net_sinks(id1).size() > _net_list.net_sinks(id2).size();
+        if (priority[i] != priority[j])
+            return priority[i] > priority[j];
+        return _net_list.net_sinks(order_net_id(i)).size() > _net_list.net_sinks(order_net_id(j)).size();
     });
 
     vtr::Timer t;
@@ -232,6 +286,10 @@ void DecompNetlistRouter<HeapType>::route_partition_tree_node(tbb::task_group& g
         }
     }
 
+    /* Each node is routed by a single thread */
+    node.route_sec = t.elapsed_sec();
+    _results_th.local().busy_sec += node.route_sec;
+
     PartitionTreeDebug::log("Node with " + std::to_string(node.nets.size())
                             + " nets and " + std::to_string(node.vnets.size())
                             + " virtual nets routed in " + std::to_string(t.elapsed_sec())
@@ -522,10 +580,7 @@ vtr::dynamic_bitset<> DecompNetlistRouter<HeapType>::get_decomposition_mask(Pare
 
     /* Sample if a sink is too close to the cutline (and unreached).
      * Those sinks are likely to fail routing */
-    for (size_t isink = 1; isink < num_sinks + 1; isink++) {
-        if (is_isink_reached.get(isink))
-            continue;
-
+    for (size_t isink = is_isink_reached.find_next_unset(1); isink < num_sinks + 1; isink = is_isink_reached.find_next_unset(isink + 1)) {
         RRNodeId rr_sink = route_ctx.net_rr_terminals[net_id][isink];
         if (is_close_to_cutline(rr_sink, node.cutline_axis, node.cutline_pos, 1))
             out.set(isink, true);
@@ -661,13 +716,12 @@ vtr::dynamic_bitset<> DecompNetlistRouter<HeapType>::get_vnet_decomposition_mask
         }
     }
 
-    std::vector<size_t> isinks = sink_mask_to_vector(get_vnet_sink_mask(vnet), tree.num_sinks());
+    vtr::dynamic_bitset<> unreached_isinks = get_vnet_sink_mask(vnet);
+    unreached_isinks.and_not(is_isink_reached);
 
     /* Sample if a sink is too close to the cutline (and unreached).
      * Those sinks are likely to fail routing */
-    for (size_t isink : isinks) {
-        if (is_isink_reached.get(isink))
-            continue;
+    for (size_t isink : sink_mask_to_vector(unreached_isinks, tree.num_sinks())) {
         RRNodeId rr_sink = route_ctx.net_rr_terminals[vnet.net_id][isink];
         if (is_close_to_cutline(rr_sink, node.cutline_axis, node.cutline_pos, 1)) {
             out.set(isink, true);
@@ -0,0 +1,134 @@
+#pragma once
+
+/** @file Distributed case for NetlistRouter: the nets are routed by several processes (ranks),
+ * possibly on different hosts, started together by mpirun.
+ *
+ * Every rank runs the same flow with the same options and inputs, so they all hold the same
+ * (read-only) RR graph and start routing with the same state. Each iteration builds the same
+ * \ref PartitionTree in every rank, and routes it in supersteps:
+ *  - While there are few ready tree nodes (starting with the root), their nets are routed by the
+ *    ranks (each ready node by one rank), and their children become ready for the next superstep.
+ *  - Once there are enough ready nodes to keep every rank busy, each rank routes whole subtrees.
+ * Nodes and subtrees are assigned to ranks by their estimated work (heaviest to the least loaded
+ * rank). The nets of different nodes in a superstep have disjoint bounding boxes, so the ranks
+ * don't need to see each other's occupancy until its end. Then each rank sends the changes to the
+ * nets it routed (route trees, delays and connection state, see distributed_route.h) to the others,
+ * which replay them, so that all the ranks have the same routing state again.
+ *
+ * Nets which have to retry with a full device bounding box are left for the next iteration (like
+ * in the \ref ParallelNetlistRouter), since they would overlap the nets routed by other ranks.
+ *
+ * All the ranks go through the rest of the flow (timing analysis, writing the results), so they
+ * should be started in separate working directories. Each rank routes its share of the nets serially.
+ *
+ * Only available when VPR is compiled with VPR_USE_MPI. */
+#include "netlist_routers.h"
+
+#include "distributed_route.h"
+
+/** Supersteps stop routing single tree nodes once there are this many ready nodes per rank.
+ * More than one, so that the subtrees can be balanced across the ranks */
+constexpr size_t DISTRIBUTED_PARTITION_TASKS_PER_RANK = 4;
+
+/** Distributed impl for NetlistRouter.
+ * Like the \ref SerialNetlistRouter, holds the context needed to call \ref route_net with a
+ * single ConnectionRouter. */
+template<typename HeapType>
+class DistributedNetlistRouter : public NetlistRouter {
+  public:
+    DistributedNetlistRouter(
+        const Netlist<>& net_list,
+        const RouterLookahead* router_lookahead,
+        const t_router_opts& router_opts,
+        CBRR& connections_inf,
+        NetPinsMatrix<float>& net_delay,
+        const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+        std::shared_ptr<SetupHoldTimingInfo> timing_info,
+        NetPinTimingInvalidator* pin_timing_invalidator,
+        route_budgets& budgeting_inf,
+        const RoutingPredictor& routing_predictor,
+        const vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>>& choking_spots,
+        bool is_flat)
+        : _router(_make_router(router_lookahead, is_flat))
+        , _net_list(net_list)
+        , _router_opts(router_opts)
+        , _connections_inf(connections_inf)
+        , _net_delay(net_delay)
+        , _netlist_pin_lookup(netlist_pin_lookup)
+        , _timing_info(timing_info)
+        , _pin_timing_invalidator(pin_timing_invalidator)
+        , _budgeting_inf(budgeting_inf)
+        , _routing_predictor(routing_predictor)
+        , _choking_spots(choking_spots)
+        , _is_flat(is_flat) {
+        check_distributed_route_consistency(net_list);
+        _rank = distributed_route_rank();
+        _num_ranks = distributed_route_num_ranks();
+    }
+    ~DistributedNetlistRouter() {}
+
+    /** Run a single iteration of netlist routing for this->_net_list, together with the other ranks.
+     * \return RouteIterResults for this iteration (the same in all the ranks, except the stats). */
+    RouteIterResults route_netlist(int itry, float pres_fac, float worst_neg_slack);
+    void set_rcv_enabled(bool x);
+    void set_timing_info(std::shared_ptr<SetupHoldTimingInfo> timing_info);
+
+  private:
+    /** Route the nets of \p node, and those of its subtrees if \p with_subtrees.
+     * \return false if a net is not routable (disconnected RRG) */
+    bool route_partition_tree_node(PartitionTreeNode& node, bool with_subtrees, RouteIterResults& results, std::vector<t_net_routing_update>& updates);
+
+    /** Route a single net and record its update for the other ranks.
+     * \return false if the net is not routable (disconnected RRG) */
+    bool route_net_local(ParentNetId net_id, RouteIterResults& results, std::vector<t_net_routing_update>& updates);
+
+    /** Get the estimated work of routing each net, for balancing the PartitionTree.
+     * Must be the same in all the ranks, so it only depends on the exchanged state.
+     * \return Estimated work for each net and the total */
+    std::pair<vtr::vector<ParentNetId, size_t>, size_t> estimate_net_work();
+
+    /** Assign \p works to ranks, heaviest first to the least loaded rank.
+     * \return The rank of each item */
+    std::vector<int> assign_to_ranks(const std::vector<size_t>& works) const;
+
+    ConnectionRouter<HeapType> _make_router(const RouterLookahead* router_lookahead, bool is_flat) {
+        auto& device_ctx = g_vpr_ctx.device();
+        auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+        return ConnectionRouter<HeapType>(
+            device_ctx.grid,
+            *router_lookahead,
+            device_ctx.rr_graph.rr_nodes(),
+            &device_ctx.rr_graph,
+            device_ctx.rr_rc_data,
+            device_ctx.rr_graph.rr_switch(),
+            route_ctx.rr_node_route_inf,
+            is_flat);
+    }
+
+    /* Context fields */
+    ConnectionRouter<HeapType> _router;
+    const Netlist<>& _net_list;
+    const t_router_opts& _router_opts;
+    CBRR& _connections_inf;
+    NetPinsMatrix<float>& _net_delay;
+    const ClusteredPinAtomPinsLookup& _netlist_pin_lookup;
+    std::shared_ptr<SetupHoldTimingInfo> _timing_info;
+    NetPinTimingInvalidator* _pin_timing_invalidator;
+    route_budgets& _budgeting_inf;
+    const RoutingPredictor& _routing_predictor;
+    const vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>>& _choking_spots;
+    bool _is_flat;
+    /** Heap pushes it took to route each net when it was last rerouted (by any rank). 0 if it wasn't routed yet */
+    vtr::vector<ParentNetId, size_t> _net_heap_pushes;
+
+    int _rank;
+    int _num_ranks;
+
+    /** Cached routing parameters for current iteration (inputs to \see route_netlist()) */
+    int _itry;
+    float _pres_fac;
+    float _worst_neg_slack;
+};
+
+#include "DistributedNetlistRouter.tpp"
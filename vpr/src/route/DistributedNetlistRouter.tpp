@@ -0,0 +1,219 @@
+#pragma once
+
+/** @file Impls for DistributedNetlistRouter */
+
+#include "DistributedNetlistRouter.h"
+#include "route_net.h"
+#include "vtr_time.h"
+
+#include <chrono>
+#include <numeric>
+
+template<typename HeapType>
+inline RouteIterResults DistributedNetlistRouter<HeapType>::route_netlist(int itry, float pres_fac, float worst_neg_slack) {
+    /* Set the routing parameters: they won't change until the next call and that saves us the trouble of passing them around */
+    _itry = itry;
+    _pres_fac = pres_fac;
+    _worst_neg_slack = worst_neg_slack;
+
+    RouteIterResults out;
+    vtr::Timer iteration_timer;
+
+    /* Every rank builds the same PartitionTree: the net work estimates only depend on exchanged state */
+    auto [net_work, total_work] = estimate_net_work();
+    size_t num_tasks = DISTRIBUTED_PARTITION_TASKS_PER_RANK * _num_ranks;
+    PartitionTree tree(_net_list, net_work, std::max<size_t>(total_work / num_tasks, 1));
+
+    bool is_routable = true;
+    std::vector<PartitionTreeNode*> ready_nodes = {&tree.root()};
+    while (!ready_nodes.empty()) {
+        bool has_children = std::any_of(ready_nodes.begin(), ready_nodes.end(), [](const PartitionTreeNode* node) {
+            return node->left != nullptr;
+        });
+        bool whole_subtrees = ready_nodes.size() >= num_tasks || !has_children;
+
+        std::vector<size_t> works;
+        for (const PartitionTreeNode* node : ready_nodes) {
+            size_t work = 0;
+            if (whole_subtrees) {
+                work = node->work;
+            } else {
+                for (ParentNetId net_id : node->nets)
+                    work += net_work[net_id];
+            }
+            works.push_back(work);
+        }
+        std::vector<int> node_ranks = assign_to_ranks(works);
+
+        /* Route my share. If this throws, the other ranks would wait for me forever */
+        std::vector<t_net_routing_update> updates;
+        try {
+            for (size_t inode = 0; inode < ready_nodes.size() && is_routable; inode++) {
+                if (node_ranks[inode] == _rank)
+                    is_routable = route_partition_tree_node(*ready_nodes[inode], whole_subtrees, out, updates);
+            }
+        } catch (const std::exception& e) {
+            VTR_LOG_ERROR("%s\n", e.what());
+            abort_distributed_route();
+        }
+
+        /* Catch up with the other ranks. The nets of the different nodes don't overlap, so the order doesn't matter */
+        for (const t_net_routing_update& update : exchange_net_routing_updates(updates)) {
+            apply_net_routing_update(update, _net_list, _connections_inf, _net_delay, _timing_info.get(), _pin_timing_invalidator, _budgeting_inf);
+            if (update.rerouted) {
+                _net_heap_pushes[update.net_id] = update.heap_pushes;
+                out.rerouted_nets.push_back(update.net_id);
+            }
+        }
+
+        std::vector<PartitionTreeNode*> next_ready_nodes;
+        if (!whole_subtrees) {
+            for (PartitionTreeNode* node : ready_nodes) {
+                if (node->left && node->right) {
+                    next_ready_nodes.push_back(node->left.get());
+                    next_ready_nodes.push_back(node->right.get());
+                } else {
+                    VTR_ASSERT(!node->left && !node->right); // there shouldn't be a node with a single branch
+                }
+            }
+        }
+        ready_nodes = std::move(next_ready_nodes);
+    }
+
+    out.is_routable = distributed_route_all(is_routable);
+
+    /* Load balance across the ranks, before summing up the stats */
+    constexpr size_t NUM_BALANCE_VALUES = 4;
+    std::vector<double> balance = distributed_route_allgather({out.busy_sec, double(out.stats.nets_routed), double(out.stats.heap_pops), tree.root().route_sec});
+    for (int irank = 0; irank < _num_ranks; irank++) {
+        out.load_balance.thread_busy_sec.push_back(balance[NUM_BALANCE_VALUES * irank]);
+        out.load_balance.thread_nets_routed.push_back(balance[NUM_BALANCE_VALUES * irank + 1]);
+        out.load_balance.thread_heap_pops.push_back(balance[NUM_BALANCE_VALUES * irank + 2]);
+        out.load_balance.root_sec = std::max<float>(out.load_balance.root_sec, balance[NUM_BALANCE_VALUES * irank + 3]);
+    }
+    distributed_route_sum_stats(out.stats);
+    out.load_balance.wall_sec = iteration_timer.elapsed_sec();
+
+    /* Which rank routed which net depends on the assignment */
+    std::sort(out.rerouted_nets.begin(), out.rerouted_nets.end());
+    return out;
+}
+
+template<typename HeapType>
+bool DistributedNetlistRouter<HeapType>::route_partition_tree_node(PartitionTreeNode& node, bool with_subtrees, RouteIterResults& results, std::vector<t_net_routing_update>& updates) {
+    /* Sort so net with most sinks (or the highest routing priority) is routed first. */
+    sort_nets_for_routing(node.nets, _net_list, _router_opts, _timing_info.get(), _netlist_pin_lookup, _is_flat);
+
+    vtr::Timer t;
+    for (auto net_id : node.nets) {
+        if (!route_net_local(net_id, results, updates))
+            return false;
+    }
+    node.route_sec = t.elapsed_sec();
+
+    if (with_subtrees && node.left && node.right) {
+        return route_partition_tree_node(*node.left, true, results, updates)
+               && route_partition_tree_node(*node.right, true, results, updates);
+    }
+    return true;
+}
+
+template<typename HeapType>
+bool DistributedNetlistRouter<HeapType>::route_net_local(ParentNetId net_id, RouteIterResults& results, std::vector<t_net_routing_update>& updates) {
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    size_t heap_pushes_before = results.stats.heap_pushes;
+    auto start_time = std::chrono::steady_clock::now();
+    auto flags = route_net(
+        _router,
+        _net_list,
+        net_id,
+        _itry,
+        _pres_fac,
+        _router_opts,
+        _connections_inf,
+        results.stats,
+        _net_delay,
+        _netlist_pin_lookup,
+        _timing_info.get(),
+        _pin_timing_invalidator,
+        _budgeting_inf,
+        _worst_neg_slack,
+        _routing_predictor,
+        _choking_spots[net_id],
+        _is_flat,
+        route_ctx.route_bb[net_id]);
+    results.busy_sec += std::chrono::duration<float>(std::chrono::steady_clock::now() - start_time).count();
+
+    if (!flags.was_rerouted)
+        return true; /* Nothing changed */
+
+    /* Disconnected RRG and ConnectionRouter doesn't think growing the BB will work */
+    bool is_routable = flags.success || flags.retry_with_full_bb;
+
+    /* ConnectionRouter thinks we should grow the BB. Do that and leave this net unrouted for now:
+     * with the full BB, it would overlap the nets of the other ranks */
+    if (flags.retry_with_full_bb)
+        route_ctx.route_bb[net_id] = full_device_bb();
+
+    bool rerouted = flags.success && !flags.retry_with_full_bb;
+    if (rerouted) {
+        _net_heap_pushes[net_id] = results.stats.heap_pushes - heap_pushes_before;
+        results.rerouted_nets.push_back(net_id);
+    }
+
+    /* Even a failed net changed the routing state, which the other ranks need to follow */
+    updates.push_back(get_net_routing_update(net_id, rerouted, _net_heap_pushes[net_id], _connections_inf, _net_delay));
+    return is_routable;
+}
+
+template<typename HeapType>
+std::pair<vtr::vector<ParentNetId, size_t>, size_t> DistributedNetlistRouter<HeapType>::estimate_net_work() {
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    if (_net_heap_pushes.size() != _net_list.nets().size())
+        _net_heap_pushes.assign(_net_list.nets().size(), 0);
+
+    vtr::vector<ParentNetId, size_t> net_work(_net_list.nets().size());
+    size_t total_work = 0;
+    for (auto net_id : _net_list.nets()) {
+        if (_net_heap_pushes[net_id] > 0) {
+            net_work[net_id] = _net_heap_pushes[net_id];
+        } else {
+            /* Not routed yet: the connection router will explore some of the bounding box for each sink */
+            const t_bb& bb = route_ctx.route_bb[net_id];
+            size_t bb_area = size_t(bb.xmax - bb.xmin + 1) * size_t(bb.ymax - bb.ymin + 1);
+            net_work[net_id] = std::max<size_t>(_net_list.net_sinks(net_id).size() * bb_area, 1);
+        }
+        total_work += net_work[net_id];
+    }
+    return {std::move(net_work), total_work};
+}
+
+template<typename HeapType>
+std::vector<int> DistributedNetlistRouter<HeapType>::assign_to_ranks(const std::vector<size_t>& works) const {
+    std::vector<size_t> order(works.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return works[lhs] > works[rhs];
+    });
+
+    std::vector<size_t> rank_loads(_num_ranks, 0);
+    std::vector<int> ranks(works.size());
+    for (size_t i : order) {
+        int rank = std::min_element(rank_loads.begin(), rank_loads.end()) - rank_loads.begin();
+        ranks[i] = rank;
+        rank_loads[rank] += std::max<size_t>(works[i], 1);
+    }
+    return ranks;
+}
+
+template<typename HeapType>
+void DistributedNetlistRouter<HeapType>::set_rcv_enabled(bool x) {
+    _router.set_rcv_enabled(x);
+}
+
+template<typename HeapType>
+void DistributedNetlistRouter<HeapType>::set_timing_info(std::shared_ptr<SetupHoldTimingInfo> timing_info) {
+    _timing_info = timing_info;
+}
@@ -6,11 +6,35 @@
  * its child nodes to the task queue. This approach is serially equivalent & deterministic,
  * but it can reduce QoR in congested cases [0].
  *
+ * The tree is balanced by an estimate of the work needed to route each net instead of its
+ * fanout alone: nets are weighted by fanout and bounding box area until they get routed, and
+ * by the number of heap pushes it took to route them in the last iteration afterwards.
+ * Nodes heavier than a fraction of the total work are partitioned further, so that no single
+ * task holds up the iteration. Idle workers pick up ready nodes from task_group by work stealing.
+ *
  * Note that the parallel router does not support graphical router breakpoints.
  *
+ * With router_opts.parallel_route_overlapping_nets, the nets inside each tree node are also
+ * routed in parallel, even though their bounding boxes overlap. Each thread then searches
+ * with its own copy of the RR node search state (\ref t_rr_node_route_inf) and occupancy is
+ * updated atomically (\ref t_rr_node_cong_inf). Since concurrently routed nets can't see each
+ * other's routing, a conflict repair pass reroutes (serially, in net ID order) the nets which
+ * ended up sharing an overused node. This mode is not deterministic.
+ *
+ * With router_opts.parallel_route_batch_iters, the first iterations skip the PartitionTree and
+ * route all the nets concurrently in a single batch, with the same thread-local search state and
+ * atomic occupancy updates. These iterations route every net and are the most expensive ones,
+ * but congestion is still light: instead of repairing conflicts, the overuse is left to the
+ * following iterations, which reroute the congested nets anyway. Also not deterministic.
+ *
+ * With router_opts.deterministic_parallel_route, the PartitionTree doesn't depend on the
+ * thread count and thread-local results are merged in a fixed order, so that the result
+ * doesn't depend on --num_workers.
+ *
  * [0]: F. Koşar, "A net-decomposing parallel FPGA router", MS thesis, UofT ECE, 2023 */
 #include "netlist_routers.h"
 
+#include <tbb/enumerable_thread_specific.h>
 #include <tbb/task_group.h>
 
 /** Parallel impl for NetlistRouter.
@@ -32,9 +56,9 @@ class ParallelNetlistRouter : public NetlistRouter {
         NetPinTimingInvalidator* pin_timing_invalidator,
         route_budgets& budgeting_inf,
         const RoutingPredictor& routing_predictor,
-        const vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>>& choking_spots,
+        const vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>>& choking_spots,
         bool is_flat)
-        : _routers_th(_make_router(router_lookahead, is_flat))
+        : _routers_th([this, router_lookahead, is_flat]() { return _make_router(router_lookahead, is_flat); })
         , _net_list(net_list)
         , _router_opts(router_opts)
         , _connections_inf(connections_inf)
@@ -56,13 +80,35 @@ class ParallelNetlistRouter : public NetlistRouter {
     void set_timing_info(std::shared_ptr<SetupHoldTimingInfo> timing_info);
 
   private:
+    /** Route all the nets concurrently, without a PartitionTree (see router_opts.parallel_route_batch_iters). */
+    void route_batch();
+
     /** A single task to route nets inside a PartitionTree node and add tasks for its child nodes to task group \p g. */
     void route_partition_tree_node(tbb::task_group& g, PartitionTreeNode& node);
 
+    /** Route a single net with this thread's ConnectionRouter and record the results.
+     * \return false if the net is not routable (disconnected RRG) */
+    bool route_net_local(ParentNetId net_id, bool record_reroute);
+
+    /** Get the estimated work of routing each net, for balancing the PartitionTree.
+     * \return Estimated work for each net and the total */
+    std::pair<vtr::vector<ParentNetId, size_t>, size_t> estimate_net_work();
+
+    /** Reroute the nets in \p nets (which were routed concurrently) that share an overused RR node.
+     * \return false if a net became unroutable */
+    bool repair_conflicts(const std::vector<ParentNetId>& nets);
+
     ConnectionRouter<HeapType> _make_router(const RouterLookahead* router_lookahead, bool is_flat) {
         auto& device_ctx = g_vpr_ctx.device();
         auto& route_ctx = g_vpr_ctx.mutable_routing();
 
+        /* Nets routed concurrently may explore the same RR nodes: give each thread its own search state */
+        t_rr_node_route_inf_vector* rr_node_route_inf = &route_ctx.rr_node_route_inf;
+        if (_router_opts.parallel_route_overlapping_nets || _router_opts.parallel_route_batch_iters > 0) {
+            rr_node_route_inf = &_search_state_th.local();
+            rr_node_route_inf->assign(device_ctx.rr_graph.num_nodes(), {RREdgeId::INVALID(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()});
+        }
+
         return ConnectionRouter<HeapType>(
             device_ctx.grid,
             *router_lookahead,
@@ -70,7 +116,7 @@ class ParallelNetlistRouter : public NetlistRouter {
             &device_ctx.rr_graph,
             device_ctx.rr_rc_data,
             device_ctx.rr_graph.rr_switch(),
-            route_ctx.rr_node_route_inf,
+            *rr_node_route_inf,
             is_flat);
     }
 
@@ -88,8 +134,12 @@ class ParallelNetlistRouter : public NetlistRouter {
     NetPinTimingInvalidator* _pin_timing_invalidator;
     route_budgets& _budgeting_inf;
     const RoutingPredictor& _routing_predictor;
-    const vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>>& _choking_spots;
+    const vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>>& _choking_spots;
     bool _is_flat;
+    /** Heap pushes it took to route each net when it was last rerouted. 0 if it wasn't routed yet */
+    vtr::vector<ParentNetId, size_t> _net_heap_pushes;
+    /** Per-thread RR node search state. Only used if nets with overlapping bounding boxes are routed concurrently (or in a batch). */
+    tbb::enumerable_thread_specific<t_rr_node_route_inf_vector> _search_state_th;
 
     /** Cached routing parameters for current iteration (inputs to \see route_netlist()) */
     int _itry;
@@ -6,6 +6,20 @@
 #include "route_net.h"
 #include "vtr_time.h"
 
+#include <chrono>
+#include <optional>
+
+#include <tbb/parallel_for_each.h>
+#include <tbb/task_arena.h>
+
+/** Number of tasks per thread the PartitionTree should be able to produce before we stop
+ * partitioning heavy nodes. More than one, so that idle workers have something to steal */
+constexpr size_t PARTITION_TASKS_PER_THREAD = 4;
+
+/** Number of tasks the PartitionTree should be able to produce in deterministic mode, where
+ * the tree can't depend on the thread count. Enough to keep a large machine busy */
+constexpr size_t DETERMINISTIC_PARTITION_TASKS = 256;
+
 template<typename HeapType>
 inline RouteIterResults ParallelNetlistRouter<HeapType>::route_netlist(int itry, float pres_fac, float worst_neg_slack) {
     /* Reset results for each thread */
@@ -18,70 +32,79 @@ inline RouteIterResults ParallelNetlistRouter<HeapType>::route_netlist(int itry,
     _pres_fac = pres_fac;
     _worst_neg_slack = worst_neg_slack;
 
-    /* Organize netlist into a PartitionTree.
-     * Nets in a given level of nodes are guaranteed to not have any overlapping bounding boxes, so they can be routed in parallel. */
-    PartitionTree tree(_net_list);
+    /* The first iterations may route all the nets in a single batch */
+    vtr::Timer iteration_timer;
+    std::optional<PartitionTree> tree;
+    if (itry <= _router_opts.parallel_route_batch_iters) {
+        route_batch();
+    } else {
+        /* Organize netlist into a PartitionTree.
+         * Nets in a given level of nodes are guaranteed to not have any overlapping bounding boxes, so they can be routed in parallel. */
+        auto [net_work, total_work] = estimate_net_work();
+        size_t num_tasks = _router_opts.deterministic_parallel_route ? DETERMINISTIC_PARTITION_TASKS : PARTITION_TASKS_PER_THREAD * tbb::this_task_arena::max_concurrency();
+        tree.emplace(_net_list, net_work, std::max<size_t>(total_work / num_tasks, 1));
 
-    /* Put the root node on the task queue, which will add its child nodes when it's finished. Wait until the entire tree gets routed. */
-    tbb::task_group g;
-    route_partition_tree_node(g, tree.root());
-    g.wait();
+        /* Put the root node on the task queue, which will add its child nodes when it's finished. Wait until the entire tree gets routed. */
+        tbb::task_group g;
+        route_partition_tree_node(g, tree->root());
+        g.wait();
+    }
 
     /* Combine results from threads */
     RouteIterResults out;
     for (auto& results : _results_th) {
+        out.load_balance.thread_busy_sec.push_back(results.busy_sec);
+        out.load_balance.thread_nets_routed.push_back(results.stats.nets_routed);
+        out.load_balance.thread_heap_pops.push_back(results.stats.heap_pops);
         out.stats.combine(results.stats);
         out.rerouted_nets.insert(out.rerouted_nets.end(), results.rerouted_nets.begin(), results.rerouted_nets.end());
         out.is_routable &= results.is_routable;
     }
+    out.load_balance.wall_sec = iteration_timer.elapsed_sec();
+    if (tree) {
+        out.load_balance.root_sec = tree->root().route_sec;
+        out.load_balance.critical_path_sec = partition_tree_critical_path_sec(tree->root());
+    }
+    /* Which thread routed which net depends on scheduling */
+    if (_router_opts.deterministic_parallel_route)
+        std::sort(out.rerouted_nets.begin(), out.rerouted_nets.end());
     return out;
 }
 
 template<typename HeapType>
-void ParallelNetlistRouter<HeapType>::route_partition_tree_node(tbb::task_group& g, PartitionTreeNode& node) {
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
+void ParallelNetlistRouter<HeapType>::route_batch() {
+    /* Start with the nets with most sinks, so that the longest tasks don't come last */
+    std::vector<ParentNetId> nets(_net_list.nets().begin(), _net_list.nets().end());
+    sort_nets_for_routing(nets, _net_list, _router_opts, _timing_info.get(), _netlist_pin_lookup, _is_flat);
 
-    /* Sort so net with most sinks is routed first. */
-    std::stable_sort(node.nets.begin(), node.nets.end(), [&](ParentNetId id1, ParentNetId id2) -> bool {
-        return _net_list.net_sinks(id1).size() > _net_list.net_sinks(id2).size();
+    /* An unroutable net is recorded in the thread's results */
+    tbb::parallel_for_each(nets.begin(), nets.end(), [&](ParentNetId net_id) {
+        route_net_local(net_id, true);
     });
+}
+
+template<typename HeapType>
+void ParallelNetlistRouter<HeapType>::route_partition_tree_node(tbb::task_group& g, PartitionTreeNode& node) {
+    /* Sort so net with most sinks (or the highest routing priority) is routed first. */
+    sort_nets_for_routing(node.nets, _net_list, _router_opts, _timing_info.get(), _netlist_pin_lookup, _is_flat);
 
     vtr::Timer t;
-    for (auto net_id : node.nets) {
-        auto flags = route_net(
-            _routers_th.local(),
-            _net_list,
-            net_id,
-            _itry,
-            _pres_fac,
-            _router_opts,
-            _connections_inf,
-            _results_th.local().stats,
-            _net_delay,
-            _netlist_pin_lookup,
-            _timing_info.get(),
-            _pin_timing_invalidator,
-            _budgeting_inf,
-            _worst_neg_slack,
-            _routing_predictor,
-            _choking_spots[net_id],
-            _is_flat,
-            route_ctx.route_bb[net_id]);
-
-        if (!flags.success && !flags.retry_with_full_bb) {
-            /* Disconnected RRG and ConnectionRouter doesn't think growing the BB will work */
-            _results_th.local().is_routable = false;
+    if (_router_opts.parallel_route_overlapping_nets) {
+        /* Route the nets of this node concurrently and fix up the resulting conflicts */
+        std::atomic<bool> is_routable = true;
+        tbb::parallel_for_each(node.nets.begin(), node.nets.end(), [&](ParentNetId net_id) {
+            if (!route_net_local(net_id, true))
+                is_routable = false;
+        });
+        if (!is_routable || !repair_conflicts(node.nets))
             return;
-        }
-        if (flags.retry_with_full_bb) {
-            /* ConnectionRouter thinks we should grow the BB. Do that and leave this net unrouted for now */
-            route_ctx.route_bb[net_id] = full_device_bb();
-            continue;
-        }
-        if (flags.was_rerouted) {
-            _results_th.local().rerouted_nets.push_back(net_id);
+    } else {
+        for (auto net_id : node.nets) {
+            if (!route_net_local(net_id, true))
+                return;
         }
     }
+    node.route_sec = t.elapsed_sec();
     PartitionTreeDebug::log("Node with " + std::to_string(node.nets.size()) + " nets routed in " + std::to_string(t.elapsed_sec()) + " s");
 
     /* This node is finished: add left & right branches to the task queue */
@@ -97,6 +120,114 @@ void ParallelNetlistRouter<HeapType>::route_partition_tree_node(tbb::task_group&
     }
 }
 
+template<typename HeapType>
+std::pair<vtr::vector<ParentNetId, size_t>, size_t> ParallelNetlistRouter<HeapType>::estimate_net_work() {
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    if (_net_heap_pushes.size() != _net_list.nets().size())
+        _net_heap_pushes.assign(_net_list.nets().size(), 0);
+
+    vtr::vector<ParentNetId, size_t> net_work(_net_list.nets().size());
+    size_t total_work = 0;
+    for (auto net_id : _net_list.nets()) {
+        if (_net_heap_pushes[net_id] > 0) {
+            net_work[net_id] = _net_heap_pushes[net_id];
+        } else {
+            /* Not routed yet: the connection router will explore some of the bounding box for each sink */
+            const t_bb& bb = route_ctx.route_bb[net_id];
+            size_t bb_area = size_t(bb.xmax - bb.xmin + 1) * size_t(bb.ymax - bb.ymin + 1);
+            net_work[net_id] = std::max<size_t>(_net_list.net_sinks(net_id).size() * bb_area, 1);
+        }
+        total_work += net_work[net_id];
+    }
+    return {std::move(net_work), total_work};
+}
+
+template<typename HeapType>
+bool ParallelNetlistRouter<HeapType>::route_net_local(ParentNetId net_id, bool record_reroute) {
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+
+    size_t heap_pushes_before = _results_th.local().stats.heap_pushes;
+    auto start_time = std::chrono::steady_clock::now();
+    auto flags = route_net(
+        _routers_th.local(),
+        _net_list,
+        net_id,
+        _itry,
+        _pres_fac,
+        _router_opts,
+        _connections_inf,
+        _results_th.local().stats,
+        _net_delay,
+        _netlist_pin_lookup,
+        _timing_info.get(),
+        _pin_timing_invalidator,
+        _budgeting_inf,
+        _worst_neg_slack,
+        _routing_predictor,
+        _choking_spots[net_id],
+        _is_flat,
+        route_ctx.route_bb[net_id]);
+    _results_th.local().busy_sec += std::chrono::duration<float>(std::chrono::steady_clock::now() - start_time).count();
+
+    if (!flags.success && !flags.retry_with_full_bb) {
+        /* Disconnected RRG and ConnectionRouter doesn't think growing the BB will work */
+        _results_th.local().is_routable = false;
+        return false;
+    }
+    if (flags.retry_with_full_bb) {
+        /* ConnectionRouter thinks we should grow the BB. Do that and leave this net unrouted for now */
+        route_ctx.route_bb[net_id] = full_device_bb();
+        return true;
+    }
+    if (flags.was_rerouted) {
+        /* Each net is routed by a single thread, so this is safe to write without synchronization */
+        _net_heap_pushes[net_id] = _results_th.local().stats.heap_pushes - heap_pushes_before;
+        if (record_reroute)
+            _results_th.local().rerouted_nets.push_back(net_id);
+    }
+    return true;
+}
+
+template<typename HeapType>
+bool ParallelNetlistRouter<HeapType>::repair_conflicts(const std::vector<ParentNetId>& nets) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    /* Count how many of the concurrently routed nets use each RR node */
+    std::unordered_map<RRNodeId, int> batch_usage;
+    for (ParentNetId net_id : nets) {
+        if (!route_ctx.route_trees[net_id])
+            continue;
+        for (auto& rt_node : route_ctx.route_trees[net_id].value().all_nodes())
+            batch_usage[rt_node.inode]++;
+    }
+
+    /* A conflict is an overused node shared by at least two of these nets: they didn't see each other's occupancy */
+    std::vector<ParentNetId> conflicting_nets;
+    for (ParentNetId net_id : nets) {
+        if (!route_ctx.route_trees[net_id])
+            continue;
+        for (auto& rt_node : route_ctx.route_trees[net_id].value().all_nodes()) {
+            RRNodeId inode = rt_node.inode;
+            if (batch_usage[inode] > 1 && route_ctx.rr_node_cong_inf[inode].occ() > rr_graph.node_capacity(inode)) {
+                conflicting_nets.push_back(net_id);
+                break;
+            }
+        }
+    }
+
+    /* Reroute serially in a fixed order. Nets which got uncongested by earlier reroutes are skipped by route_net */
+    std::sort(conflicting_nets.begin(), conflicting_nets.end());
+    for (ParentNetId net_id : conflicting_nets) {
+        if (!route_net_local(net_id, false))
+            return false;
+    }
+
+    PartitionTreeDebug::log("Repaired " + std::to_string(conflicting_nets.size()) + " conflicting nets out of " + std::to_string(nets.size()));
+    return true;
+}
+
 template<typename HeapType>
 void ParallelNetlistRouter<HeapType>::set_rcv_enabled(bool x) {
     for (auto& router : _routers_th) {
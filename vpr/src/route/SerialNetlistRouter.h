@@ -18,7 +18,7 @@ class SerialNetlistRouter : public NetlistRouter {
         NetPinTimingInvalidator* pin_timing_invalidator,
         route_budgets& budgeting_inf,
         const RoutingPredictor& routing_predictor,
-        const vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>>& choking_spots,
+        const vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>>& choking_spots,
         bool is_flat)
         : _router(_make_router(router_lookahead, is_flat))
         , _net_list(net_list)
@@ -64,7 +64,7 @@ class SerialNetlistRouter : public NetlistRouter {
     NetPinTimingInvalidator* _pin_timing_invalidator;
     route_budgets& _budgeting_inf;
     const RoutingPredictor& _routing_predictor;
-    const vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>>& _choking_spots;
+    const vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>>& _choking_spots;
     bool _is_flat;
 };
 
@@ -10,11 +10,9 @@ inline RouteIterResults SerialNetlistRouter<HeapType>::route_netlist(int itry, f
     auto& route_ctx = g_vpr_ctx.mutable_routing();
     RouteIterResults out;
 
-    /* Sort so net with most sinks is routed first */
+    /* Sort so net with most sinks (or the highest routing priority) is routed first */
     auto sorted_nets = std::vector<ParentNetId>(_net_list.nets().begin(), _net_list.nets().end());
-    std::stable_sort(sorted_nets.begin(), sorted_nets.end(), [&](ParentNetId id1, ParentNetId id2) -> bool {
-        return _net_list.net_sinks(id1).size() > _net_list.net_sinks(id2).size();
-    });
+    sort_nets_for_routing(sorted_nets, _net_list, _router_opts, _timing_info.get(), _netlist_pin_lookup, _is_flat);
 
     for (size_t inet = 0; inet < sorted_nets.size(); inet++) {
         ParentNetId net_id = sorted_nets[inet];
@@ -17,6 +17,11 @@
 #include "read_xml_arch_file.h"
 #include "route_tree.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/enumerable_thread_specific.h>
+#    include <tbb/parallel_for_each.h>
+#endif
+
 /******************** Subroutines local to this module **********************/
 static void check_node_and_range(RRNodeId inode,
                                  enum e_route_type route_type,
@@ -29,7 +34,14 @@ static void check_sink(const Netlist<>& net_list,
                        RRNodeId inode,
                        int net_pin_index,
                        ParentNetId net_id,
-                       bool* pin_done);
+                       std::vector<bool>& pin_done);
+
+static void check_net_route(const Netlist<>& net_list,
+                            ParentNetId net_id,
+                            enum e_route_type route_type,
+                            size_t num_switches,
+                            std::vector<bool>& pin_done,
+                            bool is_flat);
 
 static void check_switch(const RouteTreeNode& rt_node, size_t num_switch);
 static bool check_adjacent(RRNodeId from_node, RRNodeId to_node, bool is_flat);
@@ -65,9 +77,7 @@ void check_route(const Netlist<>& net_list,
         return;
     }
 
-    int max_pins;
-    unsigned int ipin;
-    bool valid, connects;
+    bool valid;
 
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
@@ -95,83 +105,101 @@ void check_route(const Netlist<>& net_list,
                                      is_flat);
     }
 
-    max_pins = 0;
-    for (auto net_id : net_list.nets())
-        max_pins = std::max(max_pins, (int)net_list.net_pins(net_id).size());
-
-    auto pin_done = std::make_unique<bool[]>(max_pins);
-
-    /* Now check that all nets are indeed connected. */
+    /* Now check that all nets are indeed connected. The nets are checked  *
+     * independently, so they are checked in parallel when possible.        */
+#ifdef VPR_USE_TBB
+    tbb::enumerable_thread_specific<std::vector<bool>> thread_pin_done;
+    tbb::parallel_for_each(net_list.nets().begin(), net_list.nets().end(), [&](ParentNetId net_id) {
+        check_net_route(net_list, net_id, route_type, num_switches, thread_pin_done.local(), is_flat);
+    });
+#else
+    std::vector<bool> pin_done;
     for (auto net_id : net_list.nets()) {
-        if (net_list.net_is_ignored(net_id) || net_list.net_sinks(net_id).size() == 0) /* Skip ignored nets. */
-            continue;
+        check_net_route(net_list, net_id, route_type, num_switches, pin_done, is_flat);
+    }
+#endif
 
-        std::fill_n(pin_done.get(), net_list.net_pins(net_id).size(), false);
+    if (check_route_option == e_check_route_option::FULL) {
+        check_all_non_configurable_edges(net_list, is_flat);
+    } else {
+        VTR_ASSERT(check_route_option == e_check_route_option::QUICK);
+    }
 
-        if (!route_ctx.route_trees[net_id]) {
-            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
-                            "in check_route: net %d has no routing.\n", size_t(net_id));
-        }
+    VTR_LOG("Completed routing consistency check successfully.\n");
+    VTR_LOG("\n");
+}
 
-        /* Check the SOURCE of the net. */
-        RRNodeId source_inode = route_ctx.route_trees[net_id].value().root().inode;
-        check_node_and_range(source_inode, route_type, is_flat);
-        check_source(net_list, source_inode, net_id, is_flat);
+/* Checks that the routing of net_id is a properly connected path from its  *
+ * SOURCE to all its SINKs, without stubs. pin_done is scratch space.       */
+static void check_net_route(const Netlist<>& net_list,
+                            ParentNetId net_id,
+                            enum e_route_type route_type,
+                            size_t num_switches,
+                            std::vector<bool>& pin_done,
+                            bool is_flat) {
+    auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+    auto& route_ctx = g_vpr_ctx.routing();
 
-        pin_done[0] = true;
+    if (net_list.net_is_ignored(net_id) || net_list.net_sinks(net_id).size() == 0) /* Skip ignored nets. */
+        return;
 
-        /* Check the rest of the net */
-        size_t num_sinks = 0;
-        for (auto& rt_node : route_ctx.route_trees[net_id].value().all_nodes()) {
-            RRNodeId inode = rt_node.inode;
-            int net_pin_index = rt_node.net_pin_index;
-            check_node_and_range(inode, route_type, is_flat);
-            check_switch(rt_node, num_switches);
-
-            if (rt_node.parent()) {
-                connects = check_adjacent(rt_node.parent()->inode, rt_node.inode, is_flat);
-                if (!connects) {
-                    VPR_ERROR(VPR_ERROR_ROUTE,
-                              "in check_route: found non-adjacent segments in traceback while checking net %d:\n"
-                              "  %s\n"
-                              "  %s\n",
-                              size_t(net_id),
-                              describe_rr_node(rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, rt_node.parent()->inode, is_flat).c_str(),
-                              describe_rr_node(rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, inode, is_flat).c_str());
-                }
-            }
+    pin_done.assign(net_list.net_pins(net_id).size(), false);
 
-            if (rr_graph.node_type(inode) == SINK) {
-                check_sink(net_list, inode, net_pin_index, net_id, pin_done.get());
-                num_sinks += 1;
-            }
-        }
+    if (!route_ctx.route_trees[net_id]) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                        "in check_route: net %d has no routing.\n", size_t(net_id));
+    }
 
-        if (num_sinks != net_list.net_sinks(net_id).size()) {
-            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
-                            "in check_route: net %zu (%s) has %zu SINKs (expected %zu).\n",
-                            size_t(net_id), net_list.net_name(net_id).c_str(),
-                            num_sinks, net_list.net_sinks(net_id).size());
+    /* Check the SOURCE of the net. */
+    RRNodeId source_inode = route_ctx.route_trees[net_id].value().root().inode;
+    check_node_and_range(source_inode, route_type, is_flat);
+    check_source(net_list, source_inode, net_id, is_flat);
+
+    pin_done[0] = true;
+
+    /* Check the rest of the net */
+    size_t num_sinks = 0;
+    for (auto& rt_node : route_ctx.route_trees[net_id].value().all_nodes()) {
+        RRNodeId inode = rt_node.inode;
+        int net_pin_index = rt_node.net_pin_index;
+        check_node_and_range(inode, route_type, is_flat);
+        check_switch(rt_node, num_switches);
+
+        if (rt_node.parent()) {
+            bool connects = check_adjacent(rt_node.parent()->inode, rt_node.inode, is_flat);
+            if (!connects) {
+                VPR_ERROR(VPR_ERROR_ROUTE,
+                          "in check_route: found non-adjacent segments in traceback while checking net %d:\n"
+                          "  %s\n"
+                          "  %s\n",
+                          size_t(net_id),
+                          describe_rr_node(rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, rt_node.parent()->inode, is_flat).c_str(),
+                          describe_rr_node(rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, inode, is_flat).c_str());
+            }
         }
 
-        for (ipin = 0; ipin < net_list.net_pins(net_id).size(); ipin++) {
-            if (pin_done[ipin] == false) {
-                VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
-                                "in check_route: net %zu does not connect to pin %d.\n", size_t(net_id), ipin);
-            }
+        if (rr_graph.node_type(inode) == SINK) {
+            check_sink(net_list, inode, net_pin_index, net_id, pin_done);
+            num_sinks += 1;
         }
+    }
 
-        check_net_for_stubs(net_list, net_id, is_flat);
-    } /* End for each net */
+    if (num_sinks != net_list.net_sinks(net_id).size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                        "in check_route: net %zu (%s) has %zu SINKs (expected %zu).\n",
+                        size_t(net_id), net_list.net_name(net_id).c_str(),
+                        num_sinks, net_list.net_sinks(net_id).size());
+    }
 
-    if (check_route_option == e_check_route_option::FULL) {
-        check_all_non_configurable_edges(net_list, is_flat);
-    } else {
-        VTR_ASSERT(check_route_option == e_check_route_option::QUICK);
+    for (unsigned int ipin = 0; ipin < net_list.net_pins(net_id).size(); ipin++) {
+        if (pin_done[ipin] == false) {
+            VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                            "in check_route: net %zu does not connect to pin %d.\n", size_t(net_id), ipin);
+        }
     }
 
-    VTR_LOG("Completed routing consistency check successfully.\n");
-    VTR_LOG("\n");
+    check_net_for_stubs(net_list, net_id, is_flat);
 }
 
 /* Checks that this SINK node is one of the terminals of inet, and marks   *
@@ -180,7 +208,7 @@ static void check_sink(const Netlist<>& net_list,
                        RRNodeId inode,
                        int net_pin_index,
                        ParentNetId net_id,
-                       bool* pin_done) {
+                       std::vector<bool>& pin_done) {
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
 
@@ -480,10 +508,30 @@ void recompute_occupancy_from_scratch(const Netlist<>& net_list, bool is_flat) {
 
     /* First set the occupancy of everything to zero. */
     for (RRNodeId inode : device_ctx.rr_graph.nodes())
-        route_ctx.rr_node_route_inf[inode].set_occ(0);
+        route_ctx.rr_node_cong_inf[inode].set_occ(0);
 
     /* Now go through each net and count the tracks and pins used everywhere */
 
+#ifdef VPR_USE_TBB
+    /* The route trees are walked in parallel, with each thread collecting the nodes *
+     * it finds, and the (cheap) occupancy increments are then applied serially.     */
+    tbb::enumerable_thread_specific<std::vector<RRNodeId>> thread_used_nodes;
+    tbb::parallel_for_each(net_list.nets().begin(), net_list.nets().end(), [&](ParentNetId net_id) {
+        if (!route_ctx.route_trees[net_id] || net_list.net_is_ignored(net_id))
+            return;
+
+        auto& used_nodes = thread_used_nodes.local();
+        for (auto& rt_node : route_ctx.route_trees[net_id].value().all_nodes()) {
+            used_nodes.push_back(rt_node.inode);
+        }
+    });
+
+    for (const auto& used_nodes : thread_used_nodes) {
+        for (RRNodeId inode : used_nodes) {
+            route_ctx.rr_node_cong_inf[inode].set_occ(route_ctx.rr_node_cong_inf[inode].occ() + 1);
+        }
+    }
+#else
     for (auto net_id : net_list.nets()) {
         if (!route_ctx.route_trees[net_id])
             continue;
@@ -493,9 +541,10 @@ void recompute_occupancy_from_scratch(const Netlist<>& net_list, bool is_flat) {
 
         for (auto& rt_node : route_ctx.route_trees[net_id].value().all_nodes()) {
             RRNodeId inode = rt_node.inode;
-            route_ctx.rr_node_route_inf[inode].set_occ(route_ctx.rr_node_route_inf[inode].occ() + 1);
+            route_ctx.rr_node_cong_inf[inode].set_occ(route_ctx.rr_node_cong_inf[inode].occ() + 1);
         }
     }
+#endif
 
     /* We only need to reserve output pins if flat routing is not enabled */
     if (!is_flat) {
@@ -510,7 +559,7 @@ void recompute_occupancy_from_scratch(const Netlist<>& net_list, bool is_flat) {
                 for (int ipin = 0; ipin < num_local_opins; ipin++) {
                     RRNodeId inode = route_ctx.clb_opins_used_locally[cluster_blk_id][iclass][ipin];
                     VTR_ASSERT(inode && size_t(inode) < device_ctx.rr_graph.num_nodes());
-                    route_ctx.rr_node_route_inf[inode].set_occ(route_ctx.rr_node_route_inf[inode].occ() + 1);
+                    route_ctx.rr_node_cong_inf[inode].set_occ(route_ctx.rr_node_cong_inf[inode].occ() + 1);
                 }
             }
         }
@@ -588,12 +637,21 @@ static void check_all_non_configurable_edges(const Netlist<>& net_list, bool is_
     vtr::ScopedStartFinishTimer timer("Checking to ensure non-configurable edges are legal");
     auto non_configurable_rr_sets = identify_non_configurable_rr_sets();
 
+#ifdef VPR_USE_TBB
+    tbb::parallel_for_each(net_list.nets().begin(), net_list.nets().end(), [&](ParentNetId net_id) {
+        check_non_configurable_edges(net_list,
+                                     net_id,
+                                     non_configurable_rr_sets,
+                                     is_flat);
+    });
+#else
     for (auto net_id : net_list.nets()) {
         check_non_configurable_edges(net_list,
                                      net_id,
                                      non_configurable_rr_sets,
                                      is_flat);
     }
+#endif
 }
 
 // Checks that the specified routing is legal with respect to non-configurable edges
@@ -605,7 +663,7 @@ static bool check_non_configurable_edges(const Netlist<>& net_list,
                                          const t_non_configurable_rr_sets& non_configurable_rr_sets,
                                          bool is_flat) {
     const auto& device_ctx = g_vpr_ctx.device();
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
+    auto& route_ctx = g_vpr_ctx.routing();
 
     if (!route_ctx.route_trees[net]) // no routing
         return true;
@@ -808,7 +866,7 @@ void check_net_for_stubs(const Netlist<>& net_list,
 }
 
 bool StubFinder::CheckNet(ParentNetId net) {
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
+    auto& route_ctx = g_vpr_ctx.routing();
     stub_nodes_.clear();
 
     if (!route_ctx.route_trees[net])
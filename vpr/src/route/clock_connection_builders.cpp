@@ -11,6 +11,10 @@
 #include <random>
 #include <math.h>
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 /*
  * RoutingToClockConnection (setters)
  */
@@ -170,17 +174,14 @@ size_t ClockToClockConneciton::estimate_additional_nodes() {
 void ClockToClockConneciton::create_switches(const ClockRRGraphBuilder& clock_graph, t_rr_edge_info_set* rr_edges_to_create) {
     auto& grid = clock_graph.grid();
 
-    auto to_locations = clock_graph.get_switch_locations(to_clock, to_switch);
+    const SwitchPoint& to_switch_point = clock_graph.get_switch_point(to_clock, to_switch);
+    const SwitchPoint& from_switch_point = clock_graph.get_switch_point(from_clock, from_switch);
 
-    for (auto location : to_locations) {
+    for (auto location : to_switch_point.get_switch_locations()) {
         auto x = location.first;
         auto y = location.second;
 
-        auto to_rr_node_indices = clock_graph.get_rr_node_indices_at_switch_location(
-            to_clock,
-            to_switch,
-            x,
-            y);
+        const auto& to_rr_node_indices = to_switch_point.get_rr_node_indices_at_location(x, y);
 
         // boundary conditions:
         // y at gird height and height -1 connections share the same drive point
@@ -192,11 +193,7 @@ void ClockToClockConneciton::create_switches(const ClockRRGraphBuilder& clock_gr
             y = 1;
         }
 
-        auto from_rr_node_indices = clock_graph.get_rr_node_indices_at_switch_location(
-            from_clock,
-            from_switch,
-            x,
-            y);
+        const auto& from_rr_node_indices = from_switch_point.get_rr_node_indices_at_location(x, y);
 
         auto from_itter = from_rr_node_indices.begin();
         size_t num_connections = ceil(from_rr_node_indices.size() * fc);
@@ -246,13 +243,67 @@ size_t ClockToPinsConnection::estimate_additional_nodes() {
     return 0;
 }
 
+/* Returns the clock pins of a tile type at each of its locations and sides [0..width-1][0..height-1][0..NUM_SIDES-1]:
+ * the template stamped at each location of the type. Empty for the types without blocks. */
+static vtr::NdMatrix<std::vector<int>, 3> get_clock_pins_template(t_physical_tile_type_ptr type) {
+    vtr::NdMatrix<std::vector<int>, 3> clock_pins;
+
+    // Skip EMPTY type
+    if (is_empty_type(type)) {
+        return clock_pins;
+    }
+
+    // Ignore grid locations that do not have blocks
+    bool has_pb_type = false;
+    auto equivalent_sites = get_equivalent_sites_set(type);
+    for (auto logical_block : equivalent_sites) {
+        if (logical_block->pb_type) {
+            has_pb_type = true;
+            break;
+        }
+    }
+
+    if (!has_pb_type) {
+        return clock_pins;
+    }
+
+    clock_pins.resize({size_t(type->width), size_t(type->height), NUM_SIDES});
+    std::vector<int> clock_pins_indices = type->get_clock_pins_indices();
+    for (int width_offset = 0; width_offset < type->width; width_offset++) {
+        for (int height_offset = 0; height_offset < type->height; height_offset++) {
+            for (e_side side : SIDES) {
+                for (auto clock_pin_idx : clock_pins_indices) {
+                    //Can't do anything if pin isn't at this location
+                    if (type->pinloc[width_offset][height_offset][side][clock_pin_idx]) {
+                        clock_pins[width_offset][height_offset][side].push_back(clock_pin_idx);
+                    }
+                }
+            }
+        }
+    }
+
+    return clock_pins;
+}
+
 void ClockToPinsConnection::create_switches(const ClockRRGraphBuilder& clock_graph, t_rr_edge_info_set* rr_edges_to_create) {
     auto& device_ctx = g_vpr_ctx.device();
     const auto& node_lookup = device_ctx.rr_graph.node_lookup();
     auto& grid = clock_graph.grid();
     int layer_num = 0; //Function *FOR NOW* assumes that layer_num is always 0
 
-    for (int x = 0; x < (int)grid.width(); x++) {
+    // The clock pins of each tile type, found once and stamped at each location of the type
+    std::vector<vtr::NdMatrix<std::vector<int>, 3>> clock_pins_templates;
+    for (const auto& type : device_ctx.physical_tile_types) {
+        clock_pins_templates.push_back(get_clock_pins_template(&type));
+    }
+
+    const SwitchPoint& clock_switch_point = clock_graph.get_switch_point(clock_to_connect_from, switch_point_name);
+
+    // The edges of each column are created independently, then appended in column order
+    std::vector<t_rr_edge_info_set> column_edges(grid.width());
+    auto create_column_switches = [&](int x) {
+        t_rr_edge_info_set& edges = column_edges[x];
+
         for (int y = 0; y < (int)grid.height(); y++) {
             //Avoid boundary
             if ((y == 0 && x == 0) || (x == (int)grid.width() - 1 && y == (int)grid.height() - 1)) {
@@ -260,41 +311,23 @@ void ClockToPinsConnection::create_switches(const ClockRRGraphBuilder& clock_gra
             }
 
             auto type = grid.get_physical_type({x, y, layer_num});
+            const auto& clock_pins = clock_pins_templates[type->index];
 
-            // Skip EMPTY type
-            if (is_empty_type(type)) {
+            // Skip the types without blocks
+            if (clock_pins.empty()) {
                 continue;
             }
 
             auto width_offset = grid.get_width_offset({x, y, layer_num});
             auto height_offset = grid.get_height_offset({x, y, layer_num});
 
-            // Ignore grid locations that do not have blocks
-            bool has_pb_type = false;
-            auto equivalent_sites = get_equivalent_sites_set(type);
-            for (auto logical_block : equivalent_sites) {
-                if (logical_block->pb_type) {
-                    has_pb_type = true;
-                    break;
-                }
-            }
-
-            if (!has_pb_type) {
-                continue;
-            }
-
             for (e_side side : SIDES) {
                 //Don't connect pins which are not adjacent to channels around the perimeter
                 if ((x == 0 && side != RIGHT) || (x == (int)grid.width() - 1 && side != LEFT) || (y == 0 && side != TOP) || (y == (int)grid.height() - 1 && side != BOTTOM)) {
                     continue;
                 }
 
-                for (auto clock_pin_idx : type->get_clock_pins_indices()) {
-                    //Can't do anything if pin isn't at this location
-                    if (0 == type->pinloc[width_offset][height_offset][side][clock_pin_idx]) {
-                        continue;
-                    }
-
+                for (auto clock_pin_idx : clock_pins[width_offset][height_offset][side]) {
                     //Adjust boundary connections (TODO: revisit if chany connections)
                     int clock_x_offset = 0;
                     int clock_y_offset = 0;
@@ -317,18 +350,28 @@ void ClockToPinsConnection::create_switches(const ClockRRGraphBuilder& clock_gra
                                                                     clock_pin_idx,
                                                                     side);
 
-                    auto clock_network_indices = clock_graph.get_rr_node_indices_at_switch_location(
-                        clock_to_connect_from,
-                        switch_point_name,
+                    const auto& clock_network_indices = clock_switch_point.get_rr_node_indices_at_location(
                         x + clock_x_offset,
                         y + clock_y_offset);
 
                     //Create edges depending on Fc
                     for (size_t i = 0; i < clock_network_indices.size() * fc; i++) {
-                        clock_graph.add_edge(rr_edges_to_create, RRNodeId(clock_network_indices[i]), RRNodeId(clock_pin_node_idx), arch_switch_idx, false);
+                        clock_graph.add_edge(&edges, RRNodeId(clock_network_indices[i]), RRNodeId(clock_pin_node_idx), arch_switch_idx, false);
                     }
                 }
             }
         }
+    };
+
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(0, (int)grid.width(), create_column_switches);
+#else
+    for (int x = 0; x < (int)grid.width(); x++) {
+        create_column_switches(x);
+    }
+#endif
+
+    for (const t_rr_edge_info_set& edges : column_edges) {
+        rr_edges_to_create->insert(rr_edges_to_create->end(), edges.begin(), edges.end());
     }
 }
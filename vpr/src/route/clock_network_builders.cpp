@@ -190,43 +190,67 @@ void ClockRib::create_segments(std::vector<t_segment_inf>& segment_inf) {
     populate_segment_values(index, name, length, x_chan_wire.layer, segment_inf, X_AXIS);
 }
 
-size_t ClockRib::estimate_additional_nodes(const DeviceGrid& grid) {
+std::vector<ClockWireSpan> ClockRib::get_row_spans(const DeviceGrid& grid, bool warn) const {
     // Avoid an infinite loop
-    VTR_ASSERT(repeat.y > 0);
     VTR_ASSERT(repeat.x > 0);
 
-    size_t num_additional_nodes = 0;
-    for (unsigned y = x_chan_wire.position; y < grid.height() - 1; y += repeat.y) {
-        for (unsigned x_start = x_chan_wire.start; x_start < grid.width() - 1; x_start += repeat.x) {
-            unsigned drive_x = x_start + drive.offset;
-            unsigned x_end = x_start + x_chan_wire.length;
-
-            // Adjust for boundry conditions
-            int x_offset = 0;
-            if ((x_start == 0) ||              // CHANX wires left boundry
-                (x_start + repeat.x == x_end)) // Avoid overlap
-            {
-                x_offset = 1;
-            }
-            if (x_end > grid.width() - 2) {
-                x_end = grid.width() - 2; // CHANX wires right boundry
-            }
+    std::vector<ClockWireSpan> spans;
+    for (unsigned x_start = x_chan_wire.start; x_start < grid.width() - 1; x_start += repeat.x) {
+        unsigned drive_x = x_start + drive.offset;
+        unsigned x_end = x_start + x_chan_wire.length;
+
+        // Adjust for boundry conditions
+        int x_offset = 0;
+        if ((x_start == 0) ||              // CHANX wires left boundry
+            (x_start + repeat.x == x_end)) // Avoid overlap
+        {
+            x_offset = 1;
+        }
+        if (x_end > grid.width() - 2) {
+            x_end = grid.width() - 2; // CHANX wires right boundry
+        }
 
-            // Dont create rib if drive point is not reachable
-            if (drive_x > grid.width() - 2 || drive_x >= x_end || drive_x <= (x_start + x_offset)) {
-                continue;
+        // Dont create rib if drive point is not reachable
+        if (drive_x > grid.width() - 2 || drive_x >= x_end || drive_x <= (x_start + x_offset)) {
+            if (warn) {
+                vtr::printf_warning(__FILE__, __LINE__,
+                                    "A rib part of clock network '%s' was not"
+                                    " created becuase the drive point is not reachable. "
+                                    "This can lead to an unroutable architecture.\n",
+                                    clock_name_.c_str());
             }
+            continue;
+        }
 
-            // Dont create rib if wire segment is too small
-            if ((x_start + x_offset) >= x_end) {
-                continue;
+        // Dont create rib if wire segment is too small
+        if ((x_start + x_offset) >= x_end) {
+            if (warn) {
+                vtr::printf_warning(__FILE__, __LINE__,
+                                    "Rib start '%d' and end '%d' values are "
+                                    "not sucessive for clock network '%s' due to not meeting boundry conditions."
+                                    " This can lead to an unroutable architecture.\n",
+                                    (x_start + x_offset), x_end, clock_name_.c_str());
             }
-
-            num_additional_nodes += 3;
+            continue;
         }
+
+        spans.push_back({int(x_start + x_offset), int(drive_x), int(x_end)});
+    }
+
+    return spans;
+}
+
+size_t ClockRib::estimate_additional_nodes(const DeviceGrid& grid) {
+    // Avoid an infinite loop
+    VTR_ASSERT(repeat.y > 0);
+
+    size_t num_rows = 0;
+    for (unsigned y = x_chan_wire.position; y < grid.height() - 1; y += repeat.y) {
+        ++num_rows;
     }
 
-    return num_additional_nodes;
+    // A drive point and two half ribs for each rib of each row
+    return 3 * num_rows * get_row_spans(grid, false).size();
 }
 
 void ClockRib::create_rr_nodes_and_internal_edges_for_one_instance(ClockRRGraphBuilder& clock_graph,
@@ -250,76 +274,51 @@ void ClockRib::create_rr_nodes_and_internal_edges_for_one_instance(ClockRRGraphB
     VTR_ASSERT(g_vpr_ctx.device().grid.get_num_layers() == 1);
     int layer_num = 0;
 
-    for (unsigned y = x_chan_wire.position; y < grid.height() - 1; y += repeat.y) {
-        for (unsigned x_start = x_chan_wire.start; x_start < grid.width() - 1; x_start += repeat.x) {
-            unsigned drive_x = x_start + drive.offset;
-            unsigned x_end = x_start + x_chan_wire.length;
-
-            // Adjust for boundry conditions
-            int x_offset = 0;
-            if ((x_start == 0) ||              // CHANX wires left boundry
-                (x_start + repeat.x == x_end)) // Avoid overlap
-            {
-                x_offset = 1;
-            }
-            if (x_end > grid.width() - 2) {
-                x_end = grid.width() - 2; // CHANX wires right boundry
-            }
-
-            // Dont create rib if drive point is not reachable
-            if (drive_x > grid.width() - 2 || drive_x >= x_end || drive_x <= (x_start + x_offset)) {
-                vtr::printf_warning(__FILE__, __LINE__,
-                                    "A rib part of clock network '%s' was not"
-                                    " created becuase the drive point is not reachable. "
-                                    "This can lead to an unroutable architecture.\n",
-                                    clock_name_.c_str());
-                continue;
-            }
+    // The ribs of a row, stamped on each of the repeated rows
+    const std::vector<ClockWireSpan> row_spans = get_row_spans(grid, true);
+    if (row_spans.empty() || unsigned(x_chan_wire.position) >= grid.height() - 1) {
+        return;
+    }
 
-            // Dont create rib if wire segment is too small
-            if ((x_start + x_offset) >= x_end) {
-                vtr::printf_warning(__FILE__, __LINE__,
-                                    "Rib start '%d' and end '%d' values are "
-                                    "not sucessive for clock network '%s' due to not meeting boundry conditions."
-                                    " This can lead to an unroutable architecture.\n",
-                                    (x_start + x_offset), x_end, clock_name_.c_str());
-                continue;
-            }
+    SwitchPoint& drive_points = clock_graph.get_or_create_switch_point(get_name(), drive.name);
+    SwitchPoint& tap_points = clock_graph.get_or_create_switch_point(get_name(), tap.name);
 
+    for (unsigned y = x_chan_wire.position; y < grid.height() - 1; y += repeat.y) {
+        for (const ClockWireSpan& span : row_spans) {
             // create drive point (length zero wire)
             auto drive_node_idx = create_chanx_wire(layer_num,
-                                                    drive_x,
-                                                    drive_x,
+                                                    span.drive,
+                                                    span.drive,
                                                     y,
                                                     ptc_num,
                                                     Direction::BIDIR,
                                                     rr_nodes,
                                                     rr_graph_builder);
-            clock_graph.add_switch_location(get_name(), drive.name, drive_x, y, drive_node_idx);
+            drive_points.insert_node_idx(span.drive, y, drive_node_idx);
 
             // create rib wire to the right and left of the drive point
             auto left_node_idx = create_chanx_wire(layer_num,
-                                                   x_start + x_offset,
-                                                   drive_x - 1,
+                                                   span.start,
+                                                   span.drive - 1,
                                                    y,
                                                    ptc_num,
                                                    Direction::DEC,
                                                    rr_nodes,
                                                    rr_graph_builder);
             auto right_node_idx = create_chanx_wire(layer_num,
-                                                    drive_x + 1,
-                                                    x_end,
+                                                    span.drive + 1,
+                                                    span.end,
                                                     y,
                                                     ptc_num,
                                                     Direction::INC,
                                                     rr_nodes,
                                                     rr_graph_builder);
-            record_tap_locations(x_start + x_offset,
-                                 x_end,
+            record_tap_locations(span.start,
+                                 span.end,
                                  y,
                                  left_node_idx,
                                  right_node_idx,
-                                 clock_graph);
+                                 tap_points);
 
             // connect drive point to each half rib using a directed switch
             clock_graph.add_edge(rr_edges_to_create, RRNodeId(drive_node_idx), RRNodeId(left_node_idx), drive.switch_idx, false);
@@ -385,12 +384,12 @@ void ClockRib::record_tap_locations(unsigned x_start,
                                     unsigned y,
                                     int left_rr_node_idx,
                                     int right_rr_node_idx,
-                                    ClockRRGraphBuilder& clock_graph) {
+                                    SwitchPoint& tap_points) {
     for (unsigned x = x_start + tap.offset; x <= x_end; x += tap.increment) {
         if (x < (x_start + drive.offset - 1)) {
-            clock_graph.add_switch_location(get_name(), tap.name, x, y, left_rr_node_idx);
+            tap_points.insert_node_idx(x, y, left_rr_node_idx);
         } else {
-            clock_graph.add_switch_location(get_name(), tap.name, x, y, right_rr_node_idx);
+            tap_points.insert_node_idx(x, y, right_rr_node_idx);
         }
     }
 }
@@ -530,44 +529,67 @@ void ClockSpine::create_segments(std::vector<t_segment_inf>& segment_inf) {
     populate_segment_values(index, name, length, y_chan_wire.layer, segment_inf, Y_AXIS);
 }
 
-size_t ClockSpine::estimate_additional_nodes(const DeviceGrid& grid) {
-    size_t num_additional_nodes = 0;
-
+std::vector<ClockWireSpan> ClockSpine::get_column_spans(const DeviceGrid& grid, bool warn) const {
     // Avoid an infinite loop
     VTR_ASSERT(repeat.y > 0);
-    VTR_ASSERT(repeat.x > 0);
 
-    for (unsigned x = y_chan_wire.position; x < grid.width() - 1; x += repeat.x) {
-        for (unsigned y_start = y_chan_wire.start; y_start < grid.height() - 1; y_start += repeat.y) {
-            unsigned drive_y = y_start + drive.offset;
-            unsigned y_end = y_start + y_chan_wire.length;
-
-            // Adjust for boundry conditions
-            unsigned y_offset = 0;
-            if ((y_start == 0) ||              // CHANY wires bottom boundry, start above the LB
-                (y_start + repeat.y == y_end)) // Avoid overlap
-            {
-                y_offset = 1;
-            }
-            if (y_end > grid.height() - 2) {
-                y_end = grid.height() - 2; // CHANY wires top boundry, dont go above the LB
-            }
+    std::vector<ClockWireSpan> spans;
+    for (unsigned y_start = y_chan_wire.start; y_start < grid.height() - 1; y_start += repeat.y) {
+        unsigned drive_y = y_start + drive.offset;
+        unsigned y_end = y_start + y_chan_wire.length;
+
+        // Adjust for boundry conditions
+        unsigned y_offset = 0;
+        if ((y_start == 0) ||              // CHANY wires bottom boundry, start above the LB
+            (y_start + repeat.y == y_end)) // Avoid overlap
+        {
+            y_offset = 1;
+        }
+        if (y_end > grid.height() - 2) {
+            y_end = grid.height() - 2; // CHANY wires top boundry, dont go above the LB
+        }
 
-            // Dont create spine if drive point is not reachable
-            if (drive_y > grid.width() - 2 || drive_y >= y_end || drive_y <= (y_start + y_offset)) {
-                continue;
+        // Dont create spine if drive point is not reachable
+        if (drive_y > grid.width() - 2 || drive_y >= y_end || drive_y <= (y_start + y_offset)) {
+            if (warn) {
+                vtr::printf_warning(__FILE__, __LINE__,
+                                    "A spine part of clock network '%s' was not"
+                                    " created becuase the drive point is not reachable. "
+                                    "This can lead to an unroutable architecture.\n",
+                                    clock_name_.c_str());
             }
+            continue;
+        }
 
-            // Dont create spine if wire segment is too small
-            if ((y_start + y_offset) >= y_end) {
-                continue;
+        // Dont create spine if wire segment is too small
+        if ((y_start + y_offset) >= y_end) {
+            if (warn) {
+                vtr::printf_warning(__FILE__, __LINE__,
+                                    "Spine start '%d' and end '%d' values are "
+                                    "not sucessive for clock network '%s' due to not meeting boundry conditions."
+                                    " This can lead to an unroutable architecture.\n",
+                                    (y_start + y_offset), y_end, clock_name_.c_str());
             }
-
-            num_additional_nodes += 3;
+            continue;
         }
+
+        spans.push_back({int(y_start + y_offset), int(drive_y), int(y_end)});
     }
 
-    return num_additional_nodes;
+    return spans;
+}
+
+size_t ClockSpine::estimate_additional_nodes(const DeviceGrid& grid) {
+    // Avoid an infinite loop
+    VTR_ASSERT(repeat.x > 0);
+
+    size_t num_columns = 0;
+    for (unsigned x = y_chan_wire.position; x < grid.width() - 1; x += repeat.x) {
+        ++num_columns;
+    }
+
+    // A drive point and two half spines for each spine of each column
+    return 3 * num_columns * get_column_spans(grid, false).size();
 }
 
 void ClockSpine::create_rr_nodes_and_internal_edges_for_one_instance(ClockRRGraphBuilder& clock_graph,
@@ -585,58 +607,33 @@ void ClockSpine::create_rr_nodes_and_internal_edges_for_one_instance(ClockRRGrap
 
     int layer_num = 0; //Function "FOR NOW" assumes that layer_num is always 0
 
-    for (unsigned x = y_chan_wire.position; x < grid.width() - 1; x += repeat.x) {
-        for (unsigned y_start = y_chan_wire.start; y_start < grid.height() - 1; y_start += repeat.y) {
-            unsigned drive_y = y_start + drive.offset;
-            unsigned y_end = y_start + y_chan_wire.length;
-
-            // Adjust for boundry conditions
-            unsigned y_offset = 0;
-            if ((y_start == 0) ||              // CHANY wires bottom boundry, start above the LB
-                (y_start + repeat.y == y_end)) // Avoid overlap
-            {
-                y_offset = 1;
-            }
-            if (y_end > grid.height() - 2) {
-                y_end = grid.height() - 2; // CHANY wires top boundry, dont go above the LB
-            }
-
-            // Dont create spine if drive point is not reachable
-            if (drive_y > grid.width() - 2 || drive_y >= y_end || drive_y <= (y_start + y_offset)) {
-                vtr::printf_warning(__FILE__, __LINE__,
-                                    "A spine part of clock network '%s' was not"
-                                    " created becuase the drive point is not reachable. "
-                                    "This can lead to an unroutable architecture.\n",
-                                    clock_name_.c_str());
-                continue;
-            }
+    // The spines of a column, stamped on each of the repeated columns
+    const std::vector<ClockWireSpan> column_spans = get_column_spans(grid, true);
+    if (column_spans.empty() || unsigned(y_chan_wire.position) >= grid.width() - 1) {
+        return;
+    }
 
-            // Dont create spine if wire segment is too small
-            if ((y_start + y_offset) >= y_end) {
-                vtr::printf_warning(__FILE__, __LINE__,
-                                    "Spine start '%d' and end '%d' values are "
-                                    "not sucessive for clock network '%s' due to not meeting boundry conditions."
-                                    " This can lead to an unroutable architecture.\n",
-                                    (y_start + y_offset), y_end, clock_name_.c_str());
-                continue;
-            }
+    SwitchPoint& drive_points = clock_graph.get_or_create_switch_point(get_name(), drive.name);
+    SwitchPoint& tap_points = clock_graph.get_or_create_switch_point(get_name(), tap.name);
 
+    for (unsigned x = y_chan_wire.position; x < grid.width() - 1; x += repeat.x) {
+        for (const ClockWireSpan& span : column_spans) {
             //create drive point (length zero wire)
             auto drive_node_idx = create_chany_wire(layer_num,
-                                                    drive_y,
-                                                    drive_y,
+                                                    span.drive,
+                                                    span.drive,
                                                     x,
                                                     ptc_num,
                                                     Direction::BIDIR,
                                                     rr_nodes,
                                                     rr_graph_builder,
                                                     num_segments_x);
-            clock_graph.add_switch_location(get_name(), drive.name, x, drive_y, drive_node_idx);
+            drive_points.insert_node_idx(x, span.drive, drive_node_idx);
 
             // create spine wire above and below the drive point
             auto left_node_idx = create_chany_wire(layer_num,
-                                                   y_start + y_offset,
-                                                   drive_y - 1,
+                                                   span.start,
+                                                   span.drive - 1,
                                                    x,
                                                    ptc_num,
                                                    Direction::DEC,
@@ -644,8 +641,8 @@ void ClockSpine::create_rr_nodes_and_internal_edges_for_one_instance(ClockRRGrap
                                                    rr_graph_builder,
                                                    num_segments_x);
             auto right_node_idx = create_chany_wire(layer_num,
-                                                    drive_y + 1,
-                                                    y_end,
+                                                    span.drive + 1,
+                                                    span.end,
                                                     x,
                                                     ptc_num,
                                                     Direction::INC,
@@ -655,12 +652,12 @@ void ClockSpine::create_rr_nodes_and_internal_edges_for_one_instance(ClockRRGrap
 
             // Keep a record of the rr_node idx that we will use to connects switches to at
             // the tap point
-            record_tap_locations(y_start + y_offset,
-                                 y_end,
+            record_tap_locations(span.start,
+                                 span.end,
                                  x,
                                  left_node_idx,
                                  right_node_idx,
-                                 clock_graph);
+                                 tap_points);
 
             // connect drive point to each half spine using a directed switch
             clock_graph.add_edge(rr_edges_to_create, RRNodeId(drive_node_idx), RRNodeId(left_node_idx), drive.switch_idx, false);
@@ -726,12 +723,12 @@ void ClockSpine::record_tap_locations(unsigned y_start,
                                       unsigned x,
                                       int left_node_idx,
                                       int right_node_idx,
-                                      ClockRRGraphBuilder& clock_graph) {
+                                      SwitchPoint& tap_points) {
     for (unsigned y = y_start + tap.offset; y <= y_end; y += tap.increment) {
         if (y < (y_start + drive.offset - 1)) {
-            clock_graph.add_switch_location(get_name(), tap.name, x, y, left_node_idx);
+            tap_points.insert_node_idx(x, y, left_node_idx);
         } else {
-            clock_graph.add_switch_location(get_name(), tap.name, x, y, right_node_idx);
+            tap_points.insert_node_idx(x, y, right_node_idx);
         }
     }
 }
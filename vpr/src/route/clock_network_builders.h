@@ -14,6 +14,7 @@
 
 class t_rr_graph_storage;
 class ClockRRGraphBuilder;
+class SwitchPoint;
 
 enum class ClockType {
     SPINE,
@@ -74,6 +75,14 @@ struct HtreeTaps {
     Coordinates increment;
 };
 
+/* A rib (or spine) instance along its channel: the drive point, and the wires on either side of it
+ * (from start to drive - 1 and from drive + 1 to end) */
+struct ClockWireSpan {
+    int start = OPEN;
+    int drive = OPEN;
+    int end = OPEN;
+};
+
 class ClockNetwork {
   protected:
     std::string clock_name_;
@@ -175,6 +184,10 @@ class ClockRib : public ClockNetwork {
 
     void map_relative_seg_indices(const t_unified_to_parallel_seg_index& index_map) override;
 
+    /* Returns the ribs along a row (in the x). They are the same for all the repeated rows, so
+     * they are found once and then stamped on each row. Warns about the ribs which can't be created. */
+    std::vector<ClockWireSpan> get_row_spans(const DeviceGrid& grid, bool warn) const;
+
     int create_chanx_wire(int layer,
                           int x_start,
                           int x_end,
@@ -188,7 +201,7 @@ class ClockRib : public ClockNetwork {
                               unsigned y,
                               int left_rr_node_idx,
                               int right_rr_node_idx,
-                              ClockRRGraphBuilder& clock_graph);
+                              SwitchPoint& tap_points);
 };
 
 class ClockSpine : public ClockNetwork {
@@ -243,6 +256,11 @@ class ClockSpine : public ClockNetwork {
                                                              int num_segments_x) override;
     size_t estimate_additional_nodes(const DeviceGrid& grid) override;
     void map_relative_seg_indices(const t_unified_to_parallel_seg_index& index_map) override;
+
+    /* Returns the spines along a column (in the y). They are the same for all the repeated columns, so
+     * they are found once and then stamped on each column. Warns about the spines which can't be created. */
+    std::vector<ClockWireSpan> get_column_spans(const DeviceGrid& grid, bool warn) const;
+
     int create_chany_wire(int layer,
                           int y_start,
                           int y_end,
@@ -257,7 +275,7 @@ class ClockSpine : public ClockNetwork {
                               unsigned x,
                               int left_node_idx,
                               int right_node_idx,
-                              ClockRRGraphBuilder& clock_graph);
+                              SwitchPoint& tap_points);
 };
 
 class ClockHTree : private ClockNetwork {
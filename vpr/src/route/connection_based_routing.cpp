@@ -130,3 +130,20 @@ void Connection_based_routing_resources::clear_force_reroute_for_net(ParentNetId
         }
     }
 }
+
+std::vector<RRNodeId> Connection_based_routing_resources::get_net_forced_reroute_connections(ParentNetId net_id) const {
+    std::vector<RRNodeId> rr_sink_nodes;
+    for (const auto& force_reroute_flag : forcible_reroute_connection_flag[net_id]) {
+        if (force_reroute_flag.second)
+            rr_sink_nodes.push_back(force_reroute_flag.first);
+    }
+    return rr_sink_nodes;
+}
+
+void Connection_based_routing_resources::set_net_forced_reroute_connections(ParentNetId net_id, const std::vector<RRNodeId>& rr_sink_nodes) {
+    auto& net_flags = forcible_reroute_connection_flag[net_id];
+    for (auto& force_reroute_flag : net_flags)
+        force_reroute_flag.second = false;
+    for (RRNodeId rr_sink_node : rr_sink_nodes)
+        net_flags[rr_sink_node] = true;
+}
@@ -84,6 +84,12 @@ class Connection_based_routing_resources {
     void clear_force_reroute_for_connection(ParentNetId net_id, RRNodeId rr_sink_node);
     void clear_force_reroute_for_net(ParentNetId net_id);
 
+    // get and set the connection state of a net as a whole (for the distributed router to copy it between processes)
+    const std::vector<float>& get_net_lower_bound_connection_delays(ParentNetId net_id) const { return lower_bound_connection_delay[net_id]; }
+    void set_net_lower_bound_connection_delays(ParentNetId net_id, std::vector<float> delays) { lower_bound_connection_delay[net_id] = std::move(delays); }
+    std::vector<RRNodeId> get_net_forced_reroute_connections(ParentNetId net_id) const;
+    void set_net_forced_reroute_connections(ParentNetId net_id, const std::vector<RRNodeId>& rr_sink_nodes);
+
     // check each connection of each net to see if any satisfy the criteria described above (for the forcible_reroute_connection_flag data structure)
     // and if so, mark them to be rerouted
     bool forcibly_reroute_connections(float max_criticality,
@@ -3,6 +3,8 @@
 
 #include "binary_heap.h"
 #include "bucket.h"
+#include "four_ary_heap.h"
+#include "radix_heap.h"
 #include "rr_graph_fwd.h"
 
 /**
@@ -54,6 +56,7 @@ std::tuple<bool, bool, t_heap> ConnectionRouter<Heap>::timing_driven_route_conne
     std::tie(retry, cheapest) = timing_driven_route_connection_common_setup(rt_root, sink_node, cost_params, bounding_box);
 
     if (cheapest != nullptr) {
+        record_lookahead_error(rt_root, sink_node, cost_params, cheapest->backward_path_cost);
         rcv_path_manager.update_route_tree_set(cheapest->path_data);
         update_cheapest(cheapest);
         t_heap out = *cheapest;
@@ -93,9 +96,16 @@ std::tuple<bool, t_heap*> ConnectionRouter<Heap>::timing_driven_route_connection
                    bounding_box.layer_min, bounding_box.xmin, bounding_box.ymin,
                    bounding_box.layer_max, bounding_box.xmax, bounding_box.ymax);
 
-    t_heap* cheapest = timing_driven_route_connection_from_heap(sink_node,
-                                                                cost_params,
-                                                                bounding_box);
+    t_heap* cheapest;
+    if (should_use_bidir_search(source_node, sink_node, cost_params)) {
+        cheapest = timing_driven_route_connection_from_heap_bidir(sink_node,
+                                                                  cost_params,
+                                                                  bounding_box);
+    } else {
+        cheapest = timing_driven_route_connection_from_heap(sink_node,
+                                                            cost_params,
+                                                            bounding_box);
+    }
 
     if (cheapest == nullptr) {
         // No path found within the current bounding box.
@@ -182,6 +192,7 @@ std::tuple<bool, bool, t_heap> ConnectionRouter<Heap>::timing_driven_route_conne
         return std::make_tuple(false, retry_with_full_bb, t_heap());
     }
 
+    record_lookahead_error(rt_root, sink_node, cost_params, cheapest->backward_path_cost);
     rcv_path_manager.update_route_tree_set(cheapest->path_data);
     update_cheapest(cheapest);
 
@@ -193,6 +204,144 @@ std::tuple<bool, bool, t_heap> ConnectionRouter<Heap>::timing_driven_route_conne
     return std::make_tuple(true, retry_with_full_bb, out);
 }
 
+template<typename Heap>
+void ConnectionRouter<Heap>::record_lookahead_error(const RouteTreeNode& rt_root,
+                                                    RRNodeId sink_node,
+                                                    const t_conn_cost_params& cost_params,
+                                                    float path_cost) {
+    float predicted_cost = router_lookahead_.get_expected_cost(rt_root.inode, sink_node, cost_params, rt_root.R_upstream);
+    router_stats_->profile.add_lookahead_error(path_cost, predicted_cost);
+}
+
+// Finds paths from the route tree rooted at rt_root to each of sink_nodes for a
+// high fanout net, growing a single wavefront.
+//
+// The node labels (backward cost and prev_edge) left by the search for one sink
+// are still valid paths from the (grown) route tree, so the search for the next
+// sink continues from them: the frontier is re-keyed for the new target, and the
+// branch added for the previous sink is pushed as an extra set of sources.
+// Returns the number of sinks routed.
+template<typename Heap>
+size_t ConnectionRouter<Heap>::timing_driven_route_connections_from_route_tree_high_fanout_batch(
+    const RouteTreeNode& rt_root,
+    const std::vector<RRNodeId>& sink_nodes,
+    const t_conn_cost_params& cost_params,
+    const t_bb& net_bounding_box,
+    const SpatialRouteTreeLookup& spatial_rt_lookup,
+    RouterStats& router_stats,
+    const std::vector<ConnectionParameters>& conn_params,
+    const HighFanoutSinkRoutedFn& on_sink_routed) {
+    VTR_ASSERT(!sink_nodes.empty() && sink_nodes.size() == conn_params.size());
+    VTR_ASSERT(!rcv_path_manager.is_enabled());
+    router_stats_ = &router_stats;
+
+    // Seed the wavefront with the route tree nodes close to any of the sinks, and
+    // confine the search to the union of their high fanout bounding boxes
+    t_bb batch_bb;
+    batch_target_bbs_.clear();
+    for (size_t isink = 0; isink < sink_nodes.size(); isink++) {
+        RRNodeId sink_node = sink_nodes[isink];
+        conn_params_ = &conn_params[isink];
+        t_bb sink_bb = add_high_fanout_route_tree_to_heap(rt_root, sink_node, cost_params, spatial_rt_lookup, net_bounding_box);
+        if (isink == 0) {
+            batch_bb = sink_bb;
+        } else {
+            batch_bb.xmin = std::min(batch_bb.xmin, sink_bb.xmin);
+            batch_bb.ymin = std::min(batch_bb.ymin, sink_bb.ymin);
+            batch_bb.xmax = std::max(batch_bb.xmax, sink_bb.xmax);
+            batch_bb.ymax = std::max(batch_bb.ymax, sink_bb.ymax);
+            batch_bb.layer_min = std::min(batch_bb.layer_min, sink_bb.layer_min);
+            batch_bb.layer_max = std::max(batch_bb.layer_max, sink_bb.layer_max);
+        }
+
+        // The wavefront must not prune the IPINs of the other sinks' blocks
+        t_bb target_bb;
+        target_bb.xmin = rr_graph_->node_xlow(sink_node);
+        target_bb.ymin = rr_graph_->node_ylow(sink_node);
+        target_bb.xmax = rr_graph_->node_xhigh(sink_node);
+        target_bb.ymax = rr_graph_->node_yhigh(sink_node);
+        target_bb.layer_min = rr_graph_->node_layer(sink_node);
+        target_bb.layer_max = rr_graph_->node_layer(sink_node);
+        batch_target_bbs_.push_back(target_bb);
+    }
+
+    VTR_LOGV_DEBUG(router_debug_, "  Routing %zu sinks as high fanout batch (BB: %d,%d,%d x %d,%d,%d)\n", sink_nodes.size(),
+                   batch_bb.layer_min, batch_bb.xmin, batch_bb.ymin,
+                   batch_bb.layer_max, batch_bb.xmax, batch_bb.ymax);
+
+    size_t num_routed = 0;
+    for (size_t isink = 0; isink < sink_nodes.size(); isink++) {
+        RRNodeId sink_node = sink_nodes[isink];
+        conn_params_ = &conn_params[isink];
+
+        t_heap out;
+        const t_rr_node_route_inf& sink_inf = rr_node_route_inf_[sink_node];
+        if (std::isfinite(sink_inf.backward_path_cost)) {
+            // Already reached while searching for an earlier sink in the batch
+            out.index = sink_node;
+            out.set_prev_edge(sink_inf.prev_edge);
+            out.cost = sink_inf.backward_path_cost;
+            out.backward_path_cost = sink_inf.backward_path_cost;
+        } else {
+            rekey_heap(sink_node, cost_params);
+            t_heap* cheapest = timing_driven_route_connection_from_heap(sink_node,
+                                                                        cost_params,
+                                                                        batch_bb);
+            if (cheapest == nullptr) {
+                // Leave this and the remaining sinks to the single-sink search, which
+                // knows how to fall back to the full route tree
+                VTR_LOGV_DEBUG(router_debug_, "  No path found to sink %d in high fanout batch\n", sink_node);
+                break;
+            }
+            update_cheapest(cheapest);
+            out = *cheapest;
+            heap_.free(cheapest);
+        }
+
+        vtr::optional<const RouteTreeNode&> new_branch = on_sink_routed(isink, out);
+        num_routed++;
+
+        // The remaining sinks have different lookahead costs: keep only the backward
+        // labels, so a node is re-expanded only if a cheaper path to it is found
+        for (RRNodeId inode : modified_rr_node_inf_) {
+            rr_node_route_inf_[inode].path_cost = std::numeric_limits<float>::infinity();
+        }
+        if (new_branch && isink + 1 < sink_nodes.size()) {
+            add_route_tree_to_heap(new_branch.value(), sink_nodes[isink + 1], cost_params, batch_bb);
+        }
+    }
+
+    batch_target_bbs_.clear();
+    reset_path_costs();
+    modified_rr_node_inf_.clear();
+    heap_.empty_heap();
+
+    return num_routed;
+}
+
+// Recompute the cost of every heap element for a new target node
+template<typename Heap>
+void ConnectionRouter<Heap>::rekey_heap(RRNodeId target_node, const t_conn_cost_params& cost_params) {
+    std::vector<t_heap*> elements;
+    while (!heap_.is_empty_heap()) {
+        t_heap* hptr = heap_.get_heap_head();
+        if (hptr == nullptr)
+            break;
+        elements.push_back(hptr);
+    }
+
+    for (t_heap* hptr : elements) {
+        hptr->cost = hptr->backward_path_cost
+                     + cost_params.astar_fac
+                           * router_lookahead_.get_expected_cost(hptr->index,
+                                                                 target_node,
+                                                                 cost_params,
+                                                                 hptr->R_upstream);
+        heap_.push_back(hptr);
+    }
+    heap_.build_heap();
+}
+
 //Finds a path to sink_node, starting from the elements currently in the heap.
 //
 // This is the core maze routing routine.
@@ -209,7 +358,6 @@ t_heap* ConnectionRouter<Heap>::timing_driven_route_connection_from_heap(RRNodeI
     }
 
     const auto& device_ctx = g_vpr_ctx.device();
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
 
     t_heap* cheapest = nullptr;
     while (!heap_.is_empty_heap()) {
@@ -226,11 +374,11 @@ t_heap* ConnectionRouter<Heap>::timing_driven_route_connection_from_heap(RRNodeI
 
         // Have we found the target?
         if (inode == sink_node) {
-            // If we're running RCV, the path will be stored in the path_data->path_rr vector
+            // If we're running RCV, the path will be stored in the path_data->last_step list
             // This is then placed into the traceback so that the correct path is returned
             // TODO: This can be eliminated by modifying the actual traceback function in route_timing
             if (rcv_path_manager.is_enabled()) {
-                rcv_path_manager.insert_backwards_path_into_traceback(cheapest->path_data, cheapest->cost, cheapest->backward_path_cost, route_ctx);
+                rcv_path_manager.insert_backwards_path_into_traceback(cheapest->path_data, cheapest->cost, cheapest->backward_path_cost, rr_node_route_inf_);
             }
             VTR_LOGV_DEBUG(router_debug_, "  Found target %8d (%s)\n", inode, describe_rr_node(device_ctx.rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, inode, is_flat_).c_str());
             break;
@@ -260,6 +408,197 @@ t_heap* ConnectionRouter<Heap>::timing_driven_route_connection_from_heap(RRNodeI
     return cheapest;
 }
 
+template<typename Heap>
+bool ConnectionRouter<Heap>::should_use_bidir_search(RRNodeId source_node,
+                                                     RRNodeId sink_node,
+                                                     const t_conn_cost_params& cost_params) {
+    if (cost_params.bidir_search_min_dist < 0
+        || cost_params.criticality > cost_params.bidir_search_max_criticality
+        || rcv_path_manager.is_enabled()) {
+        return false;
+    }
+
+    // The backward wave needs the fan-in of each node
+    if (g_vpr_ctx.routing().rr_reverse_edges.num_nodes() != rr_nodes_.size())
+        return false;
+
+    int dist = std::abs(rr_graph_->node_xlow(source_node) - rr_graph_->node_xlow(sink_node))
+               + std::abs(rr_graph_->node_ylow(source_node) - rr_graph_->node_ylow(sink_node));
+    return dist >= cost_params.bidir_search_min_dist;
+}
+
+template<typename Heap>
+t_heap* ConnectionRouter<Heap>::timing_driven_route_connection_from_heap_bidir(RRNodeId sink_node,
+                                                                               const t_conn_cost_params& cost_params,
+                                                                               const t_bb& bounding_box) {
+    VTR_ASSERT_SAFE(heap_.is_valid());
+    VTR_ASSERT(!rcv_path_manager.is_enabled());
+
+    if (bidir_route_inf_.size() != rr_nodes_.size()) {
+        bidir_route_inf_.assign(rr_nodes_.size(), {RREdgeId::INVALID(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity()});
+    }
+
+    // Seed the backward wave with the sink
+    t_heap* seed = bidir_heap_.alloc();
+    seed->index = sink_node;
+    bidir_heap_.add_to_heap(seed);
+
+    t_heap* cheapest = nullptr;
+    while (!heap_.is_empty_heap()) {
+        // Forward step: same as timing_driven_route_connection_from_heap, but stop at backward-expanded nodes
+        t_heap* fwd = heap_.get_heap_head();
+        update_router_stats(router_stats_,
+                            false,
+                            fwd->index,
+                            rr_graph_);
+
+        RRNodeId inode = fwd->index;
+        if (inode == sink_node) {
+            cheapest = fwd;
+            break;
+        }
+
+        if (std::isfinite(bidir_route_inf_[inode].path_cost)) {
+            const t_rr_node_route_inf& route_inf = rr_node_route_inf_[inode];
+            if (route_inf.path_cost > fwd->cost && route_inf.backward_path_cost > fwd->backward_path_cost) {
+                VTR_LOGV_DEBUG(router_debug_, "  Forward wave met backward wave at node %d\n", inode);
+                update_cheapest(fwd);
+                heap_.free(fwd);
+                cheapest = bidir_splice_path(inode, sink_node);
+                break;
+            }
+        }
+
+        timing_driven_expand_cheapest(fwd,
+                                      sink_node,
+                                      cost_params,
+                                      bounding_box);
+        heap_.free(fwd);
+
+        // Backward step: plain Dijkstra from the sink
+        if (bidir_heap_.is_empty_heap())
+            continue;
+
+        t_heap* bwd = bidir_heap_.get_heap_head();
+        update_router_stats(router_stats_,
+                            false,
+                            bwd->index,
+                            rr_graph_);
+
+        RRNodeId bnode = bwd->index;
+        t_rr_node_route_inf& bidir_inf = bidir_route_inf_[bnode];
+        if (bwd->cost < bidir_inf.path_cost) {
+            if (std::isinf(bidir_inf.path_cost))
+                bidir_modified_.push_back(bnode);
+            bidir_inf.prev_edge = bwd->prev_edge();
+            bidir_inf.path_cost = bwd->cost;
+            bidir_inf.backward_path_cost = bwd->backward_path_cost;
+
+            if (std::isfinite(rr_node_route_inf_[bnode].path_cost)) {
+                VTR_LOGV_DEBUG(router_debug_, "  Backward wave met forward wave at node %d\n", bnode);
+                bidir_heap_.free(bwd);
+                cheapest = bidir_splice_path(bnode, sink_node);
+                break;
+            }
+
+            bidir_expand_backward(bwd, cost_params, bounding_box);
+        }
+        bidir_heap_.free(bwd);
+    }
+
+    bidir_reset();
+
+    if (cheapest == nullptr) {
+        VTR_LOGV_DEBUG(router_debug_, "  Empty heap (no path found)\n");
+        return nullptr;
+    }
+
+    return cheapest;
+}
+
+template<typename Heap>
+void ConnectionRouter<Heap>::bidir_expand_backward(const t_heap* bwd,
+                                                   const t_conn_cost_params& cost_params,
+                                                   const t_bb& bounding_box) {
+    const auto& reverse_edges = g_vpr_ctx.routing().rr_reverse_edges;
+    RRNodeId to_node = bwd->index;
+
+    // Paths start from the route tree, which the forward wave expands first:
+    // walking back past pins into other blocks is of no use
+    t_rr_type to_type = rr_graph_->node_type(to_node);
+    if (to_type == SOURCE || to_type == OPIN)
+        return;
+
+    for (RREdgeId from_edge : reverse_edges.in_edges(to_node)) {
+        RRNodeId from_node = rr_graph_->edge_src_node(from_edge);
+        if (!inside_bb(from_node, bounding_box))
+            continue;
+
+        // Cost of from_node -> to_node, as seen by the forward wave with a buffered driver
+        float cost = bwd->cost;
+        float R_upstream = 0.;
+        if (is_flat_) {
+            evaluate_timing_driven_backward_costs<true>(cost_params, from_node, to_node, from_edge, cost, R_upstream);
+        } else {
+            evaluate_timing_driven_backward_costs<false>(cost_params, from_node, to_node, from_edge, cost, R_upstream);
+        }
+        if (!(cost < bidir_route_inf_[from_node].path_cost))
+            continue;
+
+        t_heap* next_ptr = bidir_heap_.alloc();
+        next_ptr->cost = cost;
+        next_ptr->backward_path_cost = cost;
+        next_ptr->index = from_node;
+        next_ptr->set_prev_edge(from_edge);
+        bidir_heap_.add_to_heap(next_ptr);
+        update_router_stats(router_stats_,
+                            true,
+                            from_node,
+                            rr_graph_);
+    }
+}
+
+template<typename Heap>
+t_heap* ConnectionRouter<Heap>::bidir_splice_path(RRNodeId meet_node, RRNodeId sink_node) {
+    // The forward wave's path ends at meet_node with this cost
+    float meet_cost = rr_node_route_inf_[meet_node].backward_path_cost;
+    float meet_cost_to_sink = bidir_route_inf_[meet_node].path_cost;
+
+    // Point each node of the backward wave's path back at its predecessor, so that the full
+    // path can be traced back from the sink
+    RRNodeId inode = meet_node;
+    while (inode != sink_node) {
+        RREdgeId edge = bidir_route_inf_[inode].prev_edge;
+        RRNodeId next = rr_nodes_.edge_sink_node(edge);
+
+        add_to_mod_list(next);
+        t_rr_node_route_inf& next_inf = rr_node_route_inf_[next];
+        next_inf.prev_edge = edge;
+        next_inf.backward_path_cost = meet_cost + (meet_cost_to_sink - bidir_route_inf_[next].path_cost);
+        next_inf.path_cost = next_inf.backward_path_cost;
+
+        inode = next;
+    }
+
+    t_heap* out = heap_.alloc();
+    out->index = sink_node;
+    out->set_prev_edge(rr_node_route_inf_[sink_node].prev_edge);
+    out->cost = rr_node_route_inf_[sink_node].path_cost;
+    out->backward_path_cost = rr_node_route_inf_[sink_node].backward_path_cost;
+    return out;
+}
+
+template<typename Heap>
+void ConnectionRouter<Heap>::bidir_reset() {
+    for (RRNodeId inode : bidir_modified_) {
+        bidir_route_inf_[inode].prev_edge = RREdgeId::INVALID();
+        bidir_route_inf_[inode].path_cost = std::numeric_limits<float>::infinity();
+        bidir_route_inf_[inode].backward_path_cost = std::numeric_limits<float>::infinity();
+    }
+    bidir_modified_.clear();
+    bidir_heap_.empty_heap();
+}
+
 // Find shortest paths from specified route tree to all nodes in the RR graph
 template<typename Heap>
 vtr::vector<RRNodeId, t_heap> ConnectionRouter<Heap>::timing_driven_find_all_shortest_paths_from_route_tree(
@@ -433,6 +772,27 @@ void ConnectionRouter<Heap>::timing_driven_expand_neighbours(t_heap* current,
         VTR_PREFETCH(&rr_switch_inf_[switch_idx], 0, 0);
     }
 
+    if (!rcv_path_manager.is_enabled() && !router_debug_) {
+        // Pick the variant once per expanded node, so that the per-edge loop
+        // is specialized for the kind of routing
+        if (is_flat_) {
+            timing_driven_expand_neighbours_batched<true>(current,
+                                                          from_node,
+                                                          cost_params,
+                                                          bounding_box,
+                                                          target_node,
+                                                          target_bb);
+        } else {
+            timing_driven_expand_neighbours_batched<false>(current,
+                                                           from_node,
+                                                           cost_params,
+                                                           bounding_box,
+                                                           target_node,
+                                                           target_bb);
+        }
+        return;
+    }
+
     for (RREdgeId from_edge : edges) {
         RRNodeId to_node = rr_nodes_.edge_sink_node(from_edge);
         timing_driven_expand_neighbour(current,
@@ -481,34 +841,17 @@ void ConnectionRouter<Heap>::timing_driven_expand_neighbour(t_heap* current,
      * the issue of how to cost them properly so they don't get expanded before *
      * more promising routes, but makes route-through (via CLBs) impossible.   *
      * Change this if you want to investigate route-throughs.                   */
-    if (target_node != RRNodeId::INVALID()) {
-        t_rr_type to_type = rr_graph_->node_type(to_node);
-        if (to_type == IPIN) {
-            // Check if this IPIN leads to the target block
-            // IPIN's of the target block should be contained within it's bounding box
-            int to_xlow = rr_graph_->node_xlow(to_node);
-            int to_ylow = rr_graph_->node_ylow(to_node);
-            int to_layer = rr_graph_->node_layer(to_node);
-            int to_xhigh = rr_graph_->node_xhigh(to_node);
-            int to_yhigh = rr_graph_->node_yhigh(to_node);
-            if (to_xlow < target_bb.xmin
-                || to_ylow < target_bb.ymin
-                || to_xhigh > target_bb.xmax
-                || to_yhigh > target_bb.ymax
-                || to_layer < target_bb.layer_min
-                || to_layer > target_bb.layer_max) {
-                VTR_LOGV_DEBUG(router_debug_,
-                               "      Pruned expansion of node %d edge %zu -> %d"
-                               " (to node is IPIN at %d,%d,%d x %d,%d,%d which does not"
-                               " lead to target block %d,%d,%d x %d,%d,%d)\n",
-                               from_node, size_t(from_edge), size_t(to_node),
-                               to_xlow, to_ylow, to_layer,
-                               to_xhigh, to_yhigh, to_layer,
-                               target_bb.xmin, target_bb.ymin, target_bb.layer_min,
-                               target_bb.xmax, target_bb.ymax, target_bb.layer_max);
-                return;
-            }
-        }
+    if (is_ipin_to_other_block(to_node, target_node, target_bb)) {
+        VTR_LOGV_DEBUG(router_debug_,
+                       "      Pruned expansion of node %d edge %zu -> %d"
+                       " (to node is IPIN at %d,%d,%d x %d,%d,%d which does not"
+                       " lead to target block %d,%d,%d x %d,%d,%d)\n",
+                       from_node, size_t(from_edge), size_t(to_node),
+                       rr_graph_->node_xlow(to_node), rr_graph_->node_ylow(to_node), rr_graph_->node_layer(to_node),
+                       rr_graph_->node_xhigh(to_node), rr_graph_->node_yhigh(to_node), rr_graph_->node_layer(to_node),
+                       target_bb.xmin, target_bb.ymin, target_bb.layer_min,
+                       target_bb.xmax, target_bb.ymax, target_bb.layer_max);
+        return;
     }
 
     VTR_LOGV_DEBUG(router_debug_, "      Expanding node %d edge %zu -> %d\n",
@@ -532,6 +875,111 @@ void ConnectionRouter<Heap>::timing_driven_expand_neighbour(t_heap* current,
     }
 }
 
+template<typename Heap>
+bool ConnectionRouter<Heap>::is_ipin_to_other_block(RRNodeId to_node,
+                                                    RRNodeId target_node,
+                                                    const t_bb& target_bb) const {
+    if (target_node == RRNodeId::INVALID() || rr_graph_->node_type(to_node) != IPIN)
+        return false;
+
+    // When routing a batch of sinks, keep the IPINs of all their blocks
+    if (!batch_target_bbs_.empty()) {
+        for (const t_bb& bb : batch_target_bbs_) {
+            if (!ipin_outside_bb(to_node, bb))
+                return false;
+        }
+        return true;
+    }
+
+    // Check if this IPIN leads to the target block
+    // IPIN's of the target block should be contained within it's bounding box
+    return ipin_outside_bb(to_node, target_bb);
+}
+
+template<typename Heap>
+bool ConnectionRouter<Heap>::ipin_outside_bb(RRNodeId to_node, const t_bb& target_bb) const {
+    return rr_graph_->node_xlow(to_node) < target_bb.xmin
+           || rr_graph_->node_ylow(to_node) < target_bb.ymin
+           || rr_graph_->node_xhigh(to_node) > target_bb.xmax
+           || rr_graph_->node_yhigh(to_node) > target_bb.ymax
+           || rr_graph_->node_layer(to_node) < target_bb.layer_min
+           || rr_graph_->node_layer(to_node) > target_bb.layer_max;
+}
+
+template<typename Heap>
+template<bool FlatRouting>
+void ConnectionRouter<Heap>::timing_driven_expand_neighbours_batched(t_heap* current,
+                                                                     RRNodeId from_node,
+                                                                     const t_conn_cost_params& cost_params,
+                                                                     const t_bb& bounding_box,
+                                                                     RRNodeId target_node,
+                                                                     const t_bb& target_bb) {
+    // Switch block nodes have fanouts of a few dozens: process them in fixed-size
+    // batches so that the per-neighbour state stays in registers/L1
+    constexpr size_t BATCH_SIZE = 32;
+    VTR_ASSERT_SAFE(FlatRouting == is_flat_);
+
+    std::array<RRNodeId, BATCH_SIZE> to_nodes;
+    std::array<RREdgeId, BATCH_SIZE> from_edges;
+    std::array<float, BATCH_SIZE> backward_costs;
+    std::array<float, BATCH_SIZE> R_upstreams;
+
+    auto edges = rr_nodes_.edge_range(from_node);
+    auto edge_it = edges.begin();
+    while (edge_it != edges.end()) {
+        // 1. Gather the neighbours which pass the bounding box and IPIN pruning
+        size_t num_candidates = 0;
+        for (; edge_it != edges.end() && num_candidates < BATCH_SIZE; ++edge_it) {
+            RREdgeId from_edge = *edge_it;
+            RRNodeId to_node = rr_nodes_.edge_sink_node(from_edge);
+            if (!inside_bb(to_node, bounding_box) || is_ipin_to_other_block(to_node, target_node, target_bb))
+                continue;
+            to_nodes[num_candidates] = to_node;
+            from_edges[num_candidates] = from_edge;
+            num_candidates++;
+        }
+
+        // 2. Compute the known costs and keep only the neighbours which improve on the
+        // best known backward cost: a new path must improve both the backward and the total
+        // cost to be pushed, so this avoids the lookahead query for the rest of them
+        size_t num_improving = 0;
+        for (size_t i = 0; i < num_candidates; i++) {
+            float backward_cost = current->backward_path_cost;
+            float R_upstream = current->R_upstream;
+            evaluate_timing_driven_backward_costs<FlatRouting>(cost_params, from_node, to_nodes[i], from_edges[i], backward_cost, R_upstream);
+            if (backward_cost < rr_node_route_inf_[to_nodes[i]].backward_path_cost) {
+                to_nodes[num_improving] = to_nodes[i];
+                from_edges[num_improving] = from_edges[i];
+                backward_costs[num_improving] = backward_cost;
+                R_upstreams[num_improving] = R_upstream;
+                num_improving++;
+            }
+        }
+
+        // 3. Add the lookahead to get the total costs and push the cheaper paths
+        for (size_t i = 0; i < num_improving; i++) {
+            RRNodeId to_node = to_nodes[i];
+            float expected_cost = router_lookahead_.get_expected_cost(to_node, target_node, cost_params, R_upstreams[i]);
+            float total_cost = backward_costs[i] + cost_params.astar_fac * expected_cost;
+            if (!(total_cost < rr_node_route_inf_[to_node].path_cost))
+                continue;
+
+            t_heap* next_ptr = heap_.alloc();
+            next_ptr->cost = total_cost;
+            next_ptr->R_upstream = R_upstreams[i];
+            next_ptr->backward_path_cost = backward_costs[i];
+            next_ptr->index = to_node;
+            next_ptr->set_prev_edge(from_edges[i]);
+
+            heap_.add_to_heap(next_ptr);
+            update_router_stats(router_stats_,
+                                true,
+                                to_node,
+                                rr_graph_);
+        }
+    }
+}
+
 // Add to_node to the heap, and also add any nodes which are connected by non-configurable edges
 template<typename Heap>
 void ConnectionRouter<Heap>::timing_driven_add_to_heap(const t_conn_cost_params& cost_params,
@@ -598,10 +1046,7 @@ void ConnectionRouter<Heap>::timing_driven_add_to_heap(const t_conn_cost_params&
         next_ptr->set_prev_edge(from_edge);
 
         if (rcv_path_manager.is_enabled() && current->path_data) {
-            next_ptr->path_data->path_rr = current->path_data->path_rr;
-            next_ptr->path_data->edge = current->path_data->edge;
-            next_ptr->path_data->path_rr.emplace_back(from_node);
-            next_ptr->path_data->edge.emplace_back(from_edge);
+            rcv_path_manager.extend_path(next_ptr->path_data, current->path_data, from_node, from_edge);
         }
 
         heap_.add_to_heap(next_ptr);
@@ -692,23 +1137,15 @@ void ConnectionRouter<Heap>::set_rcv_enabled(bool enable) {
     rcv_path_manager.set_enabled(enable);
 }
 
-//Calculates the cost of reaching to_node
+//Calculates the known part of the cost of reaching to_node via from_edge
 template<typename Heap>
-void ConnectionRouter<Heap>::evaluate_timing_driven_node_costs(t_heap* to,
-                                                               const t_conn_cost_params& cost_params,
-                                                               RRNodeId from_node,
-                                                               RRNodeId to_node,
-                                                               RREdgeId from_edge,
-                                                               RRNodeId target_node) {
-    /* new_costs.backward_cost: is the "known" part of the cost to this node -- the
-     * congestion cost of all the routing resources back to the existing route
-     * plus the known delay of the total path back to the source.
-     *
-     * new_costs.total_cost: is this "known" backward cost + an expected cost to get to the target.
-     *
-     * new_costs.R_upstream: is the upstream resistance at the end of this node
-     */
-
+template<bool FlatRouting>
+float ConnectionRouter<Heap>::evaluate_timing_driven_backward_costs(const t_conn_cost_params& cost_params,
+                                                                    RRNodeId from_node,
+                                                                    RRNodeId to_node,
+                                                                    RREdgeId from_edge,
+                                                                    float& backward_path_cost,
+                                                                    float& R_upstream) {
     //Info for the switch connecting from_node to_node
     int iswitch = rr_nodes_.edge_switch(from_edge);
     bool switch_buffered = rr_switch_inf_[iswitch].buffered();
@@ -727,16 +1164,16 @@ void ConnectionRouter<Heap>::evaluate_timing_driven_node_costs(t_heap* to,
 
     //Update R_upstream
     if (switch_buffered) {
-        to->R_upstream = 0.; //No upstream resistance
+        R_upstream = 0.; //No upstream resistance
     } else {
         //R_Upstream already initialized
     }
 
-    to->R_upstream += switch_R; //Switch resistance
-    to->R_upstream += node_R;   //Node resistance
+    R_upstream += switch_R; //Switch resistance
+    R_upstream += node_R;   //Node resistance
 
     //Calculate delay
-    float Rdel = to->R_upstream - 0.5 * node_R; //Only consider half node's resistance for delay
+    float Rdel = R_upstream - 0.5 * node_R; //Only consider half node's resistance for delay
     float Tdel = switch_Tdel + Rdel * node_C;
 
     //Depending on the switch used, the Tdel of the upstream node (from_node) may change due to
@@ -750,7 +1187,7 @@ void ConnectionRouter<Heap>::evaluate_timing_driven_node_costs(t_heap* to,
     //
     //First, we will calculate Rdel_adjust (just like in the computation for Rdel, we consider only
     //half of from_node's resistance).
-    float Rdel_adjust = to->R_upstream - 0.5 * from_node_R;
+    float Rdel_adjust = R_upstream - 0.5 * from_node_R;
 
     //Second, we adjust the Tdel to account for the delay caused by the internal capacitance.
     Tdel += Rdel_adjust * switch_Cinternal;
@@ -771,7 +1208,7 @@ void ConnectionRouter<Heap>::evaluate_timing_driven_node_costs(t_heap* to,
         //cost.
         cong_cost = 0.;
     }
-    if (conn_params_->has_choking_spot_ && is_flat_ && rr_graph_->node_type(to_node) == IPIN) {
+    if (FlatRouting && conn_params_->has_choking_spot_ && rr_graph_->node_type(to_node) == IPIN) {
         auto find_res = conn_params_->connection_choking_spots_.find(to_node);
         if (find_res != conn_params_->connection_choking_spots_.end()) {
             cong_cost = cong_cost / pow(2, (float)find_res->second);
@@ -779,17 +1216,49 @@ void ConnectionRouter<Heap>::evaluate_timing_driven_node_costs(t_heap* to,
     }
 
     //Update the backward cost (upstream already included)
-    to->backward_path_cost += (1. - cost_params.criticality) * cong_cost; //Congestion cost
-    to->backward_path_cost += cost_params.criticality * Tdel;             //Delay cost
+    backward_path_cost += (1. - cost_params.criticality) * cong_cost; //Congestion cost
+    backward_path_cost += cost_params.criticality * Tdel;             //Delay cost
 
     if (cost_params.bend_cost != 0.) {
         t_rr_type from_type = rr_graph_->node_type(from_node);
         t_rr_type to_type = rr_graph_->node_type(to_node);
         if ((from_type == CHANX && to_type == CHANY) || (from_type == CHANY && to_type == CHANX)) {
-            to->backward_path_cost += cost_params.bend_cost; //Bend cost
+            backward_path_cost += cost_params.bend_cost; //Bend cost
         }
     }
 
+    return Tdel;
+}
+
+//Calculates the cost of reaching to_node
+template<typename Heap>
+void ConnectionRouter<Heap>::evaluate_timing_driven_node_costs(t_heap* to,
+                                                               const t_conn_cost_params& cost_params,
+                                                               RRNodeId from_node,
+                                                               RRNodeId to_node,
+                                                               RREdgeId from_edge,
+                                                               RRNodeId target_node) {
+    /* new_costs.backward_cost: is the "known" part of the cost to this node -- the
+     * congestion cost of all the routing resources back to the existing route
+     * plus the known delay of the total path back to the source.
+     *
+     * new_costs.total_cost: is this "known" backward cost + an expected cost to get to the target.
+     *
+     * new_costs.R_upstream: is the upstream resistance at the end of this node
+     */
+    float Tdel = is_flat_ ? evaluate_timing_driven_backward_costs<true>(cost_params,
+                                                                        from_node,
+                                                                        to_node,
+                                                                        from_edge,
+                                                                        to->backward_path_cost,
+                                                                        to->R_upstream)
+                          : evaluate_timing_driven_backward_costs<false>(cost_params,
+                                                                         from_node,
+                                                                         to_node,
+                                                                         from_edge,
+                                                                         to->backward_path_cost,
+                                                                         to->R_upstream);
+
     float total_cost = 0.;
 
     if (rcv_path_manager.is_enabled() && to->path_data != nullptr) {
@@ -1151,7 +1620,7 @@ std::unique_ptr<ConnectionRouterInterface> make_connection_router(e_heap_type he
                                                                   const RRGraphView* rr_graph,
                                                                   const std::vector<t_rr_rc_data>& rr_rc_data,
                                                                   const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switch_inf,
-                                                                  vtr::vector<RRNodeId, t_rr_node_route_inf>& rr_node_route_inf,
+                                                                  t_rr_node_route_inf_vector& rr_node_route_inf,
                                                                   bool is_flat) {
     switch (heap_type) {
         case e_heap_type::BINARY_HEAP:
@@ -1174,6 +1643,26 @@ std::unique_ptr<ConnectionRouterInterface> make_connection_router(e_heap_type he
                 rr_switch_inf,
                 rr_node_route_inf,
                 is_flat);
+        case e_heap_type::FOUR_ARY_HEAP:
+            return std::make_unique<ConnectionRouter<FourAryHeap>>(
+                grid,
+                router_lookahead,
+                rr_nodes,
+                rr_graph,
+                rr_rc_data,
+                rr_switch_inf,
+                rr_node_route_inf,
+                is_flat);
+        case e_heap_type::RADIX_HEAP:
+            return std::make_unique<ConnectionRouter<RadixHeap>>(
+                grid,
+                router_lookahead,
+                rr_nodes,
+                rr_graph,
+                rr_rc_data,
+                rr_switch_inf,
+                rr_node_route_inf,
+                is_flat);
         default:
             VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Unknown heap_type %d",
                             heap_type);
@@ -31,7 +31,7 @@ class ConnectionRouter : public ConnectionRouterInterface {
         const RRGraphView* rr_graph,
         const std::vector<t_rr_rc_data>& rr_rc_data,
         const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switch_inf,
-        vtr::vector<RRNodeId, t_rr_node_route_inf>& rr_node_route_inf,
+        t_rr_node_route_inf_vector& rr_node_route_inf,
         bool is_flat)
         : grid_(grid)
         , router_lookahead_(router_lookahead)
@@ -47,6 +47,8 @@ class ConnectionRouter : public ConnectionRouterInterface {
         , router_debug_(false) {
         heap_.init_heap(grid);
         heap_.set_prune_limit(rr_nodes_.size(), kHeapPruneFactor * rr_nodes_.size());
+        bidir_heap_.init_heap(grid);
+        bidir_heap_.set_prune_limit(rr_nodes_.size(), kHeapPruneFactor * rr_nodes_.size());
         only_opin_inter_layer = (grid.get_num_layers() > 1) && inter_layer_connections_limited_to_opin(*rr_graph);
     }
 
@@ -58,7 +60,16 @@ class ConnectionRouter : public ConnectionRouterInterface {
 
     // Reset modified data in rr_node_route_inf based on modified_rr_node_inf.
     void reset_path_costs() final {
-        ::reset_path_costs(modified_rr_node_inf_);
+        for (RRNodeId node : modified_rr_node_inf_) {
+            rr_node_route_inf_[node].path_cost = std::numeric_limits<float>::infinity();
+            rr_node_route_inf_[node].backward_path_cost = std::numeric_limits<float>::infinity();
+            rr_node_route_inf_[node].prev_edge = RREdgeId::INVALID();
+        }
+    }
+
+    // Search state (path costs and traceback) written by this router.
+    const t_rr_node_route_inf_vector& get_rr_node_route_inf() const final {
+        return rr_node_route_inf_;
     }
 
     /** Finds a path from the route tree rooted at rt_root to sink_node.
@@ -96,6 +107,25 @@ class ConnectionRouter : public ConnectionRouterInterface {
         RouterStats& router_stats,
         const ConnectionParameters& conn_params) final;
 
+    /** Finds paths from the route tree rooted at rt_root to each of sink_nodes
+     * for a high fanout net, growing a single wavefront.
+     *
+     * Only the parts of the route tree which are spatially close to the sinks
+     * are added to the heap. The search for each sink continues from the region
+     * explored for the previous ones, with the branch returned by on_sink_routed
+     * as an additional source.
+     *
+     * Returns the number of sinks routed. */
+    size_t timing_driven_route_connections_from_route_tree_high_fanout_batch(
+        const RouteTreeNode& rt_root,
+        const std::vector<RRNodeId>& sink_nodes,
+        const t_conn_cost_params& cost_params,
+        const t_bb& net_bounding_box,
+        const SpatialRouteTreeLookup& spatial_rt_lookup,
+        RouterStats& router_stats,
+        const std::vector<ConnectionParameters>& conn_params,
+        const HighFanoutSinkRoutedFn& on_sink_routed) final;
+
     // Finds a path from the route tree rooted at rt_root to all sinks
     // available.
     //
@@ -165,6 +195,13 @@ class ConnectionRouter : public ConnectionRouterInterface {
         const t_conn_cost_params& cost_params,
         const t_bb& bounding_box);
 
+    /** Record in the RouterProfile how far off the lookahead's estimate from the net source to
+     * sink_node was from the cost of the path found (path_cost) */
+    void record_lookahead_error(const RouteTreeNode& rt_root,
+                                RRNodeId sink_node,
+                                const t_conn_cost_params& cost_params,
+                                float path_cost);
+
     // Finds a path to sink_node, starting from the elements currently in the
     // heap.
     //
@@ -179,6 +216,46 @@ class ConnectionRouter : public ConnectionRouterInterface {
         const t_conn_cost_params& cost_params,
         const t_bb& bounding_box);
 
+    // Recompute the cost of every element on the heap for target_node
+    void rekey_heap(RRNodeId target_node, const t_conn_cost_params& cost_params);
+
+    // Should this connection be routed with the bidirectional search?
+    bool should_use_bidir_search(RRNodeId source_node,
+                                 RRNodeId sink_node,
+                                 const t_conn_cost_params& cost_params);
+
+    // Bidirectional version of timing_driven_route_connection_from_heap.
+    //
+    // Alternates between popping the forward (A*) heap and a backward
+    // (Dijkstra) heap seeded with the sink, which expands over the reverse
+    // edges of the RR graph. Stops when either wave reaches a node already
+    // expanded by the other one, and splices the two half-paths together.
+    //
+    // The backward wave can't know the upstream resistance of a node, so
+    // it estimates the delay of each edge as if it was driven by a buffer.
+    // The path found is therefore not always the one the forward search
+    // would find, which is acceptable for long non-critical connections.
+    //
+    // Returns the heap element of the sink, or nullptr if no path is found
+    t_heap* timing_driven_route_connection_from_heap_bidir(
+        RRNodeId sink_node,
+        const t_conn_cost_params& cost_params,
+        const t_bb& bounding_box);
+
+    // Expand the backward wave from the node in bwd: push the nodes
+    // driving it with their cost to the sink
+    void bidir_expand_backward(const t_heap* bwd,
+                               const t_conn_cost_params& cost_params,
+                               const t_bb& bounding_box);
+
+    // Write the backward wave's path from meet_node to sink_node into
+    // rr_node_route_inf_. Returns a heap element for sink_node which can be
+    // traced back to the route tree
+    t_heap* bidir_splice_path(RRNodeId meet_node, RRNodeId sink_node);
+
+    // Reset the backward wave's search state
+    void bidir_reset();
+
     // Expand this current node if it is a cheaper path.
     void timing_driven_expand_cheapest(
         t_heap* cheapest,
@@ -208,6 +285,34 @@ class ConnectionRouter : public ConnectionRouterInterface {
         RRNodeId target_node,
         const t_bb& target_bb);
 
+    // Expand all neighbours of the current node in batches: prune them by
+    // bounding box, compute their backward costs, drop those which can't
+    // improve on the best known backward cost and only then query the
+    // lookahead for the survivors.
+    //
+    // Produces the same heap pushes as timing_driven_expand_neighbour,
+    // but it doesn't support RCV or router debug logging.
+    //
+    // FlatRouting must match is_flat_: it is a template parameter so that the
+    // common (non-flat) variant has no flat routing checks in its per-edge loop.
+    template<bool FlatRouting>
+    void timing_driven_expand_neighbours_batched(
+        t_heap* current,
+        RRNodeId from_node,
+        const t_conn_cost_params& cost_params,
+        const t_bb& bounding_box,
+        RRNodeId target_node,
+        const t_bb& target_bb);
+
+    // Returns true if to_node is an IPIN which doesn't lead to the target
+    // block (see timing_driven_expand_neighbour)
+    bool is_ipin_to_other_block(RRNodeId to_node,
+                                RRNodeId target_node,
+                                const t_bb& target_bb) const;
+
+    // Returns true if the IPIN to_node is not contained in target_bb
+    bool ipin_outside_bb(RRNodeId to_node, const t_bb& target_bb) const;
+
     // Add to_node to the heap, and also add any nodes which are connected by
     // non-configurable edges
     void timing_driven_add_to_heap(
@@ -218,6 +323,20 @@ class ConnectionRouter : public ConnectionRouterInterface {
         RREdgeId from_edge,
         RRNodeId target_node);
 
+    // Calculates the known part of the cost of reaching to_node from
+    // from_node via from_edge: adds it to backward_path_cost and updates
+    // R_upstream. Returns the delay of the edge.
+    //
+    // FlatRouting must match is_flat_ (see timing_driven_expand_neighbours_batched).
+    template<bool FlatRouting>
+    float evaluate_timing_driven_backward_costs(
+        const t_conn_cost_params& cost_params,
+        RRNodeId from_node,
+        RRNodeId to_node,
+        RREdgeId from_edge,
+        float& backward_path_cost,
+        float& R_upstream);
+
     // Calculates the cost of reaching to_node
     void evaluate_timing_driven_node_costs(
         t_heap* to,
@@ -274,7 +393,7 @@ class ConnectionRouter : public ConnectionRouterInterface {
     vtr::array_view<const t_rr_switch_inf> rr_switch_inf_;
     const vtr::vector<ParentNetId, std::vector<std::vector<int>>>& net_terminal_groups;
     const vtr::vector<ParentNetId, std::vector<int>>& net_terminal_group_num;
-    vtr::vector<RRNodeId, t_rr_node_route_inf>& rr_node_route_inf_;
+    t_rr_node_route_inf_vector& rr_node_route_inf_;
     bool is_flat_;
     std::vector<RRNodeId> modified_rr_node_inf_;
     RouterStats* router_stats_;
@@ -282,6 +401,16 @@ class ConnectionRouter : public ConnectionRouterInterface {
     HeapImplementation heap_;
     bool router_debug_;
 
+    // Backward wave of the bidirectional search: prev_edge is the edge
+    // towards the sink, path_cost is the cost to reach the sink
+    HeapImplementation bidir_heap_;
+    t_rr_node_route_inf_vector bidir_route_inf_;
+    std::vector<RRNodeId> bidir_modified_;
+
+    // Extents of the sinks' blocks while routing a high fanout batch (see
+    // is_ipin_to_other_block)
+    std::vector<t_bb> batch_target_bbs_;
+
     bool only_opin_inter_layer;
 
     // The path manager for RCV, keeps track of the route tree as a set, also manages the allocation of the heap types
@@ -301,7 +430,7 @@ std::unique_ptr<ConnectionRouterInterface> make_connection_router(
     const RRGraphView* rr_graph,
     const std::vector<t_rr_rc_data>& rr_rc_data,
     const vtr::vector<RRSwitchId, t_rr_switch_inf>& rr_switch_inf,
-    vtr::vector<RRNodeId, t_rr_node_route_inf>& rr_node_route_inf,
+    t_rr_node_route_inf_vector& rr_node_route_inf,
     bool is_flat);
 
 #endif /* _CONNECTION_ROUTER_H */
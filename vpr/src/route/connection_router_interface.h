@@ -1,6 +1,7 @@
 #ifndef _CONNECTION_ROUTER_INTERFACE_H
 #define _CONNECTION_ROUTER_INTERFACE_H
 
+#include <functional>
 #include <utility>
 
 #include "heap_type.h"
@@ -9,6 +10,7 @@
 #include "vpr_types.h"
 #include "router_stats.h"
 #include "spatial_route_tree_lookup.h"
+#include "vtr_optional.h"
 
 //Delay budget information for a specific connection
 struct t_conn_delay_budget {
@@ -27,12 +29,23 @@ struct t_conn_cost_params {
     float pres_fac = 1.;
     const t_conn_delay_budget* delay_budget = nullptr;
 
+    //Connections spanning at least bidir_search_min_dist (Manhattan distance)
+    //with a criticality of at most bidir_search_max_criticality are routed
+    //with a bidirectional search. -1 disables
+    int bidir_search_min_dist = -1;
+    float bidir_search_max_criticality = 0.;
+
     //TODO: Eventually once delay budgets are working, t_conn_delay_budget
     //should be factoured out, and the delay budget parameters integrated
     //into this struct instead. For now left as a pointer to control whether
     //budgets are enabled.
 };
 
+/** Called by the batched high fanout search for each sink it finds a path to,
+ * with the index of the sink in the batch and the heap element of its path.
+ * Returns the route tree branch added for the path (if any). */
+using HighFanoutSinkRoutedFn = std::function<vtr::optional<const RouteTreeNode&>(size_t, t_heap&)>;
+
 class ConnectionRouterInterface {
   public:
     virtual ~ConnectionRouterInterface() {}
@@ -44,6 +57,11 @@ class ConnectionRouterInterface {
     // Reset modified data in rr_node_route_inf based on modified_rr_node_inf.
     virtual void reset_path_costs() = 0;
 
+    // Search state (path costs and traceback) written by this router.
+    // Paths found by the router must be traced back through this lookup,
+    // e.g. by RouteTree::update_from_heap.
+    virtual const t_rr_node_route_inf_vector& get_rr_node_route_inf() const = 0;
+
     /** Finds a path from the route tree rooted at rt_root to sink_node.
      * This is used when you want to allow previous routing of the same net to
      * serve as valid start locations for the current connection.
@@ -81,6 +99,27 @@ class ConnectionRouterInterface {
         const ConnectionParameters& conn_params)
         = 0;
 
+    /** Finds paths from the route tree rooted at rt_root to each of sink_nodes
+     * for a high fanout net, growing a single wavefront.
+     *
+     * sink_nodes should be spatially close and not timing critical. The search
+     * for each sink continues from the region explored for the previous ones.
+     * Once the path to sink_nodes[i] is found, on_sink_routed(i, cheapest) is
+     * called: it should add the path to the route tree and return the new branch.
+     *
+     * Returns the number of sinks routed. If it is less than sink_nodes.size(),
+     * the remaining sinks should be routed one at a time. */
+    virtual size_t timing_driven_route_connections_from_route_tree_high_fanout_batch(
+        const RouteTreeNode& rt_root,
+        const std::vector<RRNodeId>& sink_nodes,
+        const t_conn_cost_params& cost_params,
+        const t_bb& bounding_box,
+        const SpatialRouteTreeLookup& spatial_rt_lookup,
+        RouterStats& router_stats,
+        const std::vector<ConnectionParameters>& conn_params,
+        const HighFanoutSinkRoutedFn& on_sink_routed)
+        = 0;
+
     // Finds a path from the route tree rooted at rt_root to all sinks
     // available.
     //
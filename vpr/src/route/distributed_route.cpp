@@ -0,0 +1,294 @@
+#ifdef VPR_USE_MPI
+
+#    include "distributed_route.h"
+
+#    include <climits>
+#    include <cstring>
+#    include <type_traits>
+
+#    include <mpi.h>
+
+#    include "globals.h"
+#    include "route_common.h"
+#    include "vpr_error.h"
+#    include "vtr_assert.h"
+#    include "vtr_log.h"
+
+/** Appends plain values and vectors of them to a byte buffer */
+class UpdateWriter {
+  public:
+    explicit UpdateWriter(std::vector<char>& buffer)
+        : _buffer(buffer) {}
+
+    template<typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain values can be sent");
+        size_t offset = _buffer.size();
+        _buffer.resize(offset + sizeof(T));
+        std::memcpy(_buffer.data() + offset, &value, sizeof(T));
+    }
+
+    template<typename T>
+    void write_vector(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable<T>::value, "only plain values can be sent");
+        write(values.size());
+        size_t offset = _buffer.size();
+        _buffer.resize(offset + values.size() * sizeof(T));
+        if (!values.empty())
+            std::memcpy(_buffer.data() + offset, values.data(), values.size() * sizeof(T));
+    }
+
+  private:
+    std::vector<char>& _buffer;
+};
+
+/** Reads back what UpdateWriter wrote */
+class UpdateReader {
+  public:
+    UpdateReader(const char* begin, const char* end)
+        : _p(begin)
+        , _end(end) {}
+
+    bool at_end() const { return _p == _end; }
+
+    template<typename T>
+    T read() {
+        T value;
+        VTR_ASSERT(_p + sizeof(T) <= _end);
+        std::memcpy(&value, _p, sizeof(T));
+        _p += sizeof(T);
+        return value;
+    }
+
+    template<typename T>
+    std::vector<T> read_vector() {
+        size_t size = read<size_t>();
+        VTR_ASSERT(_p + size * sizeof(T) <= _end);
+        std::vector<T> values(size);
+        if (size > 0)
+            std::memcpy(values.data(), _p, size * sizeof(T));
+        _p += size * sizeof(T);
+        return values;
+    }
+
+  private:
+    const char* _p;
+    const char* _end;
+};
+
+int distributed_route_rank() {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    return rank;
+}
+
+int distributed_route_num_ranks() {
+    int num_ranks;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+    return num_ranks;
+}
+
+void check_distributed_route_consistency(const Netlist<>& net_list) {
+    int initialized;
+    MPI_Initialized(&initialized);
+    if (!initialized) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "The distributed router needs MPI: run VPR with mpirun");
+    }
+
+    /* FNV-1a hash of what the processes should agree on: the routing is only exchanged as changes */
+    const auto& route_ctx = g_vpr_ctx.routing();
+    uint64_t hash = 0xcbf29ce484222325ull;
+    auto add = [&](uint64_t value) {
+        hash = (hash ^ value) * 0x100000001b3ull;
+    };
+    add(g_vpr_ctx.device().rr_graph.num_nodes());
+    add(net_list.nets().size());
+    for (ParentNetId net_id : net_list.nets()) {
+        for (RRNodeId terminal : route_ctx.net_rr_terminals[net_id])
+            add(size_t(terminal));
+    }
+
+    uint64_t min_hash, max_hash;
+    MPI_Allreduce(&hash, &min_hash, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+    MPI_Allreduce(&hash, &max_hash, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
+    if (min_hash != max_hash) {
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE,
+                        "The processes of the distributed router have different netlists or RR graphs:"
+                        " they must all run the same flow with the same options and inputs");
+    }
+}
+
+void abort_distributed_route() {
+    VTR_LOG_ERROR("Distributed routing failed in process %d, aborting all the processes\n", distributed_route_rank());
+    MPI_Abort(MPI_COMM_WORLD, 1);
+    std::abort(); /* MPI_Abort shouldn't return */
+}
+
+t_net_routing_update get_net_routing_update(ParentNetId net_id,
+                                            bool rerouted,
+                                            size_t heap_pushes,
+                                            const CBRR& connections_inf,
+                                            const NetPinsMatrix<float>& net_delay) {
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    t_net_routing_update update;
+    update.net_id = net_id;
+    update.rerouted = rerouted;
+    update.heap_pushes = heap_pushes;
+    update.route_bb = route_ctx.route_bb[net_id];
+    if (route_ctx.route_trees[net_id])
+        update.tree = route_ctx.route_trees[net_id]->to_records();
+    update.net_delays.assign(net_delay[net_id].begin(), net_delay[net_id].end());
+    update.lower_bound_connection_delays = connections_inf.get_net_lower_bound_connection_delays(net_id);
+    update.forced_reroute_connections = connections_inf.get_net_forced_reroute_connections(net_id);
+    return update;
+}
+
+std::vector<t_net_routing_update> exchange_net_routing_updates(const std::vector<t_net_routing_update>& updates) {
+    std::vector<char> send_buffer;
+    UpdateWriter writer(send_buffer);
+    for (const t_net_routing_update& update : updates) {
+        writer.write(update.net_id);
+        writer.write(update.rerouted);
+        writer.write(update.heap_pushes);
+        writer.write(update.route_bb);
+        writer.write_vector(update.tree);
+        writer.write_vector(update.net_delays);
+        writer.write_vector(update.lower_bound_connection_delays);
+        writer.write_vector(update.forced_reroute_connections);
+    }
+
+    int rank = distributed_route_rank();
+    int num_ranks = distributed_route_num_ranks();
+
+    VTR_ASSERT(send_buffer.size() <= size_t(INT_MAX));
+    int send_size = send_buffer.size();
+    std::vector<int> recv_sizes(num_ranks);
+    MPI_Allgather(&send_size, 1, MPI_INT, recv_sizes.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+    std::vector<int> recv_offsets(num_ranks);
+    size_t total_size = 0;
+    for (int irank = 0; irank < num_ranks; irank++) {
+        VTR_ASSERT(total_size <= size_t(INT_MAX));
+        recv_offsets[irank] = total_size;
+        total_size += recv_sizes[irank];
+    }
+    VTR_ASSERT(total_size <= size_t(INT_MAX));
+
+    std::vector<char> recv_buffer(total_size);
+    MPI_Allgatherv(send_buffer.data(), send_size, MPI_BYTE,
+                   recv_buffer.data(), recv_sizes.data(), recv_offsets.data(), MPI_BYTE, MPI_COMM_WORLD);
+
+    std::vector<t_net_routing_update> others_updates;
+    for (int irank = 0; irank < num_ranks; irank++) {
+        if (irank == rank)
+            continue;
+        const char* begin = recv_buffer.data() + recv_offsets[irank];
+        UpdateReader reader(begin, begin + recv_sizes[irank]);
+        while (!reader.at_end()) {
+            t_net_routing_update update;
+            update.net_id = reader.read<ParentNetId>();
+            update.rerouted = reader.read<bool>();
+            update.heap_pushes = reader.read<size_t>();
+            update.route_bb = reader.read<t_bb>();
+            update.tree = reader.read_vector<RouteTree::NodeRecord>();
+            update.net_delays = reader.read_vector<float>();
+            update.lower_bound_connection_delays = reader.read_vector<float>();
+            update.forced_reroute_connections = reader.read_vector<RRNodeId>();
+            others_updates.push_back(std::move(update));
+        }
+    }
+    return others_updates;
+}
+
+void apply_net_routing_update(const t_net_routing_update& update,
+                              const Netlist<>& net_list,
+                              CBRR& connections_inf,
+                              NetPinsMatrix<float>& net_delay,
+                              TimingInfo* timing_info,
+                              NetPinTimingInvalidator* pin_timing_invalidator,
+                              route_budgets& budgeting_inf) {
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+    ParentNetId net_id = update.net_id;
+
+    vtr::optional<RouteTree>& tree = route_ctx.route_trees[net_id];
+    if (tree)
+        pathfinder_update_cost_from_route_tree(tree->root(), -1);
+    tree = vtr::nullopt;
+    if (!update.tree.empty()) {
+        tree = RouteTree(net_id, update.tree);
+        pathfinder_update_cost_from_route_tree(tree->root(), 1);
+    }
+
+    route_ctx.route_bb[net_id] = update.route_bb;
+
+    VTR_ASSERT(update.net_delays.size() == net_delay[net_id].size());
+    for (size_t ipin = 1; ipin < update.net_delays.size(); ipin++) {
+        if (pin_timing_invalidator && update.net_delays[ipin] != net_delay[net_id][ipin]) {
+            //Delay changed, invalidate for incremental timing update
+            VTR_ASSERT_SAFE(timing_info);
+            pin_timing_invalidator->invalidate_connection(net_list.net_pin(net_id, ipin), timing_info);
+        }
+        net_delay[net_id][ipin] = update.net_delays[ipin];
+    }
+
+    connections_inf.set_net_lower_bound_connection_delays(net_id, update.lower_bound_connection_delays);
+    connections_inf.set_net_forced_reroute_connections(net_id, update.forced_reroute_connections);
+
+    if (update.rerouted) {
+        route_ctx.net_status.set_is_routed(net_id, true);
+        if (budgeting_inf.if_set())
+            budgeting_inf.set_should_reroute(net_id, false);
+    }
+}
+
+bool distributed_route_all(bool value) {
+    int local = value, all;
+    MPI_Allreduce(&local, &all, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD);
+    return all;
+}
+
+/** All the counters of \p stats, to reduce them in one go */
+static std::vector<size_t*> router_stats_counters(RouterStats& stats) {
+    std::vector<size_t*> counters = {
+        &stats.connections_routed,
+        &stats.nets_routed,
+        &stats.heap_pushes,
+        &stats.heap_pops,
+        &stats.inter_cluster_node_pushes,
+        &stats.inter_cluster_node_pops,
+        &stats.intra_cluster_node_pushes,
+        &stats.intra_cluster_node_pops,
+        &stats.profile.connections,
+        &stats.profile.sink_expansions,
+        &stats.profile.path_nodes,
+        &stats.profile.bb_retries};
+    for (int itype = 0; itype < t_rr_type::NUM_RR_TYPES; itype++) {
+        counters.push_back(&stats.inter_cluster_node_type_cnt_pushes[itype]);
+        counters.push_back(&stats.inter_cluster_node_type_cnt_pops[itype]);
+        counters.push_back(&stats.intra_cluster_node_type_cnt_pushes[itype]);
+        counters.push_back(&stats.intra_cluster_node_type_cnt_pops[itype]);
+        counters.push_back(&stats.rt_node_pushes[itype]);
+    }
+    for (size_t& bin : stats.profile.lookahead_error_bins)
+        counters.push_back(&bin);
+    return counters;
+}
+
+void distributed_route_sum_stats(RouterStats& stats) {
+    std::vector<size_t*> counters = router_stats_counters(stats);
+    std::vector<unsigned long long> local(counters.size()), sum(counters.size());
+    for (size_t i = 0; i < counters.size(); i++)
+        local[i] = *counters[i];
+    MPI_Allreduce(local.data(), sum.data(), counters.size(), MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+    for (size_t i = 0; i < counters.size(); i++)
+        *counters[i] = sum[i];
+}
+
+std::vector<double> distributed_route_allgather(const std::vector<double>& values) {
+    std::vector<double> all_values(values.size() * distributed_route_num_ranks());
+    MPI_Allgather(values.data(), values.size(), MPI_DOUBLE, all_values.data(), values.size(), MPI_DOUBLE, MPI_COMM_WORLD);
+    return all_values;
+}
+
+#endif
@@ -0,0 +1,88 @@
+#pragma once
+
+/** @file Inter-process parts of the distributed router (\ref DistributedNetlistRouter).
+ *
+ * Every process runs the same flow up to routing, so they all start with the same routing state.
+ * After each step of routing, each process sends the changes to the nets it routed
+ * (t_net_routing_update) to all the others, which replay them on their copy of the state.
+ * Only the changes are sent: the RR graph and the rest of the context are never exchanged.
+ *
+ * Only compiled with VPR_USE_MPI. */
+
+#ifdef VPR_USE_MPI
+
+#    include <vector>
+
+#    include "NetPinTimingInvalidator.h"
+#    include "connection_based_routing.h"
+#    include "netlist.h"
+#    include "route_budgets.h"
+#    include "route_tree.h"
+#    include "router_stats.h"
+#    include "timing_info.h"
+#    include "vpr_net_pins_matrix.h"
+#    include "vpr_types.h"
+
+/** What routing a net changed in the routing state, except the occupancy (which follows from the route tree) */
+struct t_net_routing_update {
+    ParentNetId net_id;
+    /** Did the routing change? False if the net only got a larger bounding box to retry with */
+    bool rerouted = false;
+    /** Heap pushes it took to route the net (its work estimate for the PartitionTree) */
+    size_t heap_pushes = 0;
+    t_bb route_bb;
+    /** RouteTree::to_records() of the net's route tree. Empty if it has none */
+    std::vector<RouteTree::NodeRecord> tree;
+    /** Delay to each pin of the net [0..num_pins-1] */
+    std::vector<float> net_delays;
+    std::vector<float> lower_bound_connection_delays;
+    std::vector<RRNodeId> forced_reroute_connections;
+};
+
+/** Rank of this process in MPI_COMM_WORLD */
+int distributed_route_rank();
+
+/** Number of processes in MPI_COMM_WORLD */
+int distributed_route_num_ranks();
+
+/** Errors out if MPI isn't initialized (VPR wasn't started by mpirun) or if the processes don't
+ * have the same netlist, RR graph and net terminals. Collective: all the processes must call it */
+void check_distributed_route_consistency(const Netlist<>& net_list);
+
+/** Abort all the processes: one of them can't go on, and the others would wait for it forever */
+[[noreturn]] void abort_distributed_route();
+
+/** Get the update of \p net_id from the current routing state */
+t_net_routing_update get_net_routing_update(ParentNetId net_id,
+                                            bool rerouted,
+                                            size_t heap_pushes,
+                                            const CBRR& connections_inf,
+                                            const NetPinsMatrix<float>& net_delay);
+
+/** Send \p updates (made by this process) to all the processes.
+ * Collective: all the processes must call it.
+ * \return The updates of all the other processes, in rank order */
+std::vector<t_net_routing_update> exchange_net_routing_updates(const std::vector<t_net_routing_update>& updates);
+
+/** Replay an update from another process: swap the net's route tree (and its occupancy) for the
+ * new one, then update its bounding box, delays (invalidating the changed ones for the incremental
+ * timing update), connection state and routing status */
+void apply_net_routing_update(const t_net_routing_update& update,
+                              const Netlist<>& net_list,
+                              CBRR& connections_inf,
+                              NetPinsMatrix<float>& net_delay,
+                              TimingInfo* timing_info,
+                              NetPinTimingInvalidator* pin_timing_invalidator,
+                              route_budgets& budgeting_inf);
+
+/** Is \p value true in all the processes? Collective */
+bool distributed_route_all(bool value);
+
+/** Sum \p stats over all the processes. Collective */
+void distributed_route_sum_stats(RouterStats& stats);
+
+/** Gather \p values (the same number from each process) from all the processes. Collective.
+ * \return The values of each process, in rank order */
+std::vector<double> distributed_route_allgather(const std::vector<double>& values);
+
+#endif
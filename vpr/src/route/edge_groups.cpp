@@ -1,65 +1,157 @@
 #include "edge_groups.h"
 
-#include <stack>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include "rr_graph_fwd.h"
 
-// Adds non-configurable (undirected) edge to be grouped.
-//
-// Returns true if this is a new edge.
-bool EdgeGroups::add_non_config_edge(RRNodeId from_node, RRNodeId to_node) {
-    return graph_[from_node].edges.insert(to_node).second && graph_[to_node].edges.insert(from_node).second;
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
+// The nodes are united by blocks of this many nodes, each block collecting the
+// non-configurable edges of its nodes.
+static constexpr size_t NODES_PER_BLOCK = 4096;
+
+typedef std::vector<std::atomic<uint32_t>> t_node_parents;
+
+// Returns the root of node's set. Each parent is only ever replaced by one of
+// its ancestors, so halving the path (skipping over the parent) is safe even if
+// another thread is uniting the same set.
+static uint32_t find_root(t_node_parents& parents, uint32_t node) {
+    while (true) {
+        uint32_t parent = parents[node].load(std::memory_order_relaxed);
+        if (parent == node) {
+            return node;
+        }
+        uint32_t grandparent = parents[parent].load(std::memory_order_relaxed);
+        if (grandparent != parent) {
+            parents[node].compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+        }
+        node = grandparent;
+    }
 }
 
-// After add_non_config_edge has been called for all edges, create_sets
-// will form groups of nodes that are connected via non-configurable
-// edges.
-void EdgeGroups::create_sets() {
+// Unites the sets of nodes a and b. The larger root is linked under the smaller
+// one, if it is still a root, so the parents only decrease (no cycles) and the
+// root of a set is its smallest node.
+static void unite(t_node_parents& parents, uint32_t a, uint32_t b) {
+    while (true) {
+        a = find_root(parents, a);
+        b = find_root(parents, b);
+        if (a == b) {
+            return;
+        }
+        if (a < b) {
+            std::swap(a, b);
+        }
+        uint32_t expected = a;
+        if (parents[a].compare_exchange_strong(expected, b, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+// Forms the groups of nodes of rr_nodes that are connected via non-configurable edges.
+void EdgeGroups::create_sets(const t_rr_graph_storage& rr_nodes,
+                             const std::function<bool(RREdgeId)>& is_non_configurable) {
+    non_config_edges_.clear();
     rr_non_config_node_sets_.clear();
+    edge_sets_.clear();
 
-    // https://en.wikipedia.org/wiki/Component_(graph_theory)#Algorithms
-    std::vector<size_t> group_size;
-    for (auto& node : graph_) {
-        if (node.second.set == OPEN) {
-            node.second.set = group_size.size();
-            group_size.push_back(add_connected_group(node.second));
-        }
+    size_t num_nodes = rr_nodes.size();
+    VTR_ASSERT(num_nodes < std::numeric_limits<uint32_t>::max());
+
+    t_node_parents parents(num_nodes);
+    for (size_t inode = 0; inode < num_nodes; inode++) {
+        parents[inode].store(inode, std::memory_order_relaxed);
     }
 
-    // Sanity check the node sets.
-    for (const auto& node : graph_) {
-        VTR_ASSERT(node.second.set != OPEN);
-        for (const auto& e : node.second.edges) {
-            int set = graph_[e].set;
-            VTR_ASSERT(set == node.second.set);
+    // Unite the nodes of the non-configurable edges, by blocks of nodes
+    size_t num_blocks = (num_nodes + NODES_PER_BLOCK - 1) / NODES_PER_BLOCK;
+    std::vector<std::vector<std::pair<RRNodeId, RRNodeId>>> block_edges(num_blocks);
+    auto unite_block = [&](size_t iblock) {
+        size_t end_node = std::min(num_nodes, (iblock + 1) * NODES_PER_BLOCK);
+        for (size_t inode = iblock * NODES_PER_BLOCK; inode < end_node; inode++) {
+            RRNodeId src(inode);
+            for (RREdgeId edge : rr_nodes.edge_range(src)) {
+                if (!is_non_configurable(edge)) {
+                    continue;
+                }
+                RRNodeId sink = rr_nodes.edge_sink_node(edge);
+                block_edges[iblock].emplace_back(src, sink);
+                unite(parents, size_t(src), size_t(sink));
+            }
         }
+    };
+
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), num_blocks, unite_block);
+#else
+    for (size_t iblock = 0; iblock < num_blocks; iblock++) {
+        unite_block(iblock);
     }
+#endif
 
-    // Create compact set of sets.
-    rr_non_config_node_sets_.resize(group_size.size());
-    for (size_t i = 0; i < group_size.size(); i++) {
-        rr_non_config_node_sets_[i].reserve(group_size[i]);
+    size_t num_edges = 0;
+    for (const auto& edges : block_edges) {
+        num_edges += edges.size();
     }
-    for (const auto& node : graph_) {
-        rr_non_config_node_sets_[node.second.set].push_back(node.first);
+    non_config_edges_.reserve(num_edges);
+    for (const auto& edges : block_edges) {
+        non_config_edges_.insert(non_config_edges_.end(), edges.begin(), edges.end());
+    }
+
+    // Mark the nodes with non-configurable edges
+    std::vector<char> in_group(num_nodes, false);
+    for (const auto& edge : non_config_edges_) {
+        in_group[size_t(edge.first)] = true;
+        in_group[size_t(edge.second)] = true;
+    }
+
+    // Create compact set of sets. A root is the smallest node of its set, so
+    // it is reached (and given its set index) before the other nodes of the set.
+    std::vector<int> root_sets(num_nodes, OPEN);
+    for (size_t inode = 0; inode < num_nodes; inode++) {
+        if (!in_group[inode]) {
+            continue;
+        }
+        uint32_t root = find_root(parents, inode);
+        if (root_sets[root] == OPEN) {
+            VTR_ASSERT(root == inode);
+            root_sets[root] = rr_non_config_node_sets_.size();
+            rr_non_config_node_sets_.emplace_back();
+        }
+        rr_non_config_node_sets_[root_sets[root]].push_back(RRNodeId(inode));
+    }
+
+    // Sanity check the node sets.
+    edge_sets_.reserve(non_config_edges_.size());
+    for (const auto& edge : non_config_edges_) {
+        int set = root_sets[find_root(parents, size_t(edge.first))];
+        VTR_ASSERT(set != OPEN);
+        VTR_ASSERT(set == root_sets[find_root(parents, size_t(edge.second))]);
+        edge_sets_.push_back(set);
     }
 }
 
 // Create t_non_configurable_rr_sets from set data.
 // NOTE: The stored graph is undirected, so this may generate reverse edges that don't exist.
 t_non_configurable_rr_sets EdgeGroups::output_sets() {
-    t_non_configurable_rr_sets sets;
-    for (const auto& nodes : rr_non_config_node_sets_) {
-        std::set<t_node_edge> edge_set;
-        std::set<RRNodeId> node_set(nodes.begin(), nodes.end());
-
-        for (const auto& src : node_set) {
-            for (const auto& dest : graph_[src].edges) {
-                edge_set.emplace(t_node_edge(src, dest));
-            }
-        }
+    std::vector<std::set<t_node_edge>> edge_sets(rr_non_config_node_sets_.size());
+    for (size_t iedge = 0; iedge < non_config_edges_.size(); iedge++) {
+        const auto& edge = non_config_edges_[iedge];
+        auto& edge_set = edge_sets[edge_sets_[iedge]];
+        edge_set.emplace(t_node_edge(edge.first, edge.second));
+        edge_set.emplace(t_node_edge(edge.second, edge.first));
+    }
 
-        sets.node_sets.emplace(std::move(node_set));
-        sets.edge_sets.emplace(std::move(edge_set));
+    t_non_configurable_rr_sets sets;
+    for (size_t set = 0; set < rr_non_config_node_sets_.size(); set++) {
+        const auto& nodes = rr_non_config_node_sets_[set];
+        sets.node_sets.emplace(nodes.begin(), nodes.end());
+        sets.edge_sets.emplace(std::move(edge_sets[set]));
     }
 
     return sets;
@@ -83,26 +175,3 @@ void EdgeGroups::set_device_context(DeviceContext& device_ctx) {
     device_ctx.rr_non_config_node_sets = std::move(rr_non_config_node_sets);
     device_ctx.rr_node_to_non_config_node_set = std::move(rr_node_to_non_config_node_set);
 }
-
-// Perform a DFS traversal marking everything reachable with the same set id
-size_t EdgeGroups::add_connected_group(const node_data& node) {
-    // stack contains nodes with edges to mark with node.set
-    // The set for each node must be set before pushing it onto the stack
-    std::stack<const node_data*> stack;
-    stack.push(&node);
-    size_t n = 1;
-    while (!stack.empty()) {
-        auto top = stack.top();
-        stack.pop();
-        for (auto e : top->edges) {
-            auto& next = graph_[e];
-            if (next.set != node.set) {
-                VTR_ASSERT(next.set == OPEN);
-                n++;
-                next.set = node.set;
-                stack.push(&next);
-            }
-        }
-    }
-    return n;
-}
@@ -1,13 +1,14 @@
 #ifndef EDGE_GROUPS_H
 #define EDGE_GROUPS_H
 
-#include <unordered_set>
-#include <unordered_map>
+#include <functional>
+#include <utility>
 #include <vector>
 #include <cstddef>
 
 #include "vpr_types.h"
 #include "vpr_context.h"
+#include "rr_graph_storage.h"
 
 // Class for identifying the components of a graph as sets of nodes.
 // Each node is reachable from any other node in the same set, and
@@ -18,20 +19,24 @@
 // non-configurable edges, because a connection to one node
 // must connect them all.
 //
+// The components are found with a lock-free union-find over the nodes:
+// the edges of the nodes are united in parallel (with TBB), each root
+// only being linked under a smaller root, with a compare-and-swap.
+//
 // https://en.wikipedia.org/wiki/Component_(graph_theory)
+// https://en.wikipedia.org/wiki/Disjoint-set_data_structure
 class EdgeGroups {
   public:
     EdgeGroups() {}
 
-    // Adds non-configurable (undirected) edge to be grouped.
+    // Forms the groups of nodes of rr_nodes that are connected via
+    // non-configurable edges (the edges for which is_non_configurable
+    // is true, which must be callable from several threads).
     //
-    // Returns true if this is a new edge.
-    bool add_non_config_edge(RRNodeId from_node, RRNodeId to_node);
-
-    // After add_non_config_edge has been called for all edges, create_sets
-    // will form groups of nodes that are connected via non-configurable
-    // edges.
-    void create_sets();
+    // The sets are ordered by their smallest node, and the nodes of
+    // each set by id.
+    void create_sets(const t_rr_graph_storage& rr_nodes,
+                     const std::function<bool(RREdgeId)>& is_non_configurable);
 
     // Create t_non_configurable_rr_sets from set data.
     // NOTE: The stored graph is undirected, so this may generate reverse edges that don't exist.
@@ -41,20 +46,14 @@ class EdgeGroups {
     void set_device_context(DeviceContext& device_ctx);
 
   private:
-    struct node_data {
-        std::unordered_set<RRNodeId> edges; // Set of indices into graph_
-        int set = OPEN;                     // Index into rr_non_config_node_sets_
-    };
-
-    // Perform a DFS traversal marking everything reachable with the same set id
-    size_t add_connected_group(const node_data& node);
-
-    // Set of non-configurable edges.
-    std::unordered_map<RRNodeId, node_data> graph_;
+    // Non-configurable edges (from, to), ordered by from node.
+    std::vector<std::pair<RRNodeId, RRNodeId>> non_config_edges_;
 
     // Connected components, representing nodes connected by non-configurable edges.
-    // Order is arbitrary.
     std::vector<std::vector<RRNodeId>> rr_non_config_node_sets_;
+
+    // Index into rr_non_config_node_sets_ of the first node of each edge in non_config_edges_.
+    std::vector<int> edge_sets_;
 };
 
 #endif
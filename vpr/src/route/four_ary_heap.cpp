@@ -0,0 +1,270 @@
+#include "four_ary_heap.h"
+#include "rr_graph_fwd.h"
+#include "vtr_log.h"
+#include "vtr_memory.h"
+
+// Slots [0..ROOT_SLOT) are padding so that every group of 4 siblings starts
+// on a cache line boundary (see four_ary_heap.h).
+static constexpr size_t ROOT_SLOT = 3;
+static constexpr size_t CACHE_LINE_BYTES = 64;
+
+static size_t parent(size_t i) { return (i >> 2) + 2; }
+// index of the first of the (up to) 4 children of a heap slot
+static size_t first_child(size_t i) { return (i << 2) - 8; }
+
+FourAryHeap::FourAryHeap()
+    : heap_(nullptr)
+    , heap_size_(0)
+    , heap_tail_(ROOT_SLOT)
+    , max_index_(std::numeric_limits<size_t>::max())
+    , prune_limit_(std::numeric_limits<size_t>::max()) {}
+
+FourAryHeap::~FourAryHeap() {
+    free_all_memory();
+}
+
+t_heap* FourAryHeap::alloc() {
+    return storage_.alloc();
+}
+void FourAryHeap::free(t_heap* hptr) {
+    storage_.free(hptr);
+}
+
+void FourAryHeap::init_heap(const DeviceGrid& grid) {
+    size_t target_heap_size = (grid.width() - 1) * (grid.height() - 1);
+    if (heap_ == nullptr || heap_size_ < target_heap_size) {
+        heap_tail_ = ROOT_SLOT;
+        resize_heap(target_heap_size);
+    }
+    heap_tail_ = ROOT_SLOT;
+}
+
+void FourAryHeap::add_to_heap(t_heap* hptr) {
+    expand_heap_if_full();
+    // start with undefined hole
+    ++heap_tail_;
+    sift_up(heap_tail_ - 1, {hptr->cost, hptr});
+
+    // If we have pruned, rebuild the heap now.
+    if (check_prune_limit()) {
+        build_heap();
+    }
+}
+
+bool FourAryHeap::is_empty_heap() const {
+    return (bool)(heap_tail_ == ROOT_SLOT);
+}
+
+t_heap* FourAryHeap::get_heap_head() {
+    /* Returns a pointer to the smallest element on the heap, or NULL if the     *
+     * heap is empty.  Invalid (index == OPEN) entries on the heap are never     *
+     * returned -- they are just skipped over.                                   */
+
+    t_heap* cheapest;
+
+    do {
+        if (heap_tail_ == ROOT_SLOT) { /* Empty heap. */
+            VTR_LOG_WARN("Empty heap occurred in get_heap_head.\n");
+            return (nullptr);
+        }
+
+        cheapest = heap_[ROOT_SLOT].item;
+
+        --heap_tail_;
+        if (heap_tail_ > ROOT_SLOT) {
+            heap_[ROOT_SLOT] = heap_[heap_tail_];
+            sift_down(ROOT_SLOT);
+        }
+
+    } while (!cheapest->index.is_valid()); /* Get another one if invalid entry. */
+
+    return (cheapest);
+}
+
+void FourAryHeap::empty_heap() {
+    for (size_t i = ROOT_SLOT; i < heap_tail_; i++)
+        free(heap_[i].item);
+
+    heap_tail_ = ROOT_SLOT;
+}
+
+size_t FourAryHeap::size() const { return heap_tail_ - ROOT_SLOT; }
+
+// returns the slot of the cheapest child among the siblings starting at first
+size_t FourAryHeap::smallest_child(size_t first) const {
+    size_t last = std::min(first + 4, heap_tail_);
+    size_t best = first;
+    for (size_t child = first + 1; child < last; ++child) {
+        if (heap_[child].cost < heap_[best].cost)
+            best = child;
+    }
+    return best;
+}
+
+// make a heap rooted at index hole by **sifting down** in O(lgn) time
+void FourAryHeap::sift_down(size_t hole) {
+    HeapNode head{heap_[hole]};
+    size_t child{first_child(hole)};
+    while (child < heap_tail_) {
+        child = smallest_child(child);
+        if (heap_[child].cost < head.cost) {
+            heap_[hole] = heap_[child];
+            hole = child;
+            child = first_child(child);
+        } else
+            break;
+    }
+    heap_[hole] = head;
+}
+
+// runs in O(n) time by sifting down every internal node, starting from the last one
+void FourAryHeap::build_heap() {
+    if (size() < 2) return;
+
+    for (size_t i = parent(heap_tail_ - 1); i >= ROOT_SLOT; --i)
+        sift_down(i);
+}
+
+void FourAryHeap::set_prune_limit(size_t max_index, size_t prune_limit) {
+    if (prune_limit != std::numeric_limits<size_t>::max()) {
+        VTR_ASSERT(max_index < prune_limit);
+    }
+    max_index_ = max_index;
+    prune_limit_ = prune_limit;
+}
+
+// O(lgn) sifting up to maintain heap property after insertion (should sift down when building heap)
+void FourAryHeap::sift_up(size_t leaf, HeapNode node) {
+    while ((leaf > ROOT_SLOT) && (node.cost < heap_[parent(leaf)].cost)) {
+        // sift hole up
+        heap_[leaf] = heap_[parent(leaf)];
+        leaf = parent(leaf);
+    }
+    heap_[leaf] = node;
+}
+
+// (re)allocates the cache-line aligned heap array, preserving the live elements
+void FourAryHeap::resize_heap(size_t num_slots) {
+    void* data;
+    int ret = vtr::memalign(&data, CACHE_LINE_BYTES, sizeof(HeapNode) * (num_slots + ROOT_SLOT));
+    if (ret != 0) {
+        throw std::bad_alloc();
+    }
+    HeapNode* new_heap = static_cast<HeapNode*>(data);
+
+    if (heap_ != nullptr) {
+        std::copy(heap_ + ROOT_SLOT, heap_ + heap_tail_, new_heap + ROOT_SLOT);
+#ifdef _WIN32
+        _aligned_free(heap_);
+#else
+        vtr::free(heap_);
+#endif
+    }
+
+    heap_ = new_heap;
+    heap_size_ = num_slots;
+}
+
+//expands heap by "realloc"
+void FourAryHeap::expand_heap_if_full() {
+    if (size() >= heap_size_) { /* Heap is full */
+        resize_heap(std::max<size_t>(2 * heap_size_, 1));
+    }
+}
+
+// adds an element to the back of heap and expand if necessary, but does not maintain heap property
+void FourAryHeap::push_back(t_heap* const hptr) {
+    expand_heap_if_full();
+    heap_[heap_tail_] = {hptr->cost, hptr};
+    ++heap_tail_;
+
+    check_prune_limit();
+}
+
+bool FourAryHeap::is_valid() const {
+    if (heap_ == nullptr) {
+        return false;
+    }
+
+    for (size_t i = ROOT_SLOT + 1; i < heap_tail_; ++i) {
+        if (heap_[i].cost < heap_[parent(i)].cost) return false;
+        if (heap_[i].cost != heap_[i].item->cost) return false;
+    }
+    return true;
+}
+
+void FourAryHeap::free_all_memory() {
+    if (heap_ != nullptr) {
+        empty_heap();
+
+#ifdef _WIN32
+        _aligned_free(heap_);
+#else
+        vtr::free(heap_);
+#endif
+        heap_ = nullptr;
+        heap_size_ = 0;
+    }
+
+    storage_.free_all_memory();
+}
+
+bool FourAryHeap::check_prune_limit() {
+    if (size() > prune_limit_) {
+        prune_heap();
+        return true;
+    }
+
+    return false;
+}
+
+void FourAryHeap::prune_heap() {
+    VTR_ASSERT(max_index_ < prune_limit_);
+
+    std::vector<t_heap*> best_heap_item(max_index_, nullptr);
+
+    // Find the cheapest instance of each index and store it.
+    for (size_t i = ROOT_SLOT; i < heap_tail_; i++) {
+        t_heap* item = heap_[i].item;
+        if (item == nullptr) {
+            continue;
+        }
+
+        if (!item->index.is_valid()) {
+            free(item);
+            heap_[i].item = nullptr;
+            continue;
+        }
+
+        auto idx = size_t(item->index);
+
+        VTR_ASSERT(idx < max_index_);
+
+        if (best_heap_item[idx] == nullptr || best_heap_item[idx]->cost > item->cost) {
+            best_heap_item[idx] = item;
+        }
+    }
+
+    // Free unused nodes.
+    for (size_t i = ROOT_SLOT; i < heap_tail_; i++) {
+        t_heap* item = heap_[i].item;
+        if (item == nullptr) {
+            continue;
+        }
+
+        auto idx = size_t(item->index);
+
+        if (best_heap_item[idx] != item) {
+            free(item);
+            heap_[i].item = nullptr;
+        }
+    }
+
+    heap_tail_ = ROOT_SLOT;
+
+    for (size_t i = 0; i < max_index_; ++i) {
+        if (best_heap_item[i] != nullptr) {
+            heap_[heap_tail_++] = {best_heap_item[i]->cost, best_heap_item[i]};
+        }
+    }
+}
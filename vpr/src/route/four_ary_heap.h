@@ -0,0 +1,68 @@
+#ifndef _FOUR_ARY_HEAP_H
+#define _FOUR_ARY_HEAP_H
+
+#include "heap_type.h"
+#include <vector>
+
+/**
+ * @brief A 4-ary min-heap laid out so that the children of every node share a cache line.
+ *
+ * Unlike BinaryHeap, which stores only t_heap pointers and must dereference
+ * into the HeapStorage pool on every comparison, FourAryHeap stores each
+ * element's sort key inline next to its pointer.  Sift operations therefore
+ * only touch the (contiguous) heap array; the t_heap object itself is only
+ * accessed when it is popped.
+ *
+ * Each heap slot is 16 bytes, so the 4 children of a node occupy exactly one
+ * 64-byte cache line.  To keep every group of siblings on a single line, the
+ * array is cache-line aligned and the root is stored at slot 3 (slots [0..2]
+ * are unused padding), which places the children of slot s at [4s-8 .. 4s-5].
+ */
+class FourAryHeap : public HeapInterface {
+  public:
+    FourAryHeap();
+    ~FourAryHeap();
+
+    t_heap* alloc() final;
+    void free(t_heap* hptr) final;
+
+    void init_heap(const DeviceGrid& grid) final;
+    void add_to_heap(t_heap* hptr) final;
+    void push_back(t_heap* const hptr) final;
+    bool is_empty_heap() const final;
+    bool is_valid() const final;
+    void empty_heap() final;
+    t_heap* get_heap_head() final;
+    void build_heap() final;
+    void set_prune_limit(size_t max_index, size_t prune_limit) final;
+
+    void free_all_memory() final;
+
+  private:
+    // A single heap slot: the sort key is kept inline with the item so
+    // comparisons never leave the heap array.
+    struct HeapNode {
+        float cost;
+        t_heap* item;
+    };
+    static_assert(sizeof(HeapNode) <= 16, "Four HeapNode siblings must fit in one cache line");
+
+    size_t size() const;
+    void sift_up(size_t leaf, HeapNode node);
+    void sift_down(size_t hole);
+    size_t smallest_child(size_t first_child) const;
+    void resize_heap(size_t num_slots);
+    void expand_heap_if_full();
+    bool check_prune_limit();
+    void prune_heap();
+
+    HeapStorage storage_;
+    HeapNode* heap_;   /* Cache-line aligned; elements live in [ROOT_SLOT..heap_tail_) */
+    size_t heap_size_; /* Number of usable element slots in the heap array */
+    size_t heap_tail_; /* Index of first unused slot in the heap array */
+
+    size_t max_index_;
+    size_t prune_limit_;
+};
+
+#endif /* _FOUR_ARY_HEAP_H */
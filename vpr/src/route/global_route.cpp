@@ -0,0 +1,373 @@
+#include "global_route.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <queue>
+#include <vector>
+
+#include "globals.h"
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_memory.h"
+#include "vtr_time.h"
+
+/** Nets with pins in more GCells than this aren't globally routed: they span most of their
+ * bounding box anyway, and routing them over the GCells would dominate the pre-pass */
+constexpr size_t GLOBAL_ROUTE_MAX_PIN_GCELLS = 64;
+
+/** Present congestion factor of the first global routing round (multiplied by 2 every round) */
+constexpr float GLOBAL_ROUTE_INITIAL_PRES_FAC = 0.5;
+
+/** The GCells of the device and the edges between adjacent GCells.
+ *
+ * GCell (gx, gy) is at index gy * nx + gx. The edge between (gx, gy) and (gx + 1, gy) is at
+ * index gy * (nx - 1) + gx, and the edge between (gx, gy) and (gx, gy + 1) at num_h_edges + gy * nx + gx. */
+struct t_gcell_graph {
+    int nx = 0;
+    int ny = 0;
+    int num_h_edges = 0;
+
+    std::vector<int> capacity;  /* [0..num_edges-1] Channel tracks crossing the edge */
+    std::vector<int> usage;     /* [0..num_edges-1] Nets whose global route uses the edge */
+    std::vector<float> history; /* [0..num_edges-1] Accumulated overuse of the edge */
+
+    int cell(int gx, int gy) const { return gy * nx + gx; }
+    int h_edge(int gx, int gy) const { return gy * (nx - 1) + gx; }
+    int v_edge(int gx, int gy) const { return num_h_edges + gy * nx + gx; }
+};
+
+/** Global route of a net: the GCells of its tree, and the edges between them */
+struct t_net_global_route {
+    std::vector<int> cells;
+    std::vector<int> edges;
+    /** Bitmask of the cells (parallel to cells), set for the cells which hold a pin */
+    std::vector<bool> is_pin_cell;
+    bool routed = false;
+};
+
+/** A bounding box in GCells */
+struct t_gcell_bb {
+    int gxmin, gymin, gxmax, gymax;
+};
+
+static int channel_width(const std::vector<int>& width_list, int coord, int default_width) {
+    return coord < int(width_list.size()) ? width_list[coord] : default_width;
+}
+
+static t_gcell_graph build_gcell_graph(const DeviceGrid& grid, const t_chan_width& chan_width) {
+    constexpr int G = GLOBAL_ROUTE_GCELL_TILES;
+    int width = grid.width();
+    int height = grid.height();
+
+    t_gcell_graph graph;
+    graph.nx = (width + G - 1) / G;
+    graph.ny = (height + G - 1) / G;
+    graph.num_h_edges = std::max(graph.nx - 1, 0) * graph.ny;
+    size_t num_edges = graph.num_h_edges + graph.nx * std::max(graph.ny - 1, 0);
+
+    graph.capacity.resize(num_edges, 0);
+    graph.usage.resize(num_edges, 0);
+    graph.history.resize(num_edges, 0.);
+
+    /* Crossing a vertical border uses the x-directed tracks of the rows of the GCell, and vice versa */
+    for (int gy = 0; gy < graph.ny; gy++) {
+        int tracks = 0;
+        for (int y = gy * G; y < std::min((gy + 1) * G, height); y++)
+            tracks += channel_width(chan_width.x_list, y, chan_width.x_max);
+        for (int gx = 0; gx + 1 < graph.nx; gx++)
+            graph.capacity[graph.h_edge(gx, gy)] = tracks;
+    }
+    for (int gx = 0; gx < graph.nx; gx++) {
+        int tracks = 0;
+        for (int x = gx * G; x < std::min((gx + 1) * G, width); x++)
+            tracks += channel_width(chan_width.y_list, x, chan_width.y_max);
+        for (int gy = 0; gy + 1 < graph.ny; gy++)
+            graph.capacity[graph.v_edge(gx, gy)] = tracks;
+    }
+
+    return graph;
+}
+
+static float edge_cost(const t_gcell_graph& graph, int edge, float pres_fac) {
+    int overuse = std::max(graph.usage[edge] + 1 - graph.capacity[edge], 0);
+    float pres_cost = 1. + pres_fac * overuse / std::max(graph.capacity[edge], 1);
+    return (1. + graph.history[edge]) * pres_cost;
+}
+
+/** Removes the global route of a net from the edge usage */
+static void rip_up_net(t_gcell_graph& graph, t_net_global_route& route) {
+    for (int edge : route.edges)
+        graph.usage[edge]--;
+    route.cells.clear();
+    route.edges.clear();
+    route.is_pin_cell.clear();
+    route.routed = false;
+}
+
+/** Scratch space of the path searches, shared by all nets */
+struct t_global_route_scratch {
+    std::vector<float> cost;    /* [0..num_cells-1] */
+    std::vector<int> prev_edge; /* [0..num_cells-1] Edge used to reach the cell, or -1 for tree cells */
+    std::vector<int> prev_cell; /* [0..num_cells-1] */
+    std::vector<int> in_tree;   /* [0..num_cells-1] Stamp of the last net whose tree has the cell */
+    std::vector<int> touched;   /* Cells with a finite cost */
+    int stamp = 0;
+};
+
+/** Routes a net over the GCells: each pin GCell (closest to the source first) is connected to the
+ * tree built so far by the cheapest path inside the net's bounding box */
+static void route_net_global(t_gcell_graph& graph,
+                             const std::vector<int>& pin_cells,
+                             const t_gcell_bb& bb,
+                             float pres_fac,
+                             t_global_route_scratch& scratch,
+                             t_net_global_route& route) {
+    scratch.stamp++;
+
+    int source_cell = pin_cells[0];
+    route.cells.push_back(source_cell);
+    route.is_pin_cell.push_back(true);
+    scratch.in_tree[source_cell] = scratch.stamp;
+
+    using t_queue_item = std::pair<float, int>;
+    std::priority_queue<t_queue_item, std::vector<t_queue_item>, std::greater<t_queue_item>> queue;
+
+    for (size_t ipin = 1; ipin < pin_cells.size(); ipin++) {
+        int target = pin_cells[ipin];
+        if (scratch.in_tree[target] == scratch.stamp)
+            continue;
+
+        /* Grow the search from the whole tree */
+        for (int cell : route.cells) {
+            scratch.cost[cell] = 0.;
+            scratch.prev_edge[cell] = -1;
+            scratch.touched.push_back(cell);
+            queue.push({0., cell});
+        }
+
+        while (!queue.empty()) {
+            auto [cost, cell] = queue.top();
+            queue.pop();
+            if (cell == target)
+                break;
+            if (cost > scratch.cost[cell])
+                continue;
+
+            int gx = cell % graph.nx;
+            int gy = cell / graph.nx;
+            auto relax = [&](int next_gx, int next_gy, int edge) {
+                int next = graph.cell(next_gx, next_gy);
+                float next_cost = cost + edge_cost(graph, edge, pres_fac);
+                if (next_cost < scratch.cost[next]) {
+                    if (std::isinf(scratch.cost[next]))
+                        scratch.touched.push_back(next);
+                    scratch.cost[next] = next_cost;
+                    scratch.prev_edge[next] = edge;
+                    scratch.prev_cell[next] = cell;
+                    queue.push({next_cost, next});
+                }
+            };
+            if (gx > bb.gxmin) relax(gx - 1, gy, graph.h_edge(gx - 1, gy));
+            if (gx < bb.gxmax) relax(gx + 1, gy, graph.h_edge(gx, gy));
+            if (gy > bb.gymin) relax(gx, gy - 1, graph.v_edge(gx, gy - 1));
+            if (gy < bb.gymax) relax(gx, gy + 1, graph.v_edge(gx, gy));
+        }
+        queue = decltype(queue)();
+
+        /* The bounding box holds all the pins, so the target is always reached.
+         * Walk back to the tree, adding the path to it */
+        VTR_ASSERT(std::isfinite(scratch.cost[target]));
+        for (int cell = target; scratch.in_tree[cell] != scratch.stamp; cell = scratch.prev_cell[cell]) {
+            int edge = scratch.prev_edge[cell];
+            graph.usage[edge]++;
+            route.edges.push_back(edge);
+            route.cells.push_back(cell);
+            route.is_pin_cell.push_back(cell == target);
+            scratch.in_tree[cell] = scratch.stamp;
+        }
+
+        for (int cell : scratch.touched)
+            scratch.cost[cell] = std::numeric_limits<float>::infinity();
+        scratch.touched.clear();
+    }
+
+    /* Pins which were already on the tree when their turn came */
+    for (size_t icell = 0; icell < route.cells.size(); icell++) {
+        if (!route.is_pin_cell[icell] && std::find(pin_cells.begin(), pin_cells.end(), route.cells[icell]) != pin_cells.end())
+            route.is_pin_cell[icell] = true;
+    }
+    route.routed = true;
+}
+
+/** Does the global route of a net use an overused edge? */
+static bool uses_overused_edge(const t_gcell_graph& graph, const t_net_global_route& route) {
+    for (int edge : route.edges) {
+        if (graph.usage[edge] > graph.capacity[edge])
+            return true;
+    }
+    return false;
+}
+
+void global_route_prepass(const Netlist<>& net_list, t_net_bb_vector& route_bb) {
+    vtr::ScopedStartFinishTimer timer("Global routing pre-pass");
+
+    const auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+    const DeviceGrid& grid = device_ctx.grid;
+    constexpr int G = GLOBAL_ROUTE_GCELL_TILES;
+
+    t_gcell_graph graph = build_gcell_graph(grid, device_ctx.chan_width);
+    size_t num_cells = size_t(graph.nx) * graph.ny;
+    if (num_cells < 2) {
+        VTR_LOG("Device is a single GCell, nothing to globally route\n");
+        return;
+    }
+
+    t_global_route_scratch scratch;
+    scratch.cost.resize(num_cells, std::numeric_limits<float>::infinity());
+    scratch.prev_edge.resize(num_cells, -1);
+    scratch.prev_cell.resize(num_cells, -1);
+    scratch.in_tree.resize(num_cells, 0);
+
+    /* Pin GCells (source first, then the sinks from the closest) of the nets to globally route */
+    vtr::vector<ParentNetId, std::vector<int>> net_pin_cells(net_list.nets().size());
+    std::vector<ParentNetId> nets_to_route;
+    for (ParentNetId net_id : net_list.nets()) {
+        if (route_ctx.is_clock_net[net_id] || net_list.net_is_global(net_id) || net_list.net_is_ignored(net_id))
+            continue;
+
+        std::vector<int>& pin_cells = net_pin_cells[net_id];
+        for (RRNodeId pin_rr : route_ctx.net_rr_terminals[net_id]) {
+            pin_cells.push_back(graph.cell(rr_graph.node_xlow(pin_rr) / G, rr_graph.node_ylow(pin_rr) / G));
+        }
+        int source_gx = pin_cells[0] % graph.nx;
+        int source_gy = pin_cells[0] / graph.nx;
+        std::sort(pin_cells.begin() + 1, pin_cells.end(), [&](int lhs, int rhs) {
+            int lhs_dist = std::abs(lhs % graph.nx - source_gx) + std::abs(lhs / graph.nx - source_gy);
+            int rhs_dist = std::abs(rhs % graph.nx - source_gx) + std::abs(rhs / graph.nx - source_gy);
+            return lhs_dist < rhs_dist || (lhs_dist == rhs_dist && lhs < rhs);
+        });
+        pin_cells.erase(std::unique(pin_cells.begin() + 1, pin_cells.end()), pin_cells.end());
+
+        if (pin_cells.size() < 2 || pin_cells.size() > GLOBAL_ROUTE_MAX_PIN_GCELLS) {
+            /* Within a single GCell (nothing to route), or too large to be worth it */
+            vtr::release_memory(pin_cells);
+            continue;
+        }
+        nets_to_route.push_back(net_id);
+    }
+
+    auto net_gcell_bb = [&](ParentNetId net_id) {
+        const t_bb& bb = route_bb[net_id];
+        return t_gcell_bb{std::max(bb.xmin, 0) / G,
+                          std::max(bb.ymin, 0) / G,
+                          std::min(bb.xmax, int(grid.width()) - 1) / G,
+                          std::min(bb.ymax, int(grid.height()) - 1) / G};
+    };
+
+    /* Negotiated congestion: route all nets, then rip-up and reroute the ones using overused edges */
+    vtr::vector<ParentNetId, t_net_global_route> net_routes(net_list.nets().size());
+    float pres_fac = GLOBAL_ROUTE_INITIAL_PRES_FAC;
+    size_t num_overused_edges = 0;
+    int iround;
+    for (iround = 0; iround < GLOBAL_ROUTE_ITERATIONS; iround++) {
+        for (ParentNetId net_id : nets_to_route) {
+            t_net_global_route& route = net_routes[net_id];
+            if (route.routed) {
+                if (!uses_overused_edge(graph, route))
+                    continue;
+                rip_up_net(graph, route);
+            }
+            route_net_global(graph, net_pin_cells[net_id], net_gcell_bb(net_id), pres_fac, scratch, route);
+        }
+
+        num_overused_edges = 0;
+        for (size_t edge = 0; edge < graph.usage.size(); edge++) {
+            int overuse = graph.usage[edge] - graph.capacity[edge];
+            if (overuse > 0) {
+                graph.history[edge] += float(overuse) / std::max(graph.capacity[edge], 1);
+                num_overused_edges++;
+            }
+        }
+        if (num_overused_edges == 0)
+            break;
+        pres_fac *= 2;
+    }
+
+    /* Shrink the bounding boxes to the pins and the GCells of the global routes */
+    size_t area_before = 0;
+    size_t area_after = 0;
+    for (ParentNetId net_id : nets_to_route) {
+        t_bb& bb = route_bb[net_id];
+        area_before += size_t(bb.xmax - bb.xmin + 1) * size_t(bb.ymax - bb.ymin + 1);
+
+        int xmin = std::numeric_limits<int>::max(), ymin = std::numeric_limits<int>::max();
+        int xmax = std::numeric_limits<int>::min(), ymax = std::numeric_limits<int>::min();
+        for (RRNodeId pin_rr : route_ctx.net_rr_terminals[net_id]) {
+            xmin = std::min<int>(xmin, rr_graph.node_xlow(pin_rr));
+            ymin = std::min<int>(ymin, rr_graph.node_ylow(pin_rr));
+            xmax = std::max<int>(xmax, rr_graph.node_xhigh(pin_rr));
+            ymax = std::max<int>(ymax, rr_graph.node_yhigh(pin_rr));
+        }
+        const t_net_global_route& route = net_routes[net_id];
+        for (size_t icell = 0; icell < route.cells.size(); icell++) {
+            if (route.is_pin_cell[icell])
+                continue;
+            /* A GCell the route goes through: the connections may use any of its tiles */
+            int gx = route.cells[icell] % graph.nx;
+            int gy = route.cells[icell] / graph.nx;
+            xmin = std::min(xmin, gx * G);
+            ymin = std::min(ymin, gy * G);
+            xmax = std::max(xmax, (gx + 1) * G - 1);
+            ymax = std::max(ymax, (gy + 1) * G - 1);
+        }
+
+        /* As in load_net_route_bb(), the channels on all 4 sides of the pins should be usable */
+        bb.xmin = std::max(bb.xmin, xmin - 1 - GLOBAL_ROUTE_BB_MARGIN);
+        bb.ymin = std::max(bb.ymin, ymin - 1 - GLOBAL_ROUTE_BB_MARGIN);
+        bb.xmax = std::min(bb.xmax, xmax + GLOBAL_ROUTE_BB_MARGIN);
+        bb.ymax = std::min(bb.ymax, ymax + GLOBAL_ROUTE_BB_MARGIN);
+        area_after += size_t(bb.xmax - bb.xmin + 1) * size_t(bb.ymax - bb.ymin + 1);
+    }
+
+    /* Seed the history of the channels of the GCells which stay overused */
+    size_t num_seeded_nodes = 0;
+    if (num_overused_edges > 0) {
+        std::vector<float> cell_overuse(num_cells, 0.);
+        for (int gy = 0; gy < graph.ny; gy++) {
+            for (int gx = 0; gx < graph.nx; gx++) {
+                auto add_edge = [&](int edge) {
+                    float overuse = float(graph.usage[edge] - graph.capacity[edge]) / std::max(graph.capacity[edge], 1);
+                    if (overuse > 0.) {
+                        float& cell = cell_overuse[graph.cell(gx, gy)];
+                        cell = std::max(cell, overuse);
+                    }
+                };
+                if (gx > 0) add_edge(graph.h_edge(gx - 1, gy));
+                if (gx + 1 < graph.nx) add_edge(graph.h_edge(gx, gy));
+                if (gy > 0) add_edge(graph.v_edge(gx, gy - 1));
+                if (gy + 1 < graph.ny) add_edge(graph.v_edge(gx, gy));
+            }
+        }
+
+        for (RRNodeId inode : rr_graph.nodes()) {
+            t_rr_type type = rr_graph.node_type(inode);
+            if (type != CHANX && type != CHANY)
+                continue;
+            float overuse = cell_overuse[graph.cell(rr_graph.node_xlow(inode) / G, rr_graph.node_ylow(inode) / G)];
+            if (overuse > 0.) {
+                float& acc_cost = route_ctx.rr_node_cong_inf[inode].acc_cost;
+                acc_cost = std::max(acc_cost, 1.f + GLOBAL_ROUTE_ACC_COST_FAC * overuse);
+                num_seeded_nodes++;
+            }
+        }
+    }
+
+    VTR_LOG("Globally routed %zu nets over %dx%d GCells in %d rounds: %zu overused GCell edges\n",
+            nets_to_route.size(), graph.nx, graph.ny, std::min(iround + 1, GLOBAL_ROUTE_ITERATIONS), num_overused_edges);
+    VTR_LOG("Route bounding box area of these nets reduced by %.1f%%, history seeded for %zu channel nodes\n",
+            area_before > 0 ? 100. * (1. - double(area_after) / area_before) : 0., num_seeded_nodes);
+}
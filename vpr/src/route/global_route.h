@@ -0,0 +1,36 @@
+#pragma once
+
+/** @file Coarse global routing pre-pass, run before the first PathFinder iteration.
+ *
+ * The device is divided into square GCells of GLOBAL_ROUTE_GCELL_TILES x GLOBAL_ROUTE_GCELL_TILES
+ * tiles. Adjacent GCells are connected by edges whose capacity is the number of channel tracks
+ * crossing their common border (from the channel widths of the device). Each net is routed as a
+ * tree over this small graph, with a few rounds of negotiated congestion (rip-up and reroute of
+ * the nets using overused edges), which is much cheaper than routing it in the RR graph.
+ *
+ * The global routes then seed the detailed router:
+ *  - The route bounding box of each net is shrunk to its pins and the GCells its global route
+ *    detours through (plus a margin), so its connections explore less of the RR graph. It never
+ *    grows past the bounding box from load_route_bb(), and the connection router still retries
+ *    with the full device if a connection can't be routed inside it.
+ *  - The channel nodes of the GCells which remain overused start with a history (acc_cost) cost
+ *    proportional to their overuse, so the first iteration already steers around the hot spots. */
+
+#include "netlist.h"
+#include "vpr_types.h"
+
+/** Width and height of a GCell, in tiles */
+constexpr int GLOBAL_ROUTE_GCELL_TILES = 4;
+
+/** Rounds of negotiated congestion routing over the GCells */
+constexpr int GLOBAL_ROUTE_ITERATIONS = 4;
+
+/** Tiles added around the pins and GCells of a net's global route to get its route bounding box */
+constexpr int GLOBAL_ROUTE_BB_MARGIN = 1;
+
+/** Initial history cost of the channel nodes of a GCell, per unit of (fractional) overuse of its edges */
+constexpr float GLOBAL_ROUTE_ACC_COST_FAC = 1.;
+
+/** Globally route \p net_list, then tighten \p route_bb and seed the routing history from the
+ * result (see global_route.h). Clock nets and global nets keep their bounding boxes. */
+void global_route_prepass(const Netlist<>& net_list, t_net_bb_vector& route_bb);
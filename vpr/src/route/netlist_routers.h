@@ -21,10 +21,12 @@
 #include "clustered_netlist_utils.h"
 #include "connection_based_routing_fwd.h"
 #include "connection_router.h"
+#include "four_ary_heap.h"
 #include "globals.h"
 #include "heap_type.h"
 #include "netlist_fwd.h"
 #include "partition_tree.h"
+#include "radix_heap.h"
 #include "routing_predictor.h"
 #include "route_budgets.h"
 #include "route_utils.h"
@@ -41,6 +43,10 @@ struct RouteIterResults {
     std::vector<ParentNetId> rerouted_nets;
     /** RouterStats for this iteration */
     RouterStats stats;
+    /** Load balance of this iteration (parallel routers only) */
+    RouteLoadBalance load_balance;
+    /** Time spent routing nets (in the per-thread results of the parallel routers) */
+    float busy_sec = 0.;
 };
 
 /** Route a given netlist. Takes a big context and passes it around to net & sink routing fns.
@@ -69,6 +75,9 @@ class NetlistRouter {
 #    include "ParallelNetlistRouter.h"
 #    include "DecompNetlistRouter.h"
 #endif
+#ifdef VPR_USE_MPI
+#    include "DistributedNetlistRouter.h"
+#endif
 
 template<typename HeapType>
 inline std::unique_ptr<NetlistRouter> make_netlist_router_with_heap(
@@ -82,7 +91,7 @@ inline std::unique_ptr<NetlistRouter> make_netlist_router_with_heap(
     NetPinTimingInvalidator* pin_timing_invalidator,
     route_budgets& budgeting_inf,
     const RoutingPredictor& routing_predictor,
-    const vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>>& choking_spots,
+    const vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>>& choking_spots,
     bool is_flat) {
     if (router_opts.router_algorithm == e_router_algorithm::TIMING_DRIVEN) {
         return std::make_unique<SerialNetlistRouter<HeapType>>(
@@ -133,6 +142,24 @@ inline std::unique_ptr<NetlistRouter> make_netlist_router_with_heap(
             is_flat);
 #else
         VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "VPR isn't compiled with TBB support required for parallel routing");
+#endif
+    } else if (router_opts.router_algorithm == e_router_algorithm::DISTRIBUTED) {
+#ifdef VPR_USE_MPI
+        return std::make_unique<DistributedNetlistRouter<HeapType>>(
+            net_list,
+            router_lookahead,
+            router_opts,
+            connections_inf,
+            net_delay,
+            netlist_pin_lookup,
+            timing_info,
+            pin_timing_invalidator,
+            budgeting_inf,
+            routing_predictor,
+            choking_spots,
+            is_flat);
+#else
+        VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "VPR isn't compiled with MPI support required for distributed routing");
 #endif
     } else {
         VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Unknown router algorithm %d", router_opts.router_algorithm);
@@ -151,7 +178,7 @@ inline std::unique_ptr<NetlistRouter> make_netlist_router(
     NetPinTimingInvalidator* pin_timing_invalidator,
     route_budgets& budgeting_inf,
     const RoutingPredictor& routing_predictor,
-    const vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>>& choking_spots,
+    const vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>>& choking_spots,
     bool is_flat) {
     if (router_opts.router_heap == e_heap_type::BINARY_HEAP) {
         return make_netlist_router_with_heap<BinaryHeap>(
@@ -181,6 +208,34 @@ inline std::unique_ptr<NetlistRouter> make_netlist_router(
             routing_predictor,
             choking_spots,
             is_flat);
+    } else if (router_opts.router_heap == e_heap_type::FOUR_ARY_HEAP) {
+        return make_netlist_router_with_heap<FourAryHeap>(
+            net_list,
+            router_lookahead,
+            router_opts,
+            connections_inf,
+            net_delay,
+            netlist_pin_lookup,
+            timing_info,
+            pin_timing_invalidator,
+            budgeting_inf,
+            routing_predictor,
+            choking_spots,
+            is_flat);
+    } else if (router_opts.router_heap == e_heap_type::RADIX_HEAP) {
+        return make_netlist_router_with_heap<RadixHeap>(
+            net_list,
+            router_lookahead,
+            router_opts,
+            connections_inf,
+            net_delay,
+            netlist_pin_lookup,
+            timing_info,
+            pin_timing_invalidator,
+            budgeting_inf,
+            routing_predictor,
+            choking_spots,
+            is_flat);
     } else {
         VPR_FATAL_ERROR(VPR_ERROR_ROUTE, "Unknown heap type %d", router_opts.router_heap);
     }
@@ -1,95 +1,151 @@
 #include "partition_tree.h"
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <memory>
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_invoke.h>
+#endif
+
 /** Minimum number of nets inside a partition to continue further partitioning.
  * Mostly an arbitrary limit. At a certain point, the quality lost due to disturbed net ordering 
  * and the task creation overhead outweighs the advantage of partitioning, so we should stop. */
 constexpr size_t MIN_NETS_TO_PARTITION = 256;
 
-PartitionTree::PartitionTree(const Netlist<>& netlist) {
+/** Minimum number of nets in a partition to build its two subtrees in parallel */
+constexpr size_t MIN_NETS_TO_BUILD_IN_PARALLEL = 4 * MIN_NETS_TO_PARTITION;
+
+/** Estimate the work of routing each net: the connection router explores some of the
+ * bounding box for each sink, so weight the fanout by the area of the bounding box */
+static vtr::vector<ParentNetId, size_t> estimate_net_work(const Netlist<>& netlist) {
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    vtr::vector<ParentNetId, size_t> net_work(netlist.nets().size());
+    for (auto net_id : netlist.nets()) {
+        const t_bb& bb = route_ctx.route_bb[net_id];
+        size_t bb_area = size_t(bb.xmax - bb.xmin + 1) * size_t(bb.ymax - bb.ymin + 1);
+        net_work[net_id] = std::max<size_t>(netlist.net_sinks(net_id).size() * bb_area, 1);
+    }
+    return net_work;
+}
+
+/** Total work of the nets before, after and intersected by each cutline of an axis */
+struct t_cutline_work {
+    std::vector<size_t> total_before;
+    std::vector<size_t> total_after;
+    std::vector<size_t> total_on;
+};
+
+/** Sum the work of \p nets around each cutline in [lo, hi] along \p axis in a single sweep.
+ *
+ * Cutlines are placed between integral coordinates.
+ * For instance, total_before[0] assumes a cutline at lo+0.5, so work at lo is included but not
+ * lo+1. It's similar for total_after[0], which excludes work at lo and includes lo+1.
+ * Note that we have W-1 possible cutlines for a W-wide box.
+ *
+ * Here, total_before holds total score of nets before the cutline and not intersecting it.
+ * In ParaDRo this would be total_before + total_on. (same for total_after)
+ *
+ * VPR's bounding boxes include the borders (see ConnectionRouter::timing_driven_expand_neighbour())
+ * so x=bb.xmax, y=bb.ymax etc. are included. Each net only adds its work where its (clamped)
+ * bounding box starts and ends, and prefix sums spread it over the cutlines: this is
+ * O(nets + W) instead of O(nets * W). */
+static t_cutline_work sum_cutline_work(const std::vector<ParentNetId>& nets, const vtr::vector<ParentNetId, size_t>& net_work, Axis axis, int lo, int hi) {
+    const auto& route_ctx = g_vpr_ctx.routing();
+    size_t num_cutlines = hi - lo;
+
+    /* ends_at[c]/starts_at[c]: work of the nets whose bbox ends/starts at lo+c.
+     * on_delta[c]: change of the work on the cutline at lo+c+0.5 from the previous one */
+    std::vector<size_t> ends_at(num_cutlines + 1, 0), starts_at(num_cutlines + 1, 0);
+    std::vector<size_t> on_delta(num_cutlines + 1, 0), on_end(num_cutlines + 1, 0);
+    for (auto net_id : nets) {
+        const t_bb& bb = route_ctx.route_bb[net_id];
+        size_t work = net_work[net_id];
+
+        /* Inclusive start and end coords of the bbox relative to lo. Clamp to [lo, hi]. */
+        int bb_min = axis == Axis::X ? bb.xmin : bb.ymin;
+        int bb_max = axis == Axis::X ? bb.xmax : bb.ymax;
+        int start = std::clamp(bb_min, lo, hi) - lo;
+        int end = std::clamp(bb_max, lo, hi) - lo;
+
+        ends_at[end] += work;
+        starts_at[start] += work;
+        /* Intersected by the cutlines in [start, end) */
+        if (start < end) {
+            on_delta[start] += work;
+            on_end[end] += work;
+        }
+    }
+
+    t_cutline_work out;
+    out.total_before.resize(num_cutlines);
+    out.total_after.resize(num_cutlines);
+    out.total_on.resize(num_cutlines);
+
+    size_t before = 0, on = 0;
+    for (size_t c = 0; c < num_cutlines; c++) {
+        before += ends_at[c];
+        on += on_delta[c];
+        on -= on_end[c];
+        out.total_before[c] = before;
+        out.total_on[c] = on;
+    }
+    size_t after = 0;
+    for (size_t c = num_cutlines; c-- > 0;) {
+        after += starts_at[c + 1];
+        out.total_after[c] = after;
+    }
+    return out;
+}
+
+PartitionTree::PartitionTree(const Netlist<>& netlist)
+    : PartitionTree(netlist, estimate_net_work(netlist), std::numeric_limits<size_t>::max()) {}
+
+PartitionTree::PartitionTree(const Netlist<>& netlist, const vtr::vector<ParentNetId, size_t>& net_work, size_t max_leaf_work) {
     const auto& device_ctx = g_vpr_ctx.device();
 
     auto all_nets = std::vector<ParentNetId>(netlist.nets().begin(), netlist.nets().end());
-    _root = build_helper(netlist, all_nets, 0, 0, device_ctx.grid.width() - 1, device_ctx.grid.height() - 1);
+    _root = build_helper(netlist, net_work, max_leaf_work, all_nets, 0, 0, device_ctx.grid.width() - 1, device_ctx.grid.height() - 1);
 }
 
-std::unique_ptr<PartitionTreeNode> PartitionTree::build_helper(const Netlist<>& netlist, const std::vector<ParentNetId>& nets, int x1, int y1, int x2, int y2) {
+std::unique_ptr<PartitionTreeNode> PartitionTree::build_helper(const Netlist<>& netlist, const vtr::vector<ParentNetId, size_t>& net_work, size_t max_leaf_work, const std::vector<ParentNetId>& nets, int x1, int y1, int x2, int y2) {
     if (nets.empty())
         return nullptr;
 
     const auto& route_ctx = g_vpr_ctx.routing();
     auto out = std::make_unique<PartitionTreeNode>();
 
-    if (nets.size() < MIN_NETS_TO_PARTITION) {
+    for (auto net_id : nets)
+        out->work += net_work[net_id];
+
+    /* Small partitions aren't worth cutting further, unless they would become a straggler task */
+    if (nets.size() < MIN_NETS_TO_PARTITION && out->work <= max_leaf_work) {
         out->nets = nets;
         return out;
     }
 
     /* Build ParaDRo-ish prefix sum lookup for each bin (coordinate) in the device.
      * Do this for every step with only given nets, because each cutline takes some nets out
-     * of the game, so if we just built a global lookup it wouldn't yield accurate results.
-     *
-     * VPR's bounding boxes include the borders (see ConnectionRouter::timing_driven_expand_neighbour())
-     * so try to include x=bb.xmax, y=bb.ymax etc. when calculating things. */
+     * of the game, so if we just built a global lookup it wouldn't yield accurate results. */
     int width = x2 - x1 + 1;
     int height = y2 - y1 + 1;
 
-    VTR_ASSERT(width > 1 && height > 1);
-    /* Cutlines are placed between integral coordinates.
-     * For instance, x_total_before[0] assumes a cutline at x=0.5, so fanouts at x=0 are included but not
-     * x=1. It's similar for x_total_after[0], which excludes fanouts at x=0 and includes x=1.
-     * Note that we have W-1 possible cutlines for a W-wide box.
-     *
-     * Here, *_total_before holds total score of nets before the cutline and not intersecting it.
-     * In ParaDRo this would be total_before + total_on. (same for total_after)*/
-    std::vector<int> x_total_before(width - 1, 0), x_total_after(width - 1, 0), x_total_on(width - 1, 0);
-    std::vector<int> y_total_before(height - 1, 0), y_total_after(height - 1, 0), y_total_on(height - 1, 0);
+    VTR_ASSERT(width > 0 && height > 0);
+    t_cutline_work x_work = sum_cutline_work(nets, net_work, Axis::X, x1, x2);
+    t_cutline_work y_work = sum_cutline_work(nets, net_work, Axis::Y, y1, y2);
 
-    for (auto net_id : nets) {
-        t_bb bb = route_ctx.route_bb[net_id];
-        size_t fanouts = netlist.net_sinks(net_id).size();
-
-        /* Inclusive start and end coords of the bbox relative to x1. Clamp to [x1, x2]. */
-        int x_start = std::max(x1, bb.xmin) - x1;
-        int x_end = std::min(bb.xmax, x2) - x1;
-        /* Fill in the lookups assuming a cutline at x + 0.5.
-         * This means total_before includes the max coord of the bbox but
-         * total_after does not include the min coord. */
-        for (int x = x_end; x < width - 1; x++) {
-            x_total_before[x] += fanouts;
-        }
-        for (int x = 0; x < x_start; x++) {
-            x_total_after[x] += fanouts;
-        }
-        for (int x = x_start; x < x_end; x++) {
-            x_total_on[x] += fanouts;
-        }
-        int y_start = std::max(y1, bb.ymin) - y1;
-        int y_end = std::min(bb.ymax, y2) - y1;
-        for (int y = y_end; y < height - 1; y++) {
-            y_total_before[y] += fanouts;
-        }
-        for (int y = 0; y < y_start; y++) {
-            y_total_after[y] += fanouts;
-        }
-        for (int y = y_start; y < y_end; y++) {
-            y_total_on[y] += fanouts;
-        }
-    }
-
-    int best_score = std::numeric_limits<int>::max();
+    size_t best_score = std::numeric_limits<size_t>::max();
     float best_pos = std::numeric_limits<double>::quiet_NaN();
     Axis best_axis = Axis::X;
 
     for (int x = 0; x < width - 1; x++) {
-        int before = x_total_before[x];
-        int after = x_total_after[x];
+        size_t before = x_work.total_before[x];
+        size_t after = x_work.total_after[x];
         if (before == 0 || after == 0) /* Cutting here would leave no nets to the left or right */
             continue;
         /* Now get a measure of "critical path": work on cutline + max(work on sides) */
-        int score = x_total_on[x] + std::max(x_total_before[x], x_total_after[x]);
-        // int score = std::abs(int(x_total_before[x]) - int(x_total_after[x]));
+        size_t score = x_work.total_on[x] + std::max(before, after);
         if (score < best_score) {
             best_score = score;
             best_pos = x1 + x + 0.5; /* Lookups are relative to (x1, y1) */
@@ -98,12 +154,11 @@ std::unique_ptr<PartitionTreeNode> PartitionTree::build_helper(const Netlist<>&
     }
 
     for (int y = 0; y < height - 1; y++) {
-        int before = y_total_before[y];
-        int after = y_total_after[y];
+        size_t before = y_work.total_before[y];
+        size_t after = y_work.total_after[y];
         if (before == 0 || after == 0) /* Cutting here would leave no nets to the left or right (sideways) */
             continue;
-        int score = y_total_on[y] + std::max(y_total_before[y], y_total_after[y]);
-        // int score = std::abs(int(y_total_before[y]) - int(y_total_after[y]));
+        size_t score = y_work.total_on[y] + std::max(before, after);
         if (score < best_score) {
             best_score = score;
             best_pos = y1 + y + 0.5; /* Lookups are relative to (x1, y1) */
@@ -132,8 +187,9 @@ std::unique_ptr<PartitionTreeNode> PartitionTree::build_helper(const Netlist<>&
             }
         }
 
-        out->left = build_helper(netlist, left_nets, x1, y1, std::floor(best_pos), y2);
-        out->right = build_helper(netlist, right_nets, std::floor(best_pos + 1), y1, x2, y2);
+        build_children(*out, netlist, net_work, max_leaf_work, left_nets, right_nets,
+                       {x1, y1, int(std::floor(best_pos)), y2},
+                       {int(std::floor(best_pos + 1)), y1, x2, y2});
     } else {
         VTR_ASSERT(best_axis == Axis::Y);
         for (auto net_id : nets) {
@@ -147,8 +203,9 @@ std::unique_ptr<PartitionTreeNode> PartitionTree::build_helper(const Netlist<>&
             }
         }
 
-        out->left = build_helper(netlist, left_nets, x1, y1, x2, std::floor(best_pos));
-        out->right = build_helper(netlist, right_nets, x1, std::floor(best_pos + 1), x2, y2);
+        build_children(*out, netlist, net_work, max_leaf_work, left_nets, right_nets,
+                       {x1, y1, x2, int(std::floor(best_pos))},
+                       {x1, int(std::floor(best_pos + 1)), x2, y2});
     }
 
     out->nets = my_nets;
@@ -156,3 +213,31 @@ std::unique_ptr<PartitionTreeNode> PartitionTree::build_helper(const Netlist<>&
     out->cutline_pos = best_pos;
     return out;
 }
+
+void PartitionTree::build_children(PartitionTreeNode& node, const Netlist<>& netlist, const vtr::vector<ParentNetId, size_t>& net_work, size_t max_leaf_work, const std::vector<ParentNetId>& left_nets, const std::vector<ParentNetId>& right_nets, const t_region& left_region, const t_region& right_region) {
+    auto build_left = [&]() {
+        node.left = build_helper(netlist, net_work, max_leaf_work, left_nets, left_region.x1, left_region.y1, left_region.x2, left_region.y2);
+    };
+    auto build_right = [&]() {
+        node.right = build_helper(netlist, net_work, max_leaf_work, right_nets, right_region.x1, right_region.y1, right_region.x2, right_region.y2);
+    };
+
+#ifdef VPR_USE_TBB
+    /* The subtrees only read the routing context, so they can be built concurrently */
+    if (left_nets.size() + right_nets.size() >= MIN_NETS_TO_BUILD_IN_PARALLEL) {
+        tbb::parallel_invoke(build_left, build_right);
+        return;
+    }
+#endif
+    build_left();
+    build_right();
+}
+
+float partition_tree_critical_path_sec(const PartitionTreeNode& node) {
+    float subtree_sec = 0.;
+    if (node.left)
+        subtree_sec = std::max(subtree_sec, partition_tree_critical_path_sec(*node.left));
+    if (node.right)
+        subtree_sec = std::max(subtree_sec, partition_tree_critical_path_sec(*node.right));
+    return node.route_sec + subtree_sec;
+}
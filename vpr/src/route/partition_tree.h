@@ -66,8 +66,15 @@ class PartitionTreeNode {
     float cutline_pos = std::numeric_limits<float>::quiet_NaN();
     /* Bounding box of *this* node. (The cutline cuts this box) */
     t_bb bb;
+    /* Estimated work to route the nets in this node and all of its subtrees */
+    size_t work = 0;
+    /* Wall time it took to route the nets in this node (not its subtrees) */
+    float route_sec = 0.;
 };
 
+/** Longest chain of PartitionTreeNode::route_sec from \p node to a leaf */
+float partition_tree_critical_path_sec(const PartitionTreeNode& node);
+
 /** Holds the root PartitionTreeNode and exposes top level operations. */
 class PartitionTree {
   public:
@@ -77,15 +84,28 @@ class PartitionTree {
     PartitionTree& operator=(const PartitionTree&) = delete;
     PartitionTree& operator=(PartitionTree&&) = default;
 
-    /** Can only be built from a netlist */
+    /** Can only be built from a netlist. The work of routing a net is estimated by its fanout
+     * times the area of its bounding box. */
     PartitionTree(const Netlist<>& netlist);
 
+    /** Build from a netlist with a given estimate of the work needed to route each net.
+     * Nodes with more than \p max_leaf_work estimated work are partitioned further even if they
+     * have few nets, so that a handful of heavy nets don't make a single straggler task. */
+    PartitionTree(const Netlist<>& netlist, const vtr::vector<ParentNetId, size_t>& net_work, size_t max_leaf_work);
+
     /** Access root. Shouldn't cause a segfault, because PartitionTree constructor always makes a _root */
     inline PartitionTreeNode& root(void) { return *_root; }
 
   private:
+    /** Inclusive bounds of a region of the device */
+    struct t_region {
+        int x1, y1, x2, y2;
+    };
+
     std::unique_ptr<PartitionTreeNode> _root;
-    std::unique_ptr<PartitionTreeNode> build_helper(const Netlist<>& netlist, const std::vector<ParentNetId>& nets, int x1, int y1, int x2, int y2);
+    /** Build the left and right subtrees of \p node (concurrently if they're large enough) */
+    void build_children(PartitionTreeNode& node, const Netlist<>& netlist, const vtr::vector<ParentNetId, size_t>& net_work, size_t max_leaf_work, const std::vector<ParentNetId>& left_nets, const std::vector<ParentNetId>& right_nets, const t_region& left_region, const t_region& right_region);
+    std::unique_ptr<PartitionTreeNode> build_helper(const Netlist<>& netlist, const vtr::vector<ParentNetId, size_t>& net_work, size_t max_leaf_work, const std::vector<ParentNetId>& nets, int x1, int y1, int x2, int y2);
 };
 
 #ifdef VPR_DEBUG_PARTITION_TREE
@@ -0,0 +1,267 @@
+#include "radix_heap.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "rr_graph_fwd.h"
+#include "vtr_assert.h"
+#include "vtr_log.h"
+
+// Maps a cost to a key with the same order: the bits of a non-negative float
+// already sort like unsigned integers, and flipping them sorts negative floats.
+static uint32_t cost_key(float cost) {
+    static_assert(sizeof(float) == sizeof(uint32_t));
+    uint32_t bits;
+    std::memcpy(&bits, &cost, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+RadixHeap::RadixHeap()
+    : non_empty_buckets_(0)
+    , num_bucket_items_(0)
+    , last_key_(0)
+    , max_index_(std::numeric_limits<size_t>::max())
+    , prune_limit_(std::numeric_limits<size_t>::max()) {}
+
+RadixHeap::~RadixHeap() {
+    free_all_memory();
+}
+
+t_heap* RadixHeap::alloc() {
+    return storage_.alloc();
+}
+void RadixHeap::free(t_heap* hptr) {
+    storage_.free(hptr);
+}
+
+void RadixHeap::init_heap(const DeviceGrid& /*grid*/) {
+    // The buckets grow as needed, and keep their capacity between connections
+    for (auto& bucket : buckets_)
+        bucket.clear();
+    overflow_.clear();
+    non_empty_buckets_ = 0;
+    num_bucket_items_ = 0;
+    last_key_ = 0;
+}
+
+// orders the overflow binary heap (std::push_heap builds max-heaps)
+bool RadixHeap::greater_key(const HeapNode& lhs, const HeapNode& rhs) {
+    return lhs.key > rhs.key;
+}
+
+size_t RadixHeap::size() const { return num_bucket_items_ + overflow_.size(); }
+
+// returns the bucket of key: 0 if it is last_key_, and otherwise one more than
+// the highest bit in which they differ
+size_t RadixHeap::bucket_index(uint32_t key) const {
+    uint32_t diff = key ^ last_key_;
+    return diff == 0 ? 0 : 32 - __builtin_clz(diff);
+}
+
+void RadixHeap::insert(HeapNode node) {
+    if (num_bucket_items_ == 0 && overflow_.empty()) {
+        // Nothing to stay monotone with: restart the buckets from this key
+        last_key_ = node.key;
+    }
+
+    if (node.key < last_key_) {
+        // Below the keys already popped (an inconsistent lookahead): cheaper
+        // than all the items of the buckets, so it is kept apart
+        overflow_.push_back(node);
+        std::push_heap(overflow_.begin(), overflow_.end(), greater_key);
+        return;
+    }
+
+    size_t ibucket = bucket_index(node.key);
+    buckets_[ibucket].push_back(node);
+    non_empty_buckets_ |= uint64_t(1) << ibucket;
+    ++num_bucket_items_;
+}
+
+void RadixHeap::add_to_heap(t_heap* hptr) {
+    insert({cost_key(hptr->cost), hptr});
+
+    check_prune_limit();
+}
+
+// items are inserted directly into their buckets: there is no heap property to restore
+void RadixHeap::push_back(t_heap* const hptr) {
+    add_to_heap(hptr);
+}
+
+void RadixHeap::build_heap() {}
+
+bool RadixHeap::is_empty_heap() const {
+    return size() == 0;
+}
+
+// Moves the cheapest items of the buckets to (the empty) bucket 0
+void RadixHeap::refill_first_bucket() {
+    VTR_ASSERT_SAFE(buckets_[0].empty() && num_bucket_items_ > 0);
+
+    size_t ibucket = __builtin_ctzll(non_empty_buckets_);
+    std::vector<HeapNode> items;
+    std::swap(items, buckets_[ibucket]);
+    non_empty_buckets_ &= ~(uint64_t(1) << ibucket);
+
+    last_key_ = std::min_element(items.begin(), items.end(), [](const HeapNode& lhs, const HeapNode& rhs) {
+                    return lhs.key < rhs.key;
+                })->key;
+
+    // All the items share the bits above ibucket - 1 with the new last_key_,
+    // so they all go to lower buckets
+    for (const HeapNode& node : items) {
+        size_t inew_bucket = bucket_index(node.key);
+        VTR_ASSERT_SAFE(inew_bucket < ibucket);
+        buckets_[inew_bucket].push_back(node);
+        non_empty_buckets_ |= uint64_t(1) << inew_bucket;
+    }
+
+    // Give the (now empty) storage back to the bucket to avoid reallocating it
+    items.clear();
+    std::swap(items, buckets_[ibucket]);
+}
+
+t_heap* RadixHeap::get_heap_head() {
+    /* Returns a pointer to the smallest element on the heap, or NULL if the     *
+     * heap is empty.  Invalid (index == OPEN) entries on the heap are never     *
+     * returned -- they are just skipped over.                                   */
+
+    t_heap* cheapest;
+
+    do {
+        if (is_empty_heap()) {
+            VTR_LOG_WARN("Empty heap occurred in get_heap_head.\n");
+            return (nullptr);
+        }
+
+        if (!overflow_.empty()) {
+            // All the overflow items are below last_key_, and so cheaper than any bucket item
+            std::pop_heap(overflow_.begin(), overflow_.end(), greater_key);
+            cheapest = overflow_.back().item;
+            overflow_.pop_back();
+        } else {
+            if (buckets_[0].empty()) {
+                refill_first_bucket();
+            }
+            cheapest = buckets_[0].back().item;
+            buckets_[0].pop_back();
+            if (buckets_[0].empty()) {
+                non_empty_buckets_ &= ~uint64_t(1);
+            }
+            --num_bucket_items_;
+        }
+    } while (!cheapest->index.is_valid()); /* Get another one if invalid entry. */
+
+    return (cheapest);
+}
+
+void RadixHeap::empty_heap() {
+    for (auto& bucket : buckets_) {
+        for (const HeapNode& node : bucket)
+            free(node.item);
+        bucket.clear();
+    }
+    for (const HeapNode& node : overflow_)
+        free(node.item);
+    overflow_.clear();
+
+    non_empty_buckets_ = 0;
+    num_bucket_items_ = 0;
+    last_key_ = 0;
+}
+
+void RadixHeap::set_prune_limit(size_t max_index, size_t prune_limit) {
+    if (prune_limit != std::numeric_limits<size_t>::max()) {
+        VTR_ASSERT(max_index < prune_limit);
+    }
+    max_index_ = max_index;
+    prune_limit_ = prune_limit;
+}
+
+bool RadixHeap::is_valid() const {
+    size_t num_bucket_items = 0;
+    for (size_t ibucket = 0; ibucket < NUM_BUCKETS; ++ibucket) {
+        const auto& bucket = buckets_[ibucket];
+        if (bucket.empty() == bool(non_empty_buckets_ & (uint64_t(1) << ibucket))) return false;
+        for (const HeapNode& node : bucket) {
+            if (bucket_index(node.key) != ibucket) return false;
+            if (node.key != cost_key(node.item->cost)) return false;
+        }
+        num_bucket_items += bucket.size();
+    }
+    if (num_bucket_items != num_bucket_items_) return false;
+
+    for (const HeapNode& node : overflow_) {
+        if (node.key >= last_key_) return false;
+        if (node.key != cost_key(node.item->cost)) return false;
+    }
+    return std::is_heap(overflow_.begin(), overflow_.end(), greater_key);
+}
+
+void RadixHeap::free_all_memory() {
+    empty_heap();
+
+    for (auto& bucket : buckets_)
+        std::vector<HeapNode>().swap(bucket);
+    std::vector<HeapNode>().swap(overflow_);
+
+    storage_.free_all_memory();
+}
+
+bool RadixHeap::check_prune_limit() {
+    if (size() > prune_limit_) {
+        prune_heap();
+        return true;
+    }
+
+    return false;
+}
+
+void RadixHeap::prune_heap() {
+    VTR_ASSERT(max_index_ < prune_limit_);
+
+    std::vector<HeapNode> nodes;
+    nodes.reserve(size());
+    for (auto& bucket : buckets_) {
+        nodes.insert(nodes.end(), bucket.begin(), bucket.end());
+        bucket.clear();
+    }
+    nodes.insert(nodes.end(), overflow_.begin(), overflow_.end());
+    overflow_.clear();
+    non_empty_buckets_ = 0;
+    num_bucket_items_ = 0;
+
+    std::vector<t_heap*> best_heap_item(max_index_, nullptr);
+
+    // Find the cheapest instance of each index and store it.
+    for (HeapNode& node : nodes) {
+        if (!node.item->index.is_valid()) {
+            free(node.item);
+            node.item = nullptr;
+            continue;
+        }
+
+        auto idx = size_t(node.item->index);
+
+        VTR_ASSERT(idx < max_index_);
+
+        if (best_heap_item[idx] == nullptr || best_heap_item[idx]->cost > node.item->cost) {
+            best_heap_item[idx] = node.item;
+        }
+    }
+
+    // Free unused nodes, and re-insert the others
+    for (const HeapNode& node : nodes) {
+        if (node.item == nullptr) {
+            continue;
+        }
+
+        if (best_heap_item[size_t(node.item->index)] != node.item) {
+            free(node.item);
+        } else {
+            insert(node);
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef _RADIX_HEAP_H
+#define _RADIX_HEAP_H
+
+#include "heap_type.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief An exact radix heap (monotone bucket queue) exploiting that the router pops near-monotone costs.
+ *
+ * Costs are mapped to order preserving 32-bit keys. Every item whose key is at least the key
+ * last popped (last_key_) lives in the bucket given by the highest bit in which its key differs
+ * from last_key_: bucket 0 holds the items equal to last_key_, and bucket b (1..32) those which
+ * differ from it first in bit b-1. Popping takes any item from bucket 0; once it is empty, the
+ * minimum of the first non-empty bucket becomes the new last_key_ and the items of that bucket
+ * are redistributed into lower buckets. Each item therefore moves at most 32 times, and pushes
+ * are O(1) without any comparison.
+ *
+ * Unlike Bucket (BUCKET_HEAP_APPROXIMATION), which quantizes the costs, items are popped in
+ * exact cost order. The A* costs popped by the router are only nearly monotone (the lookahead
+ * is not consistent), so items pushed below last_key_ go to a small exact binary heap
+ * (overflow_): they are all cheaper than any item of the buckets, and are popped first.
+ */
+class RadixHeap : public HeapInterface {
+  public:
+    RadixHeap();
+    ~RadixHeap();
+
+    t_heap* alloc() final;
+    void free(t_heap* hptr) final;
+
+    void init_heap(const DeviceGrid& grid) final;
+    void add_to_heap(t_heap* hptr) final;
+    void push_back(t_heap* const hptr) final;
+    bool is_empty_heap() const final;
+    bool is_valid() const final;
+    void empty_heap() final;
+    t_heap* get_heap_head() final;
+    void build_heap() final;
+    void set_prune_limit(size_t max_index, size_t prune_limit) final;
+
+    void free_all_memory() final;
+
+  private:
+    // An item with its key inline, so that redistributing a bucket never
+    // dereferences the items
+    struct HeapNode {
+        uint32_t key;
+        t_heap* item;
+    };
+
+    static constexpr size_t NUM_BUCKETS = 33;
+
+    static bool greater_key(const HeapNode& lhs, const HeapNode& rhs);
+
+    size_t size() const;
+    size_t bucket_index(uint32_t key) const;
+    void insert(HeapNode node);
+    void refill_first_bucket();
+    bool check_prune_limit();
+    void prune_heap();
+
+    HeapStorage storage_;
+
+    std::vector<HeapNode> buckets_[NUM_BUCKETS];
+    uint64_t non_empty_buckets_; /* Bit b is set if buckets_[b] is not empty */
+    size_t num_bucket_items_;
+    uint32_t last_key_; /* Key last moved to bucket 0: a lower bound of the keys of the buckets */
+
+    std::vector<HeapNode> overflow_; /* Binary min-heap of the items pushed below last_key_ */
+
+    size_t max_index_;
+    size_t prune_limit_;
+};
+
+#endif /* _RADIX_HEAP_H */
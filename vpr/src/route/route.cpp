@@ -1,6 +1,8 @@
 #include "concrete_timing_info.h"
 #include "connection_based_routing.h"
 #include "draw.h"
+#include "eco.h"
+#include "global_route.h"
 #include "netlist_routers.h"
 #include "place_and_route.h"
 #include "read_route.h"
@@ -11,6 +13,13 @@
 #include "route_profiling.h"
 #include "route_utils.h"
 #include "vtr_time.h"
+#include "vtr_profiler_markers.h"
+#include "vtr_trace.h"
+#include "progressupdate.h"
+
+#ifdef VPR_USE_TBB
+#    include <tbb/task_group.h>
+#endif
 
 bool route(const Netlist<>& net_list,
            int width_fac,
@@ -68,6 +77,8 @@ bool route(const Netlist<>& net_list,
 
     /* Allocate and load additional rr_graph information needed only by the router. */
     alloc_and_load_rr_node_route_structs();
+    if (router_opts.bidir_search_min_dist >= 0)
+        route_ctx.rr_reverse_edges.build(device_ctx.rr_graph.rr_nodes());
 
     init_route_structs(net_list,
                        router_opts.bb_factor,
@@ -123,8 +134,10 @@ bool route(const Netlist<>& net_list,
     // This needs to be called before filling intra-cluster lookahead maps to ensure that the intra-cluster lookahead maps are initialized.
     const RouterLookahead* router_lookahead = get_cached_router_lookahead(*det_routing_arch,
                                                                           router_opts.lookahead_type,
+                                                                          router_opts.router_lookahead_half_precision,
                                                                           router_opts.write_router_lookahead,
                                                                           router_opts.read_router_lookahead,
+                                                                          router_opts.router_lookahead_cache_dir,
                                                                           segment_inf,
                                                                           is_flat);
 
@@ -135,16 +148,20 @@ bool route(const Netlist<>& net_list,
         std::unique_ptr<RouterLookahead> mut_router_lookahead(route_ctx.cached_router_lookahead_.release());
         VTR_ASSERT(mut_router_lookahead);
         route_ctx.cached_router_lookahead_.clear();
-        if (!router_opts.read_intra_cluster_router_lookahead.empty()) {
-            mut_router_lookahead->read_intra_cluster(router_opts.read_intra_cluster_router_lookahead);
-        } else {
-            mut_router_lookahead->compute_intra_tile();
-        }
+        load_intra_cluster_router_lookahead(*mut_router_lookahead,
+                                            *det_routing_arch,
+                                            router_opts.lookahead_type,
+                                            router_opts.router_lookahead_half_precision,
+                                            router_opts.read_intra_cluster_router_lookahead,
+                                            router_opts.router_lookahead_cache_dir,
+                                            segment_inf);
         route_ctx.cached_router_lookahead_.set(cache_key, std::move(mut_router_lookahead));
         router_lookahead = get_cached_router_lookahead(*det_routing_arch,
                                                        router_opts.lookahead_type,
+                                                       router_opts.router_lookahead_half_precision,
                                                        router_opts.write_router_lookahead,
                                                        router_opts.read_router_lookahead,
+                                                       router_opts.router_lookahead_cache_dir,
                                                        segment_inf,
                                                        is_flat);
         if (!router_opts.write_intra_cluster_router_lookahead.empty()) {
@@ -221,6 +238,16 @@ bool route(const Netlist<>& net_list,
         choking_spots,
         is_flat);
 
+    if (router_opts.global_route_prepass) {
+        // Tightens route_ctx.route_bb and seeds the history costs, so it goes after init_route_structs()
+        global_route_prepass(net_list, route_ctx.route_bb);
+    }
+
+    if (!router_opts.eco_route_file.empty()) {
+        // Starts the unchanged nets from their previous routing: the router only reroutes them if they get congested
+        load_eco_routing(net_list, router_opts.eco_route_file.c_str(), net_delay, timing_info.get(), pin_timing_invalidator.get());
+    }
+
     RouterStats router_stats;
     float prev_iter_cumm_time = 0;
     vtr::Timer iteration_timer;
@@ -241,6 +268,9 @@ bool route(const Netlist<>& net_list,
 
     print_route_status_header();
     for (itry = 1; itry <= router_opts.max_router_iterations; ++itry) {
+        vtr::ScopedTraceSpan iteration_trace_span("Routing iteration");
+        VTR_PROFILE_SCOPE_ARG(route_iteration, itry);
+
         /* Reset "is_routed" and "is_fixed" flags to indicate nets not pre-routed (yet) */
         for (auto net_id : net_list.nets()) {
             route_ctx.net_status.set_is_routed(net_id, false);
@@ -270,6 +300,21 @@ bool route(const Netlist<>& net_list,
             return false;
         }
 
+        //Update timing based on the new routing
+        //Note that the net delays have already been updated by timing_driven_route_net
+        //
+        //The timing analysis only depends on the net delays, so it can optionally run
+        //concurrently with the congestion bookkeeping below, which only touches the
+        //routing resource state
+#ifdef VPR_USE_TBB
+        tbb::task_group timing_update_group;
+        if (router_opts.overlap_timing_update) {
+            timing_update_group.run([&]() {
+                timing_info->update();
+            });
+        }
+#endif
+
         // Make sure any CLB OPINs used up by subblocks being hooked directly to them are reserved for that purpose
         bool rip_up_local_opins = (itry == 1 ? false : true);
         if (!is_flat) {
@@ -282,6 +327,7 @@ bool route(const Netlist<>& net_list,
          */
         bool routing_is_feasible = feasible_routing();
         float est_success_iteration = routing_predictor.estimate_success_iteration();
+        float est_early_success_iteration = routing_predictor.estimate_early_success_iteration();
 
         //Update resource costs and overuse info
         if (itry == 1) {
@@ -293,9 +339,15 @@ bool route(const Netlist<>& net_list,
         wirelength_info = calculate_wirelength_info(net_list, available_wirelength);
         routing_predictor.add_iteration_overuse(itry, overuse_info.overused_nodes);
 
-        //Update timing based on the new routing
-        //Note that the net delays have already been updated by timing_driven_route_net
+#ifdef VPR_USE_TBB
+        if (router_opts.overlap_timing_update) {
+            timing_update_group.wait();
+        } else {
+            timing_info->update();
+        }
+#else
         timing_info->update();
+#endif
         timing_info->set_warn_unconstrained(false); //Don't warn again about unconstrained nodes again during routing
         pin_timing_invalidator->reset();
 
@@ -312,6 +364,9 @@ bool route(const Netlist<>& net_list,
 
         //Output progress
         print_route_status(itry, iter_elapsed_time, pres_fac, num_net_bounding_boxes_updated, iter_results.stats, overuse_info, wirelength_info, timing_info, est_success_iteration);
+#ifndef NO_SERVER
+        server::update_routing_progress(itry, iter_elapsed_time, pres_fac, iter_results.stats, overuse_info, wirelength_info, critical_path.delay());
+#endif /* NO_SERVER */
 
         prev_iter_cumm_time = iter_cumm_time;
 
@@ -327,6 +382,27 @@ bool route(const Netlist<>& net_list,
             print_route(net_list, nullptr, filename.c_str(), is_flat);
         }
 
+        if (vtr::trace_enabled()) {
+            vtr::trace_counter("Router heap pushes", iter_results.stats.heap_pushes);
+            vtr::trace_counter("Router heap pops", iter_results.stats.heap_pops);
+            vtr::trace_counter("Router connections routed", iter_results.stats.connections_routed);
+            vtr::trace_counter("Router overused nodes", overuse_info.overused_nodes);
+            const RouterProfile& profile = iter_results.stats.profile;
+            if (profile.connections > 0) {
+                vtr::trace_counter("Router expansions per connection", double(profile.sink_expansions) / profile.connections);
+                vtr::trace_counter("Router path nodes per connection", double(profile.path_nodes) / profile.connections);
+            }
+            if (!iter_results.load_balance.thread_busy_sec.empty()) {
+                vtr::trace_counter("Router thread utilization", iter_results.load_balance.utilization());
+                vtr::trace_counter("Router partition tree root sec", iter_results.load_balance.root_sec);
+                vtr::trace_counter("Router partition tree critical path sec", iter_results.load_balance.critical_path_sec);
+            }
+        }
+
+        if (router_opts.report_parallel_route_load_balance) {
+            print_route_load_balance(itry, iter_results.load_balance);
+        }
+
         //Update router stats (total)
         router_stats.combine(iter_results.stats);
 
@@ -410,6 +486,18 @@ bool route(const Netlist<>& net_list,
                 VTR_LOG("Routing aborted, the predicted iteration for a successful route (%.1f) is too high.\n", est_success_iteration);
 #ifndef NO_GRAPHICS
                 update_router_info_and_check_bp(BP_ROUTE_ITER, -1);
+#endif
+                break; //Abort
+            }
+
+            //Before there is enough history for the estimate above, give up on clearly unroutable
+            //problems (e.g. too narrow channels in the minimum channel width search) using the
+            //early estimate, with a budget which starts loose and tightens each iteration
+            float early_abort_iteration_threshold = abort_iteration_threshold * float(routing_predictor.min_history()) / (itry - 1);
+            if (!std::isnan(est_early_success_iteration) && est_early_success_iteration > early_abort_iteration_threshold && router_opts.routing_budgets_algorithm != YOYO) {
+                VTR_LOG("Routing aborted, the early predicted iteration for a successful route (%.1f) is too high.\n", est_early_success_iteration);
+#ifndef NO_GRAPHICS
+                update_router_info_and_check_bp(BP_ROUTE_ITER, -1);
 #endif
                 break; //Abort
             }
@@ -600,6 +688,10 @@ bool route(const Netlist<>& net_list,
 #endif
     }
 
+    if (router_opts.report_router_profile) {
+        print_router_profile(router_stats.profile);
+    }
+
     if (router_opts.with_timing_analysis) {
         VTR_LOG("Final Net Connection Criticality Histogram:\n");
         print_router_criticality_histogram(net_list, *timing_info, netlist_pin_lookup, is_flat);
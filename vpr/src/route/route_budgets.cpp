@@ -52,6 +52,11 @@
 #include "route_budgets.h"
 #include "vtr_time.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/combinable.h>
+#    include <tbb/parallel_for_each.h>
+#endif
+
 #define SHORT_PATH_EXP 0.5
 
 route_budgets::route_budgets(const Netlist<>& net_list, bool is_flat)
@@ -124,6 +129,8 @@ void route_budgets::load_route_budgets(NetPinsMatrix<float>& net_delay,
      * or scale the delay by the criticality*/
 
     num_times_congested.resize(net_list_.nets().size(), 0);
+    should_reroute_for_hold.resize(net_list_.nets().size(), false);
+    incremental_sta_ = router_opts.timing_update_type != e_timing_update_type::FULL;
 
     /*if chosen to be disable, never set the budgets*/
     if (router_opts.routing_budgets_algorithm == DISABLE) {
@@ -190,6 +197,17 @@ void route_budgets::allocate_slack_using_weights(NetPinsMatrix<float>& net_delay
     unsigned iteration;
     float max_budget_change;
 
+    if (incremental_sta_) {
+        auto& atom_ctx = g_vpr_ctx.atom();
+        sta_invalidator_ = make_net_pin_timing_invalidator(e_timing_update_type::INCREMENTAL,
+                                                           net_list_,
+                                                           netlist_pin_lookup,
+                                                           atom_ctx.nlist,
+                                                           atom_ctx.lookup,
+                                                           *g_vpr_ctx.timing().graph,
+                                                           is_flat_);
+    }
+
     /*Preprocessing algorithm in order to consider short paths when setting initial maximum budgets.
      * Not necessary unless budgets are really hard to meet*/
     // process_negative_slack_using_minimax();
@@ -264,6 +282,9 @@ void route_budgets::allocate_slack_using_weights(NetPinsMatrix<float>& net_delay
     }
     /*budgets may go below minimum delay bound to optimize for setup time*/
     keep_budget_above_value(delay_min_budget, bottom_range);
+
+    sta_states_.clear();
+    sta_invalidator_.reset();
 }
 
 void route_budgets::process_negative_slack_using_minimax(NetPinsMatrix<float>& net_delay, const ClusteredPinAtomPinsLookup& netlist_pin_lookup) {
@@ -363,11 +384,11 @@ float route_budgets::minimax_PERT(std::shared_ptr<SetupHoldTimingInfo> orig_timi
      * The weights are deteremined by how much delay of the whole path is present in this connection*/
 
     std::shared_ptr<const tatum::SetupHoldTimingAnalyzer> timing_analyzer = orig_timing_info->setup_hold_analyzer();
-    float total_path_delay = 0;
-    float path_slack;
-    float hold_path_slack;
-    float max_budget_change = 0;
-    for (auto net_id : net_list_.nets()) {
+    /*The nets are independent, so they are processed in parallel*/
+    auto allocate_net_slack = [&](ParentNetId net_id, float& max_budget_change) {
+        float total_path_delay = 0;
+        float path_slack;
+        float hold_path_slack;
         for (auto pin_id : net_list_.net_sinks(net_id)) {
             int ipin = net_list_.pin_net_index(pin_id);
             AtomPinId atom_pin;
@@ -430,7 +451,20 @@ float route_budgets::minimax_PERT(std::shared_ptr<SetupHoldTimingInfo> orig_timi
                 should_reroute_for_hold[net_id] = true;
             }
         }
+    };
+
+#ifdef VPR_USE_TBB
+    tbb::combinable<float> thread_max_budget_change(0.);
+    tbb::parallel_for_each(net_list_.nets().begin(), net_list_.nets().end(), [&](ParentNetId net_id) {
+        allocate_net_slack(net_id, thread_max_budget_change.local());
+    });
+    float max_budget_change = thread_max_budget_change.combine([](float a, float b) { return std::max(a, b); });
+#else
+    float max_budget_change = 0;
+    for (auto net_id : net_list_.nets()) {
+        allocate_net_slack(net_id, max_budget_change);
     }
+#endif
     return max_budget_change;
 }
 
@@ -659,17 +693,40 @@ void route_budgets::check_if_budgets_in_bounds() {
 
 std::shared_ptr<SetupHoldTimingInfo> route_budgets::perform_sta(NetPinsMatrix<float>& temp_budgets) {
     auto& atom_ctx = g_vpr_ctx.atom();
+
+    auto iter = sta_states_.find(&temp_budgets);
+    if (iter != sta_states_.end()) {
+        /*Re-analyze only the connections whose delays changed since the last analysis of these delays*/
+        t_sta_state& state = iter->second;
+        for (auto net_id : net_list_.nets()) {
+            for (auto pin_id : net_list_.net_sinks(net_id)) {
+                int ipin = net_list_.pin_net_index(pin_id);
+                if (temp_budgets[net_id][ipin] != state.analyzed_delays[net_id][ipin]) {
+                    sta_invalidator_->invalidate_connection(pin_id, state.timing_info.get());
+                    state.analyzed_delays[net_id][ipin] = temp_budgets[net_id][ipin];
+                }
+            }
+        }
+        sta_invalidator_->reset();
+
+        state.timing_info->update();
+        return state.timing_info;
+    }
+
     /*Perform static timing analysis to get the delay and path weights for slack allocation*/
     std::shared_ptr<RoutingDelayCalculator> routing_delay_calc = std::make_shared<RoutingDelayCalculator>(atom_ctx.nlist, atom_ctx.lookup, temp_budgets, is_flat_);
 
-    //TODO: now that we support incremental timing updates, we should avoid re-building the timing analyzer from scratch and try
-    //      to calculate this incrementally
-    std::shared_ptr<SetupHoldTimingInfo> timing_info = make_setup_hold_timing_info(routing_delay_calc, e_timing_update_type::AUTO);
+    e_timing_update_type update_type = sta_invalidator_ ? e_timing_update_type::INCREMENTAL : e_timing_update_type::AUTO;
+    std::shared_ptr<SetupHoldTimingInfo> timing_info = make_setup_hold_timing_info(routing_delay_calc, update_type);
 
     /*Unconstrained nodes should be warned in the main routing function, do not report it here*/
     timing_info->set_warn_unconstrained(false);
     timing_info->update();
 
+    if (sta_invalidator_) {
+        sta_states_[&temp_budgets] = {timing_info, temp_budgets};
+    }
+
     return timing_info;
 }
 
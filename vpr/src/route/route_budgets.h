@@ -8,6 +8,7 @@
 #include <vector>
 #include <queue>
 #include "RoutingDelayCalculator.h"
+#include "NetPinTimingInvalidator.h"
 
 enum analysis_type {
     SETUP,
@@ -81,7 +82,7 @@ class route_budgets {
 
     void process_negative_slack_using_minimax(NetPinsMatrix<float>& net_delay, const ClusteredPinAtomPinsLookup& netlist_pin_lookup);
 
-    /*Perform static timing analysis*/
+    /*Perform static timing analysis (incrementally, if temp_budgets were analyzed before by the same slack allocation)*/
     std::shared_ptr<SetupHoldTimingInfo> perform_sta(NetPinsMatrix<float>& temp_budgets);
 
     /*checks*/
@@ -132,11 +133,23 @@ class route_budgets {
     const Netlist<>& net_list_;
     bool is_flat_;
 
+    /*The slack allocation repeatedly analyzes the timing of the same few delay matrices (the net
+     * delays and the budgets), changing only some of the connection delays between analyses. So the
+     * timing info of each matrix is kept, with the delays it was last analyzed with, and is updated
+     * incrementally by invalidating the connections whose delays changed since.*/
+    struct t_sta_state {
+        std::shared_ptr<SetupHoldTimingInfo> timing_info;
+        NetPinsMatrix<float> analyzed_delays;
+    };
+    bool incremental_sta_ = false;
+    std::unique_ptr<NetPinTimingInvalidator> sta_invalidator_;
+    std::map<const NetPinsMatrix<float>*, t_sta_state> sta_states_;
+
     /*budgets only valid when loaded*/
     bool set;
 
-    /*flag to reroute each net for hold violation*/
-    std::map<ParentNetId, bool> should_reroute_for_hold;
+    /*flag to reroute each net for hold violation (not a vector<bool>, since it is set in parallel)*/
+    vtr::vector<ParentNetId, uint8_t> should_reroute_for_hold;
     std::map<ParentNetId, int> hold_fac;
 };
 
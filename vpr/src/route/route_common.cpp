@@ -8,6 +8,12 @@
 #include "route_export.h"
 #include "rr_graph.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/blocked_range.h>
+#    include <tbb/parallel_for.h>
+#    include <tbb/parallel_reduce.h>
+#endif
+
 /*  The numbering relation between the channels and clbs is:				*
  *																	        *
  *  |    IO     | chan_   |   CLB     | chan_   |   CLB     |               *
@@ -57,6 +63,21 @@ static t_clb_opins_used alloc_and_load_clb_opins_used_locally();
 
 static void adjust_one_rr_occ_and_acc_cost(RRNodeId inode, int add_or_sub, float acc_fac);
 
+/* Number of rr nodes per task of the sweeps over the whole rr graph: large enough for the loops over
+ * contiguous nodes to amortize the scheduling, small enough to balance the load */
+static constexpr size_t RR_NODE_SWEEP_GRAIN = 16384;
+
+/* Overuse of a range of rr nodes (see OveruseInfo) */
+struct t_overuse_counts {
+    size_t overused_nodes = 0;
+    size_t total_overuse = 0;
+    size_t worst_overuse = 0;
+};
+
+static void update_acc_cost_of_node_range(size_t begin, size_t end, float acc_fac, t_overuse_counts& counts);
+
+static void reset_node_range_route_structs(size_t begin, size_t end);
+
 static vtr::vector<ParentNetId, uint8_t> load_is_clock_net(const Netlist<>& net_list,
                                                            bool is_flat);
 
@@ -124,7 +145,7 @@ bool feasible_routing() {
     auto& route_ctx = g_vpr_ctx.routing();
 
     for (const RRNodeId& rr_id : rr_graph.nodes()) {
-        if (route_ctx.rr_node_route_inf[rr_id].occ() > rr_graph.node_capacity(rr_id)) {
+        if (route_ctx.rr_node_cong_inf[rr_id].occ() > rr_graph.node_capacity(rr_id)) {
             return (false);
         }
     }
@@ -140,7 +161,7 @@ std::vector<RRNodeId> collect_congested_rr_nodes() {
 
     std::vector<RRNodeId> congested_rr_nodes;
     for (const RRNodeId inode : device_ctx.rr_graph.nodes()) {
-        short occ = route_ctx.rr_node_route_inf[inode].occ();
+        short occ = route_ctx.rr_node_cong_inf[inode].occ();
         short capacity = rr_graph.node_capacity(inode);
 
         if (occ > capacity) {
@@ -174,8 +195,7 @@ vtr::vector<RRNodeId, std::set<ClusterNetId>> collect_rr_node_nets() {
 void pathfinder_update_single_node_occupancy(RRNodeId inode, int add_or_sub) {
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    int occ = route_ctx.rr_node_route_inf[inode].occ() + add_or_sub;
-    route_ctx.rr_node_route_inf[inode].set_occ(occ);
+    int occ = route_ctx.rr_node_cong_inf[inode].add_occ(add_or_sub);
     // can't have negative occupancy
     VTR_ASSERT(occ >= 0);
 }
@@ -187,52 +207,50 @@ void pathfinder_update_single_node_occupancy(RRNodeId inode, int add_or_sub) {
  * THIS ROUTINE ASSUMES THE OCCUPANCY VALUES IN RR_NODE ARE UP TO DATE.
  * This routine also creates a new overuse info for the current routing iteration. */
 void pathfinder_update_acc_cost_and_overuse_info(float acc_fac, OveruseInfo& overuse_info) {
-    auto& device_ctx = g_vpr_ctx.device();
-    const auto& rr_graph = device_ctx.rr_graph;
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
+    size_t num_nodes = g_vpr_ctx.device().rr_graph.num_nodes();
 
 #ifdef VPR_USE_TBB
-    tbb::combinable<size_t> overused_nodes(0), total_overuse(0), worst_overuse(0);
-    tbb::parallel_for_each(rr_graph.nodes().begin(), rr_graph.nodes().end(), [&](RRNodeId rr_id) {
-        int overuse = route_ctx.rr_node_route_inf[rr_id].occ() - rr_graph.node_capacity(rr_id);
-
-        // If overused, update the acc_cost and add this node to the overuse info
-        // If not, do nothing
-        if (overuse > 0) {
-            route_ctx.rr_node_route_inf[rr_id].acc_cost += overuse * acc_fac;
-
-            ++overused_nodes.local();
-            total_overuse.local() += overuse;
-            worst_overuse.local() = std::max(worst_overuse.local(), size_t(overuse));
-        }
-    });
+    t_overuse_counts counts = tbb::parallel_reduce(
+        tbb::blocked_range<size_t>(0, num_nodes, RR_NODE_SWEEP_GRAIN), t_overuse_counts(),
+        [&](const tbb::blocked_range<size_t>& range, t_overuse_counts range_counts) {
+            update_acc_cost_of_node_range(range.begin(), range.end(), acc_fac, range_counts);
+            return range_counts;
+        },
+        [](t_overuse_counts lhs, const t_overuse_counts& rhs) {
+            lhs.overused_nodes += rhs.overused_nodes;
+            lhs.total_overuse += rhs.total_overuse;
+            lhs.worst_overuse = std::max(lhs.worst_overuse, rhs.worst_overuse);
+            return lhs;
+        });
+#else
+    t_overuse_counts counts;
+    update_acc_cost_of_node_range(0, num_nodes, acc_fac, counts);
+#endif
 
     // Update overuse info
-    overuse_info.overused_nodes = overused_nodes.combine(std::plus<size_t>());
-    overuse_info.total_overuse = total_overuse.combine(std::plus<size_t>());
-    overuse_info.worst_overuse = worst_overuse.combine([](size_t a, size_t b) { return std::max(a, b); });
-#else
-    size_t overused_nodes = 0, total_overuse = 0, worst_overuse = 0;
+    overuse_info.overused_nodes = counts.overused_nodes;
+    overuse_info.total_overuse = counts.total_overuse;
+    overuse_info.worst_overuse = counts.worst_overuse;
+}
 
-    for (const RRNodeId& rr_id : rr_graph.nodes()) {
-        int overuse = route_ctx.rr_node_route_inf[rr_id].occ() - rr_graph.node_capacity(rr_id);
+/** Adds the overuse times acc_fac to the acc_cost of the nodes [begin, end), and accumulates their overuse in counts */
+static void update_acc_cost_of_node_range(size_t begin, size_t end, float acc_fac, t_overuse_counts& counts) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+    t_rr_node_cong_inf* cong_inf = g_vpr_ctx.mutable_routing().rr_node_cong_inf.data();
+
+    for (size_t inode = begin; inode < end; ++inode) {
+        int overuse = cong_inf[inode].occ() - rr_graph.node_capacity(RRNodeId(inode));
 
         // If overused, update the acc_cost and add this node to the overuse info
         // If not, do nothing
         if (overuse > 0) {
-            route_ctx.rr_node_route_inf[rr_id].acc_cost += overuse * acc_fac;
+            cong_inf[inode].acc_cost += overuse * acc_fac;
 
-            ++overused_nodes;
-            total_overuse += overuse;
-            worst_overuse = std::max(worst_overuse, size_t(overuse));
+            ++counts.overused_nodes;
+            counts.total_overuse += overuse;
+            counts.worst_overuse = std::max(counts.worst_overuse, size_t(overuse));
         }
     }
-
-    // Update overuse info
-    overuse_info.overused_nodes = overused_nodes;
-    overuse_info.total_overuse = total_overuse;
-    overuse_info.worst_overuse = worst_overuse;
-#endif
 }
 
 /** Update pathfinder cost of all nodes rooted at rt_node, including rt_node itself */
@@ -262,6 +280,10 @@ void init_route_structs(const Netlist<>& net_list,
                                                        is_flat);
 
     route_ctx.is_clock_net = load_is_clock_net(net_list, is_flat);
+
+    //The bounding boxes of any previous routing are the only users of the stage arena
+    vtr::release_memory(route_ctx.route_bb);
+    route_ctx.stage_arena.release();
     route_ctx.route_bb = load_route_bb(net_list,
                                        bb_factor);
     route_ctx.rr_blk_source = load_rr_clb_sources(device_ctx.rr_graph,
@@ -278,18 +300,6 @@ void init_route_structs(const Netlist<>& net_list,
     }
 }
 
-/* The routine sets the path_cost to HUGE_POSITIVE_FLOAT for  *
- * all channel segments touched by previous routing phases.    */
-void reset_path_costs(const std::vector<RRNodeId>& visited_rr_nodes) {
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
-
-    for (auto node : visited_rr_nodes) {
-        route_ctx.rr_node_route_inf[node].path_cost = std::numeric_limits<float>::infinity();
-        route_ctx.rr_node_route_inf[node].backward_path_cost = std::numeric_limits<float>::infinity();
-        route_ctx.rr_node_route_inf[node].prev_edge = RREdgeId::INVALID();
-    }
-}
-
 /* Returns the congestion cost of using this rr-node plus that of any      *
  * non-configurably connected rr_nodes that must be used when it is used.  */
 float get_rr_cong_cost(RRNodeId inode, float pres_fac) {
@@ -383,10 +393,8 @@ static t_clb_opins_used alloc_and_load_clb_opins_used_locally() {
 void free_route_structs() {
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    if (route_ctx.route_bb.size() != 0) {
-        route_ctx.route_bb.clear();
-        route_ctx.route_bb.shrink_to_fit();
-    }
+    vtr::release_memory(route_ctx.route_bb);
+    route_ctx.stage_arena.release();
 }
 
 void alloc_and_load_rr_node_route_structs() {
@@ -397,6 +405,7 @@ void alloc_and_load_rr_node_route_structs() {
     auto& device_ctx = g_vpr_ctx.device();
 
     route_ctx.rr_node_route_inf.resize(device_ctx.rr_graph.num_nodes());
+    route_ctx.rr_node_cong_inf.resize(device_ctx.rr_graph.num_nodes());
     route_ctx.non_configurable_bitset.resize(device_ctx.rr_graph.num_nodes());
     route_ctx.non_configurable_bitset.fill(false);
 
@@ -415,15 +424,33 @@ void reset_rr_node_route_structs() {
     auto& device_ctx = g_vpr_ctx.device();
 
     VTR_ASSERT(route_ctx.rr_node_route_inf.size() == size_t(device_ctx.rr_graph.num_nodes()));
+    VTR_ASSERT(route_ctx.rr_node_cong_inf.size() == size_t(device_ctx.rr_graph.num_nodes()));
 
-    for (const RRNodeId& rr_id : device_ctx.rr_graph.nodes()) {
-        auto& node_inf = route_ctx.rr_node_route_inf[rr_id];
+    size_t num_nodes = device_ctx.rr_graph.num_nodes();
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_nodes, RR_NODE_SWEEP_GRAIN), [](const tbb::blocked_range<size_t>& range) {
+        reset_node_range_route_structs(range.begin(), range.end());
+    });
+#else
+    reset_node_range_route_structs(0, num_nodes);
+#endif
+}
 
-        node_inf.prev_edge = RREdgeId::INVALID();
-        node_inf.acc_cost = 1.0;
-        node_inf.path_cost = std::numeric_limits<float>::infinity();
-        node_inf.backward_path_cost = std::numeric_limits<float>::infinity();
-        node_inf.set_occ(0);
+/* Resets the route and congestion info of the rr nodes [begin, end) */
+static void reset_node_range_route_structs(size_t begin, size_t end) {
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
+    t_rr_node_route_inf* route_inf = route_ctx.rr_node_route_inf.data();
+    t_rr_node_cong_inf* cong_inf = route_ctx.rr_node_cong_inf.data();
+
+    t_rr_node_route_inf reset_route_inf;
+    reset_route_inf.prev_edge = RREdgeId::INVALID();
+    reset_route_inf.path_cost = std::numeric_limits<float>::infinity();
+    reset_route_inf.backward_path_cost = std::numeric_limits<float>::infinity();
+    std::fill(route_inf + begin, route_inf + end, reset_route_inf);
+
+    for (size_t inode = begin; inode < end; ++inode) {
+        cong_inf[inode].acc_cost = 1.0;
+        cong_inf[inode].set_occ(0);
     }
 }
 
@@ -600,11 +627,11 @@ static bool classes_in_same_block(ParentBlockId blk_id, int first_class_ptc_num,
     return classes_in_same_block(physical_tile, first_class_ptc_num, second_class_ptc_num, is_flat);
 }
 
-vtr::vector<ParentNetId, t_bb> load_route_bb(const Netlist<>& net_list,
-                                             int bb_factor) {
-    vtr::vector<ParentNetId, t_bb> route_bb;
+t_net_bb_vector load_route_bb(const Netlist<>& net_list,
+                              int bb_factor) {
+    auto& route_ctx = g_vpr_ctx.mutable_routing();
 
-    auto& route_ctx = g_vpr_ctx.routing();
+    t_net_bb_vector route_bb(vtr::arena_allocator<t_bb>(route_ctx.stage_arena));
 
     t_bb full_device_bounding_box;
     {
@@ -840,14 +867,14 @@ static void adjust_one_rr_occ_and_acc_cost(RRNodeId inode, int add_or_sub, float
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
 
-    int new_occ = route_ctx.rr_node_route_inf[inode].occ() + add_or_sub;
+    int new_occ = route_ctx.rr_node_cong_inf[inode].occ() + add_or_sub;
     int capacity = rr_graph.node_capacity(inode);
-    route_ctx.rr_node_route_inf[inode].set_occ(new_occ);
+    route_ctx.rr_node_cong_inf[inode].set_occ(new_occ);
 
     if (new_occ < capacity) {
     } else {
         if (add_or_sub == 1) {
-            route_ctx.rr_node_route_inf[inode].acc_cost += (new_occ - capacity) * acc_fac;
+            route_ctx.rr_node_cong_inf[inode].acc_cost += (new_occ - capacity) * acc_fac;
         }
     }
 }
@@ -875,7 +902,7 @@ void print_invalid_routing_info(const Netlist<>& net_list, bool is_flat) {
         node_x = rr_graph.node_xlow(inode);
         node_y = rr_graph.node_ylow(inode);
 
-        int occ = route_ctx.rr_node_route_inf[inode].occ();
+        int occ = route_ctx.rr_node_cong_inf[inode].occ();
         int cap = rr_graph.node_capacity(inode);
         if (occ > cap) {
             VTR_LOG("  %s is overused (occ=%d capacity=%d)\n", describe_rr_node(rr_graph, device_ctx.grid, device_ctx.rr_indexed_data, inode, is_flat).c_str(), occ, cap);
@@ -933,7 +960,7 @@ void print_rr_node_route_inf_dot() {
         const auto& inf = route_ctx.rr_node_route_inf[RRNodeId(inode)];
         if (!std::isinf(inf.path_cost)) {
             VTR_LOG("\tnode%zu[label=\"{%zu (%s)", inode, inode, rr_graph.node_type_string(RRNodeId(inode)));
-            if (inf.occ() > rr_graph.node_capacity(RRNodeId(inode))) {
+            if (route_ctx.rr_node_cong_inf[RRNodeId(inode)].occ() > rr_graph.node_capacity(RRNodeId(inode))) {
                 VTR_LOG(" x");
             }
             VTR_LOG("}\"]\n");
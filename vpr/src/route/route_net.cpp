@@ -1,5 +1,7 @@
 /** @file Impls for non-templated net routing fns & utils */
 
+#include <algorithm>
+
 #include "route_net.h"
 #include "stats.h"
 
@@ -12,6 +14,22 @@ bool check_hold(const t_router_opts& router_opts, float worst_neg_slack) {
     return false;
 }
 
+bool should_route_high_fanout(const Netlist<>& net_list,
+                              ParentNetId net_id,
+                              float criticality,
+                              const t_router_opts& router_opts,
+                              const RoutingPredictor& routing_predictor) {
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    constexpr float HIGH_FANOUT_CRITICALITY_THRESHOLD = 0.9;
+    bool high_fanout = is_high_fanout(net_list.net_sinks(net_id).size(), router_opts.high_fanout_threshold);
+    bool sink_critical = (criticality > HIGH_FANOUT_CRITICALITY_THRESHOLD);
+    bool net_is_global = net_list.net_is_global(net_id);
+    bool net_is_clock = route_ctx.is_clock_net[net_id] != 0;
+
+    return high_fanout && !sink_critical && !net_is_global && !net_is_clock && -routing_predictor.get_slope() > router_opts.high_fanout_max_slope;
+}
+
 void setup_net(int itry,
                ParentNetId net_id,
                const Netlist<>& net_list,
@@ -27,8 +45,12 @@ void setup_net(int itry,
     int num_sinks = net_list.net_sinks(net_id).size();
 
     // for nets below a certain size (min_incremental_reroute_fanout), rip up any old routing
-    // otherwise, we incrementally reroute by reusing legal parts of the previous iteration
-    if (num_sinks < router_opts.min_incremental_reroute_fanout || itry == 1 || ripup_high_fanout_nets) {
+    // otherwise, we incrementally reroute by reusing legal parts of the previous iteration.
+    // In late iterations (incremental_reroute_all_nets_iter) few nodes are overused, so reroute
+    // only the congested connections of every net
+    bool late_iter = router_opts.incremental_reroute_all_nets_iter >= 0 && itry >= router_opts.incremental_reroute_all_nets_iter;
+    bool incremental = num_sinks >= router_opts.min_incremental_reroute_fanout || late_iter;
+    if (!incremental || itry == 1 || ripup_high_fanout_nets) {
         profiling::net_rerouted();
 
         /* rip up the whole net */
@@ -150,7 +172,7 @@ bool should_route_net(const Netlist<>& net_list,
     /* Walk over all rt_nodes in the net */
     for (auto& rt_node : tree.all_nodes()) {
         RRNodeId inode = rt_node.inode;
-        int occ = route_ctx.rr_node_route_inf[inode].occ();
+        int occ = route_ctx.rr_node_cong_inf[inode].occ();
         int capacity = rr_graph.node_capacity(inode);
 
         if (occ > capacity) {
@@ -221,6 +243,125 @@ float get_net_pin_criticality(const SetupHoldTimingInfo* timing_info,
     return pin_criticality;
 }
 
+float get_net_routing_priority(const Netlist<>& net_list,
+                               ParentNetId net_id,
+                               const t_router_opts& router_opts,
+                               const SetupHoldTimingInfo* timing_info,
+                               const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                               bool is_flat) {
+    if (router_opts.net_order != e_router_net_order::ADAPTIVE)
+        return 0.;
+
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    /* Tightest timing: the criticality of the most critical sink */
+    float max_criticality = 0.;
+    if (timing_info) {
+        for (ParentPinId pin_id : net_list.net_sinks(net_id)) {
+            max_criticality = std::max(max_criticality, get_net_pin_criticality(timing_info,
+                                                                                netlist_pin_lookup,
+                                                                                router_opts.max_criticality,
+                                                                                router_opts.criticality_exp,
+                                                                                net_id,
+                                                                                pin_id,
+                                                                                is_flat));
+        }
+    }
+
+    /* Historical congestion: the accumulated cost above its initial value of 1, averaged over the nodes
+     * of the last route tree so that big nets don't always come first */
+    float congestion = 0.;
+    const auto& tree = route_ctx.route_trees[net_id];
+    if (tree) {
+        float acc_cost_sum = 0.;
+        size_t num_nodes = 0;
+        for (const RouteTreeNode& rt_node : tree->all_nodes()) {
+            acc_cost_sum += route_ctx.rr_node_cong_inf[rt_node.inode].acc_cost - 1.;
+            num_nodes++;
+        }
+        congestion = acc_cost_sum / num_nodes;
+    }
+
+    return max_criticality + congestion / (1. + congestion);
+}
+
+void sort_nets_for_routing(std::vector<ParentNetId>& nets,
+                           const Netlist<>& net_list,
+                           const t_router_opts& router_opts,
+                           const SetupHoldTimingInfo* timing_info,
+                           const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                           bool is_flat) {
+    if (router_opts.net_order == e_router_net_order::FANOUT) {
+        std::stable_sort(nets.begin(), nets.end(), [&](ParentNetId id1, ParentNetId id2) -> bool {
+            return net_list.net_sinks(id1).size() > net_list.net_sinks(id2).size();
+        });
+        return;
+    }
+
+    /* Compute each priority once, not in every comparison */
+    std::vector<std::pair<float, ParentNetId>> prioritized_nets;
+    prioritized_nets.reserve(nets.size());
+    for (ParentNetId net_id : nets)
+        prioritized_nets.emplace_back(get_net_routing_priority(net_list, net_id, router_opts, timing_info, netlist_pin_lookup, is_flat), net_id);
+
+    std::stable_sort(prioritized_nets.begin(), prioritized_nets.end(), [&](const auto& lhs, const auto& rhs) -> bool {
+        if (lhs.first != rhs.first)
+            return lhs.first > rhs.first;
+        return net_list.net_sinks(lhs.second).size() > net_list.net_sinks(rhs.second).size();
+    });
+
+    for (size_t i = 0; i < nets.size(); i++)
+        nets[i] = prioritized_nets[i].second;
+}
+
+void sort_sinks_by_proximity(std::vector<size_t>& remaining_targets,
+                             const std::vector<float>& pin_criticality,
+                             ParentNetId net_id,
+                             const RouteTree& tree) {
+    const auto& rr_graph = g_vpr_ctx.device().rr_graph;
+    const auto& net_terminals = g_vpr_ctx.routing().net_rr_terminals[net_id];
+
+    auto distance = [&](size_t ipin1, size_t ipin2) {
+        RRNodeId node1 = net_terminals[ipin1];
+        RRNodeId node2 = net_terminals[ipin2];
+        return std::abs(rr_graph.node_xlow(node1) - rr_graph.node_xlow(node2))
+               + std::abs(rr_graph.node_ylow(node1) - rr_graph.node_ylow(node2))
+               + std::abs(rr_graph.node_layer(node1) - rr_graph.node_layer(node2));
+    };
+
+    /* Distance from each remaining sink to the closest routed point: the source and the sinks already reached */
+    std::vector<int> tree_distance(remaining_targets.size());
+    for (size_t i = 0; i < remaining_targets.size(); i++)
+        tree_distance[i] = distance(remaining_targets[i], 0);
+    const auto& is_isink_reached = tree.get_is_isink_reached();
+    for (size_t ipin = 1; ipin < net_terminals.size(); ipin++) {
+        if (!is_isink_reached.get(ipin))
+            continue;
+        for (size_t i = 0; i < remaining_targets.size(); i++)
+            tree_distance[i] = std::min(tree_distance[i], distance(remaining_targets[i], ipin));
+    }
+
+    /* Take the closest (scaled) sink, which then also counts as routed */
+    for (size_t next = 0; next < remaining_targets.size(); next++) {
+        size_t best = next;
+        float best_cost = tree_distance[next] * (1. - pin_criticality[remaining_targets[next]]);
+        for (size_t i = next + 1; i < remaining_targets.size(); i++) {
+            float cost = tree_distance[i] * (1. - pin_criticality[remaining_targets[i]]);
+            if (cost < best_cost) {
+                best = i;
+                best_cost = cost;
+            }
+        }
+
+        /* Keep the rest in criticality order, so that ties still go to the most critical sink */
+        std::rotate(remaining_targets.begin() + next, remaining_targets.begin() + best, remaining_targets.begin() + best + 1);
+        std::rotate(tree_distance.begin() + next, tree_distance.begin() + best, tree_distance.begin() + best + 1);
+
+        for (size_t i = next + 1; i < remaining_targets.size(); i++)
+            tree_distance[i] = std::min(tree_distance[i], distance(remaining_targets[i], remaining_targets[next]));
+    }
+}
+
 size_t calculate_wirelength_available() {
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
@@ -317,8 +458,8 @@ void init_net_delay_from_lookahead(const RouterLookahead& router_lookahead,
     t_conn_cost_params cost_params;
     cost_params.criticality = 1.; // Ensures lookahead returns delay value
 
-    for (auto net_id : net_list.nets()) {
-        if (net_list.net_is_ignored(net_id)) continue;
+    auto init_one_net_delay = [&](ParentNetId net_id) {
+        if (net_list.net_is_ignored(net_id)) return;
 
         RRNodeId source_rr = net_rr_terminals[net_id][0];
 
@@ -336,7 +477,16 @@ void init_net_delay_from_lookahead(const RouterLookahead& router_lookahead,
 
             net_delay[net_id][ipin] = est_delay;
         }
+    };
+
+    // The nets are independent (and the lookahead is already queried concurrently by the parallel routers)
+#ifdef VPR_USE_TBB
+    tbb::parallel_for_each(net_list.nets().begin(), net_list.nets().end(), init_one_net_delay);
+#else
+    for (auto net_id : net_list.nets()) {
+        init_one_net_delay(net_id);
     }
+#endif
 }
 
 void update_net_delays_from_route_tree(float* net_delay,
@@ -348,9 +498,8 @@ void update_net_delays_from_route_tree(float* net_delay,
     const RouteTree& tree = route_ctx.route_trees[inet].value();
     auto& is_isink_reached = tree.get_is_isink_reached();
 
-    for (unsigned int isink = 1; isink < net_list.net_pins(inet).size(); isink++) {
-        if (!is_isink_reached.get(isink))
-            continue;
+    size_t num_pins = net_list.net_pins(inet).size();
+    for (size_t isink = is_isink_reached.find_next_set(1); isink < num_pins; isink = is_isink_reached.find_next_set(isink + 1)) {
         update_net_delay_from_isink(net_delay, tree, isink, net_list, inet, timing_info, pin_timing_invalidator);
     }
 }
@@ -54,6 +54,39 @@ float get_net_pin_criticality(const SetupHoldTimingInfo* timing_info,
                               ParentPinId pin_id,
                               bool is_flat);
 
+/** Get the routing priority of \p net_id according to router_opts.net_order: nets with a higher priority
+ * are routed first, with ties broken by fanout (see sort_nets_for_routing()).
+ * For the adaptive order, this is the criticality of the net's most critical sink plus a term in [0, 1)
+ * which grows with the mean historical (accumulated) congestion cost of the nodes of its last route tree.
+ * It is always 0 for the fanout order. */
+float get_net_routing_priority(const Netlist<>& net_list,
+                               ParentNetId net_id,
+                               const t_router_opts& router_opts,
+                               const SetupHoldTimingInfo* timing_info,
+                               const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                               bool is_flat);
+
+/** Sort \p nets in the order they should be routed in: by decreasing routing priority (see
+ * get_net_routing_priority()), then by decreasing fanout */
+void sort_nets_for_routing(std::vector<ParentNetId>& nets,
+                           const Netlist<>& net_list,
+                           const t_router_opts& router_opts,
+                           const SetupHoldTimingInfo* timing_info,
+                           const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
+                           bool is_flat);
+
+/** Nets with more remaining sinks than this keep the criticality sink order under the proximity sink order,
+ * which takes quadratic time in the number of sinks */
+constexpr size_t MAX_PROXIMITY_ORDERED_SINKS = 256;
+
+/** Reorder the \p remaining_targets (pin indices, sorted by decreasing criticality) of \p net_id so that
+ * each sink is the one closest to the source and the sinks reached or ordered before it, with the distance
+ * scaled by (1 - criticality). Ties keep the criticality order. */
+void sort_sinks_by_proximity(std::vector<size_t>& remaining_targets,
+                             const std::vector<float>& pin_criticality,
+                             ParentNetId net_id,
+                             const RouteTree& tree);
+
 /** Returns true if the specified net fanout is classified as high fanout */
 constexpr bool is_high_fanout(int fanout, int fanout_threshold) {
     if (fanout_threshold < 0 || fanout < fanout_threshold)
@@ -61,6 +94,16 @@ constexpr bool is_high_fanout(int fanout, int fanout_threshold) {
     return true;
 }
 
+/** Should the connection to a sink of \p net_id with \p criticality be routed
+ * in high fanout mode? (only the spatially close part of the route tree is put on the heap)
+ * Timing critical sinks, global & clock nets and nets routed while congestion isn't
+ * improving fast enough always use the full route tree. */
+bool should_route_high_fanout(const Netlist<>& net_list,
+                              ParentNetId net_id,
+                              float criticality,
+                              const t_router_opts& router_opts,
+                              const RoutingPredictor& routing_predictor);
+
 /** Setup the current route tree for this net.
  * Depending on # of fanouts, this fn either resets or prunes the route tree
  * and updates other global data structures to match its state. */
@@ -119,9 +162,8 @@ void update_rr_route_inf_from_tree(const RouteTreeNode& rt_node);
  * (return a vector with indices of set bits) */
 inline std::vector<size_t> sink_mask_to_vector(const vtr::dynamic_bitset<>& mask, size_t num_sinks) {
     std::vector<size_t> out;
-    for (size_t i = 1; i < num_sinks + 1; i++)
-        if (mask.get(i))
-            out.push_back(i);
+    for (size_t i = mask.find_next_set(1); i < num_sinks + 1; i = mask.find_next_set(i + 1))
+        out.push_back(i);
     return out;
 }
 
@@ -4,6 +4,7 @@
 
 #include "route_net.h"
 
+#include <map>
 #include <tuple>
 
 #include "connection_router_interface.h"
@@ -14,6 +15,7 @@
 #include "route_profiling.h"
 #include "rr_graph_fwd.h"
 #include "vtr_dynamic_bitset.h"
+#include "vtr_profiler_markers.h"
 
 /** Attempt to route a single net.
  *
@@ -56,11 +58,12 @@ inline NetResultFlags route_net(ConnectionRouter& router,
                                 route_budgets& budgeting_inf,
                                 float worst_negative_slack,
                                 const RoutingPredictor& routing_predictor,
-                                const std::vector<std::unordered_map<RRNodeId, int>>& choking_spots,
+                                const std::vector<vtr::id_hash_map<RRNodeId, int>>& choking_spots,
                                 bool is_flat,
                                 const t_bb& net_bb,
                                 bool should_setup = true,
                                 vtr::optional<const vtr::dynamic_bitset<>&> sink_mask = vtr::nullopt) {
+    VTR_PROFILE_SCOPE_ARG(route_net, size_t(net_id));
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
     NetResultFlags flags;
@@ -97,22 +100,34 @@ inline NetResultFlags route_net(ConnectionRouter& router,
 
     bool high_fanout = is_high_fanout(num_sinks, router_opts.high_fanout_threshold);
 
-    SpatialRouteTreeLookup spatial_route_tree_lookup;
-    if (high_fanout) {
-        spatial_route_tree_lookup = build_route_tree_spatial_lookup(net_list,
-                                                                    route_ctx.route_bb,
-                                                                    net_id,
-                                                                    tree.root());
+    // The tree keeps its spatial lookup up to date across iterations, so it is only built the first
+    // time the net is routed (or when its bounding box changes the number of bins). The parts of a
+    // decomposed net (routed with a sink_mask) may be routed concurrently, so they build their own.
+    SpatialRouteTreeLookup vnet_spatial_route_tree_lookup;
+    if (high_fanout && sink_mask) {
+        vnet_spatial_route_tree_lookup = build_route_tree_spatial_lookup(net_list,
+                                                                         route_ctx.route_bb,
+                                                                         net_id,
+                                                                         tree.root());
     }
+    std::array<size_t, 2> num_spatial_bins = {0, 0};
+    if (high_fanout && !sink_mask) {
+        num_spatial_bins = route_tree_spatial_lookup_num_bins(net_list, route_ctx.route_bb, net_id);
+    }
+    SpatialRouteTreeLookup& spatial_route_tree_lookup = sink_mask ? vnet_spatial_route_tree_lookup : tree.spatial_lookup(num_spatial_bins);
 
     /* 1-indexed! */
     std::vector<float> pin_criticality(tree.num_sinks() + 1, 0);
 
     // after this point the route tree is correct
     // remaining_targets from this point on are the **pin indices** that have yet to be routed
-    auto remaining_targets_mask = ~tree.get_is_isink_reached();
-    if (sink_mask)
-        remaining_targets_mask &= sink_mask.value();
+    vtr::dynamic_bitset<> remaining_targets_mask;
+    if (sink_mask) {
+        remaining_targets_mask = sink_mask.value();
+        remaining_targets_mask.and_not(tree.get_is_isink_reached());
+    } else {
+        remaining_targets_mask = ~tree.get_is_isink_reached();
+    }
 
     auto remaining_targets = sink_mask_to_vector(remaining_targets_mask, num_sinks);
 
@@ -133,6 +148,9 @@ inline NetResultFlags route_net(ConnectionRouter& router,
         return pin_criticality[a] > pin_criticality[b];
     });
 
+    if (router_opts.sink_order == e_router_sink_order::PROXIMITY && remaining_targets.size() <= MAX_PROXIMITY_ORDERED_SINKS)
+        sort_sinks_by_proximity(remaining_targets, pin_criticality, net_id, tree);
+
     /* Update base costs according to fanout and criticality rules */
     update_rr_base_costs(num_sinks);
 
@@ -140,6 +158,8 @@ inline NetResultFlags route_net(ConnectionRouter& router,
     t_conn_cost_params cost_params;
     cost_params.astar_fac = router_opts.astar_fac;
     cost_params.bend_cost = router_opts.bend_cost;
+    cost_params.bidir_search_min_dist = router_opts.bidir_search_min_dist;
+    cost_params.bidir_search_max_criticality = router_opts.bidir_search_max_criticality;
     cost_params.pres_fac = pres_fac;
     cost_params.delay_budget = ((budgeting_inf.if_set()) ? &conn_delay_budget : nullptr);
 
@@ -201,10 +221,43 @@ inline NetResultFlags route_net(ConnectionRouter& router,
         budgeting_inf.set_should_reroute(net_id, false);
     }
 
+    // Sinks without delay budgets may share high fanout searches
+    bool batch_high_fanout_sinks = router_opts.high_fanout_batch_size > 1 && !budgeting_inf.if_set();
+
     // explore in order of decreasing criticality (no longer need sink_order array)
     for (unsigned itarget = 0; itarget < remaining_targets.size(); ++itarget) {
         int target_pin = remaining_targets[itarget];
 
+        if (batch_high_fanout_sinks && should_route_high_fanout(net_list, net_id, pin_criticality[target_pin], router_opts, routing_predictor)) {
+            // Targets are in order of decreasing criticality, so all the remaining ones can use the high fanout search
+            std::vector<int> batch_targets(remaining_targets.begin() + itarget, remaining_targets.end());
+            auto batch_flags = route_sinks_high_fanout_batched(router,
+                                                               net_list,
+                                                               net_id,
+                                                               itry,
+                                                               itarget,
+                                                               batch_targets,
+                                                               pin_criticality,
+                                                               cost_params,
+                                                               router_opts,
+                                                               tree,
+                                                               spatial_route_tree_lookup,
+                                                               router_stats,
+                                                               budgeting_inf,
+                                                               routing_predictor,
+                                                               choking_spots,
+                                                               is_flat,
+                                                               net_bb);
+
+            flags.retry_with_full_bb |= batch_flags.retry_with_full_bb;
+
+            if (!batch_flags.success) {
+                flags.success = false;
+                return flags;
+            }
+            break;
+        }
+
         RRNodeId sink_rr = route_ctx.net_rr_terminals[net_id][target_pin];
 
         enable_router_debug(router_opts, net_id, sink_rr, itry, &router);
@@ -273,7 +326,7 @@ inline NetResultFlags route_net(ConnectionRouter& router,
         }
     }
 
-    VTR_ASSERT_MSG(g_vpr_ctx.routing().rr_node_route_inf[tree.root().inode].occ() <= rr_graph.node_capacity(tree.root().inode), "SOURCE should never be congested");
+    VTR_ASSERT_MSG(g_vpr_ctx.routing().rr_node_cong_inf[tree.root().inode].occ() <= rr_graph.node_capacity(tree.root().inode), "SOURCE should never be congested");
     VTR_LOGV_DEBUG(f_router_debug, "Routed Net %zu (%zu sinks)\n", size_t(net_id), num_sinks);
 
     router.empty_rcv_route_tree_set(); // ?
@@ -318,7 +371,7 @@ inline NetResultFlags pre_route_to_clock_root(ConnectionRouter& router,
     ConnectionParameters conn_params(net_id,
                                      -1,
                                      false,
-                                     std::unordered_map<RRNodeId, int>());
+                                     vtr::id_hash_map<RRNodeId, int>());
 
     std::tie(found_path, retry_with_full_bb, cheapest) = router.timing_driven_route_connection_from_route_tree(
         tree.root(),
@@ -352,7 +405,7 @@ inline NetResultFlags pre_route_to_clock_root(ConnectionRouter& router,
      * points. Therefore, we can set the net pin index of the sink node to      *
      * OPEN (meaning illegal) as it is not meaningful for this sink.            */
     vtr::optional<const RouteTreeNode&> new_branch, new_sink;
-    std::tie(new_branch, new_sink) = tree.update_from_heap(&cheapest, OPEN, ((high_fanout) ? &spatial_rt_lookup : nullptr), is_flat);
+    std::tie(new_branch, new_sink) = tree.update_from_heap(&cheapest, OPEN, ((high_fanout) ? &spatial_rt_lookup : nullptr), is_flat, router.get_rr_node_route_inf());
 
     VTR_ASSERT_DEBUG(!high_fanout || validate_route_tree_spatial_lookup(tree.root(), spatial_rt_lookup));
 
@@ -372,7 +425,7 @@ inline NetResultFlags pre_route_to_clock_root(ConnectionRouter& router,
     // - remove sink from route tree and fix routing for all nodes leading to the sink ("freeze")
     // - free up virtual sink occupancy
     tree.freeze();
-    m_route_ctx.rr_node_route_inf[sink_node].set_occ(0);
+    m_route_ctx.rr_node_cong_inf[sink_node].set_occ(0);
 
     // routed to a sink successfully
     out.success = true;
@@ -413,7 +466,7 @@ inline NetResultFlags route_sink(ConnectionRouter& router,
                                  RouterStats& router_stats,
                                  route_budgets& budgeting_inf,
                                  const RoutingPredictor& routing_predictor,
-                                 const std::vector<std::unordered_map<RRNodeId, int>>& choking_spots,
+                                 const std::vector<vtr::id_hash_map<RRNodeId, int>>& choking_spots,
                                  bool is_flat,
                                  const t_bb& net_bb) {
     const auto& device_ctx = g_vpr_ctx.device();
@@ -431,19 +484,17 @@ inline NetResultFlags route_sink(ConnectionRouter& router,
     bool found_path;
     t_heap cheapest;
 
-    bool net_is_global = net_list.net_is_global(net_id);
     bool high_fanout = is_high_fanout(net_list.net_sinks(net_id).size(), router_opts.high_fanout_threshold);
-    constexpr float HIGH_FANOUT_CRITICALITY_THRESHOLD = 0.9;
-    bool sink_critical = (cost_params.criticality > HIGH_FANOUT_CRITICALITY_THRESHOLD);
-    bool net_is_clock = route_ctx.is_clock_net[net_id] != 0;
 
     bool has_choking_spot = ((int)choking_spots[target_pin].size() != 0) && router_opts.has_choking_spot;
     ConnectionParameters conn_params(net_id, target_pin, has_choking_spot, choking_spots[target_pin]);
 
+    size_t heap_pops_before = router_stats.heap_pops;
+
     //We normally route high fanout nets by only adding spatially close-by routing to the heap (reduces run-time).
     //However, if the current sink is 'critical' from a timing perspective, we put the entire route tree back onto
     //the heap to ensure it has more flexibility to find the best path.
-    if (high_fanout && !sink_critical && !net_is_global && !net_is_clock && -routing_predictor.get_slope() > router_opts.high_fanout_max_slope) {
+    if (should_route_high_fanout(net_list, net_id, cost_params.criticality, router_opts, routing_predictor)) {
         std::tie(found_path, flags.retry_with_full_bb, cheapest) = router.timing_driven_route_connection_from_route_tree_high_fanout(tree.root(),
                                                                                                                                      sink_node,
                                                                                                                                      cost_params,
@@ -461,6 +512,8 @@ inline NetResultFlags route_sink(ConnectionRouter& router,
     }
 
     if (!found_path) {
+        if (flags.retry_with_full_bb)
+            router_stats.profile.bb_retries++;
         ParentBlockId src_block = net_list.net_driver_block(net_id);
         ParentBlockId sink_block = net_list.pin_block(*(net_list.net_pins(net_id).begin() + target_pin));
         VTR_LOG("Failed to route connection from '%s' to '%s' for net '%s' (#%zu)\n",
@@ -479,10 +532,21 @@ inline NetResultFlags route_sink(ConnectionRouter& router,
     profiling::sink_criticality_end(cost_params.criticality);
 
     vtr::optional<const RouteTreeNode&> new_branch, new_sink;
-    std::tie(new_branch, new_sink) = tree.update_from_heap(&cheapest, target_pin, ((high_fanout) ? &spatial_rt_lookup : nullptr), is_flat);
+    std::tie(new_branch, new_sink) = tree.update_from_heap(&cheapest, target_pin, ((high_fanout) ? &spatial_rt_lookup : nullptr), is_flat, router.get_rr_node_route_inf());
 
     VTR_ASSERT_DEBUG(!high_fanout || validate_route_tree_spatial_lookup(tree.root(), spatial_rt_lookup));
 
+    /* The new branch is the path found from the route tree to the sink */
+    router_stats.profile.connections++;
+    router_stats.profile.sink_expansions += router_stats.heap_pops - heap_pops_before;
+    if (new_branch) {
+        router_stats.profile.path_nodes++;
+        for (auto& rt_node : new_branch->all_nodes()) {
+            (void)rt_node;
+            router_stats.profile.path_nodes++;
+        }
+    }
+
     if (f_router_debug) {
         std::string msg = vtr::string_fmt("Routed Net %zu connection %d to RR node %d successfully", size_t(net_id), itarget, sink_node);
         update_screen(ScreenUpdatePriority::MAJOR, msg.c_str(), ROUTING, nullptr);
@@ -506,3 +570,147 @@ inline NetResultFlags route_sink(ConnectionRouter& router,
     flags.success = true;
     return flags;
 }
+
+/** Route the sinks \p targets of a high fanout net in batches of spatially close sinks.
+ * Each batch shares a single wavefront expansion (see
+ * ConnectionRouterInterface::timing_driven_route_connections_from_route_tree_high_fanout_batch)
+ * and is routed with the highest criticality among its sinks. Sinks which the batched
+ * search could not reach are routed one at a time by route_sink.
+ *
+ * @param itry # of iteration
+ * @param first_itarget # of the first of \p targets in the net (only used for debug output)
+ * @param targets Pin indices of the sinks to route, in order of decreasing criticality.
+ * All of them should satisfy should_route_high_fanout()
+ * @param pin_criticality Criticality of each sink (1-indexed)
+ * Other params are the same as route_sink's.
+ * @return NetResultFlags for these sinks to be bubbled up through route_net */
+template<typename ConnectionRouter>
+inline NetResultFlags route_sinks_high_fanout_batched(ConnectionRouter& router,
+                                                      const Netlist<>& net_list,
+                                                      ParentNetId net_id,
+                                                      int itry,
+                                                      unsigned first_itarget,
+                                                      const std::vector<int>& targets,
+                                                      const std::vector<float>& pin_criticality,
+                                                      t_conn_cost_params cost_params,
+                                                      const t_router_opts& router_opts,
+                                                      RouteTree& tree,
+                                                      SpatialRouteTreeLookup& spatial_rt_lookup,
+                                                      RouterStats& router_stats,
+                                                      route_budgets& budgeting_inf,
+                                                      const RoutingPredictor& routing_predictor,
+                                                      const std::vector<vtr::id_hash_map<RRNodeId, int>>& choking_spots,
+                                                      bool is_flat,
+                                                      const t_bb& net_bb) {
+    const auto& device_ctx = g_vpr_ctx.device();
+    const auto& route_ctx = g_vpr_ctx.routing();
+    const auto& rr_graph = device_ctx.rr_graph;
+
+    NetResultFlags flags;
+    flags.success = true;
+
+    // Group the targets by spatial lookup bin. Inside a bin, they stay in order of decreasing criticality
+    // (std::map keeps the order of the bins deterministic)
+    std::map<std::pair<int, int>, std::vector<int>> bin_targets;
+    for (int target_pin : targets) {
+        RRNodeId sink_rr = route_ctx.net_rr_terminals[net_id][target_pin];
+        int bin_x = grid_to_bin_x(rr_graph.node_xlow(sink_rr), spatial_rt_lookup);
+        int bin_y = grid_to_bin_y(rr_graph.node_ylow(sink_rr), spatial_rt_lookup);
+        bin_targets[{bin_x, bin_y}].push_back(target_pin);
+    }
+
+    RRNodeId source_rr = route_ctx.net_rr_terminals[net_id][0];
+    size_t batch_size = router_opts.high_fanout_batch_size;
+    unsigned itarget = first_itarget;
+
+    for (const auto& bin : bin_targets) {
+        const std::vector<int>& pins = bin.second;
+        for (size_t first = 0; first < pins.size(); first += batch_size) {
+            std::vector<int> batch(pins.begin() + first, pins.begin() + std::min(first + batch_size, pins.size()));
+
+            std::vector<RRNodeId> sink_nodes;
+            std::vector<ConnectionParameters> conn_params;
+            conn_params.reserve(batch.size());
+            for (int target_pin : batch) {
+                sink_nodes.push_back(route_ctx.net_rr_terminals[net_id][target_pin]);
+                bool has_choking_spot = ((int)choking_spots[target_pin].size() != 0) && router_opts.has_choking_spot;
+                conn_params.emplace_back(net_id, target_pin, has_choking_spot, choking_spots[target_pin]);
+            }
+
+            enable_router_debug(router_opts, net_id, sink_nodes[0], itry, &router);
+            VTR_LOGV_DEBUG(f_router_debug, "Net %zu Targets %d-%d as high fanout batch\n", size_t(net_id), itarget, itarget + (unsigned)batch.size() - 1);
+
+            cost_params.criticality = pin_criticality[batch[0]];
+
+            router.clear_modified_rr_node_info();
+            profiling::conn_start();
+            size_t num_routed = router.timing_driven_route_connections_from_route_tree_high_fanout_batch(
+                tree.root(),
+                sink_nodes,
+                cost_params,
+                net_bb,
+                spatial_rt_lookup,
+                router_stats,
+                conn_params,
+                [&](size_t isink, t_heap& cheapest) {
+                    vtr::optional<const RouteTreeNode&> new_branch, new_sink;
+                    std::tie(new_branch, new_sink) = tree.update_from_heap(&cheapest, batch[isink], &spatial_rt_lookup, is_flat, router.get_rr_node_route_inf());
+
+                    VTR_ASSERT_DEBUG(validate_route_tree_spatial_lookup(tree.root(), spatial_rt_lookup));
+
+                    /* update global occupancy from the new branch */
+                    if (new_branch)
+                        pathfinder_update_cost_from_route_tree(new_branch.value(), 1);
+
+                    profiling::conn_finish(size_t(source_rr),
+                                           size_t(sink_nodes[isink]),
+                                           pin_criticality[batch[isink]]);
+                    ++router_stats.connections_routed;
+                    profiling::conn_start();
+
+                    return new_branch;
+                });
+            itarget += num_routed;
+
+            // Route what the batch couldn't reach one sink at a time
+            for (size_t isink = num_routed; isink < batch.size(); isink++, itarget++) {
+                int target_pin = batch[isink];
+                cost_params.criticality = pin_criticality[target_pin];
+
+                profiling::conn_start();
+
+                auto sink_flags = route_sink(router,
+                                             net_list,
+                                             net_id,
+                                             itarget,
+                                             target_pin,
+                                             cost_params,
+                                             router_opts,
+                                             tree,
+                                             spatial_rt_lookup,
+                                             router_stats,
+                                             budgeting_inf,
+                                             routing_predictor,
+                                             choking_spots,
+                                             is_flat,
+                                             net_bb);
+
+                flags.retry_with_full_bb |= sink_flags.retry_with_full_bb;
+
+                if (!sink_flags.success) {
+                    flags.success = false;
+                    VTR_LOG("Routing failed for sink %d of net %d\n", target_pin, net_id);
+                    return flags;
+                }
+
+                profiling::conn_finish(size_t(source_rr),
+                                       size_t(sink_nodes[isink]),
+                                       pin_criticality[target_pin]);
+
+                ++router_stats.connections_routed;
+            }
+        }
+    }
+
+    return flags;
+}
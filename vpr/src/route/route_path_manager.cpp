@@ -17,8 +17,8 @@ bool PathManager::node_exists_in_tree(t_heap_path* path_data,
     if (!path_data || !is_enabled_) return false;
 
     // First check the smaller current path, the ordering of these checks might effect runtime slightly
-    for (auto& node : path_data->path_rr) {
-        if (node == to_node) {
+    for (const t_heap_path_step* step = path_data->last_step; step != nullptr; step = step->prev) {
+        if (step->node == to_node) {
             return true;
         }
     }
@@ -39,15 +39,19 @@ void PathManager::mark_node_visited(RRNodeId node) {
     }
 }
 
-void PathManager::insert_backwards_path_into_traceback(t_heap_path* path_data, float cost, float backward_path_cost, RoutingContext& route_ctx) {
+void PathManager::insert_backwards_path_into_traceback(t_heap_path* path_data, float cost, float backward_path_cost, t_rr_node_route_inf_vector& rr_node_route_inf) {
     if (!is_enabled_) return;
 
-    for (unsigned i = 1; i < path_data->edge.size() - 1; i++) {
-        RRNodeId node_2 = path_data->path_rr[i];
-        RREdgeId edge = path_data->edge[i - 1];
-        route_ctx.rr_node_route_inf[node_2].prev_edge = edge;
-        route_ctx.rr_node_route_inf[node_2].path_cost = cost;
-        route_ctx.rr_node_route_inf[node_2].backward_path_cost = backward_path_cost;
+    // Every node of the path but the first and last one is reached by the edge of the previous step
+    const t_heap_path_step* last_step = path_data->last_step;
+    if (last_step == nullptr) return;
+
+    for (const t_heap_path_step* step = last_step->prev; step != nullptr && step->prev != nullptr; step = step->prev) {
+        RRNodeId node_2 = step->node;
+        RREdgeId edge = step->prev->edge;
+        rr_node_route_inf[node_2].prev_edge = edge;
+        rr_node_route_inf[node_2].path_cost = cost;
+        rr_node_route_inf[node_2].backward_path_cost = backward_path_cost;
     }
 }
 
@@ -60,8 +64,6 @@ void PathManager::set_enabled(bool enable) {
 }
 
 void PathManager::alloc_path_struct(t_heap_path*& tptr) {
-    // TODO: Use arena allocation for this part
-
     // If RCV isn't enabled return a nullptr
     if (!is_enabled_) {
         return;
@@ -79,8 +81,7 @@ void PathManager::alloc_path_struct(t_heap_path*& tptr) {
     }
     // }
 
-    tptr->path_rr.clear();
-    tptr->edge.clear();
+    tptr->last_step = nullptr;
     tptr->backward_cong = 0.;
     tptr->backward_delay = 0.;
 }
@@ -108,13 +109,18 @@ void PathManager::empty_heap() {
 
     // Copy alloc_list_ into the freed nodes list
     std::copy(alloc_list_.begin(), alloc_list_.end(), freed_nodes_.begin());
+
+    // No path refers to the steps anymore
+    num_path_steps_ = 0;
 }
 
 void PathManager::update_route_tree_set(t_heap_path* cheapest_path_struct) {
     if (!is_enabled_) return;
 
     // Add all values in path struct to the route tree nodes set
-    route_tree_nodes_.insert(cheapest_path_struct->path_rr.begin(), cheapest_path_struct->path_rr.end());
+    for (const t_heap_path_step* step = cheapest_path_struct->last_step; step != nullptr; step = step->prev) {
+        route_tree_nodes_.insert(step->node);
+    }
 }
 
 void PathManager::empty_route_tree_nodes() {
@@ -132,3 +138,17 @@ void PathManager::move(t_heap_path*& dest, t_heap_path*& src) {
     // Invalidate the source pointer to ensure it isn't double 'freed'
     src = nullptr;
 }
+
+void PathManager::extend_path(t_heap_path* dest, const t_heap_path* src, RRNodeId from_node, RREdgeId from_edge) {
+    // Reuse the steps of the previous connections before growing the pool
+    if (num_path_steps_ == path_steps_.size()) {
+        path_steps_.emplace_back();
+    }
+    t_heap_path_step& step = path_steps_[num_path_steps_++];
+
+    step.node = from_node;
+    step.edge = from_edge;
+    step.prev = src->last_step;
+
+    dest->last_step = &step;
+}
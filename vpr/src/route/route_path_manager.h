@@ -1,6 +1,9 @@
 #include "rr_graph_fwd.h"
+#include "rr_node_route_inf_fwd.h"
 #include "vtr_assert.h"
+#include "vtr_vector.h"
 
+#include <deque>
 #include <set>
 #include <list>
 #include <vector>
@@ -8,28 +11,33 @@
 #ifndef _PATH_MANAGER_H
 #    define _PATH_MANAGER_H
 
+/* A step of an RCV partial path: a node of the path, and the edge taken from it to reach the next node
+ * The steps are linked back towards the route tree, so the partial paths which extend the same prefix
+ * share its steps instead of each copying it. They are allocated (and recycled) by PathManager.
+ *
+ * prev: The previous step of the path, or nullptr for the first step */
+struct t_heap_path_step {
+    RRNodeId node;
+    RREdgeId edge;
+    const t_heap_path_step* prev;
+};
+
 /* Extra path data needed by RCV, seperated from t_heap struct for performance reasons
  * Can be accessed by a pointer, won't be initialized unless by RCV
  * Use PathManager class to handle this structure's allocation and deallocation
  *
- * path_rr: The entire partial path up until the route tree with the first node being the SOURCE,
- *          or a part of the route tree that already exists for this net 
- * 
- * edge: A list of edges from each node in the partial path to reach the next node
+ * last_step: The last step of the entire partial path up until the route tree, whose first node is the SOURCE,
+ *            or a part of the route tree that already exists for this net (nullptr if the path is empty)
  * 
  * backward_delay: The delay of the partial path plus the path from route tree to source
  * 
  * backward_cong: The congestion estimate of the partial path plus the path from route tree to source */
 struct t_heap_path {
-    std::vector<RRNodeId> path_rr;
-    std::vector<RREdgeId> edge;
+    const t_heap_path_step* last_step = nullptr;
     float backward_delay = 0.;
     float backward_cong = 0.;
 };
 
-// Forward declaration of RoutingContext needed for traceback insertion
-class RoutingContext;
-
 /* A class to manage the extra data required for RCV
  * It manages a set containing all the nodes that currently exist in the route tree
  * This class also manages the extra memory allocation required for the t_heap_path structure
@@ -73,8 +81,8 @@ class PathManager {
     // Enable/disable path manager class and therefore RCV
     void set_enabled(bool enable);
 
-    // Insert the partial path data into the main route context traceback
-    void insert_backwards_path_into_traceback(t_heap_path* path_data, float cost, float backward_path_cost, RoutingContext& route_ctx);
+    // Insert the partial path data into the router's traceback (rr_node_route_inf)
+    void insert_backwards_path_into_traceback(t_heap_path* path_data, float cost, float backward_path_cost, t_rr_node_route_inf_vector& rr_node_route_inf);
 
     // Dynamically create a t_heap_path structure to be used in the heap
     // Will return unless RCV is enabled
@@ -87,10 +95,14 @@ class PathManager {
     // Move the structure from src to dest while also invalidating the src pointer
     void move(t_heap_path*& dest, t_heap_path*& src);
 
+    // Set the partial path of dest to the one of src, followed by from_node (reached through
+    // from_edge). The path of src is shared, not copied
+    void extend_path(t_heap_path* dest, const t_heap_path* src, RRNodeId from_node, RREdgeId from_edge);
+
     // Cleanup and free all the allocated memory, called when PathManager is destroyed
     void free_all_memory();
 
-    // Put all currently allocated structures into the free_nodes list
+    // Put all currently allocated structures into the free_nodes list, and recycle all the path steps
     // This currently does NOT invalidate them
     // Ideally used before a t_heap empty_heap() call
     void empty_heap();
@@ -112,6 +124,11 @@ class PathManager {
     // A list of freed nodes, to be used where possible to avoid unnecessary news
     std::vector<t_heap_path*> freed_nodes_;
 
+    // Pool of the path steps, whose first num_path_steps_ are in use by the current connection
+    // The steps are shared by many paths, so they're only recycled all together by empty_heap()
+    std::deque<t_heap_path_step> path_steps_;
+    size_t num_path_steps_ = 0;
+
     // Set containing the current route tree, for faster lookup
     // Required by RCV so the router doesn't expand already visited nodes
     std::set<RRNodeId> route_tree_nodes_;
@@ -1,5 +1,8 @@
 #include "route_tree.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "connection_based_routing.h"
 #include "globals.h"
 #include "netlist_fwd.h"
@@ -60,7 +63,7 @@ void RouteTreeNode::print_x(int depth) const {
     }
 
     auto& route_ctx = g_vpr_ctx.routing();
-    if (route_ctx.rr_node_route_inf[inode].occ() > rr_graph.node_capacity(inode)) {
+    if (route_ctx.rr_node_cong_inf[inode].occ() > rr_graph.node_capacity(inode)) {
         VTR_LOG(" x");
     }
 
@@ -71,9 +74,95 @@ void RouteTreeNode::print_x(int depth) const {
     }
 }
 
+RouteTreeArena::RouteTreeArena(RouteTreeArena&& rhs) noexcept
+    : _chunks(std::move(rhs._chunks))
+    , _chunks_by_address(std::move(rhs._chunks_by_address))
+    , _num_active(rhs._num_active)
+    , _active_used(rhs._active_used)
+    , _free(rhs._free) {
+    rhs._chunks.clear();
+    rhs._chunks_by_address.clear();
+    rhs.clear();
+}
+
+RouteTreeArena& RouteTreeArena::operator=(RouteTreeArena&& rhs) noexcept {
+    if (this == &rhs)
+        return *this;
+    _chunks = std::move(rhs._chunks);
+    _chunks_by_address = std::move(rhs._chunks_by_address);
+    _num_active = rhs._num_active;
+    _active_used = rhs._active_used;
+    _free = rhs._free;
+    rhs._chunks.clear();
+    rhs._chunks_by_address.clear();
+    rhs.clear();
+    return *this;
+}
+
+void RouteTreeArena::clear() {
+    _num_active = 0;
+    _active_used = 0;
+    _free = nullptr;
+}
+
+void RouteTreeArena::next_chunk() {
+    if (_num_active == _chunks.size()) {
+        _chunks.emplace_back(new Slot[chunk_size(_chunks.size())]);
+        std::pair<const Slot*, size_t> entry(_chunks.back().get(), _chunks.size() - 1);
+        auto it = std::upper_bound(_chunks_by_address.begin(), _chunks_by_address.end(), entry, [](const auto& a, const auto& b) {
+            return std::less<const Slot*>()(a.first, b.first);
+        });
+        _chunks_by_address.insert(it, entry);
+    }
+    _num_active++;
+    _active_used = 0;
+}
+
+size_t RouteTreeArena::find_chunk(const RouteTreeNode* node) const {
+    const Slot* p = reinterpret_cast<const Slot*>(node);
+    /* Last chunk starting at or before p */
+    auto it = std::upper_bound(_chunks_by_address.begin(), _chunks_by_address.end(), p, [](const Slot* x, const auto& entry) {
+        return std::less<const Slot*>()(x, entry.first);
+    });
+    VTR_ASSERT_SAFE(it != _chunks_by_address.begin());
+    return std::prev(it)->second;
+}
+
+RouteTreeNode* RouteTreeArena::relocate(const RouteTreeArena& rhs, const RouteTreeNode* node) const {
+    if (node == nullptr)
+        return nullptr;
+    size_t ichunk = rhs.find_chunk(node);
+    size_t offset = reinterpret_cast<const Slot*>(node) - rhs._chunks[ichunk].get();
+    VTR_ASSERT_SAFE(offset < chunk_size(ichunk));
+    return reinterpret_cast<RouteTreeNode*>(&_chunks[ichunk][offset]);
+}
+
+void RouteTreeArena::copy_from(const RouteTreeArena& rhs) {
+    clear();
+    while (_num_active < rhs._num_active)
+        next_chunk();
+    _num_active = rhs._num_active;
+    _active_used = rhs._active_used;
+
+    for (size_t ichunk = 0; ichunk < _num_active; ichunk++) {
+        size_t n = (ichunk == _num_active - 1) ? _active_used : chunk_size(ichunk);
+        std::memcpy(_chunks[ichunk].get(), rhs._chunks[ichunk].get(), n * sizeof(Slot));
+
+        /* Free slots have null links except for _next, so they can be relocated the same way */
+        for (size_t i = 0; i < n; i++) {
+            RouteTreeNode& node = reinterpret_cast<RouteTreeNode&>(_chunks[ichunk][i]);
+            node._parent = relocate(rhs, node._parent);
+            node._next = relocate(rhs, node._next);
+            node._prev = relocate(rhs, node._prev);
+            node._subtree_end = relocate(rhs, node._subtree_end);
+        }
+    }
+    _free = relocate(rhs, rhs._free);
+}
+
 /* Construct a top-level route tree. */
 RouteTree::RouteTree(RRNodeId _inode) {
-    _root = new RouteTreeNode(_inode, RRSwitchId::INVALID(), nullptr);
+    _root = _arena.alloc(_inode, RRSwitchId::INVALID(), nullptr);
     _net_id = ParentNetId::INVALID();
     _rr_node_to_rt_node[_inode] = _root;
 }
@@ -82,7 +171,7 @@ RouteTree::RouteTree(ParentNetId _inet) {
     auto& route_ctx = g_vpr_ctx.routing();
 
     RRNodeId inode = RRNodeId(route_ctx.net_rr_terminals[_inet][0]);
-    _root = new RouteTreeNode(inode, RRSwitchId::INVALID(), nullptr);
+    _root = _arena.alloc(inode, RRSwitchId::INVALID(), nullptr);
     _net_id = _inet;
     _rr_node_to_rt_node[inode] = _root;
 
@@ -91,41 +180,102 @@ RouteTree::RouteTree(ParentNetId _inet) {
     _is_isink_reached.resize(_num_sinks + 1); /* 1-indexed */
 }
 
-/** Make a copy of rhs and return it.
- * Traverse it as a tree so we can keep parent & child ptrs valid. */
-RouteTreeNode* RouteTree::copy_tree(const RouteTreeNode* rhs) {
-    RouteTreeNode* root = new RouteTreeNode(rhs->inode, RRSwitchId::INVALID(), nullptr);
-    _rr_node_to_rt_node[root->inode] = root;
-    copy_tree_x(root, *rhs);
-    return root;
+RouteTree::RouteTree(ParentNetId _inet, const std::vector<NodeRecord>& records)
+    : RouteTree(_inet) {
+    VTR_ASSERT(!records.empty() && records[0].inode == _root->inode && records[0].parent == -1);
+
+    /* Children of each record, in order */
+    std::vector<int> first_child(records.size(), -1);
+    std::vector<int> next_sibling(records.size(), -1);
+    std::vector<int> last_child(records.size(), -1);
+    for (size_t i = 1; i < records.size(); i++) {
+        int parent = records[i].parent;
+        VTR_ASSERT(parent >= 0 && size_t(parent) < i);
+        if (last_child[parent] == -1)
+            first_child[parent] = i;
+        else
+            next_sibling[last_child[parent]] = i;
+        last_child[parent] = i;
+    }
+
+    auto load_record = [](RouteTreeNode& node, const NodeRecord& record) {
+        node.re_expand = record.re_expand;
+        node.net_pin_index = record.net_pin_index;
+        node.Tdel = record.Tdel;
+        node.R_upstream = record.R_upstream;
+        node.C_downstream = record.C_downstream;
+    };
+    load_record(*_root, records[0]);
+
+    /* add_node() makes a node the first child of its parent, so the children go in last to first.
+     * The parent of each record comes before it, so it is in the tree by then */
+    std::vector<RouteTreeNode*> nodes(records.size(), nullptr);
+    nodes[0] = _root;
+    std::vector<int> children;
+    for (size_t i = 0; i < records.size(); i++) {
+        children.clear();
+        for (int child = first_child[i]; child != -1; child = next_sibling[child])
+            children.push_back(child);
+        for (auto it = children.rbegin(); it != children.rend(); ++it) {
+            const NodeRecord& record = records[*it];
+            RouteTreeNode* node = _arena.alloc(record.inode, record.parent_switch, nodes[i]);
+            load_record(*node, record);
+            add_node(nodes[i], node);
+            nodes[*it] = node;
+            if (record.net_pin_index > 0)
+                _is_isink_reached.set(record.net_pin_index, true);
+        }
+    }
 }
 
-/* Helper for copy_list: copy child nodes of rhs into lhs */
-void RouteTree::copy_tree_x(RouteTreeNode* lhs, const RouteTreeNode& rhs) {
-    for (auto& rchild : rhs.child_nodes()) {
-        RouteTreeNode* child = new RouteTreeNode(rchild);
-        child->_is_leaf = true;
-        add_node(lhs, child);
-        copy_tree_x(child, rchild);
+std::vector<RouteTree::NodeRecord> RouteTree::to_records(void) const {
+    std::vector<NodeRecord> records;
+    std::unordered_map<const RouteTreeNode*, int> node_index;
+    for (const RouteTreeNode& node : all_nodes()) {
+        int parent = node.parent() ? node_index.at(&node.parent().value()) : -1;
+        node_index[&node] = records.size();
+        records.push_back({node.inode, node.parent_switch, parent, node.net_pin_index, node.Tdel, node.R_upstream, node.C_downstream, node.re_expand});
     }
+    return records;
 }
 
-/* Copy constructor */
-RouteTree::RouteTree(const RouteTree& rhs) {
-    _isink_to_rt_node.resize(rhs._isink_to_rt_node.size());
+/** Copy the node arena of rhs and point all lookups to the copied nodes. */
+void RouteTree::copy_from(const RouteTree& rhs) {
+    _arena.copy_from(rhs._arena);
+    _root = _arena.relocate(rhs._arena, rhs._root);
     _net_id = rhs._net_id;
-    _root = copy_tree(rhs._root);
+
+    _rr_node_to_rt_node = rhs._rr_node_to_rt_node;
+    for (auto& kv : _rr_node_to_rt_node)
+        kv.second = _arena.relocate(rhs._arena, kv.second);
+
+    _isink_to_rt_node.resize(rhs._isink_to_rt_node.size());
+    for (size_t i = 0; i < rhs._isink_to_rt_node.size(); i++)
+        _isink_to_rt_node[i] = _arena.relocate(rhs._arena, rhs._isink_to_rt_node[i]);
+
     _is_isink_reached = rhs._is_isink_reached;
     _num_sinks = rhs._num_sinks;
+
+    _spatial_lookup = rhs._spatial_lookup;
+    for (size_t ibin = 0; ibin < _spatial_lookup.size(); ibin++) {
+        for (auto& rt_node : _spatial_lookup.get(ibin))
+            rt_node = *_arena.relocate(rhs._arena, &rt_node.get());
+    }
+}
+
+/* Copy constructor */
+RouteTree::RouteTree(const RouteTree& rhs) {
+    copy_from(rhs);
 }
 
 /* Move constructor:
- * Take over rhs' linked list & set it to null so it doesn't get freed.
+ * Take over rhs' node arena & set its root to null.
  * Refs should stay valid after this?
  * I don't think there's a user crazy enough to move around route trees
  * from multiple threads, but better safe than sorry */
 RouteTree::RouteTree(RouteTree&& rhs) {
     std::unique_lock<std::mutex> rhs_write_lock(rhs._write_mutex);
+    _arena = std::move(rhs._arena);
     _root = rhs._root;
     _net_id = rhs._net_id;
     rhs._root = nullptr;
@@ -133,26 +283,21 @@ RouteTree::RouteTree(RouteTree&& rhs) {
     _isink_to_rt_node = std::move(rhs._isink_to_rt_node);
     _is_isink_reached = std::move(rhs._is_isink_reached);
     _num_sinks = rhs._num_sinks;
+    _spatial_lookup = std::move(rhs._spatial_lookup);
+    rhs._spatial_lookup.clear();
 }
 
-/* Copy assignment: free list, clear lookup, reload list. */
+/* Copy assignment: copy rhs' arena over mine, reusing its memory. */
 RouteTree& RouteTree::operator=(const RouteTree& rhs) {
     if (this == &rhs)
         return *this;
     std::unique_lock<std::mutex> write_lock(_write_mutex);
-    free_list(_root);
-    _rr_node_to_rt_node.clear();
-    _isink_to_rt_node.clear();
-    _isink_to_rt_node.resize(rhs._isink_to_rt_node.size());
-    _net_id = rhs._net_id;
-    _root = copy_tree(rhs._root);
-    _is_isink_reached = rhs._is_isink_reached;
-    _num_sinks = rhs._num_sinks;
+    copy_from(rhs);
     return *this;
 }
 
 /* Move assignment:
- * Free my list, take over rhs' linked list & set it to null so it doesn't get freed.
+ * Drop my nodes, take over rhs' node arena & set its root to null.
  * Also ~steal~ acquire ownership of node lookup from rhs.
  * Refs should stay valid after this?
  * I don't think there's a user crazy enough to move around route trees
@@ -164,7 +309,7 @@ RouteTree& RouteTree::operator=(RouteTree&& rhs) {
     std::unique_lock<std::mutex> write_lock(_write_mutex, std::defer_lock);
     std::unique_lock<std::mutex> rhs_write_lock(rhs._write_mutex, std::defer_lock);
     std::lock(write_lock, rhs_write_lock);
-    free_list(_root);
+    _arena = std::move(rhs._arena);
     _root = rhs._root;
     _net_id = rhs._net_id;
     rhs._root = nullptr;
@@ -172,9 +317,27 @@ RouteTree& RouteTree::operator=(RouteTree&& rhs) {
     _isink_to_rt_node = std::move(rhs._isink_to_rt_node);
     _is_isink_reached = std::move(rhs._is_isink_reached);
     _num_sinks = rhs._num_sinks;
+    _spatial_lookup = std::move(rhs._spatial_lookup);
+    rhs._spatial_lookup.clear();
     return *this;
 }
 
+/** Get a spatial lookup of the tree nodes with num_bins bins, only building it if
+ * the tree doesn't have one of that size already (add_node() and free_node() keep it
+ * up to date) */
+SpatialRouteTreeLookup& RouteTree::spatial_lookup(const std::array<size_t, 2>& num_bins) {
+    std::unique_lock<std::mutex> write_lock(_write_mutex);
+
+    if (num_bins[0] == 0 || num_bins[1] == 0) {
+        _spatial_lookup.clear();
+    } else if (_spatial_lookup.empty() || _spatial_lookup.dim_size(0) != num_bins[0] || _spatial_lookup.dim_size(1) != num_bins[1]) {
+        _spatial_lookup = SpatialRouteTreeLookup(num_bins);
+        update_route_tree_spatial_lookup_recur(*_root, _spatial_lookup);
+    }
+
+    return _spatial_lookup;
+}
+
 /** Reload timing values (R_upstream, C_downstream, Tdel).
  * Can take a RouteTreeNode& to do an incremental update.
  * Note that update_from_heap already calls this. */
@@ -397,7 +560,7 @@ bool RouteTree::is_valid_x(const RouteTreeNode& rt_node) const {
     }
 
     if (rr_graph.node_type(inode) == SINK) { // sink, must not be congested and must not have fanouts
-        int occ = route_ctx.rr_node_route_inf[inode].occ();
+        int occ = route_ctx.rr_node_cong_inf[inode].occ();
         int capacity = rr_graph.node_capacity(inode);
         if (rt_node._next != nullptr && rt_node._next->_parent == &rt_node) {
             VTR_LOG("SINK %d has fanouts?\n", inode);
@@ -455,7 +618,7 @@ bool RouteTree::is_uncongested_x(const RouteTreeNode& rt_node) const {
     const auto& rr_graph = device_ctx.rr_graph;
 
     RRNodeId inode = rt_node.inode;
-    if (route_ctx.rr_node_route_inf[inode].occ() > rr_graph.node_capacity(RRNodeId(inode))) {
+    if (route_ctx.rr_node_cong_inf[inode].occ() > rr_graph.node_capacity(RRNodeId(inode))) {
         //This node is congested
         return false;
     }
@@ -486,13 +649,13 @@ void RouteTree::print(void) const {
  * This routine returns a tuple: RouteTreeNode of the branch it adds to the route tree and
  * RouteTreeNode of the SINK it adds to the routing. */
 std::tuple<vtr::optional<const RouteTreeNode&>, vtr::optional<const RouteTreeNode&>>
-RouteTree::update_from_heap(t_heap* hptr, int target_net_pin_index, SpatialRouteTreeLookup* spatial_rt_lookup, bool is_flat) {
+RouteTree::update_from_heap(t_heap* hptr, int target_net_pin_index, SpatialRouteTreeLookup* spatial_rt_lookup, bool is_flat, const t_rr_node_route_inf_vector& rr_node_route_inf) {
     /* Lock the route tree for writing. At least on Linux this shouldn't have an impact on single-threaded code */
     std::unique_lock<std::mutex> write_lock(_write_mutex);
 
     //Create a new subtree from the target in hptr to existing routing
     vtr::optional<RouteTreeNode&> start_of_new_subtree_rt_node, sink_rt_node;
-    std::tie(start_of_new_subtree_rt_node, sink_rt_node) = add_subtree_from_heap(hptr, target_net_pin_index, is_flat);
+    std::tie(start_of_new_subtree_rt_node, sink_rt_node) = add_subtree_from_heap(hptr, target_net_pin_index, is_flat, rr_node_route_inf);
 
     if (!start_of_new_subtree_rt_node)
         return {vtr::nullopt, *sink_rt_node};
@@ -500,7 +663,8 @@ RouteTree::update_from_heap(t_heap* hptr, int target_net_pin_index, SpatialRoute
     /* Reload timing values */
     reload_timing_unlocked(start_of_new_subtree_rt_node);
 
-    if (spatial_rt_lookup) {
+    /* add_node() already took care of our own lookup */
+    if (spatial_rt_lookup && spatial_rt_lookup != &_spatial_lookup) {
         update_route_tree_spatial_lookup_recur(*start_of_new_subtree_rt_node, *spatial_rt_lookup);
     }
 
@@ -515,10 +679,9 @@ RouteTree::update_from_heap(t_heap* hptr, int target_net_pin_index, SpatialRoute
  * to the SINK indicated by hptr. Returns the first (most upstream) new rt_node,
  * and the rt_node of the new SINK. Traverses up from SINK  */
 std::tuple<vtr::optional<RouteTreeNode&>, vtr::optional<RouteTreeNode&>>
-RouteTree::add_subtree_from_heap(t_heap* hptr, int target_net_pin_index, bool is_flat) {
+RouteTree::add_subtree_from_heap(t_heap* hptr, int target_net_pin_index, bool is_flat, const t_rr_node_route_inf_vector& rr_node_route_inf) {
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
-    auto& route_ctx = g_vpr_ctx.routing();
 
     RRNodeId sink_inode = RRNodeId(hptr->index);
 
@@ -543,7 +706,7 @@ RouteTree::add_subtree_from_heap(t_heap* hptr, int target_net_pin_index, bool is
     while (!_rr_node_to_rt_node.count(new_inode)) {
         new_branch_inodes.push_back(new_inode);
         new_branch_iswitches.push_back(new_iswitch);
-        edge = route_ctx.rr_node_route_inf[new_inode].prev_edge;
+        edge = rr_node_route_inf[new_inode].prev_edge;
         new_inode = rr_graph.edge_src_node(edge);
         new_iswitch = RRSwitchId(rr_graph.rr_nodes().edge_switch(edge));
     }
@@ -559,7 +722,7 @@ RouteTree::add_subtree_from_heap(t_heap* hptr, int target_net_pin_index, bool is
      * ---
      * Walk through new_branch_iswitches and corresponding new_branch_inodes. */
     for (int i = new_branch_inodes.size() - 1; i >= 0; i--) {
-        RouteTreeNode* new_node = new RouteTreeNode(new_branch_inodes[i], new_branch_iswitches[i], last_node);
+        RouteTreeNode* new_node = _arena.alloc(new_branch_inodes[i], new_branch_iswitches[i], last_node);
 
         e_rr_type node_type = rr_graph.node_type(new_branch_inodes[i]);
         // If is_flat is enabled, IPINs should be added, since they are used for intra-cluster routing
@@ -622,7 +785,7 @@ void RouteTree::add_non_configurable_nodes(RouteTreeNode* rt_node,
 
         RRSwitchId edge_switch(rr_graph.edge_switch(rr_node, iedge));
 
-        RouteTreeNode* new_node = new RouteTreeNode(to_rr_node, edge_switch, rt_node);
+        RouteTreeNode* new_node = _arena.alloc(to_rr_node, edge_switch, rt_node);
         add_node(rt_node, new_node);
 
         new_node->net_pin_index = OPEN;
@@ -654,7 +817,7 @@ RouteTree::prune(CBRR& connections_inf, std::vector<int>* non_config_node_set_us
 
     VTR_ASSERT_MSG(_net_id, "RouteTree must be constructed using a ParentNetId");
 
-    VTR_ASSERT_MSG(route_ctx.rr_node_route_inf[root().inode].occ() <= rr_graph.node_capacity(root().inode),
+    VTR_ASSERT_MSG(route_ctx.rr_node_cong_inf[root().inode].occ() <= rr_graph.node_capacity(root().inode),
                    "Route tree root/SOURCE should never be congested");
 
     auto pruned_node = prune_x(*_root, connections_inf, false, non_config_node_set_usage);
@@ -672,7 +835,7 @@ RouteTree::prune_x(RouteTreeNode& rt_node, CBRR& connections_inf, bool force_pru
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
     auto& route_ctx = g_vpr_ctx.routing();
-    bool congested = (route_ctx.rr_node_route_inf[rt_node.inode].occ() > rr_graph.node_capacity(rt_node.inode));
+    bool congested = (route_ctx.rr_node_cong_inf[rt_node.inode].occ() > rr_graph.node_capacity(rt_node.inode));
 
     int node_set = -1;
     auto itr = device_ctx.rr_node_to_non_config_node_set.find(rt_node.inode);
@@ -78,13 +78,20 @@
  * or a search may be required to find a certain SINK.
  *
  * When the occupancy and timing data is up to date, a tree can be sanity checked using RouteTree::is_valid().
+ *
+ * High fanout nets also keep a spatial lookup of their nodes (see RouteTree::spatial_lookup()). Once built, it is
+ * kept up to date as nodes are added and pruned (and carried over by copies), instead of being rebuilt each time the
+ * net is routed.
  */
 
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <memory>
 #include <mutex>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #include "connection_based_routing_fwd.h"
 #include "route_tree_fwd.h"
@@ -101,6 +108,7 @@
  * Structure describing one node in a RouteTree. */
 class RouteTreeNode {
     friend class RouteTree;
+    friend class RouteTreeArena;
 
   public:
     RouteTreeNode() = delete;
@@ -320,6 +328,87 @@ class RouteTreeNode {
     };
 };
 
+/**
+ * @brief Node storage for a RouteTree.
+ *
+ * Nodes are carved out of a few chunks of doubling size instead of being allocated one by one,
+ * and freed nodes are recycled through a free list. Node addresses are stable for the lifetime
+ * of the arena (until clear() or copy_from()).
+ *
+ * Copying an arena copies its chunks wholesale and relocates the links inside the copied nodes,
+ * which is much cheaper than rebuilding a tree node by node. When the destination arena already
+ * has enough chunks (e.g. when overwriting a saved copy of the routing), no memory is allocated. */
+class RouteTreeArena {
+  public:
+    RouteTreeArena() = default;
+    RouteTreeArena(const RouteTreeArena&) = delete;
+    RouteTreeArena& operator=(const RouteTreeArena&) = delete;
+    RouteTreeArena(RouteTreeArena&& rhs) noexcept;
+    RouteTreeArena& operator=(RouteTreeArena&& rhs) noexcept;
+
+    /** Construct a new node in the arena */
+    template<typename... Args>
+    inline RouteTreeNode* alloc(Args&&... args) {
+        void* p;
+        if (_free) {
+            p = _free;
+            _free = _free->_next;
+        } else {
+            if (_num_active == 0 || _active_used == chunk_size(_num_active - 1))
+                next_chunk();
+            p = &_chunks[_num_active - 1][_active_used++];
+        }
+        return new (p) RouteTreeNode(std::forward<Args>(args)...);
+    }
+
+    /** Return a node to the arena. The node should be unlinked from its tree */
+    inline void free(RouteTreeNode* node) {
+        node->_parent = nullptr;
+        node->_prev = nullptr;
+        node->_subtree_end = nullptr;
+        node->_next = _free;
+        _free = node;
+    }
+
+    /** Drop all nodes, but keep the memory for reuse */
+    void clear();
+
+    /** Make this a copy of \p rhs. Use relocate() to translate node ptrs into rhs to this arena */
+    void copy_from(const RouteTreeArena& rhs);
+
+    /** Translate a ptr to a node in \p rhs to the same node in this arena (after copy_from(rhs)) */
+    RouteTreeNode* relocate(const RouteTreeArena& rhs, const RouteTreeNode* node) const;
+
+  private:
+    using Slot = typename std::aligned_storage<sizeof(RouteTreeNode), alignof(RouteTreeNode)>::type;
+
+    /** Nodes are bitwise copied and never destroyed */
+    static_assert(std::is_trivially_copyable<RouteTreeNode>::value, "RouteTreeNode should be trivially copyable");
+    static_assert(std::is_trivially_destructible<RouteTreeNode>::value, "RouteTreeNode should be trivially destructible");
+
+    /** Size of the first chunk. Most nets are small, so start with a few nodes */
+    static constexpr size_t FIRST_CHUNK_SIZE = 8;
+
+    static constexpr size_t chunk_size(size_t ichunk) { return FIRST_CHUNK_SIZE << ichunk; }
+
+    /** Start allocating from the next chunk, allocating it if needed */
+    void next_chunk();
+
+    /** Which chunk holds \p node? */
+    size_t find_chunk(const RouteTreeNode* node) const;
+
+    /** Chunk i holds chunk_size(i) nodes */
+    std::vector<std::unique_ptr<Slot[]>> _chunks;
+    /** (start address, index) of each chunk sorted by address, for relocate() */
+    std::vector<std::pair<const Slot*, size_t>> _chunks_by_address;
+    /** Number of chunks [0.._num_active) in use. The last one may be partially used */
+    size_t _num_active = 0;
+    /** Number of slots used in the last active chunk */
+    size_t _active_used = 0;
+    /** Freed nodes, linked through their _next ptrs */
+    RouteTreeNode* _free = nullptr;
+};
+
 /** fwd definition for compatibility class in old_traceback.h */
 class TracebackCompat;
 
@@ -344,20 +433,39 @@ class RouteTree {
      * Use this constructor where possible (needed for prune() to work) */
     RouteTree(ParentNetId inet);
 
-    ~RouteTree() {
-        std::unique_lock<std::mutex> write_lock(_write_mutex);
-        free_list(_root);
-    }
+    /** A RouteTreeNode in a flat list of the nodes of a tree (see to_records()) */
+    struct NodeRecord {
+        RRNodeId inode;
+        RRSwitchId parent_switch;
+        /** Index of the parent in the list (-1 for the root) */
+        int parent;
+        int net_pin_index;
+        float Tdel;
+        float R_upstream;
+        float C_downstream;
+        bool re_expand;
+    };
+
+    /** Return a RouteTree of nets[inet] rebuilt from the to_records() of another one.
+     * The nodes, their order and their timing values are restored as they were: this is how the
+     * distributed router sends trees to other processes */
+    RouteTree(ParentNetId inet, const std::vector<NodeRecord>& records);
+
+    ~RouteTree() = default;
 
     /** Add the most recently finished wire segment to the routing tree, and
      * update the Tdel, etc. numbers for the rest of the routing tree. hptr
      * is the heap pointer of the SINK that was reached, and target_net_pin_index
      * is the net pin index corresponding to the SINK that was reached. This routine
      * returns a tuple: RouteTreeNode of the branch it adds to the route tree and
-     * RouteTreeNode of the SINK it adds to the routing.
+     * RouteTreeNode of the SINK it adds to the routing. The path is traced back
+     * through \p rr_node_route_inf, which should be the search state of the
+     * router which found hptr (see ConnectionRouter::get_rr_node_route_inf()).
+     * The new nodes are added to the tree's own spatial lookup (if it has one), and also to
+     * spatial_rt_lookup if it is another lookup.
      * Locking operation: only one thread can update_from_heap() a RouteTree at a time. */
     std::tuple<vtr::optional<const RouteTreeNode&>, vtr::optional<const RouteTreeNode&>>
-    update_from_heap(t_heap* hptr, int target_net_pin_index, SpatialRouteTreeLookup* spatial_rt_lookup, bool is_flat);
+    update_from_heap(t_heap* hptr, int target_net_pin_index, SpatialRouteTreeLookup* spatial_rt_lookup, bool is_flat, const t_rr_node_route_inf_vector& rr_node_route_inf);
 
     /** Reload timing values (R_upstream, C_downstream, Tdel).
      * Can take a RouteTreeNode& to do an incremental update.
@@ -377,6 +485,13 @@ class RouteTree {
         return x ? vtr::optional<const RouteTreeNode&>(*x) : vtr::nullopt;
     }
 
+    /** Get a spatial lookup of the nodes in this tree, with num_bins (x, y) bins (see route_tree_spatial_lookup_num_bins()).
+     * The lookup is only (re)built if the tree has none with num_bins bins: it is otherwise kept up to date
+     * as nodes are added to and removed from the tree. Passing {0, 0} bins drops the lookup.
+     * The lookup should only be modified by the tree, and not be read while another thread updates the tree.
+     * Locking operation: only one thread can spatial_lookup() a RouteTree at a time. */
+    SpatialRouteTreeLookup& spatial_lookup(const std::array<size_t, 2>& num_bins);
+
     /** Get the number of sinks in associated net. */
     constexpr size_t num_sinks(void) const {
         return _num_sinks;
@@ -419,6 +534,10 @@ class RouteTree {
     /** Get an iterable for all nodes in this RouteTree. */
     constexpr iterable all_nodes(void) const { return iterable(_root, nullptr); }
 
+    /** Get the nodes of this tree in depth-first order, each pointing to its parent by index.
+     * The tree can be rebuilt from the list by the RouteTree(ParentNetId, records) constructor */
+    std::vector<NodeRecord> to_records(void) const;
+
     /** Get a reference to the root RouteTreeNode. */
     constexpr const RouteTreeNode& root(void) const { return *_root; } /* this file is 90% const and 10% code */
 
@@ -433,19 +552,18 @@ class RouteTree {
         using pointer = int*;
         using reference = int&;
 
-        constexpr IsinkIterator(const vtr::dynamic_bitset<>& bitset, size_t x)
+        constexpr IsinkIterator(const vtr::dynamic_bitset<>& bitset, size_t x, size_t end)
             : _bitset(bitset)
-            , _x(x) {
-            if (_x < _bitset.size() && _bitset.get(_x) != sink_state) /* Iterate forward to a valid state */
-                ++(*this);
+            , _x(x)
+            , _end(end) {
+            if (_x < _end) /* Iterate forward to a valid state */
+                seek(_x);
         }
         constexpr value_type operator*() const {
             return _x;
         }
         inline IsinkIterator& operator++() {
-            _x++;
-            for (; _x < _bitset.size() && _bitset.get(_x) != sink_state; _x++)
-                ;
+            seek(_x + 1);
             return *this;
         }
         inline IsinkIterator operator++(int) {
@@ -457,10 +575,17 @@ class RouteTree {
         constexpr bool operator!=(const IsinkIterator& rhs) { return _x != rhs._x; }
 
       private:
+        /** Move to the first position at or after \p pos with the right sink state (or to the end) */
+        inline void seek(size_t pos) {
+            _x = std::min(sink_state ? _bitset.find_next_set(pos) : _bitset.find_next_unset(pos), _end);
+        }
+
         /** Ref to the bitset */
         const vtr::dynamic_bitset<>& _bitset;
         /** Current position */
         size_t _x;
+        /** One past the last position */
+        size_t _end;
     };
 
     typedef vtr::Range<IsinkIterator<true>> reached_isink_range;
@@ -479,19 +604,19 @@ class RouteTree {
      * Otherwise it doesn't guarantee legality.
      * Builds and returns a value: use get_is_isink_reached directly if you want speed. */
     constexpr reached_isink_range get_reached_isinks(void) const {
-        return vtr::make_range(IsinkIterator<true>(_is_isink_reached, 1), IsinkIterator<true>(_is_isink_reached, _num_sinks + 1));
+        return vtr::make_range(IsinkIterator<true>(_is_isink_reached, 1, _num_sinks + 1), IsinkIterator<true>(_is_isink_reached, _num_sinks + 1, _num_sinks + 1));
     }
 
     /** Get remaining (not routed (legally?)) isinks:
      * 1-indexed pin indices enumerating the sinks in this net.
      * Caveats in get_reached_isinks() apply. */
     constexpr remaining_isink_range get_remaining_isinks(void) const {
-        return vtr::make_range(IsinkIterator<false>(_is_isink_reached, 1), IsinkIterator<false>(_is_isink_reached, _num_sinks + 1));
+        return vtr::make_range(IsinkIterator<false>(_is_isink_reached, 1, _num_sinks + 1), IsinkIterator<false>(_is_isink_reached, _num_sinks + 1, _num_sinks + 1));
     }
 
   private:
     std::tuple<vtr::optional<RouteTreeNode&>, vtr::optional<RouteTreeNode&>>
-    add_subtree_from_heap(t_heap* hptr, int target_net_pin_index, bool is_flat);
+    add_subtree_from_heap(t_heap* hptr, int target_net_pin_index, bool is_flat, const t_rr_node_route_inf_vector& rr_node_route_inf);
 
     void add_non_configurable_nodes(RouteTreeNode* rt_node,
                                     bool reached_by_non_configurable_edge,
@@ -538,26 +663,17 @@ class RouteTree {
         /** If node is a SINK (net_pin_index > 0), also add it to sink RT lookup */
         if (node->net_pin_index > 0 && _net_id.is_valid())
             _isink_to_rt_node[node->net_pin_index - 1] = node;
+        /** Add node to the spatial lookup, if there is one */
+        if (!_spatial_lookup.empty())
+            add_route_tree_node_to_spatial_lookup(*node, _spatial_lookup);
 
         /* Now it's a branch */
         parent->_is_leaf = false;
     }
 
-    /** Free all nodes after node */
-    inline void free_list(RouteTreeNode* node) {
-        RouteTreeNode* p = node;
-        while (p) {
-            RouteTreeNode* x = p;
-            p = p->_next;
-            free_node(x);
-        }
-    }
-
-    /** Make a copy of rhs and return it. Updates _rr_node_to_rt_node */
-    RouteTreeNode* copy_tree(const RouteTreeNode* rhs);
-
-    /** Helper for copy_list: copy child nodes of rhs into lhs */
-    void copy_tree_x(RouteTreeNode* lhs, const RouteTreeNode& rhs);
+    /** Make this a copy of rhs: copy its node arena and relocate all ptrs into it.
+     * Doesn't lock anything */
+    void copy_from(const RouteTree& rhs);
 
     /** Free a node. Only keeps the linked list valid (not the tree ptrs) */
     inline void free_node(RouteTreeNode* node) {
@@ -565,7 +681,11 @@ class RouteTree {
             node->_prev->_next = node->_next;
         if (node->_next)
             node->_next->_prev = node->_prev;
-        delete node;
+        if (node->net_pin_index > 0 && _net_id.is_valid() && _isink_to_rt_node[node->net_pin_index - 1] == node)
+            _isink_to_rt_node[node->net_pin_index - 1] = nullptr;
+        if (!_spatial_lookup.empty())
+            remove_route_tree_node_from_spatial_lookup(*node, _spatial_lookup);
+        _arena.free(node);
     }
 
     /** Iterate through parent's child nodes and remove if p returns true.
@@ -603,6 +723,9 @@ class RouteTree {
             parent._is_leaf = true;
     }
 
+    /** Storage for the nodes of this tree */
+    RouteTreeArena _arena;
+
     /** Root node.
      * This is also the internal node list via the ptrs in RouteTreeNode. */
     RouteTreeNode* _root;
@@ -637,6 +760,9 @@ class RouteTree {
     /** Number of sinks in this tree's net. Useful for iteration. */
     size_t _num_sinks;
 
+    /** Spatial lookup of the nodes in this tree (see spatial_lookup()). Empty if it was never built */
+    SpatialRouteTreeLookup _spatial_lookup;
+
     /** Write mutex on this RouteTree. Acquired by the write operations automatically:
      * the caller does not need to know about a lock. */
     std::mutex _write_mutex;
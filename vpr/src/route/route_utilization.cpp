@@ -47,7 +47,7 @@ vtr::Matrix<float> calculate_routing_usage(t_rr_type rr_type, bool is_flat, bool
 
             int y = rr_graph.node_ylow(rr_node);
             for (int x = rr_graph.node_xlow(rr_node); x <= rr_graph.node_xhigh(rr_node); ++x) {
-                usage[x][y] += route_ctx.rr_node_route_inf[rr_node].occ();
+                usage[x][y] += route_ctx.rr_node_cong_inf[rr_node].occ();
             }
         } else {
             VTR_ASSERT(rr_type == CHANY);
@@ -56,7 +56,7 @@ vtr::Matrix<float> calculate_routing_usage(t_rr_type rr_type, bool is_flat, bool
 
             int x = rr_graph.node_xlow(rr_node);
             for (int y = rr_graph.node_ylow(rr_node); y <= rr_graph.node_yhigh(rr_node); ++y) {
-                usage[x][y] += route_ctx.rr_node_route_inf[rr_node].occ();
+                usage[x][y] += route_ctx.rr_node_cong_inf[rr_node].occ();
             }
         }
     }
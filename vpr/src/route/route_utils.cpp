@@ -15,6 +15,9 @@
 #include "VprTimingGraphResolver.h"
 #include "tatum/TimingReporter.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 bool check_net_delays(const Netlist<>& net_list, NetPinsMatrix<float>& net_delay) {
     constexpr float ERROR_TOL = 0.0001;
 
@@ -359,6 +362,50 @@ void print_route_status_header() {
     VTR_LOG("---- ------ ------- ---- ------- ------- ------- ----------------- --------------- -------- ---------- ---------- ---------- ---------- --------\n");
 }
 
+void print_route_load_balance(int itry, const RouteLoadBalance& load_balance) {
+    const auto& busy_sec = load_balance.thread_busy_sec;
+    if (busy_sec.empty())
+        return;
+
+    auto [min_busy, max_busy] = std::minmax_element(busy_sec.begin(), busy_sec.end());
+    auto [min_nets, max_nets] = std::minmax_element(load_balance.thread_nets_routed.begin(), load_balance.thread_nets_routed.end());
+    auto [min_pops, max_pops] = std::minmax_element(load_balance.thread_heap_pops.begin(), load_balance.thread_heap_pops.end());
+    float avg_busy = std::accumulate(busy_sec.begin(), busy_sec.end(), 0.f) / busy_sec.size();
+
+    VTR_LOG("Iteration %d load balance: %zu threads busy %.3f/%.3f/%.3f sec (min/avg/max) of %.3f sec (%.1f%% utilization),"
+            " nets routed %zu-%zu, heap pops %zu-%zu, partition tree root %.3f sec, critical path %.3f sec\n",
+            itry, busy_sec.size(), *min_busy, avg_busy, *max_busy, load_balance.wall_sec, 100. * load_balance.utilization(),
+            *min_nets, *max_nets, *min_pops, *max_pops, load_balance.root_sec, load_balance.critical_path_sec);
+}
+
+void print_router_profile(const RouterProfile& profile) {
+    size_t wasted_expansions = profile.sink_expansions - std::min(profile.path_nodes, profile.sink_expansions);
+
+    VTR_LOG("Router Profile: connections: %zu expansions per connection: %.1f wasted expansions: %.1f%% bounding box retries: %zu\n",
+            profile.connections,
+            profile.connections ? double(profile.sink_expansions) / profile.connections : 0.,
+            profile.sink_expansions ? 100. * wasted_expansions / profile.sink_expansions : 0.,
+            profile.bb_retries);
+
+    print_lookahead_error_histogram(profile, "path cost / lookahead estimate from source");
+}
+
+void print_lookahead_error_histogram(const RouterProfile& profile, const char* error_name) {
+    size_t num_estimated = std::accumulate(profile.lookahead_error_bins.begin(), profile.lookahead_error_bins.end(), size_t(0));
+    VTR_LOG("Lookahead error (%s) of %zu connections:\n", error_name, num_estimated);
+    for (size_t bin = 0; bin < RouterProfile::NUM_LOOKAHEAD_ERROR_BINS; bin++) {
+        float lower = (bin == 0) ? 0. : RouterProfile::LOOKAHEAD_ERROR_BIN_BOUNDS[bin - 1];
+        std::string range;
+        if (bin < RouterProfile::LOOKAHEAD_ERROR_BIN_BOUNDS.size()) {
+            range = vtr::string_fmt("[%5.2f, %5.2f)", lower, RouterProfile::LOOKAHEAD_ERROR_BIN_BOUNDS[bin]);
+        } else {
+            range = vtr::string_fmt("[%5.2f,   inf)", lower);
+        }
+        VTR_LOG("  %s %10zu (%5.1f%%)\n", range.c_str(), profile.lookahead_error_bins[bin],
+                num_estimated ? 100. * profile.lookahead_error_bins[bin] / num_estimated : 0.);
+    }
+}
+
 void print_router_criticality_histogram(const Netlist<>& net_list,
                                         const SetupTimingInfo& timing_info,
                                         const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
@@ -386,14 +433,14 @@ void prune_unused_non_configurable_nets(CBRR& connections_inf,
     }
 }
 
-vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>> set_nets_choking_spots(const Netlist<>& net_list,
+vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>> set_nets_choking_spots(const Netlist<>& net_list,
                                                                                                 const vtr::vector<ParentNetId,
                                                                                                                   std::vector<std::vector<int>>>& net_terminal_groups,
                                                                                                 const vtr::vector<ParentNetId,
                                                                                                                   std::vector<int>>& net_terminal_group_num,
                                                                                                 bool has_choking_spot,
                                                                                                 bool is_flat) {
-    vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>> choking_spots(net_list.nets().size());
+    vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>> choking_spots(net_list.nets().size());
     for (const auto& net_id : net_list.nets()) {
         choking_spots[net_id].resize(net_list.net_pins(net_id).size());
     }
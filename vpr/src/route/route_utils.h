@@ -95,6 +95,15 @@ void print_route_status(int itry, double elapsed_sec, float pres_fac, int num_bb
 
 void print_route_status_header();
 
+/** Print the load balance of a parallel routing iteration (nothing for the serial router) */
+void print_route_load_balance(int itry, const RouteLoadBalance& load_balance);
+
+/** Print the per connection counters of the connection router (\see RouterProfile) */
+void print_router_profile(const RouterProfile& profile);
+
+/** Print the lookahead error histogram of profile, error_name describes the ratio binned */
+void print_lookahead_error_histogram(const RouterProfile& profile, const char* error_name);
+
 void print_router_criticality_histogram(const Netlist<>& net_list,
                                         const SetupTimingInfo& timing_info,
                                         const ClusteredPinAtomPinsLookup& netlist_pin_lookup,
@@ -118,7 +127,7 @@ void prune_unused_non_configurable_nets(CBRR& connections_inf,
  * @param has_choking_spot is true if the given architecture has choking spots inside the cluster
  * @param is_flat is true if flat_routing is enabled
  * @return [Net_id][pin_id] -> [choke_point_rr_node_id, number of sinks reachable by this choke point] */
-vtr::vector<ParentNetId, std::vector<std::unordered_map<RRNodeId, int>>> set_nets_choking_spots(const Netlist<>& net_list,
+vtr::vector<ParentNetId, std::vector<vtr::id_hash_map<RRNodeId, int>>> set_nets_choking_spots(const Netlist<>& net_list,
                                                                                                 const vtr::vector<ParentNetId,
                                                                                                                   std::vector<std::vector<int>>>& net_terminal_groups,
                                                                                                 const vtr::vector<ParentNetId,
@@ -12,6 +12,7 @@ RouterDelayProfiler::RouterDelayProfiler(const Netlist<>& net_list,
                                          const RouterLookahead* lookahead,
                                          bool is_flat)
     : net_list_(net_list)
+    , lookahead_(lookahead)
     , router_(
           g_vpr_ctx.device().grid,
           *lookahead,
@@ -48,6 +49,27 @@ RouterDelayProfiler::RouterDelayProfiler(const Netlist<>& net_list,
     }
 }
 
+RouterDelayProfiler::RouterDelayProfiler(const RouterDelayProfiler& parent, t_worker_tag)
+    : net_list_(parent.net_list_)
+    , lookahead_(parent.lookahead_)
+    , worker_rr_node_route_inf_(std::make_unique<t_rr_node_route_inf_vector>(g_vpr_ctx.routing().rr_node_route_inf))
+    , router_(
+          g_vpr_ctx.device().grid,
+          *parent.lookahead_,
+          g_vpr_ctx.device().rr_graph.rr_nodes(),
+          &g_vpr_ctx.device().rr_graph,
+          g_vpr_ctx.device().rr_rc_data,
+          g_vpr_ctx.device().rr_graph.rr_switch(),
+          *worker_rr_node_route_inf_,
+          parent.is_flat_)
+    , min_delays_(parent.min_delays_)
+    , is_flat_(parent.is_flat_) {
+}
+
+std::unique_ptr<RouterDelayProfiler> RouterDelayProfiler::make_worker() const {
+    return std::unique_ptr<RouterDelayProfiler>(new RouterDelayProfiler(*this, t_worker_tag()));
+}
+
 bool RouterDelayProfiler::calculate_delay(RRNodeId source_node,
                                           RRNodeId sink_node,
                                           const t_router_opts& router_opts,
@@ -72,10 +94,12 @@ bool RouterDelayProfiler::calculate_delay(RRNodeId source_node,
     //rr_node_arch_name(sink_node).c_str()));
 
     RouteTree tree((RRNodeId(source_node)));
-    enable_router_debug(router_opts, ParentNetId(), sink_node, 0, &router_);
+    if (!worker_rr_node_route_inf_) {
+        enable_router_debug(router_opts, ParentNetId(), sink_node, 0, &router_);
 
-    /* Update base costs according to fanout and criticality rules */
-    update_rr_base_costs(1);
+        /* Update base costs according to fanout and criticality rules */
+        update_rr_base_costs(1);
+    }
 
     //maximum bounding box for placement
     t_bb bounding_box;
@@ -107,7 +131,7 @@ bool RouterDelayProfiler::calculate_delay(RRNodeId source_node,
     ConnectionParameters conn_params(ParentNetId::INVALID(),
                                      -1,
                                      false,
-                                     std::unordered_map<RRNodeId, int>());
+                                     vtr::id_hash_map<RRNodeId, int>());
     std::tie(found_path, std::ignore, cheapest) = router_.timing_driven_route_connection_from_route_tree(
         tree.root(),
         sink_node,
@@ -120,12 +144,12 @@ bool RouterDelayProfiler::calculate_delay(RRNodeId source_node,
         VTR_ASSERT(cheapest.index == sink_node);
 
         vtr::optional<const RouteTreeNode&> rt_node_of_sink;
-        std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&cheapest, OPEN, nullptr, is_flat_);
+        std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&cheapest, OPEN, nullptr, is_flat_, router_.get_rr_node_route_inf());
 
         //find delay
         *net_delay = rt_node_of_sink->Tdel;
 
-        VTR_ASSERT_MSG(route_ctx.rr_node_route_inf[tree.root().inode].occ() <= rr_graph.node_capacity(tree.root().inode), "SOURCE should never be congested");
+        VTR_ASSERT_MSG(route_ctx.rr_node_cong_inf[tree.root().inode].occ() <= rr_graph.node_capacity(tree.root().inode), "SOURCE should never be congested");
     }
 
     //VTR_LOG("Explored %zu of %zu (%.2f) RR nodes: path delay %g\n", router_stats.heap_pops, device_ctx.rr_nodes.size(), float(router_stats.heap_pops) / device_ctx.rr_nodes.size(), *net_delay);
@@ -145,7 +169,8 @@ float RouterDelayProfiler::get_min_delay(int physical_tile_type_idx, int from_la
 //Returns the shortest path delay from src_node to all RR nodes in the RR graph, or NaN if no path exists
 vtr::vector<RRNodeId, float> calculate_all_path_delays_from_rr_node(RRNodeId src_rr_node,
                                                                     const t_router_opts& router_opts,
-                                                                    bool is_flat) {
+                                                                    bool is_flat,
+                                                                    t_rr_node_route_inf_vector* rr_node_route_inf) {
     auto& device_ctx = g_vpr_ctx.device();
     auto& route_ctx = g_vpr_ctx.mutable_routing();
 
@@ -170,8 +195,8 @@ vtr::vector<RRNodeId, float> calculate_all_path_delays_from_rr_node(RRNodeId src
     //be also passed
     VTR_ASSERT(is_flat == false);
     t_det_routing_arch det_routing_arch;
-    auto router_lookahead = make_router_lookahead(det_routing_arch, e_router_lookahead::NO_OP,
-                                                  /*write_lookahead=*/"", /*read_lookahead=*/"",
+    auto router_lookahead = make_router_lookahead(det_routing_arch, e_router_lookahead::NO_OP, /*half_precision=*/false,
+                                                  /*write_lookahead=*/"", /*read_lookahead=*/"", /*lookahead_cache_dir=*/"",
                                                   /*segment_inf=*/{},
                                                   is_flat);
 
@@ -182,10 +207,10 @@ vtr::vector<RRNodeId, float> calculate_all_path_delays_from_rr_node(RRNodeId src
         &g_vpr_ctx.device().rr_graph,
         device_ctx.rr_rc_data,
         device_ctx.rr_graph.rr_switch(),
-        route_ctx.rr_node_route_inf,
+        rr_node_route_inf ? *rr_node_route_inf : route_ctx.rr_node_route_inf,
         is_flat);
     RouterStats router_stats;
-    ConnectionParameters conn_params(ParentNetId::INVALID(), OPEN, false, std::unordered_map<RRNodeId, int>());
+    ConnectionParameters conn_params(ParentNetId::INVALID(), OPEN, false, vtr::id_hash_map<RRNodeId, int>());
     vtr::vector<RRNodeId, t_heap> shortest_paths = router.timing_driven_find_all_shortest_paths_from_route_tree(tree.root(),
                                                                                                                 cost_params,
                                                                                                                 bounding_box,
@@ -205,7 +230,7 @@ vtr::vector<RRNodeId, float> calculate_all_path_delays_from_rr_node(RRNodeId src
             //Build the routing tree to get the delay
             tree = RouteTree(RRNodeId(src_rr_node));
             vtr::optional<const RouteTreeNode&> rt_node_of_sink;
-            std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&shortest_paths[sink_rr_node], OPEN, nullptr, router_opts.flat_routing);
+            std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&shortest_paths[sink_rr_node], OPEN, nullptr, router_opts.flat_routing, router.get_rr_node_route_inf());
 
             VTR_ASSERT(rt_node_of_sink->inode == RRNodeId(sink_rr_node));
 
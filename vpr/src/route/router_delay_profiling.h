@@ -5,6 +5,7 @@
 #include "binary_heap.h"
 #include "connection_router.h"
 
+#include <memory>
 #include <vector>
 
 class RouterDelayProfiler {
@@ -42,17 +43,42 @@ class RouterDelayProfiler {
      */
     float get_min_delay(int physical_tile_type_idx, int from_layer, int to_layer, int dx, int dy) const;
 
+    /**
+     * @brief Returns a new profiler which can be used concurrently with this one (and with other workers).
+     *
+     * A worker routes on its own copy of the rr node route info instead of the one in the routing context,
+     * and does not update the (global) rr base costs or router debug state; the caller must call
+     * update_rr_base_costs(1) before using workers.
+     */
+    std::unique_ptr<RouterDelayProfiler> make_worker() const;
+
+    /**
+     * @return The rr node route info this profiler routes on if it is a worker, or nullptr if it uses the
+     * one in the routing context.
+     */
+    t_rr_node_route_inf_vector* worker_rr_node_route_inf() const { return worker_rr_node_route_inf_.get(); }
+
   private:
+    struct t_worker_tag {};
+    RouterDelayProfiler(const RouterDelayProfiler& parent, t_worker_tag);
+
     const Netlist<>& net_list_;
+    const RouterLookahead* lookahead_;
     RouterStats router_stats_;
+    std::unique_ptr<t_rr_node_route_inf_vector> worker_rr_node_route_inf_; // Only set for workers
     ConnectionRouter<BinaryHeap> router_;
     vtr::NdMatrix<float, 5> min_delays_; // [physical_type_idx][from_layer][to_layer][dx][dy]
     bool is_flat_;
 };
 
+/**
+ * @brief Returns the shortest path delay from src_node to all RR nodes in the RR graph, or NaN if no path exists.
+ * @param rr_node_route_inf The rr node route info to route on; the one in the routing context if nullptr.
+ */
 vtr::vector<RRNodeId, float> calculate_all_path_delays_from_rr_node(RRNodeId src_rr_node,
                                                                     const t_router_opts& router_opts,
-                                                                    bool is_flat);
+                                                                    bool is_flat,
+                                                                    t_rr_node_route_inf_vector* rr_node_route_inf = nullptr);
 
 void alloc_routing_structs(const t_chan_width& chan_width,
                            const t_router_opts& router_opts,
@@ -6,6 +6,14 @@
 #include "router_lookahead_extended_map.h"
 #include "vpr_error.h"
 #include "globals.h"
+#include "vtr_digest.h"
+#include "vtr_log.h"
+#include "vtr_util.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <sstream>
+#include <unistd.h>
 
 /**
  * Assuming inode is CHANX or CHANY, this function calculates the number of required wires of the same type as inode
@@ -21,11 +29,12 @@ static int round_up(float x);
 
 static std::unique_ptr<RouterLookahead> make_router_lookahead_object(const t_det_routing_arch& det_routing_arch,
                                                                      e_router_lookahead router_lookahead_type,
+                                                                     bool half_precision,
                                                                      bool is_flat) {
     if (router_lookahead_type == e_router_lookahead::CLASSIC) {
         return std::make_unique<ClassicLookahead>();
     } else if (router_lookahead_type == e_router_lookahead::MAP) {
-        return std::make_unique<MapLookahead>(det_routing_arch, is_flat);
+        return std::make_unique<MapLookahead>(det_routing_arch, is_flat, half_precision);
     } else if (router_lookahead_type == e_router_lookahead::COMPRESSED_MAP) {
         return std::make_unique<CompressedMapLookahead>(det_routing_arch, is_flat);
     } else if (router_lookahead_type == e_router_lookahead::EXTENDED_MAP) {
@@ -38,20 +47,139 @@ static std::unique_ptr<RouterLookahead> make_router_lookahead_object(const t_det
     return nullptr;
 }
 
+static bool lookahead_supports_cache(e_router_lookahead router_lookahead_type) {
+#ifdef VTR_ENABLE_CAPNPROTO
+    // Only these lookaheads implement both read() and write()
+    return router_lookahead_type == e_router_lookahead::MAP
+           || router_lookahead_type == e_router_lookahead::EXTENDED_MAP;
+#else
+    (void)router_lookahead_type;
+    return false;
+#endif
+}
+
+static bool intra_cluster_lookahead_supports_cache(e_router_lookahead router_lookahead_type) {
+#ifdef VTR_ENABLE_CAPNPROTO
+    // Only the map lookahead implements both read_intra_cluster() and write_intra_cluster()
+    return router_lookahead_type == e_router_lookahead::MAP;
+#else
+    (void)router_lookahead_type;
+    return false;
+#endif
+}
+
+/**
+ * @brief Returns the cache file of a lookahead in lookahead_cache_dir.
+ *
+ * @param kind The part of the lookahead stored in the file ("router_lookahead" for the
+ *             inter-cluster maps, "router_intra_cluster_lookahead" for the intra-cluster ones)
+ */
+static std::string get_router_lookahead_cache_file(const char* kind,
+                                                   const t_det_routing_arch& det_routing_arch,
+                                                   e_router_lookahead router_lookahead_type,
+                                                   bool half_precision,
+                                                   const std::string& lookahead_cache_dir,
+                                                   const std::vector<t_segment_inf>& segment_inf,
+                                                   bool is_flat) {
+    const auto& device_ctx = g_vpr_ctx.device();
+
+    // Everything the computed lookahead depends on goes into the key, so that the file
+    // name identifies its contents and a stale entry can never be picked up.
+    std::stringstream key;
+    key << "router_lookahead_cache_v1\n";
+    key << "kind " << kind << "\n";
+    key << "arch " << device_ctx.arch->architecture_id << "\n";
+    key << "lookahead " << int(router_lookahead_type) << " flat " << is_flat << " half " << half_precision << "\n";
+    key << "grid " << device_ctx.grid.name() << " " << device_ctx.grid.width() << " " << device_ctx.grid.height() << " " << device_ctx.grid.get_num_layers() << "\n";
+
+    const t_chan_width& chan_width = device_ctx.chan_width;
+    key << "chan_width " << chan_width.max;
+    for (int width : chan_width.x_list) key << " " << width;
+    key << " |";
+    for (int width : chan_width.y_list) key << " " << width;
+    key << "\n";
+
+    key << "routing_arch " << int(det_routing_arch.directionality) << " " << det_routing_arch.Fs << " " << int(det_routing_arch.switch_block_type)
+        << " " << det_routing_arch.switchblocks.size() << " " << det_routing_arch.wire_to_arch_ipin_switch << " " << det_routing_arch.wire_to_arch_ipin_switch_between_dice
+        << " " << det_routing_arch.R_minW_nmos << " " << det_routing_arch.R_minW_pmos << "\n";
+    if (!det_routing_arch.read_rr_graph_filename.empty()) {
+        key << "rr_graph " << vtr::secure_digest_file(det_routing_arch.read_rr_graph_filename) << "\n";
+    }
+
+    for (const t_segment_inf& seg : segment_inf) {
+        key << "segment " << seg.name << " " << seg.frequency << " " << seg.length
+            << " " << seg.arch_wire_switch << " " << seg.arch_opin_switch << " " << seg.arch_opin_between_dice_switch
+            << " " << seg.frac_cb << " " << seg.frac_sb << " " << seg.longline << " " << seg.Rmetal << " " << seg.Cmetal
+            << " " << int(seg.directionality) << " " << int(seg.parallel_axis) << " " << int(seg.res_type) << " ";
+        for (bool cb : seg.cb) key << cb;
+        key << " ";
+        for (bool sb : seg.sb) key << sb;
+        key << "\n";
+    }
+
+    std::string digest = vtr::secure_digest_stream(key);
+    // Drop the "SHA256:" prefix, which is not a valid file name character on every platform
+    digest = digest.substr(digest.find(':') + 1);
+
+    return (std::filesystem::path(lookahead_cache_dir) / (std::string(kind) + "_" + digest + ".capnp")).string();
+}
+
+static void write_router_lookahead_cache_file(const RouterLookahead& router_lookahead, const std::string& cache_file, bool intra_cluster) {
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(cache_file).parent_path(), ec);
+
+    // Write to a private temporary and rename it into place, so concurrent runs sharing
+    // the cache directory never observe a partially written file.
+    std::string tmp_file = cache_file + ".tmp" + std::to_string(getpid());
+    try {
+        if (intra_cluster) {
+            router_lookahead.write_intra_cluster(tmp_file);
+        } else {
+            router_lookahead.write(tmp_file);
+        }
+    } catch (const VprError& e) {
+        VTR_LOG_WARN("Failed to write router lookahead cache file '%s': %s\n", cache_file.c_str(), e.what());
+        std::remove(tmp_file.c_str());
+        return;
+    }
+
+    std::filesystem::rename(tmp_file, cache_file, ec);
+    if (ec) {
+        VTR_LOG_WARN("Failed to write router lookahead cache file '%s': %s\n", cache_file.c_str(), ec.message().c_str());
+        std::remove(tmp_file.c_str());
+        return;
+    }
+    VTR_LOG("Wrote router lookahead to cache file '%s'\n", cache_file.c_str());
+}
+
 std::unique_ptr<RouterLookahead> make_router_lookahead(const t_det_routing_arch& det_routing_arch,
                                                        e_router_lookahead router_lookahead_type,
+                                                       bool half_precision,
                                                        const std::string& write_lookahead,
                                                        const std::string& read_lookahead,
+                                                       const std::string& lookahead_cache_dir,
                                                        const std::vector<t_segment_inf>& segment_inf,
                                                        bool is_flat) {
     std::unique_ptr<RouterLookahead> router_lookahead = make_router_lookahead_object(det_routing_arch,
                                                                                      router_lookahead_type,
+                                                                                     half_precision,
                                                                                      is_flat);
 
-    if (read_lookahead.empty()) {
-        router_lookahead->compute(segment_inf);
-    } else {
+    std::string cache_file;
+    if (read_lookahead.empty() && !lookahead_cache_dir.empty() && lookahead_supports_cache(router_lookahead_type)) {
+        cache_file = get_router_lookahead_cache_file("router_lookahead", det_routing_arch, router_lookahead_type, half_precision, lookahead_cache_dir, segment_inf, is_flat);
+    }
+
+    if (!read_lookahead.empty()) {
         router_lookahead->read(read_lookahead);
+    } else if (!cache_file.empty() && vtr::file_exists(cache_file.c_str())) {
+        VTR_LOG("Reading router lookahead from cache file '%s'\n", cache_file.c_str());
+        router_lookahead->read(cache_file);
+    } else {
+        router_lookahead->compute(segment_inf);
+        if (!cache_file.empty()) {
+            write_router_lookahead_cache_file(*router_lookahead, cache_file, false);
+        }
     }
 
     if (!write_lookahead.empty()) {
@@ -61,6 +189,31 @@ std::unique_ptr<RouterLookahead> make_router_lookahead(const t_det_routing_arch&
     return router_lookahead;
 }
 
+void load_intra_cluster_router_lookahead(RouterLookahead& router_lookahead,
+                                         const t_det_routing_arch& det_routing_arch,
+                                         e_router_lookahead router_lookahead_type,
+                                         bool half_precision,
+                                         const std::string& read_intra_cluster_lookahead,
+                                         const std::string& lookahead_cache_dir,
+                                         const std::vector<t_segment_inf>& segment_inf) {
+    std::string cache_file;
+    if (read_intra_cluster_lookahead.empty() && !lookahead_cache_dir.empty() && intra_cluster_lookahead_supports_cache(router_lookahead_type)) {
+        cache_file = get_router_lookahead_cache_file("router_intra_cluster_lookahead", det_routing_arch, router_lookahead_type, half_precision, lookahead_cache_dir, segment_inf, /*is_flat=*/true);
+    }
+
+    if (!read_intra_cluster_lookahead.empty()) {
+        router_lookahead.read_intra_cluster(read_intra_cluster_lookahead);
+    } else if (!cache_file.empty() && vtr::file_exists(cache_file.c_str())) {
+        VTR_LOG("Reading router intra cluster lookahead from cache file '%s'\n", cache_file.c_str());
+        router_lookahead.read_intra_cluster(cache_file);
+    } else {
+        router_lookahead.compute_intra_tile();
+        if (!cache_file.empty()) {
+            write_router_lookahead_cache_file(router_lookahead, cache_file, true);
+        }
+    }
+}
+
 float ClassicLookahead::get_expected_cost(RRNodeId current_node, RRNodeId target_node, const t_conn_cost_params& params, float R_upstream) const {
     auto [delay_cost, cong_cost] = get_expected_delay_and_cong(current_node, target_node, params, R_upstream);
 
@@ -207,8 +360,10 @@ void invalidate_router_lookahead_cache() {
 
 const RouterLookahead* get_cached_router_lookahead(const t_det_routing_arch& det_routing_arch,
                                                    e_router_lookahead router_lookahead_type,
+                                                   bool half_precision,
                                                    const std::string& write_lookahead,
                                                    const std::string& read_lookahead,
+                                                   const std::string& lookahead_cache_dir,
                                                    const std::vector<t_segment_inf>& segment_inf,
                                                    bool is_flat) {
     auto& router_ctx = g_vpr_ctx.routing();
@@ -226,8 +381,10 @@ const RouterLookahead* get_cached_router_lookahead(const t_det_routing_arch& det
             cache_key,
             make_router_lookahead(det_routing_arch,
                                   router_lookahead_type,
+                                  half_precision,
                                   write_lookahead,
                                   read_lookahead,
+                                  lookahead_cache_dir,
                                   segment_inf,
                                   is_flat));
     }
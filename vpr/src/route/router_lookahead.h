@@ -76,6 +76,18 @@ class RouterLookahead {
      */
     virtual float get_opin_distance_min_delay(int physical_tile_idx, int from_layer, int to_layer, int dx, int dy) const = 0;
 
+    /**
+     * @brief Return the (estimated) number of bytes held by the lookahead's look-up tables (including any global tables it uses)
+     */
+    virtual size_t memory_usage() const { return 0; }
+
+    /**
+     * @brief Return true if the lookahead does not depend on the channel width of the RR graph it was
+     * computed for, so it can be reused when only the channel width changes (e.g. in the minimum channel
+     * width search). Lookaheads whose tables are profiled from the RR graph wires are width-dependent.
+     */
+    virtual bool is_chan_width_independent() const { return false; }
+
     virtual ~RouterLookahead() {}
 };
 
@@ -84,19 +96,45 @@ class RouterLookahead {
  * @attention This may involve recomputing the lookahead, so only use if lookahead cache cannot be used.
  * @param det_routing_arch
  * @param router_lookahead_type
+ * @param half_precision Store the map lookahead's wire cost map with half precision entries
  * @param write_lookahead
  * @param read_lookahead
+ * @param lookahead_cache_dir If non-empty and read_lookahead is empty, the computed lookahead is
+ *                            stored in (and later reused from) this directory, under a name derived
+ *                            from a digest of the architecture, device and routing parameters.
  * @param segment_inf
  * @param is_flat
  * @return Return a unique pointer that points to the router lookahead object
  */
 std::unique_ptr<RouterLookahead> make_router_lookahead(const t_det_routing_arch& det_routing_arch,
                                                        e_router_lookahead router_lookahead_type,
+                                                       bool half_precision,
                                                        const std::string& write_lookahead,
                                                        const std::string& read_lookahead,
+                                                       const std::string& lookahead_cache_dir,
                                                        const std::vector<t_segment_inf>& segment_inf,
                                                        bool is_flat);
 
+/**
+ * @brief Fills the intra-cluster part of a (flat) router lookahead, whose inter-cluster part is already loaded.
+ * @param router_lookahead
+ * @param det_routing_arch
+ * @param router_lookahead_type
+ * @param half_precision
+ * @param read_intra_cluster_lookahead If non-empty, the intra-cluster lookahead is read from this file
+ * @param lookahead_cache_dir If non-empty and read_intra_cluster_lookahead is empty, the computed intra-cluster
+ *                            lookahead is stored in (and later reused from) this directory, under a name derived
+ *                            from the same digest as the inter-cluster lookahead's
+ * @param segment_inf
+ */
+void load_intra_cluster_router_lookahead(RouterLookahead& router_lookahead,
+                                         const t_det_routing_arch& det_routing_arch,
+                                         e_router_lookahead router_lookahead_type,
+                                         bool half_precision,
+                                         const std::string& read_intra_cluster_lookahead,
+                                         const std::string& lookahead_cache_dir,
+                                         const std::vector<t_segment_inf>& segment_inf);
+
 /**
  * @brief Clear router lookahead cache (e.g. when changing or free rrgraph).
  */
@@ -107,16 +145,20 @@ void invalidate_router_lookahead_cache();
  * @attention Object is cached in RouterContext, but access to cached object should performed via this function.
  * @param det_routing_arch
  * @param router_lookahead_type
+ * @param half_precision
  * @param write_lookahead
  * @param read_lookahead
+ * @param lookahead_cache_dir
  * @param segment_inf
  * @param is_flat
  * @return
  */
 const RouterLookahead* get_cached_router_lookahead(const t_det_routing_arch& det_routing_arch,
                                                    e_router_lookahead router_lookahead_type,
+                                                   bool half_precision,
                                                    const std::string& write_lookahead,
                                                    const std::string& read_lookahead,
+                                                   const std::string& lookahead_cache_dir,
                                                    const std::vector<t_segment_inf>& segment_inf,
                                                    bool is_flat);
 
@@ -152,6 +194,11 @@ class ClassicLookahead : public RouterLookahead {
         return -1.;
     }
 
+    bool is_chan_width_independent() const override {
+        //The costs are computed from the RR graph (and its indexed data) when queried
+        return true;
+    }
+
   private:
     float classic_wire_lookahead_cost(RRNodeId node, RRNodeId target_node, float criticality, float R_upstream) const;
 };
@@ -187,6 +234,10 @@ class NoOpLookahead : public RouterLookahead {
     float get_opin_distance_min_delay(int /*physical_tile_idx*/, int /*from_layer*/, int /*to_layer*/, int /*dx*/, int /*dy*/) const override {
         return -1.;
     }
+
+    bool is_chan_width_independent() const override {
+        return true;
+    }
 };
 
 #endif
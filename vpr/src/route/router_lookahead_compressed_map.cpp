@@ -17,6 +17,7 @@
 #include "vtr_assert.h"
 #include "vtr_time.h"
 #include "vtr_geometry.h"
+#include "vtr_memory_usage.h"
 #include "router_lookahead_map.h"
 #include "router_lookahead_map_utils.h"
 #include "rr_graph2.h"
@@ -522,6 +523,13 @@ void CompressedMapLookahead::compute(const std::vector<t_segment_inf>& segment_i
     this->src_opin_delays = util::compute_router_src_opin_lookahead(is_flat_);
 }
 
+size_t CompressedMapLookahead::memory_usage() const {
+    return vtr::memory_usage(f_compressed_wire_cost_map)
+           + vtr::memory_usage(compressed_loc_index_map)
+           + vtr::memory_usage(src_opin_delays)
+           + vtr::memory_usage(distance_based_min_cost);
+}
+
 void CompressedMapLookahead::write(const std::string& file_name) const {
     if (vtr::check_file_name_extension(file_name, ".csv")) {
         std::vector<int> wire_cost_map_size(f_compressed_wire_cost_map.ndims());
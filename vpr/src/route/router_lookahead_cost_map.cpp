@@ -4,6 +4,7 @@
 #include "globals.h"
 #include "echo_files.h"
 #include "vtr_geometry.h"
+#include "vtr_memory_usage.h"
 
 #ifdef VTR_ENABLE_CAPNPROTO
 #    include "capnp/serialize.h"
@@ -300,6 +301,14 @@ void CostMap::set_cost_map(const util::RoutingCosts& delay_costs, const util::Ro
     }
 }
 
+size_t CostMap::memory_usage() const {
+    size_t bytes = vtr::memory_usage(cost_map_) + vtr::memory_usage(offset_) + vtr::memory_usage(penalty_);
+    for (size_t i = 0; i < cost_map_.size(); ++i) {
+        bytes += vtr::memory_usage(cost_map_.get(i));
+    }
+    return bytes;
+}
+
 // prints an ASCII diagram of each cost map for a segment type (debug)
 // o => above average
 // . => at or below average
@@ -7,6 +7,7 @@
 #include "router_lookahead_map_utils.h"
 #include "router_lookahead_cost_map.h"
 #include "vtr_geometry.h"
+#include "vtr_memory_usage.h"
 
 // Implementation of RouterLookahead based on source segment and destination connection box types
 class ExtendedMapLookahead : public RouterLookahead {
@@ -107,6 +108,10 @@ class ExtendedMapLookahead : public RouterLookahead {
     float get_opin_distance_min_delay(int /*physical_tile_idx*/, int /*from_layer*/, int /*to_layer*/, int /*dx*/, int /*dy*/) const override {
         return -1.;
     }
+
+    size_t memory_usage() const override {
+        return cost_map_.memory_usage() + vtr::memory_usage(src_opin_delays) + vtr::memory_usage(chan_ipins_delays);
+    }
 };
 
 #endif
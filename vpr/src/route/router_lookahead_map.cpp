@@ -13,6 +13,10 @@
  * reach source wire type (f_cost_map). This is used for estimates from CHANX/CHANY -> SINK nodes. See Section 3.2.4
  * in Oleg Petelin's MASc thesis (2016) for more discussion.
  *
+ * On multi-die devices the table is kept for each (from layer, to layer) pair. The sampled inter-die paths only cover
+ * the distances reachable through the die crossings near the sample locations; the other distances of an inter-layer
+ * table are estimated from the same-layer table plus the smallest sampled crossing cost (see get_layer_crossing_offset()).
+ *
  * To handle estimates starting from SOURCE/OPIN's the lookahead also creates a small side look-up table of the wire types
  * which are reachable from each physical tile type's SOURCEs/OPINs (f_src_opin_delays). This is used for
  * SRC/OPIN -> CHANX/CHANY estimates.
@@ -33,12 +37,18 @@
 #include "vtr_assert.h"
 #include "vtr_time.h"
 #include "vtr_geometry.h"
+#include "vtr_memory_usage.h"
 #include "router_lookahead_map.h"
 #include "router_lookahead_map_utils.h"
 #include "rr_graph2.h"
 #include "rr_graph.h"
+#include "rr_rc_data.h"
 #include "route_common.h"
 
+#if defined(VPR_USE_TBB)
+#    include <tbb/parallel_for.h>
+#endif
+
 #ifdef VTR_ENABLE_CAPNPROTO
 #    include "capnp/serialize.h"
 #    include "map_lookahead.capnp.h"
@@ -66,6 +76,10 @@ enum e_representative_entry_method {
 //Look-up table from CHANX/CHANY (to SINKs) for various distances
 t_wire_cost_map f_wire_cost_map;
 
+//Half precision copy of f_wire_cost_map. When the lookahead is built with half precision this
+//replaces f_wire_cost_map (which is freed), shrinking it from 12 to 4 bytes per entry.
+t_half_wire_cost_map f_half_wire_cost_map;
+
 /******** File-Scope Functions ********/
 
 /***
@@ -81,6 +95,19 @@ static util::Cost_Entry get_wire_cost_entry(e_rr_type rr_type,
 
 static void compute_router_wire_lookahead(const std::vector<t_segment_inf>& segment_inf);
 
+/**
+ * @brief Converts f_wire_cost_map to f_half_wire_cost_map (and frees f_wire_cost_map), reporting the largest relative
+ * error introduced.
+ */
+static void quantize_wire_cost_map();
+
+/**
+ * @brief Rebuilds f_wire_cost_map from f_half_wire_cost_map
+ */
+static void dequantize_wire_cost_map();
+
+static size_t wire_cost_map_dim_size(size_t dim);
+
 /***
  * @brief Compute the cost from pin to sinks of tiles - Compute the minimum cost to get to each tile sink from pins on the cluster
  * @param intra_tile_pin_primitive_pin_delay
@@ -94,15 +121,17 @@ static void compute_tiles_lookahead(std::unordered_map<int, util::t_ipin_primiti
                                     const DeviceContext& device_ctx);
 /***
  * @brief Compute the cose from tile pins to tile sinks
- * @param intra_tile_pin_primitive_pin_delay [physical_tile_type_idx][from_pin_ptc_num][sink_ptc_num] -> cost
  * @param physical_tile
  * @param det_routing_arch
  * @param delayless_switch
+ * @return [from_pin_ptc_num][sink_ptc_num] -> cost
+ *
+ * Only reads the global device context, so it can be called concurrently for different tiles
+ * once the (zero R, zero C) rr_rc_data entry used by the tile's nodes exists.
  */
-static void compute_tile_lookahead(std::unordered_map<int, util::t_ipin_primitive_sink_delays>& intra_tile_pin_primitive_pin_delay,
-                                   t_physical_tile_type_ptr physical_tile,
-                                   const t_det_routing_arch& det_routing_arch,
-                                   const int delayless_switch);
+static util::t_ipin_primitive_sink_delays compute_tile_lookahead(t_physical_tile_type_ptr physical_tile,
+                                                                 const t_det_routing_arch& det_routing_arch,
+                                                                 const int delayless_switch);
 
 /***
  * @brief Compute the minimum cost to get to the sinks from pins on the cluster
@@ -138,8 +167,18 @@ static void write_intra_cluster_router_lookahead(const std::string& file,
 
 /* sets the lookahead cost map entries based on representative cost entries from routing_cost_map */
 static void set_lookahead_map_costs(int from_layer_num, int segment_index, e_rr_type chan_type, util::t_routing_cost_map& routing_cost_map);
-/* fills in missing lookahead map entries by copying the cost of the closest valid entry */
-static void fill_in_missing_lookahead_entries(int segment_index, e_rr_type chan_type);
+/* fills in missing lookahead map entries of the given source layer by copying the cost of the closest valid entry */
+static void fill_in_missing_lookahead_entries(int from_layer_num, int segment_index, e_rr_type chan_type);
+
+/**
+ * @brief Returns the smallest extra cost of the sampled entries from \p from_layer_num to \p to_layer_num over the
+ * same-layer entries of \p from_layer_num at the same distance, or NaN if no inter-layer entry was sampled.
+ *
+ * The sampled inter-layer paths only go through the die crossings near the sample locations, so many distances of an
+ * inter-layer table are missing. Adding this offset to the (filled) same-layer table keeps the estimates of the missing
+ * entries growing with the distance, instead of copying a much closer entry.
+ */
+static util::Cost_Entry get_layer_crossing_offset(int from_layer_num, int to_layer_num, int segment_index, int chan_index);
 /* returns a cost entry in the f_wire_cost_map that is near the specified coordinates (and preferably towards (0,0)) */
 static util::Cost_Entry get_nearby_cost_entry(int from_layer_num, int x, int y, int to_layer_num, int segment_index, int chan_index);
 
@@ -163,9 +202,10 @@ static util::Cost_Entry get_nearby_cost_entry_average_neighbour(int from_layer_n
                                                                 int chan_index);
 
 /******** Interface class member function definitions ********/
-MapLookahead::MapLookahead(const t_det_routing_arch& det_routing_arch, bool is_flat)
+MapLookahead::MapLookahead(const t_det_routing_arch& det_routing_arch, bool is_flat, bool half_precision)
     : det_routing_arch_(det_routing_arch)
-    , is_flat_(is_flat) {}
+    , is_flat_(is_flat)
+    , half_precision_(half_precision) {}
 
 float MapLookahead::get_expected_cost(RRNodeId current_node, RRNodeId target_node, const t_conn_cost_params& params, float R_upstream) const {
     auto& device_ctx = g_vpr_ctx.device();
@@ -392,6 +432,8 @@ std::pair<float, float> MapLookahead::get_expected_delay_and_cong(RRNodeId from_
 void MapLookahead::compute(const std::vector<t_segment_inf>& segment_inf) {
     vtr::ScopedStartFinishTimer timer("Computing router lookahead map");
 
+    f_half_wire_cost_map.clear();
+
     //First compute the delay map when starting from the various wire types
     //(CHANX/CHANY)in the routing architecture
     compute_router_wire_lookahead(segment_inf);
@@ -402,6 +444,10 @@ void MapLookahead::compute(const std::vector<t_segment_inf>& segment_inf) {
 
     min_chann_global_cost_map(chann_distance_based_min_cost);
     min_opin_distance_cost_map(src_opin_delays, opin_distance_based_min_cost);
+
+    if (half_precision_) {
+        quantize_wire_cost_map();
+    }
 }
 
 void MapLookahead::compute_intra_tile() {
@@ -417,6 +463,8 @@ void MapLookahead::compute_intra_tile() {
 }
 
 void MapLookahead::read(const std::string& file) {
+    f_half_wire_cost_map.clear();
+
     read_router_lookahead(file);
 
     //Next, compute which wire types are accessible (and the cost to reach them)
@@ -425,13 +473,17 @@ void MapLookahead::read(const std::string& file) {
 
     min_chann_global_cost_map(chann_distance_based_min_cost);
     min_opin_distance_cost_map(src_opin_delays, opin_distance_based_min_cost);
+
+    if (half_precision_) {
+        quantize_wire_cost_map();
+    }
 }
 
 void MapLookahead::read_intra_cluster(const std::string& file) {
     vtr::ScopedStartFinishTimer timer("Loading router intra cluster lookahead map");
     is_flat_ = true;
     // Maps related to global resources should not be empty
-    VTR_ASSERT(!f_wire_cost_map.empty());
+    VTR_ASSERT(!f_wire_cost_map.empty() || !f_half_wire_cost_map.empty());
     read_intra_cluster_router_lookahead(intra_tile_pin_primitive_pin_delay,
                                         file);
 
@@ -450,12 +502,19 @@ void MapLookahead::write(const std::string& file_name) const {
     if (vtr::check_file_name_extension(file_name, ".csv")) {
         std::vector<int> wire_cost_map_size(f_wire_cost_map.ndims());
         for (size_t i = 0; i < f_wire_cost_map.ndims(); ++i) {
-            wire_cost_map_size[i] = static_cast<int>(f_wire_cost_map.dim_size(i));
+            wire_cost_map_size[i] = static_cast<int>(wire_cost_map_dim_size(i));
         }
         dump_readable_router_lookahead_map(file_name, wire_cost_map_size, get_wire_cost_entry);
     } else {
         VTR_ASSERT(vtr::check_file_name_extension(file_name, ".capnp") || vtr::check_file_name_extension(file_name, ".bin"));
-        write_router_lookahead(file_name);
+        if (f_half_wire_cost_map.empty()) {
+            write_router_lookahead(file_name);
+        } else {
+            //The file format stores single precision entries, so expand the map while writing it
+            dequantize_wire_cost_map();
+            write_router_lookahead(file_name);
+            f_wire_cost_map.clear();
+        }
     }
 }
 
@@ -468,6 +527,20 @@ float MapLookahead::get_opin_distance_min_delay(int physical_tile_idx, int from_
     return opin_distance_based_min_cost[physical_tile_idx][from_layer][to_layer][dx][dy].delay;
 }
 
+size_t MapLookahead::memory_usage() const {
+    size_t bytes = vtr::memory_usage(f_wire_cost_map)
+                   + vtr::memory_usage(f_half_wire_cost_map)
+                   + vtr::memory_usage(src_opin_delays)
+                   + vtr::memory_usage(intra_tile_pin_primitive_pin_delay)
+                   + vtr::memory_usage(tile_min_cost)
+                   + vtr::memory_usage(chann_distance_based_min_cost)
+                   + vtr::memory_usage(opin_distance_based_min_cost);
+    for (const auto& tile_costs : tile_min_cost) {
+        bytes += vtr::memory_usage(tile_costs.second);
+    }
+    return bytes;
+}
+
 /******** Function Definitions ********/
 
 static util::Cost_Entry get_wire_cost_entry(e_rr_type rr_type, int seg_index, int from_layer_num, int delta_x, int delta_y, int to_layer_num) {
@@ -478,14 +551,75 @@ static util::Cost_Entry get_wire_cost_entry(e_rr_type rr_type, int seg_index, in
         chan_index = 1;
     }
 
-    VTR_ASSERT_SAFE(from_layer_num < (int)f_wire_cost_map.dim_size(0));
-    VTR_ASSERT_SAFE(to_layer_num < (int)f_wire_cost_map.dim_size(3));
-    VTR_ASSERT_SAFE(delta_x < (int)f_wire_cost_map.dim_size(4));
-    VTR_ASSERT_SAFE(delta_y < (int)f_wire_cost_map.dim_size(5));
+    VTR_ASSERT_SAFE(from_layer_num < (int)wire_cost_map_dim_size(0));
+    VTR_ASSERT_SAFE(to_layer_num < (int)wire_cost_map_dim_size(3));
+    VTR_ASSERT_SAFE(delta_x < (int)wire_cost_map_dim_size(4));
+    VTR_ASSERT_SAFE(delta_y < (int)wire_cost_map_dim_size(5));
+
+    if (!f_half_wire_cost_map.empty()) {
+        const t_half_cost_entry& half_entry = f_half_wire_cost_map[from_layer_num][chan_index][seg_index][to_layer_num][delta_x][delta_y];
+        return util::Cost_Entry(half_entry.get_delay(), half_entry.get_congestion());
+    }
 
     return f_wire_cost_map[from_layer_num][chan_index][seg_index][to_layer_num][delta_x][delta_y];
 }
 
+static size_t wire_cost_map_dim_size(size_t dim) {
+    if (!f_half_wire_cost_map.empty()) {
+        return f_half_wire_cost_map.dim_size(dim);
+    }
+    return f_wire_cost_map.dim_size(dim);
+}
+
+static void quantize_wire_cost_map() {
+    std::array<size_t, 6> dim_sizes;
+    for (size_t i = 0; i < dim_sizes.size(); ++i) {
+        dim_sizes[i] = f_wire_cost_map.dim_size(i);
+    }
+    f_half_wire_cost_map = t_half_wire_cost_map(dim_sizes);
+
+    //Relative error of a finite, non-zero value; NaN, infinite and zero entries are represented exactly
+    auto relative_error = [](float value, float quantized_value) {
+        if (!std::isfinite(value) || value == 0.) {
+            return 0.f;
+        }
+        return std::abs(quantized_value - value) / std::abs(value);
+    };
+
+    float max_delay_error = 0.;
+    float max_congestion_error = 0.;
+    for (size_t i = 0; i < f_wire_cost_map.size(); ++i) {
+        const util::Cost_Entry& cost_entry = f_wire_cost_map.get(i);
+        t_half_cost_entry& half_entry = f_half_wire_cost_map.get(i);
+
+        half_entry = t_half_cost_entry(cost_entry.delay, cost_entry.congestion);
+
+        max_delay_error = std::max(max_delay_error, relative_error(cost_entry.delay, half_entry.get_delay()));
+        max_congestion_error = std::max(max_congestion_error, relative_error(cost_entry.congestion, half_entry.get_congestion()));
+    }
+
+    VTR_LOG("Stored wire lookahead in half precision: %.2f MiB -> %.2f MiB, max relative error %g (delay) %g (congestion), bound %g\n",
+            f_wire_cost_map.size() * sizeof(util::Cost_Entry) / 1024. / 1024.,
+            f_half_wire_cost_map.size() * sizeof(t_half_cost_entry) / 1024. / 1024.,
+            max_delay_error, max_congestion_error,
+            t_half_cost_entry::MAX_RELATIVE_ERROR);
+
+    f_wire_cost_map.clear();
+}
+
+static void dequantize_wire_cost_map() {
+    std::array<size_t, 6> dim_sizes;
+    for (size_t i = 0; i < dim_sizes.size(); ++i) {
+        dim_sizes[i] = f_half_wire_cost_map.dim_size(i);
+    }
+    f_wire_cost_map = t_wire_cost_map(dim_sizes);
+
+    for (size_t i = 0; i < f_half_wire_cost_map.size(); ++i) {
+        const t_half_cost_entry& half_entry = f_half_wire_cost_map.get(i);
+        f_wire_cost_map.get(i) = util::Cost_Entry(half_entry.get_delay(), half_entry.get_congestion());
+    }
+}
+
 static void compute_router_wire_lookahead(const std::vector<t_segment_inf>& segment_inf_vec) {
     vtr::ScopedStartFinishTimer timer("Computing wire lookahead");
 
@@ -534,7 +668,7 @@ static void compute_router_wire_lookahead(const std::vector<t_segment_inf>& segm
 
                 /* fill in missing entries in the lookahead cost map by copying the closest cost entries (cost map was computed based on
                  * a reference coordinate > (0,0) so some entries that represent a cross-chip distance have not been computed) */
-                fill_in_missing_lookahead_entries(segment_inf.seg_index, chan_type);
+                fill_in_missing_lookahead_entries(from_layer_num, segment_inf.seg_index, chan_type);
             }
         }
     }
@@ -556,34 +690,87 @@ static void set_lookahead_map_costs(int from_layer_num, int segment_index, e_rr_
     }
 }
 
-/* fills in missing lookahead map entries by copying the cost of the closest valid entry */
-static void fill_in_missing_lookahead_entries(int segment_index, e_rr_type chan_type) {
+/* fills in missing lookahead map entries of the given source layer by copying the cost of the closest valid entry */
+static void fill_in_missing_lookahead_entries(int from_layer_num, int segment_index, e_rr_type chan_type) {
     int chan_index = (chan_type == CHANX) ? 0 : 1;
 
     auto& device_ctx = g_vpr_ctx.device();
+    int num_layers = device_ctx.grid.get_num_layers();
+
+    /* the same-layer table goes first, since the inter-layer tables are completed from it */
+    std::vector<int> to_layers = {from_layer_num};
+    for (int to_layer_num = 0; to_layer_num < num_layers; ++to_layer_num) {
+        if (to_layer_num != from_layer_num) {
+            to_layers.push_back(to_layer_num);
+        }
+    }
 
     /* find missing cost entries and fill them in by copying a nearby cost entry */
-    for (int from_layer_num = 0; from_layer_num < device_ctx.grid.get_num_layers(); from_layer_num++) {
-        for (int to_layer_num = 0; to_layer_num < device_ctx.grid.get_num_layers(); ++to_layer_num) {
-            for (unsigned ix = 0; ix < device_ctx.grid.width(); ix++) {
-                for (unsigned iy = 0; iy < device_ctx.grid.height(); iy++) {
-                    util::Cost_Entry cost_entry = f_wire_cost_map[from_layer_num][chan_index][segment_index][to_layer_num][ix][iy];
-
-                    if (std::isnan(cost_entry.delay) && std::isnan(cost_entry.congestion)) {
-                        util::Cost_Entry copied_entry = get_nearby_cost_entry_average_neighbour(from_layer_num,
-                                                                                                static_cast<int>(ix),
-                                                                                                static_cast<int>(iy),
-                                                                                                to_layer_num,
-                                                                                                segment_index,
-                                                                                                chan_index);
-                        f_wire_cost_map[from_layer_num][chan_index][segment_index][to_layer_num][ix][iy] = copied_entry;
+    for (int to_layer_num : to_layers) {
+        //Must be found before filling, while the only valid entries are the sampled ones
+        util::Cost_Entry crossing_offset;
+        if (to_layer_num != from_layer_num) {
+            crossing_offset = get_layer_crossing_offset(from_layer_num, to_layer_num, segment_index, chan_index);
+        }
+
+        for (unsigned ix = 0; ix < device_ctx.grid.width(); ix++) {
+            for (unsigned iy = 0; iy < device_ctx.grid.height(); iy++) {
+                util::Cost_Entry cost_entry = f_wire_cost_map[from_layer_num][chan_index][segment_index][to_layer_num][ix][iy];
+
+                if (std::isnan(cost_entry.delay) && std::isnan(cost_entry.congestion)) {
+                    util::Cost_Entry copied_entry = get_nearby_cost_entry_average_neighbour(from_layer_num,
+                                                                                            static_cast<int>(ix),
+                                                                                            static_cast<int>(iy),
+                                                                                            to_layer_num,
+                                                                                            segment_index,
+                                                                                            chan_index);
+                    if (!std::isnan(crossing_offset.delay)) {
+                        //The copied entry is for a shorter distance (or the unreachable placeholder, if no entry was
+                        //found towards (0,0)): the same-layer cost at this distance plus the crossing offset is
+                        //usually the tighter estimate
+                        const util::Cost_Entry& same_layer_entry = f_wire_cost_map[from_layer_num][chan_index][segment_index][from_layer_num][ix][iy];
+                        util::Cost_Entry crossing_entry(same_layer_entry.delay + crossing_offset.delay,
+                                                        same_layer_entry.congestion + crossing_offset.congestion);
+                        if (copied_entry.delay >= std::numeric_limits<float>::max() / 1e12) {
+                            copied_entry = crossing_entry;
+                        } else {
+                            copied_entry.delay = std::max(copied_entry.delay, crossing_entry.delay);
+                            copied_entry.congestion = std::max(copied_entry.congestion, crossing_entry.congestion);
+                        }
                     }
+                    f_wire_cost_map[from_layer_num][chan_index][segment_index][to_layer_num][ix][iy] = copied_entry;
                 }
             }
         }
     }
 }
 
+static util::Cost_Entry get_layer_crossing_offset(int from_layer_num, int to_layer_num, int segment_index, int chan_index) {
+    float min_delay_offset = std::numeric_limits<float>::infinity();
+    float min_cong_offset = std::numeric_limits<float>::infinity();
+
+    for (size_t ix = 0; ix < f_wire_cost_map.dim_size(4); ix++) {
+        for (size_t iy = 0; iy < f_wire_cost_map.dim_size(5); iy++) {
+            const util::Cost_Entry& cost_entry = f_wire_cost_map[from_layer_num][chan_index][segment_index][to_layer_num][ix][iy];
+            if (std::isnan(cost_entry.delay) || std::isnan(cost_entry.congestion)) {
+                continue;
+            }
+
+            //The same-layer table is already filled
+            const util::Cost_Entry& same_layer_entry = f_wire_cost_map[from_layer_num][chan_index][segment_index][from_layer_num][ix][iy];
+            min_delay_offset = std::min(min_delay_offset, cost_entry.delay - same_layer_entry.delay);
+            min_cong_offset = std::min(min_cong_offset, cost_entry.congestion - same_layer_entry.congestion);
+        }
+    }
+
+    if (!std::isfinite(min_delay_offset) || !std::isfinite(min_cong_offset)) {
+        return util::Cost_Entry();
+    }
+
+    //A die crossing never makes the path cheaper
+    return util::Cost_Entry(std::max(min_delay_offset, 0.f), std::max(min_cong_offset, 0.f));
+}
+
 /* returns a cost entry in the f_wire_cost_map that is near the specified coordinates (and preferably towards (0,0)) */
 static util::Cost_Entry get_nearby_cost_entry(int from_layer_num, int x, int y, int to_layer_num, int segment_index, int chan_index) {
     /* compute the slope from x,y to 0,0 and then move towards 0,0 by one unit to get the coordinates
@@ -683,25 +870,44 @@ static void compute_tiles_lookahead(std::unordered_map<int, util::t_ipin_primiti
                                     const DeviceContext& device_ctx) {
     const auto& tiles = device_ctx.physical_tile_types;
 
+    // The pin and class nodes of the tile graphs all have zero R and C: create their rr_rc_data entry
+    // up front, so that building the tile graphs only reads the global device context
+    find_create_rr_rc_data(0., 0., g_vpr_ctx.mutable_device().rr_rc_data);
+
+    std::vector<util::t_ipin_primitive_sink_delays> tile_pin_delays(tiles.size());
+    auto compute_tile = [&](size_t itile) {
+        if (!is_empty_type(&tiles[itile])) {
+            tile_pin_delays[itile] = compute_tile_lookahead(&tiles[itile],
+                                                            det_routing_arch,
+                                                            device_ctx.delayless_switch_idx);
+        }
+    };
+
+#if defined(VPR_USE_TBB) // Run in parallel
+    // Each tile type is built and flooded independently into its own entry of tile_pin_delays
+    tbb::parallel_for(size_t(0), tiles.size(), compute_tile);
+#else // Run serially
+    for (size_t itile = 0; itile < tiles.size(); itile++) {
+        compute_tile(itile);
+    }
+#endif
+
     for (const auto& tile : tiles) {
         if (is_empty_type(&tile)) {
             continue;
         }
 
-        compute_tile_lookahead(intra_tile_pin_primitive_pin_delay,
-                               &tile,
-                               det_routing_arch,
-                               device_ctx.delayless_switch_idx);
+        auto insert_res = intra_tile_pin_primitive_pin_delay.insert(std::make_pair(tile.index, std::move(tile_pin_delays[tile.index])));
+        VTR_ASSERT(insert_res.second);
         store_min_cost_to_sinks(tile_min_cost,
                                 &tile,
                                 intra_tile_pin_primitive_pin_delay);
     }
 }
 
-static void compute_tile_lookahead(std::unordered_map<int, util::t_ipin_primitive_sink_delays>& intra_tile_pin_primitive_pin_delay,
-                                   t_physical_tile_type_ptr physical_tile,
-                                   const t_det_routing_arch& det_routing_arch,
-                                   const int delayless_switch) {
+static util::t_ipin_primitive_sink_delays compute_tile_lookahead(t_physical_tile_type_ptr physical_tile,
+                                                                 const t_det_routing_arch& det_routing_arch,
+                                                                 const int delayless_switch) {
     RRGraphBuilder rr_graph_builder;
     int layer = 0;
     int x = 1;
@@ -729,10 +935,9 @@ static void compute_tile_lookahead(std::unordered_map<int, util::t_ipin_primitiv
                                                                                       x,
                                                                                       y);
 
-    auto insert_res = intra_tile_pin_primitive_pin_delay.insert(std::make_pair(physical_tile->index, pin_delays));
-    VTR_ASSERT(insert_res.second);
-
     rr_graph_builder.clear();
+
+    return pin_delays;
 }
 
 static void store_min_cost_to_sinks(std::unordered_map<int, std::unordered_map<int, util::Cost_Entry>>& tile_min_cost,
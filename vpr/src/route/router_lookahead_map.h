@@ -2,13 +2,16 @@
 
 #include <string>
 #include <limits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include "vtr_ndmatrix.h"
 #include "router_lookahead.h"
 #include "router_lookahead_map_utils.h"
 
 class MapLookahead : public RouterLookahead {
   public:
-    explicit MapLookahead(const t_det_routing_arch& det_routing_arch, bool is_flat);
+    explicit MapLookahead(const t_det_routing_arch& det_routing_arch, bool is_flat, bool half_precision = false);
 
   private:
     float get_expected_cost_flat_router(RRNodeId current_node, RRNodeId target_node, const t_conn_cost_params& params, float R_upstream) const;
@@ -24,6 +27,7 @@ class MapLookahead : public RouterLookahead {
 
     const t_det_routing_arch& det_routing_arch_;
     bool is_flat_;
+    bool half_precision_; // Store the wire cost map with half precision entries
 
   protected:
     float get_expected_cost(RRNodeId current_node, RRNodeId target_node, const t_conn_cost_params& params, float R_upstream) const override;
@@ -36,6 +40,7 @@ class MapLookahead : public RouterLookahead {
     void write(const std::string& file_name) const override;
     void write_intra_cluster(const std::string& file) const override;
     float get_opin_distance_min_delay(int physical_tile_idx, int from_layer, int to_layer, int dx, int dy) const override;
+    size_t memory_usage() const override;
 };
 
 /* provides delay/congestion estimates to travel specified distances
@@ -49,5 +54,47 @@ typedef vtr::NdMatrix<util::Cost_Entry, 6> t_wire_cost_map; //[0..num_layers][0.
                                                             // The first index is the layer number that the node under consideration is on, and the forth index
                                                             // is the layer number that the target node is on.
 
+/* A Cost_Entry with both values stored as bfloat16, i.e. the upper half of the single precision value.
+ * This keeps the full single precision exponent range (so the very large costs used for unreachable
+ * layers, NaN and infinity are preserved) while only the significand is rounded, to 8 bits. */
+class t_half_cost_entry {
+  public:
+    /* Largest relative error of a converted (finite, normal) value: half an ulp of an 8 bit significand */
+    static constexpr float MAX_RELATIVE_ERROR = 1.f / 256;
+
+    t_half_cost_entry()
+        : t_half_cost_entry(std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::quiet_NaN()) {}
+    t_half_cost_entry(float set_delay, float set_congestion)
+        : delay_(to_half(set_delay))
+        , congestion_(to_half(set_congestion)) {}
+
+    float get_delay() const { return to_float(delay_); }
+    float get_congestion() const { return to_float(congestion_); }
+
+  private:
+    static uint16_t to_half(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        if (std::isnan(value)) {
+            return 0x7FC0; // Quiet NaN (truncation could turn a NaN into infinity)
+        }
+        //Round to nearest, ties to even
+        bits += 0x7FFF + ((bits >> 16) & 1);
+        return static_cast<uint16_t>(bits >> 16);
+    }
+
+    static float to_float(uint16_t half) {
+        uint32_t bits = static_cast<uint32_t>(half) << 16;
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    uint16_t delay_;
+    uint16_t congestion_;
+};
+
+typedef vtr::NdMatrix<t_half_cost_entry, 6> t_half_wire_cost_map; //Same layout as t_wire_cost_map
+
 void read_router_lookahead(const std::string& file);
 void write_router_lookahead(const std::string& file);
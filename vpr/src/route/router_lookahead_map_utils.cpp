@@ -18,6 +18,11 @@
 #include "route_common.h"
 #include "route_debug.h"
 
+#if defined(VPR_USE_TBB)
+#    include <tbb/enumerable_thread_specific.h>
+#    include <tbb/parallel_for_each.h>
+#endif
+
 /**
  * We will profile delay/congestion using this many tracks for each wire type.
  * Larger values increase the time to compute the lookahead, but may give
@@ -528,7 +533,7 @@ t_ipin_primitive_sink_delays compute_intra_tile_dijkstra(const RRGraphView& rr_g
     t_ipin_primitive_sink_delays pin_delays;
     pin_delays.resize(max_ptc_num);
 
-    for (int pin_physical_num : tile_pins_vec) {
+    auto flood_from_pin = [&](int pin_physical_num) {
         RRNodeId pin_node_id = get_pin_rr_node_id(rr_graph.node_lookup(),
                                                   physical_tile,
                                                   layer,
@@ -538,7 +543,16 @@ t_ipin_primitive_sink_delays compute_intra_tile_dijkstra(const RRGraphView& rr_g
         VTR_ASSERT(pin_node_id != RRNodeId::INVALID());
 
         run_intra_tile_dijkstra(rr_graph, pin_delays, physical_tile, pin_node_id);
+    };
+
+#if defined(VPR_USE_TBB) // Run in parallel
+    // Each flood only writes the delays of its own starting pin (pin_delays[pin ptc])
+    tbb::parallel_for_each(tile_pins_vec, flood_from_pin);
+#else // Run serially
+    for (int pin_physical_num : tile_pins_vec) {
+        flood_from_pin(pin_physical_num);
     }
+#endif
 
     return pin_delays;
 }
@@ -791,11 +805,7 @@ t_routing_cost_map get_routing_cost_map(int longest_seg_length,
         //reset cost for this segment
         routing_cost_map.fill(Expansion_Cost_Entry());
 
-        // to avoid multiple memory allocation and de-allocations in run_dijkstra()
-        // dijkstra_data is created outside the for loop and passed by reference to dijkstra_data()
-        t_dijkstra_data dijkstra_data;
-
-        for (RRNodeId sample_node : sample_nodes) {
+        auto run_sample_dijkstra = [&](RRNodeId sample_node, t_routing_cost_map& cost_map, t_dijkstra_data& dijkstra_data) {
             int sample_x = rr_graph.node_xlow(sample_node);
             int sample_y = rr_graph.node_ylow(sample_node);
 
@@ -807,11 +817,40 @@ t_routing_cost_map get_routing_cost_map(int longest_seg_length,
             run_dijkstra(sample_node,
                          sample_x,
                          sample_y,
-                         routing_cost_map,
+                         cost_map,
                          dijkstra_data,
                          sample_locs,
                          sample_all_locs);
+        };
+
+#if defined(VPR_USE_TBB) // Run in parallel
+        // Each worker floods from its share of the sample nodes into its own partial cost map
+        // (and reuses its own dijkstra_data across samples). The partial maps are merged once
+        // all the samples are done; since only the smallest cost entry is kept at each location
+        // the result does not depend on how the samples were distributed among the workers.
+        tbb::enumerable_thread_specific<t_routing_cost_map> thread_cost_maps([&]() {
+            return t_routing_cost_map({routing_cost_map.dim_size(0), routing_cost_map.dim_size(1), routing_cost_map.dim_size(2)});
+        });
+        tbb::enumerable_thread_specific<t_dijkstra_data> thread_dijkstra_data;
+
+        tbb::parallel_for_each(sample_nodes, [&](RRNodeId sample_node) {
+            run_sample_dijkstra(sample_node, thread_cost_maps.local(), thread_dijkstra_data.local());
+        });
+
+        for (const t_routing_cost_map& partial_cost_map : thread_cost_maps) {
+            for (size_t i = 0; i < routing_cost_map.size(); i++) {
+                routing_cost_map.get(i).merge(util::e_representative_entry_method::SMALLEST, partial_cost_map.get(i));
+            }
+        }
+#else // Run serially
+        // to avoid multiple memory allocation and de-allocations in run_dijkstra()
+        // dijkstra_data is created outside the for loop and passed by reference to dijkstra_data()
+        t_dijkstra_data dijkstra_data;
+
+        for (RRNodeId sample_node : sample_nodes) {
+            run_sample_dijkstra(sample_node, routing_cost_map, dijkstra_data);
         }
+#endif
     }
 
     return routing_cost_map;
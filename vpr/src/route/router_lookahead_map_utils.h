@@ -138,7 +138,10 @@ class Expansion_Cost_Entry {
             if (this->cost_vector.empty()) {
                 this->cost_vector.push_back(cost_entry);
             } else {
-                if (add_delay < this->cost_vector[0].delay) {
+                /* ties are broken on congestion so the kept entry does not depend on the order
+                 * the entries were added in (partial maps may be merged in any order) */
+                const Cost_Entry& smallest = this->cost_vector[0];
+                if (add_delay < smallest.delay || (add_delay == smallest.delay && add_congestion < smallest.congestion)) {
                     this->cost_vector[0] = cost_entry;
                 }
             }
@@ -150,6 +153,13 @@ class Expansion_Cost_Entry {
         this->cost_vector.clear();
     }
 
+    /* adds every cost entry of other to this entry */
+    void merge(e_representative_entry_method method, const Expansion_Cost_Entry& other) {
+        for (const Cost_Entry& cost_entry : other.cost_vector) {
+            this->add_cost_entry(method, cost_entry.delay, cost_entry.congestion);
+        }
+    }
+
     Cost_Entry get_representative_cost_entry(e_representative_entry_method method) const {
         Cost_Entry entry;
 
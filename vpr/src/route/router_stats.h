@@ -4,13 +4,18 @@
 #include "rr_graph_fwd.h"
 #include "rr_node_types.h"
 #include "vtr_assert.h"
+#include "vtr_id_hash_map.h"
+
+#include <array>
+#include <numeric>
+#include <vector>
 
 // This struct instructs the router on how to route the given connection
 struct ConnectionParameters {
     ConnectionParameters(ParentNetId net_id,
                          int target_pin_num,
                          bool has_choking_spot,
-                         const std::unordered_map<RRNodeId, int>& connection_choking_spots)
+                         const vtr::id_hash_map<RRNodeId, int>& connection_choking_spots)
         : net_id_(net_id)
         , target_pin_num_(target_pin_num)
         , has_choking_spot_(has_choking_spot)
@@ -26,7 +31,49 @@ struct ConnectionParameters {
     // take some measures to solve the congestion
     bool has_choking_spot_;
 
-    const std::unordered_map<RRNodeId, int>& connection_choking_spots_;
+    const vtr::id_hash_map<RRNodeId, int>& connection_choking_spots_;
+};
+
+/** Per connection counters of the connection router, to tune the lookahead and astar_fac with data
+ * instead of trial runs. They are cheap enough to be always collected: like the rest of RouterStats,
+ * each thread of the parallel routers keeps its own and they are combined after each iteration. */
+struct RouterProfile {
+    /** Upper bounds of the bins of the lookahead error histogram, which counts the connections by the ratio
+     * of the cost of their path to the cost the lookahead predicted from the net source. The last bin is unbounded */
+    static constexpr std::array<float, 9> LOOKAHEAD_ERROR_BIN_BOUNDS = {0.25, 0.5, 0.75, 0.9, 1.1, 1.25, 1.5, 2., 4.};
+    static constexpr size_t NUM_LOOKAHEAD_ERROR_BINS = LOOKAHEAD_ERROR_BIN_BOUNDS.size() + 1;
+
+    /** Connections routed one at a time (i.e. not in a batch of high fanout sinks) */
+    size_t connections = 0;
+    /** Heap pops while routing these connections */
+    size_t sink_expansions = 0;
+    /** RR nodes these connections added to the route tree. The other expansions were wasted */
+    size_t path_nodes = 0;
+    /** Connections left unrouted, to retry their net with a full device bounding box */
+    size_t bb_retries = 0;
+    /** Lookahead error histogram (see LOOKAHEAD_ERROR_BIN_BOUNDS) */
+    std::array<size_t, NUM_LOOKAHEAD_ERROR_BINS> lookahead_error_bins = {};
+
+    /** Record the lookahead error of a connection */
+    void add_lookahead_error(float actual_cost, float predicted_cost) {
+        if (predicted_cost <= 0.)
+            return; /* Nothing to compare against, e.g. the sink is next to the source */
+        float ratio = actual_cost / predicted_cost;
+        size_t bin = 0;
+        while (bin < LOOKAHEAD_ERROR_BIN_BOUNDS.size() && ratio >= LOOKAHEAD_ERROR_BIN_BOUNDS[bin])
+            bin++;
+        lookahead_error_bins[bin]++;
+    }
+
+    /** Add rhs's counters to mine */
+    void combine(const RouterProfile& rhs) {
+        connections += rhs.connections;
+        sink_expansions += rhs.sink_expansions;
+        path_nodes += rhs.path_nodes;
+        bb_retries += rhs.bb_retries;
+        for (size_t bin = 0; bin < NUM_LOOKAHEAD_ERROR_BINS; bin++)
+            lookahead_error_bins[bin] += rhs.lookahead_error_bins[bin];
+    }
 };
 
 struct RouterStats {
@@ -46,6 +93,8 @@ struct RouterStats {
     // For debugging purposes
     size_t rt_node_pushes[t_rr_type::NUM_RR_TYPES] = {0};
 
+    RouterProfile profile;
+
     /** Add rhs's stats to mine */
     void combine(RouterStats& rhs) {
         connections_routed += rhs.connections_routed;
@@ -63,6 +112,33 @@ struct RouterStats {
             intra_cluster_node_type_cnt_pops[node_type_idx] += rhs.intra_cluster_node_type_cnt_pops[node_type_idx];
             rt_node_pushes[node_type_idx] += rhs.rt_node_pushes[node_type_idx];
         }
+        profile.combine(rhs.profile);
+    }
+};
+
+/** Load balance of an iteration of a parallel router, to tell whether a poor speedup comes from the
+ * partitioning (threads left idle) or from the nets which can't be routed in parallel (e.g. the root
+ * of the PartitionTree). Empty for the serial router. */
+struct RouteLoadBalance {
+    /** Time each thread spent routing nets */
+    std::vector<float> thread_busy_sec;
+    /** Nets routed by each thread */
+    std::vector<size_t> thread_nets_routed;
+    /** Heap pops of each thread */
+    std::vector<size_t> thread_heap_pops;
+    /** Wall time of the iteration */
+    float wall_sec = 0.;
+    /** Wall time of routing the nets in the root of the PartitionTree (while no other thread can work) */
+    float root_sec = 0.;
+    /** Longest root to leaf chain of PartitionTree node times: the iteration can't be faster than this */
+    float critical_path_sec = 0.;
+
+    /** Fraction of the threads' time spent routing */
+    float utilization() const {
+        float busy_sec = std::accumulate(thread_busy_sec.begin(), thread_busy_sec.end(), 0.f);
+        if (thread_busy_sec.empty() || wall_sec <= 0.)
+            return 0.;
+        return busy_sec / (thread_busy_sec.size() * wall_sec);
     }
 };
 
@@ -174,6 +174,25 @@ float RoutingPredictor::estimate_success_iteration() {
     return success_iteration;
 }
 
+float RoutingPredictor::estimate_early_success_iteration() {
+    float success_iteration = std::numeric_limits<float>::quiet_NaN();
+
+    if (iterations_.size() > ROUTING_PREDICTOR_EARLY_MIN_HISTORY && iterations_.size() <= min_history_) {
+        //The first iteration is routed without present congestion costs, so its overuse is
+        //not representative of the trend: fit all the other iterations
+        float history_factor = float(iterations_.size() - 1) / iterations_.size();
+        auto model = fit_model(iterations_, iteration_overused_rr_node_counts_, history_factor);
+        success_iteration = model.find_x_for_y_value(0.);
+
+        if (success_iteration < 0.) {
+            //Overuse is not decreasing
+            success_iteration = std::numeric_limits<float>::infinity();
+        }
+    }
+
+    return success_iteration;
+}
+
 float RoutingPredictor::estimate_overuse_slope() {
     //We use a fixed size sliding window of history to estimate the slope
     //This makes the slope estimate more 'recent' than the values used to estimate
@@ -13,6 +13,12 @@ constexpr float ROUTING_PREDICTOR_ITERATION_ABORT_FACTOR_AGGRESSIVE = 1.5;
 // This avoids giving up when solutions are nearly legal, but converging slowly
 constexpr size_t ROUTING_PREDICTOR_MIN_ABSOLUTE_OVERUSE_THRESHOLD = 100;
 
+//Number of iterations (after the first) needed for an early estimate of the success iteration.
+//Since the early estimate is noisier, the router only aborts on it when it exceeds the abort
+//threshold by the ratio of the full history size to the iterations so far (i.e. the budget
+//starts loose and tightens each iteration, until the full estimate takes over)
+constexpr size_t ROUTING_PREDICTOR_EARLY_MIN_HISTORY = 4;
+
 class RoutingPredictor {
   public:
     RoutingPredictor(size_t min_history = 8, float history_factor = 0.5);
@@ -20,6 +26,13 @@ class RoutingPredictor {
     //Returns the estimated iteration when routing will succeed
     float estimate_success_iteration();
 
+    //Returns an (early, noisier) estimate of the iteration when routing will succeed, from the
+    //iterations so far, until there is enough history for estimate_success_iteration()
+    float estimate_early_success_iteration();
+
+    //Returns the number of iterations needed by estimate_success_iteration()
+    size_t min_history() const { return min_history_; }
+
     //Returns the current estimated slope (RR nodes per iteration)
     float estimate_overuse_slope();
 
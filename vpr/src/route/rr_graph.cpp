@@ -40,6 +40,11 @@
 #include "rr_types.h"
 #include "echo_files.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for_each.h>
+#    include <tbb/task_arena.h>
+#endif
+
 //#define VERBOSE
 //used for getting the exact count of each edge type and printing it to std out.
 
@@ -461,6 +466,34 @@ static float get_min_delay_to_chain(t_physical_tile_type_ptr physical_type,
 
 static std::unordered_set<int> get_chain_pins(std::vector<t_pin_chain_node> chain);
 
+/* R and C of a newly built channel node. The node's RC index is only looked up once the
+ * channel's edges are loaded, so channels can be built concurrently but the rr_rc_data
+ * table is still filled in the same (serial) order. */
+struct t_chan_node_rc {
+    RRNodeId node;
+    float R;
+    float C;
+};
+
+/* Builds the nodes and CHAN->CHAN/CHAN->IPIN edges of every channel of a layer. Returns the number of edges created */
+static size_t build_rr_chans(RRGraphBuilder& rr_graph_builder,
+                             const int layer,
+                             const t_track_to_pin_lookup& track_to_pin_lookup_x,
+                             const t_track_to_pin_lookup& track_to_pin_lookup_y,
+                             t_sb_connection_map* sb_conn_map,
+                             const vtr::NdMatrix<std::vector<int>, 3>& switch_block_conn,
+                             const int num_seg_types_x,
+                             const t_chan_width& chan_width,
+                             const DeviceGrid& grid,
+                             t_sblock_pattern& sblock_pattern,
+                             const int Fs_per_side,
+                             const t_chan_details& chan_details_x,
+                             const t_chan_details& chan_details_y,
+                             const int wire_to_ipin_switch,
+                             const int wire_to_pin_between_dice_switch,
+                             const enum e_directionality directionality,
+                             bool is_global_graph);
+
 static void build_rr_chan(RRGraphBuilder& rr_graph_builder,
                           const int layer,
                           const int i,
@@ -478,6 +511,7 @@ static void build_rr_chan(RRGraphBuilder& rr_graph_builder,
                           const t_chan_details& chan_details_x,
                           const t_chan_details& chan_details_y,
                           t_rr_edge_info_set& created_rr_edges,
+                          std::vector<t_chan_node_rc>& created_node_rcs,
                           const int wire_to_ipin_switch,
                           const int wire_to_pin_between_dice_switch,
                           const enum e_directionality directionality);
@@ -644,6 +678,8 @@ static void build_rr_graph(const t_graph_type graph_type,
                            bool is_flat,
                            int* Warnings);
 
+static void reset_rr_graph_for_chan_width_change();
+
 static void build_intra_cluster_rr_graph(const t_graph_type graph_type,
                                          const DeviceGrid& grid,
                                          const std::vector<t_physical_tile_type>& types,
@@ -715,7 +751,12 @@ void create_rr_graph(const t_graph_type graph_type,
                 }
             }
         } else {
-            free_rr_graph();
+            if (!device_ctx.rr_graph.empty() && !device_ctx.rr_graph_is_flat && !is_flat) {
+                //Only the channel widths changed (e.g. during the minimum channel width search)
+                reset_rr_graph_for_chan_width_change();
+            } else {
+                free_rr_graph();
+            }
             build_rr_graph(graph_type,
                            block_types,
                            grid,
@@ -762,6 +803,9 @@ void create_rr_graph(const t_graph_type graph_type,
 
     process_non_config_sets();
 
+    //The graph is complete, so pack the node look-up into its compact (read-only) representation
+    mutable_device_ctx.rr_graph_builder.node_lookup().freeze();
+
     verify_rr_node_indices(grid,
                            device_ctx.rr_graph,
                            device_ctx.rr_indexed_data,
@@ -789,6 +833,10 @@ void create_rr_graph(const t_graph_type graph_type,
                        echo_file_name,
                        is_flat);
     }
+
+    if (router_opts.compact_rr_graph_edges) {
+        mutable_device_ctx.rr_graph_builder.compact_edge_src_nodes();
+    }
 }
 
 static void add_intra_cluster_edges_rr_graph(RRGraphBuilder& rr_graph_builder,
@@ -2112,46 +2160,11 @@ static std::function<void(t_chan_width*)> alloc_and_load_rr_graph(RRGraphBuilder
         if (!device_ctx.inter_cluster_prog_routing_resources.at(layer)) {
             continue;
         }
-        for (size_t i = 0; i < grid.width() - 1; ++i) {
-            for (size_t j = 0; j < grid.height() - 1; ++j) {
-                if (i > 0) {
-                    int tracks_per_chan = ((is_global_graph) ? 1 : chan_width.x_list[j]);
-                    build_rr_chan(rr_graph_builder, layer, i, j, CHANX, track_to_pin_lookup_x, sb_conn_map, switch_block_conn,
-                                  CHANX_COST_INDEX_START,
-                                  chan_width, grid, tracks_per_chan,
-                                  sblock_pattern, Fs / 3, chan_details_x, chan_details_y,
-                                  rr_edges_to_create,
-                                  wire_to_ipin_switch,
-                                  wire_to_pin_between_dice_switch,
-                                  directionality);
-
-                    //Create the actual CHAN->CHAN edges
-                    uniquify_edges(rr_edges_to_create);
-                    alloc_and_load_edges(rr_graph_builder, rr_edges_to_create);
-                    num_edges += rr_edges_to_create.size();
-
-                    rr_edges_to_create.clear();
-                }
-                if (j > 0) {
-                    int tracks_per_chan = ((is_global_graph) ? 1 : chan_width.y_list[i]);
-                    build_rr_chan(rr_graph_builder, layer, i, j, CHANY, track_to_pin_lookup_y, sb_conn_map, switch_block_conn,
-                                  CHANX_COST_INDEX_START + num_seg_types_x,
-                                  chan_width, grid, tracks_per_chan,
-                                  sblock_pattern, Fs / 3, chan_details_x, chan_details_y,
-                                  rr_edges_to_create,
-                                  wire_to_ipin_switch,
-                                  wire_to_pin_between_dice_switch,
-                                  directionality);
-
-                    //Create the actual CHAN->CHAN edges
-                    uniquify_edges(rr_edges_to_create);
-                    alloc_and_load_edges(rr_graph_builder, rr_edges_to_create);
-                    num_edges += rr_edges_to_create.size();
-
-                    rr_edges_to_create.clear();
-                }
-            }
-        }
+        num_edges += build_rr_chans(rr_graph_builder, layer, track_to_pin_lookup_x, track_to_pin_lookup_y,
+                                    sb_conn_map, switch_block_conn, num_seg_types_x, chan_width, grid,
+                                    sblock_pattern, Fs / 3, chan_details_x, chan_details_y,
+                                    wire_to_ipin_switch, wire_to_pin_between_dice_switch,
+                                    directionality, is_global_graph);
     }
     VTR_LOG("CHAN->CHAN type edge count:%d\n", num_edges);
     num_edges = 0;
@@ -2630,6 +2643,30 @@ void free_rr_graph() {
     invalidate_router_lookahead_cache();
 }
 
+static void reset_rr_graph_for_chan_width_change() {
+    /* Like free_rr_graph(), but for a rebuild of the same device at different channel widths:   *
+     * the node look-up keeps its structure and the node/edge storage keeps its capacity, so the *
+     * new graph is built without re-allocating them, and the router lookahead is kept if it     *
+     * does not depend on the channel width.                                                     */
+    auto& device_ctx = g_vpr_ctx.mutable_device();
+    const auto& route_ctx = g_vpr_ctx.routing();
+
+    device_ctx.read_rr_graph_filename.clear();
+
+    device_ctx.rr_graph_builder.reset();
+
+    device_ctx.rr_indexed_data.clear();
+
+    device_ctx.switch_fanin_remap.clear();
+
+    device_ctx.rr_graph_is_flat = false;
+
+    const RouterLookahead* router_lookahead = route_ctx.cached_router_lookahead_.get(route_ctx.router_lookahead_cache_key_);
+    if (!router_lookahead || !router_lookahead->is_chan_width_independent()) {
+        invalidate_router_lookahead_cache();
+    }
+}
+
 static void build_cluster_internal_edges(RRGraphBuilder& rr_graph_builder,
                                          int& num_collapsed_nodes,
                                          ClusterBlockId cluster_blk_id,
@@ -3036,6 +3073,7 @@ static void build_rr_chan(RRGraphBuilder& rr_graph_builder,
                           const t_chan_details& chan_details_x,
                           const t_chan_details& chan_details_y,
                           t_rr_edge_info_set& rr_edges_to_create,
+                          std::vector<t_chan_node_rc>& node_rcs_to_create,
                           const int wire_to_ipin_switch,
                           const int wire_to_pin_between_dice_switch,
                           const enum e_directionality directionality) {
@@ -3043,7 +3081,6 @@ static void build_rr_chan(RRGraphBuilder& rr_graph_builder,
      * coordinates based on channel type */
 
     auto& device_ctx = g_vpr_ctx.device();
-    auto& mutable_device_ctx = g_vpr_ctx.mutable_device();
 
     //Initally assumes CHANX
     int seg_coord = x_coord;                           //The absolute coordinate of this segment within the channel
@@ -3199,7 +3236,8 @@ static void build_rr_chan(RRGraphBuilder& rr_graph_builder,
         int length = end - start + 1;
         float R = length * seg_details[track].Rmetal();
         float C = length * seg_details[track].Cmetal();
-        rr_graph_builder.set_node_rc_index(node, NodeRCIndex(find_create_rr_rc_data(R, C, mutable_device_ctx.rr_rc_data)));
+        /* The RC index is looked up (and created) when the edges are loaded, see build_rr_chans() */
+        node_rcs_to_create.push_back({node, R, C});
 
         rr_graph_builder.set_node_type(node, chan_type);
         rr_graph_builder.set_node_track_num(node, track);
@@ -3207,6 +3245,129 @@ static void build_rr_chan(RRGraphBuilder& rr_graph_builder,
     }
 }
 
+static size_t build_rr_chans(RRGraphBuilder& rr_graph_builder,
+                             const int layer,
+                             const t_track_to_pin_lookup& track_to_pin_lookup_x,
+                             const t_track_to_pin_lookup& track_to_pin_lookup_y,
+                             t_sb_connection_map* sb_conn_map,
+                             const vtr::NdMatrix<std::vector<int>, 3>& switch_block_conn,
+                             const int num_seg_types_x,
+                             const t_chan_width& chan_width,
+                             const DeviceGrid& grid,
+                             t_sblock_pattern& sblock_pattern,
+                             const int Fs_per_side,
+                             const t_chan_details& chan_details_x,
+                             const t_chan_details& chan_details_y,
+                             const int wire_to_ipin_switch,
+                             const int wire_to_pin_between_dice_switch,
+                             const enum e_directionality directionality,
+                             bool is_global_graph) {
+    /* The channels are split into vertical stripes of columns. A channel only touches the
+     * switch blocks within one wire length (plus the switch blocks at either end) of its
+     * own column, so channels in non-adjacent stripes never share any sblock_pattern
+     * entries or nodes. The even stripes are built in parallel, then the odd ones.
+     *
+     * Each channel's edges and node RCs are buffered and loaded into the graph in the
+     * original (column, row, CHANX then CHANY) order, so the resulting RR graph is
+     * identical to building the channels one at a time. */
+    struct t_chan_build {
+        t_rr_edge_info_set edges;
+        std::vector<t_chan_node_rc> node_rcs;
+    };
+
+    const size_t num_cols = grid.width() - 1;
+    const size_t num_rows = grid.height() - 1;
+    if (num_cols == 0 || num_rows == 0) {
+        return 0;
+    }
+
+    int max_seg_len = 1;
+    for (const t_chan_details* chan_details : {&chan_details_x, &chan_details_y}) {
+        for (size_t iseg = 0; iseg < chan_details->size(); ++iseg) {
+            max_seg_len = std::max(max_seg_len, chan_details->get(iseg).length());
+        }
+    }
+    const size_t stripe_width = max_seg_len + 6;
+    const size_t num_stripes = (num_cols + stripe_width - 1) / stripe_width;
+
+    /* Only a window of stripes is buffered at a time to bound the memory used for edges */
+#ifdef VPR_USE_TBB
+    const size_t stripes_per_window = 2 * std::max(1, tbb::this_task_arena::max_concurrency());
+#else
+    const size_t stripes_per_window = 2;
+#endif
+
+    auto& mutable_device_ctx = g_vpr_ctx.mutable_device();
+    size_t num_edges = 0;
+
+    std::vector<t_chan_build> chans;
+    for (size_t first_stripe = 0; first_stripe < num_stripes; first_stripe += stripes_per_window) {
+        size_t last_stripe = std::min(num_stripes, first_stripe + stripes_per_window);
+        size_t first_col = first_stripe * stripe_width;
+        size_t last_col = std::min(num_cols, last_stripe * stripe_width);
+
+        /* Two channels (CHANX, CHANY) per switch block location */
+        chans.clear();
+        chans.resize(2 * (last_col - first_col) * num_rows);
+
+        auto build_stripe = [&](size_t istripe) {
+            size_t stripe_end = std::min(num_cols, (istripe + 1) * stripe_width);
+            for (size_t i = istripe * stripe_width; i < stripe_end; ++i) {
+                for (size_t j = 0; j < num_rows; ++j) {
+                    t_chan_build* chan = &chans[2 * ((i - first_col) * num_rows + j)];
+                    if (i > 0) {
+                        int tracks_per_chan = ((is_global_graph) ? 1 : chan_width.x_list[j]);
+                        build_rr_chan(rr_graph_builder, layer, i, j, CHANX, track_to_pin_lookup_x, sb_conn_map, switch_block_conn,
+                                      CHANX_COST_INDEX_START,
+                                      chan_width, grid, tracks_per_chan,
+                                      sblock_pattern, Fs_per_side, chan_details_x, chan_details_y,
+                                      chan[0].edges, chan[0].node_rcs,
+                                      wire_to_ipin_switch,
+                                      wire_to_pin_between_dice_switch,
+                                      directionality);
+                        uniquify_edges(chan[0].edges);
+                    }
+                    if (j > 0) {
+                        int tracks_per_chan = ((is_global_graph) ? 1 : chan_width.y_list[i]);
+                        build_rr_chan(rr_graph_builder, layer, i, j, CHANY, track_to_pin_lookup_y, sb_conn_map, switch_block_conn,
+                                      CHANX_COST_INDEX_START + num_seg_types_x,
+                                      chan_width, grid, tracks_per_chan,
+                                      sblock_pattern, Fs_per_side, chan_details_x, chan_details_y,
+                                      chan[1].edges, chan[1].node_rcs,
+                                      wire_to_ipin_switch,
+                                      wire_to_pin_between_dice_switch,
+                                      directionality);
+                        uniquify_edges(chan[1].edges);
+                    }
+                }
+            }
+        };
+
+        for (size_t parity = 0; parity < 2; ++parity) {
+            std::vector<size_t> stripes;
+            for (size_t istripe = first_stripe + parity; istripe < last_stripe; istripe += 2) {
+                stripes.push_back(istripe);
+            }
+#ifdef VPR_USE_TBB
+            tbb::parallel_for_each(stripes.begin(), stripes.end(), build_stripe);
+#else
+            std::for_each(stripes.begin(), stripes.end(), build_stripe);
+#endif
+        }
+
+        //Create the actual CHAN->CHAN edges
+        for (t_chan_build& chan : chans) {
+            for (const t_chan_node_rc& node_rc : chan.node_rcs) {
+                rr_graph_builder.set_node_rc_index(node_rc.node, NodeRCIndex(find_create_rr_rc_data(node_rc.R, node_rc.C, mutable_device_ctx.rr_rc_data)));
+            }
+            alloc_and_load_edges(rr_graph_builder, chan.edges);
+            num_edges += chan.edges.size();
+        }
+    }
+
+    return num_edges;
+}
+
 void uniquify_edges(t_rr_edge_info_set& rr_edges_to_create) {
     std::stable_sort(rr_edges_to_create.begin(), rr_edges_to_create.end());
     rr_edges_to_create.erase(std::unique(rr_edges_to_create.begin(), rr_edges_to_create.end()), rr_edges_to_create.end());
@@ -4541,14 +4702,9 @@ static RRNodeId pick_best_direct_connect_target_rr_node(const RRGraphView& rr_gr
 static void create_edge_groups(EdgeGroups* groups) {
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
-    rr_graph.rr_nodes().for_each_edge(
-        [&](RREdgeId edge, RRNodeId src, RRNodeId sink) {
-            if (!rr_graph.rr_switch_inf(RRSwitchId(rr_graph.rr_nodes().edge_switch(edge))).configurable()) {
-                groups->add_non_config_edge(src, sink);
-            }
-        });
-
-    groups->create_sets();
+    groups->create_sets(rr_graph.rr_nodes(), [&](RREdgeId edge) {
+        return !rr_graph.rr_switch_inf(RRSwitchId(rr_graph.rr_nodes().edge_switch(edge))).configurable();
+    });
 }
 
 t_non_configurable_rr_sets identify_non_configurable_rr_sets() {
@@ -2049,10 +2049,12 @@ static int get_track_to_chan_seg(RRGraphBuilder& rr_graph_builder,
 
     /* get coordinate to index into the SB map */
     Switchblock_Lookup sb_coord(tile_x, tile_y, from_side, to_side);
-    if (sb_conn_map->count(sb_coord) > 0) {
+    auto sb_conn_it = sb_conn_map->find(sb_coord);
+    if (sb_conn_it != sb_conn_map->end()) {
         /* get reference to the connections vector which lists all destination wires for a given source wire
-         * at a specific coordinate sb_coord */
-        std::vector<t_switchblock_edge>& conn_vector = (*sb_conn_map)[sb_coord];
+         * at a specific coordinate sb_coord. Only look the entry up (no operator[]) since channels may be
+         * built concurrently */
+        const std::vector<t_switchblock_edge>& conn_vector = sb_conn_it->second;
 
         /* go through the connections... */
         for (int iconn = 0; iconn < (int)conn_vector.size(); ++iconn) {
@@ -45,8 +45,8 @@ void ClockRRGraphBuilder::create_clock_networks_switches(const std::vector<std::
     }
 }
 
-void ClockRRGraphBuilder::add_switch_location(std::string clock_name,
-                                              std::string switch_point_name,
+void ClockRRGraphBuilder::add_switch_location(const std::string& clock_name,
+                                              const std::string& switch_point_name,
                                               int x,
                                               int y,
                                               int node_index) {
@@ -54,7 +54,24 @@ void ClockRRGraphBuilder::add_switch_location(std::string clock_name,
     clock_name_to_switch_points[clock_name].insert_switch_node_idx(switch_point_name, x, y, node_index);
 }
 
-void SwitchPoints::insert_switch_node_idx(std::string switch_point_name, int x, int y, int node_idx) {
+SwitchPoint& ClockRRGraphBuilder::get_or_create_switch_point(const std::string& clock_name,
+                                                             const std::string& switch_point_name) {
+    // Note use of operator[] will automatically insert the clock and switch names if they don't exist.
+    // The references to unordered_map elements stay valid as other names are inserted.
+    return clock_name_to_switch_points[clock_name].switch_point_name_to_switch_location[switch_point_name];
+}
+
+const SwitchPoint& ClockRRGraphBuilder::get_switch_point(const std::string& clock_name,
+                                                         const std::string& switch_point_name) const {
+    auto itter = clock_name_to_switch_points.find(clock_name);
+
+    // assert that clock name exists in map
+    VTR_ASSERT(itter != clock_name_to_switch_points.end());
+
+    return itter->second.get_switch_point(switch_point_name);
+}
+
+void SwitchPoints::insert_switch_node_idx(const std::string& switch_point_name, int x, int y, int node_idx) {
     // Note use of operator[] will automatically insert switch name if it doesn't exit
     switch_point_name_to_switch_location[switch_point_name].insert_node_idx(x, y, node_idx);
 }
@@ -74,61 +91,45 @@ void SwitchPoint::insert_node_idx(int x, int y, int node_idx) {
     locations.insert({x, y});
 }
 
-std::vector<int> ClockRRGraphBuilder::get_rr_node_indices_at_switch_location(std::string clock_name,
-                                                                             std::string switch_point_name,
-                                                                             int x,
-                                                                             int y) const {
-    auto itter = clock_name_to_switch_points.find(clock_name);
-
-    // assert that clock name exists in map
-    VTR_ASSERT(itter != clock_name_to_switch_points.end());
+const std::vector<int>& ClockRRGraphBuilder::get_rr_node_indices_at_switch_location(const std::string& clock_name,
+                                                                                    const std::string& switch_point_name,
+                                                                                    int x,
+                                                                                    int y) const {
+    return get_switch_point(clock_name, switch_point_name).get_rr_node_indices_at_location(x, y);
+}
 
-    auto& switch_points = itter->second;
-    return switch_points.get_rr_node_indices_at_location(switch_point_name, x, y);
+const std::vector<int>& SwitchPoints::get_rr_node_indices_at_location(const std::string& switch_point_name,
+                                                                      int x,
+                                                                      int y) const {
+    return get_switch_point(switch_point_name).get_rr_node_indices_at_location(x, y);
 }
 
-std::vector<int> SwitchPoints::get_rr_node_indices_at_location(std::string switch_point_name,
-                                                               int x,
-                                                               int y) const {
+const SwitchPoint& SwitchPoints::get_switch_point(const std::string& switch_point_name) const {
     auto itter = switch_point_name_to_switch_location.find(switch_point_name);
 
     // assert that switch name exists in map
     VTR_ASSERT(itter != switch_point_name_to_switch_location.end());
 
-    auto& switch_point = itter->second;
-    std::vector<int> rr_node_indices = switch_point.get_rr_node_indices_at_location(x, y);
-    return rr_node_indices;
+    return itter->second;
 }
 
-std::vector<int> SwitchPoint::get_rr_node_indices_at_location(int x, int y) const {
+const std::vector<int>& SwitchPoint::get_rr_node_indices_at_location(int x, int y) const {
     // assert that switch is connected to nodes at the location
     VTR_ASSERT(!rr_node_indices[x][y].empty());
 
     return rr_node_indices[x][y];
 }
 
-std::set<std::pair<int, int>> ClockRRGraphBuilder::get_switch_locations(std::string clock_name,
-                                                                        std::string switch_point_name) const {
-    auto itter = clock_name_to_switch_points.find(clock_name);
-
-    // assert that clock name exists in map
-    VTR_ASSERT(itter != clock_name_to_switch_points.end());
-
-    auto& switch_points = itter->second;
-    return switch_points.get_switch_locations(switch_point_name);
+std::set<std::pair<int, int>> ClockRRGraphBuilder::get_switch_locations(const std::string& clock_name,
+                                                                        const std::string& switch_point_name) const {
+    return get_switch_point(clock_name, switch_point_name).get_switch_locations();
 }
 
-std::set<std::pair<int, int>> SwitchPoints::get_switch_locations(std::string switch_point_name) const {
-    auto itter = switch_point_name_to_switch_location.find(switch_point_name);
-
-    // assert that switch name exists in map
-    VTR_ASSERT(itter != switch_point_name_to_switch_location.end());
-
-    auto& switch_point = itter->second;
-    return switch_point.get_switch_locations();
+std::set<std::pair<int, int>> SwitchPoints::get_switch_locations(const std::string& switch_point_name) const {
+    return get_switch_point(switch_point_name).get_switch_locations();
 }
 
-std::set<std::pair<int, int>> SwitchPoint::get_switch_locations() const {
+const std::set<std::pair<int, int>>& SwitchPoint::get_switch_locations() const {
     // assert that switch is connected to nodes at the location
     VTR_ASSERT(!locations.empty());
 
@@ -31,9 +31,9 @@ class SwitchPoint {
     std::set<std::pair<int, int>> locations; // x,y
   public:
     /** Accessors **/
-    std::vector<int> get_rr_node_indices_at_location(int x, int y) const;
+    const std::vector<int>& get_rr_node_indices_at_location(int x, int y) const;
 
-    std::set<std::pair<int, int>> get_switch_locations() const;
+    const std::set<std::pair<int, int>>& get_switch_locations() const;
 
     /** Mutators **/
     void insert_node_idx(int x, int y, int node_idx);
@@ -52,14 +52,17 @@ class SwitchPoints {
     /* Example: x,y = middle of the chip, switch_point_name == name of main drive
      * of global clock spine, returns the rr_nodes of all the clock spines that
      * start the newtork there*/
-    std::vector<int> get_rr_node_indices_at_location(std::string switch_point_name,
-                                                     int x,
-                                                     int y) const;
+    const std::vector<int>& get_rr_node_indices_at_location(const std::string& switch_point_name,
+                                                            int x,
+                                                            int y) const;
 
-    std::set<std::pair<int, int>> get_switch_locations(std::string switch_point_name) const;
+    std::set<std::pair<int, int>> get_switch_locations(const std::string& switch_point_name) const;
+
+    /* Returns the switch point switch_point_name, which must exist */
+    const SwitchPoint& get_switch_point(const std::string& switch_point_name) const;
 
     /** Mutators **/
-    void insert_switch_node_idx(std::string switch_point_name, int x, int y, int node_idx);
+    void insert_switch_node_idx(const std::string& switch_point_name, int x, int y, int node_idx);
 };
 
 class ClockRRGraphBuilder {
@@ -93,21 +96,30 @@ class ClockRRGraphBuilder {
     }
 
     /* Saves a map from switch rr_node idx -> {x, y} location */
-    void add_switch_location(std::string clock_name,
-                             std::string switch_point_name,
+    void add_switch_location(const std::string& clock_name,
+                             const std::string& switch_point_name,
                              int x,
                              int y,
                              int node_index);
 
+    /* Returns the switch point of a clock network, creating it if needed. Adding the locations of a
+     * network instance through it avoids looking up the names for each location. */
+    SwitchPoint& get_or_create_switch_point(const std::string& clock_name,
+                                            const std::string& switch_point_name);
+
+    /* Returns the switch point of a clock network, which must exist */
+    const SwitchPoint& get_switch_point(const std::string& clock_name,
+                                        const std::string& switch_point_name) const;
+
     /* Returns the rr_node idx of the switch at location {x, y} */
-    std::vector<int> get_rr_node_indices_at_switch_location(std::string clock_name,
-                                                            std::string switch_point_name,
-                                                            int x,
-                                                            int y) const;
+    const std::vector<int>& get_rr_node_indices_at_switch_location(const std::string& clock_name,
+                                                                   const std::string& switch_point_name,
+                                                                   int x,
+                                                                   int y) const;
 
     /* Returns all the switch locations for the a certain clock network switch */
-    std::set<std::pair<int, int>> get_switch_locations(std::string clock_name,
-                                                       std::string switch_point_name) const;
+    std::set<std::pair<int, int>> get_switch_locations(const std::string& clock_name,
+                                                       const std::string& switch_point_name) const;
 
     void update_chan_width(t_chan_width* chan_width) const;
 
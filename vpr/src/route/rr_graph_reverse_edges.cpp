@@ -0,0 +1,32 @@
+#include "rr_graph_reverse_edges.h"
+
+void RRReverseEdges::build(const t_rr_graph_storage& rr_nodes) {
+    size_t num_nodes = rr_nodes.size();
+
+    /* Count the in-edges of each node, then turn the counts into offsets */
+    first_in_edge_.assign(num_nodes + 1, 0);
+    for (size_t inode = 0; inode < num_nodes; inode++) {
+        for (RREdgeId iedge : rr_nodes.edge_range(RRNodeId(inode))) {
+            first_in_edge_[size_t(rr_nodes.edge_sink_node(iedge)) + 1]++;
+        }
+    }
+    for (size_t inode = 0; inode < num_nodes; inode++) {
+        first_in_edge_[inode + 1] += first_in_edge_[inode];
+    }
+
+    /* Scatter the edges into their sink node's slots */
+    in_edges_.resize(first_in_edge_[num_nodes]);
+    std::vector<size_t> next_slot(first_in_edge_.begin(), first_in_edge_.end() - 1);
+    for (size_t inode = 0; inode < num_nodes; inode++) {
+        for (RREdgeId iedge : rr_nodes.edge_range(RRNodeId(inode))) {
+            in_edges_[next_slot[size_t(rr_nodes.edge_sink_node(iedge))]++] = iedge;
+        }
+    }
+}
+
+void RRReverseEdges::clear() {
+    first_in_edge_.clear();
+    first_in_edge_.shrink_to_fit();
+    in_edges_.clear();
+    in_edges_.shrink_to_fit();
+}
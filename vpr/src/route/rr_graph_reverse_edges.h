@@ -0,0 +1,43 @@
+#pragma once
+
+/** @file Fan-in lookup for the RR graph.
+ *
+ * t_rr_graph_storage only stores the edges leaving each node. Searches which
+ * walk the graph backwards (e.g. the backward wave of the bidirectional
+ * connection router) need the edges entering a node, so this builds a
+ * CSR-style index of edge IDs grouped by sink node. */
+
+#include <vector>
+
+#include "rr_graph_fwd.h"
+#include "rr_graph_storage.h"
+#include "vtr_array_view.h"
+#include "vtr_vector.h"
+
+class RRReverseEdges {
+  public:
+    /** Build the lookup for \p rr_nodes. Replaces any existing contents */
+    void build(const t_rr_graph_storage& rr_nodes);
+
+    /** Free the lookup */
+    void clear();
+
+    /** Is the lookup built? */
+    inline bool empty() const { return first_in_edge_.empty(); }
+
+    /** Number of nodes the lookup was built for */
+    inline size_t num_nodes() const { return empty() ? 0 : first_in_edge_.size() - 1; }
+
+    /** Edges ending at \p inode */
+    inline vtr::array_view<const RREdgeId> in_edges(RRNodeId inode) const {
+        size_t first = first_in_edge_[size_t(inode)];
+        size_t last = first_in_edge_[size_t(inode) + 1];
+        return vtr::array_view<const RREdgeId>(in_edges_.data() + first, last - first);
+    }
+
+  private:
+    /** Index of the first in-edge of each node in in_edges_. Has num_nodes + 1 elements */
+    std::vector<size_t> first_in_edge_;
+    /** In-edges of all nodes, grouped by sink node */
+    std::vector<RREdgeId> in_edges_;
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+/* Forward declarations for the router's per RR node search state */
+
+#include "rr_graph_fwd.h"
+#include "vtr_memory.h"
+#include "vtr_vector.h"
+
+struct t_rr_node_route_inf;
+
+/* The search state of every RR node, which is read and written by the router's inner loop.
+ * It is a large array, so it follows the large allocation policy (see --large_alloc_policy). */
+typedef vtr::vector<RRNodeId, t_rr_node_route_inf, vtr::large_array_allocator<t_rr_node_route_inf>> t_rr_node_route_inf_vector;
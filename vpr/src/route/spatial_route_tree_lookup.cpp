@@ -2,10 +2,9 @@
 
 #include "globals.h"
 
-SpatialRouteTreeLookup build_route_tree_spatial_lookup(const Netlist<>& net_list,
-                                                       const vtr::vector<ParentNetId, t_bb>& net_bound_box,
-                                                       ParentNetId net,
-                                                       const RouteTreeNode& rt_root) {
+std::array<size_t, 2> route_tree_spatial_lookup_num_bins(const Netlist<>& net_list,
+                                                         const t_net_bb_vector& net_bound_box,
+                                                         ParentNetId net) {
     constexpr float BIN_AREA_PER_SINK_FACTOR = 4;
 
     auto& device_ctx = g_vpr_ctx.device();
@@ -22,7 +21,14 @@ SpatialRouteTreeLookup build_route_tree_spatial_lookup(const Netlist<>& net_list
     size_t bins_x = std::ceil(device_ctx.grid.width() / bin_dim);
     size_t bins_y = std::ceil(device_ctx.grid.height() / bin_dim);
 
-    SpatialRouteTreeLookup spatial_lookup({bins_x, bins_y});
+    return {bins_x, bins_y};
+}
+
+SpatialRouteTreeLookup build_route_tree_spatial_lookup(const Netlist<>& net_list,
+                                                       const t_net_bb_vector& net_bound_box,
+                                                       ParentNetId net,
+                                                       const RouteTreeNode& rt_root) {
+    SpatialRouteTreeLookup spatial_lookup(route_tree_spatial_lookup_num_bins(net_list, net_bound_box, net));
 
     update_route_tree_spatial_lookup_recur(rt_root, spatial_lookup);
 
@@ -31,6 +37,15 @@ SpatialRouteTreeLookup build_route_tree_spatial_lookup(const Netlist<>& net_list
 
 // Adds the sub-tree rooted at rt_node to the spatial look-up
 void update_route_tree_spatial_lookup_recur(const RouteTreeNode& rt_node, SpatialRouteTreeLookup& spatial_lookup) {
+    add_route_tree_node_to_spatial_lookup(rt_node, spatial_lookup);
+
+    // Recurse
+    for (auto& child : rt_node.child_nodes()) {
+        update_route_tree_spatial_lookup_recur(child, spatial_lookup);
+    }
+}
+
+void add_route_tree_node_to_spatial_lookup(const RouteTreeNode& rt_node, SpatialRouteTreeLookup& spatial_lookup) {
     auto& device_ctx = g_vpr_ctx.device();
     const auto& rr_graph = device_ctx.rr_graph;
 
@@ -53,10 +68,31 @@ void update_route_tree_spatial_lookup_recur(const RouteTreeNode& rt_node, Spatia
     if (bin_xhigh != bin_xlow || bin_yhigh != bin_ylow) {
         spatial_lookup[bin_xhigh][bin_yhigh].push_back(rt_node);
     }
+}
 
-    // Recurse
-    for (auto& child : rt_node.child_nodes()) {
-        update_route_tree_spatial_lookup_recur(child, spatial_lookup);
+void remove_route_tree_node_from_spatial_lookup(const RouteTreeNode& rt_node, SpatialRouteTreeLookup& spatial_lookup) {
+    auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+
+    RRNodeId rr_node = (RRNodeId)rt_node.inode;
+
+    int bin_xlow = grid_to_bin_x(rr_graph.node_xlow(rr_node), spatial_lookup);
+    int bin_ylow = grid_to_bin_y(rr_graph.node_ylow(rr_node), spatial_lookup);
+    int bin_xhigh = grid_to_bin_x(rr_graph.node_xhigh(rr_node), spatial_lookup);
+    int bin_yhigh = grid_to_bin_y(rr_graph.node_yhigh(rr_node), spatial_lookup);
+
+    // Route tree nodes compare by address, so only this node (not another one of the same RR node) is removed
+    auto remove_from_bin = [&](std::vector<std::reference_wrapper<const RouteTreeNode>>& bin_rt_nodes) {
+        auto iter = std::find(bin_rt_nodes.begin(), bin_rt_nodes.end(), rt_node);
+        VTR_ASSERT_SAFE(iter != bin_rt_nodes.end());
+        if (iter != bin_rt_nodes.end()) {
+            bin_rt_nodes.erase(iter);
+        }
+    };
+
+    remove_from_bin(spatial_lookup[bin_xlow][bin_ylow]);
+    if (bin_xhigh != bin_xlow || bin_yhigh != bin_ylow) {
+        remove_from_bin(spatial_lookup[bin_xhigh][bin_yhigh]);
     }
 }
 
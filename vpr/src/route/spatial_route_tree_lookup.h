@@ -1,5 +1,6 @@
 #ifndef VPR_SPATIAL_ROUTE_TREE_LOOKUP_H
 #define VPR_SPATIAL_ROUTE_TREE_LOOKUP_H
+#include <array>
 #include <vector>
 
 #include "vpr_types.h"
@@ -10,13 +11,24 @@
 
 typedef vtr::Matrix<std::vector<std::reference_wrapper<const RouteTreeNode>>> SpatialRouteTreeLookup;
 
+/** Returns the number of (x, y) bins of the spatial look-up of a net's route tree */
+std::array<size_t, 2> route_tree_spatial_lookup_num_bins(const Netlist<>& net_list,
+                                                         const t_net_bb_vector& net_bound_box,
+                                                         ParentNetId net);
+
 SpatialRouteTreeLookup build_route_tree_spatial_lookup(const Netlist<>& net_list,
-                                                       const vtr::vector<ParentNetId, t_bb>& net_bound_box,
+                                                       const t_net_bb_vector& net_bound_box,
                                                        ParentNetId net,
                                                        const RouteTreeNode& rt_root);
 
 void update_route_tree_spatial_lookup_recur(const RouteTreeNode& rt_node, SpatialRouteTreeLookup& spatial_lookup);
 
+/** Adds a single route tree node (not its sub-tree) to the spatial look-up */
+void add_route_tree_node_to_spatial_lookup(const RouteTreeNode& rt_node, SpatialRouteTreeLookup& spatial_lookup);
+
+/** Removes a single route tree node from the spatial look-up (keeping the order of the other nodes) */
+void remove_route_tree_node_from_spatial_lookup(const RouteTreeNode& rt_node, SpatialRouteTreeLookup& spatial_lookup);
+
 size_t grid_to_bin_x(size_t grid_x, const SpatialRouteTreeLookup& spatial_lookup);
 size_t grid_to_bin_y(size_t grid_y, const SpatialRouteTreeLookup& spatial_lookup);
 
@@ -8,7 +8,8 @@ namespace comm {
 enum class CMD : int {
     NONE=-1,
     GET_PATH_LIST_ID=0,
-    DRAW_PATH_ID=1
+    DRAW_PATH_ID=1,
+    SUBSCRIBE_PROGRESS_ID=2
 };
 
 } // namespace comm
@@ -24,10 +24,16 @@ inline const std::string OPTION_IS_FLAT_ROUTING{"is_flat_routing"};
 inline const std::string OPTION_PATH_ELEMENTS{"path_elements"};
 inline const std::string OPTION_HIGHLIGHT_MODE{"high_light_mode"};
 inline const std::string OPTION_DRAW_PATH_CONTOUR{"draw_path_contour"};
+inline const std::string OPTION_IS_DELTA_REPORT{"is_delta_report"};
+inline const std::string OPTION_SUBSCRIBE{"subscribe"};
+inline const std::string OPTION_HEATMAP_SIZE{"heatmap_size"};
 
 inline const std::string KEY_SETUP_PATH_LIST{"setup"};
 inline const std::string KEY_HOLD_PATH_LIST{"hold"};
 
+inline const std::string KEY_DELTA_REPORT{"#RPT DELTA"};
+inline const std::string KEY_UNCHANGED_PATH{"unchanged"};
+
 } // namespace comm
 
 #endif /* NO_SERVER */
@@ -3,9 +3,12 @@
 #include "gateio.h"
 
 #include "telegramparser.h"
+#include "telegramoptions.h"
 #include "commconstants.h"
 #include "convertutils.h"
 
+#include <algorithm>
+
 namespace server {
 
 GateIO::GateIO() {
@@ -52,6 +55,44 @@ void GateIO::move_tasks_to_send_queue(std::vector<TaskPtr>& tasks) {
     tasks.clear();
 }
 
+void GateIO::queue_progress_frame(ProgressFrame&& frame) {
+    if (!m_is_progress_subscribed.load()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_progress_frames_mutex);
+    m_progress_frames.push_back(std::move(frame));
+    while (m_progress_frames.size() > PROGRESS_FRAMES_MAX_NUM) {
+        m_progress_frames.pop_front();
+    }
+}
+
+void GateIO::handle_progress_subscription(TaskPtr& task) {
+    TelegramOptions options{task->options(), {}};
+    bool subscribe = options.get_bool(comm::OPTION_SUBSCRIBE, true);
+    int heatmap_size = options.get_int(comm::OPTION_HEATMAP_SIZE, DEFAULT_PROGRESS_HEATMAP_SIZE);
+    m_progress_heatmap_size.store(std::clamp(heatmap_size, 0, MAX_PROGRESS_HEATMAP_SIZE));
+
+    if (subscribe) {
+        m_is_progress_subscribed.store(true);
+        m_logger.queue(LogLevel::Info, "client subscribed to progress, heatmap size=", m_progress_heatmap_size.load());
+    } else {
+        cancel_progress_subscription();
+        m_logger.queue(LogLevel::Info, "client unsubscribed from progress");
+    }
+
+    // acknowledge the subscription right away, the task resolver only runs when the main thread is idle
+    task->set_success();
+    std::unique_lock<std::mutex> lock(m_tasks_mutex);
+    m_send_tasks.push_back(std::move(task));
+}
+
+void GateIO::cancel_progress_subscription() {
+    m_is_progress_subscribed.store(false);
+    std::unique_lock<std::mutex> lock(m_progress_frames_mutex);
+    m_progress_frames.clear();
+}
+
 GateIO::ActivityStatus GateIO::check_client_connection(sockpp::tcp6_acceptor& tcp_server, std::optional<sockpp::tcp6_socket>& client_opt) {
     ActivityStatus status = ActivityStatus::WAITING_ACTIVITY;
 
@@ -72,7 +113,8 @@ GateIO::ActivityStatus GateIO::handle_sending_data(sockpp::tcp6_socket& client)
     ActivityStatus status = ActivityStatus::WAITING_ACTIVITY;
     std::unique_lock<std::mutex> lock(m_tasks_mutex);
 
-    if (!m_send_tasks.empty()) {
+    // a progress telegram being sent must be finished first, telegrams are never interleaved
+    if (!m_send_tasks.empty() && m_progress_send_buffer.empty()) {
         const TaskPtr& task = m_send_tasks.at(0);
         try {
             std::size_t bytes_to_send = std::min(CHUNK_MAX_BYTES_NUM, task->response_buffer().size());
@@ -109,6 +151,52 @@ GateIO::ActivityStatus GateIO::handle_sending_data(sockpp::tcp6_socket& client)
     return status;
 }
 
+GateIO::ActivityStatus GateIO::handle_sending_progress(sockpp::tcp6_socket& client) {
+    ActivityStatus status = ActivityStatus::WAITING_ACTIVITY;
+
+    if (m_progress_send_buffer.empty()) {
+        // only start a new progress telegram between task responses
+        bool is_response_being_sent = false;
+        {
+            std::unique_lock<std::mutex> lock(m_tasks_mutex);
+            is_response_being_sent = !m_send_tasks.empty() && (m_send_tasks.at(0)->response_buffer().size() != m_send_tasks.at(0)->orig_reponse_bytes_num());
+        }
+
+        std::optional<ProgressFrame> frame_opt;
+        if (!is_response_being_sent) {
+            std::unique_lock<std::mutex> lock(m_progress_frames_mutex);
+            if (!m_progress_frames.empty()) {
+                frame_opt = std::move(m_progress_frames.front());
+                m_progress_frames.pop_front();
+            }
+        }
+
+        if (frame_opt) {
+            std::string body = encode_progress_frame(frame_opt.value());
+            comm::TelegramHeader header = comm::TelegramHeader::construct_from_body(body, comm::NONE_COMPRESSOR_ID);
+            m_progress_send_buffer.append(header.buffer().begin(), header.buffer().end());
+            m_progress_send_buffer.append(body);
+        }
+    }
+
+    if (!m_progress_send_buffer.empty()) {
+        try {
+            std::size_t bytes_to_send = std::min(CHUNK_MAX_BYTES_NUM, m_progress_send_buffer.size());
+            std::size_t bytes_sent = client.write_n(m_progress_send_buffer.data(), bytes_to_send);
+            if (bytes_sent <= m_progress_send_buffer.size()) {
+                m_progress_send_buffer.erase(0, bytes_sent);
+                m_logger.queue(LogLevel::Debug, "sent progress chunk:", get_pretty_size_str_from_bytes_num(bytes_sent));
+                status = ActivityStatus::CLIENT_ACTIVITY;
+            }
+        } catch(...) {
+            m_logger.queue(LogLevel::Detail, "error while writing progress chunk");
+            status = ActivityStatus::COMMUNICATION_PROBLEM;
+        }
+    }
+
+    return status;
+}
+
 GateIO::ActivityStatus GateIO::handle_receiving_data(sockpp::tcp6_socket& client, comm::TelegramBuffer& telegram_buff, std::string& received_message) {
     ActivityStatus status = ActivityStatus::WAITING_ACTIVITY;
     std::size_t bytes_actually_received{0};
@@ -151,8 +239,12 @@ GateIO::ActivityStatus GateIO::handle_telegrams(std::vector<comm::TelegramFrameP
                 TaskPtr task = std::make_unique<Task>(job_id_opt.value(), static_cast<comm::CMD>(cmd_opt.value()), options_opt.value());
                 const comm::TelegramHeader& header = telegram_frame->header;
                 m_logger.queue(LogLevel::Info, "received:", header.info(), task->info(/*skipDuration*/true));
-                std::unique_lock<std::mutex> lock(m_tasks_mutex);
-                m_received_tasks.push_back(std::move(task));
+                if (task->cmd() == comm::CMD::SUBSCRIBE_PROGRESS_ID) {
+                    handle_progress_subscription(task);
+                } else {
+                    std::unique_lock<std::mutex> lock(m_tasks_mutex);
+                    m_received_tasks.push_back(std::move(task));
+                }
             } else {
                 m_logger.queue(LogLevel::Error, "broken telegram detected, fail extract options from", message);
             }
@@ -245,7 +337,10 @@ void GateIO::start_listening() {
             sockpp::tcp6_socket& client = client_opt.value(); // shortcut
 
             /// handle sending
-            ActivityStatus status = handle_sending_data(client);
+            ActivityStatus status = handle_sending_progress(client);
+            handle_activity_status(status, client_alive_tracker_ptr, is_communication_problem_detected);
+
+            status = handle_sending_data(client);
             handle_activity_status(status, client_alive_tracker_ptr, is_communication_problem_detected);
 
             /// handle receiving
@@ -270,6 +365,8 @@ void GateIO::start_listening() {
             /// handle communication problem
             if (is_communication_problem_detected) {
                 client_opt = std::nullopt;
+                cancel_progress_subscription();
+                m_progress_send_buffer.clear();
                 if (!telegram_buff.empty()) {
                     m_logger.queue(LogLevel::Debug, "clear telegramBuff");
                     telegram_buff.clear();
@@ -5,6 +5,7 @@
 
 #include "task.h"
 #include "telegrambuffer.h"
+#include "progressframe.h"
 
 #include "vtr_log.h"
 
@@ -12,6 +13,7 @@
 #include <sstream>
 #include <thread>
 #include <atomic>
+#include <deque>
 #include <mutex>
 #include <vector>
 #include <utility>
@@ -37,6 +39,9 @@ namespace server {
  *   and responsiveness of the application.
  * - GateIO is not started automatically upon creation, you have to use the 'start' method with the port number.
  * - The socket is initialized in a non-blocking mode to function properly in a multithreaded environment.
+ * - A client may subscribe to the placement and routing progress (see @ref comm::CMD::SUBSCRIBE_PROGRESS_ID).
+ *   The subscription is handled in the IO thread, since the main thread is busy placing or routing, and the
+ *   progress frames queued by the placer and router are encoded and sent from the IO thread as well.
 */
 class GateIO
 {
@@ -140,6 +145,10 @@ class GateIO
 
     const int LOOP_INTERVAL_MS = 100;
 
+    const std::size_t PROGRESS_FRAMES_MAX_NUM = 16; // queued frames beyond this number drop the oldest ones
+    const int DEFAULT_PROGRESS_HEATMAP_SIZE = 32;
+    const int MAX_PROGRESS_HEATMAP_SIZE = 256;
+
 public:
     /**
      * @brief Default constructor for GateIO.
@@ -181,6 +190,26 @@ public:
     */
     void move_tasks_to_send_queue(std::vector<TaskPtr>& tasks);
 
+    /**
+     * @brief Returns whether the connected client subscribed to the placement and routing progress.
+     */
+    bool is_progress_subscribed() const { return m_is_progress_subscribed.load(); }
+
+    /**
+     * @brief Returns the largest width and height, in cells, of the congestion heatmaps requested by the subscribed client.
+     */
+    int progress_heatmap_size() const { return m_progress_heatmap_size.load(); }
+
+    /**
+     * @brief Queues a progress frame to be sent to the subscribed client.
+     *
+     * Only moves the frame into the queue: it is encoded and sent by the IO thread.
+     * If the client does not keep up, the oldest queued frames are dropped.
+     *
+     * @param frame The progress frame, moved into the queue.
+     */
+    void queue_progress_frame(ProgressFrame&& frame);
+
     /**
      * @brief Prints log messages for the GateIO.
      * 
@@ -221,6 +250,13 @@ private:
     std::vector<TaskPtr> m_received_tasks; // tasks from client (requests)
     std::vector<TaskPtr> m_send_tasks; // tasks to client (responses)
 
+    std::atomic<bool> m_is_progress_subscribed{false};
+    std::atomic<int> m_progress_heatmap_size{DEFAULT_PROGRESS_HEATMAP_SIZE};
+
+    std::mutex m_progress_frames_mutex; // guards m_progress_frames
+    std::deque<ProgressFrame> m_progress_frames; // progress frames to client
+    std::string m_progress_send_buffer; // telegram of the progress frame being sent, only used by the IO thread
+
     TLogger m_logger;
 
     void start_listening(); // thread worker function
@@ -228,6 +264,9 @@ private:
     /// helper functions to be executed inside startListening
     ActivityStatus check_client_connection(sockpp::tcp6_acceptor& tcp_server, std::optional<sockpp::tcp6_socket>& client_opt);
     ActivityStatus handle_sending_data(sockpp::tcp6_socket& client);
+    ActivityStatus handle_sending_progress(sockpp::tcp6_socket& client);
+    void handle_progress_subscription(TaskPtr& task);
+    void cancel_progress_subscription();
     ActivityStatus handle_receiving_data(sockpp::tcp6_socket& client, comm::TelegramBuffer& telegram_buff, std::string& received_message);
     ActivityStatus handle_telegrams(std::vector<comm::TelegramFramePtr>& telegram_frames, comm::TelegramBuffer& telegram_buff);
     ActivityStatus handle_client_alive_tracker(sockpp::tcp6_socket& client, std::unique_ptr<ClientAliveTracker>& client_alive_tracker_ptr);
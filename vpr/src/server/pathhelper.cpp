@@ -67,6 +67,68 @@ CritPathsResultPtr calc_critical_path(const std::string& report_type, int crit_p
     return result;
 }
 
+/**
+ * @brief Helper function to find the start of each path in the report, and the end of the last path.
+ */
+static std::vector<std::size_t> find_report_path_offsets(const std::string& report) {
+    static const std::string path_start{"#Path "};
+    static const std::string paths_end{"#End of timing report"};
+
+    std::vector<std::size_t> offsets;
+    std::size_t pos = 0;
+    while (pos < report.size()) {
+        if (report.compare(pos, path_start.size(), path_start) == 0) {
+            offsets.push_back(pos);
+        } else if (report.compare(pos, paths_end.size(), paths_end) == 0) {
+            break;
+        }
+
+        pos = report.find('\n', pos);
+        if (pos == std::string::npos) {
+            pos = report.size();
+        } else {
+            pos++;
+        }
+    }
+
+    if (!offsets.empty()) {
+        offsets.push_back(pos); // end of the last path
+    }
+    return offsets;
+}
+
+std::vector<std::string> get_report_paths(const std::string& report) {
+    std::vector<std::size_t> offsets = find_report_path_offsets(report);
+
+    std::vector<std::string> paths;
+    for (std::size_t i = 0; i + 1 < offsets.size(); i++) {
+        paths.emplace_back(report, offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    return paths;
+}
+
+std::string make_delta_report(const std::string& report, const std::vector<std::string>& paths, const std::vector<std::string>& prev_paths) {
+    std::vector<std::size_t> offsets = find_report_path_offsets(report);
+    if (offsets.empty()) {
+        return comm::KEY_DELTA_REPORT + "\n" + report;
+    }
+
+    std::string result = comm::KEY_DELTA_REPORT + "\n";
+    result.append(report, 0, offsets.front()); // header
+    for (std::size_t i = 0; i < paths.size(); i++) {
+        const std::string& path = paths[i];
+        if (i < prev_paths.size() && path == prev_paths[i]) {
+            std::size_t title_end = path.find('\n');
+            result.append(path, 0, title_end);
+            result += " " + comm::KEY_UNCHANGED_PATH + "\n";
+        } else {
+            result += path;
+        }
+    }
+    result.append(report, offsets.back(), std::string::npos); // end of report and metadata
+    return result;
+}
+
 } // namespace server
 
 #endif /* NO_SERVER */
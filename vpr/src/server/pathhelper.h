@@ -48,6 +48,28 @@ using CritPathsResultPtr = std::shared_ptr<CritPathsResult>;
 */
 CritPathsResultPtr calc_critical_path(const std::string& type, int crit_path_num, e_timing_report_detail details_level, bool is_flat_routing);
 
+/**
+* @brief Splits a critical path report into its paths.
+*
+* Each path is the "#Path N" section of the report, from its first line up to the next path (or the end of the paths).
+* @param report The critical path report.
+* @return The text of each path in the report.
+*/
+std::vector<std::string> get_report_paths(const std::string& report);
+
+/**
+* @brief Builds a delta report, which only contains the paths changed since the previous report.
+*
+* The delta report starts with a "#RPT DELTA" line, followed by the report with every path identical to the path
+* with the same index in the previous report replaced by a single "#Path N unchanged" line. The report header and
+* metadata are always kept as is.
+* @param report The critical path report.
+* @param paths The paths of the report (see @ref get_report_paths).
+* @param prev_paths The paths of the previous report.
+* @return The delta report.
+*/
+std::string make_delta_report(const std::string& report, const std::vector<std::string>& paths, const std::vector<std::string>& prev_paths);
+
 } // namespace server
 
 #endif /* NO_SERVER */
@@ -0,0 +1,87 @@
+#ifndef NO_SERVER
+
+#include "progressframe.h"
+
+#include <cstring>
+
+namespace server {
+
+namespace {
+
+template<typename T>
+void write_field(std::string& data, const T& value) {
+    data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool read_field(std::string_view& data, T& value) {
+    if (data.size() < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, data.data(), sizeof(T));
+    data.remove_prefix(sizeof(T));
+    return true;
+}
+
+/**
+ * @brief Applies op to each encoded field of frame, in encoding order, and returns whether all succeeded.
+ */
+template<typename Frame, typename Op>
+bool for_each_field(Frame& frame, Op op) {
+    return op(frame.stage)
+           && op(frame.iteration)
+           && op(frame.elapsed_sec)
+           && op(frame.cpd)
+           && op(frame.temperature)
+           && op(frame.av_cost)
+           && op(frame.av_bb_cost)
+           && op(frame.av_timing_cost)
+           && op(frame.success_rate)
+           && op(frame.rlim)
+           && op(frame.pres_fac)
+           && op(frame.connections_routed)
+           && op(frame.nets_routed)
+           && op(frame.heap_pushes)
+           && op(frame.heap_pops)
+           && op(frame.overused_nodes)
+           && op(frame.total_overuse)
+           && op(frame.worst_overuse)
+           && op(frame.used_wirelength)
+           && op(frame.available_wirelength)
+           && op(frame.heatmap_width)
+           && op(frame.heatmap_height);
+}
+
+} // namespace
+
+std::string encode_progress_frame(const ProgressFrame& frame) {
+    std::string data{PROGRESS_FRAME_SIGNATURE};
+    for_each_field(frame, [&](const auto& value) {
+        write_field(data, value);
+        return true;
+    });
+    data.append(frame.heatmap.begin(), frame.heatmap.end());
+    return data;
+}
+
+std::optional<ProgressFrame> decode_progress_frame(std::string_view data) {
+    if (data.substr(0, PROGRESS_FRAME_SIGNATURE.size()) != PROGRESS_FRAME_SIGNATURE) {
+        return std::nullopt;
+    }
+    data.remove_prefix(PROGRESS_FRAME_SIGNATURE.size());
+
+    ProgressFrame frame;
+    bool is_valid = for_each_field(frame, [&](auto& value) {
+        return read_field(data, value);
+    });
+    if (!is_valid || data.size() != std::size_t(frame.heatmap_width) * frame.heatmap_height) {
+        return std::nullopt;
+    }
+    frame.heatmap.assign(data.begin(), data.end());
+
+    return frame;
+}
+
+} // namespace server
+
+#endif /* NO_SERVER */
@@ -0,0 +1,77 @@
+#ifndef PROGRESSFRAME_H
+#define PROGRESSFRAME_H
+
+#ifndef NO_SERVER
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace server {
+
+/**
+ * @brief A snapshot of the placement or routing progress, streamed to the clients which subscribed
+ * to it (see @ref comm::CMD::SUBSCRIBE_PROGRESS_ID).
+ *
+ * Each frame is sent as the body of its own telegram, in a compact binary encoding (see
+ * @ref encode_progress_frame) starting with @ref PROGRESS_FRAME_SIGNATURE, which tells it apart
+ * from the JSON task responses.
+ */
+struct ProgressFrame {
+    enum class Stage : uint8_t {
+        PLACEMENT = 0,
+        ROUTING = 1
+    };
+
+    Stage stage = Stage::ROUTING;
+
+    int32_t iteration = 0;     ///< Temperature number when placing, router iteration when routing
+    float elapsed_sec = 0.f;   ///< Time spent in the iteration
+    float cpd = 0.f;           ///< Critical path delay (seconds), 0 if not timing driven
+
+    /// Placement only
+    float temperature = 0.f;
+    float av_cost = 0.f;
+    float av_bb_cost = 0.f;
+    float av_timing_cost = 0.f;
+    float success_rate = 0.f;
+    float rlim = 0.f;
+
+    /// Routing only
+    float pres_fac = 0.f;
+    uint64_t connections_routed = 0;
+    uint64_t nets_routed = 0;
+    uint64_t heap_pushes = 0;
+    uint64_t heap_pops = 0;
+    uint64_t overused_nodes = 0;
+    uint64_t total_overuse = 0;
+    uint64_t worst_overuse = 0;
+    uint64_t used_wirelength = 0;
+    uint64_t available_wirelength = 0;
+
+    /// Downsampled routing channel utilization, [y * heatmap_width + x], in percent (saturating at 255)
+    uint16_t heatmap_width = 0;
+    uint16_t heatmap_height = 0;
+    std::vector<uint8_t> heatmap;
+};
+
+inline const std::string PROGRESS_FRAME_SIGNATURE{"VPRPROG1"};
+
+/**
+ * @brief Encodes a progress frame: the signature, then each field in declaration order (in host byte order,
+ * like the telegram header), then the heatmap cells.
+ */
+std::string encode_progress_frame(const ProgressFrame& frame);
+
+/**
+ * @brief Decodes a frame encoded by @ref encode_progress_frame, or returns std::nullopt if data is not one.
+ */
+std::optional<ProgressFrame> decode_progress_frame(std::string_view data);
+
+} // namespace server
+
+#endif /* NO_SERVER */
+
+#endif /* PROGRESSFRAME_H */
@@ -0,0 +1,113 @@
+#ifndef NO_SERVER
+
+#include "progressupdate.h"
+#include "globals.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace server {
+
+/**
+ * @brief Fills the heatmap of frame with the channel utilization (occupancy over capacity of the CHANX
+ * and CHANY nodes) of bins of grid tiles, at most heatmap_size bins along each axis.
+ */
+static void load_channel_utilization_heatmap(ProgressFrame& frame, int heatmap_size) {
+    const auto& device_ctx = g_vpr_ctx.device();
+    const auto& route_ctx = g_vpr_ctx.routing();
+    const auto& rr_graph = device_ctx.rr_graph;
+
+    int grid_width = device_ctx.grid.width();
+    int grid_height = device_ctx.grid.height();
+    if (heatmap_size <= 0 || grid_width <= 0 || grid_height <= 0) {
+        return;
+    }
+
+    int bin_width = (grid_width + heatmap_size - 1) / heatmap_size;
+    int bin_height = (grid_height + heatmap_size - 1) / heatmap_size;
+    frame.heatmap_width = (grid_width + bin_width - 1) / bin_width;
+    frame.heatmap_height = (grid_height + bin_height - 1) / bin_height;
+
+    std::vector<uint64_t> bin_occupancy(frame.heatmap_width * frame.heatmap_height, 0);
+    std::vector<uint64_t> bin_capacity(frame.heatmap_width * frame.heatmap_height, 0);
+    for (RRNodeId node : rr_graph.nodes()) {
+        t_rr_type node_type = rr_graph.node_type(node);
+        if (node_type != CHANX && node_type != CHANY) {
+            continue;
+        }
+
+        // wires are binned at their middle
+        int x = (rr_graph.node_xlow(node) + rr_graph.node_xhigh(node)) / 2;
+        int y = (rr_graph.node_ylow(node) + rr_graph.node_yhigh(node)) / 2;
+        std::size_t bin = std::size_t(y / bin_height) * frame.heatmap_width + x / bin_width;
+        bin_occupancy[bin] += std::max<int>(route_ctx.rr_node_cong_inf[node].occ(), 0);
+        bin_capacity[bin] += rr_graph.node_capacity(node);
+    }
+
+    frame.heatmap.resize(bin_occupancy.size());
+    for (std::size_t bin = 0; bin < bin_occupancy.size(); bin++) {
+        double utilization_percent = (bin_capacity[bin] > 0) ? 100. * bin_occupancy[bin] / bin_capacity[bin] : 0.;
+        frame.heatmap[bin] = uint8_t(std::min(std::lround(utilization_percent), 255L));
+    }
+}
+
+void update_placement_progress(const t_annealing_state& state,
+                               const t_placer_statistics& stats,
+                               float elapsed_sec,
+                               float cpd) {
+    GateIO& gate_io = g_vpr_ctx.mutable_server().gate_io;
+    if (!gate_io.is_progress_subscribed()) {
+        return;
+    }
+
+    ProgressFrame frame;
+    frame.stage = ProgressFrame::Stage::PLACEMENT;
+    frame.iteration = state.num_temps;
+    frame.elapsed_sec = elapsed_sec;
+    frame.cpd = std::isfinite(cpd) ? cpd : 0.f;
+    frame.temperature = state.t;
+    frame.av_cost = stats.av_cost;
+    frame.av_bb_cost = stats.av_bb_cost;
+    frame.av_timing_cost = stats.av_timing_cost;
+    frame.success_rate = stats.success_rate;
+    frame.rlim = state.rlim;
+
+    gate_io.queue_progress_frame(std::move(frame));
+}
+
+void update_routing_progress(int itry,
+                             float elapsed_sec,
+                             float pres_fac,
+                             const RouterStats& router_stats,
+                             const OveruseInfo& overuse_info,
+                             const WirelengthInfo& wirelength_info,
+                             float cpd) {
+    GateIO& gate_io = g_vpr_ctx.mutable_server().gate_io;
+    if (!gate_io.is_progress_subscribed()) {
+        return;
+    }
+
+    ProgressFrame frame;
+    frame.stage = ProgressFrame::Stage::ROUTING;
+    frame.iteration = itry;
+    frame.elapsed_sec = elapsed_sec;
+    frame.cpd = std::isfinite(cpd) ? cpd : 0.f;
+    frame.pres_fac = pres_fac;
+    frame.connections_routed = router_stats.connections_routed;
+    frame.nets_routed = router_stats.nets_routed;
+    frame.heap_pushes = router_stats.heap_pushes;
+    frame.heap_pops = router_stats.heap_pops;
+    frame.overused_nodes = overuse_info.overused_nodes;
+    frame.total_overuse = overuse_info.total_overuse;
+    frame.worst_overuse = overuse_info.worst_overuse;
+    frame.used_wirelength = wirelength_info.used_wirelength();
+    frame.available_wirelength = wirelength_info.available_wirelength();
+
+    load_channel_utilization_heatmap(frame, gate_io.progress_heatmap_size());
+
+    gate_io.queue_progress_frame(std::move(frame));
+}
+
+} // namespace server
+
+#endif /* NO_SERVER */
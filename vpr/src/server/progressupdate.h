@@ -0,0 +1,40 @@
+#ifndef PROGRESSUPDATE_H
+#define PROGRESSUPDATE_H
+
+#ifndef NO_SERVER
+
+#include "place_util.h"
+#include "router_stats.h"
+
+namespace server {
+
+/**
+ * @brief Queues a placement progress frame for the client subscribed to the progress, if any.
+ *
+ * Called by the placer after each temperature.
+ */
+void update_placement_progress(const t_annealing_state& state,
+                               const t_placer_statistics& stats,
+                               float elapsed_sec,
+                               float cpd);
+
+/**
+ * @brief Queues a routing progress frame, with a downsampled channel utilization heatmap, for the
+ * client subscribed to the progress, if any.
+ *
+ * Called by the router after each iteration, from the main thread. Only the frame is assembled here,
+ * the frame is encoded and sent from the server's IO thread.
+ */
+void update_routing_progress(int itry,
+                             float elapsed_sec,
+                             float pres_fac,
+                             const RouterStats& router_stats,
+                             const OveruseInfo& overuse_info,
+                             const WirelengthInfo& wirelength_info,
+                             float cpd);
+
+} // namespace server
+
+#endif /* NO_SERVER */
+
+#endif /* PROGRESSUPDATE_H */
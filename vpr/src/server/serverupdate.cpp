@@ -6,44 +6,66 @@
 #include "globals.h"
 #include "ezgl/application.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace server {
 
-gboolean update(gpointer data) {
-    const bool is_running = g_vpr_ctx.server().gate_io.is_running();
-    if (is_running) {
-        // shortcuts
-        ezgl::application* app = static_cast<ezgl::application*>(data);
-        GateIO& gate_io = g_vpr_ctx.mutable_server().gate_io;
-        TaskResolver& task_resolver = g_vpr_ctx.mutable_server().task_resolver;
+/**
+ * @brief Resolves the received tasks and queues the finished ones for sending.
+ *
+ * @param app The graphics application, or nullptr when running without graphics.
+ * @return True if any task was processed.
+ */
+static bool process_tasks(ezgl::application* app) {
+    // shortcuts
+    GateIO& gate_io = g_vpr_ctx.mutable_server().gate_io;
+    TaskResolver& task_resolver = g_vpr_ctx.mutable_server().task_resolver;
 
-        std::vector<TaskPtr> tasks_buff;
+    std::vector<TaskPtr> tasks_buff;
 
-        gate_io.take_received_tasks(tasks_buff);
-        for (TaskPtr& task: tasks_buff) {
-            task_resolver.own_task(std::move(task));
-        }
-        tasks_buff.clear();
+    gate_io.take_received_tasks(tasks_buff);
+    for (TaskPtr& task: tasks_buff) {
+        task_resolver.own_task(std::move(task));
+    }
+    tasks_buff.clear();
+
+    bool has_finished_tasks = false;
+    const bool is_server_context_initialized = g_vpr_ctx.server().timing_info && g_vpr_ctx.server().routing_delay_calc;
+    if (is_server_context_initialized) {
+        has_finished_tasks = task_resolver.update(app);
+
+        task_resolver.take_finished_tasks(tasks_buff);
 
-        const bool is_server_context_initialized = g_vpr_ctx.server().timing_info && g_vpr_ctx.server().routing_delay_calc;
-        if (is_server_context_initialized) {
-            bool has_finished_tasks = task_resolver.update(app);
+        gate_io.move_tasks_to_send_queue(tasks_buff);
+    }
+    gate_io.print_logs();
 
-            task_resolver.take_finished_tasks(tasks_buff);
+    return has_finished_tasks;
+}
 
-            gate_io.move_tasks_to_send_queue(tasks_buff);
+gboolean update(gpointer data) {
+    const bool is_running = g_vpr_ctx.server().gate_io.is_running();
+    if (is_running) {
+        ezgl::application* app = static_cast<ezgl::application*>(data);
 
-            // Call the redraw method of the application if any of task was processed
-            if (has_finished_tasks) {
-                app->refresh_drawing();
-            }
+        // Call the redraw method of the application if any of task was processed
+        if (process_tasks(app)) {
+            app->refresh_drawing();
         }
-        gate_io.print_logs();
     }
     
     // Return TRUE to keep the timer running, or FALSE to stop it
     return is_running;
 }
 
+void run_headless() {
+    while (g_vpr_ctx.server().gate_io.is_running()) {
+        process_tasks(/*app*/ nullptr);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+}
+
 } // namespace server
 
 #endif // NO_SERVER
@@ -16,6 +16,15 @@ namespace server {
  */
 gboolean update(gpointer);
 
+/**
+ * @brief Serves client requests without graphics.
+ *
+ * Without graphics the ezgl main loop, which invokes @ref update, never runs. This function instead
+ * processes client requests at the same interval, and only returns once the server is stopped.
+ * Requests which need the graphics (e.g. drawing a critical path) fail.
+ */
+void run_headless();
+
 } // namespace server
 
 #endif /* NO_SERVER */
@@ -95,14 +95,25 @@ void TaskResolver::process_get_path_list_task(ezgl::application*, const TaskPtr&
         const std::string path_type = options.get_string(comm::OPTION_PATH_TYPE);
         const std::string details_level_str = options.get_string(comm::OPTION_DETAILS_LEVEL);
         const bool is_flat = options.get_bool(comm::OPTION_IS_FLAT_ROUTING, false);
+        const bool is_delta = options.has_option(comm::OPTION_IS_DELTA_REPORT) && options.get_bool(comm::OPTION_IS_DELTA_REPORT, false);
 
         // calculate critical path depending on options and store result in server context
         std::optional<e_timing_report_detail> details_level_opt = try_get_details_level_enum(details_level_str);
         if (details_level_opt) {
-            CritPathsResultPtr crit_paths_result = calc_critical_path(path_type, n_critical_path_num, details_level_opt.value(), is_flat);
+            CritPathsResultPtr crit_paths_result = get_critical_path(path_type, n_critical_path_num, details_level_opt.value(), is_flat);
             if (crit_paths_result->is_valid()) {
-                server_ctx.crit_paths = std::move(crit_paths_result->paths);
-                task->set_success(std::move(crit_paths_result->report));
+                server_ctx.crit_paths = crit_paths_result->paths;
+
+                // a delta report is only meaningful against a previous report with the same options
+                std::string report_options = path_type + ";" + details_level_str + ";" + std::to_string(n_critical_path_num) + ";" + std::to_string(is_flat);
+                std::vector<std::string> report_paths = get_report_paths(crit_paths_result->report);
+                if (is_delta && report_options == server_ctx.crit_path_report_options) {
+                    task->set_success(make_delta_report(crit_paths_result->report, report_paths, server_ctx.crit_path_report_paths));
+                } else {
+                    task->set_success(std::string{crit_paths_result->report});
+                }
+                server_ctx.crit_path_report_paths = std::move(report_paths);
+                server_ctx.crit_path_report_options = std::move(report_options);
             } else {
                 std::string msg{"Critical paths report is empty"};
                 VTR_LOG_ERROR(msg.c_str());
@@ -120,7 +131,35 @@ void TaskResolver::process_get_path_list_task(ezgl::application*, const TaskPtr&
     }
 }
 
+CritPathsResultPtr TaskResolver::get_critical_path(const std::string& type, int crit_path_num, e_timing_report_detail details_level, bool is_flat_routing) {
+    // any timing update invalidates the cached path lists
+    std::size_t timing_version = g_vpr_ctx.timing().stats.num_full_updates();
+    if (timing_version != m_crit_paths_cache_timing_version) {
+        m_crit_paths_cache.clear();
+        m_crit_paths_cache_timing_version = timing_version;
+    }
+
+    CritPathsKey key{type, crit_path_num, details_level, is_flat_routing};
+    auto it = m_crit_paths_cache.find(key);
+    if (it != m_crit_paths_cache.end()) {
+        return it->second;
+    }
+
+    CritPathsResultPtr result = calc_critical_path(type, crit_path_num, details_level, is_flat_routing);
+    if (result->is_valid()) {
+        m_crit_paths_cache.emplace(std::move(key), result);
+    }
+    return result;
+}
+
 void TaskResolver::process_draw_critical_path_task(ezgl::application* app, const TaskPtr& task) {
+    if (!app) {
+        std::string msg{"cannot draw critical path, server is running without graphics"};
+        VTR_LOG_ERROR(msg.c_str());
+        task->set_fail(msg);
+        return;
+    }
+
     TelegramOptions options{task->options(), {comm::OPTION_PATH_ELEMENTS, comm::OPTION_HIGHLIGHT_MODE, comm::OPTION_DRAW_PATH_CONTOUR}};
     if (!options.has_errors()) {
         ServerContext& server_ctx = g_vpr_ctx.mutable_server(); // shortcut
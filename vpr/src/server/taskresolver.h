@@ -4,8 +4,11 @@
 #ifndef NO_SERVER
 
 #include "task.h"
+#include "pathhelper.h"
 #include "vpr_types.h"
 
+#include <map>
+#include <tuple>
 #include <vector>
 #include <optional>
 
@@ -46,7 +49,8 @@ public:
     /**
     * @brief Resolve queued tasks.
     *
-    * @param app A pointer to the ezgl::application object representing the application instance.
+    * @param app A pointer to the ezgl::application object representing the application instance,
+    *            or nullptr when the server runs without graphics.
     */
     bool update(ezgl::application* app);
 
@@ -66,6 +70,26 @@ public:
 private:
     std::vector<TaskPtr> m_tasks;
 
+    /**
+     * @brief Critical path list identifier: path type, number of paths, report details level and flat routing flag.
+     */
+    using CritPathsKey = std::tuple<std::string, int, e_timing_report_detail, bool>;
+
+    /**
+     * @brief Calculated critical path lists, which are valid while the timing analysis stays the same.
+     *
+     * Repeated path list requests (e.g. from a client switching between report views) are served
+     * from the cache instead of enumerating the timing paths again.
+     */
+    std::map<CritPathsKey, CritPathsResultPtr> m_crit_paths_cache;
+
+    /**
+     * @brief The number of full timing updates when the cached critical path lists were calculated.
+     */
+    std::size_t m_crit_paths_cache_timing_version = 0;
+
+    CritPathsResultPtr get_critical_path(const std::string& type, int crit_path_num, e_timing_report_detail details_level, bool is_flat_routing);
+
     void process_get_path_list_task(ezgl::application*, const TaskPtr&);
     void process_draw_critical_path_task(ezgl::application*, const TaskPtr&);
 
@@ -57,6 +57,16 @@ public:
      */
     bool has_errors() const { return !m_errors.empty(); }
 
+    /**
+     * @brief Checks if the option with the specified key is present.
+     *
+     * This is used for optional keys, which are not listed in the expected keys.
+     *
+     * @param key The key of the option to check.
+     * @return True if the option is present, false otherwise.
+     */
+    bool has_option(const std::string& key) const { return m_options.find(key) != m_options.end(); }
+
     /**
      * @brief Retrieves a map of sets associated with the specified key.
      *
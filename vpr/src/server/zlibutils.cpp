@@ -22,7 +22,7 @@ std::optional<std::string> try_compress(const std::string& decompressed) {
 
     do {
         zs.next_out = reinterpret_cast<Bytef*>(result_buffer);
-        zs.avail_out = sizeof(result_buffer);
+        zs.avail_out = BYTES_NUM_IN_32KB;
 
         ret_code = deflate(&zs, Z_FINISH);
 
@@ -59,7 +59,7 @@ std::optional<std::string> try_decompress(const std::string& compressed) {
 
     do {
         zs.next_out = reinterpret_cast<Bytef*>(result_buffer);
-        zs.avail_out = sizeof(result_buffer);
+        zs.avail_out = BYTES_NUM_IN_32KB;
 
         ret_code = inflate(&zs, 0);
 
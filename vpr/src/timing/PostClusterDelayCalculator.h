@@ -31,6 +31,23 @@ class PostClusterDelayCalculator : public tatum::DelayCalculator {
 
     void clear_cache();
 
+    /**
+     * @brief Enables (or disables) precomputation of the edge delays.
+     *
+     * By default every query re-derives the edge delay from the (cached) intra-cluster
+     * delays and the current net delays. When enabled, update_edge_delays() computes the
+     * delays and setup/hold times of all edges in a single (parallel) pass, and queries
+     * then simply read them from flat per-edge arrays.
+     *
+     * Since all edges are recomputed, this suits full (non-incremental) timing updates.
+     * Note that between updates the queries return the delays as of the last update,
+     * even if the net delays have changed since.
+     */
+    void set_precompute_edge_delays(bool val);
+
+    ///@brief Recomputes the delays of all edges, if edge delay precomputation is enabled
+    void update_edge_delays(const tatum::TimingGraph& tg);
+
     void set_tsu_margin_relative(float val);
     void set_tsu_margin_absolute(float val);
 
@@ -47,6 +64,8 @@ class PostClusterDelayCalculator : public tatum::DelayCalculator {
     tatum::Time atom_setup_time(const tatum::TimingGraph& tg, tatum::EdgeId edge_id) const;
     tatum::Time atom_hold_time(const tatum::TimingGraph& tg, tatum::EdgeId edge_id) const;
 
+    void load_edge_delays(const tatum::TimingGraph& tg, tatum::EdgeId edge_id);
+
     float inter_cluster_delay(ParentNetId net_id, const int driver_net_pin_index, const int sink_net_pin_index) const;
 
     tatum::Time get_cached_delay(tatum::EdgeId edge, DelayType delay_type) const;
@@ -87,6 +106,11 @@ class PostClusterDelayCalculator : public tatum::DelayCalculator {
     mutable vtr::vector<tatum::EdgeId, std::pair<ParentPinId, ParentPinId>> pin_cache_min_;
     mutable vtr::vector<tatum::EdgeId, std::pair<ParentPinId, ParentPinId>> pin_cache_max_;
     bool is_flat_;
+
+    bool precompute_edge_delays_ = false;
+    bool edge_delays_loaded_ = false;
+    vtr::vector<tatum::EdgeId, tatum::Time> edge_max_delays_; //Precomputed max delays (setup times on capture edges)
+    vtr::vector<tatum::EdgeId, tatum::Time> edge_min_delays_; //Precomputed min delays (hold times on capture edges)
 };
 
 #include "PostClusterDelayCalculator.tpp"
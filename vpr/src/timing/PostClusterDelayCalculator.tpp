@@ -7,6 +7,10 @@
 
 #include "vtr_assert.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 //Print detailed debug info about edge delay calculation
 /*#define POST_CLUSTER_DELAY_CALC_DEBUG*/
 
@@ -37,6 +41,52 @@ inline void PostClusterDelayCalculator::clear_cache() {
     std::fill(sink_clb_max_delay_cache_.begin(), sink_clb_max_delay_cache_.end(), tatum::Time(NAN));
     std::fill(pin_cache_min_.begin(), pin_cache_min_.end(), std::pair<ParentPinId, ParentPinId>(ParentPinId::INVALID(), ParentPinId::INVALID()));
     std::fill(pin_cache_max_.begin(), pin_cache_max_.end(), std::pair<ParentPinId, ParentPinId>(ParentPinId::INVALID(), ParentPinId::INVALID()));
+    edge_delays_loaded_ = false;
+}
+
+inline void PostClusterDelayCalculator::set_precompute_edge_delays(bool val) {
+    precompute_edge_delays_ = val;
+    edge_delays_loaded_ = false;
+}
+
+inline void PostClusterDelayCalculator::update_edge_delays(const tatum::TimingGraph& tg) {
+    if (!precompute_edge_delays_) return;
+
+    //Queries made while loading must calculate the delays
+    edge_delays_loaded_ = false;
+
+    size_t num_edges = tg.edges().size();
+    edge_max_delays_.resize(num_edges);
+    edge_min_delays_.resize(num_edges);
+
+    //Each edge only touches its own cache entries, so the edges can be processed concurrently
+    auto load_edge = [&](size_t iedge) {
+        load_edge_delays(tg, tatum::EdgeId(iedge));
+    };
+
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), num_edges, load_edge);
+#else
+    for (size_t iedge = 0; iedge < num_edges; ++iedge) {
+        load_edge(iedge);
+    }
+#endif
+
+    edge_delays_loaded_ = true;
+}
+
+inline void PostClusterDelayCalculator::load_edge_delays(const tatum::TimingGraph& tg, tatum::EdgeId edge_id) {
+    if (tg.edge_disabled(edge_id)) {
+        //Never queried
+        edge_max_delays_[edge_id] = tatum::Time(NAN);
+        edge_min_delays_[edge_id] = tatum::Time(NAN);
+    } else if (tg.edge_type(edge_id) == tatum::EdgeType::PRIMITIVE_CLOCK_CAPTURE) {
+        edge_max_delays_[edge_id] = atom_setup_time(tg, edge_id);
+        edge_min_delays_[edge_id] = atom_hold_time(tg, edge_id);
+    } else {
+        edge_max_delays_[edge_id] = calc_edge_delay(tg, edge_id, DelayType::MAX);
+        edge_min_delays_[edge_id] = calc_edge_delay(tg, edge_id, DelayType::MIN);
+    }
 }
 
 inline void PostClusterDelayCalculator::set_tsu_margin_relative(float new_margin) {
@@ -48,6 +98,10 @@ inline void PostClusterDelayCalculator::set_tsu_margin_absolute(float new_margin
 }
 
 inline tatum::Time PostClusterDelayCalculator::max_edge_delay(const tatum::TimingGraph& tg, tatum::EdgeId edge_id) const {
+    if (edge_delays_loaded_) {
+        return edge_max_delays_[edge_id];
+    }
+
 #ifdef POST_CLUSTER_DELAY_CALC_DEBUG
     VTR_LOG("=== Edge %zu (max) ===\n", size_t(edge_id));
 #endif
@@ -55,6 +109,10 @@ inline tatum::Time PostClusterDelayCalculator::max_edge_delay(const tatum::Timin
 }
 
 inline tatum::Time PostClusterDelayCalculator::min_edge_delay(const tatum::TimingGraph& tg, tatum::EdgeId edge_id) const {
+    if (edge_delays_loaded_) {
+        return edge_min_delays_[edge_id];
+    }
+
 #ifdef POST_CLUSTER_DELAY_CALC_DEBUG
     VTR_LOG("=== Edge %zu (min) ===\n", size_t(edge_id));
 #endif
@@ -62,6 +120,10 @@ inline tatum::Time PostClusterDelayCalculator::min_edge_delay(const tatum::Timin
 }
 
 inline tatum::Time PostClusterDelayCalculator::setup_time(const tatum::TimingGraph& tg, tatum::EdgeId edge_id) const {
+    if (edge_delays_loaded_) {
+        return edge_max_delays_[edge_id];
+    }
+
 #ifdef POST_CLUSTER_DELAY_CALC_DEBUG
     VTR_LOG("=== Edge %zu (setup) ===\n", size_t(edge_id));
 #endif
@@ -69,6 +131,10 @@ inline tatum::Time PostClusterDelayCalculator::setup_time(const tatum::TimingGra
 }
 
 inline tatum::Time PostClusterDelayCalculator::hold_time(const tatum::TimingGraph& tg, tatum::EdgeId edge_id) const {
+    if (edge_delays_loaded_) {
+        return edge_min_delays_[edge_id];
+    }
+
 #ifdef POST_CLUSTER_DELAY_CALC_DEBUG
     VTR_LOG("=== Edge %zu (hold) ===\n", size_t(edge_id));
 #endif
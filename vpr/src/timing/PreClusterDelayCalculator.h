@@ -1,6 +1,10 @@
 #ifndef PRE_CLUSTER_DELAY_CALCULATOR_H
 #define PRE_CLUSTER_DELAY_CALCULATOR_H
+#include <cmath>
+#include <limits>
+
 #include "vtr_assert.h"
+#include "vtr_vector.h"
 
 #include "tatum/Time.hpp"
 #include "tatum/delay_calc/DelayCalculator.hpp"
@@ -38,11 +42,32 @@ class PreClusterDelayCalculator : public tatum::DelayCalculator {
         } else {
             VTR_ASSERT(edge_type == tatum::EdgeType::INTERCONNECT);
 
+            //Connections already routed within a cluster use their intra-cluster delay
+            if (!intra_cluster_connection_delay_.empty()) {
+                AtomPinId sink_pin = netlist_lookup_.tnode_atom_pin(sink_node);
+                if (sink_pin && !std::isnan(intra_cluster_connection_delay_[sink_pin])) {
+                    return tatum::Time(intra_cluster_connection_delay_[sink_pin]);
+                }
+            }
+
             //External net delay
             return tatum::Time(inter_cluster_net_delay_);
         }
     }
 
+    /**
+     * @brief Sets the delay of the connection to the atom sink_pin, once it is routed within a cluster
+     *
+     * Until then (and for connections between clusters) the inter-cluster net delay is used. The timing
+     * edges of the connections must be invalidated for incremental timing analysis to pick up the change.
+     */
+    void set_intra_cluster_connection_delay(AtomPinId sink_pin, float delay) {
+        if (intra_cluster_connection_delay_.empty()) {
+            intra_cluster_connection_delay_.resize(netlist_.pins().size(), std::numeric_limits<float>::quiet_NaN());
+        }
+        intra_cluster_connection_delay_[sink_pin] = delay;
+    }
+
     tatum::Time setup_time(const tatum::TimingGraph& tg, tatum::EdgeId edge_id) const override {
         tatum::NodeId src_node = tg.edge_src_node(edge_id);
         tatum::NodeId sink_node = tg.edge_sink_node(edge_id);
@@ -166,6 +191,8 @@ class PreClusterDelayCalculator : public tatum::DelayCalculator {
     const AtomLookup& netlist_lookup_;
     const float inter_cluster_net_delay_;
     const std::unordered_map<AtomBlockId, t_pb_graph_node*> block_to_pb_gnode_;
+
+    vtr::vector<AtomPinId, float> intra_cluster_connection_delay_; ///<[sink pin] (NaN if not routed within a cluster)
 };
 
 #endif
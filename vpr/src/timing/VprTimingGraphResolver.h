@@ -19,6 +19,10 @@ class VprTimingGraphResolver : public tatum::TimingGraphNameResolver {
 
     tatum::EdgeDelayBreakdown edge_delay_breakdown(tatum::EdgeId edge, tatum::DelayType delay_type) const override;
 
+    //Only reads the netlists, placement, routing and the delay calculator's caches (which are filled
+    //by the timing analysis being reported), so the reports of different paths can be generated concurrently
+    bool is_concurrency_safe() const override { return true; }
+
     void set_detail_level(e_timing_report_detail report_detail);
 
   private:
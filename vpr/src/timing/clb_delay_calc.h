@@ -1,5 +1,9 @@
 #ifndef VPR_CLB_DELAY_CALC_H
 #define VPR_CLB_DELAY_CALC_H
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
 #include "DelayType.h"
 
 //Delay Calculator for routing internal to a clustered logic block
@@ -23,8 +27,17 @@ class ClbDelayCalc {
     const t_pb_graph_edge* find_pb_graph_edge(ClusterBlockId clb, int pb_route_idx) const;
     const t_pb_graph_edge* find_pb_graph_edge(const t_pb_graph_pin* driver, const t_pb_graph_pin* sink) const;
 
+    //Fills in pb_graph_edges_ for a logical block type
+    void build_pb_graph_edge_lookup(int type_index);
+
   private:
     IntraLbPbPinLookup intra_lb_pb_pin_lookup_;
+
+    //The pb_graph_edge (if any) between two pins of a logical block type, keyed by the driver and
+    //sink pin's pb_route indices: [type_index][driver << 32 | sink]. It only depends on the pb graph,
+    //so it is shared by all the clusters of the type (and never invalidated), and it is built for
+    //the types used by the clustered netlist up front so it is only read (by any number of threads)
+    std::vector<std::unordered_map<uint64_t, const t_pb_graph_edge*>> pb_graph_edges_;
 };
 
 #include "clb_delay_calc.inl"
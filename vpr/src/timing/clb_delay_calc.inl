@@ -7,7 +7,42 @@
  */
 
 inline ClbDelayCalc::ClbDelayCalc()
-    : intra_lb_pb_pin_lookup_(g_vpr_ctx.device().logical_block_types) {}
+    : intra_lb_pb_pin_lookup_(g_vpr_ctx.device().logical_block_types) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    pb_graph_edges_.resize(g_vpr_ctx.device().logical_block_types.size());
+
+    std::vector<bool> type_used(pb_graph_edges_.size(), false);
+    for (ClusterBlockId clb : cluster_ctx.clb_nlist.blocks()) {
+        int type_index = cluster_ctx.clb_nlist.block_type(clb)->index;
+        if (!type_used[type_index]) {
+            type_used[type_index] = true;
+            build_pb_graph_edge_lookup(type_index);
+        }
+    }
+}
+
+inline void ClbDelayCalc::build_pb_graph_edge_lookup(int type_index) {
+    const t_logical_block_type& type = g_vpr_ctx.device().logical_block_types[type_index];
+    if (!type.pb_graph_head) return;
+
+    auto& edges = pb_graph_edges_[type_index];
+    for (int ipin = 0; ipin < type.pb_graph_head->total_pb_pins; ++ipin) {
+        const t_pb_graph_pin* driver = intra_lb_pb_pin_lookup_.pb_gpin(type_index, ipin);
+        if (!driver) continue;
+
+        VTR_ASSERT(driver->pin_count_in_cluster == ipin);
+        for (int iedge = 0; iedge < driver->num_output_edges; ++iedge) {
+            const t_pb_graph_edge* edge = driver->output_edges[iedge];
+            VTR_ASSERT(edge);
+            VTR_ASSERT(edge->num_output_pins == 1);
+
+            //Like find_pb_graph_edge(), the last edge to a sink wins
+            uint64_t key = (uint64_t(ipin) << 32) | uint32_t(edge->output_pins[0]->pin_count_in_cluster);
+            edges[key] = edge;
+        }
+    }
+}
 
 inline float ClbDelayCalc::clb_input_to_internal_sink_delay(const ClusterBlockId block_id, const int pin_index, int internal_sink_pin, DelayType delay_type) const {
     return trace_delay(block_id, pin_index, internal_sink_pin, delay_type);
@@ -78,7 +113,15 @@ inline const t_pb_graph_edge* ClbDelayCalc::find_pb_graph_edge(ClusterBlockId cl
         int upstream_pb_route_idx = pb->pb_route[pb_route_idx].driver_pb_pin_id;
 
         if(upstream_pb_route_idx >= 0) {
-
+            //Look the edge up in the type's memo, rather than searching the upstream pin's edges
+            const auto& edges = pb_graph_edges_[type_index];
+            auto iter = edges.find((uint64_t(upstream_pb_route_idx) << 32) | uint32_t(pb_route_idx));
+            if (iter != edges.end()) {
+                return iter->second;
+            }
+
+            //Not in the memo (e.g. a type without clusters when it was built): search, which
+            //errors out if there is no such edge
             const t_pb_graph_pin* pb_gpin = intra_lb_pb_pin_lookup_.pb_gpin(type_index, pb_route_idx);
             const t_pb_graph_pin* upstream_pb_gpin = intra_lb_pb_pin_lookup_.pb_gpin(type_index, upstream_pb_route_idx);
 
@@ -2,6 +2,7 @@
 
 #include "timing_info.h"
 #include "concrete_timing_info.h"
+#include "PostClusterDelayCalculator.h"
 
 void warn_unconstrained(std::shared_ptr<const tatum::TimingAnalyzer> analyzer) {
     if (analyzer->num_unconstrained_startpoints() > 0) {
@@ -13,3 +14,7 @@ void warn_unconstrained(std::shared_ptr<const tatum::TimingAnalyzer> analyzer) {
                      analyzer->num_unconstrained_endpoints());
     }
 }
+
+void update_precomputed_edge_delays(PostClusterDelayCalculator& delay_calc, const tatum::TimingGraph& timing_graph) {
+    delay_calc.update_edge_delays(timing_graph);
+}
@@ -2,6 +2,8 @@
 #define VPR_CONCRETE_TIMING_INFO_H
 
 #include "vtr_log.h"
+#include "vtr_profiler_markers.h"
+#include "vtr_trace.h"
 #include "timing_info.h"
 #include "timing_util.h"
 #include "vpr_error.h"
@@ -12,6 +14,13 @@
 
 void warn_unconstrained(std::shared_ptr<const tatum::TimingAnalyzer> analyzer);
 
+class PostClusterDelayCalculator; //Forward declaration
+
+//Refreshes the edge delays precomputed by the delay calculator (if any) before a timing update.
+//Only PostClusterDelayCalculator precomputes edge delays (see PostClusterDelayCalculator::set_precompute_edge_delays())
+inline void update_precomputed_edge_delays(tatum::DelayCalculator& /*delay_calc*/, const tatum::TimingGraph& /*timing_graph*/) {}
+void update_precomputed_edge_delays(PostClusterDelayCalculator& delay_calc, const tatum::TimingGraph& timing_graph);
+
 //NOTE: These classes should not be used directly but created with the
 //      make_*_timing_info() functions in timing_info.h, and used through
 //      their abstract interfaces (SetupTimingInfo, HoldTimingInfo etc.)
@@ -108,11 +117,15 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
     }
 
     void update_setup() override {
+        vtr::ScopedTraceSpan trace_span("Setup timing analysis");
+        VTR_PROFILE_SCOPE(setup_timing_update);
+
         //Update the arrival and required times and re-calculate slacks
         double sta_wallclock_time = 0.;
         {
             auto start_time = Clock::now();
 
+            update_edge_delays();
             setup_analyzer_->update_setup_timing();
 
             sta_wallclock_time = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
@@ -136,6 +149,10 @@ class ConcreteSetupTimingInfo : public SetupTimingInfo {
         clear_cache();
     }
 
+    void update_edge_delays() {
+        update_precomputed_edge_delays(*delay_calc_, *timing_graph_);
+    }
+
     void update_setup_slacks() {
         clear_cache();
         slack_crit_.update_slacks_and_criticalities(*timing_graph_, *setup_analyzer_);
@@ -227,10 +244,14 @@ class ConcreteHoldTimingInfo : public HoldTimingInfo {
     }
 
     void update_hold() override {
+        vtr::ScopedTraceSpan trace_span("Hold timing analysis");
+        VTR_PROFILE_SCOPE(hold_timing_update);
+
         double sta_wallclock_time = 0.;
         {
             auto start_time = Clock::now();
 
+            update_edge_delays();
             hold_analyzer_->update_hold_timing();
 
             sta_wallclock_time = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
@@ -252,6 +273,10 @@ class ConcreteHoldTimingInfo : public HoldTimingInfo {
         timing_ctx.stats.num_full_hold_updates += 1;
     }
 
+    void update_edge_delays() {
+        update_precomputed_edge_delays(*delay_calc_, *timing_graph_);
+    }
+
     void update_hold_slacks() {
         slack_crit_.update_slacks_and_criticalities(*timing_graph_, *hold_analyzer_);
     }
@@ -335,10 +360,14 @@ class ConcreteSetupHoldTimingInfo : public SetupHoldTimingInfo {
     //  it performs a single combined STA to update both setup and hold (instead of calling it
     //  twice).
     void update() override {
+        vtr::ScopedTraceSpan trace_span("Setup and hold timing analysis");
+        VTR_PROFILE_SCOPE(timing_update);
+
         double sta_wallclock_time = 0.;
         {
             auto start_time = Clock::now();
 
+            setup_timing_.update_edge_delays();
             setup_hold_analyzer_->update_timing();
 
             sta_wallclock_time = std::chrono::duration_cast<dsec>(Clock::now() - start_time).count();
@@ -462,7 +491,7 @@ std::unique_ptr<SetupTimingInfo> make_setup_timing_info(std::shared_ptr<DelayCal
         analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis, tatum::ParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
     } else {
         VTR_ASSERT(update_type == e_timing_update_type::INCREMENTAL);
-        analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis, tatum::SerialIncrWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
+        analyzer = tatum::AnalyzerFactory<tatum::SetupAnalysis, tatum::ParallelIncrWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
     }
 
     return std::make_unique<ConcreteSetupTimingInfo<DelayCalc>>(timing_ctx.graph, timing_ctx.constraints, delay_calculator, analyzer);
@@ -478,7 +507,7 @@ std::unique_ptr<HoldTimingInfo> make_hold_timing_info(std::shared_ptr<DelayCalc>
         analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis, tatum::ParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
     } else {
         VTR_ASSERT(update_type == e_timing_update_type::INCREMENTAL);
-        analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis, tatum::SerialIncrWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
+        analyzer = tatum::AnalyzerFactory<tatum::HoldAnalysis, tatum::ParallelIncrWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
     }
 
     return std::make_unique<ConcreteHoldTimingInfo<DelayCalc>>(timing_ctx.graph, timing_ctx.constraints, delay_calculator, analyzer);
@@ -494,7 +523,7 @@ std::unique_ptr<SetupHoldTimingInfo> make_setup_hold_timing_info(std::shared_ptr
         analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis, tatum::ParallelWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
     } else {
         VTR_ASSERT(update_type == e_timing_update_type::INCREMENTAL);
-        analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis, tatum::SerialIncrWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
+        analyzer = tatum::AnalyzerFactory<tatum::SetupHoldAnalysis, tatum::ParallelIncrWalker>::make(*timing_ctx.graph, *timing_ctx.constraints, *delay_calculator);
     }
 
     return std::make_unique<ConcreteSetupHoldTimingInfo<DelayCalc>>(timing_ctx.graph, timing_ctx.constraints, delay_calculator, analyzer);
@@ -9,6 +9,11 @@
 #include "globals.h"
 #include "net_delay.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/enumerable_thread_specific.h>
+#    include <tbb/parallel_for_each.h>
+#endif
+
 /* This module keeps track of the time delays for signals to arrive at       *
  * each pin in every net after timing-driven routing is complete. It         *
  * achieves this by first constructing the skeleton route tree               *
@@ -21,23 +26,23 @@
  * to check against the time delays computed incrementally during           *
  * timing-driven routing.                                                    */
 
-/********************** Variables local to this module ***********************/
-
-/* Unordered map below stores the pair whose key is the pin index (ranging   *
- * from 1 to net fan-out) that corresponds to the rt_node, and whose value   *
- * is the time delay associated with that node. The map will be used to      *
- * store delays while traversing the nodes of the route tree in              *
- * load_one_net_delay_recurr.      */
-
-static std::unordered_map<int, float> ipin_to_Tdel_map;
+/* The unordered map ipin_to_Tdel_map below stores the pair whose key is the *
+ * pin index (ranging from 1 to net fan-out) that corresponds to the rt_node, *
+ * and whose value is the time delay associated with that node. The map is    *
+ * used to store delays while traversing the nodes of the route tree in       *
+ * load_one_net_delay_recurr. It is scratch space, private to each thread     *
+ * since the nets are processed in parallel.                                  */
 
 /*********************** Subroutines local to this module ********************/
 
 static void load_one_net_delay(const Netlist<>& net_list,
                                NetPinsMatrix<float>& net_delay,
-                               ParentNetId net_id);
+                               ParentNetId net_id,
+                               std::unordered_map<int, float>& ipin_to_Tdel_map);
 
-static void load_one_net_delay_recurr(const RouteTreeNode& node, ParentNetId net_id);
+static void load_one_net_delay_recurr(const RouteTreeNode& node,
+                                      ParentNetId net_id,
+                                      std::unordered_map<int, float>& ipin_to_Tdel_map);
 
 static void load_one_constant_net_delay(const Netlist<>& net_list,
                                         NetPinsMatrix<float>& net_delay,
@@ -50,20 +55,33 @@ void load_net_delay_from_routing(const Netlist<>& net_list, NetPinsMatrix<float>
      * is the Elmore delay from the net source to the appropriate sink. Both       *
      * the rr_graph and the routing traceback must be completely constructed        *
      * before this routine is called, and the net_delay array must have been        *
-     * allocated.                                                                   */
+     * allocated. The nets are independent, so they are processed in parallel.       */
 
+#ifdef VPR_USE_TBB
+    tbb::enumerable_thread_specific<std::unordered_map<int, float>> thread_ipin_to_Tdel_map;
+    tbb::parallel_for_each(net_list.nets().begin(), net_list.nets().end(), [&](ParentNetId net_id) {
+        if (net_list.net_is_ignored(net_id)) {
+            load_one_constant_net_delay(net_list, net_delay, net_id, 0.);
+        } else {
+            load_one_net_delay(net_list, net_delay, net_id, thread_ipin_to_Tdel_map.local());
+        }
+    });
+#else
+    std::unordered_map<int, float> ipin_to_Tdel_map;
     for (auto net_id : net_list.nets()) {
         if (net_list.net_is_ignored(net_id)) {
             load_one_constant_net_delay(net_list, net_delay, net_id, 0.);
         } else {
-            load_one_net_delay(net_list, net_delay, net_id);
+            load_one_net_delay(net_list, net_delay, net_id, ipin_to_Tdel_map);
         }
     }
+#endif
 }
 
 static void load_one_net_delay(const Netlist<>& net_list,
                                NetPinsMatrix<float>& net_delay,
-                               ParentNetId net_id) {
+                               ParentNetId net_id,
+                               std::unordered_map<int, float>& ipin_to_Tdel_map) {
     /* This routine loads delay values for one net in                            *
      * net_delay[net_id][1..num_pins-1]. First, from the traceback, it           *
      * constructs the route tree and computes its values for R, C, and Tdel.     *
@@ -73,15 +91,15 @@ static void load_one_net_delay(const Netlist<>& net_list,
      * correspondingly update the entry in net_delay. Finally, it frees the      *
      * route tree and clears the ipin_to_Tdel_map associated with that net.      */
 
-    auto& route_ctx = g_vpr_ctx.mutable_routing();
+    auto& route_ctx = g_vpr_ctx.routing();
 
     if (!route_ctx.route_trees[net_id]) {
         VPR_FATAL_ERROR(VPR_ERROR_TIMING,
                         "in load_one_net_delay: Route tree for net %lu does not exist.\n", size_t(net_id));
     }
 
-    RouteTree& tree = route_ctx.route_trees[net_id].value();
-    load_one_net_delay_recurr(tree.root(), net_id); // recursively traverse the tree and load entries into the ipin_to_Tdel map
+    const RouteTree& tree = route_ctx.route_trees[net_id].value();
+    load_one_net_delay_recurr(tree.root(), net_id, ipin_to_Tdel_map); // recursively traverse the tree and load entries into the ipin_to_Tdel map
 
     for (unsigned int ipin = 1; ipin < net_list.net_pins(net_id).size(); ipin++) {
         auto itr = ipin_to_Tdel_map.find(ipin);
@@ -92,7 +110,9 @@ static void load_one_net_delay(const Netlist<>& net_list,
     ipin_to_Tdel_map.clear(); // clear the map
 }
 
-static void load_one_net_delay_recurr(const RouteTreeNode& rt_node, ParentNetId net_id) {
+static void load_one_net_delay_recurr(const RouteTreeNode& rt_node,
+                                      ParentNetId net_id,
+                                      std::unordered_map<int, float>& ipin_to_Tdel_map) {
     /* This routine recursively traverses the route tree, and copies the Tdel of the sink_type nodes *
      * into the map.                                                                                 */
     if (rt_node.net_pin_index != OPEN) {                        // value of OPEN indicates a non-SINK
@@ -100,7 +120,7 @@ static void load_one_net_delay_recurr(const RouteTreeNode& rt_node, ParentNetId
     }
 
     for (auto& child : rt_node.child_nodes()) { // process children
-        load_one_net_delay_recurr(child, net_id);
+        load_one_net_delay_recurr(child, net_id, ipin_to_Tdel_map);
     }
 }
 
@@ -1,5 +1,6 @@
 #include "read_sdc.h"
 
+#include <algorithm>
 #include <regex>
 
 #include "vtr_log.h"
@@ -50,6 +51,11 @@ std::map<std::string, AtomPinId> find_netlist_primary_ios(const AtomNetlist& net
 std::string orig_blif_name(std::string name);
 
 std::regex glob_pattern_to_regex(const std::string& glob_pattern);
+bool is_wildcard_glob_pattern(const std::string& glob_pattern);
+bool wildcard_glob_match(const char* glob_pattern, const char* str);
+bool find_sorted_glob_matches(const std::vector<std::pair<std::string, AtomPinId>>& sorted_names,
+                              const std::string& glob_pattern,
+                              std::set<AtomPinId>& matches);
 
 class SdcParseCallback : public sdcparse::Callback {
   public:
@@ -66,7 +72,8 @@ class SdcParseCallback : public sdcparse::Callback {
     //Start of parsing
     void start_parse() override {
         netlist_clock_drivers_ = find_netlist_logical_clock_drivers(netlist_);
-        netlist_primary_ios_ = find_netlist_primary_ios(netlist_);
+        auto primary_ios = find_netlist_primary_ios(netlist_);
+        netlist_primary_ios_.assign(primary_ios.begin(), primary_ios.end()); //Sorted by name
     }
 
     //Sets current filename
@@ -871,19 +878,7 @@ class SdcParseCallback : public sdcparse::Callback {
 
         std::set<AtomPinId> pins;
         for (const auto& port_pattern : port_group.strings) {
-            std::regex port_regex = glob_pattern_to_regex(port_pattern);
-
-            bool found = false;
-            for (const auto& kv : netlist_primary_ios_) {
-                const std::string& io_name = kv.first;
-                if (std::regex_match(io_name, port_regex)) {
-                    found = true;
-
-                    AtomPinId pin = kv.second;
-
-                    pins.insert(pin);
-                }
-            }
+            bool found = find_sorted_glob_matches(netlist_primary_ios_, port_pattern, pins);
 
             if (!found) {
                 VTR_LOGF_WARN(fname_.c_str(), lineno_,
@@ -968,19 +963,18 @@ class SdcParseCallback : public sdcparse::Callback {
                       "Expected pin collection via get_pins");
         }
 
-        for (const auto& pin_pattern : pin_group.strings) {
-            std::regex pin_regex = glob_pattern_to_regex(pin_pattern);
-
-            bool found = false;
+        //Large SDC files refer to many pins, so the pins are looked-up in a sorted
+        //name index (built on first use) rather than by matching every netlist pin
+        if (netlist_pin_names_.empty()) {
+            netlist_pin_names_.reserve(netlist_.pins().size());
             for (AtomPinId pin : netlist_.pins()) {
-                const std::string& pin_name = netlist_.pin_name(pin);
-
-                if (std::regex_match(pin_name, pin_regex)) {
-                    found = true;
-
-                    pins.insert(pin);
-                }
+                netlist_pin_names_.emplace_back(netlist_.pin_name(pin), pin);
             }
+            std::sort(netlist_pin_names_.begin(), netlist_pin_names_.end());
+        }
+
+        for (const auto& pin_pattern : pin_group.strings) {
+            bool found = find_sorted_glob_matches(netlist_pin_names_, pin_pattern, pins);
 
             if (!found) {
                 VTR_LOGF_WARN(fname_.c_str(), lineno_,
@@ -1045,7 +1039,8 @@ class SdcParseCallback : public sdcparse::Callback {
 
     std::map<tatum::DomainId, sdcparse::CreateClock> sdc_clocks_;
     std::set<AtomPinId> netlist_clock_drivers_;
-    std::map<std::string, AtomPinId> netlist_primary_ios_;
+    std::vector<std::pair<std::string, AtomPinId>> netlist_primary_ios_; //Sorted by name
+    std::vector<std::pair<std::string, AtomPinId>> netlist_pin_names_;   //Sorted by name, built on first use by get_pins()
 
     std::set<std::pair<tatum::DomainId, tatum::DomainId>> disabled_domain_pairs_;
     std::map<std::pair<tatum::DomainId, tatum::DomainId>, float> setup_override_constraints_;
@@ -1331,3 +1326,76 @@ std::regex glob_pattern_to_regex(const std::string& glob_pattern) {
 
     return std::regex(regex_str);
 }
+
+//Returns true if the only special character of glob_pattern (as interpreted by
+//glob_pattern_to_regex()) is the '*' wildcard, so it can be matched by wildcard_glob_match()
+bool is_wildcard_glob_pattern(const std::string& glob_pattern) {
+    return glob_pattern.find_first_of("^$\\+?()[]{}|") == std::string::npos;
+}
+
+//Returns true if str matches glob_pattern in its entirety, where '*' matches
+//any (possibly empty) sequence of characters and all other characters are literal
+bool wildcard_glob_match(const char* glob_pattern, const char* str) {
+    const char* last_star = nullptr; //Most recent '*' in the pattern
+    const char* star_str = nullptr;  //Position in str matched after last_star
+
+    while (*str) {
+        if (*glob_pattern == '*') {
+            last_star = glob_pattern++;
+            star_str = str;
+        } else if (*glob_pattern == *str) {
+            ++glob_pattern;
+            ++str;
+        } else if (last_star) {
+            //Let the last '*' consume one more character, and retry
+            glob_pattern = last_star + 1;
+            str = ++star_str;
+        } else {
+            return false;
+        }
+    }
+
+    while (*glob_pattern == '*') {
+        ++glob_pattern;
+    }
+    return *glob_pattern == '\0';
+}
+
+//Adds the ids of the names in sorted_names (sorted by name) which match glob_pattern to matches.
+//
+//Patterns using only '*' wildcards (the common case) are matched directly against the names
+//sharing the pattern's literal prefix, which are found by binary search. Other patterns are
+//matched against all names with the equivalent std::regex.
+//
+//Returns true if any name matched.
+bool find_sorted_glob_matches(const std::vector<std::pair<std::string, AtomPinId>>& sorted_names,
+                              const std::string& glob_pattern,
+                              std::set<AtomPinId>& matches) {
+    bool found = false;
+
+    if (is_wildcard_glob_pattern(glob_pattern)) {
+        std::string prefix = glob_pattern.substr(0, glob_pattern.find('*'));
+
+        auto iter = std::lower_bound(sorted_names.begin(), sorted_names.end(), prefix,
+                                     [](const std::pair<std::string, AtomPinId>& entry, const std::string& value) {
+                                         return entry.first < value;
+                                     });
+        for (; iter != sorted_names.end() && iter->first.compare(0, prefix.size(), prefix) == 0; ++iter) {
+            if (wildcard_glob_match(glob_pattern.c_str(), iter->first.c_str())) {
+                found = true;
+                matches.insert(iter->second);
+            }
+        }
+    } else {
+        std::regex name_regex = glob_pattern_to_regex(glob_pattern);
+
+        for (const auto& entry : sorted_names) {
+            if (std::regex_match(entry.first, name_regex)) {
+                found = true;
+                matches.insert(entry.second);
+            }
+        }
+    }
+
+    return found;
+}
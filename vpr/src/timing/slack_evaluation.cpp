@@ -53,7 +53,7 @@ SetupSlackCrit::~SetupSlackCrit() {
     VTR_LOG("Full Max Req/Worst Slack updates %zu in %g sec\n", full_max_req_worst_slack_updates_, full_max_req_worst_slack_update_time_sec_);
     VTR_LOG("Incr Max Req/Worst Slack updates %zu in %g sec\n", incr_max_req_worst_slack_updates_, incr_max_req_worst_slack_update_time_sec_);
     VTR_LOG("Incr Criticality updates %zu in %g sec\n", incr_criticality_updates_, incr_criticality_update_time_sec_);
-    VTR_LOG("Full Criticality updates %zu in %g sec\n", full_criticality_updates_, full_criticality_update_time_sec_);
+    VTR_LOG("Full Criticality updates %zu in %g sec (%zu deferred)\n", full_criticality_updates_, full_criticality_update_time_sec_, deferred_criticality_updates_);
 }
 
 //Returns the worst (least) slack of connections through the specified pin
@@ -62,17 +62,28 @@ float SetupSlackCrit::setup_pin_slack(AtomPinId pin) const { return pin_slacks_[
 //Returns the worst (maximum) criticality of connections through the specified pin.
 //  Criticality (in [0., 1.]) represents how timing-critical something is,
 //  0. is non-critical and 1. is most-critical.
-float SetupSlackCrit::setup_pin_criticality(AtomPinId pin) const { return pin_criticalities_[pin]; }
+float SetupSlackCrit::setup_pin_criticality(AtomPinId pin) const {
+    if (criticalities_stale_) {
+        //Calculate on demand (without modifying any state, so this is safe to call concurrently)
+        tatum::NodeId node = netlist_lookup_.atom_pin_tnode(pin, BlockTnode::EXTERNAL);
+        if (node) {
+            return calc_relaxed_criticality(max_req_, worst_slack_, analyzer_->setup_slacks(node));
+        }
+    }
+    return pin_criticalities_[pin];
+}
 
 SetupSlackCrit::modified_pin_range SetupSlackCrit::pins_with_modified_slack() const {
     return vtr::make_range(pins_with_modified_slacks_);
 }
 
 SetupSlackCrit::modified_pin_range SetupSlackCrit::pins_with_modified_criticality() const {
+    update_stale_criticalities();
     return vtr::make_range(pins_with_modified_criticalities_);
 }
 
 void SetupSlackCrit::update_slacks_and_criticalities(const tatum::TimingGraph& timing_graph, const tatum::SetupTimingAnalyzer& analyzer) {
+    analyzer_ = &analyzer;
     record_modified_nodes(timing_graph, analyzer);
 
 #if defined(VPR_USE_TBB)
@@ -155,8 +166,9 @@ void SetupSlackCrit::update_criticalities(const tatum::TimingGraph& timing_graph
         //update the criticalities of each pin. (An incremental update is done lazily,
         //only on the nodes modified by the analyzer.)
         //
-        //Otherwise (if the max required and/or worst slacks changed), we fully
-        //recalculate all criticalities.
+        //Otherwise (if the max required and/or worst slacks changed), all criticalities
+        //must be recalculated. This is deferred until they are needed (see
+        //update_stale_criticalities()), since often only some of them are queried.
         //
         //  TODO: consider if incremental criticality update is feasible based only
         //        on changed domain pairs....
@@ -167,27 +179,40 @@ void SetupSlackCrit::update_criticalities(const tatum::TimingGraph& timing_graph
         //For debugability, only do incremental updates if INCR_UPDATE_ATOM_CRIT is true
         bool do_incremental_update = (INCR_UPDATE_ATOM_CRIT && could_do_incremental_update);
 
-        const auto& nodes = nodes_to_update(do_incremental_update);
+        if (!do_incremental_update) {
+            criticalities_stale_ = true;
+            ++deferred_criticality_updates_;
+        } else if (!criticalities_stale_) {
+            //Stale criticalities are all recalculated when needed, so only fresh ones need updating
+            update_pin_criticalities_from_nodes(nodes_to_update(/*incremental=*/true), analyzer);
 
-        update_pin_criticalities_from_nodes(nodes, analyzer);
+            VTR_ASSERT_DEBUG_MSG(verify_pin_criticalities(timing_graph, analyzer), "Updated pin criticalities should match those computed from scratch");
 
-        VTR_ASSERT_DEBUG_MSG(verify_pin_criticalities(timing_graph, analyzer), "Updated pin criticalities should match those computed from scratch");
+            ++incr_criticality_updates_;
+            incr_criticality_update_time_sec_ += timer.elapsed_sec();
+        }
 
         //Save the max required times and worst slacks so we can determine when next
         //updated whether the update can be done incrementally
         prev_max_req_ = max_req_;
         prev_worst_slack_ = worst_slack_;
-
-        if (do_incremental_update) {
-            ++incr_criticality_updates_;
-            incr_criticality_update_time_sec_ += timer.elapsed_sec();
-        } else {
-            ++full_criticality_updates_;
-            full_criticality_update_time_sec_ += timer.elapsed_sec();
-        }
     }
 }
 
+void SetupSlackCrit::update_stale_criticalities() const {
+    if (!criticalities_stale_) return;
+
+    vtr::Timer timer;
+
+    //Note that the modified pins are relative to the stored criticalities, which are those of
+    //the last update after which the criticalities were brought up to date
+    update_pin_criticalities_from_nodes(nodes_to_update(/*incremental=*/false), *analyzer_);
+    criticalities_stale_ = false;
+
+    ++full_criticality_updates_;
+    full_criticality_update_time_sec_ += timer.elapsed_sec();
+}
+
 void SetupSlackCrit::update_max_req_and_worst_slack(const tatum::TimingGraph& timing_graph,
                                                     const tatum::SetupTimingAnalyzer& analyzer) {
     bool incr_update_successful = false;
@@ -335,7 +360,7 @@ void SetupSlackCrit::recompute_max_req_and_worst_slack(const tatum::TimingGraph&
 }
 
 template<typename NodeRange>
-void SetupSlackCrit::update_pin_criticalities_from_nodes(const NodeRange& nodes, const tatum::SetupTimingAnalyzer& analyzer) {
+void SetupSlackCrit::update_pin_criticalities_from_nodes(const NodeRange& nodes, const tatum::SetupTimingAnalyzer& analyzer) const {
     pins_with_modified_criticalities_.clear();
 
     /** We could do this in parallel, but the overhead of combining the results is not worth it */
@@ -348,7 +373,7 @@ void SetupSlackCrit::update_pin_criticalities_from_nodes(const NodeRange& nodes,
 }
 
 AtomPinId SetupSlackCrit::update_pin_criticality(const tatum::NodeId node,
-                                                 const tatum::SetupTimingAnalyzer& analyzer) {
+                                                 const tatum::SetupTimingAnalyzer& analyzer) const {
     AtomPinId pin = netlist_lookup_.tnode_atom_pin(node);
     VTR_ASSERT_SAFE(pin);
 
@@ -16,6 +16,14 @@
  * For efficiency, when update_slacks_and_criticalities() is called it attempts to incrementally
  * update the shifted slacks and relaxed criticalities based on the set of timing graph nodes
  * which are reported as having been modified by the previous timing analysis.
+ *
+ * If the maximum required times or worst slacks (which normalize the criticalities) change, the
+ * criticality of every pin may change. Rather than recalculating all of them immediately, the
+ * criticalities are then marked stale: setup_pin_criticality() calculates the criticality of a
+ * pin on demand, and the stored criticalities (and the set of pins whose criticality changed) are
+ * only brought up to date when pins_with_modified_criticality() is called. Consumers which only
+ * query the criticalities of the connections they are working on (e.g. the router) therefore only
+ * pay for those pins.
  */
 class SetupSlackCrit {
   public: //Constructors
@@ -33,10 +41,13 @@ class SetupSlackCrit {
     //Returns the worst (maximum) criticality of connections through the specified pin.
     //  Criticality (in [0., 1.]) represents how timing-critical something is,
     //  0. is non-critical and 1. is most-critical.
+    //May be called concurrently.
     float setup_pin_criticality(AtomPinId pin) const;
 
     //Returns the set of pins which have respectively had their slack or criticality modified
     //by the last call to update_slacks_and_criticalities()
+    //  Note that pins_with_modified_criticality() updates any stale criticalities, so must not
+    //  be called concurrently with setup_pin_criticality().
     modified_pin_range pins_with_modified_slack() const;
     modified_pin_range pins_with_modified_criticality() const;
 
@@ -73,12 +84,15 @@ class SetupSlackCrit {
 
     //Updates criticalities of pins associated with the specified set of timing graph nodes
     template<typename NodeRange>
-    void update_pin_criticalities_from_nodes(const NodeRange& nodes, const tatum::SetupTimingAnalyzer& analyzer);
+    void update_pin_criticalities_from_nodes(const NodeRange& nodes, const tatum::SetupTimingAnalyzer& analyzer) const;
 
     //Updates the criticality of the pin associated with 'node' based on the last timing analysis
     //Returns the pin if it's criticality was modified, or AtomPinId::INVALID() if unchanged
     AtomPinId update_pin_criticality(const tatum::NodeId node,
-                                     const tatum::SetupTimingAnalyzer& analyzer);
+                                     const tatum::SetupTimingAnalyzer& analyzer) const;
+
+    //Updates the criticalities of all pins if they are stale
+    void update_stale_criticalities() const;
 
     //Records the timing graph nodes modified during the last timing analysis.
     //Updates modified_nodes_ and modified_sink_nodes
@@ -109,11 +123,17 @@ class SetupSlackCrit {
     const AtomNetlist& netlist_;
     const AtomLookup& netlist_lookup_;
 
-    vtr::vector<AtomPinId, float> pin_slacks_;        //Calculated adjusted slacks of all pins
-    vtr::vector<AtomPinId, float> pin_criticalities_; //Calculated criticality of all pins
+    vtr::vector<AtomPinId, float> pin_slacks_;                //Calculated adjusted slacks of all pins
+    mutable vtr::vector<AtomPinId, float> pin_criticalities_; //Calculated criticality of all pins (unless criticalities_stale_)
+
+    std::vector<AtomPinId> pins_with_modified_slacks_;                //Set of pins with modified slacks
+    mutable std::vector<AtomPinId> pins_with_modified_criticalities_; //Set of pins with modified criticalities (unless criticalities_stale_)
+
+    //Whether pin_criticalities_ need to be recalculated for the current max required times and worst slacks
+    mutable bool criticalities_stale_ = false;
 
-    std::vector<AtomPinId> pins_with_modified_slacks_;        //Set of pins with modified slacks
-    std::vector<AtomPinId> pins_with_modified_criticalities_; //Set of pins with modified criticalities
+    //The analyzer used by the last update, from which stale criticalities are calculated
+    const tatum::SetupTimingAnalyzer* analyzer_ = nullptr;
 
     std::map<DomainPair, float> max_req_;                  //Maximum required times for all clock domains
     std::map<DomainPair, float> worst_slack_;              //Worst slacks for all clock domains
@@ -137,8 +157,9 @@ class SetupSlackCrit {
     float incr_max_req_worst_slack_update_time_sec_ = 0.;
     size_t incr_criticality_updates_ = 0;
     float incr_criticality_update_time_sec_ = 0.;
-    size_t full_criticality_updates_ = 0;
-    float full_criticality_update_time_sec_ = 0.;
+    mutable size_t full_criticality_updates_ = 0;
+    mutable float full_criticality_update_time_sec_ = 0.;
+    size_t deferred_criticality_updates_ = 0;
 };
 
 //TODO: fully implement a HoldSlackCrit class for hold analysis
@@ -27,6 +27,11 @@
  * netlist primitives) are created to "stitch" the sub-graph together. This results in a
  * timing graph corresponding to the netlist.
  *
+ * The sub-graphs of the blocks are independent, so they are built in parallel and then
+ * added to the timing graph at consecutive ids (a prefix sum of their sizes), after which
+ * the net edges (which are also independent of each other) are filled in in parallel.
+ * The resulting timing graph is the same as building it one block and net at a time.
+ *
  *
  * Modelling Primitive Combinational and Sequential Logic as a Timing Graph
  * -----------------------------------------------------------------------
@@ -216,6 +221,7 @@
  * for convenience (i.e. both map to the same tnode).
  *
  */
+#include <algorithm>
 #include <set>
 
 #include "vtr_log.h"
@@ -229,6 +235,10 @@
 
 #include "tatum/TimingGraph.hpp"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 using tatum::EdgeId;
 using tatum::NodeId;
 using tatum::NodeType;
@@ -278,28 +288,15 @@ void TimingGraphBuilder::build(bool allow_dangling_combinational_nodes) {
     // Set by `--allow_dangling_combinational_nodes on`. Default value is false
     tg_->set_allow_dangling_combinational_nodes(allow_dangling_combinational_nodes);
 
-    //Walk through the netlist blocks creating the timing sub-graphs corresponding to
-    //each block (i.e. the timing nodes and internal edges of the block)
+    //Create the timing sub-graphs corresponding to each netlist block (i.e. the timing
+    //nodes and internal edges of the block)
     //
     //Note that this does not add timing graph edges which are external to each block.
-    for (AtomBlockId blk : netlist_.blocks()) {
-        AtomBlockType blk_type = netlist_.block_type(blk);
+    add_blocks_to_timing_graph();
 
-        if (blk_type == AtomBlockType::INPAD || blk_type == AtomBlockType::OUTPAD) {
-            add_io_to_timing_graph(blk);
-        } else if (blk_type == AtomBlockType::BLOCK) {
-            add_block_to_timing_graph(blk);
-        } else {
-            VPR_FATAL_ERROR(VPR_ERROR_TIMING, "Unrecognized atom block type while constructing timing graph");
-        }
-    }
-
-    //Walk through the netlist nets adding the edges representing each net to
-    //the timiing graph. This connects the timing graph nodes of each netlist
-    //block together.
-    for (AtomNetId net : netlist_.nets()) {
-        add_net_to_timing_graph(net);
-    }
+    //Add the edges representing each net to the timiing graph. This connects the
+    //timing graph nodes of each netlist block together.
+    add_nets_to_timing_graph();
 
     //Break any combinational loops (i.e. if the graph is not a DAG)
     fix_comb_loops();
@@ -323,8 +320,148 @@ void TimingGraphBuilder::opt_memory_layout() {
     remap_ids(id_map);
 }
 
+//Calls fn(i) for i in [0..num-1], in parallel if possible. The calls must be independent
+template<typename Fn>
+static void for_each_index(size_t num, const Fn& fn) {
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), num, fn);
+#else
+    for (size_t i = 0; i < num; ++i) {
+        fn(i);
+    }
+#endif
+}
+
+//Adds the timing sub-graphs of all the netlist blocks to the timing graph
+//
+//This is done in three phases:
+//  1) The sub-graph of each block is built (in parallel), with block-local node ids.
+//     This is where the netlist and architecture models are inspected.
+//  2) The blocks' sub-graphs are given consecutive node and edge ids, in block order
+//     (a prefix sum of their sizes). At the same time the pin to tnode lookup is
+//     filled in, and the messages of each block are logged (so they appear in the
+//     same order whatever the number of threads).
+//  3) The timing graph is extended by all the nodes and edges at once, and each
+//     block fills in its own (in parallel).
+//
+//The node and edge ids are the same as if the blocks were added one at a time.
+void TimingGraphBuilder::add_blocks_to_timing_graph() {
+    std::vector<AtomBlockId> blocks(netlist_.blocks().begin(), netlist_.blocks().end());
+
+    local_pin_tnodes_external_.assign(netlist_.pins().size(), OPEN);
+    local_pin_tnodes_internal_.assign(netlist_.pins().size(), OPEN);
+
+    //Phase 1: build the sub-graphs
+    std::vector<BlockTimingSubgraph> subgraphs(blocks.size());
+    for_each_index(blocks.size(), [&](size_t iblk) {
+        AtomBlockId blk = blocks[iblk];
+        AtomBlockType blk_type = netlist_.block_type(blk);
+
+        if (blk_type == AtomBlockType::INPAD || blk_type == AtomBlockType::OUTPAD) {
+            subgraphs[iblk] = build_io_timing_subgraph(blk);
+        } else if (blk_type == AtomBlockType::BLOCK) {
+            subgraphs[iblk] = build_block_timing_subgraph(blk);
+        } else {
+            subgraphs[iblk].error = "Unrecognized atom block type while constructing timing graph";
+        }
+    });
+
+    //Phase 2: assign the ids
+    size_t first_node = tg_->nodes().size();
+    size_t first_edge = tg_->edges().size();
+    std::vector<size_t> node_offsets(blocks.size());
+    std::vector<size_t> edge_offsets(blocks.size());
+    size_t num_nodes = first_node;
+    size_t num_edges = first_edge;
+    for (size_t iblk = 0; iblk < blocks.size(); ++iblk) {
+        const BlockTimingSubgraph& subgraph = subgraphs[iblk];
+
+        for (const auto& message : subgraph.log_messages) {
+            if (message.first) {
+                VTR_LOG_WARN("%s", message.second.c_str());
+            } else {
+                VTR_LOG("%s", message.second.c_str());
+            }
+        }
+        if (!subgraph.error.empty()) {
+            VPR_FATAL_ERROR(VPR_ERROR_TIMING, "%s", subgraph.error.c_str());
+        }
+
+        if (subgraph.allow_dangling_combinational_nodes) {
+            //This type of situation often requires cutting paths between the implicit clock source and
+            //it's inputs which can cause dangling combinational nodes. Do not error if this occurs.
+            tg_->set_allow_dangling_combinational_nodes(true);
+        }
+
+        node_offsets[iblk] = num_nodes;
+        edge_offsets[iblk] = num_edges;
+        num_nodes += subgraph.node_types.size();
+        num_edges += subgraph.edges.size();
+
+        //Save the pin to tnode mappings. The external tnodes are saved last, so that a
+        //combinational pin's tnode (both internal and external) maps back to the pin
+        for (AtomPinId pin : netlist_.block_pins(blocks[iblk])) {
+            for (auto blk_tnode_type : {BlockTnode::INTERNAL, BlockTnode::EXTERNAL}) {
+                int tnode = local_pin_tnode(pin, blk_tnode_type);
+                if (tnode == OPEN) continue;
+                netlist_lookup_.set_atom_pin_tnode(pin, NodeId(node_offsets[iblk] + tnode), blk_tnode_type);
+            }
+        }
+
+        for (const auto& edge : subgraph.clock_buffer_edges) {
+            VTR_LOG("Adding edge from '%s' (tnode: %zu) -> '%s' (tnode: %zu) to allow clocks to propagate\n",
+                    netlist_.pin_name(edge.src_pin).c_str(), node_offsets[iblk] + edge.src,
+                    netlist_.pin_name(edge.sink_pin).c_str(), node_offsets[iblk] + edge.sink);
+        }
+    }
+
+    //Phase 3: fill in the nodes and edges
+    tg_->add_nodes_and_edges(num_nodes - first_node, num_edges - first_edge);
+    for_each_index(blocks.size(), [&](size_t iblk) {
+        const BlockTimingSubgraph& subgraph = subgraphs[iblk];
+        size_t node_offset = node_offsets[iblk];
+
+        for (size_t inode = 0; inode < subgraph.node_types.size(); ++inode) {
+            tg_->set_node_type(NodeId(node_offset + inode), subgraph.node_types[inode]);
+        }
+        for (size_t iedge = 0; iedge < subgraph.edges.size(); ++iedge) {
+            const auto& edge = subgraph.edges[iedge];
+            tg_->set_edge(EdgeId(edge_offsets[iblk] + iedge), edge.type, NodeId(node_offset + edge.src), NodeId(node_offset + edge.sink));
+        }
+    });
+
+    local_pin_tnodes_external_.clear();
+    local_pin_tnodes_internal_.clear();
+}
+
+int TimingGraphBuilder::BlockTimingSubgraph::add_node(tatum::NodeType type, bool clock_generator) {
+    node_types.push_back(type);
+    is_clock_generator.push_back(clock_generator);
+    return node_types.size() - 1;
+}
+
+int TimingGraphBuilder::local_pin_tnode(const AtomPinId pin, BlockTnode block_tnode_type) const {
+    if (block_tnode_type == BlockTnode::EXTERNAL) {
+        return local_pin_tnodes_external_[pin];
+    } else {
+        VTR_ASSERT(block_tnode_type == BlockTnode::INTERNAL);
+        return local_pin_tnodes_internal_[pin];
+    }
+}
+
+void TimingGraphBuilder::set_local_pin_tnode(const AtomPinId pin, int tnode, BlockTnode block_tnode_type) {
+    if (block_tnode_type == BlockTnode::EXTERNAL) {
+        local_pin_tnodes_external_[pin] = tnode;
+    } else {
+        VTR_ASSERT(block_tnode_type == BlockTnode::INTERNAL);
+        local_pin_tnodes_internal_[pin] = tnode;
+    }
+}
+
 //Creates the timing graph nodes for the associated primary I/O
-void TimingGraphBuilder::add_io_to_timing_graph(const AtomBlockId blk) {
+TimingGraphBuilder::BlockTimingSubgraph TimingGraphBuilder::build_io_timing_subgraph(const AtomBlockId blk) {
+    BlockTimingSubgraph subgraph;
+
     NodeType node_type;
     AtomPinId pin;
     if (netlist_.block_type(blk) == AtomBlockType::INPAD) {
@@ -335,7 +472,7 @@ void TimingGraphBuilder::add_io_to_timing_graph(const AtomBlockId blk) {
         } else {
             //Un-swept disconnected input
             VTR_ASSERT(netlist_.block_pins(blk).size() == 0);
-            return;
+            return subgraph;
         }
 
     } else {
@@ -347,17 +484,19 @@ void TimingGraphBuilder::add_io_to_timing_graph(const AtomBlockId blk) {
         } else {
             //Un-swept disconnected output
             VTR_ASSERT(netlist_.block_pins(blk).size() == 0);
-            return;
+            return subgraph;
         }
     }
 
-    NodeId tnode = tg_->add_node(node_type);
+    int tnode = subgraph.add_node(node_type);
 
-    netlist_lookup_.set_atom_pin_tnode(pin, tnode, BlockTnode::EXTERNAL);
+    set_local_pin_tnode(pin, tnode, BlockTnode::EXTERNAL);
+
+    return subgraph;
 }
 
 //Creates the timing graph nodes and internal edges for a netlist block
-void TimingGraphBuilder::add_block_to_timing_graph(const AtomBlockId blk) {
+TimingGraphBuilder::BlockTimingSubgraph TimingGraphBuilder::build_block_timing_subgraph(const AtomBlockId blk) {
     /*
      * How the code builds the primtive timing sub-graph
      * -------------------------------------------------
@@ -391,16 +530,21 @@ void TimingGraphBuilder::add_block_to_timing_graph(const AtomBlockId blk) {
      * SOURCE (and leave any combinational inputs to that node disconnected).
      */
 
-    auto clock_generator_tnodes = create_block_timing_nodes(blk);
-    create_block_internal_data_timing_edges(blk, clock_generator_tnodes);
-    create_block_internal_clock_timing_edges(blk, clock_generator_tnodes);
+    BlockTimingSubgraph subgraph;
+    create_block_timing_nodes(blk, subgraph);
+    create_block_internal_data_timing_edges(blk, subgraph);
+    if (subgraph.error.empty()) {
+        create_block_internal_clock_timing_edges(blk, subgraph);
+    }
+    return subgraph;
 }
 
 //Constructs the timing graph nodes for the specified block
 //
-//Returns the set of created tnodese which are clock generators
-std::set<tatum::NodeId> TimingGraphBuilder::create_block_timing_nodes(const AtomBlockId blk) {
-    std::set<std::string> output_ports_used_as_combinational_sinks;
+//The created tnodes which are clock generators are marked in the sub-graph
+void TimingGraphBuilder::create_block_timing_nodes(const AtomBlockId blk, BlockTimingSubgraph& subgraph) {
+    //The output ports which will be used as combinational sinks (names owned by the port models)
+    std::vector<const std::string*> output_ports_used_as_combinational_sinks;
 
     //Create the tnodes corresponding to input pins
     for (AtomPinId input_pin : netlist_.block_input_pins(blk)) {
@@ -409,37 +553,38 @@ std::set<tatum::NodeId> TimingGraphBuilder::create_block_timing_nodes(const Atom
         //Inspect the port model to determine pin type
         const t_model_ports* model_port = netlist_.port_model(input_port);
 
-        NodeId tnode;
+        int tnode;
         VTR_ASSERT(!model_port->is_clock);
         if (model_port->clock.empty()) {
             //No clock => combinational input
-            tnode = tg_->add_node(NodeType::IPIN);
+            tnode = subgraph.add_node(NodeType::IPIN);
 
             //A combinational pin is really both internal and external, mark it internal here
             //and external in the default case below
-            netlist_lookup_.set_atom_pin_tnode(input_pin, tnode, BlockTnode::INTERNAL);
+            set_local_pin_tnode(input_pin, tnode, BlockTnode::INTERNAL);
         } else {
             //This is a sequential data input (i.e. a sequential data capture point/timing path end-point)
-            tnode = tg_->add_node(NodeType::SINK);
+            tnode = subgraph.add_node(NodeType::SINK);
 
             if (!model_port->combinational_sink_ports.empty()) {
                 //There is an internal combinational connection starting at this sequential input
                 //pin. This is a new timing path and hence we must create a new SOURCE node.
 
                 //Create the internal source
-                NodeId internal_tnode = tg_->add_node(NodeType::SOURCE);
-                netlist_lookup_.set_atom_pin_tnode(input_pin, internal_tnode, BlockTnode::INTERNAL);
+                int internal_tnode = subgraph.add_node(NodeType::SOURCE);
+                set_local_pin_tnode(input_pin, internal_tnode, BlockTnode::INTERNAL);
             }
         }
 
         //Record any output port which will be used as a combinational sink
         // This is used to determine (when creating output pin tnodes) whether we also need to
         // create an internal SINK tnode.
-        output_ports_used_as_combinational_sinks.insert(model_port->combinational_sink_ports.begin(),
-                                                        model_port->combinational_sink_ports.end());
+        for (const std::string& sink_port_name : model_port->combinational_sink_ports) {
+            output_ports_used_as_combinational_sinks.push_back(&sink_port_name);
+        }
 
         //Save the pin to external tnode mapping
-        netlist_lookup_.set_atom_pin_tnode(input_pin, tnode, BlockTnode::EXTERNAL);
+        set_local_pin_tnode(input_pin, tnode, BlockTnode::EXTERNAL);
     }
 
     //Create the clock pins
@@ -452,80 +597,78 @@ std::set<tatum::NodeId> TimingGraphBuilder::create_block_timing_nodes(const Atom
         VTR_ASSERT(model_port->is_clock);
         VTR_ASSERT(model_port->clock.empty());
 
-        NodeId tnode = tg_->add_node(NodeType::CPIN);
+        int tnode = subgraph.add_node(NodeType::CPIN);
 
-        netlist_lookup_.set_atom_pin_tnode(clock_pin, tnode, BlockTnode::EXTERNAL);
+        set_local_pin_tnode(clock_pin, tnode, BlockTnode::EXTERNAL);
     }
 
     //Create the output pins
-    std::set<tatum::NodeId> clock_generator_tnodes;
     for (AtomPinId output_pin : netlist_.block_output_pins(blk)) {
         AtomPortId output_port = netlist_.pin_port(output_pin);
 
         //Inspect the port model to determine pin type
         const t_model_ports* model_port = netlist_.port_model(output_port);
 
-        NodeId tnode;
+        int tnode;
         if (is_netlist_clock_source(output_pin)) {
             //A generated clock source
-            tnode = tg_->add_node(NodeType::SOURCE);
-
-            clock_generator_tnodes.insert(tnode);
+            tnode = subgraph.add_node(NodeType::SOURCE, true);
 
             if (!model_port->is_clock) {
                 //An implicit clock source, possibly clock derived from data
 
                 AtomNetId clock_net = netlist_.pin_net(output_pin);
-                VTR_LOG_WARN("Inferred implicit clock source %s for netlist clock %s (possibly data used as clock)\n",
-                             netlist_.pin_name(output_pin).c_str(), netlist_.net_name(clock_net).c_str());
+                subgraph.log_messages.emplace_back(true, vtr::string_fmt("Inferred implicit clock source %s for netlist clock %s (possibly data used as clock)\n",
+                                                                         netlist_.pin_name(output_pin).c_str(), netlist_.net_name(clock_net).c_str()));
 
                 //This type of situation often requires cutting paths between the implicit clock source and
                 //it's inputs which can cause dangling combinational nodes. Do not error if this occurs.
-                tg_->set_allow_dangling_combinational_nodes(true);
+                subgraph.allow_dangling_combinational_nodes = true;
             }
         } else {
             VTR_ASSERT_MSG(!model_port->is_clock, "Primitive data output (i.e. non-clock source output pin) should not be marked as a clock generator");
 
             if (model_port->clock.empty()) {
                 //No clock => combinational output
-                tnode = tg_->add_node(NodeType::OPIN);
+                tnode = subgraph.add_node(NodeType::OPIN);
 
                 //A combinational pin is really both internal and external, mark it internal here
                 //and external in the default case below
-                netlist_lookup_.set_atom_pin_tnode(output_pin, tnode, BlockTnode::INTERNAL);
+                set_local_pin_tnode(output_pin, tnode, BlockTnode::INTERNAL);
 
             } else {
                 VTR_ASSERT(!model_port->clock.empty());
                 //Has an associated clock => sequential output
-                tnode = tg_->add_node(NodeType::SOURCE);
+                tnode = subgraph.add_node(NodeType::SOURCE);
 
-                if (output_ports_used_as_combinational_sinks.count(model_port->name)) {
+                bool used_as_combinational_sink = std::any_of(output_ports_used_as_combinational_sinks.begin(),
+                                                              output_ports_used_as_combinational_sinks.end(),
+                                                              [&](const std::string* name) { return *name == model_port->name; });
+                if (used_as_combinational_sink) {
                     //There is a combinational path within the primitive terminating at this sequential output
 
                     //Create the internal sink node
-                    NodeId internal_tnode = tg_->add_node(NodeType::SINK);
-                    netlist_lookup_.set_atom_pin_tnode(output_pin, internal_tnode, BlockTnode::INTERNAL);
+                    int internal_tnode = subgraph.add_node(NodeType::SINK);
+                    set_local_pin_tnode(output_pin, internal_tnode, BlockTnode::INTERNAL);
                 }
             }
         }
 
         //Record as external tnode
-        netlist_lookup_.set_atom_pin_tnode(output_pin, tnode, BlockTnode::EXTERNAL);
+        set_local_pin_tnode(output_pin, tnode, BlockTnode::EXTERNAL);
     }
-
-    return clock_generator_tnodes;
 }
 
-void TimingGraphBuilder::create_block_internal_clock_timing_edges(const AtomBlockId blk, const std::set<tatum::NodeId>& clock_generator_tnodes) {
+void TimingGraphBuilder::create_block_internal_clock_timing_edges(const AtomBlockId blk, BlockTimingSubgraph& subgraph) {
     //Connect the clock pins to the sources and sinks
     for (AtomPinId pin : netlist_.block_pins(blk)) {
         for (auto blk_tnode_type : {BlockTnode::EXTERNAL, BlockTnode::INTERNAL}) {
-            NodeId tnode = netlist_lookup_.atom_pin_tnode(pin, blk_tnode_type);
-            if (!tnode) continue;
+            int tnode = local_pin_tnode(pin, blk_tnode_type);
+            if (tnode == OPEN) continue;
 
-            if (clock_generator_tnodes.count(tnode)) continue; //Clock sources don't have incoming clock pin connections
+            if (subgraph.is_clock_generator[tnode]) continue; //Clock sources don't have incoming clock pin connections
 
-            auto node_type = tg_->node_type(tnode);
+            auto node_type = subgraph.node_types[tnode];
 
             if (node_type != NodeType::SOURCE && node_type != NodeType::SINK) continue;
 
@@ -546,8 +689,8 @@ void TimingGraphBuilder::create_block_internal_clock_timing_edges(const AtomBloc
             VTR_ASSERT(clk_pin);
 
             //Convert the pin to it's tnode
-            NodeId clk_tnode = netlist_lookup_.atom_pin_tnode(clk_pin);
-            VTR_ASSERT(clk_tnode);
+            int clk_tnode = local_pin_tnode(clk_pin, BlockTnode::EXTERNAL);
+            VTR_ASSERT(clk_tnode != OPEN);
 
             //Determine the type of edge to create
             //This corresponds to how the clock (clk_tnode) relates
@@ -564,7 +707,7 @@ void TimingGraphBuilder::create_block_internal_clock_timing_edges(const AtomBloc
             }
 
             //Add the edge from the clock to the source/sink
-            tg_->add_edge(type, clk_tnode, tnode);
+            subgraph.edges.push_back({type, clk_tnode, tnode});
         }
     }
 
@@ -572,9 +715,9 @@ void TimingGraphBuilder::create_block_internal_clock_timing_edges(const AtomBloc
     //
     //These are typically used to represent clock buffers
     for (AtomPinId src_clock_pin : netlist_.block_clock_pins(blk)) {
-        NodeId src_tnode = netlist_lookup_.atom_pin_tnode(src_clock_pin, BlockTnode::EXTERNAL);
+        int src_tnode = local_pin_tnode(src_clock_pin, BlockTnode::EXTERNAL);
 
-        if (!src_tnode) continue;
+        if (src_tnode == OPEN) continue;
 
         //Look-up the combinationally connected sink ports name on the port model
         AtomPortId src_port = netlist_.pin_port(src_clock_pin);
@@ -588,16 +731,17 @@ void TimingGraphBuilder::create_block_internal_clock_timing_edges(const AtomBloc
             //output port
             for (AtomPinId sink_pin : netlist_.port_pins(sink_port)) {
                 //Get the tnode of the sink
-                NodeId sink_tnode = netlist_lookup_.atom_pin_tnode(sink_pin, BlockTnode::EXTERNAL);
+                int sink_tnode = local_pin_tnode(sink_pin, BlockTnode::EXTERNAL);
+                VTR_ASSERT(sink_tnode != OPEN);
 
-                tg_->add_edge(tatum::EdgeType::PRIMITIVE_COMBINATIONAL, src_tnode, sink_tnode);
-                VTR_LOG("Adding edge from '%s' (tnode: %zu) -> '%s' (tnode: %zu) to allow clocks to propagate\n", netlist_.pin_name(src_clock_pin).c_str(), size_t(src_tnode), netlist_.pin_name(sink_pin).c_str(), size_t(sink_tnode));
+                subgraph.edges.push_back({tatum::EdgeType::PRIMITIVE_COMBINATIONAL, src_tnode, sink_tnode});
+                subgraph.clock_buffer_edges.push_back({src_clock_pin, sink_pin, src_tnode, sink_tnode});
             }
         }
     }
 }
 
-void TimingGraphBuilder::create_block_internal_data_timing_edges(const AtomBlockId blk, const std::set<tatum::NodeId>& clock_generator_tnodes) {
+void TimingGraphBuilder::create_block_internal_data_timing_edges(const AtomBlockId blk, BlockTimingSubgraph& subgraph) {
     //Connect the combinational edges from data input pins
     //
     //These edges may represent an intermediate (combinational) sub-path of a
@@ -611,11 +755,11 @@ void TimingGraphBuilder::create_block_internal_data_timing_edges(const AtomBlock
         //Note that we have already created all the relevant nodes, and appropriately labelled them as
         //internal/external. As a result, we only need to consider the 'internal' tnodes when creating
         //the edges within the current block.
-        NodeId src_tnode = netlist_lookup_.atom_pin_tnode(src_pin, BlockTnode::INTERNAL);
+        int src_tnode = local_pin_tnode(src_pin, BlockTnode::INTERNAL);
 
-        if (!src_tnode) continue;
+        if (src_tnode == OPEN) continue;
 
-        auto src_type = tg_->node_type(src_tnode);
+        auto src_type = subgraph.node_types[src_tnode];
 
         //Look-up the combinationally connected sink ports name on the port model
         AtomPortId src_port = netlist_.pin_port(src_pin);
@@ -630,28 +774,29 @@ void TimingGraphBuilder::create_block_internal_data_timing_edges(const AtomBlock
             //output port
             for (AtomPinId sink_pin : netlist_.port_pins(sink_port)) {
                 //Get the tnode of the sink
-                NodeId sink_tnode = netlist_lookup_.atom_pin_tnode(sink_pin, BlockTnode::INTERNAL);
+                int sink_tnode = local_pin_tnode(sink_pin, BlockTnode::INTERNAL);
 
-                if (!sink_tnode) {
+                if (sink_tnode == OPEN) {
                     //No tnode found, either a combinational clock generator or an error
 
                     //Try again looking for an external tnode
-                    sink_tnode = netlist_lookup_.atom_pin_tnode(sink_pin, BlockTnode::EXTERNAL);
+                    sink_tnode = local_pin_tnode(sink_pin, BlockTnode::EXTERNAL);
 
                     //Is the sink a clock generator?
-                    if (sink_tnode && clock_generator_tnodes.count(sink_tnode)) {
+                    if (sink_tnode != OPEN && subgraph.is_clock_generator[sink_tnode]) {
                         //Do not create the edge
-                        VTR_LOG_WARN("Timing edge from %s to %s will not be created since %s has been identified as a clock generator\n",
-                                     netlist_.pin_name(src_pin).c_str(), netlist_.pin_name(sink_pin).c_str(), netlist_.pin_name(sink_pin).c_str());
+                        subgraph.log_messages.emplace_back(true, vtr::string_fmt("Timing edge from %s to %s will not be created since %s has been identified as a clock generator\n",
+                                                                                 netlist_.pin_name(src_pin).c_str(), netlist_.pin_name(sink_pin).c_str(), netlist_.pin_name(sink_pin).c_str()));
                     } else {
                         //Unknown
-                        VPR_FATAL_ERROR(VPR_ERROR_TIMING, "Unable to find matching sink tnode for timing edge from %s to %s",
-                                        netlist_.pin_name(src_pin).c_str(), netlist_.pin_name(src_pin).c_str());
+                        subgraph.error = vtr::string_fmt("Unable to find matching sink tnode for timing edge from %s to %s",
+                                                         netlist_.pin_name(src_pin).c_str(), netlist_.pin_name(src_pin).c_str());
+                        return;
                     }
 
                 } else {
                     //Valid tnode create the edge
-                    auto sink_type = tg_->node_type(sink_tnode);
+                    auto sink_type = subgraph.node_types[sink_tnode];
 
                     VTR_ASSERT_MSG((src_type == NodeType::IPIN && sink_type == NodeType::OPIN)
                                        || (src_type == NodeType::SOURCE && sink_type == NodeType::SINK)
@@ -660,33 +805,53 @@ void TimingGraphBuilder::create_block_internal_data_timing_edges(const AtomBlock
                                    "Internal primitive combinational edges must be between {IPIN, SOURCE} and {OPIN, SINK}");
 
                     //Add the edge between the pins
-                    tg_->add_edge(tatum::EdgeType::PRIMITIVE_COMBINATIONAL, src_tnode, sink_tnode);
+                    subgraph.edges.push_back({tatum::EdgeType::PRIMITIVE_COMBINATIONAL, src_tnode, sink_tnode});
                 }
             }
         }
     }
 }
 
-void TimingGraphBuilder::add_net_to_timing_graph(const AtomNetId net) {
-    //Create edges from the driver to sink tnodes
-
-    AtomPinId driver_pin = netlist_.net_driver(net);
+//Adds the edges of all the nets to the timing graph
+//
+//Like the blocks (see add_blocks_to_timing_graph()), the nets' edges are given consecutive
+//ids in net order and then filled in in parallel. Each net only touches the out edges of its
+//driver's tnode and the in edges of its sinks' tnodes, which no other net touches.
+void TimingGraphBuilder::add_nets_to_timing_graph() {
+    std::vector<AtomNetId> nets(netlist_.nets().begin(), netlist_.nets().end());
+
+    size_t first_edge = tg_->edges().size();
+    std::vector<size_t> edge_offsets(nets.size());
+    size_t num_edges = first_edge;
+    for (size_t inet = 0; inet < nets.size(); ++inet) {
+        edge_offsets[inet] = num_edges;
+
+        if (!netlist_.net_driver(nets[inet])) {
+            //Undriven nets have no timing dependencies, and hence no edges
+            VTR_LOG_WARN("Net %s has no driver and will be ignored for timing purposes\n", netlist_.net_name(nets[inet]).c_str());
+            continue;
+        }
 
-    if (!driver_pin) {
-        //Undriven nets have no timing dependencies, and hence no edges
-        VTR_LOG_WARN("Net %s has no driver and will be ignored for timing purposes\n", netlist_.net_name(net).c_str());
-        return;
+        //Edges from the driver to sink tnodes
+        num_edges += netlist_.net_sinks(nets[inet]).size();
     }
 
-    NodeId driver_tnode = netlist_lookup_.atom_pin_tnode(driver_pin);
-    VTR_ASSERT(driver_tnode);
+    tg_->add_nodes_and_edges(0, num_edges - first_edge);
+    for_each_index(nets.size(), [&](size_t inet) {
+        AtomPinId driver_pin = netlist_.net_driver(nets[inet]);
+        if (!driver_pin) return;
 
-    for (AtomPinId sink_pin : netlist_.net_sinks(net)) {
-        NodeId sink_tnode = netlist_lookup_.atom_pin_tnode(sink_pin);
-        VTR_ASSERT(sink_tnode);
+        NodeId driver_tnode = netlist_lookup_.atom_pin_tnode(driver_pin);
+        VTR_ASSERT(driver_tnode);
 
-        tg_->add_edge(tatum::EdgeType::INTERCONNECT, driver_tnode, sink_tnode);
-    }
+        size_t edge = edge_offsets[inet];
+        for (AtomPinId sink_pin : netlist_.net_sinks(nets[inet])) {
+            NodeId sink_tnode = netlist_lookup_.atom_pin_tnode(sink_pin);
+            VTR_ASSERT(sink_tnode);
+
+            tg_->set_edge(EdgeId(edge++), tatum::EdgeType::INTERCONNECT, driver_tnode, sink_tnode);
+        }
+    });
 }
 
 void TimingGraphBuilder::fix_comb_loops() {
@@ -1,9 +1,12 @@
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "tatum/TimingGraphFwd.hpp"
 
 #include "atom_netlist_fwd.h"
 #include "atom_lookup.h"
+#include "vtr_vector.h"
 
 /*
  * Class for constructing a Timing Graph (a tatum::TimingGraph, for use with the Tatum 
@@ -24,17 +27,56 @@ class TimingGraphBuilder {
     std::unique_ptr<tatum::TimingGraph> timing_graph(bool allow_dangling_combinational_nodes);
 
   private:
+    /*
+     * The timing nodes and internal edges of a netlist block, numbered from 0 within the block.
+     * The timing sub-graphs of all the blocks are built independently (in parallel), and then
+     * added to the timing graph at consecutive ids (see add_blocks_to_timing_graph()).
+     */
+    struct BlockTimingSubgraph {
+        struct Edge {
+            tatum::EdgeType type;
+            int src;
+            int sink;
+        };
+
+        //A clock buffer edge, which is logged (with its timing graph ids) once added
+        struct ClockBufferEdge {
+            AtomPinId src_pin;
+            AtomPinId sink_pin;
+            int src;
+            int sink;
+        };
+
+        std::vector<tatum::NodeType> node_types;
+        std::vector<bool> is_clock_generator; //[0..node_types.size()-1]
+        std::vector<Edge> edges;
+        std::vector<ClockBufferEdge> clock_buffer_edges;
+
+        //The messages to log when the sub-graph is added, in order: (is a warning, message)
+        std::vector<std::pair<bool, std::string>> log_messages;
+        //Set if the sub-graph couldn't be built
+        std::string error;
+        bool allow_dangling_combinational_nodes = false;
+
+        int add_node(tatum::NodeType type, bool clock_generator = false);
+    };
+
     void build(bool allow_dangling_combinational_nodes);
     void opt_memory_layout();
 
-    void add_io_to_timing_graph(const AtomBlockId blk);
-    void add_block_to_timing_graph(const AtomBlockId blk);
-    void add_net_to_timing_graph(const AtomNetId net);
+    void add_blocks_to_timing_graph();
+    void add_nets_to_timing_graph();
+
+    //Helper functions for add_blocks_to_timing_graph(): build the timing sub-graph of a block
+    BlockTimingSubgraph build_io_timing_subgraph(const AtomBlockId blk);
+    BlockTimingSubgraph build_block_timing_subgraph(const AtomBlockId blk);
+    void create_block_timing_nodes(const AtomBlockId blk, BlockTimingSubgraph& subgraph);
+    void create_block_internal_data_timing_edges(const AtomBlockId blk, BlockTimingSubgraph& subgraph);
+    void create_block_internal_clock_timing_edges(const AtomBlockId blk, BlockTimingSubgraph& subgraph);
 
-    //Helper functions for add_block_to_timing_graph()
-    std::set<tatum::NodeId> create_block_timing_nodes(const AtomBlockId blk);
-    void create_block_internal_data_timing_edges(const AtomBlockId blk, const std::set<tatum::NodeId>& clock_generator_tnodes);
-    void create_block_internal_clock_timing_edges(const AtomBlockId blk, const std::set<tatum::NodeId>& clock_generator_tnodes);
+    //Block-local tnode of a pin in its block's sub-graph (OPEN if none)
+    int local_pin_tnode(const AtomPinId pin, BlockTnode block_tnode_type) const;
+    void set_local_pin_tnode(const AtomPinId pin, int tnode, BlockTnode block_tnode_type);
 
     void fix_comb_loops();
     tatum::EdgeId find_scc_edge_to_break(std::vector<tatum::NodeId> scc);
@@ -57,4 +99,9 @@ class TimingGraphBuilder {
     AtomLookup& netlist_lookup_;
 
     std::set<AtomPinId> netlist_clock_drivers_;
+
+    //Block-local tnodes of each pin while the block sub-graphs are built. Each pin is only
+    //written by the build of its block's sub-graph, so they are built concurrently
+    vtr::vector<AtomPinId, int> local_pin_tnodes_external_;
+    vtr::vector<AtomPinId, int> local_pin_tnodes_internal_;
 };
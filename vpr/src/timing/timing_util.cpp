@@ -277,6 +277,45 @@ void write_setup_timing_summary(std::string timing_summary_filename, const Timin
     }
 }
 
+/*
+ * Prints how many clock domain pairs are analyzed, and how many setup tags the timing graph
+ * nodes hold: with many clocks the tags of each domain pair dominate the analysis time.
+ */
+static void print_setup_tag_counts(const tatum::TimingConstraints& constraints,
+                                   const tatum::SetupTimingAnalyzer& setup_analyzer,
+                                   const std::string& prefix) {
+    auto& timing_ctx = g_vpr_ctx.timing();
+
+    size_t num_domain_pairs = 0;
+    size_t num_analyzed_domain_pairs = 0;
+    for (tatum::DomainId launch_domain : constraints.clock_domains()) {
+        for (tatum::DomainId capture_domain : constraints.clock_domains()) {
+            ++num_domain_pairs;
+            num_analyzed_domain_pairs += constraints.should_analyze(launch_domain, capture_domain);
+        }
+    }
+
+    size_t num_tags = 0;
+    size_t max_node_tags = 0;
+    size_t num_data_arrival_tags = 0;
+    size_t max_node_data_arrival_tags = 0;
+    for (tatum::NodeId node : timing_ctx.graph->nodes()) {
+        size_t node_tags = setup_analyzer.setup_tags(node).size();
+        size_t node_data_arrival_tags = setup_analyzer.setup_tags(node, tatum::TagType::DATA_ARRIVAL).size();
+        num_tags += node_tags;
+        max_node_tags = std::max(max_node_tags, node_tags);
+        num_data_arrival_tags += node_data_arrival_tags;
+        max_node_data_arrival_tags = std::max(max_node_data_arrival_tags, node_data_arrival_tags);
+    }
+    size_t num_nodes = std::max<size_t>(timing_ctx.graph->nodes().size(), 1);
+
+    VTR_LOG("%sanalyzed clock domain pairs: %zu of %zu\n", prefix.c_str(), num_analyzed_domain_pairs, num_domain_pairs);
+    VTR_LOG("%ssetup tags per node: %.2f average, %zu max (data arrival tags: %.2f average, %zu max)\n",
+            prefix.c_str(),
+            double(num_tags) / num_nodes, max_node_tags,
+            double(num_data_arrival_tags) / num_nodes, max_node_data_arrival_tags);
+}
+
 void print_setup_timing_summary(const tatum::TimingConstraints& constraints,
                                 const tatum::SetupTimingAnalyzer& setup_analyzer,
                                 std::string prefix,
@@ -362,6 +401,9 @@ void print_setup_timing_summary(const tatum::TimingConstraints& constraints,
                         sec_to_nanosec(path.slack()));
             }
         }
+        VTR_LOG("\n");
+
+        print_setup_tag_counts(constraints, setup_analyzer, prefix);
     }
 
     //Calculate the intra-domain (i.e. same launch and capture domain) non-virtual geomean, and fanout-weighted periods
@@ -2077,7 +2077,7 @@ void print_switch_usage() {
  * //int length = abs(rr_graph.node_xhigh(rr_id) + rr_graph.node_yhigh(rr_id)
  * //             - rr_graph.node_xlow(rr_id) - rr_graph.node_ylow(rr_id));
  * int length = device_ctx.rr_nodes[(size_t)rr_id].get_length();
- * if (rr_node_route_inf[(size_t)rr_id].occ() > 0) {
+ * if (rr_node_cong_inf[(size_t)rr_id].occ() > 0) {
  * if (used_wire_count.count(length) == 0)
  * used_wire_count[length] = 0;
  * used_wire_count[length] ++;
@@ -2422,7 +2422,7 @@ std::vector<int> get_cluster_netlist_intra_tile_pins_at_loc(const int layer,
                                                             const vtr::vector<ClusterBlockId, std::unordered_set<int>>& pin_chains_num,
                                                             t_physical_tile_type_ptr physical_type) {
     auto& place_ctx = g_vpr_ctx.placement();
-    auto grid_block = place_ctx.grid_blocks;
+    const auto& grid_block = place_ctx.grid_blocks;
 
     std::vector<int> pin_num_vec;
     pin_num_vec.reserve(get_tile_num_internal_pin(physical_type));
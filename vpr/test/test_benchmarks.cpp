@@ -0,0 +1,254 @@
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+
+#include "binary_heap.h"
+#include "compressed_grid.h"
+#include "four_ary_heap.h"
+#include "globals.h"
+#include "net_delay.h"
+#include "place_and_route.h"
+#include "radix_heap.h"
+#include "route_net.h"
+#include "timing_place_lookup.h"
+#include "vpr_api.h"
+#include "vpr_signal_handler.h"
+#include "vtr_random.h"
+
+/*
+ * Microbenchmarks of the data structures on VPR's hot paths.
+ *
+ * These are hidden test cases, so they are not run by default (or by ctest).
+ * Run them with:
+ *
+ *      test_vpr "[benchmark]"
+ */
+
+static constexpr const char kArchFile[] = "../../vtr_flow/arch/timing/k6_frac_N10_mem32K_40nm.xml";
+
+namespace {
+
+// Push elements with the given costs and pop them all, as when expanding a connection
+template<typename Heap>
+float push_pop_heap(Heap& heap, const std::vector<float>& costs) {
+    for (size_t i = 0; i < costs.size(); ++i) {
+        t_heap* item = heap.alloc();
+        item->cost = costs[i];
+        item->index = RRNodeId(i);
+        heap.add_to_heap(item);
+    }
+
+    float sum = 0.;
+    while (!heap.is_empty_heap()) {
+        t_heap* item = heap.get_heap_head();
+        sum += item->cost;
+        heap.free(item);
+    }
+    return sum;
+}
+
+// Route source_node to sink_node, returning the heap element of the sink (with a cost of infinity if unroutable)
+t_heap route_one_connection(ConnectionRouter<BinaryHeap>& router, RRNodeId source_node, RRNodeId sink_node, const t_router_opts& router_opts) {
+    auto& device_ctx = g_vpr_ctx.device();
+
+    t_bb bounding_box;
+    bounding_box.xmin = 0;
+    bounding_box.xmax = device_ctx.grid.width() + 1;
+    bounding_box.ymin = 0;
+    bounding_box.ymax = device_ctx.grid.height() + 1;
+    bounding_box.layer_min = 0;
+    bounding_box.layer_max = device_ctx.grid.get_num_layers() - 1;
+
+    t_conn_cost_params cost_params;
+    cost_params.criticality = router_opts.max_criticality;
+    cost_params.astar_fac = router_opts.astar_fac;
+    cost_params.bend_cost = router_opts.bend_cost;
+
+    RouteTree tree(source_node);
+    RouterStats router_stats;
+    ConnectionParameters conn_params(ParentNetId::INVALID(), -1, false, std::unordered_map<RRNodeId, int>());
+
+    bool found_path;
+    t_heap cheapest;
+    std::tie(found_path, std::ignore, cheapest) = router.timing_driven_route_connection_from_route_tree(tree.root(),
+                                                                                                        sink_node,
+                                                                                                        cost_params,
+                                                                                                        bounding_box,
+                                                                                                        router_stats,
+                                                                                                        conn_params);
+    if (!found_path) {
+        cheapest.cost = std::numeric_limits<float>::infinity();
+    }
+    return cheapest;
+}
+
+TEST_CASE("device data structures", "[.benchmark][vpr]") {
+    auto options = t_options();
+    auto arch = t_arch();
+    auto vpr_setup = t_vpr_setup();
+
+    vpr_install_signal_handler();
+    vpr_initialize_logging();
+
+    const char* argv[] = {
+        "test_vpr",
+        kArchFile,
+        "wire.eblif",
+        "--route_chan_width", "100"};
+    vpr_init(sizeof(argv) / sizeof(argv[0]), argv,
+             &options, &vpr_setup, &arch);
+
+    vpr_create_device_grid(vpr_setup, arch);
+    vpr_setup_clock_networks(vpr_setup, arch);
+    auto& router_opts = vpr_setup.RouterOpts;
+    t_graph_type graph_directionality;
+
+    if (router_opts.route_type == GLOBAL) {
+        graph_directionality = GRAPH_BIDIR;
+    } else {
+        graph_directionality = (vpr_setup.RoutingArch.directionality == BI_DIRECTIONAL ? GRAPH_BIDIR : GRAPH_UNIDIR);
+    }
+
+    auto chan_width = init_chan(router_opts.fixed_channel_width, arch.Chans, graph_directionality);
+
+    alloc_routing_structs(
+        chan_width,
+        router_opts,
+        &vpr_setup.RoutingArch,
+        vpr_setup.Segments,
+        arch.Directs,
+        arch.num_directs,
+        router_opts.flat_routing);
+
+    const auto& device_ctx = g_vpr_ctx.device();
+    const auto& rr_graph = device_ctx.rr_graph;
+
+    // From a small connection to a connection across a large device
+    {
+        vtr::RandState rand_state = 1;
+        for (size_t num_items : {1000, 100000}) {
+            std::vector<float> costs(num_items);
+            for (float& cost : costs) {
+                cost = vtr::irand(1000000, rand_state) * 1e-15;
+            }
+
+            BinaryHeap binary_heap;
+            binary_heap.init_heap(device_ctx.grid);
+            FourAryHeap four_ary_heap;
+            four_ary_heap.init_heap(device_ctx.grid);
+            RadixHeap radix_heap;
+            radix_heap.init_heap(device_ctx.grid);
+            std::string size = " (" + std::to_string(num_items) + " items)";
+
+            BENCHMARK("BinaryHeap push and pop" + size) {
+                return push_pop_heap(binary_heap, costs);
+            };
+
+            BENCHMARK("FourAryHeap push and pop" + size) {
+                return push_pop_heap(four_ary_heap, costs);
+            };
+
+            BENCHMARK("RadixHeap push and pop" + size) {
+                return push_pop_heap(radix_heap, costs);
+            };
+        }
+    }
+
+    BENCHMARK("RRGraphView edge iteration") {
+        size_t sum = 0;
+        for (RRNodeId node : rr_graph.nodes()) {
+            for (t_edge_size iedge = 0; iedge < rr_graph.num_edges(node); ++iedge) {
+                sum += size_t(rr_graph.edge_sink_node(node, iedge));
+            }
+        }
+        return sum;
+    };
+
+    BENCHMARK("RRGraphView node attributes") {
+        float sum = 0.;
+        for (RRNodeId node : rr_graph.nodes()) {
+            sum += rr_graph.node_xlow(node) + rr_graph.node_yhigh(node) + rr_graph.node_R(node) + rr_graph.node_C(node);
+        }
+        return sum;
+    };
+
+    // Pick random blocks of the most common block type, as the placer does when choosing swap targets
+    {
+        std::vector<t_compressed_block_grid> compressed_grids = create_compressed_block_grids();
+        const t_compressed_block_grid* compressed_grid = &compressed_grids[0];
+        for (const t_compressed_block_grid& grid : compressed_grids) {
+            if (!grid.get_layer_nums().empty() && grid.get_num_columns(0) * grid.get_num_rows(0) > compressed_grid->get_num_columns(0) * compressed_grid->get_num_rows(0)) {
+                compressed_grid = &grid;
+            }
+        }
+        REQUIRE(compressed_grid->get_num_columns(0) > 0);
+
+        vtr::RandState rand_state = 1;
+        BENCHMARK("t_compressed_block_grid picks") {
+            int sum = 0;
+            for (int ipick = 0; ipick < 10000; ++ipick) {
+                int cx = vtr::irand(compressed_grid->get_num_columns(0) - 1, rand_state);
+                const auto& column = compressed_grid->get_column_block_map(cx, 0);
+                auto itr = column.begin() + vtr::irand(column.size() - 1, rand_state);
+                t_physical_tile_loc grid_loc = compressed_grid->compressed_loc_to_grid_loc({cx, itr->first, 0});
+                sum += grid_loc.x + compressed_grid->grid_loc_to_compressed_loc(itr->second).y;
+            }
+            return sum;
+        };
+    }
+
+    // Rebuild the route tree of a connection across the device from the router's backtrace
+    {
+        RRNodeId source_node = RRNodeId::INVALID();
+        RRNodeId sink_node = RRNodeId::INVALID();
+        for (RRNodeId node : rr_graph.nodes()) {
+            if (rr_graph.node_type(node) == SOURCE && !source_node) {
+                source_node = node;
+            } else if (rr_graph.node_type(node) == SINK) {
+                sink_node = node;
+            }
+        }
+        REQUIRE(source_node);
+        REQUIRE(sink_node);
+
+        update_rr_base_costs(1);
+        auto router_lookahead = make_router_lookahead(vpr_setup.RoutingArch,
+                                                      router_opts.lookahead_type,
+                                                      router_opts.router_lookahead_half_precision,
+                                                      router_opts.write_router_lookahead,
+                                                      router_opts.read_router_lookahead,
+                                                      router_opts.router_lookahead_cache_dir,
+                                                      vpr_setup.Segments,
+                                                      router_opts.flat_routing);
+        ConnectionRouter<BinaryHeap> router(
+            device_ctx.grid,
+            *router_lookahead,
+            device_ctx.rr_graph.rr_nodes(),
+            &device_ctx.rr_graph,
+            device_ctx.rr_rc_data,
+            device_ctx.rr_graph.rr_switch(),
+            g_vpr_ctx.mutable_routing().rr_node_route_inf,
+            router_opts.flat_routing);
+
+        t_heap cheapest = route_one_connection(router, source_node, sink_node, router_opts);
+        REQUIRE(std::isfinite(cheapest.cost));
+
+        BENCHMARK("RouteTree update_from_heap") {
+            RouteTree tree(source_node);
+            vtr::optional<const RouteTreeNode&> rt_node_of_sink;
+            std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&cheapest, OPEN, nullptr, router_opts.flat_routing, router.get_rr_node_route_inf());
+            return rt_node_of_sink->Tdel;
+        };
+
+        router.reset_path_costs();
+    }
+
+    free_routing_structs();
+    vpr_free_all(arch,
+                 vpr_setup);
+
+    auto& atom_ctx = g_vpr_ctx.mutable_atom();
+    free_pack_molecules(atom_ctx.list_of_pack_molecules.release());
+    atom_ctx.atom_molecules.clear();
+}
+
+} // namespace
@@ -49,8 +49,10 @@ static float do_one_route(RRNodeId source_node,
     RouterStats router_stats;
     auto router_lookahead = make_router_lookahead(det_routing_arch,
                                                   router_opts.lookahead_type,
+                                                  router_opts.router_lookahead_half_precision,
                                                   router_opts.write_router_lookahead,
                                                   router_opts.read_router_lookahead,
+                                                  router_opts.router_lookahead_cache_dir,
                                                   segment_inf,
                                                   is_flat);
 
@@ -86,7 +88,7 @@ static float do_one_route(RRNodeId source_node,
 
         // Get the delay
         vtr::optional<const RouteTreeNode&> rt_node_of_sink;
-        std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&cheapest, OPEN, nullptr, router_opts.flat_routing);
+        std::tie(std::ignore, rt_node_of_sink) = tree.update_from_heap(&cheapest, OPEN, nullptr, router_opts.flat_routing, router.get_rr_node_route_inf());
         delay = rt_node_of_sink.value().Tdel;
     }
 
@@ -0,0 +1,100 @@
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/catch_approx.hpp"
+
+#include "multilevel_place.h"
+
+namespace {
+
+using Catch::Approx;
+
+// A netlist of num_nodes single-cluster nodes of type 0
+t_ml_netlist make_netlist(int num_nodes, const std::vector<std::vector<int>>& nets) {
+    t_ml_netlist netlist;
+    netlist.node_type.assign(num_nodes, 0);
+    netlist.node_weight.assign(num_nodes, 1);
+    netlist.net_nodes = nets;
+    netlist.net_weight.assign(nets.size(), 1.);
+    netlist.load_node_nets();
+    return netlist;
+}
+
+TEST_CASE("Multilevel placement coarsening", "[vpr]") {
+    // 4 pairs of nodes sharing 3 nets each, and a net along all the nodes
+    std::vector<std::vector<int>> nets;
+    for (int pair = 0; pair < 4; ++pair) {
+        for (int i = 0; i < 3; ++i) {
+            nets.push_back({2 * pair, 2 * pair + 1});
+        }
+    }
+    nets.push_back({0, 1, 2, 3, 4, 5, 6, 7});
+    t_ml_netlist netlist = make_netlist(8, nets);
+
+    vtr::RandState rand_state = 1;
+    std::vector<int> parents;
+    int num_parents = match_ml_nodes(netlist, {2}, parents, rand_state);
+    REQUIRE(num_parents == 4);
+    for (int pair = 0; pair < 4; ++pair) {
+        REQUIRE(parents[2 * pair] == parents[2 * pair + 1]);
+    }
+
+    // Only the net along all the nodes is left
+    t_ml_netlist coarse_netlist = contract_ml_netlist(netlist, parents, num_parents);
+    REQUIRE(coarse_netlist.num_nodes() == 4);
+    REQUIRE(coarse_netlist.num_nets() == 1);
+    REQUIRE(coarse_netlist.net_nodes[0].size() == 4);
+    for (int node = 0; node < 4; ++node) {
+        REQUIRE(coarse_netlist.node_weight[node] == 2);
+        REQUIRE(coarse_netlist.node_nets[node].size() == 1);
+    }
+
+    // Nodes heavier than the type's limit, or of different types, are not merged
+    REQUIRE(match_ml_nodes(coarse_netlist, {3}, parents, rand_state) == 4);
+    netlist.node_type = {0, 1, 0, 1, 0, 1, 0, 1};
+    match_ml_nodes(netlist, {2, 2}, parents, rand_state);
+    for (int node = 0; node < 8; ++node) {
+        for (int other = node + 1; other < 8; other += 2) {
+            REQUIRE(parents[node] != parents[other]);
+        }
+    }
+}
+
+TEST_CASE("Multilevel placement anneal", "[vpr]") {
+    // A chain of 16 nodes over 8x8 bins, each holding one node, except the bottom row
+    const int num_nodes = 16;
+    std::vector<std::vector<int>> nets;
+    for (int node = 0; node + 1 < num_nodes; ++node) {
+        nets.push_back({node, node + 1});
+    }
+    t_ml_netlist netlist = make_netlist(num_nodes, nets);
+
+    t_ml_bins bins;
+    bins.width = 8;
+    bins.height = 8;
+    bins.capacity.resize({1, size_t(bins.num_bins())}, 1);
+    for (int x = 0; x < bins.width; ++x) {
+        bins.capacity[0][bins.bin(x, 0)] = 0;
+    }
+
+    // Spread the chain's nodes far apart
+    std::vector<int> node_bins(num_nodes);
+    for (int node = 0; node < num_nodes; ++node) {
+        node_bins[node] = (node % 2) ? bins.bin(0, 1 + node / 2 % 7) : bins.bin(7, 7 - node / 2 % 7);
+    }
+    double overflow_weight = ml_overflow_weight(netlist);
+    double start_cost = ml_placement_cost(netlist, bins, node_bins, overflow_weight);
+
+    vtr::RandState rand_state = 1;
+    t_ml_anneal_params params;
+    params.rlim = 8;
+    double cost = anneal_ml_placement(netlist, bins, node_bins, params, rand_state);
+
+    REQUIRE(cost == Approx(ml_placement_cost(netlist, bins, node_bins, overflow_weight)));
+    REQUIRE(cost < start_cost / 2);
+    for (int node = 0; node < num_nodes; ++node) {
+        REQUIRE(bins.capacity[0][node_bins[node]] > 0);
+    }
+}
+
+} // namespace
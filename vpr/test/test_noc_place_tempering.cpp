@@ -0,0 +1,152 @@
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_floating_point.hpp"
+
+#include "noc_place_tempering.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+namespace {
+
+constexpr int MESH_SIZE = 4;
+constexpr int NUM_ROUTERS = 12;
+constexpr int NUM_FLOWS = 20;
+
+/**
+ * @brief Builds a MESH_SIZE x MESH_SIZE mesh with XY routing, NUM_ROUTERS logical
+ *        routers (router 0 fixed) and NUM_FLOWS random traffic flows between them.
+ */
+t_noc_tempering_model make_mesh_model(std::vector<int>& router_phy) {
+    t_noc_tempering_model model;
+    const int num_phy = MESH_SIZE * MESH_SIZE;
+
+    model.phy_at.resize({MESH_SIZE, MESH_SIZE}, -1);
+    for (int phy = 0; phy < num_phy; ++phy) {
+        model.phy_x.push_back(phy % MESH_SIZE);
+        model.phy_y.push_back(phy / MESH_SIZE);
+        model.phy_at[phy % MESH_SIZE][phy / MESH_SIZE] = phy;
+    }
+    model.phy_blocked.assign(num_phy, false);
+
+    // A link in each direction between neighbouring routers
+    std::map<std::pair<int, int>, int> links;
+    for (int phy = 0; phy < num_phy; ++phy) {
+        for (int neighbour : {phy + 1, phy + MESH_SIZE}) {
+            if ((neighbour == phy + 1 && model.phy_x[phy] == MESH_SIZE - 1) || neighbour >= num_phy) {
+                continue;
+            }
+            links[{phy, neighbour}] = model.link_bandwidth.size();
+            model.link_bandwidth.push_back(100.);
+            links[{neighbour, phy}] = model.link_bandwidth.size();
+            model.link_bandwidth.push_back(100.);
+        }
+    }
+
+    model.route_offsets.push_back(0);
+    for (int src = 0; src < num_phy; ++src) {
+        for (int sink = 0; sink < num_phy; ++sink) {
+            int curr = src;
+            while (curr != sink) {
+                int next = curr;
+                if (model.phy_x[curr] != model.phy_x[sink]) {
+                    next += (model.phy_x[curr] < model.phy_x[sink]) ? 1 : -1;
+                } else {
+                    next += (model.phy_y[curr] < model.phy_y[sink]) ? MESH_SIZE : -MESH_SIZE;
+                }
+                model.route_links.push_back(links.at({curr, next}));
+                curr = next;
+            }
+            size_t num_links = model.route_links.size() - model.route_offsets.back();
+            model.route_offsets.push_back(model.route_links.size());
+            model.route_latency.push_back(1. + num_links);
+        }
+    }
+
+    model.router_fixed.assign(NUM_ROUTERS, false);
+    model.router_fixed[0] = true;
+    model.router_legal_phy.assign(NUM_ROUTERS, {});
+
+    vtr::RandState rand_state = 1;
+    for (int flow = 0; flow < NUM_FLOWS; ++flow) {
+        int src = vtr::irand(NUM_ROUTERS - 1, rand_state);
+        int sink = (src + 1 + vtr::irand(NUM_ROUTERS - 2, rand_state)) % NUM_ROUTERS;
+        model.flows.push_back({src, sink, 20. + vtr::irand(60, rand_state), 1. + vtr::irand(2, rand_state), 3.});
+    }
+    model.load_router_flows();
+
+    model.aggregate_bandwidth_factor = 1e-3;
+    model.latency_factor = 1e-1;
+    model.latency_overrun_factor = 1.;
+    model.congestion_factor = 10.;
+
+    // Routers placed in order on the last physical routers, far from each other's traffic
+    router_phy.clear();
+    for (int router = 0; router < NUM_ROUTERS; ++router) {
+        router_phy.push_back(num_phy - 1 - router);
+    }
+
+    return model;
+}
+
+TEST_CASE("test_noc_tempering_incremental_costs", "[vpr_noc_place_tempering]") {
+    std::vector<int> router_phy;
+    const t_noc_tempering_model model = make_mesh_model(router_phy);
+
+    NocTemperingReplica replica(model, router_phy);
+    vtr::RandState rand_state = 7;
+
+    for (int imove = 0; imove < 2000; ++imove) {
+        int router, to_phy;
+        if (!replica.propose_move(MESH_SIZE, rand_state, router, to_phy)) {
+            continue;
+        }
+        REQUIRE(!model.router_fixed[router]);
+
+        double prev_cost = replica.cost();
+        double delta_cost = replica.apply_move(router, to_phy);
+        REQUIRE(replica.router_phy()[router] == to_phy);
+        REQUIRE_THAT(replica.cost(), Catch::Matchers::WithinRel(NocTemperingReplica(model, replica.router_phy()).cost(), 1e-9));
+        REQUIRE_THAT(prev_cost + delta_cost, Catch::Matchers::WithinRel(replica.cost(), 1e-9));
+
+        if (imove % 2) {
+            replica.commit_move();
+        } else {
+            std::vector<int> moved_router_phy = replica.router_phy();
+            replica.revert_move();
+            REQUIRE(replica.router_phy() != moved_router_phy);
+            REQUIRE(replica.cost() == prev_cost);
+            REQUIRE_THAT(replica.cost(), Catch::Matchers::WithinRel(NocTemperingReplica(model, replica.router_phy()).cost(), 1e-9));
+        }
+    }
+}
+
+TEST_CASE("test_noc_tempering_improves_placement", "[vpr_noc_place_tempering]") {
+    std::vector<int> router_phy;
+    const t_noc_tempering_model model = make_mesh_model(router_phy);
+    const std::vector<int> start_router_phy = router_phy;
+    const double start_cost = NocTemperingReplica(model, router_phy).cost();
+
+    t_noc_tempering_params params;
+    params.num_replicas = 4;
+    params.moves_per_replica = 5000;
+    params.moves_per_exchange = 100;
+
+    vtr::RandState rand_state = 3;
+    double cost = temper_noc_placement(model, router_phy, params, rand_state);
+
+    REQUIRE(cost < start_cost);
+    REQUIRE_THAT(cost, Catch::Matchers::WithinRel(NocTemperingReplica(model, router_phy).cost(), 1e-9));
+
+    // The placement is legal: the fixed router did not move, and no two routers share a physical router
+    REQUIRE(router_phy[0] == start_router_phy[0]);
+    REQUIRE(std::set<int>(router_phy.begin(), router_phy.end()).size() == router_phy.size());
+
+    // The result only depends on the seed
+    std::vector<int> rerun_router_phy = start_router_phy;
+    rand_state = 3;
+    REQUIRE(temper_noc_placement(model, rerun_router_phy, params, rand_state) == cost);
+    REQUIRE(rerun_router_phy == router_phy);
+}
+
+} // namespace
@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/catch_approx.hpp"
+
+#include "place_congestion.h"
+#include "vtr_random.h"
+
+namespace {
+
+using Catch::Approx;
+
+// A width x height device of a single tile type, with tracks tracks in every channel
+DeviceGrid make_grid(size_t width, size_t height, t_physical_tile_type& tile_type) {
+    vtr::NdMatrix<t_grid_tile, 3> tiles({1, width, height});
+    for (size_t x = 0; x < width; ++x) {
+        for (size_t y = 0; y < height; ++y) {
+            tiles[0][x][y].type = &tile_type;
+        }
+    }
+    return DeviceGrid("test", tiles);
+}
+
+t_chan_width make_chan_width(size_t width, size_t height, int tracks) {
+    t_chan_width chan_width;
+    chan_width.x_list.assign(height, tracks);
+    chan_width.y_list.assign(width, tracks);
+    return chan_width;
+}
+
+TEST_CASE("PlacerCongestionMap RUDY demand", "[vpr]") {
+    t_physical_tile_type tile_type;
+    const size_t width = 10;
+    const size_t height = 8;
+    DeviceGrid grid = make_grid(width, height, tile_type);
+
+    PlacerCongestionMap congestion_map;
+    congestion_map.init(grid, make_chan_width(width, height, 2));
+    REQUIRE(!congestion_map.empty());
+
+    // A 2x4 box with crossing count 4 uses 1 horizontal and 2 vertical tracks per tile:
+    // the vertical channels are at capacity, not over it
+    t_bb bb(2, 3, 1, 4, 0, 0);
+    congestion_map.add_net(bb, 4.);
+    congestion_map.update_utilization();
+    REQUIRE(congestion_map.max_utilization() == Approx(1.).margin(1e-6));
+    REQUIRE(congestion_map.overused_fraction() == 0.);
+    REQUIRE(congestion_map.net_congestion_cost(bb, 4.) == Approx(0.).margin(1e-9));
+
+    // A second copy doubles the use: each tile of the box is 1 track over in its chany
+    congestion_map.add_net(bb, 4.);
+    congestion_map.update_utilization();
+    REQUIRE(congestion_map.max_utilization() == Approx(2.).margin(1e-6));
+    REQUIRE(congestion_map.overused_fraction() == Approx(8. / (2 * width * height)).margin(1e-6));
+    REQUIRE(congestion_map.net_congestion_cost(bb, 4.) == Approx((2 + 4) * 4. * 8. / 8.).margin(1e-9));
+
+    // A box around the congested one only sees its average overuse
+    t_bb outer_bb(0, 5, 0, 7, 0, 0);
+    REQUIRE(congestion_map.net_congestion_cost(outer_bb, 1.) == Approx((6 + 8) * 8. / 48.).margin(1e-9));
+
+    // Boxes away from it are free
+    REQUIRE(congestion_map.net_congestion_cost(t_bb(5, 9, 0, 7, 0, 0), 1.) == Approx(0.).margin(1e-9));
+
+    // Removing the nets restores an empty map
+    congestion_map.remove_net(bb, 4.);
+    congestion_map.remove_net(bb, 4.);
+    congestion_map.update_utilization();
+    REQUIRE(congestion_map.max_utilization() == Approx(0.).margin(1e-6));
+}
+
+TEST_CASE("PlacerCongestionMap incremental updates", "[vpr]") {
+    t_physical_tile_type tile_type;
+    const size_t width = 12;
+    const size_t height = 9;
+    DeviceGrid grid = make_grid(width, height, tile_type);
+    t_chan_width chan_width = make_chan_width(width, height, 1);
+
+    vtr::RandState rand_state = 1;
+    auto random_bb = [&]() {
+        int x0 = vtr::irand(width - 1, rand_state);
+        int x1 = vtr::irand(width - 1, rand_state);
+        int y0 = vtr::irand(height - 1, rand_state);
+        int y1 = vtr::irand(height - 1, rand_state);
+        return t_bb(std::min(x0, x1), std::max(x0, x1), std::min(y0, y1), std::max(y0, y1), 0, 0);
+    };
+
+    // Moving nets around incrementally must give the same map as adding them from scratch
+    std::vector<t_bb> bbs;
+    PlacerCongestionMap incremental_map;
+    incremental_map.init(grid, chan_width);
+    for (int inet = 0; inet < 50; ++inet) {
+        bbs.push_back(random_bb());
+        incremental_map.add_net(bbs.back(), 1.5);
+    }
+    for (int imove = 0; imove < 500; ++imove) {
+        t_bb& bb = bbs[vtr::irand(bbs.size() - 1, rand_state)];
+        incremental_map.remove_net(bb, 1.5);
+        bb = random_bb();
+        incremental_map.add_net(bb, 1.5);
+    }
+    incremental_map.update_utilization();
+
+    PlacerCongestionMap scratch_map;
+    scratch_map.init(grid, chan_width);
+    for (const t_bb& bb : bbs) {
+        scratch_map.add_net(bb, 1.5);
+    }
+    scratch_map.update_utilization();
+
+    REQUIRE(incremental_map.max_utilization() == Approx(scratch_map.max_utilization()).margin(1e-4));
+    for (int ibb = 0; ibb < 20; ++ibb) {
+        t_bb bb = random_bb();
+        REQUIRE(incremental_map.net_congestion_cost(bb, 1.) == Approx(scratch_map.net_congestion_cost(bb, 1.)).margin(1e-4));
+    }
+}
+
+} // namespace
@@ -74,6 +74,7 @@ TEST_CASE("round_trip_override_delay_model", "[vpr]") {
     model.set_base_delay_model(std::move(base_model));
     model.set_delay_override(1, 2, 3, 4, 5, 6, -1);
     model.set_delay_override(2, 2, 3, 4, 5, 6, -2);
+    model.set_delay_override(1, 2, 3, 4, -1, 0, -3);
 
     model.write(kOverrideDelayBin);
 
@@ -100,6 +101,13 @@ TEST_CASE("round_trip_override_delay_model", "[vpr]") {
 
     CHECK(model2.get_delay_override(1, 2, 3, 4, 5, 6) == -1);
     CHECK(model2.get_delay_override(2, 2, 3, 4, 5, 6) == -2);
+    CHECK(model2.get_delay_override(1, 2, 3, 4, -1, 0) == -3);
+
+    //Keys without an override (including those in the range of the dense look-up)
+    CHECK_THROWS(model2.get_delay_override(1, 2, 3, 4, 0, 0));
+    CHECK_THROWS(model2.get_delay_override(1, 2, 3, 4, 5, 7));
+    CHECK_THROWS(model2.get_delay_override(1, 1, 3, 4, 5, 6));
+    CHECK_THROWS(model2.get_delay_override(3, 2, 1, 4, 5, 6));
 }
 #endif
 
@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "radix_heap.h"
+#include "vtr_random.h"
+
+namespace {
+
+// Pops all the items of heap, returning their costs
+std::vector<float> pop_all(RadixHeap& heap) {
+    std::vector<float> costs;
+    while (!heap.is_empty_heap()) {
+        t_heap* item = heap.get_heap_head();
+        costs.push_back(item->cost);
+        heap.free(item);
+    }
+    return costs;
+}
+
+TEST_CASE("RadixHeap exact order", "[vpr]") {
+    RadixHeap heap;
+    vtr::RandState rand_state = 1;
+
+    //Interleave pushes and pops, pushing some costs below the ones already popped
+    std::vector<float> pushed;
+    std::vector<float> popped;
+    float last_popped = 0.;
+    for (size_t i = 0; i < 10000; ++i) {
+        if (i % 3 == 2) {
+            t_heap* item = heap.get_heap_head();
+            REQUIRE(item != nullptr);
+            last_popped = item->cost;
+            popped.push_back(last_popped);
+            heap.free(item);
+        } else {
+            t_heap* item = heap.alloc();
+            item->cost = std::max(0.f, last_popped + (vtr::irand(1000, rand_state) - 100) * 1e-12f);
+            item->index = RRNodeId(i);
+            pushed.push_back(item->cost);
+            heap.add_to_heap(item);
+        }
+        REQUIRE(heap.is_valid());
+    }
+
+    //Every pop must have returned the cheapest item in the heap: replay with a sorted reference
+    std::vector<float> remaining = pop_all(heap);
+    REQUIRE(std::is_sorted(remaining.begin(), remaining.end()));
+    popped.insert(popped.end(), remaining.begin(), remaining.end());
+    REQUIRE(popped.size() == pushed.size());
+
+    std::vector<float> reference;
+    size_t ipushed = 0;
+    size_t ipopped = 0;
+    for (size_t i = 0; i < 10000; ++i) {
+        if (i % 3 == 2) {
+            auto cheapest = std::min_element(reference.begin(), reference.end());
+            REQUIRE(*cheapest == popped[ipopped++]);
+            reference.erase(cheapest);
+        } else {
+            reference.push_back(pushed[ipushed++]);
+        }
+    }
+    std::sort(reference.begin(), reference.end());
+    REQUIRE(std::equal(reference.begin(), reference.end(), popped.begin() + ipopped));
+}
+
+TEST_CASE("RadixHeap pruning", "[vpr]") {
+    RadixHeap heap;
+    heap.set_prune_limit(10, 50);
+
+    //Only the cheapest item of each index survives pruning
+    for (size_t i = 0; i < 200; ++i) {
+        t_heap* item = heap.alloc();
+        item->cost = 200. - i;
+        item->index = RRNodeId(i % 10);
+        heap.add_to_heap(item);
+    }
+
+    std::vector<float> costs = pop_all(heap);
+    REQUIRE(costs.size() <= 50);
+    REQUIRE(std::is_sorted(costs.begin(), costs.end()));
+    REQUIRE(costs.front() == 1.);
+}
+
+} // namespace
@@ -0,0 +1,40 @@
+#include <cmath>
+
+#include "catch2/catch_test_macros.hpp"
+
+#include "routing_predictor.h"
+
+namespace {
+
+TEST_CASE("routing_predictor_early_estimate", "[vpr]") {
+    RoutingPredictor converging;
+    RoutingPredictor stuck;
+
+    //No early estimate with too little history
+    converging.add_iteration_overuse(1, 100000);
+    stuck.add_iteration_overuse(1, 100000);
+    REQUIRE(std::isnan(converging.estimate_early_success_iteration()));
+
+    //Overuse halving every iteration converges, while flat overuse never does
+    size_t overuse = 10000;
+    for (size_t itry = 2; itry <= 1 + ROUTING_PREDICTOR_EARLY_MIN_HISTORY; ++itry) {
+        converging.add_iteration_overuse(itry, overuse);
+        stuck.add_iteration_overuse(itry, 10000 + itry);
+        overuse /= 2;
+    }
+
+    float converging_iteration = converging.estimate_early_success_iteration();
+    REQUIRE(converging_iteration > 1 + ROUTING_PREDICTOR_EARLY_MIN_HISTORY);
+    REQUIRE(converging_iteration < 30);
+    REQUIRE(std::isinf(stuck.estimate_early_success_iteration()));
+
+    //Once there is enough history the full estimate takes over
+    for (size_t itry = 2 + ROUTING_PREDICTOR_EARLY_MIN_HISTORY; itry <= 1 + converging.min_history(); ++itry) {
+        converging.add_iteration_overuse(itry, overuse);
+        overuse /= 2;
+    }
+    REQUIRE(std::isnan(converging.estimate_early_success_iteration()));
+    REQUIRE(!std::isnan(converging.estimate_success_iteration()));
+}
+
+} // namespace
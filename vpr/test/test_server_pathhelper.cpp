@@ -0,0 +1,33 @@
+#ifndef NO_SERVER
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_all.hpp"
+
+#include "pathhelper.h"
+
+namespace {
+
+const std::string REPORT_HEADER{"#Timing report of worst 2 path(s)\n\n"};
+const std::string PATH_0{"#Path 1\nStartpoint: a\nslack (VIOLATED) -1.0\n\n\n"};
+const std::string PATH_1{"#Path 2\nStartpoint: b\nslack (VIOLATED) -0.5\n\n\n"};
+const std::string PATH_1_CHANGED{"#Path 2\nStartpoint: c\nslack (VIOLATED) -0.4\n\n\n"};
+const std::string REPORT_END{"#End of timing report\n#RPT METADATA:\npath_index/clock_launch_path_elements_num/arrival_path_elements_num\n0/1/2\n1/1/2\n"};
+
+} // namespace
+
+TEST_CASE("test_server_pathhelper_get_report_paths", "[vpr]") {
+    std::vector<std::string> paths = server::get_report_paths(REPORT_HEADER + PATH_0 + PATH_1 + REPORT_END);
+
+    REQUIRE(paths == std::vector<std::string>{PATH_0, PATH_1});
+}
+
+TEST_CASE("test_server_pathhelper_make_delta_report", "[vpr]") {
+    const std::string prev_report{REPORT_HEADER + PATH_0 + PATH_1 + REPORT_END};
+    const std::string report{REPORT_HEADER + PATH_0 + PATH_1_CHANGED + REPORT_END};
+
+    std::string delta = server::make_delta_report(report, server::get_report_paths(report), server::get_report_paths(prev_report));
+
+    REQUIRE(delta == "#RPT DELTA\n" + REPORT_HEADER + "#Path 1 unchanged\n" + PATH_1_CHANGED + REPORT_END);
+}
+
+#endif /* NO_SERVER */
@@ -0,0 +1,90 @@
+#ifndef NO_SERVER
+
+#include "catch2/catch_test_macros.hpp"
+#include "catch2/matchers/catch_matchers_all.hpp"
+
+#include "progressframe.h"
+
+TEST_CASE("test_server_progressframe_roundtrip", "[vpr]") {
+    server::ProgressFrame frame;
+    frame.stage = server::ProgressFrame::Stage::ROUTING;
+    frame.iteration = 7;
+    frame.elapsed_sec = 1.5f;
+    frame.cpd = 3.25e-9f;
+    frame.pres_fac = 2.f;
+    frame.connections_routed = 1234;
+    frame.nets_routed = 56;
+    frame.heap_pushes = 1ull << 40;
+    frame.heap_pops = 999;
+    frame.overused_nodes = 12;
+    frame.total_overuse = 15;
+    frame.worst_overuse = 3;
+    frame.used_wirelength = 4000;
+    frame.available_wirelength = 9000;
+    frame.heatmap_width = 3;
+    frame.heatmap_height = 2;
+    frame.heatmap = {0, 10, 100, 150, 255, 42};
+
+    std::string data = server::encode_progress_frame(frame);
+    REQUIRE(data.substr(0, server::PROGRESS_FRAME_SIGNATURE.size()) == server::PROGRESS_FRAME_SIGNATURE);
+
+    std::optional<server::ProgressFrame> decoded = server::decode_progress_frame(data);
+    REQUIRE(decoded);
+    REQUIRE(decoded->stage == frame.stage);
+    REQUIRE(decoded->iteration == frame.iteration);
+    REQUIRE(decoded->elapsed_sec == frame.elapsed_sec);
+    REQUIRE(decoded->cpd == frame.cpd);
+    REQUIRE(decoded->pres_fac == frame.pres_fac);
+    REQUIRE(decoded->connections_routed == frame.connections_routed);
+    REQUIRE(decoded->nets_routed == frame.nets_routed);
+    REQUIRE(decoded->heap_pushes == frame.heap_pushes);
+    REQUIRE(decoded->heap_pops == frame.heap_pops);
+    REQUIRE(decoded->overused_nodes == frame.overused_nodes);
+    REQUIRE(decoded->total_overuse == frame.total_overuse);
+    REQUIRE(decoded->worst_overuse == frame.worst_overuse);
+    REQUIRE(decoded->used_wirelength == frame.used_wirelength);
+    REQUIRE(decoded->available_wirelength == frame.available_wirelength);
+    REQUIRE(decoded->heatmap_width == frame.heatmap_width);
+    REQUIRE(decoded->heatmap_height == frame.heatmap_height);
+    REQUIRE(decoded->heatmap == frame.heatmap);
+}
+
+TEST_CASE("test_server_progressframe_placement", "[vpr]") {
+    server::ProgressFrame frame;
+    frame.stage = server::ProgressFrame::Stage::PLACEMENT;
+    frame.iteration = 3;
+    frame.temperature = 0.125f;
+    frame.av_cost = 0.9f;
+    frame.av_bb_cost = 0.8f;
+    frame.av_timing_cost = 0.7f;
+    frame.success_rate = 0.44f;
+    frame.rlim = 5.f;
+
+    std::optional<server::ProgressFrame> decoded = server::decode_progress_frame(server::encode_progress_frame(frame));
+    REQUIRE(decoded);
+    REQUIRE(decoded->stage == frame.stage);
+    REQUIRE(decoded->temperature == frame.temperature);
+    REQUIRE(decoded->av_cost == frame.av_cost);
+    REQUIRE(decoded->av_bb_cost == frame.av_bb_cost);
+    REQUIRE(decoded->av_timing_cost == frame.av_timing_cost);
+    REQUIRE(decoded->success_rate == frame.success_rate);
+    REQUIRE(decoded->rlim == frame.rlim);
+    REQUIRE(decoded->heatmap.empty());
+}
+
+TEST_CASE("test_server_progressframe_invalid", "[vpr]") {
+    server::ProgressFrame frame;
+    frame.heatmap_width = 2;
+    frame.heatmap_height = 2;
+    frame.heatmap = {1, 2, 3, 4};
+    std::string data = server::encode_progress_frame(frame);
+
+    // JSON task responses are not progress frames
+    REQUIRE(!server::decode_progress_frame("{\"JOB_ID\":\"1\"}"));
+    // truncated frames are rejected
+    REQUIRE(!server::decode_progress_frame(std::string_view{data}.substr(0, data.size() - 1)));
+    REQUIRE(!server::decode_progress_frame(std::string_view{data}.substr(0, server::PROGRESS_FRAME_SIGNATURE.size() + 4)));
+    REQUIRE(server::decode_progress_frame(data));
+}
+
+#endif /* NO_SERVER */
@@ -16,6 +16,17 @@ TEST_CASE("test_server_telegramoptions", "[vpr]") {
     REQUIRE(options.get_bool("is_flat_routing", true) == false);
 }
 
+TEST_CASE("test_server_telegramoptions_optional_keys", "[vpr]") {
+    server::TelegramOptions options{"int:path_num:11;bool:is_delta_report:1", {"path_num"}};
+
+    REQUIRE(options.errors_str() == "");
+
+    REQUIRE(options.has_option("path_num"));
+    REQUIRE(options.has_option("is_delta_report"));
+    REQUIRE(!options.has_option("is_flat_routing"));
+    REQUIRE(options.get_bool("is_delta_report", false) == true);
+}
+
 TEST_CASE("test_server_telegramoptions_get_wrong_keys", "[vpr]") {
     server::TelegramOptions options{"int:path_num:11;string:path_type:debug;int:details_level:3;bool:is_flat_routing:0", {"_path_num", "_path_type", "_details_level", "_is_flat_routing"}};
 
@@ -232,6 +232,12 @@ TEST_CASE("read_rr_graph_metadata", "[vpr]") {
         auto* value = edge_meta.second.one(edge);
         REQUIRE(value != nullptr);
         CHECK_THAT(value->as_string().get(&arch.strings), Equals("test edge"));
+
+        // The same metadata through the per-edge look-up used by fasm
+        auto* indexed_value = vpr::rr_edge_metadata(device_ctx.rr_graph_builder, std::get<0>(edge_meta.first), std::get<1>(edge_meta.first), std::get<2>(edge_meta.first), edge);
+        REQUIRE(indexed_value != nullptr);
+        CHECK_THAT(indexed_value->as_string().get(&arch.strings), Equals("test edge"));
+        CHECK(vpr::rr_edge_metadata(device_ctx.rr_graph_builder, std::get<0>(edge_meta.first), std::get<1>(edge_meta.first), std::get<2>(edge_meta.first), node) == nullptr);
     }
     vpr_free_all(arch, vpr_setup);
 